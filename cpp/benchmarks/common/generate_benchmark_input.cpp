@@ -18,7 +18,13 @@
 #include "random_distribution_factory.hpp"
 
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/bit.hpp>
 
@@ -29,10 +35,14 @@
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <future>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <random>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -64,11 +74,14 @@ T get_distribution_mean(distribution_params<T> const& dist)
   }
 }
 
+size_t avg_element_bytes(data_profile const& profile, cudf::type_id tid);
+
 // Utilities to determine the mean size of an element, given the data profile
 template <typename T>
 std::enable_if_t<cudf::is_fixed_width<T>(), size_t> avg_element_size(data_profile const& profile)
 {
-  return sizeof(T);
+  // fixed-point columns only store the representation of their values
+  return cudf::size_of(cudf::data_type{cudf::type_to_id<T>()});
 }
 
 template <typename T>
@@ -89,10 +102,21 @@ size_t avg_element_size<cudf::list_view>(data_profile const& profile)
 {
   auto const dist_params       = profile.get_distribution_params<cudf::list_view>();
   auto const single_level_mean = get_distribution_mean(dist_params.length_params);
-  auto const element_size      = cudf::size_of(cudf::data_type{dist_params.element_type});
+  auto const element_size      = avg_element_bytes(profile, dist_params.element_type);
   return element_size * pow(single_level_mean, dist_params.max_depth);
 }
 
+template <>
+size_t avg_element_size<cudf::struct_view>(data_profile const& profile)
+{
+  auto const dist_params = profile.get_distribution_params<cudf::struct_view>();
+  auto const level_size  = std::accumulate(
+    dist_params.leaf_types.cbegin(), dist_params.leaf_types.cend(), 0ul, [&](auto sum, auto tid) {
+      return sum + avg_element_bytes(profile, tid);
+    });
+  return level_size * dist_params.max_depth;
+}
+
 struct avg_element_size_fn {
   template <typename T>
   size_t operator()(data_profile const& profile)
@@ -158,7 +182,10 @@ struct random_value_fn<T, typename std::enable_if_t<cudf::is_chrono<T>()>> {
 };
 
 /**
- * @brief Creates an random fixed_point value. Not implemented yet.
+ * @brief Creates an random fixed_point value, as the representation of the value.
+ *
+ * All the values share the same scale, which is drawn with the first value when not set by the
+ * profile.
  */
 template <typename T>
 struct random_value_fn<T, typename std::enable_if_t<cudf::is_fixed_point<T>()>> {
@@ -168,22 +195,29 @@ struct random_value_fn<T, typename std::enable_if_t<cudf::is_fixed_point<T>()>>
   distribution_fn<rep> dist;
   std::optional<numeric::scale_type> scale;
 
-  random_value_fn(distribution_params<rep> const& desc)
-    : lower_bound{desc.lower_bound},
-      upper_bound{desc.upper_bound},
-      dist{make_distribution<rep>(desc.id, desc.lower_bound, desc.upper_bound)}
+  random_value_fn(distribution_params<T> const& desc)
+    : lower_bound{std::min(desc.lower_bound, desc.upper_bound)},
+      upper_bound{std::max(desc.lower_bound, desc.upper_bound)},
+      dist{make_distribution<rep>(desc.id, desc.lower_bound, desc.upper_bound)},
+      scale{desc.scale}
   {
   }
 
-  T operator()(std::mt19937& engine)
+  numeric::scale_type get_scale(std::mt19937& engine)
   {
     if (not scale.has_value()) {
       int const max_scale = std::numeric_limits<rep>::digits10;
       auto scale_dist     = make_distribution<int>(distribution_id::NORMAL, -max_scale, max_scale);
       scale = numeric::scale_type{std::max(std::min(scale_dist(engine), max_scale), -max_scale)};
     }
+    return *scale;
+  }
+
+  rep operator()(std::mt19937& engine)
+  {
+    get_scale(engine);
     // Clamp the generated random value to the specified range
-    return T{std::max(std::min(dist(engine), upper_bound), lower_bound), *scale};
+    return std::max(std::min(dist(engine), upper_bound), lower_bound);
   }
 };
 
@@ -198,9 +232,10 @@ struct random_value_fn<
   T const upper_bound;
   distribution_fn<T> dist;
 
+  // The bounds are swapped for geometric distributions skewed towards the upper bound
   random_value_fn(distribution_params<T> const& desc)
-    : lower_bound{desc.lower_bound},
-      upper_bound{desc.upper_bound},
+    : lower_bound{std::min(desc.lower_bound, desc.upper_bound)},
+      upper_bound{std::max(desc.lower_bound, desc.upper_bound)},
       dist{make_distribution<T>(desc.id, desc.lower_bound, desc.upper_bound)}
   {
   }
@@ -261,6 +296,12 @@ struct stored_as<T, typename std::enable_if_t<std::is_same_v<T, bool>>> {
   using type = int8_t;
 };
 
+// Fixed-point columns store the representation of their values, and hold their scale in their type
+template <typename T>
+struct stored_as<T, typename std::enable_if_t<cudf::is_fixed_point<T>()>> {
+  using type = typename T::rep;
+};
+
 /**
  * @brief Creates a column with random content of type @ref T.
  *
@@ -282,7 +323,7 @@ std::unique_ptr<cudf::column> create_random_column(data_profile const& profile,
   auto valid_dist = std::bernoulli_distribution{1. - profile.get_null_frequency()};
   auto value_dist = random_value_fn<T>{profile.get_distribution_params<T>()};
 
-  auto const cardinality = std::min(num_rows, profile.get_cardinality());
+  auto const cardinality = std::min(num_rows, profile.get_cardinality(cudf::type_to_id<T>()));
   std::vector<stored_Type> samples(cardinality);
   std::vector<cudf::bitmask_type> samples_null_mask(null_mask_size(cardinality), ~0);
   for (cudf::size_type si = 0; si < cardinality; ++si) {
@@ -329,8 +370,15 @@ std::unique_ptr<cudf::column> create_random_column(data_profile const& profile,
                   cudaMemcpyHostToDevice,
                   rmm::cuda_stream_default);
 
+  auto const type = [&] {
+    if constexpr (cudf::is_fixed_point<T>()) {
+      return cudf::data_type{cudf::type_to_id<T>(), value_dist.get_scale(engine)};
+    } else {
+      return cudf::data_type{cudf::type_to_id<T>()};
+    }
+  }();
   return std::make_unique<cudf::column>(
-    cudf::data_type{cudf::type_to_id<T>()},
+    type,
     num_rows,
     rmm::device_buffer(data.data(), num_rows * sizeof(stored_Type), rmm::cuda_stream_default),
     std::move(result_bitmask));
@@ -411,16 +459,23 @@ std::unique_ptr<cudf::column> create_random_column<cudf::string_view>(data_profi
                                                                       std::mt19937& engine,
                                                                       cudf::size_type num_rows)
 {
-  auto char_dist = [&engine,  // range 32-127 is ASCII; 127-136 will be multi-byte UTF-8
-                    dist = std::uniform_int_distribution<unsigned char>{32, 137}]() mutable {
-    return dist(engine);
+  // range 32-126 is ASCII; 127-137 will be multi-byte UTF-8
+  auto char_dist = [&engine,
+                    dist           = std::uniform_int_distribution<unsigned char>{32, 137},
+                    ascii_dist     = std::uniform_int_distribution<unsigned char>{32, 126},
+                    multibyte_dist = std::uniform_int_distribution<unsigned char>{127, 137},
+                    multibyte_fraction = profile.get_multibyte_fraction()]() mutable {
+    if (not multibyte_fraction.has_value()) { return dist(engine); }
+    return std::bernoulli_distribution{*multibyte_fraction}(engine) ? multibyte_dist(engine)
+                                                                    : ascii_dist(engine);
   };
   auto len_dist =
     random_value_fn<uint32_t>{profile.get_distribution_params<cudf::string_view>().length_params};
   auto valid_dist = std::bernoulli_distribution{1. - profile.get_null_frequency()};
 
   auto const avg_string_len = avg_element_size<cudf::string_view>(profile);
-  auto const cardinality    = std::min(profile.get_cardinality(), num_rows);
+  auto const cardinality =
+    std::min(profile.get_cardinality(cudf::type_id::STRING), num_rows);
   string_column_data samples(cardinality, cardinality * avg_string_len);
   for (cudf::size_type si = 0; si < cardinality; ++si) {
     append_string(char_dist, valid_dist(engine), len_dist(engine), samples);
@@ -463,10 +518,7 @@ std::unique_ptr<cudf::column> create_random_column<cudf::dictionary32>(data_prof
 template <>
 std::unique_ptr<cudf::column> create_random_column<cudf::struct_view>(data_profile const& profile,
                                                                       std::mt19937& engine,
-                                                                      cudf::size_type num_rows)
-{
-  CUDF_FAIL("not implemented yet");
-}
+                                                                      cudf::size_type num_rows);
 
 /**
  * @brief Functor to dispatch create_random_column calls.
@@ -543,6 +595,69 @@ std::unique_ptr<cudf::column> create_random_column<cudf::list_view>(data_profile
   return list_column;  // return the top-level column
 }
 
+/**
+ * @brief Creates a random null mask in host memory, empty if no row is null.
+ *
+ * @return The null mask and the number of null rows
+ */
+std::pair<std::vector<cudf::bitmask_type>, cudf::size_type> create_random_null_mask(
+  cudf::size_type num_rows, double null_frequency, std::mt19937& engine)
+{
+  if (null_frequency <= 0) { return {{}, 0}; }
+  auto valid_dist = std::bernoulli_distribution{1. - null_frequency};
+  std::vector<cudf::bitmask_type> null_mask(null_mask_size(num_rows), ~0);
+  cudf::size_type null_count = 0;
+  for (cudf::size_type row = 0; row < num_rows; ++row) {
+    if (!valid_dist(engine)) {
+      cudf::clear_bit_unsafe(null_mask.data(), row);
+      ++null_count;
+    }
+  }
+  return {std::move(null_mask), null_count};
+}
+
+rmm::device_buffer to_device_null_mask(std::vector<cudf::bitmask_type> const& null_mask)
+{
+  return rmm::device_buffer(
+    null_mask.data(), null_mask.size() * sizeof(cudf::bitmask_type), rmm::cuda_stream_default);
+}
+
+/**
+ * @brief Creates a struct column with random content.
+ *
+ * The data profile determines the types of the leaf fields and the number of nested levels. The
+ * structs are generated bottom-up; each level holds its own leaf fields and the level below.
+ *
+ * @param profile Parameters for the random generator
+ * @param engine Pseudo-random engine
+ * @param num_rows Size of the output column
+ *
+ * @return Column filled with random structs
+ */
+template <>
+std::unique_ptr<cudf::column> create_random_column<cudf::struct_view>(data_profile const& profile,
+                                                                      std::mt19937& engine,
+                                                                      cudf::size_type num_rows)
+{
+  auto const dist_params = profile.get_distribution_params<cudf::struct_view>();
+
+  std::unique_ptr<cudf::column> struct_column;
+  for (int lvl = 0; lvl < dist_params.max_depth; ++lvl) {
+    std::vector<std::unique_ptr<cudf::column>> children;
+    for (auto const tid : dist_params.leaf_types) {
+      children.push_back(cudf::type_dispatcher(
+        cudf::data_type(tid), create_rand_col_fn{}, profile, engine, num_rows));
+    }
+    if (struct_column) { children.push_back(std::move(struct_column)); }
+
+    auto const [null_mask, null_count] =
+      create_random_null_mask(num_rows, profile.get_null_frequency(), engine);
+    struct_column = cudf::make_structs_column(
+      num_rows, std::move(children), null_count, to_device_null_mask(null_mask));
+  }
+  return struct_column;  // return the top-level column
+}
+
 using columns_vector = std::vector<std::unique_ptr<cudf::column>>;
 
 /**
@@ -641,6 +756,313 @@ std::unique_ptr<cudf::table> create_random_table(std::vector<cudf::type_id> cons
   return std::make_unique<cudf::table>(std::move(output_columns));
 }
 
+namespace {
+
+/**
+ * @brief Copies the validity of the rows of a column to host memory.
+ */
+std::vector<bool> host_validity(cudf::column_view const& col)
+{
+  std::vector<bool> valid(col.size(), true);
+  if (not col.nullable()) { return valid; }
+  auto const null_mask = cudf::detail::make_std_vector_sync(
+    cudf::device_span<cudf::bitmask_type const>(
+      col.null_mask(), cudf::num_bitmask_words(col.offset() + col.size())),
+    rmm::cuda_stream_default);
+  for (cudf::size_type row = 0; row < col.size(); ++row) {
+    valid[row] = cudf::bit_is_set(null_mask.data(), col.offset() + row);
+  }
+  return valid;
+}
+
+/**
+ * @brief Copies the elements of a fixed-width column to host memory, as values of type `T`.
+ */
+template <typename T>
+std::vector<T> host_values(cudf::column_view const& col)
+{
+  return cudf::detail::make_std_vector_sync(
+    cudf::device_span<T const>(col.data<T>(), col.size()), rmm::cuda_stream_default);
+}
+
+template <typename T>
+bool is_nan(T value)
+{
+  if constexpr (std::is_floating_point_v<T>) {
+    return std::isnan(value);
+  } else {
+    return false;
+  }
+}
+
+/**
+ * @brief Sets the null frequency, cardinality and average run length of the profile to those of
+ * the sampled rows.
+ *
+ * The cardinality is zero, i.e. each row is drawn independently, if all valid values are distinct.
+ */
+template <typename T>
+void set_row_stats(data_profile& profile,
+                   std::vector<T> const& values,
+                   std::vector<bool> const& valid)
+{
+  if (values.empty()) { return; }
+  std::vector<T> distinct;
+  size_t num_runs = 0;
+  for (size_t row = 0; row < values.size(); ++row) {
+    if (valid[row] and not is_nan(values[row])) { distinct.push_back(values[row]); }
+    if (row == 0 or valid[row] != valid[row - 1] or
+        (valid[row] and not(values[row] == values[row - 1]))) {
+      ++num_runs;
+    }
+  }
+  auto const num_valid = std::count(valid.cbegin(), valid.cend(), true);
+  std::sort(distinct.begin(), distinct.end());
+  auto const num_distinct =
+    std::distance(distinct.begin(), std::unique(distinct.begin(), distinct.end()));
+
+  profile.set_null_frequency(1. - static_cast<double>(num_valid) / values.size());
+  profile.set_cardinality(num_distinct == num_valid ? 0 : num_distinct);
+  profile.set_avg_run_length(
+    std::max<cudf::size_type>(1, std::round(static_cast<double>(values.size()) / num_runs)));
+}
+
+/**
+ * @brief Distribution fitted to sampled values. The bounds are swapped for geometric
+ * distributions skewed towards the upper bound.
+ */
+template <typename T>
+struct fitted_distribution {
+  distribution_id id;
+  T lower_bound;
+  T upper_bound;
+};
+
+/**
+ * @brief Fits a distribution to the valid values of a sample, ignoring NaNs.
+ *
+ * @return The fitted distribution, or an empty optional if there is no value to fit
+ */
+template <typename T>
+std::optional<fitted_distribution<T>> fit_distribution(std::vector<T> const& values,
+                                                       std::vector<bool> const& valid)
+{
+  std::optional<T> min;
+  std::optional<T> max;
+  double sum         = 0;
+  double sum_squares = 0;
+  size_t count       = 0;
+  for (size_t row = 0; row < values.size(); ++row) {
+    if (not valid[row] or is_nan(values[row])) { continue; }
+    auto const value = values[row];
+    min              = min.has_value() ? std::min(*min, value) : value;
+    max              = max.has_value() ? std::max(*max, value) : value;
+    sum += static_cast<double>(value);
+    sum_squares += static_cast<double>(value) * static_cast<double>(value);
+    ++count;
+  }
+  if (count == 0) { return std::nullopt; }
+
+  auto const range = static_cast<double>(*max) - static_cast<double>(*min);
+  if (range <= 0) { return {{distribution_id::UNIFORM, *min, *max}}; }
+  auto const mean          = sum / count;
+  auto const stddev        = std::sqrt(std::max(0., sum_squares / count - mean * mean));
+  auto const relative_mean = (mean - static_cast<double>(*min)) / range;
+  if (relative_mean < 0.3) { return {{distribution_id::GEOMETRIC, *min, *max}}; }
+  if (relative_mean > 0.7) { return {{distribution_id::GEOMETRIC, *max, *min}}; }
+  // The standard deviation of a uniform distribution is range / sqrt(12); that of the normal
+  // distribution of the generator is range / 6
+  auto const uniform_stddev = range / std::sqrt(12.);
+  auto const normal_stddev  = range / 6;
+  auto const id             = stddev > (uniform_stddev + normal_stddev) / 2
+                                ? distribution_id::UNIFORM
+                                : distribution_id::NORMAL;
+  return {{id, *min, *max}};
+}
+
+template <typename T>
+void set_value_distribution(data_profile& profile,
+                            cudf::type_id tid,
+                            std::vector<T> const& values,
+                            std::vector<bool> const& valid)
+{
+  if (auto const dist = fit_distribution(values, valid); dist.has_value()) {
+    profile.set_distribution_params(tid, dist->id, dist->lower_bound, dist->upper_bound);
+  }
+}
+
+/**
+ * @brief Functor that derives the data profile of a leaf column from a sample column.
+ */
+struct profile_from_sample_fn {
+  template <typename T>
+  data_profile operator()(cudf::column_view const& sample)
+  {
+    data_profile profile;
+    auto const tid   = sample.type().id();
+    auto const valid = host_validity(sample);
+    if constexpr (std::is_same_v<T, bool>) {
+      auto const values = host_values<typename stored_as<T>::type>(sample);
+      set_row_stats(profile, values, valid);
+      auto const num_valid = std::count(valid.cbegin(), valid.cend(), true);
+      size_t num_true      = 0;
+      for (size_t row = 0; row < values.size(); ++row) {
+        num_true += valid[row] and values[row] != 0;
+      }
+      if (num_valid > 0) {
+        profile.set_bool_probability(static_cast<double>(num_true) / num_valid);
+      }
+    } else if constexpr (cudf::is_fixed_point<T>()) {
+      auto const values = host_values<typename T::rep>(sample);
+      set_row_stats(profile, values, valid);
+      set_value_distribution(profile, tid, values, valid);
+      profile.set_decimal_scale(numeric::scale_type{sample.type().scale()});
+    } else if constexpr (cudf::is_chrono<T>()) {
+      auto const counts = host_values<typename T::rep>(sample);
+      set_row_stats(profile, counts, valid);
+      // The generator takes the bounds of timestamps and durations as 64-bit counts
+      std::vector<int64_t> const values(counts.cbegin(), counts.cend());
+      set_value_distribution(profile, tid, values, valid);
+    } else if constexpr (cudf::is_numeric<T>()) {
+      auto const values = host_values<T>(sample);
+      set_row_stats(profile, values, valid);
+      set_value_distribution(profile, tid, values, valid);
+    } else if constexpr (std::is_same_v<T, cudf::string_view>) {
+      cudf::strings_column_view const scv{sample};
+      auto const offsets = cudf::detail::make_std_vector_sync(
+        cudf::device_span<cudf::size_type const>(
+          scv.offsets().data<cudf::size_type>() + scv.offset(), scv.size() + 1),
+        rmm::cuda_stream_default);
+      auto const chars = cudf::detail::make_std_vector_sync(
+        cudf::device_span<char const>(scv.chars().data<char>() + offsets.front(),
+                                      offsets.back() - offsets.front()),
+        rmm::cuda_stream_default);
+      std::vector<std::string> values;
+      std::vector<uint32_t> lengths;
+      for (cudf::size_type row = 0; row < scv.size(); ++row) {
+        values.emplace_back(chars.data() + offsets[row] - offsets.front(),
+                            offsets[row + 1] - offsets[row]);
+        // The generator takes the lengths of strings in characters
+        lengths.push_back(std::count_if(values.back().cbegin(), values.back().cend(), [](char c) {
+          return (static_cast<uint8_t>(c) & 0xC0) != 0x80;
+        }));
+      }
+      set_row_stats(profile, values, valid);
+      set_value_distribution(profile, tid, lengths, valid);
+      auto const num_chars           = std::accumulate(lengths.cbegin(), lengths.cend(), 0ul);
+      auto const num_multibyte_chars = std::count_if(chars.cbegin(), chars.cend(), [](char c) {
+        return (static_cast<uint8_t>(c) & 0xC0) == 0xC0;
+      });
+      if (num_chars > 0) {
+        profile.set_multibyte_fraction(static_cast<double>(num_multibyte_chars) / num_chars);
+      }
+    } else {
+      CUDF_FAIL("Unsupported type of sample column");
+    }
+    return profile;
+  }
+};
+
+/**
+ * @brief Creates a column with random content that replicates the schema and the distributions of
+ * a sample column.
+ */
+std::unique_ptr<cudf::column> create_random_column_like(cudf::column_view const& sample,
+                                                        cudf::size_type num_rows,
+                                                        std::mt19937& engine)
+{
+  auto const valid     = host_validity(sample);
+  auto const num_valid = std::count(valid.cbegin(), valid.cend(), true);
+  auto const null_frequency =
+    sample.is_empty() ? 0. : 1. - static_cast<double>(num_valid) / valid.size();
+
+  if (sample.type().id() == cudf::type_id::LIST) {
+    // Replicate the lengths and the nulls of this level, then the child column they span
+    cudf::lists_column_view const lcv{sample};
+    auto const offsets = cudf::detail::make_std_vector_sync(
+      cudf::device_span<cudf::size_type const>(
+        lcv.offsets().data<cudf::size_type>() + lcv.offset(), lcv.size() + 1),
+      rmm::cuda_stream_default);
+    std::vector<uint32_t> lengths(lcv.size());
+    for (cudf::size_type row = 0; row < lcv.size(); ++row) {
+      lengths[row] = offsets[row + 1] - offsets[row];
+    }
+
+    auto const [null_mask, null_count] = create_random_null_mask(num_rows, null_frequency, engine);
+    auto const dist = fit_distribution(lengths, valid).value_or(
+      fitted_distribution<uint32_t>{distribution_id::UNIFORM, 0, 0});
+    auto len_dist = random_value_fn<uint32_t>{{dist.id, dist.lower_bound, dist.upper_bound}};
+    std::vector<cudf::size_type> out_offsets{0};
+    out_offsets.reserve(num_rows + 1);
+    for (cudf::size_type row = 0; row < num_rows; ++row) {
+      auto const is_valid = null_mask.empty() or cudf::bit_is_set(null_mask.data(), row);
+      out_offsets.push_back(out_offsets.back() + (is_valid ? len_dist(engine) : 0));
+    }
+
+    auto child = create_random_column_like(
+      lcv.get_sliced_child(rmm::cuda_stream_default), out_offsets.back(), engine);
+    auto offsets_column = std::make_unique<cudf::column>(
+      cudf::data_type{cudf::type_id::INT32},
+      out_offsets.size(),
+      rmm::device_buffer(out_offsets.data(),
+                         out_offsets.size() * sizeof(cudf::size_type),
+                         rmm::cuda_stream_default));
+    return cudf::make_lists_column(num_rows,
+                                   std::move(offsets_column),
+                                   std::move(child),
+                                   null_count,
+                                   to_device_null_mask(null_mask));
+  }
+
+  if (sample.type().id() == cudf::type_id::STRUCT) {
+    cudf::structs_column_view const scv{sample};
+    std::vector<std::unique_ptr<cudf::column>> children;
+    for (cudf::size_type i = 0; i < scv.num_children(); ++i) {
+      children.push_back(create_random_column_like(scv.get_sliced_child(i), num_rows, engine));
+    }
+    auto const [null_mask, null_count] = create_random_null_mask(num_rows, null_frequency, engine);
+    return cudf::make_structs_column(
+      num_rows, std::move(children), null_count, to_device_null_mask(null_mask));
+  }
+
+  CUDF_EXPECTS(sample.type().id() != cudf::type_id::DICTIONARY32,
+               "Dictionary columns cannot be replicated");
+  auto const profile = cudf::type_dispatcher(sample.type(), profile_from_sample_fn{}, sample);
+  return cudf::type_dispatcher(sample.type(), create_rand_col_fn{}, profile, engine, num_rows);
+}
+
+}  // namespace
+
+std::unique_ptr<cudf::table> create_random_table_like(cudf::table_view const& sample,
+                                                      row_count num_rows,
+                                                      unsigned seed)
+{
+  auto seed_engine = deterministic_engine(seed);
+  random_value_fn<unsigned> seed_dist(
+    {distribution_id::UNIFORM, 0, std::numeric_limits<unsigned>::max()});
+
+  columns_vector output_columns;
+  for (auto const& col : sample) {
+    // Each column has its own engine, so that its content does not depend on the other columns
+    auto col_engine = deterministic_engine(seed_dist(seed_engine));
+    output_columns.push_back(create_random_column_like(col, num_rows.count, col_engine));
+  }
+  return std::make_unique<cudf::table>(std::move(output_columns));
+}
+
+std::unique_ptr<cudf::table> create_random_table_like(std::string const& parquet_path,
+                                                      row_count num_rows,
+                                                      unsigned seed,
+                                                      cudf::size_type max_sample_rows)
+{
+  auto const read_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{parquet_path})
+      .num_rows(max_sample_rows)
+      .build();
+  auto const sample = cudf::io::read_parquet(read_opts);
+  return create_random_table_like(sample.tbl->view(), num_rows, seed);
+}
+
 std::vector<cudf::type_id> get_type_or_group(int32_t id)
 {
   // identity transformation when passing a concrete type_id
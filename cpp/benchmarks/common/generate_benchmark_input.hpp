@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,9 +16,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <map>
+#include <optional>
+#include <string>
+#include <vector>
 
+#include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 
 /**
@@ -173,9 +179,27 @@ struct distribution_params<T, typename std::enable_if_t<std::is_same_v<T, cudf::
   cudf::size_type max_depth;
 };
 
-// Present for compilation only. To be implemented once reader/writers support the fixed width type.
+/**
+ * @brief Fixed-point values are parameterized with a distribution type and bounds of their
+ * representation type, and the scale of the column, random when not set.
+ */
 template <typename T>
 struct distribution_params<T, typename std::enable_if_t<cudf::is_fixed_point<T>()>> {
+  distribution_id id;
+  typename T::rep lower_bound;
+  typename T::rep upper_bound;
+  std::optional<numeric::scale_type> scale;
+};
+
+/**
+ * @brief Structs are parameterized by the types of their leaf fields and their nesting level.
+ *
+ * Each level holds one field of each leaf type, plus the struct of the level below, if any.
+ */
+template <typename T>
+struct distribution_params<T, typename std::enable_if_t<std::is_same_v<T, cudf::struct_view>>> {
+  std::vector<cudf::type_id> leaf_types;
+  cudf::size_type max_depth;
 };
 
 /**
@@ -216,12 +240,17 @@ class data_profile {
   distribution_params<cudf::string_view> string_dist_desc{{distribution_id::NORMAL, 0, 32}};
   distribution_params<cudf::list_view> list_dist_desc{
     cudf::type_id::INT32, {distribution_id::GEOMETRIC, 0, 100}, 2};
+  distribution_params<cudf::struct_view> struct_dist_desc{
+    {cudf::type_id::INT32, cudf::type_id::FLOAT32, cudf::type_id::STRING}, 1};
   std::map<cudf::type_id, distribution_params<__uint128_t>> decimal_params;
+  std::optional<numeric::scale_type> decimal_scale;
+  std::optional<double> multibyte_fraction;
 
   double bool_probability        = 0.5;
   double null_frequency          = 0.01;
   cudf::size_type cardinality    = 2000;
   cudf::size_type avg_run_length = 4;
+  std::map<cudf::type_id, cudf::size_type> type_cardinality;
 
  public:
   template <
@@ -284,24 +313,43 @@ class data_profile {
     return list_dist_desc;
   }
 
+  template <typename T, std::enable_if_t<std::is_same_v<T, cudf::struct_view>>* = nullptr>
+  distribution_params<T> get_distribution_params() const
+  {
+    return struct_dist_desc;
+  }
+
   template <typename T, typename std::enable_if_t<cudf::is_fixed_point<T>()>* = nullptr>
-  distribution_params<typename T::rep> get_distribution_params() const
+  distribution_params<T> get_distribution_params() const
   {
     using rep = typename T::rep;
     auto it   = decimal_params.find(cudf::type_to_id<T>());
     if (it == decimal_params.end()) {
       auto const range = default_range<rep>();
-      return distribution_params<rep>{default_distribution_id<rep>(), range.first, range.second};
+      return {default_distribution_id<rep>(), range.first, range.second, decimal_scale};
     } else {
       auto& desc = it->second;
-      return {desc.id, static_cast<rep>(desc.lower_bound), static_cast<rep>(desc.upper_bound)};
+      return {desc.id,
+              static_cast<rep>(desc.lower_bound),
+              static_cast<rep>(desc.upper_bound),
+              decimal_scale};
     }
   }
 
   auto get_bool_probability() const { return bool_probability; }
   auto get_null_frequency() const { return null_frequency; };
   [[nodiscard]] auto get_cardinality() const { return cardinality; };
+  /**
+   * @brief Returns the cardinality of the columns of the given type, which is the cardinality set
+   * for the type if any, and the cardinality of all the types otherwise.
+   */
+  [[nodiscard]] cudf::size_type get_cardinality(cudf::type_id type) const
+  {
+    auto const it = type_cardinality.find(type);
+    return it == type_cardinality.end() ? cardinality : it->second;
+  }
   [[nodiscard]] auto get_avg_run_length() const { return avg_run_length; };
+  [[nodiscard]] auto get_multibyte_fraction() const { return multibyte_fraction; };
 
   // Users should pass integral values for bounds when setting the parameters for types that have
   // discrete distributions (integers, strings, lists). Otherwise the call with have no effect.
@@ -320,6 +368,10 @@ class data_profile {
       } else if (tid == cudf::type_id::LIST) {
         list_dist_desc.length_params = {
           dist, static_cast<uint32_t>(lower_bound), static_cast<uint32_t>(upper_bound)};
+      } else if (cudf::is_fixed_point(cudf::data_type{tid})) {
+        // the bounds are values of the representation type, whatever the scale
+        decimal_params[tid] = {
+          dist, static_cast<__uint128_t>(lower_bound), static_cast<__uint128_t>(upper_bound)};
       } else {
         int_params[tid] = {
           dist, static_cast<uint64_t>(lower_bound), static_cast<uint64_t>(upper_bound)};
@@ -346,10 +398,44 @@ class data_profile {
   void set_bool_probability(double p) { bool_probability = p; }
   void set_null_frequency(double f) { null_frequency = f; }
   void set_cardinality(cudf::size_type c) { cardinality = c; }
+  // Overrides the cardinality for the given types, e.g. to draw strings from fewer unique values
+  // than the integers of the same table
+  template <typename Type_enum>
+  void set_cardinality(Type_enum type_or_group, cudf::size_type c)
+  {
+    for (auto tid : get_type_or_group(static_cast<int32_t>(type_or_group))) {
+      type_cardinality[tid] = c;
+    }
+  }
   void set_avg_run_length(cudf::size_type avg_rl) { avg_run_length = avg_rl; }
 
   void set_list_depth(cudf::size_type max_depth) { list_dist_desc.max_depth = max_depth; }
   void set_list_type(cudf::type_id type) { list_dist_desc.element_type = type; }
+
+  // The scale of the generated decimal columns; random for each column when not set
+  void set_decimal_scale(numeric::scale_type scale) { decimal_scale = scale; }
+
+  // The fraction of the characters of strings encoded with two bytes in UTF-8; when not set, the
+  // characters are drawn uniformly from a range where about one in ten is multibyte
+  void set_multibyte_fraction(double f)
+  {
+    CUDF_EXPECTS(f >= 0. and f <= 1., "The multibyte fraction must be between 0 and 1");
+    multibyte_fraction = f;
+  }
+
+  void set_struct_depth(cudf::size_type max_depth)
+  {
+    CUDF_EXPECTS(max_depth > 0, "Structs need at least one level");
+    struct_dist_desc.max_depth = max_depth;
+  }
+  void set_struct_types(std::vector<cudf::type_id> const& types)
+  {
+    CUDF_EXPECTS(std::none_of(types.cbegin(),
+                              types.cend(),
+                              [](auto type) { return cudf::is_nested(cudf::data_type{type}); }),
+                 "The leaf fields of structs cannot be nested types");
+    struct_dist_desc.leaf_types = types;
+  }
 };
 
 /**
@@ -403,3 +489,48 @@ std::unique_ptr<cudf::table> create_random_table(std::vector<cudf::type_id> cons
                                                  row_count num_rows,
                                                  data_profile const& data_params = data_profile{},
                                                  unsigned seed                   = 1);
+
+/**
+ * @brief Deterministically generates a table that replicates the schema and the distributions of
+ * the columns of a sample table.
+ *
+ * Each leaf column is generated with a profile derived from its sample: the null frequency, the
+ * cardinality and the average run length of the values, the bounds and the shape of the
+ * distribution of the values, or of the lengths of the strings, the fraction of multibyte
+ * characters of strings and the scale of decimals. The lengths of lists and the nulls of lists and
+ * structs are replicated at each level, so nested columns keep the schema of the sample at any
+ * depth.
+ *
+ * The shape of a distribution is inferred from its mean and standard deviation: a mean in the
+ * lowest or highest 30% of the range gives a geometric distribution skewed to that end, and
+ * otherwise samples spread like a uniform distribution give a uniform one and narrower samples a
+ * normal one. Values that are all distinct in the sample are drawn independently for each row.
+ *
+ * @throws cudf::logic_error if the sample holds a dictionary column
+ *
+ * @param sample Table whose columns to replicate
+ * @param num_rows Number of rows of the generated table
+ * @param seed Seed for the pseudo-random generator
+ * @return A table with the column types of the sample, filled with random data
+ */
+std::unique_ptr<cudf::table> create_random_table_like(cudf::table_view const& sample,
+                                                      row_count num_rows,
+                                                      unsigned seed = 1);
+
+/**
+ * @brief Deterministically generates a table that replicates the schema and the distributions of
+ * the columns of a Parquet file.
+ *
+ * The distributions are those of the first `max_sample_rows` rows of the file, replicated as with
+ * the sample table overload.
+ *
+ * @param parquet_path Path of the Parquet file whose columns to replicate
+ * @param num_rows Number of rows of the generated table
+ * @param seed Seed for the pseudo-random generator
+ * @param max_sample_rows Maximum number of rows of the file to sample the distributions from
+ * @return A table with the column types of the file, filled with random data
+ */
+std::unique_ptr<cudf::table> create_random_table_like(std::string const& parquet_path,
+                                                      row_count num_rows,
+                                                      unsigned seed                   = 1,
+                                                      cudf::size_type max_sample_rows = 1'000'000);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -93,12 +93,13 @@ distribution_fn<T> make_distribution(distribution_id did, T lower_bound, T upper
       return [dist = make_uniform_dist(lower_bound, upper_bound)](
                std::mt19937& engine) mutable -> T { return dist(engine); };
     case distribution_id::GEOMETRIC:
+      // Samples are offsets from the lower bound, towards the upper bound
       return [lower_bound, upper_bound, dist = make_geometric_dist(lower_bound, upper_bound)](
                std::mt19937& engine) mutable -> T {
         if (lower_bound <= upper_bound)
-          return dist(engine);
+          return lower_bound + dist(engine);
         else
-          return lower_bound - dist(engine) + lower_bound;
+          return lower_bound - dist(engine);
       };
     default: CUDF_FAIL("Unsupported probability distribution");
   }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,8 @@
 #include <rmm/mr/device/pool_memory_resource.hpp>
 #include <rmm/mr/device/statistics_resource_adaptor.hpp>
 
+#include <memory>
+
 namespace cudf {
 
 namespace {
@@ -47,6 +49,13 @@ inline auto make_pool()
  * and finalize it, respectively. These methods are called automatically by
  * Google Benchmark
  *
+ * The allocations from the pool are tracked, and TearDown reports two counters:
+ * `peak_memory_usage`, the peak of the device memory allocated by the
+ * benchmark, inputs included, and `num_allocations`, the number of device
+ * allocations per iteration, setup allocations amortized over the iterations.
+ * A benchmark that sets its own `peak_memory_usage` counter, e.g. measured
+ * around its timed loop with `memory_stats_logger`, keeps it.
+ *
  * Example:
  *
  * template <class T>
@@ -71,13 +80,17 @@ class benchmark : public ::benchmark::Fixture {
   void SetUp(const ::benchmark::State& state) override
   {
     mr = make_pool();
-    rmm::mr::set_current_device_resource(mr.get());  // set default resource to pool
+    statistics_mr =
+      std::make_unique<rmm::mr::statistics_resource_adaptor<rmm::mr::device_memory_resource>>(
+        mr.get());
+    rmm::mr::set_current_device_resource(statistics_mr.get());  // set default resource to pool
   }
 
   void TearDown(const ::benchmark::State& state) override
   {
     // reset default resource to the initial resource
     rmm::mr::set_current_device_resource(nullptr);
+    statistics_mr.reset();
     mr.reset();
   }
 
@@ -85,10 +98,20 @@ class benchmark : public ::benchmark::Fixture {
   void SetUp(::benchmark::State& st) override { SetUp(const_cast<const ::benchmark::State&>(st)); }
   void TearDown(::benchmark::State& st) override
   {
+    // insert does not replace the counters the benchmark already set
+    st.counters.insert({"peak_memory_usage",
+                        ::benchmark::Counter(statistics_mr->get_bytes_counter().peak,
+                                             ::benchmark::Counter::kDefaults,
+                                             ::benchmark::Counter::OneK::kIs1024)});
+    st.counters.insert({"num_allocations",
+                        ::benchmark::Counter(statistics_mr->get_allocations_counter().total,
+                                             ::benchmark::Counter::kAvgIterations)});
     TearDown(const_cast<const ::benchmark::State&>(st));
   }
 
   std::shared_ptr<rmm::mr::device_memory_resource> mr;
+  std::unique_ptr<rmm::mr::statistics_resource_adaptor<rmm::mr::device_memory_resource>>
+    statistics_mr;
 };
 
 class memory_stats_logger {
@@ -107,6 +130,11 @@ class memory_stats_logger {
     return statistics_mr.get_bytes_counter().peak;
   }
 
+  [[nodiscard]] int64_t num_allocations() const noexcept
+  {
+    return statistics_mr.get_allocations_counter().total;
+  }
+
  private:
   rmm::mr::device_memory_resource* existing_mr;
   rmm::mr::statistics_resource_adaptor<rmm::mr::device_memory_resource> statistics_mr;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,11 +14,19 @@
  * limitations under the License.
  */
 
+#pragma once
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+
 #include <rmm/mr/device/cuda_memory_resource.hpp>
 #include <rmm/mr/device/owning_wrapper.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/mr/device/pool_memory_resource.hpp>
 
+#include <nvbench/nvbench.cuh>
+
+#include <optional>
+
 namespace cudf {
 
 /**
@@ -34,7 +42,7 @@ namespace cudf {
  *
  * void my_benchmark(nvbench::state& state) {
  * cudf::rmm_pool_raii pool_raii;
- * state.exec([](nvbench::launch& launch) {
+ * cudf::exec_with_memory_stats(state, nvbench::exec_tag::sync, [](nvbench::launch& launch) {
  *       // benchmark stuff
  *  });
  * }
@@ -68,4 +76,37 @@ class rmm_pool_raii {
   std::shared_ptr<rmm::mr::device_memory_resource> mr;
 };
 
+/**
+ * @brief Runs `launcher` with `state.exec()` and reports the device memory it allocates.
+ *
+ * Two summaries are added to the state: `peak_memory_usage`, the peak of the device memory
+ * allocated by the runs, and `num_allocations`, the number of device allocations of one run. Only
+ * the first run is counted, since the number of runs depends on the timings.
+ *
+ * @param state The state of the benchmark
+ * @param tag The execution tags passed to `state.exec()`
+ * @param launcher The benchmark, called with the `nvbench::launch` of each run
+ */
+template <typename ExecTags, typename Launcher>
+void exec_with_memory_stats(nvbench::state& state, ExecTags tag, Launcher&& launcher)
+{
+  memory_stats_logger mem_stats_logger;
+  std::optional<int64_t> num_allocations;
+  state.exec(tag, [&](nvbench::launch& launch) {
+    if (num_allocations.has_value()) {
+      launcher(launch);
+    } else {
+      memory_stats_logger run_stats_logger;
+      launcher(launch);
+      num_allocations = run_stats_logger.num_allocations();
+    }
+  });
+  state.add_buffer_size(
+    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "Peak Memory Usage");
+  auto& allocations = state.add_summary("num_allocations");
+  allocations.set_string("short_name", "Allocations");
+  allocations.set_string("description", "Device allocations of one run");
+  allocations.set_int64("value", num_allocations.value_or(0));
+}
+
 }  // namespace cudf
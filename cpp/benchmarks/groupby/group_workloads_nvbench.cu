@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/fixture/rmm_pool_raii.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/groupby.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <thrust/random.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Keys drawn from a Zipf distribution of exponent `skew` over `cardinality` keys.
+ *
+ * The ranks are drawn by inverting the continuous approximation of the Zipf distribution, as in
+ * the join benchmarks. A skew of zero draws the keys uniformly.
+ */
+struct key_generator {
+  int64_t cardinality;
+  double skew;
+  unsigned seed;
+
+  __device__ int64_t operator()(cudf::size_type i) const
+  {
+    thrust::default_random_engine engine(seed);
+    engine.discard(static_cast<unsigned long long>(i));
+    thrust::uniform_real_distribution<double> uniform(0., 1.);
+    auto const u = uniform(engine);
+    auto const n = static_cast<double>(cardinality + 1);
+    auto const x =
+      skew == 1. ? pow(n, u) : pow((pow(n, 1. - skew) - 1.) * u + 1., 1. / (1. - skew));
+    auto const rank = static_cast<int64_t>(x) - 1;
+    return rank < 0 ? 0 : rank >= cardinality ? cardinality - 1 : rank;
+  }
+};
+
+struct validity_generator {
+  double null_probability;
+  unsigned seed;
+
+  __device__ bool operator()(cudf::size_type i) const
+  {
+    thrust::default_random_engine engine(seed);
+    engine.discard(i);
+    thrust::uniform_real_distribution<double> uniform(0., 1.);
+    return uniform(engine) >= null_probability;
+  }
+};
+
+std::unique_ptr<cudf::column> make_int64_column(cudf::size_type num_rows)
+{
+  return cudf::make_numeric_column(
+    cudf::data_type{cudf::type_id::INT64}, num_rows, cudf::mask_state::UNALLOCATED);
+}
+
+void set_nulls(cudf::column& column, double null_probability, unsigned seed)
+{
+  if (null_probability == 0.) { return; }
+  auto validity = cudf::make_numeric_column(
+    cudf::data_type{cudf::type_id::BOOL8}, column.size(), cudf::mask_state::UNALLOCATED);
+  auto const d_validity = validity->mutable_view().data<bool>();
+  thrust::tabulate(rmm::exec_policy(rmm::cuda_stream_default),
+                   d_validity,
+                   d_validity + column.size(),
+                   validity_generator{null_probability, seed});
+  auto [null_mask, null_count] = cudf::bools_to_mask(validity->view());
+  column.set_null_mask(std::move(*null_mask), null_count);
+}
+
+/**
+ * @brief Generates a key column of `key_type` from Zipf distributed integer keys.
+ *
+ * The STRUCT keys have an INT64 child of the integer keys and a STRING child derived from them, so
+ * that they select the same groups as the other key types.
+ */
+std::unique_ptr<cudf::column> generate_keys(cudf::size_type num_rows,
+                                            std::string const& key_type,
+                                            int64_t cardinality,
+                                            double skew,
+                                            double null_probability)
+{
+  auto keys         = make_int64_column(num_rows);
+  auto const d_keys = keys->mutable_view().data<int64_t>();
+  thrust::tabulate(rmm::exec_policy(rmm::cuda_stream_default),
+                   d_keys,
+                   d_keys + num_rows,
+                   key_generator{cardinality, skew, 1234});
+
+  if (key_type == "STRING") {
+    keys = cudf::strings::from_integers(keys->view());
+  } else if (key_type == "STRUCT") {
+    std::vector<std::unique_ptr<cudf::column>> children;
+    children.push_back(cudf::strings::from_integers(keys->view()));
+    children.insert(children.begin(), std::move(keys));
+    keys = cudf::make_structs_column(num_rows, std::move(children), 0, {});
+  }
+  set_nulls(*keys, null_probability, 4321);
+  return keys;
+}
+
+/**
+ * @brief Returns the `index`th aggregation of the set `aggregations`.
+ *
+ * The "hash" set only has aggregations the hash groupby computes, the "sort" set only has
+ * aggregations it does not, and the "mixed" set alternates between the two.
+ */
+std::unique_ptr<cudf::groupby_aggregation> make_aggregation(std::string const& aggregations,
+                                                            std::size_t index)
+{
+  using agg = cudf::groupby_aggregation;
+  std::vector<std::unique_ptr<agg> (*)()> const hash_based{
+    [] { return cudf::make_sum_aggregation<agg>(); },
+    [] { return cudf::make_min_aggregation<agg>(); },
+    [] { return cudf::make_max_aggregation<agg>(); },
+    [] { return cudf::make_count_aggregation<agg>(); },
+    [] { return cudf::make_mean_aggregation<agg>(); },
+    [] { return cudf::make_variance_aggregation<agg>(); },
+    [] { return cudf::make_std_aggregation<agg>(); },
+    [] { return cudf::make_argmax_aggregation<agg>(); }};
+  std::vector<std::unique_ptr<agg> (*)()> const sort_based{
+    [] { return cudf::make_median_aggregation<agg>(); },
+    [] { return cudf::make_quantile_aggregation<agg>({0.9}); },
+    [] { return cudf::make_nth_element_aggregation<agg>(0); },
+    [] { return cudf::make_collect_list_aggregation<agg>(); },
+    [] { return cudf::make_collect_set_aggregation<agg>(); },
+    [] { return cudf::make_tdigest_aggregation<agg>(100); }};
+
+  if (aggregations == "hash") { return hash_based[index % hash_based.size()](); }
+  if (aggregations == "sort") { return sort_based[index % sort_based.size()](); }
+  CUDF_EXPECTS(aggregations == "mixed", "Unknown aggregation set");
+  return index % 2 == 0 ? hash_based[(index / 2) % hash_based.size()]()
+                        : sort_based[(index / 2) % sort_based.size()]();
+}
+
+/**
+ * @brief Returns the implementation `groupby::aggregate` dispatches `requests` to.
+ */
+std::string groupby_path(cudf::table_view const& keys,
+                         std::vector<cudf::groupby::aggregation_request> const& requests)
+{
+  if (cudf::groupby::detail::hash::can_use_hash_groupby(keys, requests)) { return "hash"; }
+  auto const any_hash_based = std::any_of(requests.begin(), requests.end(), [](auto const& r) {
+    return std::any_of(r.aggregations.begin(), r.aggregations.end(), [&r](auto const& a) {
+      return cudf::groupby::detail::hash::can_use_hash_aggregation(r.values, a->kind);
+    });
+  });
+  return any_hash_based ? "mixed" : "sort";
+}
+
+}  // namespace
+
+/**
+ * @brief Benchmarks a groupby of keys with the given cardinality and skew.
+ *
+ * The requested aggregations are taken in turn from the aggregation set, and each value column
+ * has one aggregation of every kind of the set at most. The implementation the groupby dispatches
+ * to is reported with the results, so that changes in the dispatch show up between releases.
+ */
+void nvbench_groupby_workload(nvbench::state& state)
+{
+  auto const num_rows         = static_cast<cudf::size_type>(state.get_int64("Num Rows"));
+  auto const cardinality      = state.get_int64("Cardinality");
+  auto const skew             = state.get_float64("Zipf Skew");
+  auto const key_type         = state.get_string("Key Type");
+  auto const null_probability = state.get_float64("Null Probability");
+  auto const aggregations     = state.get_string("Aggregations");
+  auto const num_aggregations = static_cast<std::size_t>(state.get_int64("Num Aggregations"));
+
+  // TODO: to be replaced by nvbench fixture once it's ready
+  cudf::rmm_pool_raii pool_raii;
+
+  auto const keys = generate_keys(num_rows, key_type, cardinality, skew, null_probability);
+  cudf::table_view const keys_table({keys->view()});
+
+  auto const kinds_per_column = aggregations == "hash" ? 8 : aggregations == "sort" ? 6 : 12;
+  std::vector<std::unique_ptr<cudf::column>> values;
+  std::vector<cudf::groupby::aggregation_request> requests;
+  for (std::size_t i = 0; i < num_aggregations; ++i) {
+    if (i % kinds_per_column == 0) {
+      values.push_back(make_int64_column(num_rows));
+      auto const d_values = values.back()->mutable_view().data<int64_t>();
+      thrust::tabulate(rmm::exec_policy(rmm::cuda_stream_default),
+                       d_values,
+                       d_values + num_rows,
+                       key_generator{1'000'000, 0., static_cast<unsigned>(values.size())});
+      set_nulls(*values.back(), null_probability, static_cast<unsigned>(5678 + values.size()));
+      requests.emplace_back();
+      requests.back().values = values.back()->view();
+    }
+    requests.back().aggregations.push_back(make_aggregation(aggregations, i));
+  }
+
+  auto& path = state.add_summary("Groupby Path");
+  path.set_string("short_name", "Path");
+  path.set_string("description", "Implementation the groupby dispatches to");
+  path.set_string("value", groupby_path(keys_table, requests));
+
+  state.add_element_count(num_rows, "Rows");
+
+  // The groupby runs on the default stream, which synchronizes with the stream of the launch
+  cudf::exec_with_memory_stats(state, nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    cudf::groupby::groupby gb_obj(keys_table);
+    auto const result = gb_obj.aggregate(requests);
+  });
+}
+
+// Group cardinality ----------------------------------------------------------------
+NVBENCH_BENCH(nvbench_groupby_workload)
+  .set_name("groupby_cardinality")
+  .add_int64_axis("Num Rows", {10'000'000, 100'000'000})
+  .add_int64_axis("Cardinality", {10, 1'000, 100'000, 10'000'000, 1'000'000'000})
+  .add_float64_axis("Zipf Skew", {0.})
+  .add_string_axis("Key Type", {"INT64"})
+  .add_float64_axis("Null Probability", {0.})
+  .add_string_axis("Aggregations", {"hash", "sort"})
+  .add_int64_axis("Num Aggregations", {1});
+
+// Key skew -------------------------------------------------------------------------
+NVBENCH_BENCH(nvbench_groupby_workload)
+  .set_name("groupby_skew")
+  .add_int64_axis("Num Rows", {100'000'000})
+  .add_int64_axis("Cardinality", {100'000, 10'000'000})
+  .add_float64_axis("Zipf Skew", {0., 0.5, 1., 1.5})
+  .add_string_axis("Key Type", {"INT64"})
+  .add_float64_axis("Null Probability", {0.})
+  .add_string_axis("Aggregations", {"hash", "sort"})
+  .add_int64_axis("Num Aggregations", {1});
+
+// Key types ------------------------------------------------------------------------
+NVBENCH_BENCH(nvbench_groupby_workload)
+  .set_name("groupby_keys")
+  .add_int64_axis("Num Rows", {10'000'000})
+  .add_int64_axis("Cardinality", {1'000, 1'000'000})
+  .add_float64_axis("Zipf Skew", {0.})
+  .add_string_axis("Key Type", {"INT64", "STRING", "STRUCT"})
+  .add_float64_axis("Null Probability", {0.})
+  .add_string_axis("Aggregations", {"hash", "sort"})
+  .add_int64_axis("Num Aggregations", {1});
+
+// Null density ---------------------------------------------------------------------
+NVBENCH_BENCH(nvbench_groupby_workload)
+  .set_name("groupby_nulls")
+  .add_int64_axis("Num Rows", {10'000'000})
+  .add_int64_axis("Cardinality", {1'000, 1'000'000})
+  .add_float64_axis("Zipf Skew", {0.})
+  .add_string_axis("Key Type", {"INT64", "STRING"})
+  .add_float64_axis("Null Probability", {0., 0.1, 0.5})
+  .add_string_axis("Aggregations", {"hash"})
+  .add_int64_axis("Num Aggregations", {4});
+
+// Number of aggregations -----------------------------------------------------------
+NVBENCH_BENCH(nvbench_groupby_workload)
+  .set_name("groupby_num_aggregations")
+  .add_int64_axis("Num Rows", {10'000'000})
+  .add_int64_axis("Cardinality", {1'000, 1'000'000})
+  .add_float64_axis("Zipf Skew", {0.})
+  .add_string_axis("Key Type", {"INT64"})
+  .add_float64_axis("Null Probability", {0.1})
+  .add_string_axis("Aggregations", {"hash", "mixed", "sort"})
+  .add_int64_axis("Num Aggregations", {1, 4, 16});
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,14 +16,22 @@
 
 #include <benchmarks/io/cuio_benchmark_common.hpp>
 
+#include <io/utilities/io_uring_reader.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
 #include <numeric>
 #include <string>
+#include <thread>
 
+#include <fcntl.h>
 #include <unistd.h>
 
 namespace cudf_io = cudf::io;
 
 temp_directory const cuio_source_sink_pair::tmpdir{"cudf_gbench"};
+temp_directory const cuio_benchmark_source::tmpdir{"cudf_nvbench"};
 
 std::string random_file_in_dir(std::string const& dir_path)
 {
@@ -60,6 +68,262 @@ cudf_io::sink_info cuio_source_sink_pair::make_sink_info()
   }
 }
 
+data_source_type parse_data_source_type(std::string const& name)
+{
+  if (name == "MMAP") return data_source_type::MMAP;
+  if (name == "IO_URING") return data_source_type::IO_URING;
+  if (name == "HOST_BUFFER") return data_source_type::HOST_BUFFER;
+  if (name == "REMOTE") return data_source_type::REMOTE;
+  CUDF_FAIL("Unknown data source type: " + name);
+}
+
+io_type parse_io_type(std::string const& name)
+{
+  if (name == "FILEPATH") return io_type::FILEPATH;
+  if (name == "HOST_BUFFER") return io_type::HOST_BUFFER;
+  if (name == "VOID") return io_type::VOID;
+  CUDF_FAIL("Unknown io type: " + name);
+}
+
+cudf_io::compression_type parse_compression_type(std::string const& name)
+{
+  if (name == "NONE") return cudf_io::compression_type::NONE;
+  if (name == "SNAPPY") return cudf_io::compression_type::SNAPPY;
+  if (name == "ZSTD") return cudf_io::compression_type::ZSTD;
+  if (name == "LZ4") return cudf_io::compression_type::LZ4;
+  CUDF_FAIL("Unknown compression type: " + name);
+}
+
+namespace {
+
+/**
+ * @brief Datasource forwarding the calls to another datasource, optionally hiding its device
+ * reads and waiting for a given latency before each host read call.
+ */
+class forwarding_source : public cudf_io::datasource {
+ public:
+  forwarding_source(std::unique_ptr<cudf_io::datasource>&& source,
+                    bool device_reads,
+                    std::chrono::microseconds latency)
+    : _source{std::move(source)}, _device_reads{device_reads}, _latency{latency}
+  {
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    wait();
+    return _source->host_read(offset, size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    wait();
+    return _source->host_read(offset, size, dst);
+  }
+
+  size_t host_read_v(cudf::host_span<read_request const> requests) override
+  {
+    // the ranges of a vectored read are requested concurrently, so they wait only once
+    wait();
+    return _source->host_read_v(requests);
+  }
+
+  [[nodiscard]] bool supports_device_read() const override
+  {
+    return _device_reads and _source->supports_device_read();
+  }
+
+  [[nodiscard]] bool is_device_read_preferred(size_t size) const override
+  {
+    return _device_reads and _source->is_device_read_preferred(size);
+  }
+
+  std::unique_ptr<buffer> device_read(size_t offset,
+                                      size_t size,
+                                      rmm::cuda_stream_view stream) override
+  {
+    return _source->device_read(offset, size, stream);
+  }
+
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override
+  {
+    return _source->device_read(offset, size, dst, stream);
+  }
+
+  std::future<size_t> device_read_async(size_t offset,
+                                        size_t size,
+                                        uint8_t* dst,
+                                        rmm::cuda_stream_view stream) override
+  {
+    return _source->device_read_async(offset, size, dst, stream);
+  }
+
+  std::future<size_t> device_read_v(cudf::host_span<read_request const> requests,
+                                    rmm::cuda_stream_view stream) override
+  {
+    return _source->device_read_v(requests, stream);
+  }
+
+  [[nodiscard]] size_t size() const override { return _source->size(); }
+
+ private:
+  void wait() const
+  {
+    if (_latency.count() > 0) { std::this_thread::sleep_for(_latency); }
+  }
+
+  std::unique_ptr<cudf_io::datasource> _source;
+  bool const _device_reads;
+  std::chrono::microseconds const _latency;
+};
+
+/**
+ * @brief Datasource reading a file on the host with batches of io_uring reads.
+ *
+ * Reads into device memory go through the datasource that the library creates for the file, so
+ * that they use cuFile when it is enabled.
+ */
+class io_uring_source : public cudf_io::datasource {
+ public:
+  explicit io_uring_source(std::string const& file_name)
+    : _file{cudf_io::datasource::create(file_name)},
+      _reader{cudf_io::detail::io_uring_reader::create(queue_depth)}
+  {
+    CUDF_EXPECTS(_reader != nullptr, "io_uring is not supported on this system");
+    _fd = open(file_name.c_str(), O_RDONLY);
+    CUDF_EXPECTS(_fd != -1, "Cannot open file " + file_name);
+  }
+
+  ~io_uring_source() override { close(_fd); }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    std::vector<uint8_t> v(std::min(size, _file->size() - offset));
+    host_read(offset, v.size(), v.data());
+    return buffer::create(std::move(v));
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    read_request const request{offset, size, dst};
+    return host_read_v({&request, 1});
+  }
+
+  size_t host_read_v(cudf::host_span<read_request const> requests) override
+  {
+    std::vector<cudf_io::detail::host_read_request> slices;
+    size_t total_read = 0;
+    for (auto const& request : requests) {
+      CUDF_EXPECTS(request.offset <= _file->size(), "Offset is past end of file");
+      auto const read_size = std::min(request.size, _file->size() - request.offset);
+      for (size_t slice = 0; slice < read_size; slice += max_slice_bytes) {
+        auto const slice_size = std::min(max_slice_bytes, read_size - slice);
+        slices.push_back({request.offset + slice, slice_size, request.dst + slice});
+      }
+      total_read += read_size;
+    }
+    _reader->read(_fd, slices);
+    return total_read;
+  }
+
+  [[nodiscard]] bool supports_device_read() const override
+  {
+    return _file->supports_device_read();
+  }
+
+  [[nodiscard]] bool is_device_read_preferred(size_t size) const override
+  {
+    return _file->is_device_read_preferred(size);
+  }
+
+  std::unique_ptr<buffer> device_read(size_t offset,
+                                      size_t size,
+                                      rmm::cuda_stream_view stream) override
+  {
+    return _file->device_read(offset, size, stream);
+  }
+
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override
+  {
+    return _file->device_read(offset, size, dst, stream);
+  }
+
+  std::future<size_t> device_read_async(size_t offset,
+                                        size_t size,
+                                        uint8_t* dst,
+                                        rmm::cuda_stream_view stream) override
+  {
+    return _file->device_read_async(offset, size, dst, stream);
+  }
+
+  [[nodiscard]] size_t size() const override { return _file->size(); }
+
+ private:
+  static constexpr unsigned queue_depth   = 64;
+  static constexpr size_t max_slice_bytes = 4 * 1024 * 1024;
+
+  std::unique_ptr<cudf_io::datasource> _file;
+  std::unique_ptr<cudf_io::detail::io_uring_reader> _reader;
+  int _fd = -1;
+};
+
+}  // namespace
+
+cuio_benchmark_source::cuio_benchmark_source(data_source_type type,
+                                             std::vector<char> const& data,
+                                             bool use_cufile,
+                                             std::chrono::microseconds latency)
+  : file_name{random_file_in_dir(tmpdir.path())}
+{
+  if (type == data_source_type::HOST_BUFFER) {
+    buffer = data;
+    source = cudf_io::datasource::create(cudf_io::host_buffer{buffer.data(), buffer.size()});
+    return;
+  }
+
+  std::ofstream file{file_name, std::ios::binary};
+  file.write(data.data(), data.size());
+  file.close();
+  CUDF_EXPECTS(file.good(), "Cannot write the benchmark input file");
+
+  switch (type) {
+    case data_source_type::MMAP:
+      source = std::make_unique<forwarding_source>(
+        cudf_io::datasource::create(file_name), use_cufile, std::chrono::microseconds{0});
+      break;
+    case data_source_type::IO_URING:
+      source = std::make_unique<forwarding_source>(
+        std::make_unique<io_uring_source>(file_name), use_cufile, std::chrono::microseconds{0});
+      break;
+    case data_source_type::REMOTE:
+      // object stores are read on the host only
+      source = std::make_unique<forwarding_source>(
+        cudf_io::datasource::create(file_name), false, latency);
+      break;
+    default: CUDF_FAIL("invalid data source type");
+  }
+}
+
+cuio_benchmark_source::~cuio_benchmark_source()
+{
+  // release the mapping of the file before deleting it
+  source.reset();
+  std::remove(file_name.c_str());
+}
+
+bool cuio_benchmark_source::supports_device_read() const { return source->supports_device_read(); }
+
+cudf_io::source_info cuio_benchmark_source::make_source_info()
+{
+  return cudf_io::source_info{source.get()};
+}
+
 std::vector<cudf::type_id> dtypes_for_column_selection(std::vector<cudf::type_id> const& data_types,
                                                        column_selection col_sel)
 {
@@ -101,6 +365,22 @@ std::vector<int> select_column_indexes(int num_cols, column_selection col_sel)
   return col_idxs;
 }
 
+std::vector<int> select_column_fraction(int num_cols, int group_size, double fraction)
+{
+  CUDF_EXPECTS(fraction > 0. and fraction <= 1., "The fraction of columns must be in (0, 1]");
+  auto const num_groups = (num_cols + group_size - 1) / group_size;
+  std::vector<int> col_idxs;
+  for (int group = 0; group < num_groups; ++group) {
+    // select the groups at which the count of selected groups reaches the next integer
+    if (std::floor((group + 1) * fraction) == std::floor(group * fraction)) { continue; }
+    auto const end = std::min(num_cols, (group + 1) * group_size);
+    for (auto col = group * group_size; col < end; ++col) {
+      col_idxs.push_back(col);
+    }
+  }
+  return col_idxs;
+}
+
 std::vector<std::string> select_column_names(std::vector<std::string> const& col_names,
                                              column_selection col_sel)
 {
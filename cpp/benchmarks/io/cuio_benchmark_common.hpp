@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,6 +22,11 @@
 
 #include <cudf_test/file_utilities.hpp>
 
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
 using cudf::io::io_type;
 
 #define RD_BENCHMARK_DEFINE_ALL_SOURCES(benchmark, name, type_or_group)                  \
@@ -74,6 +79,75 @@ class cuio_source_sink_pair {
   std::string const file_name;
 };
 
+/**
+ * @brief Storage backends that the nvbench cuIO benchmarks read from.
+ *
+ * `MMAP` reads a local file through the datasource the library creates for a file path, which
+ * memory maps the file unless `LIBCUDF_CUFILE_POLICY` or `LIBCUDF_IO_URING_POLICY` select another
+ * one. `IO_URING` reads a local file through batches of io_uring reads. `HOST_BUFFER` reads from
+ * host memory. `REMOTE` reads a local file on the host only, and waits for an injected latency
+ * before serving each read call, as an object store would.
+ */
+enum class data_source_type { MMAP, IO_URING, HOST_BUFFER, REMOTE };
+
+/**
+ * @brief Returns the storage backend with the given name, as used in the benchmark axes.
+ */
+data_source_type parse_data_source_type(std::string const& name);
+
+/**
+ * @brief Returns the sink or source type with the given name, as used in the benchmark axes.
+ */
+io_type parse_io_type(std::string const& name);
+
+/**
+ * @brief Returns the compression type with the given name, as used in the benchmark axes.
+ */
+cudf::io::compression_type parse_compression_type(std::string const& name);
+
+/**
+ * @brief Class to hold encoded data in a storage backend, along with the datasource reading it.
+ *
+ * The readers read through the datasource as a user-implemented one, so that the same datasource
+ * object, and the file mapping or io_uring queue it holds, is reused by all the reads.
+ */
+class cuio_benchmark_source {
+ public:
+  /**
+   * @brief Stores the data in the given backend.
+   *
+   * @throws cudf::logic_error if the backend is not available, e.g. io_uring is not supported
+   *
+   * @param type Storage backend to hold the data in
+   * @param data Encoded data
+   * @param use_cufile Whether reads into device memory may go through cuFile, if the library
+   * enables it; when false, the readers only make host reads
+   * @param latency Latency injected before each read call, only for a `REMOTE` backend
+   */
+  cuio_benchmark_source(data_source_type type,
+                        std::vector<char> const& data,
+                        bool use_cufile,
+                        std::chrono::microseconds latency);
+  ~cuio_benchmark_source();
+
+  /**
+   * @brief Returns whether the readers read directly into device memory from the source.
+   */
+  [[nodiscard]] bool supports_device_read() const;
+
+  /**
+   * @brief Creates a source info that reads through the datasource of the backend
+   */
+  cudf::io::source_info make_source_info();
+
+ private:
+  static temp_directory const tmpdir;
+
+  std::string const file_name;
+  std::vector<char> buffer;
+  std::unique_ptr<cudf::io::datasource> source;
+};
+
 /**
  * @brief Column selection strategy.
  */
@@ -107,6 +181,19 @@ std::vector<cudf::type_id> dtypes_for_column_selection(std::vector<cudf::type_id
  */
 std::vector<int> select_column_indexes(int num_cols, column_selection col_sel);
 
+/**
+ * @brief Selects a given fraction of the columns, spread evenly across the table.
+ *
+ * The columns are selected by groups of `group_size` consecutive columns, so that a table whose
+ * data types repeat with a period of `group_size` keeps the same mix of types in the selection.
+ *
+ * @param num_cols Number of columns of the table
+ * @param group_size Number of consecutive columns selected together
+ * @param fraction Fraction of the groups to select, in (0, 1]
+ * @return Indexes of the selected columns
+ */
+std::vector<int> select_column_fraction(int num_cols, int group_size, double fraction);
+
 /**
  * @brief Selects a subset of columns from the array of names, based on the input enumerator.
  */
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/fixture/rmm_pool_raii.hpp>
+#include <benchmarks/io/cuio_benchmark_common.hpp>
+
+#include <cudf/io/parquet.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr size_t data_size         = 512 << 20;
+constexpr cudf::size_type num_cols = 40;
+
+// The types repeat every five columns, so that selecting whole groups of five columns keeps the
+// mix of types of the table
+std::vector<cudf::type_id> const data_types{cudf::type_id::INT32,
+                                            cudf::type_id::INT64,
+                                            cudf::type_id::FLOAT64,
+                                            cudf::type_id::TIMESTAMP_MILLISECONDS,
+                                            cudf::type_id::STRING};
+
+}  // namespace
+
+/**
+ * @brief Benchmarks reading a Parquet file from a storage backend, in one call or in chunks.
+ *
+ * Every benchmark below reads all the axes, and fixes those it does not vary to a single value.
+ * The throughput is reported in bytes of the selected columns of the decoded table per second,
+ * along with the size of the file, the bytes the reader read from it and the peak memory
+ * allocated by the reads.
+ */
+void nvbench_parquet_read(nvbench::state& state)
+{
+  auto const compression      = parse_compression_type(state.get_string("Codec"));
+  auto const source_type      = parse_data_source_type(state.get_string("Source"));
+  auto const use_cufile       = state.get_string("cuFile") == "ON";
+  auto const fraction         = state.get_float64("Column Fraction");
+  auto const row_group_rows   = static_cast<cudf::size_type>(state.get_int64("Row Group Rows"));
+  auto const chunk_read_limit = static_cast<std::size_t>(state.get_int64("Chunk Read Limit"));
+  auto const latency          = std::chrono::microseconds{state.get_int64("Latency us")};
+
+  if (latency.count() > 0 and source_type != data_source_type::REMOTE) {
+    state.skip("Latency is only injected into remote sources.");
+    return;
+  }
+
+  // TODO: to be replaced by nvbench fixture once it's ready
+  cudf::rmm_pool_raii pool_raii;
+
+  auto const tbl  = create_random_table(data_types, num_cols, table_size_bytes{data_size});
+  auto const view = tbl->view();
+
+  std::vector<char> encoded;
+  cudf::io::parquet_writer_options const write_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{&encoded}, view)
+      .compression(compression)
+      .row_group_size_rows(row_group_rows);
+  try {
+    cudf::io::write_parquet(write_opts);
+  } catch (cudf::logic_error const& e) {
+    // e.g. the codec requires nvCOMP, which is disabled
+    state.skip(e.what());
+    return;
+  }
+
+  std::unique_ptr<cuio_benchmark_source> source;
+  try {
+    source = std::make_unique<cuio_benchmark_source>(source_type, encoded, use_cufile, latency);
+  } catch (cudf::logic_error const& e) {
+    state.skip(e.what());
+    return;
+  }
+  if (use_cufile and not source->supports_device_read()) {
+    state.skip("The source does not read into device memory.");
+    return;
+  }
+
+  cudf::io::parquet_reader_options const names_opts =
+    cudf::io::parquet_reader_options::builder(
+      cudf::io::source_info{encoded.data(), encoded.size()})
+      .num_rows(1);
+  auto const col_names = cudf::io::read_parquet(names_opts).metadata.column_names;
+  auto const group_size = static_cast<int>(data_types.size());
+  std::vector<std::string> cols_to_read;
+  for (auto const idx : select_column_fraction(num_cols, group_size, fraction)) {
+    cols_to_read.push_back(col_names[idx]);
+  }
+  cudf::io::parquet_reader_options read_opts =
+    cudf::io::parquet_reader_options::builder(source->make_source_info()).columns(cols_to_read);
+
+  // One profiled read, outside of the timed ones, counts the bytes that the reader reads
+  auto profile_opts = read_opts;
+  profile_opts.enable_profile(true);
+  auto const bytes_read = cudf::io::read_parquet(profile_opts).metadata.profile->bytes_read;
+
+  state.add_element_count(data_size * cols_to_read.size() / num_cols, "Bytes");
+
+  // The chunked reader has no stream parameter and runs on the default stream, which synchronizes
+  // with the stream of the launch
+  cudf::exec_with_memory_stats(state, nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    rmm::cuda_stream_view stream{launch.get_stream()};
+    if (chunk_read_limit == 0) {
+      auto const result = cudf::io::read_parquet(read_opts, stream);
+    } else {
+      auto const reader = cudf::io::chunked_parquet_reader(chunk_read_limit, read_opts);
+      while (reader.has_next()) {
+        auto const chunk = reader.read_chunk();
+      }
+    }
+  });
+  state.add_buffer_size(encoded.size(), "encoded_file_size", "Encoded File Size");
+  state.add_buffer_size(bytes_read, "bytes_read", "Bytes Read");
+}
+
+/**
+ * @brief Benchmarks writing a table into a Parquet sink.
+ *
+ * The throughput is reported in bytes of the input table per second, along with the size of the
+ * encoded file and the peak memory allocated by the writes.
+ */
+void nvbench_parquet_write(nvbench::state& state)
+{
+  auto const compression    = parse_compression_type(state.get_string("Codec"));
+  auto const sink_type      = parse_io_type(state.get_string("Sink"));
+  auto const row_group_rows = static_cast<cudf::size_type>(state.get_int64("Row Group Rows"));
+
+  // TODO: to be replaced by nvbench fixture once it's ready
+  cudf::rmm_pool_raii pool_raii;
+
+  auto const tbl  = create_random_table(data_types, num_cols, table_size_bytes{data_size});
+  auto const view = tbl->view();
+
+  // The size of the encoded file is measured, and the codec checked, before the timed writes
+  std::vector<char> encoded;
+  cudf::io::parquet_writer_options const size_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{&encoded}, view)
+      .compression(compression)
+      .row_group_size_rows(row_group_rows);
+  try {
+    cudf::io::write_parquet(size_opts);
+  } catch (cudf::logic_error const& e) {
+    state.skip(e.what());
+    return;
+  }
+
+  cuio_source_sink_pair source_sink(sink_type);
+  cudf::io::parquet_writer_options const write_opts =
+    cudf::io::parquet_writer_options::builder(source_sink.make_sink_info(), view)
+      .compression(compression)
+      .row_group_size_rows(row_group_rows);
+
+  state.add_element_count(data_size, "Bytes");
+
+  cudf::exec_with_memory_stats(state, nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    cudf::io::write_parquet(write_opts, rmm::cuda_stream_view{launch.get_stream()});
+  });
+  state.add_buffer_size(encoded.size(), "encoded_file_size", "Encoded File Size");
+}
+
+namespace {
+
+std::vector<std::string> const codecs{"NONE", "SNAPPY", "ZSTD", "LZ4"};
+std::vector<std::string> const sources{"MMAP", "IO_URING", "HOST_BUFFER", "REMOTE"};
+
+}  // namespace
+
+// Compression codec ----------------------------------------------------------------
+NVBENCH_BENCH(nvbench_parquet_read)
+  .set_name("parquet_read_codec")
+  .add_string_axis("Codec", codecs)
+  .add_string_axis("Source", {"HOST_BUFFER"})
+  .add_string_axis("cuFile", {"OFF"})
+  .add_float64_axis("Column Fraction", {1.})
+  .add_int64_axis("Row Group Rows", {1'000'000})
+  .add_int64_axis("Chunk Read Limit", {0})
+  .add_int64_axis("Latency us", {0});
+
+// Storage backend, with and without cuFile reads into device memory ----------------
+NVBENCH_BENCH(nvbench_parquet_read)
+  .set_name("parquet_read_source")
+  .add_string_axis("Codec", {"NONE", "SNAPPY"})
+  .add_string_axis("Source", sources)
+  .add_string_axis("cuFile", {"OFF", "ON"})
+  .add_float64_axis("Column Fraction", {1.})
+  .add_int64_axis("Row Group Rows", {1'000'000})
+  .add_int64_axis("Chunk Read Limit", {0})
+  .add_int64_axis("Latency us", {0});
+
+// Fraction of the columns read -----------------------------------------------------
+NVBENCH_BENCH(nvbench_parquet_read)
+  .set_name("parquet_read_column_selection")
+  .add_string_axis("Codec", {"SNAPPY"})
+  .add_string_axis("Source", {"MMAP", "REMOTE"})
+  .add_string_axis("cuFile", {"OFF"})
+  .add_float64_axis("Column Fraction", {1., 0.5, 0.25, 0.125})
+  .add_int64_axis("Row Group Rows", {1'000'000})
+  .add_int64_axis("Chunk Read Limit", {0})
+  .add_int64_axis("Latency us", {0});
+
+// Row group size -------------------------------------------------------------------
+NVBENCH_BENCH(nvbench_parquet_read)
+  .set_name("parquet_read_row_group_size")
+  .add_string_axis("Codec", {"SNAPPY"})
+  .add_string_axis("Source", {"MMAP"})
+  .add_string_axis("cuFile", {"OFF"})
+  .add_float64_axis("Column Fraction", {1.})
+  .add_int64_axis("Row Group Rows", {10'000, 100'000, 1'000'000})
+  .add_int64_axis("Chunk Read Limit", {0})
+  .add_int64_axis("Latency us", {0});
+
+// Budget of the chunked reader, where 0 reads the file in one call -----------------
+NVBENCH_BENCH(nvbench_parquet_read)
+  .set_name("parquet_read_chunked")
+  .add_string_axis("Codec", {"SNAPPY"})
+  .add_string_axis("Source", {"MMAP"})
+  .add_string_axis("cuFile", {"OFF"})
+  .add_float64_axis("Column Fraction", {1.})
+  .add_int64_axis("Row Group Rows", {100'000})
+  .add_int64_axis("Chunk Read Limit", {0, 32 << 20, 128 << 20, 512 << 20})
+  .add_int64_axis("Latency us", {0});
+
+// Latency of a remote source -------------------------------------------------------
+NVBENCH_BENCH(nvbench_parquet_read)
+  .set_name("parquet_read_remote")
+  .add_string_axis("Codec", {"SNAPPY"})
+  .add_string_axis("Source", {"REMOTE"})
+  .add_string_axis("cuFile", {"OFF"})
+  .add_float64_axis("Column Fraction", {1., 0.25})
+  .add_int64_axis("Row Group Rows", {100'000, 1'000'000})
+  .add_int64_axis("Chunk Read Limit", {0})
+  .add_int64_axis("Latency us", {0, 100, 1'000, 10'000});
+
+// Writer codec, sink and row group size --------------------------------------------
+NVBENCH_BENCH(nvbench_parquet_write)
+  .set_name("parquet_write")
+  .add_string_axis("Codec", codecs)
+  .add_string_axis("Sink", {"FILEPATH", "HOST_BUFFER", "VOID"})
+  .add_int64_axis("Row Group Rows", {100'000, 1'000'000});
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -29,6 +29,7 @@
 #include <cudf_test/column_wrapper.hpp>
 
 #include <fixture/benchmark_fixture.hpp>
+#include <fixture/rmm_pool_raii.hpp>
 #include <synchronization/synchronization.hpp>
 
 #include <vector>
@@ -121,7 +122,7 @@ static void BM_join(state_type& state, Join JoinFunc)
     }
   }
   if constexpr (std::is_same_v<state_type, nvbench::state> and (not is_conditional)) {
-    state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    cudf::exec_with_memory_stats(state, nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
       rmm::cuda_stream_view stream_view{launch.get_stream()};
       auto result = JoinFunc(probe_table,
                              build_table,
@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/fixture/rmm_pool_raii.hpp>
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/join.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/unary.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <thrust/random.h>
+#include <thrust/sequence.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Build side keys: `num_unique` distinct keys, each repeated `multiplicity` times.
+ *
+ * The keys are even, so that the probe rows generated without a match use odd keys.
+ */
+struct build_key_generator {
+  int64_t num_unique;
+
+  __device__ int64_t operator()(cudf::size_type i) const { return 2 * (i % num_unique); }
+};
+
+/**
+ * @brief Probe side keys: a fraction `selectivity` of the rows match a build key, drawn from a
+ * Zipf distribution of exponent `skew` over the build keys; the others match nothing.
+ *
+ * The ranks are drawn by inverting the continuous approximation of the Zipf distribution, so the
+ * generation does not need a table of the probabilities of the ranks. A skew of zero draws the
+ * build keys uniformly.
+ */
+struct probe_key_generator {
+  int64_t num_unique;
+  double selectivity;
+  double skew;
+  unsigned seed;
+
+  __device__ int64_t operator()(cudf::size_type i) const
+  {
+    thrust::default_random_engine engine(seed);
+    engine.discard(3 * static_cast<unsigned long long>(i));
+    thrust::uniform_real_distribution<double> uniform(0., 1.);
+    if (uniform(engine) >= selectivity) {
+      thrust::uniform_int_distribution<int64_t> keys(0, num_unique - 1);
+      return 2 * keys(engine) + 1;
+    }
+    auto const u = uniform(engine);
+    auto const n = static_cast<double>(num_unique + 1);
+    auto const x =
+      skew == 1. ? pow(n, u) : pow((pow(n, 1. - skew) - 1.) * u + 1., 1. / (1. - skew));
+    auto const rank = static_cast<int64_t>(x) - 1;
+    return 2 * (rank < 0 ? 0 : rank >= num_unique ? num_unique - 1 : rank);
+  }
+};
+
+struct validity_generator {
+  double null_probability;
+  unsigned seed;
+
+  __device__ bool operator()(cudf::size_type i) const
+  {
+    thrust::default_random_engine engine(seed);
+    engine.discard(i);
+    thrust::uniform_real_distribution<double> uniform(0., 1.);
+    return uniform(engine) >= null_probability;
+  }
+};
+
+/**
+ * @brief Generates a key table with `num_key_columns` columns and a payload column of the row
+ * indices, from the keys generated by `generator`.
+ *
+ * The second key column, if any, is a function of the first one, so that multi-column keys select
+ * the same rows as single-column keys.
+ */
+template <typename Generator>
+std::vector<std::unique_ptr<cudf::column>> generate_table(Generator generator,
+                                                          cudf::size_type num_rows,
+                                                          std::string const& key_type,
+                                                          cudf::size_type num_key_columns,
+                                                          double null_probability,
+                                                          unsigned seed)
+{
+  auto const stream = rmm::cuda_stream_default;
+  auto keys         = cudf::make_numeric_column(
+    cudf::data_type{cudf::type_id::INT64}, num_rows, cudf::mask_state::UNALLOCATED);
+  auto const d_keys = keys->mutable_view().data<int64_t>();
+  thrust::tabulate(rmm::exec_policy(stream), d_keys, d_keys + num_rows, generator);
+
+  auto second = cudf::make_numeric_column(
+    cudf::data_type{cudf::type_id::INT64}, num_rows, cudf::mask_state::UNALLOCATED);
+  auto const d_second = second->mutable_view().data<int64_t>();
+  thrust::transform(rmm::exec_policy(stream),
+                    d_keys,
+                    d_keys + num_rows,
+                    d_second,
+                    [] __device__(int64_t key) { return key / 3; });
+
+  auto convert = [&](std::unique_ptr<cudf::column> column) {
+    if (null_probability > 0.) {
+      auto validity = cudf::make_numeric_column(
+        cudf::data_type{cudf::type_id::BOOL8}, num_rows, cudf::mask_state::UNALLOCATED);
+      auto const d_validity = validity->mutable_view().data<bool>();
+      thrust::tabulate(rmm::exec_policy(stream),
+                       d_validity,
+                       d_validity + num_rows,
+                       validity_generator{null_probability, seed});
+      auto [null_mask, null_count] = cudf::bools_to_mask(validity->view());
+      column->set_null_mask(std::move(*null_mask), null_count);
+    }
+    if (key_type == "INT32") {
+      return cudf::cast(column->view(), cudf::data_type{cudf::type_id::INT32});
+    }
+    if (key_type == "STRING") { return cudf::strings::from_integers(column->view()); }
+    return column;
+  };
+
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(convert(std::move(keys)));
+  if (num_key_columns > 1) { columns.push_back(convert(std::move(second))); }
+
+  auto payload = cudf::make_numeric_column(
+    cudf::data_type{cudf::type_id::INT32}, num_rows, cudf::mask_state::UNALLOCATED);
+  auto const d_payload = payload->mutable_view().data<int32_t>();
+  thrust::sequence(rmm::exec_policy(stream), d_payload, d_payload + num_rows);
+  columns.push_back(std::move(payload));
+  return columns;
+}
+
+std::vector<cudf::column_view> views(std::vector<std::unique_ptr<cudf::column>> const& columns,
+                                     std::size_t begin,
+                                     std::size_t end)
+{
+  std::vector<cudf::column_view> result;
+  for (auto i = begin; i < end; ++i) {
+    result.push_back(columns[i]->view());
+  }
+  return result;
+}
+
+}  // namespace
+
+/**
+ * @brief Benchmarks a join of a probe table with skewed keys and a build table with repeated keys.
+ *
+ * Every benchmark below reads all the axes, and fixes those it does not vary to a single value.
+ * The throughput is reported in rows of both input tables per second, along with the peak memory
+ * allocated by the join.
+ */
+void nvbench_join_workload(nvbench::state& state)
+{
+  auto const build_rows       = static_cast<cudf::size_type>(state.get_int64("Build Table Size"));
+  auto const probe_rows       = static_cast<cudf::size_type>(state.get_int64("Probe Table Size"));
+  auto const join_type        = state.get_string("Join");
+  auto const key_type         = state.get_string("Key Type");
+  auto const key_columns      = static_cast<cudf::size_type>(state.get_int64("Key Columns"));
+  auto const skew             = state.get_float64("Zipf Skew");
+  auto const multiplicity     = state.get_int64("Multiplicity");
+  auto const selectivity      = state.get_float64("Selectivity");
+  auto const null_probability = state.get_float64("Null Probability");
+
+  if (build_rows > probe_rows) {
+    state.skip("Large build tables are skipped.");
+    return;
+  }
+  if (join_type == "conditional_inner" and (key_type == "STRING" or key_columns > 1)) {
+    state.skip("Conditional joins are benchmarked on single integer keys.");
+    return;
+  }
+
+  // TODO: to be replaced by nvbench fixture once it's ready
+  cudf::rmm_pool_raii pool_raii;
+
+  auto const num_unique = std::max<int64_t>(1, build_rows / multiplicity);
+  auto const build      = generate_table(
+    build_key_generator{num_unique}, build_rows, key_type, key_columns, null_probability, 1234);
+  auto const probe = generate_table(probe_key_generator{num_unique, selectivity, skew, 5678},
+                                    probe_rows,
+                                    key_type,
+                                    key_columns,
+                                    null_probability,
+                                    8765);
+  cudf::table_view const build_keys(views(build, 0, key_columns));
+  cudf::table_view const probe_keys(views(probe, 0, key_columns));
+  cudf::table_view const build_payload(views(build, key_columns, key_columns + 1));
+  cudf::table_view const probe_payload(views(probe, key_columns, key_columns + 1));
+  auto const compare_nulls = cudf::null_equality::UNEQUAL;
+
+  auto const left_key  = cudf::ast::column_reference(0);
+  auto const right_key = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto const keys_equal =
+    cudf::ast::operation(cudf::ast::ast_operator::EQUAL, left_key, right_key);
+  auto const payload_at_least =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, left_key, right_key);
+
+  state.add_element_count(static_cast<std::size_t>(build_rows) + probe_rows, "Rows");
+
+  // The joins without a stream parameter run on the default stream, which synchronizes with the
+  // stream of the launch
+  cudf::exec_with_memory_stats(state, nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    rmm::cuda_stream_view stream{launch.get_stream()};
+    if (join_type == "inner" or join_type == "left" or join_type == "full") {
+      cudf::hash_join const hash_table(build_keys, compare_nulls, stream);
+      if (join_type == "inner") {
+        auto const result = hash_table.inner_join(probe_keys, compare_nulls, std::nullopt, stream);
+      } else if (join_type == "left") {
+        auto const result = hash_table.left_join(probe_keys, compare_nulls, std::nullopt, stream);
+      } else {
+        auto const result = hash_table.full_join(probe_keys, compare_nulls, std::nullopt, stream);
+      }
+    } else if (join_type == "left_semi") {
+      auto const result = cudf::left_semi_join(probe_keys, build_keys, compare_nulls);
+    } else if (join_type == "left_anti") {
+      auto const result = cudf::left_anti_join(probe_keys, build_keys, compare_nulls);
+    } else if (join_type == "mixed_inner") {
+      auto const result = cudf::mixed_inner_join(
+        probe_keys, build_keys, probe_payload, build_payload, payload_at_least, compare_nulls);
+    } else if (join_type == "conditional_inner") {
+      auto const result = cudf::conditional_inner_join(probe_keys, build_keys, keys_equal);
+    } else {
+      CUDF_FAIL("Unknown join type");
+    }
+  });
+}
+
+namespace {
+
+std::vector<std::string> const hash_joins{"inner", "left", "full", "left_semi", "left_anti"};
+
+}  // namespace
+
+// Probe key skew -------------------------------------------------------------------
+NVBENCH_BENCH(nvbench_join_workload)
+  .set_name("join_skew")
+  .add_string_axis("Join", hash_joins)
+  .add_string_axis("Key Type", {"INT32"})
+  .add_int64_axis("Key Columns", {1})
+  .add_float64_axis("Zipf Skew", {0., 0.5, 1., 1.5})
+  .add_int64_axis("Multiplicity", {1})
+  .add_float64_axis("Selectivity", {0.3})
+  .add_float64_axis("Null Probability", {0.})
+  .add_int64_axis("Build Table Size", {100'000, 10'000'000})
+  .add_int64_axis("Probe Table Size", {10'000'000, 100'000'000});
+
+// Build key multiplicity -----------------------------------------------------------
+NVBENCH_BENCH(nvbench_join_workload)
+  .set_name("join_multiplicity")
+  .add_string_axis("Join", hash_joins)
+  .add_string_axis("Key Type", {"INT32"})
+  .add_int64_axis("Key Columns", {1})
+  .add_float64_axis("Zipf Skew", {0.})
+  .add_int64_axis("Multiplicity", {1, 4, 16, 64})
+  .add_float64_axis("Selectivity", {0.3})
+  .add_float64_axis("Null Probability", {0.})
+  .add_int64_axis("Build Table Size", {100'000, 10'000'000})
+  .add_int64_axis("Probe Table Size", {10'000'000});
+
+// Key types and multi-column keys --------------------------------------------------
+NVBENCH_BENCH(nvbench_join_workload)
+  .set_name("join_keys")
+  .add_string_axis("Join", hash_joins)
+  .add_string_axis("Key Type", {"INT32", "INT64", "STRING"})
+  .add_int64_axis("Key Columns", {1, 2})
+  .add_float64_axis("Zipf Skew", {0.})
+  .add_int64_axis("Multiplicity", {1})
+  .add_float64_axis("Selectivity", {0.3})
+  .add_float64_axis("Null Probability", {0.})
+  .add_int64_axis("Build Table Size", {1'000'000})
+  .add_int64_axis("Probe Table Size", {10'000'000});
+
+// Null density ---------------------------------------------------------------------
+NVBENCH_BENCH(nvbench_join_workload)
+  .set_name("join_nulls")
+  .add_string_axis("Join", hash_joins)
+  .add_string_axis("Key Type", {"INT32", "STRING"})
+  .add_int64_axis("Key Columns", {1})
+  .add_float64_axis("Zipf Skew", {0.})
+  .add_int64_axis("Multiplicity", {1})
+  .add_float64_axis("Selectivity", {0.3})
+  .add_float64_axis("Null Probability", {0., 0.1, 0.5})
+  .add_int64_axis("Build Table Size", {1'000'000})
+  .add_int64_axis("Probe Table Size", {10'000'000});
+
+// Output size, through the fraction of probe rows with a match ----------------------
+NVBENCH_BENCH(nvbench_join_workload)
+  .set_name("join_selectivity")
+  .add_string_axis("Join", hash_joins)
+  .add_string_axis("Key Type", {"INT32"})
+  .add_int64_axis("Key Columns", {1})
+  .add_float64_axis("Zipf Skew", {0.})
+  .add_int64_axis("Multiplicity", {1, 16})
+  .add_float64_axis("Selectivity", {0.01, 0.3, 1.})
+  .add_float64_axis("Null Probability", {0.})
+  .add_int64_axis("Build Table Size", {1'000'000})
+  .add_int64_axis("Probe Table Size", {10'000'000});
+
+// Mixed and conditional joins ------------------------------------------------------
+NVBENCH_BENCH(nvbench_join_workload)
+  .set_name("join_mixed_conditional")
+  .add_string_axis("Join", {"mixed_inner", "conditional_inner"})
+  .add_string_axis("Key Type", {"INT32"})
+  .add_int64_axis("Key Columns", {1})
+  .add_float64_axis("Zipf Skew", {0., 1.})
+  .add_int64_axis("Multiplicity", {1, 16})
+  .add_float64_axis("Selectivity", {0.3})
+  .add_float64_axis("Null Probability", {0., 0.1})
+  .add_int64_axis("Build Table Size", {10'000})
+  .add_int64_axis("Probe Table Size", {100'000});
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Benchmarks of the time to the first operation of each libcudf subsystem in a process.
+ *
+ * The first call pays for the creation of the CUDA context, the loading of the modules of the
+ * kernels it launches and the initialization of the subsystem, while the calls that follow reuse
+ * them. Each benchmark therefore runs a single iteration, and is only meaningful as the first one
+ * run in its process, as in:
+ *
+ *   STARTUP_BENCH --benchmark_filter=BM_first_regex
+ *
+ * Run with `CUDA_MODULE_LOADING=LAZY` (CUDA 11.7 or newer) to only load the modules of the kernels
+ * launched, rather than all the modules of libcudf when the context is created. The benchmarks
+ * use the default memory resource, since creating a pool is not part of the startup of libcudf.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/strings/contains.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Times a call of `op`, including the creation of its inputs and the synchronization of
+ * the default stream.
+ */
+template <typename Operation>
+void time_call(benchmark::State& state, Operation op)
+{
+  for (auto _ : state) {
+    auto const start = std::chrono::steady_clock::now();
+    op();
+    rmm::cuda_stream_default.synchronize();
+    auto const elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+    state.SetIterationTime(elapsed.count());
+  }
+}
+
+}  // namespace
+
+static void BM_first_kernel(benchmark::State& state)
+{
+  time_call(state, [] {
+    cudf::test::fixed_width_column_wrapper<int32_t> input{1, 2, 3, 4};
+    cudf::test::fixed_width_column_wrapper<int32_t> map{3, 2, 1, 0};
+    auto result = cudf::gather(cudf::table_view{{input}}, map);
+  });
+}
+
+static void BM_first_regex(benchmark::State& state)
+{
+  time_call(state, [] {
+    cudf::test::strings_column_wrapper input{"abc123", "def", "456ghi"};
+    auto result = cudf::strings::contains_re(cudf::strings_column_view(input), "[a-z]+\\d+");
+  });
+}
+
+static void BM_first_parquet(benchmark::State& state)
+{
+  time_call(state, [] {
+    cudf::test::fixed_width_column_wrapper<int64_t> ints{1, 2, 3, 4};
+    cudf::test::strings_column_wrapper strings{"a", "bb", "ccc", "dddd"};
+
+    std::vector<char> buffer;
+    auto const write_opts =
+      cudf::io::parquet_writer_options::builder(cudf::io::sink_info(&buffer),
+                                                cudf::table_view{{ints, strings}})
+        .compression(cudf::io::compression_type::SNAPPY);
+    cudf::io::write_parquet(write_opts);
+
+    auto const read_opts = cudf::io::parquet_reader_options::builder(
+      cudf::io::source_info(buffer.data(), buffer.size()));
+    auto result = cudf::io::read_parquet(read_opts);
+  });
+}
+
+static void BM_first_jit(benchmark::State& state)
+{
+  time_call(state, [] {
+    std::string const cuda = R"***(
+__device__ inline void square(float* output, float input) { *output = input * input; }
+)***";
+    cudf::test::fixed_width_column_wrapper<float> input{1, 2, 3, 4};
+    auto result = cudf::transform(input, cuda, cudf::data_type{cudf::type_id::FLOAT32}, false);
+  });
+}
+
+#define STARTUP_BENCHMARK_DEFINE(name) \
+  BENCHMARK(name)->Iterations(1)->UseManualTime()->Unit(benchmark::kMillisecond);
+
+STARTUP_BENCHMARK_DEFINE(BM_first_kernel)
+STARTUP_BENCHMARK_DEFINE(BM_first_regex)
+STARTUP_BENCHMARK_DEFINE(BM_first_parquet)
+STARTUP_BENCHMARK_DEFINE(BM_first_jit)
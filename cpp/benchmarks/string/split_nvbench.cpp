@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/fixture/rmm_pool_raii.hpp>
+#include <benchmarks/string/string_nvbench_common.hpp>
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/split/split.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+/**
+ * @brief Benchmarks splitting strings into tokens.
+ *
+ * The throughput is reported in bytes of characters of the input per second.
+ */
+void nvbench_string_split(nvbench::state& state)
+{
+  auto const api = state.get_string("API");
+
+  // TODO: to be replaced by nvbench fixture once it's ready
+  cudf::rmm_pool_raii pool_raii;
+
+  auto const column = create_strings_column_from_axes(state);
+  if (not column) { return; }
+  cudf::strings_column_view const input(column->view());
+
+  cudf::string_scalar const target("+");
+
+  state.add_global_memory_reads<nvbench::int8_t>(input.chars_size());
+
+  // The strings APIs run on the default stream, which synchronizes with the stream of the launch
+  cudf::exec_with_memory_stats(state, nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    if (api == "split") {
+      cudf::strings::split(input, target);
+    } else if (api == "split_ws") {
+      cudf::strings::split(input);
+    } else if (api == "record") {
+      cudf::strings::split_record(input, target);
+    } else {
+      cudf::strings::split_record(input);
+    }
+  });
+}
+
+// Length of the strings and its skew ----------------------------------------------
+NVBENCH_BENCH(nvbench_string_split)
+  .set_name("string_split_length")
+  .add_string_axis("API", {"split", "split_ws", "record", "record_ws"})
+  .add_int64_axis("Num Rows", {1'000'000})
+  .add_int64_axis("Avg Length", {8, 64, 512})
+  .add_string_axis("Length Skew", {"UNIFORM", "GEOMETRIC"})
+  .add_float64_axis("Multibyte Fraction", {0.})
+  .add_int64_axis("Cardinality", {0})
+  .add_float64_axis("Null Frequency", {0.});
+
+// ASCII or multibyte characters, and distinct strings -----------------------------
+NVBENCH_BENCH(nvbench_string_split)
+  .set_name("string_split_content")
+  .add_string_axis("API", {"split", "split_ws", "record", "record_ws"})
+  .add_int64_axis("Num Rows", {1'000'000})
+  .add_int64_axis("Avg Length", {64})
+  .add_string_axis("Length Skew", {"NORMAL"})
+  .add_float64_axis("Multibyte Fraction", {0., 0.1, 0.5})
+  .add_int64_axis("Cardinality", {0, 1'000})
+  .add_float64_axis("Null Frequency", {0.});
+
+// Null rows -----------------------------------------------------------------------
+NVBENCH_BENCH(nvbench_string_split)
+  .set_name("string_split_nulls")
+  .add_string_axis("API", {"split", "split_ws", "record", "record_ws"})
+  .add_int64_axis("Num Rows", {1'000'000})
+  .add_int64_axis("Avg Length", {64})
+  .add_string_axis("Length Skew", {"NORMAL"})
+  .add_float64_axis("Multibyte Fraction", {0.})
+  .add_int64_axis("Cardinality", {0})
+  .add_float64_axis("Null Frequency", {0., 0.1, 0.5});
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/string/string_nvbench_common.hpp>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+
+#include <cudf/utilities/error.hpp>
+
+#include <cmath>
+#include <limits>
+
+std::unique_ptr<cudf::column> create_strings_column_from_axes(nvbench::state& state)
+{
+  auto const num_rows           = static_cast<cudf::size_type>(state.get_int64("Num Rows"));
+  auto const avg_length         = state.get_int64("Avg Length");
+  auto const length_skew        = state.get_string("Length Skew");
+  auto const multibyte_fraction = state.get_float64("Multibyte Fraction");
+  auto const cardinality        = static_cast<cudf::size_type>(state.get_int64("Cardinality"));
+  auto const null_frequency     = state.get_float64("Null Frequency");
+
+  auto const expected_chars_size =
+    num_rows * avg_length * (1. + multibyte_fraction) * (1. - null_frequency);
+  if (expected_chars_size >= std::numeric_limits<cudf::size_type>::max()) {
+    state.skip("The characters exceed the size limit of a column.");
+    return nullptr;
+  }
+
+  data_profile profile;
+  if (length_skew == "GEOMETRIC") {
+    // 99% of the lengths are below the upper bound, so the mean is close to upper / ln(100)
+    auto const upper_bound = static_cast<int64_t>(std::ceil(avg_length * std::log(100.)));
+    profile.set_distribution_params(
+      cudf::type_id::STRING, distribution_id::GEOMETRIC, int64_t{0}, upper_bound);
+  } else {
+    CUDF_EXPECTS(length_skew == "UNIFORM" or length_skew == "NORMAL", "Unknown length skew");
+    auto const dist_id =
+      length_skew == "UNIFORM" ? distribution_id::UNIFORM : distribution_id::NORMAL;
+    profile.set_distribution_params(cudf::type_id::STRING, dist_id, int64_t{0}, 2 * avg_length);
+  }
+  profile.set_multibyte_fraction(multibyte_fraction);
+  profile.set_cardinality(cardinality);
+  profile.set_null_frequency(null_frequency);
+
+  auto table = create_random_table({cudf::type_id::STRING}, 1, row_count{num_rows}, profile);
+  return std::move(table->release().front());
+}
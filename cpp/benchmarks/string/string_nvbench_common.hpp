@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <memory>
+
+/**
+ * @brief Creates the strings column a strings benchmark runs on, from the axes shared by the
+ * strings benchmarks.
+ *
+ * The axes are:
+ * - "Num Rows": number of rows of the column
+ * - "Avg Length": average number of characters of the strings
+ * - "Length Skew": distribution of the lengths; "UNIFORM" and "NORMAL" spread the lengths between
+ *   zero and twice the average, "GEOMETRIC" gives mostly short strings with a long tail
+ * - "Multibyte Fraction": fraction of the characters encoded with two bytes in UTF-8
+ * - "Cardinality": number of distinct strings, where 0 draws every row independently
+ * - "Null Frequency": fraction of null rows
+ *
+ * The state is skipped if the characters of the column are expected to exceed the size limit of a
+ * column.
+ *
+ * @param state The state of the benchmark, holding the axes
+ * @return The strings column, or `nullptr` if the state is skipped
+ */
+std::unique_ptr<cudf::column> create_strings_column_from_axes(nvbench::state& state);
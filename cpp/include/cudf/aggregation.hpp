@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -91,7 +91,10 @@ class aggregation {
     COVARIANCE,      ///< covariance between two sets of elements
     CORRELATION,     ///< correlation between two sets of elements
     TDIGEST,         ///< create a tdigest from a set of input values
-    MERGE_TDIGEST    ///< create a tdigest by merging multiple tdigests together
+    MERGE_TDIGEST,   ///< create a tdigest by merging multiple tdigests together
+    HLL,             ///< create a HyperLogLog sketch from a set of input values
+    MERGE_HLL,       ///< create a HyperLogLog sketch by merging multiple sketches together
+    APPROX_NUNIQUE   ///< estimate the number of unique elements with a HyperLogLog sketch
   };
 
   aggregation() = delete;
@@ -598,5 +601,53 @@ std::unique_ptr<Base> make_tdigest_aggregation(int max_centroids = 1000);
 template <typename Base>
 std::unique_ptr<Base> make_merge_tdigest_aggregation(int max_centroids = 1000);
 
+/**
+ * @brief Factory to create a HLL aggregation
+ *
+ * Produces a HyperLogLog sketch ("HyperLogLog in Practice", Heule et al.) of the input values,
+ * from which the number of distinct values can be estimated with `cudf::hll_distinct_count`.
+ * Null values are ignored.
+ *
+ * The sketch column produced is a `LIST<UINT8>` column whose rows are made of the
+ * `2^precision` registers of one sketch. Sketches of the same precision can be merged with a
+ * MERGE_HLL aggregation.
+ *
+ * @param precision Base 2 logarithm of the number of registers of the sketches, in `[4, 18]`.
+ * The relative standard error of the distinct counts is about `1.04 / sqrt(2^precision)`, that
+ * is 0.81% for the default precision of 14, for sketches of 16KB.
+ *
+ * @returns A HLL aggregation object.
+ */
+template <typename Base = aggregation>
+std::unique_ptr<Base> make_hll_aggregation(int precision = 14);
+
+/**
+ * @brief Factory to create a MERGE_HLL aggregation
+ *
+ * Merges the sketches resulting from a previous `make_hll_aggregation` or
+ * `make_merge_hll_aggregation` into a sketch of the union of their values. The input
+ * sketches must all be of `precision`.
+ *
+ * @param precision Base 2 logarithm of the number of registers of the sketches, in `[4, 18]`.
+ *
+ * @returns A MERGE_HLL aggregation object.
+ */
+template <typename Base = aggregation>
+std::unique_ptr<Base> make_merge_hll_aggregation(int precision = 14);
+
+/**
+ * @brief Factory to create an APPROX_NUNIQUE aggregation
+ *
+ * `APPROX_NUNIQUE` returns an estimate of the number of distinct non-null values as an
+ * `INT64`, from a HyperLogLog sketch of the values. It is much cheaper than `NUNIQUE` on large
+ * inputs, in exchange for a relative standard error of about `1.04 / sqrt(2^precision)`.
+ *
+ * @param precision Base 2 logarithm of the number of registers of the sketches, in `[4, 18]`.
+ *
+ * @returns An APPROX_NUNIQUE aggregation object.
+ */
+template <typename Base = aggregation>
+std::unique_ptr<Base> make_approx_nunique_aggregation(int precision = 14);
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/ast/expressions.hpp>
+#include <cudf/detail/utilities/stream_capture.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -23,8 +24,12 @@
 #include <thrust/optional.h>
 
 #include <functional>
+#include <map>
+#include <memory>
 #include <numeric>
 #include <optional>
+#include <string>
+#include <vector>
 
 namespace cudf {
 namespace ast {
@@ -103,7 +108,7 @@ using IntermediateDataType = possibly_null_value_t<std::int64_t, has_nulls>;
  */
 struct expression_device_view {
   device_span<detail::device_data_reference const> data_references;
-  device_span<cudf::detail::fixed_width_scalar_device_view_base const> literals;
+  device_span<generic_scalar_device_view const> literals;
   device_span<ast_operator const> operators;
   device_span<cudf::size_type const> operator_source_indices;
   cudf::size_type num_intermediates;
@@ -120,6 +125,10 @@ struct expression_device_view {
  * the expressions and constructing vectors of information that are later used by the device for
  * evaluating the abstract syntax tree as a "linear" list of operators whose input dependencies are
  * resolved into intermediate data storage in shared memory.
+ *
+ * Subexpressions that only depend on literals are evaluated once by the parser and replaced by the
+ * literal of their result, and equivalent subexpressions are only evaluated once: the result of
+ * the first one stays in its intermediate storage location until its last use.
  */
 class expression_parser {
  public:
@@ -140,8 +149,10 @@ class expression_parser {
       _right{right},
       _expression_count{0},
       _intermediate_counter{},
-      _has_nulls(has_nulls)
+      _has_nulls(has_nulls),
+      _stream{stream}
   {
+    count_subexpressions(expr, true);
     expr.accept(*this);
     move_to_device(stream, mr);
   }
@@ -168,6 +179,28 @@ class expression_parser {
    */
   [[nodiscard]] cudf::data_type output_type() const;
 
+  /**
+   * @brief Get the data references of the plan, indexed by `operator_source_indices`.
+   */
+  [[nodiscard]] std::vector<detail::device_data_reference> const& data_references() const
+  {
+    return _data_references;
+  }
+
+  /**
+   * @brief Get the operators of the plan, in evaluation order.
+   */
+  [[nodiscard]] std::vector<ast_operator> const& operators() const { return _operators; }
+
+  /**
+   * @brief Get the indices of the data references of the operands and of the output of each
+   * operator, in evaluation order.
+   */
+  [[nodiscard]] std::vector<cudf::size_type> const& operator_source_indices() const
+  {
+    return _operator_source_indices;
+  }
+
   /**
    * @brief Visit a literal expression.
    *
@@ -270,9 +303,9 @@ class expression_parser {
       std::memcpy(h_data_buffer.data() + buffer_offsets[i], data_pointers[i], sizes[i]);
     }
 
-    _device_data_buffer = rmm::device_buffer(h_data_buffer.data(), buffer_size, stream, mr);
-
-    stream.synchronize();
+    _device_data_buffer = rmm::device_buffer(buffer_size, stream, mr);
+    cudf::detail::copy_host_to_device(
+      _device_data_buffer.data(), h_data_buffer.data(), buffer_size, stream);
 
     // Create device pointers to components of plan
     auto device_data_buffer_ptr            = static_cast<char const*>(_device_data_buffer.data());
@@ -280,11 +313,10 @@ class expression_parser {
       reinterpret_cast<detail::device_data_reference const*>(device_data_buffer_ptr +
                                                              buffer_offsets[0]),
       _data_references.size());
-    device_expression_data.literals =
-      device_span<cudf::detail::fixed_width_scalar_device_view_base const>(
-        reinterpret_cast<cudf::detail::fixed_width_scalar_device_view_base const*>(
-          device_data_buffer_ptr + buffer_offsets[1]),
-        _literals.size());
+    device_expression_data.literals = device_span<generic_scalar_device_view const>(
+      reinterpret_cast<generic_scalar_device_view const*>(device_data_buffer_ptr +
+                                                          buffer_offsets[1]),
+      _literals.size());
     device_expression_data.operators = device_span<ast_operator const>(
       reinterpret_cast<ast_operator const*>(device_data_buffer_ptr + buffer_offsets[2]),
       _operators.size());
@@ -322,6 +354,42 @@ class expression_parser {
    */
   cudf::size_type add_data_reference(detail::device_data_reference data_ref);
 
+  /**
+   * @brief Returns a key that is the same for the expressions that evaluate to the same values.
+   */
+  [[nodiscard]] std::string subexpression_key(expression const& expr) const;
+
+  /**
+   * @brief Counts the uses of each subexpression that is evaluated on the device.
+   *
+   * The operands of the repeated subexpressions are not counted again, since the repeated
+   * subexpressions reuse the result of the first one.
+   *
+   * @param expr The expression to count the subexpressions of.
+   * @param is_root Whether `expr` is the root of the expression tree.
+   */
+  void count_subexpressions(expression const& expr, bool is_root);
+
+  /**
+   * @brief Returns whether the expression only depends on valid literals.
+   */
+  [[nodiscard]] bool is_constant(expression const& expr) const;
+
+  /**
+   * @brief Evaluates a constant expression into a literal owned by this parser.
+   *
+   * @param expr The expression for which `is_constant` is true.
+   * @return The literal of the value of the expression.
+   */
+  literal const& fold(expression const& expr);
+
+  /**
+   * @brief Gives back an intermediate storage location after the last use of its value.
+   *
+   * @param intermediate_index The intermediate storage location consumed by an operator.
+   */
+  void release_intermediate(cudf::size_type intermediate_index);
+
   rmm::device_buffer
     _device_data_buffer;  ///< The device-side data buffer containing the plan information, which is
                           ///< owned by this class and persists until it is destroyed.
@@ -334,7 +402,13 @@ class expression_parser {
   std::vector<detail::device_data_reference> _data_references;
   std::vector<ast_operator> _operators;
   std::vector<cudf::size_type> _operator_source_indices;
-  std::vector<cudf::detail::fixed_width_scalar_device_view_base> _literals;
+  std::vector<generic_scalar_device_view> _literals;
+  rmm::cuda_stream_view _stream;
+  std::map<std::string, cudf::size_type> _subexpression_uses;
+  std::map<std::string, cudf::size_type> _subexpressions;
+  std::map<cudf::size_type, cudf::size_type> _intermediate_uses;
+  std::vector<std::unique_ptr<cudf::scalar>> _folded_scalars;
+  std::vector<std::unique_ptr<literal>> _folded_literals;
 };
 
 }  // namespace detail
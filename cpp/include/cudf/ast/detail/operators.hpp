@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -199,6 +199,9 @@ CUDF_HOST_DEVICE inline constexpr void ast_operator_dispatcher(ast_operator op,
     case ast_operator::CAST_TO_FLOAT64:
       f.template operator()<ast_operator::CAST_TO_FLOAT64>(std::forward<Ts>(args)...);
       break;
+    case ast_operator::IS_NULL:
+      f.template operator()<ast_operator::IS_NULL>(std::forward<Ts>(args)...);
+      break;
     default:
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Invalid operator.");
@@ -807,6 +810,17 @@ template <>
 struct operator_functor<ast_operator::CAST_TO_FLOAT64, false> : cast<double> {
 };
 
+template <>
+struct operator_functor<ast_operator::IS_NULL, false> {
+  static constexpr auto arity{1};
+
+  template <typename InputT>
+  __device__ inline auto operator()(InputT input) -> bool
+  {
+    return false;
+  }
+};
+
 /*
  * The default specialization of nullable operators is to fall back to the non-nullable
  * implementation
@@ -884,6 +898,18 @@ struct operator_functor<ast_operator::NULL_LOGICAL_AND, true> {
 
 ///< NULL_LOGICAL_OR(null, null) is null, NULL_LOGICAL_OR(null, true) is true, NULL_LOGICAL_OR(null,
 ///< false) is null, and NULL_LOGICAL_OR(valid, valid) == LOGICAL_OR(valid, valid)
+template <>
+struct operator_functor<ast_operator::IS_NULL, true> {
+  using NonNullOperator       = operator_functor<ast_operator::IS_NULL, false>;
+  static constexpr auto arity = NonNullOperator::arity;
+
+  template <typename InputT>
+  __device__ inline auto operator()(InputT const input) -> possibly_null_value_t<bool, true>
+  {
+    return {!input.has_value()};
+  }
+};
+
 template <>
 struct operator_functor<ast_operator::NULL_LOGICAL_OR, true> {
   using NonNullOperator       = operator_functor<ast_operator::NULL_LOGICAL_OR, false>;
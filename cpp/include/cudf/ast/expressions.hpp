@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,7 @@
 
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
+#include <cudf/strings/string_view.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
@@ -88,32 +89,33 @@ enum class ast_operator {
                      ///< NULL_LOGICAL_OR(null, false) is null, and NULL_LOGICAL_OR(valid, valid) ==
                      ///< LOGICAL_OR(valid, valid)
   // Unary operators
-  IDENTITY,        ///< Identity function
-  SIN,             ///< Trigonometric sine
-  COS,             ///< Trigonometric cosine
-  TAN,             ///< Trigonometric tangent
-  ARCSIN,          ///< Trigonometric sine inverse
-  ARCCOS,          ///< Trigonometric cosine inverse
-  ARCTAN,          ///< Trigonometric tangent inverse
-  SINH,            ///< Hyperbolic sine
-  COSH,            ///< Hyperbolic cosine
-  TANH,            ///< Hyperbolic tangent
-  ARCSINH,         ///< Hyperbolic sine inverse
-  ARCCOSH,         ///< Hyperbolic cosine inverse
-  ARCTANH,         ///< Hyperbolic tangent inverse
-  EXP,             ///< Exponential (base e, Euler number)
-  LOG,             ///< Natural Logarithm (base e)
-  SQRT,            ///< Square-root (x^0.5)
-  CBRT,            ///< Cube-root (x^(1.0/3))
-  CEIL,            ///< Smallest integer value not less than arg
-  FLOOR,           ///< largest integer value not greater than arg
-  ABS,             ///< Absolute value
-  RINT,            ///< Rounds the floating-point argument arg to an integer value
-  BIT_INVERT,      ///< Bitwise Not (~)
-  NOT,             ///< Logical Not (!)
-  CAST_TO_INT64,   ///< Cast value to int64_t
-  CAST_TO_UINT64,  ///< Cast value to uint64_t
-  CAST_TO_FLOAT64  ///< Cast value to double
+  IDENTITY,         ///< Identity function
+  SIN,              ///< Trigonometric sine
+  COS,              ///< Trigonometric cosine
+  TAN,              ///< Trigonometric tangent
+  ARCSIN,           ///< Trigonometric sine inverse
+  ARCCOS,           ///< Trigonometric cosine inverse
+  ARCTAN,           ///< Trigonometric tangent inverse
+  SINH,             ///< Hyperbolic sine
+  COSH,             ///< Hyperbolic cosine
+  TANH,             ///< Hyperbolic tangent
+  ARCSINH,          ///< Hyperbolic sine inverse
+  ARCCOSH,          ///< Hyperbolic cosine inverse
+  ARCTANH,          ///< Hyperbolic tangent inverse
+  EXP,              ///< Exponential (base e, Euler number)
+  LOG,              ///< Natural Logarithm (base e)
+  SQRT,             ///< Square-root (x^0.5)
+  CBRT,             ///< Cube-root (x^(1.0/3))
+  CEIL,             ///< Smallest integer value not less than arg
+  FLOOR,            ///< largest integer value not greater than arg
+  ABS,              ///< Absolute value
+  RINT,             ///< Rounds the floating-point argument arg to an integer value
+  BIT_INVERT,       ///< Bitwise Not (~)
+  NOT,              ///< Logical Not (!)
+  CAST_TO_INT64,    ///< Cast value to int64_t
+  CAST_TO_UINT64,   ///< Cast value to uint64_t
+  CAST_TO_FLOAT64,  ///< Cast value to double
+  IS_NULL           ///< Check if operand is null
 };
 
 /**
@@ -127,6 +129,84 @@ enum class table_reference {
   OUTPUT  ///< Column index in the output table
 };
 
+/**
+ * @brief A type-erased scalar_device_view where the value is a fixed width type or a string
+ */
+class generic_scalar_device_view : public cudf::detail::scalar_device_view_base {
+ public:
+  /**
+   * @brief Returns the stored value.
+   *
+   * @tparam T The desired type
+   */
+  template <typename T>
+  __device__ T const value() const noexcept
+  {
+    if constexpr (std::is_same_v<T, cudf::string_view>) {
+      return string_view(static_cast<char const*>(_data), _size);
+    } else {
+      return *static_cast<T const*>(_data);
+    }
+  }
+
+  /**
+   * @brief Construct a new generic scalar device view object from a numeric scalar
+   *
+   * @param s The numeric scalar to construct from
+   */
+  template <typename T>
+  generic_scalar_device_view(numeric_scalar<T>& s)
+    : generic_scalar_device_view(s.type(), s.data(), s.validity_data())
+  {
+  }
+
+  /**
+   * @brief Construct a new generic scalar device view object from a timestamp scalar
+   *
+   * @param s The timestamp scalar to construct from
+   */
+  template <typename T>
+  generic_scalar_device_view(timestamp_scalar<T>& s)
+    : generic_scalar_device_view(s.type(), s.data(), s.validity_data())
+  {
+  }
+
+  /**
+   * @brief Construct a new generic scalar device view object from a duration scalar
+   *
+   * @param s The duration scalar to construct from
+   */
+  template <typename T>
+  generic_scalar_device_view(duration_scalar<T>& s)
+    : generic_scalar_device_view(s.type(), s.data(), s.validity_data())
+  {
+  }
+
+  /**
+   * @brief Construct a new generic scalar device view object from a string scalar
+   *
+   * @param s The string scalar to construct from
+   */
+  generic_scalar_device_view(string_scalar& s)
+    : generic_scalar_device_view(s.type(), s.data(), s.validity_data(), s.size())
+  {
+  }
+
+ protected:
+  void const* _data{};      ///< Pointer to device memory containing the value
+  size_type const _size{};  ///< Size of the string in bytes for string scalar
+
+  generic_scalar_device_view(data_type type, void const* data, bool* is_valid)
+    : cudf::detail::scalar_device_view_base(type, is_valid), _data(data)
+  {
+  }
+
+  generic_scalar_device_view(data_type type, void const* data, bool* is_valid, size_type size)
+    : cudf::detail::scalar_device_view_base(type, is_valid), _data(data), _size(size)
+  {
+  }
+};
+
 /**
  * @brief A literal value used in an abstract syntax tree.
  */
@@ -139,10 +219,7 @@ class literal : public expression {
    * @param value A numeric scalar value.
    */
   template <typename T>
-  literal(cudf::numeric_scalar<T>& value)
-    : scalar(value), value(cudf::get_scalar_device_view(value))
-  {
-  }
+  literal(cudf::numeric_scalar<T>& value) : scalar(value), value(value) {}
 
   /**
    * @brief Construct a new literal object.
@@ -151,10 +228,7 @@ class literal : public expression {
    * @param value A timestamp scalar value.
    */
   template <typename T>
-  literal(cudf::timestamp_scalar<T>& value)
-    : scalar(value), value(cudf::get_scalar_device_view(value))
-  {
-  }
+  literal(cudf::timestamp_scalar<T>& value) : scalar(value), value(value) {}
 
   /**
    * @brief Construct a new literal object.
@@ -163,10 +237,14 @@ class literal : public expression {
    * @param value A duration scalar value.
    */
   template <typename T>
-  literal(cudf::duration_scalar<T>& value)
-    : scalar(value), value(cudf::get_scalar_device_view(value))
-  {
-  }
+  literal(cudf::duration_scalar<T>& value) : scalar(value), value(value) {}
+
+  /**
+   * @brief Construct a new literal object.
+   *
+   * @param value A string scalar value.
+   */
+  literal(cudf::string_scalar& value) : scalar(value), value(value) {}
 
   /**
    * @brief Get the data type.
@@ -178,13 +256,20 @@ class literal : public expression {
   /**
    * @brief Get the value object.
    *
-   * @return cudf::detail::fixed_width_scalar_device_view_base
+   * @return cudf::ast::generic_scalar_device_view
    */
-  [[nodiscard]] cudf::detail::fixed_width_scalar_device_view_base get_value() const
+  [[nodiscard]] generic_scalar_device_view get_value() const
   {
     return value;
   }
 
+  /**
+   * @brief Get the scalar holding the literal value.
+   *
+   * @return cudf::scalar const&
+   */
+  [[nodiscard]] cudf::scalar const& get_scalar() const { return scalar; }
+
   /**
    * @brief Accepts a visitor class.
    *
@@ -195,10 +280,7 @@ class literal : public expression {
 
   [[nodiscard]] bool may_evaluate_null(table_view const& left,
                                        table_view const& right,
-                                       rmm::cuda_stream_view stream) const override
-  {
-    return !is_valid(stream);
-  }
+                                       rmm::cuda_stream_view stream) const override;
 
   /**
    * @brief Check if the underlying scalar is valid.
@@ -212,7 +294,7 @@ class literal : public expression {
 
  private:
   cudf::scalar const& scalar;
-  cudf::detail::fixed_width_scalar_device_view_base const value;
+  generic_scalar_device_view const value;
 };
 
 /**
@@ -290,10 +372,7 @@ class column_reference : public expression {
 
   [[nodiscard]] bool may_evaluate_null(table_view const& left,
                                        table_view const& right,
-                                       rmm::cuda_stream_view stream) const override
-  {
-    return (table_source == table_reference::LEFT ? left : right).column(column_index).has_nulls();
-  }
+                                       rmm::cuda_stream_view stream) const override;
 
  private:
   cudf::size_type column_index;
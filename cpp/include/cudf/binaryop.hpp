@@ -19,7 +19,10 @@
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
 #include <memory>
+#include <vector>
 
 namespace cudf {
 
@@ -88,10 +91,14 @@ enum class binary_operator : int32_t {
  * Regardless of the operator, the validity of the output value is the logical
  * AND of the validity of the two operands except NullMin and NullMax (logical OR).
  *
+ * The binary operations on fixed-width operands may be captured into a CUDA graph, in which case
+ * the null count of the output is computed once the graph has been launched.
+ *
  * @param lhs         The left operand scalar
  * @param rhs         The right operand column
  * @param op          The binary operator
  * @param output_type The desired data type of the output column
+ * @param stream      CUDA stream used for device memory operations and kernel launches
  * @param mr          Device memory resource used to allocate the returned column's device memory
  * @return            Output column of `output_type` type containing the result of
  *                    the binary operation
@@ -104,6 +111,7 @@ std::unique_ptr<column> binary_operation(
   column_view const& rhs,
   binary_operator op,
   data_type output_type,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -120,6 +128,7 @@ std::unique_ptr<column> binary_operation(
  * @param rhs         The right operand scalar
  * @param op          The binary operator
  * @param output_type The desired data type of the output column
+ * @param stream      CUDA stream used for device memory operations and kernel launches
  * @param mr          Device memory resource used to allocate the returned column's device memory
  * @return            Output column of `output_type` type containing the result of
  *                    the binary operation
@@ -132,6 +141,7 @@ std::unique_ptr<column> binary_operation(
   scalar const& rhs,
   binary_operator op,
   data_type output_type,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -146,6 +156,7 @@ std::unique_ptr<column> binary_operation(
  * @param rhs         The right operand column
  * @param op          The binary operator
  * @param output_type The desired data type of the output column
+ * @param stream      CUDA stream used for device memory operations and kernel launches
  * @param mr          Device memory resource used to allocate the returned column's device memory
  * @return            Output column of `output_type` type containing the result of
  *                    the binary operation
@@ -159,6 +170,7 @@ std::unique_ptr<column> binary_operation(
   column_view const& rhs,
   binary_operator op,
   data_type output_type,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -176,6 +188,7 @@ std::unique_ptr<column> binary_operation(
  * @param output_type The desired data type of the output column. It is assumed
  *                    that output_type is compatible with the output data type
  *                    of the function in the PTX code
+ * @param stream      CUDA stream used for device memory operations and kernel launches
  * @param mr          Device memory resource used to allocate the returned column's device memory
  * @return            Output column of `output_type` type containing the result of
  *                    the binary operation
@@ -188,6 +201,42 @@ std::unique_ptr<column> binary_operation(
   column_view const& rhs,
   std::string const& ptx,
   data_type output_type,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Performs a chain of binary operations between columns.
+ *
+ * The output contains the result of `(((operands[0] ops[0] operands[1]) ops[1] operands[2]) ...)`
+ * for every row, e.g. `(a + b) * c - d` for the operands `{a, b, c, d}` and the operators
+ * `{ADD, MUL, SUB}`.
+ *
+ * The result of an operator that is not the last one has the type of the result of its operands:
+ * the `fixed_point` type given by `binary_operation_fixed_point_output_type`, the type of the
+ * timestamp for a timestamp and a duration, and otherwise their common type. The result of the
+ * last operator has the type `output_type`. This is the result of calling `binary_operation` for
+ * each operator, but chains of up to 3 `ADD`, `SUB`, `MUL` and `DIV` operators run in a single
+ * kernel, without intermediate columns, when the operands other than the first one have the same
+ * type as the first one, or are durations of the same resolution as a first timestamp operand.
+ *
+ * Regardless of the operators, the validity of the output value is the logical AND of the
+ * validity of the operands.
+ *
+ * @param operands    The operand columns
+ * @param ops         The binary operators, applied from left to right
+ * @param output_type The desired data type of the output column
+ * @param stream      CUDA stream used for device memory operations and kernel launches
+ * @param mr          Device memory resource used to allocate the returned column's device memory
+ * @return            Output column of `output_type` type containing the result of the chain
+ * @throw cudf::logic_error if @p ops is empty or the number of @p operands is not one more than it
+ * @throw cudf::logic_error if @p operands are different sizes
+ * @throw cudf::logic_error if an operator is not supported for the types of its operands
+ */
+std::unique_ptr<column> chained_binary_operation(
+  std::vector<column_view> const& operands,
+  std::vector<binary_operator> const& ops,
+  data_type output_type,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -187,6 +187,18 @@ class column {
    */
   void set_null_count(size_type new_null_count);
 
+  /**
+   * @brief Leaves the null count to be computed by the views of the column
+   * rather than by `view()`.
+   *
+   * Sets the null count to `UNKNOWN_NULL_COUNT`. A call captured into a CUDA
+   * graph invokes this on its outputs, whose null masks are only written once
+   * the graph is launched, so that they can be the inputs of the next captured
+   * call. Setting a known null count, or invoking `null_count()`, ends the
+   * deferral.
+   */
+  void defer_null_count();
+
   /**
    * @brief Indicates whether it is possible for the column to contain null
    * values, i.e., it has an allocated null mask.
@@ -265,6 +277,11 @@ class column {
    * @brief Creates an immutable, non-owning view of the column's data and
    * children.
    *
+   * @note If the column's null count is `UNKNOWN_NULL_COUNT`, it is computed and
+   * stored in the column, unless `defer_null_count()` was invoked. It is then
+   * left to be computed by the view on the first invocation of its
+   * `null_count()`.
+   *
    * @return column_view The immutable, non-owning view
    */
   [[nodiscard]] column_view view() const;
@@ -317,6 +334,8 @@ class column {
   rmm::device_buffer _null_mask{};        ///< Bitmask used to represent null values.
                                           ///< May be empty if `null_count() == 0`
   mutable cudf::size_type _null_count{UNKNOWN_NULL_COUNT};  ///< The number of null elements
+  mutable bool _null_count_deferred{};                      ///< Whether `view()` leaves an
+                                                            ///< unknown null count to the view
   std::vector<std::unique_ptr<column>> _children{};         ///< Depending on element type, child
                                                             ///< columns may contain additional data
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -156,6 +156,18 @@ class column_view_base {
    */
   [[nodiscard]] size_type null_count() const;
 
+  /**
+   * @brief Indicates if the count of null elements is already known, so that `null_count()` will
+   * not launch a kernel to compute it.
+   *
+   * @return true The null count is stored
+   * @return false The null count is `UNKNOWN_NULL_COUNT`
+   */
+  [[nodiscard]] bool is_null_count_known() const noexcept
+  {
+    return _null_count > cudf::UNKNOWN_NULL_COUNT;
+  }
+
   /**
    * @brief Returns the count of null elements in the range [begin, end)
    *
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace comms {
+/**
+ * @addtogroup reorder_shuffle
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Group of ranks exchanging buffers, one of which is the calling process.
+ *
+ * libcudf does not depend on a transport. Implementations wrap one, e.g. an NCCL communicator,
+ * whose device exchange is a group of `ncclSend` and `ncclRecv` calls, or UCX tagged messages.
+ *
+ * Both exchanges are collective: every rank of the group must make the same sequence of calls.
+ */
+class communicator {
+ public:
+  virtual ~communicator() = default;
+
+  /**
+   * @brief Returns the index of the calling process in the group.
+   */
+  [[nodiscard]] virtual int rank() const = 0;
+
+  /**
+   * @brief Returns the number of ranks in the group.
+   */
+  [[nodiscard]] virtual int size() const = 0;
+
+  /**
+   * @brief Sends a host buffer to each rank and receives one from each rank.
+   *
+   * The call blocks until the buffers sent to this rank are received.
+   *
+   * @param send The buffer to send to each rank, indexed by rank
+   * @return The buffer received from each rank, indexed by rank
+   */
+  virtual std::vector<std::vector<uint8_t>> all_to_all(
+    std::vector<std::vector<uint8_t>> const& send) = 0;
+
+  /**
+   * @brief Sends a device buffer to each rank and receives one from each rank, in order on
+   * `stream`.
+   *
+   * The work on `stream` before the call must be complete before the buffers are read and written,
+   * and the work on `stream` after the call must not start before the transfers are complete. The
+   * call itself may return before then.
+   *
+   * @param send The buffer to send to each rank, indexed by rank
+   * @param recv The buffer to receive into from each rank, indexed by rank; each has the size of
+   * the buffer that rank sends to this one
+   * @param stream CUDA stream on which the transfers are ordered
+   */
+  virtual void all_to_all(std::vector<device_span<uint8_t const>> const& send,
+                          std::vector<device_span<uint8_t>> const& recv,
+                          rmm::cuda_stream_view stream) = 0;
+};
+
+/**
+ * @brief Redistributes the rows of tables held by the ranks of a group so that rows with equal
+ * keys are held by the same rank.
+ *
+ * Each rank calls `shuffle` with its own rows, and receives the rows whose hash of the columns
+ * `columns_to_hash`, as computed by `cudf::hash_partition` with `num_partitions` equal to the size
+ * of the group, is its rank. All the ranks must use the same columns to hash, and tables with the
+ * same schema.
+ *
+ * The rows are shuffled in chunks of `chunk_rows` rows. Each chunk is partitioned straight into
+ * packed partitions with `cudf::hash_partition_and_pack`, then the partitions are sent on a
+ * separate stream while the next chunk is partitioned. The received partitions are unpacked into
+ * the output table with a single concatenation.
+ *
+ * The order of the rows of the output is unspecified.
+ *
+ * @throw cudf::logic_error if `chunk_rows` is not positive
+ * @throw std::out_of_range if an index of `columns_to_hash` is invalid
+ *
+ * @param input The rows held by the calling rank
+ * @param columns_to_hash Indices of the columns of `input` whose hash chooses the rank of a row
+ * @param comm The group of ranks
+ * @param chunk_rows Maximum number of rows of `input` partitioned and sent at once
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The rows of all the ranks assigned to the calling rank
+ */
+std::unique_ptr<table> shuffle(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  communicator& comm,
+  size_type chunk_rows                = 1 << 20,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace comms
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,9 @@
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
 
 #include <memory>
 #include <vector>
@@ -61,6 +64,10 @@ enum class out_of_bounds_policy : bool {
  * For dictionary columns, the keys column component is copied and not trimmed
  * if the gather results in abandoned key elements.
  *
+ * A gather of fixed-width columns may be captured into a CUDA graph, in which case the null
+ * counts of the result are computed once the graph has been launched, and the nulls of
+ * `gather_map` are not checked.
+ *
  * @throws cudf::logic_error if gather_map contains null values.
  *
  * @param[in] source_table The input columns whose rows will be gathered
@@ -72,6 +79,7 @@ enum class out_of_bounds_policy : bool {
  * use `DONT_CHECK` when they are certain that the gather_map contains only valid indices for
  * better performance. If `policy` is set to `DONT_CHECK` and there are out-of-bounds indices
  * in the gather map, the behavior is undefined. Defaults to `DONT_CHECK`.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned table's device memory
  * @return std::unique_ptr<table> Result of the gather
  */
@@ -79,6 +87,7 @@ std::unique_ptr<table> gather(
   table_view const& source_table,
   column_view const& gather_map,
   out_of_bounds_policy bounds_policy  = out_of_bounds_policy::DONT_CHECK,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -147,6 +156,7 @@ std::unique_ptr<column> reverse(
  * are to be scattered
  * @param check_bounds Optionally perform bounds checking on the values of
  * `scatter_map` and throw an error if any of its values are out of bounds.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table's device memory.
  * @return Result of scattering values from source to target
  */
@@ -155,6 +165,7 @@ std::unique_ptr<table> scatter(
   column_view const& scatter_map,
   table_view const& target,
   bool check_bounds                   = false,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -187,6 +198,7 @@ std::unique_ptr<table> scatter(
  * are to be scattered
  * @param check_bounds Optionally perform bounds checking on the values of
  * `scatter_map` and throw an error if any of its values are out of bounds.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table's device memory.
  * @return Result of scattering values from source to target
  */
@@ -195,6 +207,7 @@ std::unique_ptr<table> scatter(
   column_view const& indices,
   table_view const& target,
   bool check_bounds                   = false,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -705,6 +718,87 @@ table_view unpack(packed_columns const& input);
  */
 table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data);
 
+namespace detail {
+struct chunked_pack_state;
+}  // namespace detail
+
+/**
+ * @brief Deep-copy a `table_view` into the serialized contiguous memory format of `cudf::pack`,
+ * one chunk at a time, through a user-provided device buffer of bounded size
+ *
+ * @ingroup copy_split
+ *
+ * The layout and the metadata of the packed table are computed when the `chunked_pack` is
+ * constructed. Each call to `next` then copies the next sequential chunk of the packed table into
+ * the user buffer, so that a table can be spilled or sent with bounded memory. Concatenating the
+ * chunks in order produces the same device data as `cudf::pack`, which `cudf::unpack` can
+ * deserialize with the metadata from `build_metadata`.
+ *
+ * @code{.pseudo}
+ * auto packer = cudf::chunked_pack(table, bounce_buffer.size());
+ * std::size_t offset = 0;
+ * while (packer.has_next()) {
+ *   auto const bytes = packer.next(bounce_buffer);
+ *   copy bytes from bounce_buffer to host_buffer + offset
+ *   offset += bytes;
+ * }
+ * auto metadata = packer.build_metadata();
+ * @endcode
+ *
+ * The `input` table must outlive the `chunked_pack`, and the data it views must not change until
+ * the last chunk is copied.
+ */
+class chunked_pack {
+ public:
+  /**
+   * @brief Construct a `chunked_pack` of a table.
+   *
+   * @throws cudf::logic_error if `user_buffer_size` is less than 1MB
+   *
+   * @param input View of the table to pack
+   * @param user_buffer_size Size in bytes of the user buffers passed to `next`
+   */
+  chunked_pack(cudf::table_view const& input, std::size_t user_buffer_size);
+
+  ~chunked_pack();
+
+  /**
+   * @brief Returns the total size in bytes of the packed table, which is the sum of the sizes
+   * returned by all the calls to `next`
+   */
+  [[nodiscard]] std::size_t get_total_contiguous_size() const;
+
+  /**
+   * @brief Returns whether there are chunks left to copy
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Copy the next chunk of the packed table into `user_buffer`.
+   *
+   * The copy is asynchronous on the default stream.
+   *
+   * @throws cudf::logic_error if there are no chunks left to copy
+   * @throws cudf::logic_error if `user_buffer` is not aligned to 64 bytes, or is smaller than the
+   * chunk
+   *
+   * @param user_buffer Device buffer of at least the `user_buffer_size` bytes given at
+   * construction
+   * @return The number of bytes of the packed table copied into `user_buffer`
+   */
+  std::size_t next(cudf::device_span<uint8_t> const& user_buffer);
+
+  /**
+   * @brief Build the metadata used to `unpack` the packed table
+   *
+   * @return The host-side metadata of the packed table
+   */
+  [[nodiscard]] std::unique_ptr<packed_columns::metadata> build_metadata() const;
+
+ private:
+  std::unique_ptr<detail::chunked_pack_state> state;
+};
+
 /**
  * @brief   Returns a new column, where each element is selected from either @p lhs or
  *          @p rhs based on the value of the corresponding element in @p boolean_mask
@@ -832,6 +926,7 @@ std::unique_ptr<column> copy_if_else(
  * @param[in] input table_view (set of dense columns) to scatter
  * @param[in] target table_view to modify with scattered values from `input`
  * @param[in] boolean_mask column_view which acts as boolean mask.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate device memory of the returned table.
  *
  * @returns Returns a table by scattering `input` into `target` as per `boolean_mask`.
@@ -840,6 +935,7 @@ std::unique_ptr<table> boolean_mask_scatter(
   table_view const& input,
   table_view const& target,
   column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -869,6 +965,7 @@ std::unique_ptr<table> boolean_mask_scatter(
  * @param[in] input scalars to scatter
  * @param[in] target table_view to modify with scattered values from `input`
  * @param[in] boolean_mask column_view which acts as boolean mask.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate device memory of the returned table.
  *
  * @returns Returns a table by scattering `input` into `target` as per `boolean_mask`.
@@ -877,6 +974,7 @@ std::unique_ptr<table> boolean_mask_scatter(
   std::vector<std::reference_wrapper<const scalar>> const& input,
   table_view const& target,
   column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -921,6 +1019,9 @@ enum class sample_with_replacement : bool {
  * output:       {col1: {3, 1, 1}, col2: {8, 6, 6}}
  * @endcode
  *
+ * Without replacement, small samples are drawn in memory and time proportional to `n`, and
+ * larger ones from a shuffle of all the row indices.
+ *
  * @throws cudf::logic_error if `n` > `input.num_rows()` and `replacement` == FALSE.
  * @throws cudf::logic_error if `n` < 0.
  *
@@ -939,5 +1040,42 @@ std::unique_ptr<table> sample(
   int64_t const seed                  = 0,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Gather a uniform random sample of the same fraction of the rows of each stratum of
+ * `input`, the strata being the groups of rows with equal `keys` columns
+ *
+ * Each stratum of `s` rows contributes `round(fraction * s)` distinct rows, so the proportions
+ * of the strata are kept in the sample. Null keys are equal to each other. The rows of the
+ * output are grouped by stratum, in random order within each.
+ *
+ * @code{.pseudo}
+ * Example:
+ * input: {col1: {1, 1, 2, 1, 2, 1, 2, 1}, col2: {0, 1, 2, 3, 4, 5, 6, 7}}
+ * keys: {0}
+ * fraction: 0.5
+ *
+ * output:       {col1: {1, 1, 1, 2, 2}, col2: {5, 0, 3, 6, 2}}
+ * @endcode
+ *
+ * If `keys` is empty, the whole table is a single stratum and this is equivalent to `sample`
+ * without replacement of `round(fraction * input.num_rows())` rows.
+ *
+ * @throws cudf::logic_error if `fraction` is not in `[0, 1]`.
+ *
+ * @param input View of a table to sample.
+ * @param keys Indices of the columns of `input` defining the strata.
+ * @param fraction Fraction of the rows of each stratum to sample.
+ * @param seed Seed value to initiate random number generator.
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @return std::unique_ptr<table> Table containing samples from `input`
+ */
+std::unique_ptr<table> stratified_sample(
+  table_view const& input,
+  std::vector<size_type> const& keys,
+  double const fraction,
+  int64_t const seed                  = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,8 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 /**
  * @file datetime.hpp
@@ -131,6 +133,47 @@ std::unique_ptr<cudf::column> extract_second(
   cudf::column_view const& column,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Components of a date time extracted by `extract_components`.
+ */
+enum class datetime_component : uint8_t {
+  YEAR,           ///< Year, as by `extract_year`
+  MONTH,          ///< Month, from 1 to 12, as by `extract_month`
+  DAY,            ///< Day of the month, as by `extract_day`
+  WEEKDAY,        ///< ISO day of the week, from 1 (Monday) to 7, as by `extract_weekday`
+  HOUR,           ///< Hour, as by `extract_hour`
+  MINUTE,         ///< Minute, as by `extract_minute`
+  SECOND,         ///< Second, as by `extract_second`
+  DAY_OF_YEAR,    ///< Day of the year, from 1 to 366, as by `day_of_year`
+  QUARTER,        ///< Quarter, from 1 to 4, as by `extract_quarter`
+  DAYS_IN_MONTH,  ///< Number of days in the month, as by `days_in_month`
+};
+
+/**
+ * @brief  Extracts several components from any date time type and returns a table of
+ * int16_t columns, one per component.
+ *
+ * Each date time is converted to its civil date and time once, for all the components, so that
+ * extracting several components is as fast as extracting the first one.
+ *
+ * @code{.pseudo}
+ * column = [2020-07-09 10:13:59, null, 1999-01-01 00:00:00]
+ * extract_components(column, {YEAR, MONTH, HOUR})
+ *   = {[2020, null, 1999], [7, null, 1], [10, null, 0]}
+ * @endcode
+ *
+ * @param column cudf::column_view of the input datetime values
+ * @param components Components to extract, in the order of their columns in the output
+ * @param mr Device memory resource used to allocate device memory of the returned table.
+ *
+ * @returns cudf::table of the extracted int16_t components, with the nulls of `column`
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ */
+std::unique_ptr<cudf::table> extract_components(
+  cudf::column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 /**
  * @addtogroup datetime_compute
@@ -344,6 +387,41 @@ std::unique_ptr<cudf::column> round_datetimes(
   rounding_frequency freq,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Converts the wall-clock times of a timestamp column from one timezone to another.
+ *
+ * Each timestamp is read as a wall-clock time in `from_timezone` and replaced by the wall-clock
+ * time of the same instant in `to_timezone`, at the resolution of the input column. Timezones are
+ * standard names of the system TZif files (for example, "America/Los_Angeles"), and "UTC" or an
+ * empty name stands for UTC. Times beyond the last transition of a TZif file follow its
+ * daylight saving time rule.
+ *
+ * Wall-clock times skipped or repeated by a transition of `from_timezone` are read with one of
+ * the two offsets around it.
+ *
+ * The transition table of a timezone is built once per device, the first time it is used.
+ *
+ * @code{.pseudo}
+ * timestamps = ["2020-01-01 00:00:00", "2020-07-01 00:00:00"]
+ * convert_timezone(timestamps, "UTC", "America/Los_Angeles")
+ *   = ["2019-12-31 16:00:00", "2020-06-30 17:00:00"]
+ * @endcode
+ *
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP.
+ * @throw cudf::logic_error if the TZif file of a timezone cannot be read.
+ *
+ * @param timestamps cudf::column_view of the input timestamps.
+ * @param from_timezone Timezone of the wall-clock times of `timestamps`.
+ * @param to_timezone Timezone of the wall-clock times of the returned column.
+ * @param mr Device memory resource used to allocate device memory of the returned column.
+ * @return cudf::column of the same datetime resolution as the input column.
+ */
+std::unique_ptr<cudf::column> convert_timezone(
+  cudf::column_view const& timestamps,
+  std::string const& from_timezone,
+  std::string const& to_timezone,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 
 }  // namespace datetime
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -99,6 +99,12 @@ class simple_aggregations_collector {  // Declares the interface for the simple
                                                           class tdigest_aggregation const& agg);
   virtual std::vector<std::unique_ptr<aggregation>> visit(
     data_type col_type, class merge_tdigest_aggregation const& agg);
+  virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
+                                                          class hll_aggregation const& agg);
+  virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
+                                                          class merge_hll_aggregation const& agg);
+  virtual std::vector<std::unique_ptr<aggregation>> visit(
+    data_type col_type, class approx_nunique_aggregation const& agg);
 };
 
 class aggregation_finalizer {  // Declares the interface for the finalizer
@@ -137,6 +143,9 @@ class aggregation_finalizer {  // Declares the interface for the finalizer
   virtual void visit(class correlation_aggregation const& agg);
   virtual void visit(class tdigest_aggregation const& agg);
   virtual void visit(class merge_tdigest_aggregation const& agg);
+  virtual void visit(class hll_aggregation const& agg);
+  virtual void visit(class merge_hll_aggregation const& agg);
+  virtual void visit(class approx_nunique_aggregation const& agg);
 };
 
 /**
@@ -1048,6 +1057,111 @@ class merge_tdigest_aggregation final : public groupby_aggregation {
   void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
 };
 
+/**
+ * @brief Derived aggregation class for specifying HLL aggregation
+ */
+class hll_aggregation final : public groupby_aggregation {
+ public:
+  explicit hll_aggregation(int precision_) : aggregation{HLL}, precision{precision_} {}
+
+  int const precision;  ///< Base 2 logarithm of the number of registers of the sketches
+
+  [[nodiscard]] bool is_equal(aggregation const& _other) const override
+  {
+    if (!this->aggregation::is_equal(_other)) { return false; }
+    auto const& other = dynamic_cast<hll_aggregation const&>(_other);
+    return precision == other.precision;
+  }
+
+  [[nodiscard]] size_t do_hash() const override
+  {
+    return this->aggregation::do_hash() ^ std::hash<int>{}(precision);
+  }
+
+  [[nodiscard]] std::unique_ptr<aggregation> clone() const override
+  {
+    return std::make_unique<hll_aggregation>(*this);
+  }
+  std::vector<std::unique_ptr<aggregation>> get_simple_aggregations(
+    data_type col_type, simple_aggregations_collector& collector) const override
+  {
+    return collector.visit(col_type, *this);
+  }
+  void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
+};
+
+/**
+ * @brief Derived aggregation class for specifying MERGE_HLL aggregation
+ */
+class merge_hll_aggregation final : public groupby_aggregation {
+ public:
+  explicit merge_hll_aggregation(int precision_)
+    : aggregation{MERGE_HLL}, precision{precision_}
+  {
+  }
+
+  int const precision;  ///< Base 2 logarithm of the number of registers of the sketches
+
+  [[nodiscard]] bool is_equal(aggregation const& _other) const override
+  {
+    if (!this->aggregation::is_equal(_other)) { return false; }
+    auto const& other = dynamic_cast<merge_hll_aggregation const&>(_other);
+    return precision == other.precision;
+  }
+
+  [[nodiscard]] size_t do_hash() const override
+  {
+    return this->aggregation::do_hash() ^ std::hash<int>{}(precision);
+  }
+
+  [[nodiscard]] std::unique_ptr<aggregation> clone() const override
+  {
+    return std::make_unique<merge_hll_aggregation>(*this);
+  }
+  std::vector<std::unique_ptr<aggregation>> get_simple_aggregations(
+    data_type col_type, simple_aggregations_collector& collector) const override
+  {
+    return collector.visit(col_type, *this);
+  }
+  void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
+};
+
+/**
+ * @brief Derived aggregation class for specifying APPROX_NUNIQUE aggregation
+ */
+class approx_nunique_aggregation final : public groupby_aggregation {
+ public:
+  explicit approx_nunique_aggregation(int precision_)
+    : aggregation{APPROX_NUNIQUE}, precision{precision_}
+  {
+  }
+
+  int const precision;  ///< Base 2 logarithm of the number of registers of the sketches
+
+  [[nodiscard]] bool is_equal(aggregation const& _other) const override
+  {
+    if (!this->aggregation::is_equal(_other)) { return false; }
+    auto const& other = dynamic_cast<approx_nunique_aggregation const&>(_other);
+    return precision == other.precision;
+  }
+
+  [[nodiscard]] size_t do_hash() const override
+  {
+    return this->aggregation::do_hash() ^ std::hash<int>{}(precision);
+  }
+
+  [[nodiscard]] std::unique_ptr<aggregation> clone() const override
+  {
+    return std::make_unique<approx_nunique_aggregation>(*this);
+  }
+  std::vector<std::unique_ptr<aggregation>> get_simple_aggregations(
+    data_type col_type, simple_aggregations_collector& collector) const override
+  {
+    return collector.visit(col_type, *this);
+  }
+  void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
+};
+
 /**
  * @brief Sentinel value used for `ARGMAX` aggregation.
  *
@@ -1315,6 +1429,32 @@ struct target_type_impl<Source,
   using type = struct_view;
 };
 
+// HLL sketches are lists of registers, from any type that can be hashed
+template <typename Source>
+struct target_type_impl<
+  Source,
+  aggregation::HLL,
+  std::enable_if_t<cudf::is_fixed_width<Source>() or std::is_same_v<Source, cudf::string_view>>> {
+  using type = list_view;
+};
+
+// MERGE_HLL. As with MERGE_TDIGEST, the sizes of the sketches are verified by the aggregation.
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::MERGE_HLL,
+                        std::enable_if_t<std::is_same_v<Source, cudf::list_view>>> {
+  using type = list_view;
+};
+
+// Always use int64_t for APPROX_NUNIQUE
+template <typename Source>
+struct target_type_impl<
+  Source,
+  aggregation::APPROX_NUNIQUE,
+  std::enable_if_t<cudf::is_fixed_width<Source>() or std::is_same_v<Source, cudf::string_view>>> {
+  using type = int64_t;
+};
+
 /**
  * @brief Helper alias to get the accumulator type for performing aggregation
  * `k` on elements of type `Source`
@@ -1427,6 +1567,12 @@ CUDF_HOST_DEVICE inline decltype(auto) aggregation_dispatcher(aggregation::Kind
       return f.template operator()<aggregation::TDIGEST>(std::forward<Ts>(args)...);
     case aggregation::MERGE_TDIGEST:
       return f.template operator()<aggregation::MERGE_TDIGEST>(std::forward<Ts>(args)...);
+    case aggregation::HLL:
+      return f.template operator()<aggregation::HLL>(std::forward<Ts>(args)...);
+    case aggregation::MERGE_HLL:
+      return f.template operator()<aggregation::MERGE_HLL>(std::forward<Ts>(args)...);
+    case aggregation::APPROX_NUNIQUE:
+      return f.template operator()<aggregation::APPROX_NUNIQUE>(std::forward<Ts>(args)...);
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported aggregation.");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -78,5 +78,34 @@ std::unique_ptr<column> binary_operation(
   data_type output_type,
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::chained_binary_operation
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> chained_binary_operation(
+  std::vector<column_view> const& operands,
+  std::vector<binary_operator> const& ops,
+  data_type output_type,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Compiles the kernel that `cudf::binary_operation` launches for a PTX operator without
+ * launching it.
+ *
+ * @throws cudf::logic_error if a type is not a fixed-width type, is a fixed-point type or is INT8
+ *
+ * @param ptx String containing the PTX of a binary function
+ * @param lhs_type The type of the left operand column
+ * @param rhs_type The type of the right operand column
+ * @param output_type The desired data type of the output column. It is assumed that output_type
+ * is compatible with the output data type of the function in the PTX code
+ */
+void precompile_binary_operation(std::string const& ptx,
+                                 data_type lhs_type,
+                                 data_type rhs_type,
+                                 data_type output_type);
 }  // namespace detail
 }  // namespace cudf
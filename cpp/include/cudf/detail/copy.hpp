@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -103,6 +103,32 @@ std::vector<table_view> slice(table_view const& input,
                               std::initializer_list<size_type> indices,
                               rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 
+/**
+ * @brief Returns the views with their null counts, counting all the unknown null counts with a
+ * single kernel launch.
+ *
+ * The null count of a slice is not counted until it is needed, so that slicing many times does
+ * not launch a kernel per slice. Operations that need the null counts of many slices count them
+ * together with this function instead of calling `null_count()` on each of them.
+ *
+ * @param views The views whose null counts are needed
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The views with known null counts
+ */
+std::vector<column_view> with_null_counts(host_span<column_view const> views,
+                                          rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @brief Returns the tables with the null counts of their columns, counting all the unknown null
+ * counts of all the tables with a single kernel launch.
+ *
+ * @param tables The tables whose null counts are needed
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The tables with known null counts
+ */
+std::vector<table_view> with_null_counts(host_span<table_view const> tables,
+                                         rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 /**
  * @copydoc cudf::split(column_view const&, host_span<size_type const>)
  *
@@ -289,6 +315,19 @@ std::unique_ptr<table> sample(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::stratified_sample
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> stratified_sample(
+  table_view const& input,
+  std::vector<size_type> const& keys,
+  double const fraction,
+  int64_t const seed                  = 0,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::get_element
  *
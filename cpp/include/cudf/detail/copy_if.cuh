@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -40,7 +40,11 @@
 
 #include <cub/cub.cuh>
 
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+
 #include <algorithm>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -273,32 +277,15 @@ struct scatter_gather_functor {
 
   template <typename T,
             std::enable_if_t<!cudf::is_fixed_width<T>() and !cudf::is_fixed_point<T>()>* = nullptr>
-  std::unique_ptr<cudf::column> operator()(
-    cudf::column_view const& input,
-    cudf::size_type const& output_size,
-    cudf::size_type const*,
-    Filter filter,
-    cudf::size_type,
-    rmm::cuda_stream_view stream,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+  std::unique_ptr<cudf::column> operator()(cudf::column_view const&,
+                                           cudf::size_type const&,
+                                           cudf::size_type const*,
+                                           Filter,
+                                           cudf::size_type,
+                                           rmm::cuda_stream_view,
+                                           rmm::mr::device_memory_resource*)
   {
-    rmm::device_uvector<cudf::size_type> indices(output_size, stream);
-
-    thrust::copy_if(rmm::exec_policy(stream),
-                    thrust::counting_iterator<cudf::size_type>(0),
-                    thrust::counting_iterator<cudf::size_type>(input.size()),
-                    indices.begin(),
-                    filter);
-
-    auto output_table = cudf::detail::gather(cudf::table_view{{input}},
-                                             indices,
-                                             cudf::out_of_bounds_policy::DONT_CHECK,
-                                             cudf::detail::negative_index_policy::NOT_ALLOWED,
-                                             stream,
-                                             mr);
-
-    // There will be only one column
-    return std::make_unique<cudf::column>(std::move(output_table->get_column(0)));
+    CUDF_FAIL("Columns that are not fixed-width are gathered together by copy_if");
   }
 };
 
@@ -379,18 +366,45 @@ std::unique_ptr<table> copy_if(
   if (output_size == input.num_rows()) {
     return std::make_unique<table>(input, stream, mr);
   } else if (output_size > 0) {
+    // 3. Scatter the fixed-width columns using the block offsets, and gather the other columns
+    // together with a single map of the rows that pass the filter
     std::vector<std::unique_ptr<column>> out_columns(input.num_columns());
-    std::transform(input.begin(), input.end(), out_columns.begin(), [&](auto col_view) {
-      return cudf::type_dispatcher(col_view.type(),
-                                   scatter_gather_functor<Filter, block_size>{},
-                                   col_view,
-                                   output_size,
-                                   block_offsets.begin(),
-                                   filter,
-                                   per_thread,
-                                   stream,
-                                   mr);
-    });
+    std::vector<size_type> gathered_columns;
+    for (size_type i = 0; i < input.num_columns(); ++i) {
+      auto const& col_view = input.column(i);
+      if (not is_fixed_width(col_view.type())) {
+        gathered_columns.push_back(i);
+        continue;
+      }
+      out_columns[i] = cudf::type_dispatcher(col_view.type(),
+                                             scatter_gather_functor<Filter, block_size>{},
+                                             col_view,
+                                             output_size,
+                                             block_offsets.begin(),
+                                             filter,
+                                             per_thread,
+                                             stream,
+                                             mr);
+    }
+
+    if (not gathered_columns.empty()) {
+      rmm::device_uvector<cudf::size_type> indices(output_size, stream);
+      thrust::copy_if(rmm::exec_policy(stream),
+                      thrust::counting_iterator<cudf::size_type>(0),
+                      thrust::counting_iterator<cudf::size_type>(input.num_rows()),
+                      indices.begin(),
+                      filter);
+      auto gathered = cudf::detail::gather(input.select(gathered_columns),
+                                           indices,
+                                           cudf::out_of_bounds_policy::DONT_CHECK,
+                                           cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                           stream,
+                                           mr)
+                        ->release();
+      for (std::size_t i = 0; i < gathered_columns.size(); ++i) {
+        out_columns[gathered_columns[i]] = std::move(gathered[i]);
+      }
+    }
 
     return std::make_unique<table>(std::move(out_columns));
   } else {
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <memory>
+
+namespace cudf {
+
+class column_device_view;
+class table_device_view;
+
+namespace detail {
+
+/**
+ * @brief The device views cached for a table by `cudf::cached_table_device_view`.
+ */
+struct cached_device_views;
+
+/**
+ * @brief A device view found in the cache, and the cache entry owning it.
+ *
+ * The view stays valid while `owner` lives. It is released with `release_cached_device_view`.
+ */
+template <typename DeviceView>
+struct cached_device_view {
+  DeviceView* view{};
+  std::shared_ptr<cached_device_views const> owner;
+};
+
+/**
+ * @brief Returns the cached device views of a table, creating them if no cache entry holds them.
+ *
+ * The views created are only cached while the returned entry, or a view found in it, lives.
+ *
+ * @param source The table whose columns to create the device views of
+ * @param stream CUDA stream used to create the views, synchronized before returning
+ * @return The cache entry holding the views of `source`
+ */
+std::shared_ptr<cached_device_views const> cache_device_views(table_view const& source,
+                                                               rmm::cuda_stream_view stream);
+
+/**
+ * @brief Finds a cached device view of a table.
+ *
+ * A device view is only determined by the types, sizes, offsets, data and null mask pointers of
+ * the columns and their descendants, so the view of any table equal in those is a match. No view
+ * is returned while `stream` is capturing, since the graph may be launched after the cached views
+ * are freed.
+ *
+ * @param source The table to find the device view of
+ * @param stream CUDA stream the view is to be used on
+ * @return The cached view with its owner, or a null view if none is cached
+ */
+cached_device_view<table_device_view> find_cached_device_view(
+  table_view const& source, rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @brief Finds a cached device view of a column, among the columns of the cached tables.
+ *
+ * Only the views of the columns with children are cached, since creating the views of the others
+ * allocates no device memory.
+ *
+ * @param source The column to find the device view of
+ * @param stream CUDA stream the view is to be used on
+ * @return The cached view with its owner, or a null view if none is cached
+ */
+cached_device_view<column_device_view> find_cached_device_view(
+  column_view const& source, rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @brief Ends the use of a view found with `find_cached_device_view` on `stream`.
+ *
+ * The cached views are freed in the order of the stream that created them, once the work that
+ * was enqueued on the other streams before they were released completes.
+ *
+ * @param owner The cache entry owning the view
+ * @param stream CUDA stream the view was found for
+ */
+void release_cached_device_view(cached_device_views const& owner,
+                                rmm::cuda_stream_view stream) noexcept;
+
+}  // namespace detail
+}  // namespace cudf
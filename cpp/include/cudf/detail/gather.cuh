@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/assert.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/stream_capture.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/dictionary/dictionary_column_view.hpp>
@@ -36,6 +37,7 @@
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <algorithm>
@@ -581,7 +583,11 @@ void gather_bitmask(table_view const& source,
   std::transform(target.begin(), target.end(), target_masks.begin(), [](auto const& col) {
     return col->mutable_view().null_mask();
   });
-  auto d_target_masks = make_device_uvector_async(target_masks, stream);
+  rmm::device_uvector<bitmask_type*> d_target_masks(target_masks.size(), stream);
+  copy_host_to_device(d_target_masks.data(),
+                      target_masks.data(),
+                      target_masks.size() * sizeof(bitmask_type*),
+                      stream);
 
   auto const device_source = table_device_view::create(source, stream);
   auto d_valid_counts      = make_zeroed_device_uvector_async<size_type>(target.size(), stream);
@@ -606,6 +612,14 @@ void gather_bitmask(table_view const& source,
        d_valid_counts.data(),
        stream);
 
+  // While capturing, the null counts are left to be computed once the graph has been launched
+  if (is_capturing(stream)) {
+    for (auto& col : target) {
+      if (col->nullable()) { col->defer_null_count(); }
+    }
+    return;
+  }
+
   // Copy the valid counts into each column
   auto const valid_counts = make_std_vector_sync(d_valid_counts, stream);
   for (size_t i = 0; i < target.size(); ++i) {
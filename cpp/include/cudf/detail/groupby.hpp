@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -39,6 +39,16 @@ namespace hash {
  */
 bool can_use_hash_groupby(table_view const& keys, host_span<aggregation_request const> requests);
 
+/**
+ * @brief Indicates if an aggregation of a column can be computed with a hash-based groupby
+ * implementation.
+ *
+ * @param values The column to aggregate
+ * @param kind The kind of the aggregation
+ * @return true if the aggregation can be hash-based
+ */
+bool can_use_hash_aggregation(column_view const& values, aggregation::Kind kind);
+
 // Hash-based groupby
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   table_view const& keys,
@@ -48,6 +58,28 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   rmm::mr::device_memory_resource* mr);
 }  // namespace hash
 
+namespace segmented {
+/**
+ * @brief Indicates if a set of aggregation requests on keys whose equal rows are contiguous can be
+ * satisfied with segmented reductions of the groups of rows.
+ *
+ * @param keys The table of keys
+ * @param requests The set of columns to aggregate and the aggregations to perform
+ * @param include_null_keys Indicates whether rows with null keys are grouped
+ * @return true A segmented groupby can be used
+ */
+bool can_use_segmented_groupby(table_view const& keys,
+                               host_span<aggregation_request const> requests,
+                               null_policy include_null_keys);
+
+// Groupby of pre-grouped keys with segmented reductions
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
+  table_view const& keys,
+  host_span<aggregation_request const> requests,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+}  // namespace segmented
+
 }  // namespace detail
 }  // namespace groupby
 }  // namespace cudf
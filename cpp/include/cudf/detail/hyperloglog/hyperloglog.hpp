@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+namespace cudf {
+namespace detail {
+namespace hyperloglog {
+
+/**
+ * @brief Smallest precision of the sketches, for 16 registers.
+ */
+constexpr int min_precision = 4;
+
+/**
+ * @brief Largest precision of the sketches, for 256K registers.
+ */
+constexpr int max_precision = 18;
+
+/**
+ * @brief Builds one HyperLogLog sketch of the values of each group.
+ *
+ * The sketches are the rows of a `LIST<UINT8>` column, each made of the `2^precision` registers
+ * of the sketch. Null values are ignored, as are the rows whose group label is negative. The
+ * sketch of a group without any value has all its registers zero.
+ *
+ * @throw cudf::logic_error if `precision` is not in `[min_precision, max_precision]`
+ * @throw cudf::logic_error if the values are of a nested or dictionary type
+ *
+ * @param values The values to count the distinct values of
+ * @param group_labels The group of each row of `values`, in `[0, num_groups)`, or negative for
+ * the rows to ignore
+ * @param num_groups The number of groups, and of sketches in the result
+ * @param precision Base 2 logarithm of the number of registers of the sketches
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The sketches of the groups
+ */
+std::unique_ptr<column> make_sketches(
+  column_view const& values,
+  device_span<size_type const> group_labels,
+  size_type num_groups,
+  int precision,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Builds a single HyperLogLog sketch of all the values.
+ *
+ * @see make_sketches
+ *
+ * @return A sketches column of one row
+ */
+std::unique_ptr<column> make_sketch(
+  column_view const& values,
+  int precision,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Merges the HyperLogLog sketches of each group into a sketch of the union of their
+ * values.
+ *
+ * Null sketches are ignored, as are the rows whose group label is negative.
+ *
+ * @throw cudf::logic_error if `sketches` is not a `LIST<UINT8>` column of sketches of `precision`
+ *
+ * @param sketches The sketches to merge
+ * @param group_labels The group of each sketch, in `[0, num_groups)`, or negative for the
+ * sketches to ignore
+ * @param num_groups The number of groups, and of sketches in the result
+ * @param precision Base 2 logarithm of the number of registers of the sketches
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The merged sketches of the groups
+ */
+std::unique_ptr<column> merge_sketches(
+  column_view const& sketches,
+  device_span<size_type const> group_labels,
+  size_type num_groups,
+  int precision,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Merges all the HyperLogLog sketches into a single sketch.
+ *
+ * @see merge_sketches
+ *
+ * @return A sketches column of one row
+ */
+std::unique_ptr<column> merge_sketch(
+  column_view const& sketches,
+  int precision,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::hll_distinct_count
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::unique_ptr<column> estimate_distinct_count(
+  column_view const& sketches,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+}  // namespace hyperloglog
+}  // namespace detail
+}  // namespace cudf
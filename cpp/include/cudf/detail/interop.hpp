@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -46,6 +46,25 @@ DLManagedTensor* to_dlpack(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::to_dlpack(table_view const&, dlpack_layout, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+DLManagedTensor* to_dlpack(
+  table_view const& input,
+  dlpack_layout layout,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::to_dlpack(std::unique_ptr<column>)
+ *
+ * @param stream CUDA stream on which the data of the column was written.
+ */
+DLManagedTensor* to_dlpack(std::unique_ptr<column> input,
+                           rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 // Creating arrow as per given type_id and buffer arguments
 template <typename... Ts>
 std::shared_ptr<arrow::Array> to_arrow_array(cudf::type_id id, Ts&&... args)
@@ -116,5 +135,24 @@ std::unique_ptr<table> from_arrow(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::to_arrow_device
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+unique_device_array_t to_arrow_device(
+  table&& input,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::from_arrow_device
+ *
+ * @param stream CUDA stream which waits for the `sync_event` of `input`.
+ */
+table_view from_arrow_device(ArrowSchema const* schema,
+                             ArrowDeviceArray const* input,
+                             rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 }  // namespace detail
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,7 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/stream_capture.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/types.hpp>
@@ -103,33 +104,54 @@ __global__ void offset_bitmask_binop(Binop op,
 }
 
 /**
- * @copydoc bitmask_binop(Binop op, host_span<bitmask_type const *> const, host_span<size_type>
- * const, size_type, rmm::mr::device_memory_resource *)
+ * @brief Performs a merge of the specified bitmasks using the binary operator
+ *        provided, writes in place to destination and returns the device counter of set bits
  *
- * @param stream CUDA stream used for device memory operations and kernel launches
+ * Unlike `inplace_bitmask_binop`, the count is not copied to the host, so that the merge can be
+ * captured into a CUDA graph.
+ *
+ * @param[in] op The binary operator used to combine the bitmasks
+ * @param[out] dest_mask Destination to which the merged result is written
+ * @param[in] masks The list of data pointers of the bitmasks to be merged
+ * @param[in] masks_begin_bits The bit offsets from which each mask is to be merged
+ * @param[in] mask_size_bits The number of bits to be ANDed in each mask
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr Device memory resource used to allocate the returned device_scalar
+ * @return rmm::device_scalar<size_type> Count of set bits
  */
 template <typename Binop>
-std::pair<rmm::device_buffer, size_type> bitmask_binop(
+rmm::device_scalar<size_type> inplace_bitmask_binop_async(
   Binop op,
+  device_span<bitmask_type> dest_mask,
   host_span<bitmask_type const*> masks,
   host_span<size_type const> masks_begin_bits,
   size_type mask_size_bits,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
-  auto dest_mask = rmm::device_buffer{bitmask_allocation_size_bytes(mask_size_bits), stream, mr};
-  auto null_count =
-    mask_size_bits -
-    inplace_bitmask_binop(op,
-                          device_span<bitmask_type>(static_cast<bitmask_type*>(dest_mask.data()),
-                                                    num_bitmask_words(mask_size_bits)),
-                          masks,
-                          masks_begin_bits,
-                          mask_size_bits,
-                          stream,
-                          mr);
+  CUDF_EXPECTS(
+    std::all_of(masks_begin_bits.begin(), masks_begin_bits.end(), [](auto b) { return b >= 0; }),
+    "Invalid range.");
+  CUDF_EXPECTS(mask_size_bits > 0, "Invalid bit range.");
+  CUDF_EXPECTS(std::all_of(masks.begin(), masks.end(), [](auto p) { return p != nullptr; }),
+               "Mask pointer cannot be null");
 
-  return std::make_pair(std::move(dest_mask), null_count);
+  rmm::device_scalar<size_type> d_counter{stream, mr};
+  rmm::device_uvector<bitmask_type const*> d_masks(masks.size(), stream, mr);
+  rmm::device_uvector<size_type> d_begin_bits(masks_begin_bits.size(), stream, mr);
+
+  CUDA_TRY(cudaMemsetAsync(d_counter.data(), 0, sizeof(size_type), stream.value()));
+  copy_host_to_device(d_masks.data(), masks.data(), masks.size_bytes(), stream);
+  copy_host_to_device(
+    d_begin_bits.data(), masks_begin_bits.data(), masks_begin_bits.size_bytes(), stream);
+
+  auto constexpr block_size = 256;
+  cudf::detail::grid_1d config(dest_mask.size(), block_size);
+  offset_bitmask_binop<block_size>
+    <<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+      op, dest_mask, d_masks, d_begin_bits, mask_size_bits, d_counter.data());
+  CUDA_TRY(cudaPeekAtLastError());
+  return d_counter;
 }
 
 /**
@@ -155,32 +177,41 @@ size_type inplace_bitmask_binop(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
-  CUDF_EXPECTS(
-    std::all_of(masks_begin_bits.begin(), masks_begin_bits.end(), [](auto b) { return b >= 0; }),
-    "Invalid range.");
-  CUDF_EXPECTS(mask_size_bits > 0, "Invalid bit range.");
-  CUDF_EXPECTS(std::all_of(masks.begin(), masks.end(), [](auto p) { return p != nullptr; }),
-               "Mask pointer cannot be null");
-
-  rmm::device_scalar<size_type> d_counter{0, stream, mr};
-  rmm::device_uvector<bitmask_type const*> d_masks(masks.size(), stream, mr);
-  rmm::device_uvector<size_type> d_begin_bits(masks_begin_bits.size(), stream, mr);
+  return inplace_bitmask_binop_async(
+           op, dest_mask, masks, masks_begin_bits, mask_size_bits, stream, mr)
+    .value(stream);
+}
 
-  CUDA_TRY(cudaMemcpyAsync(
-    d_masks.data(), masks.data(), masks.size_bytes(), cudaMemcpyHostToDevice, stream.value()));
-  CUDA_TRY(cudaMemcpyAsync(d_begin_bits.data(),
-                           masks_begin_bits.data(),
-                           masks_begin_bits.size_bytes(),
-                           cudaMemcpyHostToDevice,
-                           stream.value()));
+/**
+ * @copydoc bitmask_binop(Binop op, host_span<bitmask_type const *> const, host_span<size_type>
+ * const, size_type, rmm::mr::device_memory_resource *)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+template <typename Binop>
+std::pair<rmm::device_buffer, size_type> bitmask_binop(
+  Binop op,
+  host_span<bitmask_type const*> masks,
+  host_span<size_type const> masks_begin_bits,
+  size_type mask_size_bits,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  auto dest_mask = rmm::device_buffer{bitmask_allocation_size_bytes(mask_size_bits), stream, mr};
+  auto const set_bits = inplace_bitmask_binop_async(
+    op,
+    device_span<bitmask_type>(static_cast<bitmask_type*>(dest_mask.data()),
+                              num_bitmask_words(mask_size_bits)),
+    masks,
+    masks_begin_bits,
+    mask_size_bits,
+    stream,
+    mr);
+  // While capturing, the null count is left to be computed once the graph has been launched
+  auto const null_count =
+    is_capturing(stream) ? UNKNOWN_NULL_COUNT : mask_size_bits - set_bits.value(stream);
 
-  auto constexpr block_size = 256;
-  cudf::detail::grid_1d config(dest_mask.size(), block_size);
-  offset_bitmask_binop<block_size>
-    <<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
-      op, dest_mask, d_masks, d_begin_bits, mask_size_bits, d_counter.data());
-  CHECK_CUDA(stream.value());
-  return d_counter.value(stream);
+  return std::make_pair(std::move(dest_mask), null_count);
 }
 
 /**
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -47,6 +47,23 @@ void set_null_mask(bitmask_type* bitmask,
                    bool valid,
                    rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 
+/**
+ * @brief Sets the bits `[0, size)` of a pre-allocated bitmask to null if the boolean `valid`
+ * residing in device memory is false.
+ *
+ * This combines the validity of a scalar with a bitmask without reading it on the host, which is
+ * what lets a column-scalar operation be captured into a CUDA graph.
+ *
+ * @param bitmask Pointer to bitmask (e.g. returned by `column_view::null_mask()`)
+ * @param size Number of bits of the bitmask
+ * @param valid Device pointer to the validity, e.g. `scalar::validity_data()`
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void nullify_if_invalid(bitmask_type* bitmask,
+                        size_type size,
+                        bool const* valid,
+                        rmm::cuda_stream_view stream);
+
 /**
  * @brief Given a bitmask, counts the number of set (1) bits in the range
  * `[start, stop)`.
@@ -202,6 +219,38 @@ std::vector<size_type> segmented_null_count(bitmask_type const* bitmask,
                                             host_span<size_type const> indices,
                                             rmm::cuda_stream_view stream);
 
+/**
+ * @brief Given many validity bitmasks and a range of each of them, counts the null elements in
+ * each range.
+ *
+ * Unlike calling `null_count` on each range, all the ranges are counted with a single kernel
+ * launch and a single synchronization. A `nullptr` bitmask has no null elements.
+ *
+ * @throws cudf::logic_error if the spans are not of the same size
+ * @throws cudf::logic_error if a range is invalid
+ *
+ * @param[in] bitmasks Validity bitmasks residing in device memory, or `nullptr`
+ * @param[in] begin_bits Index of the first bit of the range of each bitmask (inclusive)
+ * @param[in] end_bits Index of the last bit of the range of each bitmask (exclusive)
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @return The number of null elements in the range of each bitmask
+ */
+std::vector<size_type> batch_null_count(host_span<bitmask_type const* const> bitmasks,
+                                        host_span<size_type const> begin_bits,
+                                        host_span<size_type const> end_bits,
+                                        rmm::cuda_stream_view stream);
+
+/**
+ * @brief Returns the null count of each column, counting the unknown null counts with a single
+ * kernel launch.
+ *
+ * @param[in] columns The columns whose null elements are counted
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @return The `null_count()` of each column
+ */
+std::vector<size_type> batch_null_count(host_span<column_view const> columns,
+                                        rmm::cuda_stream_view stream);
+
 /**
  * @copydoc cudf::copy_bitmask(bitmask_type const*, size_type, size_type,
  *rmm::mr::device_memory_resource*)
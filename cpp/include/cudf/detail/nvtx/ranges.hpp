@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,12 @@
 
 #include "nvtx3.hpp"
 
+#include <cudf/detail/utilities/metrics.hpp>
+#include <cudf/types.hpp>
+
+#include <cstdint>
+#include <optional>
+
 namespace cudf {
 /**
  * @brief Tag type for libcudf's NVTX domain.
@@ -31,6 +37,69 @@ struct libcudf_domain {
  */
 using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
 
+namespace detail {
+
+/**
+ * @brief Returns whether the NVTX ranges of libcudf carry the sizes of their inputs.
+ *
+ * The sizes are recorded if the `LIBCUDF_NVTX_PAYLOADS` environment variable is set to a value
+ * other than `0` when the first range is created.
+ */
+bool nvtx_payloads_enabled();
+
+/**
+ * @brief Sizes of the input of an operation recorded in its NVTX range.
+ */
+struct range_payload {
+  int64_t rows{0};   ///< Number of rows of the input
+  int64_t bytes{0};  ///< Bytes of device memory spanned by the input, including null masks
+};
+
+/**
+ * @brief Returns the number of rows and bytes of a column.
+ *
+ * The bytes are those of the data, null mask and children of the column, all computed on the host.
+ */
+range_payload make_range_payload(column_view const& input);
+
+/**
+ * @copydoc make_range_payload(column_view const&)
+ */
+range_payload make_range_payload(table_view const& input);
+
+/**
+ * @brief NVTX range in the libcudf domain whose message and payload carry the sizes of the input
+ * of the enclosing function.
+ *
+ * When `nvtx_payloads_enabled()` is false, the sizes are not computed and the range is the one
+ * `CUDF_FUNC_RANGE()` creates.
+ */
+class payload_range {
+ public:
+  /**
+   * @brief Pushes the range.
+   *
+   * @param attr Attributes of the range without payload, holding the registered function name
+   * @param func Name of the function
+   * @param input Input of the function, passed to `make_range_payload`
+   */
+  template <typename Input>
+  payload_range(::nvtx3::event_attributes const& attr, char const* func, Input const& input)
+  {
+    if (nvtx_payloads_enabled()) {
+      push(func, make_range_payload(input));
+    } else {
+      _range.emplace(attr);
+    }
+  }
+
+ private:
+  void push(char const* func, range_payload const& payload);
+
+  std::optional<thread_range> _range;
+};
+
+}  // namespace detail
 }  // namespace cudf
 
 /**
@@ -38,7 +107,8 @@ using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
  * from the lifetime of a function.
  *
  * Uses the name of the immediately enclosing function returned by `__func__` to
- * name the range.
+ * name the range. When `cudf::metrics::is_enabled()`, the call is also counted
+ * in the metrics registry under that name.
  *
  * Example:
  * ```
@@ -48,4 +118,36 @@ using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
  * }
  * ```
  */
-#define CUDF_FUNC_RANGE() NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain)
+#define CUDF_FUNC_RANGE()                   \
+  NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain) \
+  ::cudf::metrics::detail::scope const cudf_metrics_scope__{__func__}
+
+/**
+ * @brief Convenience macro for generating an NVTX range in the `libcudf` domain
+ * from the lifetime of a function, carrying the sizes of its input.
+ *
+ * When `LIBCUDF_NVTX_PAYLOADS` is set, the message of the range is the function
+ * name followed by the number of rows and bytes of `input`, and the payload of
+ * the range is the number of rows. Otherwise the range is that of
+ * `CUDF_FUNC_RANGE()` and `input` is not inspected for it.
+ *
+ * When `cudf::metrics::is_enabled()`, the call is also recorded in the metrics
+ * registry with the bytes of `input` and the GPU time of its work on `stream`.
+ *
+ * Example:
+ * ```
+ * std::unique_ptr<table> some_function(table_view const& input,
+ *                                      rmm::cuda_stream_view stream){
+ *    CUDF_FUNC_RANGE_WITH_PAYLOAD(input, stream);
+ *    ...
+ * }
+ * ```
+ */
+#define CUDF_FUNC_RANGE_WITH_PAYLOAD(input, stream)                                           \
+  static ::nvtx3::registered_message<cudf::libcudf_domain> const nvtx3_func_name__{__func__}; \
+  static ::nvtx3::event_attributes const nvtx3_func_attr__{nvtx3_func_name__};                \
+  ::cudf::detail::payload_range const nvtx3_range__{nvtx3_func_attr__, __func__, input};      \
+  ::cudf::metrics::detail::scope const cudf_metrics_scope__{                                  \
+    __func__,                                                                                 \
+    ::cudf::metrics::is_enabled() ? ::cudf::detail::make_range_payload(input).bytes : 0,      \
+    stream}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,11 +16,14 @@
 
 #pragma once
 
+#include <cudf/aggregation.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <vector>
+
 namespace cudf {
 namespace reduction {
 /**
@@ -254,5 +257,26 @@ std::unique_ptr<scalar> nth_element(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the SUM, SUM_OF_SQUARES, MIN, MAX, MEAN, VARIANCE and STD aggregations of
+ * `aggs` on each of `columns` in a single pass over each column.
+ *
+ * All the partial results are copied back to the host with a single synchronization of `stream`.
+ * The output types are those of `cudf::detail::target_type`. Only the columns of arithmetic
+ * types with at least one valid element are reduced; the results of the other columns and of the
+ * other aggregations are `nullptr`.
+ *
+ * @param columns Input columns to reduce
+ * @param aggs Aggregations to compute on each column
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned scalars' device memory
+ * @return The result of `aggs[j]` on `columns[i]` at `[i][j]`, or `nullptr` if it was not computed
+ */
+std::vector<std::vector<std::unique_ptr<scalar>>> fused_reduce(
+  std::vector<column_view> const& columns,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace reduction
 }  // namespace cudf
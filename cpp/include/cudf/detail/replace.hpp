@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,7 +20,9 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -48,6 +50,18 @@ std::unique_ptr<column> replace_nulls(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::replace_nulls(table_view const&,
+ * std::vector<std::reference_wrapper<scalar const>> const&, rmm::mr::device_memory_resource*)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> replace_nulls(
+  table_view const& input,
+  std::vector<std::reference_wrapper<scalar const>> const& replacements,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::replace_nulls(column_view const&, replace_policy const&,
  * rmm::mr::device_memory_resource*)
@@ -96,6 +110,38 @@ std::unique_ptr<column> find_and_replace_all(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::clamp(column_view const&, scalar const&, scalar const&, scalar const&,
+ * scalar const&, rmm::mr::device_memory_resource*)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> clamp(
+  column_view const& input,
+  scalar const& lo,
+  scalar const& lo_replace,
+  scalar const& hi,
+  scalar const& hi_replace,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::clamp(table_view const&, std::vector<std::reference_wrapper<scalar const>>
+ * const&, std::vector<std::reference_wrapper<scalar const>> const&,
+ * std::vector<std::reference_wrapper<scalar const>> const&,
+ * std::vector<std::reference_wrapper<scalar const>> const&, rmm::mr::device_memory_resource*)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> clamp(
+  table_view const& input,
+  std::vector<std::reference_wrapper<scalar const>> const& lo,
+  std::vector<std::reference_wrapper<scalar const>> const& lo_replace,
+  std::vector<std::reference_wrapper<scalar const>> const& hi,
+  std::vector<std::reference_wrapper<scalar const>> const& hi_replace,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::normalize_nans_and_zeros
  *
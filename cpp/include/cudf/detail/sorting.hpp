@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -24,6 +24,12 @@
 #include <vector>
 
 namespace cudf {
+namespace structs {
+namespace detail {
+class preprocessed_table;
+}  // namespace detail
+}  // namespace structs
+
 namespace detail {
 
 /**
@@ -50,6 +56,45 @@ std::unique_ptr<column> stable_sorted_order(
   rmm::cuda_stream_view stream                   = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the row indices that would produce `keys` in lexicographic sorted order.
+ *
+ * The keys may be shared with other operations over the same table, which then flatten its
+ * struct columns and copy them to the device only once.
+ *
+ * @param keys Keys flattened and copied to the device, with their column orders
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A non-nullable column of `size_type` elements containing the permuted row indices of
+ * `keys` when sorted
+ */
+std::unique_ptr<column> sorted_order(
+  structs::detail::preprocessed_table const& keys,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes the row indices that would produce `keys` in a stable lexicographic sorted
+ * order.
+ *
+ * @copydetails sorted_order(structs::detail::preprocessed_table const&, rmm::cuda_stream_view,
+ * rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<column> stable_sorted_order(
+  structs::detail::preprocessed_table const& keys,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Checks whether the rows of `keys` are sorted in lexicographical order.
+ *
+ * @param keys Keys flattened and copied to the device, with their column orders
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return true if sorted as expected, false if not
+ */
+bool is_sorted(structs::detail::preprocessed_table const& keys,
+               rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 /**
  * @copydoc cudf::sort_by_key
  *
@@ -117,6 +162,33 @@ std::unique_ptr<table> stable_segmented_sort_by_key(
   rmm::cuda_stream_view stream                   = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::top_k
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> top_k(
+  table_view const& keys,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::segmented_top_k
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> segmented_top_k(
+  table_view const& keys,
+  column_view const& segment_offsets,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::sort
  *
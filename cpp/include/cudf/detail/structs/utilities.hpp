@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,8 +22,14 @@
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <functional>
+#include <memory>
 
 namespace cudf {
+class table_device_view;
+
 namespace structs {
 namespace detail {
 
@@ -150,6 +156,101 @@ flattened_table flatten_nested_columns(
   std::vector<null_order> const& null_precedence,
   column_nullability nullability = column_nullability::MATCH_INCOMING);
 
+/**
+ * @brief Keys table flattened, copied to the device and paired with its device-side orders once,
+ * to be shared by every comparator and hasher built over the same keys.
+ *
+ * Sorting, searching and hashing a table with struct columns all start by flattening it through
+ * `flatten_nested_columns()`, creating a `table_device_view` of the result and copying the
+ * flattened column orders and null precedences to the device. An operation that builds several
+ * of these over the same keys (e.g. sorting the keys and then checking or searching them) pays
+ * for that preprocessing once by creating a `preprocessed_table` and passing it along instead.
+ *
+ * A `row_lexicographic_comparator` over the keys is constructed from `device_view()`,
+ * `d_column_order()` and `d_null_precedence()`; a `row_equality_comparator` or `row_hasher`
+ * from `device_view()` alone. The flattened columns are kept alive with the object.
+ */
+class preprocessed_table {
+ public:
+  using table_device_view_owner =
+    std::unique_ptr<table_device_view, std::function<void(table_device_view*)>>;
+
+  /**
+   * @brief Flatten the keys of `input` and copy them, with their orders, to the device.
+   *
+   * @throw cudf::logic_error if `column_order` or `null_precedence` is not empty and does not
+   * have one element per column of `input`
+   *
+   * @param input Keys table, which may hold struct columns
+   * @param column_order Per-column order of `input`, empty for all ascending
+   * @param null_precedence Per-column null order of `input`, empty for all nulls before
+   * @param nullability Whether the flattened columns are forced to be nullable
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return The preprocessed keys
+   */
+  static std::shared_ptr<preprocessed_table> create(
+    table_view const& input,
+    std::vector<order> const& column_order,
+    std::vector<null_order> const& null_precedence,
+    column_nullability nullability,
+    rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Getter for the flattened columns, as a `table_view`.
+   */
+  [[nodiscard]] table_view flattened_columns() const { return _flattened.flattened_columns(); }
+
+  /**
+   * @brief Getter for the cudf::order of the flattened columns, on the host.
+   */
+  [[nodiscard]] std::vector<order> orders() const { return _flattened.orders(); }
+
+  /**
+   * @brief Getter for the cudf::null_order of the flattened columns, on the host.
+   */
+  [[nodiscard]] std::vector<null_order> null_orders() const { return _flattened.null_orders(); }
+
+  /**
+   * @brief Getter for the device view of the flattened columns.
+   */
+  [[nodiscard]] table_device_view const& device_view() const { return *_device_view; }
+
+  /**
+   * @brief Device pointer to the cudf::order of each flattened column.
+   */
+  [[nodiscard]] order const* d_column_order() const { return _d_column_order.data(); }
+
+  /**
+   * @brief Device pointer to the cudf::null_order of each flattened column.
+   */
+  [[nodiscard]] null_order const* d_null_precedence() const { return _d_null_precedence.data(); }
+
+  /**
+   * @brief Whether any of the flattened columns has nulls.
+   */
+  [[nodiscard]] bool has_nulls() const { return _has_nulls; }
+
+ private:
+  preprocessed_table(flattened_table&& flattened,
+                     table_device_view_owner&& device_view,
+                     rmm::device_uvector<order>&& d_column_order,
+                     rmm::device_uvector<null_order>&& d_null_precedence,
+                     bool has_nulls)
+    : _flattened{std::move(flattened)},
+      _device_view{std::move(device_view)},
+      _d_column_order{std::move(d_column_order)},
+      _d_null_precedence{std::move(d_null_precedence)},
+      _has_nulls{has_nulls}
+  {
+  }
+
+  flattened_table _flattened;
+  table_device_view_owner _device_view;
+  rmm::device_uvector<order> _d_column_order;
+  rmm::device_uvector<null_order> _d_null_precedence;
+  bool _has_nulls;
+};
+
 /**
  * @brief Unflatten columns flattened as by `flatten_nested_columns()`,
  *        based on the provided `blueprint`.
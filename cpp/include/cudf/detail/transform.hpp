@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -36,14 +36,55 @@ std::unique_ptr<column> transform(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::transform(table_view const&, std::string const&, std::vector<data_type> const&,
+ * bool, bool, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> transform(
+  table_view const& input,
+  std::string const& udf,
+  std::vector<data_type> const& output_types,
+  bool is_ptx,
+  bool propagate_nulls,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Compiles the kernel that `cudf::transform` launches for a UDF without launching it.
+ *
+ * @throws cudf::logic_error if `input_type` is not a fixed-width type
+ *
+ * @param unary_udf The PTX/CUDA string of the unary function
+ * @param input_type The type of the input column
+ * @param output_type The output type that is compatible with the output type in the UDF
+ * @param is_ptx true: the UDF is treated as PTX code; false: the UDF is treated as CUDA code
+ */
+void precompile_transform(std::string const& unary_udf,
+                          data_type input_type,
+                          data_type output_type,
+                          bool is_ptx);
+
 /**
  * @copydoc cudf::compute_column
  *
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
 std::unique_ptr<column> compute_column(
-  table_view const table,
-  ast::operation const& expr,
+  table_view const& table,
+  ast::expression const& expr,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::compute_column_jit
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> compute_column_jit(
+  table_view const& table,
+  ast::expression const& expr,
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
@@ -88,6 +129,17 @@ std::pair<std::unique_ptr<column>, table_view> one_hot_encode(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::one_hot_encode_sparse
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> one_hot_encode_sparse(
+  column_view const& input,
+  column_view const& categories,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::mask_to_bools
  *
@@ -110,5 +162,14 @@ std::unique_ptr<column> row_bit_count(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::make_batches
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<size_type> make_batches(table_view const& t,
+                                    std::size_t max_bytes,
+                                    rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 }  // namespace detail
 }  // namespace cudf
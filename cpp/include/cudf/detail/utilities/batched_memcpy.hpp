@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+/**
+ * @brief Copy of many device buffers of any sizes in a few kernel launches
+ * @file batched_memcpy.hpp
+ */
+
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Copy each source buffer into its destination buffer.
+ *
+ * The copies are fused into a few kernel launches, whatever the number and sizes of the buffers:
+ * each small buffer is copied by a single warp, and each large buffer is split into tiles copied
+ * by whole blocks. The copies use 16-byte or 4-byte loads and stores whenever the source and the
+ * destination are equally misaligned.
+ *
+ * The buffers must not overlap.
+ *
+ * @throws cudf::logic_error if the spans are not of the same size
+ *
+ * @param dst_bufs Device pointers to the destination buffers
+ * @param src_bufs Device pointers to the source buffers
+ * @param buf_sizes Sizes in bytes of the buffers
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void batched_memcpy(device_span<uint8_t* const> dst_bufs,
+                    device_span<uint8_t const* const> src_bufs,
+                    device_span<std::size_t const> buf_sizes,
+                    rmm::cuda_stream_view stream);
+
+}  // namespace detail
+}  // namespace cudf
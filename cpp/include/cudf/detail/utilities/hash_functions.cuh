@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2017-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstring>
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/utilities/assert.cuh>
@@ -70,6 +71,18 @@ void __device__ inline uint32ToLowercaseHexString(uint32_t num, char* destinatio
   std::memcpy(destination, reinterpret_cast<uint8_t*>(&x), 8);
 }
 
+/**
+ * @brief Reads the 8-byte, or 4-byte, little-endian chunk at the start of `data`, which does not
+ * need to be aligned.
+ */
+template <typename T>
+__device__ inline T load_chunk(uint8_t const* data)
+{
+  T chunk;
+  std::memcpy(&chunk, data, sizeof(T));
+  return chunk;
+}
+
 }  // namespace detail
 }  // namespace cudf
 
@@ -555,6 +568,345 @@ hash_value_type __device__ inline SparkMurmurHash3_32<double>::operator()(double
   return this->compute_floating_point(key);
 }
 
+// xxHash64 implementation from
+// https://github.com/Cyan4973/xxHash
+//-----------------------------------------------------------------------------
+// xxHash - Extremely Fast Hash algorithm
+// Copyright (C) 2012-2021 Yann Collet
+// BSD 2-Clause License (https://www.opensource.org/licenses/bsd-license.php)
+template <typename Key>
+struct XXHash_64 {
+  using argument_type = Key;
+  using result_type   = uint64_t;
+
+  XXHash_64() = default;
+  constexpr XXHash_64(uint64_t seed) : m_seed(seed) {}
+
+  /**
+   * @brief Combines two hash values into a new single hash value, with the 64-bit constant of the
+   * Boost hash_combine function.
+   */
+  __device__ inline result_type hash_combine(result_type lhs, result_type rhs) const
+  {
+    return lhs ^ (rhs + 0x9e3779b97f4a7c15 + (lhs << 6) + (lhs >> 2));
+  }
+
+  result_type __device__ inline operator()(Key const& key) const
+  {
+    return compute(cudf::detail::normalize_nans_and_zeros(key));
+  }
+
+  template <typename TKey>
+  result_type __device__ inline compute(TKey const& key) const
+  {
+    return compute_bytes(reinterpret_cast<uint8_t const*>(&key), sizeof(TKey));
+  }
+
+  result_type __device__ compute_bytes(uint8_t const* data, cudf::size_type const len) const
+  {
+    cudf::size_type offset = 0;
+    uint64_t h64;
+    // process 32-byte stripes in four lanes
+    if (len >= 32) {
+      uint64_t v1 = m_seed + prime1 + prime2;
+      uint64_t v2 = m_seed + prime2;
+      uint64_t v3 = m_seed;
+      uint64_t v4 = m_seed - prime1;
+      do {
+        v1 = round(v1, cudf::detail::load_chunk<uint64_t>(data + offset));
+        v2 = round(v2, cudf::detail::load_chunk<uint64_t>(data + offset + 8));
+        v3 = round(v3, cudf::detail::load_chunk<uint64_t>(data + offset + 16));
+        v4 = round(v4, cudf::detail::load_chunk<uint64_t>(data + offset + 24));
+        offset += 32;
+      } while (offset <= len - 32);
+
+      h64 = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+      h64 = merge_round(h64, v1);
+      h64 = merge_round(h64, v2);
+      h64 = merge_round(h64, v3);
+      h64 = merge_round(h64, v4);
+    } else {
+      h64 = m_seed + prime5;
+    }
+    h64 += len;
+
+    // process the remaining 8-byte, 4-byte and 1-byte chunks
+    for (; offset + 8 <= len; offset += 8) {
+      h64 ^= round(0, cudf::detail::load_chunk<uint64_t>(data + offset));
+      h64 = rotl64(h64, 27) * prime1 + prime4;
+    }
+    if (offset + 4 <= len) {
+      h64 ^= static_cast<uint64_t>(cudf::detail::load_chunk<uint32_t>(data + offset)) * prime1;
+      h64 = rotl64(h64, 23) * prime2 + prime3;
+      offset += 4;
+    }
+    for (; offset < len; ++offset) {
+      h64 ^= data[offset] * prime5;
+      h64 = rotl64(h64, 11) * prime1;
+    }
+
+    // finalization
+    h64 ^= h64 >> 33;
+    h64 *= prime2;
+    h64 ^= h64 >> 29;
+    h64 *= prime3;
+    h64 ^= h64 >> 32;
+    return h64;
+  }
+
+ private:
+  static constexpr uint64_t prime1 = 0x9e3779b185ebca87;
+  static constexpr uint64_t prime2 = 0xc2b2ae3d27d4eb4f;
+  static constexpr uint64_t prime3 = 0x165667b19e3779f9;
+  static constexpr uint64_t prime4 = 0x85ebca77c2b2ae63;
+  static constexpr uint64_t prime5 = 0x27d4eb2f165667c5;
+
+  [[nodiscard]] __device__ inline uint64_t rotl64(uint64_t x, int8_t r) const
+  {
+    return (x << r) | (x >> (64 - r));
+  }
+
+  [[nodiscard]] __device__ inline uint64_t round(uint64_t acc, uint64_t input) const
+  {
+    acc += input * prime2;
+    acc = rotl64(acc, 31);
+    return acc * prime1;
+  }
+
+  [[nodiscard]] __device__ inline uint64_t merge_round(uint64_t acc, uint64_t val) const
+  {
+    acc ^= round(0, val);
+    return acc * prime1 + prime4;
+  }
+
+  uint64_t m_seed{cudf::DEFAULT_HASH_SEED};
+};
+
+template <>
+XXHash_64<bool>::result_type __device__ inline XXHash_64<bool>::operator()(bool const& key) const
+{
+  return this->compute(static_cast<uint8_t>(key));
+}
+
+/**
+ * @brief Specialization of XXHash_64 operator for strings.
+ */
+template <>
+XXHash_64<cudf::string_view>::result_type __device__ inline XXHash_64<cudf::string_view>::
+operator()(cudf::string_view const& key) const
+{
+  return this->compute_bytes(reinterpret_cast<uint8_t const*>(key.data()), key.size_bytes());
+}
+
+template <>
+XXHash_64<numeric::decimal32>::result_type __device__ inline XXHash_64<numeric::decimal32>::
+operator()(numeric::decimal32 const& key) const
+{
+  return this->compute(key.value());
+}
+
+template <>
+XXHash_64<numeric::decimal64>::result_type __device__ inline XXHash_64<numeric::decimal64>::
+operator()(numeric::decimal64 const& key) const
+{
+  return this->compute(key.value());
+}
+
+template <>
+XXHash_64<numeric::decimal128>::result_type __device__ inline XXHash_64<numeric::decimal128>::
+operator()(numeric::decimal128 const& key) const
+{
+  return this->compute(key.value());
+}
+
+template <>
+XXHash_64<cudf::list_view>::result_type __device__ inline XXHash_64<cudf::list_view>::operator()(
+  cudf::list_view const& key) const
+{
+  cudf_assert(false && "List column hashing is not supported");
+  return 0;
+}
+
+template <>
+XXHash_64<cudf::struct_view>::result_type __device__ inline XXHash_64<cudf::struct_view>::
+operator()(cudf::struct_view const& key) const
+{
+  cudf_assert(false && "Direct hashing of struct_view is not supported");
+  return 0;
+}
+
+/**
+ * @brief 64-bit Murmur3 hash, the first half of the 128-bit value of MurmurHash3_x64_128.
+ *
+ * MurmurHash3_x64_128 implementation from
+ * https://github.com/aappleby/smhasher/blob/master/src/MurmurHash3.cpp
+ * MurmurHash3 was written by Austin Appleby, and is placed in the public domain.
+ */
+template <typename Key>
+struct MurmurHash3_64 {
+  using argument_type = Key;
+  using result_type   = uint64_t;
+
+  MurmurHash3_64() = default;
+  constexpr MurmurHash3_64(uint32_t seed) : m_seed(seed) {}
+
+  /**
+   * @brief Combines two hash values into a new single hash value, with the 64-bit constant of the
+   * Boost hash_combine function.
+   */
+  __device__ inline result_type hash_combine(result_type lhs, result_type rhs) const
+  {
+    return lhs ^ (rhs + 0x9e3779b97f4a7c15 + (lhs << 6) + (lhs >> 2));
+  }
+
+  result_type __device__ inline operator()(Key const& key) const
+  {
+    return compute(cudf::detail::normalize_nans_and_zeros(key));
+  }
+
+  template <typename TKey>
+  result_type __device__ inline compute(TKey const& key) const
+  {
+    return compute_bytes(reinterpret_cast<uint8_t const*>(&key), sizeof(TKey));
+  }
+
+  result_type __device__ compute_bytes(uint8_t const* data, cudf::size_type const len) const
+  {
+    constexpr uint64_t c1 = 0x87c37b91114253d5;
+    constexpr uint64_t c2 = 0x4cf5ad432745937f;
+    cudf::size_type const nblocks = len / 16;
+    uint64_t h1                   = m_seed;
+    uint64_t h2                   = m_seed;
+
+    //----------
+    // body
+    for (cudf::size_type i = 0; i < nblocks; i++) {
+      uint64_t k1 = cudf::detail::load_chunk<uint64_t>(data + i * 16);
+      uint64_t k2 = cudf::detail::load_chunk<uint64_t>(data + i * 16 + 8);
+      k1 *= c1;
+      k1 = rotl64(k1, 31);
+      k1 *= c2;
+      h1 ^= k1;
+      h1 = rotl64(h1, 27);
+      h1 += h2;
+      h1 = h1 * 5 + 0x52dce729;
+      k2 *= c2;
+      k2 = rotl64(k2, 33);
+      k2 *= c1;
+      h2 ^= k2;
+      h2 = rotl64(h2, 31);
+      h2 += h1;
+      h2 = h2 * 5 + 0x38495ab5;
+    }
+    //----------
+    // tail
+    uint8_t const* tail        = data + nblocks * 16;
+    cudf::size_type const rest = len & 15;
+    uint64_t k1                = 0;
+    uint64_t k2                = 0;
+    for (cudf::size_type i = rest; i > 8; --i) {
+      k2 ^= static_cast<uint64_t>(tail[i - 1]) << ((i - 9) * 8);
+    }
+    if (rest > 8) {
+      k2 *= c2;
+      k2 = rotl64(k2, 33);
+      k2 *= c1;
+      h2 ^= k2;
+    }
+    for (cudf::size_type i = rest < 8 ? rest : 8; i > 0; --i) {
+      k1 ^= static_cast<uint64_t>(tail[i - 1]) << ((i - 1) * 8);
+    }
+    if (rest > 0) {
+      k1 *= c1;
+      k1 = rotl64(k1, 31);
+      k1 *= c2;
+      h1 ^= k1;
+    }
+    //----------
+    // finalization
+    h1 ^= len;
+    h2 ^= len;
+    h1 += h2;
+    h2 += h1;
+    h1 = fmix64(h1);
+    h2 = fmix64(h2);
+    // the first 64 bits of the 128-bit hash
+    return h1 + h2;
+  }
+
+ private:
+  [[nodiscard]] __device__ inline uint64_t rotl64(uint64_t x, int8_t r) const
+  {
+    return (x << r) | (x >> (64 - r));
+  }
+
+  [[nodiscard]] __device__ inline uint64_t fmix64(uint64_t k) const
+  {
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccd;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53;
+    k ^= k >> 33;
+    return k;
+  }
+
+  uint64_t m_seed{cudf::DEFAULT_HASH_SEED};
+};
+
+template <>
+MurmurHash3_64<bool>::result_type __device__ inline MurmurHash3_64<bool>::operator()(
+  bool const& key) const
+{
+  return this->compute(static_cast<uint8_t>(key));
+}
+
+/**
+ * @brief Specialization of MurmurHash3_64 operator for strings.
+ */
+template <>
+MurmurHash3_64<cudf::string_view>::result_type __device__ inline MurmurHash3_64<
+  cudf::string_view>::operator()(cudf::string_view const& key) const
+{
+  return this->compute_bytes(reinterpret_cast<uint8_t const*>(key.data()), key.size_bytes());
+}
+
+template <>
+MurmurHash3_64<numeric::decimal32>::result_type __device__ inline MurmurHash3_64<
+  numeric::decimal32>::operator()(numeric::decimal32 const& key) const
+{
+  return this->compute(key.value());
+}
+
+template <>
+MurmurHash3_64<numeric::decimal64>::result_type __device__ inline MurmurHash3_64<
+  numeric::decimal64>::operator()(numeric::decimal64 const& key) const
+{
+  return this->compute(key.value());
+}
+
+template <>
+MurmurHash3_64<numeric::decimal128>::result_type __device__ inline MurmurHash3_64<
+  numeric::decimal128>::operator()(numeric::decimal128 const& key) const
+{
+  return this->compute(key.value());
+}
+
+template <>
+MurmurHash3_64<cudf::list_view>::result_type __device__ inline MurmurHash3_64<
+  cudf::list_view>::operator()(cudf::list_view const& key) const
+{
+  cudf_assert(false && "List column hashing is not supported");
+  return 0;
+}
+
+template <>
+MurmurHash3_64<cudf::struct_view>::result_type __device__ inline MurmurHash3_64<
+  cudf::struct_view>::operator()(cudf::struct_view const& key) const
+{
+  cudf_assert(false && "Direct hashing of struct_view is not supported");
+  return 0;
+}
+
 /**
  * @brief  This hash function simply returns the value that is asked to be hash
  * reinterpreted as the result_type of the functor.
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/metrics.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cudf {
+namespace metrics {
+namespace detail {
+
+/**
+ * @brief Records one call of a public API or IO reader stage into the metrics registry for its
+ * lifetime.
+ *
+ * Nothing is done when `cudf::metrics::is_enabled()` is false. An API scope is only recorded when
+ * no other API scope is active on the thread, while stage scopes are always recorded.
+ *
+ * Use `CUDF_FUNC_RANGE()` or `CUDF_FUNC_RANGE_WITH_PAYLOAD()` rather than this class in public
+ * APIs.
+ */
+class scope {
+ public:
+  /**
+   * @brief Kind of the recorded call.
+   */
+  enum class kind { api, stage };
+
+  /**
+   * @brief Records the call of an API without timing it.
+   *
+   * @param name Name of the API
+   */
+  explicit scope(char const* name) noexcept;
+
+  /**
+   * @brief Records the call of an API or stage, timing its work on `stream`.
+   *
+   * @param name Name of the API or stage
+   * @param bytes Bytes of the input of the call
+   * @param stream Stream of the call
+   * @param k Kind of the call
+   */
+  scope(char const* name, int64_t bytes, rmm::cuda_stream_view stream, kind k = kind::api);
+
+  scope(scope const&) = delete;
+  scope& operator=(scope const&) = delete;
+
+  ~scope();
+
+ private:
+  friend void record_temporary_bytes(std::size_t bytes) noexcept;
+
+  void start(kind k) noexcept;
+  void start_timing(rmm::cuda_stream_view stream) noexcept;
+
+  char const* _name{nullptr};
+  kind _kind{kind::api};
+  bool _active{false};
+  int64_t _bytes{0};
+  std::size_t _peak_temporary_bytes{0};
+  bool _timed{false};
+  int _device{0};
+  rmm::cuda_stream_view _stream{};
+  cudaEvent_t _start{};
+  cudaEvent_t _stop{};
+};
+
+/**
+ * @brief Records the size of a temporary arena of the API call active on the thread.
+ *
+ * @param bytes Bytes reserved by the arena
+ */
+void record_temporary_bytes(std::size_t bytes) noexcept;
+
+}  // namespace detail
+}  // namespace metrics
+}  // namespace cudf
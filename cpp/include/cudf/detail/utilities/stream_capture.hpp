@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+/**
+ * @brief Utilities for the algorithms that may be recorded into a CUDA graph by stream capture
+ * @file stream_capture.hpp
+ */
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstddef>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Returns whether work launched on `stream` is being recorded into a CUDA graph.
+ *
+ * While a stream is capturing, its work is not executed, so results cannot be copied to the host
+ * and the stream cannot be synchronized. Algorithms that are capture-safe use this to defer what
+ * they would otherwise read back, like the null count of their output whose computation is left
+ * to the first call of `null_count()` after the graph is launched.
+ *
+ * The default stream is never reported as capturing, since it cannot be captured.
+ *
+ * @param stream Stream to query
+ * @return true if `stream` is capturing
+ */
+bool is_capturing(rmm::cuda_stream_view stream);
+
+/**
+ * @brief Copies pageable host memory to device memory such that the host memory may be released
+ * as soon as the call returns.
+ *
+ * When `stream` is capturing, the bytes are passed by value as parameters of the captured copy
+ * kernels rather than by a memcpy, whose graph node would read the host memory again each time
+ * the graph is launched. Otherwise the copy is a `cudaMemcpyAsync`, which has staged the pageable
+ * host memory by the time it returns.
+ *
+ * @param dst Device pointer to the destination
+ * @param src Host pointer to the source, in pageable memory
+ * @param size Number of bytes to copy
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void copy_host_to_device(void* dst,
+                         void const* src,
+                         std::size_t size,
+                         rmm::cuda_stream_view stream);
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Stream-ordered arena for the short-lived temporaries of a single call of an algorithm.
+ *
+ * An algorithm creates an arena on its stream and passes it as the memory resource of its
+ * temporaries (gather maps, offsets, hash tables, scratch space). Allocations are bumped from
+ * blocks allocated from the upstream resource, and the blocks are only freed, all at once, when
+ * the arena is destroyed; releasing the most recent allocation makes its memory available again.
+ * This replaces the many allocations and frees of the temporaries by a few per call.
+ *
+ * Memory returned to the caller of the algorithm must never be allocated from the arena.
+ *
+ * The arena is not thread-safe. Allocations on another stream than the arena's are forwarded to
+ * the upstream resource.
+ */
+class temporary_arena final : public rmm::mr::device_memory_resource {
+ public:
+  /// Size of the first block allocated by default
+  static constexpr std::size_t default_block_size = 1u << 20;
+
+  /**
+   * @brief Constructor.
+   *
+   * No memory is allocated until the first allocation from the arena.
+   *
+   * @param stream Stream of the algorithm, on which the blocks are allocated and freed
+   * @param initial_block_size Size of the first block, doubled for each of the following ones
+   * @param upstream Resource the blocks are allocated from
+   */
+  explicit temporary_arena(
+    rmm::cuda_stream_view stream,
+    std::size_t initial_block_size            = default_block_size,
+    rmm::mr::device_memory_resource* upstream = rmm::mr::get_current_device_resource());
+
+  temporary_arena(temporary_arena const&) = delete;
+  temporary_arena& operator=(temporary_arena const&) = delete;
+
+  /**
+   * @brief Destructor, freeing the blocks on the arena's stream.
+   *
+   * All the work using the temporaries must have been queued on that stream.
+   */
+  ~temporary_arena() override;
+
+  /**
+   * @brief Returns the total size of the blocks allocated from the upstream resource.
+   */
+  [[nodiscard]] std::size_t reserved_bytes() const;
+
+  /**
+   * @brief Allocations are ordered on the stream they are made on.
+   */
+  [[nodiscard]] bool supports_streams() const noexcept override { return true; }
+
+  /**
+   * @brief The arena does not report the memory available to it.
+   */
+  [[nodiscard]] bool supports_get_mem_info() const noexcept override { return false; }
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override;
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override;
+
+  [[nodiscard]] std::pair<std::size_t, std::size_t> do_get_mem_info(
+    rmm::cuda_stream_view) const override
+  {
+    return {0, 0};
+  }
+
+  /**
+   * @brief Block allocated from the upstream resource, bumped from its start
+   */
+  struct block {
+    char* ptr;
+    std::size_t size;
+    std::size_t used;
+  };
+
+  rmm::mr::device_memory_resource* _upstream;
+  rmm::cuda_stream_view _stream;
+  std::size_t _next_block_size;
+  std::vector<block> _blocks;
+};
+
+}  // namespace detail
+}  // namespace cudf
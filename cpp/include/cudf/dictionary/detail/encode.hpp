@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/table/table_view.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
@@ -56,6 +57,18 @@ std::unique_ptr<column> encode(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::dictionary::hash_encode
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> hash_encode(
+  column_view const& column,
+  bool sort_keys                      = false,
+  data_type indices_type              = data_type{type_id::UINT32},
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Create a column by gathering the keys from the provided
  * dictionary_column into a new column using the indices from that column.
@@ -84,6 +97,28 @@ std::unique_ptr<column> decode(
  */
 data_type get_indices_type_for_size(size_type keys_size);
 
+/**
+ * @brief Returns a table_view whose dictionary columns are replaced by views of their indices.
+ *
+ * The keys of a dictionary column are unique and sorted, so its indices compare equal and are
+ * ordered like its elements. Rows of dictionary columns can then be grouped, joined or sorted
+ * as integers rather than by decoding their keys. The indices of several dictionary columns
+ * only compare like their elements when they have the same keys, see `match_dictionaries`.
+ *
+ * The indices views have the offset, size and null mask of their dictionary columns. Empty
+ * dictionary columns without children are left unchanged.
+ *
+ * ```
+ * t = [{["a","c","d"],[2,0,1,0]}, [5,6,7,8]]
+ * v = indices_view(t)
+ * v is now [[2,0,1,0], [5,6,7,8]]
+ * ```
+ *
+ * @param input Table whose dictionary columns are replaced.
+ * @return The table_view of the replaced columns.
+ */
+table_view indices_view(table_view const& input);
+
 }  // namespace detail
 }  // namespace dictionary
 }  // namespace cudf
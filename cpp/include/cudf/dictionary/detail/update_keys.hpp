@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -95,7 +95,8 @@ std::vector<std::unique_ptr<column>> match_dictionaries(
  * Merging the dictionary keys also adjusts the indices appropriately in the
  * output dictionary columns.
  *
- * Any null rows are left unchanged.
+ * Any null rows are left unchanged. Dictionary columns that already have the same keys and
+ * type of indices are not copied, their column_views are returned as they are.
  *
  * @param input Vector of cudf::table_views that include dictionary columns to be matched.
  * @param stream CUDA stream used for device memory operations and kernel launches.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,10 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+
 namespace cudf {
 namespace dictionary {
 /**
@@ -59,6 +63,109 @@ std::unique_ptr<column> encode(
   data_type indices_type              = data_type{type_id::UINT32},
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Construct a dictionary column by dictionary encoding an existing column in a single
+ * hash pass over its rows.
+ *
+ * Unlike `encode`, the keys are not sorted by default: they are the distinct non-null values in
+ * the order of their first row in the column. Such a dictionary may be decoded or gathered, but
+ * the operations searching or merging the keys expect them sorted. When `sort_keys` is true, only
+ * the unique keys are sorted afterwards and the result is the same as that of `encode`.
+ *
+ * The null_mask and null count are copied from the input column to the output column.
+ *
+ * @throw cudf::logic_error if indices type is not an unsigned integer type.
+ * @throw cudf::logic_error if the column to encode is already a DICTIONARY type.
+ *
+ * @code{.pseudo}
+ * c = [429,111,213,111,213,429,213]
+ * d = hash_encode(c)
+ * d now has keys [429,111,213] and indices [0,1,2,1,2,0,2]
+ * d = hash_encode(c, true)
+ * d now has keys [111,213,429] and indices [2,0,1,0,1,2,1]
+ * @endcode
+ *
+ * @param column The column to dictionary encode.
+ * @param sort_keys Whether to sort the keys of the output column.
+ * @param indices_type The integer type to use for the indices.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return Returns a dictionary column.
+ */
+std::unique_ptr<column> hash_encode(
+  column_view const& column,
+  bool sort_keys                      = false,
+  data_type indices_type              = data_type{type_id::UINT32},
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief An encoder of columns against a fixed set of keys, built once to dictionary encode
+ * many batches of rows with the same keys.
+ *
+ * The keys are inserted in a hash table kept in device memory, and each row encoded is looked up
+ * in it. The output dictionaries share the keys and their order, so their indices may be compared
+ * or concatenated across batches.
+ *
+ * Example:
+ * ```
+ * auto keys = cudf::dictionary::dictionary_column_view(first->view()).keys();
+ * cudf::dictionary::hash_encoder encoder(keys);
+ * for (auto const& batch : batches) { process(encoder.encode(batch)->view()); }
+ * ```
+ */
+class hash_encoder {
+ public:
+  hash_encoder() = delete;
+  ~hash_encoder();
+  hash_encoder(hash_encoder const&) = delete;
+  hash_encoder(hash_encoder&&)      = delete;
+  hash_encoder& operator=(hash_encoder const&) = delete;
+  hash_encoder& operator=(hash_encoder&&) = delete;
+
+  /**
+   * @brief Construct an encoder of the values of `keys`.
+   *
+   * @throw cudf::logic_error if `keys` is a DICTIONARY type, contains nulls or repeats a value.
+   *
+   * @param keys The keys of the dictionaries to encode, in the order of their indices.
+   * @param mr Device memory resource used to allocate the device memory of the encoder.
+   */
+  hash_encoder(column_view const& keys,
+               rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns the keys of the encoder.
+   */
+  [[nodiscard]] column_view keys() const;
+
+  /**
+   * @brief Dictionary encodes a column with the keys of the encoder.
+   *
+   * The output rows are null where the input rows are null or their value is not a key.
+   *
+   * @code{.pseudo}
+   * e = hash_encoder([429,111,213])
+   * d = e.encode([111,null,213,500,429])
+   * d now has keys [429,111,213] and indices [1,x,2,x,0], where x is a null row
+   * @endcode
+   *
+   * @throw cudf::logic_error if indices type is not an unsigned integer type.
+   * @throw cudf::logic_error if the type of `column` is not that of the keys.
+   *
+   * @param column The column to dictionary encode.
+   * @param indices_type The integer type to use for the indices.
+   * @param mr Device memory resource used to allocate the returned column's device memory.
+   * @return Returns a dictionary column with a copy of the keys.
+   */
+  std::unique_ptr<column> encode(
+    column_view const& column,
+    data_type indices_type              = data_type{type_id::UINT32},
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  struct hash_encoder_impl;
+  std::unique_ptr<hash_encoder_impl> impl;
+};
+
 /**
  * @brief Create a column by gathering the keys from the provided
  * dictionary_column into a new column using the indices from that column.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -97,6 +97,83 @@ CUDF_HOST_DEVICE inline Rep ipow(T exponent)
   return square * extra;
 }
 
+/**
+ * @brief Divides an unsigned 128-bit integer by `Divisor`, which must be less than 2^32
+ *
+ * Whereas a 128-bit division is a slow library call, the 64-bit divisions by a constant compile to
+ * multiplications by its reciprocal.
+ *
+ * @tparam Divisor The divisor
+ * @param value The dividend
+ * @return `value / Divisor`
+ */
+template <uint64_t Divisor>
+CUDF_HOST_DEVICE inline constexpr __uint128_t divide_by_constant(__uint128_t value)
+{
+  auto const high   = static_cast<uint64_t>(value >> 64);
+  auto const low    = static_cast<uint64_t>(value);
+  auto const q_high = high / Divisor;
+  auto const middle = ((high % Divisor) << 32) | (low >> 32);
+  auto const q_mid  = middle / Divisor;
+  auto const rest   = ((middle % Divisor) << 32) | (low & 0xFFFF'FFFF);
+  auto const q_low  = rest / Divisor;
+  return (static_cast<__uint128_t>(q_high) << 64) | (static_cast<__uint128_t>(q_mid) << 32) |
+         q_low;
+}
+
+/**
+ * @brief Divides a 128-bit integer by 10 to the power of `exponent`, truncating toward zero
+ *
+ * The division is split into divisions by at most 10^9, so that each one is a
+ * `divide_by_constant`.
+ *
+ * @param value The dividend
+ * @param exponent The exponent of the divisor, which must be positive
+ * @return `value / 10^exponent`
+ */
+CUDF_HOST_DEVICE inline constexpr __int128_t divide_by_power_of_ten(__int128_t value,
+                                                                    int32_t exponent)
+{
+  // The magnitude of the minimum value only fits in the unsigned type
+  auto magnitude = value < 0 ? -static_cast<__uint128_t>(value) : static_cast<__uint128_t>(value);
+  for (; exponent > 0; exponent -= 9) {
+    switch (exponent < 9 ? exponent : 9) {
+      case 1: magnitude = divide_by_constant<10>(magnitude); break;
+      case 2: magnitude = divide_by_constant<100>(magnitude); break;
+      case 3: magnitude = divide_by_constant<1'000>(magnitude); break;
+      case 4: magnitude = divide_by_constant<10'000>(magnitude); break;
+      case 5: magnitude = divide_by_constant<100'000>(magnitude); break;
+      case 6: magnitude = divide_by_constant<1'000'000>(magnitude); break;
+      case 7: magnitude = divide_by_constant<10'000'000>(magnitude); break;
+      case 8: magnitude = divide_by_constant<100'000'000>(magnitude); break;
+      default: magnitude = divide_by_constant<1'000'000'000>(magnitude); break;
+    }
+  }
+  return value < 0 ? -static_cast<__int128_t>(magnitude) : static_cast<__int128_t>(magnitude);
+}
+
+/**
+ * @brief Divides two integers, using a 64-bit division for 128-bit integers that fit in 64 bits
+ *
+ * @tparam T Type of the integers
+ * @param lhs The dividend
+ * @param rhs The divisor
+ * @return `lhs / rhs`
+ */
+template <typename T>
+CUDF_HOST_DEVICE inline constexpr T divide(T lhs, T rhs)
+{
+  if constexpr (cuda::std::is_same_v<T, __int128_t>) {
+    // The minimum is excluded so that the 64-bit division does not overflow
+    auto constexpr min = static_cast<T>(cuda::std::numeric_limits<int64_t>::min());
+    auto constexpr max = static_cast<T>(cuda::std::numeric_limits<int64_t>::max());
+    if (lhs > min && lhs <= max && rhs > min && rhs <= max) {
+      return static_cast<int64_t>(lhs) / static_cast<int64_t>(rhs);
+    }
+  }
+  return lhs / rhs;
+}
+
 /** @brief Function that performs a `right shift` scale "times" on the `val`
  *
  * Note: perform this operation when constructing with positive scale
@@ -111,6 +188,9 @@ CUDF_HOST_DEVICE inline Rep ipow(T exponent)
 template <typename Rep, Radix Rad, typename T>
 CUDF_HOST_DEVICE inline constexpr T right_shift(T const& val, scale_type const& scale)
 {
+  if constexpr (cuda::std::is_same_v<T, __int128_t> && Rad == Radix::BASE_10) {
+    return divide_by_power_of_ten(val, static_cast<int32_t>(scale));
+  }
   return val / ipow<Rep, Rad>(static_cast<int32_t>(scale));
 }
 
@@ -692,8 +772,8 @@ CUDF_HOST_DEVICE inline fixed_point<Rep1, Rad1> operator/(fixed_point<Rep1, Rad1
 
 #endif
 
-  return fixed_point<Rep1, Rad1>{
-    scaled_integer<Rep1>(lhs._value / rhs._value, scale_type{lhs._scale - rhs._scale})};
+  return fixed_point<Rep1, Rad1>{scaled_integer<Rep1>(detail::divide(lhs._value, rhs._value),
+                                                      scale_type{lhs._scale - rhs._scale})};
 }
 
 // EQUALITY COMPARISON Operation
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -89,6 +89,9 @@ struct aggregation_result {
 
 /**
  * @brief Groups values by keys and computes aggregations on those groups.
+ *
+ * The sorted order of the keys is computed by the first sort-based call and reused by the later
+ * ones. Calls on different streams must be ordered against the stream of that first call.
  */
 class groupby {
  public:
@@ -176,6 +179,7 @@ class groupby {
    *
    * @param requests The set of columns to aggregate and the aggregations to
    * perform
+   * @param stream CUDA stream used for device memory operations and kernel launches
    * @param mr Device memory resource used to allocate the returned table and columns' device memory
    * @return Pair containing the table with each group's unique key and
    * a vector of aggregation_results for each request in the same order as
@@ -183,6 +187,7 @@ class groupby {
    */
   std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> aggregate(
     host_span<aggregation_request const> requests,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
   /**
@@ -231,6 +236,7 @@ class groupby {
    * ```
    *
    * @param requests The set of columns to scan and the scans to perform
+   * @param stream CUDA stream used for device memory operations and kernel launches
    * @param mr Device memory resource used to allocate the returned table and columns' device memory
    * @return Pair containing the table with each group's key and
    * a vector of aggregation_results for each request in the same order as
@@ -238,6 +244,7 @@ class groupby {
    */
   std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> scan(
     host_span<scan_request const> requests,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
   /**
@@ -284,6 +291,7 @@ class groupby {
    * @param values Table whose columns to be shifted
    * @param offsets The offsets by which to shift the input
    * @param fill_values Fill values for indeterminable outputs
+   * @param stream CUDA stream used for device memory operations and kernel launches
    * @param mr Device memory resource used to allocate the returned table and columns' device memory
    * @return Pair containing the tables with each group's key and the columns shifted
    *
@@ -294,6 +302,7 @@ class groupby {
     table_view const& values,
     host_span<size_type const> offsets,
     std::vector<std::reference_wrapper<const scalar>> const& fill_values,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
   /**
@@ -318,11 +327,13 @@ class groupby {
    * and the `values` of the `groups` object will be `nullptr`.
    *
    * @param values Table representing values on which a groupby operation is to be performed
+   * @param stream CUDA stream used for device memory operations and kernel launches
    * @param mr Device memory resource used to allocate the returned tables's device memory in the
    * returned groups
    * @return A `groups` object representing grouped keys and values
    */
   groups get_groups(cudf::table_view values             = {},
+                    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
                     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
   /**
@@ -356,6 +367,7 @@ class groupby {
    * @param[in] values A table whose column null values will be replaced.
    * @param[in] replace_policies Specify the position of replacement values relative to null values,
    * one for each column
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches
    * @param[in] mr Device memory resource used to allocate device memory of the returned column.
    *
    * @return Pair that contains a table with the sorted keys and the result column
@@ -363,6 +375,7 @@ class groupby {
   std::pair<std::unique_ptr<table>, std::unique_ptr<table>> replace_nulls(
     table_view const& values,
     host_span<cudf::replace_policy const> replace_policies,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
  private:
@@ -407,6 +420,131 @@ class groupby {
     rmm::cuda_stream_view stream,
     rmm::mr::device_memory_resource* mr);
 };
+
+/**
+ * @brief Request for aggregation(s) to perform on a column of the batches of a
+ * `streaming_groupby`.
+ */
+struct streaming_aggregation_request {
+  size_type values;  ///< Index of the column of the batches to aggregate
+  std::vector<std::unique_ptr<groupby_aggregation>> aggregations;  ///< Desired aggregations
+};
+
+/**
+ * @brief Groups the rows of a sequence of batches by keys and computes aggregations on those
+ * groups incrementally.
+ *
+ * Each `update` aggregates a batch into partial results and merges them with the partial results
+ * of the previous batches, which hold one row per group. The cost of an `update` thus depends on
+ * the size of the batch and the number of groups, not on the number of rows aggregated so far.
+ *
+ * The supported aggregations and the merges of their partial results are:
+ * - SUM, PRODUCT, MIN and MAX, merged with themselves
+ * - COUNT_VALID and COUNT_ALL, merged with SUM
+ * - MEAN, M2, VARIANCE and STD, from partial (COUNT_VALID, MEAN, M2) merged with MERGE_M2
+ * - COLLECT_LIST, merged with MERGE_LISTS
+ * - COLLECT_SET, merged with MERGE_SETS
+ * - TDIGEST, merged with MERGE_TDIGEST
+ * - HLL and MERGE_HLL, merged with MERGE_HLL
+ * - APPROX_NUNIQUE, from partial HLL sketches merged with MERGE_HLL
+ *
+ * Example:
+ * ```
+ * keys column: 0, values column: 1, aggregations: {SUM}
+ *
+ * update: {{1, 2, 1}, {3, 4, 5}}
+ * update: {{2, 3}, {6, 7}}
+ * finalize:
+ *   keys: {1, 2, 3}
+ *   SUM:  {8, 10, 7}
+ * ```
+ */
+class streaming_groupby {
+ public:
+  streaming_groupby() = delete;
+  ~streaming_groupby();
+  streaming_groupby(streaming_groupby const&) = delete;
+  streaming_groupby(streaming_groupby&&)      = delete;
+  streaming_groupby& operator=(streaming_groupby const&) = delete;
+  streaming_groupby& operator=(streaming_groupby&&) = delete;
+
+  /**
+   * @brief Construct a streaming groupby object for the batches to be passed to `update`
+   *
+   * @throws cudf::logic_error If `key_columns` is empty
+   * @throws cudf::logic_error If an aggregation is not supported
+   *
+   * @param key_columns Indices of the columns of the batches whose rows act as the groupby keys
+   * @param requests The columns of the batches to aggregate and the aggregations to perform
+   * @param null_handling Indicates whether rows with NULL keys should be included
+   */
+  streaming_groupby(std::vector<size_type> key_columns,
+                    std::vector<streaming_aggregation_request>&& requests,
+                    null_policy null_handling = null_policy::EXCLUDE);
+
+  /**
+   * @brief Aggregates a batch and merges its partial results with those of the previous batches.
+   *
+   * @throws cudf::logic_error If the schema of `batch` differs from the previous batches
+   *
+   * @param batch The batch of keys and values
+   */
+  void update(table_view const& batch);
+
+  /**
+   * @brief Computes the aggregations of all the batches passed to `update` so far.
+   *
+   * The partial results are kept, so that more batches may be passed to `update` afterwards. The
+   * order of the groups is arbitrary.
+   *
+   * @throws cudf::logic_error If no batch has been passed to `update`
+   *
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @return Pair containing the table with each group's unique key and a vector of
+   * aggregation_results for each request in the same order as specified in `requests`
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> finalize(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  struct streaming_groupby_impl;
+  std::unique_ptr<streaming_groupby_impl> impl;
+};
+
+/**
+ * @brief Performs groupby aggregations one hash partition of the keys at a time.
+ *
+ * The keys and the values of the requests are hash partitioned on the keys into
+ * `num_partitions` partitions, which are packed with `contiguous_split` and spilled to pinned host
+ * memory. The partitions are then copied back and aggregated one at a time, so that the hash table
+ * and the intermediate results in device memory are those of a single partition. Rows with equal
+ * keys land in the same partition, so the results of the partitions are concatenated into the
+ * results of the whole input.
+ *
+ * This is meant for groupbys with about as many groups as rows, whose hash table and results do
+ * not fit in device memory together with the input. The inputs themselves stay in device memory.
+ *
+ * The order of the groups is arbitrary. The supported aggregations are those of
+ * `groupby::aggregate`.
+ *
+ * @throws cudf::logic_error If `num_partitions` is not positive
+ * @throws cudf::logic_error If `requests[i].values.size() != keys.num_rows()`
+ *
+ * @param keys Table whose rows act as the groupby keys
+ * @param requests The set of columns to aggregate and the aggregations to perform
+ * @param num_partitions Number of partitions to aggregate in turn
+ * @param include_null_keys Indicates whether rows in `keys` that contain NULL values should be
+ * included
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ * @return Pair containing the table with each group's unique key and a vector of
+ * aggregation_results for each request in the same order as specified in `requests`
+ */
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> partitioned_aggregate(
+  table_view const& keys,
+  host_span<aggregation_request const> requests,
+  size_type num_partitions,
+  null_policy include_null_keys       = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 /** @} */
 }  // namespace groupby
 }  // namespace cudf
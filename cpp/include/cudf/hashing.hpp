@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -29,6 +29,13 @@ namespace cudf {
 /**
  * @brief Computes the hash value of each row in the input set of columns.
  *
+ * The 64-bit hash functions, `HASH_XXHASH64` and `HASH_MURMUR3_64`, return an INT64 column. Their
+ * rows hash to far fewer collisions than the 32-bit hash functions, which is worth the wider
+ * output when the hash values identify rows, e.g. as the keys of a join or a fingerprint.
+ *
+ * The message digests, `HASH_MD5`, `HASH_SHA1` and `HASH_SHA256`, return a strings column of the
+ * hexadecimal digest of each row.
+ *
  * @param input The table of columns to hash.
  * @param hash_function The hash function enum to use.
  * @param seed Optional seed value to use for the hash function.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <arrow/api.h>
+#include <arrow/c/abi.h>
 #include <cudf/column/column.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/table/table.hpp>
@@ -25,6 +26,38 @@
 
 struct DLManagedTensor;
 
+// The structures of the Arrow C device data interface, copied from its specification so that they
+// are available with Arrow versions which do not define them.
+#ifndef ARROW_C_DEVICE_DATA_INTERFACE
+#define ARROW_C_DEVICE_DATA_INTERFACE
+
+typedef int32_t ArrowDeviceType;
+
+#define ARROW_DEVICE_CPU 1
+#define ARROW_DEVICE_CUDA 2
+#define ARROW_DEVICE_CUDA_HOST 3
+#define ARROW_DEVICE_OPENCL 4
+#define ARROW_DEVICE_VULKAN 7
+#define ARROW_DEVICE_METAL 8
+#define ARROW_DEVICE_VPI 9
+#define ARROW_DEVICE_ROCM 10
+#define ARROW_DEVICE_ROCM_HOST 11
+#define ARROW_DEVICE_EXT_DEV 12
+#define ARROW_DEVICE_CUDA_MANAGED 13
+#define ARROW_DEVICE_ONEAPI 14
+#define ARROW_DEVICE_WEBGPU 15
+#define ARROW_DEVICE_HEXAGON 16
+
+struct ArrowDeviceArray {
+  struct ArrowArray array;
+  int64_t device_id;
+  ArrowDeviceType device_type;
+  void* sync_event;
+  int64_t reserved[3];
+};
+
+#endif  // ARROW_C_DEVICE_DATA_INTERFACE
+
 namespace cudf {
 /**
  * @addtogroup interop_dlpack
@@ -75,6 +108,50 @@ DLManagedTensor* to_dlpack(
   table_view const& input,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Order of the elements of a 2D DLPack tensor
+ */
+enum class dlpack_layout : bool {
+  COLUMN_MAJOR,  ///< The elements of each column are contiguous
+  ROW_MAJOR      ///< The elements of each row are contiguous
+};
+
+/**
+ * @brief Convert a cudf table into a DLPack DLTensor of the given layout
+ *
+ * As `to_dlpack(table_view const&, rmm::mr::device_memory_resource*)`, but the 2D tensor is
+ * row-major if `layout` is `ROW_MAJOR`. The rows are then interleaved straight into the tensor
+ * by a single kernel, and the columns of a column-major tensor are copied by a single batched
+ * copy.
+ *
+ * @throw cudf::logic_error if the data types are not equal or not numeric,
+ * or if any of columns have non-zero null count
+ *
+ * @param input Table to convert to DLPack
+ * @param layout Order of the elements of the tensor
+ * @param mr Device memory resource used to allocate the returned DLPack tensor's device memory.
+ *
+ * @return 1D or 2D DLPack tensor with a copy of the table data, or nullptr
+ */
+DLManagedTensor* to_dlpack(
+  table_view const& input,
+  dlpack_layout layout,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Convert a cudf column into a 1D DLPack DLTensor without copying its data
+ *
+ * The tensor takes ownership of the data of the column, which is freed by its `deleter`.
+ * If the column has no rows, the result will be nullptr.
+ *
+ * @throw cudf::logic_error if the data type is not numeric, or if the column has nulls
+ *
+ * @param input Column to convert to DLPack
+ *
+ * @return 1D DLPack tensor owning the column data, or nullptr
+ */
+DLManagedTensor* to_dlpack(std::unique_ptr<column> input);
+
 /** @} */  // end of group
 
 /**
@@ -97,6 +174,19 @@ struct column_metadata {
   column_metadata() = default;
 };
 
+/**
+ * @brief Returns an arrow memory pool allocating pinned host memory
+ *
+ * `to_arrow` copies all the buffers of a table into this pool with a single batched copy,
+ * instead of a copy per buffer into pageable memory.
+ *
+ * @note Pinned memory is a limited resource, which is best used for transfers of short-lived
+ * tables.
+ *
+ * @return The pinned memory pool, which lives until the end of the program
+ */
+arrow::MemoryPool* pinned_arrow_memory_pool();
+
 /**
  * @brief Create `arrow::Table` from cudf table `input`
  *
@@ -107,7 +197,8 @@ struct column_metadata {
  *
  * @param input table_view that needs to be converted to arrow Table
  * @param metadata Contains hierarchy of names of columns and children
- * @param ar_mr arrow memory pool to allocate memory for arrow Table
+ * @param ar_mr arrow memory pool to allocate memory for arrow Table, whose buffers are all copied
+ * at once when it allocates pinned memory, such as `pinned_arrow_memory_pool()`
  * @return arrow Table generated from `input`
  */
 std::shared_ptr<arrow::Table> to_arrow(table_view input,
@@ -126,5 +217,75 @@ std::unique_ptr<table> from_arrow(
   arrow::Table const& input,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Deleter of an `ArrowSchema` allocated by cudf, which releases it first
+ */
+struct arrow_schema_deleter {
+  void operator()(ArrowSchema* schema) const;
+};
+
+/**
+ * @brief Deleter of an `ArrowDeviceArray` allocated by cudf, which releases it first
+ */
+struct arrow_device_array_deleter {
+  void operator()(ArrowDeviceArray* array) const;
+};
+
+using unique_schema_t       = std::unique_ptr<ArrowSchema, arrow_schema_deleter>;
+using unique_device_array_t = std::unique_ptr<ArrowDeviceArray, arrow_device_array_deleter>;
+
+/**
+ * @brief Create the `ArrowSchema` of the Arrow C data interface describing the columns of `input`
+ *
+ * The schema is a struct whose children are the columns of `input`, as expected from the schema
+ * of a `to_arrow_device` array.
+ *
+ * @throws cudf::logic_error if a column is a dictionary or of a type without Arrow equivalent
+ *
+ * @param input Table whose schema is created
+ * @param metadata Contains hierarchy of names of columns and children
+ * @return The schema of `input`, which is released when it is deleted
+ */
+unique_schema_t to_arrow_schema(table_view const& input,
+                                std::vector<column_metadata> const& metadata = {});
+
+/**
+ * @brief Export a cudf table as an `ArrowDeviceArray` of the Arrow C device data interface
+ *
+ * The device buffers of the table are shared without copies: the returned array takes ownership
+ * of the table, whose columns are freed when the array, and those of its children which were
+ * moved out of it, are all released. The `sync_event` of the array is a `cudaEvent_t` recorded
+ * on the default stream once the data is ready.
+ *
+ * cudf stores booleans in bytes while Arrow stores them in bits, so the only columns copied are
+ * the `BOOL8` ones, into new bitmasks.
+ *
+ * @throws cudf::logic_error if a column is a dictionary or of a type without Arrow equivalent
+ *
+ * @param input Table to export
+ * @param mr Device memory resource used to allocate the bitmasks of the `BOOL8` columns
+ * @return A struct array whose children are the columns of `input`, of the schema created by
+ * `to_arrow_schema`, which is released when it is deleted
+ */
+unique_device_array_t to_arrow_device(
+  table&& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a `cudf::table_view` of the device buffers of an `ArrowDeviceArray`
+ *
+ * The view shares the buffers of the array without copies, so it is only valid until the array
+ * is released. If the array has a `sync_event`, the default stream waits for it.
+ *
+ * @throws cudf::logic_error if the schema is not a struct or does not match the array
+ * @throws cudf::logic_error if the array does not reside in the memory of the current device
+ * @throws cudf::logic_error if a column is a boolean or large string or list, which cudf does not
+ * store the same way as Arrow, or of a type without cudf equivalent
+ *
+ * @param schema The schema of `input`, a struct whose children are the columns
+ * @param input The array to view
+ * @return View of the columns of `input`
+ */
+table_view from_arrow_device(ArrowSchema const* schema, ArrowDeviceArray const* input);
+
 /** @} */  // end of group
 }  // namespace cudf
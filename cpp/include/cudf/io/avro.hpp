@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -54,6 +54,9 @@ class avro_reader_options {
   // Rows to read; -1 is all
   size_type _num_rows = -1;
 
+  // Whether to read records and arrays as STRUCT and LIST columns
+  bool _nested = false;
+
   /**
    * @brief Constructor from source info.
    *
@@ -91,6 +94,14 @@ class avro_reader_options {
    */
   [[nodiscard]] size_type get_num_rows() const { return _num_rows; }
 
+  /**
+   * @brief Whether to read records and arrays as STRUCT and LIST columns.
+   *
+   * When disabled, the fields of records are read as separate columns named after their path
+   * and the fields within arrays are skipped unless selected.
+   */
+  [[nodiscard]] bool is_enabled_nested() const { return _nested; }
+
   /**
    * @brief Set names of the column to be read.
    *
@@ -112,6 +123,13 @@ class avro_reader_options {
    */
   void set_num_rows(size_type val) { _num_rows = val; }
 
+  /**
+   * @brief Set whether to read records and arrays as STRUCT and LIST columns.
+   *
+   * @param val Boolean value to enable/disable nested columns.
+   */
+  void enable_nested(bool val) { _nested = val; }
+
   /**
    * @brief create avro_reader_options_builder which will build avro_reader_options.
    *
@@ -175,6 +193,18 @@ class avro_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Set whether to read records and arrays as STRUCT and LIST columns.
+   *
+   * @param val Boolean value to enable/disable nested columns.
+   * @return this for chaining.
+   */
+  avro_reader_options_builder& nested(bool val)
+  {
+    options._nested = val;
+    return *this;
+  }
+
   /**
    * @brief move avro_reader_options member once it's built.
    */
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief Datasource that merges nearby reads of another datasource and caches the merged data.
+ *
+ * Ranges of a vectored read that are less than `hole_size_limit` bytes apart are read from the
+ * wrapped source as a single range, and the data read is kept, up to `cache_size` bytes, to serve
+ * later reads of the ranges it covers. Optionally, each read is followed by a background read of
+ * the next `prefetch_size` bytes of the source, which readers going through a file in order, such
+ * as the chunked readers, find in the cache when they read their next row group or stripe.
+ *
+ * Meant for remote sources, where the latency of each request dominates the time of the reads.
+ * Device reads are forwarded to the wrapped source, without caching.
+ */
+class coalescing_datasource : public datasource {
+ public:
+  /**
+   * @brief Constructs a datasource wrapping another one.
+   *
+   * @param source Datasource to read from
+   * @param hole_size_limit Largest gap between ranges that are read together
+   * @param cache_size Maximum total size of the data kept to serve later reads
+   * @param prefetch_size Number of bytes to read ahead after each read; zero disables read-ahead
+   */
+  explicit coalescing_datasource(std::unique_ptr<datasource> source,
+                                 size_t hole_size_limit = 1 << 20,
+                                 size_t cache_size      = 256 << 20,
+                                 size_t prefetch_size   = 0);
+
+  ~coalescing_datasource() override;
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override;
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override;
+
+  size_t host_read_v(host_span<read_request const> requests) override;
+
+  [[nodiscard]] bool supports_device_read() const override
+  {
+    return _source->supports_device_read();
+  }
+
+  [[nodiscard]] bool is_device_read_preferred(size_t size) const override
+  {
+    return _source->is_device_read_preferred(size);
+  }
+
+  std::unique_ptr<buffer> device_read(size_t offset,
+                                      size_t size,
+                                      rmm::cuda_stream_view stream) override
+  {
+    return _source->device_read(offset, size, stream);
+  }
+
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override
+  {
+    return _source->device_read(offset, size, dst, stream);
+  }
+
+  std::future<size_t> device_read_async(size_t offset,
+                                        size_t size,
+                                        uint8_t* dst,
+                                        rmm::cuda_stream_view stream) override
+  {
+    return _source->device_read_async(offset, size, dst, stream);
+  }
+
+  std::future<size_t> device_read_v(host_span<read_request const> requests,
+                                    rmm::cuda_stream_view stream) override
+  {
+    return _source->device_read_v(requests, stream);
+  }
+
+  [[nodiscard]] size_t size() const override { return _size; }
+
+ private:
+  /**
+   * @brief Range of the source held in the cache, whose data may still be being read
+   */
+  struct cached_range {
+    size_t offset;
+    size_t size;
+    std::shared_future<std::vector<uint8_t>> data;
+  };
+
+  /**
+   * @brief Returns the cached range that covers the given range, if any
+   */
+  [[nodiscard]] std::optional<cached_range> find_cached(size_t offset, size_t size) const;
+
+  /**
+   * @brief Adds a range to the cache, evicting the oldest ranges beyond the cache size
+   */
+  void add_cached(cached_range range);
+
+  /**
+   * @brief Starts reading `prefetch_size` bytes from the offset in the background, unless they are
+   * already cached
+   */
+  void prefetch(size_t offset);
+
+  std::unique_ptr<datasource> _source;
+  size_t const _size;
+  size_t const _hole_size_limit;
+  size_t const _cache_size;
+  size_t const _prefetch_size;
+
+  std::deque<cached_range> _cache;  // Oldest first
+  size_t _cached_bytes = 0;
+  mutable std::mutex _mutex;
+
+  struct prefetch_pool;
+  // Declared last so that its destructor, which waits for the pending reads, runs first
+  std::unique_ptr<prefetch_pool> _pool;
+};
+
+}  // namespace io
+}  // namespace cudf
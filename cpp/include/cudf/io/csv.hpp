@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,9 +21,13 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -84,6 +88,10 @@ class csv_reader_options {
   char _lineterminator = '\n';
   // Field delimiter
   char _delimiter = ',';
+  // Multi-character line terminator; overrides the line terminator character when not empty
+  std::string _lineterminator_sequence;
+  // Multi-character field delimiter; overrides the delimiter character when not empty
+  std::string _delimiter_sequence;
   // Numeric data thousands separator; cannot match delimiter
   char _thousands = '\0';
   // Decimal point character; cannot match delimiter
@@ -116,6 +124,8 @@ class csv_reader_options {
 
   // Per-column types; disables type inference on those columns
   std::variant<std::vector<data_type>, std::map<std::string, data_type>> _dtypes;
+  // Number of rows, spread across the data, that types are inferred from; zero is all rows
+  size_type _inference_sample_rows = 0;
   // Additional values to recognize as boolean true values
   std::vector<std::string> _true_values{"True", "TRUE", "true"};
   // Additional values to recognize as boolean false values
@@ -128,6 +138,8 @@ class csv_reader_options {
   bool _na_filter = true;
   // Whether to parse dates as DD/MM versus MM/DD
   bool _dayfirst = false;
+  // Whether to return a profile of the read in the metadata
+  bool _profile = false;
   // Cast timestamp columns to a specific type
   data_type _timestamp_type{type_id::EMPTY};
 
@@ -268,6 +280,19 @@ class csv_reader_options {
    */
   [[nodiscard]] char get_delimiter() const { return _delimiter; }
 
+  /**
+   * @brief Returns multi-character line terminator, empty if the terminator is a single character.
+   */
+  [[nodiscard]] std::string const& get_lineterminator_sequence() const
+  {
+    return _lineterminator_sequence;
+  }
+
+  /**
+   * @brief Returns multi-character field delimiter, empty if the delimiter is a single character.
+   */
+  [[nodiscard]] std::string const& get_delimiter_sequence() const { return _delimiter_sequence; }
+
   /**
    * @brief Returns numeric data thousands separator.
    */
@@ -355,6 +380,11 @@ class csv_reader_options {
     return _dtypes;
   }
 
+  /**
+   * @brief Returns the number of rows sampled to infer column types, or zero for all rows.
+   */
+  [[nodiscard]] size_type get_inference_sample_rows() const { return _inference_sample_rows; }
+
   /**
    * @brief Returns additional values to recognize as boolean true values.
    */
@@ -385,6 +415,11 @@ class csv_reader_options {
    */
   bool is_enabled_dayfirst() const { return _dayfirst; }
 
+  /**
+   * @brief Whether to return a `reader_profile` in the metadata.
+   */
+  bool is_enabled_profile() const { return _profile; }
+
   /**
    * @brief Returns timestamp_type to which all timestamp columns will be cast.
    */
@@ -535,6 +570,26 @@ class csv_reader_options {
    */
   void set_delimiter(char delim) { _delimiter = delim; }
 
+  /**
+   * @brief Sets multi-character line terminator, such as `\r\n`.
+   *
+   * Overrides the line terminator character when not empty. Sequences of up to eight characters
+   * are supported.
+   *
+   * @param term Characters to indicate line termination.
+   */
+  void set_lineterminator_sequence(std::string term) { _lineterminator_sequence = std::move(term); }
+
+  /**
+   * @brief Sets multi-character field delimiter, such as `||`.
+   *
+   * Overrides the delimiter character when not empty. Sequences of up to eight characters are
+   * supported.
+   *
+   * @param delim Characters to indicate delimiter.
+   */
+  void set_delimiter_sequence(std::string delim) { _delimiter_sequence = std::move(delim); }
+
   /**
    * @brief Sets numeric data thousands separator.
    *
@@ -715,12 +770,35 @@ class csv_reader_options {
    */
   void enable_dayfirst(bool val) { _dayfirst = val; }
 
+  /**
+   * @brief Sets whether to return a `reader_profile` in the metadata of the table read.
+   *
+   * @param val Boolean value to enable/disable.
+   */
+  void enable_profile(bool val) { _profile = val; }
+
   /**
    * @brief Sets timestamp_type to which all timestamp columns will be cast.
    *
    * @param type Dtype to which all timestamp column will be cast.
    */
   void set_timestamp_type(data_type type) { _timestamp_type = type; }
+
+  /**
+   * @brief Sets the number of rows sampled to infer the types of the columns without data types.
+   *
+   * The sampled rows are spread evenly across the input, so that inference does not process all
+   * rows of large inputs. Values that appear only in rows that are not sampled are not taken into
+   * account; a column of integers with nulls outside of the sample is, for instance, inferred as
+   * INT64 instead of FLOAT64.
+   *
+   * @param rows Number of rows to sample, or zero to infer types from all rows
+   */
+  void set_inference_sample_rows(size_type rows)
+  {
+    CUDF_EXPECTS(rows >= 0, "Number of inference sample rows cannot be negative");
+    _inference_sample_rows = rows;
+  }
 };
 
 class csv_reader_options_builder {
@@ -909,6 +987,30 @@ class csv_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets multi-character line terminator.
+   *
+   * @param term Characters to indicate line termination.
+   * @return this for chaining.
+   */
+  csv_reader_options_builder& lineterminator_sequence(std::string term)
+  {
+    options._lineterminator_sequence = std::move(term);
+    return *this;
+  }
+
+  /**
+   * @brief Sets multi-character field delimiter.
+   *
+   * @param delim Characters to indicate delimiter.
+   * @return this for chaining.
+   */
+  csv_reader_options_builder& delimiter_sequence(std::string delim)
+  {
+    options._delimiter_sequence = std::move(delim);
+    return *this;
+  }
+
   /**
    * @brief Sets numeric data thousands separator.
    *
@@ -1173,6 +1275,18 @@ class csv_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets whether to return a `reader_profile` in the metadata of the table read.
+   *
+   * @param val Boolean value to enable/disable.
+   * @return this for chaining.
+   */
+  csv_reader_options_builder& profile(bool val)
+  {
+    options._profile = val;
+    return *this;
+  }
+
   /**
    * @brief Sets timestamp_type to which all timestamp columns will be cast.
    *
@@ -1185,6 +1299,18 @@ class csv_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the number of rows sampled to infer the types of the columns without data types.
+   *
+   * @param rows Number of rows to sample, or zero to infer types from all rows
+   * @return this for chaining.
+   */
+  csv_reader_options_builder& inference_sample_rows(size_type rows)
+  {
+    options.set_inference_sample_rows(rows);
+    return *this;
+  }
+
   /**
    * @brief move csv_reader_options member once it's built.
    */
@@ -1209,6 +1335,7 @@ class csv_reader_options_builder {
  * @endcode
  *
  * @param options Settings for controlling reading behavior.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate device memory of the table in the returned.
  * table_with_metadata
  *
@@ -1216,8 +1343,86 @@ class csv_reader_options_builder {
  */
 table_with_metadata read_csv(
   csv_reader_options options,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+namespace detail::csv {
+class chunked_reader;
+}  // namespace detail::csv
+
+/**
+ * @brief The chunked CSV reader class to read a CSV file iteratively into a series of tables,
+ * chunk by chunk.
+ *
+ * The file is read in ranges of a fixed number of bytes, so that the device memory used by each
+ * `read_chunk()` call is bounded by the range size rather than by the file size. A row spanning
+ * the end of a range is carried over to the next chunk. The header rows are parsed again with
+ * each chunk, so all chunks have the same column names, and, unless data types are given in the
+ * options, the types inferred from the first chunk holding rows are used for all later chunks.
+ * The next range is read from the source on a background thread while a chunk is parsed.
+ *
+ * Row boundaries are found from the line terminator alone, as with byte range reads, so quoted
+ * fields must not contain line terminators. Byte ranges, compression and the `skiprows`,
+ * `skipfooter` and `nrows` options are not supported.
+ *
+ * The following code snippet demonstrates how to read a file chunk by chunk:
+ * @code
+ *  auto source  = cudf::io::source_info("dataset.csv");
+ *  auto options = cudf::io::csv_reader_options::builder(source).build();
+ *  auto reader  = cudf::io::chunked_csv_reader(256 * 1024 * 1024, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *  }
+ * @endcode
+ */
+class chunked_csv_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *        This is added just to satisfy cython.
+   */
+  chunked_csv_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * @param chunk_read_size Number of bytes of the source read for each chunk
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_csv_reader(
+    std::size_t chunk_read_size,
+    csv_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   */
+  ~chunked_csv_reader();
+
+  /**
+   * @brief Check if there is any data in the given source that has not yet been read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read a chunk of rows in the given CSV source.
+   *
+   * The sequence of returned tables, if concatenated by their order, guarantees to form the same
+   * rows as reading the entire source at once. An empty table is returned by the first call if the
+   * source holds no rows.
+   *
+   * @throws cudf::logic_error If there is no data left to read
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::csv::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -1540,9 +1745,11 @@ class csv_writer_options_builder {
  * @endcode
  *
  * @param options Settings for controlling writing behavior.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource to use for device memory allocation.
  */
 void write_csv(csv_writer_options const& options,
+               rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
                rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /** @} */  // end of group
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,7 @@
 
 #include <cudf/io/types.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
@@ -30,8 +31,10 @@
 #include <arrow/result.h>
 #include <arrow/status.h>
 
+#include <algorithm>
 #include <future>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 //! IO interfaces
@@ -117,6 +120,15 @@ class datasource {
     return sources;
   }
 
+  /**
+   * @brief Range of the source to read, and the preallocated memory to read it into.
+   */
+  struct read_request {
+    size_t offset;  ///< Bytes from the start
+    size_t size;    ///< Bytes to read
+    uint8_t* dst;   ///< Address of the existing host or device memory
+  };
+
   /**
    * @brief Base class destructor
    */
@@ -143,6 +155,19 @@ class datasource {
    */
   virtual size_t host_read(size_t offset, size_t size, uint8_t* dst) = 0;
 
+  /**
+   * @brief Reads several ranges into preallocated host buffers.
+   *
+   * Readers pass all the ranges they need at once, so that implementations can coalesce nearby
+   * ranges and have the reads in flight concurrently. The default implementation reads each range
+   * with `host_read`, in order.
+   *
+   * @param requests Ranges to read, and the host memory to read each of them into
+   *
+   * @return The total number of bytes read (can be smaller than the total size of the ranges)
+   */
+  virtual size_t host_read_v(host_span<read_request const> requests);
+
   /**
    * @brief Whether or not this source supports reading directly into device memory.
    *
@@ -241,6 +266,24 @@ class datasource {
     CUDF_FAIL("datasource classes that support device_read_async must override it.");
   }
 
+  /**
+   * @brief Asynchronously reads several ranges into preallocated device buffers.
+   *
+   * The vectored counterpart of `device_read_async`. The default implementation issues a
+   * `device_read_async` call for each range.
+   *
+   *  @throws cudf::logic_error when the object does not support direct device reads, i.e.
+   * `supports_device_read` returns `false`.
+   *
+   * @param requests Ranges to read, and the device memory to read each of them into
+   * @param stream CUDA stream to use
+   *
+   * @return The total number of bytes read as a future value (can be smaller than the total size
+   * of the ranges)
+   */
+  virtual std::future<size_t> device_read_v(host_span<read_request const> requests,
+                                            rmm::cuda_stream_view stream);
+
   /**
    * @brief Returns the size of the data in the source.
    *
@@ -396,6 +439,68 @@ class arrow_io_source : public datasource {
     return result.ValueOrDie();
   }
 
+  /**
+   * @brief Reads selected ranges from the `arrow` source into preallocated buffers.
+   *
+   * Ranges separated by less than `max_coalesce_gap` bytes are read together, up to
+   * `max_coalesced_size` bytes per read, and all the reads are issued asynchronously before waiting
+   * for any of them; for remote filesystems, this costs one round trip instead of one per range.
+   */
+  size_t host_read_v(host_span<read_request const> requests) override
+  {
+    std::vector<read_request> sorted(requests.begin(), requests.end());
+    std::sort(sorted.begin(), sorted.end(), [](auto const& lhs, auto const& rhs) {
+      return lhs.offset < rhs.offset;
+    });
+
+    // Coalesced ranges, each with the range of the sorted requests it covers
+    struct coalesced_read {
+      size_t offset;
+      size_t size;
+      size_t first_request;
+      size_t end_request;
+    };
+    std::vector<coalesced_read> reads;
+    for (size_t i = 0; i < sorted.size(); ++i) {
+      auto const& request = sorted[i];
+      if (not reads.empty()) {
+        auto& last = reads.back();
+        auto const end = std::max(last.offset + last.size, request.offset + request.size);
+        if (request.offset <= last.offset + last.size + max_coalesce_gap &&
+            end - last.offset <= max_coalesced_size) {
+          last.size        = end - last.offset;
+          last.end_request = i + 1;
+          continue;
+        }
+      }
+      reads.push_back({request.offset, request.size, i, i + 1});
+    }
+
+    std::vector<arrow::Future<std::shared_ptr<arrow::Buffer>>> futures;
+    futures.reserve(reads.size());
+    for (auto const& read : reads) {
+      futures.push_back(arrow_file->ReadAsync(arrow::io::default_io_context(),
+                                              static_cast<int64_t>(read.offset),
+                                              static_cast<int64_t>(read.size)));
+    }
+
+    size_t total_read = 0;
+    for (size_t r = 0; r < reads.size(); ++r) {
+      auto const& result = futures[r].result();
+      CUDF_EXPECTS(result.ok(), "Cannot read file data");
+      auto const& buffer     = result.ValueOrDie();
+      auto const buffer_size = static_cast<size_t>(buffer->size());
+      for (auto i = reads[r].first_request; i < reads[r].end_request; ++i) {
+        auto const& request = sorted[i];
+        auto const begin    = std::min(request.offset - reads[r].offset, buffer_size);
+        auto const size     = std::min(request.size, buffer_size - begin);
+        std::copy(buffer->data() + begin, buffer->data() + begin + size, request.dst);
+        total_read += size;
+      }
+    }
+    return total_read;
+  }
+
   /**
    * @brief Returns the size of the data in the `arrow` source.
    */
@@ -407,6 +512,10 @@ class arrow_io_source : public datasource {
   }
 
  private:
+  // Largest gap between ranges that are read together by `host_read_v`, and largest such read
+  static constexpr size_t max_coalesce_gap   = 1 << 20;
+  static constexpr size_t max_coalesced_size = 64 << 20;
+
   std::shared_ptr<arrow::fs::FileSystem> filesystem;
   std::shared_ptr<arrow::io::RandomAccessFile> arrow_file;
 };
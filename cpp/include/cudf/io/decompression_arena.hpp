@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+/**
+ * @addtogroup io_readers
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Device memory for decompression, kept between reads to be reused.
+ *
+ * Readers given an arena through their options allocate from it the decompressed data and the
+ * scratch space of the decompressors. Instead of being freed, released buffers are kept until they
+ * total `max_retained_bytes`, and reused by later allocations they are large enough for; this
+ * avoids allocating and freeing the same large buffers on every read of a service.
+ *
+ * An arena may be shared by reads on several streams and threads. A buffer released on one stream
+ * is only reused on another one after synchronizing the first.
+ */
+class decompression_arena final : public rmm::mr::device_memory_resource {
+ public:
+  /**
+   * @brief Constructor.
+   *
+   * @param max_retained_bytes Maximum total size of the buffers kept for reuse
+   * @param upstream Resource the buffers are allocated from
+   */
+  explicit decompression_arena(
+    std::size_t max_retained_bytes,
+    rmm::mr::device_memory_resource* upstream = rmm::mr::get_current_device_resource());
+
+  decompression_arena(decompression_arena const&) = delete;
+  decompression_arena& operator=(decompression_arena const&) = delete;
+
+  /**
+   * @brief Destructor, freeing the buffers kept for reuse.
+   *
+   * All buffers allocated from the arena must have been released.
+   */
+  ~decompression_arena() override;
+
+  /**
+   * @brief Returns the maximum total size of the buffers kept for reuse.
+   */
+  [[nodiscard]] std::size_t max_retained_bytes() const { return _max_retained_bytes; }
+
+  /**
+   * @brief Returns the total size of the buffers currently kept for reuse.
+   */
+  [[nodiscard]] std::size_t retained_bytes() const;
+
+  /**
+   * @brief Frees the buffers kept for reuse.
+   */
+  void release();
+
+  /**
+   * @brief Allocations and releases are ordered on the stream they are made on.
+   */
+  [[nodiscard]] bool supports_streams() const noexcept override { return true; }
+
+  /**
+   * @brief The arena does not report the memory available to it.
+   */
+  [[nodiscard]] bool supports_get_mem_info() const noexcept override { return false; }
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override;
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override;
+
+  [[nodiscard]] std::pair<std::size_t, std::size_t> do_get_mem_info(
+    rmm::cuda_stream_view) const override
+  {
+    return {0, 0};
+  }
+
+  /**
+   * @brief Buffer kept for reuse, with the stream it was released on
+   */
+  struct retained_buffer {
+    void* ptr;
+    std::size_t size;
+    rmm::cuda_stream_view stream;
+  };
+
+  rmm::mr::device_memory_resource* _upstream;
+  std::size_t const _max_retained_bytes;
+  std::size_t _retained_bytes = 0;
+  std::vector<retained_buffer> _retained;
+  // Allocated size of each buffer handed out, which may exceed the size it was requested with
+  std::unordered_map<void*, std::size_t> _allocated;
+  mutable std::mutex _mutex;
+};
+
+/** @} */  // end of group
+}  // namespace io
+}  // namespace cudf
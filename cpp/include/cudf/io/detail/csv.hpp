@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,9 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <cstddef>
+#include <memory>
+
 namespace cudf {
 namespace io {
 namespace detail {
@@ -40,6 +43,46 @@ table_with_metadata read_csv(std::unique_ptr<cudf::io::datasource>&& source,
                              rmm::cuda_stream_view stream,
                              rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Class to read a CSV file into a series of tables, chunk by chunk.
+ */
+class chunked_reader {
+ public:
+  /**
+   * @brief Constructor from a datasource
+   *
+   * @param chunk_read_size Number of bytes of the source read for each chunk
+   * @param source Input `datasource` object to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(std::size_t chunk_read_size,
+                          std::unique_ptr<cudf::io::datasource>&& source,
+                          csv_reader_options const& options,
+                          rmm::cuda_stream_view stream,
+                          rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Destructor explicitly declared to avoid inlining in header
+   */
+  ~chunked_reader();
+
+  /**
+   * @copydoc cudf::io::chunked_csv_reader::has_next
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @copydoc cudf::io::chunked_csv_reader::read_chunk
+   */
+  [[nodiscard]] table_with_metadata read_chunk();
+
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+};
+
 /**
  * @brief Write an entire dataset to CSV format.
  *
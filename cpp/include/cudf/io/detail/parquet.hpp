@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -26,6 +26,7 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -36,15 +37,41 @@ namespace io {
 class parquet_reader_options;
 class parquet_writer_options;
 class chunked_parquet_writer_options;
+class partitioned_parquet_writer_options;
 
 namespace detail {
 namespace parquet {
 
+// Forward declaration
+class aggregate_reader_metadata;
+
+/**
+ * @brief Reads and parses the footers of all sources of a dataset.
+ *
+ * @param sources Input `datasource` objects of the dataset
+ * @param filepaths Paths of the sources if they are files, used to look up the metadata cache
+ *
+ * @return The parsed footers
+ */
+std::shared_ptr<aggregate_reader_metadata const> read_metadata(
+  std::vector<std::unique_ptr<cudf::io::datasource>> const& sources,
+  std::vector<std::string> const& filepaths);
+
+/**
+ * @copydoc cudf::io::set_parquet_metadata_cache_capacity
+ */
+void set_metadata_cache_capacity(size_t capacity);
+
+/**
+ * @copydoc cudf::io::get_parquet_metadata_cache_capacity
+ */
+size_t get_metadata_cache_capacity();
+
 /**
  * @brief Class to read Parquet dataset data into columns.
  */
 class reader {
- private:
+ protected:
   class impl;
   std::unique_ptr<impl> _impl;
 
@@ -77,6 +104,46 @@ class reader {
                            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 };
 
+/**
+ * @brief Class to read Parquet dataset data into a series of tables, chunk by chunk.
+ */
+class chunked_reader : private reader {
+ public:
+  /**
+   * @brief Constructor from an array of datasources
+   *
+   * @param chunk_read_limit Limit on the estimated size in bytes of each output table, or `0` for
+   * no limit
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(std::size_t chunk_read_limit,
+                          std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                          parquet_reader_options const& options,
+                          rmm::cuda_stream_view stream,
+                          rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_reader();
+
+  /**
+   * @copydoc cudf::io::chunked_parquet_reader::has_next
+   */
+  [[nodiscard]] bool has_next();
+
+  /**
+   * @copydoc cudf::io::chunked_parquet_reader::read_chunk
+   */
+  [[nodiscard]] table_with_metadata read_chunk();
+
+ private:
+  rmm::cuda_stream_view _stream;
+};
+
 /**
  * @brief Class to write parquet dataset data into columns.
  */
@@ -143,6 +210,13 @@ class writer {
   std::unique_ptr<std::vector<uint8_t>> close(
     std::vector<std::string> const& column_chunks_file_path = {});
 
+  /**
+   * @brief Returns the encoding of each column chunk written so far
+   *
+   * @return Encoding of the values of each leaf column, for each row group in the order written
+   */
+  [[nodiscard]] std::vector<std::vector<column_encoding>> const& encoding_report() const;
+
   /**
    * @brief Merges multiple metadata blobs returned by write_all into a single metadata blob
    *
@@ -153,6 +227,46 @@ class writer {
     const std::vector<std::unique_ptr<std::vector<uint8_t>>>& metadata_list);
 };
 
+/**
+ * @brief Class to write a table to a Hive-partitioned Parquet dataset.
+ */
+class partitioned_writer {
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+
+ public:
+  /**
+   * @brief Constructor for a writer of a partitioned dataset.
+   *
+   * @param options Settings for controlling writing behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit partitioned_writer(partitioned_parquet_writer_options const& options,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~partitioned_writer();
+
+  /**
+   * @brief Writes the rows of a table to the files of their partitions.
+   *
+   * @param table The table to be written, including the partition key columns
+   */
+  void write(table_view const& table);
+
+  /**
+   * @brief Closes all open files.
+   *
+   * @return Paths of the files written, relative to the base path, in the order they were created
+   */
+  std::vector<std::string> close();
+};
+
 };  // namespace parquet
 };  // namespace detail
 };  // namespace io
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,9 +21,13 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <cstddef>
+#include <limits>
 #include <map>
+#include <memory>
 #include <string>
 #include <variant>
 #include <vector>
@@ -67,6 +71,8 @@ class json_reader_options_builder;
 class json_reader_options {
   source_info _source;
 
+  // Names of the fields to read as columns; empty to read all fields
+  std::vector<std::string> _use_cols_names;
   // Data types of the column; empty to infer dtypes
   std::variant<std::vector<data_type>, std::map<std::string, data_type>> _dtypes;
   // Specify the compression format of the source or infer from file extension
@@ -83,6 +89,9 @@ class json_reader_options {
   // Whether to parse dates as DD/MM versus MM/DD
   bool _dayfirst = false;
 
+  // Read nested objects and arrays into STRUCT and LIST columns
+  bool _nested = false;
+
   /**
    * @brief Constructor from source info.
    *
@@ -113,6 +122,11 @@ class json_reader_options {
    */
   [[nodiscard]] source_info const& get_source() const { return _source; }
 
+  /**
+   * @brief Returns names of the fields to read as columns.
+   */
+  std::vector<std::string> const& get_use_cols_names() const { return _use_cols_names; }
+
   /**
    * @brief Returns data types of the columns.
    */
@@ -178,6 +192,24 @@ class json_reader_options {
    */
   bool is_enabled_dayfirst() const { return _dayfirst; }
 
+  /**
+   * @brief Whether to read nested objects and arrays into STRUCT and LIST columns.
+   */
+  bool is_enabled_nested() const { return _nested; }
+
+  /**
+   * @brief Set names of the fields to read as columns, in the order of the output columns.
+   *
+   * Only the values of these fields are parsed; the other fields of the records are skipped, and
+   * records that miss a field have a null in its column. The records must be objects.
+   *
+   * @param col_names Vector of field names that are needed.
+   */
+  void set_use_cols_names(std::vector<std::string> col_names)
+  {
+    _use_cols_names = std::move(col_names);
+  }
+
   /**
    * @brief Set data types for columns to be read.
    *
@@ -204,14 +236,14 @@ class json_reader_options {
    *
    * @param offset Number of bytes of offset.
    */
-  void set_byte_range_offset(size_type offset) { _byte_range_offset = offset; }
+  void set_byte_range_offset(size_t offset) { _byte_range_offset = offset; }
 
   /**
    * @brief Set number of bytes to read.
    *
    * @param size Number of bytes to read.
    */
-  void set_byte_range_size(size_type size) { _byte_range_size = size; }
+  void set_byte_range_size(size_t size) { _byte_range_size = size; }
 
   /**
    * @brief Set whether to read the file as a json object per line.
@@ -226,6 +258,16 @@ class json_reader_options {
    * @param val Boolean value to enable/disable day first parsing format.
    */
   void enable_dayfirst(bool val) { _dayfirst = val; }
+
+  /**
+   * @brief Set whether to read nested objects and arrays into STRUCT and LIST columns.
+   *
+   * Records are then read from the whole source, with the values of their fields read into
+   * STRING columns unless nested; `dtypes` and byte ranges are not supported.
+   *
+   * @param val Boolean value to enable/disable reading nested values.
+   */
+  void enable_nested(bool val) { _nested = val; }
 };
 
 class json_reader_options_builder {
@@ -246,6 +288,18 @@ class json_reader_options_builder {
    */
   explicit json_reader_options_builder(source_info const& src) : options(src) {}
 
+  /**
+   * @brief Set names of the fields to read as columns, in the order of the output columns.
+   *
+   * @param col_names Vector of field names that are needed.
+   * @return this for chaining.
+   */
+  json_reader_options_builder& use_cols_names(std::vector<std::string> col_names)
+  {
+    options._use_cols_names = std::move(col_names);
+    return *this;
+  }
+
   /**
    * @brief Set data types for columns to be read.
    *
@@ -288,7 +342,7 @@ class json_reader_options_builder {
    * @param offset Number of bytes of offset.
    * @return this for chaining.
    */
-  json_reader_options_builder& byte_range_offset(size_type offset)
+  json_reader_options_builder& byte_range_offset(size_t offset)
   {
     options._byte_range_offset = offset;
     return *this;
@@ -300,7 +354,7 @@ class json_reader_options_builder {
    * @param size Number of bytes to read.
    * @return this for chaining
    */
-  json_reader_options_builder& byte_range_size(size_type size)
+  json_reader_options_builder& byte_range_size(size_t size)
   {
     options._byte_range_size = size;
     return *this;
@@ -330,6 +384,18 @@ class json_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Set whether to read nested objects and arrays into STRUCT and LIST columns.
+   *
+   * @param val Boolean value to enable/disable reading nested values.
+   * @return this for chaining.
+   */
+  json_reader_options_builder& nested(bool val)
+  {
+    options._nested = val;
+    return *this;
+  }
+
   /**
    * @brief move json_reader_options member once it's built.
    */
@@ -363,6 +429,323 @@ table_with_metadata read_json(
   json_reader_options options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+namespace detail::json {
+class chunked_reader;
+}  // namespace detail::json
+
+/**
+ * @brief The chunked JSON reader class to read a JSON Lines file iteratively into a series of
+ * tables, chunk by chunk.
+ *
+ * The file is read in ranges of a fixed number of bytes, so that the memory used by each
+ * `read_chunk()` call is bounded by the range size rather than by the file size. Ranges need not
+ * be aligned to records: a record spanning the end of a range is carried over to the next chunk.
+ * Unless given in the options, the column names and types of the first chunk holding records are
+ * used for all later chunks, so that all chunks have the same schema; fields of object records
+ * that the first chunk does not have are then skipped. The next range is read from the source on
+ * a background thread while a chunk is parsed.
+ *
+ * Byte ranges, compression and nested reading are not supported.
+ *
+ * The following code snippet demonstrates how to read a file chunk by chunk:
+ * @code
+ *  auto source  = cudf::io::source_info("dataset.jsonl");
+ *  auto options = cudf::io::json_reader_options::builder(source).lines(true).build();
+ *  auto reader  = cudf::io::chunked_json_reader(256 * 1024 * 1024, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *  }
+ * @endcode
+ */
+class chunked_json_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *        This is added just to satisfy cython.
+   */
+  chunked_json_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * @param chunk_read_size Number of bytes of the source read for each chunk
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_json_reader(
+    std::size_t chunk_read_size,
+    json_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   */
+  ~chunked_json_reader();
+
+  /**
+   * @brief Check if there is any data in the given source that has not yet been read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read a chunk of records in the given JSON Lines source.
+   *
+   * The sequence of returned tables, if concatenated by their order, forms the same rows as
+   * reading the entire source at once with the schema of the first chunk.
+   *
+   * @throws cudf::logic_error If there is no data left to read
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::json::chunked_reader> reader;
+};
+
+/** @} */  // end of group
+
+/**
+ * @addtogroup io_writers
+ * @{
+ * @file
+ */
+
+class json_writer_options_builder;
+
+/**
+ * @brief Settings to use for `write_json()`.
+ */
+class json_writer_options {
+  // Specify the sink to use for writer output
+  sink_info _sink;
+  // Set of columns to output
+  table_view _table;
+  // Whether to write the fields holding nulls as `null`, or to leave them out of their object
+  bool _include_nulls = true;
+  // maximum number of rows to write in each chunk (limits memory use)
+  size_type _rows_per_chunk = std::numeric_limits<size_type>::max();
+  // string to use for separating lines (default "\n")
+  std::string _line_terminator = "\n";
+  // Optional associated metadata
+  table_metadata const* _metadata = nullptr;
+
+  /**
+   * @brief Constructor from sink and table.
+   *
+   * @param sink The sink used for writer output.
+   * @param table Table to be written to output.
+   */
+  explicit json_writer_options(sink_info const& sink, table_view const& table)
+    : _sink(sink), _table(table), _rows_per_chunk(table.num_rows())
+  {
+  }
+
+  friend json_writer_options_builder;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  explicit json_writer_options() = default;
+
+  /**
+   * @brief Create builder to create `json_writer_options`.
+   *
+   * @param sink The sink used for writer output.
+   * @param table Table to be written to output.
+   *
+   * @return Builder to build json_writer_options.
+   */
+  static json_writer_options_builder builder(sink_info const& sink, table_view const& table);
+
+  /**
+   * @brief Returns sink used for writer output.
+   */
+  [[nodiscard]] sink_info const& get_sink() const { return _sink; }
+
+  /**
+   * @brief Returns table that would be written to output.
+   */
+  [[nodiscard]] table_view const& get_table() const { return _table; }
+
+  /**
+   * @brief Returns optional associated metadata.
+   */
+  [[nodiscard]] table_metadata const* get_metadata() const { return _metadata; }
+
+  /**
+   * @brief Whether to write the fields holding nulls as `null`.
+   */
+  [[nodiscard]] bool is_enabled_include_nulls() const { return _include_nulls; }
+
+  /**
+   * @brief Returns maximum number of rows to process for each file write.
+   */
+  [[nodiscard]] size_type get_rows_per_chunk() const { return _rows_per_chunk; }
+
+  /**
+   * @brief Returns string used for separating lines.
+   */
+  [[nodiscard]] std::string get_line_terminator() const { return _line_terminator; }
+
+  // Setter
+  /**
+   * @brief Sets optional associated metadata.
+   *
+   * @param metadata Associated metadata.
+   */
+  void set_metadata(table_metadata const* metadata) { _metadata = metadata; }
+
+  /**
+   * @brief Enables/Disables writing the fields holding nulls as `null`.
+   *
+   * @param val Boolean value to enable/disable.
+   */
+  void enable_include_nulls(bool val) { _include_nulls = val; }
+
+  /**
+   * @brief Sets maximum number of rows to process for each file write.
+   *
+   * @param val Number of rows per chunk.
+   */
+  void set_rows_per_chunk(size_type val) { _rows_per_chunk = val; }
+
+  /**
+   * @brief Sets string used for separating lines.
+   *
+   * @param term String to represent line termination.
+   */
+  void set_line_terminator(std::string term) { _line_terminator = term; }
+};
+
+/**
+ * @brief Builder to build options for `write_json()`.
+ */
+class json_writer_options_builder {
+  json_writer_options options;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  explicit json_writer_options_builder() = default;
+
+  /**
+   * @brief Constructor from sink and table.
+   *
+   * @param sink The sink used for writer output.
+   * @param table Table to be written to output.
+   */
+  explicit json_writer_options_builder(sink_info const& sink, table_view const& table)
+    : options{sink, table}
+  {
+  }
+
+  /**
+   * @brief Sets optional associated metadata.
+   *
+   * @param metadata Associated metadata.
+   * @return this for chaining.
+   */
+  json_writer_options_builder& metadata(table_metadata const* metadata)
+  {
+    options._metadata = metadata;
+    return *this;
+  }
+
+  /**
+   * @brief Enables/Disables writing the fields holding nulls as `null`.
+   *
+   * @param val Boolean value to enable/disable.
+   * @return this for chaining.
+   */
+  json_writer_options_builder& include_nulls(bool val)
+  {
+    options._include_nulls = val;
+    return *this;
+  }
+
+  /**
+   * @brief Sets maximum number of rows to process for each file write.
+   *
+   * @param val Number of rows per chunk.
+   * @return this for chaining.
+   */
+  json_writer_options_builder& rows_per_chunk(size_type val)
+  {
+    options._rows_per_chunk = val;
+    return *this;
+  }
+
+  /**
+   * @brief Sets string used for separating lines.
+   *
+   * @param term String to represent line termination.
+   * @return this for chaining.
+   */
+  json_writer_options_builder& line_terminator(std::string term)
+  {
+    options._line_terminator = term;
+    return *this;
+  }
+
+  /**
+   * @brief move `json_writer_options` member once it's built.
+   */
+  operator json_writer_options&&() { return std::move(options); }
+
+  /**
+   * @brief move `json_writer_options` member once it's built.
+   *
+   * This has been added since Cython does not support overloading of conversion operators.
+   */
+  json_writer_options&& build() { return std::move(options); }
+};
+
+/**
+ * @brief Writes a set of columns to JSON Lines format.
+ *
+ * Each row is written as a JSON object on its own line, with a field per column. Struct columns
+ * are written as nested objects and list columns as arrays. Strings are escaped, and timestamps
+ * and durations are written as strings. Nulls, and floating-point values that are not finite, are
+ * written as `null`; with `include_nulls(false)` the fields holding them are left out of their
+ * object instead, while null elements of lists are always written.
+ *
+ * The names of the fields are those of `table_metadata::schema_info`, or else those of
+ * `table_metadata::column_names` for the columns, and the indices of the columns and struct
+ * fields when no name is given.
+ *
+ * The rows are formatted on the device in chunks of `rows_per_chunk` rows, each sized and written
+ * in two passes over its rows, and written to the sink while the next chunk is formatted.
+ *
+ * The following code snippet demonstrates how to write columns to a file:
+ * @code
+ *  auto destination = cudf::io::sink_info("dataset.jsonl");
+ *  auto options     = cudf::io::json_writer_options::builder(destination, table->view())
+ *    .metadata(&metadata)
+ *    .rows_per_chunk(rows_per_chunk);
+ *
+ *  cudf::io::write_json(options);
+ * @endcode
+ *
+ * @throw cudf::logic_error if the table holds a column of an unsupported type, e.g. a dictionary
+ * @throw cudf::logic_error if the metadata names a different number of columns than the table has
+ * @throw cudf::logic_error if `rows_per_chunk` is not positive
+ *
+ * @param options Settings for controlling writing behavior.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource to use for device memory allocation.
+ */
+void write_json(json_writer_options const& options,
+                rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+                rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace io
 }  // namespace cudf
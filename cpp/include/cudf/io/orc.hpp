@@ -16,12 +16,18 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
+#include <cudf/io/decompression_arena.hpp>
 #include <cudf/io/detail/orc.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -34,9 +40,10 @@ namespace io {
  * @file
  */
 
-constexpr size_t default_stripe_size_bytes   = 64 * 1024 * 1024;
-constexpr size_type default_stripe_size_rows = 1000000;
-constexpr size_type default_row_index_stride = 10000;
+constexpr size_t default_stripe_size_bytes    = 64 * 1024 * 1024;
+constexpr size_type default_stripe_size_rows  = 1000000;
+constexpr size_type default_row_index_stride  = 10000;
+constexpr double default_dictionary_threshold = 0.8;
 
 /**
  * @brief Builds settings to use for `read_orc()`.
@@ -64,6 +71,8 @@ class orc_reader_options {
 
   // Whether to use numpy-compatible dtypes
   bool _use_np_dtypes = true;
+  // Whether to return a profile of the read in the metadata
+  bool _profile = false;
   // Cast timestamp columns to a specific type
   data_type _timestamp_type{type_id::EMPTY};
 
@@ -74,6 +83,12 @@ class orc_reader_options {
   std::vector<std::string> _decimal128_columns;
   bool _enable_decimal128 = true;
 
+  // Predicate selecting the rows to read
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+
+  // Arena to allocate decompressed data from; null is the current device resource
+  std::shared_ptr<decompression_arena> _decompression_arena;
+
   friend orc_reader_options_builder;
 
   /**
@@ -134,6 +149,11 @@ class orc_reader_options {
    */
   bool is_enabled_use_np_dtypes() const { return _use_np_dtypes; }
 
+  /**
+   * @brief Whether to return a `reader_profile` in the metadata.
+   */
+  bool is_enabled_profile() const { return _profile; }
+
   /**
    * @brief Returns timestamp type to which timestamp column will be cast.
    */
@@ -157,6 +177,19 @@ class orc_reader_options {
    */
   bool is_enabled_decimal128() const { return _enable_decimal128; }
 
+  /**
+   * @brief Returns the expression used to filter rows, if any.
+   */
+  [[nodiscard]] auto const& get_filter() const { return _filter; }
+
+  /**
+   * @brief Returns the arena decompressed data is allocated from, if any.
+   */
+  [[nodiscard]] std::shared_ptr<decompression_arena> const& get_decompression_arena() const
+  {
+    return _decompression_arena;
+  }
+
   // Setters
 
   /**
@@ -186,6 +219,7 @@ class orc_reader_options {
   void set_skip_rows(size_type rows)
   {
     CUDF_EXPECTS(rows == 0 or _stripes.empty(), "Can't set both skip_rows along with stripes");
+    CUDF_EXPECTS(rows == 0 or not _filter.has_value(), "Can't set skip_rows along with a filter");
     _skip_rows = rows;
   }
 
@@ -197,6 +231,7 @@ class orc_reader_options {
   void set_num_rows(size_type nrows)
   {
     CUDF_EXPECTS(nrows == -1 or _stripes.empty(), "Can't set both num_rows along with stripes");
+    CUDF_EXPECTS(nrows == -1 or not _filter.has_value(), "Can't set num_rows along with a filter");
     _num_rows = nrows;
   }
 
@@ -214,6 +249,13 @@ class orc_reader_options {
    */
   void enable_use_np_dtypes(bool use) { _use_np_dtypes = use; }
 
+  /**
+   * @brief Enable/Disable returning a `reader_profile` in the metadata of the table read.
+   *
+   * @param use Boolean value to enable/disable.
+   */
+  void enable_profile(bool use) { _profile = use; }
+
   /**
    * @brief Sets timestamp type to which timestamp column will be cast.
    *
@@ -247,6 +289,39 @@ class orc_reader_options {
   {
     _decimal128_columns = std::move(val);
   }
+
+  /**
+   * @brief Sets the expression used to filter the rows that are read.
+   *
+   * Column references in the expression index the top-level columns of the output table, and
+   * only rows for which the expression evaluates to true are returned. The filter is first
+   * evaluated against the file and stripe statistics; stripes for which the statistics prove that
+   * no row can satisfy the filter are neither read nor decompressed. If stripes are also selected
+   * with `set_stripes`, only the selected stripes are considered.
+   *
+   * The expression is referenced rather than copied and must outlive the read.
+   *
+   * @param filter Boolean expression over the output columns.
+   */
+  void set_filter(ast::expression const& filter)
+  {
+    CUDF_EXPECTS(_skip_rows == 0 and _num_rows == -1,
+                 "Can't set a filter along with skip_rows and num_rows");
+    _filter = filter;
+  }
+
+  /**
+   * @brief Sets the arena to allocate decompressed data and decompression scratch space from.
+   *
+   * Sharing an arena between reads reuses the same device buffers instead of allocating new ones
+   * on every read. The arena is shared with the copies of the options.
+   *
+   * @param arena Arena to allocate from; null to allocate from the current device resource
+   */
+  void set_decompression_arena(std::shared_ptr<decompression_arena> arena)
+  {
+    _decompression_arena = std::move(arena);
+  }
 };
 
 class orc_reader_options_builder {
@@ -339,6 +414,18 @@ class orc_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Enable/Disable returning a `reader_profile` in the metadata of the table read.
+   *
+   * @param use Boolean value to enable/disable.
+   * @return this for chaining.
+   */
+  orc_reader_options_builder& profile(bool use)
+  {
+    options._profile = use;
+    return *this;
+  }
+
   /**
    * @brief Sets timestamp type to which timestamp column will be cast.
    *
@@ -386,6 +473,31 @@ class orc_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the expression used to filter the rows that are read.
+   *
+   * @param filter Boolean expression over the output columns.
+   * @return this for chaining.
+   */
+  orc_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the arena to allocate decompressed data and decompression scratch space from.
+   *
+   * @param arena Arena to allocate from; null to allocate from the current device resource
+   * @return this for chaining.
+   */
+  orc_reader_options_builder& decompression_arena(
+    std::shared_ptr<cudf::io::decompression_arena> arena)
+  {
+    options.set_decompression_arena(std::move(arena));
+    return *this;
+  }
+
   /**
    * @brief move orc_reader_options member once it's built.
    */
@@ -413,6 +525,7 @@ class orc_reader_options_builder {
  * be as reliable as reading for other datatypes.
  *
  * @param options Settings for controlling reading behavior.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate device memory of the table in the returned
  * table_with_metadata.
  *
@@ -420,8 +533,79 @@ class orc_reader_options_builder {
  */
 table_with_metadata read_orc(
   orc_reader_options const& options,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked ORC reader class to read an ORC dataset iteratively into a series of tables,
+ * chunk by chunk.
+ *
+ * The selected stripes are split into chunks whose decoded size is estimated, from the stripe
+ * statistics, to not exceed a given byte limit. Chunks always hold whole stripes, except for the
+ * rows excluded by `skip_rows` and `num_rows`, so that no stripe is read or decompressed twice; a
+ * stripe whose estimated size exceeds the limit forms a chunk of its own. When `skip_rows` or
+ * `num_rows` is set on a dataset with nested columns, the selected rows are read as a single
+ * chunk. A filter set in the options must outlive the reader.
+ *
+ * The following code snippet demonstrates how to read a dataset chunk by chunk:
+ * @code
+ *  auto source  = cudf::io::source_info("dataset.orc");
+ *  auto options = cudf::io::orc_reader_options::builder(source).build();
+ *  auto reader  = cudf::io::chunked_orc_reader(512 * 1024 * 1024, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *  }
+ * @endcode
+ */
+class chunked_orc_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *        This is added just to satisfy cython.
+   */
+  chunked_orc_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * @param chunk_read_limit Limit on the estimated size in bytes of the table returned by each
+   * `read_chunk()` call, or `0` when there is no limit
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_orc_reader(
+    std::size_t chunk_read_limit,
+    orc_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   */
+  ~chunked_orc_reader();
+
+  /**
+   * @brief Check if there is any data in the given source that has not yet been read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read a chunk of rows in the given ORC source.
+   *
+   * The sequence of returned tables, if concatenated by their order, guarantees to form a complete
+   * dataset as reading the entire given source at once. An empty table is returned by the first
+   * call if the selection holds no rows.
+   *
+   * @throws cudf::logic_error If there is no data left to read
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::orc::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -462,6 +646,8 @@ class orc_writer_options {
   size_type _stripe_size_rows = default_stripe_size_rows;
   // Row index stride (maximum number of rows in each row group)
   size_type _row_index_stride = default_row_index_stride;
+  // Ratio of distinct to non-null strings in a stripe above which dictionary encoding is skipped
+  double _dictionary_threshold = default_dictionary_threshold;
   // Set of columns to output
   table_view _table;
   // Optional associated metadata
@@ -542,6 +728,12 @@ class orc_writer_options {
     return unaligned_stride - unaligned_stride % 8;
   }
 
+  /**
+   * @brief Returns the ratio of distinct to non-null strings above which a string column is not
+   * dictionary encoded.
+   */
+  [[nodiscard]] double get_dictionary_threshold() const { return _dictionary_threshold; }
+
   /**
    * @brief Returns table to be written to output.
    */
@@ -613,6 +805,23 @@ class orc_writer_options {
     _row_index_stride = stride;
   }
 
+  /**
+   * @brief Sets the dictionary threshold of string columns.
+   *
+   * The number of distinct strings in each stripe is estimated before its dictionary is built. A
+   * column whose estimate exceeds `threshold` times its number of non-null strings in any stripe
+   * is written with direct encoding, skipping the dictionary build. Zero disables dictionary
+   * encoding and one only leaves the choice to the encoded size comparison.
+   *
+   * @param threshold Ratio of distinct to non-null strings, in the [0, 1] range.
+   */
+  void set_dictionary_threshold(double threshold)
+  {
+    CUDF_EXPECTS(threshold >= 0.0 && threshold <= 1.0,
+                 "Dictionary threshold must be in the [0, 1] range");
+    _dictionary_threshold = threshold;
+  }
+
   /**
    * @brief Sets table to be written to output.
    *
@@ -724,6 +933,18 @@ class orc_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the dictionary threshold of string columns.
+   *
+   * @param val Ratio of distinct to non-null strings above which dictionary encoding is skipped
+   * @return this for chaining.
+   */
+  orc_writer_options_builder& dictionary_threshold(double val)
+  {
+    options.set_dictionary_threshold(val);
+    return *this;
+  }
+
   /**
    * @brief Sets table to be written to output.
    *
@@ -787,9 +1008,11 @@ class orc_writer_options_builder {
  * not be as reliable as writing for other datatypes.
  *
  * @param options Settings for controlling reading behavior.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource to use for device memory allocation.
  */
 void write_orc(orc_writer_options const& options,
+               rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
                rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -813,6 +1036,8 @@ class chunked_orc_writer_options {
   size_type _stripe_size_rows = default_stripe_size_rows;
   // Row index stride (maximum number of rows in each row group)
   size_type _row_index_stride = default_row_index_stride;
+  // Ratio of distinct to non-null strings in a stripe above which dictionary encoding is skipped
+  double _dictionary_threshold = default_dictionary_threshold;
   // Optional associated metadata
   const table_input_metadata* _metadata = nullptr;
   // Optional footer key_value_metadata
@@ -878,6 +1103,12 @@ class chunked_orc_writer_options {
     return unaligned_stride - unaligned_stride % 8;
   }
 
+  /**
+   * @brief Returns the ratio of distinct to non-null strings above which a string column is not
+   * dictionary encoded.
+   */
+  [[nodiscard]] double get_dictionary_threshold() const { return _dictionary_threshold; }
+
   /**
    * @brief Returns associated metadata.
    */
@@ -944,6 +1175,23 @@ class chunked_orc_writer_options {
     _row_index_stride = stride;
   }
 
+  /**
+   * @brief Sets the dictionary threshold of string columns.
+   *
+   * The number of distinct strings in each stripe is estimated before its dictionary is built. A
+   * column whose estimate exceeds `threshold` times its number of non-null strings in any stripe
+   * is written with direct encoding, skipping the dictionary build. Zero disables dictionary
+   * encoding and one only leaves the choice to the encoded size comparison.
+   *
+   * @param threshold Ratio of distinct to non-null strings, in the [0, 1] range.
+   */
+  void set_dictionary_threshold(double threshold)
+  {
+    CUDF_EXPECTS(threshold >= 0.0 && threshold <= 1.0,
+                 "Dictionary threshold must be in the [0, 1] range");
+    _dictionary_threshold = threshold;
+  }
+
   /**
    * @brief Sets associated metadata.
    *
@@ -1045,6 +1293,18 @@ class chunked_orc_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the dictionary threshold of string columns.
+   *
+   * @param val Ratio of distinct to non-null strings above which dictionary encoding is skipped
+   * @return this for chaining.
+   */
+  chunked_orc_writer_options_builder& dictionary_threshold(double val)
+  {
+    options.set_dictionary_threshold(val);
+    return *this;
+  }
+
   /**
    * @brief Sets associated metadata.
    *
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,16 +16,21 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
+#include <cudf/io/decompression_arena.hpp>
 #include <cudf/io/detail/parquet.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <functional>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -37,8 +42,65 @@ namespace io {
  * @file
  */
 
-constexpr size_t default_row_group_size_bytes   = 128 * 1024 * 1024;  // 128MB
-constexpr size_type default_row_group_size_rows = 1000000;
+constexpr size_t default_row_group_size_bytes          = 128 * 1024 * 1024;  // 128MB
+constexpr size_type default_row_group_size_rows        = 1000000;
+constexpr size_t default_max_page_size_bytes           = 512 * 1024;  // 512KB
+constexpr size_type default_max_page_size_rows         = 20000;
+constexpr size_type default_statistics_truncate_length = 64;
+constexpr size_t default_pipeline_batch_size           = 256 * 1024 * 1024;  // 256MB
+
+/**
+ * @brief Parsed footers of the files of a Parquet dataset.
+ *
+ * Returned by `read_parquet_metadata()` and accepted by `read_parquet()` through the reader
+ * options, so that datasets read repeatedly are only parsed once. The object is immutable and
+ * cheap to copy; copies share the parsed footers.
+ */
+class parquet_dataset_metadata {
+  std::shared_ptr<detail::parquet::aggregate_reader_metadata const> _metadata;
+
+ public:
+  /**
+   * @brief Default constructor, creating an object that holds no metadata.
+   */
+  parquet_dataset_metadata() = default;
+
+  /**
+   * @brief Constructor from parsed footers.
+   *
+   * @param metadata Parsed footers of all files of the dataset
+   */
+  explicit parquet_dataset_metadata(
+    std::shared_ptr<detail::parquet::aggregate_reader_metadata const> metadata)
+    : _metadata(std::move(metadata))
+  {
+  }
+
+  /**
+   * @brief Returns true if the object holds parsed footers.
+   */
+  [[nodiscard]] bool has_value() const { return _metadata != nullptr; }
+
+  /**
+   * @brief Returns the number of files of the dataset.
+   */
+  [[nodiscard]] size_type num_sources() const;
+
+  /**
+   * @brief Returns the total number of rows of the dataset.
+   */
+  [[nodiscard]] size_type num_rows() const;
+
+  /**
+   * @brief Returns the total number of row groups of the dataset.
+   */
+  [[nodiscard]] size_type num_row_groups() const;
+
+  /**
+   * @brief Returns the parsed footers.
+   */
+  [[nodiscard]] auto const& get() const { return _metadata; }
+};
 
 /**
  * @brief Builds parquet_reader_options to use for `read_parquet()`.
@@ -63,10 +125,22 @@ class parquet_reader_options {
 
   // Whether to store string data as categorical type
   bool _convert_strings_to_categories = false;
+  // Whether to return string columns as dictionary columns
+  bool _convert_strings_to_dictionary = false;
   // Whether to use PANDAS metadata to load columns
   bool _use_pandas_metadata = true;
+  // Whether to return a profile of the read in the metadata
+  bool _profile = false;
   // Cast timestamp columns to a specific type
   data_type _timestamp_type{type_id::EMPTY};
+  // Predicate selecting the rows to read
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+  // Previously parsed footers of the sources
+  parquet_dataset_metadata _dataset_metadata;
+  // Arena to allocate decompressed data from; null is the current device resource
+  std::shared_ptr<decompression_arena> _decompression_arena;
+  // Compressed size of the batches of row groups whose reads overlap with decoding
+  size_t _pipeline_batch_size = default_pipeline_batch_size;
 
   /**
    * @brief Constructor from source info.
@@ -107,11 +181,25 @@ class parquet_reader_options {
     return _convert_strings_to_categories;
   }
 
+  /**
+   * @brief Returns true/false depending on whether string columns should be returned as
+   * DICTIONARY32 columns or not.
+   */
+  [[nodiscard]] bool is_enabled_convert_strings_to_dictionary() const
+  {
+    return _convert_strings_to_dictionary;
+  }
+
   /**
    * @brief Returns true/false depending whether to use pandas metadata or not while reading.
    */
   [[nodiscard]] bool is_enabled_use_pandas_metadata() const { return _use_pandas_metadata; }
 
+  /**
+   * @brief Returns true/false depending on whether a `reader_profile` is returned in the metadata.
+   */
+  [[nodiscard]] bool is_enabled_profile() const { return _profile; }
+
   /**
    * @brief Returns number of rows to skip from the start.
    */
@@ -137,6 +225,33 @@ class parquet_reader_options {
    */
   data_type get_timestamp_type() const { return _timestamp_type; }
 
+  /**
+   * @brief Returns the expression used to filter rows, if any.
+   */
+  [[nodiscard]] auto const& get_filter() const { return _filter; }
+
+  /**
+   * @brief Returns the previously parsed footers of the sources, if any.
+   */
+  [[nodiscard]] parquet_dataset_metadata const& get_dataset_metadata() const
+  {
+    return _dataset_metadata;
+  }
+
+  /**
+   * @brief Returns the arena decompressed data is allocated from, if any.
+   */
+  [[nodiscard]] std::shared_ptr<decompression_arena> const& get_decompression_arena() const
+  {
+    return _decompression_arena;
+  }
+
+  /**
+   * @brief Returns the compressed size of the batches of row groups that large reads of flat
+   * columns are split into.
+   */
+  [[nodiscard]] size_t get_pipeline_batch_size() const { return _pipeline_batch_size; }
+
   /**
    * @brief Sets names of the columns to be read.
    *
@@ -165,6 +280,18 @@ class parquet_reader_options {
    */
   void enable_convert_strings_to_categories(bool val) { _convert_strings_to_categories = val; }
 
+  /**
+   * @brief Sets to enable/disable returning string columns as DICTIONARY32 columns.
+   *
+   * Only applies to top-level string columns. Column chunks that are entirely dictionary encoded
+   * are built from their dictionary page and the decoded indices, without materializing the
+   * strings of every row; the dictionaries of the row groups are merged. Cannot be combined with
+   * the conversion of strings to categories.
+   *
+   * @param val Boolean value to enable/disable returning string columns as dictionaries.
+   */
+  void enable_convert_strings_to_dictionary(bool val) { _convert_strings_to_dictionary = val; }
+
   /**
    * @brief Sets to enable/disable use of pandas metadata to read.
    *
@@ -172,6 +299,13 @@ class parquet_reader_options {
    */
   void enable_use_pandas_metadata(bool val) { _use_pandas_metadata = val; }
 
+  /**
+   * @brief Sets to enable/disable returning a `reader_profile` in the metadata of the table read.
+   *
+   * @param val Boolean value whether to profile the read.
+   */
+  void enable_profile(bool val) { _profile = val; }
+
   /**
    * @brief Sets number of rows to skip.
    *
@@ -182,6 +316,9 @@ class parquet_reader_options {
     if ((val != 0) and (!_row_groups.empty())) {
       CUDF_FAIL("skip_rows can't be set along with a non-empty row_groups");
     }
+    if ((val != 0) and _filter.has_value()) {
+      CUDF_FAIL("skip_rows can't be set along with a filter");
+    }
 
     _skip_rows = val;
   }
@@ -196,6 +333,9 @@ class parquet_reader_options {
     if ((val != -1) and (!_row_groups.empty())) {
       CUDF_FAIL("num_rows can't be set along with a non-empty row_groups");
     }
+    if ((val != -1) and _filter.has_value()) {
+      CUDF_FAIL("num_rows can't be set along with a filter");
+    }
 
     _num_rows = val;
   }
@@ -206,6 +346,75 @@ class parquet_reader_options {
    * @param type The timestamp data_type to which all timestamp columns need to be cast.
    */
   void set_timestamp_type(data_type type) { _timestamp_type = type; }
+
+  /**
+   * @brief Sets the expression used to filter the rows that are read.
+   *
+   * Column references in the expression index the top-level columns of the output table, and
+   * only rows for which the expression evaluates to true are returned. The filter is first
+   * evaluated against the min/max statistics stored for each column chunk; row groups for which
+   * the statistics prove that no row can satisfy the filter are not read. When the file has a
+   * page index, the page statistics further narrow down the rows to read. The columns referenced
+   * by the filter are then decoded and evaluated, and the remaining columns are only decoded for
+   * the row groups that contain matching rows.
+   *
+   * The expression must be an `ast::operation`. It is referenced rather than copied and must
+   * outlive the read.
+   *
+   * @param filter Boolean expression over the output columns.
+   */
+  void set_filter(ast::expression const& filter)
+  {
+    if ((_skip_rows != 0) or (_num_rows != -1)) {
+      CUDF_FAIL("filter can't be set along with skip_rows and num_rows");
+    }
+
+    _filter = filter;
+  }
+
+  /**
+   * @brief Sets the previously parsed footers of the sources.
+   *
+   * The footers are used instead of reading and parsing the ones of the sources, which must be the
+   * files, in the same order, that the metadata was read from.
+   *
+   * @param metadata Metadata returned by `read_parquet_metadata()`
+   */
+  void set_dataset_metadata(parquet_dataset_metadata metadata)
+  {
+    _dataset_metadata = std::move(metadata);
+  }
+
+  /**
+   * @brief Sets the arena to allocate decompressed data and decompression scratch space from.
+   *
+   * Sharing an arena between reads reuses the same device buffers instead of allocating new ones
+   * on every read. The arena is shared with the copies of the options.
+   *
+   * @param arena Arena to allocate from; null to allocate from the current device resource
+   */
+  void set_decompression_arena(std::shared_ptr<decompression_arena> arena)
+  {
+    _decompression_arena = std::move(arena);
+  }
+
+  /**
+   * @brief Sets the compressed size of the batches of row groups that large reads of flat
+   * columns are split into.
+   *
+   * The data of each batch is read while the previous batch is decoded. A batch holds whole row
+   * groups, and ends with the first row group that brings it to at least `size_bytes` bytes.
+   * Smaller batches overlap more of the reads, at the cost of more, smaller decodes.
+   *
+   * @throws cudf::logic_error if `size_bytes` is 0
+   *
+   * @param size_bytes Compressed size of the batches, in bytes
+   */
+  void set_pipeline_batch_size(size_t size_bytes)
+  {
+    CUDF_EXPECTS(size_bytes > 0, "The pipeline batch size must be positive");
+    _pipeline_batch_size = size_bytes;
+  }
 };
 
 class parquet_reader_options_builder {
@@ -262,6 +471,18 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets to enable/disable returning string columns as DICTIONARY32 columns.
+   *
+   * @param val Boolean value to enable/disable returning string columns as dictionaries.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& convert_strings_to_dictionary(bool val)
+  {
+    options._convert_strings_to_dictionary = val;
+    return *this;
+  }
+
   /**
    * @brief Sets to enable/disable use of pandas metadata to read.
    *
@@ -274,6 +495,18 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets to enable/disable returning a `reader_profile` in the metadata of the table read.
+   *
+   * @param val Boolean value whether to profile the read.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& profile(bool val)
+  {
+    options._profile = val;
+    return *this;
+  }
+
   /**
    * @brief Sets number of rows to skip.
    *
@@ -310,6 +543,56 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the expression used to filter the rows that are read.
+   *
+   * @param filter Boolean expression over the output columns.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the previously parsed footers of the sources.
+   *
+   * @param metadata Metadata returned by `read_parquet_metadata()`
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& dataset_metadata(parquet_dataset_metadata metadata)
+  {
+    options.set_dataset_metadata(std::move(metadata));
+    return *this;
+  }
+
+  /**
+   * @brief Sets the arena to allocate decompressed data and decompression scratch space from.
+   *
+   * @param arena Arena to allocate from; null to allocate from the current device resource
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& decompression_arena(
+    std::shared_ptr<cudf::io::decompression_arena> arena)
+  {
+    options.set_decompression_arena(std::move(arena));
+    return *this;
+  }
+
+  /**
+   * @brief Sets the compressed size of the batches of row groups that large reads of flat
+   * columns are split into.
+   *
+   * @param size_bytes Compressed size of the batches, in bytes
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& pipeline_batch_size(size_t size_bytes)
+  {
+    options.set_pipeline_batch_size(size_bytes);
+    return *this;
+  }
+
   /**
    * @brief move parquet_reader_options member once it's built.
    */
@@ -334,6 +617,7 @@ class parquet_reader_options_builder {
  * @endcode
  *
  * @param options Settings for controlling reading behavior
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate device memory of the table in the returned
  * table_with_metadata
  *
@@ -341,8 +625,120 @@ class parquet_reader_options_builder {
  */
 table_with_metadata read_parquet(
   parquet_reader_options const& options,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Reads and parses the footers of the files of a Parquet dataset.
+ *
+ * The footers of multiple files are fetched and decoded in parallel. The returned object can be
+ * passed to later reads of the same files through `parquet_reader_options::set_dataset_metadata`
+ * to skip parsing the footers again.
+ *
+ * The following code snippet demonstrates how to read a dataset with previously parsed footers:
+ * @code
+ *  auto source   = cudf::io::source_info(file_paths);
+ *  auto metadata = cudf::io::read_parquet_metadata(source);
+ *  auto options  = cudf::io::parquet_reader_options::builder(source).dataset_metadata(metadata);
+ *  auto result   = cudf::io::read_parquet(options);
+ * @endcode
+ *
+ * @param src_info Dataset source
+ *
+ * @return The parsed footers of all files, which must share the same schema
+ */
+parquet_dataset_metadata read_parquet_metadata(source_info const& src_info);
+
+/**
+ * @brief Sets the capacity of the process-wide cache of Parquet file metadata.
+ *
+ * While the capacity is not zero, reads of Parquet files given by path keep the parsed footers
+ * and the decoded page headers of the files in a cache, so that later reads of the same data skip
+ * parsing and decoding them again. Files are identified by their path, size and modification
+ * time, so modified files are read anew. The least recently used metadata is evicted to keep the
+ * cache within its capacity.
+ *
+ * The capacity is zero by default, which disables the cache. Setting it to zero releases all
+ * cached metadata.
+ *
+ * @param capacity Maximum size of the cached metadata, in bytes
+ */
+void set_parquet_metadata_cache_capacity(std::size_t capacity);
+
+/**
+ * @brief Returns the capacity of the process-wide cache of Parquet file metadata, in bytes.
+ */
+std::size_t get_parquet_metadata_cache_capacity();
+
+/**
+ * @brief The chunked parquet reader class to read a Parquet dataset iteratively into a series of
+ * tables, chunk by chunk.
+ *
+ * The selected row groups are split into chunks whose decoded size is estimated, from the
+ * uncompressed sizes recorded in the file metadata, to not exceed a given byte limit. Row groups
+ * whose estimated size exceeds the limit are split at row boundaries and decoded in several
+ * passes, unless a filter is set, in which case chunks always hold whole row groups. A filter set
+ * in the options must outlive the reader.
+ *
+ * The following code snippet demonstrates how to read a dataset chunk by chunk:
+ * @code
+ *  auto source  = cudf::io::source_info("dataset.parquet");
+ *  auto options = cudf::io::parquet_reader_options::builder(source).build();
+ *  auto reader  = cudf::io::chunked_parquet_reader(512 * 1024 * 1024, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *  }
+ * @endcode
+ */
+class chunked_parquet_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *        This is added just to satisfy cython.
+   */
+  chunked_parquet_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * @param chunk_read_limit Limit on the estimated size in bytes of the table returned by each
+   * `read_chunk()` call, or `0` when there is no limit
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_parquet_reader(
+    std::size_t chunk_read_limit,
+    parquet_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   */
+  ~chunked_parquet_reader();
+
+  /**
+   * @brief Check if there is any data in the given source that has not yet been read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read a chunk of rows in the given Parquet source.
+   *
+   * The sequence of returned tables, if concatenated by their order, guarantees to form a complete
+   * dataset as reading the entire given source at once. An empty table is returned by the first
+   * call if the selection holds no rows.
+   *
+   * @throws cudf::logic_error If there is no data left to read
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::parquet::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -353,6 +749,17 @@ table_with_metadata read_parquet(
 /**
  * @brief Class to build `parquet_writer_options`.
  */
+/**
+ * @brief Sort order of a column within the row groups written, recorded in the file metadata.
+ *
+ * The order is declared by the caller and not checked by the writer.
+ */
+struct sorting_column {
+  size_type column_idx{};     //!< Index of the leaf column in the schema of the file
+  bool is_descending{false};  //!< Whether the values are in descending order
+  bool is_nulls_first{true};  //!< Whether the nulls come before the values
+};
+
 class parquet_writer_options_builder;
 
 /**
@@ -382,6 +789,16 @@ class parquet_writer_options {
   size_t _row_group_size_bytes = default_row_group_size_bytes;
   // Maximum number of rows in row group (unless smaller than a single page)
   size_type _row_group_size_rows = default_row_group_size_rows;
+  // Target maximum size of each page (unless smaller than a single row)
+  size_t _max_page_size_bytes = default_max_page_size_bytes;
+  // Maximum number of rows in each page
+  size_type _max_page_size_rows = default_max_page_size_rows;
+  // Select the encoding of each column chunk from an estimate of its encoded size
+  bool _adaptive_encoding = false;
+  // Maximum length of the string minimum and maximum values in the statistics
+  size_type _statistics_truncate_length = default_statistics_truncate_length;
+  // Sort order of the rows of each row group, if any
+  std::vector<sorting_column> _sorting_columns;
 
   /**
    * @brief Constructor from sink and table.
@@ -464,6 +881,23 @@ class parquet_writer_options {
    */
   bool is_enabled_int96_timestamps() const { return _write_timestamps_as_int96; }
 
+  /**
+   * @brief Returns `true` if the encoding of each column chunk is selected from an estimate of
+   * its encoded size
+   */
+  bool is_enabled_adaptive_encoding() const { return _adaptive_encoding; }
+
+  /**
+   * @brief Returns the maximum length of the string minimum and maximum values in the statistics,
+   * in bytes.
+   */
+  auto get_statistics_truncate_length() const { return _statistics_truncate_length; }
+
+  /**
+   * @brief Returns the sort order declared for the rows of each row group.
+   */
+  std::vector<sorting_column> const& get_sorting_columns() const { return _sorting_columns; }
+
   /**
    * @brief Returns Column chunks file paths to be set in the raw output metadata.
    */
@@ -482,6 +916,16 @@ class parquet_writer_options {
    */
   auto get_row_group_size_rows() const { return _row_group_size_rows; }
 
+  /**
+   * @brief Returns the target maximum page size, in bytes.
+   */
+  auto get_max_page_size_bytes() const { return _max_page_size_bytes; }
+
+  /**
+   * @brief Returns the maximum page size, in rows.
+   */
+  auto get_max_page_size_rows() const { return _max_page_size_rows; }
+
   /**
    * @brief Sets partitions.
    *
@@ -536,6 +980,49 @@ class parquet_writer_options {
    */
   void enable_int96_timestamps(bool req) { _write_timestamps_as_int96 = req; }
 
+  /**
+   * @brief Sets whether the encoding of each column chunk is selected from an estimate of its
+   * encoded size.
+   *
+   * When enabled, the writer estimates the size of each column chunk with the plain, dictionary
+   * and, for integers and strings, delta encodings, and uses the smallest one. Floating-point
+   * chunks that would be plain encoded use BYTE_STREAM_SPLIT when compression is enabled. When
+   * disabled, chunks are dictionary encoded when that is smaller than plain encoding.
+   *
+   * @param enabled Boolean value to enable/disable adaptive encoding selection
+   */
+  void enable_adaptive_encoding(bool enabled) { _adaptive_encoding = enabled; }
+
+  /**
+   * @brief Sets the maximum length of the string minimum and maximum values in the statistics,
+   * in bytes.
+   *
+   * Longer minimum values are truncated to a prefix of at most this length, and longer maximum
+   * values to a shorter prefix whose last character is incremented, so that they still bound the
+   * values of the chunk or page. Values are only truncated at UTF-8 character boundaries, and
+   * maximum values without ASCII characters in their prefix are not truncated.
+   *
+   * @param length Maximum length of the minimum and maximum values
+   */
+  void set_statistics_truncate_length(size_type length)
+  {
+    CUDF_EXPECTS(length > 0, "The statistics truncate length must be positive.");
+    _statistics_truncate_length = length;
+  }
+
+  /**
+   * @brief Sets the sort order declared for the rows of each row group.
+   *
+   * The columns are listed from the most significant, and written to the `sorting_columns` of
+   * each row group. Their order is not checked by the writer.
+   *
+   * @param columns Sort order of the rows, empty if they are not sorted
+   */
+  void set_sorting_columns(std::vector<sorting_column> columns)
+  {
+    _sorting_columns = std::move(columns);
+  }
+
   /**
    * @brief Sets column chunks file path to be set in the raw output metadata.
    *
@@ -570,6 +1057,28 @@ class parquet_writer_options {
       "The maximum row group size cannot be smaller than the page size, which is 5000 rows.");
     _row_group_size_rows = size_rows;
   }
+
+  /**
+   * @brief Sets the target maximum page size, in bytes.
+   *
+   * Pages are closed before the size of their encoded data exceeds the target. The rows of a
+   * page fragment, which holds up to 5000 rows, are grouped into one page; the fragments of
+   * columns with large values are made smaller so that they fit in a page.
+   */
+  void set_max_page_size_bytes(size_t size_bytes)
+  {
+    CUDF_EXPECTS(size_bytes >= 1024, "The maximum page size cannot be smaller than 1KB.");
+    _max_page_size_bytes = size_bytes;
+  }
+
+  /**
+   * @brief Sets the maximum page size, in rows.
+   */
+  void set_max_page_size_rows(size_type size_rows)
+  {
+    CUDF_EXPECTS(size_rows > 0, "The maximum page size must hold at least one row.");
+    _max_page_size_rows = size_rows;
+  }
 };
 
 class parquet_writer_options_builder {
@@ -700,26 +1209,87 @@ class parquet_writer_options_builder {
   }
 
   /**
-   * @brief Sets whether int96 timestamps are written or not in parquet_writer_options.
+   * @brief Sets the target maximum size of output pages, in bytes.
    *
-   * @param enabled Boolean value to enable/disable int96 timestamps.
+   * @param val target maximum page size
    * @return this for chaining.
    */
-  parquet_writer_options_builder& int96_timestamps(bool enabled)
+  parquet_writer_options_builder& max_page_size_bytes(size_t val)
   {
-    options._write_timestamps_as_int96 = enabled;
+    options.set_max_page_size_bytes(val);
     return *this;
   }
 
   /**
-   * @brief move parquet_writer_options member once it's built.
-   */
-  operator parquet_writer_options&&() { return std::move(options); }
-
-  /**
-   * @brief move parquet_writer_options member once it's built.
+   * @brief Sets the maximum number of rows in output pages.
    *
-   * This has been added since Cython does not support overloading of conversion operators.
+   * @param val maximum number or rows
+   * @return this for chaining.
+   */
+  parquet_writer_options_builder& max_page_size_rows(size_type val)
+  {
+    options.set_max_page_size_rows(val);
+    return *this;
+  }
+
+  /**
+   * @brief Sets whether int96 timestamps are written or not in parquet_writer_options.
+   *
+   * @param enabled Boolean value to enable/disable int96 timestamps.
+   * @return this for chaining.
+   */
+  parquet_writer_options_builder& int96_timestamps(bool enabled)
+  {
+    options._write_timestamps_as_int96 = enabled;
+    return *this;
+  }
+
+  /**
+   * @brief Sets whether the encoding of each column chunk is selected from an estimate of its
+   * encoded size.
+   *
+   * @param enabled Boolean value to enable/disable adaptive encoding selection
+   * @return this for chaining.
+   */
+  parquet_writer_options_builder& adaptive_encoding(bool enabled)
+  {
+    options.enable_adaptive_encoding(enabled);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the maximum length of the string minimum and maximum values in the statistics.
+   *
+   * @param val maximum length, in bytes
+   * @return this for chaining.
+   */
+  parquet_writer_options_builder& statistics_truncate_length(size_type val)
+  {
+    options.set_statistics_truncate_length(val);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the sort order declared for the rows of each row group.
+   *
+   * @param columns Sort order of the rows, empty if they are not sorted
+   * @return this for chaining.
+   */
+  parquet_writer_options_builder& sorting_columns(std::vector<sorting_column> columns)
+  {
+    options.set_sorting_columns(std::move(columns));
+    return *this;
+  }
+
+  /**
+   * @brief move parquet_writer_options member once it's built.
+   */
+  operator parquet_writer_options&&() { return std::move(options); }
+
+  /**
+   * @brief move parquet_writer_options member once it's built.
+   *
+   * This has been added since Cython does not support overloading of conversion operators.
    */
   parquet_writer_options&& build() { return std::move(options); }
 };
@@ -735,6 +1305,7 @@ class parquet_writer_options_builder {
  * @endcode
  *
  * @param options Settings for controlling writing behavior.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource to use for device memory allocation.
  *
  * @return A blob that contains the file metadata (parquet FileMetadata thrift message) if
@@ -743,6 +1314,7 @@ class parquet_writer_options_builder {
 
 std::unique_ptr<std::vector<uint8_t>> write_parquet(
   parquet_writer_options const& options,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -783,6 +1355,18 @@ class chunked_parquet_writer_options {
   size_t _row_group_size_bytes = default_row_group_size_bytes;
   // Maximum number of rows in row group (unless smaller than a single page)
   size_type _row_group_size_rows = default_row_group_size_rows;
+  // Target maximum size of each page (unless smaller than a single row)
+  size_t _max_page_size_bytes = default_max_page_size_bytes;
+  // Maximum number of rows in each page
+  size_type _max_page_size_rows = default_max_page_size_rows;
+  // Maximum number of column chunk writes left pending while encoding continues
+  size_type _max_in_flight_writes = 0;
+  // Select the encoding of each column chunk from an estimate of its encoded size
+  bool _adaptive_encoding = false;
+  // Maximum length of the string minimum and maximum values in the statistics
+  size_type _statistics_truncate_length = default_statistics_truncate_length;
+  // Sort order of the rows of each row group, if any
+  std::vector<sorting_column> _sorting_columns;
 
   /**
    * @brief Constructor from sink.
@@ -844,6 +1428,39 @@ class chunked_parquet_writer_options {
    */
   auto get_row_group_size_rows() const { return _row_group_size_rows; }
 
+  /**
+   * @brief Returns the target maximum page size, in bytes.
+   */
+  auto get_max_page_size_bytes() const { return _max_page_size_bytes; }
+
+  /**
+   * @brief Returns the maximum page size, in rows.
+   */
+  auto get_max_page_size_rows() const { return _max_page_size_rows; }
+
+  /**
+   * @brief Returns the maximum number of column chunk writes left pending while encoding
+   * continues; zero if each write completes before encoding continues.
+   */
+  auto get_max_in_flight_writes() const { return _max_in_flight_writes; }
+
+  /**
+   * @brief Returns `true` if the encoding of each column chunk is selected from an estimate of
+   * its encoded size
+   */
+  bool is_enabled_adaptive_encoding() const { return _adaptive_encoding; }
+
+  /**
+   * @brief Returns the maximum length of the string minimum and maximum values in the statistics,
+   * in bytes.
+   */
+  auto get_statistics_truncate_length() const { return _statistics_truncate_length; }
+
+  /**
+   * @brief Returns the sort order declared for the rows of each row group.
+   */
+  std::vector<sorting_column> const& get_sorting_columns() const { return _sorting_columns; }
+
   /**
    * @brief Sets metadata.
    *
@@ -907,6 +1524,84 @@ class chunked_parquet_writer_options {
     _row_group_size_rows = size_rows;
   }
 
+  /**
+   * @brief Sets the target maximum page size, in bytes.
+   *
+   * Pages are closed before the size of their encoded data exceeds the target. The rows of a
+   * page fragment, which holds up to 5000 rows, are grouped into one page; the fragments of
+   * columns with large values are made smaller so that they fit in a page.
+   */
+  void set_max_page_size_bytes(size_t size_bytes)
+  {
+    CUDF_EXPECTS(size_bytes >= 1024, "The maximum page size cannot be smaller than 1KB.");
+    _max_page_size_bytes = size_bytes;
+  }
+
+  /**
+   * @brief Sets the maximum page size, in rows.
+   */
+  void set_max_page_size_rows(size_type size_rows)
+  {
+    CUDF_EXPECTS(size_rows > 0, "The maximum page size must hold at least one row.");
+    _max_page_size_rows = size_rows;
+  }
+
+  /**
+   * @brief Sets the maximum number of column chunk writes left pending while encoding continues.
+   *
+   * When nonzero, the column chunks are copied to pinned host buffers and written to the sink from
+   * a background thread, so that writing a chunk overlaps the encoding of the following ones,
+   * including those of the next table written. Sinks that prefer device writes are not affected.
+   */
+  void set_max_in_flight_writes(size_type count)
+  {
+    CUDF_EXPECTS(count >= 0, "The maximum number of writes in flight cannot be negative");
+    _max_in_flight_writes = count;
+  }
+
+  /**
+   * @brief Sets whether the encoding of each column chunk is selected from an estimate of its
+   * encoded size.
+   *
+   * When enabled, the writer estimates the size of each column chunk with the plain, dictionary
+   * and, for integers and strings, delta encodings, and uses the smallest one. Floating-point
+   * chunks that would be plain encoded use BYTE_STREAM_SPLIT when compression is enabled. When
+   * disabled, chunks are dictionary encoded when that is smaller than plain encoding.
+   *
+   * @param enabled Boolean value to enable/disable adaptive encoding selection
+   */
+  void enable_adaptive_encoding(bool enabled) { _adaptive_encoding = enabled; }
+
+  /**
+   * @brief Sets the maximum length of the string minimum and maximum values in the statistics,
+   * in bytes.
+   *
+   * Longer minimum values are truncated to a prefix of at most this length, and longer maximum
+   * values to a shorter prefix whose last character is incremented, so that they still bound the
+   * values of the chunk or page. Values are only truncated at UTF-8 character boundaries, and
+   * maximum values without ASCII characters in their prefix are not truncated.
+   *
+   * @param length Maximum length of the minimum and maximum values
+   */
+  void set_statistics_truncate_length(size_type length)
+  {
+    CUDF_EXPECTS(length > 0, "The statistics truncate length must be positive.");
+    _statistics_truncate_length = length;
+  }
+
+  /**
+   * @brief Sets the sort order declared for the rows of each row group.
+   *
+   * The columns are listed from the most significant, and written to the `sorting_columns` of
+   * each row group. Their order is not checked by the writer.
+   *
+   * @param columns Sort order of the rows, empty if they are not sorted
+   */
+  void set_sorting_columns(std::vector<sorting_column> columns)
+  {
+    _sorting_columns = std::move(columns);
+  }
+
   /**
    * @brief creates builder to build chunked_parquet_writer_options.
    *
@@ -1025,6 +1720,79 @@ class chunked_parquet_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the target maximum size of output pages, in bytes.
+   *
+   * @param val target maximum page size
+   * @return this for chaining.
+   */
+  chunked_parquet_writer_options_builder& max_page_size_bytes(size_t val)
+  {
+    options.set_max_page_size_bytes(val);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the maximum number of rows in output pages.
+   *
+   * @param val maximum number or rows
+   * @return this for chaining.
+   */
+  chunked_parquet_writer_options_builder& max_page_size_rows(size_type val)
+  {
+    options.set_max_page_size_rows(val);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the maximum number of column chunk writes left pending while encoding continues.
+   *
+   * @param val maximum number of writes in flight, or zero to write synchronously
+   * @return this for chaining.
+   */
+  chunked_parquet_writer_options_builder& max_in_flight_writes(size_type val)
+  {
+    options.set_max_in_flight_writes(val);
+    return *this;
+  }
+
+  /**
+   * @brief Sets whether the encoding of each column chunk is selected from an estimate of its
+   * encoded size.
+   *
+   * @param enabled Boolean value to enable/disable adaptive encoding selection
+   * @return this for chaining.
+   */
+  chunked_parquet_writer_options_builder& adaptive_encoding(bool enabled)
+  {
+    options.enable_adaptive_encoding(enabled);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the maximum length of the string minimum and maximum values in the statistics.
+   *
+   * @param val maximum length, in bytes
+   * @return this for chaining.
+   */
+  chunked_parquet_writer_options_builder& statistics_truncate_length(size_type val)
+  {
+    options.set_statistics_truncate_length(val);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the sort order declared for the rows of each row group.
+   *
+   * @param columns Sort order of the rows, empty if they are not sorted
+   * @return this for chaining.
+   */
+  chunked_parquet_writer_options_builder& sorting_columns(std::vector<sorting_column> columns)
+  {
+    options.set_sorting_columns(std::move(columns));
+    return *this;
+  }
+
   /**
    * @brief move chunked_parquet_writer_options member once it's built.
    */
@@ -1099,10 +1867,369 @@ class parquet_chunked_writer {
   std::unique_ptr<std::vector<uint8_t>> close(
     std::vector<std::string> const& column_chunks_file_paths = {});
 
+  /**
+   * @brief Returns the encoding of each column chunk written so far.
+   *
+   * The report has one entry per row group, in the order the row groups were written, holding the
+   * encoding of the values of each leaf column of the row group. For partitioned writes, the row
+   * groups of each partition follow those of the previous partition.
+   *
+   * @return Encoding of each column chunk, indexed by row group and leaf column
+   */
+  [[nodiscard]] std::vector<std::vector<column_encoding>> const& encoding_report() const;
+
   // Unique pointer to impl writer class
   std::unique_ptr<cudf::io::detail::parquet::writer> writer;
 };
 
+/**
+ * @brief Builds options for `partitioned_parquet_writer_options`.
+ */
+class partitioned_parquet_writer_options_builder;
+
+/**
+ * @brief Settings for `write_partitioned_parquet()`.
+ *
+ * The rows of each table written are grouped by the values of the partition key columns, and the
+ * remaining columns of each group are written to a file in the Hive-style directory of its
+ * partition, `<base_path>/<key0>=<value0>/<key1>=<value1>/<file_prefix>-<n>.parquet`. Null keys
+ * are written as `__HIVE_DEFAULT_PARTITION__`.
+ */
+class partitioned_parquet_writer_options {
+  // Root directory of the dataset
+  std::string _base_path;
+  // Indices of the partition key columns
+  std::vector<size_type> _partition_cols;
+  // Prefix of the names of the files written
+  std::string _file_prefix = "part";
+  // Specify the compression format to use
+  compression_type _compression = compression_type::AUTO;
+  // Specify the level of statistics in the output file
+  statistics_freq _stats_level = statistics_freq::STATISTICS_ROWGROUP;
+  // Optional associated metadata, for all the columns of the input table
+  table_input_metadata const* _metadata = nullptr;
+  // Maximum number of files left open at a time
+  size_type _max_open_files = 256;
+  // Maximum number of rows in each file; zero if unlimited
+  size_type _max_rows_per_file = 0;
+
+  /**
+   * @brief Constructor from base path and partition key columns.
+   *
+   * @param base_path Root directory of the dataset
+   * @param partition_cols Indices of the partition key columns
+   */
+  explicit partitioned_parquet_writer_options(std::string base_path,
+                                              std::vector<size_type> partition_cols)
+    : _base_path(std::move(base_path)), _partition_cols(std::move(partition_cols))
+  {
+  }
+
+  friend partitioned_parquet_writer_options_builder;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  partitioned_parquet_writer_options() = default;
+
+  /**
+   * @brief Returns the root directory of the dataset.
+   */
+  [[nodiscard]] std::string const& get_base_path() const { return _base_path; }
+
+  /**
+   * @brief Returns the indices of the partition key columns.
+   */
+  [[nodiscard]] std::vector<size_type> const& get_partition_cols() const { return _partition_cols; }
+
+  /**
+   * @brief Returns the prefix of the names of the files written.
+   */
+  [[nodiscard]] std::string const& get_file_prefix() const { return _file_prefix; }
+
+  /**
+   * @brief Returns compression format used.
+   */
+  [[nodiscard]] compression_type get_compression() const { return _compression; }
+
+  /**
+   * @brief Returns level of statistics requested in output file.
+   */
+  [[nodiscard]] statistics_freq get_stats_level() const { return _stats_level; }
+
+  /**
+   * @brief Returns metadata information.
+   */
+  [[nodiscard]] table_input_metadata const* get_metadata() const { return _metadata; }
+
+  /**
+   * @brief Returns the maximum number of files left open at a time.
+   */
+  [[nodiscard]] size_type get_max_open_files() const { return _max_open_files; }
+
+  /**
+   * @brief Returns the maximum number of rows in each file; zero if unlimited.
+   */
+  [[nodiscard]] size_type get_max_rows_per_file() const { return _max_rows_per_file; }
+
+  /**
+   * @brief Sets the prefix of the names of the files written.
+   *
+   * Writers that add files to the same dataset concurrently must use different prefixes.
+   *
+   * @param prefix Prefix of the file names
+   */
+  void set_file_prefix(std::string prefix)
+  {
+    CUDF_EXPECTS(not prefix.empty(), "The file prefix cannot be empty");
+    _file_prefix = std::move(prefix);
+  }
+
+  /**
+   * @brief Sets compression type.
+   *
+   * @param compression The compression type to use.
+   */
+  void set_compression(compression_type compression) { _compression = compression; }
+
+  /**
+   * @brief Sets the level of statistics in the output files.
+   *
+   * @param sf Level of statistics requested in the output files.
+   */
+  void set_stats_level(statistics_freq sf) { _stats_level = sf; }
+
+  /**
+   * @brief Sets metadata.
+   *
+   * The metadata describes all the columns of the input table, including the partition keys,
+   * whose names are used in the directory names. The partition keys must be named.
+   *
+   * @param metadata Associated metadata.
+   */
+  void set_metadata(table_input_metadata const* metadata) { _metadata = metadata; }
+
+  /**
+   * @brief Sets the maximum number of files left open at a time.
+   *
+   * When a row must be written to a partition whose file is not open and the limit has been
+   * reached, the least recently written file is closed; later rows of its partition are written
+   * to a new file.
+   */
+  void set_max_open_files(size_type count)
+  {
+    CUDF_EXPECTS(count > 0, "At least one file must be allowed to be open");
+    _max_open_files = count;
+  }
+
+  /**
+   * @brief Sets the maximum number of rows in each file; zero if unlimited.
+   *
+   * Once a file holds that many rows, it is closed and the next rows of its partition are written
+   * to a new file.
+   */
+  void set_max_rows_per_file(size_type count)
+  {
+    CUDF_EXPECTS(count >= 0, "The maximum number of rows per file cannot be negative");
+    _max_rows_per_file = count;
+  }
+
+  /**
+   * @brief Creates builder to build partitioned_parquet_writer_options.
+   *
+   * @param base_path Root directory of the dataset
+   * @param partition_cols Indices of the partition key columns
+   *
+   * @return Builder to build `partitioned_parquet_writer_options`.
+   */
+  static partitioned_parquet_writer_options_builder builder(std::string base_path,
+                                                            std::vector<size_type> partition_cols);
+};
+
+class partitioned_parquet_writer_options_builder {
+  partitioned_parquet_writer_options options;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  partitioned_parquet_writer_options_builder() = default;
+
+  /**
+   * @brief Constructor from base path and partition key columns.
+   *
+   * @param base_path Root directory of the dataset
+   * @param partition_cols Indices of the partition key columns
+   */
+  partitioned_parquet_writer_options_builder(std::string base_path,
+                                             std::vector<size_type> partition_cols)
+    : options(std::move(base_path), std::move(partition_cols))
+  {
+  }
+
+  /**
+   * @brief Sets the prefix of the names of the files written.
+   *
+   * @param prefix Prefix of the file names
+   * @return this for chaining.
+   */
+  partitioned_parquet_writer_options_builder& file_prefix(std::string prefix)
+  {
+    options.set_file_prefix(std::move(prefix));
+    return *this;
+  }
+
+  /**
+   * @brief Sets compression type.
+   *
+   * @param compression The compression type to use.
+   * @return this for chaining.
+   */
+  partitioned_parquet_writer_options_builder& compression(compression_type compression)
+  {
+    options._compression = compression;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the level of statistics in the output files.
+   *
+   * @param sf Level of statistics requested in the output files.
+   * @return this for chaining.
+   */
+  partitioned_parquet_writer_options_builder& stats_level(statistics_freq sf)
+  {
+    options._stats_level = sf;
+    return *this;
+  }
+
+  /**
+   * @brief Sets metadata.
+   *
+   * @param metadata Associated metadata, for all the columns of the input table.
+   * @return this for chaining.
+   */
+  partitioned_parquet_writer_options_builder& metadata(table_input_metadata const* metadata)
+  {
+    options._metadata = metadata;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the maximum number of files left open at a time.
+   *
+   * @param count Maximum number of open files
+   * @return this for chaining.
+   */
+  partitioned_parquet_writer_options_builder& max_open_files(size_type count)
+  {
+    options.set_max_open_files(count);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the maximum number of rows in each file; zero if unlimited.
+   *
+   * @param count Maximum number of rows per file
+   * @return this for chaining.
+   */
+  partitioned_parquet_writer_options_builder& max_rows_per_file(size_type count)
+  {
+    options.set_max_rows_per_file(count);
+    return *this;
+  }
+
+  /**
+   * @brief move partitioned_parquet_writer_options member once it's built.
+   */
+  operator partitioned_parquet_writer_options&&() { return std::move(options); }
+
+  /**
+   * @brief move partitioned_parquet_writer_options member once it's is built.
+   *
+   * This has been added since Cython does not support overloading of conversion operators.
+   */
+  partitioned_parquet_writer_options&& build() { return std::move(options); }
+};
+
+/**
+ * @brief Writer of Hive-partitioned Parquet datasets.
+ *
+ * Each table written is grouped on the GPU by its partition keys, and the rows of each partition
+ * are appended to the open file of that partition, so that a dataset can be written from a
+ * series of unsorted tables in a single pass.
+ *
+ * @code
+ *  auto options = cudf::io::partitioned_parquet_writer_options::builder("/data/events", {0})
+ *                   .metadata(&metadata)
+ *                   .max_rows_per_file(10'000'000);
+ *  auto writer = cudf::io::partitioned_parquet_writer(options);
+ *
+ *  writer.write(table0);
+ *  writer.write(table1);
+ *  auto const files = writer.close();
+ *  @endcode
+ */
+class partitioned_parquet_writer {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *        This is added just to satisfy cython.
+   */
+  partitioned_parquet_writer() = default;
+
+  /**
+   * @brief Constructor with partitioned writer options
+   *
+   * @param[in] options options used to write the dataset
+   * @param[in] mr Device memory resource to use for device memory allocation
+   */
+  partitioned_parquet_writer(
+    partitioned_parquet_writer_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Writes the rows of a table to the files of their partitions.
+   *
+   * @param[in] table Table that needs to be written, including the partition key columns
+   *
+   * @throws cudf::logic_error If a partition key column has an unsupported type
+   * @return returns reference of the class object
+   */
+  partitioned_parquet_writer& write(table_view const& table);
+
+  /**
+   * @brief Closes all open files, completing the write of the dataset.
+   *
+   * @return Paths of the files written, relative to the base path, in the order they were created
+   */
+  std::vector<std::string> close();
+
+  // Unique pointer to impl writer class
+  std::unique_ptr<cudf::io::detail::parquet::partitioned_writer> writer;
+};
+
+/**
+ * @brief Writes a table to a Hive-partitioned Parquet dataset.
+ *
+ * Partition key columns can be of integral, boolean, timestamp or string type.
+ *
+ * @param options Settings for controlling writing behavior
+ * @param table Table to write, including the partition key columns
+ * @param mr Device memory resource to use for device memory allocation
+ *
+ * @return Paths of the files written, relative to the base path
+ */
+std::vector<std::string> write_partitioned_parquet(
+  partitioned_parquet_writer_options const& options,
+  table_view const& table,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace io
 }  // namespace cudf
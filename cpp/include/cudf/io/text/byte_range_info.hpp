@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace cudf {
+namespace io {
+namespace text {
+
+/**
+ * @brief stores offset and size used to indicate a byte range
+ */
+class byte_range_info {
+ private:
+  int64_t _offset;
+  int64_t _size;
+
+ public:
+  constexpr byte_range_info() noexcept : _offset(0), _size(0) {}
+  constexpr byte_range_info(int64_t offset, int64_t size) noexcept : _offset(offset), _size(size)
+  {
+  }
+
+  /**
+   * @brief Get the offset in bytes of the first byte of the range
+   */
+  [[nodiscard]] constexpr int64_t offset() const noexcept { return _offset; }
+
+  /**
+   * @brief Get the size in bytes of the range
+   */
+  [[nodiscard]] constexpr int64_t size() const noexcept { return _size; }
+
+  /**
+   * @brief Returns whether the range holds no bytes
+   */
+  [[nodiscard]] constexpr bool is_empty() const noexcept { return _size == 0; }
+};
+
+/**
+ * @brief Create a byte range which covers every byte of any data source.
+ */
+constexpr byte_range_info create_byte_range_info_max() noexcept
+{
+  return {0, std::numeric_limits<int64_t>::max()};
+}
+
+}  // namespace text
+}  // namespace io
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -52,6 +52,16 @@ class device_data_chunk {
  */
 class data_chunk_reader {
  public:
+  /**
+   * @brief Skips the given number of bytes of the data source
+   *
+   * The next chunk begins right after the skipped bytes; skipping past the end of the data source
+   * leaves no bytes to read.
+   *
+   * @param size number of bytes to skip.
+   */
+  virtual void skip_bytes(std::size_t size) = 0;
+
   /**
    * @brief Get the next chunk of bytes from the data source
    *
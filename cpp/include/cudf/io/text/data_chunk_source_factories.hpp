@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -25,7 +25,9 @@
 #include <thrust/host_vector.h>
 #include <thrust/system/cuda/experimental/pinned_allocator.h>
 
+#include <algorithm>
 #include <fstream>
+#include <future>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -65,11 +67,16 @@ class device_uvector_data_chunk : public device_data_chunk {
  * @brief a reader which produces views of device memory which contain a copy of the data from an
  * istream.
  *
+ * Reads run ahead on a background thread: while a chunk is copied to the device and processed,
+ * the next chunk of the same size is read in to a second pinned host buffer.
  */
 class istream_data_chunk_reader : public data_chunk_reader {
   struct host_ticket {
     cudaEvent_t event;
     thrust::host_vector<char, thrust::system::cuda::experimental::pinned_allocator<char>> buffer;
+    std::size_t prefetch_size = 0;
+    // declared last, so that a read in to the buffer finishes before the buffer is destroyed
+    std::future<std::size_t> prefetch;
   };
 
  public:
@@ -84,11 +91,21 @@ class istream_data_chunk_reader : public data_chunk_reader {
 
   ~istream_data_chunk_reader()
   {
+    // the read ahead synchronizes on the event of its ticket, so it must finish first.
+    for (std::size_t i = 0; i < _tickets.size(); i++) {
+      if (_tickets[i].prefetch.valid()) { _tickets[i].prefetch.wait(); }
+    }
     for (std::size_t i = 0; i < _tickets.size(); i++) {
       CUDA_TRY(cudaEventDestroy(_tickets[i].event));
     }
   }
 
+  void skip_bytes(std::size_t size) override
+  {
+    discard_prefetch(_tickets[_next_ticket_idx], 0);
+    _datastream->ignore(static_cast<std::streamsize>(size));
+  }
+
   std::unique_ptr<device_data_chunk> get_next_chunk(std::size_t read_size,
                                                     rmm::cuda_stream_view stream) override
   {
@@ -98,17 +115,13 @@ class istream_data_chunk_reader : public data_chunk_reader {
 
     _next_ticket_idx = (_next_ticket_idx + 1) % _tickets.size();
 
-    // synchronize on the last host-to-device copy, so we don't clobber the host buffer.
-    CUDA_TRY(cudaEventSynchronize(h_ticket.event));
-
-    // resize the host buffer as necessary to contain the requested number of bytes
-    if (h_ticket.buffer.size() < read_size) { h_ticket.buffer.resize(read_size); }
-
-    // read data from the host istream in to the pinned host memory buffer
-    _datastream->read(h_ticket.buffer.data(), read_size);
-
-    // adjust the read size to reflect how many bytes were actually read from the data stream
-    read_size = _datastream->gcount();
+    if (h_ticket.prefetch.valid() and h_ticket.prefetch_size >= read_size) {
+      // use the bytes read ahead, giving back any bytes beyond the requested size.
+      read_size = discard_prefetch(h_ticket, read_size);
+    } else {
+      discard_prefetch(h_ticket, 0);
+      read_size = read(h_ticket, read_size);
+    }
 
     // get a view over some device memory we can use to buffer the read data on to device.
     auto chunk = rmm::device_uvector<char>(read_size, stream);
@@ -124,11 +137,59 @@ class istream_data_chunk_reader : public data_chunk_reader {
     // record the host-to-device copy.
     CUDA_TRY(cudaEventRecord(h_ticket.event, stream.value()));
 
+    // read the next chunk while this one is copied and processed, assuming the same size.
+    if (read_size > 0) {
+      auto& next_ticket = _tickets[_next_ticket_idx];
+      auto read_ahead  = [this, &next_ticket, read_size]() { return read(next_ticket, read_size); };
+
+      next_ticket.prefetch_size = read_size;
+      next_ticket.prefetch      = std::async(std::launch::async, read_ahead);
+    }
+
     // return the view over device memory so it can be processed.
     return std::make_unique<device_uvector_data_chunk>(std::move(chunk));
   }
 
  private:
+  /**
+   * @brief reads up to `read_size` bytes in to the buffer of the ticket
+   *
+   * @return the number of bytes read
+   */
+  std::size_t read(host_ticket& h_ticket, std::size_t read_size)
+  {
+    // synchronize on the last host-to-device copy, so we don't clobber the host buffer.
+    CUDA_TRY(cudaEventSynchronize(h_ticket.event));
+
+    // resize the host buffer as necessary to contain the requested number of bytes
+    if (h_ticket.buffer.size() < read_size) { h_ticket.buffer.resize(read_size); }
+
+    // read data from the host istream in to the pinned host memory buffer
+    _datastream->read(h_ticket.buffer.data(), read_size);
+
+    // return how many bytes were actually read from the data stream
+    return _datastream->gcount();
+  }
+
+  /**
+   * @brief waits for the read ahead of the ticket, if any, and keeps the first `keep_size` bytes
+   *
+   * The remaining bytes are given back to the istream, so that the next read begins with them.
+   *
+   * @return the number of bytes kept
+   */
+  std::size_t discard_prefetch(host_ticket& h_ticket, std::size_t keep_size)
+  {
+    if (not h_ticket.prefetch.valid()) { return 0; }
+    auto const prefetched = h_ticket.prefetch.get();
+    keep_size             = std::min(keep_size, prefetched);
+    if (prefetched > keep_size) {
+      _datastream->clear();
+      _datastream->seekg(-static_cast<std::streamoff>(prefetched - keep_size), std::ios_base::cur);
+    }
+    return keep_size;
+  }
+
   std::size_t _next_ticket_idx = 0;
   std::unique_ptr<std::istream> _datastream;
   std::vector<host_ticket> _tickets;
@@ -143,6 +204,11 @@ class device_span_data_chunk_reader : public data_chunk_reader {
  public:
   device_span_data_chunk_reader(device_span<char const> data) : _data(data) {}
 
+  void skip_bytes(std::size_t size) override
+  {
+    _position += std::min<std::size_t>(size, _data.size() - _position);
+  }
+
   std::unique_ptr<device_data_chunk> get_next_chunk(std::size_t read_size,
                                                     rmm::cuda_stream_view stream) override
   {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,19 +17,62 @@
 #pragma once
 
 #include <cudf/column/column.hpp>
+#include <cudf/io/text/byte_range_info.hpp>
 #include <cudf/io/text/data_chunk_source.hpp>
 
 #include <rmm/mr/device/device_memory_resource.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace cudf {
 namespace io {
 namespace text {
 
+/**
+ * @brief Splits the source text into a strings column using a multiple byte delimiter.
+ *
+ * Each row ends with, and includes, the delimiter; the last row ends at the end of the source.
+ *
+ * When a byte range is given, the output holds only the rows which begin inside of it: the first
+ * row of the source begins at offset zero, and every other row right after a delimiter. The last of
+ * these rows is read past the end of the range, up to its delimiter. Splitting consecutive byte
+ * ranges of a source therefore produces each row exactly once, so that the ranges can be split
+ * separately and concatenated.
+ *
+ * @param source The source to split
+ * @param delimiter The delimiter that ends each row
+ * @param byte_range The byte range of the source whose rows are returned
+ * @param mr Memory resource to use for the device memory allocation
+ * @return The strings found by splitting the source by the delimiter within the byte range
+ */
 std::unique_ptr<cudf::column> multibyte_split(
   data_chunk_source const& source,
   std::string const& delimiter,
+  byte_range_info byte_range          = create_byte_range_info_max(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Splits the source text into a strings column using any of several multiple byte
+ * delimiters.
+ *
+ * The delimiters are matched together in a single pass over the source: each row ends with, and
+ * includes, the first of the delimiters found after its beginning. Otherwise the same as the
+ * single delimiter overload.
+ *
+ * @throw cudf::logic_error if no delimiter is given, or if any delimiter is empty
+ *
+ * @param source The source to split
+ * @param delimiters The delimiters that end the rows
+ * @param byte_range The byte range of the source whose rows are returned
+ * @param mr Memory resource to use for the device memory allocation
+ * @return The strings found by splitting the source by the delimiters within the byte range
+ */
+std::unique_ptr<cudf::column> multibyte_split(
+  data_chunk_source const& source,
+  std::vector<std::string> const& delimiters,
+  byte_range_info byte_range          = create_byte_range_info_max(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 }  // namespace text
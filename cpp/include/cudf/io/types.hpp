@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -27,6 +27,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -60,7 +61,21 @@ enum class compression_type {
   BZIP2,   ///< BZIP2 format, using Burrows-Wheeler transform
   BROTLI,  ///< BROTLI format, using LZ77 + Huffman + 2nd order context modeling
   ZIP,     ///< ZIP format, using DEFLATE algorithm
-  XZ       ///< XZ format, using LZMA(2) algorithm
+  XZ,      ///< XZ format, using LZMA(2) algorithm
+  ZSTD,    ///< Zstandard format
+  LZ4,     ///< LZ4 format, using LZ77
+  ZLIB     ///< ZLIB format, using DEFLATE algorithm
+};
+
+/**
+ * @brief Encodings of the values of a column chunk written to a file
+ */
+enum class column_encoding {
+  PLAIN,                ///< Values stored as they are
+  DICTIONARY,           ///< Indices into a dictionary of the unique values
+  DELTA_BINARY_PACKED,  ///< Bit-packed differences between consecutive integers
+  DELTA_BYTE_ARRAY,     ///< Strings stored as the suffix after the prefix shared with the previous
+  BYTE_STREAM_SPLIT     ///< Floating-point values split into one stream per byte
 };
 
 /**
@@ -90,6 +105,7 @@ enum statistics_freq {
   STATISTICS_NONE     = 0,  ///< No column statistics
   STATISTICS_ROWGROUP = 1,  ///< Per-Rowgroup column statistics
   STATISTICS_PAGE     = 2,  ///< Per-page column statistics
+  STATISTICS_COLUMN   = 3,  ///< Per-rowgroup statistics, plus column and offset indices (Parquet)
 };
 
 /**
@@ -105,6 +121,30 @@ struct column_name_info {
   column_name_info() = default;
 };
 
+/**
+ * @brief Breakdown of the work of a read, returned by the readers whose options enable it.
+ *
+ * The time of a stage is measured between CUDA events recorded on the stream of the read when the
+ * stage starts and ends. It includes the time the stream waits for the host meanwhile, e.g. for
+ * the data of the sources in the `read` stage. Stages that run several times, e.g. once per batch
+ * of row groups, are summed.
+ */
+struct reader_profile {
+  /**
+   * @brief Time spent in one stage of the reader
+   */
+  struct stage_time {
+    std::string name;   //!< Name of the stage, e.g. "read", "decompress" or "decode"
+    float time_ms = 0;  //!< Time of the stage, in milliseconds
+  };
+
+  size_t bytes_read         = 0;        //!< Bytes read from the sources
+  size_t compressed_bytes   = 0;        //!< Bytes of compressed data decompressed by the reader
+  size_t uncompressed_bytes = 0;        //!< Bytes decompressed from `compressed_bytes`
+  size_t pages_skipped      = 0;        //!< Pages, stripes or row groups skipped, not read
+  std::vector<stage_time> stage_times;  //!< Times of the stages, in the order they first ran
+};
+
 /**
  * @brief Table metadata for io readers/writers (primarily column names)
  * For nested types (structs, maps, unions), the ordering of names in the column_names vector
@@ -125,6 +165,7 @@ struct table_metadata {
   std::vector<column_name_info>
     schema_info;  //!< Detailed name information for the entire output hierarchy
   std::map<std::string, std::string> user_data;  //!< Format-dependent metadata as key-values pairs
+  std::optional<reader_profile> profile;         //!< Profile of the read, if requested
 };
 
 /**
@@ -242,6 +283,7 @@ class column_in_metadata {
   thrust::optional<bool> _nullable;
   bool _list_column_is_map  = false;
   bool _use_int96_timestamp = false;
+  bool _bloom_filter        = false;
   // bool _output_as_binary = false;
   thrust::optional<uint8_t> _decimal_precision;
   std::vector<column_in_metadata> children;
@@ -324,6 +366,23 @@ class column_in_metadata {
     return *this;
   }
 
+  /**
+   * @brief Specifies whether to write a bloom filter for each column chunk of this column
+   *
+   * Honored by the parquet writer, for top-level integral, floating point, decimal32, decimal64
+   * and string columns, and by the ORC writer, which writes a filter per rowgroup of top-level
+   * integral, boolean, floating point, date and string columns. Readers use the filters to skip
+   * row groups when filtering on equality with a value.
+   *
+   * @param req True = write bloom filters. False = do not write bloom filters
+   * @return this for chaining
+   */
+  column_in_metadata& set_bloom_filter(bool req)
+  {
+    _bloom_filter = req;
+    return *this;
+  }
+
   /**
    * @brief Get reference to a child of this column
    *
@@ -367,6 +426,11 @@ class column_in_metadata {
    */
   [[nodiscard]] bool is_enabled_int96_timestamps() const { return _use_int96_timestamp; }
 
+  /**
+   * @brief Get whether to write bloom filters for this column
+   */
+  [[nodiscard]] bool is_enabled_bloom_filter() const { return _bloom_filter; }
+
   /**
    * @brief Get whether precision has been set for this decimal column
    */
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/copying.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @file ipc_table.hpp
+ * @brief Sharing of tables between the processes of a device through CUDA IPC
+ */
+
+namespace cudf {
+
+/**
+ * @brief A table packed into device memory which other processes can map through CUDA IPC
+ *
+ * The table is packed as by `cudf::pack` into its own `cudaMalloc` allocation, since a CUDA IPC
+ * handle maps a whole allocation. The allocation is freed when this object is destroyed, which
+ * must not happen while other processes have the table imported, as counted by `num_importers`.
+ */
+class ipc_exported_table {
+ public:
+  ipc_exported_table(packed_columns&& packed, rmm::device_buffer&& importers);
+
+  /**
+   * @brief Returns the handle of the table, which `import_ipc` reads in another process
+   *
+   * The handle holds the CUDA IPC memory handles of the table and its `pack_metadata`.
+   */
+  [[nodiscard]] std::vector<uint8_t> const& handle() const { return _handle; }
+
+  /**
+   * @brief Returns the number of imports of the table which are not destroyed yet, in all the
+   * processes
+   */
+  [[nodiscard]] int num_importers() const;
+
+ private:
+  packed_columns _packed;
+  rmm::device_buffer _importers;  ///< Count of the imports, shared by all the processes
+  std::vector<uint8_t> _handle;
+};
+
+/**
+ * @brief A table of another process mapped through CUDA IPC
+ *
+ * The memory of the table is unmapped when this object is destroyed, so the views of the
+ * table must be shared along with the `std::shared_ptr` owning it.
+ */
+class ipc_imported_table {
+ public:
+  explicit ipc_imported_table(host_span<uint8_t const> handle);
+  ~ipc_imported_table();
+
+  ipc_imported_table(ipc_imported_table const&) = delete;
+  ipc_imported_table& operator=(ipc_imported_table const&) = delete;
+
+  /**
+   * @brief Returns the view of the table, which does not copy the memory of the other process
+   */
+  [[nodiscard]] table_view view() const { return _view; }
+
+ private:
+  std::vector<uint8_t> _metadata;
+  void* _importers{};
+  void* _data{};
+  table_view _view;
+};
+
+/**
+ * @brief Packs a table into device memory which other processes can map through CUDA IPC
+ *
+ * @param input The table to export
+ * @return The exported table, whose `handle()` is sent to the importing processes
+ */
+std::unique_ptr<ipc_exported_table> export_ipc(table_view const& input);
+
+/**
+ * @brief Maps in this process the device memory of a table exported by another process
+ *
+ * The table is not copied, and its memory is unmapped when the last reference to the returned
+ * object is released. A process cannot import the tables it exports.
+ *
+ * @throws cudf::logic_error if `handle` is not the handle of an exported table
+ * @throws cudf::cuda_error if the memory of the table cannot be mapped
+ *
+ * @param handle The `handle()` of the exported table
+ * @return The imported table
+ */
+std::shared_ptr<ipc_imported_table> import_ipc(host_span<uint8_t const> handle);
+
+}  // namespace cudf
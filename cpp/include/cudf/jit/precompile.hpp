@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace jit {
+/**
+ * @addtogroup transformation_transform
+ * @{
+ * @file
+ * @brief APIs for compiling the kernels of user-defined functions ahead of time
+ */
+
+/**
+ * @brief The APIs that compile a kernel for a user-defined function.
+ */
+enum class kernel_kind : int32_t {
+  TRANSFORM,        ///< The kernel of `cudf::transform`
+  BINARY_OPERATION  ///< The kernel of `cudf::binary_operation` with a PTX operator
+};
+
+/**
+ * @brief The arguments of an API that select the kernel it compiles.
+ */
+struct kernel_signature {
+  kernel_kind kind;                    ///< The API that launches the kernel
+  std::string udf;                     ///< The PTX or CUDA source of the user-defined function
+  bool is_ptx;                         ///< Whether `udf` is PTX code
+  std::vector<data_type> input_types;  ///< The types of the input columns
+  data_type output_type;               ///< The type of the output column
+};
+
+/**
+ * @brief Compiles the kernels of user-defined functions without launching them.
+ *
+ * Each kernel is compiled for the current device as the API of its `kind` would compile it for
+ * columns of the given types. The kernels are added to the kernel cache of the process and, when
+ * the file cache is enabled, written under `LIBCUDF_KERNEL_CACHE_PATH`, so that the processes that
+ * later launch them load them from the file cache instead of compiling them.
+ *
+ * @throws cudf::logic_error if a `TRANSFORM` signature does not have one fixed-width input type
+ * @throws cudf::logic_error if a `BINARY_OPERATION` signature does not have two input types or
+ * its `udf` is not PTX code
+ *
+ * @param kernels The signatures of the kernels to compile
+ */
+void precompile(std::vector<kernel_signature> const& kernels);
+
+/** @} */  // end of group
+}  // namespace jit
+}  // namespace cudf
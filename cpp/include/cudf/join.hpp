@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,8 @@
 #pragma once
 
 #include <cudf/ast/expressions.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/spill.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/span.hpp>
@@ -24,6 +26,7 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <memory>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -61,6 +64,7 @@ namespace cudf {
  * @param[in] right_keys The right table
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
@@ -72,6 +76,7 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
 inner_join(cudf::table_view const& left_keys,
            cudf::table_view const& right_keys,
            null_equality compare_nulls         = null_equality::EQUAL,
+           rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
            rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -106,6 +111,7 @@ inner_join(cudf::table_view const& left_keys,
  * from `left` indicated by `left_on[i]`.
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return Result of joining `left` and `right` tables on the columns
@@ -117,6 +123,7 @@ std::unique_ptr<cudf::table> inner_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -146,6 +153,7 @@ std::unique_ptr<cudf::table> inner_join(
  * @param[in] right_keys The right table
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
@@ -157,6 +165,7 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
 left_join(cudf::table_view const& left_keys,
           cudf::table_view const& right_keys,
           null_equality compare_nulls         = null_equality::EQUAL,
+          rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
           rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -199,6 +208,7 @@ left_join(cudf::table_view const& left_keys,
  * from `left` indicated by `left_on[i]`.
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return Result of joining `left` and `right` tables on the columns
@@ -210,6 +220,7 @@ std::unique_ptr<cudf::table> left_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -238,6 +249,7 @@ std::unique_ptr<cudf::table> left_join(
  * @param[in] right_keys The right table
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
@@ -249,6 +261,7 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
 full_join(cudf::table_view const& left_keys,
           cudf::table_view const& right_keys,
           null_equality compare_nulls         = null_equality::EQUAL,
+          rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
           rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -291,6 +304,7 @@ full_join(cudf::table_view const& left_keys,
  * from `left` indicated by `left_on[i]`.
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return Result of joining `left` and `right` tables on the columns
@@ -302,6 +316,7 @@ std::unique_ptr<cudf::table> full_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -325,6 +340,7 @@ std::unique_ptr<cudf::table> full_join(
  * @param[in] right_keys The right table
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return A vector `left_indices` that can be used to construct
@@ -335,6 +351,7 @@ std::unique_ptr<rmm::device_uvector<size_type>> left_semi_join(
   cudf::table_view const& left_keys,
   cudf::table_view const& right_keys,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -371,6 +388,7 @@ std::unique_ptr<rmm::device_uvector<size_type>> left_semi_join(
  *                             will be compared against the column from `left`
  *                             indicated by `left_on[i]`.
  * @param[in] compare_nulls    Controls whether null join-key values should match or not.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr               Device memory resource used to allocate the returned table's
  *                             device memory
  *
@@ -383,6 +401,7 @@ std::unique_ptr<cudf::table> left_semi_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -404,6 +423,7 @@ std::unique_ptr<cudf::table> left_semi_join(
  * @param[in] right_keys The right table
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return A column `left_indices` that can be used to construct
@@ -414,6 +434,7 @@ std::unique_ptr<rmm::device_uvector<size_type>> left_anti_join(
   cudf::table_view const& left_keys,
   cudf::table_view const& right_keys,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -453,6 +474,7 @@ std::unique_ptr<rmm::device_uvector<size_type>> left_anti_join(
  *                             will be compared against the column from `left`
  *                             indicated by `left_on[i]`.
  * @param[in] compare_nulls    Controls whether null join-key values should match or not.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr               Device memory resource used to allocate the returned table's
  *                             device memory
  *
@@ -465,6 +487,7 @@ std::unique_ptr<cudf::table> left_anti_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -485,6 +508,7 @@ std::unique_ptr<cudf::table> left_anti_join(
  *
  * @param left  The left table
  * @param right The right table
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr    Device memory resource used to allocate the returned table's device memory
  *
  * @return     Result of cross joining `left` and `right` tables
@@ -492,6 +516,238 @@ std::unique_ptr<cudf::table> left_anti_join(
 std::unique_ptr<cudf::table> cross_join(
   cudf::table_view const& left,
   cudf::table_view const& right,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner join between the specified
+ * tables, whose rows are sorted.
+ *
+ * Instead of building a hash table, the rows of `right_keys` equal to each row of `left_keys` are
+ * located by binary searches in `right_keys`, which are then expanded into output rows in order.
+ * For large sorted inputs, e.g. the output of `cudf::merge` or sorted files, this avoids the
+ * random memory accesses of hashing. The output is ordered by left index, and by right index
+ * within the rows of the same left index.
+ *
+ * Whether both tables are sorted in the given order is checked with `cudf::is_sorted`; when either
+ * is not, the join falls back to `cudf::inner_join`, and the order of the output is unspecified.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 1, 2}}
+ * Right: {{1, 1, 2, 3}}
+ * Result: {{1, 1, 2, 2, 3}, {0, 1, 0, 1, 2}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the number of columns in either table is 0, or if the tables differ
+ * in number of columns.
+ *
+ * @param left_keys The left table
+ * @param right_keys The right table
+ * @param column_order The desired order for each key column. Size must be equal to
+ * `left_keys.num_columns()` or empty. If empty, all columns are sorted in ascending order.
+ * @param null_precedence The desired order of a null element compared to other elements for each
+ * key column. Size must be equal to `left_keys.num_columns()` or empty. If empty, null elements
+ * are ordered before the other elements.
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param mr Device memory resource used to allocate the returned vectors' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing an inner join between two tables with `left_keys` and `right_keys`
+ * as the join keys.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_inner_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  null_equality compare_nulls                    = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to a left join between the specified
+ * tables, whose rows are sorted.
+ *
+ * Like `sort_merge_inner_join`, but every row of `left_keys` is in the output. The right index of
+ * the rows without a match is an unspecified out-of-bounds value. When either table is not sorted,
+ * the join falls back to `cudf::left_join`.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 1, 2}}
+ * Right: {{1, 1, 2, 3}}
+ * Result: {{0, 1, 1, 2, 2, 3}, {None, 0, 1, 0, 1, 2}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the number of columns in either table is 0, or if the tables differ
+ * in number of columns.
+ *
+ * @param left_keys The left table
+ * @param right_keys The right table
+ * @param column_order The desired order for each key column. Size must be equal to
+ * `left_keys.num_columns()` or empty. If empty, all columns are sorted in ascending order.
+ * @param null_precedence The desired order of a null element compared to other elements for each
+ * key column. Size must be equal to `left_keys.num_columns()` or empty. If empty, null elements
+ * are ordered before the other elements.
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param mr Device memory resource used to allocate the returned vectors' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a left join between two tables with `left_keys` and `right_keys`
+ * as the join keys.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_left_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  null_equality compare_nulls                    = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Result of a join kept as the gather maps of both tables, from which the columns of the
+ * joined table are gathered on request.
+ *
+ * The gather maps can be passed on to operations that take row indices without materializing any
+ * column. `materialize` gathers the selected columns of both tables in a single pass: the
+ * fixed-width columns of both sides are gathered together by one kernel that reads each gather
+ * map once per row, and the other columns are gathered with `cudf::gather`.
+ *
+ * The tables are not copied, and must outlive the result.
+ */
+class join_result {
+ public:
+  /**
+   * @brief Constructs the result of a join from its gather maps.
+   *
+   * @throw cudf::logic_error if the gather maps differ in size.
+   *
+   * @param left The left table of the join
+   * @param right The right table of the join
+   * @param left_indices The rows of `left` of each output row
+   * @param right_indices The rows of `right` of each output row
+   * @param bounds_policy Whether out-of-bounds indices, marking the rows of an outer join
+   * without a match, are gathered as nulls
+   */
+  join_result(cudf::table_view left,
+              cudf::table_view right,
+              std::unique_ptr<rmm::device_uvector<size_type>> left_indices,
+              std::unique_ptr<rmm::device_uvector<size_type>> right_indices,
+              out_of_bounds_policy bounds_policy);
+
+  /**
+   * @brief Returns the number of rows of the joined table.
+   */
+  [[nodiscard]] std::size_t size() const { return _left_indices->size(); }
+
+  /**
+   * @brief Returns the rows of the left table of each output row.
+   */
+  [[nodiscard]] cudf::device_span<size_type const> left_indices() const { return *_left_indices; }
+
+  /**
+   * @brief Returns the rows of the right table of each output row.
+   */
+  [[nodiscard]] cudf::device_span<size_type const> right_indices() const
+  {
+    return *_right_indices;
+  }
+
+  /**
+   * @brief Releases the gather maps of the result.
+   *
+   * @return A pair of vectors [`left_indices`, `right_indices`]
+   */
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  release();
+
+  /**
+   * @brief Gathers the selected columns of both tables.
+   *
+   * @throw std::out_of_range if a column index is out of range.
+   *
+   * @param left_columns The columns of the left table to gather
+   * @param right_columns The columns of the right table to gather
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   *
+   * @return The selected columns of the left table, followed by the selected columns of the
+   * right table
+   */
+  [[nodiscard]] std::unique_ptr<cudf::table> materialize(
+    std::vector<size_type> const& left_columns,
+    std::vector<size_type> const& right_columns,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  cudf::table_view _left;
+  cudf::table_view _right;
+  std::unique_ptr<rmm::device_uvector<size_type>> _left_indices;
+  std::unique_ptr<rmm::device_uvector<size_type>> _right_indices;
+  out_of_bounds_policy _bounds_policy;
+};
+
+/**
+ * @brief Performs an inner join on the specified columns of two tables (`left`, `right`), and
+ * returns the gather maps of the result without gathering any column.
+ *
+ * @throw cudf::logic_error if number of elements in `left_on` or `right_on` mismatch.
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param left_on The column indices from `left` to join on
+ * @param right_on The column indices from `right` to join on
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the gather maps' device memory
+ *
+ * @return The result of the join, which refers to `left` and `right`
+ */
+join_result lazy_inner_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Performs a left join on the specified columns of two tables (`left`, `right`), and
+ * returns the gather maps of the result without gathering any column.
+ *
+ * The right columns of the left rows without a match are materialized as nulls.
+ *
+ * @copydetails lazy_inner_join
+ */
+join_result lazy_left_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Performs a full join on the specified columns of two tables (`left`, `right`), and
+ * returns the gather maps of the result without gathering any column.
+ *
+ * The columns of the other table of the rows without a match are materialized as nulls.
+ *
+ * @copydetails lazy_inner_join
+ */
+join_result lazy_full_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -500,6 +756,11 @@ std::unique_ptr<cudf::table> cross_join(
  *
  * This class enables the hash join scheme that builds hash table once, and probes as many times as
  * needed (possibly in parallel).
+ *
+ * The second probe without an `output_size` checks whether the keys of the build table are unique,
+ * as they are for the primary keys of a dimension table. When they are, that and all the later
+ * probes size their output from the number of probe rows, instead of counting the matches first.
+ * A hash join probed only once, as by the `inner_join` and `left_join` functions, never checks.
  */
 class hash_join {
  public:
@@ -652,6 +913,273 @@ class hash_join {
   const std::unique_ptr<const hash_join_impl> impl;
 };
 
+/**
+ * @brief Hash table of the rows of a table, built once for repeated semi joins, anti joins and
+ * membership tests against that table.
+ *
+ * The probes do not modify the hash table, so they may run concurrently on different streams.
+ * The hash table is built on the stream passed to the constructor; probes on other streams must be
+ * ordered after the construction, e.g. by synchronizing that stream.
+ */
+class semi_join_hash_table {
+ public:
+  semi_join_hash_table() = delete;
+  ~semi_join_hash_table();
+  semi_join_hash_table(semi_join_hash_table const&) = delete;
+  semi_join_hash_table(semi_join_hash_table&&)      = delete;
+  semi_join_hash_table& operator=(semi_join_hash_table const&) = delete;
+  semi_join_hash_table& operator=(semi_join_hash_table&&) = delete;
+
+  /**
+   * @brief Constructs a hash table of the rows of `build` for subsequent probe calls.
+   *
+   * @note The `semi_join_hash_table` object must not outlive the table viewed by `build`, else
+   * behavior is undefined.
+   *
+   * @throw cudf::logic_error if the number of columns in `build` table is 0.
+   *
+   * @param build The table of the rows that probe rows are looked up in.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  semi_join_hash_table(cudf::table_view const& build,
+                       null_equality compare_nulls  = null_equality::EQUAL,
+                       rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Returns the indices of the rows of `probe` that are in the hash table.
+   * @see cudf::left_semi_join().
+   *
+   * @throw cudf::logic_error if `probe` and the build table differ in number of columns.
+   *
+   * @param probe The probe table, which has the same columns as the build table.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned vector's device memory
+   * @return A vector of the indices of the rows of `probe` that have a match in the build table
+   */
+  std::unique_ptr<rmm::device_uvector<size_type>> left_semi_join(
+    cudf::table_view const& probe,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the indices of the rows of `probe` that are not in the hash table.
+   * @see cudf::left_anti_join().
+   *
+   * @throw cudf::logic_error if `probe` and the build table differ in number of columns.
+   *
+   * @param probe The probe table, which has the same columns as the build table.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned vector's device memory
+   * @return A vector of the indices of the rows of `probe` without a match in the build table
+   */
+  std::unique_ptr<rmm::device_uvector<size_type>> left_anti_join(
+    cudf::table_view const& probe,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns whether each row of `probe` is in the hash table.
+   *
+   * @throw cudf::logic_error if `probe` and the build table differ in number of columns.
+   *
+   * @param probe The probe table, which has the same columns as the build table.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A BOOL8 column without nulls, true for the rows of `probe` that have a match in the
+   * build table
+   */
+  std::unique_ptr<column> contains(
+    cudf::table_view const& probe,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  struct semi_join_hash_table_impl;
+  const std::unique_ptr<const semi_join_hash_table_impl> impl;
+};
+
+/**
+ * @brief Side of a join that a partition of a `partitioned_hash_join` belongs to.
+ */
+enum class join_side : bool {
+  BUILD,  ///< Rows of the build table
+  PROBE   ///< Rows of the probe table
+};
+
+/**
+ * @brief Storage for the partitions of a `partitioned_hash_join` until they are joined.
+ *
+ * Each partition is stored as a sequence of chunks in the serialized format of `cudf::pack`, one
+ * per table added to the join. Implementations decide where the chunks are kept while the other
+ * partitions are joined, e.g. in host memory or in files.
+ */
+class join_partition_store {
+ public:
+  virtual ~join_partition_store() = default;
+
+  /**
+   * @brief Stores a chunk of a partition.
+   *
+   * @param side Side of the join the chunk belongs to
+   * @param partition Index of the partition
+   * @param chunk Rows of the chunk, in device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  virtual void store(join_side side,
+                     size_type partition,
+                     packed_columns&& chunk,
+                     rmm::cuda_stream_view stream) = 0;
+
+  /**
+   * @brief Returns the chunks stored for a partition, in device memory, and removes them from the
+   * store.
+   *
+   * @param side Side of the join the chunks belong to
+   * @param partition Index of the partition
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned chunks' device memory
+   * @return The chunks of the partition, in the order they were stored
+   */
+  virtual std::vector<packed_columns> retrieve(join_side side,
+                                               size_type partition,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr) = 0;
+};
+
+/**
+ * @brief Creates a partition store that keeps the chunks in pinned host memory.
+ *
+ * @return The partition store
+ */
+std::unique_ptr<join_partition_store> make_host_join_partition_store();
+
+/**
+ * @brief Creates a partition store that keeps the chunks as `spillable_table`s of a manager.
+ *
+ * The chunks stay in device memory until the manager spills them, so that the partitions are only
+ * copied to host memory and back when device memory runs low.
+ *
+ * @param manager The manager that may spill the chunks; it must outlive the store
+ * @return The partition store
+ */
+std::unique_ptr<join_partition_store> make_spilling_join_partition_store(spill_manager& manager);
+
+/**
+ * @brief Hash join of tables that do not fit in device memory together with their hash table.
+ *
+ * The build and probe tables are added in chunks, each of which is hash partitioned on its join
+ * keys and moved out of device memory through a `join_partition_store`. Rows with equal keys land
+ * in partitions of the same index, so the join is computed one partition at a time, and only the
+ * two sides of a single partition, and the hash table of its build side, are in device memory at
+ * once. The number of partitions should be chosen so that this is the case; keys with many
+ * duplicates can make some partitions much larger than the others.
+ *
+ * The result of joining a partition holds the columns of the probe table followed by the columns
+ * of the build table, like the result of `cudf::left_join` with the probe table on the left.
+ *
+ * @code{.pseudo}
+ * partitioned_hash_join join(num_partitions, {0}, {0});
+ * for (auto const& chunk : build_chunks) join.add_build(chunk);
+ * for (auto const& chunk : probe_chunks) join.add_probe(chunk);
+ * for (size_type p = 0; p < join.num_partitions(); ++p) write(join.inner_join(p)->view());
+ * @endcode
+ */
+class partitioned_hash_join {
+ public:
+  partitioned_hash_join() = delete;
+  ~partitioned_hash_join();
+  partitioned_hash_join(partitioned_hash_join const&) = delete;
+  partitioned_hash_join(partitioned_hash_join&&)      = delete;
+  partitioned_hash_join& operator=(partitioned_hash_join const&) = delete;
+  partitioned_hash_join& operator=(partitioned_hash_join&&) = delete;
+
+  /**
+   * @brief Constructs a join whose tables are added in later calls.
+   *
+   * @throw cudf::logic_error if `num_partitions` is not positive
+   * @throw cudf::logic_error if `build_on` and `probe_on` are empty or differ in size
+   *
+   * @param num_partitions Number of partitions to split both tables into
+   * @param build_on The column indices of the build table to join on
+   * @param probe_on The column indices of the probe table to join on
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param store Storage for the partitions until they are joined
+   */
+  partitioned_hash_join(
+    size_type num_partitions,
+    std::vector<size_type> build_on,
+    std::vector<size_type> probe_on,
+    null_equality compare_nulls                 = null_equality::EQUAL,
+    std::unique_ptr<join_partition_store> store = make_host_join_partition_store());
+
+  /**
+   * @brief Partitions a chunk of the build table and moves it to the partition store.
+   *
+   * @param build Rows of the build table; all chunks must have the same columns
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void add_build(cudf::table_view const& build,
+                 rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Partitions a chunk of the probe table and moves it to the partition store.
+   *
+   * @param probe Rows of the probe table; all chunks must have the same columns
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void add_probe(cudf::table_view const& probe,
+                 rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Returns the number of partitions the tables are split into.
+   */
+  [[nodiscard]] size_type num_partitions() const;
+
+  /**
+   * @brief Performs an inner join of a partition of the tables. @see cudf::inner_join().
+   *
+   * The partition is removed from the store, so each partition can be joined only once.
+   *
+   * @throw cudf::logic_error if no chunk of either table was added
+   * @throw std::out_of_range if `partition` is not a valid partition index
+   *
+   * @param partition Index of the partition to join
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   * @return Result of joining the partition of the probe table with that of the build table
+   */
+  std::unique_ptr<cudf::table> inner_join(
+    size_type partition,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Performs a left join of a partition of the tables, keeping all the rows of the probe
+   * table. @see cudf::left_join().
+   *
+   * @copydetails inner_join
+   */
+  std::unique_ptr<cudf::table> left_join(
+    size_type partition,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Performs a full join of a partition of the tables. @see cudf::full_join().
+   *
+   * @copydetails inner_join
+   */
+  std::unique_ptr<cudf::table> full_join(
+    size_type partition,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+ private:
+  struct partitioned_hash_join_impl;
+  const std::unique_ptr<partitioned_hash_join_impl> impl;
+};
+
 /**
  * @brief Returns a pair of row index vectors corresponding to all pairs
  * of rows between the specified tables where the predicate evaluates to true.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -75,5 +75,44 @@ std::unique_ptr<column> label_bins(
   inclusive right_inclusive,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief One-hot encodes elements by their membership in the specified bins, as sparse indices.
+ *
+ * Fuses `label_bins` with the one-hot encoding of its labels: the output is the compressed sparse
+ * row (CSR) form of the 0/1 matrix having a row per element of `input` and a column per bin. It
+ * is a lists column with one list per element of `input`, holding the index of the bin of the
+ * element, or empty if the element belongs to no bin. The list offsets are the row pointers and
+ * the child column the column indices, so no dense column per bin is materialized.
+ *
+ * Bin membership follows `label_bins`, with the same requirements on the edges.
+ *
+ * @code{.pseudo}
+ * input: {1, 5, NULL, 12, 7}
+ * left_edges: {0, 5}, right_edges: {5, 10}
+ * left_inclusive: YES, right_inclusive: NO
+ * output: [{0}, {1}, {}, {}, {1}]
+ * @endcode
+ *
+ * @throws cudf::logic_error if `input.type() == left_edges.type() == right_edges.type()` is
+ * violated.
+ * @throws cudf::logic_error if `left_edges.size() != right_edges.size()`
+ * @throws cudf::logic_error if `left_edges.has_nulls()` or `right_edges.has_nulls()`
+ *
+ * @param input The input elements to encode according to the specified bins.
+ * @param left_edges Values of the left edge of each bin.
+ * @param left_inclusive Whether or not the left edge is inclusive.
+ * @param right_edges Value of the right edge of each bin.
+ * @param right_inclusive Whether or not the right edge is inclusive.
+ * @param mr Device memory resource used to allocate the returned column's device.
+ * @return A LIST column of INT32 bin indices, one list per element of `input`.
+ */
+std::unique_ptr<column> one_hot_encode_bins(
+  column_view const& input,
+  column_view const& left_edges,
+  inclusive left_inclusive,
+  column_view const& right_edges,
+  inclusive right_inclusive,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -26,6 +26,20 @@ namespace lists {
  * @file
  */
 
+/**
+ * @brief Option to choose how the list search operations look for the search keys in the list
+ * rows
+ */
+enum class search_strategy : int32_t {
+  LINEAR_SCAN = 0,  ///< Scans each list row, with a whole warp for each row when the lists are
+                    ///< long on average.
+  BINARY_SEARCH,    ///< Binary searches each list row. The valid elements of each list row must
+                    ///< be sorted in ascending or descending order, and its nulls must be at one
+                    ///< of its ends.
+  HASH_TABLE        ///< Probes the search keys against a hash set of the elements of each list
+                    ///< row, which balances the work of lists of very different lengths.
+};
+
 /**
  * @brief Create a column of `bool` values indicating whether the specified scalar
  * is an element of each row of a list column.
@@ -42,12 +56,14 @@ namespace lists {
  *
  * @param lists Lists column whose `n` rows are to be searched
  * @param search_key The scalar key to be looked up in each list row
+ * @param strategy How to look for the search key in the list rows
  * @param mr Device memory resource used to allocate the returned column's device memory.
  * @return std::unique_ptr<column> BOOL8 column of `n` rows with the result of the lookup
  */
 std::unique_ptr<column> contains(
   cudf::lists_column_view const& lists,
   cudf::scalar const& search_key,
+  search_strategy strategy            = search_strategy::LINEAR_SCAN,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -66,12 +82,14 @@ std::unique_ptr<column> contains(
  *
  * @param lists Lists column whose `n` rows are to be searched
  * @param search_keys Column of elements to be looked up in each list row
+ * @param strategy How to look for the search keys in the list rows
  * @param mr Device memory resource used to allocate the returned column's device memory.
  * @return std::unique_ptr<column> BOOL8 column of `n` rows with the result of the lookup
  */
 std::unique_ptr<column> contains(
   cudf::lists_column_view const& lists,
   cudf::column_view const& search_keys,
+  search_strategy strategy            = search_strategy::LINEAR_SCAN,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -123,6 +141,7 @@ enum class duplicate_find_option : int32_t {
  * @param search_key The scalar key to be looked up in each list row
  * @param find_option Whether to return the position of the first match (`FIND_FIRST`) or
  * last (`FIND_LAST`)
+ * @param strategy How to look for the search key in the list rows
  * @param mr Device memory resource used to allocate the returned column's device memory.
  * @return std::unique_ptr<column> INT32 column of `n` rows with the location of the `search_key`
  *
@@ -134,6 +153,7 @@ std::unique_ptr<column> index_of(
   cudf::lists_column_view const& lists,
   cudf::scalar const& search_key,
   duplicate_find_option find_option   = duplicate_find_option::FIND_FIRST,
+  search_strategy strategy            = search_strategy::LINEAR_SCAN,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -159,6 +179,7 @@ std::unique_ptr<column> index_of(
  * `lists`
  * @param find_option Whether to return the position of the first match (`FIND_FIRST`) or
  * last (`FIND_LAST`)
+ * @param strategy How to look for the search keys in the list rows
  * @param mr Device memory resource used to allocate the returned column's device memory.
  * @return std::unique_ptr<column> INT32 column of `n` rows with the location of the `search_key`
  *
@@ -170,6 +191,7 @@ std::unique_ptr<column> index_of(
   cudf::lists_column_view const& lists,
   cudf::column_view const& search_keys,
   duplicate_find_option find_option   = duplicate_find_option::FIND_FIRST,
+  search_strategy strategy            = search_strategy::LINEAR_SCAN,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /** @} */  // end of group
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+namespace cudf {
+namespace lists {
+/**
+ * @addtogroup lists_set_operations
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Create a new lists column by copying the distinct elements of each list of the input,
+ * in the order of their first occurrence.
+ *
+ * Unlike `drop_list_duplicates`, the elements are not sorted: each list entry is hashed together
+ * with the index of its list, so that the distinct elements of all the lists are found with a
+ * single hash table in linear time.
+ *
+ * @throw cudf::logic_error If the child column of the input lists column contains nested type other
+ *        than STRUCT.
+ *
+ * @code{.pseudo}
+ * input  = { {1, 1, 2, 3}, {4}, NULL, {}, {NULL, NULL, NULL, 5, 6, 6, 6, 5} }
+ * distinct(input) = { {1, 2, 3}, {4}, NULL, {}, {NULL, 5, 6} }
+ * @endcode
+ *
+ * @param input The input lists column
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal
+ * @param nans_equal Flag to specify whether floating-point NaNs should be considered as equal
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The lists of the distinct elements of the input lists
+ */
+std::unique_ptr<column> distinct(
+  lists_column_view const& input,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  nan_equality nans_equal             = nan_equality::ALL_EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Check if the lists at each row of the given lists columns overlap.
+ *
+ * Output `column[i]` is true if the lists `lhs[i]` and `rhs[i]` have at least one equal element,
+ * and null if either of them is null.
+ *
+ * @throw cudf::logic_error If the input columns have different sizes or element types, or their
+ *        elements are of nested type other than STRUCT.
+ *
+ * @code{.pseudo}
+ * lhs    = { {0, 1, 2}, {1, 2}, {3},  NULL, {} }
+ * rhs    = { {1, 4},    {3},    {},   {1},  {5} }
+ * result = { true,      false,  false, NULL, false }
+ * @endcode
+ *
+ * @param lhs The input lists column for one side
+ * @param rhs The input lists column for the other side
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal
+ * @param nans_equal Flag to specify whether floating-point NaNs should be considered as equal
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A column of BOOL8 type indicating whether the lists of each row overlap
+ */
+std::unique_ptr<column> have_overlap(
+  lists_column_view const& lhs,
+  lists_column_view const& rhs,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  nan_equality nans_equal             = nan_equality::ALL_EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a lists column of the distinct elements of each list of `lhs` that are also in
+ * the list of the same row of `rhs`.
+ *
+ * The elements keep the order of their first occurrence in `lhs`. A row of the output is null, and
+ * empty, if either of the input rows is null.
+ *
+ * @throw cudf::logic_error If the input columns have different sizes or element types, or their
+ *        elements are of nested type other than STRUCT.
+ *
+ * @code{.pseudo}
+ * lhs    = { {2, 1, 2}, {1, 2}, {3},  NULL, {} }
+ * rhs    = { {1, 2, 4}, {3},    {},   {1},  {5} }
+ * result = { {2, 1},    {},     {},   NULL, {} }
+ * @endcode
+ *
+ * @param lhs The input lists column for one side
+ * @param rhs The input lists column for the other side
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal
+ * @param nans_equal Flag to specify whether floating-point NaNs should be considered as equal
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The lists of the intersections of the input lists
+ */
+std::unique_ptr<column> intersect_distinct(
+  lists_column_view const& lhs,
+  lists_column_view const& rhs,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  nan_equality nans_equal             = nan_equality::ALL_EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a lists column of the distinct elements of the lists of each row of `lhs` and
+ * `rhs`.
+ *
+ * The distinct elements of `lhs[i]` come first, then those of `rhs[i]` that are not in `lhs[i]`,
+ * each in the order of their first occurrence. A row of the output is null, and empty, if either of
+ * the input rows is null.
+ *
+ * @throw cudf::logic_error If the input columns have different sizes or element types, or their
+ *        elements are of nested type other than STRUCT.
+ *
+ * @code{.pseudo}
+ * lhs    = { {2, 1, 2},    {1, 2},    {3}, NULL, {} }
+ * rhs    = { {1, 2, 4},    {3},       {},  {1},  {5} }
+ * result = { {2, 1, 4},    {1, 2, 3}, {3}, NULL, {5} }
+ * @endcode
+ *
+ * @param lhs The input lists column for one side
+ * @param rhs The input lists column for the other side
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal
+ * @param nans_equal Flag to specify whether floating-point NaNs should be considered as equal
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The lists of the unions of the input lists
+ */
+std::unique_ptr<column> union_distinct(
+  lists_column_view const& lhs,
+  lists_column_view const& rhs,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  nan_equality nans_equal             = nan_equality::ALL_EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a lists column of the distinct elements of each list of `lhs` that are not in the
+ * list of the same row of `rhs`.
+ *
+ * The elements keep the order of their first occurrence in `lhs`. A row of the output is null, and
+ * empty, if either of the input rows is null.
+ *
+ * @throw cudf::logic_error If the input columns have different sizes or element types, or their
+ *        elements are of nested type other than STRUCT.
+ *
+ * @code{.pseudo}
+ * lhs    = { {2, 1, 2}, {1, 2}, {3},  NULL, {} }
+ * rhs    = { {1, 4},    {3},    {},   {1},  {5} }
+ * result = { {2},       {1, 2}, {3},  NULL, {} }
+ * @endcode
+ *
+ * @param lhs The input lists column of the elements to keep
+ * @param rhs The input lists column of the elements to remove
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal
+ * @param nans_equal Flag to specify whether floating-point NaNs should be considered as equal
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The lists of the differences of the input lists
+ */
+std::unique_ptr<column> difference_distinct(
+  lists_column_view const& lhs,
+  lists_column_view const& rhs,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  nan_equality nans_equal             = nan_equality::ALL_EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace lists
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -59,6 +59,31 @@ std::unique_ptr<column> quantile(
   bool exact                          = true,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes quantiles of an unsorted column with interpolation, without sorting it.
+ *
+ * Returns the same values as `quantile` given the sorted order of the valid elements of `input`.
+ * The values that the quantiles interpolate between are selected by radix: each pass over
+ * `input` counts the next 8 bits of the values matching the bits selected so far, for all the
+ * quantiles at once, so that `input` is read `sizeof` its element type times instead of being
+ * sorted. Null elements are ignored, and NaNs are ordered after all the other values.
+ *
+ * @throws cudf::logic_error if `input` is not a numeric or fixed-point column.
+ *
+ * @param input  Column from which to compute quantile values.
+ * @param q      Specified quantiles in range [0, 1].
+ * @param interp Strategy used to select between values adjacent to a specified quantile.
+ * @param exact  If true, returns doubles. If false, returns same type as input.
+ * @param mr     Device memory resource used to allocate the returned column's device memory
+ * @returns Column of specified quantiles, all null if `input` has no valid elements.
+ */
+std::unique_ptr<column> unsorted_quantile(
+  column_view const& input,
+  std::vector<double> const& q,
+  interpolation interp                = interpolation::LINEAR,
+  bool exact                          = true,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns the rows of the input corresponding to the requested quantiles.
  *
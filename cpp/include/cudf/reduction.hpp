@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,9 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <vector>
 
 namespace cudf {
 /**
@@ -69,6 +72,27 @@ std::unique_ptr<scalar> reduce(
   data_type output_dtype,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes several reductions of each column of a table.
+ *
+ * The output type of each reduction is the one of the matching groupby aggregation, e.g.
+ * `INT64` for the `sum` of an `INT32` column and `FLOAT64` for its `mean`. The `sum`,
+ * `sum_of_squares`, `min`, `max`, `mean`, `var` and `std` reductions of an arithmetic column are
+ * computed in a single pass over the column, and their results are copied back to the host
+ * together, instead of once per reduction. The other reductions are computed as by `reduce`.
+ *
+ * @throw cudf::logic_error if an aggregation is not supported for the type of a column.
+ *
+ * @param input Input table
+ * @param aggs Aggregation operators applied to each column
+ * @param mr Device memory resource used to allocate the returned scalars' device memory
+ * @returns The result of `aggs[j]` on column `i` of `input` at `[i][j]`
+ */
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce(
+  table_view const& input,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief  Computes the scan of a column.
  *
@@ -94,6 +118,42 @@ std::unique_ptr<column> scan(
   null_policy null_handling           = null_policy::EXCLUDE,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the inclusive scan of each segment of a column.
+ *
+ * The segments are the contiguous ranges of rows starting at the offsets of `segment_offsets`,
+ * e.g. the groups of a column sorted or grouped by its keys. The first row always starts a
+ * segment. All the segments are scanned in a single pass, without the group labels of a groupby
+ * scan.
+ *
+ * `sum`, `min`, `max` and `product` scans apply to fixed-width columns, and their output has the
+ * type of `input`. With null_policy::EXCLUDE, the null values are skipped and the output element
+ * at `i` is null if the input element at `i` is; with null_policy::INCLUDE, a null value makes
+ * the rest of its segment null. `rank` and `dense_rank` scans return the `INT32` rank of each row
+ * within its segment, whose rows must be sorted, and compare the nulls as equal.
+ *
+ * If `segment_offsets` contains values larger than the number of rows, behavior is undefined.
+ *
+ * @throws cudf::logic_error if `segment_offsets` is not a `size_type` column.
+ * @throws cudf::logic_error if `agg` is not a `sum`, `min`, `max`, `product`, `rank` or
+ * `dense_rank` aggregation, or is not supported for the type of `input`.
+ *
+ * @param input The input column view for the scan
+ * @param segment_offsets The column of `size_type` type containing start offset index for each
+ * contiguous segment
+ * @param agg unique_ptr to aggregation operator applied by the scan
+ * @param null_handling Exclude null values when computing the result if null_policy::EXCLUDE.
+ * Include nulls if null_policy::INCLUDE.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @returns unique pointer to new output column
+ */
+std::unique_ptr<column> segmented_scan(
+  column_view const& input,
+  column_view const& segment_offsets,
+  std::unique_ptr<aggregation> const& agg,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Determines the minimum and maximum values of a column.
  *
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,7 +17,10 @@
 #pragma once
 
 #include <cudf/types.hpp>
+
+#include <functional>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 /**
@@ -69,6 +72,30 @@ std::unique_ptr<column> replace_nulls(
   scalar const& replacement,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Replaces all null values in each column of a table with a scalar.
+ *
+ * If `input.column(j)[i]` is NULL, then `output.column(j)[i]` will contain `replacements[j]`.
+ * `input.column(j)` and `replacements[j]` must have the same type.
+ *
+ * The fixed-width columns are processed together, with one kernel launch per element size, so
+ * that cleaning a wide table does not cost a launch and a synchronization per column. The other
+ * columns are processed as by `replace_nulls(column_view const&, scalar const&)`.
+ *
+ * @throws cudf::logic_error if the number of replacements differs from the number of columns
+ * @throws cudf::logic_error if the type of a column and its replacement differ
+ *
+ * @param[in] input A table whose null values will be replaced
+ * @param[in] replacements The scalars used to replace the null values of each column of `input`
+ * @param[in] mr Device memory resource used to allocate device memory of the returned table.
+ *
+ * @returns Copy of `input` with the null values of each column replaced by its replacement.
+ */
+std::unique_ptr<table> replace_nulls(
+  table_view const& input,
+  std::vector<std::reference_wrapper<scalar const>> const& replacements,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Replaces all null values in a column with the first non-null value that precedes/follows.
  *
@@ -251,6 +278,61 @@ std::unique_ptr<column> clamp(
   scalar const& hi,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Clamps each column of a table, as by `clamp(column_view const&, scalar const&, scalar
+ * const&, scalar const&, scalar const&)` with the limit and replace scalars of the column.
+ *
+ * The fixed-width columns are processed together, with one kernel launch per type, so that
+ * clamping a wide table does not cost a launch and a synchronization per column. The limits
+ * are read on the device, and the validity of all the scalars is checked with a single copy to
+ * the host.
+ *
+ * @throws cudf::logic_error if the number of scalars of `lo`, `lo_replace`, `hi` or
+ * `hi_replace` differs from the number of columns
+ * @throws cudf::logic_error if the types of the scalars of a column differ from each other or
+ * from the type of the column
+ * @throws cudf::logic_error if `lo[j]` is valid and `lo_replace[j]` is not, or if `hi[j]` is
+ * valid and `hi_replace[j]` is not
+ *
+ * @param[in] input Table whose columns will be clamped
+ * @param[in] lo Minimum clamp values of the columns. Ignored if null.
+ * @param[in] lo_replace Values replacing the elements less than `lo` in each column.
+ * @param[in] hi Maximum clamp values of the columns. Ignored if null.
+ * @param[in] hi_replace Values replacing the elements greater than `hi` in each column.
+ * @param[in] mr Device memory resource used to allocate device memory of the returned table.
+ *
+ * @return Returns a table of the clamped columns
+ */
+std::unique_ptr<table> clamp(
+  table_view const& input,
+  std::vector<std::reference_wrapper<scalar const>> const& lo,
+  std::vector<std::reference_wrapper<scalar const>> const& lo_replace,
+  std::vector<std::reference_wrapper<scalar const>> const& hi,
+  std::vector<std::reference_wrapper<scalar const>> const& hi_replace,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Clamps each column of a table at its `lo` and `hi` limits, as by `clamp(column_view
+ * const&, scalar const&, scalar const&)`.
+ *
+ * @throws cudf::logic_error if the number of scalars of `lo` or `hi` differs from the number of
+ * columns
+ * @throws cudf::logic_error if the types of the limits of a column differ from each other or
+ * from the type of the column
+ *
+ * @param[in] input Table whose columns will be clamped
+ * @param[in] lo Minimum clamp values of the columns. Ignored if null.
+ * @param[in] hi Maximum clamp values of the columns. Ignored if null.
+ * @param[in] mr Device memory resource used to allocate device memory of the returned table.
+ *
+ * @return Returns a table of the clamped columns
+ */
+std::unique_ptr<table> clamp(
+  table_view const& input,
+  std::vector<std::reference_wrapper<scalar const>> const& lo,
+  std::vector<std::reference_wrapper<scalar const>> const& hi,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Copies from a column of floating-point elements and replaces `-NaN` and `-0.0` with `+NaN`
  * and `+0.0`, respectively.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,12 +16,18 @@
 
 #pragma once
 
+#include <cudf/aggregation.hpp>
 #include <cudf/rolling/range_window_bounds.hpp>
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
+namespace ast {
+struct expression;
+}  // namespace ast
+
 /**
  * @addtogroup aggregation_rolling
  * @{
@@ -89,6 +95,66 @@ std::unique_ptr<column> rolling_window(
   rolling_aggregation const& agg,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief  Applies several fixed-size rolling window functions to the values in a column, over the
+ * same windows.
+ *
+ * The result of each aggregation is that of `rolling_window` with the same arguments. The SUM,
+ * MEAN, MIN, MAX, COUNT_VALID and COUNT_ALL aggregations of a numeric column are computed
+ * together, in a single pass over the rows of each window.
+ *
+ * @param[in] input The input column
+ * @param[in] preceding_window The static rolling window size in the backward direction.
+ * @param[in] following_window The static rolling window size in the forward direction.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggs The rolling window aggregations
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @returns   A table of the nullable output column of each aggregation, in the order of `aggs`
+ */
+std::unique_ptr<table> rolling_window(
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<rolling_aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief  Evaluates an expression over the results of fixed-size rolling window functions.
+ *
+ * This is an alternative to the UDF aggregations that needs no runtime compilation: the
+ * statistics of each window are computed by `aggs`, and `expr` combines them into the value of
+ * the window. The column references of `expr` are indices into `aggs`, e.g.
+ * `column_reference(0)` is the result of `aggs[0]`.
+ *
+ * @code{.pseudo}
+ * // the range of the values of each window
+ * aggs = [MAX, MIN]
+ * expr = operation(SUB, column_reference(0), column_reference(1))
+ * @endcode
+ *
+ * @param[in] input The input column
+ * @param[in] preceding_window The static rolling window size in the backward direction.
+ * @param[in] following_window The static rolling window size in the forward direction.
+ * @param[in] min_periods Minimum number of observations in window required to have a value
+ *                        for each of the aggregations.
+ * @param[in] aggs The rolling window aggregations referenced by `expr`
+ * @param[in] expr The expression evaluated for each window
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns   A column of the value of `expr` for each window
+ */
+std::unique_ptr<column> rolling_window(
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<rolling_aggregation>> const& aggs,
+  ast::expression const& expr,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Abstraction for window boundary sizes
  */
@@ -575,5 +641,67 @@ std::unique_ptr<column> rolling_window(
   rolling_aggregation const& agg,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief  Applies several variable-size rolling window functions to the values in a column, over
+ * the same windows.
+ *
+ * The result of each aggregation is that of `rolling_window` with the same arguments. The SUM,
+ * MEAN, MIN, MAX, COUNT_VALID and COUNT_ALL aggregations of a numeric column are computed
+ * together, in a single pass over the rows of each window.
+ *
+ * @throws cudf::logic_error if window column type is not INT32
+ *
+ * @param[in] input The input column
+ * @param[in] preceding_window A non-nullable column of INT32 window sizes in the forward direction.
+ *                             `preceding_window[i]` specifies preceding window size for
+ *                             element `i`.
+ * @param[in] following_window A non-nullable column of INT32 window sizes in the backward
+ *                             direction. `following_window[i]` specifies following window size
+ *                             for element `i`.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggs The rolling window aggregations
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @returns   A table of the nullable output column of each aggregation, in the order of `aggs`
+ */
+std::unique_ptr<table> rolling_window(
+  column_view const& input,
+  column_view const& preceding_window,
+  column_view const& following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<rolling_aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief  Evaluates an expression over the results of variable-size rolling window functions.
+ *
+ * The column references of `expr` are indices into `aggs`, as for the fixed-size windows.
+ *
+ * @throws cudf::logic_error if window column type is not INT32
+ * @param[in] input The input column
+ * @param[in] preceding_window A non-nullable column of INT32 window sizes in the forward direction.
+ *                             `preceding_window[i]` specifies preceding window size for
+ *                             element `i`.
+ * @param[in] following_window A non-nullable column of INT32 window sizes in the backward
+ *                             direction. `following_window[i]` specifies following window size
+ *                             for element `i`.
+ * @param[in] min_periods Minimum number of observations in window required to have a value
+ *                        for each of the aggregations.
+ * @param[in] aggs The rolling window aggregations referenced by `expr`
+ * @param[in] expr The expression evaluated for each window
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns   A column of the value of `expr` for each window
+ */
+std::unique_ptr<column> rolling_window(
+  column_view const& input,
+  column_view const& preceding_window,
+  column_view const& following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<rolling_aggregation>> const& aggs,
+  ast::expression const& expr,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup reshape_row_conversion
+ * @{
+ * @file
+ * @brief Conversion between columnar tables and the row-major JCUDF format
+ *
+ * Each row of the JCUDF format holds the fixed-width columns in order, each aligned to its own
+ * size, followed by one validity bit per column packed into bytes. A string column takes an
+ * 8-byte slot holding the 32-bit offset of its characters from the start of the row and their
+ * 32-bit length. The characters of the strings of a row follow its validity bytes, and each row
+ * is padded to a multiple of 8 bytes.
+ *
+ * The rows are returned as LIST<INT8> columns, one row per list. A single column can only address
+ * 2GB, so a table whose rows do not fit is split into several columns of consecutive rows.
+ */
+
+/**
+ * @brief Converts a table into rows of the JCUDF format.
+ *
+ * The columns are transposed a tile at a time through shared memory.
+ *
+ * @throw cudf::logic_error if a column is neither fixed-width nor a string column
+ *
+ * @param tbl The table to convert
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return LIST<INT8> columns holding the consecutive rows of `tbl`, each smaller than 2GB
+ */
+std::vector<std::unique_ptr<column>> convert_to_rows(
+  table_view const& tbl,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Converts a table of fixed-width columns into rows of the JCUDF format.
+ *
+ * This version is faster than `convert_to_rows` for narrow tables, of up to about 100 columns,
+ * whose whole rows fit in shared memory.
+ *
+ * @throw cudf::logic_error if a column is not fixed-width
+ *
+ * @param tbl The table to convert
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return LIST<INT8> columns holding the consecutive rows of `tbl`, each smaller than 2GB
+ */
+std::vector<std::unique_ptr<column>> convert_to_rows_fixed_width_optimized(
+  table_view const& tbl,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Converts rows of the JCUDF format into a table.
+ *
+ * @throw cudf::logic_error if `input` is not a list of INT8 or UINT8
+ * @throw cudf::logic_error if a type of `schema` is neither fixed-width nor STRING
+ *
+ * @param input The rows to convert, one per list
+ * @param schema The types of the columns of the rows
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The table of the rows, with one column per type of `schema`
+ */
+std::unique_ptr<table> convert_from_rows(
+  lists_column_view const& input,
+  std::vector<data_type> const& schema,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Converts rows of the JCUDF format with only fixed-width columns into a table.
+ *
+ * This version is faster than `convert_from_rows` for narrow tables, of up to about 100 columns,
+ * whose whole rows fit in shared memory.
+ *
+ * @throw cudf::logic_error if `input` is not a list of INT8 or UINT8
+ * @throw cudf::logic_error if a type of `schema` is not fixed-width
+ * @throw cudf::logic_error if the size of `input` does not match `schema`
+ *
+ * @param input The rows to convert, one per list
+ * @param schema The types of the columns of the rows
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The table of the rows, with one column per type of `schema`
+ */
+std::unique_ptr<table> convert_from_rows_fixed_width_optimized(
+  lists_column_view const& input,
+  std::vector<data_type> const& schema,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,7 @@
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 
+#include <memory>
 #include <vector>
 
 namespace cudf {
@@ -166,5 +167,81 @@ std::unique_ptr<column> contains(
   column_view const& needles,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief An index of a sorted table, built once to find the insertion points of many values.
+ *
+ * The packed keys of the rows of tables of fixed-width columns of up to 64 bits, as sorted by
+ * `sorted_order`, are laid out in an Eytzinger search tree: the rows are stored in the
+ * breadth-first order of the implicit binary search tree over them. The nodes visited first by
+ * every search are then contiguous and stay in cache, and each step of a search compares two
+ * integers. Other tables, and values with nulls in a column whose keys have no nulls, are
+ * searched as by `lower_bound` and `upper_bound`.
+ *
+ * Example:
+ * ```
+ * cudf::sorted_index index(table_view{{timestamps}});
+ * for (auto const& probes : batches) { process(index.lower_bound(probes)->view()); }
+ * ```
+ */
+class sorted_index {
+ public:
+  sorted_index() = delete;
+  ~sorted_index();
+  sorted_index(sorted_index const&) = delete;
+  sorted_index(sorted_index&&)      = delete;
+  sorted_index& operator=(sorted_index const&) = delete;
+  sorted_index& operator=(sorted_index&&) = delete;
+
+  /**
+   * @brief Construct an index of the rows of `sorted_keys`.
+   *
+   * @throws cudf::logic_error If a non-empty `column_order` or `null_precedence` does not have
+   * the number of columns of `sorted_keys`
+   *
+   * @param sorted_keys The table to search, sorted by `column_order` and `null_precedence`
+   * @param column_order The order of each column, ascending if empty
+   * @param null_precedence The order of a null element compared to other elements for each
+   * column. If empty, nulls are ordered before all other elements.
+   * @param mr Device memory resource used to allocate the device memory of the index
+   */
+  sorted_index(
+    table_view const& sorted_keys,
+    std::vector<order> const& column_order         = {},
+    std::vector<null_order> const& null_precedence = {},
+    rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Find the smallest indices in the sorted table where the rows of `values` should be
+   * inserted to maintain order, as by `cudf::lower_bound`.
+   *
+   * @throws cudf::logic_error If the columns of `values` and of the sorted table differ in type
+   *
+   * @param values The rows to find the insertion points of
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A non-nullable column of cudf::size_type elements containing the insertion points
+   */
+  std::unique_ptr<column> lower_bound(
+    table_view const& values,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Find the largest indices in the sorted table where the rows of `values` should be
+   * inserted to maintain order, as by `cudf::upper_bound`.
+   *
+   * @throws cudf::logic_error If the columns of `values` and of the sorted table differ in type
+   *
+   * @param values The rows to find the insertion points of
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A non-nullable column of cudf::size_type elements containing the insertion points
+   */
+  std::unique_ptr<column> upper_bound(
+    table_view const& values,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  struct sorted_index_impl;
+  std::unique_ptr<sorted_index_impl> impl;
+};
+
 /** @} */  // end of group
 }  // namespace cudf
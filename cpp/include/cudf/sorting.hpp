@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,7 +18,10 @@
 
 #include <cudf/types.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace cudf {
@@ -53,6 +56,7 @@ enum class rank_method {
  * @param null_precedence The desired order of null compared to other elements
  * for each column.  Size must be equal to `input.num_columns()` or empty.
  * If empty, all columns will be sorted in `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned column's device memory
  * @return A non-nullable column of `size_type` elements containing the permuted row indices of
  * `input` if it were sorted
@@ -61,6 +65,7 @@ std::unique_ptr<column> sorted_order(
   table_view const& input,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
 /**
@@ -75,6 +80,7 @@ std::unique_ptr<column> stable_sorted_order(
   table_view const& input,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
 /**
@@ -90,12 +96,15 @@ std::unique_ptr<column> stable_sorted_order(
  *                              elements for each column. Size must be equal to
  *                              `input.num_columns()` or empty. If empty,
  *                              `null_order::BEFORE` is assumed for all columns.
+ * @param[in] stream            CUDA stream used for device memory operations and kernel
+ *                              launches
  *
  * @returns bool                true if sorted as expected, false if not.
  */
 bool is_sorted(cudf::table_view const& table,
                std::vector<order> const& column_order,
-               std::vector<null_order> const& null_precedence);
+               std::vector<null_order> const& null_precedence,
+               rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 
 /**
  * @brief Performs a lexicographic sort of the rows of a table
@@ -108,6 +117,7 @@ bool is_sorted(cudf::table_view const& table,
  * elements for each column in `input`. Size must be equal to
  * `input.num_columns()` or empty. If empty, all columns will be sorted with
  * `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table's device memory
  * @return New table containing the desired sorted order of `input`
  */
@@ -115,6 +125,7 @@ std::unique_ptr<table> sort(
   table_view const& input,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
 /**
@@ -134,6 +145,7 @@ std::unique_ptr<table> sort(
  * elements for each column in `keys`. Size must be equal to
  * `keys.num_columns()` or empty. If empty, all columns will be sorted with
  * `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table's device memory
  * @return The reordering of `values` determined by the lexicographic order of
  * the rows of `keys`.
@@ -143,6 +155,7 @@ std::unique_ptr<table> sort_by_key(
   table_view const& keys,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
 /**
@@ -184,6 +197,40 @@ std::unique_ptr<column> rank(
   bool percentage,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the ranks of input column in sorted order for several ranking methods at once.
+ *
+ * The column is sorted once, and the ranks of every method are derived from the groups of equal
+ * values of that single sort, so that requesting several methods costs about as much as one.
+ *
+ * @code{.pseudo}
+ * input   = { 3, 4, 5, 4, 1, 2}
+ * methods = {MIN, DENSE}
+ * result  = {{3, 4, 6, 4, 1, 2}, {3, 4, 5, 4, 1, 2}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if `methods` holds a value that is not a `rank_method`
+ *
+ * @param input The column to rank
+ * @param methods The ranking methods used for tie breaking (same values), one per output column
+ * @param column_order The desired sort order for ranking
+ * @param null_handling  flag to include nulls during ranking. If nulls are not
+ * included, corresponding rank will be null.
+ * @param null_precedence The desired order of null compared to other elements
+ * for column
+ * @param percentage flag to convert ranks to percentage in range (0,1}
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return The rank columns, in the order of `methods`, each as returned by `rank` for its method
+ */
+std::vector<std::unique_ptr<column>> rank(
+  column_view const& input,
+  std::vector<rank_method> const& methods,
+  order column_order,
+  null_policy null_handling,
+  null_order null_precedence,
+  bool percentage,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns sorted order after sorting each segment in the table.
  *
@@ -266,5 +313,165 @@ std::unique_ptr<table> stable_segmented_sort_by_key(
   std::vector<null_order> const& null_precedence = {},
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the indices of the first `k` rows of the table in sorted order.
+ *
+ * The result is the first `k` elements of `stable_sorted_order(keys, column_order,
+ * null_precedence)`, computed without sorting the whole table. When the rows of `keys` pack into
+ * 64-bit integer keys (fixed-width columns of at most 64 bits in total, with one more bit per
+ * column with nulls), the `k`-th row is found by a radix select over the packed keys and the row
+ * indices, and only the `k` selected rows are sorted. Other keys are fully sorted.
+ *
+ * @code{.pseudo}
+ * keys = {{ 5, 1, 4, 1, 9, 2 }}
+ * top_k(keys, 3, {order::DESCENDING}) = { 4, 0, 2 }
+ * top_k(keys, 3, {order::ASCENDING}) = { 1, 3, 5 }
+ * @endcode
+ *
+ * @throws cudf::logic_error if `k` is negative
+ *
+ * @param keys The table that determines the ordering
+ * @param k Number of rows to return the indices of; all the rows when larger than their number
+ * @param column_order The desired order for each column in `keys`. Size must be equal to
+ * `keys.num_columns()` or empty. If empty, all columns are sorted in ascending order.
+ * @param null_precedence The desired order of a null element compared to other elements for each
+ * column in `keys`. Size must be equal to `keys.num_columns()` or empty. If empty, all columns
+ * will be sorted with `null_order::BEFORE`.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The `min(k, keys.num_rows())` indices of the first rows in sorted order
+ */
+std::unique_ptr<column> top_k(
+  table_view const& keys,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the indices of the first `k` rows of each segment of the table in sorted order.
+ *
+ * The result is made of the first `min(k, size)` indices of `stable_segmented_sorted_order` for
+ * each segment, with the indices of each segment following those of the previous segment. Rows
+ * outside of the segments are ignored.
+ *
+ * @code{.pseudo}
+ * keys = {{ 5, 1, 4, 1, 9, 2 }}
+ * segment_offsets = { 0, 4, 6 }
+ * segmented_top_k(keys, segment_offsets, 2, {order::DESCENDING}) = { 0, 2, 4, 5 }
+ * @endcode
+ *
+ * @throws cudf::logic_error if `k` is negative
+ * @throws cudf::logic_error if `segment_offsets` is not a `size_type` column
+ *
+ * @param keys The table that determines the ordering of the rows of each segment
+ * @param segment_offsets The column of `size_type` type containing the start offset index of
+ * each contiguous segment, followed by the end offset of the last segment
+ * @param k Number of rows of each segment to return the indices of
+ * @param column_order The desired order for each column in `keys`. Size must be equal to
+ * `keys.num_columns()` or empty. If empty, all columns are sorted in ascending order.
+ * @param null_precedence The desired order of a null element compared to other elements for each
+ * column in `keys`. Size must be equal to `keys.num_columns()` or empty. If empty, all columns
+ * will be sorted with `null_order::BEFORE`.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The indices of the first rows of each segment in sorted order
+ */
+std::unique_ptr<column> segmented_top_k(
+  table_view const& keys,
+  column_view const& segment_offsets,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Sorts a table larger than device memory, passed and returned in chunks.
+ *
+ * Each chunk passed to `push` is sorted on its own into a run, which is split into blocks of at
+ * most `block_rows` rows packed by `contiguous_split` and spilled to pinned host memory, or to a
+ * file when a spill directory is given. `next` then returns the rows of all the runs in sorted
+ * order, a bounded chunk at a time, by a k-way merge of the runs with `cudf::merge`.
+ *
+ * The merge keeps one block of each run in device memory. The rows smaller than the last row of
+ * every block loaded so far cannot be preceded by a row yet to be loaded, and are returned first;
+ * the run whose loaded block ends first then has its next block loaded. The device memory used
+ * by the merge is thus about `num_runs * block_rows` rows plus the returned chunk.
+ *
+ * Example:
+ * ```
+ * cudf::external_sorter sorter({0}, {order::ASCENDING});
+ * for (auto const& chunk : input_chunks) { sorter.push(chunk); }
+ * while (sorter.has_next()) { write(sorter.next(chunk_rows)->view()); }
+ * ```
+ *
+ * Rows of equal keys come out in an arbitrary order.
+ */
+class external_sorter {
+ public:
+  external_sorter() = delete;
+  ~external_sorter();
+  external_sorter(external_sorter const&) = delete;
+  external_sorter(external_sorter&&)      = delete;
+  external_sorter& operator=(external_sorter const&) = delete;
+  external_sorter& operator=(external_sorter&&) = delete;
+
+  /**
+   * @brief Construct an external sorter for the chunks to be passed to `push`
+   *
+   * @throws cudf::logic_error If `key_columns` is empty
+   * @throws cudf::logic_error If `column_order` or a non-empty `null_precedence` does not have
+   * the size of `key_columns`
+   * @throws cudf::logic_error If `block_rows` is not positive
+   *
+   * @param key_columns Indices of the columns of the chunks to sort by
+   * @param column_order The desired order of each key column
+   * @param null_precedence The desired order of a null element compared to other elements for
+   * each key column. If empty, nulls are ordered before all other elements.
+   * @param block_rows Number of rows of the blocks the sorted runs are spilled and merged by
+   * @param spill_directory Directory of the file the runs are spilled to. If empty, the runs are
+   * spilled to pinned host memory instead.
+   */
+  external_sorter(std::vector<size_type> key_columns,
+                  std::vector<order> column_order,
+                  std::vector<null_order> null_precedence = {},
+                  size_type block_rows                    = 1 << 20,
+                  std::string const& spill_directory      = {});
+
+  /**
+   * @brief Sorts a chunk of the table and spills it as a run.
+   *
+   * @throws cudf::logic_error If the schema of `chunk` differs from the previous chunks
+   * @throws cudf::logic_error If `next` has already been called
+   *
+   * @param chunk The chunk of the table to sort
+   */
+  void push(table_view const& chunk);
+
+  /**
+   * @brief Returns whether `next` has rows left to return.
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Returns the next rows of the sorted table.
+   *
+   * No more chunks may be passed to `push` once `next` has been called.
+   *
+   * @throws cudf::logic_error If `max_rows` is not positive
+   * @throws cudf::logic_error If no chunk has been passed to `push`
+   *
+   * @param max_rows Largest number of rows to return
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   * @return The next `max_rows` rows in sorted order, fewer for the last ones, and an empty table
+   * once all the rows have been returned
+   */
+  std::unique_ptr<table> next(
+    size_type max_rows,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+ private:
+  struct external_sorter_impl;
+  std::unique_ptr<external_sorter_impl> impl;
+};
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/copying.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <utility>
+
+namespace cudf {
+/**
+ * @addtogroup utility_spill
+ * @{
+ * @file
+ */
+
+namespace detail {
+struct spill_entry;
+}  // namespace detail
+
+/**
+ * @brief Registry of the `spillable_table`s whose device memory may be moved to pinned host memory
+ * when device memory runs low.
+ *
+ * The manager keeps its tables in least-recently-used order, where a table is used when it is
+ * registered and each time it is locked. Spilling moves the device data of the least recently used
+ * tables that are not locked to pinned host memory, and a spilled table is copied back to device
+ * memory the next time it is locked.
+ *
+ * Both copies are asynchronous and ordered on the stream passed to the call that triggers them.
+ * The device data of a table is immutable, so the host copy made by the first spill of a table is
+ * kept when the table is copied back, and spilling it again only frees its device memory.
+ *
+ * Tables are spilled on demand with `spill()`, by a `spilling_resource_adaptor` whose upstream
+ * allocations fail, or whenever the device memory of the registered tables exceeds the limit of
+ * the manager. All the member functions are thread-safe.
+ *
+ * @code{.pseudo}
+ * spill_manager manager;
+ * spilling_resource_adaptor mr{manager};
+ * rmm::mr::set_current_device_resource(&mr);
+ * std::vector<spillable_table> partitions;
+ * for (auto& chunk : chunks) partitions.emplace_back(std::move(chunk), manager);
+ * for (auto& partition : partitions) {
+ *   auto const lock = partition.lock();  // copies the partition back to device if it was spilled
+ *   process(lock.view());
+ * }
+ * @endcode
+ */
+class spill_manager {
+ public:
+  ~spill_manager();
+  spill_manager(spill_manager const&) = delete;
+  spill_manager(spill_manager&&)      = delete;
+  spill_manager& operator=(spill_manager const&) = delete;
+  spill_manager& operator=(spill_manager&&) = delete;
+
+  /**
+   * @brief Constructs a manager without any table.
+   *
+   * @param device_limit Bytes of device memory that the registered tables may hold before the
+   * least recently used ones are spilled
+   */
+  explicit spill_manager(std::size_t device_limit = std::numeric_limits<std::size_t>::max());
+
+  /**
+   * @brief Spills the least recently used tables that are not locked until at least `bytes` of
+   * device memory are freed, or no table is left to spill.
+   *
+   * @param bytes Bytes of device memory to free
+   * @param stream CUDA stream on which the tables are copied to host memory and their device memory
+   * is freed
+   * @return Bytes of device memory freed, which may be more or less than `bytes`
+   */
+  std::size_t spill(std::size_t bytes, rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Returns the bytes of device memory held by the registered tables.
+   */
+  [[nodiscard]] std::size_t device_bytes() const;
+
+  /**
+   * @brief Returns the bytes of pinned host memory held by the host copies of the registered
+   * tables.
+   */
+  [[nodiscard]] std::size_t host_bytes() const;
+
+  /**
+   * @brief Returns the bytes of device memory the registered tables may hold before they are
+   * spilled.
+   */
+  [[nodiscard]] std::size_t device_limit() const;
+
+  /**
+   * @brief Sets the bytes of device memory the registered tables may hold, and spills the tables
+   * that exceed it.
+   *
+   * @param device_limit Bytes of device memory that the registered tables may hold
+   * @param stream CUDA stream on which the tables exceeding the limit are spilled
+   */
+  void set_device_limit(std::size_t device_limit,
+                        rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+ private:
+  friend class spillable_table;
+
+  struct spill_manager_impl;
+  std::unique_ptr<spill_manager_impl> const impl;
+};
+
+/**
+ * @brief Table in the serialized format of `cudf::pack` whose device data may be spilled to
+ * pinned host memory by a `spill_manager`.
+ *
+ * The columns of the table are only accessible through a `device_lock`, which guarantees that the
+ * device data is not spilled while it is held. The table must not outlive its manager.
+ */
+class spillable_table {
+ public:
+  /**
+   * @brief Holds the device data of a `spillable_table` in device memory.
+   *
+   * The work using the view of the lock must be ordered before the destruction of the lock on the
+   * stream passed to `spillable_table::lock()`, which is the stream a later spill of the table
+   * waits for.
+   */
+  class device_lock {
+   public:
+    ~device_lock();
+    device_lock(device_lock const&) = delete;
+    device_lock(device_lock&& other) noexcept;
+    device_lock& operator=(device_lock const&) = delete;
+    device_lock& operator=(device_lock&&) = delete;
+
+    /**
+     * @brief Returns the columns of the locked table.
+     */
+    [[nodiscard]] table_view view() const { return _view; }
+
+   private:
+    friend class spillable_table;
+
+    device_lock(detail::spill_entry* entry,
+                spill_manager* manager,
+                table_view view,
+                rmm::cuda_stream_view stream);
+
+    detail::spill_entry* _entry;
+    spill_manager* _manager;
+    table_view _view;
+    rmm::cuda_stream_view _stream;
+  };
+
+  ~spillable_table();
+  spillable_table(spillable_table const&) = delete;
+  spillable_table(spillable_table&& other) noexcept;
+  spillable_table& operator=(spillable_table const&) = delete;
+  spillable_table& operator=(spillable_table&& other) noexcept;
+
+  /**
+   * @brief Packs a table and registers it with a manager.
+   *
+   * @param input The table to pack
+   * @param manager The manager that may spill the table
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the device data of the table, when it is
+   * packed and each time it is copied back from host memory
+   */
+  spillable_table(table_view const& input,
+                  spill_manager& manager,
+                  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+                  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Registers a packed table with a manager.
+   *
+   * @throw cudf::logic_error if `input` has no metadata or no device data
+   *
+   * @param input The packed table, e.g. a result of `cudf::contiguous_split`
+   * @param manager The manager that may spill the table
+   * @param stream CUDA stream on which the device data of `input` is valid
+   * @param mr Device memory resource used to allocate the device data of the table each time it is
+   * copied back from host memory
+   */
+  spillable_table(packed_columns&& input,
+                  spill_manager& manager,
+                  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+                  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Locks the device data of the table in device memory, copying it back from host memory
+   * if it was spilled.
+   *
+   * @throw cudf::logic_error if the table was released
+   *
+   * @param stream CUDA stream on which the device data is copied back and the view of the lock is
+   * used
+   * @return The lock, whose view is valid until it is destroyed
+   */
+  device_lock lock(rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Returns whether the device data of the table is in host memory only.
+   *
+   * @throw cudf::logic_error if the table was released
+   */
+  [[nodiscard]] bool is_spilled() const;
+
+  /**
+   * @brief Returns the bytes of the device data of the table.
+   *
+   * @throw cudf::logic_error if the table was released
+   */
+  [[nodiscard]] std::size_t packed_size() const;
+
+  /**
+   * @brief Unregisters the table from its manager and returns its packed data in device memory.
+   *
+   * @throw cudf::logic_error if the table was released or is locked
+   *
+   * @param stream CUDA stream on which the returned device data is valid
+   * @return The packed table
+   */
+  packed_columns release(rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+ private:
+  static void unlock(detail::spill_entry* entry,
+                     spill_manager* manager,
+                     rmm::cuda_stream_view stream);
+
+  detail::spill_entry* _entry;
+  spill_manager* _manager;
+};
+
+/**
+ * @brief Device memory resource that spills the tables of a `spill_manager` when its upstream
+ * resource fails to allocate.
+ *
+ * An allocation that throws `rmm::bad_alloc` spills at least the bytes of the allocation on its
+ * stream and is retried, until it succeeds or no table is left to spill. All other calls are
+ * forwarded to the upstream resource.
+ */
+class spilling_resource_adaptor final : public rmm::mr::device_memory_resource {
+ public:
+  /**
+   * @brief Constructs the adaptor.
+   *
+   * @param manager The manager whose tables are spilled; it must outlive the adaptor
+   * @param upstream The resource used for the allocations; it must outlive the adaptor
+   */
+  explicit spilling_resource_adaptor(
+    spill_manager& manager,
+    rmm::mr::device_memory_resource* upstream = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns the upstream resource.
+   */
+  [[nodiscard]] rmm::mr::device_memory_resource* get_upstream() const noexcept { return _upstream; }
+
+  /**
+   * @brief Returns whether the upstream resource supports streams.
+   */
+  [[nodiscard]] bool supports_streams() const noexcept override
+  {
+    return _upstream->supports_streams();
+  }
+
+  /**
+   * @brief Returns whether the upstream resource supports `get_mem_info`.
+   */
+  [[nodiscard]] bool supports_get_mem_info() const noexcept override
+  {
+    return _upstream->supports_get_mem_info();
+  }
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override;
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    _upstream->deallocate(ptr, bytes, stream);
+  }
+
+  [[nodiscard]] std::pair<std::size_t, std::size_t> do_get_mem_info(
+    rmm::cuda_stream_view stream) const override
+  {
+    return _upstream->get_mem_info(stream);
+  }
+
+  spill_manager* _manager;
+  rmm::mr::device_memory_resource* _upstream;
+};
+
+/** @} */  // end of group
+}  // namespace cudf
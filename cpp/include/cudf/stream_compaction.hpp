@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,10 +18,16 @@
 
 #include <cudf/types.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
 #include <memory>
 #include <vector>
 
 namespace cudf {
+namespace ast {
+struct expression;
+}  // namespace ast
+
 /**
  * @addtogroup reorder_compact
  * @{
@@ -191,10 +197,13 @@ std::unique_ptr<table> drop_nans(
  *
  * @throws cudf::logic_error if The `input` size  and `boolean_mask` size mismatches.
  * @throws cudf::logic_error if `boolean_mask` is not `type_id::BOOL8` type.
+ * @throws cudf::logic_error if `stream` is being captured into a CUDA graph, since the size of
+ * the output must be read on the host to allocate it.
  *
  * @param[in] input The input table_view to filter
  * @param[in] boolean_mask A nullable column_view of type type_id::BOOL8 used
  * as a mask to filter the `input`.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned table's device memory
  * @return Table containing copy of all rows of @p input passing
  * the filter defined by @p boolean_mask.
@@ -202,6 +211,29 @@ std::unique_ptr<table> drop_nans(
 std::unique_ptr<table> apply_boolean_mask(
   table_view const& input,
   column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Filters `input` using a boolean AST expression evaluated on its rows.
+ *
+ * An element `i` from each column_view of the `input` is copied to the corresponding output
+ * column if `predicate` evaluated on row `i` of `input` is non-null and `true`. This operation is
+ * stable: the input order is preserved.
+ *
+ * This is equivalent to `apply_boolean_mask(input, *compute_column(input, predicate))`, but the
+ * predicate is evaluated into a bitmask instead of a BOOL8 column.
+ *
+ * @throws cudf::logic_error if `predicate` does not evaluate to `type_id::BOOL8`.
+ *
+ * @param[in] input The input table_view to filter
+ * @param[in] predicate The boolean expression evaluated on the rows of `input`
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @return Table containing copy of all rows of @p input for which @p predicate is true.
+ */
+std::unique_ptr<table> filter(
+  table_view const& input,
+  ast::expression const& predicate,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -243,6 +275,37 @@ std::unique_ptr<table> drop_duplicates(
   null_order null_precedence          = null_order::BEFORE,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create a new table without duplicate rows, in the order of the input rows
+ *
+ * Given an `input` table_view, each row is copied to output table if the corresponding
+ * row of `keys` columns is unique, where the definition of unique depends on the value of @p keep:
+ * - KEEP_FIRST: only the first of a set of duplicate rows is copied
+ * - KEEP_LAST: only the last of a set of duplicate rows is copied
+ * - KEEP_NONE: no duplicate rows are copied
+ *
+ * Unlike `drop_duplicates`, the rows are found with a hash table instead of sorting, and the
+ * output rows are in the same order as in `input`.
+ *
+ * @throws cudf::logic_error if The `input` row size mismatches with `keys`.
+ *
+ * @param[in] input           input table_view to copy only unique rows
+ * @param[in] keys            vector of indices representing key columns from `input`
+ * @param[in] keep            keep first entry, last entry, or no entries if duplicates found
+ * @param[in] nulls_equal     flag to denote nulls are equal if null_equality::EQUAL, nulls are not
+ *                            equal if null_equality::UNEQUAL
+ * @param[in] mr              Device memory resource used to allocate the returned table's device
+ * memory
+ *
+ * @return Table with unique rows as per specified `keep`, in the order of `input`.
+ */
+std::unique_ptr<table> distinct(
+  table_view const& input,
+  std::vector<size_type> const& keys,
+  duplicate_keep_option keep          = duplicate_keep_option::KEEP_FIRST,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Count the unique elements in the column_view
  *
@@ -276,5 +339,23 @@ cudf::size_type distinct_count(column_view const& input,
 cudf::size_type distinct_count(table_view const& input,
                                null_equality nulls_equal = null_equality::EQUAL);
 
+/**
+ * @brief Estimates the number of unique elements counted by each of the HyperLogLog sketches
+ * produced by a `HLL` or `MERGE_HLL` aggregation.
+ *
+ * The estimates are much cheaper than `distinct_count` on large inputs, with a relative standard
+ * error of about `1.04 / sqrt(2^precision)` for sketches of precision `precision`.
+ *
+ * @throw cudf::logic_error if `sketches` is not a `LIST<UINT8>` column of HyperLogLog sketches
+ *
+ * @param sketches The `LIST<UINT8>` column of the sketches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @return `INT64` column of the estimates, null where the sketch is null
+ */
+std::unique_ptr<column> hll_distinct_count(
+  column_view const& sketches,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */
 }  // namespace cudf
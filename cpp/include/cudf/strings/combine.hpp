@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,8 @@
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table_view.hpp>
 
+#include <string>
+
 namespace cudf {
 namespace strings {
 /**
@@ -321,6 +323,47 @@ std::unique_ptr<column> join_list_elements(
   output_if_empty_list empty_list_policy = output_if_empty_list::EMPTY_STRING,
   rmm::mr::device_memory_resource* mr    = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Row-wise formats the strings of the given columns into a pattern.
+ *
+ * Each output row is the pattern with each placeholder replaced by the string of its column in
+ * that row. A placeholder `{i}` refers to the column `i` of `strings_columns`, and a placeholder
+ * `{}` to the column after that of the previous placeholder, starting from column 0. The
+ * characters `{{` and `}}` are written as single braces, and the rest of the pattern is copied.
+ *
+ * The output sizes are computed in one pass and the strings written in the next, with no
+ * intermediate columns between the placeholders.
+ *
+ * A row referencing a null string is null, unless `narep` is valid, in which case it replaces
+ * the null strings.
+ *
+ * @code{.pseudo}
+ * Example:
+ * c0  = ['aa', null, 'cc']
+ * c1  = ['1',  '2',  null]
+ * out = format("{0}-{1}:{0}", {c0, c1})
+ * out is ['aa-1:aa', null, null]
+ * out = format("{{{}}}={}", {c0, c1}, '?')
+ * out is ['{aa}=1', '{?}=2', '{cc}=?']
+ * @endcode
+ *
+ * @throw cudf::logic_error if input columns are not all strings columns.
+ * @throw cudf::logic_error if the pattern has unmatched braces or a malformed placeholder.
+ * @throw cudf::logic_error if a placeholder refers to a column not in `strings_columns`.
+ *
+ * @param pattern The pattern of the output strings.
+ * @param strings_columns Strings columns referred to by the placeholders.
+ * @param narep String that should be used in place of any null strings
+ *        found in any column. Default of invalid-scalar means null rows for the null strings.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New strings column with the formatted rows.
+ */
+std::unique_ptr<column> format(
+  std::string const& pattern,
+  table_view const& strings_columns,
+  string_scalar const& narep          = string_scalar("", false),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
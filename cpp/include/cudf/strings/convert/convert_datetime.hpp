@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,9 @@
 #include <cudf/column/column.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -29,6 +32,50 @@ namespace strings {
  * @file
  */
 
+/**
+ * @brief Timestamp format compiled once and reused by every conversion it is passed to.
+ *
+ * The format string is parsed into its specifiers and literals, and copied to the device, when
+ * the format is created. Calls using the format skip both steps, which otherwise dominate the
+ * conversion of small columns.
+ *
+ * A format is created with the specifiers of `from_timestamps`. Passing a format using
+ * specifiers of `from_timestamps` only to `to_timestamps` or `is_timestamp` throws.
+ */
+struct datetime_format {
+  struct datetime_format_impl;
+
+  /**
+   * @brief Compiles a timestamp format.
+   *
+   * @throw cudf::logic_error if the format is empty or has an invalid specifier
+   *
+   * @param format String specifying the timestamp format, as for `from_timestamps`
+   * @return The compiled format
+   */
+  static std::unique_ptr<datetime_format> create(std::string const& format);
+
+  datetime_format()                       = delete;
+  datetime_format(datetime_format const&) = delete;
+  datetime_format& operator=(datetime_format const&) = delete;
+  datetime_format(datetime_format&& other) noexcept;
+  datetime_format& operator=(datetime_format&& other) noexcept;
+  ~datetime_format();
+
+  /**
+   * @brief Returns the format string the format was compiled from.
+   */
+  [[nodiscard]] std::string format() const;
+
+ private:
+  datetime_format(std::string const& format, rmm::cuda_stream_view stream);
+
+  std::string _format;
+  std::unique_ptr<datetime_format_impl> _impl;
+
+  friend struct datetime_format_reader;
+};
+
 /**
  * @brief Returns a new timestamp column converting a strings column into
  * timestamps using the provided format pattern.
@@ -77,6 +124,28 @@ std::unique_ptr<column> to_timestamps(
   std::string const& format,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a new timestamp column converting a strings column into
+ * timestamps using a compiled format.
+ *
+ * The format is compiled once by `datetime_format::create`, and is reused by every call it is
+ * passed to. The conversion is otherwise the same as with the format string.
+ *
+ * @throw cudf::logic_error if timestamp_type is not a timestamp type.
+ * @throw cudf::logic_error if the format has a specifier not supported by this function.
+ *
+ * @param strings Strings instance for this operation.
+ * @param timestamp_type The timestamp type used for creating the output column.
+ * @param format Compiled timestamp format of the strings.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New datetime column.
+ */
+std::unique_ptr<column> to_timestamps(
+  strings_column_view const& strings,
+  data_type timestamp_type,
+  datetime_format const& format,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Verifies the given strings column can be parsed to timestamps using the provided format
  * pattern.
@@ -118,6 +187,24 @@ std::unique_ptr<column> is_timestamp(
   std::string const& format,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Verifies the given strings column can be parsed to timestamps using a compiled format.
+ *
+ * The format is compiled once by `datetime_format::create`, and is reused by every call it is
+ * passed to. The check is otherwise the same as with the format string.
+ *
+ * @throw cudf::logic_error if the format has a specifier not supported by this function.
+ *
+ * @param strings Strings instance for this operation.
+ * @param format Compiled timestamp format of the strings.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New BOOL8 column.
+ */
+std::unique_ptr<column> is_timestamp(
+  strings_column_view const& strings,
+  datetime_format const& format,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns a new strings column converting a timestamp column into
  * strings using the provided format pattern.
@@ -230,6 +317,33 @@ std::unique_ptr<column> from_timestamps(
     data_type{type_id::STRING}, 0, nullptr}),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a new strings column converting a timestamp column into
+ * strings using a compiled format.
+ *
+ * The format is compiled once by `datetime_format::create`, and is reused by every call it is
+ * passed to. The conversion is otherwise the same as with the format string.
+ *
+ * When every formatted timestamp has the same length, as with the ISO-8601 formats, the output
+ * offsets are computed from that length instead of from a pass measuring each timestamp.
+ *
+ * @throw cudf::logic_error if `timestamps` column parameter is not a timestamp type.
+ * @throw cudf::logic_error if `names.size()` is an invalid size. Must be 0 or 40 strings.
+ *
+ * @param timestamps Timestamp values to convert.
+ * @param format Compiled output format.
+ * @param names The string names to use for weekdays ("%a", "%A") and months ("%b", "%B")
+ *        Default is an empty `strings_column_view`.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New strings column with formatted timestamps.
+ */
+std::unique_ptr<column> from_timestamps(
+  column_view const& timestamps,
+  datetime_format const& format,
+  strings_column_view const& names    = strings_column_view(column_view{
+    data_type{type_id::STRING}, 0, nullptr}),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -47,6 +47,32 @@ std::unique_ptr<column> to_floats(
   data_type output_type,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a new numeric column by parsing float values from each string
+ * in the provided strings column, with null entries for the strings which are not valid floats.
+ *
+ * This is the same as the output of `to_floats()` with nulls where `is_float()` is false,
+ * each string being checked and parsed at once.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ['123', '-4.5', '', 'A', '3.7e+5', null]
+ * r = to_floats_or_null(s, data_type{type_id::FLOAT64})
+ * r is [123, -4.5, null, null, 370000, null]
+ * @endcode
+ *
+ * @throw cudf::logic_error if output_type is not float type.
+ *
+ * @param strings Strings instance for this operation.
+ * @param output_type Type of float numeric column to return.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New column with floats converted from strings.
+ */
+std::unique_ptr<column> to_floats_or_null(
+  strings_column_view const& strings,
+  data_type output_type,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns a new strings column converting the float values from the
  * provided column into strings.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -54,6 +54,32 @@ std::unique_ptr<column> to_integers(
   data_type output_type,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a new integer numeric column parsing integer values from the
+ * provided strings column, with null entries for the strings which are not valid integers.
+ *
+ * This is the same as the output of `to_integers()` with nulls where `is_integer()` with
+ * the `output_type` is false, each string being checked and parsed at once.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ['123', '-456', '', 'A', '+7', '300', null]
+ * r = to_integers_or_null(s, data_type{type_id::INT8})
+ * r is [123, null, null, null, 7, null, null]
+ * @endcode
+ *
+ * @throw cudf::logic_error if output_type is not integral type or is boolean.
+ *
+ * @param strings Strings instance for this operation.
+ * @param output_type Type of integer numeric column to return.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New column with integers converted from strings.
+ */
+std::unique_ptr<column> to_integers_or_null(
+  strings_column_view const& strings,
+  data_type output_type,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns a new strings column converting the integer values from the
  * provided column into strings.
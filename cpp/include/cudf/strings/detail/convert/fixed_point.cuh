@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,7 @@
 #include <thrust/optional.h>
 #include <thrust/pair.h>
 
+#include <cuda/std/limits>
 #include <cuda/std/type_traits>
 
 namespace cudf {
@@ -156,6 +157,48 @@ __device__ DecimalType parse_decimal(char const* iter, char const* iter_end, int
 
   return static_cast<DecimalType>(value) * (sign == 0 ? 1 : sign);
 }
+
+/**
+ * @brief Returns whether a string is a decimal that `parse_decimal` converts without overflow.
+ *
+ * Only the characters are validated and the integer component checked for overflow, the value
+ * itself is not computed.
+ *
+ * @tparam DecimalType The storage type of the decimal to parse
+ *
+ * @param iter The beginning of the characters to check
+ * @param iter_end The end of the characters to check
+ * @param scale The scale to be applied
+ * @return true if the characters are a decimal that fits in `DecimalType` at `scale`
+ */
+template <typename DecimalType>
+__device__ bool is_parsable_decimal(char const* iter, char const* iter_end, int32_t scale)
+{
+  if (iter == iter_end) { return false; }
+  iter += static_cast<int>((*iter == '-' || *iter == '+'));
+
+  using UnsignedDecimalType = cuda::std::make_unsigned_t<DecimalType>;
+  auto [value, exp_offset]  = parse_integer<UnsignedDecimalType>(iter, iter_end);
+
+  // only exponent notation is expected here
+  if ((iter < iter_end) && (*iter != 'e' && *iter != 'E')) { return false; }
+  ++iter;
+
+  int32_t exp_ten = 0;  // check exponent overflow
+  if (iter < iter_end) {
+    auto exp_result = parse_exponent<true>(iter, iter_end);
+    if (!exp_result) { return false; }
+    exp_ten = exp_result.value();
+  }
+  exp_ten += exp_offset;
+
+  // finally, check for overflow based on the exp_ten and scale values
+  return (exp_ten < scale) or
+         value <= static_cast<UnsignedDecimalType>(
+                    cuda::std::numeric_limits<DecimalType>::max() /
+                    static_cast<DecimalType>(exp10(static_cast<double>(exp_ten - scale))));
+}
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/convert/convert_datetime.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -35,6 +36,17 @@ std::unique_ptr<column> to_integers(strings_column_view const& strings,
                                     rmm::cuda_stream_view stream,
                                     rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc to_integers_or_null(strings_column_view const&,data_type,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> to_integers_or_null(strings_column_view const& strings,
+                                            data_type output_type,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr);
+
 /**
  * @copydoc from_integers(strings_column_view const&,rmm::mr::device_memory_resource*)
  *
@@ -54,6 +66,17 @@ std::unique_ptr<column> to_floats(strings_column_view const& strings,
                                   rmm::cuda_stream_view stream,
                                   rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc to_floats_or_null(strings_column_view const&,data_type,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> to_floats_or_null(strings_column_view const& strings,
+                                          data_type output_type,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr);
+
 /**
  * @copydoc from_floats(strings_column_view const&,rmm::mr::device_memory_resource*)
  *
@@ -98,6 +121,18 @@ std::unique_ptr<cudf::column> to_timestamps(strings_column_view const& strings,
                                             rmm::cuda_stream_view stream,
                                             rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc to_timestamps(strings_column_view const&,data_type,datetime_format
+ * const&,rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<cudf::column> to_timestamps(strings_column_view const& strings,
+                                            data_type timestamp_type,
+                                            datetime_format const& format,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr);
+
 /**
  * @copydoc from_timestamps(strings_column_view const&,std::string
  * const&,strings_column_view const&,rmm::mr::device_memory_resource*)
@@ -110,6 +145,18 @@ std::unique_ptr<column> from_timestamps(column_view const& timestamps,
                                         rmm::cuda_stream_view stream,
                                         rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc from_timestamps(strings_column_view const&,datetime_format
+ * const&,strings_column_view const&,rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> from_timestamps(column_view const& timestamps,
+                                        datetime_format const& format,
+                                        strings_column_view const& names,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr);
+
 /**
  * @copydoc to_durations(strings_column_view const&,data_type,std::string
  * const&,rmm::mr::device_memory_resource*)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,11 +22,16 @@
 #include <cudf/strings/string_view.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/scan.h>
 
+#include <limits>
 #include <mutex>
 #include <unordered_map>
 
@@ -204,6 +209,147 @@ auto make_strings_children(
   return make_strings_children(size_and_exec_fn, strings_count, strings_count, stream, mr);
 }
 
+/**
+ * @brief Writes the bytes of an output string into a buffer of limited capacity while counting
+ * all the bytes of the string.
+ *
+ * The bytes not fitting in the buffer are dropped, so the output is only complete when
+ * `bytes() <= capacity()`.
+ */
+class bounded_chars_writer {
+ public:
+  __device__ bounded_chars_writer(char* buffer, size_type capacity)
+    : _buffer{buffer}, _capacity{capacity}
+  {
+  }
+
+  /**
+   * @brief Appends `bytes` bytes of `data` to the output string.
+   */
+  __device__ void write(char const* data, size_type bytes)
+  {
+    if (_bytes + bytes <= _capacity) { memcpy(_buffer + _bytes, data, bytes); }
+    _bytes += bytes;
+  }
+
+  /**
+   * @brief Appends the bytes of `d_str` to the output string.
+   */
+  __device__ void write(string_view const& d_str) { write(d_str.data(), d_str.size_bytes()); }
+
+  /**
+   * @brief Returns the number of bytes of the output string.
+   */
+  [[nodiscard]] __device__ size_type bytes() const { return _bytes; }
+
+  /**
+   * @brief Returns the number of bytes the buffer can hold.
+   */
+  [[nodiscard]] __device__ size_type capacity() const { return _capacity; }
+
+ private:
+  char* _buffer;
+  size_type _capacity;
+  size_type _bytes{0};
+};
+
+/**
+ * @brief Creates child offsets and chars columns by executing the template function once per
+ * string into a speculatively sized buffer.
+ *
+ * Each string is first written into a slot of `capacity_fn(idx)` bytes of a temporary buffer,
+ * which also gives its exact size. The offsets are then computed from the sizes and the strings
+ * fitting their slots are copied into the chars column. Only the strings which overflowed their
+ * slot are executed a second time to write them into the chars column. This avoids evaluating
+ * expensive functions twice as `make_strings_children` does when the capacities are good
+ * estimates of the output sizes.
+ *
+ * When the slots together would not fit in a chars column, they are all left empty, which turns
+ * this into the two-pass evaluation of `make_strings_children`.
+ *
+ * @tparam WriteFunction Function accepting an index and a `bounded_chars_writer&` and writing
+ *         the output string of that index with the writer. Null entries should write nothing.
+ * @tparam CapacityFunction Function accepting an index and returning the estimated number of
+ *         bytes of its output string.
+ *
+ * @param write_fn Writes each output string. This is called once for each string and a second
+ *        time for the strings larger than their estimate.
+ * @param capacity_fn Returns the estimated size of each output string.
+ * @param strings_count Number of strings.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned columns' device memory.
+ * @return offsets child column and chars child column for a strings column
+ */
+template <typename WriteFunction, typename CapacityFunction>
+auto make_strings_children_speculative(
+  WriteFunction write_fn,
+  CapacityFunction capacity_fn,
+  size_type strings_count,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  // the slots of the strings in the temporary buffer
+  rmm::device_uvector<int64_t> slot_offsets(strings_count + 1, stream);
+  auto const d_slot_offsets = slot_offsets.data();
+  auto const capacities     = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [capacity_fn, strings_count] __device__(size_type idx) -> int64_t {
+      return idx < strings_count ? capacity_fn(idx) : 0;
+    });
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), capacities, capacities + strings_count + 1, d_slot_offsets);
+  auto slots_size = slot_offsets.element(strings_count, stream);
+  if (slots_size > static_cast<int64_t>(std::numeric_limits<size_type>::max())) {
+    // no string is written until its size is known
+    thrust::fill(rmm::exec_policy(stream), slot_offsets.begin(), slot_offsets.end(), 0);
+    slots_size = 0;
+  }
+  rmm::device_uvector<char> slots(slots_size, stream);
+  auto const d_slots = slots.data();
+
+  auto offsets_column = make_numeric_column(
+    data_type{type_id::INT32}, strings_count + 1, mask_state::UNALLOCATED, stream, mr);
+  auto d_offsets = offsets_column->mutable_view().template data<int32_t>();
+
+  // write each string into its slot and keep its size
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     strings_count,
+                     [write_fn, d_slot_offsets, d_slots, d_offsets] __device__(
+                       size_type idx) mutable {
+                       auto const capacity =
+                         static_cast<size_type>(d_slot_offsets[idx + 1] - d_slot_offsets[idx]);
+                       bounded_chars_writer writer{d_slots + d_slot_offsets[idx], capacity};
+                       write_fn(idx, writer);
+                       d_offsets[idx] = writer.bytes();
+                     });
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), d_offsets, d_offsets + strings_count + 1, d_offsets);
+
+  auto const bytes =
+    cudf::detail::get_value<int32_t>(offsets_column->view(), strings_count, stream);
+  std::unique_ptr<column> chars_column = create_chars_child_column(bytes, stream, mr);
+  if (bytes > 0) {
+    auto d_chars = chars_column->mutable_view().template data<char>();
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      strings_count,
+      [write_fn, d_slot_offsets, d_slots, d_offsets, d_chars] __device__(size_type idx) mutable {
+        auto const size     = d_offsets[idx + 1] - d_offsets[idx];
+        auto const capacity = d_slot_offsets[idx + 1] - d_slot_offsets[idx];
+        if (size <= capacity) {
+          memcpy(d_chars + d_offsets[idx], d_slots + d_slot_offsets[idx], size);
+        } else {
+          bounded_chars_writer writer{d_chars + d_offsets[idx], size};
+          write_fn(idx, writer);
+        }
+      });
+  }
+
+  return std::make_pair(std::move(offsets_column), std::move(chars_column));
+}
+
 // This template is a thin wrapper around per-context singleton objects.
 // It maintains a single object for each CUDA context.
 template <typename TableType>
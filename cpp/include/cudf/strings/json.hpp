@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,9 +16,13 @@
 #pragma once
 
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 
 #include <thrust/optional.h>
 
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace strings {
 
@@ -122,6 +126,26 @@ std::unique_ptr<cudf::column> get_json_object(
   get_json_object_options options     = get_json_object_options{},
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Apply several JSONPath strings to all rows in an input strings column.
+ *
+ * Returns the same columns as applying each JSONPath string with `get_json_object()`, but walks
+ * each json string once for all of the paths made of only the `$` `.` and `[]` operators rather
+ * than once per path. Paths with wildcards are applied one at a time.
+ *
+ * @param col The input strings column. Each row must contain a valid json string
+ * @param json_paths The JSONPath strings to be applied to each row
+ * @param options Options for controlling the behavior of the function
+ * @param mr Resource for allocating device memory.
+ * @return New table with one strings column per JSONPath string, containing the retrieved json
+ * object strings
+ */
+std::unique_ptr<cudf::table> get_json_object(
+  cudf::strings_column_view const& col,
+  std::vector<std::string> const& json_paths,
+  get_json_object_options options     = get_json_object_options{},
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
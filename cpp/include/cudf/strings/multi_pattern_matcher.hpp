@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace strings {
+/**
+ * @addtogroup strings_find
+ * @{
+ * @file
+ */
+
+/**
+ * @brief A matcher of many literal patterns, built once to search strings columns for all the
+ * patterns in a single pass over each string.
+ *
+ * The patterns are compiled into an Aho-Corasick automaton kept in device memory: the trie of
+ * their bytes, in which each node links to the node of its longest suffix also in the trie. Each
+ * byte of a string then moves down the trie, or along the links until it can, and the patterns
+ * found end at the nodes reached. Empty patterns are never found, as by `find_multiple`.
+ *
+ * Example:
+ * ```
+ * cudf::strings::multi_pattern_matcher matcher(keywords);
+ * for (auto const& batch : batches) { process(matcher.contains(batch)->view()); }
+ * ```
+ */
+class multi_pattern_matcher {
+ public:
+  multi_pattern_matcher() = delete;
+  ~multi_pattern_matcher();
+  multi_pattern_matcher(multi_pattern_matcher const&) = delete;
+  multi_pattern_matcher(multi_pattern_matcher&&)      = delete;
+  multi_pattern_matcher& operator=(multi_pattern_matcher const&) = delete;
+  multi_pattern_matcher& operator=(multi_pattern_matcher&&) = delete;
+
+  /**
+   * @brief Construct a matcher of the strings of `patterns`.
+   *
+   * @throws cudf::logic_error if `patterns` is empty or contains nulls
+   *
+   * @param patterns The patterns to search for, identified by their row index
+   * @param mr Device memory resource used to allocate the device memory of the matcher
+   */
+  multi_pattern_matcher(
+    strings_column_view const& patterns,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns the number of patterns of the matcher.
+   */
+  [[nodiscard]] size_type size() const;
+
+  /**
+   * @brief Returns the ids of the patterns found in each string.
+   *
+   * @code{.pseudo}
+   * p = ["cat", "dog", "at"]
+   * s = ["a cat", "dogs", "bird", null]
+   * r = multi_pattern_matcher(p).contains(s)
+   * r is now [[0, 2], [1], [], null]
+   * @endcode
+   *
+   * @param strings Strings to search
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return Lists column of INT32 pattern ids in increasing order, null for the null strings
+   */
+  std::unique_ptr<column> contains(
+    strings_column_view const& strings,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the character position of the first occurrence of each pattern in each
+   * string, as `find_multiple` with the patterns as targets.
+   *
+   * The output row `i * size() + j` is the position of pattern `j` in string `i`, or -1 if the
+   * pattern is not found or the string is null.
+   *
+   * @param strings Strings to search
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return New INT32 column of `strings.size() * size()` positions
+   */
+  std::unique_ptr<column> find(
+    strings_column_view const& strings,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Replaces the patterns found in each string, as `replace` with the patterns as
+   * targets.
+   *
+   * The strings are scanned from the beginning, and at each position the first pattern found
+   * starting there, in the order of the patterns, is replaced. The scan then resumes after it.
+   *
+   * @throws cudf::logic_error if `repls` contains nulls, or has neither one nor `size()` strings
+   *
+   * @param strings Strings to replace the patterns of
+   * @param repls Replacement of each pattern, or a single replacement for all of them
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return New strings column
+   */
+  std::unique_ptr<column> replace(
+    strings_column_view const& strings,
+    strings_column_view const& repls,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  struct multi_pattern_matcher_impl;
+  std::unique_ptr<multi_pattern_matcher_impl> impl;
+};
+
+/** @} */  // end of doxygen group
+}  // namespace strings
+}  // namespace cudf
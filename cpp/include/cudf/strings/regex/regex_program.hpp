@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/strings/regex/flags.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+#include <string>
+
+namespace cudf {
+namespace strings {
+
+/**
+ * @addtogroup strings_contains
+ * @{
+ */
+
+/**
+ * @brief Regex program compiled once and reused by every call of the regex APIs it is passed to.
+ *
+ * The pattern is compiled into its instructions when the program is created. The device copy of
+ * the instructions, and the working memory some patterns need to evaluate them, are made by the
+ * first call using the program and kept for the next calls.
+ *
+ * A program should not be used by several threads at once, since its device copy is made or
+ * grown by the calls using it.
+ *
+ * See the @ref md_regex "Regex Features" page for details on patterns supported.
+ */
+struct regex_program {
+  struct regex_program_impl;
+
+  /**
+   * @brief Compiles a regex pattern into a program.
+   *
+   * @throw cudf::logic_error if the pattern is invalid
+   *
+   * @param pattern Regex pattern to compile
+   * @param flags Regex flags for interpreting special characters in the pattern
+   * @return The compiled program
+   */
+  static std::unique_ptr<regex_program> create(std::string const& pattern,
+                                               regex_flags flags = regex_flags::DEFAULT);
+
+  regex_program()                     = delete;
+  regex_program(regex_program const&) = delete;
+  regex_program& operator=(regex_program const&) = delete;
+  regex_program(regex_program&& other) noexcept;
+  regex_program& operator=(regex_program&& other) noexcept;
+  ~regex_program();
+
+  /**
+   * @brief Returns the pattern the program was compiled from.
+   */
+  [[nodiscard]] std::string pattern() const;
+
+  /**
+   * @brief Returns the flags the program was compiled with.
+   */
+  [[nodiscard]] regex_flags flags() const;
+
+  /**
+   * @brief Returns the number of instructions of the program.
+   */
+  [[nodiscard]] int32_t instructions_count() const;
+
+  /**
+   * @brief Returns the number of capturing groups of the pattern.
+   */
+  [[nodiscard]] int32_t groups_count() const;
+
+ private:
+  regex_program(std::string const& pattern, regex_flags flags);
+
+  std::string _pattern;
+  regex_flags _flags;
+  std::unique_ptr<regex_program_impl> _impl;
+
+  friend struct regex_device_builder;
+};
+
+/** @} */  // end of doxygen group
+}  // namespace strings
+}  // namespace cudf
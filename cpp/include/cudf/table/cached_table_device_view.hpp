@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/detail/device_view_cache.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <memory>
+
+/**
+ * @file cached_table_device_view.hpp
+ * @brief Class keeping the device views of a table cached across operations
+ */
+
+namespace cudf {
+
+/**
+ * @brief Handle keeping the device view of a table cached, so that libcudf reuses it instead of
+ * creating it for each operation.
+ *
+ * Creating the device view of a table allocates device memory and copies the views of all its
+ * columns and their descendants to it. While a handle lives, `table_device_view::create` returns
+ * its cached view for any table equal to the source table, and `column_device_view::create`
+ * returns the cached view of any column of the source table that has children. Tables and
+ * columns are equal when their types, sizes, offsets, data and null mask pointers are, as are
+ * those of their descendants. Since the libcudf algorithms create the device views of their
+ * inputs with these factories, passing the same tables to the successive operations of a
+ * pipeline only creates their views once.
+ *
+ * The views are created on construction. Handles of equal tables, and copies of a handle, share
+ * the same views. A view returned from the cache keeps them alive, so they remain valid after the
+ * handles are destroyed while the operations using them complete. The views are freed once no
+ * handle and no returned view refers to them, on the stream that created them and after the work
+ * enqueued on other streams before their views were released. That stream must therefore outlive
+ * the views. Work using `view()` directly on another stream must complete before the last handle
+ * is destroyed. Views are neither cached nor returned from the cache on a capturing stream.
+ *
+ * The following code snippet shows a pipeline of operations on the same table.
+ * @code
+ *  auto const cached = cudf::cached_table_device_view(keys);
+ *  auto const unique = cudf::distinct_count(keys);
+ *  auto const order  = cudf::sorted_order(keys);
+ * @endcode
+ */
+class cached_table_device_view {
+ public:
+  /**
+   * @brief Creates the device views of a table, or shares those of a handle of an equal table.
+   *
+   * @throws cudf::logic_error if `stream` is capturing
+   *
+   * @param source The table to cache the device views of
+   * @param stream CUDA stream used to create and free the views, synchronized before returning
+   */
+  explicit cached_table_device_view(table_view const& source,
+                                    rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Returns the table whose device views are cached.
+   */
+  [[nodiscard]] table_view const& source() const;
+
+  /**
+   * @brief Returns the cached device view of the table.
+   *
+   * It may be passed by value to kernels like the device views returned by
+   * `table_device_view::create`.
+   */
+  [[nodiscard]] table_device_view const& view() const;
+
+ private:
+  std::shared_ptr<detail::cached_device_views const> _views;
+};
+
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/utilities/assert.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/traits.hpp>
@@ -158,6 +159,39 @@ __device__ bool equality_compare(Element const lhs, Element const rhs)
   return lhs == rhs;
 }
 
+namespace detail {
+
+/**
+ * @brief Compares the elements of the children of two lists columns, whose null elements are
+ * equal. The elements must not be nested.
+ */
+struct list_element_equality_comparator {
+  column_device_view lhs;
+  column_device_view rhs;
+
+  template <typename Element,
+            std::enable_if_t<cudf::is_equality_comparable<Element, Element>()>* = nullptr>
+  __device__ bool operator()(size_type lhs_element_index,
+                             size_type rhs_element_index) const noexcept
+  {
+    bool const lhs_is_null{lhs.is_null(lhs_element_index)};
+    bool const rhs_is_null{rhs.is_null(rhs_element_index)};
+    if (lhs_is_null or rhs_is_null) { return lhs_is_null == rhs_is_null; }
+    return equality_compare(lhs.element<Element>(lhs_element_index),
+                            rhs.element<Element>(rhs_element_index));
+  }
+
+  template <typename Element,
+            std::enable_if_t<not cudf::is_equality_comparable<Element, Element>()>* = nullptr>
+  __device__ bool operator()(size_type lhs_element_index, size_type rhs_element_index) const
+  {
+    cudf_assert(false && "Attempted to compare list elements of uncomparable types.");
+    return false;
+  }
+};
+
+}  // namespace detail
+
 /**
  * @brief Performs an equality comparison between two elements in two columns.
  *
@@ -212,8 +246,55 @@ class element_equality_comparator {
                             rhs.element<Element>(rhs_element_index));
   }
 
+  /**
+   * @brief Compares the specified lists for equality.
+   *
+   * The lists are equal if they have the same size and equal elements, where null elements are
+   * equal. Only lists of non-nested elements are supported.
+   *
+   * @param lhs_element_index The index of the first list
+   * @param rhs_element_index The index of the second list
+   * @return True if both lists are nulls and `nulls_are_equal` is true, or equal
+   */
+  template <typename Element, std::enable_if_t<std::is_same_v<Element, list_view>>* = nullptr>
+  __device__ bool operator()(size_type lhs_element_index,
+                             size_type rhs_element_index) const noexcept
+  {
+    if (nulls) {
+      bool const lhs_is_null{lhs.is_null(lhs_element_index)};
+      bool const rhs_is_null{rhs.is_null(rhs_element_index)};
+      if (lhs_is_null and rhs_is_null) {
+        return nulls_are_equal == null_equality::EQUAL;
+      } else if (lhs_is_null != rhs_is_null) {
+        return false;
+      }
+    }
+
+    auto const lhs_offsets = lhs.child(lists_column_view::offsets_column_index);
+    auto const rhs_offsets = rhs.child(lists_column_view::offsets_column_index);
+    auto const lhs_row     = lhs_element_index + lhs.offset();
+    auto const rhs_row     = rhs_element_index + rhs.offset();
+    auto const lhs_begin   = lhs_offsets.element<size_type>(lhs_row);
+    auto const rhs_begin   = rhs_offsets.element<size_type>(rhs_row);
+    auto const size        = lhs_offsets.element<size_type>(lhs_row + 1) - lhs_begin;
+    if (size != rhs_offsets.element<size_type>(rhs_row + 1) - rhs_begin) { return false; }
+
+    auto const lhs_child = lhs.child(lists_column_view::child_column_index);
+    auto const rhs_child = rhs.child(lists_column_view::child_column_index);
+    for (size_type i = 0; i < size; ++i) {
+      if (not cudf::type_dispatcher(lhs_child.type(),
+                                    detail::list_element_equality_comparator{lhs_child, rhs_child},
+                                    lhs_begin + i,
+                                    rhs_begin + i)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   template <typename Element,
-            std::enable_if_t<not cudf::is_equality_comparable<Element, Element>()>* = nullptr>
+            std::enable_if_t<not cudf::is_equality_comparable<Element, Element>() and
+                             not std::is_same_v<Element, list_view>>* = nullptr>
   __device__ bool operator()(size_type lhs_element_index, size_type rhs_element_index)
   {
     cudf_assert(false && "Attempted to compare elements of uncomparable types.");
@@ -429,18 +510,105 @@ class row_lexicographic_comparator {
  * @tparam hash_function Hash functor to use for hashing elements.
  * @tparam Nullate A cudf::nullate type describing how to check for nulls.
  */
+namespace detail {
+
+/**
+ * @brief The type of the hash values computed with `hash_function`, 32-bit `hash_value_type` for
+ * the Murmur3 and identity hashes and 64-bit for `XXHash_64` and `MurmurHash3_64`.
+ */
+template <template <typename> class hash_function>
+using hash_result_t = typename hash_function<size_type>::result_type;
+
+/**
+ * @brief Computes the hash value of an element of the child of a lists column. The elements must
+ * not be nested.
+ */
+template <template <typename> class hash_function>
+struct list_element_hasher {
+  using result_type = hash_result_t<hash_function>;
+  uint32_t seed;
+
+  template <typename T, CUDF_ENABLE_IF(column_device_view::has_element_accessor<T>())>
+  __device__ result_type operator()(column_device_view child, size_type index) const
+  {
+    if (child.is_null(index)) { return std::numeric_limits<result_type>::max(); }
+    return hash_function<T>{seed}(child.element<T>(index));
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>())>
+  __device__ result_type operator()(column_device_view child, size_type index) const
+  {
+    cudf_assert(false && "Unsupported list element type in hash.");
+    return {};
+  }
+};
+
+/**
+ * @brief Computes the hash value of a list of non-nested elements, combining the hash values of
+ * its size and of its elements.
+ */
+template <template <typename> class hash_function>
+__device__ hash_result_t<hash_function> hash_list(column_device_view col,
+                                                  size_type row_index,
+                                                  uint32_t seed)
+{
+  using result_type  = hash_result_t<hash_function>;
+  auto const offsets = col.child(lists_column_view::offsets_column_index);
+  auto const child   = col.child(lists_column_view::child_column_index);
+  auto const begin   = offsets.element<size_type>(row_index + col.offset());
+  auto const end     = offsets.element<size_type>(row_index + col.offset() + 1);
+
+  // The 32-bit hashes of the sizes and combined elements are always Murmur3, the 64-bit hash
+  // functions provide their own.
+  auto const hash_size = [seed](size_type size) -> result_type {
+    if constexpr (std::is_same_v<result_type, hash_value_type>) {
+      return MurmurHash3_32<size_type>{seed}(size);
+    } else {
+      return hash_function<size_type>{seed}(size);
+    }
+  };
+  auto const hash_combine = [](result_type lhs, result_type rhs) {
+    if constexpr (std::is_same_v<result_type, hash_value_type>) {
+      return MurmurHash3_32<hash_value_type>{}.hash_combine(lhs, rhs);
+    } else {
+      return hash_function<result_type>{}.hash_combine(lhs, rhs);
+    }
+  };
+
+  auto hash = hash_size(end - begin);
+  for (auto i = begin; i < end; ++i) {
+    hash = hash_combine(hash,
+                        type_dispatcher<dispatch_storage_type>(
+                          child.type(), list_element_hasher<hash_function>{seed}, child, i));
+  }
+  return hash;
+}
+
+}  // namespace detail
+
 template <template <typename> class hash_function, typename Nullate>
 class element_hasher {
  public:
+  using result_type = detail::hash_result_t<hash_function>;
+
   template <typename T, CUDF_ENABLE_IF(column_device_view::has_element_accessor<T>())>
-  __device__ hash_value_type operator()(column_device_view col, size_type row_index) const
+  __device__ result_type operator()(column_device_view col, size_type row_index) const
   {
-    if (has_nulls && col.is_null(row_index)) { return std::numeric_limits<hash_value_type>::max(); }
+    if (has_nulls && col.is_null(row_index)) { return std::numeric_limits<result_type>::max(); }
     return hash_function<T>{}(col.element<T>(row_index));
   }
 
-  template <typename T, CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>())>
-  __device__ hash_value_type operator()(column_device_view col, size_type row_index) const
+  template <typename T, CUDF_ENABLE_IF(std::is_same_v<T, list_view>)>
+  __device__ result_type operator()(column_device_view col, size_type row_index) const
+  {
+    if (has_nulls && col.is_null(row_index)) { return std::numeric_limits<result_type>::max(); }
+    return detail::hash_list<hash_function>(col, row_index, DEFAULT_HASH_SEED);
+  }
+
+  template <typename T,
+            CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>() and
+                           not std::is_same_v<T, list_view>)>
+  __device__ result_type operator()(column_device_view col, size_type row_index) const
   {
     cudf_assert(false && "Unsupported type in hash.");
     return {};
@@ -452,25 +620,36 @@ class element_hasher {
 template <template <typename> class hash_function, typename Nullate>
 class element_hasher_with_seed {
  public:
+  using result_type = detail::hash_result_t<hash_function>;
+
   __device__ element_hasher_with_seed(Nullate has_nulls, uint32_t seed)
     : _seed{seed}, _has_nulls{has_nulls}
   {
   }
 
-  __device__ element_hasher_with_seed(Nullate has_nulls, uint32_t seed, hash_value_type null_hash)
+  __device__ element_hasher_with_seed(Nullate has_nulls, uint32_t seed, result_type null_hash)
     : _seed{seed}, _null_hash{null_hash}, _has_nulls{has_nulls}
   {
   }
 
   template <typename T, CUDF_ENABLE_IF(column_device_view::has_element_accessor<T>())>
-  __device__ hash_value_type operator()(column_device_view col, size_type row_index) const
+  __device__ result_type operator()(column_device_view col, size_type row_index) const
   {
     if (has_nulls && col.is_null(row_index)) { return _null_hash; }
     return hash_function<T>{_seed}(col.element<T>(row_index));
   }
 
-  template <typename T, CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>())>
-  __device__ hash_value_type operator()(column_device_view col, size_type row_index) const
+  template <typename T, CUDF_ENABLE_IF(std::is_same_v<T, list_view>)>
+  __device__ result_type operator()(column_device_view col, size_type row_index) const
+  {
+    if (_has_nulls && col.is_null(row_index)) { return _null_hash; }
+    return detail::hash_list<hash_function>(col, row_index, _seed);
+  }
+
+  template <typename T,
+            CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>() and
+                           not std::is_same_v<T, list_view>)>
+  __device__ result_type operator()(column_device_view col, size_type row_index) const
   {
     cudf_assert(false && "Unsupported type in hash.");
     return {};
@@ -478,7 +657,7 @@ class element_hasher_with_seed {
 
  private:
   uint32_t _seed{DEFAULT_HASH_SEED};
-  hash_value_type _null_hash{std::numeric_limits<hash_value_type>::max()};
+  result_type _null_hash{std::numeric_limits<result_type>::max()};
   Nullate _has_nulls;
 };
 
@@ -491,6 +670,8 @@ class element_hasher_with_seed {
 template <template <typename> class hash_function, typename Nullate>
 class row_hasher {
  public:
+  using result_type = detail::hash_result_t<hash_function>;
+
   row_hasher() = delete;
   CUDF_HOST_DEVICE row_hasher(Nullate has_nulls, table_device_view t)
     : _table{t}, _has_nulls{has_nulls}
@@ -503,13 +684,13 @@ class row_hasher {
 
   __device__ auto operator()(size_type row_index) const
   {
-    auto hash_combiner = [](hash_value_type lhs, hash_value_type rhs) {
-      return hash_function<hash_value_type>{}.hash_combine(lhs, rhs);
+    auto hash_combiner = [](result_type lhs, result_type rhs) {
+      return hash_function<result_type>{}.hash_combine(lhs, rhs);
     };
 
     // Hash the first column w/ the seed
     auto const initial_hash =
-      hash_combiner(hash_value_type{0},
+      hash_combiner(result_type{0},
                     type_dispatcher<dispatch_storage_type>(
                       _table.column(0).type(),
                       element_hasher_with_seed<hash_function, Nullate>{_has_nulls, _seed},
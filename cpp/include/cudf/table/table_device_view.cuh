@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,6 +16,8 @@
 #pragma once
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/device_view_cache.hpp>
+#include <cudf/detail/utilities/stream_capture.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
@@ -33,6 +35,25 @@
 
 namespace cudf {
 namespace detail {
+/**
+ * @brief Deleter of the table device views returned by `table_device_view::create`, which only
+ * destroys the views it does not share with a `cached_table_device_view`.
+ */
+struct table_device_view_deleter {
+  std::shared_ptr<cached_device_views const> cache_owner;  ///< Owner of a cached view
+  rmm::cuda_stream_view stream;                             ///< Stream a cached view is used on
+
+  template <typename TableDeviceView>
+  void operator()(TableDeviceView* view) const
+  {
+    if (cache_owner == nullptr) {
+      view->destroy();
+    } else {
+      release_cached_device_view(*cache_owner, stream);
+    }
+  }
+};
+
 template <typename ColumnDeviceView, typename HostTableView>
 class table_device_view_base {
  public:
@@ -81,12 +102,27 @@ class table_device_view_base {
 
 class table_device_view : public detail::table_device_view_base<column_device_view, table_view> {
  public:
+  /**
+   * @brief Factory to construct a table view that is usable in device memory.
+   *
+   * Returns the cached view of an equal table while a `cached_table_device_view` of it lives,
+   * and otherwise allocates and copies views of the columns of `source_view` to device memory.
+   *
+   * @param source_view The table to make usable in device code
+   * @param stream CUDA stream used for device memory operations
+   * @return A `unique_ptr` to a `table_device_view` of `source_view`
+   */
   static auto create(table_view source_view,
                      rmm::cuda_stream_view stream = rmm::cuda_stream_default)
   {
-    auto deleter = [](table_device_view* t) { t->destroy(); };
-    return std::unique_ptr<table_device_view, decltype(deleter)>{
-      new table_device_view(source_view, stream), deleter};
+    using view_ptr = std::unique_ptr<table_device_view, detail::table_device_view_deleter>;
+    if (auto cached = detail::find_cached_device_view(source_view, stream);
+        cached.view != nullptr) {
+      return view_ptr{cached.view,
+                      detail::table_device_view_deleter{std::move(cached.owner), stream}};
+    }
+    return view_ptr{new table_device_view(source_view, stream),
+                    detail::table_device_view_deleter{}};
   }
 
  private:
@@ -145,8 +181,7 @@ auto contiguous_copy_column_device_views(HostTableView source_view, rmm::cuda_st
   auto d_columns = detail::child_columns_to_device_array<ColumnDeviceView>(
     source_view.begin(), source_view.end(), h_ptr, d_ptr);
 
-  CUDA_TRY(cudaMemcpyAsync(d_ptr, h_ptr, views_size_bytes, cudaMemcpyDefault, stream.value()));
-  stream.synchronize();
+  detail::copy_host_to_device(d_ptr, h_ptr, views_size_bytes, stream);
   return std::make_tuple(std::move(descendant_storage), d_columns);
 }
 
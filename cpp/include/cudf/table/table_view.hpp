@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -262,10 +262,15 @@ inline bool nullable(table_view const& view)
   return std::any_of(view.begin(), view.end(), [](auto const& col) { return col.nullable(); });
 }
 
-inline bool has_nulls(table_view const& view)
-{
-  return std::any_of(view.begin(), view.end(), [](auto const& col) { return col.has_nulls(); });
-}
+/**
+ * @brief Indicates if any column of the table contains null elements.
+ *
+ * The columns whose null count is unknown are counted together with a single kernel launch.
+ *
+ * @param view The table to check
+ * @return true One or more elements of a column are null
+ */
+bool has_nulls(table_view const& view);
 
 inline bool has_nested_nulls(table_view const& input)
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,7 +19,11 @@
 #include <cudf/ast/expressions.hpp>
 #include <cudf/types.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace cudf {
 /**
@@ -54,6 +58,40 @@ std::unique_ptr<column> transform(
   bool is_ptx,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Creates a new table by applying a function of several columns with several outputs
+ * against every row of an input table.
+ *
+ * Computes:
+ * `F(&out_0[i], ..., &out_m[i], in_0[i], ..., in_n[i])`
+ *
+ * where the UDF has the signature `void F(Out_0* out_0, ..., Out_m* out_m, In_0 in_0, ..., In_n
+ * in_n)`, so that the intermediates shared by the outputs are only computed once per row. The UDF
+ * is compiled once per UDF and types, and the compiled kernel is cached like that of `transform`.
+ *
+ * If `propagate_nulls` is true, the rows where any column of `input` is null are null in every
+ * output column, and the UDF is not applied to them. Otherwise the output columns have no nulls,
+ * and the UDF is applied to every row, with unspecified values for the null elements.
+ *
+ * @throws cudf::logic_error if a column of `input` or an output type is not a fixed-width type
+ * @throws cudf::logic_error if `output_types` is empty
+ *
+ * @param input         An immutable view of the input table to transform
+ * @param udf           The PTX/CUDA string of the function to apply
+ * @param output_types  The output types that are compatible with the output types in the UDF
+ * @param is_ptx        true: the UDF is treated as PTX code; false: the UDF is treated as CUDA code
+ * @param propagate_nulls Whether the rows with null inputs are null in the outputs
+ * @param mr            Device memory resource used to allocate the returned table's device memory
+ * @return              The table of the output columns of the function
+ */
+std::unique_ptr<table> transform(
+  table_view const& input,
+  std::string const& udf,
+  std::vector<data_type> const& output_types,
+  bool is_ptx,
+  bool propagate_nulls,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Creates a null_mask from `input` by converting `NaN` to null and
  * preserving existing null values and also returns new null_count.
@@ -75,16 +113,49 @@ std::pair<std::unique_ptr<rmm::device_buffer>, size_type> nans_to_nulls(
  * This evaluates an expression over a table to produce a new column. Also called an n-ary
  * transform.
  *
+ * The evaluation may be captured into a CUDA graph. Literals are then not folded, and an
+ * expression referencing a nullable column or a literal produces a nullable column whose null
+ * count is computed once the graph has been launched.
+ *
  * @throws cudf::logic_error if passed an expression operating on table_reference::RIGHT.
  *
  * @param table The table used for expression evaluation.
  * @param expr The root of the expression tree.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource.
  * @return std::unique_ptr<column> Output column.
  */
 std::unique_ptr<column> compute_column(
   table_view const& table,
   ast::expression const& expr,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Compute a new column by evaluating an expression tree on a table, with a kernel
+ * generated for the expression.
+ *
+ * The result is that of `compute_column`. Instead of interpreting the operators of the
+ * expression for each row, the expression is translated to CUDA source and JIT-compiled, once per
+ * expression and types: the compiled kernels are cached in the process and in the JIT kernel
+ * cache directory.
+ *
+ * The expressions on arithmetic and boolean columns are compiled. The others, and the expressions
+ * with null-aware operators or null literals applied to columns with nulls, are evaluated by
+ * `compute_column` instead.
+ *
+ * @throws cudf::logic_error if passed an expression operating on table_reference::RIGHT.
+ *
+ * @param table The table used for expression evaluation.
+ * @param expr The root of the expression tree.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource.
+ * @return std::unique_ptr<column> Output column.
+ */
+std::unique_ptr<column> compute_column_jit(
+  table_view const& table,
+  ast::expression const& expr,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -166,6 +237,39 @@ std::pair<std::unique_ptr<column>, table_view> one_hot_encode(
   column_view const& categories,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Encodes `input` as the sparse indices of the categories matching its elements.
+ *
+ * The output is the compressed sparse row (CSR) form of the 0/1 matrix returned by
+ * `one_hot_encode`, transposed so that rows are the input elements: a lists column with one
+ * list per element of `input`, holding the indices in `categories` of the values equal to the
+ * element. The list offsets are the row pointers and the child column the column indices. Its
+ * size is that of `input` plus the number of matches, instead of `input.size() *
+ * categories.size()`.
+ *
+ * The matches are found by binary search in the sorted categories. A null element matches the
+ * null categories. If `categories` has duplicates, the indices of a list are in sorted order of
+ * the categories, ties in their original order.
+ *
+ * Examples:
+ * @code{.pseudo}
+ * input: [{'a', 'c', null, 'c', 'b'}]
+ * categories: ['c', null]
+ * output: [{}, {0}, {1}, {0}, {}]
+ * @endcode
+ *
+ * @throws cudf::logic_error if input and categories are of different types.
+ *
+ * @param input Column containing values to be encoded
+ * @param categories Column containing categories
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A LIST column of INT32 category indices, one list per element of `input`
+ */
+std::unique_ptr<column> one_hot_encode_sparse(
+  column_view const& input,
+  column_view const& categories,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Creates a boolean column from given bitmask.
  *
@@ -222,5 +326,30 @@ std::unique_ptr<column> row_bit_count(
   table_view const& t,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the split points dividing a table into batches of rows of at most `max_bytes`.
+ *
+ * The batches are formed greedily from the first row, each one taking as many of the following
+ * rows as fit in `max_bytes`. Their sizes are the sums of the sizes computed by `row_bit_count`,
+ * so the same approximations apply: the terminating offsets of the string and list columns of
+ * each batch are not counted. A row larger than `max_bytes` forms a batch of its own.
+ *
+ * The split points are the indices of the first rows of all batches but the first, as expected
+ * by `cudf::split`. They are empty if the whole table fits in one batch.
+ *
+ * @code{.pseudo}
+ * input:     {int32: [1, 2, 3, 4, 5]}
+ * max_bytes: 8
+ * output:    [2, 4]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `max_bytes` is 0
+ *
+ * @param t The table view to divide into batches
+ * @param max_bytes Maximum size in bytes of a batch
+ * @return The indices of the rows starting the batches after the first one
+ */
+std::vector<size_type> make_batches(table_view const& t, std::size_t max_bytes);
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -31,8 +31,15 @@ namespace cudf {
  * Stores output in a contiguous column, exposing the transposed table as
  * a `table_view`.
  *
+ * Fixed-width and strings columns are transposed through tiles in shared
+ * memory, reading the input columns and writing the output rows coalesced.
+ * Strings are transposed by their sizes, from which the output offsets are
+ * computed before their chars are copied. Columns of other types are
+ * interleaved element by element.
+ *
  * @throw cudf::logic_error if column types are non-homogenous
- * @throw cudf::logic_error if column types are non-fixed-width
+ * @throw cudf::logic_error if the transposed table has more elements than
+ *        the maximum size of a column
  *
  * @param[in] input A table (M cols x N rows) to be transposed.
  * @param[in] mr Device memory resource used to allocate the device memory of returned value
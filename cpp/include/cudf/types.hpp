@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -334,7 +334,11 @@ enum class hash_id {
   HASH_MURMUR3,         ///< Murmur3 hash function
   HASH_MD5,             ///< MD5 hash function
   HASH_SERIAL_MURMUR3,  ///< Serial Murmur3 hash function
-  HASH_SPARK_MURMUR3    ///< Spark Murmur3 hash function
+  HASH_SPARK_MURMUR3,   ///< Spark Murmur3 hash function
+  HASH_XXHASH64,        ///< 64-bit xxHash hash function
+  HASH_MURMUR3_64,      ///< 64-bit Murmur3 hash function, half of the 128-bit MurmurHash3_x64_128
+  HASH_SHA1,            ///< SHA-1 hash function
+  HASH_SHA256           ///< SHA-256 hash function
 };
 
 /**
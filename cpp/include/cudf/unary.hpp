@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,7 +17,11 @@
 #pragma once
 
 #include <cudf/types.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
 #include <memory>
+#include <vector>
 
 namespace cudf {
 /**
@@ -113,6 +117,47 @@ std::unique_ptr<column> cast(
   data_type out_type,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Policy for the elements of a table cast that cannot be converted to the output type.
+ */
+enum class cast_error_policy : bool {
+  FAIL,    ///< The cast throws if any element cannot be converted
+  NULLIFY  ///< The elements that cannot be converted are null in the output
+};
+
+/**
+ * @brief Casts the columns of a table to the types specified for each of them.
+ *
+ * The columns are converted with one kernel launch per pair of input and output types, which also
+ * checks the conversions: a valid element cannot be converted when it is a string that is not
+ * a number of the output type, or a number out of the range of the output type, in which case the
+ * cast fails or the output element is null as specified by `error_policy`.
+ *
+ * The conversions checked are:
+ * - from strings to integers, floating-point and fixed-point types, parsed as by
+ *   `strings::to_integers`, `strings::to_floats` and `strings::to_fixed_point`
+ * - between integers and floating-point types, where NaNs and infinities cannot be converted to
+ *   integers and finite doubles cannot overflow floats
+ *
+ * The other columns are cast one by one by `cudf::cast`, without checking the conversions.
+ *
+ * @throw cudf::logic_error if the number of types does not match the number of columns
+ * @throw cudf::logic_error if `error_policy` is `FAIL` and an element cannot be converted
+ * @throw cudf::logic_error if a column cannot be cast to its output type
+ *
+ * @param input Input table
+ * @param out_types Desired data types of the output columns
+ * @param error_policy What to do with the elements that cannot be converted
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @returns Table of the columns of `input` cast to `out_types`
+ */
+std::unique_ptr<table> cast(
+  table_view const& input,
+  std::vector<data_type> const& out_types,
+  cast_error_policy error_policy      = cast_error_policy::FAIL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Creates a column of `type_id::BOOL8` elements indicating the presence of `NaN` values
  * in a column of floating point values.
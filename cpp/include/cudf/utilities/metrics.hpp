@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Opt-in registry of the calls made to libcudf
+ * @file metrics.hpp
+ */
+
+namespace cudf {
+namespace metrics {
+
+/**
+ * @brief Metrics accumulated for one public API or IO reader stage.
+ */
+struct api_metrics {
+  std::string name;  ///< Name of the API, the same as that of its NVTX range, or of the stage
+  std::size_t calls{0};        ///< Number of completed calls
+  std::size_t timed_calls{0};  ///< Number of calls whose GPU time is included in `gpu_time_ms`
+  double gpu_time_ms{0};       ///< Sum of the GPU times of the timed calls, in milliseconds
+  int64_t bytes{0};            ///< Sum of the bytes of the inputs of the calls, when recorded
+  std::size_t peak_temporary_bytes{0};  ///< Largest temporary arena reserved by one call
+};
+
+/**
+ * @brief Returns whether calls are recorded.
+ *
+ * Recording is disabled unless the `LIBCUDF_METRICS` environment variable is set to a value other
+ * than `0` when libcudf is first called, or `set_enabled(true)` is called.
+ */
+bool is_enabled();
+
+/**
+ * @brief Enables or disables the recording of calls.
+ *
+ * Calls in progress when the setting changes are recorded according to the previous setting.
+ *
+ * @param enabled Whether calls are recorded
+ */
+void set_enabled(bool enabled);
+
+/**
+ * @brief Returns the metrics accumulated since the start of the process or the last `reset()`,
+ * sorted by name.
+ *
+ * Only the outermost public API called by a thread is recorded; the APIs it calls internally are
+ * part of its own metrics. The GPU time of a call is measured between CUDA events recorded on its
+ * stream when it starts and returns, and is only included once the work of the call has completed
+ * on the device, which this function does not wait for. Calls made while their stream is
+ * capturing are not timed.
+ *
+ * @return Metrics of each API and IO reader stage called at least once
+ */
+std::vector<api_metrics> snapshot();
+
+/**
+ * @brief Discards the metrics accumulated so far.
+ */
+void reset();
+
+}  // namespace metrics
+}  // namespace cudf
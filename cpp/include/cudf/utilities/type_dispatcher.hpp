@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -322,6 +322,71 @@ using scalar_type_t = typename type_to_scalar_type_impl<T>::ScalarType;
 template <typename T>
 using scalar_device_type_t = typename type_to_scalar_type_impl<T>::ScalarDeviceType;
 
+/**
+ * @brief Returns whether `type_dispatcher` dispatches the type of `id` in this build of libcudf.
+ *
+ * All the types are dispatched unless the build excludes some of them with the
+ * `CUDF_EXCLUDED_DISPATCH_TYPES` CMake option, which defines `CUDF_DISPATCH_EXCLUDE_<ID>` for
+ * each excluded `type_id::<ID>`. The callables are not instantiated for the excluded types, which
+ * shrinks the device code of libcudf, and dispatching one throws a `cudf::logic_error`.
+ *
+ * Only the types that libcudf never dispatches internally can be excluded: `INT16`, `UINT16`, the
+ * timestamps, the durations and the decimals.
+ *
+ * @param id The `type_id` to check
+ * @return `true` if the type of `id` is dispatched
+ */
+CUDF_HOST_DEVICE constexpr bool is_dispatched_type([[maybe_unused]] type_id id)
+{
+  return
+#ifdef CUDF_DISPATCH_EXCLUDE_INT16
+         id != type_id::INT16 and
+#endif
+#ifdef CUDF_DISPATCH_EXCLUDE_UINT16
+         id != type_id::UINT16 and
+#endif
+#ifdef CUDF_DISPATCH_EXCLUDE_TIMESTAMP_DAYS
+         id != type_id::TIMESTAMP_DAYS and
+#endif
+#ifdef CUDF_DISPATCH_EXCLUDE_TIMESTAMP_SECONDS
+         id != type_id::TIMESTAMP_SECONDS and
+#endif
+#ifdef CUDF_DISPATCH_EXCLUDE_TIMESTAMP_MILLISECONDS
+         id != type_id::TIMESTAMP_MILLISECONDS and
+#endif
+#ifdef CUDF_DISPATCH_EXCLUDE_TIMESTAMP_MICROSECONDS
+         id != type_id::TIMESTAMP_MICROSECONDS and
+#endif
+#ifdef CUDF_DISPATCH_EXCLUDE_TIMESTAMP_NANOSECONDS
+         id != type_id::TIMESTAMP_NANOSECONDS and
+#endif
+#ifdef CUDF_DISPATCH_EXCLUDE_DURATION_DAYS
+         id != type_id::DURATION_DAYS and
+#endif
+#ifdef CUDF_DISPATCH_EXCLUDE_DURATION_SECONDS
+         id != type_id::DURATION_SECONDS and
+#endif
+#ifdef CUDF_DISPATCH_EXCLUDE_DURATION_MILLISECONDS
+         id != type_id::DURATION_MILLISECONDS and
+#endif
+#ifdef CUDF_DISPATCH_EXCLUDE_DURATION_MICROSECONDS
+         id != type_id::DURATION_MICROSECONDS and
+#endif
+#ifdef CUDF_DISPATCH_EXCLUDE_DURATION_NANOSECONDS
+         id != type_id::DURATION_NANOSECONDS and
+#endif
+#ifdef CUDF_DISPATCH_EXCLUDE_DECIMAL32
+         id != type_id::DECIMAL32 and
+#endif
+#ifdef CUDF_DISPATCH_EXCLUDE_DECIMAL64
+         id != type_id::DECIMAL64 and
+#endif
+#ifdef CUDF_DISPATCH_EXCLUDE_DECIMAL128
+         id != type_id::DECIMAL128 and
+#endif
+         true;
+}
+
 /**
  * @brief Invokes an `operator()` template with the type instantiation based on
  * the specified `cudf::data_type`'s `id()`.
@@ -432,8 +497,11 @@ CUDF_HOST_DEVICE __forceinline__ constexpr decltype(auto) type_dispatcher(cudf::
       return f.template operator()<typename IdTypeMap<type_id::INT8>::type>(
         std::forward<Ts>(args)...);
     case type_id::INT16:
-      return f.template operator()<typename IdTypeMap<type_id::INT16>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::INT16)) {
+        return f.template operator()<typename IdTypeMap<type_id::INT16>::type>(
+          std::forward<Ts>(args)...);
+      }
+      break;
     case type_id::INT32:
       return f.template operator()<typename IdTypeMap<type_id::INT32>::type>(
         std::forward<Ts>(args)...);
@@ -444,8 +512,11 @@ CUDF_HOST_DEVICE __forceinline__ constexpr decltype(auto) type_dispatcher(cudf::
       return f.template operator()<typename IdTypeMap<type_id::UINT8>::type>(
         std::forward<Ts>(args)...);
     case type_id::UINT16:
-      return f.template operator()<typename IdTypeMap<type_id::UINT16>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::UINT16)) {
+        return f.template operator()<typename IdTypeMap<type_id::UINT16>::type>(
+          std::forward<Ts>(args)...);
+      }
+      break;
     case type_id::UINT32:
       return f.template operator()<typename IdTypeMap<type_id::UINT32>::type>(
         std::forward<Ts>(args)...);
@@ -462,35 +533,65 @@ CUDF_HOST_DEVICE __forceinline__ constexpr decltype(auto) type_dispatcher(cudf::
       return f.template operator()<typename IdTypeMap<type_id::STRING>::type>(
         std::forward<Ts>(args)...);
     case type_id::TIMESTAMP_DAYS:
-      return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_DAYS>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::TIMESTAMP_DAYS)) {
+        return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_DAYS>::type>(
+          std::forward<Ts>(args)...);
+      }
+      break;
     case type_id::TIMESTAMP_SECONDS:
-      return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_SECONDS>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::TIMESTAMP_SECONDS)) {
+        return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_SECONDS>::type>(
+          std::forward<Ts>(args)...);
+      }
+      break;
     case type_id::TIMESTAMP_MILLISECONDS:
-      return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_MILLISECONDS>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::TIMESTAMP_MILLISECONDS)) {
+        return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_MILLISECONDS>::type>(
+          std::forward<Ts>(args)...);
+      }
+      break;
     case type_id::TIMESTAMP_MICROSECONDS:
-      return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_MICROSECONDS>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::TIMESTAMP_MICROSECONDS)) {
+        return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_MICROSECONDS>::type>(
+          std::forward<Ts>(args)...);
+      }
+      break;
     case type_id::TIMESTAMP_NANOSECONDS:
-      return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_NANOSECONDS>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::TIMESTAMP_NANOSECONDS)) {
+        return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_NANOSECONDS>::type>(
+          std::forward<Ts>(args)...);
+      }
+      break;
     case type_id::DURATION_DAYS:
-      return f.template operator()<typename IdTypeMap<type_id::DURATION_DAYS>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::DURATION_DAYS)) {
+        return f.template operator()<typename IdTypeMap<type_id::DURATION_DAYS>::type>(
+          std::forward<Ts>(args)...);
+      }
+      break;
     case type_id::DURATION_SECONDS:
-      return f.template operator()<typename IdTypeMap<type_id::DURATION_SECONDS>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::DURATION_SECONDS)) {
+        return f.template operator()<typename IdTypeMap<type_id::DURATION_SECONDS>::type>(
+          std::forward<Ts>(args)...);
+      }
+      break;
     case type_id::DURATION_MILLISECONDS:
-      return f.template operator()<typename IdTypeMap<type_id::DURATION_MILLISECONDS>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::DURATION_MILLISECONDS)) {
+        return f.template operator()<typename IdTypeMap<type_id::DURATION_MILLISECONDS>::type>(
+          std::forward<Ts>(args)...);
+      }
+      break;
     case type_id::DURATION_MICROSECONDS:
-      return f.template operator()<typename IdTypeMap<type_id::DURATION_MICROSECONDS>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::DURATION_MICROSECONDS)) {
+        return f.template operator()<typename IdTypeMap<type_id::DURATION_MICROSECONDS>::type>(
+          std::forward<Ts>(args)...);
+      }
+      break;
     case type_id::DURATION_NANOSECONDS:
-      return f.template operator()<typename IdTypeMap<type_id::DURATION_NANOSECONDS>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::DURATION_NANOSECONDS)) {
+        return f.template operator()<typename IdTypeMap<type_id::DURATION_NANOSECONDS>::type>(
+          std::forward<Ts>(args)...);
+      }
+      break;
     case type_id::DICTIONARY32:
       return f.template operator()<typename IdTypeMap<type_id::DICTIONARY32>::type>(
         std::forward<Ts>(args)...);
@@ -498,34 +599,45 @@ CUDF_HOST_DEVICE __forceinline__ constexpr decltype(auto) type_dispatcher(cudf::
       return f.template operator()<typename IdTypeMap<type_id::LIST>::type>(
         std::forward<Ts>(args)...);
     case type_id::DECIMAL32:
-      return f.template operator()<typename IdTypeMap<type_id::DECIMAL32>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::DECIMAL32)) {
+        return f.template operator()<typename IdTypeMap<type_id::DECIMAL32>::type>(
+          std::forward<Ts>(args)...);
+      }
+      break;
     case type_id::DECIMAL64:
-      return f.template operator()<typename IdTypeMap<type_id::DECIMAL64>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::DECIMAL64)) {
+        return f.template operator()<typename IdTypeMap<type_id::DECIMAL64>::type>(
+          std::forward<Ts>(args)...);
+      }
+      break;
     case type_id::DECIMAL128:
-      return f.template operator()<typename IdTypeMap<type_id::DECIMAL128>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::DECIMAL128)) {
+        return f.template operator()<typename IdTypeMap<type_id::DECIMAL128>::type>(
+          std::forward<Ts>(args)...);
+      }
+      break;
     case type_id::STRUCT:
       return f.template operator()<typename IdTypeMap<type_id::STRUCT>::type>(
         std::forward<Ts>(args)...);
-    default: {
+    default: break;
+  }
 #ifndef __CUDA_ARCH__
-      CUDF_FAIL("Unsupported type_id.");
+  if (not is_dispatched_type(dtype.id())) {
+    CUDF_FAIL("Type excluded from dispatch by CUDF_EXCLUDED_DISPATCH_TYPES.");
+  }
+  CUDF_FAIL("Unsupported type_id.");
 #else
-      cudf_assert(false && "Unsupported type_id.");
+  cudf_assert(false && "Unsupported type_id.");
 
-      // The following code will never be reached, but the compiler generates a
-      // warning if there isn't a return value.
+  // The following code will never be reached, but the compiler generates a
+  // warning if there isn't a return value.
 
-      // Need to find out what the return type is in order to have a default
-      // return value and solve the compiler warning for lack of a default
-      // return
-      using return_type = decltype(f.template operator()<int8_t>(std::forward<Ts>(args)...));
-      return return_type();
+  // Need to find out what the return type is in order to have a default
+  // return value and solve the compiler warning for lack of a default
+  // return
+  using return_type = decltype(f.template operator()<int8_t>(std::forward<Ts>(args)...));
+  return return_type();
 #endif
-    }
-  }
 }
 
 namespace detail {
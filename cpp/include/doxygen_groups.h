@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -98,10 +98,12 @@
  *   @defgroup column_reshape Reshaping
  *   @{
  *     @defgroup reshape_transpose Transpose
+ *     @defgroup reshape_row_conversion Row Conversion
  *   @}
  *   @defgroup column_reorder Reordering
  *   @{
  *     @defgroup reorder_partition Partitioning
+ *     @defgroup reorder_shuffle Shuffling
  *     @defgroup reorder_compact Stream Compaction
  *   @}
  *   @defgroup column_interop Interop
@@ -150,6 +152,7 @@
  *   @defgroup lists_gather Gathering
  *   @defgroup lists_elements Counting
  *   @defgroup lists_drop_duplicates Filtering
+ *   @defgroup lists_set_operations Set Operations
  *   @defgroup lists_sort Sorting
  * @}
  * @defgroup nvtext_apis NVText
@@ -160,6 +163,7 @@
  *   @defgroup nvtext_edit_distance Edit Distance
  *   @defgroup nvtext_tokenize Tokenizing
  *   @defgroup nvtext_replace Replacing
+ *   @defgroup nvtext_minhash MinHashing
  * @}
  * @defgroup utility_apis Utilities
  * @{
@@ -167,6 +171,7 @@
  *   @defgroup utility_dispatcher Type Dispatcher
  *   @defgroup utility_bitmask Bitmask
  *   @defgroup utility_error Exception
+ *   @defgroup utility_spill Spilling
  * @}
  * @defgroup labeling_apis Labeling
  * @{
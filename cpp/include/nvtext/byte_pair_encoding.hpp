@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cstdint>
+#include <memory>
+
+namespace nvtext {
+
+/**
+ * @addtogroup nvtext_tokenize
+ * @{
+ * @file
+ */
+
+/**
+ * @brief The merge pairs and the tokens of a byte-level byte-pair encoding, kept in device
+ * memory for use with the byte_pair_encoding function.
+ *
+ * The merge pairs and the tokens are inserted in hash tables keyed by a 64-bit hash of their
+ * bytes. Every key found is checked against the bytes of the pair or token it refers to.
+ */
+class bpe_vocabulary {
+ public:
+  bpe_vocabulary() = delete;
+  ~bpe_vocabulary();
+  bpe_vocabulary(bpe_vocabulary const&) = delete;
+  bpe_vocabulary(bpe_vocabulary&&)      = delete;
+  bpe_vocabulary& operator=(bpe_vocabulary const&) = delete;
+  bpe_vocabulary& operator=(bpe_vocabulary&&) = delete;
+
+  /**
+   * @brief Construct the vocabulary of a byte-pair encoding.
+   *
+   * The merge pairs are the rows of `merge_left` and `merge_right`, in the order they are
+   * applied: the pair of row 0 is merged before any other. The id of each token is its row in
+   * `tokens`. The bytes of both are those of the input strings, without the mapping of the
+   * bytes to printable characters of some vocabulary files.
+   *
+   * @throw cudf::logic_error if `merge_left` and `merge_right` do not have the same size
+   * @throw cudf::logic_error if any of the columns contain nulls
+   *
+   * @param merge_left The left token of each merge pair.
+   * @param merge_right The right token of each merge pair.
+   * @param tokens The tokens identified by their row index.
+   * @param unknown_token_id The id given to the encoded tokens not in `tokens`.
+   * @param mr Memory resource to allocate the device memory of the vocabulary.
+   */
+  bpe_vocabulary(cudf::strings_column_view const& merge_left,
+                 cudf::strings_column_view const& merge_right,
+                 cudf::strings_column_view const& tokens,
+                 uint32_t unknown_token_id,
+                 rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns the number of merge pairs of the vocabulary.
+   */
+  [[nodiscard]] cudf::size_type merges_count() const;
+
+  /**
+   * @brief Returns the number of tokens of the vocabulary.
+   */
+  [[nodiscard]] cudf::size_type tokens_count() const;
+
+  struct bpe_vocabulary_impl;
+
+ private:
+  std::unique_ptr<bpe_vocabulary_impl> impl;
+
+  friend std::unique_ptr<cudf::column> byte_pair_encoding(cudf::strings_column_view const&,
+                                                          bpe_vocabulary const&,
+                                                          rmm::mr::device_memory_resource*);
+};
+
+/**
+ * @brief Encodes the strings into the ids of the tokens of a byte-level byte-pair encoding.
+ *
+ * Each string is first split into words: the runs of non-space bytes along with the space
+ * before them, as well as the runs of spaces not followed by a word. The bytes of each word are
+ * then merged, separately from the other words and in parallel over the words, by applying the
+ * merge pairs in their order until none of the pairs of adjacent tokens of the word can be
+ * merged. All the occurrences of the pair applied are merged at once, from left to right.
+ *
+ * @code{.pseudo}
+ * merges = [("l", "o"), ("lo", "w"), (" ", "low")]
+ * tokens = ["l", "o", "w", " ", "e", "r", "lo", "low", " low"]
+ * s = ["lower low", "", null]
+ * t = byte_pair_encoding(s, bpe_vocabulary(merges, tokens))
+ * t is now [[7, 4, 5, 8], [], null]
+ * @endcode
+ *
+ * The ids are of type UINT32, as the token-ids of `subword_tokenize`. A null input row produces
+ * a null list row in the output.
+ *
+ * @param strings The input strings to encode.
+ * @param vocabulary The merge pairs and tokens of the encoding.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return Lists column of the token ids of each string
+ */
+std::unique_ptr<cudf::column> byte_pair_encoding(
+  cudf::strings_column_view const& strings,
+  bpe_vocabulary const& vocabulary,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace nvtext
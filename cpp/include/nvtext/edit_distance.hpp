@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -34,6 +34,9 @@ namespace nvtext {
  * This edit distance calculation uses the Levenshtein algorithm as documented here:
  * https://www.cuelogic.com/blog/the-levenshtein-algorithm
  *
+ * The distances are computed with the bit-parallel algorithm of Myers, processing the
+ * characters of the shorter string 64 at a time.
+ *
  * @code{.pseudo}
  * Example:
  * s = ["hello", "", "world"]
@@ -61,11 +64,44 @@ std::unique_ptr<cudf::column> edit_distance(
   cudf::strings_column_view const& targets,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Compute the edit distance between individual strings in two strings columns,
+ * up to a maximum distance.
+ *
+ * This is the same as `edit_distance` except that any distance greater than `max_distance`
+ * is returned as `max_distance + 1`. The calculation for a pair of strings stops as soon as
+ * its distance is known to be greater than `max_distance`.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["hello", "", "world"]
+ * t = ["hallo", "goodbye", "world"]
+ * d = edit_distance(s, t, 2)
+ * d is now [1, 3, 0]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `targets.size() != strings.size()` and
+ *                          if `targets.size() != 1`
+ * @throw cudf::logic_error if `max_distance < 0`
+ *
+ * @param strings Strings column of input strings
+ * @param targets Strings to compute edit distance against `strings`
+ * @param max_distance The largest distance to compute exactly
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New INT32 column of edit distance values.
+ */
+std::unique_ptr<cudf::column> edit_distance(
+  cudf::strings_column_view const& strings,
+  cudf::strings_column_view const& targets,
+  cudf::size_type max_distance,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Compute the edit distance between all the strings in the input column.
  *
  * This uses the Levenshtein algorithm to calculate the edit distance between
  * two strings as documented here: https://www.cuelogic.com/blog/the-levenshtein-algorithm
+ * The distances are computed as by `edit_distance`.
  *
  * The output is essentially a `strings.size() x strings.size()` square matrix of integers.
  * All values at diagonal `row == col` are 0 since the edit distance between two identical
@@ -97,5 +133,35 @@ std::unique_ptr<cudf::column> edit_distance_matrix(
   cudf::strings_column_view const& strings,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Compute the edit distance between all the strings in the input column,
+ * up to a maximum distance.
+ *
+ * This is the same as `edit_distance_matrix` except that any distance greater than
+ * `max_distance` is returned as `max_distance + 1`. The calculation for a pair of strings
+ * stops as soon as its distance is known to be greater than `max_distance`.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["hello", "hallo", "goodbye"]
+ * d = edit_distance_matrix(s, 2)
+ * d is now [[0, 1, 3],
+ *           [1, 0, 3]
+ *           [3, 3, 0]]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `strings.size() == 1`
+ * @throw cudf::logic_error if `max_distance < 0`
+ *
+ * @param strings Strings column of input strings
+ * @param max_distance The largest distance to compute exactly
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New lists column of edit distance values.
+ */
+std::unique_ptr<cudf::column> edit_distance_matrix(
+  cudf::strings_column_view const& strings,
+  cudf::size_type max_distance,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
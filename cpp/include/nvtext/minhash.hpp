@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+namespace nvtext {
+/**
+ * @addtogroup nvtext_minhash
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Returns the MinHash signature of each string.
+ *
+ * The shingles of a string are its ngrams of `width` characters, as produced by
+ * `generate_character_ngrams`. A string with fewer characters than `width` is a single shingle.
+ * The signature of a string is, for each seed, the minimum of the MurmurHash3 hashes of its
+ * shingles with that seed. The shingles are hashed in place in a single pass over the characters
+ * and are never copied to a column.
+ *
+ * ```
+ * s = ["abcde", null]
+ * t = minhash(s, [seed0, seed1], 4)
+ * t is now [[min(h0("abcd"), h0("bcde")), min(h1("abcd"), h1("bcde"))], null]
+ * ```
+ *
+ * @throw cudf::logic_error if `width < 2`
+ * @throw cudf::logic_error if `seeds` is empty, is not of type UINT32, or contains nulls
+ *
+ * @param strings Strings column to compute the signatures of.
+ * @param seeds The seeds of the hashes of each signature.
+ * @param width The number of characters of each shingle.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return Lists column of the `seeds.size()` UINT32 hashes of each string, null for null strings
+ */
+std::unique_ptr<cudf::column> minhash(
+  cudf::strings_column_view const& strings,
+  cudf::column_view const& seeds,
+  cudf::size_type width               = 4,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the pairs of rows sharing a band of their MinHash signatures.
+ *
+ * The hashes of each signature are split into `bands` consecutive bands of the same size, and
+ * the rows whose signatures agree on all the hashes of any band are buckets of candidate
+ * near-duplicates in the locality-sensitive hashing scheme. The bands are hashed to 32 bits, so
+ * that a few pairs may not share a band; the candidates are meant to be checked further.
+ *
+ * ```
+ * s = [[1, 2, 3, 4], [1, 2, 5, 6], [7, 8, 5, 6], [9, 9, 9, 9]]
+ * t = minhash_candidates(s, 2)
+ * t is now {[0, 1], [1, 2]}
+ * ```
+ *
+ * The null rows are not candidates of any pair.
+ *
+ * @throw cudf::logic_error if `bands < 1`
+ * @throw cudf::logic_error if `signatures` is not a lists column of UINT32
+ * @throw cudf::logic_error if the non-null signatures do not all have the same number of hashes
+ * @throw cudf::logic_error if the number of hashes of the signatures is not a multiple of `bands`
+ *
+ * @param signatures The signatures of the rows, as returned by `minhash`.
+ * @param bands The number of bands of each signature.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return Table of two INT32 columns, the first and second rows of each pair, with the first less
+ *         than the second and the pairs in increasing order
+ */
+std::unique_ptr<cudf::table> minhash_candidates(
+  cudf::lists_column_view const& signatures,
+  cudf::size_type bands,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace nvtext
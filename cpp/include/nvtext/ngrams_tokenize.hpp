@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -83,5 +83,41 @@ std::unique_ptr<cudf::column> ngrams_tokenize(
   cudf::string_scalar const& separator = cudf::string_scalar{"_"},
   rmm::mr::device_memory_resource* mr  = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a single column of strings by normalizing the characters of the input strings,
+ * tokenizing them on whitespace and then producing ngrams of each string.
+ *
+ * The result is the same as
+ * `ngrams_tokenize(normalize_characters(normalize_spaces(strings), do_lower_case), ngrams)`
+ * with the `separator` given, but the normalized strings are never built. The characters are
+ * normalized once to locate the tokens and measure them, and once more when the ngrams are
+ * written, so that only the positions and sizes of the tokens are kept in between.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["The  Cat sat.", "Hi", "Éé ab cd"]
+ * t = normalized_ngrams_tokenize(s, 2)
+ * t is now ["the_cat", "cat_sat", "sat_.", "ee_ab", "ab_cd"]
+ * @endcode
+ *
+ * All null row entries are ignored and the output contains all valid rows.
+ *
+ * @param strings Strings column to normalize, tokenize and produce ngrams from.
+ * @param ngrams The ngram number to generate.
+ *               Default is 2 = bigram.
+ * @param do_lower_case If true, upper-case characters are converted to lower-case and accents
+ *                      are stripped from the characters, as by `normalize_characters`.
+ * @param separator The string to use for separating ngram tokens.
+ *                  Default is "_" character.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New strings columns of tokens.
+ */
+std::unique_ptr<cudf::column> normalized_ngrams_tokenize(
+  cudf::strings_column_view const& strings,
+  cudf::size_type ngrams               = 2,
+  bool do_lower_case                   = true,
+  cudf::string_scalar const& separator = cudf::string_scalar{"_"},
+  rmm::mr::device_memory_resource* mr  = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,8 +19,11 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
 #include <cstdint>
 #include <cstring>
+#include <memory>
 
 namespace nvtext {
 
@@ -158,5 +161,82 @@ tokenizer_result subword_tokenize(
   uint32_t max_rows_tensor,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief A subword tokenizer keeping its vocabulary and the tables of the normalizer resident in
+ * device memory, for tokenizing many batches of strings with little fixed cost per call.
+ *
+ * The tables are copied to the device once, by the constructor, and are only read by the calls
+ * of `tokenize`. The calls may therefore run concurrently, on different streams, from several
+ * host threads.
+ *
+ * Example:
+ * ```
+ * nvtext::subword_tokenizer tokenizer(nvtext::load_vocabulary_file(filename));
+ * for (auto const& batch : batches) {
+ *   process(tokenizer.tokenize(batch, 64, 64, true, true, stream));
+ * }
+ * ```
+ */
+class subword_tokenizer {
+ public:
+  subword_tokenizer() = delete;
+  ~subword_tokenizer();
+  subword_tokenizer(subword_tokenizer const&) = delete;
+  subword_tokenizer(subword_tokenizer&&)      = delete;
+  subword_tokenizer& operator=(subword_tokenizer const&) = delete;
+  subword_tokenizer& operator=(subword_tokenizer&&) = delete;
+
+  /**
+   * @brief Construct a tokenizer using the given vocabulary.
+   *
+   * @throw cudf::logic_error if `vocabulary` is null
+   *
+   * @param vocabulary The vocabulary loaded by `load_vocabulary_file`.
+   */
+  explicit subword_tokenizer(std::unique_ptr<hashed_vocabulary> vocabulary);
+
+  /**
+   * @brief Returns the vocabulary of the tokenizer.
+   */
+  [[nodiscard]] hashed_vocabulary const& vocabulary() const;
+
+  /**
+   * @brief Tokenizes the strings into token-ids as `subword_tokenize`.
+   *
+   * The output vectors are sized from the number of tokens found in each string, so no bound on
+   * the number of their rows is needed.
+   *
+   * @throw cudf::logic_error if `stride > max_sequence_length`
+   * @throw cudf::logic_error if the output token-ids are more than the max value for
+   *        cudf::size_type
+   *
+   * @param strings The input strings to tokenize.
+   * @param max_sequence_length Limit of the number of token-ids per row in final tensor
+   *        for each string.
+   * @param stride Each row in the output token-ids will replicate `max_sequence_length - stride`
+   *        the token-ids from the previous row, unless it is the first string.
+   * @param do_lower_case If true, the tokenizer will convert uppercase characters in the
+   *        input stream to lower-case and strip accents from those characters.
+   *        If false, accented and uppercase characters are not transformed.
+   * @param do_truncate If true, the tokenizer will discard all the token-ids after
+   *        `max_sequence_length` for each input string. If false, it will use a new row
+   *        in the output token-ids to continue generating the output.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Memory resource to allocate any returned objects.
+   * @return token-ids, attention-mask, and metadata
+   */
+  tokenizer_result tokenize(
+    cudf::strings_column_view const& strings,
+    uint32_t max_sequence_length,
+    uint32_t stride,
+    bool do_lower_case,
+    bool do_truncate,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  std::unique_ptr<hashed_vocabulary> _vocabulary;
+};
+
 /** @} */  // end of group
 }  // namespace nvtext
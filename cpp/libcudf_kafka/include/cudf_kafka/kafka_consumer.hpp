@@ -17,24 +17,45 @@
 
 #include "kafka_callback.hpp"
 
+#include <cudf/column/column.hpp>
 #include <cudf/io/datasource.hpp>
+#include <cudf/table/table.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 
 #include <librdkafka/rdkafkacpp.h>
 
+#include <cuda_runtime_api.h>
+
 #include <algorithm>
 #include <chrono>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace cudf {
 namespace io {
 namespace external {
 namespace kafka {
 
+/**
+ * @brief Range of messages to consume from a partition of a Kafka topic
+ */
+struct partition_range {
+  int partition;         ///< Partition index, between `0` and `TOPIC_NUM_PARTITIONS - 1`
+  int64_t start_offset;  ///< Offset of the first message to consume
+  int64_t end_offset;    ///< Offset past the last message to consume
+};
+
 /**
  * @brief libcudf datasource for Apache Kafka
  *
+ * The messages of all the partitions are consumed when the datasource is created, each partition
+ * from its own thread, into a single pinned host buffer. Host reads return views of that buffer,
+ * which the readers then copy to the device at the bandwidth of pinned memory.
+ *
  * @ingroup io_datasources
  */
 class kafka_consumer : public cudf::io::datasource {
@@ -92,6 +113,32 @@ class kafka_consumer : public cudf::io::datasource {
                  int batch_timeout,
                  std::string const& delimiter);
 
+  /**
+   * @brief Instantiate a Kafka consumer object that consumes from several partitions of a topic in
+   * parallel.
+   *
+   * The messages of the partitions follow each other in the data of the datasource, in the order
+   * of `partitions`.
+   *
+   * @param configs key/value pairs of librdkafka configurations that will be
+   *                passed to the librdkafka client
+   * @param python_callable `python_callable_type` pointer to a Python functools.partial object
+   * @param callable_wrapper `kafka_oauth_callback_wrapper_type` Cython wrapper that will
+   *                 be used to invoke the `python_callable`
+   * @param topic_name name of the Kafka topic to consume from
+   * @param partitions ranges of messages to consume, one per partition
+   * @param batch_timeout maximum (millisecond) read time allowed. If the end offsets are not
+   * reached before batch_timeout, a smaller subset will be returned
+   * @param delimiter optional delimiter to insert into the output between kafka messages, Ex: "\n"
+   */
+  kafka_consumer(std::map<std::string, std::string> configs,
+                 python_callable_type python_callable,
+                 kafka_oauth_callback_wrapper_type callable_wrapper,
+                 std::string const& topic_name,
+                 std::vector<partition_range> partitions,
+                 int batch_timeout,
+                 std::string const& delimiter);
+
   /**
    * @brief Returns a buffer with a subset of data from Kafka Topic
    *
@@ -120,6 +167,85 @@ class kafka_consumer : public cudf::io::datasource {
    */
   size_t host_read(size_t offset, size_t size, uint8_t* dst) override;
 
+  /**
+   * @brief Whether or not this source supports reading directly into device memory.
+   *
+   * @return bool Always true; the data is copied from pinned host memory
+   */
+  bool supports_device_read() const override { return true; }
+
+  /**
+   * @brief Returns a device buffer with a subset of data from Kafka Topic
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   * @param[in] stream CUDA stream to use
+   *
+   * @return The data buffer in the device memory
+   */
+  std::unique_ptr<cudf::io::datasource::buffer> device_read(size_t offset,
+                                                            size_t size,
+                                                            rmm::cuda_stream_view stream) override;
+
+  /**
+   * @brief Reads a selected range into preallocated device memory.
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   * @param[in] dst Address of the existing device memory
+   * @param[in] stream CUDA stream to use
+   *
+   * @return The number of bytes read (can be smaller than size)
+   */
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override;
+
+  /**
+   * @brief Returns the number of messages consumed
+   *
+   * @return size_t The number of messages
+   */
+  size_t num_messages() const { return message_offsets.size(); }
+
+  /**
+   * @brief Returns the consumed messages as a strings column, one row per message.
+   *
+   * The delimiter is not part of the strings. This saves parsing the data with a reader when each
+   * message is a single value.
+   *
+   * @throws cudf::logic_error if the messages are too large for a strings column
+   *
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches
+   * @param[in] mr Device memory resource used to allocate the returned column's device memory
+   *
+   * @return Strings column with the payload of each message
+   */
+  std::unique_ptr<cudf::column> to_strings_column(
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the consumed messages as a table, one row per message.
+   *
+   * The table holds three columns: the payloads, as in `to_strings_column`; the keys, as strings
+   * that are null for the messages without a key; and the timestamps of the messages, as
+   * `TIMESTAMP_MILLISECONDS`, null when the broker did not provide one. Each strings column is
+   * built from the offsets recorded during consumption, with a single copy of its characters to
+   * the device.
+   *
+   * @throws cudf::logic_error if the payloads or keys are too large for a strings column
+   *
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches
+   * @param[in] mr Device memory resource used to allocate the returned table's device memory
+   *
+   * @return Table of the payload, key, and timestamp of each message
+   */
+  std::unique_ptr<cudf::table> to_table(
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
   /**
    * @brief Commits an offset to a specified Kafka Topic/Partition instance
    *
@@ -201,25 +327,31 @@ class kafka_consumer : public cudf::io::datasource {
   kafka_oauth_callback_wrapper_type callable_wrapper_;
 
   std::string topic_name;
-  int partition;
-  int64_t start_offset;
-  int64_t end_offset;
+  std::vector<partition_range> partitions;
   int batch_timeout;
   int default_timeout = 10000;  // milliseconds
   std::string delimiter;
 
-  std::string buffer;
+  std::unique_ptr<char, decltype(&cudaFreeHost)> buffer{nullptr, cudaFreeHost};  // Pinned
+  size_t buffer_size = 0;
+  std::vector<size_t> message_offsets;  // Start of each message in `buffer`
+  std::vector<size_t> message_sizes;    // Size of each message, without the delimiter
 
- private:
-  RdKafka::ErrorCode update_consumer_topic_partition_assignment(std::string const& topic,
-                                                                int partition,
-                                                                int64_t offset);
+  std::vector<char> keys;           // Keys of the messages, one after the other
+  std::vector<size_t> key_sizes;    // Size of the key of each message
+  std::vector<bool> has_key;        // Whether each message has a key
+  std::vector<int64_t> timestamps;  // Timestamp of each message, in milliseconds
+  std::vector<bool> has_timestamp;  // Whether each message has a timestamp
 
+ private:
   /**
    * Convenience method for getting "now()" in Kafka's standard format
    */
   int64_t now();
 
+  /**
+   * @brief Consumes the messages of all the partitions, in parallel, into `buffer`
+   */
   void consume_to_buffer();
 };
 
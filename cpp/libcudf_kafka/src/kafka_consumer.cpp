@@ -15,10 +15,20 @@
  */
 #include "cudf_kafka/kafka_consumer.hpp"
 
+#include <cudf/column/column_factories.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/bit.hpp>
+
+#include <rmm/device_buffer.hpp>
+
 #include <librdkafka/rdkafkacpp.h>
 
 #include <chrono>
+#include <cstring>
+#include <future>
+#include <limits>
 #include <memory>
+#include <numeric>
 
 namespace cudf {
 namespace io {
@@ -67,13 +77,28 @@ kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
                                int64_t end_offset,
                                int batch_timeout,
                                std::string const& delimiter)
+  : kafka_consumer(configs,
+                   python_callable,
+                   callback_wrapper,
+                   topic_name,
+                   {{partition, start_offset, end_offset}},
+                   batch_timeout,
+                   delimiter)
+{
+}
+
+kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
+                               python_callable_type python_callable,
+                               kafka_oauth_callback_wrapper_type callback_wrapper,
+                               std::string const& topic_name,
+                               std::vector<partition_range> partitions,
+                               int batch_timeout,
+                               std::string const& delimiter)
   : configs(configs),
     python_callable_(python_callable),
     callable_wrapper_(callback_wrapper),
     topic_name(topic_name),
-    partition(partition),
-    start_offset(start_offset),
-    end_offset(end_offset),
+    partitions(std::move(partitions)),
     batch_timeout(batch_timeout),
     delimiter(delimiter),
     kafka_conf(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL))
@@ -109,51 +134,253 @@ kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
 
 std::unique_ptr<cudf::io::datasource::buffer> kafka_consumer::host_read(size_t offset, size_t size)
 {
-  if (offset > buffer.size()) { return 0; }
-  size = std::min(size, buffer.size() - offset);
-  return std::make_unique<non_owning_buffer>((uint8_t*)buffer.data() + offset, size);
+  if (offset > buffer_size) { return std::make_unique<non_owning_buffer>(); }
+  size = std::min(size, buffer_size - offset);
+  return std::make_unique<non_owning_buffer>(reinterpret_cast<uint8_t*>(buffer.get()) + offset,
+                                             size);
 }
 
 size_t kafka_consumer::host_read(size_t offset, size_t size, uint8_t* dst)
 {
-  if (offset > buffer.size()) { return 0; }
-  auto const read_size = std::min(size, buffer.size() - offset);
-  memcpy(dst, buffer.data() + offset, size);
+  if (offset > buffer_size) { return 0; }
+  auto const read_size = std::min(size, buffer_size - offset);
+  std::memcpy(dst, buffer.get() + offset, read_size);
   return read_size;
 }
 
-size_t kafka_consumer::size() const { return buffer.size(); }
+std::unique_ptr<cudf::io::datasource::buffer> kafka_consumer::device_read(
+  size_t offset, size_t size, rmm::cuda_stream_view stream)
+{
+  rmm::device_buffer out_data(offset > buffer_size ? 0 : std::min(size, buffer_size - offset),
+                              stream);
+  device_read(offset, out_data.size(), static_cast<uint8_t*>(out_data.data()), stream);
+  return datasource::buffer::create(std::move(out_data));
+}
+
+size_t kafka_consumer::device_read(size_t offset,
+                                   size_t size,
+                                   uint8_t* dst,
+                                   rmm::cuda_stream_view stream)
+{
+  if (offset > buffer_size) { return 0; }
+  auto const read_size = std::min(size, buffer_size - offset);
+  CUDA_TRY(cudaMemcpyAsync(
+    dst, buffer.get() + offset, read_size, cudaMemcpyHostToDevice, stream.value()));
+  stream.synchronize();
+  return read_size;
+}
+
+size_t kafka_consumer::size() const { return buffer_size; }
+
+namespace {
+
+/**
+ * @brief Messages consumed from one partition
+ */
+struct partition_messages {
+  std::vector<char> data;       // Payloads, each followed by the delimiter
+  std::vector<size_t> offsets;  // Start of each message in `data`
+  std::vector<size_t> sizes;    // Size of each message, without the delimiter
+  // Keys and timestamps, as in `kafka_consumer`
+  std::vector<char> keys;
+  std::vector<size_t> key_sizes;
+  std::vector<bool> has_key;
+  std::vector<int64_t> timestamps;
+  std::vector<bool> has_timestamp;
+};
+
+/**
+ * @brief Copies a host validity vector to a device null mask
+ *
+ * @return The null mask, empty if all the elements are valid, and the null count
+ */
+std::pair<rmm::device_buffer, cudf::size_type> make_null_mask(std::vector<bool> const& valid,
+                                                              rmm::cuda_stream_view stream,
+                                                              rmm::mr::device_memory_resource* mr)
+{
+  auto const size       = static_cast<cudf::size_type>(valid.size());
+  auto const null_count =
+    static_cast<cudf::size_type>(std::count(valid.begin(), valid.end(), false));
+  if (null_count == 0) { return {rmm::device_buffer{}, 0}; }
+
+  auto const mask_size = cudf::bitmask_allocation_size_bytes(size);
+  std::vector<cudf::bitmask_type> mask(mask_size / sizeof(cudf::bitmask_type), 0);
+  for (cudf::size_type i = 0; i < size; ++i) {
+    if (valid[i]) { cudf::set_bit_unsafe(mask.data(), i); }
+  }
+  rmm::device_buffer null_mask(mask.data(), mask_size, stream, mr);
+  stream.synchronize();
+  return {std::move(null_mask), null_count};
+}
 
 /**
- * Change the TOPPAR assignment for this consumer instance
+ * @brief Copies strings laid out one after the other in host memory to a strings column
+ *
+ * @param chars The characters of the strings
+ * @param sizes Size of each string
+ * @param valid Whether each string is valid; empty if all of them are
  */
-RdKafka::ErrorCode kafka_consumer::update_consumer_topic_partition_assignment(
-  std::string const& topic, int partition, int64_t offset)
+std::unique_ptr<cudf::column> make_host_strings_column(char const* chars,
+                                                       std::vector<size_t> const& sizes,
+                                                       std::vector<bool> const& valid,
+                                                       rmm::cuda_stream_view stream,
+                                                       rmm::mr::device_memory_resource* mr)
 {
-  std::vector<RdKafka::TopicPartition*> topic_partitions;
-  topic_partitions.push_back(RdKafka::TopicPartition::create(topic, partition, offset));
-  return consumer.get()->assign(topic_partitions);
+  auto const num_chars = std::accumulate(sizes.begin(), sizes.end(), static_cast<size_t>(0));
+  CUDF_EXPECTS(num_chars <= static_cast<size_t>(std::numeric_limits<cudf::size_type>::max()),
+               "Kafka messages are too large for a strings column");
+
+  std::vector<cudf::size_type> offsets(sizes.size() + 1, 0);
+  std::inclusive_scan(sizes.begin(), sizes.end(), offsets.begin() + 1);
+  auto offsets_column = std::make_unique<cudf::column>(
+    cudf::data_type{cudf::type_id::INT32},
+    static_cast<cudf::size_type>(offsets.size()),
+    rmm::device_buffer(offsets.data(), offsets.size() * sizeof(cudf::size_type), stream, mr));
+  auto chars_column =
+    std::make_unique<cudf::column>(cudf::data_type{cudf::type_id::INT8},
+                                   static_cast<cudf::size_type>(num_chars),
+                                   rmm::device_buffer(chars, num_chars, stream, mr));
+  auto [null_mask, null_count] = make_null_mask(valid, stream, mr);
+  // The host data is released on return
+  stream.synchronize();
+  return cudf::make_strings_column(static_cast<cudf::size_type>(sizes.size()),
+                                   std::move(offsets_column),
+                                   std::move(chars_column),
+                                   null_count,
+                                   std::move(null_mask));
+}
+
+}  // namespace
+
+std::unique_ptr<cudf::column> kafka_consumer::to_strings_column(
+  rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr) const
+{
+  // Without a delimiter, the messages already follow each other in the pinned buffer
+  if (delimiter.empty()) {
+    return make_host_strings_column(buffer.get(), message_sizes, {}, stream, mr);
+  }
+
+  std::vector<char> chars;
+  chars.reserve(buffer_size - num_messages() * delimiter.size());
+  for (size_t i = 0; i < num_messages(); ++i) {
+    auto const message = buffer.get() + message_offsets[i];
+    chars.insert(chars.end(), message, message + message_sizes[i]);
+  }
+  return make_host_strings_column(chars.data(), message_sizes, {}, stream, mr);
+}
+
+std::unique_ptr<cudf::table> kafka_consumer::to_table(rmm::cuda_stream_view stream,
+                                                      rmm::mr::device_memory_resource* mr) const
+{
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(to_strings_column(stream, mr));
+  columns.push_back(make_host_strings_column(keys.data(), key_sizes, has_key, stream, mr));
+
+  auto [null_mask, null_count] = make_null_mask(has_timestamp, stream, mr);
+  columns.push_back(std::make_unique<cudf::column>(
+    cudf::data_type{cudf::type_id::TIMESTAMP_MILLISECONDS},
+    static_cast<cudf::size_type>(timestamps.size()),
+    rmm::device_buffer(timestamps.data(), timestamps.size() * sizeof(int64_t), stream, mr),
+    std::move(null_mask),
+    null_count));
+  stream.synchronize();
+  return std::make_unique<cudf::table>(std::move(columns));
 }
 
 void kafka_consumer::consume_to_buffer()
 {
-  update_consumer_topic_partition_assignment(topic_name, partition, start_offset);
-
-  int64_t messages_read = 0;
-  auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_timeout);
-
-  while (messages_read < end_offset - start_offset && end > std::chrono::steady_clock::now()) {
-    std::unique_ptr<RdKafka::Message> msg{
-      consumer->consume((end - std::chrono::steady_clock::now()).count())};
-
-    if (msg->err() == RdKafka::ErrorCode::ERR_NO_ERROR) {
-      buffer.append(static_cast<char*>(msg->payload()));
-      buffer.append(delimiter);
-      messages_read++;
-    } else if (msg->err() == RdKafka::ErrorCode::ERR__PARTITION_EOF) {
-      // If there are no more messages return
-      break;
+  // All the partitions are assigned together, then each of them is consumed from its own queue
+  std::vector<RdKafka::TopicPartition*> toppars;
+  for (auto const& range : partitions) {
+    toppars.push_back(
+      RdKafka::TopicPartition::create(topic_name, range.partition, range.start_offset));
+  }
+  auto const assign_result = consumer->assign(toppars);
+  std::vector<std::unique_ptr<RdKafka::Queue>> queues;
+  if (assign_result == RdKafka::ErrorCode::ERR_NO_ERROR) {
+    for (auto const* toppar : toppars) {
+      queues.emplace_back(consumer->get_partition_queue(toppar));
+      // Keep the messages of the partition in its queue instead of the queue of the consumer
+      if (queues.back() != nullptr) { queues.back()->forward(nullptr); }
+    }
+  }
+  RdKafka::TopicPartition::destroy(toppars);
+  CUDF_EXPECTS(assign_result == RdKafka::ErrorCode::ERR_NO_ERROR,
+               "Failed to assign the Kafka topic partitions");
+  CUDF_EXPECTS(std::all_of(queues.begin(), queues.end(), [](auto& q) { return q != nullptr; }),
+               "Failed to get the Kafka partition queues");
+
+  auto const end = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_timeout);
+  auto consume_partition = [&](size_t i) {
+    partition_messages messages;
+    auto const num_messages = partitions[i].end_offset - partitions[i].start_offset;
+    while (static_cast<int64_t>(messages.offsets.size()) < num_messages) {
+      auto const remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                               end - std::chrono::steady_clock::now())
+                               .count();
+      if (remaining <= 0) { break; }
+      std::unique_ptr<RdKafka::Message> msg{queues[i]->consume(static_cast<int>(remaining))};
+
+      if (msg->err() == RdKafka::ErrorCode::ERR_NO_ERROR) {
+        auto const payload = static_cast<char const*>(msg->payload());
+        messages.offsets.push_back(messages.data.size());
+        messages.sizes.push_back(msg->len());
+        messages.data.insert(messages.data.end(), payload, payload + msg->len());
+        messages.data.insert(messages.data.end(), delimiter.begin(), delimiter.end());
+
+        auto const key = static_cast<char const*>(msg->key_pointer());
+        messages.keys.insert(messages.keys.end(), key, key + (key ? msg->key_len() : 0));
+        messages.key_sizes.push_back(key ? msg->key_len() : 0);
+        messages.has_key.push_back(key != nullptr);
+        auto const timestamp = msg->timestamp();
+        messages.timestamps.push_back(timestamp.timestamp);
+        messages.has_timestamp.push_back(timestamp.type !=
+                                         RdKafka::MessageTimestamp::MSG_TIMESTAMP_NOT_AVAILABLE);
+      } else if (msg->err() == RdKafka::ErrorCode::ERR__PARTITION_EOF) {
+        // If there are no more messages return
+        break;
+      }
+    }
+    return messages;
+  };
+
+  std::vector<partition_messages> consumed;
+  {
+    std::vector<std::future<partition_messages>> tasks;
+    for (size_t i = 0; i < partitions.size(); ++i) {
+      tasks.push_back(std::async(std::launch::async, consume_partition, i));
+    }
+    for (auto& task : tasks) {
+      consumed.push_back(task.get());
+    }
+  }
+
+  // Gather the messages of all the partitions into a single pinned buffer
+  buffer_size = std::accumulate(
+    consumed.begin(), consumed.end(), static_cast<size_t>(0), [](size_t sum, auto const& part) {
+      return sum + part.data.size();
+    });
+  if (buffer_size > 0) {
+    char* ptr = nullptr;
+    CUDA_TRY(cudaMallocHost(&ptr, buffer_size));
+    buffer.reset(ptr);
+  }
+  size_t buffer_offset = 0;
+  for (auto const& part : consumed) {
+    if (not part.data.empty()) {
+      std::memcpy(buffer.get() + buffer_offset, part.data.data(), part.data.size());
+    }
+    for (size_t m = 0; m < part.offsets.size(); ++m) {
+      message_offsets.push_back(buffer_offset + part.offsets[m]);
     }
+    buffer_offset += part.data.size();
+    message_sizes.insert(message_sizes.end(), part.sizes.begin(), part.sizes.end());
+    keys.insert(keys.end(), part.keys.begin(), part.keys.end());
+    key_sizes.insert(key_sizes.end(), part.key_sizes.begin(), part.key_sizes.end());
+    has_key.insert(has_key.end(), part.has_key.begin(), part.has_key.end());
+    timestamps.insert(timestamps.end(), part.timestamps.begin(), part.timestamps.end());
+    has_timestamp.insert(
+      has_timestamp.end(), part.has_timestamp.begin(), part.has_timestamp.end());
   }
 }
 
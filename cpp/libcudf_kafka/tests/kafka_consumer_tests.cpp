@@ -19,6 +19,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <cudf/io/csv.hpp>
 #include <cudf/io/datasource.hpp>
@@ -66,3 +67,18 @@ TEST_F(KafkaDatasourceTest, InvalidConfigValues)
       kafka_configs, python_callable, callback_wrapper, "csv-topic", 0, 0, 3, 5000, "\n"),
     cudf::logic_error);
 }
+
+TEST_F(KafkaDatasourceTest, MultiplePartitionsMissingGroupID)
+{
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs["bootstrap.servers"] = "localhost:9092";
+
+  kafka::python_callable_type python_callable;
+  kafka::kafka_oauth_callback_wrapper_type callback_wrapper;
+
+  std::vector<kafka::partition_range> const partitions{{0, 0, 3}, {1, 0, 3}};
+  EXPECT_THROW(
+    kafka::kafka_consumer kc(
+      kafka_configs, python_callable, callback_wrapper, "csv-topic", partitions, 5000, "\n"),
+    cudf::logic_error);
+}
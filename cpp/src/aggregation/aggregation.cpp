@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -224,6 +224,24 @@ std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
   return visit(col_type, static_cast<aggregation const&>(agg));
 }
 
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, hll_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, merge_hll_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, approx_nunique_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
 // aggregation_finalizer ----------------------------------------
 
 void aggregation_finalizer::visit(aggregation const& agg) {}
@@ -388,6 +406,21 @@ void aggregation_finalizer::visit(merge_tdigest_aggregation const& agg)
   visit(static_cast<aggregation const&>(agg));
 }
 
+void aggregation_finalizer::visit(hll_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
+void aggregation_finalizer::visit(merge_hll_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
+void aggregation_finalizer::visit(approx_nunique_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
 }  // namespace detail
 
 std::vector<std::unique_ptr<aggregation>> aggregation::get_simple_aggregations(
@@ -752,6 +785,33 @@ template std::unique_ptr<aggregation> make_merge_tdigest_aggregation<aggregation
 template std::unique_ptr<groupby_aggregation> make_merge_tdigest_aggregation<groupby_aggregation>(
   int max_centroids);
 
+template <typename Base>
+std::unique_ptr<Base> make_hll_aggregation(int precision)
+{
+  return std::make_unique<detail::hll_aggregation>(precision);
+}
+template std::unique_ptr<aggregation> make_hll_aggregation<aggregation>(int precision);
+template std::unique_ptr<groupby_aggregation> make_hll_aggregation<groupby_aggregation>(
+  int precision);
+
+template <typename Base>
+std::unique_ptr<Base> make_merge_hll_aggregation(int precision)
+{
+  return std::make_unique<detail::merge_hll_aggregation>(precision);
+}
+template std::unique_ptr<aggregation> make_merge_hll_aggregation<aggregation>(int precision);
+template std::unique_ptr<groupby_aggregation> make_merge_hll_aggregation<groupby_aggregation>(
+  int precision);
+
+template <typename Base>
+std::unique_ptr<Base> make_approx_nunique_aggregation(int precision)
+{
+  return std::make_unique<detail::approx_nunique_aggregation>(precision);
+}
+template std::unique_ptr<aggregation> make_approx_nunique_aggregation<aggregation>(int precision);
+template std::unique_ptr<groupby_aggregation> make_approx_nunique_aggregation<groupby_aggregation>(
+  int precision);
+
 namespace detail {
 namespace {
 struct target_type_functor {
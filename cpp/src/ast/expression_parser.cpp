@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,16 +16,22 @@
 #include <cudf/ast/detail/expression_parser.hpp>
 #include <cudf/ast/detail/operators.hpp>
 #include <cudf/ast/expressions.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/stream_capture.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <thrust/iterator/transform_iterator.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 
@@ -35,6 +41,57 @@ namespace ast {
 
 namespace detail {
 
+namespace {
+
+/**
+ * @brief Creates the literal of a scalar that is the value of a constant expression.
+ */
+struct make_literal_fn {
+  template <typename T, std::enable_if_t<cudf::is_numeric<T>()>* = nullptr>
+  std::unique_ptr<literal> operator()(cudf::scalar& value)
+  {
+    return std::make_unique<literal>(static_cast<cudf::numeric_scalar<T>&>(value));
+  }
+
+  template <typename T, std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
+  std::unique_ptr<literal> operator()(cudf::scalar& value)
+  {
+    return std::make_unique<literal>(static_cast<cudf::timestamp_scalar<T>&>(value));
+  }
+
+  template <typename T, std::enable_if_t<cudf::is_duration<T>()>* = nullptr>
+  std::unique_ptr<literal> operator()(cudf::scalar& value)
+  {
+    return std::make_unique<literal>(static_cast<cudf::duration_scalar<T>&>(value));
+  }
+
+  template <typename T,
+            std::enable_if_t<!cudf::is_numeric<T>() && !cudf::is_chrono<T>()>* = nullptr>
+  std::unique_ptr<literal> operator()(cudf::scalar&)
+  {
+    CUDF_FAIL("Unsupported type of constant expression.");
+  }
+};
+
+/**
+ * @brief Appends the literals of an expression, returning false if it references a column.
+ */
+bool collect_literals(expression const& expr, std::vector<literal const*>& literals)
+{
+  if (auto const lit = dynamic_cast<literal const*>(&expr)) {
+    literals.push_back(lit);
+    return true;
+  }
+  auto const op = dynamic_cast<operation const*>(&expr);
+  if (op == nullptr) { return false; }
+  auto const operands = op->get_operands();
+  return std::all_of(operands.cbegin(), operands.cend(), [&literals](auto const& operand) {
+    return collect_literals(operand.get(), literals);
+  });
+}
+
+}  // namespace
+
 device_data_reference::device_data_reference(device_data_reference_type reference_type,
                                              cudf::data_type data_type,
                                              cudf::size_type data_index,
@@ -133,6 +190,14 @@ cudf::size_type expression_parser::visit(column_reference const& expr)
 
 cudf::size_type expression_parser::visit(operation const& expr)
 {
+  // A constant subexpression is replaced by the literal of its value.
+  if (_expression_count > 0 && is_constant(expr)) { return fold(expr).accept(*this); }
+  // An equivalent subexpression that was already evaluated is reused.
+  auto const key = subexpression_key(expr);
+  if (auto const it = _subexpressions.find(key); it != _subexpressions.end()) {
+    _expression_count++;
+    return it->second;
+  }
   // Increment the expression index
   auto const expression_index = _expression_count++;
   // Visit children (operands) of this expression
@@ -156,8 +221,7 @@ cudf::size_type expression_parser::visit(operation const& expr)
     [this](auto const& data_reference_index) {
       auto const operand_source = _data_references[data_reference_index];
       if (operand_source.reference_type == detail::device_data_reference_type::INTERMEDIATE) {
-        auto const intermediate_index = operand_source.data_index;
-        _intermediate_counter.give(intermediate_index);
+        release_intermediate(operand_source.data_index);
       }
     });
   // Resolve expression type
@@ -180,11 +244,16 @@ cudf::size_type expression_parser::visit(operation const& expr)
                                                         : sizeof(IntermediateDataType<false>))) {
         CUDF_FAIL("The output data type is too large to be stored in an intermediate.");
       }
+      auto const intermediate_index = _intermediate_counter.take();
+      auto const uses               = _subexpression_uses.find(key);
+      _intermediate_uses[intermediate_index] =
+        uses != _subexpression_uses.end() ? uses->second : 1;
       return detail::device_data_reference(
-        detail::device_data_reference_type::INTERMEDIATE, data_type, _intermediate_counter.take());
+        detail::device_data_reference_type::INTERMEDIATE, data_type, intermediate_index);
     }
   }();
   auto const index = add_data_reference(output);
+  if (expression_index != 0) { _subexpressions[key] = index; }
   // Insert source indices from all operands (sources) and this operator (destination)
   _operator_source_indices.insert(_operator_source_indices.end(),
                                   operand_data_ref_indices.cbegin(),
@@ -223,6 +292,71 @@ cudf::size_type expression_parser::add_data_reference(detail::device_data_refere
   }
 }
 
+std::string expression_parser::subexpression_key(expression const& expr) const
+{
+  if (auto const lit = dynamic_cast<literal const*>(&expr)) {
+    return "L" + std::to_string(reinterpret_cast<std::uintptr_t>(&lit->get_scalar()));
+  }
+  if (auto const col = dynamic_cast<column_reference const*>(&expr)) {
+    return "C" + std::to_string(static_cast<int>(col->get_table_source())) + ":" +
+           std::to_string(col->get_column_index());
+  }
+  auto const& op = dynamic_cast<operation const&>(expr);
+  auto key       = "O" + std::to_string(static_cast<int>(op.get_operator())) + "(";
+  for (auto const& operand : op.get_operands()) {
+    key += subexpression_key(operand.get()) + ",";
+  }
+  return key + ")";
+}
+
+void expression_parser::count_subexpressions(expression const& expr, bool is_root)
+{
+  auto const op = dynamic_cast<operation const*>(&expr);
+  if (op == nullptr || (!is_root && is_constant(expr))) { return; }
+  if (++_subexpression_uses[subexpression_key(expr)] > 1) { return; }
+  for (auto const& operand : op->get_operands()) {
+    count_subexpressions(operand.get(), false);
+  }
+}
+
+bool expression_parser::is_constant(expression const& expr) const
+{
+  // Folding reads the validity of the literals and the folded value on the host
+  if (cudf::detail::is_capturing(_stream)) { return false; }
+  auto literals = std::vector<literal const*>{};
+  return collect_literals(expr, literals) &&
+         std::all_of(literals.cbegin(), literals.cend(), [this](auto const& lit) {
+           return lit->get_scalar().is_valid(_stream);
+         });
+}
+
+literal const& expression_parser::fold(expression const& expr)
+{
+  if (auto const lit = dynamic_cast<literal const*>(&expr)) { return *lit; }
+  auto const& op = dynamic_cast<operation const&>(expr);
+  auto operands  = std::vector<std::reference_wrapper<expression const>>{};
+  for (auto const& operand : op.get_operands()) {
+    operands.push_back(fold(operand.get()));
+  }
+  // Evaluate the operator on the literals of its operands over a single row.
+  auto const folded = operands.size() == 1
+                        ? operation(op.get_operator(), operands[0].get())
+                        : operation(op.get_operator(), operands[0].get(), operands[1].get());
+  auto const row =
+    make_fixed_width_column(data_type{type_id::INT8}, 1, mask_state::UNALLOCATED, _stream);
+  auto const result = cudf::detail::compute_column(table_view{{row->view()}}, folded, _stream);
+  _folded_scalars.push_back(cudf::detail::get_element(result->view(), 0, _stream));
+  _folded_literals.push_back(
+    cudf::type_dispatcher(result->type(), make_literal_fn{}, *_folded_scalars.back()));
+  return *_folded_literals.back();
+}
+
+void expression_parser::release_intermediate(cudf::size_type intermediate_index)
+{
+  auto& uses = _intermediate_uses[intermediate_index];
+  if (--uses == 0) { _intermediate_counter.give(intermediate_index); }
+}
+
 }  // namespace detail
 
 }  // namespace ast
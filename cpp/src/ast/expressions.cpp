@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,6 +16,7 @@
 #include <cudf/ast/detail/expression_parser.hpp>
 #include <cudf/ast/detail/operators.hpp>
 #include <cudf/ast/expressions.hpp>
+#include <cudf/detail/utilities/stream_capture.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/table_view.hpp>
@@ -53,6 +54,23 @@ cudf::size_type operation::accept(detail::expression_parser& visitor) const
   return visitor.visit(*this);
 }
 
+// While capturing, the validity of literals and the null counts of columns are not read on the
+// host, and expressions on nullable inputs are assumed to produce nulls
+bool literal::may_evaluate_null(table_view const& left,
+                                table_view const& right,
+                                rmm::cuda_stream_view stream) const
+{
+  return cudf::detail::is_capturing(stream) || !is_valid(stream);
+}
+
+bool column_reference::may_evaluate_null(table_view const& left,
+                                         table_view const& right,
+                                         rmm::cuda_stream_view stream) const
+{
+  auto const& column = (table_source == table_reference::LEFT ? left : right).column(column_index);
+  return cudf::detail::is_capturing(stream) ? column.nullable() : column.has_nulls();
+}
+
 }  // namespace ast
 
 }  // namespace cudf
@@ -30,6 +30,7 @@
 #include <cudf/detail/binaryop.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/stream_capture.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
@@ -41,7 +42,9 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 #include <thrust/optional.h>
 
@@ -58,6 +61,16 @@ rmm::device_buffer scalar_col_valid_mask_and(column_view const& col,
 {
   if (col.is_empty()) return rmm::device_buffer{0, stream, mr};
 
+  if (cudf::detail::is_capturing(stream)) {
+    // The validity of the scalar cannot be read on the host while capturing
+    auto mask = col.nullable()
+                  ? cudf::detail::copy_bitmask(col, stream, mr)
+                  : cudf::detail::create_null_mask(col.size(), mask_state::ALL_VALID, stream, mr);
+    cudf::detail::nullify_if_invalid(
+      static_cast<bitmask_type*>(mask.data()), col.size(), s.validity_data(), stream);
+    return mask;
+  }
+
   if (not s.is_valid(stream)) {
     return cudf::detail::create_null_mask(col.size(), mask_state::ALL_NULL, stream, mr);
   } else if (s.is_valid(stream) and col.nullable()) {
@@ -125,28 +138,59 @@ bool is_same_scale_necessary(binary_operator op)
   return op != binary_operator::MUL && op != binary_operator::DIV;
 }
 
+/**
+ * @brief Returns the type of the result of an operator of a chain that is not the last operator.
+ */
+data_type chained_result_type(binary_operator op, data_type lhs, data_type rhs)
+{
+  if (is_comparison_binop(op) or op == binary_operator::LOGICAL_AND or
+      op == binary_operator::LOGICAL_OR or op == binary_operator::NULL_LOGICAL_AND or
+      op == binary_operator::NULL_LOGICAL_OR) {
+    return data_type{type_id::BOOL8};
+  }
+  if (is_fixed_point(lhs) and is_fixed_point(rhs)) {
+    return binary_operation_fixed_point_output_type(op, lhs, rhs);
+  }
+  if (is_timestamp(lhs) and is_duration(rhs)) { return lhs; }
+  auto const common_type = compiled::get_common_type(lhs, lhs, rhs);
+  CUDF_EXPECTS(common_type.has_value(), "Unsupported operator for these types");
+  return *common_type;
+}
+
 namespace jit {
-void binary_operation(mutable_column_view& out,
-                      column_view const& lhs,
-                      column_view const& rhs,
-                      const std::string& ptx,
-                      rmm::cuda_stream_view stream)
+bool is_type_supported_ptx(data_type type)
+{
+  return is_fixed_width(type) and not is_fixed_point(type) and
+         type.id() != type_id::INT8;  // Numba PTX doesn't support int8
+}
+
+auto get_binary_operation_kernel(data_type output_type,
+                                 data_type lhs_type,
+                                 data_type rhs_type,
+                                 std::string const& ptx)
 {
-  std::string const output_type_name = cudf::jit::get_type_name(out.type());
+  std::string const output_type_name = cudf::jit::get_type_name(output_type);
 
-  std::string ptx_hash =
-    "prog_binop." + std::to_string(std::hash<std::string>{}(ptx + output_type_name));
   std::string cuda_source =
     cudf::jit::parse_single_function_ptx(ptx, "GENERIC_BINARY_OP", output_type_name);
 
   std::string kernel_name = jitify2::reflection::Template("cudf::binops::jit::kernel_v_v")
                               .instantiate(output_type_name,  // list of template arguments
-                                           cudf::jit::get_type_name(lhs.type()),
-                                           cudf::jit::get_type_name(rhs.type()),
+                                           cudf::jit::get_type_name(lhs_type),
+                                           cudf::jit::get_type_name(rhs_type),
                                            std::string("cudf::binops::jit::UserDefinedOp"));
 
-  cudf::jit::get_program_cache(*binaryop_jit_kernel_cu_jit)
-    .get_kernel(kernel_name, {}, {{"binaryop/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})
+  return cudf::jit::get_program_cache(*binaryop_jit_kernel_cu_jit)
+    .get_kernel(kernel_name, {}, {{"binaryop/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."});
+}
+
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      const std::string& ptx,
+                      rmm::cuda_stream_view stream)
+{
+  get_binary_operation_kernel(out.type(), lhs.type(), rhs.type(), ptx)
     ->configure_1d_max_occupancy(0, 0, 0, stream.value())
     ->launch(out.size(),
              cudf::jit::get_data_ptr(out),
@@ -204,6 +248,8 @@ std::unique_ptr<column> binary_operation(LhsType const& lhs,
   }
 
   auto out = make_fixed_width_column_for_output(lhs, rhs, op, output_type, stream, mr);
+  // While capturing, the null count is left to be computed once the graph has been launched
+  if (cudf::detail::is_capturing(stream)) { out->defer_null_count(); }
 
   if constexpr (std::is_same_v<LhsType, column_view>)
     if (lhs.is_empty()) return out;
@@ -317,7 +363,7 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
                                          rmm::mr::device_memory_resource* mr)
 {
   return binops::compiled::binary_operation<scalar, column_view>(
-    lhs, rhs, op, output_type, rmm::cuda_stream_default, mr);
+    lhs, rhs, op, output_type, stream, mr);
 }
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          scalar const& rhs,
@@ -327,7 +373,7 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          rmm::mr::device_memory_resource* mr)
 {
   return binops::compiled::binary_operation<column_view, scalar>(
-    lhs, rhs, op, output_type, rmm::cuda_stream_default, mr);
+    lhs, rhs, op, output_type, stream, mr);
 }
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          column_view const& rhs,
@@ -337,7 +383,75 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          rmm::mr::device_memory_resource* mr)
 {
   return binops::compiled::binary_operation<column_view, column_view>(
-    lhs, rhs, op, output_type, rmm::cuda_stream_default, mr);
+    lhs, rhs, op, output_type, stream, mr);
+}
+
+std::unique_ptr<column> chained_binary_operation(std::vector<column_view> const& operands,
+                                                 std::vector<binary_operator> const& ops,
+                                                 data_type output_type,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(not ops.empty(), "At least one binary operator is required");
+  CUDF_EXPECTS(operands.size() == ops.size() + 1,
+               "The number of operands must be one more than the number of operators");
+  CUDF_EXPECTS(std::all_of(operands.begin(),
+                           operands.end(),
+                           [&](auto const& col) { return col.size() == operands[0].size(); }),
+               "Column sizes don't match");
+
+  // The result of the operators before operator `k`
+  std::unique_ptr<column> result;
+  std::size_t k = 0;
+  while (k < ops.size()) {
+    auto const lhs       = result ? result->view() : operands[0];
+    auto const num_fused = std::min(ops.size() - k, std::size_t{3});
+    auto const last      = k + num_fused == ops.size();
+
+    // Types of the results of the next operators, and whether they can run in a single kernel
+    std::vector<data_type> types;
+    auto fused = num_fused > 1 and not lhs.is_empty();
+    for (auto j = k; j < k + num_fused; ++j) {
+      auto const lhs_type = j == k ? lhs.type() : types.back();
+      auto const rhs_type = operands[j + 1].type();
+      types.push_back(j + 1 == ops.size()
+                        ? output_type
+                        : binops::chained_result_type(ops[j], lhs_type, rhs_type));
+      fused = fused and
+              binops::compiled::is_supported_operation(types.back(), lhs_type, rhs_type, ops[j]);
+    }
+
+    if (fused) {
+      std::vector<column_view> chain{lhs};
+      chain.insert(chain.end(), operands.begin() + k + 1, operands.begin() + k + num_fused + 1);
+      auto const chain_view = table_view{chain};
+      auto const chain_mr   = last ? mr : rmm::mr::get_current_device_resource();
+
+      auto [new_mask, null_count] = bitmask_and(chain_view, stream, chain_mr);
+      auto out                    = make_fixed_width_column(
+        types.back(), lhs.size(), std::move(new_mask), null_count, stream, chain_mr);
+      if (is_capturing(stream)) { out->defer_null_count(); }
+      auto out_view = out->mutable_view();
+      auto const chain_ops =
+        std::vector<binary_operator>(ops.begin() + k, ops.begin() + k + num_fused);
+      if (binops::compiled::apply_binary_op_chain(out_view, chain_view, chain_ops, stream)) {
+        result = std::move(out);
+        k += num_fused;
+        continue;
+      }
+    }
+
+    // Run the next operator alone
+    result = binops::compiled::binary_operation<column_view, column_view>(
+      lhs,
+      operands[k + 1],
+      ops[k],
+      types.front(),
+      stream,
+      k + 1 == ops.size() ? mr : rmm::mr::get_current_device_resource());
+    ++k;
+  }
+  return result;
 }
 
 std::unique_ptr<column> binary_operation(column_view const& lhs,
@@ -348,11 +462,7 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          rmm::mr::device_memory_resource* mr)
 {
   // Check for datatype
-  auto is_type_supported_ptx = [](data_type type) -> bool {
-    return is_fixed_width(type) and not is_fixed_point(type) and
-           type.id() != type_id::INT8;  // Numba PTX doesn't support int8
-  };
-
+  using binops::jit::is_type_supported_ptx;
   CUDF_EXPECTS(is_type_supported_ptx(lhs.type()), "Invalid/Unsupported lhs datatype");
   CUDF_EXPECTS(is_type_supported_ptx(rhs.type()), "Invalid/Unsupported rhs datatype");
   CUDF_EXPECTS(is_type_supported_ptx(output_type), "Invalid/Unsupported output datatype");
@@ -362,6 +472,7 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   auto [new_mask, null_count] = bitmask_and(table_view({lhs, rhs}), stream, mr);
   auto out =
     make_fixed_width_column(output_type, lhs.size(), std::move(new_mask), null_count, stream, mr);
+  if (is_capturing(stream)) { out->defer_null_count(); }
 
   // Check for 0 sized data
   if (lhs.is_empty() or rhs.is_empty()) return out;
@@ -370,6 +481,21 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   binops::jit::binary_operation(out_view, lhs, rhs, ptx, stream);
   return out;
 }
+
+void precompile_binary_operation(std::string const& ptx,
+                                 data_type lhs_type,
+                                 data_type rhs_type,
+                                 data_type output_type)
+{
+  using binops::jit::is_type_supported_ptx;
+  CUDF_EXPECTS(is_type_supported_ptx(lhs_type), "Invalid/Unsupported lhs datatype");
+  CUDF_EXPECTS(is_type_supported_ptx(rhs_type), "Invalid/Unsupported rhs datatype");
+  CUDF_EXPECTS(is_type_supported_ptx(output_type), "Invalid/Unsupported output datatype");
+
+  // configuring the kernel loads it, or throws if it did not compile
+  binops::jit::get_binary_operation_kernel(output_type, lhs_type, rhs_type, ptx)
+    ->configure_1d_max_occupancy(0, 0, 0, rmm::cuda_stream_default.value());
+}
 }  // namespace detail
 
 int32_t binary_operation_fixed_point_scale(binary_operator op,
@@ -397,38 +523,52 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
                                          column_view const& rhs,
                                          binary_operator op,
                                          data_type output_type,
+                                         rmm::cuda_stream_view stream,
                                          rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::binary_operation(lhs, rhs, op, output_type, rmm::cuda_stream_default, mr);
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(rhs, stream);
+  return detail::binary_operation(lhs, rhs, op, output_type, stream, mr);
 }
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          scalar const& rhs,
                                          binary_operator op,
                                          data_type output_type,
+                                         rmm::cuda_stream_view stream,
                                          rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::binary_operation(lhs, rhs, op, output_type, rmm::cuda_stream_default, mr);
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(lhs, stream);
+  return detail::binary_operation(lhs, rhs, op, output_type, stream, mr);
 }
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          column_view const& rhs,
                                          binary_operator op,
                                          data_type output_type,
+                                         rmm::cuda_stream_view stream,
                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(lhs, stream);
+  return detail::binary_operation(lhs, rhs, op, output_type, stream, mr);
+}
+
+std::unique_ptr<column> chained_binary_operation(std::vector<column_view> const& operands,
+                                                 std::vector<binary_operator> const& ops,
+                                                 data_type output_type,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::binary_operation(lhs, rhs, op, output_type, rmm::cuda_stream_default, mr);
+  return detail::chained_binary_operation(operands, ops, output_type, stream, mr);
 }
 
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          column_view const& rhs,
                                          std::string const& ptx,
                                          data_type output_type,
+                                         rmm::cuda_stream_view stream,
                                          rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::binary_operation(lhs, rhs, ptx, output_type, rmm::cuda_stream_default, mr);
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(lhs, stream);
+  return detail::binary_operation(lhs, rhs, ptx, output_type, stream, mr);
 }
 
 }  // namespace cudf
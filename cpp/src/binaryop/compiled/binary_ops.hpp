@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,10 +18,12 @@
 
 #include <cudf/binaryop.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table_view.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
 #include <optional>
+#include <vector>
 
 namespace cudf {
 // Forward declarations
@@ -194,6 +196,25 @@ void apply_binary_op(mutable_column_device_view&,
                      bool is_lhs_scalar,
                      bool is_rhs_scalar,
                      rmm::cuda_stream_view stream);
+// Defined in chained_ops.cu
+/**
+ * @brief Runs a chain of 2 or 3 binary operations on each row of @p operands in a single kernel.
+ *
+ * @note @p out is not modified when the kernel is not compiled for the operand types and
+ * operators, in which case the caller runs the binary operations one by one.
+ *
+ * @param out output column
+ * @param operands operand columns of the chain, whose first column is the left operand of the
+ * first operator
+ * @param ops binary operators of the chain, applied from left to right
+ * @param stream CUDA stream used for device memory operations
+ * @return true if the chain was run
+ */
+bool apply_binary_op_chain(mutable_column_view& out,
+                           table_view const& operands,
+                           std::vector<binary_operator> const& ops,
+                           rmm::cuda_stream_view stream);
+
 /**
  * @brief Deploys single type or double type dispatcher that runs equality operation on each element
  * of @p lhsd and @p rhsd columns.
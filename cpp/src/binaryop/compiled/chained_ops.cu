@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "binary_ops.cuh"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace cudf {
+namespace binops {
+namespace compiled {
+
+namespace {
+
+/**
+ * @brief Returns true if `BinaryOperator` on `TypeAcc` and `TypeRhs` returns a `TypeAcc`, so that
+ * its result can be the left operand of the next operator of a chain.
+ */
+template <typename BinaryOperator, typename TypeAcc, typename TypeRhs>
+constexpr bool is_chainable()
+{
+  if constexpr (std::is_invocable_v<BinaryOperator, TypeAcc, TypeRhs>) {
+    return std::is_same_v<std::invoke_result_t<BinaryOperator, TypeAcc, TypeRhs>, TypeAcc>;
+  }
+  return false;
+}
+
+template <typename TypeAcc, typename TypeRhs>
+constexpr bool is_chainable_op(binary_operator op)
+{
+  switch (op) {
+    case binary_operator::ADD: return is_chainable<ops::Add, TypeAcc, TypeRhs>();
+    case binary_operator::SUB: return is_chainable<ops::Sub, TypeAcc, TypeRhs>();
+    case binary_operator::MUL: return is_chainable<ops::Mul, TypeAcc, TypeRhs>();
+    case binary_operator::DIV: return is_chainable<ops::Div, TypeAcc, TypeRhs>();
+    default: return false;
+  }
+}
+
+template <typename BinaryOperator, typename TypeAcc, typename TypeRhs>
+__device__ inline TypeAcc apply_chained(TypeAcc x, TypeRhs y)
+{
+  if constexpr (is_chainable<BinaryOperator, TypeAcc, TypeRhs>()) {
+    return BinaryOperator{}.template operator()<TypeAcc, TypeRhs>(x, y);
+  }
+  return x;
+}
+
+/**
+ * @brief Evaluates `(((col_0 op_0 col_1) op_1 col_2) ...)` on row `i` and writes it to `out`.
+ *
+ * The result of each operator is kept in a register as a `TypeAcc`, instead of being written to
+ * an intermediate column.
+ *
+ * @tparam TypeAcc Type of the first operand and of the result of each operator
+ * @tparam TypeRhs Type of the other operands
+ * @tparam num_ops Number of operators of the chain
+ */
+template <typename TypeAcc, typename TypeRhs, int num_ops>
+struct binary_op_chain_functor {
+  mutable_column_device_view out;
+  table_device_view operands;
+  binary_operator ops[num_ops];
+
+  __device__ void operator()(size_type i)
+  {
+    auto result = operands.column(0).element<TypeAcc>(i);
+#pragma unroll
+    for (int k = 0; k < num_ops; ++k) {
+      auto const y = operands.column(k + 1).element<TypeRhs>(i);
+      switch (ops[k]) {
+        case binary_operator::ADD: result = apply_chained<ops::Add>(result, y); break;
+        case binary_operator::SUB: result = apply_chained<ops::Sub>(result, y); break;
+        case binary_operator::MUL: result = apply_chained<ops::Mul>(result, y); break;
+        case binary_operator::DIV: result = apply_chained<ops::Div>(result, y); break;
+        default: break;
+      }
+    }
+    type_dispatcher(out.type(), typed_casted_writer<TypeAcc>{}, i, out, result);
+  }
+};
+
+/**
+ * @brief Types of the first operand of a chain that the fused kernel is compiled for.
+ *
+ * The other operands have the same type, except after a timestamp, where they are durations of
+ * the same resolution.
+ */
+template <typename T>
+constexpr bool is_chain_type()
+{
+  return std::is_same_v<T, int32_t> or std::is_same_v<T, int64_t> or std::is_same_v<T, float> or
+         std::is_same_v<T, double> or is_fixed_point<T>() or is_chrono<T>();
+}
+
+template <typename TypeAcc, typename = void>
+struct chain_rhs_type {
+  using type = TypeAcc;
+};
+
+template <typename TypeAcc>
+struct chain_rhs_type<TypeAcc, std::enable_if_t<is_timestamp<TypeAcc>()>> {
+  using type = typename TypeAcc::duration;
+};
+
+/**
+ * @brief Launches the fused kernel for the type of the first operand, or returns false if it is not
+ * compiled for the types of the operands and the operators.
+ */
+struct binary_op_chain_dispatcher {
+  template <typename TypeAcc, typename TypeRhs, int num_ops>
+  void launch(mutable_column_view& out,
+              table_view const& operands,
+              std::vector<binary_operator> const& ops,
+              rmm::cuda_stream_view stream)
+  {
+    auto outd      = mutable_column_device_view::create(out, stream);
+    auto operandsd = table_device_view::create(operands, stream);
+    auto f         = binary_op_chain_functor<TypeAcc, TypeRhs, num_ops>{*outd, *operandsd, {}};
+    std::copy(ops.begin(), ops.end(), f.ops);
+    for_each(stream, out.size(), f);
+  }
+
+  template <typename TypeAcc>
+  bool operator()(mutable_column_view& out,
+                  table_view const& operands,
+                  std::vector<binary_operator> const& ops,
+                  rmm::cuda_stream_view stream)
+  {
+    if constexpr (is_chain_type<TypeAcc>()) {
+      using TypeRhs = typename chain_rhs_type<TypeAcc>::type;
+      auto const is_rhs = [](column_view const& col) {
+        return col.type().id() == type_to_id<TypeRhs>();
+      };
+      auto const is_chained_op = [](binary_operator op) {
+        return is_chainable_op<TypeAcc, TypeRhs>(op);
+      };
+      if (not std::all_of(operands.begin() + 1, operands.end(), is_rhs) or
+          not std::all_of(ops.begin(), ops.end(), is_chained_op)) {
+        return false;
+      }
+      if (ops.size() == 2) {
+        launch<TypeAcc, TypeRhs, 2>(out, operands, ops, stream);
+      } else {
+        launch<TypeAcc, TypeRhs, 3>(out, operands, ops, stream);
+      }
+      return true;
+    }
+    return false;
+  }
+};
+
+}  // namespace
+
+bool apply_binary_op_chain(mutable_column_view& out,
+                           table_view const& operands,
+                           std::vector<binary_operator> const& ops,
+                           rmm::cuda_stream_view stream)
+{
+  if (ops.size() < 2 or ops.size() > 3) { return false; }
+  return type_dispatcher(
+    operands.column(0).type(), binary_op_chain_dispatcher{}, out, operands, ops, stream);
+}
+
+}  // namespace compiled
+}  // namespace binops
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -150,6 +150,35 @@ void set_null_mask(bitmask_type* bitmask,
   }
 }
 
+namespace {
+__global__ void nullify_if_invalid_kernel(bitmask_type* bitmask,
+                                          size_type number_of_mask_words,
+                                          bool const* valid)
+{
+  if (*valid) { return; }
+  for (size_type word_index = threadIdx.x + blockIdx.x * blockDim.x;
+       word_index < number_of_mask_words;
+       word_index += blockDim.x * gridDim.x) {
+    bitmask[word_index] = 0;
+  }
+}
+}  // namespace
+
+// Set all the bits of a pre-allocated null mask to null if the device flag is false
+void nullify_if_invalid(bitmask_type* bitmask,
+                        size_type size,
+                        bool const* valid,
+                        rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  if (bitmask == nullptr or size == 0) { return; }
+  auto const number_of_mask_words = num_bitmask_words(size);
+  cudf::detail::grid_1d config(number_of_mask_words, 256);
+  nullify_if_invalid_kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+    bitmask, number_of_mask_words, valid);
+  CUDA_TRY(cudaPeekAtLastError());
+}
+
 }  // namespace detail
 
 // Create a device_buffer for a null mask
@@ -403,6 +432,141 @@ std::vector<size_type> segmented_null_count(const bitmask_type* bitmask,
   return detail::segmented_null_count(bitmask, indices.begin(), indices.end(), stream);
 }
 
+namespace {
+// number of bitmask words counted by each block of batch_count_set_bits_kernel
+constexpr size_type words_per_tile{2048};
+
+/**
+ * @brief Counts the set bits of the ranges of many bitmasks, each split into tiles of
+ * `words_per_tile` words that are counted by a block each.
+ *
+ * @param[in] bitmasks The bitmask of each range
+ * @param[in] begin_bits The first bit of each range (inclusive)
+ * @param[in] end_bits The last bit of each range (exclusive)
+ * @param[in] tile_offsets The first tile of each range, and the total number of tiles
+ * @param[in] num_ranges The number of ranges
+ * @param[out] set_counts The number of set bits in each range, which must be set to zero
+ */
+template <size_type block_size>
+__global__ void batch_count_set_bits_kernel(bitmask_type const* const* bitmasks,
+                                            size_type const* begin_bits,
+                                            size_type const* end_bits,
+                                            size_type const* tile_offsets,
+                                            size_type num_ranges,
+                                            size_type* set_counts)
+{
+  constexpr auto const word_size{detail::size_in_bits<bitmask_type>()};
+
+  size_type const tile = blockIdx.x;
+  auto const range     = static_cast<size_type>(
+    thrust::upper_bound(thrust::seq, tile_offsets, tile_offsets + num_ranges + 1, tile) -
+    tile_offsets - 1);
+  auto const bitmask         = bitmasks[range];
+  auto const first_bit_index = begin_bits[range];
+  auto const last_bit_index  = end_bits[range] - 1;
+  auto const first_word      = word_index(first_bit_index);
+  auto const last_word       = word_index(last_bit_index);
+  auto const tile_begin      = first_word + (tile - tile_offsets[range]) * words_per_tile;
+  auto const tile_end        = min(last_word + 1, tile_begin + words_per_tile);
+
+  size_type thread_count{0};
+  for (auto i = tile_begin + static_cast<size_type>(threadIdx.x); i < tile_end; i += block_size) {
+    auto word = bitmask[i];
+    // Ignore the slack bits of the first and last words
+    auto const first_slack_bits = first_bit_index % word_size;
+    auto const last_slack_bits  = word_size - last_bit_index % word_size - 1;
+    if (i == first_word and first_slack_bits > 0) {
+      word &= ~set_least_significant_bits(first_slack_bits);
+    }
+    if (i == last_word and last_slack_bits > 0) {
+      word &= ~set_most_significant_bits(last_slack_bits);
+    }
+    thread_count += __popc(word);
+  }
+
+  using BlockReduce = cub::BlockReduce<size_type, block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  size_type block_count{BlockReduce(temp_storage).Sum(thread_count)};
+
+  if (threadIdx.x == 0) { atomicAdd(set_counts + range, block_count); }
+}
+
+}  // namespace
+
+// Count null elements in the specified ranges of many validity bitmasks
+std::vector<size_type> batch_null_count(host_span<bitmask_type const* const> bitmasks,
+                                        host_span<size_type const> begin_bits,
+                                        host_span<size_type const> end_bits,
+                                        rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(bitmasks.size() == begin_bits.size() && begin_bits.size() == end_bits.size(),
+               "The numbers of bitmasks and of range bounds must match.");
+
+  // Only the non-empty ranges of bitmasks are counted on the device
+  std::vector<size_type> null_counts(bitmasks.size(), 0);
+  std::vector<std::size_t> ranges;
+  std::vector<bitmask_type const*> h_bitmasks;
+  std::vector<size_type> h_begin_bits;
+  std::vector<size_type> h_end_bits;
+  std::vector<size_type> h_tile_offsets{0};
+  for (std::size_t i = 0; i < bitmasks.size(); ++i) {
+    CUDF_EXPECTS(begin_bits[i] >= 0, "Invalid range.");
+    CUDF_EXPECTS(begin_bits[i] <= end_bits[i], "Invalid bit range.");
+    if (bitmasks[i] == nullptr or begin_bits[i] == end_bits[i]) { continue; }
+    auto const num_words = word_index(end_bits[i] - 1) - word_index(begin_bits[i]) + 1;
+    ranges.push_back(i);
+    h_bitmasks.push_back(bitmasks[i]);
+    h_begin_bits.push_back(begin_bits[i]);
+    h_end_bits.push_back(end_bits[i]);
+    h_tile_offsets.push_back(h_tile_offsets.back() +
+                             util::div_rounding_up_safe(num_words, words_per_tile));
+  }
+  if (ranges.empty()) { return null_counts; }
+
+  auto const num_ranges   = static_cast<size_type>(ranges.size());
+  auto const d_bitmasks   = make_device_uvector_async(h_bitmasks, stream);
+  auto const d_begin_bits = make_device_uvector_async(h_begin_bits, stream);
+  auto const d_end_bits   = make_device_uvector_async(h_end_bits, stream);
+  auto const d_tiles      = make_device_uvector_async(h_tile_offsets, stream);
+  rmm::device_uvector<size_type> d_set_counts(num_ranges, stream);
+  CUDA_TRY(cudaMemsetAsync(d_set_counts.data(), 0, num_ranges * sizeof(size_type), stream.value()));
+
+  constexpr size_type block_size{256};
+  batch_count_set_bits_kernel<block_size>
+    <<<h_tile_offsets.back(), block_size, 0, stream.value()>>>(d_bitmasks.data(),
+                                                               d_begin_bits.data(),
+                                                               d_end_bits.data(),
+                                                               d_tiles.data(),
+                                                               num_ranges,
+                                                               d_set_counts.data());
+
+  auto const set_counts = make_std_vector_sync(d_set_counts, stream);
+  for (size_type i = 0; i < num_ranges; ++i) {
+    null_counts[ranges[i]] = h_end_bits[i] - h_begin_bits[i] - set_counts[i];
+  }
+  return null_counts;
+}
+
+// Return the null counts of the columns, counting the unknown ones together
+std::vector<size_type> batch_null_count(host_span<column_view const> columns,
+                                        rmm::cuda_stream_view stream)
+{
+  std::vector<bitmask_type const*> bitmasks;
+  std::vector<size_type> begin_bits;
+  std::vector<size_type> end_bits;
+  for (auto const& col : columns) {
+    bool const is_counted = col.is_null_count_known() or not col.nullable();
+    bitmasks.push_back(is_counted ? nullptr : col.null_mask());
+    begin_bits.push_back(col.offset());
+    end_bits.push_back(col.offset() + col.size());
+  }
+  auto null_counts = batch_null_count(bitmasks, begin_bits, end_bits, stream);
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    if (columns[i].is_null_count_known()) { null_counts[i] = columns[i].null_count(); }
+  }
+  return null_counts;
+}
+
 // Inplace Bitwise AND of the masks
 cudf::size_type inplace_bitmask_and(device_span<bitmask_type> dest_mask,
                                     host_span<bitmask_type const*> masks,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -52,7 +52,8 @@ column::column(column const& other,
     _size{other._size},
     _data{other._data, stream, mr},
     _null_mask{other._null_mask, stream, mr},
-    _null_count{other._null_count}
+    _null_count{other._null_count},
+    _null_count_deferred{other._null_count_deferred}
 {
   _children.reserve(other.num_children());
   for (auto const& c : other._children) {
@@ -67,19 +68,22 @@ column::column(column&& other) noexcept
     _data{std::move(other._data)},
     _null_mask{std::move(other._null_mask)},
     _null_count{other._null_count},
+    _null_count_deferred{other._null_count_deferred},
     _children{std::move(other._children)}
 {
-  other._size       = 0;
-  other._null_count = 0;
-  other._type       = data_type{type_id::EMPTY};
+  other._size                = 0;
+  other._null_count          = 0;
+  other._null_count_deferred = false;
+  other._type                = data_type{type_id::EMPTY};
 }
 
 // Release contents
 column::contents column::release() noexcept
 {
-  _size       = 0;
-  _null_count = 0;
-  _type       = data_type{type_id::EMPTY};
+  _size                = 0;
+  _null_count          = 0;
+  _null_count_deferred = false;
+  _type                = data_type{type_id::EMPTY};
   return column::contents{std::make_unique<rmm::device_buffer>(std::move(_data)),
                           std::make_unique<rmm::device_buffer>(std::move(_null_mask)),
                           std::move(_children)};
@@ -95,11 +99,12 @@ column_view column::view() const
     child_views.emplace_back(*c);
   }
 
+  // A deferred null count is passed as is, since computing it synchronizes
   return column_view{type(),
                      size(),
                      _data.data(),
                      static_cast<bitmask_type const*>(_null_mask.data()),
-                     null_count(),
+                     _null_count_deferred ? _null_count : null_count(),
                      0,
                      child_views};
 }
@@ -144,6 +149,7 @@ size_type column::null_count() const
   if (_null_count <= cudf::UNKNOWN_NULL_COUNT) {
     _null_count = cudf::detail::null_count(
       static_cast<bitmask_type const*>(_null_mask.data()), 0, size(), rmm::cuda_stream_default);
+    _null_count_deferred = false;
   }
   return _null_count;
 }
@@ -157,6 +163,7 @@ void column::set_null_mask(rmm::device_buffer&& new_null_mask, size_type new_nul
   }
   _null_mask  = std::move(new_null_mask);  // move
   _null_count = new_null_count;
+  if (new_null_count != UNKNOWN_NULL_COUNT) { _null_count_deferred = false; }
 }
 
 void column::set_null_mask(rmm::device_buffer const& new_null_mask,
@@ -170,12 +177,20 @@ void column::set_null_mask(rmm::device_buffer const& new_null_mask,
   }
   _null_mask  = rmm::device_buffer{new_null_mask, stream};  // copy
   _null_count = new_null_count;
+  if (new_null_count != UNKNOWN_NULL_COUNT) { _null_count_deferred = false; }
 }
 
 void column::set_null_count(size_type new_null_count)
 {
   if (new_null_count > 0) { CUDF_EXPECTS(nullable(), "Invalid null count."); }
   _null_count = new_null_count;
+  if (new_null_count != UNKNOWN_NULL_COUNT) { _null_count_deferred = false; }
+}
+
+void column::defer_null_count()
+{
+  _null_count          = UNKNOWN_NULL_COUNT;
+  _null_count_deferred = true;
 }
 
 namespace {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,7 +15,9 @@
  */
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
+#include <cudf/detail/device_view_cache.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/stream_capture.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 
@@ -74,13 +76,8 @@ create_device_view_from_view(ColumnView const& source, rmm::cuda_stream_view str
     new ColumnDeviceView(source, staging_buffer.data(), descendant_storage->data()), deleter};
 
   // copy the CPU memory with all the children into device memory
-  CUDA_TRY(cudaMemcpyAsync(descendant_storage->data(),
-                           staging_buffer.data(),
-                           descendant_storage->size(),
-                           cudaMemcpyDefault,
-                           stream.value()));
-
-  stream.synchronize();
+  detail::copy_host_to_device(
+    descendant_storage->data(), staging_buffer.data(), descendant_storage->size(), stream);
 
   return result;
 }
@@ -111,6 +108,14 @@ column_device_view::create(column_view source, rmm::cuda_stream_view stream)
     return std::unique_ptr<column_device_view>(new column_device_view(source));
   }
 
+  // The cached view is owned by its cache entry, which the deleter keeps alive
+  if (auto cached = detail::find_cached_device_view(source, stream); cached.view != nullptr) {
+    return std::unique_ptr<column_device_view, std::function<void(column_device_view*)>>{
+      cached.view, [owner = std::move(cached.owner), stream](column_device_view*) {
+        detail::release_cached_device_view(*owner, stream);
+      }};
+  }
+
   return create_device_view_from_view<column_view, column_device_view>(source, stream);
 }
 
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/ipc_table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/cuda_memory_resource.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+namespace cudf {
+namespace {
+
+/**
+ * @brief Layout of the handle of an exported table, followed by its `pack_metadata`.
+ */
+struct ipc_table_header {
+  cudaIpcMemHandle_t importers;
+  cudaIpcMemHandle_t data;
+  uint64_t data_size;
+};
+
+/**
+ * @brief Returns the resource of the exported tables, whose allocations can each be mapped by a
+ * CUDA IPC handle.
+ */
+rmm::mr::device_memory_resource* ipc_memory_resource()
+{
+  static rmm::mr::cuda_memory_resource mr;
+  return &mr;
+}
+
+__global__ void add_importers(int* importers, int delta) { atomicAdd(importers, delta); }
+
+}  // namespace
+
+ipc_exported_table::ipc_exported_table(packed_columns&& packed, rmm::device_buffer&& importers)
+  : _packed(std::move(packed)), _importers(std::move(importers))
+{
+  ipc_table_header header{};
+  CUDA_TRY(cudaIpcGetMemHandle(&header.importers, _importers.data()));
+  header.data_size = _packed.gpu_data->size();
+  if (header.data_size > 0) {
+    CUDA_TRY(cudaIpcGetMemHandle(&header.data, _packed.gpu_data->data()));
+  }
+
+  _handle.resize(sizeof(header) + _packed.metadata_->size());
+  std::memcpy(_handle.data(), &header, sizeof(header));
+  std::memcpy(
+    _handle.data() + sizeof(header), _packed.metadata_->data(), _packed.metadata_->size());
+}
+
+int ipc_exported_table::num_importers() const
+{
+  int importers{};
+  CUDA_TRY(cudaMemcpy(&importers, _importers.data(), sizeof(int), cudaMemcpyDeviceToHost));
+  return importers;
+}
+
+ipc_imported_table::ipc_imported_table(host_span<uint8_t const> handle)
+{
+  CUDF_EXPECTS(handle.size() >= sizeof(ipc_table_header), "Invalid IPC table handle.");
+  ipc_table_header header{};
+  std::memcpy(&header, handle.data(), sizeof(header));
+  _metadata.assign(handle.begin() + sizeof(header), handle.end());
+
+  CUDA_TRY(cudaIpcOpenMemHandle(&_importers, header.importers, cudaIpcMemLazyEnablePeerAccess));
+  if (header.data_size > 0) {
+    auto const status = cudaIpcOpenMemHandle(&_data, header.data, cudaIpcMemLazyEnablePeerAccess);
+    if (status != cudaSuccess) {
+      cudaIpcCloseMemHandle(_importers);
+      CUDA_TRY(status);
+    }
+  }
+
+  // the exporting process reads the count synchronously, so it is updated before returning
+  add_importers<<<1, 1, 0, rmm::cuda_stream_default.value()>>>(static_cast<int*>(_importers), 1);
+  CHECK_CUDA(rmm::cuda_stream_default.value());
+  rmm::cuda_stream_default.synchronize();
+
+  _view = unpack(_metadata.data(), static_cast<uint8_t const*>(_data));
+}
+
+ipc_imported_table::~ipc_imported_table()
+{
+  // errors are ignored by the destructor, which the exporting process detects by the count
+  add_importers<<<1, 1, 0, rmm::cuda_stream_default.value()>>>(static_cast<int*>(_importers), -1);
+  cudaStreamSynchronize(rmm::cuda_stream_default.value());
+  if (_data != nullptr) { cudaIpcCloseMemHandle(_data); }
+  cudaIpcCloseMemHandle(_importers);
+}
+
+std::unique_ptr<ipc_exported_table> export_ipc(table_view const& input)
+{
+  CUDF_FUNC_RANGE();
+  auto const stream = rmm::cuda_stream_default;
+  auto packed       = detail::pack(input, stream, ipc_memory_resource());
+  auto importers    = rmm::device_buffer(sizeof(int), stream, ipc_memory_resource());
+  CUDA_TRY(cudaMemsetAsync(importers.data(), 0, sizeof(int), stream.value()));
+  // the other processes may map the table as soon as its handle is returned
+  stream.synchronize();
+  return std::make_unique<ipc_exported_table>(std::move(packed), std::move(importers));
+}
+
+std::shared_ptr<ipc_imported_table> import_ipc(host_span<uint8_t const> handle)
+{
+  CUDF_FUNC_RANGE();
+  return std::make_shared<ipc_imported_table>(handle);
+}
+
+}  // namespace cudf
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/comms/shuffle.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream.hpp>
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace cudf {
+namespace comms {
+namespace detail {
+namespace {
+
+// Alignment of the received partitions in the buffer of their chunk, that of the allocations of
+// RMM, so that they unpack as the buffers they were packed into
+constexpr std::size_t partition_alignment = 256;
+
+/**
+ * @brief Header sent ahead of a packed partition, followed by its `pack_metadata`.
+ */
+struct partition_header {
+  uint64_t data_size;
+};
+
+/**
+ * @brief CUDA event ordering the work of one stream after that of another.
+ */
+class stream_event {
+ public:
+  stream_event() { CUDA_TRY(cudaEventCreateWithFlags(&_event, cudaEventDisableTiming)); }
+  ~stream_event() { cudaEventDestroy(_event); }
+  stream_event(stream_event const&) = delete;
+  stream_event& operator=(stream_event const&) = delete;
+
+  void record(rmm::cuda_stream_view stream)
+  {
+    CUDA_TRY(cudaEventRecord(_event, stream.value()));
+  }
+
+  void wait(rmm::cuda_stream_view stream) const
+  {
+    CUDA_TRY(cudaStreamWaitEvent(stream.value(), _event, 0));
+  }
+
+ private:
+  cudaEvent_t _event{};
+};
+
+/**
+ * @brief Partitions received by a rank for one chunk, in a single device buffer.
+ */
+struct received_chunk {
+  rmm::device_buffer data;
+  std::vector<std::vector<uint8_t>> metadata;  // empty for the ranks that sent no partition
+  std::vector<std::size_t> offsets;            // of each partition in `data`
+  std::vector<std::size_t> sizes;              // of each partition
+};
+
+/**
+ * @brief Returns the largest number of chunks of all the ranks, which is the number of chunks
+ * every rank exchanges.
+ */
+int64_t agree_num_chunks(int64_t num_chunks, communicator& comm)
+{
+  std::vector<uint8_t> message(sizeof(num_chunks));
+  std::memcpy(message.data(), &num_chunks, sizeof(num_chunks));
+  auto const received = comm.all_to_all(std::vector<std::vector<uint8_t>>(comm.size(), message));
+
+  int64_t max_chunks = 0;
+  for (auto const& peer : received) {
+    CUDF_EXPECTS(peer.size() == sizeof(int64_t), "Invalid number of chunks received");
+    int64_t peer_chunks{};
+    std::memcpy(&peer_chunks, peer.data(), sizeof(peer_chunks));
+    max_chunks = std::max(max_chunks, peer_chunks);
+  }
+  return max_chunks;
+}
+
+/**
+ * @brief Returns the message announcing a packed partition to the rank it is sent to.
+ */
+std::vector<uint8_t> make_header(packed_columns const& partition)
+{
+  partition_header const header{partition.gpu_data->size()};
+  std::vector<uint8_t> message(sizeof(header) + partition.metadata_->size());
+  std::memcpy(message.data(), &header, sizeof(header));
+  std::memcpy(
+    message.data() + sizeof(header), partition.metadata_->data(), partition.metadata_->size());
+  return message;
+}
+
+/**
+ * @brief Allocates the buffer receiving the partitions announced by the headers of all the ranks.
+ */
+received_chunk make_receive_buffer(std::vector<std::vector<uint8_t>> const& headers,
+                                   rmm::cuda_stream_view stream)
+{
+  received_chunk chunk;
+  std::size_t total = 0;
+  for (auto const& message : headers) {
+    std::size_t size = 0;
+    if (message.empty()) {
+      chunk.metadata.emplace_back();
+    } else {
+      CUDF_EXPECTS(message.size() >= sizeof(partition_header), "Invalid partition header");
+      partition_header header{};
+      std::memcpy(&header, message.data(), sizeof(header));
+      size = header.data_size;
+      chunk.metadata.emplace_back(message.begin() + sizeof(header), message.end());
+    }
+    chunk.offsets.push_back(total);
+    chunk.sizes.push_back(size);
+    total += cudf::util::round_up_safe(size, partition_alignment);
+  }
+  chunk.data = rmm::device_buffer(total, stream);
+  return chunk;
+}
+
+}  // namespace
+
+std::unique_ptr<table> shuffle(table_view const& input,
+                               std::vector<size_type> const& columns_to_hash,
+                               communicator& comm,
+                               size_type chunk_rows,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(chunk_rows > 0, "Number of rows per chunk must be positive");
+  // Validated before the ranks without rows skip partitioning
+  [[maybe_unused]] auto const keys = input.select(columns_to_hash);
+  auto const num_ranks             = comm.size();
+
+  // The ranks with fewer chunks take part in the exchanges of the others with empty chunks
+  int64_t const num_rows = input.num_rows();
+  auto const num_chunks  = agree_num_chunks((num_rows + chunk_rows - 1) / chunk_rows, comm);
+
+  // The partitions are sent on their own stream, while the next chunk is partitioned on `stream`
+  rmm::cuda_stream transfer_stream;
+  stream_event partitioned;
+  stream_event transferred;
+  std::vector<received_chunk> received;
+  std::vector<packed_table> in_flight;
+
+  for (int64_t c = 0; c < num_chunks; ++c) {
+    auto const begin = static_cast<size_type>(std::min(c * chunk_rows, num_rows));
+    auto const end   = static_cast<size_type>(std::min((c + 1) * chunk_rows, num_rows));
+    auto partitions =
+      begin == end ? std::vector<packed_table>{}
+                   : hash_partition_and_pack(slice(input, {begin, end})[0],
+                                             columns_to_hash,
+                                             num_ranks,
+                                             hash_id::HASH_MURMUR3,
+                                             DEFAULT_HASH_SEED,
+                                             stream);
+
+    std::vector<std::vector<uint8_t>> headers(num_ranks);
+    if (not partitions.empty()) {
+      std::transform(partitions.begin(), partitions.end(), headers.begin(), [](auto const& p) {
+        return make_header(p.data);
+      });
+    }
+    auto chunk = make_receive_buffer(comm.all_to_all(headers), stream);
+
+    // The partitions of the previous chunk are freed on `stream` once they are sent
+    transferred.wait(stream);
+    in_flight = std::move(partitions);
+
+    std::vector<device_span<uint8_t const>> send(num_ranks);
+    for (std::size_t r = 0; r < in_flight.size(); ++r) {
+      auto const& data = *in_flight[r].data.gpu_data;
+      send[r]          = {static_cast<uint8_t const*>(data.data()), data.size()};
+    }
+    std::vector<device_span<uint8_t>> recv;
+    for (std::size_t r = 0; r < chunk.sizes.size(); ++r) {
+      auto const data = static_cast<uint8_t*>(chunk.data.data()) + chunk.offsets[r];
+      recv.emplace_back(data, chunk.sizes[r]);
+    }
+
+    partitioned.record(stream);
+    partitioned.wait(transfer_stream.view());
+    comm.all_to_all(send, recv, transfer_stream.view());
+    transferred.record(transfer_stream.view());
+    received.push_back(std::move(chunk));
+  }
+
+  // The received partitions are read on `stream`, and the sent ones freed on it
+  transferred.wait(stream);
+  in_flight.clear();
+
+  std::vector<table_view> views;
+  for (auto const& chunk : received) {
+    for (std::size_t r = 0; r < chunk.metadata.size(); ++r) {
+      if (chunk.metadata[r].empty()) { continue; }
+      views.push_back(unpack(chunk.metadata[r].data(),
+                             static_cast<uint8_t const*>(chunk.data.data()) + chunk.offsets[r]));
+    }
+  }
+  if (views.empty()) { return empty_like(input); }
+  return cudf::detail::concatenate(views, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> shuffle(table_view const& input,
+                               std::vector<size_type> const& columns_to_hash,
+                               communicator& comm,
+                               size_type chunk_rows,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::shuffle(input, columns_to_hash, comm, chunk_rows, stream, mr);
+}
+
+}  // namespace comms
+}  // namespace cudf
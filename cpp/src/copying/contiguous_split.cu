@@ -22,10 +22,12 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
@@ -33,6 +35,7 @@
 #include <thrust/binary_search.h>
 #include <thrust/iterator/discard_iterator.h>
 
+#include <cstdint>
 #include <numeric>
 
 namespace cudf {
@@ -42,6 +45,9 @@ namespace {
 // start at that alignment.
 static constexpr std::size_t split_align = 64;
 
+// copies larger than this many bytes are subdivided, so that the copy kernel is evenly occupied
+static constexpr std::size_t desired_chunk_size = 1 * 1024 * 1024;
+
 /**
  * @brief Struct which contains information on a source buffer.
  *
@@ -801,25 +807,43 @@ struct num_chunks_func {
   __device__ size_t operator()(size_type i) const { return thrust::get<0>(chunks[i]); }
 };
 
-void copy_data(int num_bufs,
-               int num_src_bufs,
-               uint8_t const** d_src_bufs,
-               uint8_t** d_dst_bufs,
-               dst_buf_info* _d_dst_buf_info,
-               rmm::cuda_stream_view stream)
+/**
+ * @brief Functor for returning the index of the destination buffer of a chunked copy.
+ */
+struct out_to_in_index_func {
+  offset_type const* chunk_offsets;
+  int num_bufs;
+  __device__ size_type operator()(size_type i) const
+  {
+    return static_cast<size_type>(
+             thrust::upper_bound(thrust::seq, chunk_offsets, chunk_offsets + num_bufs + 1, i) -
+             chunk_offsets) -
+           1;
+  }
+};
+
+/**
+ * @brief Subdivide the copies of the destination buffers into copies of at most
+ * `desired_chunk_size` bytes.
+ *
+ * Since we parallelize at one block per copy, we are vulnerable to situations where we
+ * have small numbers of copies to do (a combination of small numbers of splits and/or columns),
+ * so we will take the actual set of outgoing source/destination buffers and further partition
+ * them into much smaller chunks in order to drive up the number of blocks and overall occupancy.
+ *
+ * @returns The chunked copies, and the offsets of the chunks of each destination buffer
+ */
+std::pair<rmm::device_uvector<dst_buf_info>, rmm::device_uvector<offset_type>> chunk_copies(
+  int num_bufs, dst_buf_info const* _d_dst_buf_info, rmm::cuda_stream_view stream)
 {
-  // Since we parallelize at one block per copy, we are vulnerable to situations where we
-  // have small numbers of copies to do (a combination of small numbers of splits and/or columns),
-  // so we will take the actual set of outgoing source/destination buffers and further partition
-  // them into much smaller chunks in order to drive up the number of blocks and overall occupancy.
-  auto const desired_chunk_size = size_t{1 * 1024 * 1024};
   rmm::device_uvector<thrust::pair<size_t, size_t>> chunks(num_bufs, stream);
   thrust::transform(
     rmm::exec_policy(stream),
     _d_dst_buf_info,
     _d_dst_buf_info + num_bufs,
     chunks.begin(),
-    [desired_chunk_size] __device__(dst_buf_info const& buf) -> thrust::pair<size_t, size_t> {
+    [chunk_size = desired_chunk_size] __device__(
+      dst_buf_info const& buf) -> thrust::pair<size_t, size_t> {
       // Total bytes for this incoming partition
       size_t const bytes = buf.num_elements * buf.element_size;
 
@@ -829,12 +853,12 @@ void copy_data(int num_bufs,
 
       // The number of chunks we want to subdivide this buffer into
       size_t const num_chunks =
-        max(size_t{1}, util::round_up_unsafe(bytes, desired_chunk_size) / desired_chunk_size);
+        max(size_t{1}, util::round_up_unsafe(bytes, chunk_size) / chunk_size);
 
       // NOTE: leaving chunk size as a separate parameter for future tuning
       // possibilities, even though in the current implementation it will be a
       // constant.
-      return {num_chunks, desired_chunk_size};
+      return {num_chunks, chunk_size};
     });
 
   rmm::device_uvector<offset_type> chunk_offsets(num_bufs + 1, stream);
@@ -848,12 +872,7 @@ void copy_data(int num_bufs,
                          chunk_offsets.begin(),
                          0);
 
-  auto out_to_in_index = [chunk_offsets = chunk_offsets.begin(), num_bufs] __device__(size_type i) {
-    return static_cast<size_type>(
-             thrust::upper_bound(thrust::seq, chunk_offsets, chunk_offsets + num_bufs + 1, i) -
-             chunk_offsets) -
-           1;
-  };
+  auto out_to_in_index = out_to_in_index_func{chunk_offsets.begin(), num_bufs};
 
   // apply the chunking.
   auto const num_chunks =
@@ -870,8 +889,6 @@ void copy_data(int num_bufs,
      d_dst_buf_info = d_dst_buf_info.begin(),
      chunks         = chunks.begin(),
      chunk_offsets  = chunk_offsets.begin(),
-     num_bufs,
-     num_src_bufs,
      out_to_in_index] __device__(size_type i) {
       size_type const in_buf_index = out_to_in_index(i);
       size_type const chunk_index  = i - chunk_offsets[in_buf_index];
@@ -913,6 +930,18 @@ void copy_data(int num_bufs,
       // underneath the final structure of the output
     });
 
+  return {std::move(d_dst_buf_info), std::move(chunk_offsets)};
+}
+
+void copy_data(int num_bufs,
+               uint8_t const** d_src_bufs,
+               uint8_t** d_dst_bufs,
+               dst_buf_info* _d_dst_buf_info,
+               rmm::cuda_stream_view stream)
+{
+  auto [d_dst_buf_info, chunk_offsets] = chunk_copies(num_bufs, _d_dst_buf_info, stream);
+  auto const new_buf_count             = static_cast<size_type>(d_dst_buf_info.size());
+
   // perform the copy
   constexpr size_type block_size = 256;
   copy_partitions<block_size><<<new_buf_count, block_size, 0, stream.value()>>>(
@@ -920,7 +949,7 @@ void copy_data(int num_bufs,
 
   // postprocess valid_counts
   auto keys = cudf::detail::make_counting_transform_iterator(
-    0, [out_to_in_index] __device__(size_type i) { return out_to_in_index(i); });
+    0, out_to_in_index_func{chunk_offsets.begin(), num_bufs});
   auto values = thrust::make_transform_iterator(
     d_dst_buf_info.begin(), [] __device__(dst_buf_info const& info) { return info.valid_count; });
   thrust::reduce_by_key(rmm::exec_policy(stream),
@@ -931,68 +960,83 @@ void copy_data(int num_bufs,
                         dst_valid_count_output_iterator{_d_dst_buf_info});
 }
 
-};  // anonymous namespace
+/**
+ * @brief The source and destination buffers of a contiguous split, with the sizes and offsets of
+ * all the destination buffers, which are computed before any data is copied.
+ *
+ * The destination buffer pointers are set by the caller, once the output is allocated.
+ */
+struct split_setup {
+  std::size_t num_partitions;
+  size_type num_src_bufs;
+  std::size_t num_bufs;
 
-namespace detail {
+  // packed block of memory 1. split indices, src_buf_info structs and the offset stack
+  rmm::device_buffer d_indices_and_source_info;
 
-std::vector<packed_table> contiguous_split(cudf::table_view const& input,
-                                           std::vector<size_type> const& splits,
-                                           rmm::cuda_stream_view stream,
-                                           rmm::mr::device_memory_resource* mr)
-{
-  if (input.num_columns() == 0) { return {}; }
-  if (splits.size() > 0) {
-    CUDF_EXPECTS(splits.back() <= input.column(0).size(),
-                 "splits can't exceed size of input columns");
+  // packed block of memory 2. partition buffer sizes and dst_buf_info structs
+  std::size_t buf_sizes_size;
+  std::size_t dst_buf_info_size;
+  std::vector<uint8_t> h_buf_sizes_and_dst_info;
+  rmm::device_buffer d_buf_sizes_and_dst_info;
+
+  // packed block of memory 3. pointers to source and destination buffers
+  std::size_t src_bufs_size;
+  std::size_t dst_bufs_size;
+  std::vector<uint8_t> h_src_and_dst_buffers;
+  rmm::device_buffer d_src_and_dst_buffers;
+
+  std::size_t* h_buf_sizes()
+  {
+    return reinterpret_cast<std::size_t*>(h_buf_sizes_and_dst_info.data());
   }
+  dst_buf_info* h_dst_buf_info()
   {
-    size_type begin = 0;
-    for (std::size_t i = 0; i < splits.size(); i++) {
-      size_type end = splits[i];
-      CUDF_EXPECTS(begin >= 0, "Starting index cannot be negative.");
-      CUDF_EXPECTS(end >= begin, "End index cannot be smaller than the starting index.");
-      CUDF_EXPECTS(end <= input.column(0).size(), "Slice range out of bounds.");
-      begin = end;
-    }
+    return reinterpret_cast<dst_buf_info*>(h_buf_sizes_and_dst_info.data() + buf_sizes_size);
+  }
+  dst_buf_info* d_dst_buf_info()
+  {
+    return reinterpret_cast<dst_buf_info*>(
+      static_cast<uint8_t*>(d_buf_sizes_and_dst_info.data()) + buf_sizes_size);
+  }
+  uint8_t const** h_src_bufs()
+  {
+    return reinterpret_cast<uint8_t const**>(h_src_and_dst_buffers.data());
+  }
+  uint8_t** h_dst_bufs()
+  {
+    return reinterpret_cast<uint8_t**>(h_src_and_dst_buffers.data() + src_bufs_size);
+  }
+  uint8_t const** d_src_bufs()
+  {
+    return reinterpret_cast<uint8_t const**>(d_src_and_dst_buffers.data());
+  }
+  uint8_t** d_dst_bufs()
+  {
+    return reinterpret_cast<uint8_t**>(static_cast<uint8_t*>(d_src_and_dst_buffers.data()) +
+                                       src_bufs_size);
   }
 
-  std::size_t const num_partitions   = splits.size() + 1;
-  std::size_t const num_root_columns = input.num_columns();
-
-  // if inputs are empty, just return num_partitions empty tables
-  if (input.column(0).size() == 0) {
-    // sanitize the inputs (to handle corner cases like sliced tables)
-    std::vector<std::unique_ptr<column>> empty_columns;
-    empty_columns.reserve(input.num_columns());
-    std::transform(
-      input.begin(), input.end(), std::back_inserter(empty_columns), [](column_view const& col) {
-        return cudf::empty_like(col);
-      });
-    std::vector<cudf::column_view> empty_column_views;
-    empty_column_views.reserve(input.num_columns());
-    std::transform(empty_columns.begin(),
-                   empty_columns.end(),
-                   std::back_inserter(empty_column_views),
-                   [](std::unique_ptr<column> const& col) { return col->view(); });
-    table_view empty_inputs(empty_column_views);
-
-    // build the empty results
-    std::vector<packed_table> result;
-    result.reserve(num_partitions);
-    auto iter = thrust::make_counting_iterator(0);
-    std::transform(iter,
-                   iter + num_partitions,
-                   std::back_inserter(result),
-                   [&empty_inputs](int partition_index) {
-                     return packed_table{
-                       empty_inputs,
-                       packed_columns{std::make_unique<packed_columns::metadata>(pack_metadata(
-                                        empty_inputs, static_cast<uint8_t const*>(nullptr), 0)),
-                                      std::make_unique<rmm::device_buffer>()}};
-                   });
-
-    return result;
+  // HtoD src and dest buffers
+  void copy_buffer_pointers_to_device(rmm::cuda_stream_view stream)
+  {
+    CUDA_TRY(cudaMemcpyAsync(d_src_and_dst_buffers.data(),
+                             h_src_and_dst_buffers.data(),
+                             src_bufs_size + dst_bufs_size,
+                             cudaMemcpyHostToDevice,
+                             stream.value()));
   }
+};
+
+/**
+ * @brief Compute the sizes and offsets of all the destination buffers of a contiguous split of a
+ * non-empty table, and bring them back to the host.
+ */
+split_setup setup_split(cudf::table_view const& input,
+                        std::vector<size_type> const& splits,
+                        rmm::cuda_stream_view stream)
+{
+  std::size_t const num_partitions = splits.size() + 1;
 
   // compute # of source buffers (column data, validity, children), # of partitions
   // and total # of buffers
@@ -1047,8 +1091,6 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
   // host-side
   std::vector<uint8_t> h_buf_sizes_and_dst_info(buf_sizes_size + dst_buf_info_size);
   std::size_t* h_buf_sizes = reinterpret_cast<std::size_t*>(h_buf_sizes_and_dst_info.data());
-  dst_buf_info* h_dst_buf_info =
-    reinterpret_cast<dst_buf_info*>(h_buf_sizes_and_dst_info.data() + buf_sizes_size);
   // device-side
   rmm::device_buffer d_buf_sizes_and_dst_info(
     buf_sizes_size + dst_buf_info_size, stream, rmm::mr::get_current_device_resource());
@@ -1174,52 +1216,129 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
                            stream.value()));
   stream.synchronize();
 
-  // allocate output partition buffers
-  std::vector<rmm::device_buffer> out_buffers;
-  out_buffers.reserve(num_partitions);
-  std::transform(h_buf_sizes,
-                 h_buf_sizes + num_partitions,
-                 std::back_inserter(out_buffers),
-                 [stream, mr](std::size_t bytes) {
-                   return rmm::device_buffer{bytes, stream, mr};
-                 });
-
-  // packed block of memory 3. pointers to source and destination buffers (and stack space on the
-  // gpu for offset computation)
+  // packed block of memory 3. pointers to source and destination buffers
   std::size_t const src_bufs_size =
     cudf::util::round_up_safe(num_src_bufs * sizeof(uint8_t*), split_align);
   std::size_t const dst_bufs_size =
     cudf::util::round_up_safe(num_partitions * sizeof(uint8_t*), split_align);
   // host-side
   std::vector<uint8_t> h_src_and_dst_buffers(src_bufs_size + dst_bufs_size);
-  uint8_t const** h_src_bufs = reinterpret_cast<uint8_t const**>(h_src_and_dst_buffers.data());
-  uint8_t** h_dst_bufs = reinterpret_cast<uint8_t**>(h_src_and_dst_buffers.data() + src_bufs_size);
   // device-side
-  rmm::device_buffer d_src_and_dst_buffers(src_bufs_size + dst_bufs_size + offset_stack_size,
-                                           stream,
-                                           rmm::mr::get_current_device_resource());
-  auto const** d_src_bufs = reinterpret_cast<uint8_t const**>(d_src_and_dst_buffers.data());
-  uint8_t** d_dst_bufs    = reinterpret_cast<uint8_t**>(
-    reinterpret_cast<uint8_t*>(d_src_and_dst_buffers.data()) + src_bufs_size);
+  rmm::device_buffer d_src_and_dst_buffers(
+    src_bufs_size + dst_bufs_size, stream, rmm::mr::get_current_device_resource());
 
   // setup src buffers
-  setup_src_buf_data(input.begin(), input.end(), h_src_bufs);
+  setup_src_buf_data(input.begin(),
+                     input.end(),
+                     reinterpret_cast<uint8_t const**>(h_src_and_dst_buffers.data()));
+
+  return split_setup{num_partitions,
+                     num_src_bufs,
+                     num_bufs,
+                     std::move(d_indices_and_source_info),
+                     buf_sizes_size,
+                     dst_buf_info_size,
+                     std::move(h_buf_sizes_and_dst_info),
+                     std::move(d_buf_sizes_and_dst_info),
+                     src_bufs_size,
+                     dst_bufs_size,
+                     std::move(h_src_and_dst_buffers),
+                     std::move(d_src_and_dst_buffers)};
+}
+
+};  // anonymous namespace
+
+namespace detail {
+
+std::vector<packed_table> contiguous_split(cudf::table_view const& input,
+                                           std::vector<size_type> const& splits,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  if (input.num_columns() == 0) { return {}; }
+  if (splits.size() > 0) {
+    CUDF_EXPECTS(splits.back() <= input.column(0).size(),
+                 "splits can't exceed size of input columns");
+  }
+  {
+    size_type begin = 0;
+    for (std::size_t i = 0; i < splits.size(); i++) {
+      size_type end = splits[i];
+      CUDF_EXPECTS(begin >= 0, "Starting index cannot be negative.");
+      CUDF_EXPECTS(end >= begin, "End index cannot be smaller than the starting index.");
+      CUDF_EXPECTS(end <= input.column(0).size(), "Slice range out of bounds.");
+      begin = end;
+    }
+  }
+
+  std::size_t const num_partitions   = splits.size() + 1;
+  std::size_t const num_root_columns = input.num_columns();
+
+  // if inputs are empty, just return num_partitions empty tables
+  if (input.column(0).size() == 0) {
+    // sanitize the inputs (to handle corner cases like sliced tables)
+    std::vector<std::unique_ptr<column>> empty_columns;
+    empty_columns.reserve(input.num_columns());
+    std::transform(
+      input.begin(), input.end(), std::back_inserter(empty_columns), [](column_view const& col) {
+        return cudf::empty_like(col);
+      });
+    std::vector<cudf::column_view> empty_column_views;
+    empty_column_views.reserve(input.num_columns());
+    std::transform(empty_columns.begin(),
+                   empty_columns.end(),
+                   std::back_inserter(empty_column_views),
+                   [](std::unique_ptr<column> const& col) { return col->view(); });
+    table_view empty_inputs(empty_column_views);
+
+    // build the empty results
+    std::vector<packed_table> result;
+    result.reserve(num_partitions);
+    auto iter = thrust::make_counting_iterator(0);
+    std::transform(iter,
+                   iter + num_partitions,
+                   std::back_inserter(result),
+                   [&empty_inputs](int partition_index) {
+                     return packed_table{
+                       empty_inputs,
+                       packed_columns{std::make_unique<packed_columns::metadata>(pack_metadata(
+                                        empty_inputs, static_cast<uint8_t const*>(nullptr), 0)),
+                                      std::make_unique<rmm::device_buffer>()}};
+                   });
+
+    return result;
+  }
+
+
+  auto setup = setup_split(input, splits, stream);
+
+  // allocate output partition buffers
+  std::vector<rmm::device_buffer> out_buffers;
+  out_buffers.reserve(num_partitions);
+  std::transform(setup.h_buf_sizes(),
+                 setup.h_buf_sizes() + num_partitions,
+                 std::back_inserter(out_buffers),
+                 [stream, mr](std::size_t bytes) {
+                   return rmm::device_buffer{bytes, stream, mr};
+                 });
 
   // setup dst buffers
-  std::transform(out_buffers.begin(), out_buffers.end(), h_dst_bufs, [](auto& buf) {
+  std::transform(out_buffers.begin(), out_buffers.end(), setup.h_dst_bufs(), [](auto& buf) {
     return static_cast<uint8_t*>(buf.data());
   });
 
   // HtoD src and dest buffers
-  CUDA_TRY(cudaMemcpyAsync(
-    d_src_bufs, h_src_bufs, src_bufs_size + dst_bufs_size, cudaMemcpyHostToDevice, stream.value()));
+  setup.copy_buffer_pointers_to_device(stream);
 
   // perform the copy.
-  copy_data(num_bufs, num_src_bufs, d_src_bufs, d_dst_bufs, d_dst_buf_info, stream);
+  copy_data(setup.num_bufs, setup.d_src_bufs(), setup.d_dst_bufs(), setup.d_dst_buf_info(), stream);
 
   // DtoH dst info (to retrieve null counts)
-  CUDA_TRY(cudaMemcpyAsync(
-    h_dst_buf_info, d_dst_buf_info, dst_buf_info_size, cudaMemcpyDeviceToHost, stream.value()));
+  CUDA_TRY(cudaMemcpyAsync(setup.h_dst_buf_info(),
+                           setup.d_dst_buf_info(),
+                           setup.dst_buf_info_size,
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
 
   stream.synchronize();
 
@@ -1228,11 +1347,14 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
   result.reserve(num_partitions);
   std::vector<column_view> cols;
   cols.reserve(num_root_columns);
-  auto cur_dst_buf_info = h_dst_buf_info;
+  auto cur_dst_buf_info = setup.h_dst_buf_info();
   for (std::size_t idx = 0; idx < num_partitions; idx++) {
     // traverse the buffers and build the columns.
-    cur_dst_buf_info = build_output_columns(
-      input.begin(), input.end(), cur_dst_buf_info, std::back_inserter(cols), h_dst_bufs[idx]);
+    cur_dst_buf_info = build_output_columns(input.begin(),
+                                            input.end(),
+                                            cur_dst_buf_info,
+                                            std::back_inserter(cols),
+                                            setup.h_dst_bufs()[idx]);
 
     // pack the columns
     cudf::table_view t{cols};
@@ -1248,6 +1370,132 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
   return result;
 }
 
+/**
+ * @brief The state of a `cudf::chunked_pack`.
+ *
+ * The layout of the packed table, its metadata and the chunked copies are computed up front, and
+ * the copies are grouped into iterations, each of which fills at most `user_buffer_size` bytes of
+ * the packed table.
+ */
+struct chunked_pack_state {
+  chunked_pack_state(cudf::table_view const& input,
+                     std::size_t user_buffer_size,
+                     rmm::cuda_stream_view stream)
+    : stream(stream)
+  {
+    CUDF_EXPECTS(user_buffer_size >= desired_chunk_size,
+                 "The user buffer must be at least 1MB in size");
+
+    if (input.num_columns() == 0) {
+      metadata = std::make_unique<packed_columns::metadata>();
+      return;
+    }
+    if (input.column(0).size() == 0) {
+      // sanitize the inputs (to handle corner cases like sliced tables)
+      std::vector<std::unique_ptr<column>> empty_columns;
+      empty_columns.reserve(input.num_columns());
+      std::transform(
+        input.begin(), input.end(), std::back_inserter(empty_columns), [](column_view const& col) {
+          return cudf::empty_like(col);
+        });
+      std::vector<column_view> empty_column_views;
+      empty_column_views.reserve(input.num_columns());
+      std::transform(empty_columns.begin(),
+                     empty_columns.end(),
+                     std::back_inserter(empty_column_views),
+                     [](std::unique_ptr<column> const& col) { return col->view(); });
+      metadata = std::make_unique<packed_columns::metadata>(pack_metadata(
+        table_view{empty_column_views}, static_cast<uint8_t const*>(nullptr), 0));
+      return;
+    }
+
+    setup      = std::make_unique<split_setup>(setup_split(input, {}, stream));
+    total_size = setup->h_buf_sizes()[0];
+
+    // the null counts of the packed table are those of the source ranges of its validity buffers
+    std::vector<dst_buf_info> h_dst_buf_info(setup->h_dst_buf_info(),
+                                             setup->h_dst_buf_info() + setup->num_bufs);
+    for (auto& info : h_dst_buf_info) {
+      if (info.valid_count == 0 || info.num_rows == 0) { continue; }
+      auto const bitmask =
+        reinterpret_cast<bitmask_type const*>(setup->h_src_bufs()[info.src_buf_index]);
+      auto const row_start =
+        info.src_element_index * static_cast<size_type>(size_in_bits<bitmask_type>()) +
+        info.bit_shift;
+      info.valid_count =
+        cudf::detail::valid_count(bitmask, row_start, row_start + info.num_rows, stream);
+    }
+
+    // the metadata only holds offsets from the base of the packed table, so that any non-null
+    // address can stand for the base
+    auto const base_ptr = reinterpret_cast<uint8_t const*>(split_align);
+    std::vector<column_view> cols;
+    cols.reserve(input.num_columns());
+    build_output_columns(
+      input.begin(), input.end(), h_dst_buf_info.data(), std::back_inserter(cols), base_ptr);
+    metadata = std::make_unique<packed_columns::metadata>(
+      pack_metadata(table_view{cols}, base_ptr, total_size));
+
+    // group the chunked copies into iterations, each of which fills at most user_buffer_size bytes
+    auto const d_copies = chunk_copies(setup->num_bufs, setup->d_dst_buf_info(), stream).first;
+    auto h_copies       = cudf::detail::make_std_vector_sync(
+      device_span<dst_buf_info const>{d_copies.data(), d_copies.size()}, stream);
+    iteration_copies.push_back(0);
+    iteration_offsets.push_back(0);
+    for (std::size_t i = 0; i < h_copies.size(); ++i) {
+      auto& copy = h_copies[i];
+      auto const copy_end =
+        cudf::util::round_up_safe(copy.dst_offset + static_cast<std::size_t>(copy.num_elements) *
+                                                      static_cast<std::size_t>(copy.element_size),
+                                  split_align);
+      if (copy_end - iteration_offsets.back() > user_buffer_size) {
+        iteration_copies.push_back(i);
+        iteration_offsets.push_back(copy.dst_offset);
+      }
+      copy.dst_offset -= iteration_offsets.back();
+    }
+    iteration_copies.push_back(h_copies.size());
+    iteration_offsets.push_back(total_size);
+    copies = cudf::detail::make_device_uvector_sync(h_copies, stream);
+  }
+
+  [[nodiscard]] bool has_next() const { return current_iteration + 1 < iteration_offsets.size(); }
+
+  std::size_t next(cudf::device_span<uint8_t> const& user_buffer)
+  {
+    CUDF_EXPECTS(has_next(), "chunked_pack has no more data to pack");
+    CUDF_EXPECTS(reinterpret_cast<std::uintptr_t>(user_buffer.data()) % split_align == 0,
+                 "The user buffer must be aligned to 64 bytes");
+    auto const bytes =
+      iteration_offsets[current_iteration + 1] - iteration_offsets[current_iteration];
+    CUDF_EXPECTS(user_buffer.size() >= bytes, "The user buffer is too small");
+
+    auto const first_copy = iteration_copies[current_iteration];
+    auto const num_copies = iteration_copies[current_iteration + 1] - first_copy;
+    if (num_copies > 0) {
+      setup->h_dst_bufs()[0] = user_buffer.data();
+      setup->copy_buffer_pointers_to_device(stream);
+
+      constexpr size_type block_size = 256;
+      copy_partitions<block_size><<<num_copies, block_size, 0, stream.value()>>>(
+        setup->d_src_bufs(), setup->d_dst_bufs(), copies.data() + first_copy);
+    }
+    ++current_iteration;
+    return bytes;
+  }
+
+  rmm::cuda_stream_view stream;
+  std::size_t total_size = 0;
+  std::unique_ptr<packed_columns::metadata> metadata;
+  std::unique_ptr<split_setup> setup;
+  // the chunked copies of all the iterations, with their offsets into the user buffer
+  rmm::device_uvector<dst_buf_info> copies{0, stream};
+  // offsets of the first chunked copy, and of the data in the packed table, of each iteration
+  std::vector<std::size_t> iteration_copies;
+  std::vector<std::size_t> iteration_offsets;
+  std::size_t current_iteration = 0;
+};
+
 };  // namespace detail
 
 std::vector<packed_table> contiguous_split(cudf::table_view const& input,
@@ -1258,4 +1506,28 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
   return cudf::detail::contiguous_split(input, splits, rmm::cuda_stream_default, mr);
 }
 
-};  // namespace cudf
\ No newline at end of file
+chunked_pack::chunked_pack(cudf::table_view const& input, std::size_t user_buffer_size)
+  : state{std::make_unique<detail::chunked_pack_state>(
+      input, user_buffer_size, rmm::cuda_stream_default)}
+{
+  CUDF_FUNC_RANGE();
+}
+
+chunked_pack::~chunked_pack() = default;
+
+std::size_t chunked_pack::get_total_contiguous_size() const { return state->total_size; }
+
+bool chunked_pack::has_next() const { return state->has_next(); }
+
+std::size_t chunked_pack::next(cudf::device_span<uint8_t> const& user_buffer)
+{
+  CUDF_FUNC_RANGE();
+  return state->next(user_buffer);
+}
+
+std::unique_ptr<packed_columns::metadata> chunked_pack::build_metadata() const
+{
+  return std::make_unique<packed_columns::metadata>(*state->metadata);
+}
+
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,17 +16,124 @@
 
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/indexalator.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/stream_capture.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+
+#include <algorithm>
+#include <vector>
 
 namespace cudf {
 namespace detail {
+namespace {
+
+// Minimum average length of the runs of consecutive indices of a gather map for the runs to be
+// copied in bulk instead of gathering row by row
+constexpr size_type min_average_run_length = 1024;
+
+/**
+ * @brief Returns whether a row of a gather map starts a run of consecutive indices.
+ */
+template <typename MapIterator>
+struct run_head_checker {
+  MapIterator gather_map;
+
+  __device__ bool operator()(size_type i) const
+  {
+    return i == 0 or gather_map[i] != gather_map[i - 1] + 1;
+  }
+};
+
+/**
+ * @brief Gathers by copying each run of consecutive indices of the gather map as a slice.
+ *
+ * Maps from filters and merges are often made of long runs. Copying them as slices moves the
+ * data with coalesced memcpys, including the chars of strings, which a row by row gather copies
+ * one string at a time.
+ *
+ * @return The gathered table, or nullptr if the table has nested or dictionary columns, the runs
+ * are on average shorter than `min_average_run_length`, or a run is out of bounds.
+ */
+template <typename MapIterator>
+std::unique_ptr<table> gather_runs(table_view const& source_table,
+                                   MapIterator gather_map,
+                                   size_type gather_map_size,
+                                   out_of_bounds_policy bounds_policy,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  bool const is_flat =
+    std::all_of(source_table.begin(), source_table.end(), [](column_view const& col) {
+      return is_fixed_width(col.type()) or col.type().id() == type_id::STRING;
+    });
+  // Counting the runs reads their number back to the host, which cannot be captured
+  if (source_table.num_columns() == 0 or not is_flat or
+      gather_map_size < min_average_run_length or is_capturing(stream)) {
+    return nullptr;
+  }
+
+  auto const is_run_head = run_head_checker<MapIterator>{gather_map};
+  auto const rows        = thrust::make_counting_iterator<size_type>(0);
+  auto const num_runs    = static_cast<size_type>(
+    thrust::count_if(rmm::exec_policy(stream), rows, rows + gather_map_size, is_run_head));
+  if (gather_map_size / num_runs < min_average_run_length) { return nullptr; }
+
+  // the first output row and the first source row of each run
+  rmm::device_uvector<size_type> d_runs(2 * num_runs, stream);
+  auto const rows_and_map = thrust::make_zip_iterator(thrust::make_tuple(rows, gather_map));
+  thrust::copy_if(
+    rmm::exec_policy(stream),
+    rows_and_map,
+    rows_and_map + gather_map_size,
+    rows,
+    thrust::make_zip_iterator(thrust::make_tuple(d_runs.begin(), d_runs.begin() + num_runs)),
+    is_run_head);
+  auto const runs = make_std_vector_sync(d_runs, stream);
+
+  std::vector<size_type> slice_indices;
+  slice_indices.reserve(2 * num_runs);
+  for (size_type i = 0; i < num_runs; ++i) {
+    auto const length = (i + 1 < num_runs ? runs[i + 1] : gather_map_size) - runs[i];
+    auto const begin  = runs[num_runs + i];
+    if (begin < 0 or begin > source_table.num_rows() - length) { return nullptr; }
+    slice_indices.push_back(begin);
+    slice_indices.push_back(begin + length);
+  }
+  auto const slices = detail::slice(source_table, slice_indices, stream);
+  auto gathered      = num_runs == 1 ? std::make_unique<table>(slices.front(), stream, mr)
+                                     : detail::concatenate(slices, stream, mr);
+  auto columns       = gathered->release();
+
+  // match the nullability of a row by row gather
+  for (size_type i = 0; i < source_table.num_columns(); ++i) {
+    if ((bounds_policy == out_of_bounds_policy::NULLIFY or source_table.column(i).nullable()) and
+        not columns[i]->nullable()) {
+      columns[i]->set_null_mask(
+        create_null_mask(gather_map_size, mask_state::ALL_VALID, stream, mr), 0);
+    }
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace
 
 std::unique_ptr<table> gather(table_view const& source_table,
                               column_view const& gather_map,
@@ -35,23 +142,28 @@ std::unique_ptr<table> gather(table_view const& source_table,
                               rmm::cuda_stream_view stream,
                               rmm::mr::device_memory_resource* mr)
 {
-  CUDF_EXPECTS(gather_map.has_nulls() == false, "gather_map contains nulls");
+  // The null count of a map produced by a captured call may only be known once the graph has
+  // been launched
+  CUDF_EXPECTS(is_capturing(stream) or gather_map.has_nulls() == false,
+               "gather_map contains nulls");
 
   // create index type normalizing iterator for the gather_map
   auto map_begin = indexalator_factory::make_input_iterator(gather_map);
   auto map_end   = map_begin + gather_map.size();
 
+  auto const gather_with = [&](auto begin, auto end) {
+    auto result = gather_runs(source_table, begin, gather_map.size(), bounds_policy, stream, mr);
+    if (result) { return result; }
+    return gather(source_table, begin, end, bounds_policy, stream, mr);
+  };
+
   if (neg_indices == negative_index_policy::ALLOWED) {
     cudf::size_type n_rows = source_table.num_rows();
     auto idx_converter = [n_rows] __device__(size_type in) { return in < 0 ? in + n_rows : in; };
-    return gather(source_table,
-                  thrust::make_transform_iterator(map_begin, idx_converter),
-                  thrust::make_transform_iterator(map_end, idx_converter),
-                  bounds_policy,
-                  stream,
-                  mr);
+    return gather_with(thrust::make_transform_iterator(map_begin, idx_converter),
+                       thrust::make_transform_iterator(map_end, idx_converter));
   }
-  return gather(source_table, map_begin, map_end, bounds_policy, stream, mr);
+  return gather_with(map_begin, map_end);
 }
 
 std::unique_ptr<table> gather(table_view const& source_table,
@@ -74,15 +186,15 @@ std::unique_ptr<table> gather(table_view const& source_table,
 std::unique_ptr<table> gather(table_view const& source_table,
                               column_view const& gather_map,
                               out_of_bounds_policy bounds_policy,
+                              rmm::cuda_stream_view stream,
                               rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(source_table, stream);
 
   auto index_policy = is_unsigned(gather_map.type()) ? detail::negative_index_policy::NOT_ALLOWED
                                                      : detail::negative_index_policy::ALLOWED;
 
-  return detail::gather(
-    source_table, gather_map, bounds_policy, index_policy, rmm::cuda_stream_default, mr);
+  return detail::gather(source_table, gather_map, bounds_policy, index_policy, stream, mr);
 }
 
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,21 +16,107 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/random.h>
 #include <thrust/random/uniform_int_distribution.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
 #include <thrust/shuffle.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 namespace cudf {
 namespace detail {
+namespace {
+
+/**
+ * @brief Draws the `i`th of a sequence of random integers uniform in `[0, max]`.
+ */
+template <typename T>
+struct random_draw_fn {
+  int64_t seed;
+  T max;
+
+  __device__ T operator()(size_type i) const
+  {
+    thrust::default_random_engine rng(seed);
+    thrust::uniform_int_distribution<T> dist{0, max};
+    rng.discard(i);
+    return dist(rng);
+  }
+};
+
+// Largest fraction of the rows sampled without replacement from the drawn indices rather than
+// from a shuffle of all the row indices
+constexpr double max_sparse_sample_fraction = 0.125;
+
+/**
+ * @brief Draws `n` distinct row indices out of `num_rows`, uniformly at random and in random
+ * order, with memory and work proportional to `n`.
+ *
+ * Indices are drawn with replacement and deduplicated. The distinct indices of independent
+ * uniform draws are a uniform random subset, so shuffling them and keeping `n` gives a uniform
+ * random sample. Enough indices are drawn to expect slightly more than `n` distinct ones, and
+ * more are drawn in the unlikely case of too many duplicates.
+ */
+rmm::device_uvector<size_type> sample_distinct_indices(size_type num_rows,
+                                                       size_type n,
+                                                       int64_t seed,
+                                                       rmm::cuda_stream_view stream)
+{
+  // Expected number of draws for `n` distinct indices
+  auto const expected_draws =
+    std::log1p(-static_cast<double>(n) / num_rows) / std::log1p(-1.0 / num_rows);
+  auto num_draws = static_cast<size_type>(std::ceil(expected_draws * 1.05)) + 32;
+
+  for (int64_t attempt = 0;; ++attempt) {
+    auto const draw_seed = seed + attempt;
+    rmm::device_uvector<size_type> indices(num_draws, stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_draws),
+                      indices.begin(),
+                      random_draw_fn<size_type>{draw_seed, num_rows - 1});
+    thrust::sort(rmm::exec_policy(stream), indices.begin(), indices.end());
+    auto const num_distinct = static_cast<size_type>(thrust::distance(
+      indices.begin(), thrust::unique(rmm::exec_policy(stream), indices.begin(), indices.end())));
+    if (num_distinct >= n) {
+      thrust::shuffle(rmm::exec_policy(stream),
+                      indices.begin(),
+                      indices.begin() + num_distinct,
+                      thrust::default_random_engine(draw_seed));
+      indices.resize(n, stream);
+      return indices;
+    }
+    num_draws = static_cast<size_type>(std::min<int64_t>(2 * static_cast<int64_t>(num_draws),
+                                                         std::numeric_limits<size_type>::max()));
+  }
+}
+
+}  // namespace
 
 std::unique_ptr<table> sample(table_view const& input,
                               size_type const n,
@@ -49,16 +135,14 @@ std::unique_ptr<table> sample(table_view const& input,
   if (n == 0) return cudf::empty_like(input);
 
   if (replacement == sample_with_replacement::TRUE) {
-    auto RandomGen = [seed, num_rows] __device__(auto i) {
-      thrust::default_random_engine rng(seed);
-      thrust::uniform_int_distribution<size_type> dist{0, num_rows - 1};
-      rng.discard(i);
-      return dist(rng);
-    };
-
-    auto begin = cudf::detail::make_counting_transform_iterator(0, RandomGen);
+    auto begin = cudf::detail::make_counting_transform_iterator(
+      0, random_draw_fn<size_type>{seed, num_rows - 1});
 
     return detail::gather(input, begin, begin + n, out_of_bounds_policy::DONT_CHECK, stream, mr);
+  } else if (n <= max_sparse_sample_fraction * num_rows) {
+    auto const gather_map = sample_distinct_indices(num_rows, n, seed, stream);
+    return detail::gather(
+      input, gather_map.begin(), gather_map.end(), out_of_bounds_policy::DONT_CHECK, stream, mr);
   } else {
     auto gather_map =
       make_numeric_column(data_type{type_id::INT32}, num_rows, mask_state::UNALLOCATED, stream);
@@ -82,6 +166,81 @@ std::unique_ptr<table> sample(table_view const& input,
   }
 }
 
+std::unique_ptr<table> stratified_sample(table_view const& input,
+                                         std::vector<size_type> const& keys,
+                                         double const fraction,
+                                         int64_t const seed,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(fraction >= 0 and fraction <= 1, "sampled fraction should be in [0, 1]");
+  auto const num_rows = input.num_rows();
+  if (num_rows == 0 or fraction == 0) { return cudf::empty_like(input); }
+  if (keys.empty()) {
+    auto const n = static_cast<size_type>(std::llround(fraction * num_rows));
+    return detail::sample(input, n, sample_with_replacement::FALSE, seed, stream, mr);
+  }
+
+  // Label the rows by stratum
+  auto const [strata, labels] = detail::encode(input.select(keys), stream);
+  auto const num_strata       = strata->num_rows();
+  auto const d_labels         = labels->view().data<size_type>();
+
+  rmm::device_uvector<size_type> strata_sizes(num_strata, stream);
+  thrust::fill(rmm::exec_policy(stream), strata_sizes.begin(), strata_sizes.end(), 0);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_rows,
+                     [d_labels, d_sizes = strata_sizes.data()] __device__(size_type i) {
+                       atomicAdd(d_sizes + d_labels[i], 1);
+                     });
+  rmm::device_uvector<size_type> strata_begins(num_strata, stream);
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), strata_sizes.begin(), strata_sizes.end(), strata_begins.begin());
+  rmm::device_uvector<size_type> sample_sizes(num_strata, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    strata_sizes.begin(),
+                    strata_sizes.end(),
+                    sample_sizes.begin(),
+                    [fraction] __device__(size_type size) {
+                      return static_cast<size_type>(llround(fraction * size));
+                    });
+  auto const total_samples =
+    thrust::reduce(rmm::exec_policy(stream), sample_sizes.begin(), sample_sizes.end());
+
+  // Order the rows by stratum, and randomly within each, so that the first rows of each stratum
+  // are a uniform random sample of it
+  rmm::device_uvector<uint64_t> sort_keys(num_rows, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    sort_keys.begin(),
+                    [d_labels,
+                     draw = random_draw_fn<uint32_t>{seed, std::numeric_limits<uint32_t>::max()}]
+                    __device__(size_type i) {
+                      return (static_cast<uint64_t>(d_labels[i]) << 32) | draw(i);
+                    });
+  rmm::device_uvector<size_type> rows(num_rows, stream);
+  thrust::sequence(rmm::exec_policy(stream), rows.begin(), rows.end());
+  thrust::sort_by_key(rmm::exec_policy(stream), sort_keys.begin(), sort_keys.end(), rows.begin());
+
+  rmm::device_uvector<size_type> gather_map(total_samples, stream);
+  thrust::copy_if(rmm::exec_policy(stream),
+                  rows.begin(),
+                  rows.end(),
+                  thrust::make_counting_iterator<size_type>(0),
+                  gather_map.begin(),
+                  [d_sort_keys     = sort_keys.data(),
+                   d_strata_begins = strata_begins.data(),
+                   d_sample_sizes  = sample_sizes.data()] __device__(size_type position) {
+                    auto const label = static_cast<size_type>(d_sort_keys[position] >> 32);
+                    return position - d_strata_begins[label] < d_sample_sizes[label];
+                  });
+
+  return detail::gather(
+    input, gather_map.begin(), gather_map.end(), out_of_bounds_policy::DONT_CHECK, stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> sample(table_view const& input,
@@ -94,4 +253,15 @@ std::unique_ptr<table> sample(table_view const& input,
 
   return detail::sample(input, n, replacement, seed, rmm::cuda_stream_default, mr);
 }
+
+std::unique_ptr<table> stratified_sample(table_view const& input,
+                                         std::vector<size_type> const& keys,
+                                         double const fraction,
+                                         int64_t const seed,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  return detail::stratified_sample(input, keys, fraction, seed, rmm::cuda_stream_default, mr);
+}
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,13 +18,14 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/iterator.cuh>
-#include <cudf/detail/null_mask.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
 #include <algorithm>
+#include <iterator>
 
 namespace cudf {
 namespace detail {
@@ -36,13 +37,10 @@ std::vector<column_view> slice(column_view const& input,
 
   if (indices.empty()) return {};
 
-  // need to shift incoming indices by the column offset to generate the correct bit ranges
-  // to count
-  auto indices_iter = cudf::detail::make_counting_transform_iterator(
-    0, [offset = input.offset(), &indices](size_type index) { return indices[index] + offset; });
-  auto null_counts = cudf::detail::segmented_null_count(
-    input.null_mask(), indices_iter, indices_iter + indices.size(), stream);
-
+  // The null counts of the slices are left unknown, to be counted only when they are needed,
+  // unless they are known not to have any null element
+  auto const no_nulls = not input.nullable() or
+                        (input.is_null_count_known() and input.null_count() == 0);
   auto const children = std::vector<column_view>(input.child_begin(), input.child_end());
 
   auto op = [&](auto i) {
@@ -51,11 +49,15 @@ std::vector<column_view> slice(column_view const& input,
     CUDF_EXPECTS(begin >= 0, "Starting index cannot be negative.");
     CUDF_EXPECTS(end >= begin, "End index cannot be smaller than the starting index.");
     CUDF_EXPECTS(end <= input.size(), "Slice range out of bounds.");
+    auto const whole      = begin == 0 and end == input.size();
+    auto const null_count = (no_nulls or begin == end) ? 0
+                            : (whole and input.is_null_count_known()) ? input.null_count()
+                                                                      : UNKNOWN_NULL_COUNT;
     return column_view{input.type(),
                        end - begin,
                        input.head(),
                        input.null_mask(),
-                       null_counts[i],
+                       null_count,
                        input.offset() + begin,
                        children};
   };
@@ -92,6 +94,48 @@ std::vector<table_view> slice(table_view const& input,
   return result;
 }
 
+std::vector<column_view> with_null_counts(host_span<column_view const> views,
+                                          rmm::cuda_stream_view stream)
+{
+  auto const null_counts = batch_null_count(views, stream);
+  std::vector<column_view> result;
+  result.reserve(views.size());
+  std::transform(views.begin(),
+                 views.end(),
+                 null_counts.begin(),
+                 std::back_inserter(result),
+                 [](column_view const& v, size_type null_count) {
+                   return column_view{v.type(),
+                                      v.size(),
+                                      v.head(),
+                                      v.null_mask(),
+                                      null_count,
+                                      v.offset(),
+                                      std::vector<column_view>(v.child_begin(), v.child_end())};
+                 });
+  return result;
+}
+
+std::vector<table_view> with_null_counts(host_span<table_view const> tables,
+                                         rmm::cuda_stream_view stream)
+{
+  // the columns of all the tables are counted together
+  std::vector<column_view> columns;
+  for (auto const& t : tables) {
+    columns.insert(columns.end(), t.begin(), t.end());
+  }
+  auto const counted = with_null_counts(columns, stream);
+
+  std::vector<table_view> result;
+  result.reserve(tables.size());
+  auto it = counted.begin();
+  for (auto const& t : tables) {
+    result.emplace_back(std::vector<column_view>(it, it + t.num_columns()));
+    it += t.num_columns();
+  }
+  return result;
+}
+
 std::vector<column_view> slice(column_view const& input,
                                std::initializer_list<size_type> indices,
                                rmm::cuda_stream_view stream)
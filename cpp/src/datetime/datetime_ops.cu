@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -24,10 +24,13 @@
 #include <cudf/detail/indexalator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <cudf/wrappers/durations.hpp>
@@ -35,25 +38,13 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 
 namespace cudf {
 namespace datetime {
 namespace detail {
-enum class datetime_component {
-  INVALID = 0,
-  YEAR,
-  MONTH,
-  DAY,
-  WEEKDAY,
-  HOUR,
-  MINUTE,
-  SECOND,
-  MILLISECOND,
-  MICROSECOND,
-  NANOSECOND
-};
-
 enum class rounding_function {
   CEIL,   ///< Rounds up to the next integer multiple of the provided frequency
   FLOOR,  ///< Rounds down to the next integer multiple of the provided frequency
@@ -229,6 +220,78 @@ struct is_leap_year_op {
   }
 };
 
+// Extracts several components of a timestamp, converting it to its civil date and time once
+template <typename Timestamp>
+struct extract_components_fn {
+  Timestamp const* timestamps;
+  datetime_component const* components;
+  int16_t* const* outputs;
+  size_type num_components;
+
+  __device__ inline void operator()(size_type idx) const
+  {
+    using namespace cuda::std::chrono;
+
+    auto const ts               = timestamps[idx];
+    auto const days_since_epoch = floor<days>(ts);
+    auto const date             = year_month_day(days_since_epoch);
+    auto const month            = unsigned{date.month()};
+
+    auto time_since_midnight = ts - days_since_epoch;
+    if (time_since_midnight.count() < 0) { time_since_midnight += days(1); }
+
+    auto const hrs_  = duration_cast<hours>(time_since_midnight);
+    auto const mins_ = duration_cast<minutes>(time_since_midnight - hrs_);
+    auto const secs_ = duration_cast<seconds>(time_since_midnight - hrs_ - mins_);
+
+    for (size_type i = 0; i < num_components; ++i) {
+      outputs[i][idx] = [&]() -> int16_t {
+        switch (components[i]) {
+          case datetime_component::YEAR: return static_cast<int>(date.year());
+          case datetime_component::MONTH: return month;
+          case datetime_component::DAY: return static_cast<unsigned>(date.day());
+          case datetime_component::WEEKDAY:
+            return year_month_weekday(days_since_epoch).weekday().iso_encoding();
+          case datetime_component::HOUR: return hrs_.count();
+          case datetime_component::MINUTE: return mins_.count();
+          case datetime_component::SECOND: return secs_.count();
+          case datetime_component::DAY_OF_YEAR:
+            return days_until_month[date.year().is_leap()][month - 1] + unsigned{date.day()};
+          case datetime_component::QUARTER: return (month + 2) / 3;
+          case datetime_component::DAYS_IN_MONTH:
+            return static_cast<unsigned>(
+              year_month_day_last(date.year() / date.month() / last).day());
+          default: return 0;
+        }
+      }();
+    }
+  }
+};
+
+struct dispatch_extract_components {
+  template <typename Timestamp>
+  std::enable_if_t<cudf::is_timestamp<Timestamp>(), void> operator()(
+    cudf::column_view const& column,
+    device_span<datetime_component const> components,
+    device_span<int16_t* const> outputs,
+    rmm::cuda_stream_view stream) const
+  {
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       column.size(),
+                       extract_components_fn<Timestamp>{column.begin<Timestamp>(),
+                                                        components.data(),
+                                                        outputs.data(),
+                                                        static_cast<size_type>(components.size())});
+  }
+
+  template <typename Timestamp, typename... Args>
+  std::enable_if_t<!cudf::is_timestamp<Timestamp>(), void> operator()(Args&&...) const
+  {
+    CUDF_FAIL("Must be cudf::timestamp");
+  }
+};
+
 // Specific function for applying ceil/floor/round date ops
 struct dispatch_round {
   template <typename Timestamp>
@@ -434,7 +497,7 @@ std::unique_ptr<column> extract_year(column_view const& column,
                                      rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::YEAR>,
+    detail::extract_component_operator<datetime_component::YEAR>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -443,7 +506,7 @@ std::unique_ptr<column> extract_month(column_view const& column,
                                       rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MONTH>,
+    detail::extract_component_operator<datetime_component::MONTH>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -452,7 +515,7 @@ std::unique_ptr<column> extract_day(column_view const& column,
                                     rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::DAY>,
+    detail::extract_component_operator<datetime_component::DAY>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -461,7 +524,7 @@ std::unique_ptr<column> extract_weekday(column_view const& column,
                                         rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::WEEKDAY>,
+    detail::extract_component_operator<datetime_component::WEEKDAY>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -470,7 +533,7 @@ std::unique_ptr<column> extract_hour(column_view const& column,
                                      rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::HOUR>,
+    detail::extract_component_operator<datetime_component::HOUR>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -479,7 +542,7 @@ std::unique_ptr<column> extract_minute(column_view const& column,
                                        rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MINUTE>,
+    detail::extract_component_operator<datetime_component::MINUTE>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -488,10 +551,39 @@ std::unique_ptr<column> extract_second(column_view const& column,
                                        rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::SECOND>,
+    detail::extract_component_operator<datetime_component::SECOND>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
+std::unique_ptr<table> extract_components(column_view const& column,
+                                          std::vector<datetime_component> const& components,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(column.type()), "Column type should be timestamp");
+
+  std::vector<std::unique_ptr<column>> outputs;
+  std::vector<int16_t*> output_data;
+  for (std::size_t i = 0; i < components.size(); ++i) {
+    outputs.push_back(make_fixed_width_column(data_type{type_id::INT16},
+                                              column.size(),
+                                              cudf::detail::copy_bitmask(column, stream, mr),
+                                              column.null_count(),
+                                              stream,
+                                              mr));
+    output_data.push_back(outputs.back()->mutable_view().data<int16_t>());
+  }
+
+  if (column.size() > 0 and not components.empty()) {
+    auto const d_components  = cudf::detail::make_device_uvector_async(components, stream);
+    auto const d_output_data = cudf::detail::make_device_uvector_async(output_data, stream);
+    type_dispatcher(
+      column.type(), dispatch_extract_components{}, column, d_components, d_output_data, stream);
+  }
+
+  return std::make_unique<table>(std::move(outputs));
+}
+
 std::unique_ptr<column> last_day_of_month(column_view const& column,
                                           rmm::cuda_stream_view stream,
                                           rmm::mr::device_memory_resource* mr)
@@ -604,6 +696,14 @@ std::unique_ptr<column> extract_second(column_view const& column,
   return detail::extract_second(column, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<table> extract_components(column_view const& column,
+                                          std::vector<datetime_component> const& components,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::extract_components(column, components, rmm::cuda_stream_default, mr);
+}
+
 std::unique_ptr<column> last_day_of_month(column_view const& column,
                                           rmm::mr::device_memory_resource* mr)
 {
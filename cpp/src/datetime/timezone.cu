@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/orc/timezone.cuh>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/datetime.hpp>
+#include <cudf/detail/datetime.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <cudf/wrappers/durations.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace cudf {
+namespace datetime {
+namespace detail {
+namespace {
+
+constexpr size_type block_size = 256;
+// Each block converts enough timestamps to amortize the copy of the tables to shared memory
+constexpr size_type timestamps_per_thread = 16;
+// Tables are searched in global memory when both do not fit in this much shared memory
+constexpr std::size_t max_shared_tables_bytes = 32 * 1024;
+
+/**
+ * @brief Returns the transition table of a timezone, built from its TZif file the first time
+ * the timezone is converted from or to on the current device.
+ *
+ * The tables are never freed, like the other per-context device tables, so that no device
+ * memory is released after the memory resources have been destroyed.
+ */
+io::timezone_table_view get_timezone_table(std::string const& timezone_name,
+                                           rmm::cuda_stream_view stream)
+{
+  static std::mutex tables_mutex;
+  static std::map<std::string, strings::detail::per_context_cache<io::timezone_table>> tables;
+
+  std::lock_guard<std::mutex> lock(tables_mutex);
+  return tables[timezone_name]
+    .find_or_initialize([&] {
+      return new io::timezone_table(io::build_timezone_transition_table(timezone_name, stream));
+    })
+    ->view();
+}
+
+/**
+ * @brief Transition times and their UTC offsets, in global or shared memory.
+ */
+struct transition_table {
+  int64_t const* ttimes;
+  int32_t const* offsets;
+  size_type count;
+
+  /**
+   * @brief Returns the UTC offset, in seconds, at the UTC instant `ts`.
+   */
+  __device__ int32_t utc_offset(int64_t ts) const
+  {
+    return count == 0 ? 0 : io::get_gmt_offset_impl(ttimes, offsets, count, ts);
+  }
+};
+
+/**
+ * @brief Converts the wall times of `input` in one timezone to the wall times of the same
+ * instants in another timezone.
+ *
+ * When `shared_tables` is set, each block first copies both transition tables to shared
+ * memory, the transition times first to keep them aligned, so that the binary searches of all its
+ * timestamps read from it instead of global memory.
+ */
+template <typename Timestamp>
+__global__ void convert_timezone_kernel(Timestamp const* input,
+                                        Timestamp* output,
+                                        size_type size,
+                                        io::timezone_table_view from,
+                                        io::timezone_table_view to,
+                                        bool shared_tables)
+{
+  extern __shared__ int64_t shared_ttimes[];
+
+  auto const from_count = static_cast<size_type>(from.ttimes.size());
+  auto const to_count   = static_cast<size_type>(to.ttimes.size());
+  auto from_table       = transition_table{from.ttimes.data(), from.offsets.data(), from_count};
+  auto to_table         = transition_table{to.ttimes.data(), to.offsets.data(), to_count};
+  if (shared_tables) {
+    auto const shared_offsets = reinterpret_cast<int32_t*>(shared_ttimes + from_count + to_count);
+    for (auto i = static_cast<size_type>(threadIdx.x); i < from_count + to_count;
+         i += blockDim.x) {
+      shared_ttimes[i]  = i < from_count ? from.ttimes[i] : to.ttimes[i - from_count];
+      shared_offsets[i] = i < from_count ? from.offsets[i] : to.offsets[i - from_count];
+    }
+    __syncthreads();
+    from_table = transition_table{shared_ttimes, shared_offsets, from_count};
+    to_table =
+      transition_table{shared_ttimes + from_count, shared_offsets + from_count, to_count};
+  }
+
+  auto const stride = blockDim.x * gridDim.x;
+  for (auto idx = static_cast<size_type>(threadIdx.x + blockIdx.x * blockDim.x); idx < size;
+       idx += stride) {
+    auto const elapsed  = input[idx].time_since_epoch();
+    auto const local_ts = cuda::std::chrono::floor<duration_s>(elapsed).count();
+    // The offset of a wall time is the one at the instant it names, which is found by first
+    // reading the wall time as a UTC instant
+    auto const from_offset = from_table.utc_offset(local_ts - from_table.utc_offset(local_ts));
+    auto const delta       = to_table.utc_offset(local_ts - from_offset) - from_offset;
+    output[idx]            = Timestamp{
+      cuda::std::chrono::floor<typename Timestamp::duration>(elapsed + duration_s{delta})};
+  }
+}
+
+struct dispatch_convert_timezone {
+  template <typename Timestamp>
+  std::enable_if_t<cudf::is_timestamp<Timestamp>(), std::unique_ptr<cudf::column>> operator()(
+    cudf::column_view const& timestamps,
+    io::timezone_table_view from,
+    io::timezone_table_view to,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr) const
+  {
+    auto output = make_fixed_width_column(timestamps.type(),
+                                          timestamps.size(),
+                                          cudf::detail::copy_bitmask(timestamps, stream, mr),
+                                          timestamps.null_count(),
+                                          stream,
+                                          mr);
+    if (timestamps.is_empty()) { return output; }
+
+    auto const num_entries   = from.ttimes.size() + to.ttimes.size();
+    auto const tables_bytes  = num_entries * (sizeof(int64_t) + sizeof(int32_t));
+    auto const shared_tables = tables_bytes <= max_shared_tables_bytes;
+    cudf::detail::grid_1d grid{timestamps.size(), block_size, timestamps_per_thread};
+    convert_timezone_kernel<Timestamp>
+      <<<grid.num_blocks, block_size, shared_tables ? tables_bytes : 0, stream.value()>>>(
+        timestamps.begin<Timestamp>(),
+        output->mutable_view().begin<Timestamp>(),
+        timestamps.size(),
+        from,
+        to,
+        shared_tables);
+    CHECK_CUDA(stream.value());
+
+    return output;
+  }
+
+  template <typename Timestamp, typename... Args>
+  std::enable_if_t<!cudf::is_timestamp<Timestamp>(), std::unique_ptr<cudf::column>> operator()(
+    Args&&...) const
+  {
+    CUDF_FAIL("Must be cudf::timestamp");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<cudf::column> convert_timezone(cudf::column_view const& timestamps,
+                                               std::string const& from_timezone,
+                                               std::string const& to_timezone,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(timestamps.type()), "Column type should be timestamp");
+  auto const from = get_timezone_table(from_timezone, stream);
+  auto const to   = get_timezone_table(to_timezone, stream);
+  return type_dispatcher(
+    timestamps.type(), dispatch_convert_timezone{}, timestamps, from, to, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<cudf::column> convert_timezone(cudf::column_view const& timestamps,
+                                               std::string const& from_timezone,
+                                               std::string const& to_timezone,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_timezone(
+    timestamps, from_timezone, to_timezone, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace datetime
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -29,6 +29,9 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
+#include <vector>
+
 namespace cudf {
 namespace dictionary {
 namespace detail {
@@ -82,6 +85,19 @@ data_type get_indices_type_for_size(size_type keys_size)
   return data_type{type_id::UINT32};
 }
 
+/**
+ * @copydoc cudf::dictionary::detail::indices_view
+ */
+table_view indices_view(table_view const& input)
+{
+  std::vector<column_view> columns(input.begin(), input.end());
+  std::transform(columns.begin(), columns.end(), columns.begin(), [](column_view const& col) {
+    if (col.type().id() != type_id::DICTIONARY32 or col.num_children() == 0) { return col; }
+    return dictionary_column_view(col).get_indices_annotated();
+  });
+  return table_view{columns};
+}
+
 }  // namespace detail
 
 // external API
@@ -0,0 +1,418 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <hash/hash_allocator.cuh>
+#include <hash/helper_functions.cuh>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/dictionary/encode.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/polymorphic_allocator.hpp>
+
+#include <cuco/static_map.cuh>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/scatter.h>
+#include <thrust/swap.h>
+#include <thrust/transform.h>
+
+#include <cuda/std/atomic>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+namespace cudf {
+namespace dictionary {
+namespace detail {
+namespace {
+
+using hash_table_allocator_type = rmm::mr::stream_allocator_adaptor<default_allocator<char>>;
+
+/**
+ * @brief Hash map of the rows of a column, from the index of a row to the index of the first
+ * equal row inserted.
+ */
+using map_type =
+  cuco::static_map<size_type, size_type, cuda::thread_scope_device, hash_table_allocator_type>;
+
+constexpr size_type unused_key{std::numeric_limits<size_type>::max()};
+constexpr size_type unused_value{std::numeric_limits<size_type>::max()};
+
+/**
+ * @brief Returns an empty map sized for `num_rows` rows.
+ */
+std::unique_ptr<map_type> make_map(size_type num_rows, rmm::cuda_stream_view stream)
+{
+  return std::make_unique<map_type>(compute_hash_table_size(std::max(num_rows, 1)),
+                                    unused_key,
+                                    unused_value,
+                                    hash_table_allocator_type{default_allocator<char>{}, stream},
+                                    stream.value());
+}
+
+/**
+ * @brief Writes the indices of the output rows into an unsigned integer column.
+ */
+struct dispatch_write_indices {
+  template <typename IndexType, typename Iterator>
+  std::enable_if_t<is_index_type<IndexType>() and std::is_unsigned_v<IndexType>> operator()(
+    Iterator indices_begin, mutable_column_view& indices, rmm::cuda_stream_view stream) const
+  {
+    thrust::transform(rmm::exec_policy(stream),
+                      indices_begin,
+                      indices_begin + indices.size(),
+                      indices.begin<IndexType>(),
+                      [] __device__(size_type index) { return static_cast<IndexType>(index); });
+  }
+
+  template <typename IndexType, typename Iterator>
+  std::enable_if_t<not(is_index_type<IndexType>() and std::is_unsigned_v<IndexType>)> operator()(
+    Iterator, mutable_column_view&, rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("indices must be type unsigned integer");
+  }
+};
+
+/**
+ * @brief Returns an indices column of type `indices_type` with the values of `indices`.
+ */
+template <typename Iterator>
+std::unique_ptr<column> make_indices_column(data_type indices_type,
+                                            Iterator indices,
+                                            size_type size,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  auto result = make_numeric_column(indices_type, size, mask_state::UNALLOCATED, stream, mr);
+  auto view   = result->mutable_view();
+  type_dispatcher(indices_type, dispatch_write_indices{}, indices, view, stream);
+  return result;
+}
+
+/**
+ * @brief Hasher of the rows of the keys and of the rows of a column probing them.
+ *
+ * The probing rows are identified by their index past the end of the keys, so that the rows of
+ * both stored and searched in the hash map are of the same type.
+ */
+struct keys_probe_hasher {
+  row_hasher<default_hash, nullate::DYNAMIC> keys_hasher;
+  row_hasher<default_hash, nullate::DYNAMIC> probe_hasher;
+  size_type num_keys;
+
+  __device__ hash_value_type operator()(size_type index) const
+  {
+    return index < num_keys ? keys_hasher(index) : probe_hasher(index - num_keys);
+  }
+};
+
+/**
+ * @brief Comparator of the rows of the keys, with each other or with the probing rows, which
+ * are identified as by `keys_probe_hasher`.
+ */
+struct keys_probe_equality {
+  row_equality_comparator<nullate::DYNAMIC> keys_equal;
+  row_equality_comparator<nullate::DYNAMIC> probe_equal;
+  size_type num_keys;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const
+  {
+    if (lhs >= num_keys) { thrust::swap(lhs, rhs); }
+    return rhs < num_keys ? keys_equal(lhs, rhs) : probe_equal(lhs, rhs - num_keys);
+  }
+};
+
+}  // namespace
+
+/**
+ * @copydoc cudf::dictionary::detail::hash_encode
+ */
+std::unique_ptr<column> hash_encode(column_view const& input_column,
+                                    bool sort_keys,
+                                    data_type indices_type,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_unsigned(indices_type), "indices must be type unsigned integer");
+  CUDF_EXPECTS(input_column.type().id() != type_id::DICTIONARY32,
+               "cannot encode a dictionary from a dictionary");
+
+  auto const num_rows  = input_column.size();
+  auto const input     = table_view{{input_column}};
+  auto const d_input   = table_device_view::create(input, stream);
+  auto const has_nulls = nullate::DYNAMIC{input_column.has_nulls()};
+  auto const d_column  = d_input->column(0);
+
+  // insert the valid rows: the first row of each distinct value is the representative of its
+  // value, and the rows in the map are the rows of the keys
+  auto map = make_map(num_rows, stream);
+  row_hasher<default_hash, nullate::DYNAMIC> hasher{has_nulls, *d_input};
+  row_equality_comparator<nullate::DYNAMIC> rows_equal{
+    has_nulls, *d_input, *d_input, null_equality::EQUAL};
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_rows,
+    [d_map = map->get_device_mutable_view(), hasher, rows_equal, d_column] __device__(
+      size_type idx) mutable {
+      if (d_column.is_valid(idx)) { d_map.insert(thrust::make_pair(idx, idx), hasher, rows_equal); }
+    });
+
+  rmm::device_uvector<size_type> first_rows(num_rows, stream);
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    first_rows.begin(),
+    [d_map = map->get_device_view(), hasher, rows_equal, d_column] __device__(size_type idx) {
+      if (d_column.is_null(idx)) { return unused_value; }
+      return d_map.find(idx, hasher, rows_equal)->second.load(cuda::std::memory_order_relaxed);
+    });
+  map.reset();
+
+  // the rows of the keys, in the order of their first row in the column
+  auto const num_keys = static_cast<size_type>(
+    thrust::count_if(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     thrust::make_counting_iterator<size_type>(num_rows),
+                     [d_first_rows = first_rows.data()] __device__(size_type idx) {
+                       return d_first_rows[idx] == idx;
+                     }));
+  rmm::device_uvector<size_type> key_rows(num_keys, stream);
+  thrust::copy_if(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(num_rows),
+                  key_rows.begin(),
+                  [d_first_rows = first_rows.data()] __device__(size_type idx) {
+                    return d_first_rows[idx] == idx;
+                  });
+
+  auto keys_table = cudf::detail::gather(
+    input, key_rows, out_of_bounds_policy::DONT_CHECK, negative_index_policy::NOT_ALLOWED, stream);
+  if (sort_keys) {
+    // only the unique keys are sorted, and their rows follow them
+    auto const order = cudf::detail::sorted_order(keys_table->view(), {}, {}, stream);
+    keys_table       = cudf::detail::gather(keys_table->view(),
+                                      order->view(),
+                                      out_of_bounds_policy::DONT_CHECK,
+                                      negative_index_policy::NOT_ALLOWED,
+                                      stream,
+                                      mr);
+    rmm::device_uvector<size_type> sorted_rows(num_keys, stream);
+    thrust::gather(rmm::exec_policy(stream),
+                   order->view().begin<size_type>(),
+                   order->view().end<size_type>(),
+                   key_rows.begin(),
+                   sorted_rows.begin());
+    key_rows = std::move(sorted_rows);
+  }
+  auto keys_column = std::move(keys_table->release().front());
+  keys_column->set_null_mask(rmm::device_buffer{0, stream, mr}, 0);  // remove the null-mask
+
+  // the index of each key at the row of the key, read through the first row of each row
+  rmm::device_uvector<size_type> key_indices(num_rows, stream);
+  thrust::scatter(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(num_keys),
+                  key_rows.begin(),
+                  key_indices.begin());
+  auto const indices_begin = thrust::make_transform_iterator(
+    first_rows.begin(),
+    [d_key_indices = key_indices.data()] __device__(size_type first_row) {
+      return first_row == unused_value ? 0 : d_key_indices[first_row];
+    });
+  auto indices_column = make_indices_column(indices_type, indices_begin, num_rows, stream, mr);
+
+  return make_dictionary_column(std::move(keys_column),
+                                std::move(indices_column),
+                                cudf::detail::copy_bitmask(input_column, stream, mr),
+                                input_column.null_count());
+}
+
+}  // namespace detail
+
+struct hash_encoder::hash_encoder_impl {
+  rmm::cuda_stream_view const _stream = rmm::cuda_stream_default;
+  std::unique_ptr<column> _keys;
+  std::unique_ptr<table_device_view, std::function<void(table_device_view*)>> _d_keys;
+  std::unique_ptr<detail::map_type> _map;
+
+  hash_encoder_impl(column_view const& keys, rmm::mr::device_memory_resource* mr)
+    : _keys{std::make_unique<column>(keys, _stream, mr)},
+      _d_keys{table_device_view::create(table_view{{_keys->view()}}, _stream)},
+      _map{detail::make_map(keys.size(), _stream)}
+  {
+    CUDF_EXPECTS(keys.type().id() != type_id::DICTIONARY32,
+                 "cannot encode a dictionary from a dictionary");
+    CUDF_EXPECTS(not keys.has_nulls(), "keys must not contain nulls");
+
+    auto const num_keys = keys.size();
+    auto const hasher   = make_hasher(*_d_keys);
+    auto const equal    = make_equality(*_d_keys);
+    thrust::for_each_n(rmm::exec_policy(_stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       num_keys,
+                       [d_map = _map->get_device_mutable_view(), hasher, equal] __device__(
+                         size_type idx) mutable {
+                         d_map.insert(thrust::make_pair(idx, idx), hasher, equal);
+                       });
+    auto const repeated = thrust::count_if(
+      rmm::exec_policy(_stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_keys),
+      [d_map = _map->get_device_view(), hasher, equal] __device__(size_type idx) {
+        return d_map.find(idx, hasher, equal)->second.load(cuda::std::memory_order_relaxed) != idx;
+      });
+    CUDF_EXPECTS(repeated == 0, "keys must be unique");
+    _stream.synchronize();
+  }
+
+  /**
+   * @brief Returns the hasher of the keys and of the rows of `d_probe`.
+   */
+  [[nodiscard]] detail::keys_probe_hasher make_hasher(table_device_view const& d_probe) const
+  {
+    return detail::keys_probe_hasher{
+      row_hasher<default_hash, nullate::DYNAMIC>{nullate::DYNAMIC{false}, *_d_keys},
+      row_hasher<default_hash, nullate::DYNAMIC>{nullate::DYNAMIC{is_nullable(d_probe)}, d_probe},
+      _keys->size()};
+  }
+
+  /**
+   * @brief Returns the comparator of the keys and of the rows of `d_probe`.
+   */
+  [[nodiscard]] detail::keys_probe_equality make_equality(table_device_view const& d_probe) const
+  {
+    return detail::keys_probe_equality{
+      row_equality_comparator<nullate::DYNAMIC>{
+        nullate::DYNAMIC{false}, *_d_keys, *_d_keys, null_equality::EQUAL},
+      row_equality_comparator<nullate::DYNAMIC>{
+        nullate::DYNAMIC{is_nullable(d_probe)}, *_d_keys, d_probe, null_equality::EQUAL},
+      _keys->size()};
+  }
+
+  static bool is_nullable(table_device_view const& d_probe) { return d_probe.column(0).nullable(); }
+
+  std::unique_ptr<column> encode(column_view const& input_column,
+                                 data_type indices_type,
+                                 rmm::mr::device_memory_resource* mr) const
+  {
+    CUDF_EXPECTS(is_unsigned(indices_type), "indices must be type unsigned integer");
+    CUDF_EXPECTS(input_column.type() == _keys->type(), "column type must match the keys type");
+    CUDF_EXPECTS(static_cast<int64_t>(_keys->size()) + input_column.size() <
+                   static_cast<int64_t>(detail::unused_key),
+                 "number of keys and rows exceeds the size_type range");
+
+    auto const num_rows = input_column.size();
+    auto const d_input  = table_device_view::create(table_view{{input_column}}, _stream);
+    auto const d_column = d_input->column(0);
+    auto const hasher   = make_hasher(*d_input);
+    auto const equal    = make_equality(*d_input);
+
+    // the index of the key equal to each row, the unused value for the rows without one
+    rmm::device_uvector<size_type> positions(num_rows, _stream);
+    thrust::transform(rmm::exec_policy(_stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_rows),
+                      positions.begin(),
+                      [d_map    = _map->get_device_view(),
+                       hasher,
+                       equal,
+                       d_column,
+                       num_keys = _keys->size()] __device__(size_type idx) {
+                        if (d_column.is_null(idx)) { return detail::unused_value; }
+                        auto const slot = d_map.find(idx + num_keys, hasher, equal);
+                        return slot == d_map.end()
+                                 ? detail::unused_value
+                                 : slot->second.load(cuda::std::memory_order_relaxed);
+                      });
+
+    auto [null_mask, null_count] = cudf::detail::valid_if(
+      positions.begin(),
+      positions.end(),
+      [] __device__(size_type position) { return position != detail::unused_value; },
+      _stream,
+      mr);
+    auto const indices_begin = thrust::make_transform_iterator(
+      positions.begin(), [] __device__(size_type position) {
+        return position == detail::unused_value ? 0 : position;
+      });
+    auto indices_column =
+      detail::make_indices_column(indices_type, indices_begin, num_rows, _stream, mr);
+
+    return make_dictionary_column(std::make_unique<column>(_keys->view(), _stream, mr),
+                                  std::move(indices_column),
+                                  null_count > 0 ? std::move(null_mask) : rmm::device_buffer{},
+                                  null_count);
+  }
+};
+
+hash_encoder::~hash_encoder() = default;
+
+hash_encoder::hash_encoder(column_view const& keys, rmm::mr::device_memory_resource* mr)
+  : impl{std::make_unique<hash_encoder_impl>(keys, mr)}
+{
+}
+
+column_view hash_encoder::keys() const { return impl->_keys->view(); }
+
+std::unique_ptr<column> hash_encoder::encode(column_view const& column,
+                                             data_type indices_type,
+                                             rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->encode(column, indices_type, mr);
+}
+
+// external API
+
+std::unique_ptr<column> hash_encode(column_view const& input_column,
+                                    bool sort_keys,
+                                    data_type indices_type,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash_encode(input_column, sort_keys, indices_type, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace dictionary
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -27,6 +27,8 @@
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/stream_compaction.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
@@ -34,6 +36,8 @@
 #include <algorithm>
 #include <iterator>
 #include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
 
 namespace cudf {
 namespace dictionary {
@@ -107,6 +111,40 @@ struct dispatch_compute_indices {
   }
 };
 
+/**
+ * @brief Returns true if the dictionary columns all have the same keys and type of indices, so
+ * that their indices already compare like their elements.
+ *
+ * Columns sharing the same keys column are matched without comparing the keys.
+ */
+bool have_matching_keys(host_span<dictionary_column_view const> input,
+                        rmm::cuda_stream_view stream)
+{
+  auto const has_children = [](auto const& col) { return col.num_children() > 0; };
+  if (not std::all_of(input.begin(), input.end(), has_children)) { return false; }
+
+  auto const first = input.front();
+  return std::all_of(input.begin() + 1, input.end(), [first, stream](auto const& col) {
+    auto const lhs = first.keys();
+    auto const rhs = col.keys();
+    if (first.indices().type() != col.indices().type() or lhs.type() != rhs.type() or
+        lhs.size() != rhs.size()) {
+      return false;
+    }
+    if (lhs.head() == rhs.head() and lhs.offset() == rhs.offset()) { return true; }
+
+    // the keys are sorted, so the same keys are at the same positions
+    auto const d_lhs = table_device_view::create(table_view{{lhs}}, stream);
+    auto const d_rhs = table_device_view::create(table_view{{rhs}}, stream);
+    row_equality_comparator<nullate::NO> const equal{
+      nullate::NO{}, *d_lhs, *d_rhs, null_equality::EQUAL};
+    return thrust::all_of(rmm::exec_policy(stream),
+                          thrust::make_counting_iterator<size_type>(0),
+                          thrust::make_counting_iterator<size_type>(lhs.size()),
+                          [equal] __device__(size_type idx) { return equal(idx, idx); });
+  });
+}
+
 }  // namespace
 
 //
@@ -201,6 +239,8 @@ std::pair<std::vector<std::unique_ptr<column>>, std::vector<table_view>> match_d
         tables.begin(), tables.end(), std::back_inserter(dict_views), [col_idx](auto& t) {
           return dictionary_column_view(t.column(col_idx));
         });
+      // columns that already have the same keys are left unchanged
+      if (have_matching_keys(dict_views, stream)) { continue; }
       // now match the keys in these dictionary columns
       auto dict_cols = dictionary::detail::match_dictionaries(dict_views, stream, mr);
       // replace the updated_columns vector entries for the set of columns at col_idx
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -25,9 +25,12 @@
 #include <cudf/detail/groupby/group_replace_nulls.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/structs/utilities.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/groupby.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/strings/string_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -37,14 +40,36 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
-#include <thrust/copy.h>
 #include <thrust/iterator/counting_iterator.h>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
+#include <vector>
 
 namespace cudf {
 namespace groupby {
+namespace {
+
+/**
+ * @brief Returns the aggregations of `request` that can or cannot be hash-based, as selected by
+ * `hash_based`, in a request of the same values.
+ */
+aggregation_request select_aggregations(aggregation_request const& request, bool hash_based)
+{
+  aggregation_request selected;
+  selected.values = request.values;
+  for (auto const& agg : request.aggregations) {
+    if (detail::hash::can_use_hash_aggregation(request.values, agg->kind) == hash_based) {
+      selected.aggregations.emplace_back(
+        dynamic_cast<groupby_aggregation*>(agg->clone().release()));
+    }
+  }
+  return selected;
+}
+
+}  // namespace
+
 // Constructor
 groupby::groupby(table_view const& keys,
                  null_policy include_null_keys,
@@ -67,27 +92,97 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::disp
 {
   using namespace cudf::structs::detail;
 
+  // Keys whose equal rows are already contiguous only need the offsets of their groups
+  if (_keys_are_sorted == sorted::YES and not _helper and
+      detail::segmented::can_use_segmented_groupby(_keys, requests, _include_null_keys)) {
+    return detail::segmented::groupby(_keys, requests, stream, mr);
+  }
+
   // If sort groupby has been called once on this groupby object, then
   // always use sort groupby from now on. Because once keys are sorted,
   // all the aggs that can be done by hash groupby are efficiently done by
   // sort groupby as well.
-  // Only use hash groupby if the keys aren't sorted and all requests can be
-  // satisfied with a hash implementation
-  if (_keys_are_sorted == sorted::NO and not _helper and
-      detail::hash::can_use_hash_groupby(_keys, requests)) {
+  // Only use hash groupby if the keys aren't sorted, for all the requests when
+  // they can all be satisfied with a hash implementation and otherwise for the
+  // aggregations that can be
+  if (_keys_are_sorted == sorted::NO and not _helper) {
     // Optionally flatten nested key columns.
     auto flattened             = flatten_nested_columns(_keys, {}, {}, column_nullability::FORCE);
     auto flattened_keys        = flattened.flattened_columns();
-    auto is_supported_key_type = [](auto col) { return cudf::is_equality_comparable(col.type()); };
-    CUDF_EXPECTS(std::all_of(flattened_keys.begin(), flattened_keys.end(), is_supported_key_type),
-                 "Unsupported groupby key type does not support equality comparison");
-    auto [grouped_keys, results] =
-      detail::hash::groupby(flattened_keys, requests, _include_null_keys, stream, mr);
-    return std::make_pair(unflatten_nested_columns(std::move(grouped_keys), _keys),
-                          std::move(results));
-  } else {
-    return sort_aggregate(requests, stream, mr);
+    auto is_supported_key_type = [](auto col) {
+      // Lists of non-nested elements are compared and hashed element by element
+      if (col.type().id() == type_id::LIST) {
+        return not cudf::is_nested(lists_column_view(col).child().type());
+      }
+      return cudf::is_equality_comparable(col.type());
+    };
+    auto const keys_supported =
+      std::all_of(flattened_keys.begin(), flattened_keys.end(), is_supported_key_type);
+
+    if (detail::hash::can_use_hash_groupby(_keys, requests)) {
+      CUDF_EXPECTS(keys_supported,
+                   "Unsupported groupby key type does not support equality comparison");
+      auto [grouped_keys, results] =
+        detail::hash::groupby(flattened_keys, requests, _include_null_keys, stream, mr);
+      return std::make_pair(unflatten_nested_columns(std::move(grouped_keys), _keys),
+                            std::move(results));
+    }
+
+    // Otherwise, only the aggregations that cannot be hash-based are left to the sort groupby
+    auto const any_hash_based = std::any_of(requests.begin(), requests.end(), [](auto const& r) {
+      return std::any_of(r.aggregations.begin(), r.aggregations.end(), [&r](auto const& a) {
+        return detail::hash::can_use_hash_aggregation(r.values, a->kind);
+      });
+    });
+    if (keys_supported and any_hash_based) {
+      std::vector<aggregation_request> hash_requests;
+      std::vector<aggregation_request> sort_requests;
+      for (auto const& request : requests) {
+        hash_requests.push_back(select_aggregations(request, true));
+        sort_requests.push_back(select_aggregations(request, false));
+      }
+
+      auto const temp_mr             = rmm::mr::get_current_device_resource();
+      auto [hash_keys, hash_results] = detail::hash::groupby(
+        flattened_keys, hash_requests, _include_null_keys, stream, temp_mr);
+      auto [sort_keys, sort_results] = sort_aggregate(sort_requests, stream, mr);
+
+      // The groups of the sort groupby are in the ascending order of the keys, with nulls last
+      auto const grouped_keys = unflatten_nested_columns(std::move(hash_keys), _keys);
+      auto const key_order    = cudf::detail::sorted_order(
+        grouped_keys->view(),
+        {},
+        std::vector<null_order>(grouped_keys->num_columns(), null_order::AFTER),
+        stream,
+        temp_mr);
+
+      std::vector<aggregation_result> results(requests.size());
+      for (std::size_t i = 0; i < requests.size(); ++i) {
+        std::vector<column_view> hash_columns;
+        for (auto const& result : hash_results[i].results) {
+          hash_columns.push_back(result->view());
+        }
+        auto ordered = cudf::detail::gather(table_view{hash_columns},
+                                            key_order->view(),
+                                            out_of_bounds_policy::DONT_CHECK,
+                                            cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                            stream,
+                                            mr)
+                         ->release();
+
+        // Restore the order of the aggregations of the request
+        auto next_hash = ordered.begin();
+        auto next_sort = sort_results[i].results.begin();
+        for (auto const& agg : requests[i].aggregations) {
+          auto const hash_based =
+            detail::hash::can_use_hash_aggregation(requests[i].values, agg->kind);
+          results[i].results.push_back(std::move(hash_based ? *next_hash++ : *next_sort++));
+        }
+      }
+      return std::make_pair(std::move(sort_keys), std::move(results));
+    }
   }
+  return sort_aggregate(requests, stream, mr);
 }
 
 // Destructor
@@ -182,9 +277,11 @@ void verify_valid_requests(host_span<RequestType const> requests)
 
 // Compute aggregation requests
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggregate(
-  host_span<aggregation_request const> requests, rmm::mr::device_memory_resource* mr)
+  host_span<aggregation_request const> requests,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(_keys, stream);
   CUDF_EXPECTS(
     std::all_of(requests.begin(),
                 requests.end(),
@@ -195,14 +292,16 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggr
 
   if (_keys.num_rows() == 0) { return std::make_pair(empty_like(_keys), empty_results(requests)); }
 
-  return dispatch_aggregation(requests, rmm::cuda_stream_default, mr);
+  return dispatch_aggregation(requests, stream, mr);
 }
 
 // Compute scan requests
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::scan(
-  host_span<scan_request const> requests, rmm::mr::device_memory_resource* mr)
+  host_span<scan_request const> requests,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(_keys, stream);
   CUDF_EXPECTS(
     std::all_of(requests.begin(),
                 requests.end(),
@@ -213,26 +312,25 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::scan
 
   if (_keys.num_rows() == 0) { return std::make_pair(empty_like(_keys), empty_results(requests)); }
 
-  return sort_scan(requests, rmm::cuda_stream_default, mr);
+  return sort_scan(requests, stream, mr);
 }
 
-groupby::groups groupby::get_groups(table_view values, rmm::mr::device_memory_resource* mr)
+groupby::groups groupby::get_groups(table_view values,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  auto grouped_keys = helper().sorted_keys(rmm::cuda_stream_default, mr);
+  auto grouped_keys = helper().sorted_keys(stream, mr);
 
-  auto const& group_offsets = helper().group_offsets(rmm::cuda_stream_default);
-  std::vector<size_type> group_offsets_vector(group_offsets.size());
-  thrust::copy(thrust::device_pointer_cast(group_offsets.begin()),
-               thrust::device_pointer_cast(group_offsets.end()),
-               group_offsets_vector.begin());
+  auto const& group_offsets = helper().group_offsets(stream);
+  auto group_offsets_vector = cudf::detail::make_std_vector_sync(group_offsets, stream);
 
   if (values.num_columns()) {
     auto grouped_values = cudf::detail::gather(values,
-                                               helper().key_sort_order(rmm::cuda_stream_default),
+                                               helper().key_sort_order(stream),
                                                cudf::out_of_bounds_policy::DONT_CHECK,
                                                cudf::detail::negative_index_policy::NOT_ALLOWED,
-                                               rmm::cuda_stream_default,
+                                               stream,
                                                mr);
     return groupby::groups{
       std::move(grouped_keys), std::move(group_offsets_vector), std::move(grouped_values)};
@@ -244,6 +342,7 @@ groupby::groups groupby::get_groups(table_view values, rmm::mr::device_memory_re
 std::pair<std::unique_ptr<table>, std::unique_ptr<table>> groupby::replace_nulls(
   table_view const& values,
   host_span<cudf::replace_policy const> replace_policies,
+  rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
@@ -253,7 +352,6 @@ std::pair<std::unique_ptr<table>, std::unique_ptr<table>> groupby::replace_nulls
                "Size mismatch between num_columns and replace_policies.");
 
   if (values.is_empty()) { return std::make_pair(empty_like(_keys), empty_like(values)); }
-  auto const stream = rmm::cuda_stream_default;
 
   auto const& group_labels = helper().group_labels(stream);
   std::vector<std::unique_ptr<column>> results;
@@ -288,6 +386,7 @@ std::pair<std::unique_ptr<table>, std::unique_ptr<table>> groupby::shift(
   table_view const& values,
   host_span<size_type const> offsets,
   std::vector<std::reference_wrapper<const scalar>> const& fill_values,
+  rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
@@ -299,7 +398,6 @@ std::pair<std::unique_ptr<table>, std::unique_ptr<table>> groupby::shift(
                 [&](auto i) { return values.column(i).type() == fill_values[i].get().type(); }),
     "values and fill_value should have the same type.");
 
-  auto stream = rmm::cuda_stream_default;
   std::vector<std::unique_ptr<column>> results;
   auto const& group_offsets = helper().group_offsets(stream);
   std::transform(
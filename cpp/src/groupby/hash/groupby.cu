@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,6 +16,7 @@
 
 #include <groupby/common/utils.hpp>
 #include <groupby/hash/groupby_kernels.cuh>
+#include <groupby/sort/group_reductions.hpp>
 
 #include <cudf/aggregation.hpp>
 #include <cudf/column/column.hpp>
@@ -28,12 +29,15 @@
 #include <cudf/detail/binaryop.hpp>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby.hpp>
+#include <cudf/detail/hyperloglog/hyperloglog.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/replace.hpp>
 #include <cudf/detail/unary.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/temporary_arena.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/scalar/scalar.hpp>
@@ -44,10 +48,22 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/traits.cuh>
 #include <cudf/utilities/traits.hpp>
-#include <hash/concurrent_unordered_map.cuh>
 
-#include <rmm/cuda_stream_view.hpp>
+#include <hash/helper_functions.cuh>
 
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/tabulate.h>
+#include <thrust/uninitialized_fill.h>
+
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <unordered_set>
 #include <utility>
@@ -64,7 +80,7 @@ namespace {
  * @brief List of aggregation operations that can be computed with a hash-based
  * implementation.
  */
-constexpr std::array<aggregation::Kind, 12> hash_aggregations{aggregation::SUM,
+constexpr std::array<aggregation::Kind, 14> hash_aggregations{aggregation::SUM,
                                                               aggregation::PRODUCT,
                                                               aggregation::MIN,
                                                               aggregation::MAX,
@@ -74,12 +90,14 @@ constexpr std::array<aggregation::Kind, 12> hash_aggregations{aggregation::SUM,
                                                               aggregation::ARGMAX,
                                                               aggregation::SUM_OF_SQUARES,
                                                               aggregation::MEAN,
+                                                              aggregation::M2,
                                                               aggregation::STD,
-                                                              aggregation::VARIANCE};
+                                                              aggregation::VARIANCE,
+                                                              aggregation::NUNIQUE};
 
 // Could be hash: SUM, PRODUCT, MIN, MAX, COUNT_VALID, COUNT_ALL, ANY, ALL,
-// Compound: MEAN(SUM, COUNT_VALID), VARIANCE, STD(MEAN (SUM, COUNT_VALID), COUNT_VALID),
-// ARGMAX, ARGMIN
+// Compound: MEAN(SUM, COUNT_VALID), M2, VARIANCE, STD(MEAN (SUM, COUNT_VALID), COUNT_VALID),
+// ARGMAX, ARGMIN, NUNIQUE
 
 // TODO replace with std::find in C++20 onwards.
 template <class T, size_t N>
@@ -140,6 +158,17 @@ class groupby_simple_aggregations_collector final
     return aggs;
   }
 
+  std::vector<std::unique_ptr<aggregation>> visit(data_type,
+                                                  cudf::detail::m2_aggregation const&) override
+  {
+    std::vector<std::unique_ptr<aggregation>> aggs;
+    aggs.push_back(make_sum_aggregation());
+    // COUNT_VALID
+    aggs.push_back(make_count_aggregation());
+
+    return aggs;
+  }
+
   std::vector<std::unique_ptr<aggregation>> visit(data_type,
                                                   cudf::detail::var_aggregation const&) override
   {
@@ -172,10 +201,66 @@ class groupby_simple_aggregations_collector final
 
     return aggs;
   }
+
+  // NUNIQUE inserts the rows in a map of its own, after the single pass
+  std::vector<std::unique_ptr<aggregation>> visit(
+    data_type, cudf::detail::nunique_aggregation const&) override
+  {
+    return {};
+  }
+
+  // The HyperLogLog sketches are built from the dense group of each row, after the single pass
+  std::vector<std::unique_ptr<aggregation>> visit(data_type,
+                                                  cudf::detail::hll_aggregation const&) override
+  {
+    return {};
+  }
+
+  std::vector<std::unique_ptr<aggregation>> visit(
+    data_type, cudf::detail::merge_hll_aggregation const&) override
+  {
+    return {};
+  }
+
+  std::vector<std::unique_ptr<aggregation>> visit(
+    data_type, cudf::detail::approx_nunique_aggregation const&) override
+  {
+    return {};
+  }
+
+  // The tdigests are built from the dense group of each row, after the single pass
+  std::vector<std::unique_ptr<aggregation>> visit(
+    data_type, cudf::detail::tdigest_aggregation const&) override
+  {
+    return {};
+  }
 };
 
+constexpr size_type unused_key{std::numeric_limits<size_type>::max()};
+constexpr size_type unused_value{std::numeric_limits<size_type>::max()};
+
+/**
+ * @brief Construct the device view of `map` that uses row comparator and row hasher on
+ * `d_keys` table and stores indices
+ */
+groupby_map_view make_map_view(map_type& map,
+                               table_device_view const& d_keys,
+                               bool keys_have_nulls,
+                               null_policy include_null_keys)
+{
+  auto const null_keys_are_equal =
+    include_null_keys == null_policy::INCLUDE ? null_equality::EQUAL : null_equality::UNEQUAL;
+
+  row_hasher<default_hash, nullate::DYNAMIC> hasher{nullate::DYNAMIC{keys_have_nulls}, d_keys};
+  row_equality_comparator<nullate::DYNAMIC> rows_equal{
+    nullate::DYNAMIC{keys_have_nulls}, d_keys, d_keys, null_keys_are_equal};
+
+  return groupby_map_view{map.get_device_mutable_view(), map.get_device_view(), hasher, rows_equal};
+}
+
 template <typename Map>
 class hash_compound_agg_finalizer final : public cudf::detail::aggregation_finalizer {
+  table_view keys;
   column_view col;
   data_type result_type;
   cudf::detail::result_cache* sparse_results;
@@ -189,7 +274,8 @@ class hash_compound_agg_finalizer final : public cudf::detail::aggregation_final
  public:
   using cudf::detail::aggregation_finalizer::visit;
 
-  hash_compound_agg_finalizer(column_view col,
+  hash_compound_agg_finalizer(table_view keys,
+                              column_view col,
                               cudf::detail::result_cache* sparse_results,
                               cudf::detail::result_cache* dense_results,
                               device_span<size_type const> gather_map,
@@ -197,7 +283,8 @@ class hash_compound_agg_finalizer final : public cudf::detail::aggregation_final
                               bitmask_type const* row_bitmask,
                               rmm::cuda_stream_view stream,
                               rmm::mr::device_memory_resource* mr)
-    : col(col),
+    : keys(keys),
+      col(col),
       sparse_results(sparse_results),
       dense_results(dense_results),
       gather_map(gather_map),
@@ -246,6 +333,29 @@ class hash_compound_agg_finalizer final : public cudf::detail::aggregation_final
     return std::move(gather_argminmax->release()[0]);
   }
 
+  // Returns the index of the dense result of the group of each row, or -1 for the skipped rows
+  rmm::device_uvector<size_type> dense_group_labels()
+  {
+    rmm::device_uvector<size_type> sparse_to_dense(col.size(), stream);
+    thrust::scatter(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator(0),
+                    thrust::make_counting_iterator(static_cast<size_type>(gather_map.size())),
+                    gather_map.begin(),
+                    sparse_to_dense.begin());
+
+    rmm::device_uvector<size_type> labels(col.size(), stream);
+    thrust::tabulate(
+      rmm::exec_policy(stream),
+      labels.begin(),
+      labels.end(),
+      [map = map, row_bitmask = row_bitmask, sparse_to_dense = sparse_to_dense.data()] __device__(
+        size_type i) {
+        if (row_bitmask != nullptr and not cudf::bit_is_set(row_bitmask, i)) { return -1; }
+        return sparse_to_dense[map.find(i)];
+      });
+    return labels;
+  }
+
   // Declare overloads for each kind of aggregation to dispatch
   void visit(cudf::aggregation const& agg) override
   {
@@ -328,6 +438,121 @@ class hash_compound_agg_finalizer final : public cudf::detail::aggregation_final
     dense_results->add_result(col, agg, to_dense_agg_result(agg));
   }
 
+  void visit(cudf::detail::m2_aggregation const& agg) override
+  {
+    if (dense_results->has_result(col, agg)) return;
+
+    auto sum_agg   = make_sum_aggregation();
+    auto count_agg = make_count_aggregation();
+    this->visit(*sum_agg);
+    this->visit(*count_agg);
+    column_view sum_result   = sparse_results->get_result(col, *sum_agg);
+    column_view count_result = sparse_results->get_result(col, *count_agg);
+
+    auto values_view = column_device_view::create(col, stream);
+    auto sum_view    = column_device_view::create(sum_result, stream);
+    auto count_view  = column_device_view::create(count_result, stream);
+
+    // The groups without any valid value stay null, as in the sort-based M2
+    auto m2_result = make_fixed_width_column(
+      cudf::detail::target_type(result_type, agg.kind), col.size(), mask_state::ALL_NULL, stream);
+    thrust::uninitialized_fill(rmm::exec_policy(stream),
+                               m2_result->mutable_view().begin<double>(),
+                               m2_result->mutable_view().end<double>(),
+                               0.0);
+    auto m2_result_view = mutable_column_device_view::create(m2_result->mutable_view(), stream);
+
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator(0),
+      col.size(),
+      ::cudf::detail::var_hash_functor<Map, aggregation::M2>{
+        map, row_bitmask, *m2_result_view, *values_view, *sum_view, *count_view, 0});
+    sparse_results->add_result(col, agg, std::move(m2_result));
+    dense_results->add_result(col, agg, to_dense_agg_result(agg));
+  }
+
+  void visit(cudf::detail::nunique_aggregation const& agg) override
+  {
+    if (dense_results->has_result(col, agg)) return;
+
+    // The first row of each distinct pair of key and value is the only one to be counted. Null
+    // keys are skipped by `row_bitmask` when they are excluded, so the pairs compare nulls equal.
+    std::vector<column_view> pair_columns(keys.begin(), keys.end());
+    pair_columns.push_back(col);
+    table_view const pairs{pair_columns};
+    auto const d_pairs = table_device_view::create(pairs, stream);
+    map_type pairs_map{compute_hash_table_size(pairs.num_rows()),
+                       unused_key,
+                       unused_value,
+                       hash_table_allocator_type{default_allocator<char>{}, stream},
+                       stream.value()};
+    auto const pairs_view =
+      make_map_view(pairs_map, *d_pairs, has_nulls(pairs), null_policy::INCLUDE);
+
+    auto nunique_result = make_fixed_width_column(cudf::detail::target_type(result_type, agg.kind),
+                                                  col.size(),
+                                                  mask_state::UNALLOCATED,
+                                                  stream);
+    thrust::uninitialized_fill(rmm::exec_policy(stream),
+                               nunique_result->mutable_view().begin<size_type>(),
+                               nunique_result->mutable_view().end<size_type>(),
+                               0);
+    auto nunique_result_view =
+      mutable_column_device_view::create(nunique_result->mutable_view(), stream);
+    auto values_view = column_device_view::create(col, stream);
+
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator(0),
+                       col.size(),
+                       ::cudf::detail::nunique_hash_functor<Map>{
+                         map,
+                         pairs_view,
+                         row_bitmask,
+                         *nunique_result_view,
+                         *values_view,
+                         agg._null_handling == null_policy::INCLUDE});
+    sparse_results->add_result(col, agg, std::move(nunique_result));
+    dense_results->add_result(col, agg, to_dense_agg_result(agg));
+  }
+
+  void visit(cudf::detail::hll_aggregation const& agg) override
+  {
+    if (dense_results->has_result(col, agg)) return;
+    auto const num_groups = static_cast<size_type>(gather_map.size());
+    auto sketches         = cudf::detail::hyperloglog::make_sketches(
+      col, dense_group_labels(), num_groups, agg.precision, stream, mr);
+    dense_results->add_result(col, agg, std::move(sketches));
+  }
+
+  void visit(cudf::detail::merge_hll_aggregation const& agg) override
+  {
+    if (dense_results->has_result(col, agg)) return;
+    auto const num_groups = static_cast<size_type>(gather_map.size());
+    auto sketches         = cudf::detail::hyperloglog::merge_sketches(
+      col, dense_group_labels(), num_groups, agg.precision, stream, mr);
+    dense_results->add_result(col, agg, std::move(sketches));
+  }
+
+  void visit(cudf::detail::approx_nunique_aggregation const& agg) override
+  {
+    if (dense_results->has_result(col, agg)) return;
+    auto hll_agg = make_hll_aggregation(agg.precision);
+    this->visit(*dynamic_cast<cudf::detail::hll_aggregation*>(hll_agg.get()));
+    column_view sketches = dense_results->get_result(col, *hll_agg);
+    dense_results->add_result(
+      col, agg, cudf::detail::hyperloglog::estimate_distinct_count(sketches, stream, mr));
+  }
+
+  void visit(cudf::detail::tdigest_aggregation const& agg) override
+  {
+    if (dense_results->has_result(col, agg)) return;
+    auto const num_groups = static_cast<size_type>(gather_map.size());
+    auto tdigests         = cudf::groupby::detail::unsorted_group_tdigest(
+      col, dense_group_labels(), num_groups, agg.max_centroids, stream, mr);
+    dense_results->add_result(col, agg, std::move(tdigests));
+  }
+
   void visit(cudf::detail::std_aggregation const& agg) override
   {
     if (dense_results->has_result(col, agg)) return;
@@ -405,7 +630,7 @@ void sparse_to_dense_results(table_view const& keys,
     // Given an aggregation, this will get the result from sparse_results and
     // convert and return dense, compacted result
     auto finalizer = hash_compound_agg_finalizer<Map>(
-      col, sparse_results, dense_results, gather_map, map, row_bitmask_ptr, stream, mr);
+      keys, col, sparse_results, dense_results, gather_map, map, row_bitmask_ptr, stream, mr);
     for (auto&& agg : agg_v) {
       agg->finalize(finalizer);
     }
@@ -413,38 +638,24 @@ void sparse_to_dense_results(table_view const& keys,
 }
 
 /**
- * @brief Construct hash map that uses row comparator and row hasher on
- * `d_keys` table and stores indices
+ * @brief Returns the number of slots of the shared memory tables of `compute_shared_memory_aggs`
+ * for `num_columns` sparse result columns, or zero if they do not fit in shared memory.
  */
-auto create_hash_map(table_device_view const& d_keys,
-                     bool keys_have_nulls,
-                     null_policy include_null_keys,
-                     rmm::cuda_stream_view stream)
+size_type shared_memory_aggs_slots(size_type num_columns)
 {
-  size_type constexpr unused_key{std::numeric_limits<size_type>::max()};
-  size_type constexpr unused_value{std::numeric_limits<size_type>::max()};
-
-  using map_type = concurrent_unordered_map<size_type,
-                                            size_type,
-                                            row_hasher<default_hash, nullate::DYNAMIC>,
-                                            row_equality_comparator<nullate::DYNAMIC>>;
-
-  using allocator_type = typename map_type::allocator_type;
-
-  auto const null_keys_are_equal =
-    include_null_keys == null_policy::INCLUDE ? null_equality::EQUAL : null_equality::UNEQUAL;
-
-  row_hasher<default_hash, nullate::DYNAMIC> hasher{nullate::DYNAMIC{keys_have_nulls}, d_keys};
-  row_equality_comparator rows_equal{
-    nullate::DYNAMIC{keys_have_nulls}, d_keys, d_keys, null_keys_are_equal};
-
-  return map_type::create(compute_hash_table_size(d_keys.num_rows()),
-                          stream,
-                          unused_key,
-                          unused_value,
-                          hasher,
-                          rows_equal,
-                          allocator_type());
+  int device = 0;
+  CUDA_TRY(cudaGetDevice(&device));
+  int max_shared_memory = 0;
+  CUDA_TRY(
+    cudaDeviceGetAttribute(&max_shared_memory, cudaDevAttrMaxSharedMemoryPerBlock, device));
+
+  // Tables smaller than a few blocks of threads would send most rows to the sparse results
+  auto num_slots = GROUPBY_SHM_MAX_SLOTS;
+  while (num_slots >= 2 * GROUPBY_SHM_BLOCK_SIZE and
+         shared_memory_aggs_size(num_slots, num_columns) > static_cast<size_t>(max_shared_memory)) {
+    num_slots /= 2;
+  }
+  return num_slots >= 2 * GROUPBY_SHM_BLOCK_SIZE ? num_slots : 0;
 }
 
 // make table that will hold sparse results
@@ -483,15 +694,18 @@ auto create_sparse_results_table(table_view const& flattened_values,
 /**
  * @brief Computes all aggregations from `requests` that require a single pass
  * over the data and stores the results in `sparse_results`
+ *
+ * The temporaries of the aggregation, which do not outlive the call, are allocated from `temp_mr`.
  */
 template <typename Map>
 void compute_single_pass_aggs(table_view const& keys,
                               host_span<aggregation_request const> requests,
                               cudf::detail::result_cache* sparse_results,
-                              Map& map,
+                              Map map,
                               bool keys_have_nulls,
                               null_policy include_null_keys,
-                              rmm::cuda_stream_view stream)
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* temp_mr)
 {
   // flatten the aggs to a table that can be operated on by aggregate_row
   auto const [flattened_values, agg_kinds, aggs] = flatten_single_pass_aggs(requests);
@@ -501,23 +715,60 @@ void compute_single_pass_aggs(table_view const& keys,
   // prepare to launch kernel to do the actual aggregation
   auto d_sparse_table = mutable_table_device_view::create(sparse_table, stream);
   auto d_values       = table_device_view::create(flattened_values, stream);
-  auto const d_aggs   = cudf::detail::make_device_uvector_async(agg_kinds, stream);
+  auto const d_aggs   = cudf::detail::make_device_uvector_async(agg_kinds, stream, temp_mr);
 
   bool skip_key_rows_with_nulls = keys_have_nulls and include_null_keys == null_policy::EXCLUDE;
 
-  auto row_bitmask =
-    skip_key_rows_with_nulls ? cudf::detail::bitmask_and(keys, stream).first : rmm::device_buffer{};
-  thrust::for_each_n(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator(0),
-    keys.num_rows(),
-    hash::compute_single_pass_aggs_fn<Map>{map,
-                                           keys.num_rows(),
-                                           *d_values,
-                                           *d_sparse_table,
-                                           d_aggs.data(),
-                                           static_cast<bitmask_type*>(row_bitmask.data()),
-                                           skip_key_rows_with_nulls});
+  auto row_bitmask = skip_key_rows_with_nulls
+                       ? cudf::detail::bitmask_and(keys, stream, temp_mr).first
+                       : rmm::device_buffer{};
+
+  // Aggregate the rows of each block in shared memory first when all the aggregations support it
+  auto const num_columns = flattened_values.num_columns();
+  bool shared_memory_ok  = num_columns > 0;
+  for (size_type i = 0; i < num_columns; ++i) {
+    auto const type  = flattened_values.column(i).type();
+    shared_memory_ok = shared_memory_ok and is_shared_memory_aggregation(type, agg_kinds[i]);
+  }
+  auto const num_slots = shared_memory_ok ? shared_memory_aggs_slots(num_columns) : 0;
+
+  if (num_slots > 0 and keys.num_rows() > 0) {
+    auto const kernel       = compute_shared_memory_aggs<Map>;
+    auto const shared_bytes = shared_memory_aggs_size(num_slots, num_columns);
+    int max_blocks_per_sm   = 0;
+    CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+      &max_blocks_per_sm, kernel, GROUPBY_SHM_BLOCK_SIZE, shared_bytes));
+    int device = 0;
+    CUDA_TRY(cudaGetDevice(&device));
+    int num_sms = 0;
+    CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, device));
+
+    // Fewer blocks than rows keep the number of partial results to merge small
+    cudf::detail::grid_1d const config(keys.num_rows(), GROUPBY_SHM_BLOCK_SIZE);
+    auto const num_blocks =
+      std::max(1, std::min(config.num_blocks, std::max(1, max_blocks_per_sm) * num_sms));
+    kernel<<<num_blocks, GROUPBY_SHM_BLOCK_SIZE, shared_bytes, stream.value()>>>(
+      map,
+      keys.num_rows(),
+      *d_values,
+      *d_sparse_table,
+      d_aggs.data(),
+      static_cast<bitmask_type*>(row_bitmask.data()),
+      skip_key_rows_with_nulls,
+      num_slots);
+  } else {
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator(0),
+      keys.num_rows(),
+      hash::compute_single_pass_aggs_fn<Map>{map,
+                                             keys.num_rows(),
+                                             *d_values,
+                                             *d_sparse_table,
+                                             d_aggs.data(),
+                                             static_cast<bitmask_type*>(row_bitmask.data()),
+                                             skip_key_rows_with_nulls});
+  }
   // Add results back to sparse_results cache
   auto sparse_result_cols = sparse_table.release();
   for (size_t i = 0; i < aggs.size(); i++) {
@@ -531,20 +782,25 @@ void compute_single_pass_aggs(table_view const& keys,
  * @brief Computes and returns a device vector containing all populated keys in
  * `map`.
  */
-template <typename Map>
-rmm::device_uvector<size_type> extract_populated_keys(Map map,
+rmm::device_uvector<size_type> extract_populated_keys(map_type const& map,
                                                       size_type num_keys,
-                                                      rmm::cuda_stream_view stream)
+                                                      rmm::cuda_stream_view stream,
+                                                      rmm::mr::device_memory_resource* mr)
 {
-  rmm::device_uvector<size_type> populated_keys(num_keys, stream);
+  rmm::device_uvector<size_type> populated_keys(num_keys, stream, mr);
 
-  auto get_key    = [] __device__(auto const& element) { return element.first; };  // first = key
-  auto get_key_it = thrust::make_transform_iterator(map.data(), get_key);
-  auto key_used   = [unused = map.get_unused_key()] __device__(auto key) { return key != unused; };
+  auto const view = map.get_device_view();
+  auto get_key    = [] __device__(map_type::pair_atomic_type const& slot) {
+    return slot.first.load(cuda::std::memory_order_relaxed);
+  };
+  auto get_key_it = thrust::make_transform_iterator(view.get_slots(), get_key);
+  auto key_used   = [unused = map.get_empty_key_sentinel()] __device__(auto key) {
+    return key != unused;
+  };
 
   auto end_it = thrust::copy_if(rmm::exec_policy(stream),
                                 get_key_it,
-                                get_key_it + map.capacity(),
+                                get_key_it + view.get_capacity(),
                                 populated_keys.begin(),
                                 key_used);
 
@@ -587,28 +843,45 @@ std::unique_ptr<table> groupby(table_view const& keys,
                                rmm::cuda_stream_view stream,
                                rmm::mr::device_memory_resource* mr)
 {
-  auto d_keys_ptr = table_device_view::create(keys, stream);
-  auto map        = create_hash_map(*d_keys_ptr, keys_have_nulls, include_null_keys, stream);
+  // The gather map and the scratch space of the aggregations are only needed during the call
+  cudf::detail::temporary_arena temp_mr{stream};
+
+  // Dictionary keys are hashed and compared by their indices, the unique keys are gathered from
+  // the dictionary columns
+  auto const key_indices = cudf::dictionary::detail::indices_view(keys);
+  auto d_keys_ptr        = table_device_view::create(key_indices, stream);
+  map_type map{compute_hash_table_size(keys.num_rows()),
+               unused_key,
+               unused_value,
+               hash_table_allocator_type{default_allocator<char>{}, stream},
+               stream.value()};
+  auto const d_map = make_map_view(map, *d_keys_ptr, keys_have_nulls, include_null_keys);
 
   // Cache of sparse results where the location of aggregate value in each
   // column is indexed by the hash map
   cudf::detail::result_cache sparse_results(requests.size());
 
   // Compute all single pass aggs first
-  compute_single_pass_aggs(
-    keys, requests, &sparse_results, *map, keys_have_nulls, include_null_keys, stream);
+  compute_single_pass_aggs(key_indices,
+                           requests,
+                           &sparse_results,
+                           d_map,
+                           keys_have_nulls,
+                           include_null_keys,
+                           stream,
+                           &temp_mr);
 
   // Extract the populated indices from the hash map and create a gather map.
   // Gathering using this map from sparse results will give dense results.
-  auto gather_map = extract_populated_keys(*map, keys.num_rows(), stream);
+  auto gather_map = extract_populated_keys(map, keys.num_rows(), stream, &temp_mr);
 
   // Compact all results from sparse_results and insert into cache
-  sparse_to_dense_results(keys,
+  sparse_to_dense_results(key_indices,
                           requests,
                           &sparse_results,
                           cache,
                           gather_map,
-                          *map,
+                          d_map,
                           keys_have_nulls,
                           include_null_keys,
                           stream,
@@ -624,6 +897,26 @@ std::unique_ptr<table> groupby(table_view const& keys,
 
 }  // namespace
 
+bool can_use_hash_aggregation(column_view const& values, aggregation::Kind kind)
+{
+  // Currently, structs are not supported in any of hash-based aggregations.
+  // TODO: Support structs in hash-based aggregations.
+  if (values.type().id() == type_id::STRUCT) { return false; }
+  // NUNIQUE compares the values in a hash map instead of aggregating them with atomics, and the
+  // HyperLogLog sketches are built from the dense group of each row
+  if (kind == aggregation::NUNIQUE or kind == aggregation::HLL or
+      kind == aggregation::APPROX_NUNIQUE) {
+    return not cudf::is_nested(values.type()) and not cudf::is_dictionary(values.type());
+  }
+  // MERGE_HLL merges the registers of the sketches of the dense group of each row
+  if (kind == aggregation::MERGE_HLL) { return values.type().id() == type_id::LIST; }
+  // TDIGEST sorts bounded chunks of the values by dense group and merges their tdigests
+  if (kind == aggregation::TDIGEST) {
+    return cudf::is_numeric(values.type()) or cudf::is_fixed_point(values.type());
+  }
+  return cudf::has_atomic_support(values.type()) and is_hash_aggregation(kind);
+}
+
 /**
  * @brief Indicates if a set of aggregation requests can be satisfied with a
  * hash-based groupby implementation.
@@ -636,15 +929,11 @@ std::unique_ptr<table> groupby(table_view const& keys,
  */
 bool can_use_hash_groupby(table_view const& keys, host_span<aggregation_request const> requests)
 {
+  // If any request cannot be hash-based then we must fallback to sort-based aggregations.
   return std::all_of(requests.begin(), requests.end(), [](aggregation_request const& r) {
-    // Currently, structs are not supported in any of hash-based aggregations.
-    // Therefore, if any request contains structs then we must fallback to sort-based aggregations.
-    // TODO: Support structs in hash-based aggregations.
-    return not(r.values.type().id() == type_id::STRUCT) and
-           cudf::has_atomic_support(r.values.type()) and
-           std::all_of(r.aggregations.begin(), r.aggregations.end(), [](auto const& a) {
-             return is_hash_aggregation(a->kind);
-           });
+    return std::all_of(r.aggregations.begin(), r.aggregations.end(), [&r](auto const& a) {
+      return can_use_hash_aggregation(r.values, a->kind);
+    });
   });
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,13 +19,67 @@
 #include "multi_pass_kernels.cuh"
 #include <cudf/detail/aggregation/aggregation.cuh>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/groupby.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <hash/hash_allocator.cuh>
+
+#include <rmm/mr/device/polymorphic_allocator.hpp>
+
+#include <cuco/static_map.cuh>
+
+#include <thrust/pair.h>
 
 namespace cudf {
 namespace groupby {
 namespace detail {
 namespace hash {
+
+using hash_table_allocator_type = rmm::mr::stream_allocator_adaptor<default_allocator<char>>;
+
+/**
+ * @brief Hash map of the rows of the keys, from the index of a row to the index of the first equal
+ * row inserted.
+ */
+using map_type =
+  cuco::static_map<size_type, size_type, cuda::thread_scope_device, hash_table_allocator_type>;
+
+/**
+ * @brief Device view of a `map_type` together with the row hasher and comparator of the keys.
+ *
+ * The index of the row representing the group of a row is the location of the results of the
+ * group in the sparse result columns.
+ */
+struct groupby_map_view {
+  map_type::device_mutable_view mutable_map;
+  map_type::device_view map;
+  row_hasher<default_hash, nullate::DYNAMIC> hasher;
+  row_equality_comparator<nullate::DYNAMIC> key_equal;
+
+  /**
+   * @brief Inserts row `i` if no equal row is in the map, and returns the index of its group.
+   */
+  __device__ size_type insert(size_type i)
+  {
+    if (mutable_map.insert(thrust::make_pair(i, i), hasher, key_equal)) { return i; }
+    return find(i);
+  }
+
+  /**
+   * @brief Returns the index of the group of row `i`, which must have been inserted.
+   */
+  __device__ size_type find(size_type i) const
+  {
+    auto const slot = map.find(i, hasher, key_equal);
+    return slot->second.load(cuda::std::memory_order_relaxed);
+  }
+};
+
 /**
  * @brief Compute single-pass aggregations and store results into a sparse
  * `output_values` table, and populate `map` with indices of unique keys
@@ -107,14 +161,284 @@ struct compute_single_pass_aggs_fn {
   __device__ void operator()(size_type i)
   {
     if (not skip_rows_with_nulls or cudf::bit_is_set(row_bitmask, i)) {
-      auto result = map.insert(thrust::make_pair(i, i));
+      cudf::detail::aggregate_row<true, true>(output_values, map.insert(i), input_values, i, aggs);
+    }
+  }
+};
+
+/**
+ * @brief Number of threads of the blocks of `compute_shared_memory_aggs`
+ */
+constexpr int GROUPBY_SHM_BLOCK_SIZE = 128;
+
+/**
+ * @brief Largest number of slots of the shared memory table of a block of
+ * `compute_shared_memory_aggs`
+ */
+constexpr size_type GROUPBY_SHM_MAX_SLOTS = 2048;
+
+/**
+ * @brief Value of the empty slots of the shared memory table of a block
+ */
+constexpr size_type GROUPBY_SHM_EMPTY_SLOT = -1;
+
+/**
+ * @brief Indicates whether aggregation `k` of elements of type `Source` can be partially computed
+ * in shared memory by `compute_shared_memory_aggs`.
+ *
+ * The partial results are merged into the sparse results with a single atomic operation, so only
+ * the aggregations whose results combine with their own operator are supported.
+ */
+template <typename Source, aggregation::Kind k>
+constexpr bool is_shared_memory_aggregation()
+{
+  if constexpr (k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL) {
+    return cudf::detail::is_valid_aggregation<Source, k>();
+  } else if constexpr (k == aggregation::SUM or k == aggregation::PRODUCT or
+                       k == aggregation::MIN or k == aggregation::MAX or
+                       k == aggregation::SUM_OF_SQUARES) {
+    if constexpr (is_numeric<Source>() and cudf::detail::is_valid_aggregation<Source, k>()) {
+      return sizeof(cudf::detail::target_type_t<Source, k>) <= sizeof(int64_t);
+    } else {
+      return false;
+    }
+  } else {
+    return false;
+  }
+}
+
+/**
+ * @brief Host counterpart of `is_shared_memory_aggregation`.
+ */
+inline bool is_shared_memory_aggregation(data_type source, aggregation::Kind k)
+{
+  switch (k) {
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL: return cudf::detail::is_valid_aggregation(source, k);
+    case aggregation::SUM:
+    case aggregation::PRODUCT:
+    case aggregation::MIN:
+    case aggregation::MAX:
+    case aggregation::SUM_OF_SQUARES:
+      return is_numeric(source) and cudf::detail::is_valid_aggregation(source, k);
+    default: return false;
+  }
+}
+
+/**
+ * @brief Sets element `slot` of a partial result column in shared memory to the identity of the
+ * aggregation.
+ */
+struct initialize_shared_memory_target {
+  template <typename Source, aggregation::Kind k>
+  __device__ void operator()(int64_t* storage, size_type slot) const noexcept
+  {
+    if constexpr (is_shared_memory_aggregation<Source, k>()) {
+      using Target = cudf::detail::target_type_t<Source, k>;
+      reinterpret_cast<Target*>(storage)[slot] =
+        cudf::detail::corresponding_operator_t<k>::template identity<Target>();
+    }
+  }
+};
+
+/**
+ * @brief Aggregates a source element into element `slot` of a partial result column in shared
+ * memory.
+ */
+struct update_shared_memory_target {
+  template <typename Source, aggregation::Kind k>
+  __device__ void operator()(int64_t* storage,
+                             bool* updated,
+                             size_type slot,
+                             column_device_view source,
+                             size_type source_index) const noexcept
+  {
+    if constexpr (is_shared_memory_aggregation<Source, k>()) {
+      if (k != aggregation::COUNT_ALL and source.is_null(source_index)) { return; }
+
+      using Target = cudf::detail::target_type_t<Source, k>;
+      auto target  = reinterpret_cast<Target*>(storage) + slot;
+      if constexpr (k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL) {
+        atomicAdd(target, Target{1});
+      } else {
+        auto const value = static_cast<Target>(source.element<Source>(source_index));
+        if constexpr (k == aggregation::SUM) { atomicAdd(target, value); }
+        if constexpr (k == aggregation::SUM_OF_SQUARES) { atomicAdd(target, value * value); }
+        if constexpr (k == aggregation::PRODUCT) { atomicMul(target, value); }
+        if constexpr (k == aggregation::MIN) { atomicMin(target, value); }
+        if constexpr (k == aggregation::MAX) { atomicMax(target, value); }
+      }
+      updated[slot] = true;
+    } else {
+      cudf_assert(false and "Invalid source type and aggregation combination.");
+    }
+  }
+};
 
-      cudf::detail::aggregate_row<true, true>(
-        output_values, result.first->second, input_values, i, aggs);
+/**
+ * @brief Merges element `slot` of a partial result column in shared memory into a sparse result.
+ */
+struct merge_shared_memory_target {
+  template <typename Source, aggregation::Kind k>
+  __device__ void operator()(mutable_column_device_view target,
+                             size_type target_index,
+                             int64_t const* storage,
+                             size_type slot) const noexcept
+  {
+    if constexpr (is_shared_memory_aggregation<Source, k>()) {
+      using Target     = cudf::detail::target_type_t<Source, k>;
+      auto const value = reinterpret_cast<Target const*>(storage)[slot];
+      auto result      = &target.element<Target>(target_index);
+      if constexpr (k == aggregation::SUM or k == aggregation::SUM_OF_SQUARES or
+                    k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL) {
+        atomicAdd(result, value);
+      }
+      if constexpr (k == aggregation::PRODUCT) { atomicMul(result, value); }
+      if constexpr (k == aggregation::MIN) { atomicMin(result, value); }
+      if constexpr (k == aggregation::MAX) { atomicMax(result, value); }
+      if (target.nullable() and target.is_null(target_index)) { target.set_valid(target_index); }
     }
   }
 };
 
+/**
+ * @brief Returns the number of bytes of shared memory of a block of `compute_shared_memory_aggs`
+ * with `num_slots` slots for `num_columns` result columns.
+ */
+constexpr std::size_t shared_memory_aggs_size(size_type num_slots, size_type num_columns)
+{
+  return static_cast<std::size_t>(num_slots) *
+         (num_columns * (sizeof(int64_t) + sizeof(bool)) + sizeof(size_type));
+}
+
+/**
+ * @brief Finds the slot of group `group` in the shared memory table of a block, inserting it if
+ * the table is not half full.
+ *
+ * The table is never more than half full, so that probing always ends on the slot of the group or
+ * on an empty slot.
+ *
+ * @return The slot of the group, or `GROUPBY_SHM_EMPTY_SLOT` if it is not in the table and the
+ * table is half full
+ */
+__device__ inline size_type find_or_insert_shared_memory_slot(size_type group,
+                                                              size_type* slot_groups,
+                                                              size_type num_slots,
+                                                              size_type* num_slots_used)
+{
+  // Finalizer of MurmurHash3, mixing the bits of the group into those of the slot
+  auto hash = static_cast<uint32_t>(group);
+  hash ^= hash >> 16;
+  hash *= 0x85eb'ca6bu;
+  hash ^= hash >> 13;
+  hash *= 0xc2b2'ae35u;
+  hash ^= hash >> 16;
+  auto slot = static_cast<size_type>(hash & static_cast<uint32_t>(num_slots - 1));
+  while (true) {
+    auto const existing = static_cast<size_type volatile*>(slot_groups)[slot];
+    if (existing == group) { return slot; }
+    if (existing == GROUPBY_SHM_EMPTY_SLOT) {
+      if (*static_cast<size_type volatile*>(num_slots_used) >= num_slots / 2 or
+          atomicAdd(num_slots_used, 1) >= num_slots / 2) {
+        return GROUPBY_SHM_EMPTY_SLOT;
+      }
+      auto const old = atomicCAS(slot_groups + slot, GROUPBY_SHM_EMPTY_SLOT, group);
+      if (old == GROUPBY_SHM_EMPTY_SLOT or old == group) { return slot; }
+    }
+    slot = (slot + 1) & (num_slots - 1);
+  }
+}
+
+/**
+ * @brief Computes single-pass aggregations like `compute_single_pass_aggs_fn`, aggregating the
+ * rows of each block in shared memory first.
+ *
+ * Each block keeps a table of up to `num_slots / 2` groups in shared memory, with a partial result
+ * of every aggregation for each group. The rows of a group in the table are aggregated with
+ * shared memory atomics, and the partial results are merged into `output_values` once the block
+ * has processed all its rows. With few groups, this replaces the contended atomics of every row on
+ * the sparse results with one atomic per group and block. The rows of the groups that do not fit
+ * in the table of their block are aggregated into `output_values` directly.
+ *
+ * All the aggregations must satisfy `is_shared_memory_aggregation`, and `num_slots` must be a
+ * power of two.
+ *
+ * @tparam Map The type of the hash map
+ */
+template <typename Map>
+__global__ void compute_shared_memory_aggs(Map map,
+                                           size_type num_keys,
+                                           table_device_view input_values,
+                                           mutable_table_device_view output_values,
+                                           aggregation::Kind const* __restrict__ aggs,
+                                           bitmask_type const* __restrict__ row_bitmask,
+                                           bool skip_rows_with_nulls,
+                                           size_type num_slots)
+{
+  extern __shared__ int64_t shared_storage[];
+  __shared__ size_type num_slots_used;
+
+  auto const num_columns = output_values.num_columns();
+  auto const storage     = shared_storage;
+  auto const slot_groups = reinterpret_cast<size_type*>(storage + num_columns * num_slots);
+  auto const updated     = reinterpret_cast<bool*>(slot_groups + num_slots);
+
+  for (auto s = static_cast<size_type>(threadIdx.x); s < num_slots; s += blockDim.x) {
+    slot_groups[s] = GROUPBY_SHM_EMPTY_SLOT;
+    for (size_type c = 0; c < num_columns; ++c) {
+      cudf::detail::dispatch_type_and_aggregation(input_values.column(c).type(),
+                                                  aggs[c],
+                                                  initialize_shared_memory_target{},
+                                                  storage + c * num_slots,
+                                                  s);
+      updated[c * num_slots + s] = false;
+    }
+  }
+  if (threadIdx.x == 0) { num_slots_used = 0; }
+  __syncthreads();
+
+  auto const stride = static_cast<int64_t>(blockDim.x) * gridDim.x;
+  for (auto i = static_cast<int64_t>(threadIdx.x) + int64_t{blockIdx.x} * blockDim.x; i < num_keys;
+       i += stride) {
+    auto const row = static_cast<size_type>(i);
+    if (skip_rows_with_nulls and not cudf::bit_is_set(row_bitmask, row)) { continue; }
+
+    auto const group = map.insert(row);
+    auto const slot =
+      find_or_insert_shared_memory_slot(group, slot_groups, num_slots, &num_slots_used);
+    if (slot == GROUPBY_SHM_EMPTY_SLOT) {
+      cudf::detail::aggregate_row<true, true>(output_values, group, input_values, row, aggs);
+      continue;
+    }
+    for (size_type c = 0; c < num_columns; ++c) {
+      cudf::detail::dispatch_type_and_aggregation(input_values.column(c).type(),
+                                                  aggs[c],
+                                                  update_shared_memory_target{},
+                                                  storage + c * num_slots,
+                                                  updated + c * num_slots,
+                                                  slot,
+                                                  input_values.column(c),
+                                                  row);
+    }
+  }
+  __syncthreads();
+
+  for (auto s = static_cast<size_type>(threadIdx.x); s < num_slots; s += blockDim.x) {
+    auto const group = slot_groups[s];
+    if (group == GROUPBY_SHM_EMPTY_SLOT) { continue; }
+    for (size_type c = 0; c < num_columns; ++c) {
+      if (not updated[c * num_slots + s]) { continue; }
+      cudf::detail::dispatch_type_and_aggregation(input_values.column(c).type(),
+                                                  aggs[c],
+                                                  merge_shared_memory_target{},
+                                                  output_values.column(c),
+                                                  group,
+                                                  storage + c * num_slots,
+                                                  s);
+    }
+  }
+}
+
 }  // namespace hash
 }  // namespace detail
 }  // namespace groupby
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,7 @@
 #include <cudf/detail/utilities/device_atomics.cuh>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <cmath>
@@ -30,7 +31,14 @@
 namespace cudf {
 namespace detail {
 
-template <typename Map, bool target_has_nulls = true, bool source_has_nulls = true>
+/**
+ * @brief Computes `VARIANCE` or, when `k` is `M2`, the sum of the squared differences from the
+ * mean, of a sparse result from the sparse results of `SUM` and `COUNT_VALID`.
+ */
+template <typename Map,
+          aggregation::Kind k   = aggregation::VARIANCE,
+          bool target_has_nulls = true,
+          bool source_has_nulls = true>
 struct var_hash_functor {
   Map const map;
   bitmask_type const* __restrict__ row_bitmask;
@@ -75,17 +83,18 @@ struct var_hash_functor {
                                                                  size_type source_index,
                                                                  size_type target_index) noexcept
   {
-    using Target    = target_type_t<Source, aggregation::VARIANCE>;
+    using Target    = target_type_t<Source, k>;
     using SumType   = target_type_t<Source, aggregation::SUM>;
     using CountType = target_type_t<Source, aggregation::COUNT_VALID>;
 
     if (source_has_nulls and source.is_null(source_index)) return;
     CountType group_size = count.element<CountType>(target_index);
-    if (group_size == 0 or group_size - ddof <= 0) return;
+    if (group_size == 0 or (k == aggregation::VARIANCE and group_size - ddof <= 0)) return;
 
     auto x        = static_cast<Target>(source.element<Source>(source_index));
     auto mean     = static_cast<Target>(sum.element<SumType>(target_index)) / group_size;
-    Target result = (x - mean) * (x - mean) / (group_size - ddof);
+    Target result = (x - mean) * (x - mean);
+    if (k == aggregation::VARIANCE) { result /= (group_size - ddof); }
     atomicAdd(&target.element<Target>(target_index), result);
     // STD sqrt is applied in finalize()
 
@@ -94,8 +103,7 @@ struct var_hash_functor {
   __device__ inline void operator()(size_type source_index)
   {
     if (row_bitmask == nullptr or cudf::bit_is_set(row_bitmask, source_index)) {
-      auto result       = map.find(source_index);
-      auto target_index = result->second;
+      auto const target_index = map.find(source_index);
 
       auto col         = source;
       auto source_type = source.type();
@@ -110,5 +118,30 @@ struct var_hash_functor {
   }
 };
 
+/**
+ * @brief Counts the distinct values of each group into a sparse result.
+ *
+ * `pairs` is a map of the rows of the keys and values together, so that the first row of each
+ * distinct value of a group is the only one to be inserted.
+ */
+template <typename Map>
+struct nunique_hash_functor {
+  Map const map;
+  Map pairs;
+  bitmask_type const* __restrict__ row_bitmask;
+  mutable_column_device_view target;
+  column_device_view source;
+  bool include_nulls;
+
+  __device__ inline void operator()(size_type source_index)
+  {
+    if (row_bitmask != nullptr and not cudf::bit_is_set(row_bitmask, source_index)) { return; }
+    if (not include_nulls and source.is_null(source_index)) { return; }
+    if (pairs.insert(source_index) == source_index) {
+      atomicAdd(&target.element<size_type>(map.find(source_index)), size_type{1});
+    }
+  }
+};
+
 }  // namespace detail
 }  // namespace cudf
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <thrust/host_vector.h>
+#include <thrust/system/cuda/experimental/pinned_allocator.h>
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace {
+
+using pinned_buffer =
+  thrust::host_vector<uint8_t, thrust::system::cuda::experimental::pinned_allocator<uint8_t>>;
+
+/**
+ * @brief A partition packed by `contiguous_split` and spilled to pinned host memory.
+ */
+struct spilled_partition {
+  std::unique_ptr<packed_columns::metadata> metadata;
+  pinned_buffer data;
+};
+
+/**
+ * @brief Hash partitions `input` on the columns `on`, and spills the non-empty partitions to
+ * host memory.
+ */
+std::vector<spilled_partition> spill_partitions(table_view const& input,
+                                                std::vector<size_type> const& on,
+                                                size_type num_partitions,
+                                                rmm::cuda_stream_view stream)
+{
+  auto [partitioned, offsets] = cudf::hash_partition(
+    input, on, num_partitions, hash_id::HASH_MURMUR3, DEFAULT_HASH_SEED, stream);
+  std::vector<size_type> const splits(offsets.begin() + 1, offsets.end());
+  auto packed = cudf::detail::contiguous_split(partitioned->view(), splits, stream);
+  partitioned.reset();
+
+  // The copies of all the partitions are queued before waiting on any of them
+  std::vector<spilled_partition> spilled;
+  for (auto& partition : packed) {
+    if (partition.table.num_rows() == 0) { continue; }
+    auto& gpu_data = *partition.data.gpu_data;
+    spilled.push_back({std::move(partition.data.metadata_), pinned_buffer(gpu_data.size())});
+    CUDA_TRY(cudaMemcpyAsync(spilled.back().data.data(),
+                             gpu_data.data(),
+                             gpu_data.size(),
+                             cudaMemcpyDeviceToHost,
+                             stream.value()));
+  }
+  stream.synchronize();
+  return spilled;
+}
+
+}  // namespace
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> partitioned_aggregate(
+  table_view const& keys,
+  host_span<aggregation_request const> requests,
+  size_type num_partitions,
+  null_policy include_null_keys,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(num_partitions > 0, "Number of partitions must be positive");
+  CUDF_EXPECTS(
+    std::all_of(requests.begin(),
+                requests.end(),
+                [&keys](auto const& request) { return request.values.size() == keys.num_rows(); }),
+    "Size mismatch between request values and groupby keys.");
+
+  if (num_partitions == 1 or keys.num_rows() == 0) {
+    return cudf::groupby::groupby(keys, include_null_keys).aggregate(requests, stream, mr);
+  }
+
+  // The keys are followed by the values of each request
+  std::vector<column_view> columns(keys.begin(), keys.end());
+  std::transform(requests.begin(),
+                 requests.end(),
+                 std::back_inserter(columns),
+                 [](auto const& request) { return request.values; });
+  std::vector<size_type> key_indices(keys.num_columns());
+  std::iota(key_indices.begin(), key_indices.end(), 0);
+
+  auto spilled = spill_partitions(table_view{columns}, key_indices, num_partitions, stream);
+
+  std::vector<std::unique_ptr<table>> partition_keys;
+  std::vector<std::vector<aggregation_result>> partition_results;
+  for (auto& partition : spilled) {
+    auto gpu_data = std::make_unique<rmm::device_buffer>(partition.data.size(), stream);
+    CUDA_TRY(cudaMemcpyAsync(gpu_data->data(),
+                             partition.data.data(),
+                             partition.data.size(),
+                             cudaMemcpyHostToDevice,
+                             stream.value()));
+    packed_columns const packed{std::move(partition.metadata), std::move(gpu_data)};
+    auto const input = unpack(packed);
+
+    std::vector<aggregation_request> partition_requests(requests.size());
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+      partition_requests[i].values = input.column(keys.num_columns() + i);
+      for (auto const& agg : requests[i].aggregations) {
+        partition_requests[i].aggregations.emplace_back(
+          dynamic_cast<groupby_aggregation*>(agg->clone().release()));
+      }
+    }
+    auto [result_keys, results] =
+      cudf::groupby::groupby(input.select(key_indices), include_null_keys)
+        .aggregate(partition_requests);
+    partition_keys.push_back(std::move(result_keys));
+    partition_results.push_back(std::move(results));
+
+    // The host buffer is released with the partition, so the copy must be done by then
+    stream.synchronize();
+    partition.data = pinned_buffer{};
+  }
+
+  std::vector<table_view> key_views;
+  std::transform(partition_keys.begin(),
+                 partition_keys.end(),
+                 std::back_inserter(key_views),
+                 [](auto const& t) { return t->view(); });
+  auto result_keys = cudf::detail::concatenate(key_views, stream, mr);
+
+  std::vector<aggregation_result> results(requests.size());
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    for (std::size_t j = 0; j < requests[i].aggregations.size(); ++j) {
+      std::vector<column_view> views;
+      for (auto const& partition : partition_results) {
+        views.push_back(partition[i].results[j]->view());
+      }
+      results[i].results.push_back(cudf::detail::concatenate(views, stream, mr));
+    }
+  }
+  return std::make_pair(std::move(result_keys), std::move(results));
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> partitioned_aggregate(
+  table_view const& keys,
+  host_span<aggregation_request const> requests,
+  size_type num_partitions,
+  null_policy include_null_keys,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::partitioned_aggregate(
+    keys, requests, num_partitions, include_null_keys, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace groupby
+}  // namespace cudf
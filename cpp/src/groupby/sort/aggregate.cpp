@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -26,6 +26,7 @@
 #include <cudf/detail/binaryop.hpp>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/detail/hyperloglog/hyperloglog.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/unary.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
@@ -37,9 +38,11 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace cudf {
 namespace groupby {
@@ -60,6 +63,54 @@ struct aggregate_result_functor final : store_result_functor {
   {
     CUDF_FAIL("Unsupported aggregation.");
   }
+
+  /**
+   * @brief Computes the single-pass reductions of `aggs`, and the SUM and COUNT_VALID which
+   * MEAN, M2, VARIANCE and STD derive from, in one pass over the grouped values.
+   *
+   * The results are added to the cache, where the dispatch of each aggregation finds them. Nothing
+   * is computed unless there are several such reductions.
+   */
+  void fuse_reductions(std::vector<std::unique_ptr<groupby_aggregation>> const& aggs)
+  {
+    std::vector<std::unique_ptr<aggregation>> fused;
+    auto const add = [&](std::unique_ptr<aggregation>&& agg) {
+      if (not detail::is_fused_reduction_supported(values.type(), agg->kind) or
+          cache.has_result(values, *agg) or
+          std::any_of(fused.begin(), fused.end(), [&agg](auto const& f) {
+            return f->is_equal(*agg);
+          })) {
+        return;
+      }
+      fused.push_back(std::move(agg));
+    };
+    for (auto const& agg : aggs) {
+      switch (agg->kind) {
+        case aggregation::MEAN:
+        case aggregation::M2:
+        case aggregation::VARIANCE:
+        case aggregation::STD:
+          add(make_sum_aggregation());
+          add(make_count_aggregation());
+          break;
+        default: add(agg->clone());
+      }
+    }
+    if (fused.size() < 2) { return; }
+
+    std::vector<aggregation::Kind> kinds(fused.size());
+    std::transform(
+      fused.begin(), fused.end(), kinds.begin(), [](auto const& agg) { return agg->kind; });
+    auto results = detail::group_fused_reductions(get_grouped_values(),
+                                                  kinds,
+                                                  helper.num_groups(stream),
+                                                  helper.group_labels(stream),
+                                                  stream,
+                                                  mr);
+    for (std::size_t i = 0; i < fused.size(); ++i) {
+      cache.add_result(values, *fused[i], std::move(results[i]));
+    }
+  }
 };
 
 template <>
@@ -753,6 +804,59 @@ void aggregate_result_functor::operator()<aggregation::MERGE_TDIGEST>(aggregatio
                                                mr));
 };
 
+/**
+ * @brief Generate a HyperLogLog sketch of the values of each group.
+ *
+ * The sketches are the rows of a `LIST<UINT8>` column, each made of the `2^precision` registers
+ * of the sketch of a group.
+ */
+template <>
+void aggregate_result_functor::operator()<aggregation::HLL>(aggregation const& agg)
+{
+  if (cache.has_result(values, agg)) { return; }
+
+  auto const precision = dynamic_cast<cudf::detail::hll_aggregation const&>(agg).precision;
+  cache.add_result(values,
+                   agg,
+                   cudf::detail::hyperloglog::make_sketches(get_grouped_values(),
+                                                            helper.group_labels(stream),
+                                                            helper.num_groups(stream),
+                                                            precision,
+                                                            stream,
+                                                            mr));
+};
+
+template <>
+void aggregate_result_functor::operator()<aggregation::MERGE_HLL>(aggregation const& agg)
+{
+  if (cache.has_result(values, agg)) { return; }
+
+  auto const precision = dynamic_cast<cudf::detail::merge_hll_aggregation const&>(agg).precision;
+  cache.add_result(values,
+                   agg,
+                   cudf::detail::hyperloglog::merge_sketches(get_grouped_values(),
+                                                             helper.group_labels(stream),
+                                                             helper.num_groups(stream),
+                                                             precision,
+                                                             stream,
+                                                             mr));
+};
+
+template <>
+void aggregate_result_functor::operator()<aggregation::APPROX_NUNIQUE>(aggregation const& agg)
+{
+  if (cache.has_result(values, agg)) { return; }
+
+  auto const precision =
+    dynamic_cast<cudf::detail::approx_nunique_aggregation const&>(agg).precision;
+  auto hll_agg = make_hll_aggregation(precision);
+  operator()<aggregation::HLL>(*hll_agg);
+  column_view sketches = cache.get_result(values, *hll_agg);
+
+  cache.add_result(
+    values, agg, cudf::detail::hyperloglog::estimate_distinct_count(sketches, stream, mr));
+};
+
 }  // namespace detail
 
 // Sort-based groupby
@@ -769,8 +873,8 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::sort
   for (auto const& request : requests) {
     auto store_functor =
       detail::aggregate_result_functor(request.values, helper(), cache, stream, mr);
+    store_functor.fuse_reductions(request.aggregations);
     for (auto const& agg : request.aggregations) {
-      // TODO (dm): single pass compute all supported reductions
       cudf::detail::aggregation_dispatcher(agg->kind, store_functor, *agg);
     }
   }
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <groupby/sort/group_reductions.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace {
+
+template <typename T>
+constexpr bool is_fused_reduction_type()
+{
+  return std::is_arithmetic_v<T> and not std::is_same_v<T, bool>;
+}
+
+/**
+ * @brief Partial results of all the fused reductions of a range of rows.
+ */
+template <typename T>
+struct fused_accumulator {
+  using sum_type     = cudf::detail::target_type_t<T, aggregation::SUM>;
+  using product_type = cudf::detail::target_type_t<T, aggregation::PRODUCT>;
+
+  sum_type sum;
+  product_type product;
+  T min;
+  T max;
+  size_type count;  // Number of valid rows
+};
+
+/**
+ * @brief Device functor returning the partial results of a single row, with the identities of the
+ * reductions for a null row.
+ */
+template <typename T>
+struct make_accumulator_fn {
+  using accumulator = fused_accumulator<T>;
+  column_device_view d_values;
+
+  __device__ accumulator operator()(size_type i) const noexcept
+  {
+    if (d_values.is_null(i)) {
+      return {cudf::DeviceSum::identity<typename accumulator::sum_type>(),
+              cudf::DeviceProduct::identity<typename accumulator::product_type>(),
+              cudf::DeviceMin::identity<T>(),
+              cudf::DeviceMax::identity<T>(),
+              0};
+    }
+    auto const value = d_values.element<T>(i);
+    return {static_cast<typename accumulator::sum_type>(value),
+            static_cast<typename accumulator::product_type>(value),
+            value,
+            value,
+            1};
+  }
+};
+
+template <typename T>
+struct combine_accumulators_fn {
+  __device__ fused_accumulator<T> operator()(fused_accumulator<T> const& lhs,
+                                             fused_accumulator<T> const& rhs) const noexcept
+  {
+    return {lhs.sum + rhs.sum,
+            lhs.product * rhs.product,
+            cudf::DeviceMin{}(lhs.min, rhs.min),
+            cudf::DeviceMax{}(lhs.max, rhs.max),
+            lhs.count + rhs.count};
+  }
+};
+
+/**
+ * @brief Device functor returning the result of the reduction `K` from the partial results of a
+ * group.
+ */
+template <aggregation::Kind K, typename T, typename ResultType>
+struct extract_result_fn {
+  __device__ ResultType operator()(fused_accumulator<T> const& acc) const noexcept
+  {
+    if constexpr (K == aggregation::SUM) {
+      return acc.sum;
+    } else if constexpr (K == aggregation::PRODUCT) {
+      return acc.product;
+    } else if constexpr (K == aggregation::MIN) {
+      return acc.min;
+    } else if constexpr (K == aggregation::MAX) {
+      return acc.max;
+    } else {
+      return acc.count;
+    }
+  }
+};
+
+template <aggregation::Kind K, typename T>
+std::unique_ptr<column> extract_result(device_span<fused_accumulator<T> const> accumulators,
+                                       bool has_nulls,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  using accumulator = fused_accumulator<T>;
+  using ResultType  = std::conditional_t<
+    K == aggregation::SUM,
+    typename accumulator::sum_type,
+    std::conditional_t<K == aggregation::PRODUCT,
+                       typename accumulator::product_type,
+                       std::conditional_t<K == aggregation::COUNT_VALID, size_type, T>>>;
+
+  auto const num_groups = static_cast<size_type>(accumulators.size());
+  auto result           = make_fixed_width_column(
+    data_type{type_to_id<ResultType>()}, num_groups, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    accumulators.begin(),
+                    accumulators.end(),
+                    result->mutable_view().template begin<ResultType>(),
+                    extract_result_fn<K, T, ResultType>{});
+
+  // The reductions of groups without valid values are null, unlike their counts
+  if (has_nulls and K != aggregation::COUNT_VALID) {
+    auto [null_mask, null_count] = cudf::detail::valid_if(
+      accumulators.begin(),
+      accumulators.end(),
+      [] __device__(fused_accumulator<T> const& acc) { return acc.count > 0; },
+      stream,
+      mr);
+    result->set_null_mask(std::move(null_mask), null_count);
+  }
+  return result;
+}
+
+struct group_fused_reductions_fn {
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_fused_reduction_type<T>(), std::vector<std::unique_ptr<column>>>
+  operator()(Args&&...)
+  {
+    CUDF_FAIL("Unsupported type for fused groupby reductions");
+  }
+
+  template <typename T>
+  std::enable_if_t<is_fused_reduction_type<T>(), std::vector<std::unique_ptr<column>>> operator()(
+    column_view const& values,
+    host_span<aggregation::Kind const> kinds,
+    size_type num_groups,
+    device_span<size_type const> group_labels,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr)
+  {
+    // A single pass over the values computes all the reductions of each group
+    rmm::device_uvector<fused_accumulator<T>> accumulators(num_groups, stream);
+    auto const d_values = column_device_view::create(values, stream);
+    thrust::reduce_by_key(
+      rmm::exec_policy(stream),
+      group_labels.begin(),
+      group_labels.end(),
+      cudf::detail::make_counting_transform_iterator(0, make_accumulator_fn<T>{*d_values}),
+      thrust::make_discard_iterator(),
+      accumulators.begin(),
+      thrust::equal_to<size_type>{},
+      combine_accumulators_fn<T>{});
+
+    auto const has_nulls = values.has_nulls();
+    std::vector<std::unique_ptr<column>> results;
+    for (auto const kind : kinds) {
+      switch (kind) {
+        case aggregation::SUM:
+          results.push_back(
+            extract_result<aggregation::SUM, T>(accumulators, has_nulls, stream, mr));
+          break;
+        case aggregation::PRODUCT:
+          results.push_back(
+            extract_result<aggregation::PRODUCT, T>(accumulators, has_nulls, stream, mr));
+          break;
+        case aggregation::MIN:
+          results.push_back(
+            extract_result<aggregation::MIN, T>(accumulators, has_nulls, stream, mr));
+          break;
+        case aggregation::MAX:
+          results.push_back(
+            extract_result<aggregation::MAX, T>(accumulators, has_nulls, stream, mr));
+          break;
+        case aggregation::COUNT_VALID:
+          results.push_back(
+            extract_result<aggregation::COUNT_VALID, T>(accumulators, has_nulls, stream, mr));
+          break;
+        default: CUDF_FAIL("Unsupported aggregation in fused groupby reductions");
+      }
+    }
+    return results;
+  }
+};
+
+}  // namespace
+
+bool is_fused_reduction_supported(data_type values_type, aggregation::Kind kind)
+{
+  auto const type_supported = cudf::is_numeric(values_type) and
+                              values_type.id() != type_id::BOOL8;
+  return type_supported and (kind == aggregation::SUM or kind == aggregation::PRODUCT or
+                             kind == aggregation::MIN or kind == aggregation::MAX or
+                             kind == aggregation::COUNT_VALID);
+}
+
+std::vector<std::unique_ptr<column>> group_fused_reductions(
+  column_view const& values,
+  host_span<aggregation::Kind const> kinds,
+  size_type num_groups,
+  cudf::device_span<size_type const> group_labels,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  return type_dispatcher(values.type(),
+                         group_fused_reductions_fn{},
+                         values,
+                         kinds,
+                         num_groups,
+                         group_labels,
+                         stream,
+                         mr);
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
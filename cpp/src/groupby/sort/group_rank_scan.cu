@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,59 +22,92 @@
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/scan.h>
+#include <thrust/tabulate.h>
+
+#include <utility>
+
 namespace cudf {
 namespace groupby {
 namespace detail {
 namespace {
 /**
- * @brief generate grouped row ranks or dense ranks using a row comparison then scan the results
+ * @brief Returns whether each row starts a group or differs from the previous row of its group
+ *
+ * @param order_by input column to generate ranks for
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param group_offsets group index offsets with group ID indices
+ * @param has_nulls true if nulls are included in the `order_by` column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The flag of each row
+ */
+rmm::device_uvector<bool> rank_run_starts(column_view const& order_by,
+                                          device_span<size_type const> group_labels,
+                                          device_span<size_type const> group_offsets,
+                                          bool has_nulls,
+                                          rmm::cuda_stream_view stream)
+{
+  auto const flattened = cudf::structs::detail::flatten_nested_columns(
+    table_view{{order_by}}, {}, {}, structs::detail::column_nullability::MATCH_INCOMING);
+  auto const d_flat_order = table_device_view::create(flattened, stream);
+  row_equality_comparator comparator(
+    nullate::DYNAMIC{has_nulls}, *d_flat_order, *d_flat_order, null_equality::EQUAL);
+  rmm::device_uvector<bool> run_starts(flattened.flattened_columns().num_rows(), stream);
+
+  thrust::tabulate(
+    rmm::exec_policy(stream),
+    run_starts.begin(),
+    run_starts.end(),
+    [comparator, labels = group_labels.data(), offsets = group_offsets.data()] __device__(
+      size_type row_index) {
+      return row_index == offsets[labels[row_index]] || !comparator(row_index, row_index - 1);
+    });
+  return run_starts;
+}
+
+/**
+ * @brief generate grouped row ranks or dense ranks from the run start flags then scan the results
  *
  * @tparam value_resolver flag value resolver function with boolean first and row number arguments
  * @tparam scan_operator scan function ran on the flag values
- * @param order_by input column to generate ranks for
+ * @param run_starts flags of the rows that differ from the previous row of their group
  * @param group_labels ID of group that the corresponding value belongs to
  * @param group_offsets group index offsets with group ID indices
  * @param resolver flag value resolver
  * @param scan_op scan operation ran on the flag results
- * @param has_nulls true if nulls are included in the `order_by` column
  * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned column's device memory
  * @return std::unique_ptr<column> rank values
  */
 template <typename value_resolver, typename scan_operator>
-std::unique_ptr<column> rank_generator(column_view const& order_by,
+std::unique_ptr<column> rank_generator(device_span<bool const> run_starts,
                                        device_span<size_type const> group_labels,
                                        device_span<size_type const> group_offsets,
                                        value_resolver resolver,
                                        scan_operator scan_op,
-                                       bool has_nulls,
                                        rmm::cuda_stream_view stream,
                                        rmm::mr::device_memory_resource* mr)
 {
-  auto const flattened = cudf::structs::detail::flatten_nested_columns(
-    table_view{{order_by}}, {}, {}, structs::detail::column_nullability::MATCH_INCOMING);
-  auto const d_flat_order = table_device_view::create(flattened, stream);
-  row_equality_comparator comparator(
-    nullate::DYNAMIC{has_nulls}, *d_flat_order, *d_flat_order, null_equality::EQUAL);
   auto ranks         = make_fixed_width_column(data_type{type_to_id<size_type>()},
-                                       flattened.flattened_columns().num_rows(),
+                                       static_cast<size_type>(run_starts.size()),
                                        mask_state::UNALLOCATED,
                                        stream,
                                        mr);
   auto mutable_ranks = ranks->mutable_view();
 
-  thrust::tabulate(
-    rmm::exec_policy(stream),
-    mutable_ranks.begin<size_type>(),
-    mutable_ranks.end<size_type>(),
-    [comparator, resolver, labels = group_labels.data(), offsets = group_offsets.data()] __device__(
-      size_type row_index) {
-      auto group_start = offsets[labels[row_index]];
-      return resolver(row_index == group_start || !comparator(row_index, row_index - 1),
-                      row_index - group_start);
-    });
+  thrust::tabulate(rmm::exec_policy(stream),
+                   mutable_ranks.begin<size_type>(),
+                   mutable_ranks.end<size_type>(),
+                   [resolver,
+                    run_starts = run_starts.data(),
+                    labels     = group_labels.data(),
+                    offsets    = group_offsets.data()] __device__(size_type row_index) {
+                     return resolver(run_starts[row_index],
+                                     row_index - offsets[labels[row_index]]);
+                   });
 
   thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
                                 group_labels.begin(),
@@ -86,41 +119,74 @@ std::unique_ptr<column> rank_generator(column_view const& order_by,
 
   return ranks;
 }
-}  // namespace
 
-std::unique_ptr<column> rank_scan(column_view const& order_by,
-                                  device_span<size_type const> group_labels,
-                                  device_span<size_type const> group_offsets,
-                                  rmm::cuda_stream_view stream,
-                                  rmm::mr::device_memory_resource* mr)
+std::unique_ptr<column> rank_from_run_starts(device_span<bool const> run_starts,
+                                             device_span<size_type const> group_labels,
+                                             device_span<size_type const> group_offsets,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr)
 {
   return rank_generator(
-    order_by,
+    run_starts,
     group_labels,
     group_offsets,
     [] __device__(bool equality, auto row_index) { return equality ? row_index + 1 : 0; },
     DeviceMax{},
-    has_nested_nulls(table_view{{order_by}}),
     stream,
     mr);
 }
 
-std::unique_ptr<column> dense_rank_scan(column_view const& order_by,
-                                        device_span<size_type const> group_labels,
-                                        device_span<size_type const> group_offsets,
-                                        rmm::cuda_stream_view stream,
-                                        rmm::mr::device_memory_resource* mr)
+std::unique_ptr<column> dense_rank_from_run_starts(device_span<bool const> run_starts,
+                                                   device_span<size_type const> group_labels,
+                                                   device_span<size_type const> group_offsets,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr)
 {
   return rank_generator(
-    order_by,
+    run_starts,
     group_labels,
     group_offsets,
     [] __device__(bool equality, auto row_index) { return equality; },
     DeviceSum{},
-    has_nested_nulls(table_view{{order_by}}),
     stream,
     mr);
 }
+}  // namespace
+
+std::unique_ptr<column> rank_scan(column_view const& order_by,
+                                  device_span<size_type const> group_labels,
+                                  device_span<size_type const> group_offsets,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  auto const run_starts = rank_run_starts(
+    order_by, group_labels, group_offsets, has_nested_nulls(table_view{{order_by}}), stream);
+  return rank_from_run_starts(run_starts, group_labels, group_offsets, stream, mr);
+}
+
+std::unique_ptr<column> dense_rank_scan(column_view const& order_by,
+                                        device_span<size_type const> group_labels,
+                                        device_span<size_type const> group_offsets,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  auto const run_starts = rank_run_starts(
+    order_by, group_labels, group_offsets, has_nested_nulls(table_view{{order_by}}), stream);
+  return dense_rank_from_run_starts(run_starts, group_labels, group_offsets, stream, mr);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> rank_and_dense_rank_scan(
+  column_view const& order_by,
+  device_span<size_type const> group_labels,
+  device_span<size_type const> group_offsets,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const run_starts = rank_run_starts(
+    order_by, group_labels, group_offsets, has_nested_nulls(table_view{{order_by}}), stream);
+  return {rank_from_run_starts(run_starts, group_labels, group_offsets, stream, mr),
+          dense_rank_from_run_starts(run_starts, group_labels, group_offsets, stream, mr)};
+}
 
 }  // namespace detail
 }  // namespace groupby
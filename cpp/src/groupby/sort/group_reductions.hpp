@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,7 @@
 #include <rmm/cuda_stream_view.hpp>
 
 #include <memory>
+#include <vector>
 
 /** @internal @file Internal API in this file are mostly segmented reduction operations on column,
  * which are used in sort-based groupby aggregations.
@@ -54,6 +55,42 @@ std::unique_ptr<column> group_sum(column_view const& values,
                                   rmm::cuda_stream_view stream,
                                   rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Indicates if the groupwise reduction `kind` of values of type `values_type` can be
+ * computed by `group_fused_reductions`.
+ */
+bool is_fused_reduction_supported(data_type values_type, aggregation::Kind kind);
+
+/**
+ * @brief Internal API to calculate several groupwise reductions of the same values in one pass
+ *
+ * Each value is loaded and checked for null once for all the reductions.
+ *
+ * @code{.pseudo}
+ * values       = [2, 1, 4, -1, -2, <NA>, 4, <NA>]
+ * group_labels = [0, 0, 0,  1,  1,    2, 2,    3]
+ * num_groups   = 4
+ * kinds        = [SUM, MIN, COUNT_VALID]
+ *
+ * group_fused_reductions = [[7, -3, 4, <NA>], [1, -2, 4, <NA>], [3, 2, 1, 0]]
+ * @endcode
+ *
+ * @param values Grouped values to reduce
+ * @param kinds The reductions to compute, for which `is_fused_reduction_supported` holds
+ * @param num_groups Number of groups
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return The results of the reductions, in the order of `kinds`
+ */
+std::vector<std::unique_ptr<column>> group_fused_reductions(
+  column_view const& values,
+  host_span<aggregation::Kind const> kinds,
+  size_type num_groups,
+  cudf::device_span<size_type const> group_labels,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
 /**
  * @brief Internal API to calculate groupwise product
  *
@@ -571,6 +608,34 @@ std::unique_ptr<column> group_merge_tdigest(column_view const& values,
                                             rmm::cuda_stream_view stream,
                                             rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Generate a tdigest column from ungrouped and unsorted numeric input values.
+ *
+ * The tdigest column produced has the structure described in `group_tdigest`, with one tdigest
+ * per group, so that the tdigests can be built by the hash groupby.
+ *
+ * The values are processed in chunks of bounded size. The values of each chunk are radix sorted
+ * by group and value to build a tdigest per group, and the tdigests buffered for each group are
+ * merged into one every few chunks and once at the end, so that no segmented sort of all the
+ * values is needed.
+ *
+ * @param values Ungrouped values to build the tdigests from.
+ * @param group_labels 0-based ID of group that the corresponding value belongs to, or -1 to skip it
+ * @param num_groups Number of groups.
+ * @param max_centroids Parameter controlling the level of compression of the tdigest. Higher
+ * values result in a larger, more precise tdigest.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns tdigest column, with 1 tdigest per row
+ */
+std::unique_ptr<column> unsorted_group_tdigest(column_view const& values,
+                                               cudf::device_span<size_type const> group_labels,
+                                               size_type num_groups,
+                                               int max_centroids,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr);
+
 }  // namespace detail
 }  // namespace groupby
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,7 @@
 #include <rmm/cuda_stream_view.hpp>
 
 #include <memory>
+#include <utility>
 
 namespace cudf {
 namespace groupby {
@@ -116,6 +117,24 @@ std::unique_ptr<column> dense_rank_scan(column_view const& order_by,
                                         rmm::cuda_stream_view stream,
                                         rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Internal API to calculate groupwise rank and dense rank values in a single comparison
+ * of the rows
+ *
+ * @param order_by column or struct column that rows within a group are sorted by
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param group_offsets group index offsets with group ID indices
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Columns of type size_type of rank and dense rank values
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> rank_and_dense_rank_scan(
+  column_view const& order_by,
+  device_span<size_type const> group_labels,
+  device_span<size_type const> group_offsets,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
 }  // namespace detail
 }  // namespace groupby
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,12 +19,13 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.cuh>
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/iterator.cuh>
-#include <cudf/detail/merge.cuh>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/tdigest/tdigest.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/tdigest/tdigest_column_view.cuh>
 #include <cudf/utilities/span.hpp>
 
@@ -34,7 +35,11 @@
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/sort.h>
+#include <thrust/tabulate.h>
 
 namespace cudf {
 namespace groupby {
@@ -816,67 +821,44 @@ std::unique_ptr<column> group_merge_tdigest(column_view const& input,
     return cudf::detail::tdigest::make_empty_tdigest_column(stream, mr);
   }
 
-  // first step is to merge all the tdigests in each group. at the moment the only way to
-  // make this work is to retrieve the group sizes (via group_offsets) and the individual digest
-  // sizes (via input.offsets()) to the gpu and do the merges.  The scale problem is that while the
-  // size of each group will likely be small (size of each group will typically map to # of batches
-  // the input data was chopped into for tdigest generation), the -number- of groups can be
-  // arbitrarily large.
-  //
-  // thrust::merge and thrust::merge_by_key don't provide what we need.  What we would need is an
-  // algorithm like a super-merge that takes two layers of keys: one which identifies the outer
-  // grouping of tdigests, and one which identifies the inner groupings of the tdigests within the
-  // outer groups.
-
-  // bring group offsets back to the host
-  std::vector<size_type> h_outer_offsets(group_offsets.size());
-  cudaMemcpyAsync(h_outer_offsets.data(),
-                  group_offsets.data(),
-                  sizeof(size_type) * group_offsets.size(),
-                  cudaMemcpyDeviceToHost,
-                  stream);
-
-  // bring tdigest offsets back to the host
+  // first step is to merge all the tdigests in each group. the groups of tdigests are contiguous,
+  // so sorting all the centroids by mean, then stably by group, merges the tdigests of each group
+  // in place, without bringing the offsets back to the host to merge the groups one by one.
   auto tdigest_offsets = tdv.centroids().offsets();
-  std::vector<size_type> h_inner_offsets(tdigest_offsets.size());
-  cudaMemcpyAsync(h_inner_offsets.data(),
-                  tdigest_offsets.begin<size_type>(),
-                  sizeof(size_type) * tdigest_offsets.size(),
-                  cudaMemcpyDeviceToHost,
-                  stream);
-
-  stream.synchronize();
-
-  // extract all means and weights into a table
-  cudf::table_view tdigests_unsliced({tdv.means(), tdv.weights()});
-
-  // generate the merged (but not yet compressed) tdigests for each group.
-  std::vector<std::unique_ptr<table>> tdigests;
-  tdigests.reserve(num_groups);
-  std::transform(
-    h_outer_offsets.begin(),
-    h_outer_offsets.end() - 1,
-    std::next(h_outer_offsets.begin()),
-    std::back_inserter(tdigests),
-    [&](auto tdigest_start, auto tdigest_end) {
-      // the range of tdigests in this group
-      auto const num_tdigests = tdigest_end - tdigest_start;
-
-      // slice each tdigest from the input
-      std::vector<table_view> unmerged_tdigests;
-      unmerged_tdigests.reserve(num_tdigests);
-      auto offset_iter = std::next(h_inner_offsets.begin(), tdigest_start);
-      std::transform(offset_iter,
-                     offset_iter + num_tdigests,
-                     std::next(offset_iter),
-                     std::back_inserter(unmerged_tdigests),
-                     [&](auto start, auto end) {
-                       return cudf::detail::slice(tdigests_unsliced, {start, end}, stream);
-                     });
-
-      // merge
-      return cudf::detail::merge(unmerged_tdigests, {0}, {order::ASCENDING}, {}, stream, mr);
+  auto merged = std::make_unique<table>(table_view({tdv.means(), tdv.weights()}), stream, mr);
+  auto const num_centroids = merged->num_rows();
+
+  // the group of each centroid
+  auto centroid_group = cudf::detail::make_counting_transform_iterator(
+    0,
+    [group_labels      = group_labels.begin(),
+     inner_offsets     = tdigest_offsets.begin<size_type>(),
+     num_inner_offsets = tdigest_offsets.size()] __device__(int index) {
+      // what -original- tdigest index this absolute index corresponds to
+      auto const iter = thrust::prev(
+        thrust::upper_bound(thrust::seq, inner_offsets, inner_offsets + num_inner_offsets, index));
+      auto const tdigest_index = thrust::distance(inner_offsets, iter);
+
+      // what group index the original tdigest belongs to
+      return group_labels[tdigest_index];
     });
+  rmm::device_uvector<size_type> centroid_groups(num_centroids, stream);
+  thrust::copy(rmm::exec_policy(stream),
+               centroid_group,
+               centroid_group + num_centroids,
+               centroid_groups.begin());
+  auto const means   = merged->get_column(0).mutable_view().begin<double>();
+  auto const weights = merged->get_column(1).mutable_view().begin<double>();
+  thrust::stable_sort_by_key(
+    rmm::exec_policy(stream),
+    means,
+    means + num_centroids,
+    thrust::make_zip_iterator(thrust::make_tuple(weights, centroid_groups.begin())));
+  thrust::stable_sort_by_key(
+    rmm::exec_policy(stream),
+    centroid_groups.begin(),
+    centroid_groups.end(),
+    thrust::make_zip_iterator(thrust::make_tuple(means, weights)));
 
   // generate min and max values
   auto merged_min_col = cudf::make_numeric_column(
@@ -932,35 +914,13 @@ std::unique_ptr<column> group_merge_tdigest(column_view const& input,
                      group_is_empty,
                      0);
 
-  // concatenate all the merged tdigests back into one table.
-  std::vector<table_view> tdigest_views;
-  tdigest_views.reserve(num_groups);
-  std::transform(tdigests.begin(),
-                 tdigests.end(),
-                 std::back_inserter(tdigest_views),
-                 [](std::unique_ptr<table> const& t) { return t->view(); });
-  auto merged = cudf::detail::concatenate(tdigest_views, stream, mr);
-
   // generate cumulative weights
   auto merged_weights     = merged->get_column(1).view();
   auto cumulative_weights = cudf::make_numeric_column(
     data_type{type_id::FLOAT64}, merged_weights.size(), mask_state::UNALLOCATED);
-  auto keys = cudf::detail::make_counting_transform_iterator(
-    0,
-    [group_labels      = group_labels.begin(),
-     inner_offsets     = tdigest_offsets.begin<size_type>(),
-     num_inner_offsets = tdigest_offsets.size()] __device__(int index) {
-      // what -original- tdigest index this absolute index corresponds to
-      auto const iter = thrust::prev(
-        thrust::upper_bound(thrust::seq, inner_offsets, inner_offsets + num_inner_offsets, index));
-      auto const tdigest_index = thrust::distance(inner_offsets, iter);
-
-      // what group index the original tdigest belongs to
-      return group_labels[tdigest_index];
-    });
   thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
-                                keys,
-                                keys + cumulative_weights->size(),
+                                centroid_groups.begin(),
+                                centroid_groups.end(),
                                 merged_weights.begin<double>(),
                                 cumulative_weights->mutable_view().begin<double>());
 
@@ -1010,6 +970,240 @@ std::unique_ptr<column> group_merge_tdigest(column_view const& input,
                           mr);
 }
 
+namespace {
+
+// number of values sorted at once to build the tdigests of unsorted values
+constexpr size_type unsorted_tdigest_chunk_size = 1 << 22;
+// number of tdigests buffered for each group before they are merged into one
+constexpr std::size_t max_buffered_tdigests = 16;
+
+// copy the values of a chunk as doubles, with the group of each value, or -1 for skipped values
+struct copy_labeled_values {
+  template <
+    typename T,
+    typename std::enable_if_t<cudf::is_numeric<T>() || cudf::is_fixed_point<T>()>* = nullptr>
+  void operator()(column_view const& col,
+                  size_type const* group_labels,
+                  double* values,
+                  size_type* labels,
+                  rmm::cuda_stream_view stream)
+  {
+    auto d_col = cudf::column_device_view::create(col, stream);
+    thrust::transform(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator(0),
+      thrust::make_counting_iterator(0) + col.size(),
+      thrust::make_zip_iterator(thrust::make_tuple(values, labels)),
+      [col = *d_col, group_labels] __device__(size_type index) {
+        auto const label = col.is_valid(index) ? group_labels[index] : -1;
+        auto const value = label < 0 ? 0.0 : static_cast<double>(col.element<T>(index));
+        return thrust::make_tuple(value, label);
+      });
+  }
+
+  template <
+    typename T,
+    typename... Args,
+    typename std::enable_if_t<!cudf::is_numeric<T>() && !cudf::is_fixed_point<T>()>* = nullptr>
+  void operator()(Args&&...)
+  {
+    CUDF_FAIL("Non-numeric type in group_tdigest");
+  }
+};
+
+/**
+ * @brief Generate the tdigests of the groups of a chunk of unsorted values, or nullptr if no value
+ * of the chunk is valid.
+ *
+ * Two stable radix sorts, by value and then by group, produce the grouped and sorted values that
+ * `group_tdigest` expects, without a segmented sort of the chunk.
+ */
+std::unique_ptr<column> chunk_tdigest(column_view const& values,
+                                      size_type const* group_labels,
+                                      size_type num_groups,
+                                      int max_centroids,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  auto const num_values = values.size();
+  rmm::device_uvector<double> sorted_values(num_values, stream);
+  rmm::device_uvector<size_type> sorted_labels(num_values, stream);
+  cudf::type_dispatcher(values.type(),
+                        copy_labeled_values{},
+                        values,
+                        group_labels,
+                        sorted_values.data(),
+                        sorted_labels.data(),
+                        stream);
+  thrust::stable_sort_by_key(rmm::exec_policy(stream),
+                             sorted_values.begin(),
+                             sorted_values.end(),
+                             sorted_labels.begin());
+  thrust::stable_sort_by_key(rmm::exec_policy(stream),
+                             sorted_labels.begin(),
+                             sorted_labels.end(),
+                             sorted_values.begin());
+
+  // the skipped values sort first
+  auto const first_valid = static_cast<size_type>(thrust::distance(
+    sorted_labels.begin(),
+    thrust::lower_bound(rmm::exec_policy(stream), sorted_labels.begin(), sorted_labels.end(), 0)));
+  auto const num_valid = num_values - first_valid;
+  if (num_valid == 0) { return nullptr; }
+  auto const labels = cudf::device_span<size_type const>{sorted_labels.data() + first_valid,
+                                                         static_cast<std::size_t>(num_valid)};
+
+  rmm::device_uvector<size_type> group_offsets(num_groups + 1, stream);
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      labels.begin(),
+                      labels.end(),
+                      thrust::make_counting_iterator(0),
+                      thrust::make_counting_iterator(0) + num_groups + 1,
+                      group_offsets.begin());
+  rmm::device_uvector<size_type> group_valid_counts(num_groups, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    group_offsets.begin() + 1,
+                    group_offsets.end(),
+                    group_offsets.begin(),
+                    group_valid_counts.begin(),
+                    thrust::minus<size_type>{});
+
+  column_view const grouped_values(
+    data_type{type_id::FLOAT64}, num_valid, sorted_values.data() + first_valid);
+  return group_tdigest(grouped_values,
+                       group_offsets,
+                       labels,
+                       group_valid_counts,
+                       num_groups,
+                       max_centroids,
+                       stream,
+                       mr);
+}
+
+/**
+ * @brief Merge several columns of tdigests, each holding one tdigest per group, into one.
+ */
+std::unique_ptr<column> merge_chunk_tdigests(std::vector<std::unique_ptr<column>> const& tdigests,
+                                             size_type num_groups,
+                                             int max_centroids,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  std::vector<column_view> tdigest_views;
+  tdigest_views.reserve(tdigests.size());
+  std::transform(tdigests.begin(),
+                 tdigests.end(),
+                 std::back_inserter(tdigest_views),
+                 [](std::unique_ptr<column> const& col) { return col->view(); });
+  auto const concatenated = cudf::detail::concatenate(tdigest_views, stream);
+
+  // gather the tdigests of each group together: the tdigest of group g in column c is at row
+  // c * num_groups + g
+  auto const num_tdigests = static_cast<size_type>(tdigests.size());
+  auto const gather_map   = cudf::detail::make_counting_transform_iterator(
+    0, [num_groups, num_tdigests] __device__(size_type index) {
+      return (index % num_tdigests) * num_groups + index / num_tdigests;
+    });
+  auto const grouped = cudf::detail::gather(table_view({concatenated->view()}),
+                                            gather_map,
+                                            gather_map + concatenated->size(),
+                                            out_of_bounds_policy::DONT_CHECK,
+                                            stream);
+
+  rmm::device_uvector<size_type> group_offsets(num_groups + 1, stream);
+  thrust::tabulate(rmm::exec_policy(stream),
+                   group_offsets.begin(),
+                   group_offsets.end(),
+                   [num_tdigests] __device__(size_type group) { return group * num_tdigests; });
+  rmm::device_uvector<size_type> group_labels(concatenated->size(), stream);
+  thrust::tabulate(rmm::exec_policy(stream),
+                   group_labels.begin(),
+                   group_labels.end(),
+                   [num_tdigests] __device__(size_type index) { return index / num_tdigests; });
+
+  return group_merge_tdigest(grouped->get_column(0).view(),
+                             group_offsets,
+                             group_labels,
+                             num_groups,
+                             max_centroids,
+                             stream,
+                             mr);
+}
+
+// a column of num_groups empty tdigests
+std::unique_ptr<column> make_empty_tdigests(size_type num_groups,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  auto offsets = cudf::make_fixed_width_column(
+    data_type(type_id::INT32), num_groups + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::fill(rmm::exec_policy(stream),
+               offsets->mutable_view().begin<offset_type>(),
+               offsets->mutable_view().end<offset_type>(),
+               0);
+  auto min_col = cudf::make_numeric_column(
+    data_type(type_id::FLOAT64), num_groups, mask_state::UNALLOCATED, stream, mr);
+  thrust::fill(rmm::exec_policy(stream),
+               min_col->mutable_view().begin<double>(),
+               min_col->mutable_view().end<double>(),
+               0);
+  auto max_col = cudf::make_numeric_column(
+    data_type(type_id::FLOAT64), num_groups, mask_state::UNALLOCATED, stream, mr);
+  thrust::fill(rmm::exec_policy(stream),
+               max_col->mutable_view().begin<double>(),
+               max_col->mutable_view().end<double>(),
+               0);
+  return cudf::detail::tdigest::make_tdigest_column(num_groups,
+                                                    make_empty_column(type_id::FLOAT64),
+                                                    make_empty_column(type_id::FLOAT64),
+                                                    std::move(offsets),
+                                                    std::move(min_col),
+                                                    std::move(max_col),
+                                                    stream,
+                                                    mr);
+}
+
+}  // anonymous namespace
+
+std::unique_ptr<column> unsorted_group_tdigest(column_view const& values,
+                                               cudf::device_span<size_type const> group_labels,
+                                               size_type num_groups,
+                                               int max_centroids,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  if (values.size() == 0 || num_groups == 0) {
+    return cudf::detail::tdigest::make_empty_tdigest_column(stream, mr);
+  }
+
+  // a single chunk is returned as is, the tdigests of several chunks are merged at the end
+  auto const num_chunks =
+    cudf::util::div_rounding_up_safe(values.size(), unsorted_tdigest_chunk_size);
+  auto const chunk_mr = num_chunks == 1 ? mr : rmm::mr::get_current_device_resource();
+
+  std::vector<std::unique_ptr<column>> tdigests;
+  for (size_type chunk_index = 0; chunk_index < num_chunks; ++chunk_index) {
+    auto const begin = chunk_index * unsorted_tdigest_chunk_size;
+    auto const end   = begin + std::min(unsorted_tdigest_chunk_size, values.size() - begin);
+    auto const chunk = cudf::detail::slice(values, begin, end);
+    auto tdigest     = chunk_tdigest(
+      chunk, group_labels.data() + begin, num_groups, max_centroids, stream, chunk_mr);
+    if (tdigest == nullptr) { continue; }
+    tdigests.push_back(std::move(tdigest));
+
+    // compress the buffered tdigests, so that the memory used stays bounded
+    if (tdigests.size() == max_buffered_tdigests) {
+      auto merged = merge_chunk_tdigests(tdigests, num_groups, max_centroids, stream, chunk_mr);
+      tdigests.clear();
+      tdigests.push_back(std::move(merged));
+    }
+  }
+
+  if (tdigests.empty()) { return make_empty_tdigests(num_groups, stream, mr); }
+  if (num_chunks == 1) { return std::move(tdigests.front()); }
+  return merge_chunk_tdigests(tdigests, num_groups, max_centroids, stream, mr);
+}
+
 }  // namespace detail
 }  // namespace groupby
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -30,6 +30,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
 #include <memory>
 
 namespace cudf {
@@ -52,6 +53,12 @@ struct scan_result_functor final : store_result_functor {
     CUDF_FAIL("Unsupported groupby scan aggregation");
   }
 
+  /**
+   * @brief Computes and caches the RANK and DENSE_RANK aggregations of the values together, from
+   * a single comparison of their rows.
+   */
+  void rank_and_dense_rank(aggregation const& rank_agg, aggregation const& dense_rank_agg);
+
  private:
   column_view get_grouped_values()
   {
@@ -144,6 +151,22 @@ void scan_result_functor::operator()<aggregation::DENSE_RANK>(aggregation const&
     detail::dense_rank_scan(
       order_by, helper.group_labels(stream), helper.group_offsets(stream), stream, mr));
 }
+
+void scan_result_functor::rank_and_dense_rank(aggregation const& rank_agg,
+                                              aggregation const& dense_rank_agg)
+{
+  if (cache.has_result(values, rank_agg) or cache.has_result(values, dense_rank_agg)) return;
+  CUDF_EXPECTS(helper.is_presorted(),
+               "Rank aggregate in groupby scan requires the keys to be presorted");
+  auto const order_by = get_grouped_values();
+  CUDF_EXPECTS(!cudf::structs::detail::is_or_has_nested_lists(order_by),
+               "Unsupported list type in grouped rank scan.");
+
+  auto [ranks, dense_ranks] = detail::rank_and_dense_rank_scan(
+    order_by, helper.group_labels(stream), helper.group_offsets(stream), stream, mr);
+  cache.add_result(values, rank_agg, std::move(ranks));
+  cache.add_result(values, dense_rank_agg, std::move(dense_ranks));
+}
 }  // namespace detail
 
 // Sort-based groupby
@@ -160,6 +183,18 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::sort
   for (auto const& request : requests) {
     auto store_functor =
       detail::scan_result_functor(request.values, helper(), cache, stream, mr, _keys_are_sorted);
+    // Ranks and dense ranks of the same values share the comparison of their rows
+    auto const find_kind = [&request](aggregation::Kind kind) {
+      return std::find_if(request.aggregations.begin(),
+                          request.aggregations.end(),
+                          [kind](auto const& agg) { return agg->kind == kind; });
+    };
+    auto const rank_agg       = find_kind(aggregation::RANK);
+    auto const dense_rank_agg = find_kind(aggregation::DENSE_RANK);
+    if (rank_agg != request.aggregations.end() and
+        dense_rank_agg != request.aggregations.end()) {
+      store_functor.rank_and_dense_rank(**rank_agg, **dense_rank_agg);
+    }
     for (auto const& aggregation : request.aggregations) {
       // TODO (dm): single pass compute all supported reductions
       cudf::detail::aggregation_dispatcher(aggregation->kind, store_functor, *aggregation);
@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.cuh>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/groupby.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <cub/device/device_segmented_reduce.cuh>
+
+#include <algorithm>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace segmented {
+namespace {
+
+/**
+ * @brief Returns whether `kind` is computed by a segmented reduction of the values of each group.
+ */
+bool is_segmented_reduction(aggregation::Kind kind)
+{
+  return kind == aggregation::SUM or kind == aggregation::PRODUCT or kind == aggregation::MIN or
+         kind == aggregation::MAX or kind == aggregation::MEAN;
+}
+
+template <typename T>
+constexpr bool is_segmented_reduction_type()
+{
+  return std::is_arithmetic_v<T> and not std::is_same_v<T, bool>;
+}
+
+/**
+ * @brief Device functor returning the value of a row as the result type of the reduction, or the
+ * identity of the reduction for a null row.
+ */
+template <typename T, typename ResultType>
+struct null_replaced_result_fn {
+  column_device_view d_values;
+  ResultType identity;
+
+  __device__ ResultType operator()(size_type i) const noexcept
+  {
+    return d_values.is_valid(i) ? static_cast<ResultType>(d_values.element<T>(i)) : identity;
+  }
+};
+
+/**
+ * @brief Computes an aggregation of each group of contiguous rows with a segmented reduction.
+ */
+template <aggregation::Kind K>
+struct segmented_reduce_fn {
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_segmented_reduction_type<T>(), std::unique_ptr<column>> operator()(
+    Args&&...)
+  {
+    CUDF_FAIL("Unsupported type for a segmented groupby reduction");
+  }
+
+  template <typename T>
+  std::enable_if_t<is_segmented_reduction_type<T>(), std::unique_ptr<column>> operator()(
+    column_view const& values,
+    device_span<size_type const> offsets,
+    device_span<size_type const> valid_counts,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr)
+  {
+    using ResultType = cudf::detail::target_type_t<T, K>;
+    using OpType     = cudf::detail::corresponding_operator_t<K>;
+
+    auto const num_groups = static_cast<size_type>(offsets.size() - 1);
+    auto result           = make_fixed_width_column(
+      data_type{type_to_id<ResultType>()}, num_groups, mask_state::UNALLOCATED, stream, mr);
+    auto const d_result = result->mutable_view().template begin<ResultType>();
+
+    auto const d_values = column_device_view::create(values, stream);
+    auto const identity = OpType::template identity<ResultType>();
+    auto const input    = cudf::detail::make_counting_transform_iterator(
+      0, null_replaced_result_fn<T, ResultType>{*d_values, identity});
+
+    std::size_t temp_storage_bytes = 0;
+    CUDA_TRY(cub::DeviceSegmentedReduce::Reduce(nullptr,
+                                                temp_storage_bytes,
+                                                input,
+                                                d_result,
+                                                num_groups,
+                                                offsets.begin(),
+                                                offsets.begin() + 1,
+                                                OpType{},
+                                                identity,
+                                                stream.value()));
+    rmm::device_buffer temp_storage(temp_storage_bytes, stream);
+    CUDA_TRY(cub::DeviceSegmentedReduce::Reduce(temp_storage.data(),
+                                                temp_storage_bytes,
+                                                input,
+                                                d_result,
+                                                num_groups,
+                                                offsets.begin(),
+                                                offsets.begin() + 1,
+                                                OpType{},
+                                                identity,
+                                                stream.value()));
+
+    if constexpr (K == aggregation::MEAN) {
+      thrust::transform(rmm::exec_policy(stream),
+                        d_result,
+                        d_result + num_groups,
+                        valid_counts.begin(),
+                        d_result,
+                        [] __device__(ResultType sum, size_type count) {
+                          return count > 0 ? sum / count : sum;
+                        });
+    }
+
+    if (values.has_nulls()) {
+      auto [null_mask, null_count] = cudf::detail::valid_if(
+        valid_counts.begin(),
+        valid_counts.end(),
+        [] __device__(size_type count) { return count > 0; },
+        stream,
+        mr);
+      result->set_null_mask(std::move(null_mask), null_count);
+    }
+    return result;
+  }
+};
+
+/**
+ * @brief Returns the offsets of the groups of equal contiguous rows of `keys` followed by the
+ * number of rows, by comparing every row with the previous one.
+ */
+rmm::device_uvector<size_type> group_offsets(table_view const& keys, rmm::cuda_stream_view stream)
+{
+  auto const num_rows = keys.num_rows();
+  auto const d_keys   = table_device_view::create(keys, stream);
+  row_equality_comparator<nullate::DYNAMIC> const equal{
+    nullate::DYNAMIC{has_nulls(keys)}, *d_keys, *d_keys, null_equality::EQUAL};
+
+  rmm::device_uvector<size_type> offsets(num_rows + 1, stream);
+  auto const end = thrust::copy_if(rmm::exec_policy(stream),
+                                   thrust::make_counting_iterator<size_type>(0),
+                                   thrust::make_counting_iterator<size_type>(num_rows),
+                                   offsets.begin(),
+                                   [equal] __device__(size_type i) {
+                                     return i == 0 or not equal(i, i - 1);
+                                   });
+  auto const num_groups = static_cast<std::size_t>(thrust::distance(offsets.begin(), end));
+  offsets.set_element(num_groups, num_rows, stream);
+  offsets.resize(num_groups + 1, stream);
+  return offsets;
+}
+
+/**
+ * @brief Returns the number of valid values of each group of `values`.
+ */
+rmm::device_uvector<size_type> group_valid_counts(column_view const& values,
+                                                  device_span<size_type const> offsets,
+                                                  rmm::cuda_stream_view stream)
+{
+  auto const num_groups = static_cast<size_type>(offsets.size() - 1);
+  rmm::device_uvector<size_type> counts(num_groups, stream);
+  if (not values.has_nulls()) {
+    thrust::transform(rmm::exec_policy(stream),
+                      offsets.begin() + 1,
+                      offsets.end(),
+                      offsets.begin(),
+                      counts.begin(),
+                      thrust::minus<size_type>{});
+    return counts;
+  }
+
+  auto const d_values = column_device_view::create(values, stream);
+  auto const valid    = cudf::detail::make_counting_transform_iterator(
+    0, [d_values = *d_values] __device__(size_type i) -> size_type {
+      return d_values.is_valid(i);
+    });
+  std::size_t temp_storage_bytes = 0;
+  CUDA_TRY(cub::DeviceSegmentedReduce::Sum(nullptr,
+                                           temp_storage_bytes,
+                                           valid,
+                                           counts.begin(),
+                                           num_groups,
+                                           offsets.begin(),
+                                           offsets.begin() + 1,
+                                           stream.value()));
+  rmm::device_buffer temp_storage(temp_storage_bytes, stream);
+  CUDA_TRY(cub::DeviceSegmentedReduce::Sum(temp_storage.data(),
+                                           temp_storage_bytes,
+                                           valid,
+                                           counts.begin(),
+                                           num_groups,
+                                           offsets.begin(),
+                                           offsets.begin() + 1,
+                                           stream.value()));
+  return counts;
+}
+
+}  // namespace
+
+bool can_use_segmented_groupby(table_view const& keys,
+                               host_span<aggregation_request const> requests,
+                               null_policy include_null_keys)
+{
+  // Rows with null keys would have to be filtered out first
+  if (include_null_keys == null_policy::EXCLUDE and has_nulls(keys)) { return false; }
+  auto const keys_supported = std::all_of(keys.begin(), keys.end(), [](auto const& col) {
+    return cudf::is_equality_comparable(col.type()) and not cudf::is_nested(col.type()) and
+           not cudf::is_dictionary(col.type());
+  });
+  return keys_supported and std::all_of(requests.begin(), requests.end(), [](auto const& r) {
+           auto const type                = r.values.type();
+           auto const reduction_supported = cudf::is_numeric(type) and type.id() != type_id::BOOL8;
+           return std::all_of(
+             r.aggregations.begin(), r.aggregations.end(), [&](auto const& agg) {
+               return agg->kind == aggregation::COUNT_VALID or
+                      agg->kind == aggregation::COUNT_ALL or
+                      (is_segmented_reduction(agg->kind) and reduction_supported);
+             });
+         });
+}
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
+  table_view const& keys,
+  host_span<aggregation_request const> requests,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const offsets    = group_offsets(dictionary::detail::indices_view(keys), stream);
+  auto const num_groups = static_cast<size_type>(offsets.size() - 1);
+
+  std::vector<aggregation_result> results(requests.size());
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    auto const& values      = requests[i].values;
+    auto const valid_counts = group_valid_counts(values, offsets, stream);
+    for (auto const& agg : requests[i].aggregations) {
+      auto& result = results[i].results;
+      switch (agg->kind) {
+        case aggregation::COUNT_VALID:
+          result.push_back(std::make_unique<column>(
+            data_type{type_to_id<size_type>()},
+            num_groups,
+            rmm::device_buffer{
+              valid_counts.data(), valid_counts.size() * sizeof(size_type), stream, mr}));
+          break;
+        case aggregation::COUNT_ALL: {
+          rmm::device_uvector<size_type> counts(num_groups, stream, mr);
+          thrust::transform(rmm::exec_policy(stream),
+                            offsets.begin() + 1,
+                            offsets.end(),
+                            offsets.begin(),
+                            counts.begin(),
+                            thrust::minus<size_type>{});
+          result.push_back(std::make_unique<column>(
+            data_type{type_to_id<size_type>()}, num_groups, counts.release()));
+          break;
+        }
+        case aggregation::SUM:
+          result.push_back(type_dispatcher(values.type(),
+                                           segmented_reduce_fn<aggregation::SUM>{},
+                                           values,
+                                           offsets,
+                                           valid_counts,
+                                           stream,
+                                           mr));
+          break;
+        case aggregation::PRODUCT:
+          result.push_back(type_dispatcher(values.type(),
+                                           segmented_reduce_fn<aggregation::PRODUCT>{},
+                                           values,
+                                           offsets,
+                                           valid_counts,
+                                           stream,
+                                           mr));
+          break;
+        case aggregation::MIN:
+          result.push_back(type_dispatcher(values.type(),
+                                           segmented_reduce_fn<aggregation::MIN>{},
+                                           values,
+                                           offsets,
+                                           valid_counts,
+                                           stream,
+                                           mr));
+          break;
+        case aggregation::MAX:
+          result.push_back(type_dispatcher(values.type(),
+                                           segmented_reduce_fn<aggregation::MAX>{},
+                                           values,
+                                           offsets,
+                                           valid_counts,
+                                           stream,
+                                           mr));
+          break;
+        case aggregation::MEAN:
+          result.push_back(type_dispatcher(values.type(),
+                                           segmented_reduce_fn<aggregation::MEAN>{},
+                                           values,
+                                           offsets,
+                                           valid_counts,
+                                           stream,
+                                           mr));
+          break;
+        default: CUDF_FAIL("Unsupported aggregation in a segmented groupby");
+      }
+    }
+  }
+
+  // The unique keys are the first rows of the groups
+  auto unique_keys = cudf::detail::gather(keys,
+                                          offsets.begin(),
+                                          offsets.begin() + num_groups,
+                                          out_of_bounds_policy::DONT_CHECK,
+                                          stream,
+                                          mr);
+  return std::make_pair(std::move(unique_keys), std::move(results));
+}
+
+}  // namespace segmented
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -24,6 +24,7 @@
 #include <cudf/detail/scatter.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/structs/utilities.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/strings/string_view.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
@@ -103,7 +104,8 @@ sort_groupby_helper::sort_groupby_helper(table_view const& keys,
   using namespace cudf::structs::detail;
 
   _flattened                 = flatten_nested_columns(keys, {}, {}, column_nullability::FORCE);
-  _keys                      = _flattened;
+  // the keys are only sorted and compared, so dictionary keys are grouped by their indices
+  _keys                      = dictionary::detail::indices_view(_flattened);
   auto is_supported_key_type = [](auto col) { return cudf::is_equality_comparable(col.type()); };
   CUDF_EXPECTS(std::all_of(_keys.begin(), _keys.end(), is_supported_key_type),
                "Unsupported groupby key type does not support equality comparison");
@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/unary.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace {
+
+/**
+ * @brief Returns whether the partial results of `kind` are the (COUNT_VALID, MEAN, M2) structs
+ * merged by MERGE_M2.
+ */
+bool is_m2_based(aggregation::Kind kind)
+{
+  return kind == aggregation::MEAN or kind == aggregation::M2 or kind == aggregation::VARIANCE or
+         kind == aggregation::STD;
+}
+
+/**
+ * @brief Returns the aggregation merging the partial results of `agg`.
+ */
+std::unique_ptr<groupby_aggregation> make_merge_aggregation(groupby_aggregation const& agg)
+{
+  switch (agg.kind) {
+    case aggregation::SUM:
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL: return make_sum_aggregation<groupby_aggregation>();
+    case aggregation::PRODUCT: return make_product_aggregation<groupby_aggregation>();
+    case aggregation::MIN: return make_min_aggregation<groupby_aggregation>();
+    case aggregation::MAX: return make_max_aggregation<groupby_aggregation>();
+    case aggregation::MEAN:
+    case aggregation::M2:
+    case aggregation::VARIANCE:
+    case aggregation::STD: return make_merge_m2_aggregation<groupby_aggregation>();
+    case aggregation::COLLECT_LIST: return make_merge_lists_aggregation<groupby_aggregation>();
+    case aggregation::COLLECT_SET: {
+      auto const& collect = dynamic_cast<cudf::detail::collect_set_aggregation const&>(agg);
+      return make_merge_sets_aggregation<groupby_aggregation>(collect._nulls_equal,
+                                                              collect._nans_equal);
+    }
+    case aggregation::TDIGEST: {
+      auto const& tdigest = dynamic_cast<cudf::detail::tdigest_aggregation const&>(agg);
+      return make_merge_tdigest_aggregation<groupby_aggregation>(tdigest.max_centroids);
+    }
+    case aggregation::HLL:
+      return make_merge_hll_aggregation<groupby_aggregation>(
+        dynamic_cast<cudf::detail::hll_aggregation const&>(agg).precision);
+    case aggregation::MERGE_HLL:
+      return make_merge_hll_aggregation<groupby_aggregation>(
+        dynamic_cast<cudf::detail::merge_hll_aggregation const&>(agg).precision);
+    case aggregation::APPROX_NUNIQUE:
+      return make_merge_hll_aggregation<groupby_aggregation>(
+        dynamic_cast<cudf::detail::approx_nunique_aggregation const&>(agg).precision);
+    default: CUDF_FAIL("Unsupported aggregation in streaming groupby");
+  }
+}
+
+/**
+ * @brief Returns the variance of the groups of the merged (COUNT_VALID, MEAN, M2) structs
+ * `partial`, which is null where the number of valid values is not larger than `ddof`.
+ */
+std::unique_ptr<column> variance_from_m2(structs_column_view const& partial,
+                                         size_type ddof,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  auto const counts       = cudf::cast(partial.get_sliced_child(0), data_type{type_id::FLOAT64});
+  auto const denominators = cudf::binary_operation(*counts,
+                                                   numeric_scalar<double>(ddof),
+                                                   binary_operator::SUB,
+                                                   data_type{type_id::FLOAT64});
+  auto const variances    = cudf::binary_operation(
+    partial.get_sliced_child(2), *denominators, binary_operator::DIV, data_type{type_id::FLOAT64});
+  auto const valid = cudf::binary_operation(
+    *denominators, numeric_scalar<double>(0), binary_operator::GREATER, data_type{type_id::BOOL8});
+  return cudf::copy_if_else(*variances, numeric_scalar<double>(0, false), *valid, mr);
+}
+
+}  // namespace
+
+struct streaming_groupby::streaming_groupby_impl {
+  std::vector<size_type> const _key_columns;
+  std::vector<streaming_aggregation_request> const _requests;
+  null_policy const _null_handling;
+
+  // Unique keys of the groups of the batches so far, followed by one column of partial results
+  // per aggregation of the requests
+  std::unique_ptr<table> _state;
+
+  streaming_groupby_impl(std::vector<size_type> key_columns,
+                         std::vector<streaming_aggregation_request>&& requests,
+                         null_policy null_handling)
+    : _key_columns{std::move(key_columns)},
+      _requests{std::move(requests)},
+      _null_handling{null_handling}
+  {
+    CUDF_EXPECTS(not _key_columns.empty(), "Streaming groupby requires at least one key column");
+    for (auto const& request : _requests) {
+      for (auto const& agg : request.aggregations) {
+        make_merge_aggregation(*agg);
+      }
+    }
+  }
+
+  /**
+   * @brief Aggregates `batch` into one column of partial results per aggregation, following the
+   * unique keys of the batch.
+   */
+  std::unique_ptr<table> aggregate_batch(table_view const& batch) const
+  {
+    std::vector<aggregation_request> requests;
+    for (auto const& request : _requests) {
+      CUDF_EXPECTS(request.values >= 0 and request.values < batch.num_columns(),
+                   "Values column index out of range of the batch");
+      requests.emplace_back();
+      requests.back().values = batch.column(request.values);
+      for (auto const& agg : request.aggregations) {
+        if (is_m2_based(agg->kind)) {
+          requests.back().aggregations.push_back(make_count_aggregation<groupby_aggregation>());
+          requests.back().aggregations.push_back(make_mean_aggregation<groupby_aggregation>());
+          requests.back().aggregations.push_back(make_m2_aggregation<groupby_aggregation>());
+        } else if (agg->kind == aggregation::APPROX_NUNIQUE) {
+          // The sketches are merged across the batches, and only estimated by `finalize`
+          auto const precision =
+            dynamic_cast<cudf::detail::approx_nunique_aggregation const&>(*agg).precision;
+          requests.back().aggregations.push_back(
+            make_hll_aggregation<groupby_aggregation>(precision));
+        } else {
+          requests.back().aggregations.emplace_back(
+            dynamic_cast<groupby_aggregation*>(agg->clone().release()));
+        }
+      }
+    }
+
+    cudf::groupby::groupby gb_obj(batch.select(_key_columns), _null_handling);
+    auto [keys, results] = gb_obj.aggregate(requests);
+    auto const num_groups = keys->num_rows();
+
+    auto columns = keys->release();
+    for (std::size_t i = 0; i < _requests.size(); ++i) {
+      auto partial = results[i].results.begin();
+      for (auto const& agg : _requests[i].aggregations) {
+        if (is_m2_based(agg->kind)) {
+          std::vector<std::unique_ptr<column>> children(3);
+          std::move(partial, partial + 3, children.begin());
+          partial += 3;
+          columns.push_back(
+            make_structs_column(num_groups, std::move(children), 0, rmm::device_buffer{}));
+        } else if (agg->kind == aggregation::COUNT_VALID or agg->kind == aggregation::COUNT_ALL) {
+          // The counts are merged with SUM, whose results are 64-bit
+          columns.push_back(cudf::cast(**partial++, data_type{type_id::INT64}));
+        } else {
+          columns.push_back(std::move(*partial++));
+        }
+      }
+    }
+    return std::make_unique<table>(std::move(columns));
+  }
+
+  void update(table_view const& batch)
+  {
+    if (_state and batch.num_rows() == 0) { return; }
+    auto partial = aggregate_batch(batch);
+    if (not _state) {
+      _state = std::move(partial);
+      return;
+    }
+    CUDF_EXPECTS(partial->num_columns() == _state->num_columns(),
+                 "Mismatch in number of columns of the batches");
+
+    std::vector<table_view> const tables{_state->view(), partial->view()};
+    auto const merged = cudf::concatenate(tables);
+
+    // The batches have been grouped already, so that null keys are only left when included
+    auto const num_keys = static_cast<size_type>(_key_columns.size());
+    std::vector<size_type> key_indices(num_keys);
+    std::iota(key_indices.begin(), key_indices.end(), 0);
+    std::vector<aggregation_request> requests;
+    auto column_index = num_keys;
+    for (auto const& request : _requests) {
+      for (auto const& agg : request.aggregations) {
+        requests.emplace_back();
+        requests.back().values = merged->get_column(column_index++).view();
+        requests.back().aggregations.push_back(make_merge_aggregation(*agg));
+      }
+    }
+
+    cudf::groupby::groupby gb_obj(merged->select(key_indices), null_policy::INCLUDE);
+    auto [keys, results] = gb_obj.aggregate(requests);
+    auto columns         = keys->release();
+    for (auto& result : results) {
+      columns.push_back(std::move(result.results.front()));
+    }
+    _state = std::make_unique<table>(std::move(columns));
+  }
+
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> finalize(
+    rmm::mr::device_memory_resource* mr) const
+  {
+    CUDF_EXPECTS(_state != nullptr, "Streaming groupby requires at least one batch");
+
+    auto const num_keys = static_cast<size_type>(_key_columns.size());
+    std::vector<size_type> key_indices(num_keys);
+    std::iota(key_indices.begin(), key_indices.end(), 0);
+    auto keys = std::make_unique<table>(_state->select(key_indices), rmm::cuda_stream_default, mr);
+
+    std::vector<aggregation_result> results(_requests.size());
+    auto column_index = num_keys;
+    for (std::size_t i = 0; i < _requests.size(); ++i) {
+      for (auto const& agg : _requests[i].aggregations) {
+        auto const partial = _state->get_column(column_index++).view();
+        auto& result       = results[i].results;
+        switch (agg->kind) {
+          case aggregation::COUNT_VALID:
+          case aggregation::COUNT_ALL:
+            result.push_back(cudf::cast(partial, data_type{type_to_id<size_type>()}, mr));
+            break;
+          case aggregation::MEAN:
+          case aggregation::M2:
+            result.push_back(std::make_unique<column>(
+              structs_column_view(partial).get_sliced_child(agg->kind == aggregation::MEAN ? 1 : 2),
+              rmm::cuda_stream_default,
+              mr));
+            break;
+          case aggregation::VARIANCE:
+          case aggregation::STD: {
+            auto const ddof = dynamic_cast<cudf::detail::std_var_aggregation const&>(*agg)._ddof;
+            if (agg->kind == aggregation::VARIANCE) {
+              result.push_back(variance_from_m2(structs_column_view(partial), ddof, mr));
+            } else {
+              auto const variances = variance_from_m2(structs_column_view(partial), ddof, mr);
+              result.push_back(cudf::unary_operation(*variances, unary_operator::SQRT, mr));
+            }
+            break;
+          }
+          case aggregation::APPROX_NUNIQUE:
+            result.push_back(cudf::hll_distinct_count(partial, mr));
+            break;
+          default:
+            result.push_back(std::make_unique<column>(partial, rmm::cuda_stream_default, mr));
+        }
+      }
+    }
+    return std::make_pair(std::move(keys), std::move(results));
+  }
+};
+
+streaming_groupby::~streaming_groupby() = default;
+
+streaming_groupby::streaming_groupby(std::vector<size_type> key_columns,
+                                     std::vector<streaming_aggregation_request>&& requests,
+                                     null_policy null_handling)
+  : impl{std::make_unique<streaming_groupby_impl>(
+      std::move(key_columns), std::move(requests), null_handling)}
+{
+}
+
+void streaming_groupby::update(table_view const& batch)
+{
+  CUDF_FUNC_RANGE();
+  impl->update(batch);
+}
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> streaming_groupby::finalize(
+  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->finalize(mr);
+}
+
+}  // namespace groupby
+}  // namespace cudf
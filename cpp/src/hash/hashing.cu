@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -86,6 +86,30 @@ std::unique_ptr<column> serial_murmur_hash3_32(table_view const& input,
   return output;
 }
 
+template <template <typename> class hash_function>
+std::unique_ptr<column> row_hash_64(table_view const& input,
+                                    uint32_t seed,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  auto output = make_numeric_column(
+    data_type(type_id::INT64), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
+
+  if (input.num_columns() == 0 || input.num_rows() == 0) { return output; }
+
+  table_view const leaf_table(to_leaf_columns(input.begin(), input.end()));
+  auto const device_input = table_device_view::create(leaf_table, stream);
+  auto output_view        = output->mutable_view();
+
+  thrust::tabulate(rmm::exec_policy(stream),
+                   output_view.begin<int64_t>(),
+                   output_view.end<int64_t>(),
+                   row_hasher<hash_function, nullate::DYNAMIC>(
+                     nullate::DYNAMIC{has_nulls(leaf_table)}, *device_input, seed));
+
+  return output;
+}
+
 std::unique_ptr<column> hash(table_view const& input,
                              hash_id hash_function,
                              uint32_t seed,
@@ -95,10 +119,14 @@ std::unique_ptr<column> hash(table_view const& input,
   switch (hash_function) {
     case (hash_id::HASH_MURMUR3): return murmur_hash3_32(input, stream, mr);
     case (hash_id::HASH_MD5): return md5_hash(input, stream, mr);
+    case (hash_id::HASH_SHA1): return sha1_hash(input, stream, mr);
+    case (hash_id::HASH_SHA256): return sha256_hash(input, stream, mr);
     case (hash_id::HASH_SERIAL_MURMUR3):
       return serial_murmur_hash3_32<MurmurHash3_32>(input, seed, stream, mr);
     case (hash_id::HASH_SPARK_MURMUR3):
       return serial_murmur_hash3_32<SparkMurmurHash3_32>(input, seed, stream, mr);
+    case (hash_id::HASH_XXHASH64): return row_hash_64<XXHash_64>(input, seed, stream, mr);
+    case (hash_id::HASH_MURMUR3_64): return row_hash_64<MurmurHash3_64>(input, seed, stream, mr);
     default: return nullptr;
   }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,11 +16,14 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/hashing.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/string_view.hpp>
+#include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/traits.hpp>
 
@@ -30,7 +33,9 @@
 #include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
 
+#include <algorithm>
 #include <iterator>
+#include <numeric>
 
 namespace cudf {
 
@@ -55,15 +60,34 @@ const __constant__ uint32_t md5_hash_constants[64] = {
   0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391,
 };
 
+// The SHA-256 hash constants are officially specified in FIPS 180-4:
+// https://csrc.nist.gov/publications/detail/fips/180/4/final
+const __constant__ uint32_t sha256_hash_constants[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+// Rows of string columns averaging at least this many bytes are hashed by the warp-cooperative
+// kernel, which loads their bytes coalesced
+constexpr size_type BYTES_PER_ROW_THRESHOLD = 128;
+// Number of warps per block of the warp-cooperative kernel
+constexpr size_type WARPS_PER_BLOCK = 8;
+
 template <int capacity, typename hash_step_callable>
 struct hash_circular_buffer {
-  uint8_t storage[capacity];
+  uint8_t* storage;
   uint8_t* cur;
   int available_space{capacity};
   hash_step_callable hash_step;
 
-  __device__ inline hash_circular_buffer(hash_step_callable hash_step)
-    : cur{storage}, hash_step{hash_step}
+  __device__ inline hash_circular_buffer(uint8_t* storage, hash_step_callable hash_step)
+    : storage{storage}, cur{storage}, hash_step{hash_step}
   {
   }
 
@@ -88,6 +112,21 @@ struct hash_circular_buffer {
     available_space -= size;
   }
 
+  /**
+   * @brief Accounts for `size <= available_space` bytes that were copied to `cur` by other
+   * threads, triggering a hash step if they fill the buffer.
+   */
+  __device__ inline void advance(int size)
+  {
+    cur += size;
+    available_space -= size;
+    if (available_space == 0) {
+      hash_step(storage);
+      cur             = storage;
+      available_space = capacity;
+    }
+  }
+
   __device__ inline void pad(int const space_to_leave)
   {
     if (space_to_leave > available_space) {
@@ -121,38 +160,296 @@ auto __device__ inline get_element_pointer_and_size(string_view const& element)
   return thrust::make_pair(reinterpret_cast<uint8_t const*>(element.data()), element.size_bytes());
 }
 
-struct MD5Hasher {
+// Reads the big-endian 32-bit word at `data`, which does not need to be aligned.
+uint32_t __device__ inline load_big_endian(uint8_t const* data)
+{
+  uint32_t word;
+  memcpy(&word, data, sizeof(word));
+  return __byte_perm(word, 0, 0x0123);
+}
+
+/**
+ * @brief Core MD5 algorithm implementation. Processes a single 64-byte chunk,
+ * updating the hash value so far. Does not zero out the buffer contents.
+ */
+struct md5_hash_step {
+  uint32_t (&hash_values)[4];
+
+  void __device__ inline operator()(uint8_t const* buffer)
+  {
+    uint32_t A = hash_values[0];
+    uint32_t B = hash_values[1];
+    uint32_t C = hash_values[2];
+    uint32_t D = hash_values[3];
+
+    for (int j = 0; j < 64; j++) {
+      uint32_t F;
+      uint32_t g;
+      // No default case is needed because j < 64. j / 16 is always 0, 1, 2, or 3.
+      switch (j / 16) {
+        case 0:
+          F = (B & C) | ((~B) & D);
+          g = j;
+          break;
+        case 1:
+          F = (D & B) | ((~D) & C);
+          g = (5 * j + 1) % 16;
+          break;
+        case 2:
+          F = B ^ C ^ D;
+          g = (3 * j + 5) % 16;
+          break;
+        case 3:
+          F = C ^ (B | (~D));
+          g = (7 * j) % 16;
+          break;
+      }
+
+      uint32_t buffer_element_as_int;
+      memcpy(&buffer_element_as_int, &buffer[g * 4], 4);
+      F = F + A + md5_hash_constants[j] + buffer_element_as_int;
+      A = D;
+      D = C;
+      C = B;
+      B = B + __funnelshift_l(F, F, md5_shift_constants[((j / 16) * 4) + (j % 4)]);
+    }
+
+    hash_values[0] += A;
+    hash_values[1] += B;
+    hash_values[2] += C;
+    hash_values[3] += D;
+  }
+};
+
+/**
+ * @brief Core SHA-1 algorithm implementation. Processes a single 64-byte chunk, updating the
+ * hash value so far, with the message schedule computed in place over 16 words.
+ */
+struct sha1_hash_step {
+  uint32_t (&hash_values)[5];
+
+  void __device__ inline operator()(uint8_t const* buffer)
+  {
+    uint32_t words[16];
+    for (int t = 0; t < 16; t++) {
+      words[t] = load_big_endian(buffer + t * 4);
+    }
+
+    uint32_t A = hash_values[0];
+    uint32_t B = hash_values[1];
+    uint32_t C = hash_values[2];
+    uint32_t D = hash_values[3];
+    uint32_t E = hash_values[4];
+
+    for (int t = 0; t < 80; t++) {
+      if (t >= 16) {
+        auto const word = words[(t - 3) & 15] ^ words[(t - 8) & 15] ^ words[(t - 14) & 15] ^
+                          words[t & 15];
+        words[t & 15] = __funnelshift_l(word, word, 1);
+      }
+      uint32_t F;
+      uint32_t K;
+      // No default case is needed because t < 80. t / 20 is always 0, 1, 2, or 3.
+      switch (t / 20) {
+        case 0:
+          F = (B & C) | ((~B) & D);
+          K = 0x5a827999;
+          break;
+        case 1:
+          F = B ^ C ^ D;
+          K = 0x6ed9eba1;
+          break;
+        case 2:
+          F = (B & C) | (B & D) | (C & D);
+          K = 0x8f1bbcdc;
+          break;
+        case 3:
+          F = B ^ C ^ D;
+          K = 0xca62c1d6;
+          break;
+      }
+      uint32_t const temp = __funnelshift_l(A, A, 5) + F + E + K + words[t & 15];
+      E                   = D;
+      D                   = C;
+      C                   = __funnelshift_l(B, B, 30);
+      B                   = A;
+      A                   = temp;
+    }
+
+    hash_values[0] += A;
+    hash_values[1] += B;
+    hash_values[2] += C;
+    hash_values[3] += D;
+    hash_values[4] += E;
+  }
+};
+
+/**
+ * @brief Core SHA-256 algorithm implementation. Processes a single 64-byte chunk, updating the
+ * hash value so far, with the message schedule computed in place over 16 words.
+ */
+struct sha256_hash_step {
+  uint32_t (&hash_values)[8];
+
+  void __device__ inline operator()(uint8_t const* buffer)
+  {
+    uint32_t words[16];
+    for (int t = 0; t < 16; t++) {
+      words[t] = load_big_endian(buffer + t * 4);
+    }
+
+    auto const rotr = [](uint32_t x, int n) { return __funnelshift_r(x, x, n); };
+
+    uint32_t a = hash_values[0];
+    uint32_t b = hash_values[1];
+    uint32_t c = hash_values[2];
+    uint32_t d = hash_values[3];
+    uint32_t e = hash_values[4];
+    uint32_t f = hash_values[5];
+    uint32_t g = hash_values[6];
+    uint32_t h = hash_values[7];
+
+    for (int t = 0; t < 64; t++) {
+      if (t >= 16) {
+        auto const w15 = words[(t - 15) & 15];
+        auto const w2  = words[(t - 2) & 15];
+        auto const s0  = rotr(w15, 7) ^ rotr(w15, 18) ^ (w15 >> 3);
+        auto const s1  = rotr(w2, 17) ^ rotr(w2, 19) ^ (w2 >> 10);
+        words[t & 15] += s0 + words[(t - 7) & 15] + s1;
+      }
+      auto const S1    = rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25);
+      auto const ch    = (e & f) ^ ((~e) & g);
+      auto const temp1 = h + S1 + ch + sha256_hash_constants[t] + words[t & 15];
+      auto const S0    = rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22);
+      auto const maj   = (a & b) ^ (a & c) ^ (b & c);
+      h                = g;
+      g                = f;
+      f                = e;
+      e                = d + temp1;
+      d                = c;
+      c                = b;
+      b                = a;
+      a                = temp1 + S0 + maj;
+    }
+
+    hash_values[0] += a;
+    hash_values[1] += b;
+    hash_values[2] += c;
+    hash_values[3] += d;
+    hash_values[4] += e;
+    hash_values[5] += f;
+    hash_values[6] += g;
+    hash_values[7] += h;
+  }
+};
+
+struct md5_algorithm {
+  using hash_step                           = md5_hash_step;
+  static constexpr int num_hash_values      = 4;
+  static constexpr bool big_endian          = false;
+  static constexpr char const* empty_digest = "d41d8cd98f00b204e9800998ecf8427e";
+
+  static void __device__ inline initialize(uint32_t (&hash_values)[num_hash_values])
+  {
+    hash_values[0] = 0x67452301;
+    hash_values[1] = 0xefcdab89;
+    hash_values[2] = 0x98badcfe;
+    hash_values[3] = 0x10325476;
+  }
+};
+
+struct sha1_algorithm {
+  using hash_step                           = sha1_hash_step;
+  static constexpr int num_hash_values      = 5;
+  static constexpr bool big_endian          = true;
+  static constexpr char const* empty_digest = "da39a3ee5e6b4b0d3255bfef95601890afd80709";
+
+  static void __device__ inline initialize(uint32_t (&hash_values)[num_hash_values])
+  {
+    hash_values[0] = 0x67452301;
+    hash_values[1] = 0xefcdab89;
+    hash_values[2] = 0x98badcfe;
+    hash_values[3] = 0x10325476;
+    hash_values[4] = 0xc3d2e1f0;
+  }
+};
+
+struct sha256_algorithm {
+  using hash_step                           = sha256_hash_step;
+  static constexpr int num_hash_values      = 8;
+  static constexpr bool big_endian          = true;
+  static constexpr char const* empty_digest =
+    "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+
+  static void __device__ inline initialize(uint32_t (&hash_values)[num_hash_values])
+  {
+    hash_values[0] = 0x6a09e667;
+    hash_values[1] = 0xbb67ae85;
+    hash_values[2] = 0x3c6ef372;
+    hash_values[3] = 0xa54ff53a;
+    hash_values[4] = 0x510e527f;
+    hash_values[5] = 0x9b05688c;
+    hash_values[6] = 0x1f83d9ab;
+    hash_values[7] = 0x5be0cd19;
+  }
+};
+
+/**
+ * @brief Hashes the elements of a row into the 64-byte message chunks of an MD5 or SHA
+ * algorithm.
+ *
+ * @tparam hash_algorithm One of `md5_algorithm`, `sha1_algorithm` or `sha256_algorithm`
+ */
+template <typename hash_algorithm>
+struct MessageHasher {
   static constexpr int message_chunk_size = 64;
+  // Number of hexadecimal characters of the digest
+  static constexpr int digest_size = hash_algorithm::num_hash_values * 8;
+  using hash_step                  = typename hash_algorithm::hash_step;
 
-  __device__ inline MD5Hasher(char* result_location)
-    : result_location(result_location), buffer(md5_hash_step{hash_values})
+  /**
+   * @param chunk_storage The `message_chunk_size` bytes of memory holding the message chunk
+   */
+  __device__ inline MessageHasher(uint8_t* chunk_storage)
+    : buffer(chunk_storage, hash_step{hash_values})
   {
+    hash_algorithm::initialize(hash_values);
   }
 
-  __device__ inline ~MD5Hasher()
+  MessageHasher(const MessageHasher&) = delete;
+  MessageHasher& operator=(const MessageHasher&) = delete;
+  MessageHasher(MessageHasher&&)                 = delete;
+  MessageHasher& operator=(MessageHasher&&) = delete;
+
+  /**
+   * @brief Finalizes the message buffer and writes out the hexadecimal hash value to
+   * `result_location`.
+   */
+  void __device__ inline finalize(char* result_location)
   {
-    // On destruction, finalize the message buffer and write out the current
-    // hexadecimal hash value to the result location.
     // Add a one byte flag 0b10000000 to signal the end of the message.
     uint8_t constexpr end_of_message = 0x80;
     // The message length is appended to the end of the last chunk processed.
-    uint64_t const message_length_in_bits = message_length * 8;
+    uint64_t message_length_in_bits = message_length * 8;
+    if constexpr (hash_algorithm::big_endian) {
+      auto const low_bits    = static_cast<uint32_t>(message_length_in_bits);
+      auto const high_bits   = static_cast<uint32_t>(message_length_in_bits >> 32);
+      message_length_in_bits = (static_cast<uint64_t>(__byte_perm(low_bits, 0, 0x0123)) << 32) |
+                               __byte_perm(high_bits, 0, 0x0123);
+    }
 
     buffer.put(&end_of_message, sizeof(end_of_message));
     buffer.pad(sizeof(message_length_in_bits));
     buffer.put(reinterpret_cast<uint8_t const*>(&message_length_in_bits),
                sizeof(message_length_in_bits));
 
-    for (int i = 0; i < 4; ++i) {
-      uint32ToLowercaseHexString(hash_values[i], result_location + (8 * i));
+    for (int i = 0; i < hash_algorithm::num_hash_values; ++i) {
+      auto const value =
+        hash_algorithm::big_endian ? __byte_perm(hash_values[i], 0, 0x0123) : hash_values[i];
+      uint32ToLowercaseHexString(value, result_location + (8 * i));
     }
   }
 
-  MD5Hasher(const MD5Hasher&) = delete;
-  MD5Hasher& operator=(const MD5Hasher&) = delete;
-  MD5Hasher(MD5Hasher&&)                 = delete;
-  MD5Hasher& operator=(MD5Hasher&&) = delete;
-
   template <typename Element>
   void __device__ inline process(Element const& element)
   {
@@ -162,63 +459,25 @@ struct MD5Hasher {
     message_length += size;
   }
 
-  /**
-   * @brief Core MD5 algorithm implementation. Processes a single 64-byte chunk,
-   * updating the hash value so far. Does not zero out the buffer contents.
-   */
-  struct md5_hash_step {
-    uint32_t (&hash_values)[4];
-
-    void __device__ inline operator()(const uint8_t (&buffer)[message_chunk_size])
-    {
-      uint32_t A = hash_values[0];
-      uint32_t B = hash_values[1];
-      uint32_t C = hash_values[2];
-      uint32_t D = hash_values[3];
-
-      for (int j = 0; j < message_chunk_size; j++) {
-        uint32_t F;
-        uint32_t g;
-        // No default case is needed because j < 64. j / 16 is always 0, 1, 2, or 3.
-        switch (j / 16) {
-          case 0:
-            F = (B & C) | ((~B) & D);
-            g = j;
-            break;
-          case 1:
-            F = (D & B) | ((~D) & C);
-            g = (5 * j + 1) % 16;
-            break;
-          case 2:
-            F = B ^ C ^ D;
-            g = (3 * j + 5) % 16;
-            break;
-          case 3:
-            F = C ^ (B | (~D));
-            g = (7 * j) % 16;
-            break;
-        }
+  /// Number of message bytes the chunk holds before the next hash step
+  [[nodiscard]] int __device__ inline chunk_space() const { return buffer.available_space; }
 
-        uint32_t buffer_element_as_int;
-        memcpy(&buffer_element_as_int, &buffer[g * 4], 4);
-        F = F + A + md5_hash_constants[j] + buffer_element_as_int;
-        A = D;
-        D = C;
-        C = B;
-        B = B + __funnelshift_l(F, F, md5_shift_constants[((j / 16) * 4) + (j % 4)]);
-      }
+  /// Position in the chunk of the next message byte
+  [[nodiscard]] int __device__ inline chunk_position() const
+  {
+    return message_chunk_size - buffer.available_space;
+  }
 
-      hash_values[0] += A;
-      hash_values[1] += B;
-      hash_values[2] += C;
-      hash_values[3] += D;
-    }
-  };
+  /// Processes `size <= chunk_space()` message bytes copied to `chunk_position()` by the warp
+  void __device__ inline process_copied(int size)
+  {
+    buffer.advance(size);
+    message_length += size;
+  }
 
-  char* result_location;
-  hash_circular_buffer<message_chunk_size, md5_hash_step> buffer;
+  uint32_t hash_values[hash_algorithm::num_hash_values];
+  hash_circular_buffer<message_chunk_size, hash_step> buffer;
   uint64_t message_length = 0;
-  uint32_t hash_values[4] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476};
 };
 
 template <typename Hasher>
@@ -270,22 +529,116 @@ struct ListHasherDispatcher {
   }
 };
 
+/**
+ * @brief Hashes one row per thread of each warp, with the warp copying the bytes of the strings
+ * of its rows into the message chunks of each thread in turn.
+ *
+ * A thread hashing its own long strings reads them one byte after another, and its warp waits on
+ * the threads of the longest rows. Here the warp reads the bytes of each string coalesced, and
+ * its threads run the hash steps of their message chunks together.
+ *
+ * @param input The table to hash, without list columns
+ * @param d_chars The characters of the digests of the rows
+ */
+template <typename hash_algorithm>
+__global__ void hash_rows_warp_cooperative(table_device_view input, char* d_chars)
+{
+  using hasher_type = MessageHasher<hash_algorithm>;
+  __shared__ uint8_t chunks[WARPS_PER_BLOCK * warp_size][hasher_type::message_chunk_size];
+
+  auto const lane_index = static_cast<size_type>(threadIdx.x % warp_size);
+  auto const warp_begin = threadIdx.x - lane_index;
+  auto const thread_row = static_cast<std::size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  bool const active     = thread_row < static_cast<std::size_t>(input.num_rows());
+  auto const row_index  = static_cast<size_type>(thread_row);
+
+  hasher_type hasher(chunks[threadIdx.x]);
+  for (auto const& col : input) {
+    if (col.type().id() != type_id::STRING) {
+      if (active && col.is_valid(row_index)) {
+        cudf::type_dispatcher<dispatch_storage_type>(
+          col.type(), HasherDispatcher(&hasher, col), row_index);
+      }
+      continue;
+    }
+
+    // The copies of the warp write to the chunks of the other threads
+    __syncwarp();
+
+    auto const chars = col.child(strings_column_view::chars_column_index).data<uint8_t>();
+
+    size_type position  = 0;
+    size_type remaining = 0;
+    if (active && col.is_valid(row_index)) {
+      auto const element = col.element<string_view>(row_index);
+      position  = static_cast<size_type>(reinterpret_cast<uint8_t const*>(element.data()) - chars);
+      remaining = element.size_bytes();
+    }
+    // Each round fills the message chunks of the threads with the next bytes of their strings
+    while (true) {
+      auto const count   = std::min(remaining, hasher.chunk_space());
+      auto const pending = __ballot_sync(0xffffffff, count > 0);
+      if (pending == 0) { break; }
+      for (auto lanes = pending; lanes != 0; lanes &= lanes - 1) {
+        auto const source_lane  = __ffs(lanes) - 1;
+        auto const source_begin = __shfl_sync(0xffffffff, position, source_lane);
+        auto const source_count = __shfl_sync(0xffffffff, count, source_lane);
+        auto const chunk_begin  = __shfl_sync(0xffffffff, hasher.chunk_position(), source_lane);
+        auto const destination  = chunks[warp_begin + source_lane] + chunk_begin;
+        for (auto i = lane_index; i < source_count; i += warp_size) {
+          destination[i] = chars[source_begin + i];
+        }
+      }
+      __syncwarp();
+      if (count > 0) { hasher.process_copied(count); }
+      position += count;
+      remaining -= count;
+      __syncwarp();
+    }
+  }
+  if (active) { hasher.finalize(d_chars + (row_index * hasher_type::digest_size)); }
+}
+
 // MD5 supported leaf data type check
 constexpr inline bool md5_leaf_type_check(data_type dt)
 {
   return (is_fixed_width(dt) && !is_chrono(dt)) || (dt.id() == type_id::STRING);
 }
 
-}  // namespace
+/**
+ * @brief Returns whether to hash the rows of `input` with `hash_rows_warp_cooperative`, because
+ * it has no list columns and its strings average at least `BYTES_PER_ROW_THRESHOLD` bytes per
+ * row.
+ */
+bool is_warp_cooperative(table_view const& input)
+{
+  if (std::any_of(input.begin(), input.end(), [](auto const& col) {
+        return col.type().id() == type_id::LIST;
+      })) {
+    return false;
+  }
+  auto const chars_size = std::accumulate(
+    input.begin(), input.end(), int64_t{0}, [](int64_t size, column_view const& col) {
+      return col.type().id() == type_id::STRING ? size + strings_column_view(col).chars_size()
+                                                : size;
+    });
+  return chars_size >= static_cast<int64_t>(input.num_rows()) * BYTES_PER_ROW_THRESHOLD;
+}
 
-std::unique_ptr<column> md5_hash(table_view const& input,
-                                 rmm::cuda_stream_view stream,
-                                 rmm::mr::device_memory_resource* mr)
+/**
+ * @brief Computes the hexadecimal MD5, SHA-1 or SHA-256 digest of each row of `input`.
+ */
+template <typename hash_algorithm>
+std::unique_ptr<column> message_digest(table_view const& input,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
 {
+  using hasher_type = MessageHasher<hash_algorithm>;
+
   if (input.num_columns() == 0 || input.num_rows() == 0) {
-    // Return the MD5 hash of a zero-length input.
-    string_scalar const string_128bit("d41d8cd98f00b204e9orig98ecf8427e");
-    return make_column_from_scalar(string_128bit, input.num_rows(), stream, mr);
+    // Return the digest of a zero-length input.
+    string_scalar const empty_digest(hash_algorithm::empty_digest);
+    return make_column_from_scalar(empty_digest, input.num_rows(), stream, mr);
   }
 
   // Accepts string and fixed width columns, or single layer list columns holding those types
@@ -300,7 +653,7 @@ std::unique_ptr<column> md5_hash(table_view const& input,
                "Unsupported column type for hash function.");
 
   // Digest size in bytes
-  auto constexpr digest_size = 32;
+  auto constexpr digest_size = hasher_type::digest_size;
   // Result column allocation and creation
   auto begin = thrust::make_constant_iterator(digest_size);
   auto offsets_column =
@@ -315,13 +668,26 @@ std::unique_ptr<column> md5_hash(table_view const& input,
 
   auto const device_input = table_device_view::create(input, stream);
 
+  if (is_warp_cooperative(input)) {
+    constexpr int block_size = WARPS_PER_BLOCK * warp_size;
+    auto const num_blocks    = util::div_rounding_up_safe(input.num_rows(), block_size);
+    hash_rows_warp_cooperative<hash_algorithm>
+      <<<num_blocks, block_size, 0, stream.value()>>>(*device_input, d_chars);
+    return make_strings_column(input.num_rows(),
+                               std::move(offsets_column),
+                               std::move(chars_column),
+                               0,
+                               std::move(null_mask));
+  }
+
   // Hash each row, hashing each element sequentially left to right
   thrust::for_each(
     rmm::exec_policy(stream),
     thrust::make_counting_iterator(0),
     thrust::make_counting_iterator(input.num_rows()),
     [d_chars, device_input = *device_input] __device__(auto row_index) {
-      MD5Hasher hasher(d_chars + (row_index * digest_size));
+      uint8_t chunk_storage[hasher_type::message_chunk_size];
+      hasher_type hasher(chunk_storage);
       for (auto const& col : device_input) {
         if (col.is_valid(row_index)) {
           if (col.type().id() == type_id::LIST) {
@@ -340,11 +706,35 @@ std::unique_ptr<column> md5_hash(table_view const& input,
           }
         }
       }
+      hasher.finalize(d_chars + (row_index * digest_size));
     });
 
   return make_strings_column(
     input.num_rows(), std::move(offsets_column), std::move(chars_column), 0, std::move(null_mask));
 }
 
+}  // namespace
+
+std::unique_ptr<column> md5_hash(table_view const& input,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  return message_digest<md5_algorithm>(input, stream, mr);
+}
+
+std::unique_ptr<column> sha1_hash(table_view const& input,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  return message_digest<sha1_algorithm>(input, stream, mr);
+}
+
+std::unique_ptr<column> sha256_hash(table_view const& input,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  return message_digest<sha256_algorithm>(input, stream, mr);
+}
+
 }  // namespace detail
 }  // namespace cudf
@@ -0,0 +1,539 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/interop.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+constexpr int64_t arrow_flag_nullable = 2;  // ARROW_FLAG_NULLABLE
+
+/**
+ * @brief Returns the format string of the Arrow C data interface of `type`.
+ */
+std::string arrow_format(data_type type)
+{
+  switch (type.id()) {
+    case type_id::EMPTY: return "n";
+    case type_id::INT8: return "c";
+    case type_id::INT16: return "s";
+    case type_id::INT32: return "i";
+    case type_id::INT64: return "l";
+    case type_id::UINT8: return "C";
+    case type_id::UINT16: return "S";
+    case type_id::UINT32: return "I";
+    case type_id::UINT64: return "L";
+    case type_id::FLOAT32: return "f";
+    case type_id::FLOAT64: return "g";
+    case type_id::BOOL8: return "b";
+    case type_id::TIMESTAMP_DAYS: return "tdD";
+    case type_id::TIMESTAMP_SECONDS: return "tss:";
+    case type_id::TIMESTAMP_MILLISECONDS: return "tsm:";
+    case type_id::TIMESTAMP_MICROSECONDS: return "tsu:";
+    case type_id::TIMESTAMP_NANOSECONDS: return "tsn:";
+    case type_id::DURATION_SECONDS: return "tDs";
+    case type_id::DURATION_MILLISECONDS: return "tDm";
+    case type_id::DURATION_MICROSECONDS: return "tDu";
+    case type_id::DURATION_NANOSECONDS: return "tDn";
+    case type_id::STRING: return "u";
+    case type_id::LIST: return "+l";
+    case type_id::STRUCT: return "+s";
+    // cudf scales are the negation of Arrow's
+    case type_id::DECIMAL32: return "d:9," + std::to_string(-type.scale()) + ",32";
+    case type_id::DECIMAL64: return "d:18," + std::to_string(-type.scale()) + ",64";
+    case type_id::DECIMAL128: return "d:38," + std::to_string(-type.scale());
+    default: CUDF_FAIL("Unsupported type for the Arrow C data interface.");
+  }
+}
+
+/**
+ * @brief Returns the cudf type of the Arrow C data interface format string `format`.
+ */
+data_type cudf_type(std::string const& format)
+{
+  if (format.size() == 1) {
+    switch (format[0]) {
+      case 'n': return data_type{type_id::EMPTY};
+      case 'c': return data_type{type_id::INT8};
+      case 's': return data_type{type_id::INT16};
+      case 'i': return data_type{type_id::INT32};
+      case 'l': return data_type{type_id::INT64};
+      case 'C': return data_type{type_id::UINT8};
+      case 'S': return data_type{type_id::UINT16};
+      case 'I': return data_type{type_id::UINT32};
+      case 'L': return data_type{type_id::UINT64};
+      case 'f': return data_type{type_id::FLOAT32};
+      case 'g': return data_type{type_id::FLOAT64};
+      case 'u': return data_type{type_id::STRING};
+      case 'b': CUDF_FAIL("Arrow booleans are bits, which cudf cannot view as BOOL8.");
+      case 'U': CUDF_FAIL("Large strings are not supported.");
+      default: break;
+    }
+  }
+  if (format == "+l") { return data_type{type_id::LIST}; }
+  if (format == "+s") { return data_type{type_id::STRUCT}; }
+  if (format == "+L") { CUDF_FAIL("Large lists are not supported."); }
+  if (format == "tdD") { return data_type{type_id::TIMESTAMP_DAYS}; }
+  // the time zone of a timestamp is ignored
+  if (format.size() >= 4 and format.compare(0, 2, "ts") == 0 and format[3] == ':') {
+    switch (format[2]) {
+      case 's': return data_type{type_id::TIMESTAMP_SECONDS};
+      case 'm': return data_type{type_id::TIMESTAMP_MILLISECONDS};
+      case 'u': return data_type{type_id::TIMESTAMP_MICROSECONDS};
+      case 'n': return data_type{type_id::TIMESTAMP_NANOSECONDS};
+      default: break;
+    }
+  }
+  if (format.size() == 3 and format.compare(0, 2, "tD") == 0) {
+    switch (format[2]) {
+      case 's': return data_type{type_id::DURATION_SECONDS};
+      case 'm': return data_type{type_id::DURATION_MILLISECONDS};
+      case 'u': return data_type{type_id::DURATION_MICROSECONDS};
+      case 'n': return data_type{type_id::DURATION_NANOSECONDS};
+      default: break;
+    }
+  }
+  if (format.compare(0, 2, "d:") == 0) {
+    // "d:precision,scale[,bitwidth]", whose bit width is 128 when it is omitted
+    auto const scale_begin = format.find(',') + 1;
+    CUDF_EXPECTS(scale_begin > 0, "Invalid decimal format.");
+    auto const bitwidth_begin = format.find(',', scale_begin);
+    auto const scale = std::stoi(format.substr(scale_begin, bitwidth_begin - scale_begin));
+    auto const bitwidth =
+      bitwidth_begin == std::string::npos ? 128 : std::stoi(format.substr(bitwidth_begin + 1));
+    switch (bitwidth) {
+      case 32: return data_type{type_id::DECIMAL32, -scale};
+      case 64: return data_type{type_id::DECIMAL64, -scale};
+      case 128: return data_type{type_id::DECIMAL128, -scale};
+      default: break;
+    }
+  }
+  CUDF_FAIL("Unsupported Arrow format: " + format);
+}
+
+/**
+ * @brief Returns the children of `col` which are the children of its Arrow array.
+ *
+ * The offsets of lists and strings are buffers of their Arrow array, not children.
+ */
+std::vector<column_view> arrow_children(column_view const& col)
+{
+  switch (col.type().id()) {
+    case type_id::LIST:
+      // an empty list column may have no children, and its child is then an empty null array
+      if (col.num_children() == 0) { return {column_view{data_type{type_id::EMPTY}, 0, nullptr}}; }
+      return {col.child(lists_column_view::child_column_index)};
+    case type_id::STRUCT: return {col.child_begin(), col.child_end()};
+    default: return {};
+  }
+}
+
+/**
+ * @brief Storage of the strings and children of an exported `ArrowSchema`.
+ */
+struct schema_private_data {
+  std::string format;
+  std::string name;
+  std::vector<ArrowSchema> children;
+  std::vector<ArrowSchema*> child_pointers;
+};
+
+void release_schema(ArrowSchema* schema)
+{
+  auto data = static_cast<schema_private_data*>(schema->private_data);
+  for (auto child : data->child_pointers) {
+    if (child->release != nullptr) { child->release(child); }
+  }
+  delete data;
+  schema->release = nullptr;
+}
+
+/**
+ * @brief Fills `out` with a schema of `format`, and returns the storage of its children.
+ *
+ * The children are zero-initialized, so that `out` can be released before they are filled.
+ */
+std::vector<ArrowSchema>& fill_schema(ArrowSchema* out,
+                                      std::string format,
+                                      std::string name,
+                                      bool nullable,
+                                      std::size_t num_children)
+{
+  auto data    = std::make_unique<schema_private_data>();
+  data->format = std::move(format);
+  data->name   = std::move(name);
+  data->children.resize(num_children, ArrowSchema{});
+  for (auto& child : data->children) {
+    data->child_pointers.push_back(&child);
+  }
+
+  out->format       = data->format.c_str();
+  out->name         = data->name.c_str();
+  out->metadata     = nullptr;
+  out->flags        = nullable ? arrow_flag_nullable : 0;
+  out->n_children   = static_cast<int64_t>(num_children);
+  out->children     = data->child_pointers.data();
+  out->dictionary   = nullptr;
+  out->release      = release_schema;
+  out->private_data = data.release();
+  return static_cast<schema_private_data*>(out->private_data)->children;
+}
+
+void column_to_schema(column_view const& col, column_metadata const* metadata, ArrowSchema* out)
+{
+  auto const children = arrow_children(col);
+  auto& child_schemas = fill_schema(out,
+                                    arrow_format(col.type()),
+                                    metadata != nullptr ? metadata->name : std::string{},
+                                    col.nullable() or col.type().id() == type_id::EMPTY,
+                                    children.size());
+  for (std::size_t i = 0; i < children.size(); ++i) {
+    // the metadata of a list has the entries of both its offsets and its child
+    auto const meta_index = col.type().id() == type_id::LIST ? 1 : i;
+    auto const child_metadata =
+      metadata != nullptr and meta_index < metadata->children_meta.size()
+        ? &metadata->children_meta[meta_index]
+        : nullptr;
+    column_to_schema(children[i], child_metadata, &child_schemas[i]);
+  }
+}
+
+/**
+ * @brief Keeps the exported device memory alive until all its arrays are released.
+ */
+struct export_owner {
+  std::unique_ptr<table> owned_table;
+  std::vector<rmm::device_buffer> buffers;  ///< Buffers converted from cudf's representation
+  cudaEvent_t event{};
+
+  ~export_owner()
+  {
+    if (event != cudaEvent_t{}) { cudaEventDestroy(event); }
+  }
+};
+
+/**
+ * @brief Storage of the buffers and children of an exported `ArrowArray`.
+ *
+ * Every array shares the ownership of the device memory, since children may be moved out of
+ * their parent and released after it.
+ */
+struct array_private_data {
+  std::shared_ptr<export_owner> owner;
+  std::vector<void const*> buffers;
+  std::vector<ArrowArray> children;
+  std::vector<ArrowArray*> child_pointers;
+};
+
+void release_array(ArrowArray* array)
+{
+  auto data = static_cast<array_private_data*>(array->private_data);
+  for (auto child : data->child_pointers) {
+    if (child->release != nullptr) { child->release(child); }
+  }
+  delete data;
+  array->release = nullptr;
+}
+
+/**
+ * @brief Fills `out` with an array of `buffers`, and returns the storage of its children.
+ *
+ * The children are zero-initialized, so that `out` can be released before they are filled.
+ */
+std::vector<ArrowArray>& fill_array(ArrowArray* out,
+                                    std::shared_ptr<export_owner> const& owner,
+                                    int64_t length,
+                                    int64_t null_count,
+                                    int64_t offset,
+                                    std::vector<void const*> buffers,
+                                    std::size_t num_children)
+{
+  auto data     = std::make_unique<array_private_data>();
+  data->owner   = owner;
+  data->buffers = std::move(buffers);
+  data->children.resize(num_children, ArrowArray{});
+  for (auto& child : data->children) {
+    data->child_pointers.push_back(&child);
+  }
+
+  out->length       = length;
+  out->null_count   = null_count;
+  out->offset       = offset;
+  out->n_buffers    = static_cast<int64_t>(data->buffers.size());
+  out->n_children   = static_cast<int64_t>(num_children);
+  out->buffers      = data->buffers.empty() ? nullptr : data->buffers.data();
+  out->children     = data->child_pointers.data();
+  out->dictionary   = nullptr;
+  out->release      = release_array;
+  out->private_data = data.release();
+  return static_cast<array_private_data*>(out->private_data)->children;
+}
+
+/**
+ * @brief Returns the device pointer to a single offset of 0, the offsets of an empty column.
+ */
+void const* zero_offsets(export_owner& owner, rmm::cuda_stream_view stream)
+{
+  auto& buffer = owner.buffers.emplace_back(sizeof(size_type), stream);
+  CUDA_TRY(cudaMemsetAsync(buffer.data(), 0, sizeof(size_type), stream.value()));
+  return buffer.data();
+}
+
+void column_to_array(column_view const& col,
+                     std::shared_ptr<export_owner> const& owner,
+                     ArrowArray* out,
+                     rmm::cuda_stream_view stream,
+                     rmm::mr::device_memory_resource* mr)
+{
+  void const* null_mask = col.null_mask();
+  auto offset           = col.offset();
+  std::vector<void const*> buffers;
+  switch (col.type().id()) {
+    case type_id::EMPTY: break;
+    case type_id::BOOL8: {
+      // cudf booleans are bytes, which are packed into the bits of new buffers starting at bit 0
+      if (col.nullable()) {
+        null_mask = owner->buffers.emplace_back(copy_bitmask(col, stream, mr)).data();
+      }
+      auto bits = std::move(*bools_to_mask(col, stream, mr).first);
+      buffers   = {null_mask, owner->buffers.emplace_back(std::move(bits)).data()};
+      offset    = 0;
+      break;
+    }
+    case type_id::STRING:
+      if (col.num_children() == 0) {
+        buffers = {null_mask, zero_offsets(*owner, stream), nullptr};
+      } else {
+        strings_column_view const strings(col);
+        buffers = {null_mask, strings.offsets().head(), strings.chars().head()};
+      }
+      break;
+    case type_id::LIST:
+      buffers = {null_mask,
+                 col.num_children() == 0
+                   ? zero_offsets(*owner, stream)
+                   : col.child(lists_column_view::offsets_column_index).head()};
+      break;
+    case type_id::STRUCT: buffers = {null_mask}; break;
+    case type_id::DICTIONARY32: CUDF_FAIL("Unsupported dictionary column.");
+    default: buffers = {null_mask, col.head()};
+  }
+
+  auto const children = arrow_children(col);
+  auto& child_arrays  = fill_array(out,
+                                  owner,
+                                  col.size(),
+                                  col.null_count(),
+                                  offset,
+                                  std::move(buffers),
+                                  children.size());
+  for (std::size_t i = 0; i < children.size(); ++i) {
+    column_to_array(children[i], owner, &child_arrays[i], stream, mr);
+  }
+}
+
+/**
+ * @brief Returns the value of the offset `index` of the Arrow offsets buffer `offsets`.
+ */
+size_type read_offset(void const* offsets, int64_t index, rmm::cuda_stream_view stream)
+{
+  size_type value{};
+  CUDA_TRY(cudaMemcpyAsync(&value,
+                           static_cast<size_type const*>(offsets) + index,
+                           sizeof(size_type),
+                           cudaMemcpyDefault,
+                           stream.value()));
+  stream.synchronize();
+  return value;
+}
+
+column_view array_to_column(ArrowSchema const* schema,
+                            ArrowArray const* array,
+                            rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(schema->dictionary == nullptr, "Dictionary arrays are not supported.");
+  CUDF_EXPECTS(schema->n_children == array->n_children, "The schema does not match the array.");
+  CUDF_EXPECTS(array->offset + array->length <= std::numeric_limits<size_type>::max(),
+               "Array too large for a cudf column.");
+
+  auto const type   = cudf_type(schema->format);
+  auto const length = static_cast<size_type>(array->length);
+  auto const offset = static_cast<size_type>(array->offset);
+  if (type.id() == type_id::EMPTY) { return column_view{type, length, nullptr}; }
+
+  auto const buffer = [&](int64_t index) {
+    CUDF_EXPECTS(index < array->n_buffers, "The schema does not match the array.");
+    return array->buffers[index];
+  };
+  auto const null_mask  = static_cast<bitmask_type const*>(buffer(0));
+  auto const null_count = null_mask == nullptr     ? 0
+                          : array->null_count < 0 ? UNKNOWN_NULL_COUNT
+                                                  : static_cast<size_type>(array->null_count);
+
+  std::vector<column_view> children;
+  switch (type.id()) {
+    case type_id::STRING: {
+      if (buffer(1) == nullptr) { return column_view{type, 0, nullptr}; }
+      auto const num_offsets = offset + length + 1;
+      auto const num_chars   = read_offset(buffer(1), num_offsets - 1, stream);
+      children.emplace_back(data_type{type_id::INT32}, num_offsets, buffer(1));
+      children.emplace_back(data_type{type_id::INT8}, num_chars, buffer(2));
+      break;
+    }
+    case type_id::LIST: {
+      auto const num_offsets = buffer(1) == nullptr ? 0 : offset + length + 1;
+      children.emplace_back(data_type{type_id::INT32}, num_offsets, buffer(1));
+      children.push_back(array_to_column(schema->children[0], array->children[0], stream));
+      break;
+    }
+    case type_id::STRUCT:
+      for (int64_t i = 0; i < array->n_children; ++i) {
+        children.push_back(array_to_column(schema->children[i], array->children[i], stream));
+      }
+      break;
+    default: return column_view{type, length, buffer(1), null_mask, null_count, offset};
+  }
+  return column_view{type, length, nullptr, null_mask, null_count, offset, children};
+}
+
+}  // namespace
+
+unique_device_array_t to_arrow_device(table&& input,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  auto owner         = std::make_shared<export_owner>();
+  owner->owned_table = std::make_unique<table>(std::move(input));
+  auto const view    = owner->owned_table->view();
+
+  unique_device_array_t result{new ArrowDeviceArray{}};
+  auto& columns = fill_array(&result->array,
+                             owner,
+                             view.num_rows(),
+                             0,
+                             0,
+                             {nullptr},
+                             static_cast<std::size_t>(view.num_columns()));
+  for (size_type i = 0; i < view.num_columns(); ++i) {
+    column_to_array(view.column(i), owner, &columns[i], stream, mr);
+  }
+
+  int device_id{};
+  CUDA_TRY(cudaGetDevice(&device_id));
+  CUDA_TRY(cudaEventCreateWithFlags(&owner->event, cudaEventDisableTiming));
+  CUDA_TRY(cudaEventRecord(owner->event, stream.value()));
+  result->device_id   = device_id;
+  result->device_type = ARROW_DEVICE_CUDA;
+  result->sync_event  = &owner->event;
+  return result;
+}
+
+table_view from_arrow_device(ArrowSchema const* schema,
+                             ArrowDeviceArray const* input,
+                             rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(schema != nullptr and input != nullptr, "Unexpected null schema or array.");
+  CUDF_EXPECTS(std::string(schema->format) == "+s", "The schema of a table must be a struct.");
+  CUDF_EXPECTS(input->device_type == ARROW_DEVICE_CUDA or
+                 input->device_type == ARROW_DEVICE_CUDA_HOST or
+                 input->device_type == ARROW_DEVICE_CUDA_MANAGED,
+               "The array must reside in memory accessible by CUDA.");
+  if (input->device_type == ARROW_DEVICE_CUDA) {
+    int device_id{};
+    CUDA_TRY(cudaGetDevice(&device_id));
+    CUDF_EXPECTS(input->device_id == device_id, "The array must reside on the current device.");
+  }
+  if (input->sync_event != nullptr) {
+    CUDA_TRY(
+      cudaStreamWaitEvent(stream.value(), *static_cast<cudaEvent_t*>(input->sync_event), 0));
+  }
+
+  auto const& array = input->array;
+  CUDF_EXPECTS(schema->n_children == array.n_children, "The schema does not match the array.");
+  std::vector<column_view> columns;
+  for (int64_t i = 0; i < array.n_children; ++i) {
+    auto const col = array_to_column(schema->children[i], array.children[i], stream);
+    // the columns of a struct are sliced by its offset and length
+    auto const begin = static_cast<size_type>(array.offset);
+    auto const end   = static_cast<size_type>(array.offset + array.length);
+    columns.push_back(begin == 0 and end == col.size() ? col : slice(col, begin, end));
+  }
+  return table_view{columns};
+}
+
+}  // namespace detail
+
+void arrow_schema_deleter::operator()(ArrowSchema* schema) const
+{
+  if (schema->release != nullptr) { schema->release(schema); }
+  delete schema;
+}
+
+void arrow_device_array_deleter::operator()(ArrowDeviceArray* array) const
+{
+  if (array->array.release != nullptr) { array->array.release(&array->array); }
+  delete array;
+}
+
+unique_schema_t to_arrow_schema(table_view const& input,
+                                std::vector<column_metadata> const& metadata)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(
+    metadata.empty() or metadata.size() == static_cast<std::size_t>(input.num_columns()),
+    "columns' metadata should be equal to number of columns in table");
+
+  unique_schema_t result{new ArrowSchema{}};
+  auto& columns = detail::fill_schema(
+    result.get(), "+s", std::string{}, false, static_cast<std::size_t>(input.num_columns()));
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    detail::column_to_schema(
+      input.column(i), metadata.empty() ? nullptr : &metadata[i], &columns[i]);
+  }
+  return result;
+}
+
+unique_device_array_t to_arrow_device(table&& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_arrow_device(std::move(input), rmm::cuda_stream_default, mr);
+}
+
+table_view from_arrow_device(ArrowSchema const* schema, ArrowDeviceArray const* input)
+{
+  CUDF_FUNC_RANGE();
+  return detail::from_arrow_device(schema, input, rmm::cuda_stream_default);
+}
+
+}  // namespace cudf
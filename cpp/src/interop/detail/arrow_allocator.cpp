@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,8 +16,68 @@
 
 #include <cudf/detail/interop.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
 namespace cudf {
 namespace detail {
+namespace {
+
+/**
+ * @brief Arrow memory pool of pinned host memory.
+ */
+class pinned_memory_pool : public arrow::MemoryPool {
+ public:
+  arrow::Status Allocate(int64_t size, uint8_t** out) override
+  {
+    if (size == 0) {
+      *out = zero_size_area;
+      return arrow::Status::OK();
+    }
+    auto const status = cudaMallocHost(reinterpret_cast<void**>(out), size);
+    if (status != cudaSuccess) {
+      cudaGetLastError();
+      return arrow::Status::OutOfMemory("cudaMallocHost failed: ", cudaGetErrorString(status));
+    }
+    auto const allocated = bytes_allocated_ += size;
+    auto max             = max_memory_.load();
+    while (allocated > max and not max_memory_.compare_exchange_weak(max, allocated)) {}
+    return arrow::Status::OK();
+  }
+
+  arrow::Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override
+  {
+    uint8_t* reallocated{};
+    ARROW_RETURN_NOT_OK(Allocate(new_size, &reallocated));
+    if (old_size > 0 and new_size > 0) {
+      std::memcpy(reallocated, *ptr, std::min(old_size, new_size));
+    }
+    Free(*ptr, old_size);
+    *ptr = reallocated;
+    return arrow::Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) override
+  {
+    if (buffer == zero_size_area) { return; }
+    cudaFreeHost(buffer);
+    bytes_allocated_ -= size;
+  }
+
+  int64_t bytes_allocated() const override { return bytes_allocated_; }
+
+  int64_t max_memory() const override { return max_memory_; }
+
+  std::string backend_name() const override { return "cudf_pinned"; }
+
+ private:
+  alignas(64) static inline uint8_t zero_size_area[1];
+  std::atomic<int64_t> bytes_allocated_{0};
+  std::atomic<int64_t> max_memory_{0};
+};
+
+}  // namespace
 
 std::unique_ptr<arrow::Buffer> allocate_arrow_buffer(const int64_t size, arrow::MemoryPool* ar_mr)
 {
@@ -48,4 +108,11 @@ std::shared_ptr<arrow::Buffer> allocate_arrow_bitmap(const int64_t size, arrow::
 }
 
 }  // namespace detail
+
+arrow::MemoryPool* pinned_arrow_memory_pool()
+{
+  static detail::pinned_memory_pool pool;
+  return &pool;
+}
+
 }  // namespace cudf
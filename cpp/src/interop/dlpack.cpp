@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,6 +15,9 @@
  */
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/interop.hpp>
+#include <cudf/detail/reshape.hpp>
+#include <cudf/detail/utilities/batched_memcpy.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/list_view.cuh>
 #include <cudf/structs/struct_view.hpp>
 #include <cudf/utilities/error.hpp>
@@ -126,6 +129,36 @@ struct dltensor_context {
   }
 };
 
+/**
+ * @brief Returns a tensor of the shape of `num_rows` by `num_cols`, owning its context.
+ */
+std::unique_ptr<DLManagedTensor> make_tensor(dltensor_context& context,
+                                             DLDataType dltype,
+                                             size_type num_rows,
+                                             size_type num_cols,
+                                             dlpack_layout layout)
+{
+  auto managed_tensor = std::make_unique<DLManagedTensor>();
+  DLTensor& tensor    = managed_tensor->dl_tensor;
+  tensor.dtype        = dltype;
+
+  tensor.ndim     = (num_cols > 1) ? 2 : 1;
+  tensor.shape    = context.shape;
+  tensor.shape[0] = num_rows;
+  if (tensor.ndim > 1) {
+    auto const is_row_major = layout == dlpack_layout::ROW_MAJOR;
+    tensor.shape[1]         = num_cols;
+    tensor.strides          = context.strides;
+    tensor.strides[0]       = is_row_major ? num_cols : 1;
+    tensor.strides[1]       = is_row_major ? 1 : num_rows;
+  }
+
+  CUDA_TRY(cudaGetDevice(&tensor.device.device_id));
+  tensor.device.device_type = kDLCUDA;
+  tensor.data               = context.buffer.data();
+  return managed_tensor;
+}
+
 }  // namespace
 
 namespace detail {
@@ -172,10 +205,14 @@ std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
   size_t const bytes      = num_rows * byte_width;
 
   // For 2D tensors, if the strides pointer is not null, then strides[1] is the
-  // number of elements (not bytes) between the start of each column
+  // number of elements (not bytes) between the start of each column, and strides[0]
+  // the number of elements between the start of each row, which is 1 unless the
+  // tensor is row-major
   size_t const col_stride = (tensor.ndim == 2 && nullptr != tensor.strides)
                               ? byte_width * tensor.strides[1]
                               : byte_width * num_rows;
+  size_t const row_stride =
+    (tensor.ndim == 2 && nullptr != tensor.strides) ? byte_width * tensor.strides[0] : byte_width;
 
   auto tensor_data = reinterpret_cast<uintptr_t>(tensor.data) + tensor.byte_offset;
 
@@ -184,11 +221,22 @@ std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
   for (auto& col : columns) {
     col = make_numeric_column(dtype, num_rows, mask_state::UNALLOCATED, stream, mr);
 
-    CUDA_TRY(cudaMemcpyAsync(col->mutable_view().head<void>(),
-                             reinterpret_cast<void*>(tensor_data),
-                             bytes,
-                             cudaMemcpyDefault,
-                             stream.value()));
+    if (row_stride == byte_width) {
+      CUDA_TRY(cudaMemcpyAsync(col->mutable_view().head<void>(),
+                               reinterpret_cast<void*>(tensor_data),
+                               bytes,
+                               cudaMemcpyDefault,
+                               stream.value()));
+    } else if (num_rows > 0) {
+      CUDA_TRY(cudaMemcpy2DAsync(col->mutable_view().head<void>(),
+                                 byte_width,
+                                 reinterpret_cast<void*>(tensor_data),
+                                 row_stride,
+                                 byte_width,
+                                 num_rows,
+                                 cudaMemcpyDefault,
+                                 stream.value()));
+    }
 
     tensor_data += col_stride;
   }
@@ -197,6 +245,7 @@ std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
 }
 
 DLManagedTensor* to_dlpack(table_view const& input,
+                           dlpack_layout layout,
                            rmm::cuda_stream_view stream,
                            rmm::mr::device_memory_resource* mr)
 {
@@ -218,57 +267,70 @@ DLManagedTensor* to_dlpack(table_view const& input,
     std::none_of(input.begin(), input.end(), [](auto const& col) { return col.has_nulls(); }),
     "Input required to have null count zero");
 
-  auto managed_tensor = std::make_unique<DLManagedTensor>();
-  auto context        = std::make_unique<dltensor_context>();
+  auto context = std::make_unique<dltensor_context>();
 
-  DLTensor& tensor = managed_tensor->dl_tensor;
-  tensor.dtype     = dltype;
+  // The data of the table is always copied, even for a single column, since the tensor would
+  // otherwise view memory that it does not own and which could be changed or freed while the
+  // tensor is used. The `std::unique_ptr<column>` overload does not copy, owning the data.
 
-  tensor.ndim     = (num_cols > 1) ? 2 : 1;
-  tensor.shape    = context->shape;
-  tensor.shape[0] = num_rows;
-  if (tensor.ndim > 1) {
-    tensor.shape[1]   = num_cols;
-    tensor.strides    = context->strides;
-    tensor.strides[0] = 1;
-    tensor.strides[1] = num_rows;
+  if (layout == dlpack_layout::ROW_MAJOR and num_cols > 1) {
+    // The rows are interleaved straight into the tensor buffer by a single kernel
+    auto interleaved = detail::interleave_columns(input, stream, mr);
+    context->buffer  = std::move(*interleaved->release().data);
+  } else {
+    // The columns are copied into the tensor buffer by a single batched copy
+    size_t const stride_bytes = num_rows * size_of(type);
+    context->buffer           = rmm::device_buffer(stride_bytes * num_cols, stream, mr);
+
+    std::vector<uint8_t*> dst(num_cols);
+    std::vector<uint8_t const*> src(num_cols);
+    std::vector<std::size_t> sizes(num_cols, stride_bytes);
+    for (size_type i = 0; i < num_cols; ++i) {
+      dst[i] = static_cast<uint8_t*>(context->buffer.data()) + i * stride_bytes;
+      src[i] = static_cast<uint8_t const*>(get_column_data(input.column(i)));
+    }
+    auto const d_dst   = make_device_uvector_async(dst, stream);
+    auto const d_src   = make_device_uvector_async(src, stream);
+    auto const d_sizes = make_device_uvector_async(sizes, stream);
+    batched_memcpy(d_dst, d_src, d_sizes, stream);
   }
 
-  CUDA_TRY(cudaGetDevice(&tensor.device.device_id));
-  tensor.device.device_type = kDLCUDA;
-
-  // If there is only one column, then a 1D tensor can just copy the pointer
-  // to the data in the column, and the deleter should not delete the original
-  // data. However, this is inconsistent with the 2D cases where we must do a
-  // copy of each column's data into the dense tensor array. Also, if we don't
-  // copy, then the original column data could be changed, which would change
-  // the contents of the tensor, which might be surprising or cause issues.
-  // Therefore, for now we ALWAYS do a copy of the data. If this becomes
-  // a performance issue we can reevaluate in the future.
-
-  size_t const stride_bytes = num_rows * size_of(type);
-  size_t const total_bytes  = stride_bytes * num_cols;
-
-  context->buffer = rmm::device_buffer(total_bytes, stream, mr);
-  tensor.data     = context->buffer.data();
-
-  auto tensor_data = reinterpret_cast<uintptr_t>(tensor.data);
-  for (auto const& col : input) {
-    CUDA_TRY(cudaMemcpyAsync(reinterpret_cast<void*>(tensor_data),
-                             get_column_data(col),
-                             stride_bytes,
-                             cudaMemcpyDefault,
-                             stream.value()));
-    tensor_data += stride_bytes;
-  }
+  auto managed_tensor = make_tensor(*context, dltype, num_rows, num_cols, layout);
 
   // Defer ownership of managed tensor to caller
   managed_tensor->deleter     = dltensor_context::deleter;
   managed_tensor->manager_ctx = context.release();
 
   // synchronize the stream because after the return the data may be accessed from the host before
-  // the above `cudaMemcpyAsync` calls have completed their copies (especially if pinned host
-  // memory is used).
+  // the above copies have completed (especially if pinned host memory is used).
+  stream.synchronize();
+
+  return managed_tensor.release();
+}
+
+DLManagedTensor* to_dlpack(table_view const& input,
+                           rmm::cuda_stream_view stream,
+                           rmm::mr::device_memory_resource* mr)
+{
+  return to_dlpack(input, dlpack_layout::COLUMN_MAJOR, stream, mr);
+}
+
+DLManagedTensor* to_dlpack(std::unique_ptr<column> input, rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(input != nullptr, "input is null");
+  if (input->size() == 0) { return nullptr; }
+  DLDataType const dltype = data_type_to_DLDataType(input->type());
+  CUDF_EXPECTS(not input->has_nulls(), "Input required to have null count zero");
+
+  auto const num_rows = input->size();
+  auto context        = std::make_unique<dltensor_context>();
+  context->buffer     = std::move(*input->release().data);
+
+  auto managed_tensor = make_tensor(*context, dltype, num_rows, 1, dlpack_layout::COLUMN_MAJOR);
+  managed_tensor->deleter     = dltensor_context::deleter;
+  managed_tensor->manager_ctx = context.release();
+
+  // the data may have been written on the stream, and is accessed with no stream after the return
   stream.synchronize();
 
   return managed_tensor.release();
@@ -287,4 +349,16 @@ DLManagedTensor* to_dlpack(table_view const& input, rmm::mr::device_memory_resou
   return detail::to_dlpack(input, rmm::cuda_stream_default, mr);
 }
 
+DLManagedTensor* to_dlpack(table_view const& input,
+                           dlpack_layout layout,
+                           rmm::mr::device_memory_resource* mr)
+{
+  return detail::to_dlpack(input, layout, rmm::cuda_stream_default, mr);
+}
+
+DLManagedTensor* to_dlpack(std::unique_ptr<column> input)
+{
+  return detail::to_dlpack(std::move(input), rmm::cuda_stream_default);
+}
+
 }  // namespace cudf
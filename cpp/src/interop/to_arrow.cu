@@ -18,8 +18,11 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/interop.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/batched_memcpy.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/interop.hpp>
 #include <cudf/null_mask.hpp>
@@ -40,23 +43,83 @@ namespace cudf {
 namespace detail {
 namespace {
 
+/**
+ * @brief Returns whether `ptr` points to pinned host memory, which kernels can access.
+ */
+bool is_pinned(void const* ptr)
+{
+  cudaPointerAttributes attributes{};
+  if (cudaPointerGetAttributes(&attributes, ptr) != cudaSuccess) {
+    // pageable memory is an invalid value before CUDA 11
+    cudaGetLastError();
+    return false;
+  }
+  return attributes.type == cudaMemoryTypeHost;
+}
+
+/**
+ * @brief Device to host copies of the buffers of arrow arrays.
+ *
+ * The copies are deferred until `copy`, which issues all of them at once. The temporary device
+ * memory they copy from is kept alive until then.
+ */
+struct host_copies {
+  std::vector<uint8_t*> dst;
+  std::vector<uint8_t const*> src;
+  std::vector<std::size_t> sizes;
+  std::vector<rmm::device_buffer> buffers;
+  std::vector<std::unique_ptr<column>> columns;
+
+  void add(void* to, void const* from, std::size_t size)
+  {
+    dst.push_back(static_cast<uint8_t*>(to));
+    src.push_back(static_cast<uint8_t const*>(from));
+    sizes.push_back(size);
+  }
+
+  /**
+   * @brief Issues all the copies without synchronizing the stream.
+   *
+   * The copies into pinned host memory are all done by a single batched copy. The others each
+   * take a `cudaMemcpyAsync`, which pageable memory makes synchronous.
+   */
+  void copy(rmm::cuda_stream_view stream)
+  {
+    std::vector<uint8_t*> pinned_dst;
+    std::vector<uint8_t const*> pinned_src;
+    std::vector<std::size_t> pinned_sizes;
+    for (std::size_t i = 0; i < dst.size(); ++i) {
+      if (sizes[i] == 0) { continue; }
+      if (is_pinned(dst[i])) {
+        pinned_dst.push_back(dst[i]);
+        pinned_src.push_back(src[i]);
+        pinned_sizes.push_back(sizes[i]);
+      } else {
+        CUDA_TRY(
+          cudaMemcpyAsync(dst[i], src[i], sizes[i], cudaMemcpyDeviceToHost, stream.value()));
+      }
+    }
+    if (pinned_dst.empty()) { return; }
+
+    auto const d_dst   = make_device_uvector_async(pinned_dst, stream);
+    auto const d_src   = make_device_uvector_async(pinned_src, stream);
+    auto const d_sizes = make_device_uvector_async(pinned_sizes, stream);
+    batched_memcpy(d_dst, d_src, d_sizes, stream);
+  }
+};
+
 /**
  * @brief Create arrow data buffer from given cudf column
  */
 template <typename T>
 std::shared_ptr<arrow::Buffer> fetch_data_buffer(column_view input_view,
                                                  arrow::MemoryPool* ar_mr,
-                                                 rmm::cuda_stream_view stream)
+                                                 host_copies& copies)
 {
   const int64_t data_size_in_bytes = sizeof(T) * input_view.size();
 
   auto data_buffer = allocate_arrow_buffer(data_size_in_bytes, ar_mr);
-
-  CUDA_TRY(cudaMemcpyAsync(data_buffer->mutable_data(),
-                           input_view.data<T>(),
-                           data_size_in_bytes,
-                           cudaMemcpyDeviceToHost,
-                           stream.value()));
+  copies.add(data_buffer->mutable_data(), input_view.data<T>(), data_size_in_bytes);
 
   return std::move(data_buffer);
 }
@@ -66,18 +129,17 @@ std::shared_ptr<arrow::Buffer> fetch_data_buffer(column_view input_view,
  */
 std::shared_ptr<arrow::Buffer> fetch_mask_buffer(column_view input_view,
                                                  arrow::MemoryPool* ar_mr,
+                                                 host_copies& copies,
                                                  rmm::cuda_stream_view stream)
 {
-  const int64_t mask_size_in_bytes = cudf::bitmask_allocation_size_bytes(input_view.size());
-
   if (input_view.has_nulls()) {
     auto mask_buffer = allocate_arrow_bitmap(static_cast<int64_t>(input_view.size()), ar_mr);
-    CUDA_TRY(cudaMemcpyAsync(
-      mask_buffer->mutable_data(),
-      (input_view.offset() > 0) ? cudf::copy_bitmask(input_view).data() : input_view.null_mask(),
-      mask_size_in_bytes,
-      cudaMemcpyDeviceToHost,
-      stream.value()));
+    void const* mask = input_view.null_mask();
+    if (input_view.offset() > 0) {
+      mask = copies.buffers.emplace_back(cudf::detail::copy_bitmask(input_view, stream)).data();
+    }
+    // Only the bytes of the bitmap are copied, so that the padding reset here stays 0
+    copies.add(mask_buffer->mutable_data(), mask, mask_buffer->size());
 
     // Resets all padded bits to 0
     mask_buffer->ZeroPadding();
@@ -92,6 +154,8 @@ std::shared_ptr<arrow::Buffer> fetch_mask_buffer(column_view input_view,
  * @brief Functor to convert cudf column to arrow array
  */
 struct dispatch_to_arrow {
+  host_copies& copies;
+
   /**
    * @brief Creates vector Arrays from given cudf column children
    */
@@ -107,9 +171,14 @@ struct dispatch_to_arrow {
       input_view.child_end(),
       metadata.begin(),
       std::back_inserter(child_arrays),
-      [&ar_mr, &stream](auto const& child, auto const& meta) {
-        return type_dispatcher(
-          child.type(), dispatch_to_arrow{}, child, child.type().id(), meta, ar_mr, stream);
+      [this, &ar_mr, &stream](auto const& child, auto const& meta) {
+        return type_dispatcher(child.type(),
+                               dispatch_to_arrow{copies},
+                               child,
+                               child.type().id(),
+                               meta,
+                               ar_mr,
+                               stream);
       });
     return child_arrays;
   }
@@ -130,8 +199,8 @@ struct dispatch_to_arrow {
   {
     return to_arrow_array(id,
                           static_cast<int64_t>(input_view.size()),
-                          fetch_data_buffer<T>(input_view, ar_mr, stream),
-                          fetch_mask_buffer(input_view, ar_mr, stream),
+                          fetch_data_buffer<T>(input_view, ar_mr, copies),
+                          fetch_mask_buffer(input_view, ar_mr, copies, stream),
                           static_cast<int64_t>(input_view.null_count()));
   }
 };
@@ -151,7 +220,8 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<numeric::decimal64>(
 
   auto count = thrust::make_counting_iterator(0);
 
-  thrust::for_each(count,
+  thrust::for_each(rmm::exec_policy(stream),
+                   count,
                    count + input.size(),
                    [in = input.begin<DeviceType>(), out = buf.data()] __device__(auto in_idx) {
                      auto const out_idx = in_idx * 2;
@@ -161,15 +231,12 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<numeric::decimal64>(
 
   auto const buf_size_in_bytes = buf.size() * sizeof(DeviceType);
   auto data_buffer             = allocate_arrow_buffer(buf_size_in_bytes, ar_mr);
-
-  CUDA_TRY(cudaMemcpyAsync(data_buffer->mutable_data(),
-                           buf.data(),
-                           buf_size_in_bytes,
-                           cudaMemcpyDeviceToHost,
-                           stream.value()));
+  copies.add(data_buffer->mutable_data(),
+             copies.buffers.emplace_back(buf.release()).data(),
+             buf_size_in_bytes);
 
   auto type    = arrow::decimal(18, -input.type().scale());
-  auto mask    = fetch_mask_buffer(input, ar_mr, stream);
+  auto mask    = fetch_mask_buffer(input, ar_mr, copies, stream);
   auto buffers = std::vector<std::shared_ptr<arrow::Buffer>>{mask, std::move(data_buffer)};
   auto data    = std::make_shared<arrow::ArrayData>(type, input.size(), buffers);
 
@@ -195,15 +262,12 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<numeric::decimal128>
 
   auto const buf_size_in_bytes = buf.size() * sizeof(DeviceType);
   auto data_buffer             = allocate_arrow_buffer(buf_size_in_bytes, ar_mr);
-
-  CUDA_TRY(cudaMemcpyAsync(data_buffer->mutable_data(),
-                           buf.data(),
-                           buf_size_in_bytes,
-                           cudaMemcpyDeviceToHost,
-                           stream.value()));
+  copies.add(data_buffer->mutable_data(),
+             copies.buffers.emplace_back(buf.release()).data(),
+             buf_size_in_bytes);
 
   auto type    = arrow::decimal(18, -input.type().scale());
-  auto mask    = fetch_mask_buffer(input, ar_mr, stream);
+  auto mask    = fetch_mask_buffer(input, ar_mr, copies, stream);
   auto buffers = std::vector<std::shared_ptr<arrow::Buffer>>{mask, std::move(data_buffer)};
   auto data    = std::make_shared<arrow::ArrayData>(type, input.size(), buffers);
 
@@ -217,19 +281,15 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<bool>(column_view in
                                                                   arrow::MemoryPool* ar_mr,
                                                                   rmm::cuda_stream_view stream)
 {
-  auto bitmask = bools_to_mask(input, stream);
+  auto& bitmask = copies.buffers.emplace_back(std::move(*bools_to_mask(input, stream).first));
 
-  auto data_buffer = allocate_arrow_buffer(static_cast<int64_t>(bitmask.first->size()), ar_mr);
+  auto data_buffer = allocate_arrow_buffer(static_cast<int64_t>(bitmask.size()), ar_mr);
+  copies.add(data_buffer->mutable_data(), bitmask.data(), bitmask.size());
 
-  CUDA_TRY(cudaMemcpyAsync(data_buffer->mutable_data(),
-                           bitmask.first->data(),
-                           bitmask.first->size(),
-                           cudaMemcpyDeviceToHost,
-                           stream.value()));
   return to_arrow_array(id,
                         static_cast<int64_t>(input.size()),
                         std::move(data_buffer),
-                        fetch_mask_buffer(input, ar_mr, stream),
+                        fetch_mask_buffer(input, ar_mr, copies, stream),
                         static_cast<int64_t>(input.null_count()));
 }
 
@@ -241,13 +301,11 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::string_view>(
   arrow::MemoryPool* ar_mr,
   rmm::cuda_stream_view stream)
 {
-  std::unique_ptr<column> tmp_column =
+  column_view input_view =
     ((input.offset() != 0) or
      ((input.num_children() == 2) and (input.child(0).size() - 1 != input.size())))
-      ? std::make_unique<cudf::column>(input, stream)
-      : nullptr;
-
-  column_view input_view = (tmp_column != nullptr) ? tmp_column->view() : input;
+      ? copies.columns.emplace_back(std::make_unique<cudf::column>(input, stream))->view()
+      : input;
   auto child_arrays      = fetch_child_array(input_view, {{}, {}}, ar_mr, stream);
   if (child_arrays.empty()) {
     // Empty string will have only one value in offset of 4 bytes
@@ -263,7 +321,7 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::string_view>(
   return std::make_shared<arrow::StringArray>(static_cast<int64_t>(input_view.size()),
                                               offset_buffer,
                                               data_buffer,
-                                              fetch_mask_buffer(input_view, ar_mr, stream),
+                                              fetch_mask_buffer(input_view, ar_mr, copies, stream),
                                               static_cast<int64_t>(input_view.null_count()));
 }
 
@@ -277,13 +335,12 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::struct_view>(
 {
   CUDF_EXPECTS(metadata.children_meta.size() == static_cast<std::size_t>(input.num_children()),
                "Number of field names and number of children doesn't match\n");
-  std::unique_ptr<column> tmp_column = nullptr;
-
-  if (input.offset() != 0) { tmp_column = std::make_unique<cudf::column>(input, stream); }
-
-  column_view input_view = (tmp_column != nullptr) ? tmp_column->view() : input;
-  auto child_arrays      = fetch_child_array(input_view, metadata.children_meta, ar_mr, stream);
-  auto mask              = fetch_mask_buffer(input_view, ar_mr, stream);
+  column_view input_view =
+    (input.offset() != 0)
+      ? copies.columns.emplace_back(std::make_unique<cudf::column>(input, stream))->view()
+      : input;
+  auto child_arrays = fetch_child_array(input_view, metadata.children_meta, ar_mr, stream);
+  auto mask         = fetch_mask_buffer(input_view, ar_mr, copies, stream);
 
   std::vector<std::shared_ptr<arrow::Field>> fields;
   std::transform(child_arrays.cbegin(),
@@ -311,13 +368,11 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::list_view>(
   arrow::MemoryPool* ar_mr,
   rmm::cuda_stream_view stream)
 {
-  std::unique_ptr<column> tmp_column = nullptr;
-  if ((input.offset() != 0) or
-      ((input.num_children() == 2) and (input.child(0).size() - 1 != input.size()))) {
-    tmp_column = std::make_unique<cudf::column>(input, stream);
-  }
-
-  column_view input_view = (tmp_column != nullptr) ? tmp_column->view() : input;
+  column_view input_view =
+    ((input.offset() != 0) or
+     ((input.num_children() == 2) and (input.child(0).size() - 1 != input.size())))
+      ? copies.columns.emplace_back(std::make_unique<cudf::column>(input, stream))->view()
+      : input;
   auto children_meta =
     metadata.children_meta.empty() ? std::vector<column_metadata>{{}, {}} : metadata.children_meta;
   auto child_arrays = fetch_child_array(input_view, children_meta, ar_mr, stream);
@@ -331,7 +386,7 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::list_view>(
                                             static_cast<int64_t>(input_view.size()),
                                             offset_buffer,
                                             data,
-                                            fetch_mask_buffer(input_view, ar_mr, stream),
+                                            fetch_mask_buffer(input_view, ar_mr, copies, stream),
                                             static_cast<int64_t>(input_view.null_count()));
 }
 
@@ -344,17 +399,17 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::dictionary32>(
   rmm::cuda_stream_view stream)
 {
   // Arrow dictionary requires indices to be signed integer
-  std::unique_ptr<column> dict_indices =
+  auto const& dict_indices = copies.columns.emplace_back(
     cast(cudf::dictionary_column_view(input).get_indices_annotated(),
          cudf::data_type{type_id::INT32},
          stream,
-         rmm::mr::get_current_device_resource());
-  auto indices = dispatch_to_arrow{}.operator()<int32_t>(
+         rmm::mr::get_current_device_resource()));
+  auto indices = dispatch_to_arrow{copies}.operator()<int32_t>(
     dict_indices->view(), dict_indices->type().id(), {}, ar_mr, stream);
   auto dict_keys = cudf::dictionary_column_view(input).keys();
   auto dictionary =
     type_dispatcher(dict_keys.type(),
-                    dispatch_to_arrow{},
+                    dispatch_to_arrow{copies},
                     dict_keys,
                     dict_keys.type().id(),
                     metadata.children_meta.empty() ? column_metadata{} : metadata.children_meta[0],
@@ -376,6 +431,7 @@ std::shared_ptr<arrow::Table> to_arrow(table_view input,
 
   std::vector<std::shared_ptr<arrow::Array>> arrays;
   std::vector<std::shared_ptr<arrow::Field>> fields;
+  detail::host_copies copies;
 
   std::transform(
     input.begin(),
@@ -384,8 +440,13 @@ std::shared_ptr<arrow::Table> to_arrow(table_view input,
     std::back_inserter(arrays),
     [&](auto const& c, auto const& meta) {
       return c.type().id() != type_id::EMPTY
-               ? type_dispatcher(
-                   c.type(), detail::dispatch_to_arrow{}, c, c.type().id(), meta, ar_mr, stream)
+               ? type_dispatcher(c.type(),
+                                 detail::dispatch_to_arrow{copies},
+                                 c,
+                                 c.type().id(),
+                                 meta,
+                                 ar_mr,
+                                 stream)
                : std::make_shared<arrow::NullArray>(c.size());
     });
 
@@ -398,9 +459,10 @@ std::shared_ptr<arrow::Table> to_arrow(table_view input,
 
   auto result = arrow::Table::Make(arrow::schema(fields), arrays);
 
-  // synchronize the stream because after the return the data may be accessed from the host before
-  // the above `cudaMemcpyAsync` calls have completed their copies (especially if pinned host
-  // memory is used).
+  // all the buffers are copied at once, and the stream is synchronized because after the return
+  // the data may be accessed from the host before the copies have completed (especially if pinned
+  // host memory is used).
+  copies.copy(stream);
   stream.synchronize();
 
   return result;
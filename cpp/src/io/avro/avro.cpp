@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -47,6 +47,7 @@ std::string container::get_encoded()
 {
   auto const len = [&] {
     auto const len = get_encoded<uint64_t>();
+    if (not(len & 1) && (len >> 1) > static_cast<uint64_t>(m_end - m_cur)) { m_past_end = true; }
     return (len & 1) || (m_cur >= m_end) ? 0
                                          : std::min(len >> 1, static_cast<uint64_t>(m_end - m_cur));
   }();
@@ -56,19 +57,19 @@ std::string container::get_encoded()
 }
 
 /**
- * @brief AVRO file metadata parser
+ * @brief AVRO file header parser
+ *
+ * Parses the header of the file, which ends with the sync marker ending every data block, and
+ * extracts the columns of its schema. The data blocks that follow are found on the device.
  *
  * @param[out] md parsed avro file metadata
- * @param[in] max_num_rows maximum number of rows
- * @param[in] first_row drop blocks below first_row
  *
  * @returns true if successful, false if error
  */
-bool container::parse(file_metadata* md, size_t max_num_rows, size_t first_row)
+bool container::parse(file_metadata* md)
 {
   constexpr uint32_t avro_magic = (('O' << 0) | ('b' << 8) | ('j' << 16) | (0x01 << 24));
-  uint32_t sig4, max_block_size;
-  size_t total_object_count;
+  uint32_t sig4;
 
   sig4 = get_raw<uint8_t>();
   sig4 |= get_raw<uint8_t>() << 8;
@@ -76,9 +77,13 @@ bool container::parse(file_metadata* md, size_t max_num_rows, size_t first_row)
   sig4 |= get_raw<uint8_t>() << 24;
   if (sig4 != avro_magic) { return false; }
   for (;;) {
-    auto num_md_items = static_cast<uint32_t>(get_encoded<int64_t>());
+    auto num_md_items = get_encoded<int64_t>();
     if (num_md_items == 0) { break; }
-    for (uint32_t i = 0; i < num_md_items; i++) {
+    if (num_md_items < 0) {
+      get_encoded<int64_t>();  // block size in bytes, ignored
+      num_md_items = -num_md_items;
+    }
+    for (int64_t i = 0; i < num_md_items && !m_past_end; i++) {
       auto const key   = get_encoded<std::string>();
       auto const value = get_encoded<std::string>();
       if (key == "avro.codec") {
@@ -91,37 +96,13 @@ bool container::parse(file_metadata* md, size_t max_num_rows, size_t first_row)
         md->user_data.emplace(key, value);
       }
     }
+    if (m_past_end) { return false; }
   }
   md->sync_marker[0] = get_raw<uint64_t>();
   md->sync_marker[1] = get_raw<uint64_t>();
+  if (m_past_end) { return false; }
 
-  md->metadata_size  = m_cur - m_base;
-  md->skip_rows      = 0;
-  max_block_size     = 0;
-  total_object_count = 0;
-  while (m_cur + 18 < m_end && total_object_count < max_num_rows) {
-    auto const object_count = static_cast<uint32_t>(get_encoded<int64_t>());
-    auto const block_size   = static_cast<uint32_t>(get_encoded<int64_t>());
-    if (block_size <= 0 || object_count <= 0 || m_cur + block_size + 16 > m_end) { break; }
-    if (object_count > first_row) {
-      auto block_row = static_cast<uint32_t>(total_object_count);
-      max_block_size = std::max(max_block_size, block_size);
-      total_object_count += object_count;
-      if (!md->block_list.size()) {
-        md->skip_rows = static_cast<uint32_t>(first_row);
-        total_object_count -= first_row;
-        first_row = 0;
-      }
-      md->block_list.emplace_back(m_cur - m_base, block_size, block_row, object_count);
-    } else {
-      first_row -= object_count;
-    }
-    m_cur += block_size;
-    m_cur += 16;  // TODO: Validate sync marker
-  }
-  md->max_block_size  = max_block_size;
-  md->num_rows        = total_object_count;
-  md->total_data_size = m_cur - (m_base + md->metadata_size);
+  md->metadata_size = m_cur - m_base;
   // Extract columns
   for (size_t i = 0; i < md->schema.size(); i++) {
     type_kind_e kind = md->schema[i].kind;
@@ -202,6 +183,11 @@ bool schema_parser::parse(std::vector<schema_entry>& schema, const std::string&
   if (json_str == "[]") return true;
 
   char depthbuf[MAX_SCHEMA_DEPTH];
+  // Parent and current entries when each object was opened, restored when it is closed
+  int parentbuf[MAX_SCHEMA_DEPTH];
+  int entrybuf[MAX_SCHEMA_DEPTH];
+  // depth of the object defining each entry; names at deeper levels are those of its type
+  std::vector<int> entry_depths;
   int depth = 0, parent_idx = -1, entry_idx = -1;
   json_state_e state = state_attrname;
   std::string str;
@@ -244,6 +230,7 @@ bool schema_parser::parse(std::vector<schema_entry>& schema, const std::string&
           if (entry_idx < 0) {
             entry_idx = static_cast<int>(schema.size());
             schema.emplace_back(type_not_set, parent_idx);
+            entry_depths.push_back(depth);
             if (parent_idx >= 0) { schema[parent_idx].num_children++; }
           }
           if (cur_attr == attrtype_type) {
@@ -252,7 +239,15 @@ bool schema_parser::parse(std::vector<schema_entry>& schema, const std::string&
             schema[entry_idx].kind = t->second;
           } else if (cur_attr == attrtype_name) {
             if (entry_idx < 0) return false;
+            if (depth == entry_depths[entry_idx]) { schema[entry_idx].field_name = str; }
             schema[entry_idx].name = std::move(str);
+          } else if (cur_attr == attrtype_items && schema[entry_idx].kind == type_array) {
+            // Array of a primitive type, given by its name
+            auto t = typenames.find(str);
+            if (t == typenames.end() || t->second >= type_record) return false;
+            schema.emplace_back(t->second, entry_idx);
+            entry_depths.push_back(depth);
+            schema[entry_idx].num_children++;
           }
           if (state == state_attrvalue_last) { entry_idx = -1; }
           state    = state_nextattr;
@@ -272,16 +267,20 @@ bool schema_parser::parse(std::vector<schema_entry>& schema, const std::string&
           state = state_attrname;
         }
         break;
-      case '{':
+      case '{': {
+        auto const outer_parent_idx = parent_idx;
         if (state == state_attrvalue && cur_attr == attrtype_type) {
           if (entry_idx < 0) {
             entry_idx = static_cast<int>(schema.size());
             schema.emplace_back(type_record, parent_idx);
+            entry_depths.push_back(depth);
             if (parent_idx >= 0) { schema[parent_idx].num_children++; }
           }
           cur_attr = attrtype_none;
           state    = state_attrname;
-        } else if (state == state_attrvalue && cur_attr == attrtype_items && entry_idx >= 0) {
+        }
+        auto const outer_entry_idx = entry_idx;
+        if (state == state_attrvalue && cur_attr == attrtype_items && entry_idx >= 0) {
           // Treat array as a one-field record
           parent_idx = entry_idx;
           entry_idx  = -1;
@@ -289,16 +288,16 @@ bool schema_parser::parse(std::vector<schema_entry>& schema, const std::string&
           state      = state_attrname;
         }
         if (depth >= MAX_SCHEMA_DEPTH || state != state_attrname) { return false; }
+        parentbuf[depth]  = outer_parent_idx;
+        entrybuf[depth]   = outer_entry_idx;
         depthbuf[depth++] = '{';
         break;
+      }
       case '}':
         if (depth == 0 || state != state_nextattr || depthbuf[depth - 1] != '{') return false;
         --depth;
-        if (entry_idx < 0) {
-          parent_idx = (parent_idx >= 0) ? schema[parent_idx].parent_idx : -1;
-        } else {
-          entry_idx = -1;
-        }
+        parent_idx = parentbuf[depth];
+        entry_idx  = entrybuf[depth];
         break;
       case '[':
         if (state == state_attrname && cur_attr == attrtype_none) {
@@ -314,6 +313,7 @@ bool schema_parser::parse(std::vector<schema_entry>& schema, const std::string&
           if (entry_idx < 0 || schema[entry_idx].kind != type_not_set) {
             entry_idx = static_cast<int>(schema.size());
             schema.emplace_back(type_union, parent_idx);
+            entry_depths.push_back(depth);
             if (parent_idx >= 0) { schema[parent_idx].num_children++; }
           } else {
             schema[entry_idx].kind = type_union;
@@ -39,10 +39,11 @@ struct schema_entry {
     : parent_idx(parent_idx_), num_children(num_children_), kind(kind_)
   {
   }
-  int32_t parent_idx   = -1;  // index of parent entry in schema array, negative if no parent
-  int32_t num_children = 0;
-  type_kind_e kind     = type_not_set;
-  std::string name     = "";
+  int32_t parent_idx     = -1;  // index of parent entry in schema array, negative if no parent
+  int32_t num_children   = 0;
+  type_kind_e kind       = type_not_set;
+  std::string name       = "";  // name of the field, or of the record type for records
+  std::string field_name = "";  // name of the field, even if its type is a named record
   std::vector<std::string> symbols;
 };
 
@@ -105,10 +106,19 @@ class container {
 
   [[nodiscard]] auto bytecount() const { return m_cur - m_base; }
 
+  /**
+   * @brief Whether a value was read past the end of the data, which may only hold a prefix of the
+   * file
+   */
+  [[nodiscard]] bool is_past_end() const { return m_past_end; }
+
   template <typename T>
   T get_raw()
   {
-    if (m_cur + sizeof(T) > m_end) return T{};
+    if (m_cur + sizeof(T) > m_end) {
+      m_past_end = true;
+      return T{};
+    }
     T val;
     memcpy(&val, m_cur, sizeof(T));
     m_cur += sizeof(T);
@@ -119,12 +129,13 @@ class container {
   T get_encoded();
 
  public:
-  bool parse(file_metadata* md, size_t max_num_rows = 0x7fffffff, size_t first_row = 0);
+  bool parse(file_metadata* md);
 
  protected:
   const uint8_t* m_base;
   const uint8_t* m_cur;
   const uint8_t* m_end;
+  bool m_past_end = false;
 };
 
 }  // namespace avro
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,7 +17,21 @@
 
 #include <io/utilities/block_utils.cuh>
 
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/error.hpp>
+
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <limits>
+#include <string>
 
 using cudf::device_span;
 
@@ -62,6 +76,7 @@ static inline int64_t __device__ avro_decode_zigzag_varint(const uint8_t*& cur,
  * @param[in] cur Current input data pointer
  * @param[in] end End of input data
  * @param[in] global_Dictionary Global dictionary entries
+ * @param[in] count_items Whether to count the items of the arrays rather than decode the values
  *
  * @return data pointer at the end of the row (start of next row)
  */
@@ -73,10 +88,15 @@ avro_decode_row(schemadesc_s const* schema,
                 size_t max_rows,
                 uint8_t const* cur,
                 uint8_t const* end,
-                device_span<string_index_pair const> global_dictionary)
+                device_span<string_index_pair const> global_dictionary,
+                bool count_items)
 {
   uint32_t array_start = 0, array_repeat_count = 0;
   int array_children = 0;
+  // Whether the array is entered again to read the count of its next block of items
+  bool array_reentry = false;
+  // Index of the array item in the output, for arrays read as lists
+  size_t item = row;
   for (uint32_t i = 0; i < schema_len;) {
     uint32_t kind = schema[i].kind;
     int skip      = 0;
@@ -97,11 +117,12 @@ avro_decode_row(schemadesc_s const* schema,
       skip = skip_after;
     }
 
-    void* dataptr = schema[i].dataptr;
+    void* dataptr  = schema[i].dataptr;
+    auto const idx = (array_repeat_count != 0) ? item : row;
     switch (kind) {
       case type_null:
         if (dataptr != nullptr && row < max_rows) {
-          atomicAnd(static_cast<uint32_t*>(dataptr) + (row >> 5), ~(1 << (row & 0x1f)));
+          atomicAnd(static_cast<uint32_t*>(dataptr) + (idx >> 5), ~(1 << (idx & 0x1f)));
           atomicAdd(&schema_g[i].count, 1);
         }
         break;
@@ -114,10 +135,10 @@ avro_decode_row(schemadesc_s const* schema,
         int64_t v = avro_decode_zigzag_varint(cur, end);
         if (kind == type_int) {
           if (dataptr != nullptr && row < max_rows) {
-            static_cast<int32_t*>(dataptr)[row] = static_cast<int32_t>(v);
+            static_cast<int32_t*>(dataptr)[idx] = static_cast<int32_t>(v);
           }
         } else if (kind == type_long) {
-          if (dataptr != nullptr && row < max_rows) { static_cast<int64_t*>(dataptr)[row] = v; }
+          if (dataptr != nullptr && row < max_rows) { static_cast<int64_t*>(dataptr)[idx] = v; }
         } else {  // string or enum
           size_t count    = 0;
           const char* ptr = nullptr;
@@ -133,8 +154,8 @@ avro_decode_row(schemadesc_s const* schema,
             cur += count;
           }
           if (dataptr != nullptr && row < max_rows) {
-            static_cast<string_index_pair*>(dataptr)[row].first  = ptr;
-            static_cast<string_index_pair*>(dataptr)[row].second = count;
+            static_cast<string_index_pair*>(dataptr)[idx].first  = ptr;
+            static_cast<string_index_pair*>(dataptr)[idx].second = count;
           }
         }
       } break;
@@ -148,7 +169,7 @@ avro_decode_row(schemadesc_s const* schema,
           } else {
             v = 0;
           }
-          static_cast<uint32_t*>(dataptr)[row] = v;
+          static_cast<uint32_t*>(dataptr)[idx] = v;
         } else {
           cur += 4;
         }
@@ -163,7 +184,7 @@ avro_decode_row(schemadesc_s const* schema,
           } else {
             v = 0;
           }
-          static_cast<uint64_t*>(dataptr)[row] = v;
+          static_cast<uint64_t*>(dataptr)[idx] = v;
         } else {
           cur += 8;
         }
@@ -172,7 +193,7 @@ avro_decode_row(schemadesc_s const* schema,
       case type_boolean:
         if (dataptr != nullptr && row < max_rows) {
           uint8_t v                           = (cur < end) ? *cur : 0;
-          static_cast<uint8_t*>(dataptr)[row] = (v) ? 1 : 0;
+          static_cast<uint8_t*>(dataptr)[idx] = (v) ? 1 : 0;
         }
         cur++;
         break;
@@ -183,6 +204,16 @@ avro_decode_row(schemadesc_s const* schema,
           avro_decode_zigzag_varint(cur, end);  // block size in bytes, ignored
           array_block_count = -array_block_count;
         }
+        // For arrays read as lists, count the items of each row, then write them from its offset
+        if (dataptr != nullptr && row < max_rows) {
+          auto const offsets = static_cast<size_type*>(dataptr);
+          if (count_items) {
+            offsets[row] += array_block_count;
+          } else if (!array_reentry) {
+            item = offsets[row];
+          }
+        }
+        array_reentry      = false;
         array_start        = i;
         array_repeat_count = array_block_count;
         array_children     = 1;
@@ -203,8 +234,10 @@ avro_decode_row(schemadesc_s const* schema,
     }
     // If within an array, check if we reached the last item
     if (array_repeat_count != 0 && array_children <= 0 && cur < end) {
+      if (schema[array_start].dataptr != nullptr && !count_items) { ++item; }
       if (!--array_repeat_count) {
-        i = array_start;  // Restart at the array parent
+        i             = array_start;  // Restart at the array parent
+        array_reentry = true;
       } else {
         i              = array_start + 1;  // Restart after the array parent
         array_children = schema[array_start].count;
@@ -225,6 +258,7 @@ avro_decode_row(schemadesc_s const* schema,
  * @param[in] min_row_size Minimum size in bytes of a row
  * @param[in] max_rows Maximum number of rows to load
  * @param[in] first_row Crop all rows below first_row
+ * @param[in] count_items Whether to count the items of the arrays rather than decode the values
  */
 // blockDim {32,num_warps,1}
 extern "C" __global__ void __launch_bounds__(num_warps * 32, 2)
@@ -235,7 +269,8 @@ extern "C" __global__ void __launch_bounds__(num_warps * 32, 2)
                           uint32_t schema_len,
                           uint32_t min_row_size,
                           size_t max_rows,
-                          size_t first_row)
+                          size_t first_row,
+                          bool count_items)
 {
   __shared__ __align__(8) schemadesc_s g_shared_schema[max_shared_schema_len];
   __shared__ __align__(8) block_desc_s blk_g[num_warps];
@@ -283,7 +318,8 @@ extern "C" __global__ void __launch_bounds__(num_warps * 32, 2)
                             max_rows,
                             cur,
                             end,
-                            global_dictionary);
+                            global_dictionary,
+                            count_items);
     }
     if (nrows <= 1) {
       cur = start + shuffle(static_cast<uint32_t>(cur - start));
@@ -307,6 +343,7 @@ extern "C" __global__ void __launch_bounds__(num_warps * 32, 2)
  * @param[in] max_rows Maximum number of rows to load
  * @param[in] first_row Crop all rows below first_row
  * @param[in] min_row_size Minimum size in bytes of a row
+ * @param[in] count_items Whether to count the items of the arrays rather than decode the values
  * @param[in] stream CUDA stream to use, default 0
  */
 void DecodeAvroColumnData(device_span<block_desc_s const> blocks,
@@ -317,6 +354,7 @@ void DecodeAvroColumnData(device_span<block_desc_s const> blocks,
                           size_t max_rows,
                           size_t first_row,
                           uint32_t min_row_size,
+                          bool count_items,
                           rmm::cuda_stream_view stream)
 {
   // num_warps warps per threadblock
@@ -325,7 +363,115 @@ void DecodeAvroColumnData(device_span<block_desc_s const> blocks,
   dim3 const dim_grid((blocks.size() + num_warps - 1) / num_warps, 1);
 
   gpuDecodeAvroColumnData<<<dim_grid, dim_block, 0, stream.value()>>>(
-    blocks, schema, global_dictionary, avro_data, schema_len, min_row_size, max_rows, first_row);
+    blocks,
+    schema,
+    global_dictionary,
+    avro_data,
+    schema_len,
+    min_row_size,
+    max_rows,
+    first_row,
+    count_items);
+}
+
+namespace {
+
+constexpr size_t sync_marker_size = 16;
+
+/**
+ * @brief Header of a data block candidate
+ */
+struct block_header_s {
+  int64_t num_objects;  // number of objects in the block
+  int64_t size;         // size in bytes of the serialized objects
+  size_t data_offset;   // offset of the serialized objects
+};
+
+}  // namespace
+
+/**
+ * @brief Finds the data blocks following the header of an Avro file
+ *
+ * The sync markers are searched for in parallel, and the header of the block following each of
+ * them is decoded. The chain of blocks is then followed from the first one, each block having to
+ * end with a sync marker.
+ *
+ * @param[in] data Data following the header of the file
+ * @param[in] sync_marker Sync marker of the file
+ * @param[in] stream CUDA stream to use
+ *
+ * @return Description of the non-empty blocks, with offsets relative to `data`
+ */
+std::vector<block_desc_s> FindAvroBlocks(device_span<uint8_t const> data,
+                                         uint64_t const sync_marker[2],
+                                         rmm::cuda_stream_view stream)
+{
+  if (data.empty()) { return {}; }
+
+  auto const num_positions =
+    (data.size() >= sync_marker_size) ? data.size() - sync_marker_size + 1 : 0;
+  auto const is_sync_marker =
+    [data = data.data(), lo = sync_marker[0], hi = sync_marker[1]] __device__(size_t pos) {
+      return unaligned_load64(data + pos) == lo && unaligned_load64(data + pos + 8) == hi;
+    };
+  auto const num_markers = thrust::count_if(rmm::exec_policy(stream),
+                                            thrust::make_counting_iterator<size_t>(0),
+                                            thrust::make_counting_iterator(num_positions),
+                                            is_sync_marker);
+  rmm::device_uvector<size_t> markers(num_markers, stream);
+  thrust::copy_if(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator<size_t>(0),
+                  thrust::make_counting_iterator(num_positions),
+                  markers.begin(),
+                  is_sync_marker);
+
+  // A block starts at the beginning of the data, and may start after each sync marker
+  rmm::device_uvector<block_header_s> headers(num_markers + 1, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_t>(0),
+                    thrust::make_counting_iterator<size_t>(headers.size()),
+                    headers.begin(),
+                    [data = data, markers = markers.data()] __device__(size_t i) {
+                      auto const start = (i == 0) ? 0 : markers[i - 1] + sync_marker_size;
+                      auto cur         = data.data() + start;
+                      auto end         = data.data() + data.size();
+                      block_header_s header;
+                      header.num_objects = avro_decode_zigzag_varint(cur, end);
+                      header.size        = avro_decode_zigzag_varint(cur, end);
+                      header.data_offset = cur - data.data();
+                      return header;
+                    });
+
+  auto const h_markers = cudf::detail::make_std_vector_async(markers, stream);
+  auto const h_headers = cudf::detail::make_std_vector_sync(headers, stream);
+
+  std::vector<block_desc_s> blocks;
+  for (size_t start = 0, header_idx = 0; start < data.size();) {
+    auto const& header = h_headers[header_idx];
+    if (header.num_objects < 0 || header.size < 0 ||
+        header.size > std::numeric_limits<uint32_t>::max()) {
+      CUDF_FAIL("Corrupted Avro block header at offset " + std::to_string(start));
+    }
+    auto const block_end = header.data_offset + header.size;
+    if (block_end + sync_marker_size > data.size()) {
+      CUDF_FAIL("Truncated Avro block at offset " + std::to_string(start));
+    }
+    auto const marker = std::lower_bound(h_markers.begin(), h_markers.end(), block_end);
+    if (marker == h_markers.end() || *marker != block_end) {
+      CUDF_FAIL("Sync marker mismatch after the Avro block at offset " + std::to_string(start));
+    }
+    if (header.num_objects > 0) {
+      CUDF_EXPECTS(header.num_objects <= std::numeric_limits<uint32_t>::max(),
+                   "Too many objects in an Avro block");
+      blocks.emplace_back(header.data_offset,
+                          static_cast<uint32_t>(header.size),
+                          0,
+                          static_cast<uint32_t>(header.num_objects));
+    }
+    header_idx = (marker - h_markers.begin()) + 1;
+    start      = block_end + sync_marker_size;
+  }
+  return blocks;
 }
 
 }  // namespace gpu
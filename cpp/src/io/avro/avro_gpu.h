@@ -21,6 +21,8 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <vector>
+
 namespace cudf {
 namespace io {
 namespace avro {
@@ -33,7 +35,8 @@ struct schemadesc_s {
   uint32_t kind;   // avro type kind
   uint32_t count;  // for records/unions: number of following child columns, for nulls: global
                    // null_count, for enums: dictionary ofs
-  void* dataptr;   // Ptr to column data, or null if column not selected
+  void* dataptr;   // Ptr to column data, or null if column not selected; for arrays read as
+                   // lists, ptr to the list offsets
 };
 
 /**
@@ -47,6 +50,7 @@ struct schemadesc_s {
  * @param[in] max_rows Maximum number of rows to load
  * @param[in] first_row Crop all rows below first_row
  * @param[in] min_row_size Minimum size in bytes of a row
+ * @param[in] count_items Whether to count the items of the arrays rather than decode the values
  * @param[in] stream CUDA stream to use
  */
 void DecodeAvroColumnData(cudf::device_span<block_desc_s const> blocks,
@@ -57,8 +61,24 @@ void DecodeAvroColumnData(cudf::device_span<block_desc_s const> blocks,
                           size_t max_rows,
                           size_t first_row,
                           uint32_t min_row_size,
+                          bool count_items,
                           rmm::cuda_stream_view stream);
 
+/**
+ * @brief Finds the data blocks following the header of an Avro file
+ *
+ * @throws cudf::logic_error if a block is truncated or does not end with the sync marker
+ *
+ * @param[in] data Data following the header of the file
+ * @param[in] sync_marker Sync marker of the file
+ * @param[in] stream CUDA stream to use
+ *
+ * @return Description of the non-empty blocks, with offsets relative to `data`
+ */
+std::vector<block_desc_s> FindAvroBlocks(cudf::device_span<uint8_t const> data,
+                                         uint64_t const sync_marker[2],
+                                         rmm::cuda_stream_view stream);
+
 }  // namespace gpu
 }  // namespace avro
 }  // namespace io
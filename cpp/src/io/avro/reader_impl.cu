@@ -18,6 +18,7 @@
 #include "avro_gpu.h"
 #include "thrust/iterator/transform_output_iterator.h"
 
+#include <io/comp/decompression.hpp>
 #include <io/comp/gpuinflate.h>
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
@@ -37,8 +38,11 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/scan.h>
+
 #include <nvcomp/snappy.h>
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -74,6 +78,33 @@ type_id to_type_id(avro::schema_entry const* col)
   }
 }
 
+/**
+ * @brief Returns the index of the schema entry following an entry and its descendants
+ */
+int next_sibling(std::vector<schema_entry> const& schema, int idx)
+{
+  int skip = 1;
+  do {
+    skip += schema[idx].num_children - 1;
+    ++idx;
+  } while (skip != 0);
+  return idx;
+}
+
+/**
+ * @brief Returns the index of the null member of the union holding an entry, or -1 if none
+ */
+int null_member(std::vector<schema_entry> const& schema, int idx)
+{
+  auto const parent_idx = schema[idx].parent_idx;
+  if (parent_idx < 0 || schema[parent_idx].kind != avro::type_union) { return -1; }
+  for (int i = 0, child = parent_idx + 1; i < schema[parent_idx].num_children; ++i) {
+    if (schema[child].kind == avro::type_null) { return child; }
+    child = next_sibling(schema, child);
+  }
+  return -1;
+}
+
 }  // namespace
 
 /**
@@ -85,18 +116,61 @@ class metadata : public file_metadata {
   explicit metadata(datasource* const src) : source(src) {}
 
   /**
-   * @brief Initializes the parser and filters down to a subset of rows
+   * @brief Initializes the parser from the header of the file
    *
+   * Only the header is read on the host. It is usually much smaller than the first read, which is
+   * doubled until it holds the whole header.
+   */
+  void init()
+  {
+    constexpr size_t initial_header_read_size = 64 * 1024;
+    for (auto read_size = std::min(initial_header_read_size, source->size());;
+         read_size      = std::min(2 * read_size, source->size())) {
+      auto const buffer                  = source->host_read(0, read_size);
+      static_cast<file_metadata&>(*this) = file_metadata{};
+      avro::container pod(buffer->data(), buffer->size());
+      if (pod.parse(this)) { break; }
+      CUDF_EXPECTS(pod.is_past_end() && read_size < source->size(), "Cannot parse metadata");
+    }
+  }
+
+  /**
+   * @brief Finds the data blocks and filters down to those holding a subset of rows
+   *
+   * @param[in] data Data following the header of the file
    * @param[in,out] row_start Starting row of the selection
    * @param[in,out] row_count Total number of rows selected
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches
    */
-  void init_and_select_rows(int& row_start, int& row_count)
+  void select_rows(device_span<uint8_t const> data,
+                   int& row_start,
+                   int& row_count,
+                   rmm::cuda_stream_view stream)
   {
-    auto const buffer = source->host_read(0, source->size());
-    avro::container pod(buffer->data(), buffer->size());
-    CUDF_EXPECTS(pod.parse(this, row_count, row_start), "Cannot parse metadata");
+    auto const max_num_rows = static_cast<size_t>(row_count);
+    size_t first_row        = row_start;
+    // Number of rows in the selected blocks
+    size_t block_rows = 0;
+    for (auto block : gpu::FindAvroBlocks(data, sync_marker, stream)) {
+      if (!block_list.empty() && block_rows - skip_rows >= max_num_rows) { break; }
+      if (block_list.empty()) {
+        if (block.num_rows <= first_row) {
+          first_row -= block.num_rows;
+          continue;
+        }
+        skip_rows = static_cast<uint32_t>(first_row);
+      }
+      block.first_row = static_cast<uint32_t>(block_rows);
+      block_rows += block.num_rows;
+      max_block_size = std::max(max_block_size, block.size);
+      block_list.push_back(block);
+    }
+    if (!block_list.empty()) {
+      num_rows        = std::min(block_rows - skip_rows, max_num_rows);
+      total_data_size = block_list.back().offset + block_list.back().size - block_list[0].offset;
+    }
     row_start = skip_rows;
-    row_count = num_rows;
+    row_count = static_cast<int>(num_rows);
   }
 
   /**
@@ -147,6 +221,37 @@ class metadata : public file_metadata {
     return selection;
   }
 
+  /**
+   * @brief Filters down to a selection of the fields of the root record, read as nested columns
+   *
+   * @param[in] use_names List of field names to select
+   *
+   * @return Schema index and name of each selected field
+   */
+  auto select_nested_columns(std::vector<std::string> const& use_names)
+  {
+    std::vector<std::pair<int, std::string>> fields;
+    if (schema.empty()) { return fields; }
+    if (schema[0].kind == avro::type_record) {
+      for (int i = 0, child = 1; i < schema[0].num_children; ++i) {
+        fields.emplace_back(child, schema[child].field_name);
+        child = next_sibling(schema, child);
+      }
+    } else {
+      fields.emplace_back(0, schema[0].field_name);
+    }
+    if (use_names.empty()) { return fields; }
+
+    std::vector<std::pair<int, std::string>> selection;
+    for (auto const& use_name : use_names) {
+      auto const field = std::find_if(
+        fields.begin(), fields.end(), [&](auto const& f) { return f.second == use_name; });
+      if (field != fields.end()) { selection.push_back(*field); }
+    }
+    CUDF_EXPECTS(selection.size() > 0, "Filtered out all columns");
+    return selection;
+  }
+
  private:
   datasource* const source;
 };
@@ -171,9 +276,8 @@ rmm::device_buffer decompress_data(datasource& source,
 
     rmm::device_buffer decomp_block_data(uncompressed_data_size, stream);
 
-    auto const base_offset = meta.block_list[0].offset;
     for (size_t i = 0, dst_pos = 0; i < meta.block_list.size(); i++) {
-      auto const src_pos = meta.block_list[i].offset - base_offset;
+      auto const src_pos = meta.block_list[i].offset;
 
       inflate_in[i].srcDevice = static_cast<uint8_t const*>(comp_block_data.data()) + src_pos;
       inflate_in[i].srcSize   = meta.block_list[i].size;
@@ -189,8 +293,13 @@ rmm::device_buffer decompress_data(datasource& source,
       inflate_in.host_to_device(stream);
       CUDA_TRY(
         cudaMemsetAsync(inflate_out.device_ptr(), 0, inflate_out.memory_size(), stream.value()));
-      CUDA_TRY(gpuinflate(
-        inflate_in.device_ptr(), inflate_out.device_ptr(), inflate_in.size(), 0, stream));
+      auto const max_uncomp_block_size =
+        std::max_element(inflate_in.host_ptr(),
+                         inflate_in.host_ptr() + inflate_in.size(),
+                         [](auto const& a, auto const& b) { return a.dstSize < b.dstSize; })
+          ->dstSize;
+      batched_decompress(
+        compression_type::ZLIB, inflate_in, inflate_out, max_uncomp_block_size, false, stream);
       inflate_out.device_to_host(stream, true);
 
       // Check if larger output is required, as it's not known ahead of time
@@ -224,17 +333,14 @@ rmm::device_buffer decompress_data(datasource& source,
   } else if (meta.codec == "snappy") {
     size_t const num_blocks = meta.block_list.size();
 
-    // comp_block_data contains contents of the avro file starting from the first block, excluding
-    // file header. meta.block_list[i].offset refers to offset of block i in the file, including
-    // file header.
-    // Find ptrs to each compressed block in comp_block_data by removing header offset.
+    // comp_block_data contains contents of the avro file following the file header, which
+    // meta.block_list[i].offset are relative to.
     hostdevice_vector<void const*> compressed_data_ptrs(num_blocks, stream);
     std::transform(meta.block_list.begin(),
                    meta.block_list.end(),
                    compressed_data_ptrs.host_ptr(),
                    [&](auto const& block) {
-                     return static_cast<std::byte const*>(comp_block_data.data()) +
-                            (block.offset - meta.block_list[0].offset);
+                     return static_cast<std::byte const*>(comp_block_data.data()) + block.offset;
                    });
     compressed_data_ptrs.host_to_device(stream);
 
@@ -324,29 +430,23 @@ rmm::device_buffer decompress_data(datasource& source,
   }
 }
 
-std::vector<column_buffer> decode_data(metadata& meta,
-                                       rmm::device_buffer const& block_data,
-                                       std::vector<std::pair<uint32_t, uint32_t>> const& dict,
-                                       device_span<string_index_pair const> global_dictionary,
-                                       size_t num_rows,
-                                       std::vector<std::pair<int, std::string>> const& selection,
-                                       std::vector<data_type> const& column_types,
-                                       rmm::cuda_stream_view stream,
-                                       rmm::mr::device_memory_resource* mr)
+/**
+ * @brief Builds the description of the schema used by the decode kernel, with no column selected
+ *
+ * @param[in] meta File metadata
+ * @param[out] min_row_data_size Minimum size in bytes of a row
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Schema description
+ */
+hostdevice_vector<gpu::schemadesc_s> make_schema_desc(metadata const& meta,
+                                                      uint32_t& min_row_data_size,
+                                                      rmm::cuda_stream_view stream)
 {
-  auto out_buffers = std::vector<column_buffer>();
-
-  for (size_t i = 0; i < column_types.size(); ++i) {
-    auto col_idx     = selection[i].first;
-    bool is_nullable = (meta.columns[col_idx].schema_null_idx >= 0);
-    out_buffers.emplace_back(column_types[i], num_rows, is_nullable, stream, mr);
-  }
-
-  // Build gpu schema
   auto schema_desc = hostdevice_vector<gpu::schemadesc_s>(meta.schema.size(), stream);
 
-  uint32_t min_row_data_size = 0;
-  int skip_field_cnt         = 0;
+  min_row_data_size  = 0;
+  int skip_field_cnt = 0;
 
   for (size_t i = 0; i < meta.schema.size(); i++) {
     type_kind_e kind = meta.schema[i].kind;
@@ -375,11 +475,40 @@ std::vector<column_buffer> decode_data(metadata& meta,
     schema_desc[i].count =
       (kind == type_enum) ? 0 : static_cast<uint32_t>(meta.schema[i].num_children);
     schema_desc[i].dataptr = nullptr;
-    CUDF_EXPECTS(kind != type_union || meta.schema[i].num_children < 2 ||
-                   (meta.schema[i].num_children == 2 &&
-                    (meta.schema[i + 1].kind == type_null || meta.schema[i + 2].kind == type_null)),
-                 "Union with non-null type not currently supported");
+    if (kind == type_union && meta.schema[i].num_children >= 2) {
+      auto const first_member  = static_cast<int>(i) + 1;
+      auto const second_member = next_sibling(meta.schema, first_member);
+      CUDF_EXPECTS(meta.schema[i].num_children == 2 &&
+                     (meta.schema[first_member].kind == type_null ||
+                      meta.schema[second_member].kind == type_null),
+                   "Union with non-null type not currently supported");
+    }
   }
+  return schema_desc;
+}
+
+std::vector<column_buffer> decode_data(metadata& meta,
+                                       rmm::device_buffer const& block_data,
+                                       std::vector<std::pair<uint32_t, uint32_t>> const& dict,
+                                       device_span<string_index_pair const> global_dictionary,
+                                       size_t num_rows,
+                                       std::vector<std::pair<int, std::string>> const& selection,
+                                       std::vector<data_type> const& column_types,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  auto out_buffers = std::vector<column_buffer>();
+
+  for (size_t i = 0; i < column_types.size(); ++i) {
+    auto col_idx     = selection[i].first;
+    bool is_nullable = (meta.columns[col_idx].schema_null_idx >= 0);
+    out_buffers.emplace_back(column_types[i], num_rows, is_nullable, stream, mr);
+  }
+
+  // Build gpu schema
+  uint32_t min_row_data_size = 0;
+  auto schema_desc           = make_schema_desc(meta, min_row_data_size, stream);
+
   std::vector<void*> valid_alias(out_buffers.size(), nullptr);
   for (size_t i = 0; i < out_buffers.size(); i++) {
     auto const col_idx  = selection[i].first;
@@ -414,6 +543,7 @@ std::vector<column_buffer> decode_data(metadata& meta,
                             meta.num_rows,
                             meta.skip_rows,
                             min_row_data_size,
+                            false,
                             stream);
 
   // Copy valid bits that are shared between columns
@@ -437,6 +567,235 @@ std::vector<column_buffer> decode_data(metadata& meta,
   return out_buffers;
 }
 
+/**
+ * @brief Creates the buffer of a column read from an entry of the schema, without allocating it
+ *
+ * Records are read as STRUCT columns and arrays as LIST columns. The schema index of the values
+ * read into each buffer is kept in its user data.
+ *
+ * @param[in] schema Schema of the file
+ * @param[in] idx Schema index of the entry
+ * @param[in] in_array Whether the entry is within an array
+ *
+ * @return Column buffer, with its children
+ */
+column_buffer make_nested_buffer(std::vector<schema_entry> const& schema, int idx, bool in_array)
+{
+  auto data_idx = idx;
+  if (schema[idx].kind == type_union) {
+    // Optional value, the union of null and another type
+    data_idx = (schema[idx + 1].kind == type_null && schema[idx].num_children > 1)
+                 ? next_sibling(schema, idx + 1)
+                 : idx + 1;
+  }
+  auto const& entry      = schema[data_idx];
+  auto const is_nullable = (null_member(schema, data_idx) >= 0);
+
+  column_buffer buffer;
+  switch (entry.kind) {
+    case type_record:
+      buffer = column_buffer(data_type{type_id::STRUCT}, is_nullable);
+      for (int i = 0, child = data_idx + 1; i < entry.num_children; ++i) {
+        buffer.children.push_back(make_nested_buffer(schema, child, in_array));
+        child = next_sibling(schema, child);
+      }
+      break;
+    case type_array:
+      CUDF_EXPECTS(!in_array, "Arrays of arrays are not supported");
+      buffer = column_buffer(data_type{type_id::LIST}, is_nullable);
+      buffer.children.push_back(make_nested_buffer(schema, data_idx + 1, true));
+      break;
+    default: {
+      auto const col_type = to_type_id(&entry);
+      CUDF_EXPECTS(col_type != type_id::EMPTY, "Unsupported data type");
+      buffer = column_buffer(data_type{col_type}, is_nullable);
+    }
+  }
+  buffer.name      = schema[idx].field_name;
+  buffer.user_data = data_idx;
+  return buffer;
+}
+
+/**
+ * @brief Allocates a buffer and its descendants, except the children of LIST buffers, whose sizes
+ * are only known once the items of the arrays are counted
+ */
+void create_nested_buffer(column_buffer& buffer,
+                          size_type size,
+                          rmm::cuda_stream_view stream,
+                          rmm::mr::device_memory_resource* mr)
+{
+  auto const is_list = (buffer.type.id() == type_id::LIST);
+  buffer.create(is_list ? size + 1 : size, stream, mr);
+  if (buffer.null_mask_size()) {
+    cudf::detail::set_null_mask(buffer.null_mask(), 0, size, true, stream);
+  }
+  if (!is_list) {
+    for (auto& child : buffer.children) {
+      create_nested_buffer(child, size, stream, mr);
+    }
+  }
+}
+
+/**
+ * @brief Calls `f` on each buffer and on each of their descendants
+ */
+template <typename Function>
+void for_each_buffer(std::vector<column_buffer>& buffers, Function const& f)
+{
+  for (auto& buffer : buffers) {
+    f(buffer);
+    for_each_buffer(buffer.children, f);
+  }
+}
+
+/**
+ * @brief Decodes the selected fields of the root record as nested columns
+ *
+ * The arrays are decoded in two passes: the first counts the items of each row into the offsets of
+ * the LIST columns, which size their children, and the second decodes all the values.
+ */
+std::vector<column_buffer> decode_nested_data(
+  metadata& meta,
+  rmm::device_buffer const& block_data,
+  std::vector<std::pair<uint32_t, uint32_t>> const& dict,
+  device_span<string_index_pair const> global_dictionary,
+  size_t num_rows,
+  std::vector<std::pair<int, std::string>> const& selection,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto out_buffers = std::vector<column_buffer>();
+  for (auto const& col : selection) {
+    out_buffers.push_back(make_nested_buffer(meta.schema, col.first, false));
+    create_nested_buffer(out_buffers.back(), num_rows, stream, mr);
+  }
+
+  uint32_t min_row_data_size = 0;
+  auto schema_desc           = make_schema_desc(meta, min_row_data_size, stream);
+  auto const block_list      = cudf::detail::make_device_uvector_async(meta.block_list, stream);
+
+  auto const decode = [&](bool count_items) {
+    schema_desc.host_to_device(stream);
+    gpu::DecodeAvroColumnData(block_list,
+                              schema_desc.device_ptr(),
+                              global_dictionary,
+                              static_cast<uint8_t const*>(block_data.data()),
+                              static_cast<uint32_t>(schema_desc.size()),
+                              meta.num_rows,
+                              meta.skip_rows,
+                              min_row_data_size,
+                              count_items,
+                              stream);
+  };
+
+  // Arrays of arrays are not supported, so all the LIST columns have a row per row of the file
+  std::vector<column_buffer*> lists;
+  for_each_buffer(out_buffers, [&](column_buffer& buffer) {
+    if (buffer.type.id() == type_id::LIST) { lists.push_back(&buffer); }
+  });
+  if (!lists.empty()) {
+    for (auto const list : lists) {
+      schema_desc[list->user_data].dataptr = list->data();
+    }
+    decode(true);
+    for (auto const list : lists) {
+      auto const offsets = static_cast<size_type*>(list->data());
+      thrust::exclusive_scan(rmm::exec_policy(stream), offsets, offsets + list->size, offsets);
+      auto const num_items = cudf::detail::make_std_vector_sync(
+        device_span<size_type const>{offsets + list->size - 1, 1}, stream);
+      create_nested_buffer(list->children[0], num_items.front(), stream, mr);
+    }
+  }
+
+  for_each_buffer(out_buffers, [&](column_buffer& buffer) {
+    auto const data_idx = buffer.user_data;
+    if (buffer.type.id() != type_id::STRUCT) { schema_desc[data_idx].dataptr = buffer.data(); }
+    if (meta.schema[data_idx].kind == type_enum) {
+      schema_desc[data_idx].count = dict[data_idx].first;
+    }
+    auto const null_idx = null_member(meta.schema, data_idx);
+    if (null_idx >= 0) { schema_desc[null_idx].dataptr = buffer.null_mask(); }
+  });
+  decode(false);
+  schema_desc.device_to_host(stream, true);
+
+  for_each_buffer(out_buffers, [&](column_buffer& buffer) {
+    auto const null_idx = null_member(meta.schema, buffer.user_data);
+    buffer.null_count() = (null_idx >= 0) ? schema_desc[null_idx].count : 0;
+  });
+
+  return out_buffers;
+}
+
+/**
+ * @brief Copies the symbols of the enums of the given schema entries to the device
+ *
+ * @param[in] meta File metadata
+ * @param[in] entries Schema indices of the entries
+ * @param[out] d_global_dict Symbols of all the entries
+ * @param[out] d_global_dict_data Characters of the symbols
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Index of the first symbol and number of symbols of each entry
+ */
+std::vector<std::pair<uint32_t, uint32_t>> make_dictionary(
+  metadata const& meta,
+  std::vector<int> const& entries,
+  rmm::device_uvector<string_index_pair>& d_global_dict,
+  rmm::device_uvector<char>& d_global_dict_data,
+  rmm::cuda_stream_view stream)
+{
+  size_t total_dictionary_entries = 0;
+  size_t dictionary_data_size     = 0;
+
+  auto dict = std::vector<std::pair<uint32_t, uint32_t>>(entries.size());
+
+  for (size_t i = 0; i < entries.size(); ++i) {
+    auto& col_schema = meta.schema[entries[i]];
+    dict[i].first    = static_cast<uint32_t>(total_dictionary_entries);
+    dict[i].second   = static_cast<uint32_t>(col_schema.symbols.size());
+    total_dictionary_entries += dict[i].second;
+    for (auto const& sym : col_schema.symbols) {
+      dictionary_data_size += sym.length();
+    }
+  }
+
+  if (total_dictionary_entries > 0) {
+    auto h_global_dict      = std::vector<string_index_pair>(total_dictionary_entries);
+    auto h_global_dict_data = std::vector<char>(dictionary_data_size);
+    size_t dict_pos         = 0;
+
+    // The symbols point to their characters in device memory
+    d_global_dict_data = rmm::device_uvector<char>(dictionary_data_size, stream);
+
+    for (size_t i = 0; i < entries.size(); ++i) {
+      auto const& col_schema      = meta.schema[entries[i]];
+      auto const col_dict_entries = &(h_global_dict[dict[i].first]);
+      for (size_t j = 0; j < dict[i].second; j++) {
+        auto const& symbols = col_schema.symbols[j];
+
+        auto const len             = symbols.length();
+        col_dict_entries[j].first  = d_global_dict_data.data() + dict_pos;
+        col_dict_entries[j].second = len;
+
+        std::copy(symbols.c_str(), symbols.c_str() + len, h_global_dict_data.data() + dict_pos);
+        dict_pos += len;
+      }
+    }
+
+    d_global_dict = cudf::detail::make_device_uvector_async(h_global_dict, stream);
+    CUDA_TRY(cudaMemcpyAsync(d_global_dict_data.data(),
+                             h_global_dict_data.data(),
+                             dictionary_data_size,
+                             cudaMemcpyHostToDevice,
+                             stream.value()));
+
+    stream.synchronize();
+  }
+  return dict;
+}
+
 table_with_metadata read_avro(std::unique_ptr<cudf::io::datasource>&& source,
                               avro_reader_options const& options,
                               rmm::cuda_stream_view stream,
@@ -451,105 +810,95 @@ table_with_metadata read_avro(std::unique_ptr<cudf::io::datasource>&& source,
   // Open the source Avro dataset metadata
   auto meta = metadata(source.get());
 
-  // Select and read partial metadata / schema within the subset of rows
-  meta.init_and_select_rows(skip_rows, num_rows);
+  // Read the metadata and schema from the header of the file
+  meta.init();
 
   // Select only columns required by the options
-  auto selected_columns = meta.select_columns(options.get_columns());
+  auto const is_nested  = options.is_enabled_nested();
+  auto selected_columns = is_nested ? meta.select_nested_columns(options.get_columns())
+                                    : meta.select_columns(options.get_columns());
   if (selected_columns.size() != 0) {
     // Get a list of column data types
     std::vector<data_type> column_types;
-    for (auto const& col : selected_columns) {
-      auto& col_schema = meta.schema[meta.columns[col.first].schema_data_idx];
+    if (!is_nested) {
+      for (auto const& col : selected_columns) {
+        auto& col_schema = meta.schema[meta.columns[col.first].schema_data_idx];
 
-      auto col_type = to_type_id(&col_schema);
-      CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
-      column_types.emplace_back(col_type);
+        auto col_type = to_type_id(&col_schema);
+        CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
+        column_types.emplace_back(col_type);
+      }
     }
 
-    if (meta.total_data_size > 0) {
-      rmm::device_buffer block_data;
-      if (source->is_device_read_preferred(meta.total_data_size)) {
-        block_data      = rmm::device_buffer{meta.total_data_size, stream};
-        auto read_bytes = source->device_read(meta.block_list[0].offset,
-                                              meta.total_data_size,
-                                              static_cast<uint8_t*>(block_data.data()),
-                                              stream);
-        block_data.resize(read_bytes, stream);
-      } else {
-        auto const buffer = source->host_read(meta.block_list[0].offset, meta.total_data_size);
-        block_data        = rmm::device_buffer{buffer->data(), buffer->size(), stream};
-      }
+    // Read the data blocks following the header, directly to the device if preferred
+    auto const data_size = source->size() - meta.metadata_size;
+    rmm::device_buffer block_data;
+    if (source->is_device_read_preferred(data_size)) {
+      block_data      = rmm::device_buffer{data_size, stream};
+      auto read_bytes = source->device_read(
+        meta.metadata_size, data_size, static_cast<uint8_t*>(block_data.data()), stream);
+      block_data.resize(read_bytes, stream);
+    } else {
+      auto const buffer = source->host_read(meta.metadata_size, data_size);
+      block_data        = rmm::device_buffer{buffer->data(), buffer->size(), stream};
+    }
 
+    // Find the data blocks and select those within the subset of rows
+    meta.select_rows({static_cast<uint8_t const*>(block_data.data()), block_data.size()},
+                     skip_rows,
+                     num_rows,
+                     stream);
+
+    if (meta.total_data_size > 0) {
       if (meta.codec != "" && meta.codec != "null") {
         auto decomp_block_data = decompress_data(*source, meta, block_data, stream);
         block_data             = std::move(decomp_block_data);
-      } else {
-        auto dst_ofs = meta.block_list[0].offset;
-        for (size_t i = 0; i < meta.block_list.size(); i++) {
-          meta.block_list[i].offset -= dst_ofs;
-        }
       }
 
-      size_t total_dictionary_entries = 0;
-      size_t dictionary_data_size     = 0;
-
-      auto dict = std::vector<std::pair<uint32_t, uint32_t>>(column_types.size());
-
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        auto col_idx     = selected_columns[i].first;
-        auto& col_schema = meta.schema[meta.columns[col_idx].schema_data_idx];
-        dict[i].first    = static_cast<uint32_t>(total_dictionary_entries);
-        dict[i].second   = static_cast<uint32_t>(col_schema.symbols.size());
-        total_dictionary_entries += dict[i].second;
-        for (auto const& sym : col_schema.symbols) {
-          dictionary_data_size += sym.length();
+      // Enum symbols of the selected columns, or of all the entries of the schema
+      std::vector<int> dict_entries;
+      if (is_nested) {
+        dict_entries.resize(meta.schema.size());
+        std::iota(dict_entries.begin(), dict_entries.end(), 0);
+      } else {
+        for (auto const& col : selected_columns) {
+          dict_entries.push_back(meta.columns[col.first].schema_data_idx);
         }
       }
-
       auto d_global_dict      = rmm::device_uvector<string_index_pair>(0, stream);
       auto d_global_dict_data = rmm::device_uvector<char>(0, stream);
-
-      if (total_dictionary_entries > 0) {
-        auto h_global_dict      = std::vector<string_index_pair>(total_dictionary_entries);
-        auto h_global_dict_data = std::vector<char>(dictionary_data_size);
-        size_t dict_pos         = 0;
-
-        for (size_t i = 0; i < column_types.size(); ++i) {
-          auto const col_idx          = selected_columns[i].first;
-          auto const& col_schema      = meta.schema[meta.columns[col_idx].schema_data_idx];
-          auto const col_dict_entries = &(h_global_dict[dict[i].first]);
-          for (size_t j = 0; j < dict[i].second; j++) {
-            auto const& symbols = col_schema.symbols[j];
-
-            auto const data_dst        = h_global_dict_data.data() + dict_pos;
-            auto const len             = symbols.length();
-            col_dict_entries[j].first  = data_dst;
-            col_dict_entries[j].second = len;
-
-            std::copy(symbols.c_str(), symbols.c_str() + len, data_dst);
-            dict_pos += len;
-          }
-        }
-
-        d_global_dict      = cudf::detail::make_device_uvector_async(h_global_dict, stream);
-        d_global_dict_data = cudf::detail::make_device_uvector_async(h_global_dict_data, stream);
-
-        stream.synchronize();
+      auto const dict =
+        make_dictionary(meta, dict_entries, d_global_dict, d_global_dict_data, stream);
+
+      auto out_buffers = is_nested ? decode_nested_data(meta,
+                                                        block_data,
+                                                        dict,
+                                                        d_global_dict,
+                                                        num_rows,
+                                                        selected_columns,
+                                                        stream,
+                                                        mr)
+                                   : decode_data(meta,
+                                                 block_data,
+                                                 dict,
+                                                 d_global_dict,
+                                                 num_rows,
+                                                 selected_columns,
+                                                 column_types,
+                                                 stream,
+                                                 mr);
+
+      for (auto& buffer : out_buffers) {
+        column_name_info* schema_info = nullptr;
+        if (is_nested) { schema_info = &metadata_out.schema_info.emplace_back(""); }
+        out_columns.emplace_back(make_column(buffer, schema_info, stream, mr));
       }
-
-      auto out_buffers = decode_data(meta,
-                                     block_data,
-                                     dict,
-                                     d_global_dict,
-                                     num_rows,
-                                     selected_columns,
-                                     column_types,
-                                     stream,
-                                     mr);
-
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(make_column(out_buffers[i], nullptr, stream, mr));
+    } else if (is_nested) {
+      // Create empty columns, with the hierarchy of the nested ones
+      for (auto const& col : selected_columns) {
+        auto buffer = make_nested_buffer(meta.schema, col.first, false);
+        out_columns.emplace_back(
+          empty_like(buffer, &metadata_out.schema_info.emplace_back(""), stream, mr));
       }
     } else {
       // Create empty columns
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -82,8 +82,13 @@ For more information on these sources, see the manual.
 #include "io_uncomp.h"
 #include "unbz2.h"
 
+#include <io/utilities/thread_pool.hpp>
+
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
+#include <future>
+#include <memory>
 #include <vector>
 
 namespace cudf {
@@ -597,5 +602,136 @@ int32_t cpu_bz2_uncompress(
   return ret;
 }
 
+namespace {
+
+/**
+ * @brief Output of a single block decoded independently of the rest of the stream
+ */
+struct decoded_block {
+  int32_t status;    // BZ_OK or BZ_STREAM_END if the block decoded, an error code otherwise
+  uint64_t end_bit;  // Bit offset of the signature that follows the block
+  std::vector<uint8_t> data;
+};
+
+/**
+ * @brief Bit offsets of all the matches of the 48-bit block signature, in ascending order
+ *
+ * Blocks are not byte-aligned, so every bit offset is tested. The signature may also occur within
+ * the compressed bits of a block; such false matches are told apart by where the blocks end.
+ */
+std::vector<uint64_t> find_block_signatures(const uint8_t* source, size_t sourceLen)
+{
+  constexpr uint64_t block_signature = 0x3141'5926'5359;
+  constexpr uint64_t signature_mask  = (1ull << 48) - 1;
+  std::vector<uint64_t> offsets;
+  uint64_t window = 0;
+  for (size_t i = 4; i < sourceLen; i++) {
+    window = (window << 8) | source[i];
+    // Signatures ending in the current byte, from the last bit backwards
+    for (uint32_t shift = 0; shift < 8; shift++) {
+      auto const end_bit = (i + 1) * 8 - shift;
+      if (end_bit < 32 + 48) { break; }
+      if (((window >> shift) & signature_mask) == block_signature) {
+        offsets.push_back(end_bit - 48);
+      }
+    }
+  }
+  std::sort(offsets.begin(), offsets.end());
+  return offsets;
+}
+
+/**
+ * @brief Decodes the block starting at the given bit offset, sizing its output as needed
+ */
+decoded_block decode_block(const uint8_t* source,
+                           size_t sourceLen,
+                           uint32_t blockSize100k,
+                           uint64_t bit_offs)
+{
+  decoded_block block{BZ_PARAM_ERROR, 0, {}};
+  auto s = std::make_unique<unbz_state_s>();
+
+  s->base = source;
+  s->end  = source + sourceLen - 4;
+  s->cur  = source + (size_t)(bit_offs >> 3);
+  if (s->cur + 8 > s->end) return block;
+  s->bitbuf        = __builtin_bswap64(*reinterpret_cast<const uint64_t*>(s->cur));
+  s->bitpos        = (uint32_t)(bit_offs & 7);
+  s->blockSize100k = blockSize100k;
+  s->tt.resize(blockSize100k * 100000);
+
+  block.status = bz2_decompress_block(s.get());
+  if (block.status != BZ_OK && block.status != BZ_STREAM_END) return block;
+  block.end_bit = ((s->cur - s->base) << 3) + (s->bitpos);
+
+  // Runs of the initial run-length coding rarely expand the block by more than twice; bzUnRLE
+  // counts the bytes past the end of the output, so that a second pass fits them all
+  block.data.resize(2 * s->save_nblock);
+  while (true) {
+    s->out     = block.data.data();
+    s->outend  = s->out + block.data.size();
+    s->outbase = s->out;
+    bzUnRLE(s.get());
+    if (s->nblock_used != s->save_nblock + 1) {
+      block.status = BZ_UNEXPECTED_EOF;
+      return block;
+    }
+    auto const size = static_cast<size_t>(s->out - s->outbase);
+    auto const fits = size <= block.data.size();
+    block.data.resize(size);
+    if (fits) break;
+  }
+  return block;
+}
+
+}  // namespace
+
+int32_t cpu_bz2_uncompress_blocks(const uint8_t* source,
+                                  size_t sourceLen,
+                                  std::vector<char>& dst)
+{
+  if (source == nullptr || sourceLen < 14) return BZ_PARAM_ERROR;
+  if (source[0] != BZ_HDR_B || source[1] != BZ_HDR_Z || source[2] != BZ_HDR_h)
+    return BZ_DATA_ERROR_MAGIC;
+  uint32_t const blockSize100k = source[3] - BZ_HDR_0;
+  if (blockSize100k < 1 || blockSize100k > 9) return BZ_DATA_ERROR_MAGIC;
+
+  dst.clear();
+  // A stream without blocks holds the end-of-stream signature right after the header
+  constexpr uint8_t eos_signature[] = {0x17, 0x72, 0x45, 0x38, 0x50, 0x90};
+  if (std::equal(std::cbegin(eos_signature), std::cend(eos_signature), source + 4)) return BZ_OK;
+
+  // Every match of the signature is decoded concurrently; the blocks of the stream are then found
+  // by following the end of each block from the first one, which starts right after the header
+  // (The final combined CRC in the last 4 bytes is not read)
+  auto const offsets = find_block_signatures(source, sourceLen - 4);
+  if (offsets.empty()) return BZ_DATA_ERROR;
+  auto& pool = cudf::detail::host_worker_pool();
+  std::vector<std::future<decoded_block>> blocks;
+  blocks.reserve(offsets.size());
+  for (auto const offset : offsets) {
+    blocks.emplace_back(pool.submit(
+      [=]() { return decode_block(source, sourceLen, blockSize100k, offset); }));
+  }
+
+  auto const status = [&]() {
+    uint64_t bit_offs = 32;
+    while (true) {
+      auto const it = std::lower_bound(offsets.begin(), offsets.end(), bit_offs);
+      if (it == offsets.end() || *it != bit_offs) return BZ_DATA_ERROR;
+      auto const block = blocks[it - offsets.begin()].get();
+      if (block.status != BZ_OK && block.status != BZ_STREAM_END) return block.status;
+      dst.insert(dst.end(), block.data.begin(), block.data.end());
+      if (block.status == BZ_STREAM_END) return BZ_OK;
+      bit_offs = block.end_bit;
+    }
+  }();
+  // The remaining blocks read the input, so they must be done with it before returning
+  for (auto& block : blocks) {
+    if (block.valid()) block.wait();
+  }
+  return status;
+}
+
 }  // namespace io
 }  // namespace cudf
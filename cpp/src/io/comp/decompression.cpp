@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "decompression.hpp"
+#include "nvcomp_adapter.hpp"
+
+#include <io/utilities/config_utils.hpp>
+
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <optional>
+
+namespace cudf {
+namespace io {
+namespace {
+
+constexpr auto no_internal_kernel = std::numeric_limits<size_t>::max();
+
+/**
+ * @brief Chunk sizes from which nvcomp decompresses a format faster than the cuDF kernels
+ *
+ * Formats without a cuDF kernel always use nvcomp, formats that nvcomp does not support never do.
+ * Update the thresholds from the decompression benchmarks when either backend changes.
+ */
+struct backend_threshold {
+  compression_type compression;
+  std::optional<nvcomp::compression_type> nvcomp_type;
+  size_t min_nvcomp_chunk_size;
+};
+
+constexpr std::array<backend_threshold, 6> backend_thresholds{
+  backend_threshold{compression_type::GZIP, std::nullopt, 0},
+  backend_threshold{compression_type::ZLIB, std::nullopt, 0},
+  backend_threshold{compression_type::BROTLI, std::nullopt, 0},
+  backend_threshold{compression_type::SNAPPY, nvcomp::compression_type::SNAPPY, 0},
+  backend_threshold{compression_type::ZSTD, nvcomp::compression_type::ZSTD, no_internal_kernel},
+  backend_threshold{compression_type::LZ4, nvcomp::compression_type::LZ4, no_internal_kernel}};
+
+backend_threshold const& find_threshold(compression_type compression)
+{
+  auto const it = std::find_if(backend_thresholds.begin(),
+                               backend_thresholds.end(),
+                               [&](auto const& entry) { return entry.compression == compression; });
+  CUDF_EXPECTS(it != backend_thresholds.end(), "Unsupported compression type");
+  return *it;
+}
+
+}  // namespace
+
+decompression_backend select_decompression_backend(compression_type compression,
+                                                   size_t max_uncomp_chunk_size)
+{
+  auto const& threshold = find_threshold(compression);
+  if (not threshold.nvcomp_type.has_value()) { return decompression_backend::INTERNAL; }
+  if (threshold.min_nvcomp_chunk_size == no_internal_kernel) {
+    CUDF_EXPECTS(detail::nvcomp_integration::is_stable_enabled(),
+                 "ZSTD and LZ4 decompression require nvCOMP use to be enabled");
+    return decompression_backend::NVCOMP;
+  }
+  return detail::nvcomp_integration::is_stable_enabled() and
+             max_uncomp_chunk_size >= threshold.min_nvcomp_chunk_size
+           ? decompression_backend::NVCOMP
+           : decompression_backend::INTERNAL;
+}
+
+void batched_decompress(compression_type compression,
+                        device_span<gpu_inflate_input_s> inputs,
+                        device_span<gpu_inflate_status_s> statuses,
+                        size_t max_uncomp_chunk_size,
+                        bool exact_output_size,
+                        rmm::cuda_stream_view stream,
+                        rmm::mr::device_memory_resource* mr)
+{
+  if (inputs.empty()) { return; }
+  auto const count = static_cast<int>(inputs.size());
+
+  if (select_decompression_backend(compression, max_uncomp_chunk_size) ==
+      decompression_backend::NVCOMP) {
+    nvcomp::batched_decompress(*find_threshold(compression).nvcomp_type,
+                               inputs,
+                               statuses,
+                               max_uncomp_chunk_size,
+                               exact_output_size,
+                               stream,
+                               mr);
+    return;
+  }
+
+  switch (compression) {
+    case compression_type::GZIP:
+      CUDA_TRY(gpuinflate(inputs.data(), statuses.data(), count, 1, stream));
+      break;
+    case compression_type::ZLIB:
+      CUDA_TRY(gpuinflate(inputs.data(), statuses.data(), count, 0, stream));
+      break;
+    case compression_type::SNAPPY:
+      CUDA_TRY(gpu_unsnap(inputs.data(), statuses.data(), count, stream));
+      break;
+    case compression_type::BROTLI: {
+      rmm::device_buffer scratch(get_gpu_debrotli_scratch_size(count), stream, mr);
+      CUDA_TRY(gpu_debrotli(
+        inputs.data(), statuses.data(), scratch.data(), scratch.size(), count, stream));
+      break;
+    }
+    default: CUDF_FAIL("Unexpected decompression dispatch");
+  }
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file decompression.hpp
+ * @brief Batched decompression of independent chunks, through nvcomp or the cuDF kernels
+ */
+
+#pragma once
+
+#include "gpuinflate.h"
+
+#include <cudf/io/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief Implementations of batched decompression
+ */
+enum class decompression_backend {
+  INTERNAL,  ///< cuDF kernels: gpuinflate, gpu_unsnap and gpu_debrotli
+  NVCOMP     ///< nvcomp's batched API
+};
+
+/**
+ * @brief Selects the backend to decompress chunks of the given format
+ *
+ * nvcomp is only used when its use is enabled, and only for the chunk sizes at which it is the
+ * faster backend for the format.
+ *
+ * @throw cudf::logic_error if no enabled backend can decompress the format
+ *
+ * @param compression Compression format of the chunks
+ * @param max_uncomp_chunk_size Maximum uncompressed size of a chunk
+ * @return The backend to use
+ */
+[[nodiscard]] decompression_backend select_decompression_backend(compression_type compression,
+                                                                 size_t max_uncomp_chunk_size);
+
+/**
+ * @brief Decompresses a batch of independent chunks with the backend selected for the format
+ *
+ * GZIP chunks begin with a GZIP header. ZLIB chunks are raw DEFLATE streams, as stored in ORC and
+ * Avro files. The statuses are those reported by the backend: the cuDF kernels set a nonzero status
+ * for each chunk that fails, while nvcomp failures throw.
+ *
+ * @param compression Compression format of the chunks: GZIP, ZLIB, SNAPPY, BROTLI, ZSTD or LZ4
+ * @param inputs Location and size of each compressed chunk and of its output
+ * @param[out] statuses Number of bytes written for each chunk, and its status
+ * @param max_uncomp_chunk_size Maximum uncompressed size of a chunk
+ * @param exact_output_size Whether each chunk must fill its output buffer
+ * @param stream CUDA stream to use
+ * @param mr Device memory resource used to allocate the scratch space of the backend
+ */
+void batched_decompress(
+  compression_type compression,
+  device_span<gpu_inflate_input_s> inputs,
+  device_span<gpu_inflate_status_s> statuses,
+  size_t max_uncomp_chunk_size,
+  bool exact_output_size,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+}  // namespace io
+}  // namespace cudf
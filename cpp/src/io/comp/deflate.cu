@@ -0,0 +1,402 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpuinflate.h"
+
+#include <io/utilities/block_utils.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace io {
+constexpr int deflate_hash_bits = 12;
+
+constexpr uint32_t max_literal_length = 256;  // Literals found per match search
+constexpr uint32_t max_match_length   = 258;
+constexpr uint32_t max_copy_distance  = 32768;
+
+constexpr uint32_t end_of_block = 256;
+
+/**
+ * @brief deflate compressor state
+ */
+struct deflate_state_s {
+  const uint8_t* src;                         ///< Ptr to uncompressed data
+  uint32_t src_len;                           ///< Uncompressed data length
+  uint8_t* dst;                               ///< Base ptr to output compressed data
+  uint8_t* end;                               ///< End of compressed data buffer
+  uint32_t dst_pos;                           ///< Number of bytes of compressed data output
+  uint32_t pending_bits;                      ///< Number of bits in bit_buffer[0] not yet output
+  volatile uint32_t literal_length;           ///< Number of literal bytes
+  volatile uint32_t copy_length;              ///< Number of copy bytes
+  volatile uint32_t copy_distance;            ///< Distance for copy bytes
+  uint32_t bit_buffer[32];                    ///< Compressed bits not yet output
+  uint16_t hash_map[1 << deflate_hash_bits];  ///< Low 16-bit offset from hash
+};
+
+/**
+ * @brief 12-bit hash from four consecutive bytes
+ */
+static inline __device__ uint32_t deflate_hash(uint32_t v)
+{
+  return (v * ((1 << 20) + (0x2a00) + (0x6a) + 1)) >> (32 - deflate_hash_bits);
+}
+
+/**
+ * @brief Fetches four consecutive bytes
+ */
+static inline __device__ uint32_t fetch4(const uint8_t* src)
+{
+  uint32_t src_align = 3 & reinterpret_cast<uintptr_t>(src);
+  const auto* src32  = reinterpret_cast<const uint32_t*>(src - src_align);
+  uint32_t v         = src32[0];
+  return (src_align) ? __funnelshift_r(v, src32[1], src_align * 8) : v;
+}
+
+/**
+ * @brief Returns mask of any thread in the warp that has a hash value
+ * equal to that of the calling thread
+ */
+static inline __device__ uint32_t HashMatchAny(uint32_t v, uint32_t t)
+{
+#if (__CUDA_ARCH__ >= 700)
+  return __match_any_sync(~0, v);
+#else
+  uint32_t err_map = 0;
+  for (uint32_t i = 0; i < deflate_hash_bits; i++, v >>= 1) {
+    uint32_t b       = v & 1;
+    uint32_t match_b = ballot(b);
+    err_map |= match_b ^ -(int32_t)b;
+  }
+  return ~err_map;
+#endif
+}
+
+/**
+ * @brief Appends the bits of each thread of the warp to the compressed output, in thread order
+ *
+ * DEFLATE packs bits starting with the least significant bit of each byte, so the bits are
+ * collected in little-endian 32-bit words, and the complete words are output.
+ *
+ * @param s Compressor state
+ * @param bits Bits to append, starting with the least significant bit
+ * @param len Number of bits to append, at most 31
+ * @param t Thread in warp
+ */
+static __device__ void PutBits(deflate_state_s* s, uint32_t bits, uint32_t len, uint32_t t)
+{
+  uint32_t bit_end = WarpReducePos32(len, t) + s->pending_bits;
+  uint32_t bit_pos = bit_end - len;
+  if (len > 0) {
+    atomicOr(&s->bit_buffer[bit_pos / 32], bits << (bit_pos % 32));
+    if ((bit_pos % 32) + len > 32) {
+      atomicOr(&s->bit_buffer[bit_pos / 32 + 1], bits >> (32 - bit_pos % 32));
+    }
+  }
+  __syncwarp();
+  uint32_t num_bits  = shuffle(bit_end, 31);
+  uint32_t num_words = num_bits / 32;
+  uint32_t partial   = s->bit_buffer[num_words];
+  if (t < num_words) {
+    uint8_t* dst  = s->dst + s->dst_pos + t * 4;
+    uint32_t word = s->bit_buffer[t];
+    for (uint32_t i = 0; i < 4; i++) {
+      if (dst + i < s->end) { dst[i] = word >> (i * 8); }
+    }
+  }
+  __syncwarp();
+  if (num_words > 0) {
+    for (uint32_t i = t; i <= num_words; i += 32) {
+      s->bit_buffer[i] = (i == 0) ? partial : 0;
+    }
+  }
+  if (t == 0) {
+    s->dst_pos += num_words * 4;
+    s->pending_bits = num_bits % 32;
+  }
+  __syncwarp();
+}
+
+/**
+ * @brief Returns the fixed Huffman code of a literal/length symbol, bit-reversed so that it can be
+ * output starting with the least significant bit, and its length
+ */
+static inline __device__ uint2 FixedLiteralCode(uint32_t sym)
+{
+  uint32_t code, len;
+  if (sym < 144) {
+    code = 0x30 + sym;
+    len  = 8;
+  } else if (sym < 256) {
+    code = 0x190 + sym - 144;
+    len  = 9;
+  } else if (sym < 280) {
+    code = sym - 256;
+    len  = 7;
+  } else {
+    code = 0xc0 + sym - 280;
+    len  = 8;
+  }
+  return make_uint2(__brev(code) >> (32 - len), len);
+}
+
+/**
+ * @brief Returns the bits of a copy, with its fixed length and distance codes followed by their
+ * extra bits, and their number (at most 31)
+ *
+ * @param length Copy length, from 3 to 258
+ * @param distance Copy distance, from 1 to 32768
+ */
+static __device__ uint2 CopyCode(uint32_t length, uint32_t distance)
+{
+  uint32_t sym, extra_len, extra;
+  uint32_t x = length - 3;
+  if (length == max_match_length) {
+    sym       = 285;
+    extra_len = 0;
+    extra     = 0;
+  } else if (x < 8) {
+    sym       = 257 + x;
+    extra_len = 0;
+    extra     = 0;
+  } else {
+    uint32_t log2 = 31 - __clz(x);
+    extra_len     = log2 - 2;
+    sym           = 257 + 4 * (log2 - 1) + ((x >> extra_len) & 3);
+    extra         = x & ((1 << extra_len) - 1);
+  }
+  uint2 code    = FixedLiteralCode(sym);
+  uint32_t bits = code.x | (extra << code.y);
+  uint32_t len  = code.y + extra_len;
+
+  x = distance - 1;
+  if (x < 4) {
+    sym       = x;
+    extra_len = 0;
+    extra     = 0;
+  } else {
+    uint32_t log2 = 31 - __clz(x);
+    extra_len     = log2 - 1;
+    sym           = 2 * log2 + ((x >> extra_len) & 1);
+    extra         = x & ((1 << extra_len) - 1);
+  }
+  // distance codes are fixed 5-bit values
+  bits |= (__brev(sym) >> 27) << len;
+  len += 5;
+  bits |= extra << len;
+  len += extra_len;
+  return make_uint2(bits, len);
+}
+
+/**
+ * @brief Finds the first occurrence of a consecutive 4-byte match in the input sequence,
+ * or at most 256 bytes
+ *
+ * @param s Compressor state (copy_length set to 4 if a match is found, zero otherwise)
+ * @param src Uncompressed buffer
+ * @param pos0 Position in uncompressed buffer
+ * @param t thread in warp
+ *
+ * @return Number of bytes before first match (literal length)
+ */
+static __device__ uint32_t FindFourByteMatch(deflate_state_s* s,
+                                             const uint8_t* src,
+                                             uint32_t pos0,
+                                             uint32_t t)
+{
+  uint32_t len    = s->src_len;
+  uint32_t pos    = pos0;
+  uint32_t maxpos = pos0 + max_literal_length - 31;
+  uint32_t match_mask, literal_cnt;
+  if (t == 0) { s->copy_length = 0; }
+  do {
+    bool valid4               = (pos + t + 4 <= len);
+    uint32_t data32           = (valid4) ? fetch4(src + pos + t) : 0;
+    uint32_t hash             = (valid4) ? deflate_hash(data32) : 0;
+    uint32_t local_match      = HashMatchAny(hash, t);
+    uint32_t local_match_lane = 31 - __clz(local_match & ((1 << t) - 1));
+    uint32_t local_match_data = shuffle(data32, min(local_match_lane, t));
+    uint32_t offset, match;
+    if (valid4) {
+      if (local_match_lane < t && local_match_data == data32) {
+        match  = 1;
+        offset = pos + local_match_lane;
+      } else {
+        offset = (pos & ~0xffff) | s->hash_map[hash];
+        if (offset >= pos) { offset = (offset >= 0x10000) ? offset - 0x10000 : pos; }
+        match =
+          (offset < pos && offset + max_copy_distance >= pos + t && fetch4(src + offset) == data32);
+      }
+    } else {
+      match       = 0;
+      local_match = 0;
+      offset      = pos + t;
+    }
+    match_mask = ballot(match);
+    if (match_mask != 0) {
+      literal_cnt = __ffs(match_mask) - 1;
+      if (t == literal_cnt) {
+        s->copy_distance = pos + t - offset;
+        s->copy_length   = 4;
+      }
+    } else {
+      literal_cnt = 32;
+    }
+    // Update hash up to the first 4 bytes of the copy length
+    local_match &= (0x2 << literal_cnt) - 1;
+    if (t <= literal_cnt && t == 31 - __clz(local_match)) { s->hash_map[hash] = pos + t; }
+    pos += literal_cnt;
+  } while (literal_cnt == 32 && pos < maxpos);
+  return min(pos, len) - pos0;
+}
+
+/// @brief Returns the number of matching bytes for two byte sequences up to `len` bytes
+static __device__ uint32_t MatchLength(const uint8_t* src1,
+                                       const uint8_t* src2,
+                                       uint32_t len,
+                                       uint32_t t)
+{
+  for (uint32_t matched = 0; matched < len; matched += 32) {
+    uint32_t i        = matched + t;
+    uint32_t mismatch = ballot(i >= len || src1[i] != src2[i]);
+    if (mismatch != 0) { return matched + __ffs(mismatch) - 1; }
+  }
+  return len;
+}
+
+/**
+ * @brief DEFLATE compression kernel
+ * See https://www.rfc-editor.org/rfc/rfc1951
+ *
+ * Outputs a single final block using the fixed Huffman codes. Matches are found as in the snappy
+ * compressor, within the 32KB window of DEFLATE, and extended up to 258 bytes.
+ *
+ * blockDim {128,1,1}
+ *
+ * @param[in] inputs Source/Destination buffer information per block
+ * @param[out] outputs Compression status per block
+ * @param[in] count Number of blocks to compress
+ */
+__global__ void __launch_bounds__(128)
+  deflate_kernel(gpu_inflate_input_s* inputs, gpu_inflate_status_s* outputs, int count)
+{
+  __shared__ __align__(16) deflate_state_s state_g;
+
+  deflate_state_s* const s = &state_g;
+  uint32_t t               = threadIdx.x;
+  uint32_t pos;
+  const uint8_t* src;
+
+  if (!t) {
+    auto* dst         = static_cast<uint8_t*>(inputs[blockIdx.x].dstDevice);
+    s->src            = static_cast<const uint8_t*>(inputs[blockIdx.x].srcDevice);
+    s->src_len        = static_cast<uint32_t>(inputs[blockIdx.x].srcSize);
+    s->dst            = dst;
+    s->end            = dst + inputs[blockIdx.x].dstSize;
+    s->dst_pos        = 0;
+    s->pending_bits   = 0;
+    s->literal_length = 0;
+    s->copy_length    = 0;
+    s->copy_distance  = 0;
+  }
+  if (t < 32) { s->bit_buffer[t] = 0; }
+  for (uint32_t i = t; i < sizeof(s->hash_map) / sizeof(uint32_t); i += 128) {
+    *reinterpret_cast<volatile uint32_t*>(&s->hash_map[i * 2]) = 0;
+  }
+  __syncthreads();
+  // BFINAL = 1, BTYPE = 01 (fixed Huffman codes)
+  if (t < 32) { PutBits(s, 3, (t == 0) ? 3 : 0, t); }
+  src = s->src;
+  pos = 0;
+  while (pos < s->src_len) {
+    uint32_t literal_len = s->literal_length;
+    uint32_t copy_len    = s->copy_length;
+    uint32_t distance    = s->copy_distance;
+    __syncthreads();
+    if (t < 32) {
+      // WARP0: Encode literals and copies
+      for (uint32_t i = 0; i < literal_len; i += 32) {
+        uint2 code = (i + t < literal_len) ? FixedLiteralCode(src[pos + i + t]) : make_uint2(0, 0);
+        PutBits(s, code.x, code.y, t);
+      }
+      pos += literal_len;
+      if (copy_len > 0) {
+        uint2 code = (t == 0) ? CopyCode(copy_len, distance) : make_uint2(0, 0);
+        PutBits(s, code.x, code.y, t);
+        pos += copy_len;
+      }
+    } else {
+      pos += literal_len + copy_len;
+      if (t < 32 * 2) {
+        // WARP1: Find a match using 12-bit hashes of 4-byte blocks
+        uint32_t t5 = t & 0x1f;
+        literal_len = FindFourByteMatch(s, src, pos, t5);
+        if (t5 == 0) { s->literal_length = literal_len; }
+        copy_len = s->copy_length;
+        if (copy_len != 0) {
+          uint32_t match_pos = pos + literal_len + copy_len;  // NOTE: copy_len is always 4 here
+          copy_len += MatchLength(src + match_pos,
+                                  src + match_pos - s->copy_distance,
+                                  min(s->src_len - match_pos, max_match_length - copy_len),
+                                  t5);
+          if (t5 == 0) { s->copy_length = copy_len; }
+        }
+      }
+    }
+    __syncthreads();
+  }
+  if (t < 32) {
+    PutBits(s, FixedLiteralCode(end_of_block).x, (t == 0) ? 7 : 0, t);
+    // Output the last partial word
+    if (t == 0) {
+      uint32_t num_bytes = (s->pending_bits + 7) / 8;
+      for (uint32_t i = 0; i < num_bytes; i++) {
+        if (s->dst + s->dst_pos + i < s->end) {
+          s->dst[s->dst_pos + i] = s->bit_buffer[0] >> (i * 8);
+        }
+      }
+      s->dst_pos += num_bytes;
+    }
+  }
+  __syncthreads();
+  if (!t) {
+    outputs[blockIdx.x].bytes_written = s->dst_pos;
+    outputs[blockIdx.x].status        = (s->dst + s->dst_pos > s->end) ? 1 : 0;
+    outputs[blockIdx.x].reserved      = 0;
+  }
+}
+
+size_t get_gpu_deflate_max_output_size(size_t uncomp_size)
+{
+  // Literals take at most 9 bits per byte, copies less; plus the block header and end of block
+  return uncomp_size + (uncomp_size + 7) / 8 + 2;
+}
+
+cudaError_t __host__ gpu_deflate(gpu_inflate_input_s* inputs,
+                                 gpu_inflate_status_s* outputs,
+                                 int count,
+                                 rmm::cuda_stream_view stream)
+{
+  dim3 dim_block(128, 1);  // 4 warps per stream, 1 stream per block
+  dim3 dim_grid(count, 1);
+  if (count > 0) {
+    deflate_kernel<<<dim_grid, dim_block, 0, stream.value()>>>(inputs, outputs, count);
+  }
+  return cudaSuccess;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -131,5 +131,33 @@ cudaError_t gpu_snap(gpu_inflate_input_s* inputs,
                      int count,
                      rmm::cuda_stream_view stream);
 
+/**
+ * @brief Computes the maximum size of the output of DEFLATE compression
+ *
+ * @param[in] uncomp_size The size in bytes of an uncompressed chunk
+ *
+ * @return The maximum size in bytes of the compressed chunk
+ */
+size_t get_gpu_deflate_max_output_size(size_t uncomp_size);
+
+/**
+ * @brief Interface for compressing data with DEFLATE
+ *
+ * Each chunk is compressed into a raw DEFLATE stream, without a zlib or GZIP header, made of a
+ * single block of fixed Huffman codes.
+ *
+ * Multiple, independent chunks of compressed data can be compressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures
+ * @param[in] stream CUDA stream to use
+ */
+cudaError_t gpu_deflate(gpu_inflate_input_s* inputs,
+                        gpu_inflate_status_s* outputs,
+                        int count,
+                        rmm::cuda_stream_view stream);
+
 }  // namespace io
 }  // namespace cudf
@@ -0,0 +1,437 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nvcomp_adapter.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <string>
+
+#include <nvcomp.h>
+#include <nvcomp/lz4.h>
+#include <nvcomp/snappy.h>
+
+#define NVCOMP_VERSION_AT_LEAST(major, minor) \
+  (NVCOMP_MAJOR_VERSION > (major) ||          \
+   (NVCOMP_MAJOR_VERSION == (major) && NVCOMP_MINOR_VERSION >= (minor)))
+
+#if NVCOMP_VERSION_AT_LEAST(2, 3) && __has_include(<nvcomp/zstd.h>)
+#include <nvcomp/zstd.h>
+#define NVCOMP_HAS_ZSTD_DECOMP 1
+#define NVCOMP_HAS_ZSTD_COMP NVCOMP_VERSION_AT_LEAST(2, 4)
+#else
+#define NVCOMP_HAS_ZSTD_DECOMP 0
+#define NVCOMP_HAS_ZSTD_COMP 0
+#endif
+
+#include <thrust/equal.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+namespace cudf {
+namespace io {
+namespace nvcomp {
+namespace {
+
+char const* format_name(compression_type type)
+{
+  switch (type) {
+    case compression_type::SNAPPY: return "snappy";
+    case compression_type::ZSTD: return "ZSTD";
+    case compression_type::LZ4: return "LZ4";
+  }
+  return "unknown";
+}
+
+size_t batched_decompress_temp_size(compression_type type,
+                                    size_t num_chunks,
+                                    size_t max_uncomp_chunk_size)
+{
+  size_t temp_size             = 0;
+  nvcompStatus_t nvcomp_status = nvcompStatus_t::nvcompErrorNotSupported;
+  switch (type) {
+    case compression_type::SNAPPY:
+      nvcomp_status =
+        nvcompBatchedSnappyDecompressGetTempSize(num_chunks, max_uncomp_chunk_size, &temp_size);
+      break;
+    case compression_type::ZSTD:
+#if NVCOMP_HAS_ZSTD_DECOMP
+      nvcomp_status =
+        nvcompBatchedZstdDecompressGetTempSize(num_chunks, max_uncomp_chunk_size, &temp_size);
+#endif
+      break;
+    case compression_type::LZ4:
+      nvcomp_status =
+        nvcompBatchedLZ4DecompressGetTempSize(num_chunks, max_uncomp_chunk_size, &temp_size);
+      break;
+  }
+  CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
+               std::string{"Unable to get scratch size for "} + format_name(type) +
+                 " decompression");
+  return temp_size;
+}
+
+nvcompStatus_t batched_decompress_async(compression_type type,
+                                        void const* const* compressed_data_ptrs,
+                                        size_t const* compressed_data_sizes,
+                                        size_t const* uncompressed_data_sizes,
+                                        size_t* actual_uncompressed_data_sizes,
+                                        size_t num_chunks,
+                                        void* temp_data,
+                                        size_t temp_size,
+                                        void* const* uncompressed_data_ptrs,
+                                        nvcompStatus_t* statuses,
+                                        rmm::cuda_stream_view stream)
+{
+  switch (type) {
+    case compression_type::SNAPPY:
+      return nvcompBatchedSnappyDecompressAsync(compressed_data_ptrs,
+                                                compressed_data_sizes,
+                                                uncompressed_data_sizes,
+                                                actual_uncompressed_data_sizes,
+                                                num_chunks,
+                                                temp_data,
+                                                temp_size,
+                                                uncompressed_data_ptrs,
+                                                statuses,
+                                                stream.value());
+    case compression_type::ZSTD:
+#if NVCOMP_HAS_ZSTD_DECOMP
+      return nvcompBatchedZstdDecompressAsync(compressed_data_ptrs,
+                                              compressed_data_sizes,
+                                              uncompressed_data_sizes,
+                                              actual_uncompressed_data_sizes,
+                                              num_chunks,
+                                              temp_data,
+                                              temp_size,
+                                              uncompressed_data_ptrs,
+                                              statuses,
+                                              stream.value());
+#else
+      return nvcompStatus_t::nvcompErrorNotSupported;
+#endif
+    case compression_type::LZ4:
+      return nvcompBatchedLZ4DecompressAsync(compressed_data_ptrs,
+                                             compressed_data_sizes,
+                                             uncompressed_data_sizes,
+                                             actual_uncompressed_data_sizes,
+                                             num_chunks,
+                                             temp_data,
+                                             temp_size,
+                                             uncompressed_data_ptrs,
+                                             statuses,
+                                             stream.value());
+  }
+  return nvcompStatus_t::nvcompErrorNotSupported;
+}
+
+size_t batched_compress_temp_size(compression_type type,
+                                  size_t num_chunks,
+                                  size_t max_uncomp_chunk_size)
+{
+  size_t temp_size             = 0;
+  nvcompStatus_t nvcomp_status = nvcompStatus_t::nvcompErrorNotSupported;
+  switch (type) {
+    case compression_type::SNAPPY:
+      nvcomp_status = nvcompBatchedSnappyCompressGetTempSize(
+        num_chunks, max_uncomp_chunk_size, nvcompBatchedSnappyDefaultOpts, &temp_size);
+      break;
+    case compression_type::ZSTD:
+#if NVCOMP_HAS_ZSTD_COMP
+      nvcomp_status = nvcompBatchedZstdCompressGetTempSize(
+        num_chunks, max_uncomp_chunk_size, nvcompBatchedZstdDefaultOpts, &temp_size);
+#endif
+      break;
+    case compression_type::LZ4:
+      nvcomp_status = nvcompBatchedLZ4CompressGetTempSize(
+        num_chunks, max_uncomp_chunk_size, nvcompBatchedLZ4DefaultOpts, &temp_size);
+      break;
+  }
+  CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
+               std::string{"Unable to get scratch size for "} + format_name(type) +
+                 " compression");
+  return temp_size;
+}
+
+nvcompStatus_t batched_compress_async(compression_type type,
+                                      void const* const* uncompressed_data_ptrs,
+                                      size_t const* uncompressed_data_sizes,
+                                      size_t max_uncomp_chunk_size,
+                                      size_t num_chunks,
+                                      void* temp_data,
+                                      size_t temp_size,
+                                      void* const* compressed_data_ptrs,
+                                      size_t* compressed_data_sizes,
+                                      rmm::cuda_stream_view stream)
+{
+  switch (type) {
+    case compression_type::SNAPPY:
+      return nvcompBatchedSnappyCompressAsync(uncompressed_data_ptrs,
+                                              uncompressed_data_sizes,
+                                              max_uncomp_chunk_size,
+                                              num_chunks,
+                                              temp_data,
+                                              temp_size,
+                                              compressed_data_ptrs,
+                                              compressed_data_sizes,
+                                              nvcompBatchedSnappyDefaultOpts,
+                                              stream.value());
+    case compression_type::ZSTD:
+#if NVCOMP_HAS_ZSTD_COMP
+      return nvcompBatchedZstdCompressAsync(uncompressed_data_ptrs,
+                                            uncompressed_data_sizes,
+                                            max_uncomp_chunk_size,
+                                            num_chunks,
+                                            temp_data,
+                                            temp_size,
+                                            compressed_data_ptrs,
+                                            compressed_data_sizes,
+                                            nvcompBatchedZstdDefaultOpts,
+                                            stream.value());
+#else
+      return nvcompStatus_t::nvcompErrorNotSupported;
+#endif
+    case compression_type::LZ4:
+      return nvcompBatchedLZ4CompressAsync(uncompressed_data_ptrs,
+                                           uncompressed_data_sizes,
+                                           max_uncomp_chunk_size,
+                                           num_chunks,
+                                           temp_data,
+                                           temp_size,
+                                           compressed_data_ptrs,
+                                           compressed_data_sizes,
+                                           nvcompBatchedLZ4DefaultOpts,
+                                           stream.value());
+  }
+  return nvcompStatus_t::nvcompErrorNotSupported;
+}
+
+}  // namespace
+
+bool is_decompression_supported(compression_type type)
+{
+  switch (type) {
+    case compression_type::SNAPPY:
+    case compression_type::LZ4: return true;
+    case compression_type::ZSTD: return NVCOMP_HAS_ZSTD_DECOMP;
+  }
+  return false;
+}
+
+bool is_compression_supported(compression_type type)
+{
+  switch (type) {
+    case compression_type::SNAPPY:
+    case compression_type::LZ4: return true;
+    case compression_type::ZSTD: return NVCOMP_HAS_ZSTD_COMP;
+  }
+  return false;
+}
+
+void batched_decompress(compression_type type,
+                        device_span<gpu_inflate_input_s const> inputs,
+                        device_span<gpu_inflate_status_s> statuses,
+                        size_t max_uncomp_chunk_size,
+                        bool exact_output_size,
+                        rmm::cuda_stream_view stream,
+                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_decompression_supported(type),
+               std::string{"This version of nvcomp does not support "} + format_name(type) +
+                 " decompression");
+  auto const num_chunks = inputs.size();
+  if (num_chunks == 0) { return; }
+
+  // Not needed now for all formats but nvcomp API makes no promises about future
+  rmm::device_buffer scratch(
+    batched_decompress_temp_size(type, num_chunks, max_uncomp_chunk_size), stream, mr);
+  // Analogous to inputs.srcDevice
+  rmm::device_uvector<void const*> compressed_data_ptrs(num_chunks, stream);
+  // Analogous to inputs.srcSize
+  rmm::device_uvector<size_t> compressed_data_sizes(num_chunks, stream);
+  // Analogous to inputs.dstDevice
+  rmm::device_uvector<void*> uncompressed_data_ptrs(num_chunks, stream);
+  // Analogous to inputs.dstSize
+  rmm::device_uvector<size_t> uncompressed_data_sizes(num_chunks, stream);
+
+  // Analogous to statuses.bytes_written
+  rmm::device_uvector<size_t> actual_uncompressed_data_sizes(num_chunks, stream);
+  // Convertible to statuses.status
+  rmm::device_uvector<nvcompStatus_t> nvcomp_statuses(num_chunks, stream);
+
+  // Prepare the vectors
+  auto comp_it = thrust::make_zip_iterator(compressed_data_ptrs.begin(),
+                                           compressed_data_sizes.begin(),
+                                           uncompressed_data_ptrs.begin(),
+                                           uncompressed_data_sizes.begin());
+  thrust::transform(rmm::exec_policy(stream),
+                    inputs.begin(),
+                    inputs.end(),
+                    comp_it,
+                    [] __device__(gpu_inflate_input_s in) {
+                      return thrust::make_tuple(in.srcDevice, in.srcSize, in.dstDevice, in.dstSize);
+                    });
+
+  auto const nvcomp_status = batched_decompress_async(type,
+                                                      compressed_data_ptrs.data(),
+                                                      compressed_data_sizes.data(),
+                                                      uncompressed_data_sizes.data(),
+                                                      actual_uncompressed_data_sizes.data(),
+                                                      num_chunks,
+                                                      scratch.data(),
+                                                      scratch.size(),
+                                                      uncompressed_data_ptrs.data(),
+                                                      nvcomp_statuses.data(),
+                                                      stream);
+  CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
+               std::string{"Unable to perform "} + format_name(type) + " decompression");
+
+  if (exact_output_size) {
+    CUDF_EXPECTS(thrust::equal(rmm::exec_policy(stream),
+                               uncompressed_data_sizes.begin(),
+                               uncompressed_data_sizes.end(),
+                               actual_uncompressed_data_sizes.begin()),
+                 std::string{"Mismatch in expected and actual decompressed size during "} +
+                   format_name(type) + " decompression");
+  }
+  CUDF_EXPECTS(thrust::equal(rmm::exec_policy(stream),
+                             nvcomp_statuses.begin(),
+                             nvcomp_statuses.end(),
+                             thrust::make_constant_iterator(nvcompStatus_t::nvcompSuccess)),
+               std::string{"Error during "} + format_name(type) + " decompression");
+
+  thrust::transform(rmm::exec_policy(stream),
+                    actual_uncompressed_data_sizes.begin(),
+                    actual_uncompressed_data_sizes.end(),
+                    statuses.begin(),
+                    [] __device__(size_t size) {
+                      gpu_inflate_status_s status{};
+                      status.bytes_written = size;
+                      return status;
+                    });
+}
+
+void batched_compress(compression_type type,
+                      device_span<gpu_inflate_input_s const> inputs,
+                      device_span<gpu_inflate_status_s> statuses,
+                      size_t max_uncomp_chunk_size,
+                      rmm::cuda_stream_view stream)
+{
+  auto const num_chunks = inputs.size();
+  if (num_chunks == 0) { return; }
+  try {
+    CUDF_EXPECTS(is_compression_supported(type),
+                 std::string{"This version of nvcomp does not support "} + format_name(type) +
+                   " compression");
+
+    // Not needed now for all formats but nvcomp API makes no promises about future
+    rmm::device_buffer scratch(batched_compress_temp_size(type, num_chunks, max_uncomp_chunk_size),
+                               stream);
+    // Analogous to inputs.srcDevice
+    rmm::device_uvector<void const*> uncompressed_data_ptrs(num_chunks, stream);
+    // Analogous to inputs.srcSize
+    rmm::device_uvector<size_t> uncompressed_data_sizes(num_chunks, stream);
+    // Analogous to inputs.dstDevice
+    rmm::device_uvector<void*> compressed_data_ptrs(num_chunks, stream);
+    // Analogous to statuses.bytes_written
+    rmm::device_uvector<size_t> compressed_bytes_written(num_chunks, stream);
+    // nvcomp does not use inputs.dstSize. Cannot assume that the output will fit in the space
+    // allocated unless it was sized with compress_max_output_chunk_size()
+
+    // Prepare the vectors
+    auto comp_it = thrust::make_zip_iterator(uncompressed_data_ptrs.begin(),
+                                             uncompressed_data_sizes.begin(),
+                                             compressed_data_ptrs.begin());
+    thrust::transform(rmm::exec_policy(stream),
+                      inputs.begin(),
+                      inputs.end(),
+                      comp_it,
+                      [] __device__(gpu_inflate_input_s in) {
+                        return thrust::make_tuple(in.srcDevice, in.srcSize, in.dstDevice);
+                      });
+    auto const nvcomp_status = batched_compress_async(type,
+                                                      uncompressed_data_ptrs.data(),
+                                                      uncompressed_data_sizes.data(),
+                                                      max_uncomp_chunk_size,
+                                                      num_chunks,
+                                                      scratch.data(),
+                                                      scratch.size(),
+                                                      compressed_data_ptrs.data(),
+                                                      compressed_bytes_written.data(),
+                                                      stream);
+    CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
+                 std::string{"Error in "} + format_name(type) + " compression");
+
+    // nvcomp doesn't report per-chunk statuses. It guarantees that given enough output space,
+    // compression will succeed.
+    // The other status field is `reserved` which is for internal cuIO debugging and can be 0.
+    thrust::transform(rmm::exec_policy(stream),
+                      compressed_bytes_written.begin(),
+                      compressed_bytes_written.end(),
+                      statuses.begin(),
+                      [] __device__(size_t size) {
+                        gpu_inflate_status_s status{};
+                        status.bytes_written = size;
+                        return status;
+                      });
+  } catch (...) {
+    // If we reach this then there was an error in compressing so set an error status for all
+    thrust::for_each(rmm::exec_policy(stream),
+                     statuses.begin(),
+                     statuses.end(),
+                     [] __device__(gpu_inflate_status_s & stat) { stat.status = 1; });
+  }
+}
+
+size_t compress_max_output_chunk_size(compression_type type, size_t max_uncomp_chunk_size)
+{
+  CUDF_EXPECTS(is_compression_supported(type),
+               std::string{"This version of nvcomp does not support "} + format_name(type) +
+                 " compression");
+  size_t max_comp_chunk_size   = 0;
+  nvcompStatus_t nvcomp_status = nvcompStatus_t::nvcompErrorNotSupported;
+  switch (type) {
+    case compression_type::SNAPPY:
+      nvcomp_status = nvcompBatchedSnappyCompressGetMaxOutputChunkSize(
+        max_uncomp_chunk_size, nvcompBatchedSnappyDefaultOpts, &max_comp_chunk_size);
+      break;
+    case compression_type::ZSTD:
+#if NVCOMP_HAS_ZSTD_COMP
+      nvcomp_status = nvcompBatchedZstdCompressGetMaxOutputChunkSize(
+        max_uncomp_chunk_size, nvcompBatchedZstdDefaultOpts, &max_comp_chunk_size);
+#endif
+      break;
+    case compression_type::LZ4:
+      nvcomp_status = nvcompBatchedLZ4CompressGetMaxOutputChunkSize(
+        max_uncomp_chunk_size, nvcompBatchedLZ4DefaultOpts, &max_comp_chunk_size);
+      break;
+  }
+  CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
+               "Error in getting compressed size from nvcomp");
+  return max_comp_chunk_size;
+}
+
+}  // namespace nvcomp
+}  // namespace io
+}  // namespace cudf
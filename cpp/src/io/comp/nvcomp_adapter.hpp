@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file nvcomp_adapter.hpp
+ * @brief Batched compression and decompression of independent chunks through nvcomp
+ */
+
+#pragma once
+
+#include "gpuinflate.h"
+
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+namespace cudf {
+namespace io {
+namespace nvcomp {
+
+/**
+ * @brief Compression formats supported through nvcomp's batched API
+ */
+enum class compression_type { SNAPPY, ZSTD, LZ4 };
+
+/**
+ * @brief Returns whether the nvcomp library cuDF was built against can decompress `type`
+ *
+ * ZSTD decompression requires nvcomp 2.3 or later.
+ */
+[[nodiscard]] bool is_decompression_supported(compression_type type);
+
+/**
+ * @brief Returns whether the nvcomp library cuDF was built against can compress to `type`
+ *
+ * ZSTD compression requires nvcomp 2.4 or later.
+ */
+[[nodiscard]] bool is_compression_supported(compression_type type);
+
+/**
+ * @brief Decompresses a batch of independent chunks
+ *
+ * Any failure throws, including a chunk that does not decompress to exactly `dstSize` bytes when
+ * `exact_output_size` is set. Otherwise `dstSize` is only an upper bound, as for the blocks of ORC
+ * streams whose uncompressed size is not stored.
+ *
+ * @param type Compression format of the chunks
+ * @param inputs Location and size of each compressed chunk and of its output
+ * @param[out] statuses Number of bytes written for each chunk; statuses are set to zero
+ * @param max_uncomp_chunk_size Maximum uncompressed size of a chunk
+ * @param exact_output_size Whether each chunk must fill its output buffer
+ * @param stream CUDA stream to use
+ * @param mr Device memory resource used to allocate the temporary space of nvcomp
+ */
+void batched_decompress(
+  compression_type type,
+  device_span<gpu_inflate_input_s const> inputs,
+  device_span<gpu_inflate_status_s> statuses,
+  size_t max_uncomp_chunk_size,
+  bool exact_output_size,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Compresses a batch of independent chunks
+ *
+ * Each output buffer must hold at least `compress_max_output_chunk_size` bytes, as nvcomp does not
+ * honor `dstSize`. Errors are reported by setting the status of every chunk to a nonzero value.
+ *
+ * @param type Compression format to use
+ * @param inputs Location and size of each uncompressed chunk and of its output
+ * @param[out] statuses Number of bytes written for each chunk, and its status
+ * @param max_uncomp_chunk_size Maximum uncompressed size of a chunk
+ * @param stream CUDA stream to use
+ */
+void batched_compress(compression_type type,
+                      device_span<gpu_inflate_input_s const> inputs,
+                      device_span<gpu_inflate_status_s> statuses,
+                      size_t max_uncomp_chunk_size,
+                      rmm::cuda_stream_view stream);
+
+/**
+ * @brief Returns the maximum size of a compressed chunk, given its maximum uncompressed size
+ */
+[[nodiscard]] size_t compress_max_output_chunk_size(compression_type type,
+                                                    size_t max_uncomp_chunk_size);
+
+}  // namespace nvcomp
+}  // namespace io
+}  // namespace cudf
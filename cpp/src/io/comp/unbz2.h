@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -77,6 +77,10 @@ For more information on these sources, see the manual.
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 namespace cudf {
 namespace io {
 // If BZ_OUTBUFF_FULL is returned and block_start is non-NULL, dstlen will be updated to point to
@@ -102,5 +106,10 @@ int32_t cpu_bz2_uncompress(const uint8_t* input,
                            size_t* dstlen,
                            uint64_t* block_start = nullptr);
 
+// Decompresses a whole stream, decoding its blocks concurrently on the shared host thread pool.
+// The output is sized as the blocks are decoded, so its size need not be known in advance. Streams
+// with several concatenated bzip2 streams are not supported.
+int32_t cpu_bz2_uncompress_blocks(const uint8_t* input, size_t inlen, std::vector<char>& dst);
+
 }  // namespace io
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,11 +15,18 @@
  */
 
 #include "io_uncomp.h"
+#include "nvcomp_adapter.hpp"
 #include "unbz2.h"  // bz2 uncompress
 
+#include <io/utilities/config_utils.hpp>
+
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+
 #include <cuda_runtime.h>
 
 #include <cstring>  // memset
@@ -385,27 +392,9 @@ std::vector<char> io_uncompress_single_h2d(const void* src, size_t src_size, int
     return dst;
   }
   if (stream_type == IO_UNCOMP_STREAM_TYPE_BZIP2) {
-    size_t src_ofs = 0;
-    size_t dst_ofs = 0;
-    int bz_err     = 0;
-    std::vector<char> dst(uncomp_len);
-    do {
-      size_t dst_len = uncomp_len - dst_ofs;
-      bz_err         = cpu_bz2_uncompress(
-        comp_data, comp_len, reinterpret_cast<uint8_t*>(dst.data()) + dst_ofs, &dst_len, &src_ofs);
-      if (bz_err == BZ_OUTBUFF_FULL) {
-        // TBD: We could infer the compression ratio based on produced/consumed byte counts
-        // in order to minimize realloc events and over-allocation
-        dst_ofs = dst_len;
-        dst_len = uncomp_len + (uncomp_len / 2);
-        dst.resize(dst_len);
-        uncomp_len = dst_len;
-      } else if (bz_err == 0) {
-        uncomp_len = dst_len;
-        dst.resize(uncomp_len);
-      }
-    } while (bz_err == BZ_OUTBUFF_FULL);
-    CUDF_EXPECTS(bz_err == 0, "Decompression: error in stream");
+    std::vector<char> dst;
+    CUDF_EXPECTS(cpu_bz2_uncompress_blocks(comp_data, comp_len, dst) == BZ_OK,
+                 "Decompression: error in stream");
     return dst;
   }
 
@@ -559,6 +548,44 @@ class HostDecompressor_SNAPPY : public HostDecompressor {
   }
 };
 
+/**
+ * @brief Host decompressor class for the formats that are only decompressed through nvcomp
+ *
+ * Each block is copied to the device and back, which is only worth it for small buffers such as
+ * the metadata of ORC files.
+ */
+class HostDecompressor_NVCOMP : public HostDecompressor {
+ public:
+  explicit HostDecompressor_NVCOMP(nvcomp::compression_type type_) : type(type_) {}
+  size_t Decompress(uint8_t* dstBytes,
+                    size_t dstLen,
+                    const uint8_t* srcBytes,
+                    size_t srcLen) override
+  {
+    if (!dstBytes || srcLen < 1) { return 0; }
+    auto const stream = rmm::cuda_stream_default;
+    try {
+      rmm::device_buffer src(srcBytes, srcLen, stream);
+      rmm::device_buffer dst(dstLen, stream);
+      gpu_inflate_input_s const input{src.data(), srcLen, dst.data(), dstLen};
+      rmm::device_uvector<gpu_inflate_input_s> inputs(1, stream);
+      rmm::device_uvector<gpu_inflate_status_s> statuses(1, stream);
+      inputs.set_element_async(0, input, stream);
+      nvcomp::batched_decompress(type, inputs, statuses, dstLen, false, stream);
+      auto const bytes_written = statuses.element(0, stream).bytes_written;
+      CUDA_TRY(cudaMemcpyAsync(
+        dstBytes, dst.data(), bytes_written, cudaMemcpyDeviceToHost, stream.value()));
+      stream.synchronize();
+      return bytes_written;
+    } catch (cudf::logic_error const&) {
+      return 0;
+    }
+  }
+
+ protected:
+  const nvcomp::compression_type type;
+};
+
 /**
  * @brief CPU decompression class
  *
@@ -572,6 +599,13 @@ std::unique_ptr<HostDecompressor> HostDecompressor::Create(int stream_type)
     case IO_UNCOMP_STREAM_TYPE_GZIP: return std::make_unique<HostDecompressor_ZLIB>(true);
     case IO_UNCOMP_STREAM_TYPE_INFLATE: return std::make_unique<HostDecompressor_ZLIB>(false);
     case IO_UNCOMP_STREAM_TYPE_SNAPPY: return std::make_unique<HostDecompressor_SNAPPY>();
+    case IO_UNCOMP_STREAM_TYPE_ZSTD:
+    case IO_UNCOMP_STREAM_TYPE_LZ4:
+      CUDF_EXPECTS(detail::nvcomp_integration::is_stable_enabled(),
+                   "ZSTD and LZ4 decompression require nvCOMP use to be enabled");
+      return std::make_unique<HostDecompressor_NVCOMP>(stream_type == IO_UNCOMP_STREAM_TYPE_ZSTD
+                                                         ? nvcomp::compression_type::ZSTD
+                                                         : nvcomp::compression_type::LZ4);
   }
   CUDF_FAIL("Unsupported compression type");
 }
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file chunked_reader.cpp
+ * @brief cuDF-IO CSV reader of files in fixed-size byte ranges
+ */
+
+#include <io/utilities/byte_range_reader.hpp>
+
+#include <cudf/io/datasource.hpp>
+#include <cudf/io/detail/csv.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <map>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace csv {
+
+/**
+ * @brief Implementation of the chunked reader
+ *
+ * The data left to parse is kept on the host, prefixed with the header lines of the file so that
+ * each chunk is parsed as a complete CSV input. Each chunk parses the complete rows of the data
+ * and keeps the trailing partial row for the next one.
+ */
+class chunked_reader::impl {
+ public:
+  impl(std::size_t chunk_read_size,
+       std::unique_ptr<cudf::io::datasource>&& source,
+       csv_reader_options const& options,
+       rmm::cuda_stream_view stream,
+       rmm::mr::device_memory_resource* mr)
+    : _reader(std::move(source), chunk_read_size), _options(options), _stream(stream), _mr(mr)
+  {
+    CUDF_EXPECTS(options.get_compression() == compression_type::NONE,
+                 "Chunked reading of compressed data is unsupported");
+    CUDF_EXPECTS(options.get_byte_range_offset() == 0 && options.get_byte_range_size() == 0,
+                 "Chunked reading does not support byte ranges");
+    CUDF_EXPECTS(options.get_skiprows() <= 0 && options.get_skipfooter() <= 0 &&
+                   options.get_nrows() == -1,
+                 "Chunked reading does not support row selection");
+  }
+
+  [[nodiscard]] bool has_next() const
+  {
+    return _first_chunk || _reader.has_ranges() || _reader.data().size() > _header_size;
+  }
+
+  table_with_metadata read_chunk()
+  {
+    CUDF_EXPECTS(has_next(), "No data left to read");
+    auto const terminator = _options.get_lineterminator_sequence().empty()
+                              ? std::string(1, _options.get_lineterminator())
+                              : _options.get_lineterminator_sequence();
+    auto& data = _reader.data();
+
+    // The header lines are carried over from the first chunk
+    if (_first_chunk && _options.get_header() >= 0) {
+      auto const num_header_lines = static_cast<size_t>(_options.get_header()) + 1;
+      size_t header_end           = 0;
+      for (size_t line = 0; line < num_header_lines; ++line) {
+        auto const line_end = _reader.find_line_end(header_end, terminator);
+        if (not line_end.has_value()) {
+          header_end = data.size();
+          break;
+        }
+        header_end = *line_end;
+      }
+      _header_size = header_end;
+    }
+
+    // Read ranges until the data holds a complete row past the header, or the source is exhausted
+    auto const rows_end = _reader.find_last_line_end(_header_size, terminator);
+    auto result =
+      read_csv(datasource::create(host_buffer{data.data(), rows_end}), _options, _stream, _mr);
+    data.erase(data.begin() + _header_size, data.begin() + rows_end);
+
+    carry_over_types(result);
+    _first_chunk = false;
+    return result;
+  }
+
+ private:
+  /**
+   * @brief Sets the types inferred for the first rows as the types of all later chunks
+   *
+   * Columns are named the same in all chunks, after the header lines or their index, so the types
+   * are set by name.
+   */
+  void carry_over_types(table_with_metadata const& result)
+  {
+    if (result.tbl->num_rows() == 0) { return; }
+    auto const has_types =
+      std::visit([](auto const& dtypes) { return not dtypes.empty(); }, _options.get_dtypes());
+    if (has_types) { return; }
+    std::map<std::string, data_type> types;
+    for (size_type col = 0; col < result.tbl->num_columns(); ++col) {
+      types[result.metadata.column_names[col]] = result.tbl->get_column(col).type();
+    }
+    _options.set_dtypes(std::move(types));
+  }
+
+  // Header lines, followed by the data left to parse
+  cudf::io::detail::byte_range_reader _reader;
+  csv_reader_options _options;
+  rmm::cuda_stream_view _stream;
+  rmm::mr::device_memory_resource* _mr;
+
+  size_t _header_size = 0;
+  bool _first_chunk   = true;
+};
+
+chunked_reader::chunked_reader(std::size_t chunk_read_size,
+                               std::unique_ptr<cudf::io::datasource>&& source,
+                               csv_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+  : _impl(std::make_unique<impl>(chunk_read_size, std::move(source), options, stream, mr))
+{
+}
+
+chunked_reader::~chunked_reader() = default;
+
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+table_with_metadata chunked_reader::read_chunk() { return _impl->read_chunk(); }
+
+}  // namespace csv
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
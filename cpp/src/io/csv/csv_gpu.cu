@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -41,6 +41,7 @@
 #include <thrust/detail/copy.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
 #include <type_traits>
 
 using namespace ::cudf::io;
@@ -159,12 +160,14 @@ __device__ __inline__ bool is_floatingpoint(long len,
  * @brief CUDA kernel that parses and converts CSV data into cuDF column data.
  *
  * Data is processed in one row/record at a time, so the number of total
- * threads (tid) is equal to the number of rows.
+ * threads (tid) is equal to the number of sampled rows. The sampled rows are
+ * spread evenly across all the rows.
  *
  * @param opts A set of parsing options
  * @param csv_text The entire CSV data to read
  * @param column_flags Per-column parsing behavior flags
  * @param row_offsets The start the CSV data of interest
+ * @param num_samples The number of rows to sample, at most the number of rows
  * @param d_column_data The count for each column data type
  */
 __global__ void __launch_bounds__(csvparse_block_dim)
@@ -172,18 +175,21 @@ __global__ void __launch_bounds__(csvparse_block_dim)
                       device_span<char const> csv_text,
                       device_span<column_parse::flags const> const column_flags,
                       device_span<uint64_t const> const row_offsets,
+                      size_t const num_samples,
                       device_span<column_type_histogram> d_column_data)
 {
   auto const raw_csv = csv_text.data();
 
   // ThreadIds range per block, so also need the blockId
-  // This is entry into the fields; threadId is an element within `num_records`
-  long const rec_id      = threadIdx.x + (blockDim.x * blockIdx.x);
-  long const rec_id_next = rec_id + 1;
+  // This is entry into the samples; threadId is an element within `num_samples`
+  long const sample_id = threadIdx.x + (blockDim.x * blockIdx.x);
 
   // we can have more threads than data, make sure we are not past the end of
   // the data
-  if (rec_id_next >= row_offsets.size()) { return; }
+  if (sample_id >= num_samples || row_offsets.size() < 2) { return; }
+  // Spread the samples evenly across the rows; this is the identity when all rows are sampled
+  long const rec_id      = sample_id * (row_offsets.size() - 1) / num_samples;
+  long const rec_id_next = rec_id + 1;
 
   auto field_start   = raw_csv + row_offsets[rec_id];
   auto const row_end = raw_csv + row_offsets[rec_id_next];
@@ -285,7 +291,7 @@ __global__ void __launch_bounds__(csvparse_block_dim)
       }
       actual_col++;
     }
-    next_field  = next_delimiter + 1;
+    next_field  = cudf::io::gpu::next_field_start(next_delimiter, opts);
     field_start = next_field;
     col++;
   }
@@ -571,7 +577,7 @@ __global__ void __launch_bounds__(csvparse_block_dim)
       }
       ++actual_col;
     }
-    next_field  = next_delimiter + 1;
+    next_field  = cudf::io::gpu::next_field_start(next_delimiter, options);
     field_start = next_field;
     ++col;
   }
@@ -805,8 +811,8 @@ static inline __device__ rowctx32_t rowctx_inverse_merge_transform(uint64_t ctxt
  * @param byte_range_start Ignore rows starting before this position in the file
  * @param byte_range_end In phase 2, store the number of rows beyond range in row_ctx
  * @param skip_rows Number of rows to skip (ignored in phase 1)
- * @param terminator Line terminator character
- * @param delimiter Column delimiter character
+ * @param terminator Line terminator sequence
+ * @param delimiter Column delimiter sequence
  * @param quotechar Quote character
  * @param escapechar Delimiter escape character
  * @param commentchar Comment line character (skip rows starting with this character)
@@ -822,8 +828,8 @@ __global__ void __launch_bounds__(rowofs_block_dim)
                          size_t byte_range_start,
                          size_t byte_range_end,
                          size_t skip_rows,
-                         int terminator,
-                         int delimiter,
+                         char_sequence const terminator,
+                         char_sequence const delimiter,
                          int quotechar,
                          int escapechar,
                          int commentchar)
@@ -847,13 +853,14 @@ __global__ void __launch_bounds__(rowofs_block_dim)
     .y = 0,
     .z = 0,
     .w = (ROW_CTX_NONE << 0) | (ROW_CTX_QUOTE << 2) | (ROW_CTX_COMMENT << 4) | (ROW_CTX_EOF << 6)};
-  int c, c_prev = (cur > start && cur <= end) ? cur[-1] : terminator;
-  // Loop through all 32 bytes and keep a bitmask of row starts for each possible input context
-  for (uint32_t pos = 0; pos < 32; pos++, cur++, c_prev = c) {
+  // Loop through all 32 bytes and keep a bitmask of row starts for each possible input context.
+  // Terminators and delimiters are matched ending at the previous character, so that the context
+  // of each character depends on the data alone and the transitions can be merged in any order.
+  for (uint32_t pos = 0; pos < 32; pos++, cur++) {
     uint32_t ctx;
     if (cur < end) {
-      c = cur[0];
-      if (c_prev == terminator) {
+      int const c = cur[0];
+      if (cur == start || terminator.ends_at(cur - 1, start)) {
         if (c == commentchar) {
           // Start of a new comment row
           ctx = make_char_context(ROW_CTX_COMMENT, ROW_CTX_QUOTE, ROW_CTX_COMMENT, 1, 0, 1);
@@ -865,7 +872,7 @@ __global__ void __launch_bounds__(rowofs_block_dim)
           ctx = make_char_context(ROW_CTX_NONE, ROW_CTX_QUOTE, ROW_CTX_NONE, 1, 0, 1);
         }
       } else if (c == quotechar) {
-        if (c_prev == delimiter || c_prev == quotechar) {
+        if (delimiter.ends_at(cur - 1, start) || cur[-1] == quotechar) {
           // Quoted string after delimiter, quoted string ending in delimiter, or double-quote
           ctx = make_char_context(ROW_CTX_QUOTE, ROW_CTX_NONE);
         } else {
@@ -936,22 +943,48 @@ __global__ void __launch_bounds__(rowofs_block_dim)
   }
 }
 
+/**
+ * @brief Functor returning whether the row starting at a given offset is blank or a comment line
+ */
+struct blank_row_fn {
+  device_span<char const> data;
+  char newline;
+  char comment;
+  char carriage;
+  // Multi-character line terminator of blank rows; empty without one
+  char_sequence terminator;
+
+  __device__ bool operator()(uint64_t const pos) const
+  {
+    return (pos != data.size()) &&
+           (data[pos] == newline || data[pos] == comment || data[pos] == carriage ||
+            terminator.starts_at(data.data() + pos, data.data() + data.size()));
+  }
+};
+
+blank_row_fn make_blank_row_fn(cudf::io::parse_options_view const& opts,
+                               device_span<char const> data)
+{
+  // A multi-character terminator is matched as a whole, rather than by its first character
+  auto const multichar_terminator = opts.skipblanklines && opts.terminator_seq.size > 1;
+  auto const skip_newline         = opts.skipblanklines && !multichar_terminator;
+
+  const auto newline  = skip_newline ? opts.terminator : opts.comment;
+  const auto comment  = opts.comment != '\0' ? opts.comment : newline;
+  const auto carriage = (skip_newline && opts.terminator == '\n') ? '\r' : comment;
+  return {
+    data, newline, comment, carriage, multichar_terminator ? opts.terminator_seq : char_sequence{}};
+}
+
 size_t __host__ count_blank_rows(const cudf::io::parse_options_view& opts,
                                  device_span<char const> data,
                                  device_span<uint64_t const> row_offsets,
                                  rmm::cuda_stream_view stream)
 {
-  const auto newline  = opts.skipblanklines ? opts.terminator : opts.comment;
-  const auto comment  = opts.comment != '\0' ? opts.comment : newline;
-  const auto carriage = (opts.skipblanklines && opts.terminator == '\n') ? '\r' : comment;
-  return thrust::count_if(
-    rmm::exec_policy(stream),
-    row_offsets.begin(),
-    row_offsets.end(),
-    [data = data, newline, comment, carriage] __device__(const uint64_t pos) {
-      return ((pos != data.size()) &&
-              (data[pos] == newline || data[pos] == comment || data[pos] == carriage));
-    });
+  return thrust::count_if(rmm::exec_policy(stream),
+                          row_offsets.begin(),
+                          row_offsets.end(),
+                          make_blank_row_fn(opts, data));
 }
 
 device_span<uint64_t> __host__ remove_blank_rows(cudf::io::parse_options_view const& options,
@@ -959,18 +992,10 @@ device_span<uint64_t> __host__ remove_blank_rows(cudf::io::parse_options_view co
                                                  device_span<uint64_t> row_offsets,
                                                  rmm::cuda_stream_view stream)
 {
-  size_t d_size       = data.size();
-  const auto newline  = options.skipblanklines ? options.terminator : options.comment;
-  const auto comment  = options.comment != '\0' ? options.comment : newline;
-  const auto carriage = (options.skipblanklines && options.terminator == '\n') ? '\r' : comment;
-  auto new_end        = thrust::remove_if(
-    rmm::exec_policy(stream),
-    row_offsets.begin(),
-    row_offsets.end(),
-    [data = data, d_size, newline, comment, carriage] __device__(const uint64_t pos) {
-      return ((pos != d_size) &&
-              (data[pos] == newline || data[pos] == comment || data[pos] == carriage));
-    });
+  auto new_end = thrust::remove_if(rmm::exec_policy(stream),
+                                   row_offsets.begin(),
+                                   row_offsets.end(),
+                                   make_blank_row_fn(options, data));
   return row_offsets.subspan(0, new_end - row_offsets.begin());
 }
 
@@ -980,17 +1005,22 @@ std::vector<column_type_histogram> detect_column_types(
   device_span<column_parse::flags const> const column_flags,
   device_span<uint64_t const> const row_starts,
   size_t const num_active_columns,
+  size_t const num_samples,
   rmm::cuda_stream_view stream)
 {
-  // Calculate actual block count to use based on records count
+  auto const num_rows = std::max<size_t>(row_starts.size(), 1) - 1;
+  auto const num_sampled_rows =
+    (num_samples == 0) ? num_rows : std::min<size_t>(num_samples, num_rows);
+
+  // Calculate actual block count to use based on sampled records count
   const int block_size = csvparse_block_dim;
-  const int grid_size  = (row_starts.size() + block_size - 1) / block_size;
+  const int grid_size  = std::max<size_t>((num_sampled_rows + block_size - 1) / block_size, 1);
 
   auto d_stats =
     detail::make_zeroed_device_uvector_async<column_type_histogram>(num_active_columns, stream);
 
   data_type_detection<<<grid_size, block_size, 0, stream.value()>>>(
-    options, data, column_flags, row_starts, d_stats);
+    options, data, column_flags, row_starts, num_sampled_rows, d_stats);
 
   return detail::make_std_vector_sync(d_stats, stream);
 }
@@ -1039,8 +1069,8 @@ uint32_t __host__ gather_row_offsets(const parse_options_view& options,
     byte_range_start,
     byte_range_end,
     skip_rows,
-    options.terminator,
-    options.delimiter,
+    options.terminator_seq,
+    options.delimiter_seq,
     (options.quotechar) ? options.quotechar : 0x100,
     /*(options.escapechar) ? options.escapechar :*/ 0x100,
     (options.comment) ? options.comment : 0x100);
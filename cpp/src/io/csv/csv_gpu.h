@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -195,9 +195,12 @@ device_span<uint64_t> remove_blank_rows(const cudf::io::parse_options_view& opti
  * @param[in] data The row-column data
  * @param[in] column_flags Flags that control individual column parsing
  * @param[in] row_offsets List of row data start positions (offsets)
+ * @param[in] num_active_columns Number of columns to detect the dtype of
+ * @param[in] num_samples Number of rows, spread evenly across the data, to detect the dtypes
+ * from; `0` for all the rows
  * @param[in] stream CUDA stream to use, default 0
  *
- * @return stats Histogram of each dtypes' occurrence for each column
+ * @return stats Histogram of each dtypes' occurrence for each column, in the sampled rows
  */
 std::vector<column_type_histogram> detect_column_types(
   cudf::io::parse_options_view const& options,
@@ -205,6 +208,7 @@ std::vector<column_type_histogram> detect_column_types(
   device_span<column_parse::flags const> column_flags,
   device_span<uint64_t const> row_offsets,
   size_t const num_active_columns,
+  size_t const num_samples,
   rmm::cuda_stream_view stream);
 
 /**
@@ -26,6 +26,7 @@
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
 #include <io/utilities/parsing_utils.cuh>
+#include <io/utilities/reader_profiler.hpp>
 #include <io/utilities/type_conversion.hpp>
 
 #include <cudf/detail/utilities/cuda.cuh>
@@ -46,6 +47,7 @@
 #include <iostream>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -133,6 +135,14 @@ std::vector<std::string> get_column_names(std::vector<char> const& header,
   std::vector<char> first_row = header;
   int num_cols                = 0;
 
+  auto const first_row_end = first_row.data() + first_row.size();
+  auto const is_delimiter  = [&](size_t pos) {
+    return parse_opts.delimiter_seq.starts_at(first_row.data() + pos, first_row_end);
+  };
+  auto const is_terminator = [&](size_t pos) {
+    return parse_opts.terminator_seq.starts_at(first_row.data() + pos, first_row_end);
+  };
+
   bool quotation = false;
   for (size_t pos = 0, prev = 0; pos < first_row.size(); ++pos) {
     // Flip the quotation flag if current character is a quotechar
@@ -140,17 +150,17 @@ std::vector<std::string> get_column_names(std::vector<char> const& header,
       quotation = !quotation;
     }
     // Check if end of a column/row
-    else if (pos == first_row.size() - 1 ||
-             (!quotation && first_row[pos] == parse_opts.terminator) ||
-             (!quotation && first_row[pos] == parse_opts.delimiter)) {
+    else if (pos == first_row.size() - 1 || (!quotation && is_terminator(pos)) ||
+             (!quotation && is_delimiter(pos))) {
+      auto const separator_size = is_delimiter(pos)    ? parse_opts.delimiter_seq.size
+                                  : is_terminator(pos) ? parse_opts.terminator_seq.size
+                                                       : 1;
       // This is the header, add the column name
       if (header_row >= 0) {
         // Include the current character, in case the line is not terminated
         int col_name_len = pos - prev + 1;
         // Exclude the delimiter/terminator is present
-        if (first_row[pos] == parse_opts.delimiter || first_row[pos] == parse_opts.terminator) {
-          --col_name_len;
-        }
+        if (is_delimiter(pos) || is_terminator(pos)) { --col_name_len; }
         // Also exclude '\r' character at the end of the column name if it's
         // part of the terminator
         if (col_name_len > 0 && parse_opts.terminator == '\n' && first_row[pos] == '\n' &&
@@ -165,7 +175,7 @@ std::vector<std::string> get_column_names(std::vector<char> const& header,
         // a blank line following the header. In this case, first_row includes
         // multiple line terminators at the end, as the new recStart belongs to
         // a line that comes after the blank line(s)
-        if (!quotation && first_row[pos] == parse_opts.terminator) { break; }
+        if (!quotation && is_terminator(pos)) { break; }
       } else {
         // This is the first data row, add the automatically generated name
         col_names.push_back(prefix + std::to_string(num_cols));
@@ -177,6 +187,8 @@ std::vector<std::string> get_column_names(std::vector<char> const& header,
              first_row[pos] == parse_opts.delimiter && first_row[pos + 1] == parse_opts.delimiter) {
         ++pos;
       }
+      // Skip the rest of a multi-character delimiter or terminator
+      pos += separator_size - 1;
       prev = pos + 1;
     }
   }
@@ -195,15 +207,16 @@ void erase_except_last(C& container, rmm::cuda_stream_view stream)
   container.resize(1, stream);
 }
 
-size_t find_first_row_start(char row_terminator, host_span<char const> data)
+size_t find_first_row_start(char_sequence const& row_terminator, host_span<char const> data)
 {
   // For now, look for the first terminator (assume the first terminator isn't within a quote)
   // TODO: Attempt to infer this from the data
-  size_t pos = 0;
-  while (pos < data.size() && data[pos] != row_terminator) {
-    ++pos;
-  }
-  return std::min(pos + 1, data.size());
+  auto const pos = std::search(data.begin(),
+                               data.end(),
+                               row_terminator.bytes,
+                               row_terminator.bytes + row_terminator.size) -
+                   data.begin();
+  return std::min<size_t>(pos + row_terminator.size, data.size());
 }
 
 /**
@@ -394,6 +407,7 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> select_data_and_row_
   csv_reader_options const& reader_opts,
   std::vector<char>& header,
   parse_options const& parse_opts,
+  reader_profiler* profiler,
   rmm::cuda_stream_view stream)
 {
   auto range_offset      = reader_opts.get_byte_range_offset();
@@ -411,7 +425,12 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> select_data_and_row_
   // Transfer source data to GPU
   if (!source->is_empty()) {
     auto data_size = (range_size_padded != 0) ? range_size_padded : source->size();
-    auto buffer    = source->host_read(range_offset, data_size);
+    std::unique_ptr<datasource::buffer> buffer;
+    {
+      reader_profiler::stage_timer const read_timer{profiler, "read", stream};
+      buffer = source->host_read(range_offset, data_size);
+    }
+    if (profiler != nullptr) { profiler->counters().bytes_read += buffer->size(); }
 
     auto h_data = host_span<char const>(  //
       reinterpret_cast<const char*>(buffer->data()),
@@ -420,8 +439,13 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> select_data_and_row_
     std::vector<char> h_uncomp_data_owner;
 
     if (reader_opts.get_compression() != compression_type::NONE) {
+      reader_profiler::stage_timer const decompress_timer{profiler, "decompress", stream};
       h_uncomp_data_owner = get_uncompressed_data(h_data, reader_opts.get_compression());
-      h_data              = h_uncomp_data_owner;
+      if (profiler != nullptr) {
+        profiler->counters().compressed_bytes += h_data.size();
+        profiler->counters().uncompressed_bytes += h_uncomp_data_owner.size();
+      }
+      h_data = h_uncomp_data_owner;
     }
     // None of the parameters for row selection is used, we are parsing the entire file
     const bool load_whole_file = range_offset == 0 && range_size == 0 && skip_rows <= 0 &&
@@ -429,13 +453,14 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> select_data_and_row_
 
     // With byte range, find the start of the first data row
     size_t const data_start_offset =
-      (range_offset != 0) ? find_first_row_start(parse_opts.terminator, h_data) : 0;
+      (range_offset != 0) ? find_first_row_start(parse_opts.terminator_seq, h_data) : 0;
 
     // TODO: Allow parsing the header outside the mapped range
     CUDF_EXPECTS((range_offset == 0 || reader_opts.get_header() < 0),
                  "byte_range offset with header not supported");
 
     // Gather row offsets
+    reader_profiler::stage_timer const gather_timer{profiler, "gather_rows", stream};
     auto data_row_offsets =
       load_data_and_gather_row_offsets(reader_opts,
                                        parse_opts,
@@ -506,6 +531,7 @@ std::vector<data_type> infer_column_types(parse_options const& parse_opts,
                                           int32_t num_records,
                                           int32_t num_active_columns,
                                           data_type timestamp_type,
+                                          size_type num_sample_rows,
                                           rmm::cuda_stream_view stream)
 {
   std::vector<data_type> dtypes;
@@ -518,9 +544,12 @@ std::vector<data_type> infer_column_types(parse_options const& parse_opts,
                                               make_device_uvector_async(column_flags, stream),
                                               row_offsets,
                                               num_active_columns,
+                                              num_sample_rows,
                                               stream);
 
     stream.synchronize();
+    // The histograms only count the sampled rows
+    if (num_sample_rows > 0 && num_sample_rows < num_records) { num_records = num_sample_rows; }
 
     for (int col = 0; col < num_active_columns; col++) {
       unsigned long long int_count_total = column_stats[col].big_int_count +
@@ -630,8 +659,12 @@ table_with_metadata read_csv(cudf::io::datasource* source,
 {
   std::vector<char> header;
 
+  std::optional<reader_profiler> profiler;
+  if (reader_opts.is_enabled_profile()) { profiler.emplace(); }
+  auto const profiler_ptr = profiler.has_value() ? &profiler.value() : nullptr;
+
   auto const data_row_offsets =
-    select_data_and_row_offsets(source, reader_opts, header, parse_opts, stream);
+    select_data_and_row_offsets(source, reader_opts, header, parse_opts, profiler_ptr, stream);
 
   auto const& data        = data_row_offsets.first;
   auto const& row_offsets = data_row_offsets.second;
@@ -752,6 +785,7 @@ table_with_metadata read_csv(cudf::io::datasource* source,
 
   std::vector<data_type> column_types;
   if (has_to_infer_column_types) {
+    reader_profiler::stage_timer const infer_timer{profiler_ptr, "infer_types", stream};
     column_types = infer_column_types(  //
       parse_opts,
       column_flags,
@@ -760,6 +794,7 @@ table_with_metadata read_csv(cudf::io::datasource* source,
       num_records,
       num_active_columns,
       reader_opts.get_timestamp_type(),
+      reader_opts.get_inference_sample_rows(),
       stream);
   } else {
     column_types =
@@ -781,6 +816,8 @@ table_with_metadata read_csv(cudf::io::datasource* source,
   out_columns.reserve(column_types.size());
 
   if (num_records != 0) {
+    std::optional<reader_profiler::stage_timer> decode_timer;
+    decode_timer.emplace(profiler_ptr, "decode", stream);
     auto out_buffers = decode_data(  //
       parse_opts,
       column_flags,
@@ -793,6 +830,9 @@ table_with_metadata read_csv(cudf::io::datasource* source,
       num_active_columns,
       stream,
       mr);
+    decode_timer.reset();
+
+    reader_profiler::stage_timer const assemble_timer{profiler_ptr, "assemble", stream};
     for (size_t i = 0; i < column_types.size(); ++i) {
       metadata.column_names.emplace_back(out_buffers[i].name);
       if (column_types[i].id() == type_id::STRING && parse_opts.quotechar != '\0' &&
@@ -822,6 +862,7 @@ table_with_metadata read_csv(cudf::io::datasource* source,
       }
     }
   }
+  if (profiler.has_value()) { metadata.profile = profiler->finish(stream); }
   return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
 }
 
@@ -867,20 +908,45 @@ cudf::detail::trie create_na_trie(char quotechar,
   return cudf::detail::create_serialized_trie(na_values, stream);
 }
 
+/**
+ * @brief Returns the delimiter or line terminator `str` as a sequence
+ */
+char_sequence make_char_sequence(std::string const& str)
+{
+  CUDF_EXPECTS(not str.empty(), "Delimiters and line terminators cannot be empty");
+  CUDF_EXPECTS(str.size() <= char_sequence::max_size,
+               "Delimiters and line terminators are limited to 8 characters");
+  char_sequence seq;
+  std::copy(str.begin(), str.end(), seq.bytes);
+  seq.size = str.size();
+  return seq;
+}
+
 parse_options make_parse_options(csv_reader_options const& reader_opts,
                                  rmm::cuda_stream_view stream)
 {
   auto parse_opts = parse_options{};
 
+  std::string delimiter;
   if (reader_opts.is_enabled_delim_whitespace()) {
-    parse_opts.delimiter       = ' ';
+    delimiter                  = " ";
     parse_opts.multi_delimiter = true;
   } else {
-    parse_opts.delimiter       = reader_opts.get_delimiter();
+    delimiter                  = reader_opts.get_delimiter_sequence().empty()
+                                   ? std::string(1, reader_opts.get_delimiter())
+                                   : reader_opts.get_delimiter_sequence();
     parse_opts.multi_delimiter = false;
   }
+  auto const terminator = reader_opts.get_lineterminator_sequence().empty()
+                            ? std::string(1, reader_opts.get_lineterminator())
+                            : reader_opts.get_lineterminator_sequence();
 
-  parse_opts.terminator = reader_opts.get_lineterminator();
+  // Single-character code paths use the first character of multi-character sequences only to
+  // check for them
+  parse_opts.delimiter      = delimiter.front();
+  parse_opts.terminator     = terminator.front();
+  parse_opts.delimiter_seq  = make_char_sequence(delimiter);
+  parse_opts.terminator_seq = make_char_sequence(terminator);
 
   if (reader_opts.get_quotechar() != '\0' && reader_opts.get_quoting() != quote_style::NONE) {
     parse_opts.quotechar   = reader_opts.get_quotechar();
@@ -898,9 +964,9 @@ parse_options make_parse_options(csv_reader_options const& reader_opts,
   parse_opts.decimal        = reader_opts.get_decimal();
   parse_opts.thousands      = reader_opts.get_thousands();
 
-  CUDF_EXPECTS(parse_opts.decimal != parse_opts.delimiter,
+  CUDF_EXPECTS(delimiter.find(parse_opts.decimal) == std::string::npos,
                "Decimal point cannot be the same as the delimiter");
-  CUDF_EXPECTS(parse_opts.thousands != parse_opts.delimiter,
+  CUDF_EXPECTS(delimiter.find(parse_opts.thousands) == std::string::npos,
                "Thousands separator cannot be the same as the delimiter");
 
   // Handle user-defined true values, whereby field data is substituted with a
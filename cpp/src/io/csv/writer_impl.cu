@@ -24,6 +24,8 @@
 #include "csv_common.h"
 #include "csv_gpu.h"
 
+#include <io/utilities/chunk_writer.hpp>
+
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/null_mask.hpp>
@@ -31,21 +33,26 @@
 #include <cudf/io/detail/csv.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar.hpp>
-#include <cudf/strings/detail/combine.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/strings/detail/converters.hpp>
-#include <cudf/strings/detail/replace.hpp>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <thrust/copy.h>
 #include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/logical.h>
 #include <thrust/scan.h>
+#include <thrust/transform.h>
 
 #include <algorithm>
 #include <memory>
@@ -144,7 +151,7 @@ struct column_to_strings_fn {
   {
   }
 
-  // Note: `null` replacement with `na_rep` deferred to `concatenate()`
+  // Note: `null` replacement with `na_rep` deferred to `format_rows()`
   // instead of column-wise; might be faster
   //
   // Note: Cannot pass `stream` to detail::<fname> version of <fname> calls below, because they are
@@ -342,57 +349,80 @@ void write_chunked_begin(data_sink* out_sink,
   }
 }
 
-void write_chunked(data_sink* out_sink,
-                   strings_column_view const& str_column_view,
-                   table_metadata const* metadata,
-                   csv_writer_options const& options,
-                   rmm::cuda_stream_view stream,
-                   rmm::mr::device_memory_resource* mr)
+/**
+ * @brief Formats the rows of a table of string columns into a row-major character buffer.
+ *
+ * Each row holds its fields separated by the delimiter, with nulls replaced by `na_rep`, followed
+ * by the line terminator. The rows are sized in a first pass and written in a second one, with no
+ * intermediate strings column.
+ *
+ * @param str_table Table of string columns to format
+ * @param options Options holding the delimiter, null representation and line terminator
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The characters of all rows
+ */
+rmm::device_uvector<char> format_rows(table_view const& str_table,
+                                      csv_writer_options const& options,
+                                      rmm::cuda_stream_view stream)
 {
-  // algorithm outline:
-  //
-  //  for_each(strings_column.begin(), strings_column.end(),
-  //           [sink = out_sink](auto str_row) mutable {
-  //               auto host_buffer = str_row.host_buffer();
-  //               sink->host_write(host_buffer_.data(), host_buffer_.size());
-  //           });//or...sink->device_write(device_buffer,...);
-  //
-  // added line_terminator functionality
-  //
-
-  CUDF_EXPECTS(str_column_view.size() > 0, "Unexpected empty strings column.");
-
-  cudf::string_scalar newline{options.get_line_terminator()};
-  auto p_str_col_w_nl =
-    cudf::strings::detail::join_strings(str_column_view, newline, string_scalar("", false), stream);
-  strings_column_view strings_column{p_str_col_w_nl->view()};
-
-  auto total_num_bytes      = strings_column.chars_size();
-  char const* ptr_all_bytes = strings_column.chars_begin();
-
-  if (out_sink->is_device_write_preferred(total_num_bytes)) {
-    // Direct write from device memory
-    out_sink->device_write(ptr_all_bytes, total_num_bytes, stream);
-  } else {
-    // copy the bytes to host to write them out
-    thrust::host_vector<char> h_bytes(total_num_bytes);
-    CUDA_TRY(cudaMemcpyAsync(h_bytes.data(),
-                             ptr_all_bytes,
-                             total_num_bytes * sizeof(char),
-                             cudaMemcpyDeviceToHost,
-                             stream.value()));
-    stream.synchronize();
-
-    out_sink->host_write(h_bytes.data(), total_num_bytes);
-  }
-
-  // Needs newline at the end, to separate from next chunk
-  if (out_sink->is_device_write_preferred(newline.size())) {
-    out_sink->device_write(newline.data(), newline.size(), stream);
-  } else {
-    out_sink->host_write(options.get_line_terminator().data(),
-                         options.get_line_terminator().size());
-  }
+  auto const num_rows = str_table.num_rows();
+  auto const d_table  = table_device_view::create(str_table, stream);
+
+  auto const& na_rep     = options.get_na_rep();
+  auto const& terminator = options.get_line_terminator();
+  auto const delimiter   = options.get_inter_column_delimiter();
+  // The null representation, followed by the line terminator
+  auto const h_extras = na_rep + terminator;
+  auto const d_extras = cudf::detail::make_device_uvector_sync(
+    host_span<char const>{h_extras.data(), h_extras.size()}, stream);
+
+  rmm::device_uvector<size_t> row_offsets(num_rows + 1, stream);
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows + 1),
+    row_offsets.begin(),
+    [table     = *d_table,
+     num_rows,
+     na_size   = na_rep.size(),
+     term_size = terminator.size()] __device__(size_type row) -> size_t {
+      if (row == num_rows) { return 0; }
+      size_t size = table.num_columns() - 1 + term_size;
+      for (size_type col = 0; col < table.num_columns(); ++col) {
+        auto const& column = table.column(col);
+        size += column.is_null(row) ? na_size : column.element<string_view>(row).size_bytes();
+      }
+      return size;
+    });
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), row_offsets.begin(), row_offsets.end(), row_offsets.begin());
+
+  rmm::device_uvector<char> chars(row_offsets.back_element(stream), stream);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_rows,
+    [table     = *d_table,
+     offsets   = row_offsets.data(),
+     out       = chars.data(),
+     extras    = d_extras.data(),
+     na_size   = na_rep.size(),
+     term_size = terminator.size(),
+     delimiter] __device__(size_type row) {
+      auto ptr = out + offsets[row];
+      for (size_type col = 0; col < table.num_columns(); ++col) {
+        if (col > 0) { *ptr++ = delimiter; }
+        auto const& column = table.column(col);
+        if (column.is_null(row)) {
+          ptr = thrust::copy(thrust::seq, extras, extras + na_size, ptr);
+        } else {
+          auto const str = column.element<string_view>(row);
+          ptr = thrust::copy(thrust::seq, str.data(), str.data() + str.size_bytes(), ptr);
+        }
+      }
+      thrust::copy(thrust::seq, extras + na_size, extras + na_size + term_size, ptr);
+    });
+  return chars;
 }
 
 void write_csv(data_sink* out_sink,
@@ -440,6 +470,7 @@ void write_csv(data_sink* out_sink,
     // convert each chunk to CSV:
     //
     column_to_strings_fn converter{options, stream, rmm::mr::get_current_device_resource()};
+    chunk_writer writer{out_sink};
     for (auto&& sub_view : vector_views) {
       // Skip if the table has no rows
       if (sub_view.num_rows() == 0) continue;
@@ -459,23 +490,10 @@ void write_csv(data_sink* out_sink,
       auto str_table_ptr  = std::make_unique<cudf::table>(std::move(str_column_vec));
       auto str_table_view = str_table_ptr->view();
 
-      // concatenate columns in each row into one big string column
-      // (using null representation and delimiter):
-      //
-      std::string delimiter_str{options.get_inter_column_delimiter()};
-      auto str_concat_col = [&] {
-        if (str_table_view.num_columns() > 1)
-          return cudf::strings::detail::concatenate(str_table_view,
-                                                    delimiter_str,
-                                                    options.get_na_rep(),
-                                                    strings::separator_on_nulls::YES,
-                                                    stream);
-        cudf::string_scalar narep{options.get_na_rep()};
-        return cudf::strings::detail::replace_nulls(str_table_view.column(0), narep, stream);
-      }();
-
-      write_chunked(out_sink, str_concat_col->view(), metadata, options, stream, mr);
+      // format the rows into one buffer, while the previous chunk is being written
+      writer.write(format_rows(str_table_view, options, stream), stream);
     }
+    writer.wait();
   }
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -79,6 +79,13 @@ json_reader_options_builder json_reader_options::builder(source_info const& src)
   return json_reader_options_builder(src);
 }
 
+// Returns builder for json_writer_options
+json_writer_options_builder json_writer_options::builder(sink_info const& sink,
+                                                         table_view const& table)
+{
+  return json_writer_options_builder{sink, table};
+}
+
 // Returns builder for parquet_reader_options
 parquet_reader_options_builder parquet_reader_options::builder(source_info const& src)
 {
@@ -105,6 +112,14 @@ chunked_parquet_writer_options_builder chunked_parquet_writer_options::builder(
   return chunked_parquet_writer_options_builder(sink);
 }
 
+// Returns builder for partitioned_parquet_writer_options
+partitioned_parquet_writer_options_builder partitioned_parquet_writer_options::builder(
+  std::string base_path, std::vector<size_type> partition_cols)
+{
+  return partitioned_parquet_writer_options_builder(std::move(base_path),
+                                                    std::move(partition_cols));
+}
+
 namespace {
 
 std::vector<std::unique_ptr<cudf::io::datasource>> make_datasources(source_info const& info,
@@ -200,7 +215,71 @@ table_with_metadata read_json(json_reader_options options, rmm::mr::device_memor
   return detail::json::read_json(datasources, options, rmm::cuda_stream_default, mr);
 }
 
-table_with_metadata read_csv(csv_reader_options options, rmm::mr::device_memory_resource* mr)
+/**
+ * @copydoc cudf::io::chunked_json_reader::chunked_json_reader
+ */
+chunked_json_reader::chunked_json_reader(std::size_t chunk_read_size,
+                                         json_reader_options const& options,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  auto reader_options = options;
+  reader_options.set_compression(
+    infer_compression_type(options.get_compression(), options.get_source()));
+
+  auto datasources = make_datasources(options.get_source());
+  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
+  reader = std::make_unique<cudf::io::detail::json::chunked_reader>(
+    chunk_read_size, std::move(datasources[0]), reader_options, rmm::cuda_stream_default, mr);
+}
+
+/**
+ * @copydoc cudf::io::chunked_json_reader::~chunked_json_reader
+ */
+chunked_json_reader::~chunked_json_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_json_reader::has_next
+ */
+bool chunked_json_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_json_reader::read_chunk
+ */
+table_with_metadata chunked_json_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
+// Freeform API wraps the detail writer class API
+void write_json(json_writer_options const& options,
+                rmm::cuda_stream_view stream,
+                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  using namespace cudf::io::detail;
+
+  auto sinks = make_datasinks(options.get_sink());
+  CUDF_EXPECTS(sinks.size() == 1, "Multiple sinks not supported for JSON writing");
+
+  return json::write_json(  //
+    sinks[0].get(),
+    options.get_table(),
+    options.get_metadata(),
+    options,
+    stream,
+    mr);
+}
+
+table_with_metadata read_csv(csv_reader_options options,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
 
@@ -215,12 +294,52 @@ table_with_metadata read_csv(csv_reader_options options, rmm::mr::device_memory_
   return cudf::io::detail::csv::read_csv(  //
     std::move(datasources[0]),
     options,
-    rmm::cuda_stream_default,
+    stream,
     mr);
 }
 
+/**
+ * @copydoc cudf::io::chunked_csv_reader::chunked_csv_reader
+ */
+chunked_csv_reader::chunked_csv_reader(std::size_t chunk_read_size,
+                                       csv_reader_options const& options,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  auto datasources = make_datasources(options.get_source());
+  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
+  reader = std::make_unique<cudf::io::detail::csv::chunked_reader>(
+    chunk_read_size, std::move(datasources[0]), options, rmm::cuda_stream_default, mr);
+}
+
+/**
+ * @copydoc cudf::io::chunked_csv_reader::~chunked_csv_reader
+ */
+chunked_csv_reader::~chunked_csv_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_csv_reader::has_next
+ */
+bool chunked_csv_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_csv_reader::read_chunk
+ */
+table_with_metadata chunked_csv_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 // Freeform API wraps the detail writer class API
-void write_csv(csv_writer_options const& options, rmm::mr::device_memory_resource* mr)
+void write_csv(csv_writer_options const& options,
+               rmm::cuda_stream_view stream,
+               rmm::mr::device_memory_resource* mr)
 {
   using namespace cudf::io::detail;
 
@@ -232,7 +351,7 @@ void write_csv(csv_writer_options const& options, rmm::mr::device_memory_resourc
     options.get_table(),
     options.get_metadata(),
     options,
-    rmm::cuda_stream_default,
+    stream,
     mr);
 }
 
@@ -338,31 +457,73 @@ parsed_orc_statistics read_parsed_orc_statistics(source_info const& src_info)
 /**
  * @copydoc cudf::io::read_orc
  */
-table_with_metadata read_orc(orc_reader_options const& options, rmm::mr::device_memory_resource* mr)
+table_with_metadata read_orc(orc_reader_options const& options,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
 
   auto datasources = make_datasources(options.get_source());
-  auto reader      = std::make_unique<detail_orc::reader>(
-    std::move(datasources), options, rmm::cuda_stream_default, mr);
+  auto reader = std::make_unique<detail_orc::reader>(std::move(datasources), options, stream, mr);
+
+  return reader->read(options, stream);
+}
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::chunked_orc_reader
+ */
+chunked_orc_reader::chunked_orc_reader(std::size_t chunk_read_limit,
+                                       orc_reader_options const& options,
+                                       rmm::mr::device_memory_resource* mr)
+  : reader{std::make_unique<detail_orc::chunked_reader>(chunk_read_limit,
+                                                        make_datasources(options.get_source()),
+                                                        options,
+                                                        rmm::cuda_stream_default,
+                                                        mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::~chunked_orc_reader
+ */
+chunked_orc_reader::~chunked_orc_reader() = default;
 
-  return reader->read(options);
+/**
+ * @copydoc cudf::io::chunked_orc_reader::has_next
+ */
+bool chunked_orc_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::read_chunk
+ */
+table_with_metadata chunked_orc_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
 }
 
 /**
  * @copydoc cudf::io::write_orc
  */
-void write_orc(orc_writer_options const& options, rmm::mr::device_memory_resource* mr)
+void write_orc(orc_writer_options const& options,
+               rmm::cuda_stream_view stream,
+               rmm::mr::device_memory_resource* mr)
 {
   namespace io_detail = cudf::io::detail;
 
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(options.get_table(), stream);
 
   auto sinks = make_datasinks(options.get_sink());
   CUDF_EXPECTS(sinks.size() == 1, "Multiple sinks not supported for ORC writing");
 
   auto writer = std::make_unique<detail_orc::writer>(
-    std::move(sinks[0]), options, io_detail::SingleWriteMode::YES, rmm::cuda_stream_default, mr);
+    std::move(sinks[0]), options, io_detail::SingleWriteMode::YES, stream, mr);
 
   writer->write(options.get_table());
 }
@@ -387,7 +548,7 @@ orc_chunked_writer::orc_chunked_writer(chunked_orc_writer_options const& options
  */
 orc_chunked_writer& orc_chunked_writer::write(table_view const& table)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(table, stream);
 
   writer->write(table);
 
@@ -408,6 +569,7 @@ using namespace cudf::io::detail::parquet;
 namespace detail_parquet = cudf::io::detail::parquet;
 
 table_with_metadata read_parquet(parquet_reader_options const& options,
+                                 rmm::cuda_stream_view stream,
                                  rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
@@ -415,7 +577,74 @@ table_with_metadata read_parquet(parquet_reader_options const& options,
   auto datasources = make_datasources(options.get_source());
   auto reader      = std::make_unique<detail_parquet::reader>(std::move(datasources), options, mr);
 
-  return reader->read(options);
+  return reader->read(options, stream);
+}
+
+/**
+ * @copydoc cudf::io::read_parquet_metadata
+ */
+parquet_dataset_metadata read_parquet_metadata(source_info const& src_info)
+{
+  CUDF_FUNC_RANGE();
+
+  auto datasources = make_datasources(src_info);
+  return parquet_dataset_metadata{
+    detail_parquet::read_metadata(datasources, src_info.filepaths())};
+}
+
+/**
+ * @copydoc cudf::io::set_parquet_metadata_cache_capacity
+ */
+void set_parquet_metadata_cache_capacity(std::size_t capacity)
+{
+  detail_parquet::set_metadata_cache_capacity(capacity);
+}
+
+/**
+ * @copydoc cudf::io::get_parquet_metadata_cache_capacity
+ */
+std::size_t get_parquet_metadata_cache_capacity()
+{
+  return detail_parquet::get_metadata_cache_capacity();
+}
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::chunked_parquet_reader
+ */
+chunked_parquet_reader::chunked_parquet_reader(std::size_t chunk_read_limit,
+                                               parquet_reader_options const& options,
+                                               rmm::mr::device_memory_resource* mr)
+  : reader{std::make_unique<detail_parquet::chunked_reader>(chunk_read_limit,
+                                                            make_datasources(options.get_source()),
+                                                            options,
+                                                            rmm::cuda_stream_default,
+                                                            mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::~chunked_parquet_reader
+ */
+chunked_parquet_reader::~chunked_parquet_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::has_next
+ */
+bool chunked_parquet_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::read_chunk
+ */
+table_with_metadata chunked_parquet_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
 }
 
 /**
@@ -446,15 +675,16 @@ table_input_metadata::table_input_metadata(table_view const& table)
  * @copydoc cudf::io::write_parquet
  */
 std::unique_ptr<std::vector<uint8_t>> write_parquet(parquet_writer_options const& options,
+                                                    rmm::cuda_stream_view stream,
                                                     rmm::mr::device_memory_resource* mr)
 {
   namespace io_detail = cudf::io::detail;
 
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(options.get_table(), stream);
 
   auto sinks  = make_datasinks(options.get_sink());
   auto writer = std::make_unique<detail_parquet::writer>(
-    std::move(sinks), options, io_detail::SingleWriteMode::YES, rmm::cuda_stream_default, mr);
+    std::move(sinks), options, io_detail::SingleWriteMode::YES, stream, mr);
 
   writer->write(options.get_table(), options.get_partitions());
 
@@ -481,7 +711,7 @@ parquet_chunked_writer::parquet_chunked_writer(chunked_parquet_writer_options co
 parquet_chunked_writer& parquet_chunked_writer::write(table_view const& table,
                                                       std::vector<partition_info> const& partitions)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(table, stream);
 
   writer->write(table, partitions);
 
@@ -498,5 +728,59 @@ std::unique_ptr<std::vector<uint8_t>> parquet_chunked_writer::close(
   return writer->close(column_chunks_file_path);
 }
 
+/**
+ * @copydoc cudf::io::parquet_chunked_writer::encoding_report
+ */
+std::vector<std::vector<column_encoding>> const& parquet_chunked_writer::encoding_report() const
+{
+  return writer->encoding_report();
+}
+
+/**
+ * @copydoc cudf::io::partitioned_parquet_writer::partitioned_parquet_writer
+ */
+partitioned_parquet_writer::partitioned_parquet_writer(
+  partitioned_parquet_writer_options const& options, rmm::mr::device_memory_resource* mr)
+  : writer{std::make_unique<detail_parquet::partitioned_writer>(
+      options, rmm::cuda_stream_default, mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::partitioned_parquet_writer::write
+ */
+partitioned_parquet_writer& partitioned_parquet_writer::write(table_view const& table)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(table, stream);
+
+  writer->write(table);
+
+  return *this;
+}
+
+/**
+ * @copydoc cudf::io::partitioned_parquet_writer::close
+ */
+std::vector<std::string> partitioned_parquet_writer::close()
+{
+  CUDF_FUNC_RANGE();
+  return writer->close();
+}
+
+/**
+ * @copydoc cudf::io::write_partitioned_parquet
+ */
+std::vector<std::string> write_partitioned_parquet(
+  partitioned_parquet_writer_options const& options,
+  table_view const& table,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  detail_parquet::partitioned_writer writer(options, rmm::cuda_stream_default, mr);
+  writer.write(table);
+  return writer.close();
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file chunked_reader.cpp
+ * @brief cuDF-IO JSON Lines reader of files in fixed-size byte ranges
+ */
+
+#include <io/utilities/byte_range_reader.hpp>
+
+#include <cudf/io/datasource.hpp>
+#include <cudf/io/detail/json.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <variant>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace json {
+
+/**
+ * @brief Implementation of the chunked reader
+ *
+ * The data left to parse is kept on the host. Each chunk parses the complete records of the data,
+ * those ending with a newline, and keeps the trailing partial record for the next one.
+ */
+class chunked_reader::impl {
+ public:
+  impl(std::size_t chunk_read_size,
+       std::unique_ptr<cudf::io::datasource>&& source,
+       json_reader_options const& options,
+       rmm::cuda_stream_view stream,
+       rmm::mr::device_memory_resource* mr)
+    : _reader(std::move(source), chunk_read_size), _options(options), _stream(stream), _mr(mr)
+  {
+    CUDF_EXPECTS(options.is_enabled_lines(), "Only JSON Lines format is currently supported.");
+    CUDF_EXPECTS(options.get_compression() == compression_type::NONE,
+                 "Chunked reading of compressed data is unsupported");
+    CUDF_EXPECTS(options.get_byte_range_offset() == 0 && options.get_byte_range_size() == 0,
+                 "Chunked reading does not support byte ranges");
+    CUDF_EXPECTS(not options.is_enabled_nested(), "Chunked reading does not support nested JSON");
+  }
+
+  [[nodiscard]] bool has_next() const
+  {
+    return _first_chunk || _reader.has_ranges() ||
+           has_records(_reader.data().cbegin(), _reader.data().cend());
+  }
+
+  table_with_metadata read_chunk()
+  {
+    CUDF_EXPECTS(has_next(), "No data left to read");
+    auto& data = _reader.data();
+
+    // Read ranges until the data holds a complete record, or the source is exhausted
+    auto const records_end = _reader.find_last_line_end(0, "\n");
+
+    // Blank data at the end of the source holds no records
+    auto const records = data.cbegin();
+    auto const first_record =
+      std::find_if_not(records, records + records_end, [](char c) { return std::isspace(c); });
+    if (first_record == records + records_end) {
+      data.erase(records, records + records_end);
+      _first_chunk = false;
+      return table_with_metadata{std::make_unique<table>(), {}};
+    }
+    auto const are_objects = *first_record == '{';
+
+    std::vector<std::unique_ptr<datasource>> sources;
+    sources.emplace_back(datasource::create(host_buffer{data.data(), records_end}));
+    auto result = read_json(sources, _options, _stream, _mr);
+    data.erase(data.begin(), data.begin() + records_end);
+
+    carry_over_schema(result, are_objects);
+    _first_chunk = false;
+    return result;
+  }
+
+ private:
+  /**
+   * @brief Whether the data in the given range holds anything else than whitespace
+   */
+  [[nodiscard]] static bool has_records(std::vector<char>::const_iterator begin,
+                                        std::vector<char>::const_iterator end)
+  {
+    return std::any_of(begin, end, [](char c) { return not std::isspace(c); });
+  }
+
+  /**
+   * @brief Sets the schema of the first records as the schema of all later chunks
+   *
+   * The columns of object records are selected by name, so that later records with other fields
+   * still produce the same columns; the columns of array records are the first fields. The types
+   * are set in the order of the columns.
+   */
+  void carry_over_schema(table_with_metadata const& result, bool are_objects)
+  {
+    if (result.tbl->num_rows() == 0) { return; }
+    if (are_objects && _options.get_use_cols_names().empty()) {
+      _options.set_use_cols_names(result.metadata.column_names);
+    }
+    auto const has_types =
+      std::visit([](auto const& dtypes) { return not dtypes.empty(); }, _options.get_dtypes());
+    if (has_types) { return; }
+    std::vector<data_type> types;
+    for (size_type col = 0; col < result.tbl->num_columns(); ++col) {
+      types.push_back(result.tbl->get_column(col).type());
+    }
+    _options.set_dtypes(std::move(types));
+  }
+
+  // Data left to parse
+  cudf::io::detail::byte_range_reader _reader;
+  json_reader_options _options;
+  rmm::cuda_stream_view _stream;
+  rmm::mr::device_memory_resource* _mr;
+
+  bool _first_chunk = true;
+};
+
+chunked_reader::chunked_reader(std::size_t chunk_read_size,
+                               std::unique_ptr<cudf::io::datasource>&& source,
+                               json_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+  : _impl(std::make_unique<impl>(chunk_read_size, std::move(source), options, stream, mr))
+{
+}
+
+chunked_reader::~chunked_reader() = default;
+
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+table_with_metadata chunked_reader::read_chunk() { return _impl->read_chunk(); }
+
+}  // namespace json
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -337,7 +337,7 @@ struct field_descriptor {
  * @param[in] field_idx Index of the current field in the input row
  * @param[in] col_map Pointer to the (column name hash -> column index) map in device memory.
  * nullptr is passed when the input file does not consist of objects.
- * @return Descriptor of the parsed field
+ * @return Descriptor of the parsed field; its column is -1 if the key is not in `col_map`
  */
 __device__ field_descriptor next_field_descriptor(const char* begin,
                                                   const char* end,
@@ -354,8 +354,8 @@ __device__ field_descriptor next_field_descriptor(const char* begin,
           auto const key_hash  = MurmurHash3_32<cudf::string_view>{}(
             cudf::string_view(key_range.first, key_range.second - key_range.first));
           auto const hash_col = col_map.find(key_hash);
-          // Fall back to field index if not found (parsing error)
-          auto const column = (hash_col != col_map.end()) ? (*hash_col).second : field_idx;
+          // Fields that are not read as columns are skipped
+          auto const column = (hash_col != col_map.end()) ? (*hash_col).second : -1;
 
           // Skip the colon between the key and the value
           auto const value_begin = thrust::find(thrust::seq, key_range.second, end, ':') + 1;
@@ -421,14 +421,18 @@ __global__ void convert_data_to_columns_kernel(parse_options_view opts,
   auto const row_data_range = get_row_data_range(data, row_offsets, rec_id);
 
   auto current = row_data_range.first;
+  // Stop once all columns are read, as the rest of the row holds fields that are skipped
+  size_type num_fields_read = 0;
   for (size_type input_field_index = 0;
-       input_field_index < column_types.size() && current < row_data_range.second;
+       num_fields_read < column_types.size() && current < row_data_range.second;
        input_field_index++) {
     auto const desc =
       next_field_descriptor(current, row_data_range.second, opts, input_field_index, col_map);
     auto const value_len = static_cast<size_t>(std::max(desc.value_end - desc.value_begin, 0L));
 
     current = desc.value_end + 1;
+    if (desc.column < 0) { continue; }
+    ++num_fields_read;
 
     using string_index_pair = thrust::pair<const char*, size_type>;
 
@@ -494,8 +498,9 @@ __global__ void detect_data_types_kernel(
   auto const row_data_range   = get_row_data_range(data, row_offsets, rec_id);
 
   size_type input_field_index = 0;
+  size_type num_fields_read   = 0;
   for (auto current = row_data_range.first;
-       input_field_index < num_columns && current < row_data_range.second;
+       num_fields_read < num_columns && current < row_data_range.second;
        input_field_index++) {
     auto const desc =
       next_field_descriptor(current, row_data_range.second, opts, input_field_index, col_map);
@@ -503,6 +508,9 @@ __global__ void detect_data_types_kernel(
 
     // Advance to the next field; +1 to skip the delimiter
     current = desc.value_end + 1;
+    // Values of the fields that are not read are not inspected
+    if (desc.column < 0) { continue; }
+    ++num_fields_read;
 
     // Checking if the field is empty/valid
     if (serialized_trie_contains(opts.trie_na, {desc.value_begin, value_len})) {
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file nested_json.hpp
+ * @brief cuDF-IO reader of JSON Lines records holding nested objects and arrays
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cstdint>
+#include <utility>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace json {
+
+/**
+ * @brief Tokens of the JSON input, each located by the offset of its first character
+ */
+enum class token_t : int8_t {
+  STRUCT_BEGIN,  ///< `{`
+  STRUCT_END,    ///< `}`
+  LIST_BEGIN,    ///< `[`
+  LIST_END,      ///< `]`
+  STRING_BEGIN,  ///< Opening quote of a string value or field name
+  STRING_END,    ///< Closing quote of a string value or field name
+  VALUE_BEGIN,   ///< First character of a number, `true`, `false` or `null`
+  VALUE_END,     ///< One past the last character of a number, `true`, `false` or `null`
+  FIELD_SEP      ///< `:` between a field name and its value
+};
+
+/**
+ * @brief Splits JSON input into tokens
+ *
+ * Whether each character is within a string is found with a prefix scan of the transitions of
+ * the string/escape state machine, so that the input is tokenized in parallel regardless of the
+ * nesting of its values.
+ *
+ * @param input JSON input in device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The token kinds and the offsets of the tokens in the input
+ */
+std::pair<rmm::device_uvector<token_t>, rmm::device_uvector<size_type>> get_token_stream(
+  device_span<char const> input, rmm::cuda_stream_view stream);
+
+/**
+ * @brief Reads JSON Lines records into a table of STRUCT, LIST and STRING columns
+ *
+ * Each record must be an object; its fields are the columns of the table. Objects become
+ * STRUCT columns, arrays LIST columns, and other values STRING columns holding their text,
+ * without the quotes of strings. Missing fields and `null` values are null.
+ *
+ * @param input JSON input in device memory
+ * @param h_input The same JSON input in host memory, to read the field names from
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return Table and its metadata
+ */
+table_with_metadata read_nested_json(
+  device_span<char const> input,
+  host_span<char const> h_input,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+}  // namespace json
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,805 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nested_json.hpp"
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace json {
+
+namespace {
+
+/**
+ * @brief States of the string state machine
+ */
+enum string_state : uint8_t { OUTSIDE = 0, INSIDE = 1, ESCAPED = 2 };
+
+/**
+ * @brief Returns the transitions of the string state machine on a character
+ *
+ * The next state of each state is packed in two bits, so that runs of transitions can be composed
+ * by a scan.
+ */
+__device__ uint8_t string_transitions(char c)
+{
+  uint8_t const from_outside = (c == '"') ? INSIDE : OUTSIDE;
+  uint8_t const from_inside  = (c == '"') ? OUTSIDE : ((c == '\\') ? ESCAPED : INSIDE);
+  return from_outside | (from_inside << 2) | (INSIDE << 4);
+}
+
+/**
+ * @brief Composes the packed transitions of two consecutive runs of characters
+ */
+struct compose_transitions {
+  __device__ uint8_t operator()(uint8_t first, uint8_t second) const
+  {
+    uint8_t result = 0;
+    for (int state = OUTSIDE; state <= ESCAPED; ++state) {
+      auto const mid = (first >> (2 * state)) & 3;
+      result |= ((second >> (2 * mid)) & 3) << (2 * state);
+    }
+    return result;
+  }
+};
+
+/**
+ * @brief Classes of characters, given the string state before them
+ */
+enum char_class : uint8_t { IN_STRING, WHITESPACE, STRUCTURAL, LITERAL };
+
+/**
+ * @brief Finds the tokens starting or ending at each character of the input
+ */
+struct token_finder {
+  device_span<char const> input;
+  // Transitions of the string state machine over each prefix of the input
+  uint8_t const* prefix_transitions;
+
+  __device__ uint8_t state_before(size_type i) const
+  {
+    return (i == 0) ? OUTSIDE : (prefix_transitions[i - 1] & 3);
+  }
+
+  __device__ char_class class_of(size_type i) const
+  {
+    auto const c = input[i];
+    if (state_before(i) != OUTSIDE || c == '"') { return IN_STRING; }
+    switch (c) {
+      case ' ':
+      case '\t':
+      case '\n':
+      case '\r': return WHITESPACE;
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ',':
+      case ':': return STRUCTURAL;
+      default: return LITERAL;
+    }
+  }
+
+  /**
+   * @brief Writes the tokens of a character to `kinds` and `offsets`, if not null
+   *
+   * @return The number of tokens of the character, at most two
+   */
+  __device__ size_type operator()(size_type i, token_t* kinds, size_type* offsets) const
+  {
+    size_type count = 0;
+    auto emit       = [&](token_t kind, size_type offset) {
+      if (kinds != nullptr) {
+        kinds[count]   = kind;
+        offsets[count] = offset;
+      }
+      ++count;
+    };
+
+    auto const c = input[i];
+    if (c == '"') {
+      auto const state = state_before(i);
+      if (state == OUTSIDE) {
+        emit(token_t::STRING_BEGIN, i);
+      } else if (state == INSIDE) {
+        emit(token_t::STRING_END, i);
+      }
+      return count;
+    }
+    switch (class_of(i)) {
+      case STRUCTURAL:
+        if (c == '{') { emit(token_t::STRUCT_BEGIN, i); }
+        if (c == '}') { emit(token_t::STRUCT_END, i); }
+        if (c == '[') { emit(token_t::LIST_BEGIN, i); }
+        if (c == ']') { emit(token_t::LIST_END, i); }
+        if (c == ':') { emit(token_t::FIELD_SEP, i); }
+        break;
+      case LITERAL:
+        if (i == 0 || class_of(i - 1) != LITERAL) { emit(token_t::VALUE_BEGIN, i); }
+        if (i + 1 == static_cast<size_type>(input.size()) || class_of(i + 1) != LITERAL) {
+          emit(token_t::VALUE_END, i + 1);
+        }
+        break;
+      default: break;
+    }
+    return count;
+  }
+};
+
+/**
+ * @brief Categories of the nodes of the tree of values
+ */
+enum node_category : int8_t {
+  NC_STRUCT,  ///< An object
+  NC_LIST,    ///< An array
+  NC_FIELD,   ///< A field name, parent of the field's value
+  NC_STRING,  ///< A string value
+  NC_VALUE,   ///< A number, `true` or `false`
+  NC_NULL     ///< `null`
+};
+
+/**
+ * @brief Categories of columns; all non-nested values are read into STRING columns
+ */
+enum column_category : int8_t { CC_STRUCT, CC_LIST, CC_LEAF };
+
+__device__ inline column_category to_column_category(node_category category)
+{
+  return (category == NC_STRUCT) ? CC_STRUCT : (category == NC_LIST) ? CC_LIST : CC_LEAF;
+}
+
+/**
+ * @brief Nodes of the tree of values, in input order
+ */
+struct tree {
+  rmm::device_uvector<node_category> categories;
+  rmm::device_uvector<size_type> depths;  // Number of enclosing objects and arrays
+  rmm::device_uvector<size_type> parents;
+  // Range of the characters of strings, values and field names, without quotes
+  rmm::device_uvector<size_type> begins;
+  rmm::device_uvector<size_type> ends;
+};
+
+/**
+ * @brief Builds the tree of values from the tokens
+ *
+ * The parent of a node is its enclosing object or array: the last one opened before it, one level
+ * up. The value of a field is a child of the field name, which is a child of the object.
+ */
+tree build_tree(device_span<token_t const> kinds,
+                device_span<size_type const> offsets,
+                device_span<char const> input,
+                rmm::cuda_stream_view stream)
+{
+  auto const num_tokens = static_cast<size_type>(kinds.size());
+
+  // Nesting level of each token
+  rmm::device_uvector<size_type> token_depths(num_tokens, stream);
+  auto const depth_deltas = thrust::make_transform_iterator(
+    kinds.begin(), [] __device__(token_t kind) -> size_type {
+      if (kind == token_t::STRUCT_BEGIN || kind == token_t::LIST_BEGIN) { return 1; }
+      if (kind == token_t::STRUCT_END || kind == token_t::LIST_END) { return -1; }
+      return 0;
+    });
+  thrust::exclusive_scan(rmm::exec_policy(stream),
+                         depth_deltas,
+                         depth_deltas + num_tokens,
+                         token_depths.begin());
+
+  // Tokens that start a value or a field name
+  rmm::device_uvector<size_type> node_tokens(num_tokens, stream);
+  auto const node_tokens_end = thrust::copy_if(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_tokens),
+    node_tokens.begin(),
+    [kinds] __device__(size_type t) {
+      auto const kind = kinds[t];
+      return kind == token_t::STRUCT_BEGIN || kind == token_t::LIST_BEGIN ||
+             kind == token_t::STRING_BEGIN || kind == token_t::VALUE_BEGIN;
+    });
+  auto const num_nodes = static_cast<size_type>(node_tokens_end - node_tokens.begin());
+  node_tokens.resize(num_nodes, stream);
+
+  tree nodes{rmm::device_uvector<node_category>(num_nodes, stream),
+             rmm::device_uvector<size_type>(num_nodes, stream),
+             rmm::device_uvector<size_type>(num_nodes, stream),
+             rmm::device_uvector<size_type>(num_nodes, stream),
+             rmm::device_uvector<size_type>(num_nodes, stream)};
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_nodes,
+    [kinds,
+     offsets,
+     input,
+     num_tokens,
+     node_tokens  = node_tokens.data(),
+     token_depths = token_depths.data(),
+     categories   = nodes.categories.data(),
+     depths       = nodes.depths.data(),
+     begins       = nodes.begins.data(),
+     ends         = nodes.ends.data()] __device__(size_type n) {
+      auto const t   = node_tokens[n];
+      auto const end = (t + 1 < num_tokens) ? offsets[t + 1] : static_cast<size_type>(input.size());
+      depths[n]      = token_depths[t];
+      switch (kinds[t]) {
+        case token_t::STRUCT_BEGIN:
+        case token_t::LIST_BEGIN:
+          categories[n] = (kinds[t] == token_t::STRUCT_BEGIN) ? NC_STRUCT : NC_LIST;
+          begins[n]     = offsets[t];
+          ends[n]       = offsets[t] + 1;
+          break;
+        case token_t::STRING_BEGIN: {
+          auto const is_field = t + 2 < num_tokens && kinds[t + 2] == token_t::FIELD_SEP;
+          categories[n]       = is_field ? NC_FIELD : NC_STRING;
+          begins[n]           = offsets[t] + 1;
+          ends[n]             = end;
+          break;
+        }
+        default: {
+          auto const begin  = offsets[t];
+          auto const* value = input.data() + begin;
+          auto const is_null =
+            end - begin == 4 && value[0] == 'n' && value[1] == 'u' && value[2] == 'l' &&
+            value[3] == 'l';
+          categories[n] = is_null ? NC_NULL : NC_VALUE;
+          begins[n]     = begin;
+          ends[n]       = end;
+        }
+      }
+    });
+
+  // Objects and arrays, sorted by level and then by input order
+  rmm::device_uvector<size_type> containers(num_nodes, stream);
+  auto const containers_end =
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_nodes),
+                    containers.begin(),
+                    [categories = nodes.categories.data()] __device__(size_type n) {
+                      return categories[n] == NC_STRUCT || categories[n] == NC_LIST;
+                    });
+  auto const num_containers = static_cast<size_type>(containers_end - containers.begin());
+  rmm::device_uvector<size_type> container_depths(num_containers, stream);
+  thrust::gather(rmm::exec_policy(stream),
+                 containers.begin(),
+                 containers_end,
+                 nodes.depths.begin(),
+                 container_depths.begin());
+  thrust::stable_sort_by_key(rmm::exec_policy(stream),
+                             container_depths.begin(),
+                             container_depths.end(),
+                             containers.begin());
+
+  auto const container_keys = thrust::make_zip_iterator(
+    thrust::make_tuple(container_depths.begin(), containers.begin()));
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_nodes),
+    nodes.parents.begin(),
+    [container_keys,
+     num_containers,
+     containers = containers.data(),
+     categories = nodes.categories.data(),
+     depths     = nodes.depths.data()] __device__(size_type n) -> size_type {
+      if (depths[n] == 0) { return -1; }
+      // The last container opened before the node, one level up, is still open at the node
+      auto const it        = thrust::upper_bound(thrust::seq,
+                                          container_keys,
+                                          container_keys + num_containers,
+                                          thrust::make_tuple(depths[n] - 1, n));
+      auto const container = containers[(it - container_keys) - 1];
+      if (categories[container] == NC_STRUCT && categories[n] != NC_FIELD) {
+        // The value follows its field name
+        return n - 1;
+      }
+      return container;
+    });
+  return nodes;
+}
+
+/**
+ * @brief Description of an output column
+ */
+struct column_info {
+  size_type parent;  // Parent column, -1 for the records
+  std::string name;  // Field name, empty for list elements and records
+  column_category category;
+  size_type first_node;  // First node of the column, in input order
+  size_type num_rows = 0;
+};
+
+/**
+ * @brief Columns of the tree of values, and the nodes of each column
+ */
+struct column_tree {
+  std::vector<column_info> columns;
+  std::vector<size_type> node_offsets;         // Offsets of the nodes of each column
+  rmm::device_uvector<size_type> sorted_nodes;  // Nodes of the columns, grouped by column
+  rmm::device_uvector<size_type> rows;          // Row of each node in its column
+};
+
+/**
+ * @brief Assigns the nodes of the tree to columns, identified by their path from the records
+ *
+ * Columns are assigned level by level, so that the column of a node is identified by the column
+ * of its parent, its field name, and its category.
+ */
+column_tree build_columns(tree const& nodes,
+                          device_span<char const> input,
+                          host_span<char const> h_input,
+                          rmm::cuda_stream_view stream)
+{
+  auto const num_nodes = static_cast<size_type>(nodes.categories.size());
+  rmm::device_uvector<size_type> node_columns(num_nodes, stream);
+  thrust::fill(rmm::exec_policy(stream), node_columns.begin(), node_columns.end(), -1);
+
+  auto const max_depth =
+    (num_nodes == 0) ? 0
+                     : thrust::reduce(rmm::exec_policy(stream),
+                                      nodes.depths.begin(),
+                                      nodes.depths.end(),
+                                      0,
+                                      thrust::maximum<size_type>{});
+
+  std::vector<column_info> columns;
+  rmm::device_uvector<size_type> level_nodes(num_nodes, stream);
+  for (size_type depth = 0; depth <= max_depth; ++depth) {
+    // Values at this level; null fields are left out, as missing
+    auto const level_end = thrust::copy_if(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_nodes),
+      level_nodes.begin(),
+      [depth,
+       categories = nodes.categories.data(),
+       depths     = nodes.depths.data(),
+       parents    = nodes.parents.data()] __device__(size_type n) {
+        if (depths[n] != depth || categories[n] == NC_FIELD) { return false; }
+        return categories[n] != NC_NULL ||
+               (parents[n] >= 0 && categories[parents[n]] == NC_LIST);
+      });
+    auto const num_level_nodes = static_cast<size_type>(level_end - level_nodes.begin());
+    if (num_level_nodes == 0) { continue; }
+
+    // Identifying key of the column of each node
+    auto const parent_column = [categories = nodes.categories.data(),
+                                parents    = nodes.parents.data(),
+                                node_columns =
+                                  node_columns.data()] __device__(size_type n) -> size_type {
+      auto const parent = parents[n];
+      if (parent < 0) { return -1; }
+      return node_columns[(categories[parent] == NC_FIELD) ? parents[parent] : parent];
+    };
+    auto const key_less = [parent_column,
+                           input,
+                           categories = nodes.categories.data(),
+                           parents    = nodes.parents.data(),
+                           begins     = nodes.begins.data(),
+                           ends       = nodes.ends.data()] __device__(size_type lhs,
+                                                                      size_type rhs) {
+      auto const lhs_column = parent_column(lhs);
+      auto const rhs_column = parent_column(rhs);
+      if (lhs_column != rhs_column) { return lhs_column < rhs_column; }
+      auto const lhs_parent = parents[lhs];
+      auto const rhs_parent = parents[rhs];
+      if (lhs_parent >= 0 && categories[lhs_parent] == NC_FIELD) {
+        auto const lhs_name = input.data() + begins[lhs_parent];
+        auto const rhs_name = input.data() + begins[rhs_parent];
+        auto const lhs_size = ends[lhs_parent] - begins[lhs_parent];
+        auto const rhs_size = ends[rhs_parent] - begins[rhs_parent];
+        for (size_type i = 0; i < min(lhs_size, rhs_size); ++i) {
+          if (lhs_name[i] != rhs_name[i]) { return lhs_name[i] < rhs_name[i]; }
+        }
+        if (lhs_size != rhs_size) { return lhs_size < rhs_size; }
+      }
+      return to_column_category(categories[lhs]) < to_column_category(categories[rhs]);
+    };
+    thrust::stable_sort(rmm::exec_policy(stream), level_nodes.begin(), level_end, key_less);
+
+    // Number the distinct keys, in sorted order
+    rmm::device_uvector<size_type> level_columns(num_level_nodes, stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_level_nodes),
+                      level_columns.begin(),
+                      [key_less, level_nodes = level_nodes.data()] __device__(size_type i) {
+                        return i == 0 || key_less(level_nodes[i - 1], level_nodes[i]) ? 1 : 0;
+                      });
+    thrust::inclusive_scan(
+      rmm::exec_policy(stream), level_columns.begin(), level_columns.end(), level_columns.begin());
+    auto const first_column = static_cast<size_type>(columns.size());
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       num_level_nodes,
+                       [first_column,
+                        level_nodes   = level_nodes.data(),
+                        level_columns = level_columns.data(),
+                        node_columns  = node_columns.data()] __device__(size_type i) {
+                         node_columns[level_nodes[i]] = first_column + level_columns[i] - 1;
+                       });
+
+    // Describe the new columns from their first node; stable sorting keeps it first of its key
+    rmm::device_uvector<size_type> first_nodes(num_level_nodes, stream);
+    auto const first_nodes_end = thrust::copy_if(
+      rmm::exec_policy(stream),
+      level_nodes.begin(),
+      level_end,
+      thrust::make_counting_iterator<size_type>(0),
+      first_nodes.begin(),
+      [level_columns = level_columns.data()] __device__(size_type i) {
+        return i == 0 || level_columns[i] != level_columns[i - 1];
+      });
+    first_nodes.resize(first_nodes_end - first_nodes.begin(), stream);
+    rmm::device_uvector<size_type> descriptions(first_nodes.size() * 4, stream);
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       first_nodes.size(),
+                       [parent_column,
+                        num_columns  = static_cast<size_type>(first_nodes.size()),
+                        first_nodes  = first_nodes.data(),
+                        descriptions = descriptions.data(),
+                        categories   = nodes.categories.data(),
+                        parents      = nodes.parents.data(),
+                        begins       = nodes.begins.data(),
+                        ends         = nodes.ends.data()] __device__(size_type i) {
+                         auto const n      = first_nodes[i];
+                         auto const parent = parents[n];
+                         auto const named  = parent >= 0 && categories[parent] == NC_FIELD;
+                         descriptions[i]                   = parent_column(n);
+                         descriptions[num_columns + i]     = to_column_category(categories[n]);
+                         descriptions[2 * num_columns + i] = named ? begins[parent] : 0;
+                         descriptions[3 * num_columns + i] = named ? ends[parent] : 0;
+                       });
+    auto const h_first_nodes = cudf::detail::make_std_vector_async(first_nodes, stream);
+    auto const h_descriptions = cudf::detail::make_std_vector_sync(descriptions, stream);
+    auto const num_new_columns = h_first_nodes.size();
+    for (size_t i = 0; i < num_new_columns; ++i) {
+      auto const name_begin = h_descriptions[2 * num_new_columns + i];
+      auto const name_end   = h_descriptions[3 * num_new_columns + i];
+      columns.push_back(
+        {h_descriptions[i],
+         std::string(h_input.data() + name_begin, h_input.data() + name_end),
+         static_cast<column_category>(h_descriptions[num_new_columns + i]),
+         h_first_nodes[i]});
+    }
+  }
+
+  // Fields holding values of different categories cannot be read into a single column
+  std::map<std::pair<size_type, std::string>, column_category> categories;
+  for (auto const& column : columns) {
+    CUDF_EXPECTS(categories.insert({{column.parent, column.name}, column.category}).second,
+                 "Mixed nested and non-nested values in a JSON field");
+  }
+
+  // Group the nodes by column, in input order within each column
+  rmm::device_uvector<size_type> sorted_nodes(num_nodes, stream);
+  auto const sorted_end = thrust::copy_if(rmm::exec_policy(stream),
+                                          thrust::make_counting_iterator<size_type>(0),
+                                          thrust::make_counting_iterator<size_type>(num_nodes),
+                                          node_columns.begin(),
+                                          sorted_nodes.begin(),
+                                          [] __device__(size_type column) { return column >= 0; });
+  sorted_nodes.resize(sorted_end - sorted_nodes.begin(), stream);
+  rmm::device_uvector<size_type> sorted_columns(sorted_nodes.size(), stream);
+  thrust::gather(rmm::exec_policy(stream),
+                 sorted_nodes.begin(),
+                 sorted_nodes.end(),
+                 node_columns.begin(),
+                 sorted_columns.begin());
+  thrust::stable_sort_by_key(rmm::exec_policy(stream),
+                             sorted_columns.begin(),
+                             sorted_columns.end(),
+                             sorted_nodes.begin());
+  rmm::device_uvector<size_type> node_offsets(columns.size() + 1, stream);
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      sorted_columns.begin(),
+                      sorted_columns.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(columns.size() + 1),
+                      node_offsets.begin());
+
+  // The rank of each node in its column, and then its row: fields are in the row of their object,
+  // which is itself in the row of its own object if it is the value of a field
+  rmm::device_uvector<size_type> ranks(num_nodes, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     sorted_nodes.size(),
+                     [sorted_nodes   = sorted_nodes.data(),
+                      sorted_columns = sorted_columns.data(),
+                      node_offsets   = node_offsets.data(),
+                      ranks          = ranks.data()] __device__(size_type i) {
+                       ranks[sorted_nodes[i]] = i - node_offsets[sorted_columns[i]];
+                     });
+  rmm::device_uvector<size_type> rows(num_nodes, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     sorted_nodes.begin(),
+                     sorted_nodes.size(),
+                     [categories = nodes.categories.data(),
+                      parents    = nodes.parents.data(),
+                      ranks      = ranks.data(),
+                      rows       = rows.data()] __device__(size_type n) {
+                       auto object = n;
+                       while (parents[object] >= 0 && categories[parents[object]] == NC_FIELD) {
+                         object = parents[parents[object]];
+                       }
+                       rows[n] = ranks[object];
+                     });
+
+  auto h_node_offsets = cudf::detail::make_std_vector_sync(node_offsets, stream);
+  for (auto& column : columns) {
+    auto const id   = &column - columns.data();
+    auto const size = h_node_offsets[id + 1] - h_node_offsets[id];
+    // Fields have a row per object; parents are numbered before their children
+    column.num_rows = (column.parent >= 0 && columns[column.parent].category == CC_STRUCT)
+                        ? columns[column.parent].num_rows
+                        : size;
+  }
+  return {std::move(columns), std::move(h_node_offsets), std::move(sorted_nodes), std::move(rows)};
+}
+
+/**
+ * @brief Builds the columns of the tree of values
+ */
+class column_builder {
+ public:
+  column_builder(tree const& nodes,
+                 column_tree const& columns,
+                 device_span<char const> input,
+                 rmm::cuda_stream_view stream,
+                 rmm::mr::device_memory_resource* mr)
+    : _nodes(nodes), _columns(columns), _input(input), _stream(stream), _mr(mr)
+  {
+  }
+
+  /**
+   * @brief Returns the children of a column, in order of their first node
+   */
+  [[nodiscard]] std::vector<size_type> children(size_type parent) const
+  {
+    std::vector<size_type> result;
+    for (size_type id = 0; id < static_cast<size_type>(_columns.columns.size()); ++id) {
+      if (_columns.columns[id].parent == parent) { result.push_back(id); }
+    }
+    std::sort(result.begin(), result.end(), [&](auto lhs, auto rhs) {
+      return _columns.columns[lhs].first_node < _columns.columns[rhs].first_node;
+    });
+    return result;
+  }
+
+  std::unique_ptr<column> build(size_type id, column_name_info& schema) const
+  {
+    auto const& info = _columns.columns[id];
+    auto const nodes = device_span<size_type const>(_columns.sorted_nodes)
+                         .subspan(_columns.node_offsets[id],
+                                  _columns.node_offsets[id + 1] - _columns.node_offsets[id]);
+    schema.name = info.name;
+
+    switch (info.category) {
+      case CC_STRUCT: {
+        std::vector<std::unique_ptr<column>> child_columns;
+        for (auto const child : children(id)) {
+          schema.children.emplace_back();
+          child_columns.push_back(build(child, schema.children.back()));
+        }
+        auto [null_mask, null_count] = validity(id, nodes);
+        return make_structs_column(info.num_rows,
+                                   std::move(child_columns),
+                                   null_count,
+                                   std::move(null_mask),
+                                   _stream,
+                                   _mr);
+      }
+      case CC_LIST: {
+        auto const element = children(id);
+        schema.children.emplace_back("offsets");
+        schema.children.emplace_back("element");
+        auto child_column = element.empty()
+                              ? make_empty_column(type_id::STRING)
+                              : build(element.front(), schema.children.back());
+        schema.children.back().name = "element";
+        auto offsets = make_numeric_column(
+          data_type{type_id::INT32}, info.num_rows + 1, mask_state::UNALLOCATED, _stream, _mr);
+        // Offset of the first element of each list, from the rows of the lists of the elements
+        auto const element_nodes =
+          element.empty() ? device_span<size_type const>{}
+                          : device_span<size_type const>(_columns.sorted_nodes)
+                              .subspan(_columns.node_offsets[element.front()],
+                                       _columns.node_offsets[element.front() + 1] -
+                                         _columns.node_offsets[element.front()]);
+        auto const element_lists = thrust::make_transform_iterator(
+          element_nodes.begin(),
+          [parents = _nodes.parents.data(), rows = _columns.rows.data()] __device__(
+            size_type n) { return rows[parents[n]]; });
+        thrust::lower_bound(rmm::exec_policy(_stream),
+                            element_lists,
+                            element_lists + element_nodes.size(),
+                            thrust::make_counting_iterator<size_type>(0),
+                            thrust::make_counting_iterator<size_type>(info.num_rows + 1),
+                            offsets->mutable_view().begin<size_type>());
+        auto [null_mask, null_count] = validity(id, nodes);
+        return make_lists_column(info.num_rows,
+                                 std::move(offsets),
+                                 std::move(child_column),
+                                 null_count,
+                                 std::move(null_mask),
+                                 _stream,
+                                 _mr);
+      }
+      default: {
+        schema.children.emplace_back("offsets");
+        schema.children.emplace_back("chars");
+        rmm::device_uvector<thrust::pair<char const*, size_type>> strings(info.num_rows, _stream);
+        thrust::fill(rmm::exec_policy(_stream),
+                     strings.begin(),
+                     strings.end(),
+                     thrust::pair<char const*, size_type>{nullptr, 0});
+        thrust::for_each(rmm::exec_policy(_stream),
+                         nodes.begin(),
+                         nodes.end(),
+                         [input      = _input,
+                          categories = _nodes.categories.data(),
+                          begins     = _nodes.begins.data(),
+                          ends       = _nodes.ends.data(),
+                          rows       = _columns.rows.data(),
+                          strings    = strings.data()] __device__(size_type n) {
+                           if (categories[n] == NC_NULL) { return; }
+                           strings[rows[n]] = {input.data() + begins[n], ends[n] - begins[n]};
+                         });
+        return make_strings_column(strings, _stream, _mr);
+      }
+    }
+  }
+
+ private:
+  /**
+   * @brief Returns the null mask of a nested column; fields are null in the objects missing them
+   */
+  std::pair<rmm::device_buffer, size_type> validity(size_type id,
+                                                    device_span<size_type const> nodes) const
+  {
+    auto const& info = _columns.columns[id];
+    if (info.parent < 0 || _columns.columns[info.parent].category != CC_STRUCT) {
+      return {rmm::device_buffer{0, _stream, _mr}, 0};
+    }
+    rmm::device_uvector<bool> present(info.num_rows, _stream);
+    thrust::fill(rmm::exec_policy(_stream), present.begin(), present.end(), false);
+    thrust::for_each(rmm::exec_policy(_stream),
+                     nodes.begin(),
+                     nodes.end(),
+                     [rows = _columns.rows.data(), present = present.data()] __device__(
+                       size_type n) { present[rows[n]] = true; });
+    return cudf::detail::valid_if(
+      present.begin(), present.end(), thrust::identity<bool>{}, _stream, _mr);
+  }
+
+  tree const& _nodes;
+  column_tree const& _columns;
+  device_span<char const> _input;
+  rmm::cuda_stream_view _stream;
+  rmm::mr::device_memory_resource* _mr;
+};
+
+}  // namespace
+
+std::pair<rmm::device_uvector<token_t>, rmm::device_uvector<size_type>> get_token_stream(
+  device_span<char const> input, rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(input.size() < static_cast<size_t>(std::numeric_limits<size_type>::max()),
+               "JSON input size exceeds the column size limit");
+  auto const size = static_cast<size_type>(input.size());
+
+  // String state machine transitions over each prefix of the input
+  rmm::device_uvector<uint8_t> prefix_transitions(size, stream);
+  auto const transitions = thrust::make_transform_iterator(
+    input.begin(), [] __device__(char c) { return string_transitions(c); });
+  thrust::inclusive_scan(rmm::exec_policy(stream),
+                         transitions,
+                         transitions + size,
+                         prefix_transitions.begin(),
+                         compose_transitions{});
+
+  // Count the tokens of each character, then write them
+  token_finder const finder{input, prefix_transitions.data()};
+  rmm::device_uvector<size_type> token_offsets(size + 1, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(size + 1),
+                    token_offsets.begin(),
+                    [finder, size] __device__(size_type i) {
+                      return (i < size) ? finder(i, nullptr, nullptr) : 0;
+                    });
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), token_offsets.begin(), token_offsets.end(), token_offsets.begin());
+  auto const num_tokens = token_offsets.back_element(stream);
+
+  rmm::device_uvector<token_t> kinds(num_tokens, stream);
+  rmm::device_uvector<size_type> offsets(num_tokens, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     size,
+                     [finder,
+                      token_offsets = token_offsets.data(),
+                      kinds         = kinds.data(),
+                      offsets       = offsets.data()] __device__(size_type i) {
+                       finder(i, kinds + token_offsets[i], offsets + token_offsets[i]);
+                     });
+  return {std::move(kinds), std::move(offsets)};
+}
+
+table_with_metadata read_nested_json(device_span<char const> input,
+                                     host_span<char const> h_input,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  auto const [kinds, offsets] = get_token_stream(input, stream);
+  auto const nodes            = build_tree(kinds, offsets, input, stream);
+  auto const columns          = build_columns(nodes, input, h_input, stream);
+
+  // The records are the only column without a parent
+  auto const records = std::find_if(columns.columns.begin(),
+                                    columns.columns.end(),
+                                    [](auto const& column) { return column.parent < 0; });
+  CUDF_EXPECTS(records != columns.columns.end(), "No JSON records found");
+  CUDF_EXPECTS(records->category == CC_STRUCT, "Each JSON Lines record must be an object");
+
+  column_builder const builder{nodes, columns, input, stream, mr};
+  std::vector<std::unique_ptr<column>> out_columns;
+  table_metadata metadata;
+  for (auto const id : builder.children(records - columns.columns.begin())) {
+    metadata.schema_info.emplace_back();
+    out_columns.push_back(builder.build(id, metadata.schema_info.back()));
+    metadata.column_names.push_back(columns.columns[id].name);
+  }
+  return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
+}
+
+}  // namespace json
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,6 +15,7 @@
  */
 
 #include "json_gpu.h"
+#include "nested_json.hpp"
 
 #include <hash/concurrent_unordered_map.cuh>
 
@@ -24,6 +25,7 @@
 #include <io/utilities/type_conversion.hpp>
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/detail/utilities/visitor_overload.hpp>
 #include <cudf/groupby.hpp>
@@ -32,6 +34,7 @@
 #include <cudf/io/json.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/strings/detail/replace.hpp>
+#include <cudf/strings/string_view.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
@@ -44,6 +47,8 @@
 
 #include <thrust/optional.h>
 
+#include <algorithm>
+
 using cudf::host_span;
 
 namespace cudf {
@@ -106,6 +111,35 @@ col_map_ptr_type create_col_names_hash_map(column_view column_name_hashes,
   return key_col_map;
 }
 
+/**
+ * @brief Initializes the (key hash -> column index) hash map from the names of the columns to read.
+ */
+col_map_ptr_type create_col_names_hash_map(std::vector<std::string> const& column_names,
+                                           rmm::cuda_stream_view stream)
+{
+  std::vector<char> h_chars;
+  std::vector<size_type> h_offsets{0};
+  for (auto const& name : column_names) {
+    h_chars.insert(h_chars.end(), name.begin(), name.end());
+    h_offsets.push_back(h_chars.size());
+  }
+  auto const d_chars   = cudf::detail::make_device_uvector_async(h_chars, stream);
+  auto const d_offsets = cudf::detail::make_device_uvector_async(h_offsets, stream);
+
+  auto key_col_map = col_map_type::create(column_names.size(), stream);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    column_names.size(),
+    [map = *key_col_map, chars = d_chars.data(), offsets = d_offsets.data()] __device__(
+      size_type idx) mutable {
+      auto const name = cudf::string_view(chars + offsets[idx], offsets[idx + 1] - offsets[idx]);
+      map.insert(thrust::make_pair(MurmurHash3_32<cudf::string_view>{}(name), idx));
+    });
+  stream.synchronize();
+  return key_col_map;
+}
+
 /**
  * @brief Create a table whose columns contain the information on JSON objects' keys.
  *
@@ -337,7 +371,14 @@ rmm::device_uvector<char> upload_data_to_device(json_reader_options const& reade
                                                  stream);
 }
 
+/**
+ * @brief Returns the names of the columns and the (key hash -> column index) map of object rows.
+ *
+ * The names of the columns to read, when given, are used instead of the keys of the records, so
+ * that the fields that are not read are never collected.
+ */
 std::pair<std::vector<std::string>, col_map_ptr_type> get_column_names_and_map(
+  json_reader_options const& reader_opts,
   parse_options_view const& parse_opts,
   host_span<char const> h_data,
   device_span<uint64_t const> rec_starts,
@@ -371,10 +412,20 @@ std::pair<std::vector<std::string>, col_map_ptr_type> get_column_names_and_map(
   CUDF_EXPECTS(first_curly_bracket != first_row.end() || first_square_bracket != first_row.end(),
                "Input data is not a valid JSON file.");
   // If the first opening bracket is '{', assume object format
+  auto const& use_cols_names = reader_opts.get_use_cols_names();
   if (first_curly_bracket < first_square_bracket) {
+    if (not use_cols_names.empty()) {
+      auto sorted_names = use_cols_names;
+      std::sort(sorted_names.begin(), sorted_names.end());
+      CUDF_EXPECTS(std::adjacent_find(sorted_names.begin(), sorted_names.end()) ==
+                     sorted_names.end(),
+                   "Column names to read must be unique");
+      return {use_cols_names, create_col_names_hash_map(use_cols_names, stream)};
+    }
     // use keys as column names if input rows are objects
     return get_json_object_keys_hashes(parse_opts, h_data, rec_starts, d_data, stream);
   } else {
+    CUDF_EXPECTS(use_cols_names.empty(), "Selecting columns by name requires object rows");
     int cols_found    = 0;
     bool quotation    = false;
     auto column_names = std::vector<std::string>();
@@ -584,6 +635,15 @@ table_with_metadata read_json(std::vector<std::unique_ptr<datasource>>& sources,
 
   CUDF_EXPECTS(h_data.size() != 0, "Ingest failed: uncompressed input data has zero size.\n");
 
+  if (reader_opts.is_enabled_nested()) {
+    CUDF_EXPECTS(should_load_whole_source(reader_opts),
+                 "Byte ranges are not supported with nested JSON");
+    CUDF_EXPECTS(reader_opts.get_use_cols_names().empty(),
+                 "Selecting columns by name is not supported with nested JSON");
+    auto const d_input = cudf::detail::make_device_uvector_async(h_data, stream);
+    return read_nested_json(d_input, h_data, stream, mr);
+  }
+
   auto d_data = rmm::device_uvector<char>(0, stream);
 
   if (should_load_whole_source(reader_opts)) {
@@ -601,7 +661,7 @@ table_with_metadata read_json(std::vector<std::unique_ptr<datasource>>& sources,
   CUDF_EXPECTS(d_data.size() != 0, "Error uploading input data to the GPU.\n");
 
   auto column_names_and_map =
-    get_column_names_and_map(parse_opts.view(), h_data, rec_starts, d_data, stream);
+    get_column_names_and_map(reader_opts, parse_opts.view(), h_data, rec_starts, d_data, stream);
 
   auto column_names = std::get<0>(column_names_and_map);
   auto column_map   = std::move(std::get<1>(column_names_and_map));
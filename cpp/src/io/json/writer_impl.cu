@@ -0,0 +1,726 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file writer_impl.cu
+ * @brief cuDF-IO JSON Lines writer implementation
+ */
+
+#include <io/csv/durations.hpp>
+#include <io/utilities/chunk_writer.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/detail/json.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/detail/converters.hpp>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace json {
+
+namespace {
+
+// Maximum number of objects and arrays a row may be nested in, including the row itself; bounds
+// the stack of the rows being formatted
+constexpr int max_nesting_depth = 32;
+
+/**
+ * @brief Returns the character following the backslash in the JSON escape sequence of a
+ * character, 'u' for the characters only escaped as `\u00XX`, or 0 if it is not escaped.
+ */
+CUDF_HOST_DEVICE constexpr char escape_of(unsigned char chr)
+{
+  switch (chr) {
+    case '\"': return '\"';
+    case '\\': return '\\';
+    case '\b': return 'b';
+    case '\f': return 'f';
+    case '\n': return 'n';
+    case '\r': return 'r';
+    case '\t': return 't';
+    default: return chr < 0x20 ? 'u' : 0;
+  }
+}
+
+CUDF_HOST_DEVICE constexpr char hex_digit(unsigned char value)
+{
+  return static_cast<char>(value < 10 ? '0' + value : 'a' + (value - 10));
+}
+
+/**
+ * @brief Functor to turn a string column into JSON strings: quoted, with the quotes, backslashes
+ * and control characters escaped.
+ *
+ * The UTF-8 bytes of the other characters are written as they are.
+ */
+struct escape_strings_fn {
+  column_device_view const d_column;
+  offset_type* d_offsets{};
+  char* d_chars{};
+
+  __device__ void write_char(char chr, char*& d_buffer, offset_type& bytes)
+  {
+    if (d_buffer) { *d_buffer++ = chr; }
+    ++bytes;
+  }
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_column.is_null(idx)) {
+      if (!d_chars) d_offsets[idx] = 0;
+      return;
+    }
+
+    auto const d_str  = d_column.element<string_view>(idx);
+    char* d_buffer    = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    offset_type bytes = 0;
+
+    write_char('\"', d_buffer, bytes);
+    for (size_type i = 0; i < d_str.size_bytes(); ++i) {
+      auto const chr    = static_cast<unsigned char>(d_str.data()[i]);
+      auto const escape = escape_of(chr);
+      if (escape == 0) {
+        write_char(chr, d_buffer, bytes);
+      } else if (escape != 'u') {
+        write_char('\\', d_buffer, bytes);
+        write_char(escape, d_buffer, bytes);
+      } else {
+        write_char('\\', d_buffer, bytes);
+        write_char('u', d_buffer, bytes);
+        write_char('0', d_buffer, bytes);
+        write_char('0', d_buffer, bytes);
+        write_char(hex_digit(chr >> 4), d_buffer, bytes);
+        write_char(hex_digit(chr & 0xf), d_buffer, bytes);
+      }
+    }
+    write_char('\"', d_buffer, bytes);
+
+    if (!d_chars) d_offsets[idx] = bytes;
+  }
+};
+
+/**
+ * @brief Returns the JSON strings of the strings of a column, nulls staying null.
+ */
+std::unique_ptr<column> escape_strings(column_view const& column,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  auto d_column = column_device_view::create(column, stream);
+  auto children = cudf::strings::detail::make_strings_children(
+    escape_strings_fn{*d_column}, column.size(), stream, mr);
+
+  return make_strings_column(column.size(),
+                             std::move(children.first),
+                             std::move(children.second),
+                             column.null_count(),
+                             cudf::detail::copy_bitmask(column, stream, mr));
+}
+
+/**
+ * @brief Functor converting a column of values into a strings column of their JSON texts.
+ *
+ * Numbers are formatted by the same converters as in the CSV writer. Timestamps and durations
+ * are formatted as in the CSV writer too, then written as JSON strings.
+ */
+struct column_to_json_fn {
+  // compile-time predicate that defines unsupported column types;
+  // based on the conditions used for instantiations of individual
+  // converters in strings/convert/convert_*.hpp
+  template <typename column_type>
+  constexpr static bool is_not_handled()
+  {
+    return not(
+      (std::is_same_v<column_type, cudf::string_view>) || (std::is_integral<column_type>::value) ||
+      (std::is_floating_point<column_type>::value) || (cudf::is_fixed_point<column_type>()) ||
+      (cudf::is_timestamp<column_type>()) || (cudf::is_duration<column_type>()));
+  }
+
+  explicit column_to_json_fn(rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr)
+    : stream_(stream), mr_(mr)
+  {
+  }
+
+  // bools:
+  //
+  template <typename column_type>
+  std::enable_if_t<std::is_same_v<column_type, bool>, std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    return cudf::strings::detail::from_booleans(column,
+                                                string_scalar{"true", true, stream_},
+                                                string_scalar{"false", true, stream_},
+                                                stream_,
+                                                mr_);
+  }
+
+  // strings:
+  //
+  template <typename column_type>
+  std::enable_if_t<std::is_same_v<column_type, cudf::string_view>, std::unique_ptr<column>>
+  operator()(column_view const& column) const
+  {
+    return escape_strings(column, stream_, mr_);
+  }
+
+  // ints:
+  //
+  template <typename column_type>
+  std::enable_if_t<std::is_integral<column_type>::value && !std::is_same_v<column_type, bool>,
+                   std::unique_ptr<column>>
+  operator()(column_view const& column) const
+  {
+    return cudf::strings::detail::from_integers(column, stream_, mr_);
+  }
+
+  // floats: JSON has no representation of NaN and infinities, which are written as nulls
+  //
+  template <typename column_type>
+  std::enable_if_t<std::is_floating_point<column_type>::value, std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    auto strings        = cudf::strings::detail::from_floats(column, stream_, mr_);
+    auto const d_column = column_device_view::create(column, stream_);
+    auto [null_mask, null_count] = cudf::detail::valid_if(
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(column.size()),
+      [d_column = *d_column] __device__(size_type idx) {
+        return d_column.is_valid(idx) && std::isfinite(d_column.element<column_type>(idx));
+      },
+      stream_,
+      mr_);
+    strings->set_null_mask(std::move(null_mask), null_count);
+    return strings;
+  }
+
+  // fixed point:
+  //
+  template <typename column_type>
+  std::enable_if_t<cudf::is_fixed_point<column_type>(), std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    return cudf::strings::detail::from_fixed_point(column, stream_, mr_);
+  }
+
+  // timestamps:
+  //
+  template <typename column_type>
+  std::enable_if_t<cudf::is_timestamp<column_type>(), std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    std::string const format = [&]() {
+      if (std::is_same_v<cudf::timestamp_s, column_type>) {
+        return std::string{"%Y-%m-%dT%H:%M:%SZ"};
+      } else if (std::is_same_v<cudf::timestamp_ms, column_type>) {
+        return std::string{"%Y-%m-%dT%H:%M:%S.%3fZ"};
+      } else if (std::is_same_v<cudf::timestamp_us, column_type>) {
+        return std::string{"%Y-%m-%dT%H:%M:%S.%6fZ"};
+      } else if (std::is_same_v<cudf::timestamp_ns, column_type>) {
+        return std::string{"%Y-%m-%dT%H:%M:%S.%9fZ"};
+      } else {
+        return std::string{"%Y-%m-%d"};
+      }
+    }();
+
+    auto const strings = cudf::strings::detail::from_timestamps(
+      column,
+      format,
+      strings_column_view(column_view{data_type{type_id::STRING}, 0, nullptr}),
+      stream_,
+      rmm::mr::get_current_device_resource());
+    return escape_strings(strings->view(), stream_, mr_);
+  }
+
+  // durations:
+  //
+  template <typename column_type>
+  std::enable_if_t<cudf::is_duration<column_type>(), std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    auto const strings = cudf::io::detail::csv::pandas_format_durations(
+      column, stream_, rmm::mr::get_current_device_resource());
+    return escape_strings(strings->view(), stream_, mr_);
+  }
+
+  // unsupported type of column:
+  //
+  template <typename column_type>
+  std::enable_if_t<is_not_handled<column_type>(), std::unique_ptr<column>> operator()(
+    column_view const&) const
+  {
+    CUDF_FAIL("Unsupported column type.");
+  }
+
+ private:
+  rmm::cuda_stream_view stream_;
+  rmm::mr::device_memory_resource* mr_;
+};
+
+enum class node_kind : int8_t { LEAF, LIST, STRUCT };
+
+/**
+ * @brief A column of the table or one of its descendants, with the JSON texts written for it.
+ *
+ * The children of a node are consecutive; those of a struct are its fields, that of a list its
+ * elements.
+ */
+struct schema_node {
+  column_view column;
+  node_kind kind;
+  column_name_info const* names;  // of the column and its descendants, if given
+  size_type children_begin;
+  size_type num_children;
+  size_type key_begin;  // of the text `"name":` of a field of a struct or of the table
+  size_type key_size;   // 0 for the elements of a list
+};
+
+/**
+ * @brief The nodes of a table, with the texts written for them.
+ */
+struct json_schema {
+  std::vector<schema_node> nodes;  // those of the columns of the table first
+  std::string text;                // the keys of the fields, then the line terminator
+  size_type terminator_begin;
+};
+
+/**
+ * @brief Returns the key of a field of the given name: the name as a JSON string, then a colon.
+ */
+std::string make_key(std::string const& name)
+{
+  std::string key{"\""};
+  for (unsigned char const chr : name) {
+    auto const escape = escape_of(chr);
+    if (escape == 0) {
+      key.push_back(chr);
+    } else if (escape != 'u') {
+      key.push_back('\\');
+      key.push_back(escape);
+    } else {
+      key += "\\u00";
+      key.push_back(hex_digit(chr >> 4));
+      key.push_back(hex_digit(chr & 0xf));
+    }
+  }
+  return key + "\":";
+}
+
+/**
+ * @brief Returns the names of the columns of the table, taken from the metadata if given.
+ */
+std::vector<column_name_info> column_names(table_view const& table,
+                                           table_metadata const* metadata)
+{
+  if (metadata != nullptr && not metadata->schema_info.empty()) {
+    CUDF_EXPECTS(metadata->schema_info.size() == static_cast<size_t>(table.num_columns()),
+                 "Mismatch between number of column names and table columns.");
+    return metadata->schema_info;
+  }
+  std::vector<column_name_info> names;
+  if (metadata != nullptr) {
+    CUDF_EXPECTS(metadata->column_names.size() == static_cast<size_t>(table.num_columns()),
+                 "Mismatch between number of column names and table columns.");
+    for (auto const& name : metadata->column_names) {
+      names.emplace_back(name);
+    }
+  } else {
+    for (size_type col = 0; col < table.num_columns(); ++col) {
+      names.emplace_back(std::to_string(col));
+    }
+  }
+  return names;
+}
+
+/**
+ * @brief Returns the nodes of the columns of a table and of their descendants.
+ *
+ * @throw cudf::logic_error if the columns are nested too deep
+ */
+json_schema make_schema(table_view const& table,
+                        std::vector<column_name_info> const& names,
+                        std::string const& terminator)
+{
+  json_schema schema;
+  std::vector<int> depths;
+  auto add_node = [&](column_view const& column,
+                      column_name_info const* column_names,
+                      std::optional<std::string> const& name,
+                      int depth) {
+    auto const kind = column.type().id() == type_id::STRUCT ? node_kind::STRUCT
+                      : column.type().id() == type_id::LIST ? node_kind::LIST
+                                                            : node_kind::LEAF;
+    CUDF_EXPECTS(kind == node_kind::LEAF or depth < max_nesting_depth,
+                 "Columns are nested too deep for the JSON writer.");
+    auto const key = name.has_value() ? make_key(*name) : std::string{};
+    schema.nodes.push_back(schema_node{column,
+                                       kind,
+                                       column_names,
+                                       0,
+                                       0,
+                                       static_cast<size_type>(schema.text.size()),
+                                       static_cast<size_type>(key.size())});
+    schema.text += key;
+    depths.push_back(depth);
+  };
+
+  for (size_type col = 0; col < table.num_columns(); ++col) {
+    add_node(table.column(col), &names[col], names[col].name, 1);
+  }
+  // The children of each node are added after all the nodes already there, so they are
+  // consecutive
+  for (std::size_t i = 0; i < schema.nodes.size(); ++i) {
+    auto const node  = schema.nodes[i];  // copied, since adding the children grows the vector
+    auto const depth = depths[i];
+    if (node.kind == node_kind::LEAF) { continue; }
+    schema.nodes[i].children_begin = static_cast<size_type>(schema.nodes.size());
+    if (node.kind == node_kind::STRUCT) {
+      auto const num_children = node.column.num_children();
+      schema.nodes[i].num_children = num_children;
+      bool const has_names =
+        node.names != nullptr && node.names->children.size() == static_cast<size_t>(num_children);
+      for (size_type child = 0; child < num_children; ++child) {
+        auto const child_names = has_names ? &node.names->children[child] : nullptr;
+        add_node(node.column.child(child),
+                 child_names,
+                 has_names ? child_names->name : std::to_string(child),
+                 depth + 1);
+      }
+    } else {
+      auto const child_index = lists_column_view::child_column_index;
+      schema.nodes[i].num_children = 1;
+      bool const has_names =
+        node.names != nullptr && node.names->children.size() > static_cast<size_t>(child_index);
+      add_node(node.column.child(child_index),
+               has_names ? &node.names->children[child_index] : nullptr,
+               std::nullopt,
+               depth + 1);
+    }
+  }
+
+  schema.terminator_begin = static_cast<size_type>(schema.text.size());
+  schema.text += terminator;
+  return schema;
+}
+
+/**
+ * @brief A node of the schema, on the device, for the rows of one chunk.
+ */
+struct json_node {
+  column_device_view column;  // the list or struct column, or the JSON texts of a leaf's values
+  size_type leaf_begin;       // index of the value of a leaf whose JSON text is the first one
+  node_kind kind;
+  size_type children_begin;
+  size_type num_children;
+  size_type key_begin;
+  size_type key_size;
+};
+
+using column_device_view_ptr =
+  std::unique_ptr<column_device_view, std::function<void(column_device_view*)>>;
+
+/**
+ * @brief The nodes of the schema for the rows of one chunk, and the device memory they refer to.
+ */
+struct chunk_nodes {
+  std::vector<std::unique_ptr<column>> texts;
+  std::vector<column_device_view_ptr> views;
+  rmm::device_uvector<json_node> nodes;
+};
+
+/**
+ * @brief Returns the nodes of the schema for the rows `[begin, end)` of the table, converting the
+ * values of the leaves those rows hold to their JSON texts.
+ */
+chunk_nodes make_chunk_nodes(json_schema const& schema,
+                             size_type num_columns,
+                             size_type begin,
+                             size_type end,
+                             rmm::cuda_stream_view stream)
+{
+  auto const mr = rmm::mr::get_current_device_resource();
+  std::vector<std::unique_ptr<column>> texts;
+  std::vector<column_device_view_ptr> views;
+  std::vector<json_node> h_nodes;
+  h_nodes.reserve(schema.nodes.size());
+
+  // The range of the elements of each node held by the rows, set before its node is reached
+  std::vector<std::pair<size_type, size_type>> ranges(schema.nodes.size());
+  std::fill(ranges.begin(), ranges.begin() + num_columns, std::make_pair(begin, end));
+
+  column_to_json_fn const converter{stream, mr};
+  for (std::size_t i = 0; i < schema.nodes.size(); ++i) {
+    auto const& node         = schema.nodes[i];
+    auto const [first, last] = ranges[i];
+    auto const column_offset = node.column.offset();
+    switch (node.kind) {
+      case node_kind::STRUCT:
+        std::fill(ranges.begin() + node.children_begin,
+                  ranges.begin() + node.children_begin + node.num_children,
+                  std::make_pair(first + column_offset, last + column_offset));
+        views.push_back(column_device_view::create(node.column, stream));
+        break;
+      case node_kind::LIST:
+        if (first < last) {
+          auto const offsets = node.column.child(lists_column_view::offsets_column_index);
+          ranges[node.children_begin] = {
+            cudf::detail::get_value<offset_type>(offsets, first + column_offset, stream),
+            cudf::detail::get_value<offset_type>(offsets, last + column_offset, stream)};
+        }
+        views.push_back(column_device_view::create(node.column, stream));
+        break;
+      case node_kind::LEAF:
+        texts.push_back(cudf::type_dispatcher(
+          node.column.type(), converter, cudf::detail::slice(node.column, first, last)));
+        views.push_back(column_device_view::create(texts.back()->view(), stream));
+        break;
+    }
+    h_nodes.push_back(json_node{*views.back(),
+                                first,
+                                node.kind,
+                                node.children_begin,
+                                node.num_children,
+                                node.key_begin,
+                                node.key_size});
+  }
+
+  auto nodes = cudf::detail::make_device_uvector_async(h_nodes, stream);
+  return chunk_nodes{std::move(texts), std::move(views), std::move(nodes)};
+}
+
+/**
+ * @brief An object or array being formatted.
+ */
+struct frame {
+  size_type node;   // -1 for the object of the row itself
+  size_type row;    // of the object among the elements of its node
+  size_type pos;    // the next field of the object, or element of the array
+  size_type end;    // one past the last field or element
+  size_type count;  // number of fields or elements written
+};
+
+/**
+ * @brief Functor formatting a row as a JSON object, followed by the line terminator.
+ *
+ * The same traversal of the nested columns sizes the row when given no output buffer, and writes
+ * it otherwise.
+ */
+struct format_row_fn {
+  device_span<json_node const> nodes;
+  size_type num_columns;
+  char const* text;  // the keys of the fields, then the line terminator
+  size_type terminator_begin;
+  size_type terminator_size;
+  bool include_nulls;
+
+  __device__ void write(char chr, char*& out, size_t& bytes) const
+  {
+    if (out) { *out++ = chr; }
+    ++bytes;
+  }
+
+  __device__ void write(char const* data, size_type size, char*& out, size_t& bytes) const
+  {
+    if (out) { out = thrust::copy(thrust::seq, data, data + size, out); }
+    bytes += size;
+  }
+
+  __device__ bool is_null(json_node const& node, size_type row) const
+  {
+    return node.column.is_null(node.kind == node_kind::LEAF ? row - node.leaf_begin : row);
+  }
+
+  __device__ size_t operator()(size_type row, char* out) const
+  {
+    frame stack[max_nesting_depth];
+    int depth    = 0;
+    size_t bytes = 0;
+
+    write('{', out, bytes);
+    stack[depth++] = frame{-1, row, 0, num_columns, 0};
+    while (depth > 0) {
+      auto& parent       = stack[depth - 1];
+      bool const is_list = parent.node >= 0 && nodes[parent.node].kind == node_kind::LIST;
+      if (parent.pos == parent.end) {
+        write(is_list ? ']' : '}', out, bytes);
+        --depth;
+        continue;
+      }
+
+      // The node and element of the next field or element of the parent
+      size_type child{};
+      size_type child_row{};
+      if (is_list) {
+        child     = nodes[parent.node].children_begin;
+        child_row = parent.pos++;
+      } else if (parent.node < 0) {
+        child     = parent.pos++;
+        child_row = parent.row;
+      } else {
+        auto const& structs = nodes[parent.node];
+        child               = structs.children_begin + parent.pos++;
+        child_row           = parent.row + structs.column.offset();
+      }
+
+      auto const& node = nodes[child];
+      bool const null  = is_null(node, child_row);
+      if (null && !include_nulls && !is_list) { continue; }
+      if (parent.count++ > 0) { write(',', out, bytes); }
+      if (!is_list) { write(text + node.key_begin, node.key_size, out, bytes); }
+      if (null) {
+        write("null", 4, out, bytes);
+        continue;
+      }
+
+      switch (node.kind) {
+        case node_kind::LEAF: {
+          auto const value = node.column.element<string_view>(child_row - node.leaf_begin);
+          write(value.data(), value.size_bytes(), out, bytes);
+          break;
+        }
+        case node_kind::STRUCT:
+          write('{', out, bytes);
+          stack[depth++] = frame{child, child_row, 0, node.num_children, 0};
+          break;
+        case node_kind::LIST: {
+          auto const offsets = node.column.child(lists_column_view::offsets_column_index);
+          auto const index   = child_row + node.column.offset();
+          write('[', out, bytes);
+          stack[depth++] = frame{child,
+                                 child_row,
+                                 offsets.element<offset_type>(index),
+                                 offsets.element<offset_type>(index + 1),
+                                 0};
+          break;
+        }
+      }
+    }
+    write(text + terminator_begin, terminator_size, out, bytes);
+    return bytes;
+  }
+};
+
+/**
+ * @brief Formats the rows `[begin, end)` of a table into a character buffer of JSON Lines.
+ *
+ * The rows are sized in a first pass and written in a second one, with no intermediate strings
+ * column.
+ */
+rmm::device_uvector<char> format_rows(json_schema const& schema,
+                                      device_span<char const> d_text,
+                                      size_type num_columns,
+                                      size_type begin,
+                                      size_type end,
+                                      json_writer_options const& options,
+                                      rmm::cuda_stream_view stream)
+{
+  auto const chunk    = make_chunk_nodes(schema, num_columns, begin, end, stream);
+  auto const num_rows = end - begin;
+  format_row_fn const fn{chunk.nodes,
+                         num_columns,
+                         d_text.data(),
+                         schema.terminator_begin,
+                         static_cast<size_type>(d_text.size()) - schema.terminator_begin,
+                         options.is_enabled_include_nulls()};
+
+  rmm::device_uvector<size_t> row_offsets(num_rows + 1, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows + 1),
+                    row_offsets.begin(),
+                    [fn, begin, num_rows] __device__(size_type row) -> size_t {
+                      return row == num_rows ? 0 : fn(begin + row, nullptr);
+                    });
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), row_offsets.begin(), row_offsets.end(), row_offsets.begin());
+
+  rmm::device_uvector<char> chars(row_offsets.back_element(stream), stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_rows,
+                     [fn, begin, offsets = row_offsets.data(), out = chars.data()] __device__(
+                       size_type row) { fn(begin + row, out + offsets[row]); });
+  return chars;
+}
+
+}  // unnamed namespace
+
+void write_json(data_sink* out_sink,
+                table_view const& table,
+                table_metadata const* metadata,
+                json_writer_options const& options,
+                rmm::cuda_stream_view stream,
+                rmm::mr::device_memory_resource* mr)
+{
+  auto const schema =
+    make_schema(table, column_names(table, metadata), options.get_line_terminator());
+
+  auto const num_rows = table.num_rows();
+  if (num_rows == 0) { return; }
+
+  auto const rows_per_chunk = options.get_rows_per_chunk();
+  CUDF_EXPECTS(rows_per_chunk > 0, "write_json: invalid rows_per_chunk; must be positive");
+
+  auto const d_text = cudf::detail::make_device_uvector_async(
+    host_span<char const>{schema.text.data(), schema.text.size()}, stream);
+
+  chunk_writer writer{out_sink};
+  for (size_type begin = 0; begin < num_rows;) {
+    auto const end = begin + std::min(rows_per_chunk, num_rows - begin);
+    // format the rows into one buffer, while the previous chunk is being written
+    writer.write(format_rows(schema, d_text, table.num_columns(), begin, end, options, stream),
+                 stream);
+    begin = end;
+  }
+  writer.wait();
+}
+
+}  // namespace json
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
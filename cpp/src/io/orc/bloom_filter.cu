@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bloom_filter.hpp"
+#include "orc_gpu.h"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace io {
+namespace orc {
+namespace gpu {
+
+constexpr int bloom_filter_block_size = 256;
+
+/**
+ * @brief Hashes an element the way the ORC Java library hashes the values of its column type
+ *
+ * Integers, booleans and dates are hashed as longs, floating point values as the bits of the value
+ * widened to double, and strings as their UTF-8 bytes.
+ */
+__device__ inline uint64_t bloom_filter_hash(orc_column_device_view const& col, size_type row)
+{
+  switch (col.type().id()) {
+    case type_id::BOOL8: return bloom_filter_long_hash(col.element<bool>(row) ? 1 : 0);
+    case type_id::INT8: return bloom_filter_long_hash(col.element<int8_t>(row));
+    case type_id::INT16: return bloom_filter_long_hash(col.element<int16_t>(row));
+    case type_id::INT32: return bloom_filter_long_hash(col.element<int32_t>(row));
+    case type_id::INT64: return bloom_filter_long_hash(col.element<int64_t>(row));
+    case type_id::TIMESTAMP_DAYS:
+      return bloom_filter_long_hash(col.element<timestamp_D>(row).time_since_epoch().count());
+    case type_id::FLOAT32:
+      return bloom_filter_long_hash(
+        __double_as_longlong(static_cast<double>(col.element<float>(row))));
+    case type_id::FLOAT64:
+      return bloom_filter_long_hash(__double_as_longlong(col.element<double>(row)));
+    case type_id::STRING: {
+      auto const str = col.element<string_view>(row);
+      return murmur3_hash64(reinterpret_cast<uint8_t const*>(str.data()), str.size_bytes());
+    }
+    default: return 0;
+  }
+}
+
+/**
+ * @brief Inserts the valid elements of a rowgroup into its bloom filter
+ *
+ * @param[in] chunks Bloom filter descriptors, one per block
+ */
+// blockDim {bloom_filter_block_size,1,1}
+__global__ void __launch_bounds__(bloom_filter_block_size)
+  gpuBuildBloomFilters(device_span<BloomFilterChunk const> chunks)
+{
+  auto const& chunk = chunks[blockIdx.x];
+  auto const& col   = *chunk.column;
+  auto const bitset = reinterpret_cast<unsigned long long*>(chunk.bitset);
+
+  for (auto row = chunk.start_row + static_cast<size_type>(threadIdx.x);
+       row < chunk.start_row + chunk.num_rows;
+       row += bloom_filter_block_size) {
+    if (!col.is_valid(row)) { continue; }
+    auto const hash = bloom_filter_hash(col, row);
+    for (uint32_t i = 1; i <= chunk.num_hash_functions; ++i) {
+      auto const pos = bloom_filter_bit(hash, i, chunk.num_bits);
+      atomicOr(bitset + (pos / 64), 1ull << (pos % 64));
+    }
+  }
+}
+
+void BuildBloomFilters(device_span<BloomFilterChunk const> chunks, rmm::cuda_stream_view stream)
+{
+  if (chunks.empty()) { return; }
+  dim3 dim_block(bloom_filter_block_size, 1);
+  dim3 dim_grid(chunks.size(), 1);
+  gpuBuildBloomFilters<<<dim_grid, dim_block, 0, stream.value()>>>(chunks);
+}
+
+}  // namespace gpu
+}  // namespace orc
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file bloom_filter.hpp
+ * @brief ORC (BLOOM_FILTER_UTF8) bloom filters
+ *
+ * A filter is a bitset of a multiple of 64 bits. Each value is hashed to 64 bits, with Murmur3 for
+ * strings and Thomas Wang's integer hash for integers, dates and the bits of floating point values
+ * widened to double. The two 32-bit halves of the hash are combined into `num_hash_functions` bit
+ * positions, as done by the Java implementation.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace cudf {
+namespace io {
+namespace orc {
+
+// false positive probability the writer sizes filters for
+constexpr double bloom_filter_fpp = 0.01;
+
+constexpr uint64_t murmur3_c1   = 0x87c37b91114253d5ULL;
+constexpr uint64_t murmur3_c2   = 0x4cf5ad432745937fULL;
+constexpr uint64_t murmur3_seed = 104729;
+
+CUDF_HOST_DEVICE inline uint64_t murmur3_rotl(uint64_t x, int r)
+{
+  return (x << r) | (x >> (64 - r));
+}
+
+CUDF_HOST_DEVICE inline uint64_t murmur3_fmix64(uint64_t h)
+{
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+/**
+ * @brief Computes the 64-bit Murmur3 hash of a byte sequence, as used by ORC bloom filters
+ *
+ * This is the `Murmur3.hash64` variant of the ORC Java library, not the 128-bit hash truncated.
+ */
+CUDF_HOST_DEVICE inline uint64_t murmur3_hash64(uint8_t const* data, size_t size)
+{
+  uint64_t hash      = murmur3_seed;
+  auto const nblocks = size / 8;
+  for (size_t b = 0; b < nblocks; ++b) {
+    uint64_t k = 0;
+    for (int i = 7; i >= 0; --i) {
+      k = (k << 8) | data[b * 8 + i];
+    }
+    k *= murmur3_c1;
+    k = murmur3_rotl(k, 31);
+    k *= murmur3_c2;
+    hash ^= k;
+    hash = murmur3_rotl(hash, 27) * 5 + 0x52dce729;
+  }
+  auto const tail = nblocks * 8;
+  if (tail < size) {
+    uint64_t k = 0;
+    for (auto i = size; i > tail; --i) {
+      k = (k << 8) | data[i - 1];
+    }
+    k *= murmur3_c1;
+    k = murmur3_rotl(k, 31);
+    k *= murmur3_c2;
+    hash ^= k;
+  }
+  hash ^= size;
+  return murmur3_fmix64(hash);
+}
+
+/**
+ * @brief Computes Thomas Wang's 64-bit integer hash, as used by ORC bloom filters for longs
+ *
+ * Right shifts are arithmetic, as in Java.
+ */
+CUDF_HOST_DEVICE inline uint64_t bloom_filter_long_hash(int64_t key)
+{
+  auto k = static_cast<uint64_t>(key);
+  k      = (~k) + (k << 21);
+  k      = k ^ static_cast<uint64_t>(static_cast<int64_t>(k) >> 24);
+  k      = (k + (k << 3)) + (k << 8);
+  k      = k ^ static_cast<uint64_t>(static_cast<int64_t>(k) >> 14);
+  k      = (k + (k << 2)) + (k << 4);
+  k      = k ^ static_cast<uint64_t>(static_cast<int64_t>(k) >> 28);
+  k      = k + (k << 31);
+  return k;
+}
+
+/**
+ * @brief Returns the position of the bit set by the `i`-th hash function, counted from one
+ */
+CUDF_HOST_DEVICE inline uint32_t bloom_filter_bit(uint64_t hash, int i, uint32_t num_bits)
+{
+  auto const hash1 = static_cast<uint32_t>(hash);
+  auto const hash2 = static_cast<uint32_t>(hash >> 32);
+  auto combined    = static_cast<int32_t>(hash1 + static_cast<uint32_t>(i) * hash2);
+  if (combined < 0) { combined = ~combined; }
+  return static_cast<uint32_t>(combined) % num_bits;
+}
+
+/**
+ * @brief Returns the number of bits of a filter holding up to `num_values` values with a false
+ * positive probability of `bloom_filter_fpp`
+ *
+ * The size is rounded to the next multiple of 64 bits, as done by the Java implementation.
+ */
+inline uint32_t bloom_filter_num_bits(size_t num_values)
+{
+  auto const n = static_cast<double>(std::max<size_t>(num_values, 1));
+  auto const num_bits =
+    static_cast<uint32_t>(-n * std::log(bloom_filter_fpp) / (std::log(2.0) * std::log(2.0)));
+  return num_bits + (64 - num_bits % 64);
+}
+
+/**
+ * @brief Returns the number of hash functions of a filter of `num_bits` bits holding up to
+ * `num_values` values
+ */
+inline uint32_t bloom_filter_num_hash_functions(size_t num_values, uint32_t num_bits)
+{
+  auto const n = static_cast<double>(std::max<size_t>(num_values, 1));
+  return std::max<uint32_t>(1, static_cast<uint32_t>(std::lround(num_bits / n * std::log(2.0))));
+}
+
+}  // namespace orc
+}  // namespace io
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "bloom_filter.hpp"
 #include "orc_common.h"
 #include "orc_gpu.h"
 
@@ -425,6 +426,63 @@ __global__ void __launch_bounds__(block_size)
   }
 }
 
+// Number of HyperLogLog registers, as a power of two; the standard error is ~1.04/sqrt(2^bits)
+constexpr int cardinality_register_bits = 10;
+constexpr int cardinality_num_registers = 1 << cardinality_register_bits;
+
+/**
+ * @brief Estimate the number of distinct strings of each stripe with a HyperLogLog sketch
+ *
+ * Only the unique strings of the rowgroup dictionaries are inserted, which does not change the
+ * result as the sketch ignores duplicates.
+ *
+ * @param[in,out] stripes StripeDictionary device array [stripe][column]
+ * @param[in] chunks DictionaryChunk device array [rowgroup][column]
+ */
+// blockDim {cardinality_num_registers,1,1}
+template <int block_size>
+__global__ void __launch_bounds__(block_size)
+  gpuEstimateStripeCardinalities(device_2dspan<StripeDictionary> stripes,
+                                 device_2dspan<DictionaryChunk const> chunks)
+{
+  static_assert(block_size == cardinality_num_registers, "One thread per register is required");
+  __shared__ uint32_t registers[cardinality_num_registers];
+  using block_reduce = cub::BlockReduce<float, block_size>;
+  __shared__ typename block_reduce::TempStorage reduce_storage;
+
+  uint32_t col_id    = blockIdx.x;
+  uint32_t stripe_id = blockIdx.y;
+  int t              = threadIdx.x;
+
+  auto const stripe = stripes[stripe_id][col_id];
+  if (!stripe.dict_data) { return; }
+  registers[t] = 0;
+  __syncthreads();
+  for (uint32_t g = 0; g < stripe.num_chunks; g++) {
+    auto const& chunk = chunks[stripe.start_chunk + g][col_id];
+    for (uint32_t i = t; i < chunk.num_dict_strings; i += block_size) {
+      auto const str  = chunk.leaf_column->element<string_view>(chunk.dict_data[i]);
+      auto const hash =
+        murmur3_hash64(reinterpret_cast<uint8_t const*>(str.data()), str.size_bytes());
+      auto const rest = hash << cardinality_register_bits;
+      uint32_t const rank =
+        (rest == 0) ? 64 - cardinality_register_bits + 1 : __clzll(static_cast<int64_t>(rest)) + 1;
+      atomicMax(&registers[hash >> (64 - cardinality_register_bits)], rank);
+    }
+  }
+  __syncthreads();
+  auto const inv_sum = block_reduce(reduce_storage).Sum(exp2f(-static_cast<float>(registers[t])));
+  __syncthreads();
+  auto const num_zeros = block_reduce(reduce_storage).Sum(registers[t] == 0 ? 1.f : 0.f);
+  if (t == 0) {
+    constexpr float m = cardinality_num_registers;
+    auto estimate     = 0.7213f / (1.f + 1.079f / m) * m * m / inv_sum;
+    // Linear counting is more accurate for small cardinalities
+    if (estimate <= 2.5f * m && num_zeros > 0) { estimate = m * logf(m / num_zeros); }
+    stripes[stripe_id][col_id].cardinality_estimate = static_cast<uint32_t>(estimate + 0.5f);
+  }
+}
+
 void InitDictionaryIndices(device_span<orc_column_device_view const> orc_columns,
                            device_2dspan<DictionaryChunk> chunks,
                            device_span<device_span<uint32_t>> dict_data,
@@ -441,6 +499,19 @@ void InitDictionaryIndices(device_span<orc_column_device_view const> orc_columns
     chunks, orc_columns, dict_data, dict_index, tmp_indices, rowgroup_bounds, str_col_indexes);
 }
 
+/**
+ * @copydoc cudf::io::orc::gpu::EstimateStripeCardinalities
+ */
+void EstimateStripeCardinalities(device_2dspan<StripeDictionary> stripes,
+                                 device_2dspan<DictionaryChunk const> chunks,
+                                 rmm::cuda_stream_view stream)
+{
+  dim3 dim_block(cardinality_num_registers, 1);
+  dim3 dim_grid(stripes.size().second, stripes.size().first);
+  gpuEstimateStripeCardinalities<cardinality_num_registers>
+    <<<dim_grid, dim_block, 0, stream.value()>>>(stripes, chunks);
+}
+
 /**
  * @copydoc cudf::io::orc::gpu::BuildStripeDictionaries
  */
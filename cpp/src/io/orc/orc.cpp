@@ -200,6 +200,35 @@ void ProtobufReader::read(Metadata& s, size_t maxlen)
   function_builder(s, maxlen, op);
 }
 
+void ProtobufReader::read(RowIndexEntry& s, size_t maxlen)
+{
+  auto op = std::make_tuple(make_packed_field_reader(1, s.positions),
+                            make_raw_field_reader(2, s.statistics));
+  function_builder(s, maxlen, op);
+}
+
+void ProtobufReader::read(RowIndex& s, size_t maxlen)
+{
+  auto op = std::make_tuple(make_field_reader(1, s.entry));
+  function_builder(s, maxlen, op);
+}
+
+void ProtobufReader::read(BloomFilter& s, size_t maxlen)
+{
+  // BLOOM_FILTER_UTF8 streams hold the bits in the bytes of `utf8bitset`, read as a string
+  std::string utf8bitset;
+  auto op =
+    std::make_tuple(make_field_reader(1, s.numHashFunctions), make_field_reader(3, utf8bitset));
+  function_builder(s, maxlen, op);
+  s.utf8bitset.assign(utf8bitset.cbegin(), utf8bitset.cend());
+}
+
+void ProtobufReader::read(BloomFilterIndex& s, size_t maxlen)
+{
+  auto op = std::make_tuple(make_field_reader(1, s.bloomFilter));
+  function_builder(s, maxlen, op);
+}
+
 /**
  * @brief Add a single rowIndexEntry, negative input values treated as not present
  */
@@ -356,6 +385,21 @@ size_t ProtobufWriter::write(const Metadata& s)
   return w.value();
 }
 
+size_t ProtobufWriter::write(const BloomFilter& s)
+{
+  ProtobufFieldWriter w(this);
+  w.field_uint(1, s.numHashFunctions);
+  w.field_blob(3, s.utf8bitset);
+  return w.value();
+}
+
+size_t ProtobufWriter::write(const BloomFilterIndex& s)
+{
+  ProtobufFieldWriter w(this);
+  w.field_repeated_struct(1, s.bloomFilter);
+  return w.value();
+}
+
 OrcDecompressor::OrcDecompressor(CompressionKind kind, uint32_t blockSize)
   : m_kind(kind), m_blockSize(blockSize)
 {
@@ -105,6 +105,24 @@ struct StripeFooter {
   std::string writerTimezone = "";      // time zone of the writer
 };
 
+struct BloomFilter {
+  uint32_t numHashFunctions = 0;    // number of bits set for each value
+  std::vector<uint8_t> utf8bitset;  // bitset, as little-endian 64-bit words
+};
+
+struct BloomFilterIndex {
+  std::vector<BloomFilter> bloomFilter;  // one filter per rowgroup
+};
+
+struct RowIndexEntry {
+  std::vector<uint64_t> positions;       // position of the rowgroup in each stream of the column
+  std::vector<ColStatsBlob> statistics;  // statistics of the rowgroup, if written (at most one)
+};
+
+struct RowIndex {
+  std::vector<RowIndexEntry> entry;  // one entry per rowgroup
+};
+
 /**
  * @brief Contains per-column ORC statistics.
  *
@@ -223,6 +241,10 @@ class ProtobufReader {
   void read(column_statistics&, size_t maxlen);
   void read(StripeStatistics&, size_t maxlen);
   void read(Metadata&, size_t maxlen);
+  void read(RowIndexEntry&, size_t maxlen);
+  void read(RowIndex&, size_t maxlen);
+  void read(BloomFilter&, size_t maxlen);
+  void read(BloomFilterIndex&, size_t maxlen);
 
  private:
   template <int index>
@@ -526,6 +548,8 @@ class ProtobufWriter {
   size_t write(const ColumnEncoding&);
   size_t write(const StripeStatistics&);
   size_t write(const Metadata&);
+  size_t write(const BloomFilter&);
+  size_t write(const BloomFilterIndex&);
 
  protected:
   std::vector<uint8_t>* m_buf;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -194,10 +194,24 @@ struct StripeDictionary {
   uint32_t num_chunks;       // number of chunks in the stripe
   uint32_t num_strings;      // number of unique strings in the dictionary
   uint32_t dict_char_count;  // total size of dictionary string data
+  // estimated number of distinct strings in the stripe, set before the dictionary is built
+  uint32_t cardinality_estimate;
 
   orc_column_device_view const* leaf_column;  //!< Pointer to string column
 };
 
+/**
+ * @brief Struct to describe the bloom filter of a rowgroup
+ */
+struct BloomFilterChunk {
+  orc_column_device_view const* column;  // column the filter is built for
+  size_type start_row;                   // first row of the rowgroup
+  size_type num_rows;                    // number of rows in the rowgroup
+  uint64_t* bitset;                      // zero-initialized bitset
+  uint32_t num_bits;                     // number of bits in the bitset, a multiple of 64
+  uint32_t num_hash_functions;           // number of bits set for each value
+};
+
 constexpr uint32_t encode_block_size = 512;
 
 /**
@@ -381,6 +395,20 @@ void InitDictionaryIndices(device_span<orc_column_device_view const> orc_columns
                            device_span<uint32_t const> str_col_indexes,
                            rmm::cuda_stream_view stream);
 
+/**
+ * @brief Launches kernel for estimating the number of distinct strings in each stripe
+ *
+ * The estimate is a HyperLogLog sketch of the strings of the rowgroup dictionaries, so it must be
+ * computed before the rowgroup dictionaries are merged.
+ *
+ * @param[in,out] stripes StripeDictionary device 2D array [stripe][column], with the estimates set
+ * @param[in] chunks DictionaryChunk device array [rowgroup][column]
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ */
+void EstimateStripeCardinalities(device_2dspan<StripeDictionary> stripes,
+                                 device_2dspan<DictionaryChunk const> chunks,
+                                 rmm::cuda_stream_view stream);
+
 /**
  * @brief Launches kernel for building stripe dictionaries
  *
@@ -435,6 +463,16 @@ void orc_encode_statistics(uint8_t* blob_bfr,
                            uint32_t statistics_count,
                            rmm::cuda_stream_view stream);
 
+/**
+ * @brief Launches kernel for building the bloom filters of rowgroups
+ *
+ * Null elements are not inserted.
+ *
+ * @param[in] chunks Bloom filter descriptors, one per rowgroup of each column
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ */
+void BuildBloomFilters(device_span<BloomFilterChunk const> chunks, rmm::cuda_stream_view stream);
+
 /**
  * @brief Number of set bits in pushdown masks, per rowgroup.
  *
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -24,25 +24,35 @@
 #include "reader_impl.hpp"
 #include "timezone.cuh"
 
+#include <io/comp/decompression.hpp>
 #include <io/comp/gpuinflate.h>
-#include <io/utilities/config_utils.hpp>
+#include <io/parquet/predicate_pushdown.hpp>
+#include <io/utilities/reader_profiler.hpp>
+#include <io/utilities/thread_pool.hpp>
 #include <io/utilities/time_utils.cuh>
 
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 
+#include <rmm/cuda_stream_pool.hpp>
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
-#include <nvcomp/snappy.h>
-
 #include <algorithm>
+#include <future>
 #include <iterator>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <tuple>
 
 namespace cudf {
 namespace io {
@@ -51,6 +61,22 @@ namespace orc {
 using namespace cudf::io::orc;
 
 namespace {
+/**
+ * @brief Function that translates ORC compression to GDF compression
+ *
+ * The blocks of ORC ZLIB streams are raw DEFLATE streams, without a header.
+ */
+compression_type to_compression_type(orc::CompressionKind compression)
+{
+  switch (compression) {
+    case orc::ZLIB: return compression_type::ZLIB;
+    case orc::SNAPPY: return compression_type::SNAPPY;
+    case orc::ZSTD: return compression_type::ZSTD;
+    case orc::LZ4: return compression_type::LZ4;
+    default: CUDF_FAIL("Unexpected decompression dispatch");
+  }
+}
+
 /**
  * @brief Function that translates ORC data kind to cuDF type enum
  */
@@ -261,70 +287,312 @@ auto decimal_column_type(std::vector<std::string> const& float64_columns,
   return type_id::DECIMAL128;
 }
 
-}  // namespace
+/**
+ * @brief Range of a source to read into device memory
+ */
+struct stripe_read_info {
+  datasource* source;
+  size_t offset;
+  size_t length;
+  uint8_t* dst;
+};
 
-void snappy_decompress(device_span<gpu_inflate_input_s> comp_in,
-                       device_span<gpu_inflate_status_s> comp_stat,
-                       size_t max_uncomp_page_size,
-                       rmm::cuda_stream_view stream)
+/**
+ * @brief Reads ranges of stripe data into device memory, spreading the transfers over the streams
+ * of a pool.
+ *
+ * Ranges are assigned to the streams in a round-robin fashion, so that the transfers of different
+ * stripes overlap. The ranges of a source assigned to a stream are read with a single vectored
+ * read. Device reads are issued directly on their stream, while host reads and their copies to the
+ * device are issued from the shared pool of threads.
+ *
+ * @param reads Ranges to read; their destination may have been allocated on `stream`
+ * @param stream_pool Streams to issue the transfers on
+ * @param stream Stream on which all the transfers are complete when the function returns
+ */
+void read_stripe_data(std::vector<stripe_read_info> const& reads,
+                      rmm::cuda_stream_pool& stream_pool,
+                      rmm::cuda_stream_view stream)
 {
-  size_t num_blocks = comp_in.size();
-  size_t temp_size;
-
-  auto status =
-    nvcompBatchedSnappyDecompressGetTempSize(num_blocks, max_uncomp_page_size, &temp_size);
-  CUDF_EXPECTS(nvcompStatus_t::nvcompSuccess == status,
-               "Unable to get scratch size for snappy decompression");
-
-  rmm::device_buffer scratch(temp_size, stream);
-  rmm::device_uvector<void const*> compressed_data_ptrs(num_blocks, stream);
-  rmm::device_uvector<size_t> compressed_data_sizes(num_blocks, stream);
-  rmm::device_uvector<void*> uncompressed_data_ptrs(num_blocks, stream);
-  rmm::device_uvector<size_t> uncompressed_data_sizes(num_blocks, stream);
-
-  rmm::device_uvector<size_t> actual_uncompressed_data_sizes(num_blocks, stream);
-  rmm::device_uvector<nvcompStatus_t> statuses(num_blocks, stream);
-
-  // Prepare the vectors
-  auto comp_it = thrust::make_zip_iterator(compressed_data_ptrs.begin(),
-                                           compressed_data_sizes.begin(),
-                                           uncompressed_data_ptrs.begin(),
-                                           uncompressed_data_sizes.data());
-  thrust::transform(rmm::exec_policy(stream),
-                    comp_in.begin(),
-                    comp_in.end(),
-                    comp_it,
-                    [] __device__(gpu_inflate_input_s in) {
-                      return thrust::make_tuple(in.srcDevice, in.srcSize, in.dstDevice, in.dstSize);
-                    });
-
-  status = nvcompBatchedSnappyDecompressAsync(compressed_data_ptrs.data(),
-                                              compressed_data_sizes.data(),
-                                              uncompressed_data_sizes.data(),
-                                              actual_uncompressed_data_sizes.data(),
-                                              num_blocks,
-                                              scratch.data(),
-                                              scratch.size(),
-                                              uncompressed_data_ptrs.data(),
-                                              statuses.data(),
-                                              stream.value());
-  CUDF_EXPECTS(nvcompStatus_t::nvcompSuccess == status, "unable to perform snappy decompression");
-
-  CUDF_EXPECTS(thrust::equal(rmm::exec_policy(stream),
-                             statuses.begin(),
-                             statuses.end(),
-                             thrust::make_constant_iterator(nvcompStatus_t::nvcompSuccess)),
-               "Error during snappy decompression");
-  thrust::for_each_n(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator(0),
-    num_blocks,
-    [=, actual_uncomp_sizes = actual_uncompressed_data_sizes.data()] __device__(auto i) {
-      comp_stat[i].bytes_written = actual_uncomp_sizes[i];
-      comp_stat[i].status        = 0;
-    });
+  if (reads.empty()) { return; }
+  std::vector<rmm::cuda_stream_view> streams;
+  for (size_t i = 0; i < std::min(reads.size(), stream_pool.get_pool_size()); ++i) {
+    streams.push_back(stream_pool.get_stream(i));
+  }
+
+  cudaEvent_t event;
+  CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+  // Fork: the transfers must follow the allocation of their destination on `stream`
+  CUDA_TRY(cudaEventRecord(event, stream.value()));
+  for (auto const& read_stream : streams) {
+    CUDA_TRY(cudaStreamWaitEvent(read_stream.value(), event, 0));
+  }
+
+  // Group the ranges of each source by stream, and by whether they are read into device memory
+  struct read_group {
+    datasource* source;
+    rmm::cuda_stream_view stream;
+    bool is_device_read;
+    std::vector<datasource::read_request> requests;
+    size_t total_size;
+  };
+  std::vector<read_group> groups;
+  std::map<std::tuple<datasource*, size_t, bool>, size_t> group_indices;
+  for (size_t i = 0; i < reads.size(); ++i) {
+    auto const& read          = reads[i];
+    auto const stream_idx     = i % streams.size();
+    auto const is_device_read = read.source->is_device_read_preferred(read.length);
+    auto const [it, inserted] = group_indices.try_emplace(
+      std::make_tuple(read.source, stream_idx, is_device_read), groups.size());
+    if (inserted) { groups.push_back({read.source, streams[stream_idx], is_device_read, {}, 0}); }
+    auto& group = groups[it->second];
+    group.requests.push_back({read.offset, read.length, read.dst});
+    group.total_size += read.length;
+  }
+
+  auto& pool = cudf::detail::host_worker_pool();
+  std::vector<std::future<size_t>> device_reads;
+  std::vector<std::future<void>> host_reads;
+  for (auto const& group : groups) {
+    if (group.is_device_read) {
+      device_reads.push_back(group.source->device_read_v(group.requests, group.stream));
+    } else {
+      host_reads.push_back(pool.submit([&group]() {
+        // Read all the ranges into one host buffer, then copy each of them to the device
+        std::vector<uint8_t> buffer(group.total_size);
+        std::vector<datasource::read_request> host_requests;
+        size_t buffer_offset = 0;
+        for (auto const& request : group.requests) {
+          host_requests.push_back({request.offset, request.size, buffer.data() + buffer_offset});
+          buffer_offset += request.size;
+        }
+        CUDF_EXPECTS(group.source->host_read_v(host_requests) == group.total_size,
+                     "Unexpected discrepancy in bytes read.");
+        for (size_t r = 0; r < host_requests.size(); ++r) {
+          CUDA_TRY(cudaMemcpyAsync(group.requests[r].dst,
+                                   host_requests[r].dst,
+                                   host_requests[r].size,
+                                   cudaMemcpyHostToDevice,
+                                   group.stream.value()));
+        }
+        // The host buffer must outlive the copies
+        group.stream.synchronize();
+      }));
+    }
+  }
+  size_t device_read_idx = 0;
+  for (auto const& group : groups) {
+    if (group.is_device_read) {
+      CUDF_EXPECTS(device_reads[device_read_idx++].get() == group.total_size,
+                   "Unexpected discrepancy in bytes read.");
+    }
+  }
+  for (auto& task : host_reads) {
+    task.get();
+  }
+
+  // Join: the transfers are complete on `stream`
+  for (auto const& read_stream : streams) {
+    CUDA_TRY(cudaEventRecord(event, read_stream.value()));
+    CUDA_TRY(cudaStreamWaitEvent(stream.value(), event, 0));
+  }
+  CUDA_TRY(cudaEventDestroy(event));
+}
+
+using cudf::io::detail::parquet::column_chunk_range;
+using cudf::io::detail::parquet::stats_value;
+
+/**
+ * @brief Returns the duration of a tick of a chrono type, in seconds, as a `{num, den}` ratio
+ */
+struct get_tick_period {
+  template <typename T>
+  std::pair<int64_t, int64_t> operator()()
+  {
+    if constexpr (is_chrono<T>()) {
+      return {T::period::num, T::period::den};
+    } else {
+      CUDF_FAIL("Invalid, non chrono type");
+    }
+  }
+};
+
+/**
+ * @brief Converts a range of ticks to a different time unit.
+ *
+ * The converted range covers every value whose truncation to the source unit lies in `[min,
+ * max]`, since ORC truncates timestamp statistics to milliseconds.
+ *
+ * @return The converted range, or `std::nullopt` if it does not fit in 64 bits
+ */
+std::optional<std::pair<int64_t, int64_t>> rescale_tick_range(int64_t min,
+                                                              int64_t max,
+                                                              std::pair<int64_t, int64_t> src,
+                                                              std::pair<int64_t, int64_t> dst)
+{
+  // Ticks of `src` are converted to ticks of `dst` by multiplying with `num / den`
+  __int128 const num = static_cast<__int128>(src.first) * dst.second;
+  __int128 const den = static_cast<__int128>(src.second) * dst.first;
+  auto const floor_div = [den](__int128 value) { return value / den - (value % den < 0); };
+
+  auto const lo = floor_div(min * num);
+  auto const hi = floor_div((static_cast<__int128>(max) + 1) * num + den - 1) - 1;
+  if (lo < std::numeric_limits<int64_t>::min() or hi > std::numeric_limits<int64_t>::max()) {
+    return std::nullopt;
+  }
+  return std::make_pair(static_cast<int64_t>(lo), static_cast<int64_t>(hi));
+}
+
+/**
+ * @brief Decodes the value range of a column from its encoded file or stripe statistics.
+ *
+ * Only boolean, integral, floating point, date and timestamp columns produce a min/max range;
+ * for other columns only the null information is returned.
+ *
+ * @param blob Encoded column statistics
+ * @param type cuDF type of the output column
+ * @param num_rows Number of rows the statistics describe
+ *
+ * @return The value range, or `std::nullopt` if the column has no statistics
+ */
+std::optional<column_chunk_range> decode_column_range(ColStatsBlob const& blob,
+                                                      data_type type,
+                                                      uint64_t num_rows)
+{
+  if (blob.empty()) { return std::nullopt; }
+  cudf::io::orc::column_statistics stats;
+  ProtobufReader(blob.data(), blob.size()).read(stats);
+
+  column_chunk_range range;
+  range.type = type;
+  // `number_of_values` only counts the non-null values
+  range.all_nulls = num_rows > 0 and stats.number_of_values == 0;
+  auto const set_min_max = [&](auto const& min, auto const& max) {
+    if (min.has_value() and max.has_value()) {
+      range.min = stats_value{min.value()};
+      range.max = stats_value{max.value()};
+    }
+  };
+  auto const set_chrono_min_max =
+    [&](auto const& min, auto const& max, std::pair<int64_t, int64_t> src_period) {
+      if (not min.has_value() or not max.has_value()) { return; }
+      auto const dst_period = type_dispatcher(type, get_tick_period{});
+      if (auto const ticks = rescale_tick_range(min.value(), max.value(), src_period, dst_period)) {
+        range.min = stats_value{ticks->first};
+        range.max = stats_value{ticks->second};
+      }
+    };
+
+  switch (type.id()) {
+    case type_id::BOOL8:
+      // The only bucket holds the number of true values
+      if (stats.bucket_stats.has_value() and not stats.bucket_stats->count.empty() and
+          stats.number_of_values.has_value()) {
+        auto const num_true = stats.bucket_stats->count[0];
+        range.min = stats_value{int64_t{num_true == stats.number_of_values.value()}};
+        range.max = stats_value{int64_t{num_true > 0}};
+      }
+      break;
+    case type_id::INT8:
+    case type_id::INT16:
+    case type_id::INT32:
+    case type_id::INT64:
+      if (stats.int_stats.has_value()) {
+        set_min_max(stats.int_stats->minimum, stats.int_stats->maximum);
+      }
+      break;
+    case type_id::FLOAT32:
+    case type_id::FLOAT64:
+      if (stats.double_stats.has_value()) {
+        set_min_max(stats.double_stats->minimum, stats.double_stats->maximum);
+      }
+      break;
+    case type_id::TIMESTAMP_DAYS:
+    case type_id::TIMESTAMP_SECONDS:
+    case type_id::TIMESTAMP_MILLISECONDS:
+    case type_id::TIMESTAMP_MICROSECONDS:
+    case type_id::TIMESTAMP_NANOSECONDS:
+      if (stats.date_stats.has_value()) {
+        set_chrono_min_max(stats.date_stats->minimum, stats.date_stats->maximum, {86400, 1});
+      } else if (stats.timestamp_stats.has_value()) {
+        // Only the UTC values match the timestamps returned by the reader
+        set_chrono_min_max(
+          stats.timestamp_stats->minimum_utc, stats.timestamp_stats->maximum_utc, {1, 1000});
+      }
+      break;
+    default: break;
+  }
+  return range;
+}
+
+/**
+ * @brief Reads the statistics of each rowgroup of a stripe from the row index of its columns.
+ *
+ * Only the index streams are read and decompressed, on the host, so that the stripe data is not
+ * read when no rowgroup can satisfy the filter.
+ *
+ * @param per_file_metadata Metadata of the source of the stripe
+ * @param stripe_idx Index of the stripe in its source
+ * @param orc_col_ids ORC ids of the columns whose row index is read
+ * @param[out] bytes_read Number of bytes read from the source
+ *
+ * @return Statistics blobs of each rowgroup, indexed by ORC column id, or an empty vector if the
+ * stripe has no row index
+ */
+std::vector<std::vector<ColStatsBlob>> read_rowgroup_statistics(
+  cudf::io::orc::metadata const& per_file_metadata,
+  size_type stripe_idx,
+  std::vector<uint32_t> const& orc_col_ids,
+  size_t& bytes_read)
+{
+  auto const& stripe      = per_file_metadata.ff.stripes[stripe_idx];
+  auto const index_stride = per_file_metadata.get_row_index_stride();
+  if (stripe.indexLength == 0 or index_stride == 0 or stripe.numberOfRows == 0) { return {}; }
+
+  auto const footer_offset = stripe.offset + stripe.indexLength + stripe.dataLength;
+  CUDF_EXPECTS(footer_offset + stripe.footerLength < per_file_metadata.source->size(),
+               "Invalid stripe information");
+  auto const footer_buffer =
+    per_file_metadata.source->host_read(footer_offset, stripe.footerLength);
+  size_t footer_length   = 0;
+  auto const footer_data = per_file_metadata.decompressor->Decompress(
+    footer_buffer->data(), stripe.footerLength, &footer_length);
+  StripeFooter footer;
+  ProtobufReader(footer_data, footer_length).read(footer);
+
+  auto const index_buffer = per_file_metadata.source->host_read(stripe.offset, stripe.indexLength);
+  bytes_read += stripe.footerLength + stripe.indexLength;
+
+  auto const num_rowgroups = (stripe.numberOfRows + index_stride - 1) / index_stride;
+  std::vector<std::vector<ColStatsBlob>> rowgroup_stats(
+    num_rowgroups, std::vector<ColStatsBlob>(per_file_metadata.get_num_columns()));
+  // The index streams come first in the stripe, in the order of the footer
+  uint64_t stream_offset = 0;
+  for (auto const& stream : footer.streams) {
+    if (stream_offset + stream.length > stripe.indexLength) { break; }
+    auto const is_selected =
+      stream.kind == ROW_INDEX and stream.column_id.has_value() and
+      std::find(orc_col_ids.cbegin(), orc_col_ids.cend(), *stream.column_id) != orc_col_ids.cend();
+    if (is_selected and *stream.column_id < rowgroup_stats.front().size()) {
+      size_t index_length   = 0;
+      auto const index_data = per_file_metadata.decompressor->Decompress(
+        index_buffer->data() + stream_offset, stream.length, &index_length);
+      RowIndex row_index;
+      ProtobufReader(index_data, index_length).read(row_index);
+      for (size_t rg = 0; rg < std::min(row_index.entry.size(), rowgroup_stats.size()); ++rg) {
+        auto& statistics = row_index.entry[rg].statistics;
+        if (not statistics.empty()) {
+          rowgroup_stats[rg][*stream.column_id] = std::move(statistics.front());
+        }
+      }
+    }
+    stream_offset += stream.length;
+  }
+  return rowgroup_stats;
 }
 
+}  // namespace
+
 rmm::device_buffer reader::impl::decompress_stripe_data(
   cudf::detail::hostdevice_2dvector<gpu::ColumnDesc>& chunks,
   const std::vector<rmm::device_buffer>& stripe_data,
@@ -336,6 +604,7 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
   bool use_base_stride,
   rmm::cuda_stream_view stream)
 {
+  reader_profiler::stage_timer const timer{_profiler, "decompress", stream};
   // Parse the columns' compressed info
   hostdevice_vector<gpu::CompressedStreamInfo> compinfo(0, stream_info.size(), stream);
   for (const auto& info : stream_info) {
@@ -361,8 +630,17 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
     total_decomp_size += compinfo[i].max_uncompressed_size;
   }
   CUDF_EXPECTS(total_decomp_size > 0, "No decompressible data found");
+  if (_profiler != nullptr) {
+    _profiler->counters().compressed_bytes += std::accumulate(
+      stream_info.cbegin(), stream_info.cend(), size_t{0}, [](auto sum, auto const& info) {
+        return sum + info.length;
+      });
+    _profiler->counters().uncompressed_bytes += total_decomp_size;
+  }
 
-  rmm::device_buffer decomp_data(total_decomp_size, stream);
+  auto const decomp_mr = _decompression_arena != nullptr ? _decompression_arena.get()
+                                                         : rmm::mr::get_current_device_resource();
+  rmm::device_buffer decomp_data(total_decomp_size, stream, decomp_mr);
   rmm::device_uvector<gpu_inflate_input_s> inflate_in(
     num_compressed_blocks + num_uncompressed_blocks, stream);
   rmm::device_uvector<gpu_inflate_status_s> inflate_out(num_compressed_blocks, stream);
@@ -395,25 +673,15 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
 
   // Dispatch batches of blocks to decompress
   if (num_compressed_blocks > 0) {
-    switch (decompressor->GetKind()) {
-      case orc::ZLIB:
-        CUDA_TRY(
-          gpuinflate(inflate_in.data(), inflate_out.data(), num_compressed_blocks, 0, stream));
-        break;
-      case orc::SNAPPY:
-        if (nvcomp_integration::is_stable_enabled()) {
-          device_span<gpu_inflate_input_s> inflate_in_view{inflate_in.data(),
-                                                           num_compressed_blocks};
-          device_span<gpu_inflate_status_s> inflate_out_view{inflate_out.data(),
-                                                             num_compressed_blocks};
-          snappy_decompress(inflate_in_view, inflate_out_view, max_uncomp_block_size, stream);
-        } else {
-          CUDA_TRY(
-            gpu_unsnap(inflate_in.data(), inflate_out.data(), num_compressed_blocks, stream));
-        }
-        break;
-      default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
-    }
+    device_span<gpu_inflate_input_s> inflate_in_view{inflate_in.data(), num_compressed_blocks};
+    device_span<gpu_inflate_status_s> inflate_out_view{inflate_out.data(), num_compressed_blocks};
+    batched_decompress(to_compression_type(decompressor->GetKind()),
+                       inflate_in_view,
+                       inflate_out_view,
+                       max_uncomp_block_size,
+                       false,
+                       stream,
+                       decomp_mr);
   }
   if (num_uncompressed_blocks > 0) {
     CUDA_TRY(gpu_copy_uncompressed_blocks(
@@ -600,6 +868,7 @@ void reader::impl::decode_stream_data(cudf::detail::hostdevice_2dvector<gpu::Col
                                       size_t level,
                                       rmm::cuda_stream_view stream)
 {
+  reader_profiler::stage_timer const timer{_profiler, "decode", stream};
   const auto num_stripes = chunks.size().first;
   const auto num_columns = chunks.size().second;
   thrust::counting_iterator<int> col_idx_it(0);
@@ -901,13 +1170,261 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
   _decimal_cols_as_float = options.get_decimal_cols_as_float();
   decimal128_columns     = options.get_decimal128_columns();
   is_decimal128_enabled  = options.is_enabled_decimal128();
+
+  _filter = options.get_filter();
+
+  _decompression_arena = options.get_decompression_arena();
+
+  _profile = options.is_enabled_profile();
+}
+
+type_id reader::impl::output_type_id(size_type orc_col_id) const
+{
+  return to_type_id(
+    _metadata.get_col_type(orc_col_id),
+    _use_np_dtypes,
+    _timestamp_type.id(),
+    decimal_column_type(
+      _decimal_cols_as_float, decimal128_columns, is_decimal128_enabled, _metadata, orc_col_id));
+}
+
+size_t reader::impl::estimate_stripe_output_size(size_t src_idx, size_type stripe_idx) const
+{
+  auto const& per_file_metadata = _metadata.per_file_metadata[src_idx];
+  auto const num_rows           = per_file_metadata.ff.stripes[stripe_idx].numberOfRows;
+  auto const& stripe_stats      = per_file_metadata.md.stripeStats;
+
+  size_t size = 0;
+  for (auto const& level : selected_columns.levels) {
+    for (auto const& col : level) {
+      // Child columns may hold more or fewer values than the stripe has rows
+      cudf::io::orc::column_statistics stats;
+      if (static_cast<size_t>(stripe_idx) < stripe_stats.size() and
+          static_cast<size_t>(col.id) < stripe_stats[stripe_idx].colStats.size()) {
+        auto const& blob = stripe_stats[stripe_idx].colStats[col.id];
+        ProtobufReader(blob.data(), blob.size()).read(stats);
+      }
+      auto const num_values = stats.number_of_values.value_or(num_rows);
+      auto const type       = data_type{output_type_id(col.id)};
+
+      size += cudf::util::div_rounding_up_safe<size_t>(num_values, 8);  // null mask
+      if (is_fixed_width(type)) {
+        size += num_values * size_of(type);
+      } else if (type.id() == type_id::STRING or type.id() == type_id::LIST) {
+        size += (num_values + 1) * sizeof(size_type);
+        // The total length of the strings is only known from the statistics
+        if (type.id() == type_id::STRING and stats.string_stats.has_value()) {
+          size += stats.string_stats->sum.value_or(0);
+        }
+      }
+    }
+  }
+  return size;
+}
+
+void reader::impl::setup_chunks(std::size_t chunk_read_limit,
+                                size_type skip_rows,
+                                size_type num_rows,
+                                std::vector<std::vector<size_type>> const& stripes,
+                                rmm::cuda_stream_view stream)
+{
+  _current_chunk = 0;
+  _chunks.clear();
+  auto const num_sources = _metadata.per_file_metadata.size();
+
+  chunk_read_info chunk;
+  size_t chunk_bytes = 0;     // estimated decoded size of the stripes in `chunk`
+  bool chunk_empty   = true;  // whether `chunk` holds no stripe yet
+  // Starts a new chunk if a stripe of the given size does not fit in the current one
+  auto const add_stripe = [&](size_t bytes) {
+    auto const is_new =
+      not chunk_empty and chunk_read_limit > 0 and chunk_bytes + bytes > chunk_read_limit;
+    if (is_new) {
+      _chunks.push_back(std::move(chunk));
+      chunk       = chunk_read_info{};
+      chunk_bytes = 0;
+    }
+    chunk_bytes += bytes;
+    chunk_empty = false;
+    return is_new;
+  };
+
+  if (skip_rows == 0 and num_rows == -1) {
+    CUDF_EXPECTS(stripes.empty() or stripes.size() == num_sources,
+                 "Must specify stripes for each source");
+    // Chunks name their stripes explicitly; the filter is applied again when reading each chunk
+    std::vector<std::vector<size_type>> selection;
+    if (_filter.has_value()) {
+      selection = filter_stripes(stripes, _filter->get(), stream);
+    } else if (not stripes.empty()) {
+      selection = stripes;
+    } else {
+      for (auto const& per_file_metadata : _metadata.per_file_metadata) {
+        selection.emplace_back(per_file_metadata.get_num_stripes());
+        std::iota(selection.back().begin(), selection.back().end(), 0);
+      }
+    }
+    chunk.stripes.resize(num_sources);
+    for (size_t src_idx = 0; src_idx < num_sources; ++src_idx) {
+      for (auto const stripe_idx : selection[src_idx]) {
+        CUDF_EXPECTS(stripe_idx >= 0 and
+                       stripe_idx < _metadata.per_file_metadata[src_idx].get_num_stripes(),
+                     "Invalid stripe index");
+        if (add_stripe(estimate_stripe_output_size(src_idx, stripe_idx))) {
+          chunk.stripes.resize(num_sources);
+        }
+        chunk.stripes[src_idx].push_back(stripe_idx);
+      }
+    }
+    // Always produce at least one chunk so that an empty selection yields an empty table
+    if (not chunk_empty or _chunks.empty()) { _chunks.push_back(std::move(chunk)); }
+    return;
+  }
+
+  // Chunks are ranges of rows, split at stripe boundaries
+  auto const row_start = std::max(skip_rows, 0);
+  auto const total_rows = _metadata.get_num_rows();
+  auto const row_end    = num_rows < 0 ? total_rows : std::min(total_rows, row_start + num_rows);
+  // Only flat columns can be read from a row within a stripe
+  if (selected_columns.num_levels() > 1 or row_start >= row_end) {
+    _chunks.push_back({row_start, std::max(row_end - row_start, 0), {}});
+    return;
+  }
+
+  size_type stripe_start_row = 0;
+  chunk.skip_rows            = row_start;
+  chunk.num_rows             = 0;
+  for (size_t src_idx = 0; src_idx < num_sources; ++src_idx) {
+    auto const& per_file_metadata = _metadata.per_file_metadata[src_idx];
+    for (size_type stripe_idx = 0; stripe_idx < per_file_metadata.get_num_stripes() and
+                                   stripe_start_row < row_end;
+         ++stripe_idx) {
+      auto const stripe_rows =
+        static_cast<size_type>(per_file_metadata.ff.stripes[stripe_idx].numberOfRows);
+      auto const first_row = std::max(stripe_start_row, row_start);
+      auto const last_row  = std::min(stripe_start_row + stripe_rows, row_end);
+      stripe_start_row += stripe_rows;
+      if (first_row >= last_row) { continue; }
+
+      auto const stripe_bytes = estimate_stripe_output_size(src_idx, stripe_idx);
+      if (add_stripe(static_cast<size_t>(static_cast<double>(stripe_bytes) *
+                                         (last_row - first_row) / stripe_rows))) {
+        chunk.skip_rows = first_row;
+        chunk.num_rows  = 0;
+      }
+      chunk.num_rows += last_row - first_row;
+    }
+  }
+  _chunks.push_back(std::move(chunk));
+}
+
+table_with_metadata reader::impl::read_chunk(rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(has_next(), "No more chunks to read");
+  auto const& chunk = _chunks[_current_chunk++];
+  return read(chunk.skip_rows, chunk.num_rows, chunk.stripes, stream);
+}
+
+std::vector<std::vector<size_type>> reader::impl::filter_stripes(
+  std::vector<std::vector<size_type>> const& stripes,
+  ast::expression const& filter,
+  rmm::cuda_stream_view stream) const
+{
+  auto const& output_columns = selected_columns.levels[0];
+  std::vector<data_type> output_types;
+  for (auto const& col : output_columns) {
+    output_types.emplace_back(output_type_id(col.id));
+  }
+  auto const make_column_range = [&](std::vector<ColStatsBlob> const& col_stats,
+                                     uint64_t num_rows) {
+    return [&, stats = &col_stats, num_rows](
+             size_type col_idx) -> std::optional<column_chunk_range> {
+      if (col_idx < 0 || col_idx >= static_cast<size_type>(output_columns.size())) {
+        return std::nullopt;
+      }
+      auto const orc_col_id = static_cast<size_t>(output_columns[col_idx].id);
+      if (orc_col_id >= stats->size()) { return std::nullopt; }
+      return decode_column_range((*stats)[orc_col_id], output_types[col_idx], num_rows);
+    };
+  };
+
+  // The row index is only read for the columns the filter can reference
+  std::vector<uint32_t> orc_col_ids;
+  std::transform(output_columns.cbegin(),
+                 output_columns.cend(),
+                 std::back_inserter(orc_col_ids),
+                 [](auto const& col) { return static_cast<uint32_t>(col.id); });
+  // A stripe is kept if any of its rowgroups may hold a matching row
+  auto const may_satisfy_rowgroups = [&](cudf::io::orc::metadata const& per_file_metadata,
+                                         size_type stripe_idx) {
+    size_t bytes_read = 0;
+    auto const rowgroup_stats =
+      read_rowgroup_statistics(per_file_metadata, stripe_idx, orc_col_ids, bytes_read);
+    if (_profiler != nullptr) { _profiler->counters().bytes_read += bytes_read; }
+
+    auto const stripe_rows  = per_file_metadata.ff.stripes[stripe_idx].numberOfRows;
+    auto const index_stride = per_file_metadata.get_row_index_stride();
+    for (size_t rg = 0; rg < rowgroup_stats.size(); ++rg) {
+      auto const rowgroup_rows = std::min<uint64_t>(index_stride, stripe_rows - rg * index_stride);
+      if (cudf::io::detail::parquet::may_satisfy(
+            filter, make_column_range(rowgroup_stats[rg], rowgroup_rows), stream)) {
+        return true;
+      }
+    }
+    return rowgroup_stats.empty();
+  };
+
+  std::vector<std::vector<size_type>> filtered(_metadata.per_file_metadata.size());
+  for (size_t src_idx = 0; src_idx < filtered.size(); ++src_idx) {
+    auto const& per_file_metadata = _metadata.per_file_metadata[src_idx];
+    // The file statistics can rule out all the stripes of a source at once
+    if (not cudf::io::detail::parquet::may_satisfy(
+          filter,
+          make_column_range(per_file_metadata.ff.statistics, per_file_metadata.get_total_rows()),
+          stream)) {
+      continue;
+    }
+
+    std::vector<size_type> candidates;
+    if (stripes.empty()) {
+      candidates.resize(per_file_metadata.get_num_stripes());
+      std::iota(candidates.begin(), candidates.end(), 0);
+    } else if (src_idx < stripes.size()) {
+      candidates = stripes[src_idx];
+    }
+    auto const& stripe_stats = per_file_metadata.md.stripeStats;
+    for (auto const stripe_idx : candidates) {
+      // Invalid indices are kept so that selecting the stripes reports them
+      if (stripe_idx < 0 || stripe_idx >= per_file_metadata.get_num_stripes()) {
+        filtered[src_idx].push_back(stripe_idx);
+        continue;
+      }
+      // The stripe statistics are checked first, since they do not need a read of the stripe
+      auto const may_satisfy_stripe =
+        stripe_idx >= static_cast<size_type>(stripe_stats.size()) ||
+        cudf::io::detail::parquet::may_satisfy(
+          filter,
+          make_column_range(stripe_stats[stripe_idx].colStats,
+                            per_file_metadata.ff.stripes[stripe_idx].numberOfRows),
+          stream);
+      if (may_satisfy_stripe and may_satisfy_rowgroups(per_file_metadata, stripe_idx)) {
+        filtered[src_idx].push_back(stripe_idx);
+      }
+    }
+  }
+  return filtered;
 }
 
 timezone_table reader::impl::compute_timezone_table(
   const std::vector<cudf::io::orc::metadata::stripe_source_mapping>& selected_stripes,
   rmm::cuda_stream_view stream)
 {
-  if (selected_stripes.empty()) return {};
+  // Filtering may leave sources without stripes
+  auto const first_stripes =
+    std::find_if(selected_stripes.cbegin(), selected_stripes.cend(), [](auto const& mapping) {
+      return not mapping.stripe_info.empty();
+    });
+  if (first_stripes == selected_stripes.cend()) return {};
 
   auto const has_timestamp_column = std::any_of(
     selected_columns.levels.cbegin(), selected_columns.levels.cend(), [&](auto& col_lvl) {
@@ -917,7 +1434,7 @@ timezone_table reader::impl::compute_timezone_table(
     });
   if (not has_timestamp_column) return {};
 
-  return build_timezone_transition_table(selected_stripes[0].stripe_info[0].second->writerTimezone,
+  return build_timezone_transition_table(first_stripes->stripe_info[0].second->writerTimezone,
                                          stream);
 }
 
@@ -931,6 +1448,13 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   CUDF_EXPECTS(skip_rows == 0 or selected_columns.num_levels() == 1,
                "skip_rows is not supported by nested columns");
 
+  // The column metadata is built anew by each read
+  _col_meta = reader_column_meta{};
+
+  std::optional<reader_profiler> profiler;
+  if (_profile) { profiler.emplace(); }
+  _profiler = profiler.has_value() ? &profiler.value() : nullptr;
+
   std::vector<std::unique_ptr<column>> out_columns;
   // buffer and stripe data are stored as per nesting level
   std::vector<std::vector<column_buffer>> out_buffers(selected_columns.num_levels());
@@ -943,8 +1467,20 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   if (selected_columns.num_levels() == 0)
     return {std::make_unique<table>(), std::move(out_metadata)};
 
-  // Select only stripes required (aka row groups)
-  const auto selected_stripes = _metadata.select_stripes(stripes, skip_rows, num_rows);
+  // Select only stripes required (aka row groups), leaving out those the filter rules out
+  auto const filtered_stripes =
+    _filter.has_value() ? filter_stripes(stripes, _filter->get(), stream) : stripes;
+  if (_profiler != nullptr and _filter.has_value()) {
+    auto const num_stripes = [&](std::vector<std::vector<size_type>> const& stripe_lists) {
+      if (stripe_lists.empty()) { return static_cast<size_t>(_metadata.get_num_stripes()); }
+      return std::accumulate(
+        stripe_lists.cbegin(), stripe_lists.cend(), size_t{0}, [](auto sum, auto const& list) {
+          return sum + list.size();
+        });
+    };
+    _profiler->counters().pages_skipped += num_stripes(stripes) - num_stripes(filtered_stripes);
+  }
+  const auto selected_stripes = _metadata.select_stripes(filtered_stripes, skip_rows, num_rows);
 
   auto const tz_table = compute_timezone_table(selected_stripes, stream);
 
@@ -1041,7 +1577,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       size_t num_rowgroups    = 0;
       int stripe_idx          = 0;
 
-      std::vector<std::pair<std::future<size_t>, size_t>> read_tasks;
+      std::vector<stripe_read_info> stripe_reads;
       for (auto const& stripe_source_mapping : selected_stripes) {
         // Iterate through the source files selected stripes
         for (auto const& stripe : stripe_source_mapping.stripe_info) {
@@ -1085,22 +1621,12 @@ table_with_metadata reader::impl::read(size_type skip_rows,
               len += stream_info[stream_count].length;
               stream_count++;
             }
-            if (_metadata.per_file_metadata[stripe_source_mapping.source_idx]
-                  .source->is_device_read_preferred(len)) {
-              read_tasks.push_back(
-                std::make_pair(_metadata.per_file_metadata[stripe_source_mapping.source_idx]
-                                 .source->device_read_async(offset, len, d_dst, stream),
-                               len));
-
-            } else {
-              const auto buffer =
-                _metadata.per_file_metadata[stripe_source_mapping.source_idx].source->host_read(
-                  offset, len);
-              CUDF_EXPECTS(buffer->size() == len, "Unexpected discrepancy in bytes read.");
-              CUDA_TRY(cudaMemcpyAsync(
-                d_dst, buffer->data(), len, cudaMemcpyHostToDevice, stream.value()));
-              stream.synchronize();
-            }
+            stripe_reads.push_back(
+              {_metadata.per_file_metadata[stripe_source_mapping.source_idx].source,
+               offset,
+               len,
+               d_dst});
+            if (_profiler != nullptr) { _profiler->counters().bytes_read += len; }
           }
 
           const auto num_rows_per_stripe = stripe_info->numberOfRows;
@@ -1164,8 +1690,9 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           stripe_idx++;
         }
       }
-      for (auto& task : read_tasks) {
-        CUDF_EXPECTS(task.first.get() == task.second, "Unexpected discrepancy in bytes read.");
+      {
+        reader_profiler::stage_timer const read_timer{_profiler, "read", stream};
+        read_stripe_data(stripe_reads, _read_streams, stream);
       }
 
       // Process dataset chunk pages into output columns
@@ -1276,6 +1803,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
 
   // If out_columns is empty, then create columns from buffer.
   if (out_columns.empty()) {
+    reader_profiler::stage_timer const assemble_timer{_profiler, "assemble", stream};
     create_columns(std::move(out_buffers), out_columns, schema_info, stream);
   }
 
@@ -1294,7 +1822,18 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     }
   }
 
-  return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
+  auto out_table = std::make_unique<table>(std::move(out_columns));
+  // The remaining stripes may hold rows that do not satisfy the filter
+  if (_filter.has_value() and out_table->num_rows() > 0) {
+    auto const mask = cudf::detail::compute_column(out_table->view(), _filter->get(), stream);
+    CUDF_EXPECTS(mask->type().id() == type_id::BOOL8, "The filter expression must return booleans");
+    out_table = cudf::detail::apply_boolean_mask(out_table->view(), mask->view(), stream, _mr);
+  }
+  if (profiler.has_value()) {
+    out_metadata.profile = profiler->finish(stream);
+    _profiler            = nullptr;
+  }
+  return {std::move(out_table), std::move(out_metadata)};
 }
 
 // Forward to implementation
@@ -1316,6 +1855,30 @@ table_with_metadata reader::read(orc_reader_options const& options, rmm::cuda_st
     options.get_skip_rows(), options.get_num_rows(), options.get_stripes(), stream);
 }
 
+// Forward to implementation
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                               orc_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+  : reader(std::move(sources), options, stream, mr), _stream(stream)
+{
+  _impl->setup_chunks(chunk_read_limit,
+                      options.get_skip_rows(),
+                      options.get_num_rows(),
+                      options.get_stripes(),
+                      stream);
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk() { return _impl->read_chunk(_stream); }
+
 }  // namespace orc
 }  // namespace detail
 }  // namespace io
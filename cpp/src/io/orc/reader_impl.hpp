@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,14 +22,18 @@
 
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/reader_profiler.hpp>
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/detail/orc.hpp>
 #include <cudf/io/orc.hpp>
 
+#include <rmm/cuda_stream_pool.hpp>
 #include <rmm/cuda_stream_view.hpp>
 
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -101,7 +105,63 @@ class reader::impl {
                            const std::vector<std::vector<size_type>>& stripes,
                            rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Splits the data selected by the options into chunks for the chunked reader
+   *
+   * @param chunk_read_limit Limit on the estimated size in bytes of each chunk, or `0` for no limit
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read
+   * @param stripes Indices of individual stripes to load if non-empty
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void setup_chunks(std::size_t chunk_read_limit,
+                    size_type skip_rows,
+                    size_type num_rows,
+                    std::vector<std::vector<size_type>> const& stripes,
+                    rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns whether the chunked reader has chunks left to read
+   */
+  [[nodiscard]] bool has_next() const { return _current_chunk < _chunks.size(); }
+
+  /**
+   * @brief Reads the next chunk set up by `setup_chunks`
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return The set of columns of the chunk along with metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream);
+
  private:
+  /**
+   * @brief Rows or stripes read by one call of the chunked reader
+   */
+  struct chunk_read_info {
+    size_type skip_rows = 0;
+    size_type num_rows  = -1;
+    std::vector<std::vector<size_type>> stripes;  // Stripes of each source, unless empty
+  };
+
+  /**
+   * @brief Returns the cuDF type of the output column read from the given ORC column
+   */
+  [[nodiscard]] type_id output_type_id(size_type orc_col_id) const;
+
+  /**
+   * @brief Estimates the size of the selected columns of a stripe once decoded
+   *
+   * The estimate is computed from the stripe statistics; the characters of string columns without
+   * statistics are not accounted for.
+   *
+   * @param src_idx Index of the source holding the stripe
+   * @param stripe_idx Index of the stripe within its source
+   *
+   * @return Estimated size in bytes
+   */
+  [[nodiscard]] size_t estimate_stripe_output_size(size_t src_idx, size_type stripe_idx) const;
+
   /**
    * @brief Decompresses the stripe data, at stream granularity
    *
@@ -115,7 +175,8 @@ class reader::impl {
    * @param use_base_stride Whether to use base stride obtained from meta or use the computed value
    * @param stream CUDA stream used for device memory operations and kernel launches
    *
-   * @return Device buffer to decompressed page data
+   * @return Device buffer to decompressed page data, allocated from the decompression arena if
+   * one is set
    */
   rmm::device_buffer decompress_stripe_data(
     cudf::detail::hostdevice_2dvector<gpu::ColumnDesc>& chunks,
@@ -213,6 +274,23 @@ class reader::impl {
     const std::vector<cudf::io::orc::metadata::stripe_source_mapping>& selected_stripes,
     rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Selects the stripes whose file and stripe statistics do not rule out the filter
+   *
+   * The stripes that pass their statistics are also checked against the statistics of their
+   * rowgroups, from the row index, and are only kept if one of the rowgroups may match.
+   *
+   * @param stripes Indices of the stripes to consider per source, or all stripes if empty
+   * @param filter Boolean expression over the output columns
+   * @param stream CUDA stream used to read the filter literals
+   *
+   * @return Indices of the remaining stripes of each source
+   */
+  [[nodiscard]] std::vector<std::vector<size_type>> filter_stripes(
+    std::vector<std::vector<size_type>> const& stripes,
+    ast::expression const& filter,
+    rmm::cuda_stream_view stream) const;
+
  private:
   rmm::mr::device_memory_resource* _mr = nullptr;
   std::vector<std::unique_ptr<datasource>> _sources;
@@ -225,7 +303,20 @@ class reader::impl {
   std::vector<std::string> decimal128_columns;
   bool is_decimal128_enabled{true};
   data_type _timestamp_type{type_id::EMPTY};
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+  // Arena the decompressed streams are allocated from; null is the current device resource
+  std::shared_ptr<decompression_arena> _decompression_arena;
   reader_column_meta _col_meta{};
+
+  std::vector<chunk_read_info> _chunks;
+  size_t _current_chunk = 0;
+
+  // Streams the transfers of stripe data are spread over
+  rmm::cuda_stream_pool _read_streams{4};
+
+  // Whether reads return a profile, and the profiler of the read in progress if they do
+  bool _profile{false};
+  reader_profiler* _profiler = nullptr;
 };
 
 }  // namespace orc
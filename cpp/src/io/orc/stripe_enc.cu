@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/utilities/bit.hpp>
+#include <io/comp/nvcomp_adapter.hpp>
 #include <io/utilities/block_utils.cuh>
 #include <io/utilities/config_utils.hpp>
 #include <io/utilities/time_utils.cuh>
@@ -28,8 +29,6 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
-#include <nvcomp/snappy.h>
-
 namespace cudf {
 namespace io {
 namespace orc {
@@ -1316,64 +1315,20 @@ void CompressOrcDataStreams(uint8_t* compressed_data,
     strm_desc, enc_streams, comp_in, comp_out, compressed_data, comp_blk_size, max_comp_blk_size);
   if (compression == SNAPPY) {
     if (detail::nvcomp_integration::is_stable_enabled()) {
-      try {
-        size_t temp_size;
-        nvcompStatus_t nvcomp_status = nvcompBatchedSnappyCompressGetTempSize(
-          num_compressed_blocks, comp_blk_size, nvcompBatchedSnappyDefaultOpts, &temp_size);
-
-        CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
-                     "Error in getting snappy compression scratch size");
-
-        rmm::device_buffer scratch(temp_size, stream);
-        rmm::device_uvector<void const*> uncompressed_data_ptrs(num_compressed_blocks, stream);
-        rmm::device_uvector<size_t> uncompressed_data_sizes(num_compressed_blocks, stream);
-        rmm::device_uvector<void*> compressed_data_ptrs(num_compressed_blocks, stream);
-        rmm::device_uvector<size_t> compressed_bytes_written(num_compressed_blocks, stream);
-
-        auto comp_it = thrust::make_zip_iterator(uncompressed_data_ptrs.begin(),
-                                                 uncompressed_data_sizes.begin(),
-                                                 compressed_data_ptrs.begin());
-        thrust::transform(rmm::exec_policy(stream),
-                          comp_in.begin(),
-                          comp_in.end(),
-                          comp_it,
-                          [] __device__(gpu_inflate_input_s in) {
-                            return thrust::make_tuple(in.srcDevice, in.srcSize, in.dstDevice);
-                          });
-        nvcomp_status = nvcompBatchedSnappyCompressAsync(uncompressed_data_ptrs.data(),
-                                                         uncompressed_data_sizes.data(),
-                                                         max_comp_blk_size,
-                                                         num_compressed_blocks,
-                                                         scratch.data(),
-                                                         scratch.size(),
-                                                         compressed_data_ptrs.data(),
-                                                         compressed_bytes_written.data(),
-                                                         nvcompBatchedSnappyDefaultOpts,
-                                                         stream.value());
-
-        CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess, "Error in snappy compression");
-
-        thrust::transform(rmm::exec_policy(stream),
-                          compressed_bytes_written.begin(),
-                          compressed_bytes_written.end(),
-                          comp_out.begin(),
-                          [] __device__(size_t size) {
-                            gpu_inflate_status_s status{};
-                            status.bytes_written = size;
-                            return status;
-                          });
-      } catch (...) {
-        // If we reach this then there was an error in compressing so set an error status for each
-        // block
-        thrust::for_each(rmm::exec_policy(stream),
-                         comp_out.begin(),
-                         comp_out.end(),
-                         [] __device__(gpu_inflate_status_s & stat) { stat.status = 1; });
-      };
-
+      nvcomp::batched_compress(
+        nvcomp::compression_type::SNAPPY, comp_in, comp_out, comp_blk_size, stream);
     } else {
       gpu_snap(comp_in.data(), comp_out.data(), num_compressed_blocks, stream);
     }
+  } else if (compression == ZLIB) {
+    gpu_deflate(comp_in.data(), comp_out.data(), num_compressed_blocks, stream);
+  } else if (compression == ZSTD || compression == LZ4) {
+    nvcomp::batched_compress(
+      compression == ZSTD ? nvcomp::compression_type::ZSTD : nvcomp::compression_type::LZ4,
+      comp_in,
+      comp_out,
+      comp_blk_size,
+      stream);
   }
   dim3 dim_block_compact(1024, 1);
   gpuCompactCompressedBlocks<<<dim_grid, dim_block_compact, 0, stream.value()>>>(
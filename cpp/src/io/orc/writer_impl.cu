@@ -19,10 +19,13 @@
  * @brief cuDF-IO ORC writer class implementation
  */
 
+#include "bloom_filter.hpp"
 #include "writer_impl.hpp"
 
+#include <io/comp/nvcomp_adapter.hpp>
 #include <io/statistics/column_statistics.cuh>
 #include <io/utilities/column_utils.cuh>
+#include <io/utilities/config_utils.hpp>
 
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
@@ -36,8 +39,6 @@
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 
-#include <nvcomp/snappy.h>
-
 #include <algorithm>
 #include <cstring>
 #include <numeric>
@@ -74,11 +75,27 @@ orc::CompressionKind to_orc_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return orc::CompressionKind::SNAPPY;
+    case compression_type::ZSTD: return orc::CompressionKind::ZSTD;
+    case compression_type::LZ4: return orc::CompressionKind::LZ4;
+    case compression_type::ZLIB: return orc::CompressionKind::ZLIB;
     case compression_type::NONE: return orc::CompressionKind::NONE;
     default: CUDF_EXPECTS(false, "Unsupported compression type"); return orc::CompressionKind::NONE;
   }
 }
 
+/**
+ * @brief Function that translates ORC compression to the nvcomp format used for its blocks
+ */
+nvcomp::compression_type to_nvcomp_compression(orc::CompressionKind compression)
+{
+  switch (compression) {
+    case orc::CompressionKind::SNAPPY: return nvcomp::compression_type::SNAPPY;
+    case orc::CompressionKind::ZSTD: return nvcomp::compression_type::ZSTD;
+    case orc::CompressionKind::LZ4: return nvcomp::compression_type::LZ4;
+    default: CUDF_FAIL("Unsupported compression type");
+  }
+}
+
 /**
  * @brief Function that translates GDF dtype to ORC datatype
  */
@@ -121,6 +138,25 @@ constexpr int32_t to_clockscale(cudf::type_id timestamp_id)
   }
 }
 
+/**
+ * @brief Returns whether the writer can build bloom filters for columns of the given type kind.
+ */
+constexpr bool is_bloom_filter_supported(TypeKind kind)
+{
+  switch (kind) {
+    case TypeKind::BOOLEAN:
+    case TypeKind::BYTE:
+    case TypeKind::SHORT:
+    case TypeKind::INT:
+    case TypeKind::LONG:
+    case TypeKind::FLOAT:
+    case TypeKind::DOUBLE:
+    case TypeKind::DATE:
+    case TypeKind::STRING: return true;
+    default: return false;
+  }
+}
+
 /**
  * @brief Returns the precision of the given decimal type.
  */
@@ -161,6 +197,8 @@ class orc_column_view {
                                                : to_clockscale(col.type().id())},
       _precision{metadata.is_decimal_precision_set() ? metadata.get_decimal_precision()
                                                      : orc_precision(col.type().id())},
+      _bloom_filter{metadata.is_enabled_bloom_filter() && parent == nullptr &&
+                    is_bloom_filter_supported(_type_kind)},
       name{metadata.get_name()}
   {
     if (metadata.is_nullability_defined()) { nullable_from_metadata = metadata.nullable(); }
@@ -244,6 +282,8 @@ class orc_column_view {
   [[nodiscard]] auto orc_kind() const noexcept { return _type_kind; }
   [[nodiscard]] auto orc_encoding() const noexcept { return _encoding_kind; }
   [[nodiscard]] std::string_view orc_name() const noexcept { return name; }
+  // Whether a bloom filter is written for each rowgroup of the column
+  [[nodiscard]] auto has_bloom_filter() const noexcept { return _bloom_filter; }
 
  private:
   column_view cudf_column;
@@ -263,6 +303,8 @@ class orc_column_view {
   int32_t _scale     = 0;
   int32_t _precision = 0;
 
+  bool _bloom_filter = false;
+
   // String dictionary-related members
   size_t _dict_stride                        = 0;
   gpu::DictionaryChunk const* dict           = nullptr;
@@ -419,7 +461,8 @@ void writer::impl::build_dictionaries(orc_table_view& orc_table,
           const auto& dt = dict[rg_idx][dict_idx];
           return dt_str_cnt + dt.num_dict_strings;
         });
-      sd.leaf_column = dict[0][dict_idx].leaf_column;
+      sd.leaf_column          = dict[0][dict_idx].leaf_column;
+      sd.cardinality_estimate = 0;
     }
 
     if (enable_dictionary_) {
@@ -438,7 +481,7 @@ void writer::impl::build_dictionaries(orc_table_view& orc_table,
                         });
       // Disable dictionary if it does not reduce the output size
       if (!dictionary_enabled[orc_table.string_column(dict_idx).index()] ||
-          col_cost.dictionary >= col_cost.direct) {
+          col_cost.dictionary >= col_cost.direct || dictionary_threshold_ == 0.0) {
         for (auto const& stripe : stripe_bounds) {
           stripe_dict[stripe.id][dict_idx].dict_data = nullptr;
         }
@@ -447,6 +490,29 @@ void writer::impl::build_dictionaries(orc_table_view& orc_table,
   }
 
   stripe_dict.host_to_device(stream);
+  if (enable_dictionary_ && dictionary_threshold_ < 1.0) {
+    // Skip the dictionary build of the columns with too many distinct strings in any stripe
+    gpu::EstimateStripeCardinalities(stripe_dict, dict, stream);
+    stripe_dict.device_to_host(stream, true);
+    for (size_t dict_idx = 0; dict_idx < orc_table.num_string_columns(); ++dict_idx) {
+      auto const is_high_cardinality = std::any_of(
+        stripe_bounds.begin(), stripe_bounds.end(), [&](auto const& stripe) {
+          auto const& sd = stripe_dict[stripe.id][dict_idx];
+          auto const num_strings =
+            std::accumulate(stripe.cbegin(), stripe.cend(), 0ul, [&](auto count, auto rg_idx) {
+              return count + dict[rg_idx][dict_idx].num_strings;
+            });
+          return sd.dict_data != nullptr &&
+                 sd.cardinality_estimate > dictionary_threshold_ * num_strings;
+        });
+      if (is_high_cardinality) {
+        for (auto const& stripe : stripe_bounds) {
+          stripe_dict[stripe.id][dict_idx].dict_data = nullptr;
+        }
+      }
+    }
+    stripe_dict.host_to_device(stream);
+  }
   gpu::BuildStripeDictionaries(stripe_dict, stripe_dict, dict, stream);
   stripe_dict.device_to_host(stream, true);
 }
@@ -497,6 +563,10 @@ orc_streams writer::impl::create_streams(host_span<orc_column_view> columns,
   std::transform(columns.begin(), columns.end(), std::back_inserter(streams), [](auto const& col) {
     return Stream{ROW_INDEX, col.id()};
   });
+  // Followed by the bloom filter streams, which are also index streams
+  for (auto const& col : columns) {
+    if (col.has_bloom_filter()) { streams.push_back(Stream{BLOOM_FILTER_UTF8, col.id()}); }
+  }
 
   std::vector<int32_t> ids(columns.size() * gpu::CI_NUM_STREAMS, -1);
   std::vector<TypeKind> types(streams.size(), INVALID_TYPE_KIND);
@@ -1204,6 +1274,7 @@ writer::impl::encoded_statistics writer::impl::gather_statistic_blobs(
 
 void writer::impl::write_index_stream(int32_t stripe_id,
                                       int32_t stream_id,
+                                      size_type num_index_streams,
                                       host_span<orc_column_view const> columns,
                                       file_segmentation const& segmentation,
                                       host_2dspan<gpu::encoder_chunk_streams const> enc_streams,
@@ -1225,7 +1296,7 @@ void writer::impl::write_index_stream(int32_t stripe_id,
     if (stream.ids[type] > 0) {
       record.pos = 0;
       if (compression_kind_ != NONE) {
-        auto const& ss   = strm_desc[stripe_id][stream.ids[type] - (columns.size() + 1)];
+        auto const& ss   = strm_desc[stripe_id][stream.ids[type] - num_index_streams];
         record.blk_pos   = ss.first_block;
         record.comp_pos  = 0;
         record.comp_size = ss.stream_size;
@@ -1299,6 +1370,80 @@ void writer::impl::write_index_stream(int32_t stripe_id,
   stripe->indexLength += buffer_.size();
 }
 
+std::vector<std::vector<BloomFilterIndex>> writer::impl::build_bloom_filters(
+  orc_table_view const& orc_table, file_segmentation const& segmentation)
+{
+  std::vector<std::vector<BloomFilterIndex>> indexes(
+    segmentation.num_stripes(), std::vector<BloomFilterIndex>(orc_table.num_columns()));
+
+  // One filter per rowgroup of each column, sized for the number of rows in the rowgroup
+  std::vector<gpu::BloomFilterChunk> h_chunks;
+  std::vector<size_t> word_offsets;
+  size_t num_words = 0;
+  for (auto const& column : orc_table.columns) {
+    if (!column.has_bloom_filter()) { continue; }
+    for (size_t rg_idx = 0; rg_idx < segmentation.num_rowgroups(); ++rg_idx) {
+      auto const& rows     = segmentation.rowgroups[rg_idx][column.index()];
+      auto const num_bits  = bloom_filter_num_bits(rows.size());
+      auto const num_funcs = bloom_filter_num_hash_functions(rows.size(), num_bits);
+      h_chunks.push_back({orc_table.d_columns.data() + column.index(),
+                          rows.begin,
+                          rows.size(),
+                          nullptr,
+                          num_bits,
+                          num_funcs});
+      word_offsets.push_back(num_words);
+      num_words += num_bits / 64;
+    }
+  }
+  if (h_chunks.empty()) { return indexes; }
+
+  rmm::device_uvector<uint64_t> bitsets(num_words, stream);
+  CUDA_TRY(cudaMemsetAsync(bitsets.data(), 0, bitsets.size() * sizeof(uint64_t), stream.value()));
+  for (size_t i = 0; i < h_chunks.size(); ++i) {
+    h_chunks[i].bitset = bitsets.data() + word_offsets[i];
+  }
+  auto const d_chunks = cudf::detail::make_device_uvector_async(h_chunks, stream);
+  gpu::BuildBloomFilters(d_chunks, stream);
+  auto const h_bitsets = cudf::detail::make_std_vector_sync(bitsets, stream);
+
+  size_t first_chunk = 0;
+  for (auto const& column : orc_table.columns) {
+    if (!column.has_bloom_filter()) { continue; }
+    for (auto const& stripe : segmentation.stripes) {
+      auto& index = indexes[stripe.id][column.index()];
+      std::for_each(stripe.cbegin(), stripe.cend(), [&](auto rg_idx) {
+        auto const chunk_idx = first_chunk + rg_idx;
+        BloomFilter filter;
+        filter.numHashFunctions = h_chunks[chunk_idx].num_hash_functions;
+        // The host is little-endian, so the words can be copied as bytes
+        filter.utf8bitset.resize(h_chunks[chunk_idx].num_bits / 8);
+        std::memcpy(filter.utf8bitset.data(),
+                    h_bitsets.data() + word_offsets[chunk_idx],
+                    filter.utf8bitset.size());
+        index.bloomFilter.push_back(std::move(filter));
+      });
+    }
+    first_chunk += segmentation.num_rowgroups();
+  }
+  return indexes;
+}
+
+void writer::impl::write_bloom_filter_stream(BloomFilterIndex const& index,
+                                             int32_t stream_id,
+                                             StripeInformation* stripe,
+                                             orc_streams* streams,
+                                             ProtobufWriter* pbw)
+{
+  buffer_.resize((compression_kind_ != NONE) ? 3 : 0);
+  pbw->write(index);
+  // Unlike row indexes, filters of large rowgroups can exceed the compression block size
+  add_uncompressed_block_headers(buffer_);
+  (*streams)[stream_id].length = buffer_.size();
+  out_sink_->host_write(buffer_.data(), buffer_.size());
+  stripe->indexLength += buffer_.size();
+}
+
 std::future<void> writer::impl::write_data_stream(gpu::StripeStream const& strm_desc,
                                                   gpu::encoder_chunk_streams const& enc_stream,
                                                   uint8_t const* compressed_data,
@@ -1361,6 +1506,7 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
     max_stripe_size{options.get_stripe_size_bytes(), options.get_stripe_size_rows()},
     row_index_stride{options.get_row_index_stride()},
     compression_kind_(to_orc_compression(options.get_compression())),
+    dictionary_threshold_(options.get_dictionary_threshold()),
     stats_freq_(options.get_statistics_freq()),
     single_write_mode(mode == SingleWriteMode::YES),
     kv_meta(options.get_key_value_metadata()),
@@ -1382,6 +1528,7 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
     max_stripe_size{options.get_stripe_size_bytes(), options.get_stripe_size_rows()},
     row_index_stride{options.get_row_index_stride()},
     compression_kind_(to_orc_compression(options.get_compression())),
+    dictionary_threshold_(options.get_dictionary_threshold()),
     stats_freq_(options.get_statistics_freq()),
     single_write_mode(mode == SingleWriteMode::YES),
     kv_meta(options.get_key_value_metadata()),
@@ -1895,7 +2042,11 @@ void writer::impl::write(table_view const& table)
     orc_table, std::move(dictionaries), std::move(dec_chunk_sizes), segmentation, streams, stream);
 
   // Assemble individual disparate column chunks into contiguous data streams
-  size_type const num_index_streams = (orc_table.num_columns() + 1);
+  auto const num_index_streams = static_cast<size_type>(
+    orc_table.num_columns() + 1 +
+    std::count_if(orc_table.columns.begin(), orc_table.columns.end(), [](auto const& col) {
+      return col.has_bloom_filter();
+    }));
   const auto num_data_streams       = streams.size() - num_index_streams;
   hostdevice_2dvector<gpu::StripeStream> strm_descs(
     segmentation.num_stripes(), num_data_streams, stream);
@@ -1906,9 +2057,13 @@ void writer::impl::write(table_view const& table)
     size_t compressed_bfr_size       = 0;
     size_t num_compressed_blocks     = 0;
     size_t max_compressed_block_size = 0;
-    if (compression_kind_ != NONE) {
-      nvcompBatchedSnappyCompressGetMaxOutputChunkSize(
-        compression_blocksize_, nvcompBatchedSnappyDefaultOpts, &max_compressed_block_size);
+    if (compression_kind_ == ZLIB) {
+      max_compressed_block_size = get_gpu_deflate_max_output_size(compression_blocksize_);
+    } else if (compression_kind_ != NONE) {
+      CUDF_EXPECTS(compression_kind_ == SNAPPY || nvcomp_integration::is_stable_enabled(),
+                   "ZSTD and LZ4 compression require nvCOMP use to be enabled");
+      max_compressed_block_size = nvcomp::compress_max_output_chunk_size(
+        to_nvcomp_compression(compression_kind_), compression_blocksize_);
     }
     auto stream_output = [&]() {
       size_t max_stream_size = 0;
@@ -1964,7 +2119,8 @@ void writer::impl::write(table_view const& table)
 
     ProtobufWriter pbw_(&buffer_);
 
-    auto const statistics = gather_statistic_blobs(stats_freq_, orc_table, segmentation);
+    auto const statistics    = gather_statistic_blobs(stats_freq_, orc_table, segmentation);
+    auto const bloom_filters = build_bloom_filters(orc_table, segmentation);
 
     // Write stripes
     std::vector<std::future<void>> write_tasks;
@@ -1975,8 +2131,18 @@ void writer::impl::write(table_view const& table)
 
       // Column (skippable) index streams appear at the start of the stripe
       for (size_type stream_id = 0; stream_id < num_index_streams; ++stream_id) {
+        if (streams[stream_id].kind == BLOOM_FILTER_UTF8) {
+          write_bloom_filter_stream(
+            bloom_filters[stripe_id][streams[stream_id].column_index().value()],
+            stream_id,
+            &stripe,
+            &streams,
+            &pbw_);
+          continue;
+        }
         write_index_stream(stripe_id,
                            stream_id,
+                           num_index_streams,
                            orc_table.columns,
                            segmentation,
                            enc_data.streams,
@@ -308,6 +308,7 @@ class writer::impl {
    *
    * @param[in] stripe_id Stripe's identifier
    * @param[in] stream_id Stream identifier (column id + 1)
+   * @param[in] num_index_streams Total number of index streams
    * @param[in] columns List of columns
    * @param[in] segmentation stripe and rowgroup ranges
    * @param[in] enc_streams List of encoder chunk streams [column][rowgroup]
@@ -320,6 +321,7 @@ class writer::impl {
    */
   void write_index_stream(int32_t stripe_id,
                           int32_t stream_id,
+                          size_type num_index_streams,
                           host_span<orc_column_view const> columns,
                           file_segmentation const& segmentation,
                           host_2dspan<gpu::encoder_chunk_streams const> enc_streams,
@@ -330,6 +332,32 @@ class writer::impl {
                           orc_streams* streams,
                           ProtobufWriter* pbw);
 
+  /**
+   * @brief Builds the bloom filters of each rowgroup of the columns that have them.
+   *
+   * @param orc_table Table information to be written
+   * @param segmentation stripe and rowgroup ranges
+   * @return Bloom filter index of each stripe of each column [stripe][column]; empty for the
+   * columns without bloom filters
+   */
+  std::vector<std::vector<BloomFilterIndex>> build_bloom_filters(
+    orc_table_view const& orc_table, file_segmentation const& segmentation);
+
+  /**
+   * @brief Writes the specified column's bloom filter stream.
+   *
+   * @param[in] index Bloom filters of the column's rowgroups in the stripe
+   * @param[in] stream_id Index of the bloom filter stream
+   * @param[in,out] stripe Stream's parent stripe
+   * @param[in,out] streams List of all streams
+   * @param[in,out] pbw Protobuf writer
+   */
+  void write_bloom_filter_stream(BloomFilterIndex const& index,
+                                 int32_t stream_id,
+                                 StripeInformation* stripe,
+                                 orc_streams* streams,
+                                 ProtobufWriter* pbw);
+
   /**
    * @brief Write the specified column's data streams
    *
@@ -365,8 +393,9 @@ class writer::impl {
   size_t compression_blocksize_     = DEFAULT_COMPRESSION_BLOCKSIZE;
   CompressionKind compression_kind_ = CompressionKind::NONE;
 
-  bool enable_dictionary_     = true;
-  statistics_freq stats_freq_ = ORC_STATISTICS_ROW_GROUP;
+  bool enable_dictionary_      = true;
+  double dictionary_threshold_ = default_dictionary_threshold;
+  statistics_freq stats_freq_  = ORC_STATISTICS_ROW_GROUP;
 
   // Overall file metadata.  Filled in during the process and written during write_chunked_end()
   cudf::io::orc::FileFooter ff;
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bloom_filter.hpp"
+
+#include <io/parquet/parquet_gpu.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/fixed_point/fixed_point.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+namespace cudf {
+namespace io {
+namespace parquet {
+namespace gpu {
+namespace {
+
+/**
+ * @brief Physical type a column of type `T` is written as, for fixed-width columns
+ *
+ * Integral types narrower than 32 bits are written as INT32 and decimals as their storage type.
+ */
+template <typename T, typename Enable = void>
+struct physical_value {
+  using type = T;
+};
+
+template <typename T>
+struct physical_value<T, std::enable_if_t<std::is_integral_v<T> && sizeof(T) < 4>> {
+  using type = std::conditional_t<std::is_signed_v<T>, int32_t, uint32_t>;
+};
+
+template <typename T>
+struct physical_value<T, std::enable_if_t<cudf::is_fixed_point<T>()>> {
+  using type = typename T::rep;
+};
+
+__device__ inline void insert_hash(uint64_t hash, device_span<uint32_t> bitset)
+{
+  auto const num_blocks = bitset.size() / bloom_filter_block_words;
+  auto const block      = bitset.data() + bloom_filter_block_index(hash, num_blocks) *
+                                            bloom_filter_block_words;
+  for (int i = 0; i < bloom_filter_block_words; ++i) {
+    atomicOr(block + i, bloom_filter_word_mask(hash, i));
+  }
+}
+
+template <typename T>
+__device__ inline uint64_t hash_value(column_device_view const& col, size_type row)
+{
+  if constexpr (std::is_same_v<T, string_view>) {
+    auto const str = col.element<string_view>(row);
+    return xxhash64(reinterpret_cast<uint8_t const*>(str.data()), str.size_bytes());
+  } else {
+    using physical_type = typename physical_value<T>::type;
+    physical_type value;
+    if constexpr (cudf::is_fixed_point<T>()) {
+      value = col.element<T>(row).value();
+    } else {
+      value = static_cast<physical_type>(col.element<T>(row));
+    }
+    return xxhash64(reinterpret_cast<uint8_t const*>(&value), sizeof(value));
+  }
+}
+
+template <typename T>
+constexpr bool is_supported()
+{
+  return (std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_floating_point_v<T> ||
+         std::is_same_v<T, numeric::decimal32> || std::is_same_v<T, numeric::decimal64> ||
+         std::is_same_v<T, string_view>;
+}
+
+struct bloom_filter_inserter {
+  template <typename T>
+  std::enable_if_t<is_supported<T>(), void> operator()(column_device_view const& col,
+                                                       size_type first_row,
+                                                       size_type num_rows,
+                                                       device_span<uint32_t> bitset,
+                                                       rmm::cuda_stream_view stream)
+  {
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator(first_row),
+                       num_rows,
+                       [col, bitset] __device__(size_type row) {
+                         if (col.is_valid(row)) { insert_hash(hash_value<T>(col, row), bitset); }
+                       });
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<!is_supported<T>(), void> operator()(Args&&...)
+  {
+    CUDF_FAIL("Bloom filters are not supported for this column type");
+  }
+};
+
+struct bloom_filter_support {
+  template <typename T>
+  bool operator()() const
+  {
+    return is_supported<T>();
+  }
+};
+
+}  // namespace
+
+void insert_bloom_filter_values(column_device_view const& col,
+                                size_type first_row,
+                                size_type num_rows,
+                                device_span<uint32_t> bitset,
+                                rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(bitset.size() % bloom_filter_block_words == 0 && !bitset.empty(),
+               "Bloom filter bitset must hold a whole number of blocks");
+  if (num_rows == 0) { return; }
+  type_dispatcher(col.type(), bloom_filter_inserter{}, col, first_row, num_rows, bitset, stream);
+}
+
+bool is_bloom_filter_supported(data_type type)
+{
+  return type_dispatcher(type, bloom_filter_support{});
+}
+
+}  // namespace gpu
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
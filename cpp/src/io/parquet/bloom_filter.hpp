@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file bloom_filter.hpp
+ * @brief Parquet split-block bloom filters, shared by the reader and the writer
+ *
+ * A filter is an array of 256-bit blocks. The 64-bit xxHash of the plain-encoded value selects a
+ * block with its upper half and sets or tests one bit in each of the block's eight 32-bit words
+ * with its lower half.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace cudf {
+namespace io {
+namespace parquet {
+
+constexpr size_t bloom_filter_block_bytes = 32;  // 256 bits per block
+constexpr int bloom_filter_block_words    = 8;   // 32-bit words per block
+constexpr size_t bloom_filter_min_bytes   = bloom_filter_block_bytes;
+constexpr size_t bloom_filter_max_bytes   = 128 * 1024 * 1024;
+// false positive probability the writer sizes filters for
+constexpr double bloom_filter_fpp = 0.01;
+
+constexpr uint64_t xxhash64_prime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t xxhash64_prime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t xxhash64_prime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t xxhash64_prime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t xxhash64_prime5 = 0x27D4EB2F165667C5ULL;
+
+CUDF_HOST_DEVICE inline uint64_t xxhash64_rotl(uint64_t x, int r)
+{
+  return (x << r) | (x >> (64 - r));
+}
+
+CUDF_HOST_DEVICE inline uint64_t xxhash64_round(uint64_t acc, uint64_t input)
+{
+  acc += input * xxhash64_prime2;
+  return xxhash64_rotl(acc, 31) * xxhash64_prime1;
+}
+
+CUDF_HOST_DEVICE inline uint64_t xxhash64_merge(uint64_t acc, uint64_t val)
+{
+  acc ^= xxhash64_round(0, val);
+  return acc * xxhash64_prime1 + xxhash64_prime4;
+}
+
+template <typename T>
+CUDF_HOST_DEVICE inline T load_unaligned(uint8_t const* p)
+{
+  T v;
+  memcpy(&v, p, sizeof(T));
+  return v;
+}
+
+/**
+ * @brief Computes the 64-bit xxHash, with a seed of zero, of a byte sequence
+ *
+ * This is the hash function of Parquet bloom filters.
+ */
+CUDF_HOST_DEVICE inline uint64_t xxhash64(uint8_t const* data, size_t size)
+{
+  auto p         = data;
+  auto const end = data + size;
+  uint64_t h;
+  if (size >= 32) {
+    uint64_t v1 = xxhash64_prime1 + xxhash64_prime2;
+    uint64_t v2 = xxhash64_prime2;
+    uint64_t v3 = 0;
+    uint64_t v4 = 0 - xxhash64_prime1;
+    for (; p + 32 <= end; p += 32) {
+      v1 = xxhash64_round(v1, load_unaligned<uint64_t>(p));
+      v2 = xxhash64_round(v2, load_unaligned<uint64_t>(p + 8));
+      v3 = xxhash64_round(v3, load_unaligned<uint64_t>(p + 16));
+      v4 = xxhash64_round(v4, load_unaligned<uint64_t>(p + 24));
+    }
+    h = xxhash64_rotl(v1, 1) + xxhash64_rotl(v2, 7) + xxhash64_rotl(v3, 12) +
+        xxhash64_rotl(v4, 18);
+    h = xxhash64_merge(h, v1);
+    h = xxhash64_merge(h, v2);
+    h = xxhash64_merge(h, v3);
+    h = xxhash64_merge(h, v4);
+  } else {
+    h = xxhash64_prime5;
+  }
+  h += size;
+  for (; p + 8 <= end; p += 8) {
+    h ^= xxhash64_round(0, load_unaligned<uint64_t>(p));
+    h = xxhash64_rotl(h, 27) * xxhash64_prime1 + xxhash64_prime4;
+  }
+  if (p + 4 <= end) {
+    h ^= static_cast<uint64_t>(load_unaligned<uint32_t>(p)) * xxhash64_prime1;
+    h = xxhash64_rotl(h, 23) * xxhash64_prime2 + xxhash64_prime3;
+    p += 4;
+  }
+  for (; p < end; ++p) {
+    h ^= (*p) * xxhash64_prime5;
+    h = xxhash64_rotl(h, 11) * xxhash64_prime1;
+  }
+  h ^= h >> 33;
+  h *= xxhash64_prime2;
+  h ^= h >> 29;
+  h *= xxhash64_prime3;
+  h ^= h >> 32;
+  return h;
+}
+
+/**
+ * @brief Returns the index of the block a hash maps to
+ */
+CUDF_HOST_DEVICE inline size_t bloom_filter_block_index(uint64_t hash, size_t num_blocks)
+{
+  return static_cast<size_t>(((hash >> 32) * num_blocks) >> 32);
+}
+
+/**
+ * @brief Returns the bit a hash sets in word `i` of its block
+ */
+CUDF_HOST_DEVICE inline uint32_t bloom_filter_word_mask(uint64_t hash, int i)
+{
+  uint32_t const salt[bloom_filter_block_words] = {0x47b6137bU,
+                                                   0x44974d91U,
+                                                   0x8824ad5bU,
+                                                   0xa2b7289dU,
+                                                   0x705495c7U,
+                                                   0x2df1424bU,
+                                                   0x9efc4947U,
+                                                   0x5c6bfb31U};
+  return 1u << ((static_cast<uint32_t>(hash) * salt[i]) >> 27);
+}
+
+/**
+ * @brief Tests whether a hash may have been inserted into a filter
+ *
+ * @param bitset Bitset of the filter; no alignment is required
+ * @param num_bytes Size of the bitset, a multiple of the block size
+ * @param hash Hash of the value
+ *
+ * @return `false` if the value has definitely not been inserted
+ */
+inline bool bloom_filter_contains(uint8_t const* bitset, size_t num_bytes, uint64_t hash)
+{
+  auto const block =
+    bitset + bloom_filter_block_index(hash, num_bytes / bloom_filter_block_bytes) *
+               bloom_filter_block_bytes;
+  for (int i = 0; i < bloom_filter_block_words; ++i) {
+    auto const word = load_unaligned<uint32_t>(block + i * sizeof(uint32_t));
+    if ((word & bloom_filter_word_mask(hash, i)) == 0) { return false; }
+  }
+  return true;
+}
+
+/**
+ * @brief Returns the size of the bitset of a filter holding up to `num_values` distinct values
+ * with a false positive probability of `bloom_filter_fpp`
+ *
+ * The size is a power of two between `bloom_filter_min_bytes` and `bloom_filter_max_bytes`.
+ */
+inline size_t bloom_filter_num_bytes(size_t num_values)
+{
+  auto const num_bits =
+    -8.0 * static_cast<double>(num_values) / std::log(1.0 - std::pow(bloom_filter_fpp, 1.0 / 8));
+  size_t num_bytes = bloom_filter_min_bytes;
+  while (num_bytes < bloom_filter_max_bytes && num_bytes * 8 < num_bits) {
+    num_bytes *= 2;
+  }
+  return num_bytes;
+}
+
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
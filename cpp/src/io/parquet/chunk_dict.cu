@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,6 +22,10 @@
 
 #include <rmm/exec_policy.hpp>
 
+#include <cub/cub.cuh>
+
+#include <limits>
+
 namespace cudf {
 namespace io {
 namespace parquet {
@@ -183,6 +187,121 @@ __global__ void __launch_bounds__(block_size, 1)
   }
 }
 
+/**
+ * @brief Number of windows of `block_size` consecutive values sampled from each fragment when
+ * estimating the delta-encoded size of a chunk
+ */
+constexpr size_type delta_sample_windows = 4;
+
+template <int block_size>
+__global__ void __launch_bounds__(block_size)
+  estimate_delta_sizes_kernel(cudf::detail::device_2dspan<EncColumnChunk> chunks,
+                              cudf::detail::device_2dspan<gpu::PageFragment const> frags)
+{
+  auto col_idx = blockIdx.y;
+  auto block_x = blockIdx.x;
+  auto t       = threadIdx.x;
+  auto frag    = frags[col_idx][block_x];
+  auto chunk   = frag.chunk;
+  auto col     = chunk->col_desc;
+
+  column_device_view const& data_col = *col->leaf_column;
+  bool const is_int = col->physical_type == Type::INT32 || col->physical_type == Type::INT64;
+  bool const is_string =
+    col->physical_type == Type::BYTE_ARRAY && data_col.type().id() == type_id::STRING;
+  if (not is_int and not is_string) { return; }
+
+  __shared__ size_type s_start_value_idx;
+  __shared__ size_type s_num_values;
+  __shared__ size_type s_val_idx[block_size];
+
+  if (t == 0) {
+    auto cudf_col      = *(col->parent_column);
+    s_start_value_idx  = row_to_value_idx(frag.start_row, cudf_col);
+    auto end_value_idx = row_to_value_idx(frag.start_row + frag.num_rows, cudf_col);
+    s_num_values       = end_value_idx - s_start_value_idx;
+  }
+  __syncthreads();
+
+  using block_scan   = cub::BlockScan<size_type, block_size>;
+  using block_reduce = cub::BlockReduce<int64_t, block_size>;
+  __shared__ union {
+    typename block_scan::TempStorage scan;
+    typename block_reduce::TempStorage reduce;
+  } temp_storage;
+
+  // Deltas of INT32 columns wrap around in 32 bits, as they do in the encoder
+  uint64_t const delta_mask = (col->physical_type == Type::INT32) ? 0xffff'ffffu : ~0ull;
+  auto const num_values     = s_num_values;
+  // Windows are spread over the fragment, or contiguous if they cover all of it
+  auto const window_stride  = max(num_values / delta_sample_windows, block_size);
+  int64_t sampled_size      = 0;
+  size_type sampled_values  = 0;
+  for (size_type w = 0; w < delta_sample_windows && w * window_stride < num_values; ++w) {
+    auto const window_start = w * window_stride;
+    auto const window_size  = min(num_values - window_start, block_size);
+    auto const val_idx      = s_start_value_idx + window_start + t;
+    size_type const is_valid =
+      t < window_size && val_idx < data_col.size() && data_col.is_valid(val_idx);
+
+    // Compact the valid values so that each one is compared with the previous valid value
+    size_type pos, num_valid;
+    block_scan(temp_storage.scan).ExclusiveSum(is_valid, pos, num_valid);
+    if (is_valid) { s_val_idx[pos] = val_idx; }
+    __syncthreads();
+    bool const has_prev = t > 0 && t < num_valid;
+
+    int64_t window_encoded_size = 0;
+    if (is_int) {
+      int64_t delta = 0;
+      if (has_prev) {
+        auto const cur  = physical_int_value(*col, s_val_idx[t]);
+        auto const prev = physical_int_value(*col, s_val_idx[t - 1]);
+        delta           = static_cast<int64_t>((static_cast<uint64_t>(cur) - prev) & delta_mask);
+        if (delta_mask != ~0ull) { delta = static_cast<int32_t>(delta); }
+      }
+      auto const min_delta = block_reduce(temp_storage.reduce)
+                               .Reduce(has_prev ? delta : std::numeric_limits<int64_t>::max(),
+                                       cub::Min());
+      __syncthreads();
+      auto const max_delta = block_reduce(temp_storage.reduce)
+                               .Reduce(has_prev ? delta : std::numeric_limits<int64_t>::min(),
+                                       cub::Max());
+      // Bits for the deltas relative to the smallest one, plus the block header
+      if (t == 0 && num_valid > 1) {
+        auto const range    = (static_cast<uint64_t>(max_delta) - min_delta) & delta_mask;
+        auto const bits     = (range == 0) ? 0 : 64 - __clzll(range);
+        window_encoded_size = (static_cast<int64_t>(bits) * (num_valid - 1) + 7) / 8 + 14;
+      }
+    } else {
+      // Suffix after the prefix shared with the previous string, plus about one byte for each of
+      // the delta-encoded prefix and suffix lengths
+      int64_t suffix_size = 0;
+      if (t < num_valid) {
+        auto const cur       = data_col.element<string_view>(s_val_idx[t]);
+        size_type prefix_len = 0;
+        if (has_prev) {
+          auto const prev       = data_col.element<string_view>(s_val_idx[t - 1]);
+          auto const max_prefix = min(cur.size_bytes(), prev.size_bytes());
+          while (prefix_len < max_prefix && cur.data()[prefix_len] == prev.data()[prefix_len]) {
+            ++prefix_len;
+          }
+        }
+        suffix_size = cur.size_bytes() - prefix_len + 2;
+      }
+      window_encoded_size = block_reduce(temp_storage.reduce).Sum(suffix_size);
+    }
+    __syncthreads();
+    sampled_size += window_encoded_size;
+    sampled_values += window_size;
+  }
+
+  if (t == 0 && sampled_values > 0) {
+    auto const estimate = sampled_size * num_values / sampled_values;
+    atomicAdd(&chunk->delta_data_size, static_cast<size_type>(estimate));
+  }
+}
+
 template <int block_size>
 __global__ void __launch_bounds__(block_size, 1)
   collect_map_entries_kernel(device_span<EncColumnChunk> chunks)
@@ -289,6 +408,17 @@ void populate_chunk_hash_maps(cudf::detail::device_2dspan<EncColumnChunk> chunks
     <<<dim_grid, block_size, 0, stream.value()>>>(chunks, frags);
 }
 
+void estimate_delta_sizes(cudf::detail::device_2dspan<EncColumnChunk> chunks,
+                          cudf::detail::device_2dspan<gpu::PageFragment const> frags,
+                          rmm::cuda_stream_view stream)
+{
+  constexpr int block_size = 128;
+  dim3 const dim_grid(frags.size().second, frags.size().first);
+
+  estimate_delta_sizes_kernel<block_size>
+    <<<dim_grid, block_size, 0, stream.value()>>>(chunks, frags);
+}
+
 void collect_map_entries(device_span<EncColumnChunk> chunks, rmm::cuda_stream_view stream)
 {
   constexpr int block_size = 1024;
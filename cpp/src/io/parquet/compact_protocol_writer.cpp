@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -75,6 +75,16 @@ size_t CompactProtocolWriter::write(const RowGroup& r)
   c.field_struct_list(1, r.columns);
   c.field_int(2, r.total_byte_size);
   c.field_int(3, r.num_rows);
+  if (!r.sorting_columns.empty()) { c.field_struct_list(4, r.sorting_columns); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const SortingColumn& s)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_int(1, s.column_idx);
+  c.field_bool(2, s.descending);
+  c.field_bool(3, s.nulls_first);
   return c.value();
 }
 
@@ -117,6 +127,68 @@ size_t CompactProtocolWriter::write(const ColumnChunkMetaData& s)
   if (s.index_page_offset != 0) { c.field_int(10, s.index_page_offset); }
   if (s.dictionary_page_offset != 0) { c.field_int(11, s.dictionary_page_offset); }
   if (s.statistics_blob.size() != 0) { c.field_struct_blob(12, s.statistics_blob); }
+  if (s.bloom_filter_offset != 0) {
+    c.field_int(14, s.bloom_filter_offset);
+    c.field_int(15, s.bloom_filter_length);
+  }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterAlgorithm& a)
+{
+  CompactProtocolFieldWriter c(*this);
+  if (a.isset.BLOCK) { c.field_empty_struct(1); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterHash& h)
+{
+  CompactProtocolFieldWriter c(*this);
+  if (h.isset.XXHASH) { c.field_empty_struct(1); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterCompression& comp)
+{
+  CompactProtocolFieldWriter c(*this);
+  if (comp.isset.UNCOMPRESSED) { c.field_empty_struct(1); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterHeader& b)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_int(1, b.num_bytes);
+  c.field_struct(2, b.algorithm);
+  c.field_struct(3, b.hash);
+  c.field_struct(4, b.compression);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const PageLocation& p)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_int(1, p.offset);
+  c.field_int(2, p.compressed_page_size);
+  c.field_int(3, p.first_row_index);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const OffsetIndex& o)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_struct_list(1, o.page_locations);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const ColumnIndex& ci)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_bool_list(1, ci.null_pages);
+  c.field_binary_list(2, ci.min_values);
+  c.field_binary_list(3, ci.max_values);
+  c.field_int(4, static_cast<int32_t>(ci.boundary_order));
+  if (ci.null_counts.size() != 0) { c.field_int64_list(5, ci.null_counts); }
   return c.value();
 }
 
@@ -156,6 +228,13 @@ void CompactProtocolFieldWriter::put_field_header(int f, int cur, int t)
   }
 }
 
+inline void CompactProtocolFieldWriter::field_bool(int field, bool val)
+{
+  // the value of a boolean field is encoded in the type of its header
+  put_field_header(field, current_field_value, val ? ST_FLD_TRUE : ST_FLD_FALSE);
+  current_field_value = field;
+}
+
 inline void CompactProtocolFieldWriter::field_int(int field, int32_t val)
 {
   put_field_header(field, current_field_value, ST_FLD_I32);
@@ -217,6 +296,13 @@ inline void CompactProtocolFieldWriter::field_struct_blob(int field,
   current_field_value = field;
 }
 
+inline void CompactProtocolFieldWriter::field_empty_struct(int field)
+{
+  put_field_header(field, current_field_value, ST_FLD_STRUCT);
+  put_byte(0);
+  current_field_value = field;
+}
+
 inline void CompactProtocolFieldWriter::field_string(int field, const std::string& val)
 {
   put_field_header(field, current_field_value, ST_FLD_BINARY);
@@ -240,6 +326,42 @@ inline void CompactProtocolFieldWriter::field_string_list(int field,
   current_field_value = field;
 }
 
+inline void CompactProtocolFieldWriter::field_binary_list(
+  int field, const std::vector<std::vector<uint8_t>>& val)
+{
+  put_field_header(field, current_field_value, ST_FLD_LIST);
+  put_byte((uint8_t)((std::min(val.size(), (size_t)0xfu) << 4) | ST_FLD_BINARY));
+  if (val.size() >= 0xf) put_uint(val.size());
+  for (auto& v : val) {
+    put_uint(v.size());
+    put_byte(v.data(), (uint32_t)v.size());
+  }
+  current_field_value = field;
+}
+
+inline void CompactProtocolFieldWriter::field_bool_list(int field, const std::vector<bool>& val)
+{
+  put_field_header(field, current_field_value, ST_FLD_LIST);
+  put_byte((uint8_t)((std::min(val.size(), (size_t)0xfu) << 4) | ST_FLD_TRUE));
+  if (val.size() >= 0xf) put_uint(val.size());
+  for (bool v : val) {
+    // list elements are encoded as one byte each, 1 meaning true and 2 false
+    put_byte(v ? ST_FLD_TRUE : ST_FLD_FALSE);
+  }
+  current_field_value = field;
+}
+
+inline void CompactProtocolFieldWriter::field_int64_list(int field, const std::vector<int64_t>& val)
+{
+  put_field_header(field, current_field_value, ST_FLD_LIST);
+  put_byte((uint8_t)((std::min(val.size(), (size_t)0xfu) << 4) | ST_FLD_I64));
+  if (val.size() >= 0xf) put_uint(val.size());
+  for (auto v : val) {
+    put_int(v);
+  }
+  current_field_value = field;
+}
+
 inline int CompactProtocolFieldWriter::current_field() { return current_field_value; }
 
 inline void CompactProtocolFieldWriter::set_current_field(const int& field)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -41,9 +41,17 @@ class CompactProtocolWriter {
   size_t write(const FileMetaData&);
   size_t write(const SchemaElement&);
   size_t write(const RowGroup&);
+  size_t write(const SortingColumn&);
   size_t write(const KeyValue&);
   size_t write(const ColumnChunk&);
   size_t write(const ColumnChunkMetaData&);
+  size_t write(const BloomFilterAlgorithm&);
+  size_t write(const BloomFilterHash&);
+  size_t write(const BloomFilterCompression&);
+  size_t write(const BloomFilterHeader&);
+  size_t write(const PageLocation&);
+  size_t write(const OffsetIndex&);
+  size_t write(const ColumnIndex&);
 
  protected:
   std::vector<uint8_t>& m_buf;
@@ -71,6 +79,8 @@ class CompactProtocolFieldWriter {
 
   void put_field_header(int f, int cur, int t);
 
+  inline void field_bool(int field, bool val);
+
   inline void field_int(int field, int32_t val);
 
   inline void field_int(int field, int64_t val);
@@ -88,10 +98,18 @@ class CompactProtocolFieldWriter {
 
   inline void field_struct_blob(int field, const std::vector<uint8_t>& val);
 
+  inline void field_empty_struct(int field);
+
   inline void field_string(int field, const std::string& val);
 
   inline void field_string_list(int field, const std::vector<std::string>& val);
 
+  inline void field_binary_list(int field, const std::vector<std::vector<uint8_t>>& val);
+
+  inline void field_bool_list(int field, const std::vector<bool>& val);
+
+  inline void field_int64_list(int field, const std::vector<int64_t>& val);
+
   inline int current_field();
 
   inline void set_current_field(const int& field);
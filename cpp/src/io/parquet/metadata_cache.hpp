@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file metadata_cache.hpp
+ * @brief Process-wide cache of the metadata of Parquet files, reused across reads
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace parquet {
+
+/**
+ * @brief Identity of a version of a file
+ */
+struct file_identity {
+  std::string path;
+  size_t size      = 0;
+  int64_t mtime_ns = 0;  // Modification time, in nanoseconds since the epoch
+
+  bool operator<(file_identity const& other) const
+  {
+    return std::tie(path, size, mtime_ns) < std::tie(other.path, other.size, other.mtime_ns);
+  }
+};
+
+/**
+ * @brief Returns the identity of the file at `path`, or `std::nullopt` if it cannot be determined
+ */
+std::optional<file_identity> get_file_identity(std::string const& path);
+
+/**
+ * @brief Location of the data of a column chunk, as read from its file
+ */
+struct chunk_location {
+  size_t io_offset  = 0;  // Offset of the data in the file
+  size_t io_size    = 0;  // Size of the data read
+  size_t gap_offset = 0;  // Offset of the skipped bytes within the data
+  size_t gap_size   = 0;  // Number of skipped bytes
+  size_t num_values = 0;  // Number of values decoded from the data
+
+  bool operator<(chunk_location const& other) const
+  {
+    return std::tie(io_offset, io_size, gap_offset, gap_size, num_values) <
+           std::tie(
+             other.io_offset, other.io_size, other.gap_offset, other.gap_size, other.num_values);
+  }
+};
+
+/**
+ * @brief Key of a cache entry: the footer of a file, or the page headers of one of its chunks
+ */
+struct metadata_cache_key {
+  file_identity file;
+  std::optional<chunk_location> chunk;  // Unset for the footer
+
+  bool operator<(metadata_cache_key const& other) const
+  {
+    return std::tie(file, chunk) < std::tie(other.file, other.chunk);
+  }
+};
+
+/**
+ * @brief Thread-safe least recently used cache, bounded by the total size of its values
+ *
+ * The size of each value is given on insertion. The capacity is zero until set, in which case
+ * nothing is cached.
+ *
+ * @tparam Key Key type, ordered by `operator<`
+ * @tparam Value Value type, returned by copy, hence usually a shared pointer
+ */
+template <typename Key, typename Value>
+class lru_cache {
+ public:
+  /**
+   * @brief Sets the maximum total size of the values, evicting values as needed
+   */
+  void set_capacity(size_t capacity)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _capacity = capacity;
+    evict();
+  }
+
+  /**
+   * @brief Returns the maximum total size of the values
+   */
+  [[nodiscard]] size_t capacity() const
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _capacity;
+  }
+
+  /**
+   * @brief Returns the value of `key` and marks it as the most recently used, if it is cached
+   */
+  std::optional<Value> find(Key const& key)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto const it = _index.find(key);
+    if (it == _index.end()) { return std::nullopt; }
+    _entries.splice(_entries.begin(), _entries, it->second);
+    return it->second->value;
+  }
+
+  /**
+   * @brief Inserts or replaces the value of `key`, evicting the least recently used values until
+   * the total size fits the capacity
+   *
+   * Values larger than the capacity are not cached.
+   */
+  void insert(Key const& key, Value value, size_t size)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (size > _capacity) { return; }
+    if (auto const it = _index.find(key); it != _index.end()) {
+      _size -= it->second->size;
+      _entries.erase(it->second);
+      _index.erase(it);
+    }
+    _entries.push_front(entry{key, std::move(value), size});
+    _index.emplace(key, _entries.begin());
+    _size += size;
+    evict();
+  }
+
+ private:
+  struct entry {
+    Key key;
+    Value value;
+    size_t size;
+  };
+
+  void evict()
+  {
+    while (_size > _capacity) {
+      auto const& last = _entries.back();
+      _size -= last.size;
+      _index.erase(last.key);
+      _entries.pop_back();
+    }
+  }
+
+  mutable std::mutex _mutex;
+  size_t _capacity = 0;
+  size_t _size     = 0;
+  std::list<entry> _entries;  // Most recently used first
+  std::map<Key, typename std::list<entry>::iterator> _index;
+};
+
+}  // namespace parquet
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
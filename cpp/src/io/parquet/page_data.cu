@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -194,10 +194,16 @@ __device__ uint32_t InitLevelSection(page_state_s* s,
     s->initial_rle_value[lvl] = 0;
     s->lvl_start[lvl]         = cur;
   } else if (encoding == Encoding::RLE) {
-    if (cur + 4 < end) {
+    // the level sizes of data pages v2 are stored in the page header instead of the page data
+    bool const is_v2 = (s->page.flags & PAGEINFO_FLAGS_V2) != 0;
+    if (cur + (is_v2 ? 0 : 4) < end) {
       uint32_t run;
-      len = 4 + (cur[0]) + (cur[1] << 8) + (cur[2] << 16) + (cur[3] << 24);
-      cur += 4;
+      if (is_v2) {
+        len = s->page.lvl_bytes[lvl];
+      } else {
+        len = 4 + (cur[0]) + (cur[1] << 8) + (cur[2] << 16) + (cur[3] << 24);
+        cur += 4;
+      }
       run                     = get_vlq32(cur, end);
       s->initial_rle_run[lvl] = run;
       if (!(run & 1)) {
@@ -509,13 +515,20 @@ __device__ void gpuInitStringDescriptors(volatile page_state_s* s, int target_po
  *
  * @param[in,out] s Page state input/output
  * @param[in] src_pos Source position
- * @param[in] dstv Pointer to row output data (string descriptor or 32-bit hash)
+ * @param[in] dstv Pointer to row output data (string descriptor, 32-bit hash or dictionary index)
  */
 inline __device__ void gpuOutputString(volatile page_state_s* s, int src_pos, void* dstv)
 {
   const char* ptr = nullptr;
   size_t len      = 0;
 
+  if (s->col.output_dict_index) {
+    // Output the index of the value in the chunk's dictionary
+    *static_cast<uint32_t*>(dstv) =
+      (s->dict_bits > 0) ? s->dict_idx[src_pos & (non_zero_buffer_size - 1)] : 0;
+    return;
+  }
+
   if (s->dict_base) {
     // String dictionary
     uint32_t dict_pos = (s->dict_bits > 0) ? s->dict_idx[src_pos & (non_zero_buffer_size - 1)] *
@@ -954,8 +967,8 @@ static __device__ bool setupLocalPageInfo(page_state_s* const s,
       } else if (data_type == INT32) {
         if (dtype_len_out == 1) s->dtype_len = 1;  // INT8 output
         if (dtype_len_out == 2) s->dtype_len = 2;  // INT16 output
-      } else if (data_type == BYTE_ARRAY && dtype_len_out == 4) {
-        s->dtype_len = 4;  // HASH32 output
+      } else if (data_type == BYTE_ARRAY && (dtype_len_out == 4 || s->col.output_dict_index)) {
+        s->dtype_len = 4;  // HASH32 or dictionary index output
       } else if (data_type == INT96) {
         s->dtype_len = 8;  // Convert to 64-bit timestamp
       }
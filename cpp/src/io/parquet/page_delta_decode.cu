@@ -0,0 +1,503 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file page_delta_decode.cu
+ * @brief Rewrites delta-encoded and byte-stream-split Parquet data pages with the plain encoding
+ *
+ * Each page is processed by a single warp. The bit-packed deltas are unpacked 32 at a time from
+ * shared memory and turned into values with a warp-wide prefix sum, and the byte streams of
+ * BYTE_STREAM_SPLIT pages are interleaved back, so the regular page decoder only ever sees
+ * plain-encoded values.
+ */
+
+#include "parquet_gpu.hpp"
+#include <io/utilities/block_utils.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace io {
+namespace parquet {
+namespace gpu {
+namespace {
+
+constexpr int warps_per_block  = 4;
+constexpr int delta_block_size = warps_per_block * 32;
+// 32 bit-packed values of up to 64 bits each, plus padding for the unaligned reads of the last one
+constexpr int unpack_buffer_size = 32 * 8 + 16;
+
+inline __device__ uint64_t get_uleb128(uint8_t const*& cur, uint8_t const* end)
+{
+  uint64_t v = 0;
+  for (int shift = 0; cur < end && shift < 64; shift += 7) {
+    auto const c = *cur++;
+    v |= static_cast<uint64_t>(c & 0x7f) << shift;
+    if (!(c & 0x80)) { break; }
+  }
+  return v;
+}
+
+inline __device__ uint64_t get_zigzag128(uint8_t const*& cur, uint8_t const* end)
+{
+  auto const u = get_uleb128(cur, end);
+  return (u >> 1) ^ (0 - (u & 1));
+}
+
+/**
+ * @brief Decoder for a DELTA_BINARY_PACKED stream, shared by all the lanes of a warp
+ *
+ * Every lane holds the same state. Values are returned in groups of up to 32, one per lane:
+ * the first value of the stream, stored in its header, is returned on its own, then each group
+ * covers 32 values of a miniblock. Arithmetic wraps around, as required by the encoding.
+ */
+struct delta_binary_decoder {
+  uint8_t const* cur;         // start of the current miniblock, or of the next block header
+  uint8_t const* end;         // end of the page
+  uint32_t values_per_mb;     // number of values in a miniblock, a multiple of 32
+  uint32_t num_mb;            // number of miniblocks in a block
+  uint32_t remaining;         // number of values not decoded yet, including the first one
+  uint32_t mb_idx;            // current miniblock of the block, `num_mb` before a block header
+  uint32_t mb_pos;            // number of values of the current miniblock already decoded
+  uint8_t const* bit_widths;  // bit widths of the miniblocks of the current block
+  uint64_t min_delta;         // minimum delta of the current block
+  uint64_t last_value;        // last value decoded
+  bool first;                 // whether the first value has not been returned yet
+  bool error;                 // whether the stream is malformed
+
+  /**
+   * @brief Parses the header of a stream
+   */
+  __device__ void init(uint8_t const* start, uint8_t const* page_end)
+  {
+    cur                   = start;
+    end                   = page_end;
+    auto const block_size = get_uleb128(cur, end);
+    auto const mb_count   = get_uleb128(cur, end);
+    auto const num_values = get_uleb128(cur, end);
+    last_value            = get_zigzag128(cur, end);
+    error = cur > end || block_size == 0 || block_size > (1 << 20) || mb_count == 0 ||
+            block_size % (mb_count * 32) != 0 || num_values > 0x7fff'ffff;
+    num_mb        = error ? 0 : mb_count;
+    values_per_mb = error ? 0 : block_size / mb_count;
+    remaining     = error ? 0 : num_values;
+    mb_idx        = num_mb;
+    mb_pos        = 0;
+    bit_widths    = nullptr;
+    min_delta     = 0;
+    first         = true;
+  }
+
+  /**
+   * @brief Returns the bit width of the current miniblock, parsing the next block header first
+   * if the previous block has been fully decoded
+   */
+  __device__ uint32_t start_miniblock()
+  {
+    if (mb_idx == num_mb) {
+      min_delta  = get_zigzag128(cur, end);
+      bit_widths = cur;
+      cur += num_mb;
+      mb_idx = 0;
+      mb_pos = 0;
+      if (cur > end) {
+        error     = true;
+        remaining = 0;
+        return 0;
+      }
+    }
+    uint32_t const bit_width = bit_widths[mb_idx];
+    if (bit_width > 64) {
+      error     = true;
+      remaining = 0;
+    }
+    return bit_width;
+  }
+
+  /**
+   * @brief Moves past the current miniblock
+   */
+  __device__ void end_miniblock(uint32_t bit_width)
+  {
+    cur += (values_per_mb / 8) * bit_width;
+    mb_idx++;
+    mb_pos = 0;
+  }
+
+  /**
+   * @brief Decodes the next group of values
+   *
+   * @param lane Lane of the calling thread
+   * @param scratch Per-warp shared memory buffer of `unpack_buffer_size` bytes
+   * @param value Set to the value of the group at index `lane`, if any
+   *
+   * @return Number of values in the group, zero at the end of the stream
+   */
+  __device__ uint32_t decode(uint32_t lane, uint8_t* scratch, uint64_t& value)
+  {
+    if (remaining == 0) { return 0; }
+    if (first) {
+      first = false;
+      remaining--;
+      value = last_value;
+      return 1;
+    }
+    auto const bit_width = start_miniblock();
+    if (error) { return 0; }
+    auto const count = min(remaining, 32u);
+
+    // 32 values at `bit_width` bits each take `4 * bit_width` bytes
+    auto const src = cur + (mb_pos / 8) * bit_width;
+    for (uint32_t i = lane; i < 4 * bit_width + 9; i += 32) {
+      scratch[i] = (src + i < end) ? src[i] : 0;
+    }
+    syncwarp();
+    uint64_t delta = 0;
+    if (bit_width != 0) {
+      auto const bit_pos = lane * bit_width;
+      auto const bytes   = scratch + (bit_pos >> 3);
+      auto const shift   = bit_pos & 7;
+      uint64_t bits      = 0;
+      for (int i = 0; i < 8; i++) {
+        bits |= static_cast<uint64_t>(bytes[i]) << (i * 8);
+      }
+      bits >>= shift;
+      if (shift + bit_width > 64) { bits |= static_cast<uint64_t>(bytes[8]) << (64 - shift); }
+      delta = (bit_width < 64) ? bits & ((1ull << bit_width) - 1) : bits;
+    }
+    syncwarp();
+
+    delta      = (lane < count) ? delta + min_delta : 0;
+    value      = last_value + WarpReducePos32(delta, lane);
+    last_value = shuffle(value, count - 1);
+    remaining -= count;
+    mb_pos += 32;
+    if (mb_pos == values_per_mb) { end_miniblock(bit_width); }
+    return count;
+  }
+
+  /**
+   * @brief Returns the end of the stream, skipping over the values not decoded yet
+   */
+  __device__ uint8_t const* find_end()
+  {
+    if (first && remaining != 0) {
+      first = false;
+      remaining--;
+    }
+    // the last miniblock holding values is padded to its full size, the following ones are empty
+    while (remaining != 0 && !error) {
+      auto const bit_width = start_miniblock();
+      if (error) { break; }
+      remaining -= min(remaining, values_per_mb - mb_pos);
+      end_miniblock(bit_width);
+    }
+    if (mb_pos != 0 && !error) { end_miniblock(bit_widths[mb_idx]); }
+    return cur < end ? cur : end;
+  }
+};
+
+/**
+ * @brief Returns the size of the repetition and definition levels at the start of a data page
+ */
+__device__ uint32_t level_size(PageInfo const& page, ColumnChunkDesc const& chunk)
+{
+  if (page.flags & PAGEINFO_FLAGS_V2) {
+    return page.lvl_bytes[level_type::DEFINITION] + page.lvl_bytes[level_type::REPETITION];
+  }
+  uint8_t const* const begin = page.page_data;
+  uint8_t const* const end   = begin + page.uncompressed_page_size;
+  uint8_t const* cur         = begin;
+  for (auto const lvl : {level_type::REPETITION, level_type::DEFINITION}) {
+    auto const level_bits = chunk.level_bits[lvl];
+    auto const encoding   = lvl == level_type::DEFINITION ? page.definition_level_encoding
+                                                          : page.repetition_level_encoding;
+    if (level_bits == 0) { continue; }
+    if (encoding == Encoding::RLE) {
+      if (cur + 4 > end) { return end - begin; }
+      cur += 4 + (cur[0] | (cur[1] << 8) | (cur[2] << 16) | (static_cast<uint32_t>(cur[3]) << 24));
+    } else if (encoding == Encoding::BIT_PACKED) {
+      cur += (page.num_input_values * level_bits + 7) >> 3;
+    }
+  }
+  return static_cast<uint32_t>((cur < end ? cur : end) - begin);
+}
+
+/**
+ * @brief Returns the sum of the values of a stream over all the lanes of a warp
+ */
+__device__ uint64_t sum_values(delta_binary_decoder& decoder, uint32_t lane, uint8_t* scratch)
+{
+  uint64_t sum = 0;
+  uint64_t value;
+  for (uint32_t count; (count = decoder.decode(lane, scratch, value)) != 0;) {
+    if (lane < count) { sum += value; }
+  }
+  return shuffle(WarpReducePos32(sum, lane), 31);
+}
+
+/**
+ * @brief Writes a 32-bit or 64-bit little-endian value to unaligned memory
+ */
+inline __device__ void store_bytes(uint8_t* dst, uint64_t value, int num_bytes)
+{
+  for (int i = 0; i < num_bytes; i++) {
+    dst[i] = static_cast<uint8_t>(value >> (i * 8));
+  }
+}
+
+/**
+ * @brief Writes a plain-encoded byte array, skipping values that do not fit the input or output
+ */
+inline __device__ void store_string(
+  uint8_t* dst, uint8_t const* dst_end, uint8_t const* src, uint8_t const* src_end, size_t len)
+{
+  if (dst + 4 + len > dst_end || src + len > src_end) { return; }
+  store_bytes(dst, len, 4);
+  memcpy(dst + 4, src, len);
+}
+
+/**
+ * @brief Kernel for computing the size of delta-encoded pages once rewritten with the plain
+ * encoding, one warp per page
+ *
+ * @param[in] pages All pages to be decoded
+ * @param[in] chunks All chunks to be decoded
+ * @param[out] page_sizes Size of each rewritten page, zero for other pages
+ * @param[in] num_pages Number of pages
+ */
+__global__ void __launch_bounds__(delta_block_size)
+  gpuComputeDeltaPageSizes(PageInfo const* pages,
+                           ColumnChunkDesc const* chunks,
+                           size_t* page_sizes,
+                           size_t num_pages)
+{
+  __shared__ __align__(8) uint8_t scratch_buffer[warps_per_block][unpack_buffer_size];
+
+  uint32_t const lane   = threadIdx.x & 0x1f;
+  auto const warp       = threadIdx.x >> 5;
+  size_t const page_idx = blockIdx.x * warps_per_block + warp;
+  if (page_idx >= num_pages) { return; }
+  auto const& page = pages[page_idx];
+  auto scratch     = scratch_buffer[warp];
+
+  size_t size = 0;
+  if (!(page.flags & PAGEINFO_FLAGS_DICTIONARY) && is_rewritten_as_plain(page)) {
+    auto const& chunk      = chunks[page.chunk_idx];
+    auto const type        = chunk.data_type & 7;
+    auto const type_length = chunk.data_type >> 3;
+    auto const lvl_size    = level_size(page, chunk);
+    auto const end         = page.page_data + page.uncompressed_page_size;
+    delta_binary_decoder decoder;
+    decoder.init(page.page_data + lvl_size, end);
+    size_t const num_values = decoder.remaining;
+    switch (page.encoding) {
+      case Encoding::BYTE_STREAM_SPLIT:
+        // the streams hold the bytes of the plain-encoded values, so the page keeps its size
+        if (type == FLOAT || type == DOUBLE) { size = page.uncompressed_page_size; }
+        break;
+      case Encoding::DELTA_BINARY_PACKED:
+        if (!decoder.error && (type == INT32 || type == INT64)) {
+          size = lvl_size + num_values * (type == INT32 ? 4 : 8);
+        }
+        break;
+      case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+        if (type == BYTE_ARRAY) {
+          // the concatenated values follow the lengths and extend to the end of the page
+          auto const data = decoder.find_end();
+          if (!decoder.error) { size = lvl_size + num_values * 4 + (end - data); }
+        }
+        break;
+      case Encoding::DELTA_BYTE_ARRAY:
+        if (type == BYTE_ARRAY || type == FIXED_LEN_BYTE_ARRAY) {
+          // prefix lengths, then suffixes encoded as DELTA_LENGTH_BYTE_ARRAY
+          auto const prefix_bytes = sum_values(decoder, lane, scratch);
+          auto const prefix_error = decoder.error;
+          auto const suffixes     = decoder.find_end();
+          decoder.init(suffixes, end);
+          size_t const num_suffixes = decoder.remaining;
+          auto const suffix_bytes   = end - decoder.find_end();
+          if (!prefix_error && !decoder.error && num_suffixes == num_values) {
+            size = (type == FIXED_LEN_BYTE_ARRAY)
+                     ? lvl_size + num_values * type_length
+                     : lvl_size + num_values * 4 + prefix_bytes + suffix_bytes;
+          }
+        }
+        break;
+      default: break;
+    }
+  }
+  if (lane == 0) { page_sizes[page_idx] = size; }
+}
+
+/**
+ * @brief Kernel for rewriting delta-encoded pages with the plain encoding, one warp per page
+ *
+ * @param[in,out] pages All pages to be decoded
+ * @param[in] chunks All chunks to be decoded
+ * @param[in] page_offsets Offset of each rewritten page in `page_data`, followed by the total size
+ * @param[out] page_data Rewritten pages
+ * @param[in] num_pages Number of pages
+ */
+__global__ void __launch_bounds__(delta_block_size)
+  gpuDecodeDeltaPages(PageInfo* pages,
+                      ColumnChunkDesc const* chunks,
+                      size_t const* page_offsets,
+                      uint8_t* page_data,
+                      size_t num_pages)
+{
+  __shared__ __align__(8) uint8_t scratch_buffer[warps_per_block][unpack_buffer_size];
+
+  uint32_t const lane   = threadIdx.x & 0x1f;
+  auto const warp       = threadIdx.x >> 5;
+  size_t const page_idx = blockIdx.x * warps_per_block + warp;
+  if (page_idx >= num_pages) { return; }
+  auto const size = page_offsets[page_idx + 1] - page_offsets[page_idx];
+  if (size == 0) { return; }
+  auto& page      = pages[page_idx];
+  auto scratch    = scratch_buffer[warp];
+  auto const type = chunks[page.chunk_idx].data_type & 7;
+
+  auto const encoding = page.encoding;
+  auto const lvl_size = level_size(page, chunks[page.chunk_idx]);
+  auto const src      = page.page_data;
+  auto const end      = src + page.uncompressed_page_size;
+  auto const out      = page_data + page_offsets[page_idx];
+  auto const out_end  = out + size;
+
+  for (uint32_t i = lane; i < lvl_size; i += 32) {
+    out[i] = src[i];
+  }
+  auto dst = out + lvl_size;
+
+  delta_binary_decoder decoder;
+  decoder.init(src + lvl_size, end);
+  uint64_t value;
+  if (encoding == Encoding::BYTE_STREAM_SPLIT) {
+    // byte `b` of value `i` is byte `i` of stream `b`
+    int const value_size    = (type == FLOAT) ? 4 : 8;
+    auto const data         = src + lvl_size;
+    size_t const num_values = (end - data) / value_size;
+    for (size_t i = lane; i < num_values; i += 32) {
+      for (int b = 0; b < value_size; b++) {
+        dst[i * value_size + b] = data[b * num_values + i];
+      }
+    }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    int const value_size = (type == INT32) ? 4 : 8;
+    for (uint32_t count; (count = decoder.decode(lane, scratch, value)) != 0;) {
+      if (lane < count) { store_bytes(dst + lane * value_size, value, value_size); }
+      dst += count * value_size;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    auto lengths = decoder;
+    auto data    = decoder.find_end();
+    for (uint32_t count; (count = lengths.decode(lane, scratch, value)) != 0;) {
+      // value positions in the input and output are the prefix sums of the lengths
+      size_t const len     = (lane < count) ? min(value, static_cast<uint64_t>(end - src)) : 0;
+      size_t const src_pos = WarpReducePos32(len, lane);
+      size_t const dst_pos = WarpReducePos32((lane < count) ? len + 4 : 0, lane);
+      if (lane < count) {
+        store_string(dst + dst_pos - len - 4, out_end, data + src_pos - len, end, len);
+      }
+      data += shuffle(src_pos, 31);
+      dst += shuffle(dst_pos, 31);
+    }
+  } else {
+    // each value starts with a prefix of the previous one, so values are written one at a time
+    bool const is_flba = (type == FIXED_LEN_BYTE_ARRAY);
+    auto prefixes      = decoder;
+    delta_binary_decoder suffixes;
+    suffixes.init(decoder.find_end(), end);
+    auto suffix_data    = suffixes;
+    auto data           = suffix_data.find_end();
+    uint8_t const* prev = nullptr;
+    size_t prev_len     = 0;
+    uint64_t suffix_len = 0;
+    for (uint32_t count; (count = prefixes.decode(lane, scratch, value)) != 0;) {
+      // both streams hold the same number of values, so their groups match
+      suffixes.decode(lane, scratch, suffix_len);
+      for (uint32_t i = 0; i < count; i++) {
+        size_t const prefix = min(static_cast<size_t>(shuffle(value, i)), prev_len);
+        size_t const suffix =
+          min(static_cast<size_t>(shuffle(suffix_len, i)), static_cast<size_t>(end - data));
+        size_t const len = prefix + suffix;
+        auto const val   = dst + (is_flba ? 0 : 4);
+        if (val + len > out_end) {
+          prefixes.remaining = 0;
+          break;
+        }
+        if (!is_flba && lane == 0) { store_bytes(dst, len, 4); }
+        for (size_t j = lane; j < prefix; j += 32) {
+          val[j] = prev[j];
+        }
+        for (size_t j = lane; j < suffix; j += 32) {
+          val[prefix + j] = data[j];
+        }
+        syncwarp();
+        prev     = val;
+        prev_len = len;
+        data += suffix;
+        dst = val + len;
+      }
+    }
+  }
+
+  syncwarp();
+  if (lane == 0) {
+    page.page_data              = out;
+    page.uncompressed_page_size = size;
+    page.encoding               = Encoding::PLAIN;
+  }
+}
+
+}  // namespace
+
+/**
+ * @copydoc cudf::io::parquet::gpu::ComputeDeltaPageSizes
+ */
+void ComputeDeltaPageSizes(hostdevice_vector<PageInfo>& pages,
+                           hostdevice_vector<ColumnChunkDesc> const& chunks,
+                           device_span<size_t> page_sizes,
+                           rmm::cuda_stream_view stream)
+{
+  dim3 dim_block(delta_block_size, 1);
+  dim3 dim_grid((pages.size() + warps_per_block - 1) / warps_per_block, 1);  // 1 warp per page
+
+  gpuComputeDeltaPageSizes<<<dim_grid, dim_block, 0, stream.value()>>>(
+    pages.device_ptr(), chunks.device_ptr(), page_sizes.data(), pages.size());
+}
+
+/**
+ * @copydoc cudf::io::parquet::gpu::DecodeDeltaPages
+ */
+void DecodeDeltaPages(hostdevice_vector<PageInfo>& pages,
+                      hostdevice_vector<ColumnChunkDesc> const& chunks,
+                      device_span<size_t const> page_offsets,
+                      uint8_t* page_data,
+                      rmm::cuda_stream_view stream)
+{
+  dim3 dim_block(delta_block_size, 1);
+  dim3 dim_grid((pages.size() + warps_per_block - 1) / warps_per_block, 1);  // 1 warp per page
+
+  gpuDecodeDeltaPages<<<dim_grid, dim_block, 0, stream.value()>>>(
+    pages.device_ptr(), chunks.device_ptr(), page_offsets.data(), page_data, pages.size());
+}
+
+}  // namespace gpu
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
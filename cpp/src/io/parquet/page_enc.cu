@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -31,6 +31,8 @@
 #include <thrust/gather.h>
 #include <thrust/iterator/discard_iterator.h>
 
+#include <limits>
+
 namespace cudf {
 namespace io {
 namespace parquet {
@@ -90,6 +92,18 @@ uint32_t __device__ physical_type_len(Type physical_type, type_id id)
   }
 }
 
+/**
+ * @brief Returns the worst-case size of a DELTA_BINARY_PACKED stream of `num_values` values, in
+ * addition to `value_size` bytes per value
+ *
+ * Includes the stream header, the header of each block of 128 values (minimum delta and miniblock
+ * bit widths) and the padding of the last miniblock.
+ */
+inline __device__ uint32_t max_delta_overhead(uint32_t num_values, uint32_t value_size)
+{
+  return 25 + ((num_values + 127) >> 7) * 14 + 31 * value_size;
+}
+
 /**
  * @brief Return a 12-bit hash from a byte sequence
  */
@@ -229,7 +243,9 @@ __global__ void __launch_bounds__(128)
                statistics_merge_group* page_grstats,
                statistics_merge_group* chunk_grstats,
                size_t max_page_comp_data_size,
-               int32_t num_columns)
+               int32_t num_columns,
+               size_t max_page_size_bytes,
+               size_type max_page_size_rows)
 {
   // TODO: All writing seems to be done by thread 0. Could be replaced by thrust foreach
   __shared__ __align__(8) parquet_column_device_view col_g;
@@ -321,15 +337,25 @@ __global__ void __launch_bounds__(128)
         (ck_g.use_dictionary)
           ? frag_g.num_leaf_values * 2  // Assume worst-case of 2-bytes per dictionary index
           : frag_g.fragment_data_size;
-      // TODO (dm): this convoluted logic to limit page size needs refactoring
-      uint32_t max_page_size = (values_in_page * 2 >= ck_g.num_values)   ? 256 * 1024
-                               : (values_in_page * 3 >= ck_g.num_values) ? 384 * 1024
-                                                                         : 512 * 1024;
+      // Pages holding a large part of the chunk's values are kept below the target size, so that
+      // the last pages of a chunk are balanced rather than ending with a small page
+      size_t const max_page_size = (values_in_page * 2 >= ck_g.num_values)
+                                     ? max_page_size_bytes / 2
+                                   : (values_in_page * 3 >= ck_g.num_values)
+                                     ? max_page_size_bytes * 3 / 4
+                                     : max_page_size_bytes;
       if (num_rows >= ck_g.num_rows ||
-          (values_in_page > 0 && (page_size + fragment_data_size > max_page_size))) {
+          (values_in_page > 0 && (page_size + fragment_data_size > max_page_size ||
+                                  rows_in_page + frag_g.num_rows > max_page_size_rows))) {
         if (ck_g.use_dictionary) {
           page_size =
             1 + 5 + ((values_in_page * ck_g.dict_rle_bits + 7) >> 3) + (values_in_page >> 8);
+        } else if (ck_g.encoding == Encoding::DELTA_BINARY_PACKED) {
+          uint32_t const value_size = (col_g.physical_type == INT64) ? 8 : 4;
+          page_size += max_delta_overhead(leaf_values_in_page, value_size);
+        } else if (ck_g.encoding == Encoding::DELTA_BYTE_ARRAY) {
+          // The prefix and suffix lengths replace the 4-byte length of each string
+          page_size += 4 * leaf_values_in_page + 2 * max_delta_overhead(leaf_values_in_page, 4);
         }
         if (!t) {
           page_g.num_fragments = fragments_in_chunk - page_start;
@@ -699,6 +725,375 @@ static __device__ void PlainBoolEncode(page_enc_state_s* s,
   }
 }
 
+constexpr uint32_t delta_block_size     = 128;  //!< Number of deltas in a DELTA_BINARY_PACKED block
+constexpr uint32_t delta_num_miniblocks = 4;    //!< Number of miniblocks of a block, one per warp
+
+/**
+ * @brief State of the DELTA_BINARY_PACKED encoder of a page
+ */
+struct delta_enc_state_s {
+  int64_t values[2 * delta_block_size];       //!< Last value encoded, then the values to encode
+  uint64_t rel_deltas[delta_block_size];      //!< Deltas of the current block minus the minimum
+  size_type indices[delta_block_size + 1];    //!< Last valid leaf value, then those of the batch
+  uint8_t* miniblocks[delta_num_miniblocks];  //!< Output of each miniblock of the current block
+  int64_t warp_min[delta_num_miniblocks];     //!< Minimum delta of each miniblock
+  uint8_t widths[delta_num_miniblocks];       //!< Bit width of each miniblock
+  uint32_t num_values;                        //!< Number of entries in `values`
+  uint32_t num_batch_valid;                   //!< Number of valid values in the last batch
+};
+
+/**
+ * @brief Variable-length encode a 64-bit integer
+ */
+inline __device__ uint8_t* VlqEncode64(uint8_t* p, uint64_t v)
+{
+  while (v > 0x7f) {
+    *p++ = (v | 0x80);
+    v >>= 7;
+  }
+  *p++ = v;
+  return p;
+}
+
+/**
+ * @brief Maps signed integers to unsigned integers with small absolute values to small values
+ */
+inline __device__ uint64_t zigzag_encode(int64_t v)
+{
+  return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+}
+
+/**
+ * @brief Returns whether a leaf value of a data page is valid
+ *
+ * @param[in] s Page encode state
+ * @param[in] value_idx Index of the leaf value in the page
+ */
+inline __device__ bool is_valid_leaf_value(page_enc_state_s const* s, uint32_t value_idx)
+{
+  size_type const val_idx = s->page_start_val + value_idx;
+  return value_idx < s->page.num_leaf_values && val_idx < s->col.leaf_column->size() &&
+         s->col.leaf_column->is_valid(val_idx);
+}
+
+/**
+ * @brief Counts the valid leaf values of a data page
+ */
+template <int block_size>
+static __device__ uint32_t CountValidLeafValues(
+  page_enc_state_s const* s,
+  typename cub::BlockScan<uint32_t, block_size>::TempStorage& temp_storage,
+  uint32_t t)
+{
+  uint32_t num_valid_values = 0;
+  for (uint32_t cur_val_idx = 0; cur_val_idx < s->page.num_leaf_values;
+       cur_val_idx += block_size) {
+    uint32_t pos, num_valid;
+    cub::BlockScan<uint32_t, block_size>(temp_storage)
+      .ExclusiveSum(is_valid_leaf_value(s, cur_val_idx + t), pos, num_valid);
+    num_valid_values += num_valid;
+    __syncthreads();
+  }
+  return num_valid_values;
+}
+
+/**
+ * @brief Valid values of a batch of leaf values of a data page
+ */
+struct leaf_batch_s {
+  bool is_valid;       //!< Whether the value of the calling thread is valid
+  uint32_t pos;        //!< Rank of the value of the calling thread among the valid values
+  uint32_t num_valid;  //!< Number of valid values in the batch
+};
+
+/**
+ * @brief Gathers the leaf column indices of the valid values of a batch of leaf values
+ *
+ * The index of the valid value at rank `pos` is stored in `d->indices[pos + 1]`, so that
+ * `d->indices[pos]` is that of the valid value preceding it in the page, or -1 for the first one.
+ * Callers must synchronize after their last use of `d->indices` before gathering the next batch.
+ *
+ * @param[in] s Page encode state
+ * @param[in,out] d Delta encoder state
+ * @param[in] first_value Index of the first leaf value of the batch in the page
+ * @param[in] t thread id (0..block_size-1)
+ */
+template <int block_size>
+static __device__ leaf_batch_s GatherValidLeafValues(
+  page_enc_state_s const* s,
+  delta_enc_state_s* d,
+  uint32_t first_value,
+  typename cub::BlockScan<uint32_t, block_size>::TempStorage& temp_storage,
+  uint32_t t)
+{
+  if (t == 0 && d->num_batch_valid > 0) { d->indices[0] = d->indices[d->num_batch_valid]; }
+  bool const is_valid = is_valid_leaf_value(s, first_value + t);
+  uint32_t pos, num_valid;
+  cub::BlockScan<uint32_t, block_size>(temp_storage).ExclusiveSum(is_valid, pos, num_valid);
+  __syncthreads();
+  if (is_valid) { d->indices[pos + 1] = s->page_start_val + first_value + t; }
+  if (t == 0) { d->num_batch_valid = num_valid; }
+  __syncthreads();
+  return {is_valid, pos, num_valid};
+}
+
+/**
+ * @brief Encodes a block of DELTA_BINARY_PACKED deltas between the buffered values
+ *
+ * The deltas of each warp make up a miniblock. The last buffered value is kept to compute the next
+ * delta, and the values following it are moved to the start of the buffer.
+ *
+ * @param[in,out] s Page encode state
+ * @param[in,out] d Delta encoder state
+ * @param[in] num_deltas Number of deltas in the block (1..delta_block_size)
+ * @param[in] is_int32 Whether the values are 32-bit integers, whose deltas wrap around in 32 bits
+ * @param[in] t thread id (0..delta_block_size-1)
+ */
+static __device__ void DeltaEncodeBlock(page_enc_state_s* s,
+                                        delta_enc_state_s* d,
+                                        uint32_t num_deltas,
+                                        bool is_int32,
+                                        uint32_t t)
+{
+  uint32_t const lane = t & 0x1f;
+  uint32_t const warp = t >> 5;
+
+  int64_t delta = 0;
+  if (t < num_deltas) {
+    auto const cur  = static_cast<uint64_t>(d->values[t + 1]);
+    auto const prev = static_cast<uint64_t>(d->values[t]);
+    delta           = is_int32 ? static_cast<int32_t>(static_cast<uint32_t>(cur - prev))
+                               : static_cast<int64_t>(cur - prev);
+  }
+  int64_t warp_min = (t < num_deltas) ? delta : std::numeric_limits<int64_t>::max();
+  for (uint32_t i = 1; i < 32; i <<= 1) {
+    warp_min = min(warp_min, shuffle_xor(warp_min, i));
+  }
+  if (lane == 0) { d->warp_min[warp] = warp_min; }
+  __syncthreads();
+  auto const min_delta =
+    min(min(d->warp_min[0], d->warp_min[1]), min(d->warp_min[2], d->warp_min[3]));
+
+  // Deltas are stored relative to the minimum, with the bit width of the largest of the miniblock
+  uint64_t rel_delta = 0;
+  if (t < num_deltas) {
+    rel_delta = is_int32 ? static_cast<uint32_t>(delta) - static_cast<uint32_t>(min_delta)
+                         : static_cast<uint64_t>(delta) - static_cast<uint64_t>(min_delta);
+  }
+  d->rel_deltas[t] = rel_delta;
+  auto const bits  = WarpReduceOr32(rel_delta);
+  if (lane == 0) {
+    // Miniblocks without values are omitted
+    d->widths[warp] = (warp * 32 < num_deltas && bits != 0) ? 64 - __clzll(bits) : 0;
+  }
+  __syncthreads();
+  if (t == 0) {
+    uint8_t* dst = VlqEncode64(s->cur, zigzag_encode(min_delta));
+    uint8_t* mb  = dst + delta_num_miniblocks;
+    for (uint32_t i = 0; i < delta_num_miniblocks; i++) {
+      dst[i]           = d->widths[i];
+      d->miniblocks[i] = mb;
+      mb += 4 * d->widths[i];
+    }
+    s->cur = mb;
+  }
+  __syncthreads();
+
+  // Each lane below the bit width writes one 32-bit word of the bit-packed miniblock
+  uint32_t const width = d->widths[warp];
+  if (lane < width) {
+    uint32_t const word_start = lane * 32;
+    uint32_t word             = 0;
+    for (uint32_t i = word_start / width; i < 32 && i * width < word_start + 32; i++) {
+      auto const v     = d->rel_deltas[warp * 32 + i];
+      auto const shift = static_cast<int>(i * width) - static_cast<int>(word_start);
+      word |= (shift >= 0) ? static_cast<uint32_t>(v << shift) : static_cast<uint32_t>(v >> -shift);
+    }
+    uint8_t* dst = d->miniblocks[warp] + lane * 4;
+    dst[0]       = word;
+    dst[1]       = word >> 8;
+    dst[2]       = word >> 16;
+    dst[3]       = word >> 24;
+  }
+
+  uint32_t const num_remaining = d->num_values - num_deltas;
+  int64_t v                    = 0;
+  if (t < num_remaining) { v = d->values[num_deltas + t]; }
+  __syncthreads();
+  if (t < num_remaining) { d->values[t] = v; }
+  if (t == 0) { d->num_values = num_remaining; }
+  __syncthreads();
+}
+
+/**
+ * @brief Encodes the valid values of a data page as a DELTA_BINARY_PACKED stream at `s->cur`
+ *
+ * @param[in,out] s Page encode state
+ * @param[in,out] d Delta encoder state
+ * @param[in] num_valid_values Number of valid leaf values in the page
+ * @param[in] is_int32 Whether the values are 32-bit integers, whose deltas wrap around in 32 bits
+ * @param[in] value_fn Returns the value to encode given the leaf column index of a valid value and
+ * that of the previous valid value of the page, or -1 for the first one
+ * @param[in] t thread id (0..block_size-1)
+ */
+template <int block_size, typename ValueFn>
+static __device__ void DeltaBinaryPackedEncode(
+  page_enc_state_s* s,
+  delta_enc_state_s* d,
+  uint32_t num_valid_values,
+  bool is_int32,
+  ValueFn value_fn,
+  typename cub::BlockScan<uint32_t, block_size>::TempStorage& temp_storage,
+  uint32_t t)
+{
+  static_assert(block_size == delta_block_size, "One thread per delta of a block is required");
+  if (t == 0) {
+    uint8_t* dst = VlqEncode(s->cur, delta_block_size);
+    dst          = VlqEncode(dst, delta_num_miniblocks);
+    dst          = VlqEncode(dst, num_valid_values);
+    // The header ends with the first value, written once known
+    if (num_valid_values == 0) { dst = VlqEncode64(dst, 0); }
+    s->cur             = dst;
+    d->num_values      = 0;
+    d->num_batch_valid = 0;
+    d->indices[0]      = -1;
+  }
+  __syncthreads();
+  for (uint32_t cur_val_idx = 0; cur_val_idx < s->page.num_leaf_values;
+       cur_val_idx += block_size) {
+    auto const batch      = GatherValidLeafValues<block_size>(s, d, cur_val_idx, temp_storage, t);
+    auto const num_values = d->num_values;
+    if (batch.is_valid) {
+      d->values[num_values + batch.pos] =
+        value_fn(d->indices[batch.pos + 1], d->indices[batch.pos]);
+    }
+    __syncthreads();
+    if (t == 0) {
+      if (num_values == 0 && batch.num_valid > 0) {
+        s->cur = VlqEncode64(s->cur, zigzag_encode(d->values[0]));
+      }
+      d->num_values = num_values + batch.num_valid;
+    }
+    __syncthreads();
+    // Encode a block as soon as the deltas following the last value encoded fill it
+    if (d->num_values > delta_block_size) { DeltaEncodeBlock(s, d, delta_block_size, is_int32, t); }
+  }
+  if (d->num_values > 1) { DeltaEncodeBlock(s, d, d->num_values - 1, is_int32, t); }
+}
+
+/**
+ * @brief DELTA_BYTE_ARRAY encoder for the strings of a data page
+ *
+ * Writes the lengths of the prefixes shared with the previous strings and the lengths of the
+ * remaining suffixes as DELTA_BINARY_PACKED streams, followed by the suffixes.
+ *
+ * @param[in,out] s Page encode state
+ * @param[in,out] d Delta encoder state
+ * @param[in] num_valid_values Number of valid leaf values in the page
+ * @param[in] t thread id (0..block_size-1)
+ */
+template <int block_size>
+static __device__ void DeltaByteArrayEncode(
+  page_enc_state_s* s,
+  delta_enc_state_s* d,
+  uint32_t num_valid_values,
+  typename cub::BlockScan<uint32_t, block_size>::TempStorage& temp_storage,
+  uint32_t t)
+{
+  auto const& col       = *s->col.leaf_column;
+  auto const prefix_len = [&](size_type idx, size_type prev_idx) -> size_type {
+    if (prev_idx < 0) { return 0; }
+    auto const cur        = col.element<string_view>(idx);
+    auto const prev       = col.element<string_view>(prev_idx);
+    auto const max_prefix = min(cur.size_bytes(), prev.size_bytes());
+    size_type len         = 0;
+    while (len < max_prefix && cur.data()[len] == prev.data()[len]) {
+      ++len;
+    }
+    return len;
+  };
+  auto const suffix_len = [&](size_type idx, size_type prev_idx) -> size_type {
+    return col.element<string_view>(idx).size_bytes() - prefix_len(idx, prev_idx);
+  };
+
+  DeltaBinaryPackedEncode<block_size>(
+    s, d, num_valid_values, true, prefix_len, temp_storage, t);
+  DeltaBinaryPackedEncode<block_size>(
+    s, d, num_valid_values, true, suffix_len, temp_storage, t);
+
+  if (t == 0) {
+    d->num_batch_valid = 0;
+    d->indices[0]      = -1;
+  }
+  __syncthreads();
+  for (uint32_t cur_val_idx = 0; cur_val_idx < s->page.num_leaf_values;
+       cur_val_idx += block_size) {
+    auto const batch = GatherValidLeafValues<block_size>(s, d, cur_val_idx, temp_storage, t);
+    uint32_t prefix  = 0;
+    uint32_t suffix  = 0;
+    if (batch.is_valid) {
+      prefix = prefix_len(d->indices[batch.pos + 1], d->indices[batch.pos]);
+      suffix = col.element<string_view>(d->indices[batch.pos + 1]).size_bytes() - prefix;
+    }
+    uint32_t pos, total_len;
+    cub::BlockScan<uint32_t, block_size>(temp_storage).ExclusiveSum(suffix, pos, total_len);
+    if (suffix != 0) {
+      memcpy(s->cur + pos,
+             col.element<string_view>(d->indices[batch.pos + 1]).data() + prefix,
+             suffix);
+    }
+    __syncthreads();
+    if (t == 0) { s->cur += total_len; }
+    __syncthreads();
+  }
+}
+
+/**
+ * @brief BYTE_STREAM_SPLIT encoder for the floating-point values of a data page
+ *
+ * Byte `b` of the valid value at rank `i` is written at position `i` of stream `b`.
+ *
+ * @param[in,out] s Page encode state
+ * @param[in] num_valid_values Number of valid leaf values in the page
+ * @param[in] t thread id (0..block_size-1)
+ */
+template <int block_size>
+static __device__ void ByteStreamSplitEncode(
+  page_enc_state_s* s,
+  uint32_t num_valid_values,
+  typename cub::BlockScan<uint32_t, block_size>::TempStorage& temp_storage,
+  uint32_t t)
+{
+  auto const& col        = *s->col.leaf_column;
+  uint32_t const width   = (s->col.physical_type == FLOAT) ? 4 : 8;
+  uint8_t* const streams = s->cur;
+  uint32_t rank          = 0;
+  for (uint32_t cur_val_idx = 0; cur_val_idx < s->page.num_leaf_values;
+       cur_val_idx += block_size) {
+    bool const is_valid = is_valid_leaf_value(s, cur_val_idx + t);
+    uint32_t pos, num_valid;
+    cub::BlockScan<uint32_t, block_size>(temp_storage).ExclusiveSum(is_valid, pos, num_valid);
+    if (is_valid) {
+      size_type const val_idx = s->page_start_val + cur_val_idx + t;
+      uint64_t bits           = 0;
+      if (width == 4) {
+        auto const v = col.element<float>(val_idx);
+        memcpy(&bits, &v, sizeof(v));
+      } else {
+        auto const v = col.element<double>(val_idx);
+        memcpy(&bits, &v, sizeof(v));
+      }
+      for (uint32_t b = 0; b < width; b++) {
+        streams[b * num_valid_values + rank + pos] = bits >> (b * 8);
+      }
+    }
+    rank += num_valid;
+    __syncthreads();
+  }
+  if (t == 0) { s->cur = streams + width * num_valid_values; }
+  __syncthreads();
+}
+
 /**
  * @brief Determines the difference between the Proleptic Gregorian Calendar epoch (1970-01-01
  * 00:00:00 UTC) and the Julian date epoch (-4713-11-24 12:00:00 UTC).
@@ -740,6 +1135,7 @@ __global__ void __launch_bounds__(128, 8)
                  device_span<gpu_inflate_status_s> comp_stat)
 {
   __shared__ __align__(8) page_enc_state_s state_g;
+  __shared__ __align__(8) delta_enc_state_s delta_g;
   using block_scan = cub::BlockScan<uint32_t, block_size>;
   __shared__ typename block_scan::TempStorage temp_storage;
 
@@ -890,180 +1286,205 @@ __global__ void __launch_bounds__(128, 8)
     s->chunk_start_val = row_to_value_idx(s->ck.start_row, col);
   }
   __syncthreads();
-  for (uint32_t cur_val_idx = 0; cur_val_idx < s->page.num_leaf_values;) {
-    uint32_t nvals = min(s->page.num_leaf_values - cur_val_idx, 128);
-    uint32_t len, pos;
-
-    auto [is_valid, val_idx] = [&]() {
-      uint32_t val_idx;
-      uint32_t is_valid;
-
-      size_type val_idx_in_block = cur_val_idx + t;
-      if (s->page.page_type == PageType::DICTIONARY_PAGE) {
-        val_idx  = val_idx_in_block;
-        is_valid = (val_idx < s->page.num_leaf_values);
-        if (is_valid) { val_idx = s->ck.dict_data[val_idx]; }
-      } else {
-        size_type val_idx_in_leaf_col = s->page_start_val + val_idx_in_block;
-
-        is_valid = (val_idx_in_leaf_col < s->col.leaf_column->size() &&
-                    val_idx_in_block < s->page.num_leaf_values)
-                     ? s->col.leaf_column->is_valid(val_idx_in_leaf_col)
-                     : 0;
-        val_idx =
-          (s->ck.use_dictionary) ? val_idx_in_leaf_col - s->chunk_start_val : val_idx_in_leaf_col;
-      }
-      return std::make_tuple(is_valid, val_idx);
-    }();
-
-    cur_val_idx += nvals;
-    if (dict_bits >= 0) {
-      // Dictionary encoding
-      if (dict_bits > 0) {
-        uint32_t rle_numvals;
-        uint32_t rle_numvals_in_block;
-        block_scan(temp_storage).ExclusiveSum(is_valid, pos, rle_numvals_in_block);
-        rle_numvals = s->rle_numvals;
-        if (is_valid) {
-          uint32_t v;
-          if (physical_type == BOOLEAN) {
-            v = s->col.leaf_column->element<uint8_t>(val_idx);
+  bool const encodes_value_streams = s->page.page_type == PageType::DATA_PAGE &&
+                                     (s->ck.encoding == Encoding::DELTA_BINARY_PACKED ||
+                                      s->ck.encoding == Encoding::DELTA_BYTE_ARRAY ||
+                                      s->ck.encoding == Encoding::BYTE_STREAM_SPLIT);
+  if (encodes_value_streams) {
+    // These encodings store the number of valid values ahead of them
+    auto const num_valid = CountValidLeafValues<block_size>(s, temp_storage, t);
+    switch (s->ck.encoding) {
+      case Encoding::DELTA_BINARY_PACKED:
+        DeltaBinaryPackedEncode<block_size>(
+          s,
+          &delta_g,
+          num_valid,
+          physical_type == INT32,
+          [&](size_type idx, size_type) { return physical_int_value(s->col, idx); },
+          temp_storage,
+          t);
+        break;
+      case Encoding::DELTA_BYTE_ARRAY:
+        DeltaByteArrayEncode<block_size>(s, &delta_g, num_valid, temp_storage, t);
+        break;
+      default: ByteStreamSplitEncode<block_size>(s, num_valid, temp_storage, t); break;
+    }
+  } else {
+    for (uint32_t cur_val_idx = 0; cur_val_idx < s->page.num_leaf_values;) {
+      uint32_t nvals = min(s->page.num_leaf_values - cur_val_idx, 128);
+      uint32_t len, pos;
+
+      auto [is_valid, val_idx] = [&]() {
+        uint32_t val_idx;
+        uint32_t is_valid;
+
+        size_type val_idx_in_block = cur_val_idx + t;
+        if (s->page.page_type == PageType::DICTIONARY_PAGE) {
+          val_idx  = val_idx_in_block;
+          is_valid = (val_idx < s->page.num_leaf_values);
+          if (is_valid) { val_idx = s->ck.dict_data[val_idx]; }
+        } else {
+          size_type val_idx_in_leaf_col = s->page_start_val + val_idx_in_block;
+
+          is_valid = (val_idx_in_leaf_col < s->col.leaf_column->size() &&
+                      val_idx_in_block < s->page.num_leaf_values)
+                       ? s->col.leaf_column->is_valid(val_idx_in_leaf_col)
+                       : 0;
+          val_idx =
+            (s->ck.use_dictionary) ? val_idx_in_leaf_col - s->chunk_start_val : val_idx_in_leaf_col;
+        }
+        return std::make_tuple(is_valid, val_idx);
+      }();
+
+      cur_val_idx += nvals;
+      if (dict_bits >= 0) {
+        // Dictionary encoding
+        if (dict_bits > 0) {
+          uint32_t rle_numvals;
+          uint32_t rle_numvals_in_block;
+          block_scan(temp_storage).ExclusiveSum(is_valid, pos, rle_numvals_in_block);
+          rle_numvals = s->rle_numvals;
+          if (is_valid) {
+            uint32_t v;
+            if (physical_type == BOOLEAN) {
+              v = s->col.leaf_column->element<uint8_t>(val_idx);
+            } else {
+              v = s->ck.dict_index[val_idx];
+            }
+            s->vals[(rle_numvals + pos) & (rle_buffer_size - 1)] = v;
+          }
+          rle_numvals += rle_numvals_in_block;
+          __syncthreads();
+          if ((!enable_bool_rle) && (physical_type == BOOLEAN)) {
+            PlainBoolEncode(s, rle_numvals, (cur_val_idx == s->page.num_leaf_values), t);
           } else {
-            v = s->ck.dict_index[val_idx];
+            RleEncode(s, rle_numvals, dict_bits, (cur_val_idx == s->page.num_leaf_values), t);
           }
-          s->vals[(rle_numvals + pos) & (rle_buffer_size - 1)] = v;
+          __syncthreads();
         }
-        rle_numvals += rle_numvals_in_block;
+        if (t == 0) { s->cur = s->rle_out; }
         __syncthreads();
-        if ((!enable_bool_rle) && (physical_type == BOOLEAN)) {
-          PlainBoolEncode(s, rle_numvals, (cur_val_idx == s->page.num_leaf_values), t);
+      } else {
+        // Non-dictionary encoding
+        uint8_t* dst = s->cur;
+
+        if (is_valid) {
+          len = dtype_len_out;
+          if (physical_type == BYTE_ARRAY) {
+            len += s->col.leaf_column->element<string_view>(val_idx).size_bytes();
+          }
         } else {
-          RleEncode(s, rle_numvals, dict_bits, (cur_val_idx == s->page.num_leaf_values), t);
+          len = 0;
         }
+        uint32_t total_len = 0;
+        block_scan(temp_storage).ExclusiveSum(len, pos, total_len);
         __syncthreads();
-      }
-      if (t == 0) { s->cur = s->rle_out; }
-      __syncthreads();
-    } else {
-      // Non-dictionary encoding
-      uint8_t* dst = s->cur;
-
-      if (is_valid) {
-        len = dtype_len_out;
-        if (physical_type == BYTE_ARRAY) {
-          len += s->col.leaf_column->element<string_view>(val_idx).size_bytes();
-        }
-      } else {
-        len = 0;
-      }
-      uint32_t total_len = 0;
-      block_scan(temp_storage).ExclusiveSum(len, pos, total_len);
-      __syncthreads();
-      if (t == 0) { s->cur = dst + total_len; }
-      if (is_valid) {
-        switch (physical_type) {
-          case INT32:
-          case FLOAT: {
-            int32_t v;
-            if (dtype_len_in == 4)
-              v = s->col.leaf_column->element<int32_t>(val_idx);
-            else if (dtype_len_in == 2)
-              v = s->col.leaf_column->element<int16_t>(val_idx);
-            else
-              v = s->col.leaf_column->element<int8_t>(val_idx);
-            dst[pos + 0] = v;
-            dst[pos + 1] = v >> 8;
-            dst[pos + 2] = v >> 16;
-            dst[pos + 3] = v >> 24;
-          } break;
-          case INT64: {
-            int64_t v        = s->col.leaf_column->element<int64_t>(val_idx);
-            int32_t ts_scale = s->col.ts_scale;
-            if (ts_scale != 0) {
-              if (ts_scale < 0) {
-                v /= -ts_scale;
-              } else {
-                v *= ts_scale;
+        if (t == 0) { s->cur = dst + total_len; }
+        if (is_valid) {
+          switch (physical_type) {
+            case INT32:
+            case FLOAT: {
+              int32_t v;
+              if (dtype_len_in == 4)
+                v = s->col.leaf_column->element<int32_t>(val_idx);
+              else if (dtype_len_in == 2)
+                v = s->col.leaf_column->element<int16_t>(val_idx);
+              else
+                v = s->col.leaf_column->element<int8_t>(val_idx);
+              dst[pos + 0] = v;
+              dst[pos + 1] = v >> 8;
+              dst[pos + 2] = v >> 16;
+              dst[pos + 3] = v >> 24;
+            } break;
+            case INT64: {
+              int64_t v        = s->col.leaf_column->element<int64_t>(val_idx);
+              int32_t ts_scale = s->col.ts_scale;
+              if (ts_scale != 0) {
+                if (ts_scale < 0) {
+                  v /= -ts_scale;
+                } else {
+                  v *= ts_scale;
+                }
               }
-            }
-            dst[pos + 0] = v;
-            dst[pos + 1] = v >> 8;
-            dst[pos + 2] = v >> 16;
-            dst[pos + 3] = v >> 24;
-            dst[pos + 4] = v >> 32;
-            dst[pos + 5] = v >> 40;
-            dst[pos + 6] = v >> 48;
-            dst[pos + 7] = v >> 56;
-          } break;
-          case INT96: {
-            int64_t v        = s->col.leaf_column->element<int64_t>(val_idx);
-            int32_t ts_scale = s->col.ts_scale;
-            if (ts_scale != 0) {
-              if (ts_scale < 0) {
-                v /= -ts_scale;
-              } else {
-                v *= ts_scale;
+              dst[pos + 0] = v;
+              dst[pos + 1] = v >> 8;
+              dst[pos + 2] = v >> 16;
+              dst[pos + 3] = v >> 24;
+              dst[pos + 4] = v >> 32;
+              dst[pos + 5] = v >> 40;
+              dst[pos + 6] = v >> 48;
+              dst[pos + 7] = v >> 56;
+            } break;
+            case INT96: {
+              int64_t v        = s->col.leaf_column->element<int64_t>(val_idx);
+              int32_t ts_scale = s->col.ts_scale;
+              if (ts_scale != 0) {
+                if (ts_scale < 0) {
+                  v /= -ts_scale;
+                } else {
+                  v *= ts_scale;
+                }
               }
-            }
 
-            auto const ret = convert_nanoseconds([&]() {
-              switch (s->col.leaf_column->type().id()) {
-                case type_id::TIMESTAMP_SECONDS:
-                case type_id::TIMESTAMP_MILLISECONDS: {
-                  return timestamp_ns{duration_ms{v}};
-                } break;
-                case type_id::TIMESTAMP_MICROSECONDS:
-                case type_id::TIMESTAMP_NANOSECONDS: {
-                  return timestamp_ns{duration_us{v}};
-                } break;
+              auto const ret = convert_nanoseconds([&]() {
+                switch (s->col.leaf_column->type().id()) {
+                  case type_id::TIMESTAMP_SECONDS:
+                  case type_id::TIMESTAMP_MILLISECONDS: {
+                    return timestamp_ns{duration_ms{v}};
+                  } break;
+                  case type_id::TIMESTAMP_MICROSECONDS:
+                  case type_id::TIMESTAMP_NANOSECONDS: {
+                    return timestamp_ns{duration_us{v}};
+                  } break;
+                }
+                return timestamp_ns{duration_ns{0}};
+              }());
+
+              // the 12 bytes of fixed length data.
+              v             = ret.first.count();
+              dst[pos + 0]  = v;
+              dst[pos + 1]  = v >> 8;
+              dst[pos + 2]  = v >> 16;
+              dst[pos + 3]  = v >> 24;
+              dst[pos + 4]  = v >> 32;
+              dst[pos + 5]  = v >> 40;
+              dst[pos + 6]  = v >> 48;
+              dst[pos + 7]  = v >> 56;
+              uint32_t w    = ret.second.count();
+              dst[pos + 8]  = w;
+              dst[pos + 9]  = w >> 8;
+              dst[pos + 10] = w >> 16;
+              dst[pos + 11] = w >> 24;
+            } break;
+
+            case DOUBLE: {
+              auto v = s->col.leaf_column->element<double>(val_idx);
+              memcpy(dst + pos, &v, 8);
+            } break;
+            case BYTE_ARRAY: {
+              auto str     = s->col.leaf_column->element<string_view>(val_idx);
+              uint32_t v   = len - 4;  // string length
+              dst[pos + 0] = v;
+              dst[pos + 1] = v >> 8;
+              dst[pos + 2] = v >> 16;
+              dst[pos + 3] = v >> 24;
+              if (v != 0) memcpy(dst + pos + 4, str.data(), v);
+            } break;
+            case FIXED_LEN_BYTE_ARRAY: {
+              if (type_id == type_id::DECIMAL128) {
+                // When using FIXED_LEN_BYTE_ARRAY for decimals, the rep is encoded in big-endian
+                auto const v = s->col.leaf_column->element<numeric::decimal128>(val_idx).value();
+                auto const v_char_ptr = reinterpret_cast<char const*>(&v);
+                thrust::copy(thrust::seq,
+                             thrust::make_reverse_iterator(v_char_ptr + sizeof(v)),
+                             thrust::make_reverse_iterator(v_char_ptr),
+                             dst + pos);
               }
-              return timestamp_ns{duration_ns{0}};
-            }());
-
-            // the 12 bytes of fixed length data.
-            v             = ret.first.count();
-            dst[pos + 0]  = v;
-            dst[pos + 1]  = v >> 8;
-            dst[pos + 2]  = v >> 16;
-            dst[pos + 3]  = v >> 24;
-            dst[pos + 4]  = v >> 32;
-            dst[pos + 5]  = v >> 40;
-            dst[pos + 6]  = v >> 48;
-            dst[pos + 7]  = v >> 56;
-            uint32_t w    = ret.second.count();
-            dst[pos + 8]  = w;
-            dst[pos + 9]  = w >> 8;
-            dst[pos + 10] = w >> 16;
-            dst[pos + 11] = w >> 24;
-          } break;
-
-          case DOUBLE: {
-            auto v = s->col.leaf_column->element<double>(val_idx);
-            memcpy(dst + pos, &v, 8);
-          } break;
-          case BYTE_ARRAY: {
-            auto str     = s->col.leaf_column->element<string_view>(val_idx);
-            uint32_t v   = len - 4;  // string length
-            dst[pos + 0] = v;
-            dst[pos + 1] = v >> 8;
-            dst[pos + 2] = v >> 16;
-            dst[pos + 3] = v >> 24;
-            if (v != 0) memcpy(dst + pos + 4, str.data(), v);
-          } break;
-          case FIXED_LEN_BYTE_ARRAY: {
-            if (type_id == type_id::DECIMAL128) {
-              // When using FIXED_LEN_BYTE_ARRAY for decimals, the rep is encoded in big-endian
-              auto const v = s->col.leaf_column->element<numeric::decimal128>(val_idx).value();
-              auto const v_char_ptr = reinterpret_cast<char const*>(&v);
-              thrust::copy(thrust::seq,
-                           thrust::make_reverse_iterator(v_char_ptr + sizeof(v)),
-                           thrust::make_reverse_iterator(v_char_ptr),
-                           dst + pos);
-            }
-          } break;
+            } break;
+          }
         }
+        __syncthreads();
       }
-      __syncthreads();
     }
   }
   if (t == 0) {
@@ -1249,10 +1670,42 @@ class header_encoder {
   inline __device__ void set_ptr(uint8_t* ptr) { current_header_ptr = ptr; }
 };
 
+/**
+ * @brief Returns the length of the longest prefix of a UTF-8 string that is at most `max_length`
+ * bytes long and ends at a character boundary.
+ */
+__device__ uint32_t truncated_min_length(char const* str, uint32_t length, uint32_t max_length)
+{
+  if (length <= max_length) { return length; }
+  auto prefix_length = max_length;
+  // The prefix ends before the character of its first excluded byte
+  while (prefix_length > 0 && (static_cast<uint8_t>(str[prefix_length]) & 0xc0) == 0x80) {
+    --prefix_length;
+  }
+  return prefix_length;
+}
+
+/**
+ * @brief Returns the length of the prefix of a UTF-8 string that is an upper bound of the string
+ * once its last byte is incremented, or `length` if the string is not to be truncated.
+ *
+ * The prefix ends with its last ASCII character, which remains ASCII once incremented.
+ */
+__device__ uint32_t truncated_max_length(char const* str, uint32_t length, uint32_t max_length)
+{
+  if (length <= max_length) { return length; }
+  auto prefix_length = truncated_min_length(str, length, max_length);
+  while (prefix_length > 0 && static_cast<uint8_t>(str[prefix_length - 1]) >= 0x7f) {
+    --prefix_length;
+  }
+  return (prefix_length > 0) ? prefix_length : length;
+}
+
 __device__ uint8_t* EncodeStatistics(uint8_t* start,
                                      const statistics_chunk* s,
                                      uint8_t dtype,
-                                     float* fp_scratch)
+                                     float* fp_scratch,
+                                     uint32_t truncate_length)
 {
   uint8_t *end, dtype_len;
   switch (dtype) {
@@ -1277,10 +1730,12 @@ __device__ uint8_t* EncodeStatistics(uint8_t* start,
     uint32_t lmin, lmax;
 
     if (dtype == dtype_string) {
-      lmin = s->min_value.str_val.length;
-      vmin = s->min_value.str_val.ptr;
-      lmax = s->max_value.str_val.length;
-      vmax = s->max_value.str_val.ptr;
+      auto const& min = s->min_value.str_val;
+      auto const& max = s->max_value.str_val;
+      lmin            = truncated_min_length(min.ptr, min.length, truncate_length);
+      vmin            = min.ptr;
+      lmax            = truncated_max_length(max.ptr, max.length, truncate_length);
+      vmax            = max.ptr;
     } else {
       lmin = lmax = dtype_len;
       if (dtype == dtype_float32) {  // Convert from double to float32
@@ -1294,6 +1749,10 @@ __device__ uint8_t* EncodeStatistics(uint8_t* start,
       }
     }
     encoder.field_binary(5, vmax, lmax);
+    if (dtype == dtype_string && lmax < s->max_value.str_val.length) {
+      // The truncated maximum is incremented to remain an upper bound
+      ++encoder.get_ptr()[-1];
+    }
     encoder.field_binary(6, vmin, lmin);
   }
   encoder.end(&end);
@@ -1305,7 +1764,8 @@ __global__ void __launch_bounds__(128)
   gpuEncodePageHeaders(device_span<EncPage> pages,
                        device_span<gpu_inflate_status_s const> comp_stat,
                        device_span<statistics_chunk const> page_stats,
-                       const statistics_chunk* chunk_stats)
+                       const statistics_chunk* chunk_stats,
+                       uint32_t truncate_length)
 {
   // When this whole kernel becomes single thread, the following variables need not be __shared__
   __shared__ __align__(8) parquet_column_device_view col_g;
@@ -1325,8 +1785,11 @@ __global__ void __launch_bounds__(128)
 
     if (chunk_stats && &pages[blockIdx.x] == ck_g.pages) {  // Is this the first page in a chunk?
       hdr_start = (ck_g.is_compressed) ? ck_g.compressed_bfr : ck_g.uncompressed_bfr;
-      hdr_end =
-        EncodeStatistics(hdr_start, &chunk_stats[page_g.chunk_id], col_g.stats_dtype, fp_scratch);
+      hdr_end   = EncodeStatistics(hdr_start,
+                                   &chunk_stats[page_g.chunk_id],
+                                   col_g.stats_dtype,
+                                   fp_scratch,
+                                   truncate_length);
       page_g.chunk->ck_stat_size = static_cast<uint32_t>(hdr_end - hdr_start);
     }
     uncompressed_page_size = page_g.max_data_size;
@@ -1344,15 +1807,11 @@ __global__ void __launch_bounds__(128)
     // RLE_DICTIONARY in data page, but parquet v1 uses PLAIN_DICTIONARY in both dictionary and
     // data pages (actual encoding is identical).
     Encoding encoding;
-    if (enable_bool_rle) {
-      encoding = (col_g.physical_type == BOOLEAN) ? Encoding::RLE
-                 : (page_type == PageType::DICTIONARY_PAGE || page_g.chunk->use_dictionary)
-                   ? Encoding::PLAIN_DICTIONARY
-                   : Encoding::PLAIN;
+    if (enable_bool_rle && col_g.physical_type == BOOLEAN) {
+      encoding = Encoding::RLE;
     } else {
-      encoding = (page_type == PageType::DICTIONARY_PAGE || page_g.chunk->use_dictionary)
-                   ? Encoding::PLAIN_DICTIONARY
-                   : Encoding::PLAIN;
+      encoding = (page_type == PageType::DICTIONARY_PAGE) ? Encoding::PLAIN_DICTIONARY
+                                                          : page_g.chunk->encoding;
     }
     encoder.field_int32(1, page_type);
     encoder.field_int32(2, uncompressed_page_size);
@@ -1367,8 +1826,11 @@ __global__ void __launch_bounds__(128)
       // Optionally encode page-level statistics
       if (not page_stats.empty()) {
         encoder.field_struct_begin(5);
-        encoder.set_ptr(EncodeStatistics(
-          encoder.get_ptr(), &page_stats[blockIdx.x], col_g.stats_dtype, fp_scratch));
+        encoder.set_ptr(EncodeStatistics(encoder.get_ptr(),
+                                         &page_stats[blockIdx.x],
+                                         col_g.stats_dtype,
+                                         fp_scratch,
+                                         truncate_length));
         encoder.field_struct_end(5);
       }
       encoder.field_struct_end(5);
@@ -1386,6 +1848,25 @@ __global__ void __launch_bounds__(128)
   if (t == 0) pages[blockIdx.x] = page_g;
 }
 
+// blockDim(128, 1, 1)
+__global__ void __launch_bounds__(128)
+  gpuEncodePageStatistics(device_span<EncPage const> pages,
+                          device_span<statistics_chunk const> page_stats,
+                          device_span<size_t const> blob_offsets,
+                          uint8_t* blobs,
+                          device_span<uint32_t> blob_sizes,
+                          uint32_t truncate_length)
+{
+  float fp_scratch[2];
+  auto const page = blockIdx.x * blockDim.x + threadIdx.x;
+  if (page >= pages.size()) { return; }
+
+  auto const dtype = pages[page].chunk->col_desc->stats_dtype;
+  auto const start = blobs + blob_offsets[page];
+  auto const end = EncodeStatistics(start, &page_stats[page], dtype, fp_scratch, truncate_length);
+  blob_sizes[page] = static_cast<uint32_t>(end - start);
+}
+
 // blockDim(1024, 1, 1)
 __global__ void __launch_bounds__(1024)
   gpuGatherPages(device_span<EncColumnChunk> chunks, device_span<gpu::EncPage const> pages)
@@ -1931,12 +2412,21 @@ void InitEncoderPages(device_2dspan<EncColumnChunk> chunks,
                       statistics_merge_group* page_grstats,
                       statistics_merge_group* chunk_grstats,
                       size_t max_page_comp_data_size,
+                      size_t max_page_size_bytes,
+                      size_type max_page_size_rows,
                       rmm::cuda_stream_view stream)
 {
   auto num_rowgroups = chunks.size().first;
   dim3 dim_grid(num_columns, num_rowgroups);  // 1 threadblock per rowgroup
-  gpuInitPages<<<dim_grid, 128, 0, stream.value()>>>(
-    chunks, pages, col_desc, page_grstats, chunk_grstats, max_page_comp_data_size, num_columns);
+  gpuInitPages<<<dim_grid, 128, 0, stream.value()>>>(chunks,
+                                                     pages,
+                                                     col_desc,
+                                                     page_grstats,
+                                                     chunk_grstats,
+                                                     max_page_comp_data_size,
+                                                     num_columns,
+                                                     max_page_size_bytes,
+                                                     max_page_size_rows);
 }
 
 void EncodePages(device_span<gpu::EncPage> pages,
@@ -1959,12 +2449,30 @@ void EncodePageHeaders(device_span<EncPage> pages,
                        device_span<gpu_inflate_status_s const> comp_stat,
                        device_span<statistics_chunk const> page_stats,
                        const statistics_chunk* chunk_stats,
+                       uint32_t truncate_length,
                        rmm::cuda_stream_view stream)
 {
   // TODO: single thread task. No need for 128 threads/block. Earlier it used to employ rest of the
   // threads to coop load structs
   gpuEncodePageHeaders<<<pages.size(), 128, 0, stream.value()>>>(
-    pages, comp_stat, page_stats, chunk_stats);
+    pages, comp_stat, page_stats, chunk_stats, truncate_length);
+}
+
+void EncodePageStatistics(device_span<EncPage const> pages,
+                          device_span<statistics_chunk const> page_stats,
+                          device_span<size_t const> blob_offsets,
+                          uint8_t* blobs,
+                          device_span<uint32_t> blob_sizes,
+                          uint32_t truncate_length,
+                          rmm::cuda_stream_view stream)
+{
+  if (pages.empty()) { return; }
+  constexpr int block_size = 128;
+  gpuEncodePageStatistics<<<util::div_rounding_up_safe<size_t>(pages.size(), block_size),
+                            block_size,
+                            0,
+                            stream.value()>>>(
+    pages, page_stats, blob_offsets, blobs, blob_sizes, truncate_length);
 }
 
 void GatherPages(device_span<EncColumnChunk> chunks,
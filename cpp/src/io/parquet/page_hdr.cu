@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -172,6 +172,25 @@ struct ParquetFieldInt32 {
   }
 };
 
+/**
+ * @brief Functor to set value to bool read from byte stream
+ *
+ * @return True if field type is not bool
+ */
+struct ParquetFieldBool {
+  int field;
+  bool& val;
+
+  __device__ ParquetFieldBool(int f, bool& v) : field(f), val(v) {}
+
+  inline __device__ bool operator()(byte_stream_s* bs, int field_type)
+  {
+    // the value of a bool field is encoded in its type
+    val = (field_type == ST_FLD_TRUE);
+    return (field_type != ST_FLD_TRUE && field_type != ST_FLD_FALSE);
+  }
+};
+
 /**
  * @brief Functor to set value to enum read from byte stream
  *
@@ -306,11 +325,13 @@ struct gpuParseDictionaryPageHeader {
 struct gpuParseDataPageHeaderV2 {
   __device__ bool operator()(byte_stream_s* bs)
   {
-    auto op = thrust::make_tuple(ParquetFieldInt32(1, bs->page.num_input_values),
-                                 ParquetFieldInt32(3, bs->page.num_rows),
-                                 ParquetFieldEnum<Encoding>(4, bs->page.encoding),
-                                 ParquetFieldEnum<Encoding>(5, bs->page.definition_level_encoding),
-                                 ParquetFieldEnum<Encoding>(6, bs->page.repetition_level_encoding));
+    auto op = thrust::make_tuple(
+      ParquetFieldInt32(1, bs->page.num_input_values),
+      ParquetFieldInt32(3, bs->page.num_rows),
+      ParquetFieldEnum<Encoding>(4, bs->page.encoding),
+      ParquetFieldInt32(5, bs->page.lvl_bytes[level_type::DEFINITION]),
+      ParquetFieldInt32(6, bs->page.lvl_bytes[level_type::REPETITION]),
+      ParquetFieldBool(7, bs->page.is_compressed));
     return parse_header(op, bs);
   }
 };
@@ -381,7 +402,10 @@ extern "C" __global__ void __launch_bounds__(128)
         // they will be recomputed in the preprocess step by examining repetition and
         // definition levels
         bs->page.chunk_row += bs->page.num_rows;
-        bs->page.num_rows = 0;
+        bs->page.num_rows                          = 0;
+        bs->page.lvl_bytes[level_type::DEFINITION] = 0;
+        bs->page.lvl_bytes[level_type::REPETITION] = 0;
+        bs->page.is_compressed                     = true;
         if (parse_page_header(bs) && bs->page.compressed_page_size >= 0) {
           switch (bs->page_type) {
             case PageType::DATA_PAGE:
@@ -389,10 +413,18 @@ extern "C" __global__ void __launch_bounds__(128)
               // they will be recomputed in the preprocess step by examining repetition and
               // definition levels
               bs->page.num_rows = bs->page.num_input_values;
+              index_out         = num_dict_pages + data_page_count;
+              data_page_count++;
+              bs->page.flags = 0;
+              values_found += bs->page.num_input_values;
+              break;
             case PageType::DATA_PAGE_V2:
+              // levels of data pages v2 are always RLE encoded, without a length prefix
               index_out = num_dict_pages + data_page_count;
               data_page_count++;
-              bs->page.flags = 0;
+              bs->page.flags                     = PAGEINFO_FLAGS_V2;
+              bs->page.definition_level_encoding = Encoding::RLE;
+              bs->page.repetition_level_encoding = Encoding::RLE;
               values_found += bs->page.num_input_values;
               break;
             case PageType::DICTIONARY_PAGE:
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -203,6 +203,21 @@ struct SchemaElement {
   }
 };
 
+/**
+ * @brief Thrift-derived struct describing column chunk statistics
+ *
+ * Values are stored in the plain encoding of the column's physical type. `min`/`max` are the
+ * deprecated signed-order fields; `min_value`/`max_value` follow the column's sort order.
+ */
+struct Statistics {
+  std::vector<uint8_t> max;
+  std::vector<uint8_t> min;
+  int64_t null_count     = -1;  // -1 if not present
+  int64_t distinct_count = -1;  // -1 if not present
+  std::vector<uint8_t> max_value;
+  std::vector<uint8_t> min_value;
+};
+
 /**
  * @brief Thrift-derived struct describing a column chunk
  */
@@ -221,6 +236,8 @@ struct ColumnChunkMetaData {
   int64_t dictionary_page_offset =
     0;  // Byte offset from the beginning of file to first (only) dictionary page
   std::vector<uint8_t> statistics_blob;  // Encoded chunk-level statistics as binary blob
+  int64_t bloom_filter_offset = 0;  // Byte offset from the beginning of file to the bloom filter
+  int32_t bloom_filter_length = 0;  // Size of the bloom filter, including its header, in bytes
 };
 
 /**
@@ -244,6 +261,15 @@ struct ColumnChunk {
   int schema_idx = -1;  // Index in flattened schema (derived from path_in_schema)
 };
 
+/**
+ * @brief Thrift-derived struct describing the sort order of a column within a row group
+ */
+struct SortingColumn {
+  int32_t column_idx = 0;      // Index of the column in the row group
+  bool descending    = false;  // Whether the values are in descending order
+  bool nulls_first   = false;  // Whether the nulls come before the values
+};
+
 /**
  * @brief Thrift-derived struct describing a group of row data
  *
@@ -254,6 +280,7 @@ struct RowGroup {
   int64_t total_byte_size = 0;
   std::vector<ColumnChunk> columns;
   int64_t num_rows = 0;
+  std::vector<SortingColumn> sorting_columns;  // Columns by which the rows are sorted, if any
 };
 
 /**
@@ -317,6 +344,82 @@ struct PageHeader {
   DictionaryPageHeader dictionary_page_header;
 };
 
+/**
+ * @brief Thrift-derived struct describing the location of a data page within the file
+ */
+struct PageLocation {
+  int64_t offset               = 0;  // File offset of the page header
+  int32_t compressed_page_size = 0;  // Compressed page size in bytes, including the header
+  int64_t first_row_index      = 0;  // Index of the first row of the page within the row group
+};
+
+/**
+ * @brief Thrift-derived struct describing the page locations of a column chunk (page index)
+ */
+struct OffsetIndex {
+  std::vector<PageLocation> page_locations;
+};
+
+/**
+ * @brief Thrift-derived struct describing the page statistics of a column chunk (page index)
+ *
+ * All lists hold one entry per data page. Values are stored like those of `Statistics`.
+ */
+struct ColumnIndex {
+  std::vector<bool> null_pages;  // Whether each page holds only null values
+  std::vector<std::vector<uint8_t>> min_values;
+  std::vector<std::vector<uint8_t>> max_values;
+  BoundaryOrder boundary_order = BoundaryOrder::UNORDERED;
+  std::vector<int64_t> null_counts;  // Optional
+};
+
+// thrift generated code simplified.
+struct SplitBlockAlgorithm {
+};
+struct XxHash {
+};
+struct BloomFilterUncompressed {
+};
+
+using BloomFilterAlgorithm_isset = struct BloomFilterAlgorithm_isset {
+  BloomFilterAlgorithm_isset() {}
+  bool BLOCK{false};
+};
+struct BloomFilterAlgorithm {
+  BloomFilterAlgorithm_isset isset;
+  SplitBlockAlgorithm BLOCK;
+};
+
+using BloomFilterHash_isset = struct BloomFilterHash_isset {
+  BloomFilterHash_isset() {}
+  bool XXHASH{false};
+};
+struct BloomFilterHash {
+  BloomFilterHash_isset isset;
+  XxHash XXHASH;
+};
+
+using BloomFilterCompression_isset = struct BloomFilterCompression_isset {
+  BloomFilterCompression_isset() {}
+  bool UNCOMPRESSED{false};
+};
+struct BloomFilterCompression {
+  BloomFilterCompression_isset isset;
+  BloomFilterUncompressed UNCOMPRESSED;
+};
+
+/**
+ * @brief Thrift-derived struct describing the header of the bloom filter of a column chunk
+ *
+ * The header is directly followed by the `num_bytes` bytes of the filter's bitset.
+ */
+struct BloomFilterHeader {
+  int32_t num_bytes = 0;  // Size of the bitset, in bytes
+  BloomFilterAlgorithm algorithm;
+  BloomFilterHash hash;
+  BloomFilterCompression compression;
+};
+
 /**
  * @brief Count the number of leading zeros in an unsigned integer
  */
@@ -417,12 +520,21 @@ class CompactProtocolReader {
   bool read(TimestampType* t);
   bool read(IntType* t);
   bool read(RowGroup* r);
+  bool read(SortingColumn* s);
   bool read(ColumnChunk* c);
   bool read(ColumnChunkMetaData* c);
   bool read(PageHeader* p);
   bool read(DataPageHeader* d);
   bool read(DictionaryPageHeader* d);
   bool read(KeyValue* k);
+  bool read(Statistics* s);
+  bool read(PageLocation* p);
+  bool read(OffsetIndex* o);
+  bool read(ColumnIndex* c);
+  bool read(BloomFilterAlgorithm* a);
+  bool read(BloomFilterHash* h);
+  bool read(BloomFilterCompression* c);
+  bool read(BloomFilterHeader* b);
 
  public:
   static int NumRequiredBits(uint32_t max_level) noexcept
@@ -450,6 +562,7 @@ class CompactProtocolReader {
   template <typename T>
   friend class ParquetFieldStructListFunctor;
   friend class ParquetFieldString;
+  friend class ParquetFieldBinary;
   template <typename T>
   friend class ParquetFieldStructFunctor;
   template <typename T, bool>
@@ -460,6 +573,9 @@ class CompactProtocolReader {
   friend class ParquetFieldEnumListFunctor;
   friend class ParquetFieldStringList;
   friend class ParquetFieldStructBlob;
+  friend class ParquetFieldBoolList;
+  friend class ParquetFieldInt64List;
+  friend class ParquetFieldBinaryList;
 };
 
 /**
@@ -614,6 +730,35 @@ class ParquetFieldString {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to read a binary field from CompactProtocolReader
+ *
+ * @return True if field type mismatches or if size of the data exceeds bounds
+ * of the CompactProtocolReader
+ */
+class ParquetFieldBinary {
+  int field_val;
+  std::vector<uint8_t>& val;
+
+ public:
+  ParquetFieldBinary(int f, std::vector<uint8_t>& v) : field_val(f), val(v) {}
+
+  inline bool operator()(CompactProtocolReader* cpr, int field_type)
+  {
+    if (field_type != ST_FLD_BINARY) return true;
+    uint32_t n = cpr->get_u32();
+    if (n <= (size_t)(cpr->m_end - cpr->m_cur)) {
+      val.assign(cpr->m_cur, cpr->m_cur + n);
+      cpr->m_cur += n;
+      return false;
+    } else {
+      return true;
+    }
+  }
+
+  int field() { return field_val; }
+};
+
 /**
  * @brief Functor to read a structure from CompactProtocolReader
  *
@@ -815,6 +960,97 @@ class ParquetFieldStructBlob {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to read a vector of booleans from CompactProtocolReader
+ *
+ * @return True if field types mismatch
+ */
+class ParquetFieldBoolList {
+  int field_val;
+  std::vector<bool>& val;
+
+ public:
+  ParquetFieldBoolList(int f, std::vector<bool>& v) : field_val(f), val(v) {}
+  inline bool operator()(CompactProtocolReader* cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_TRUE && (current_byte & 0xf) != ST_FLD_FALSE) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) {
+      // list elements are encoded as one byte each, 1 meaning true
+      val[i] = (cpr->getb() == 1);
+    }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
+/**
+ * @brief Functor to read a vector of 64 bit integers from CompactProtocolReader
+ *
+ * @return True if field types mismatch
+ */
+class ParquetFieldInt64List {
+  int field_val;
+  std::vector<int64_t>& val;
+
+ public:
+  ParquetFieldInt64List(int f, std::vector<int64_t>& v) : field_val(f), val(v) {}
+  inline bool operator()(CompactProtocolReader* cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_I64) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) {
+      val[i] = cpr->get_i64();
+    }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
+/**
+ * @brief Functor to read a vector of binary fields from CompactProtocolReader
+ *
+ * @return True if field types mismatch or if the size of a field exceeds bounds
+ * of the CompactProtocolReader
+ */
+class ParquetFieldBinaryList {
+  int field_val;
+  std::vector<std::vector<uint8_t>>& val;
+
+ public:
+  ParquetFieldBinaryList(int f, std::vector<std::vector<uint8_t>>& v) : field_val(f), val(v) {}
+  inline bool operator()(CompactProtocolReader* cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_BINARY) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) {
+      uint32_t l = cpr->get_u32();
+      if (l <= (size_t)(cpr->m_end - cpr->m_cur)) {
+        val[i].assign(cpr->m_cur, cpr->m_cur + l);
+        cpr->m_cur += l;
+      } else
+        return true;
+    }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
 }  // namespace parquet
 }  // namespace io
 }  // namespace cudf
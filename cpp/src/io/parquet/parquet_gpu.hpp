@@ -72,6 +72,7 @@ using slot_type               = map_type::pair_atomic_type;
  */
 enum {
   PAGEINFO_FLAGS_DICTIONARY = (1 << 0),  // Indicates a dictionary page
+  PAGEINFO_FLAGS_V2         = (1 << 1),  // Indicates a data page v2, with uncompressed levels
 };
 
 /**
@@ -134,6 +135,10 @@ struct PageInfo {
   Encoding encoding;       // Encoding for data or dictionary page
   Encoding definition_level_encoding;  // Encoding used for definition levels (data page)
   Encoding repetition_level_encoding;  // Encoding used for repetition levels (data page)
+  // Sizes of the definition and repetition levels of data pages v2, which precede the values and
+  // are never compressed
+  int32_t lvl_bytes[level_type::NUM_LEVEL_TYPES];
+  bool is_compressed;  // Whether the values of a data page v2 are compressed
 
   // for nested types, we run a preprocess step in order to determine output
   // column sizes. Because of this, we can jump directly to the position in the
@@ -190,6 +195,7 @@ struct ColumnChunkDesc {
       max_num_pages(0),
       page_info(nullptr),
       str_dict_index(nullptr),
+      output_dict_index(false),
       valid_map_base{nullptr},
       column_data_base{nullptr},
       codec(codec_),
@@ -218,6 +224,7 @@ struct ColumnChunkDesc {
   PageInfo* page_info;                        // output page info for up to num_dict_pages +
                                               // num_data_pages (dictionary pages first)
   string_index_pair* str_dict_index;          // index for string dictionary
+  bool output_dict_index;                     // output dictionary indices instead of strings
   uint32_t** valid_map_base;                  // base pointers of valid bit map for this column
   void** column_data_base;                    // base pointers of column data
   int8_t codec;                               // compressed codec enum
@@ -309,6 +316,29 @@ inline size_type __device__ row_to_value_idx(size_type idx, column_device_view c
   return idx;
 }
 
+/**
+ * @brief Returns the value of an element of an INT32 or INT64 leaf column as it is stored in the
+ * file, i.e. after the conversions applied by the plain encoder
+ */
+inline int64_t __device__ physical_int_value(parquet_column_device_view const& col, size_type idx)
+{
+  auto const& leaf = *col.leaf_column;
+  if (col.physical_type == Type::INT32) {
+    switch (int32_logical_len(leaf.type().id())) {
+      case 1: return leaf.element<int8_t>(idx);
+      case 2: return leaf.element<int16_t>(idx);
+      default: return leaf.element<int32_t>(idx);
+    }
+  }
+  int64_t v = leaf.element<int64_t>(idx);
+  if (col.ts_scale < 0) {
+    v /= -col.ts_scale;
+  } else if (col.ts_scale > 0) {
+    v *= col.ts_scale;
+  }
+  return v;
+}
+
 /**
  * @brief Return worst-case compressed size of compressed data given the uncompressed size
  */
@@ -354,6 +384,8 @@ struct EncColumnChunk {
   uint16_t* dict_index;   //!< Index of value in dictionary page. column[dict_data[dict_index[row]]]
   uint8_t dict_rle_bits;  //!< Bit size for encoding dictionary indices
   bool use_dictionary;    //!< True if the chunk uses dictionary encoding
+  size_type delta_data_size;  //!< Estimated size of data in this chunk if a delta encoding is used
+  Encoding encoding;          //!< Encoding of the data pages of this chunk
 };
 
 /**
@@ -426,6 +458,59 @@ void PreprocessColumnData(hostdevice_vector<PageInfo>& pages,
                           rmm::cuda_stream_view stream,
                           rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Returns whether a data page is encoded with one of the delta encodings
+ */
+inline __host__ __device__ bool is_delta_encoded(PageInfo const& page)
+{
+  return page.encoding == Encoding::DELTA_BINARY_PACKED ||
+         page.encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY ||
+         page.encoding == Encoding::DELTA_BYTE_ARRAY;
+}
+
+/**
+ * @brief Returns whether a data page is rewritten with the plain encoding before it is decoded,
+ * i.e. whether it is encoded with one of the delta encodings or with BYTE_STREAM_SPLIT
+ */
+inline __host__ __device__ bool is_rewritten_as_plain(PageInfo const& page)
+{
+  return is_delta_encoded(page) || page.encoding == Encoding::BYTE_STREAM_SPLIT;
+}
+
+/**
+ * @brief Launches kernel for computing the size of delta-encoded and byte-stream-split data pages
+ * once rewritten with the plain encoding
+ *
+ * @param[in] pages All pages to be decoded
+ * @param[in] chunks All chunks to be decoded
+ * @param[out] page_sizes Size of the levels and plain-encoded values of each page, zero for pages
+ * that are not rewritten
+ * @param[in] stream CUDA stream to use, default 0
+ */
+void ComputeDeltaPageSizes(hostdevice_vector<PageInfo>& pages,
+                           hostdevice_vector<ColumnChunkDesc> const& chunks,
+                           device_span<size_t> page_sizes,
+                           rmm::cuda_stream_view stream);
+
+/**
+ * @brief Launches kernel for rewriting delta-encoded and byte-stream-split data pages with the
+ * plain encoding
+ *
+ * The levels of each page are copied unchanged, followed by the plain encoding of its values.
+ * The data, size and encoding of the rewritten pages are updated in device memory.
+ *
+ * @param[in,out] pages All pages to be decoded
+ * @param[in] chunks All chunks to be decoded
+ * @param[in] page_offsets Offset of each rewritten page in `page_data`
+ * @param[out] page_data Rewritten pages, sized as computed by `ComputeDeltaPageSizes`
+ * @param[in] stream CUDA stream to use, default 0
+ */
+void DecodeDeltaPages(hostdevice_vector<PageInfo>& pages,
+                      hostdevice_vector<ColumnChunkDesc> const& chunks,
+                      device_span<size_t const> page_offsets,
+                      uint8_t* page_data,
+                      rmm::cuda_stream_view stream);
+
 /**
  * @brief Launches kernel for reading the column data stored in the pages
  *
@@ -533,6 +618,21 @@ void populate_chunk_hash_maps(cudf::detail::device_2dspan<EncColumnChunk> chunks
                               cudf::detail::device_2dspan<gpu::PageFragment const> frags,
                               rmm::cuda_stream_view stream);
 
+/**
+ * @brief Estimate the size of each chunk if its data pages were delta encoded
+ *
+ * Integer chunks are estimated for DELTA_BINARY_PACKED and string chunks for DELTA_BYTE_ARRAY,
+ * from a sample of the values of each fragment. The estimates are accumulated into
+ * `delta_data_size`, which must be zero-initialized; other chunks are left untouched.
+ *
+ * @param chunks Column chunks [rowgroup][column]
+ * @param frags Column fragments
+ * @param stream CUDA stream to use
+ */
+void estimate_delta_sizes(cudf::detail::device_2dspan<EncColumnChunk> chunks,
+                          cudf::detail::device_2dspan<gpu::PageFragment const> frags,
+                          rmm::cuda_stream_view stream);
+
 /**
  * @brief Compact dictionary hash map entries into chunk.dict_data
  *
@@ -569,6 +669,8 @@ void get_dictionary_indices(cudf::detail::device_2dspan<EncColumnChunk> chunks,
  * @param[in] page_grstats Setup for page-level stats
  * @param[in] chunk_grstats Setup for chunk-level stats
  * @param[in] max_page_comp_data_size Calculated maximum compressed data size of pages
+ * @param[in] max_page_size_bytes Target maximum size of the data of each page
+ * @param[in] max_page_size_rows Maximum number of rows in each page
  * @param[in] stream CUDA stream to use, default 0
  */
 void InitEncoderPages(cudf::detail::device_2dspan<EncColumnChunk> chunks,
@@ -578,6 +680,8 @@ void InitEncoderPages(cudf::detail::device_2dspan<EncColumnChunk> chunks,
                       statistics_merge_group* page_grstats,
                       statistics_merge_group* chunk_grstats,
                       size_t max_page_comp_data_size,
+                      size_t max_page_size_bytes,
+                      size_type max_page_size_rows,
                       rmm::cuda_stream_view stream);
 
 /**
@@ -608,14 +712,38 @@ void DecideCompression(device_span<EncColumnChunk> chunks, rmm::cuda_stream_view
  * @param[in] comp_out Compressor status or nullptr if no compression
  * @param[in] page_stats Optional page-level statistics to be included in page header
  * @param[in] chunk_stats Optional chunk-level statistics to be encoded
+ * @param[in] truncate_length Maximum length of the encoded string minimum and maximum values
  * @param[in] stream CUDA stream to use, default 0
  */
 void EncodePageHeaders(device_span<EncPage> pages,
                        device_span<gpu_inflate_status_s const> comp_out,
                        device_span<statistics_chunk const> page_stats,
                        const statistics_chunk* chunk_stats,
+                       uint32_t truncate_length,
                        rmm::cuda_stream_view stream);
 
+/**
+ * @brief Launches kernel to encode the statistics of each page as a Thrift `Statistics` struct
+ *
+ * The encoded statistics are used to build the ColumnIndex of each column chunk.
+ *
+ * @param[in] pages Device array of EncPages
+ * @param[in] page_stats Statistics of each page
+ * @param[in] blob_offsets Offset of the encoded statistics of each page in `blobs`; each page may
+ * use up to its maximum header size
+ * @param[out] blobs Encoded statistics
+ * @param[out] blob_sizes Size of the encoded statistics of each page
+ * @param[in] truncate_length Maximum length of the encoded string minimum and maximum values
+ * @param[in] stream CUDA stream to use, default 0
+ */
+void EncodePageStatistics(device_span<EncPage const> pages,
+                          device_span<statistics_chunk const> page_stats,
+                          device_span<size_t const> blob_offsets,
+                          uint8_t* blobs,
+                          device_span<uint32_t> blob_sizes,
+                          uint32_t truncate_length,
+                          rmm::cuda_stream_view stream);
+
 /**
  * @brief Launches kernel to gather pages to a single contiguous block per chunk
  *
@@ -627,6 +755,28 @@ void GatherPages(device_span<EncColumnChunk> chunks,
                  device_span<gpu::EncPage const> pages,
                  rmm::cuda_stream_view stream);
 
+/**
+ * @brief Inserts the values of a range of rows into a split-block bloom filter
+ *
+ * Values are hashed in their plain physical encoding. Null rows are not inserted.
+ *
+ * @param[in] col Flat integral, floating point, decimal32, decimal64 or string column
+ * @param[in] first_row First row to insert
+ * @param[in] num_rows Number of rows to insert
+ * @param[in,out] bitset Zero-initialized bitset of the filter, a whole number of blocks
+ * @param[in] stream CUDA stream to use, default 0
+ */
+void insert_bloom_filter_values(column_device_view const& col,
+                                size_type first_row,
+                                size_type num_rows,
+                                device_span<uint32_t> bitset,
+                                rmm::cuda_stream_view stream);
+
+/**
+ * @brief Returns whether `insert_bloom_filter_values` supports columns of a type
+ */
+bool is_bloom_filter_supported(data_type type);
+
 }  // namespace gpu
 }  // namespace parquet
 }  // namespace io
@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file partitioned_writer.cpp
+ * @brief cuDF-IO writer of Hive-partitioned Parquet datasets
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/strings/convert/convert_booleans.hpp>
+#include <cudf/strings/convert/convert_datetime.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/unary.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <list>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace parquet {
+
+namespace {
+
+constexpr char const* hive_default_partition = "__HIVE_DEFAULT_PARTITION__";
+
+// Printable characters escaped by Hive in partition directory names
+constexpr std::string_view reserved_path_chars = "\"#%'*/:=?\\{[]^";
+
+/**
+ * @brief Escapes the characters that cannot appear in a Hive partition directory name
+ */
+std::string escape_path_name(std::string const& name)
+{
+  std::string escaped;
+  escaped.reserve(name.size());
+  for (unsigned char const c : name) {
+    if (c < 0x20 || c == 0x7f || reserved_path_chars.find(c) != std::string_view::npos) {
+      char hex[4];
+      std::snprintf(hex, sizeof(hex), "%%%02X", c);
+      escaped += hex;
+    } else {
+      escaped += static_cast<char>(c);
+    }
+  }
+  return escaped;
+}
+
+/**
+ * @brief Converts a partition key column to the strings used in the directory names
+ */
+std::unique_ptr<column> keys_to_strings(column_view const& keys)
+{
+  auto const type = keys.type();
+  if (type.id() == type_id::STRING) { return std::make_unique<column>(keys); }
+  if (type.id() == type_id::BOOL8) { return strings::from_booleans(keys); }
+  if (type.id() == type_id::TIMESTAMP_DAYS) { return strings::from_timestamps(keys, "%Y-%m-%d"); }
+  if (is_timestamp(type)) { return strings::from_timestamps(keys, "%Y-%m-%d %H:%M:%S"); }
+  CUDF_EXPECTS(is_integral(type), "Unsupported partition key type");
+  return strings::from_integers(keys);
+}
+
+/**
+ * @brief Copies a strings column to host, with null elements as `std::nullopt`
+ */
+std::vector<std::optional<std::string>> strings_to_host(column_view const& col,
+                                                        rmm::cuda_stream_view stream)
+{
+  strings_column_view const scv{col};
+  auto const offsets = cudf::detail::make_std_vector_sync(
+    device_span<offset_type const>{scv.offsets().data<offset_type>() + col.offset(),
+                                   static_cast<size_t>(col.size() + 1)},
+    stream);
+  auto const chars = cudf::detail::make_std_vector_sync(
+    device_span<char const>{scv.chars().data<char>(), static_cast<size_t>(scv.chars_size())},
+    stream);
+  // BOOL8 elements are copied as bytes, as std::vector<bool> has no contiguous storage
+  std::vector<uint8_t> valid(col.size(), 1);
+  if (col.nullable()) {
+    auto const is_valid_col = cudf::is_valid(col);
+    valid                   = cudf::detail::make_std_vector_sync(
+      device_span<uint8_t const>{is_valid_col->view().data<uint8_t>(),
+                                 static_cast<size_t>(col.size())},
+      stream);
+  }
+
+  std::vector<std::optional<std::string>> strings(col.size());
+  for (size_type i = 0; i < col.size(); ++i) {
+    if (valid[i]) {
+      strings[i] = std::string(chars.begin() + offsets[i], chars.begin() + offsets[i + 1]);
+    }
+  }
+  return strings;
+}
+
+}  // namespace
+
+/**
+ * @brief Implementation of the partitioned writer
+ *
+ * Each partition, identified by its directory, has at most one open chunked writer. Open writers
+ * are kept in least-recently-written order so that the oldest one is closed when the number of
+ * open files reaches its limit.
+ */
+class partitioned_writer::impl {
+ public:
+  impl(partitioned_parquet_writer_options const& options,
+       rmm::cuda_stream_view stream,
+       rmm::mr::device_memory_resource* mr)
+    : _options(options), _stream(stream), _mr(mr)
+  {
+    CUDF_EXPECTS(not _options.get_partition_cols().empty(),
+                 "At least one partition key column is required");
+  }
+
+  ~impl() { close(); }
+
+  void write(table_view const& table)
+  {
+    CUDF_EXPECTS(not _closed, "Data has already been flushed to out and closed");
+    auto const& key_cols = _options.get_partition_cols();
+    for (auto const col : key_cols) {
+      CUDF_EXPECTS(col >= 0 && col < table.num_columns(), "Partition key column out of range");
+    }
+    std::vector<size_type> value_cols;
+    for (size_type col = 0; col < table.num_columns(); ++col) {
+      if (std::find(key_cols.begin(), key_cols.end(), col) == key_cols.end()) {
+        value_cols.push_back(col);
+      }
+    }
+    CUDF_EXPECTS(not value_cols.empty(), "All columns of the table are partition keys");
+    if (not _value_metadata.has_value()) { init_metadata(table, value_cols); }
+    if (table.num_rows() == 0) { return; }
+
+    // Sort-based grouping leaves the rows of each partition contiguous in the values table
+    auto const keys = table.select(key_cols);
+    cudf::groupby::groupby grouper(keys, null_policy::INCLUDE);
+    auto const groups     = grouper.get_groups(table.select(value_cols), _stream, _mr);
+    auto const num_groups = static_cast<size_type>(groups.offsets.size()) - 1;
+
+    auto const dirs   = partition_directories(groups.keys->view(), groups.offsets);
+    auto const values = groups.values->view();
+    for (size_type g = 0; g < num_groups; ++g) {
+      auto begin     = groups.offsets[g];
+      auto const end = groups.offsets[g + 1];
+      while (begin < end) {
+        auto& file      = open_file(dirs[g]);
+        auto const room = _options.get_max_rows_per_file() > 0
+                            ? _options.get_max_rows_per_file() - file.num_rows
+                            : end - begin;
+        auto const count = std::min(end - begin, room);
+        file.writer->write(cudf::slice(values, {begin, begin + count})[0]);
+        file.num_rows += count;
+        begin += count;
+        if (file.num_rows == _options.get_max_rows_per_file()) { close_file(dirs[g]); }
+      }
+    }
+  }
+
+  std::vector<std::string> close()
+  {
+    if (_closed) { return {}; }
+    while (not _lru.empty()) {
+      close_file(_lru.front());
+    }
+    _closed = true;
+    return std::move(_files);
+  }
+
+ private:
+  struct partition_file {
+    std::unique_ptr<parquet_chunked_writer> writer;
+    size_type num_rows = 0;
+    std::list<std::string>::iterator lru_pos;
+  };
+
+  /**
+   * @brief Records the names of the partition keys and the metadata of the other columns
+   */
+  void init_metadata(table_view const& table, std::vector<size_type> const& value_cols)
+  {
+    auto const* metadata = _options.get_metadata();
+    CUDF_EXPECTS(metadata != nullptr &&
+                   metadata->column_metadata.size() == static_cast<size_t>(table.num_columns()),
+                 "The metadata must describe all the columns of the table");
+    for (auto const col : _options.get_partition_cols()) {
+      auto const& name = metadata->column_metadata[col].get_name();
+      CUDF_EXPECTS(not name.empty(), "Partition key columns must be named");
+      _key_names.push_back(escape_path_name(name));
+    }
+    _value_metadata.emplace();
+    for (auto const col : value_cols) {
+      _value_metadata->column_metadata.push_back(metadata->column_metadata[col]);
+    }
+  }
+
+  /**
+   * @brief Builds the directory of each group, relative to the base path
+   */
+  std::vector<std::string> partition_directories(table_view const& sorted_keys,
+                                                 std::vector<size_type> const& offsets)
+  {
+    auto const num_groups = offsets.size() - 1;
+    auto const first_rows = cudf::detail::make_device_uvector_sync(
+      host_span<size_type const>{offsets.data(), num_groups}, _stream);
+    auto const gather_map = column_view{
+      data_type{type_to_id<size_type>()}, static_cast<size_type>(num_groups), first_rows.data()};
+    auto const unique_keys = cudf::gather(sorted_keys, gather_map);
+
+    std::vector<std::string> dirs(num_groups);
+    for (size_type k = 0; k < unique_keys->num_columns(); ++k) {
+      auto const key_strings = keys_to_strings(unique_keys->get_column(k));
+      auto const values      = strings_to_host(key_strings->view(), _stream);
+      for (size_t g = 0; g < num_groups; ++g) {
+        dirs[g] += _key_names[k] + "=" +
+                   (values[g].has_value() ? escape_path_name(values[g].value())
+                                          : std::string{hive_default_partition}) +
+                   "/";
+      }
+    }
+    return dirs;
+  }
+
+  /**
+   * @brief Returns the open file of a partition, creating one if needed
+   */
+  partition_file& open_file(std::string const& dir)
+  {
+    auto it = _open_files.find(dir);
+    if (it != _open_files.end()) {
+      _lru.splice(_lru.end(), _lru, it->second.lru_pos);
+      return it->second;
+    }
+    if (static_cast<size_type>(_open_files.size()) == _options.get_max_open_files()) {
+      close_file(_lru.front());
+    }
+
+    auto const file_index = _num_files[dir]++;
+    char file_name[32];
+    std::snprintf(file_name, sizeof(file_name), "-%05d.parquet", file_index);
+    auto const relative_path = dir + _options.get_file_prefix() + file_name;
+    auto const path          = std::filesystem::path{_options.get_base_path()} / relative_path;
+    std::filesystem::create_directories(path.parent_path());
+
+    auto const writer_options =
+      chunked_parquet_writer_options::builder(sink_info{path.string()})
+        .compression(_options.get_compression())
+        .stats_level(_options.get_stats_level())
+        .metadata(&_value_metadata.value())
+        .build();
+    _files.push_back(relative_path);
+    _lru.push_back(dir);
+    auto& file   = _open_files[dir];
+    file.writer  = std::make_unique<parquet_chunked_writer>(writer_options, _mr);
+    file.lru_pos = std::prev(_lru.end());
+    return file;
+  }
+
+  /**
+   * @brief Closes the open file of a partition
+   *
+   * @param dir Directory of the partition, taken by value as it may refer to an element of `_lru`
+   */
+  void close_file(std::string dir)
+  {
+    auto it = _open_files.find(dir);
+    it->second.writer->close();
+    _lru.erase(it->second.lru_pos);
+    _open_files.erase(it);
+  }
+
+  partitioned_parquet_writer_options const _options;
+  rmm::cuda_stream_view _stream;
+  rmm::mr::device_memory_resource* _mr;
+
+  std::vector<std::string> _key_names;
+  std::optional<table_input_metadata> _value_metadata;
+  std::unordered_map<std::string, partition_file> _open_files;
+  std::list<std::string> _lru;  // Directories of the open files, least recently written first
+  std::unordered_map<std::string, size_type> _num_files;
+  std::vector<std::string> _files;
+  bool _closed = false;
+};
+
+partitioned_writer::partitioned_writer(partitioned_parquet_writer_options const& options,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+  : _impl(std::make_unique<impl>(options, stream, mr))
+{
+}
+
+partitioned_writer::~partitioned_writer() = default;
+
+void partitioned_writer::write(table_view const& table) { _impl->write(table); }
+
+std::vector<std::string> partitioned_writer::close() { return _impl->close(); }
+
+}  // namespace parquet
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,526 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "predicate_pushdown.hpp"
+
+#include "bloom_filter.hpp"
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace parquet {
+
+namespace {
+
+/**
+ * @brief Reads a plain-encoded physical value of type `T` from a statistics field
+ */
+template <typename T>
+std::optional<T> read_plain(std::vector<uint8_t> const& bytes)
+{
+  if (bytes.size() != sizeof(T)) { return std::nullopt; }
+  T value;
+  std::memcpy(&value, bytes.data(), sizeof(T));
+  return value;
+}
+
+/**
+ * @brief Converts a plain-encoded statistics value to its comparable representation
+ */
+std::optional<stats_value> to_stats_value(std::vector<uint8_t> const& bytes,
+                                          Type physical,
+                                          type_id id)
+{
+  auto const is_unsigned =
+    id == type_id::UINT8 || id == type_id::UINT16 || id == type_id::UINT32 || id == type_id::UINT64;
+  switch (physical) {
+    case BOOLEAN:
+      if (bytes.size() != 1 || id != type_id::BOOL8) { return std::nullopt; }
+      return stats_value{static_cast<int64_t>(bytes[0] != 0)};
+    case INT32: {
+      if (is_fixed_point(data_type{id})) { return std::nullopt; }
+      if (is_unsigned) {
+        auto const value = read_plain<uint32_t>(bytes);
+        if (value) { return stats_value{static_cast<uint64_t>(*value)}; }
+      } else {
+        auto const value = read_plain<int32_t>(bytes);
+        if (value) { return stats_value{static_cast<int64_t>(*value)}; }
+      }
+      return std::nullopt;
+    }
+    case INT64: {
+      if (is_fixed_point(data_type{id})) { return std::nullopt; }
+      if (is_unsigned) {
+        auto const value = read_plain<uint64_t>(bytes);
+        if (value) { return stats_value{*value}; }
+      } else {
+        auto const value = read_plain<int64_t>(bytes);
+        if (value) { return stats_value{*value}; }
+      }
+      return std::nullopt;
+    }
+    case FLOAT: {
+      auto const value = read_plain<float>(bytes);
+      if (!value || std::isnan(*value)) { return std::nullopt; }
+      return stats_value{static_cast<double>(*value)};
+    }
+    case DOUBLE: {
+      auto const value = read_plain<double>(bytes);
+      if (!value || std::isnan(*value)) { return std::nullopt; }
+      return stats_value{*value};
+    }
+    default: return std::nullopt;
+  }
+}
+
+/**
+ * @brief Functor converting the value of a literal to its comparable representation
+ */
+struct literal_value_fn {
+  template <typename T>
+  std::optional<stats_value> operator()(scalar const& s, rmm::cuda_stream_view stream)
+  {
+    if constexpr (std::is_same_v<T, bool>) {
+      auto const& typed = static_cast<numeric_scalar<T> const&>(s);
+      return stats_value{static_cast<int64_t>(typed.value(stream))};
+    } else if constexpr (cudf::is_integral<T>()) {
+      auto const& typed = static_cast<numeric_scalar<T> const&>(s);
+      if constexpr (std::is_signed_v<T>) {
+        return stats_value{static_cast<int64_t>(typed.value(stream))};
+      } else {
+        return stats_value{static_cast<uint64_t>(typed.value(stream))};
+      }
+    } else if constexpr (cudf::is_floating_point<T>()) {
+      auto const value = static_cast<numeric_scalar<T> const&>(s).value(stream);
+      if (std::isnan(value)) { return std::nullopt; }
+      return stats_value{static_cast<double>(value)};
+    } else if constexpr (cudf::is_timestamp<T>()) {
+      auto const& typed = static_cast<timestamp_scalar<T> const&>(s);
+      return stats_value{static_cast<int64_t>(typed.value(stream).time_since_epoch().count())};
+    } else if constexpr (cudf::is_duration<T>()) {
+      auto const& typed = static_cast<duration_scalar<T> const&>(s);
+      return stats_value{static_cast<int64_t>(typed.value(stream).count())};
+    } else {
+      return std::nullopt;
+    }
+  }
+};
+
+/**
+ * @brief Returns the operator to use when swapping the operands of a comparison
+ */
+ast::ast_operator flip_comparison(ast::ast_operator op)
+{
+  switch (op) {
+    case ast::ast_operator::LESS: return ast::ast_operator::GREATER;
+    case ast::ast_operator::GREATER: return ast::ast_operator::LESS;
+    case ast::ast_operator::LESS_EQUAL: return ast::ast_operator::GREATER_EQUAL;
+    case ast::ast_operator::GREATER_EQUAL: return ast::ast_operator::LESS_EQUAL;
+    default: return op;
+  }
+}
+
+/**
+ * @brief Returns whether some value in `range` may satisfy `value op literal`
+ */
+bool range_may_satisfy(ast::ast_operator op,
+                       column_chunk_range const& range,
+                       stats_value const& literal)
+{
+  // comparing a null with a valid literal never evaluates to true
+  if (range.all_nulls) { return false; }
+  if (!range.min || !range.max) { return true; }
+  auto const& min = *range.min;
+  auto const& max = *range.max;
+  if (min.index() != literal.index() || max.index() != literal.index()) { return true; }
+
+  switch (op) {
+    case ast::ast_operator::EQUAL:
+    case ast::ast_operator::NULL_EQUAL: return min <= literal && literal <= max;
+    case ast::ast_operator::NOT_EQUAL: return !(min == literal && max == literal);
+    case ast::ast_operator::LESS: return min < literal;
+    case ast::ast_operator::LESS_EQUAL: return min <= literal;
+    case ast::ast_operator::GREATER: return max > literal;
+    case ast::ast_operator::GREATER_EQUAL: return max >= literal;
+    default: return true;
+  }
+}
+
+bool is_comparison(ast::ast_operator op)
+{
+  switch (op) {
+    case ast::ast_operator::EQUAL:
+    case ast::ast_operator::NULL_EQUAL:
+    case ast::ast_operator::NOT_EQUAL:
+    case ast::ast_operator::LESS:
+    case ast::ast_operator::LESS_EQUAL:
+    case ast::ast_operator::GREATER:
+    case ast::ast_operator::GREATER_EQUAL: return true;
+    default: return false;
+  }
+}
+
+/**
+ * @brief Comparison of a column with a literal value, normalized to `column op value`
+ */
+struct column_comparison {
+  ast::ast_operator op;
+  size_type column_index;
+  data_type type;
+  stats_value value;
+};
+
+/**
+ * @brief Extracts the comparison between a column reference and a valid literal, if any
+ */
+std::optional<column_comparison> to_column_comparison(ast::ast_operator op,
+                                                      ast::expression const& lhs,
+                                                      ast::expression const& rhs,
+                                                      rmm::cuda_stream_view stream)
+{
+  auto col = dynamic_cast<ast::column_reference const*>(&lhs);
+  auto lit = dynamic_cast<ast::literal const*>(&rhs);
+  if (col == nullptr || lit == nullptr) {
+    col = dynamic_cast<ast::column_reference const*>(&rhs);
+    lit = dynamic_cast<ast::literal const*>(&lhs);
+    op  = flip_comparison(op);
+  }
+  if (col == nullptr || lit == nullptr) { return std::nullopt; }
+  if (col->get_table_source() != ast::table_reference::LEFT) { return std::nullopt; }
+  if (!lit->is_valid(stream)) { return std::nullopt; }
+
+  auto const& s    = lit->get_scalar();
+  auto const value = type_dispatcher(s.type(), literal_value_fn{}, s, stream);
+  if (!value) { return std::nullopt; }
+  return column_comparison{op, col->get_column_index(), lit->get_data_type(), *value};
+}
+
+/**
+ * @brief Evaluates a comparison between a column reference and a literal
+ */
+bool comparison_may_satisfy(ast::ast_operator op,
+                            ast::expression const& lhs,
+                            ast::expression const& rhs,
+                            column_range_fn const& column_range,
+                            rmm::cuda_stream_view stream)
+{
+  auto const comparison = to_column_comparison(op, lhs, rhs, stream);
+  if (!comparison) { return true; }
+
+  auto const range = column_range(comparison->column_index);
+  if (!range || range->type != comparison->type) { return true; }
+  return range_may_satisfy(comparison->op, *range, comparison->value);
+}
+
+/**
+ * @brief Returns the smallest row range holding every page that may satisfy a comparison
+ */
+row_range comparison_candidate_rows(ast::ast_operator op,
+                                    ast::expression const& lhs,
+                                    ast::expression const& rhs,
+                                    page_ranges_fn const& page_ranges,
+                                    row_range all_rows,
+                                    rmm::cuda_stream_view stream)
+{
+  auto const comparison = to_column_comparison(op, lhs, rhs, stream);
+  if (!comparison) { return all_rows; }
+
+  auto const pages = page_ranges(comparison->column_index);
+  if (!pages) { return all_rows; }
+
+  row_range candidates{all_rows.second, all_rows.first};
+  for (auto const& page : *pages) {
+    if (page.values.type != comparison->type ||
+        range_may_satisfy(comparison->op, page.values, comparison->value)) {
+      candidates.first  = std::min(candidates.first, page.rows.first);
+      candidates.second = std::max(candidates.second, page.rows.second);
+    }
+  }
+  return candidates;
+}
+
+/**
+ * @brief Hashes a literal value in the plain encoding of a column's physical type
+ *
+ * @return The hash, or `std::nullopt` if the value's physical representation is not known
+ */
+std::optional<uint64_t> plain_value_hash(stats_value const& value, Type physical, data_type type)
+{
+  // chrono, decimal and boolean columns may be stored in another representation than the
+  // literal's value
+  if (!(is_integral(type) && type.id() != type_id::BOOL8) && !is_floating_point(type)) {
+    return std::nullopt;
+  }
+  auto hash = [](auto v) { return xxhash64(reinterpret_cast<uint8_t const*>(&v), sizeof(v)); };
+  switch (physical) {
+    case INT32:
+      if (auto const i = std::get_if<int64_t>(&value)) {
+        if (*i < std::numeric_limits<int32_t>::min() || *i > std::numeric_limits<int32_t>::max()) {
+          return std::nullopt;
+        }
+        return hash(static_cast<int32_t>(*i));
+      }
+      if (auto const u = std::get_if<uint64_t>(&value)) {
+        if (*u > std::numeric_limits<uint32_t>::max()) { return std::nullopt; }
+        return hash(static_cast<uint32_t>(*u));
+      }
+      return std::nullopt;
+    case INT64:
+      if (auto const i = std::get_if<int64_t>(&value)) { return hash(*i); }
+      if (auto const u = std::get_if<uint64_t>(&value)) { return hash(*u); }
+      return std::nullopt;
+    case FLOAT:
+    case DOUBLE: {
+      auto const d = std::get_if<double>(&value);
+      // zero compares equal to negative zero, which hashes differently
+      if (d == nullptr || *d == 0.0) { return std::nullopt; }
+      return (physical == FLOAT) ? hash(static_cast<float>(*d)) : hash(*d);
+    }
+    default: return std::nullopt;
+  }
+}
+
+/**
+ * @brief Evaluates an equality comparison between a column reference and a literal
+ */
+bool comparison_may_contain(ast::ast_operator op,
+                            ast::expression const& lhs,
+                            ast::expression const& rhs,
+                            bloom_filter_fn const& bloom_filter,
+                            rmm::cuda_stream_view stream)
+{
+  auto const comparison = to_column_comparison(op, lhs, rhs, stream);
+  if (!comparison) { return true; }
+  if (comparison->op != ast::ast_operator::EQUAL &&
+      comparison->op != ast::ast_operator::NULL_EQUAL) {
+    return true;
+  }
+
+  auto const filter = bloom_filter(comparison->column_index);
+  if (!filter || filter->type != comparison->type) { return true; }
+  auto const hash = plain_value_hash(comparison->value, filter->physical_type, filter->type);
+  if (!hash) { return true; }
+  return bloom_filter_contains(filter->bitset, filter->num_bytes, *hash);
+}
+
+/**
+ * @brief Appends the columns compared for equality with a literal to `columns`
+ */
+void collect_equality_columns(ast::expression const& filter,
+                              std::vector<size_type>& columns,
+                              rmm::cuda_stream_view stream)
+{
+  auto const op = dynamic_cast<ast::operation const*>(&filter);
+  if (op == nullptr) { return; }
+
+  auto const operands = op->get_operands();
+  switch (op->get_operator()) {
+    case ast::ast_operator::LOGICAL_AND:
+    case ast::ast_operator::NULL_LOGICAL_AND:
+    case ast::ast_operator::LOGICAL_OR:
+    case ast::ast_operator::NULL_LOGICAL_OR:
+      collect_equality_columns(operands[0].get(), columns, stream);
+      collect_equality_columns(operands[1].get(), columns, stream);
+      return;
+    case ast::ast_operator::EQUAL:
+    case ast::ast_operator::NULL_EQUAL: {
+      if (operands.size() != 2) { return; }
+      auto const comparison =
+        to_column_comparison(op->get_operator(), operands[0].get(), operands[1].get(), stream);
+      if (comparison) { columns.push_back(comparison->column_index); }
+      return;
+    }
+    default: return;
+  }
+}
+
+}  // namespace
+
+std::optional<column_chunk_range> decode_column_chunk_range(ColumnChunkMetaData const& meta,
+                                                            SchemaElement const& schema,
+                                                            data_type type,
+                                                            int64_t num_rows)
+{
+  if (meta.statistics_blob.empty()) { return std::nullopt; }
+
+  Statistics stats;
+  CompactProtocolReader cp(meta.statistics_blob.data(), meta.statistics_blob.size());
+  if (!cp.read(&stats)) { return std::nullopt; }
+
+  column_chunk_range range;
+  range.type      = type;
+  range.all_nulls = stats.null_count >= 0 && stats.null_count == num_rows;
+
+  // min/max are only meaningful for flat columns
+  if (schema.max_repetition_level != 0) { return range; }
+
+  auto const is_unsigned = type.id() == type_id::UINT8 || type.id() == type_id::UINT16 ||
+                           type.id() == type_id::UINT32 || type.id() == type_id::UINT64;
+  auto const* min = &stats.min_value;
+  auto const* max = &stats.max_value;
+  if (min->empty() || max->empty()) {
+    // The deprecated fields use signed comparison and are not valid for unsigned columns
+    if (is_unsigned) { return range; }
+    min = &stats.min;
+    max = &stats.max;
+  }
+  range.min = to_stats_value(*min, schema.type, type.id());
+  range.max = to_stats_value(*max, schema.type, type.id());
+  return range;
+}
+
+bool may_satisfy(ast::expression const& filter,
+                 column_range_fn const& column_range,
+                 rmm::cuda_stream_view stream)
+{
+  auto const op = dynamic_cast<ast::operation const*>(&filter);
+  if (op == nullptr) { return true; }
+
+  auto const operands = op->get_operands();
+  switch (op->get_operator()) {
+    case ast::ast_operator::LOGICAL_AND:
+    case ast::ast_operator::NULL_LOGICAL_AND:
+      return may_satisfy(operands[0].get(), column_range, stream) &&
+             may_satisfy(operands[1].get(), column_range, stream);
+    case ast::ast_operator::LOGICAL_OR:
+    case ast::ast_operator::NULL_LOGICAL_OR:
+      return may_satisfy(operands[0].get(), column_range, stream) ||
+             may_satisfy(operands[1].get(), column_range, stream);
+    default: break;
+  }
+
+  if (is_comparison(op->get_operator()) && operands.size() == 2) {
+    return comparison_may_satisfy(
+      op->get_operator(), operands[0].get(), operands[1].get(), column_range, stream);
+  }
+  return true;
+}
+
+std::optional<std::vector<page_range>> decode_page_ranges(ColumnIndex const& column_index,
+                                                          OffsetIndex const& offset_index,
+                                                          SchemaElement const& schema,
+                                                          data_type type,
+                                                          size_type num_rows)
+{
+  auto const& locations = offset_index.page_locations;
+  auto const num_pages  = locations.size();
+  if (num_pages == 0 || column_index.null_pages.size() != num_pages ||
+      column_index.min_values.size() != num_pages || column_index.max_values.size() != num_pages) {
+    return std::nullopt;
+  }
+
+  std::vector<page_range> pages(num_pages);
+  for (size_t i = 0; i < num_pages; ++i) {
+    auto const next_row   = (i + 1 < num_pages) ? locations[i + 1].first_row_index : num_rows;
+    auto& page            = pages[i];
+    page.rows             = {static_cast<size_type>(locations[i].first_row_index),
+                             static_cast<size_type>(next_row)};
+    page.values.type      = type;
+    page.values.all_nulls = column_index.null_pages[i];
+    // min/max are only meaningful for flat columns
+    if (schema.max_repetition_level == 0 && !page.values.all_nulls) {
+      page.values.min = to_stats_value(column_index.min_values[i], schema.type, type.id());
+      page.values.max = to_stats_value(column_index.max_values[i], schema.type, type.id());
+    }
+  }
+  return pages;
+}
+
+row_range candidate_rows(ast::expression const& filter,
+                         page_ranges_fn const& page_ranges,
+                         size_type num_rows,
+                         rmm::cuda_stream_view stream)
+{
+  row_range const all_rows{0, num_rows};
+  auto const op = dynamic_cast<ast::operation const*>(&filter);
+  if (op == nullptr) { return all_rows; }
+
+  auto const operands = op->get_operands();
+  switch (op->get_operator()) {
+    case ast::ast_operator::LOGICAL_AND:
+    case ast::ast_operator::NULL_LOGICAL_AND: {
+      auto const lhs = candidate_rows(operands[0].get(), page_ranges, num_rows, stream);
+      auto const rhs = candidate_rows(operands[1].get(), page_ranges, num_rows, stream);
+      return {std::max(lhs.first, rhs.first), std::min(lhs.second, rhs.second)};
+    }
+    case ast::ast_operator::LOGICAL_OR:
+    case ast::ast_operator::NULL_LOGICAL_OR: {
+      auto const lhs = candidate_rows(operands[0].get(), page_ranges, num_rows, stream);
+      auto const rhs = candidate_rows(operands[1].get(), page_ranges, num_rows, stream);
+      if (lhs.first >= lhs.second) { return rhs; }
+      if (rhs.first >= rhs.second) { return lhs; }
+      return {std::min(lhs.first, rhs.first), std::max(lhs.second, rhs.second)};
+    }
+    default: break;
+  }
+
+  if (is_comparison(op->get_operator()) && operands.size() == 2) {
+    return comparison_candidate_rows(
+      op->get_operator(), operands[0].get(), operands[1].get(), page_ranges, all_rows, stream);
+  }
+  return all_rows;
+}
+
+std::vector<size_type> equality_columns(ast::expression const& filter,
+                                        rmm::cuda_stream_view stream)
+{
+  std::vector<size_type> columns;
+  collect_equality_columns(filter, columns, stream);
+  std::sort(columns.begin(), columns.end());
+  columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+  return columns;
+}
+
+bool may_contain(ast::expression const& filter,
+                 bloom_filter_fn const& bloom_filter,
+                 rmm::cuda_stream_view stream)
+{
+  auto const op = dynamic_cast<ast::operation const*>(&filter);
+  if (op == nullptr) { return true; }
+
+  auto const operands = op->get_operands();
+  switch (op->get_operator()) {
+    case ast::ast_operator::LOGICAL_AND:
+    case ast::ast_operator::NULL_LOGICAL_AND:
+      return may_contain(operands[0].get(), bloom_filter, stream) &&
+             may_contain(operands[1].get(), bloom_filter, stream);
+    case ast::ast_operator::LOGICAL_OR:
+    case ast::ast_operator::NULL_LOGICAL_OR:
+      return may_contain(operands[0].get(), bloom_filter, stream) ||
+             may_contain(operands[1].get(), bloom_filter, stream);
+    default: break;
+  }
+
+  if (is_comparison(op->get_operator()) && operands.size() == 2) {
+    return comparison_may_contain(
+      op->get_operator(), operands[0].get(), operands[1].get(), bloom_filter, stream);
+  }
+  return true;
+}
+
+}  // namespace parquet
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
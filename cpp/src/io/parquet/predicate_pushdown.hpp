@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file predicate_pushdown.hpp
+ * @brief Evaluation of reader filters against Parquet column and page statistics
+ */
+
+#pragma once
+
+#include "parquet.hpp"
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <functional>
+#include <optional>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace parquet {
+using namespace cudf::io::parquet;
+
+/**
+ * @brief Comparable representation of a statistics or literal value.
+ *
+ * Signed integral, boolean and chrono values are held as `int64_t`, unsigned integral values as
+ * `uint64_t` and floating point values as `double`. Two values of the same cudf type always hold
+ * the same alternative.
+ */
+using stats_value = std::variant<int64_t, uint64_t, double>;
+
+/**
+ * @brief Range of the values of a column chunk, as recorded in its statistics
+ */
+struct column_chunk_range {
+  data_type type{type_id::EMPTY};  // Output type of the column
+  std::optional<stats_value> min;  // Smallest non-null value, if known
+  std::optional<stats_value> max;  // Largest non-null value, if known
+  bool all_nulls = false;          // Whether the chunk is known to only hold nulls
+};
+
+/**
+ * @brief Decodes the value range of a column chunk from its encoded statistics.
+ *
+ * Only flat columns with a fixed-width physical type whose values map directly onto `type`
+ * produce a min/max range; for other columns only the null information is returned.
+ *
+ * @param meta Column chunk metadata holding the encoded statistics
+ * @param schema Schema element of the column
+ * @param type cuDF type the physical values are interpreted as
+ * @param num_rows Number of rows in the row group
+ *
+ * @return The value range, or `std::nullopt` if the chunk has no readable statistics
+ */
+std::optional<column_chunk_range> decode_column_chunk_range(ColumnChunkMetaData const& meta,
+                                                            SchemaElement const& schema,
+                                                            data_type type,
+                                                            int64_t num_rows);
+
+/**
+ * @brief Callback returning the value range of the column chunk of a referenced column
+ *
+ * The argument is the `column_reference` index; `std::nullopt` means nothing is known.
+ */
+using column_range_fn = std::function<std::optional<column_chunk_range>(size_type)>;
+
+/**
+ * @brief Determines whether a row group may contain rows that satisfy a filter.
+ *
+ * The evaluation is conservative: `false` is only returned when the statistics prove that no
+ * row of the row group can satisfy `filter`. Comparisons between a column reference and a
+ * literal of the same type, combined with logical AND/OR, are evaluated; any other expression
+ * is assumed to possibly be satisfied.
+ *
+ * @param filter Boolean expression over the columns of the output table
+ * @param column_range Callback returning the statistics of a referenced column
+ * @param stream CUDA stream used to copy literal values to the host
+ *
+ * @return `false` if no row can satisfy the filter, `true` otherwise
+ */
+bool may_satisfy(ast::expression const& filter,
+                 column_range_fn const& column_range,
+                 rmm::cuda_stream_view stream);
+
+/**
+ * @brief Range `[first, second)` of rows within a row group
+ */
+using row_range = std::pair<size_type, size_type>;
+
+/**
+ * @brief Rows and value range of a data page, as recorded in the page index
+ */
+struct page_range {
+  row_range rows;             // Rows of the row group held by the page
+  column_chunk_range values;  // Range of the values of the page
+};
+
+/**
+ * @brief Decodes the value ranges of the pages of a column chunk from its page index.
+ *
+ * @param column_index Page statistics of the column chunk
+ * @param offset_index Page locations of the column chunk
+ * @param schema Schema element of the column
+ * @param type cuDF type the physical values are interpreted as
+ * @param num_rows Number of rows in the row group
+ *
+ * @return The value ranges of all data pages, or `std::nullopt` if the page index is inconsistent
+ */
+std::optional<std::vector<page_range>> decode_page_ranges(ColumnIndex const& column_index,
+                                                          OffsetIndex const& offset_index,
+                                                          SchemaElement const& schema,
+                                                          data_type type,
+                                                          size_type num_rows);
+
+/**
+ * @brief Callback returning the page ranges of the column chunk of a referenced column
+ *
+ * The argument is the `column_reference` index; `std::nullopt` means nothing is known.
+ */
+using page_ranges_fn = std::function<std::optional<std::vector<page_range>>(size_type)>;
+
+/**
+ * @brief Computes the smallest range of rows of a row group that holds every row that may
+ * satisfy a filter.
+ *
+ * Like `may_satisfy`, the evaluation is conservative and works on the same expressions, using
+ * the value ranges of individual pages instead of those of whole column chunks.
+ *
+ * @param filter Boolean expression over the columns of the output table
+ * @param page_ranges Callback returning the page ranges of a referenced column
+ * @param num_rows Number of rows in the row group
+ * @param stream CUDA stream used to copy literal values to the host
+ *
+ * @return The candidate rows; the range is empty if no row can satisfy the filter
+ */
+row_range candidate_rows(ast::expression const& filter,
+                         page_ranges_fn const& page_ranges,
+                         size_type num_rows,
+                         rmm::cuda_stream_view stream);
+
+/**
+ * @brief Split-block bloom filter of a column chunk
+ */
+struct column_chunk_bloom_filter {
+  data_type type{type_id::EMPTY};       // Output type of the column
+  Type physical_type = UNDEFINED_TYPE;  // Physical type of the hashed values
+  uint8_t const* bitset = nullptr;      // Bitset of the filter
+  size_t num_bytes      = 0;            // Size of the bitset, in bytes
+};
+
+/**
+ * @brief Callback returning the bloom filter of the column chunk of a referenced column
+ *
+ * The argument is the `column_reference` index; `std::nullopt` means nothing is known.
+ */
+using bloom_filter_fn = std::function<std::optional<column_chunk_bloom_filter>(size_type)>;
+
+/**
+ * @brief Returns the columns compared for equality with a literal by a filter.
+ *
+ * Only the comparisons `may_contain` can evaluate are considered, so a row group's bloom filters
+ * only need to be read for the returned columns.
+ *
+ * @param filter Boolean expression over the columns of the output table
+ * @param stream CUDA stream used to copy literal values to the host
+ *
+ * @return The sorted, unique `column_reference` indices
+ */
+std::vector<size_type> equality_columns(ast::expression const& filter,
+                                        rmm::cuda_stream_view stream);
+
+/**
+ * @brief Determines whether a row group may contain rows that satisfy a filter, using the bloom
+ * filters of its column chunks.
+ *
+ * Equality comparisons between a column reference and a literal of the same integral or floating
+ * point type, combined with logical AND/OR, are evaluated; the literal is hashed in the physical
+ * representation of the column and looked up in its bloom filter. Any other expression is
+ * assumed to possibly be satisfied.
+ *
+ * @param filter Boolean expression over the columns of the output table
+ * @param bloom_filter Callback returning the bloom filter of a referenced column
+ * @param stream CUDA stream used to copy literal values to the host
+ *
+ * @return `false` if no row can satisfy the filter, `true` otherwise
+ */
+bool may_contain(ast::expression const& filter,
+                 bloom_filter_fn const& bloom_filter,
+                 rmm::cuda_stream_view stream);
+
+}  // namespace parquet
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
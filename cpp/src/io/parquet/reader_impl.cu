@@ -19,13 +19,28 @@
  * @brief cuDF-IO Parquet reader class implementation
  */
 
+#include "bloom_filter.hpp"
+#include "predicate_pushdown.hpp"
 #include "reader_impl.hpp"
 
+#include <io/comp/decompression.hpp>
 #include <io/comp/gpuinflate.h>
-#include <io/utilities/config_utils.hpp>
+#include <io/utilities/thread_pool.hpp>
 #include <io/utilities/time_utils.cuh>
 
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/metrics.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
@@ -35,12 +50,24 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
-#include <nvcomp/snappy.h>
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
 
 #include <algorithm>
 #include <array>
+#include <future>
+#include <map>
 #include <numeric>
 #include <regex>
+#include <set>
+#include <tuple>
+#include <utility>
 
 namespace cudf {
 namespace io {
@@ -54,8 +81,26 @@ using namespace cudf::io;
 constexpr uint32_t PARQUET_COLUMN_BUFFER_SCHEMA_MASK          = (0xffffff);
 constexpr uint32_t PARQUET_COLUMN_BUFFER_FLAG_LIST_TERMINATED = (1 << 24);
 
+// page index structures at most this many bytes apart are fetched with a single read
+constexpr size_t PAGE_INDEX_MAX_READ_GAP = 1024 * 1024;
+
 namespace {
 
+/**
+ * @brief Function that translates Parquet compression to GDF compression
+ */
+compression_type to_compression_type(parquet::Compression compression)
+{
+  switch (compression) {
+    case parquet::GZIP: return compression_type::GZIP;
+    case parquet::SNAPPY: return compression_type::SNAPPY;
+    case parquet::BROTLI: return compression_type::BROTLI;
+    case parquet::ZSTD: return compression_type::ZSTD;
+    case parquet::LZ4_RAW: return compression_type::LZ4;
+    default: CUDF_FAIL("Unexpected decompression dispatch");
+  }
+}
+
 parquet::ConvertedType logical_type_to_converted_type(parquet::LogicalType const& logical)
 {
   if (logical.isset.STRING) {
@@ -235,6 +280,371 @@ std::tuple<int32_t, int32_t, int8_t> conversion_info(type_id column_type_id,
   return std::make_tuple(type_width, clock_rate, converted_type);
 }
 
+/**
+ * @brief Data pages of a column chunk selected through its offset index
+ */
+struct page_selection {
+  size_t io_offset;   // File offset of the selected chunk data
+  size_t io_size;     // Size of the selected chunk data, excluding the gap
+  size_t gap_offset;  // Offset of the skipped pages relative to `io_offset`
+  size_t gap_size;    // Size of the skipped pages between the dictionary and the selected pages
+  size_t first_row;   // Index of the first row of the selected pages within the row group
+  size_t num_rows;    // Number of rows held by the selected pages
+  size_t num_skipped_pages;  // Number of data pages that are not read
+};
+
+/**
+ * @brief Selects the data pages of a flat column chunk that hold a range of rows
+ *
+ * @param locations Page locations from the offset index of the column chunk
+ * @param chunk_offset File offset of the column chunk, including its dictionary page
+ * @param chunk_size Compressed size of the column chunk
+ * @param first_row First row to read, relative to the row group
+ * @param end_row End of the rows to read, relative to the row group
+ * @param num_rows Number of rows in the row group
+ *
+ * @return The selected pages, or `std::nullopt` if no page can be skipped or the offset index is
+ * inconsistent with the column chunk
+ */
+std::optional<page_selection> select_pages(std::vector<PageLocation> const& locations,
+                                           size_t chunk_offset,
+                                           size_t chunk_size,
+                                           size_t first_row,
+                                           size_t end_row,
+                                           size_t num_rows)
+{
+  if (locations.empty() || first_row >= end_row || locations.front().first_row_index != 0) {
+    return std::nullopt;
+  }
+  for (size_t i = 0; i < locations.size(); ++i) {
+    auto const& page = locations[i];
+    if (page.offset < static_cast<int64_t>(chunk_offset) || page.compressed_page_size <= 0 ||
+        page.offset + page.compressed_page_size > static_cast<int64_t>(chunk_offset + chunk_size)) {
+      return std::nullopt;
+    }
+    if (i > 0 && (page.offset < locations[i - 1].offset + locations[i - 1].compressed_page_size ||
+                  page.first_row_index <= locations[i - 1].first_row_index)) {
+      return std::nullopt;
+    }
+  }
+
+  // the last pages starting at or before the first and the last rows to read
+  auto const page_of_row = [&](size_t row) -> size_t {
+    auto const it = std::upper_bound(
+      locations.cbegin(), locations.cend(), row, [](size_t row, PageLocation const& page) {
+        return static_cast<int64_t>(row) < page.first_row_index;
+      });
+    return std::distance(locations.cbegin(), it) - 1;
+  };
+  auto const first_page = page_of_row(first_row);
+  auto const last_page  = page_of_row(end_row - 1);
+  if (first_page == 0 && last_page == locations.size() - 1) { return std::nullopt; }
+
+  auto const data_offset  = static_cast<size_t>(locations.front().offset);
+  auto const pages_offset = static_cast<size_t>(locations[first_page].offset);
+  auto const pages_end =
+    static_cast<size_t>(locations[last_page].offset + locations[last_page].compressed_page_size);
+
+  page_selection selection{};
+  selection.first_row = locations[first_page].first_row_index;
+  selection.num_rows  = ((last_page + 1 < locations.size())
+                          ? static_cast<size_t>(locations[last_page + 1].first_row_index)
+                          : num_rows) -
+                       selection.first_row;
+  if (first_page == 0) {
+    selection.io_offset = chunk_offset;
+  } else if (data_offset == chunk_offset) {
+    // no dictionary page, the selected pages are read on their own
+    selection.io_offset = pages_offset;
+  } else {
+    // the dictionary page is kept and the pages in between are skipped
+    selection.io_offset  = chunk_offset;
+    selection.gap_offset = data_offset - chunk_offset;
+    selection.gap_size   = pages_offset - data_offset;
+  }
+  selection.io_size          = pages_end - selection.io_offset - selection.gap_size;
+  selection.num_skipped_pages = locations.size() - (last_page + 1 - first_page);
+  return selection;
+}
+
+/**
+ * @brief Groups the column chunks of consecutive row groups into batches of about
+ * `max_batch_size` compressed bytes
+ *
+ * @param row_group_chunks Range of column chunks of each row group
+ * @param chunks Column chunk descriptors
+ * @param max_batch_size Compressed size at which a batch ends
+ *
+ * @return Range of column chunks of each batch
+ */
+std::vector<std::pair<size_t, size_t>> make_read_batches(
+  std::vector<std::pair<size_t, size_t>> const& row_group_chunks,
+  hostdevice_vector<gpu::ColumnChunkDesc> const& chunks,
+  size_t max_batch_size)
+{
+  std::vector<std::pair<size_t, size_t>> batches;
+  size_t batch_size = 0;
+  for (auto const& [begin, end] : row_group_chunks) {
+    if (batches.empty() || batch_size >= max_batch_size) {
+      batches.emplace_back(begin, end);
+      batch_size = 0;
+    } else {
+      batches.back().second = end;
+    }
+    for (auto c = begin; c < end; ++c) {
+      batch_size += chunks[c].compressed_size;
+    }
+  }
+  return batches;
+}
+
+/**
+ * @brief Bloom filter of a column chunk, as read from the file
+ */
+struct bloom_filter_data {
+  std::unique_ptr<datasource::buffer> buffer;  // Holds the bitset
+  uint8_t const* bitset = nullptr;             // Bitset of the filter, or null if unavailable
+  size_t num_bytes      = 0;                   // Size of the bitset
+};
+
+/**
+ * @brief Reads the split-block bloom filter of a column chunk
+ *
+ * @param source Source holding the column chunk
+ * @param col_meta Metadata of the column chunk
+ *
+ * @return The filter; its bitset is null if the chunk has no readable bloom filter
+ */
+bloom_filter_data read_bloom_filter(datasource& source, ColumnChunkMetaData const& col_meta)
+{
+  // Bloom filter headers are a few bytes long. Files that do not record the length of the
+  // filter are read in two steps: the header, then the bitset it describes.
+  constexpr size_t max_header_size = 64;
+
+  bloom_filter_data bloom_filter;
+  if (col_meta.bloom_filter_offset <= 0) { return bloom_filter; }
+  auto const offset = static_cast<size_t>(col_meta.bloom_filter_offset);
+  if (offset >= source.size()) { return bloom_filter; }
+  auto const available = source.size() - offset;
+
+  auto const read_size = (col_meta.bloom_filter_length > 0)
+                           ? std::min<size_t>(col_meta.bloom_filter_length, available)
+                           : std::min(max_header_size, available);
+  auto buffer = source.host_read(offset, read_size);
+  BloomFilterHeader header;
+  CompactProtocolReader cp(buffer->data(), buffer->size());
+  if (!cp.read(&header)) { return bloom_filter; }
+  if (!header.algorithm.isset.BLOCK || !header.hash.isset.XXHASH ||
+      !header.compression.isset.UNCOMPRESSED) {
+    return bloom_filter;
+  }
+  auto const header_size = static_cast<size_t>(cp.bytecount());
+  auto const num_bytes   = static_cast<size_t>(header.num_bytes);
+  if (header.num_bytes <= 0 || num_bytes % bloom_filter_block_bytes != 0 ||
+      header_size + num_bytes > available) {
+    return bloom_filter;
+  }
+
+  if (header_size + num_bytes > buffer->size()) {
+    buffer              = source.host_read(offset + header_size, num_bytes);
+    bloom_filter.bitset = buffer->data();
+  } else {
+    bloom_filter.bitset = buffer->data() + header_size;
+  }
+  bloom_filter.num_bytes = num_bytes;
+  bloom_filter.buffer    = std::move(buffer);
+  return bloom_filter;
+}
+
+/**
+ * @brief Creates an unallocated buffer with the type, name and hierarchy of another buffer
+ */
+column_buffer make_empty_buffer(column_buffer const& buffer)
+{
+  column_buffer empty(buffer.type, buffer.is_nullable);
+  empty.name = buffer.name;
+  std::transform(buffer.children.cbegin(),
+                 buffer.children.cend(),
+                 std::back_inserter(empty.children),
+                 [](auto const& child) { return make_empty_buffer(child); });
+  return empty;
+}
+
+/**
+ * @brief Collects the indices of all columns referenced by an expression
+ */
+void collect_column_references(ast::expression const& expr, std::set<size_type>& indices)
+{
+  if (auto const col = dynamic_cast<ast::column_reference const*>(&expr); col != nullptr) {
+    indices.insert(col->get_column_index());
+  } else if (auto const op = dynamic_cast<ast::operation const*>(&expr); op != nullptr) {
+    for (auto const& operand : op->get_operands()) {
+      collect_column_references(operand.get(), indices);
+    }
+  }
+}
+
+/**
+ * @brief Counts the valid, true elements of a boolean column within each segment
+ *
+ * @param mask Boolean column
+ * @param offsets Segment boundaries within `mask`, including the end offset of the last segment
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Number of true elements in each segment
+ */
+std::vector<size_type> count_matches_per_segment(column_view const& mask,
+                                                 std::vector<size_type> const& offsets,
+                                                 rmm::cuda_stream_view stream)
+{
+  auto const num_segments = offsets.size() - 1;
+  std::vector<size_type> counts(num_segments, 0);
+  if (mask.is_empty()) { return counts; }
+
+  auto const d_offsets = cudf::detail::make_device_uvector_async(offsets, stream);
+  auto const d_mask    = column_device_view::create(mask, stream);
+  auto const segment_keys = cudf::detail::make_counting_transform_iterator(
+    0, [offsets = d_offsets.data(), num_segments] __device__(size_type row) {
+      return static_cast<size_type>(
+        thrust::upper_bound(thrust::seq, offsets, offsets + num_segments + 1, row) - offsets - 1);
+    });
+  auto const is_match = cudf::detail::make_counting_transform_iterator(
+    0, [mask = *d_mask] __device__(size_type row) {
+      return static_cast<size_type>(mask.is_valid(row) && mask.element<bool>(row));
+    });
+
+  // Empty segments have no keys, so the counts are scattered back by segment index
+  rmm::device_uvector<size_type> segments(num_segments, stream);
+  rmm::device_uvector<size_type> segment_counts(num_segments, stream);
+  auto const end = thrust::reduce_by_key(rmm::exec_policy(stream),
+                                         segment_keys,
+                                         segment_keys + mask.size(),
+                                         is_match,
+                                         segments.begin(),
+                                         segment_counts.begin());
+  auto const num_keys = std::distance(segments.begin(), end.first);
+  segments.resize(num_keys, stream);
+  segment_counts.resize(num_keys, stream);
+  auto const h_segments = cudf::detail::make_std_vector_async(segments, stream);
+  auto const h_counts   = cudf::detail::make_std_vector_sync(segment_counts, stream);
+  for (size_t i = 0; i < h_segments.size(); ++i) {
+    counts[h_segments[i]] = h_counts[i];
+  }
+  return counts;
+}
+
+/**
+ * @brief Returns the indices of the first and the last true elements of a boolean column
+ *
+ * @return The indices, or `{mask.size(), -1}` if no element is true
+ */
+std::pair<size_type, size_type> find_match_bounds(column_view const& mask,
+                                                  rmm::cuda_stream_view stream)
+{
+  if (mask.is_empty()) { return {0, -1}; }
+
+  auto const d_mask = column_device_view::create(mask, stream);
+  auto const rows   = thrust::make_counting_iterator<size_type>(0);
+  auto const first  = thrust::transform_reduce(
+    rmm::exec_policy(stream),
+    rows,
+    rows + mask.size(),
+    [mask = *d_mask] __device__(size_type row) {
+      return (mask.is_valid(row) && mask.element<bool>(row)) ? row : mask.size();
+    },
+    mask.size(),
+    thrust::minimum<size_type>{});
+  auto const last = thrust::transform_reduce(
+    rmm::exec_policy(stream),
+    rows,
+    rows + mask.size(),
+    [mask = *d_mask] __device__(size_type row) {
+      return (mask.is_valid(row) && mask.element<bool>(row)) ? row : -1;
+    },
+    -1,
+    thrust::maximum<size_type>{});
+  return {first, last};
+}
+
+/**
+ * @brief Dictionary of a column chunk whose values are decoded as dictionary indices
+ */
+struct dictionary_chunk {
+  size_type first_row;            // First output row of the chunk
+  string_index_pair const* keys;  // Strings of the chunk's dictionary
+  size_type num_keys;             // Number of entries in the chunk's dictionary
+};
+
+/**
+ * @brief Builds a DICTIONARY32 column from the per-chunk dictionary indices of a string column
+ *
+ * The dictionaries of all chunks are concatenated, then sorted and deduplicated into the keys of
+ * the output column; every index is remapped to the position of its string in those keys.
+ *
+ * @param indices Lists, for each row, the index of its value in the dictionary of its chunk
+ * @param chunks Dictionaries of the chunks, in output row order
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @return The dictionary column
+ */
+std::unique_ptr<column> make_dictionary_output(column_view const& indices,
+                                               std::vector<dictionary_chunk> const& chunks,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  std::vector<size_type> first_rows;
+  std::vector<size_type> key_offsets{0};
+  for (auto const& chunk : chunks) {
+    first_rows.push_back(chunk.first_row);
+    key_offsets.push_back(key_offsets.back() + chunk.num_keys);
+  }
+  rmm::device_uvector<string_index_pair> all_keys(key_offsets.back(), stream);
+  for (size_t c = 0; c < chunks.size(); ++c) {
+    CUDA_TRY(cudaMemcpyAsync(all_keys.data() + key_offsets[c],
+                             chunks[c].keys,
+                             chunks[c].num_keys * sizeof(string_index_pair),
+                             cudaMemcpyDeviceToDevice,
+                             stream.value()));
+  }
+  auto const keys = make_strings_column(all_keys, stream);
+
+  // `key_map` maps each key of a chunk to its position in the sorted unique keys
+  auto encoded =
+    cudf::dictionary::detail::encode(keys->view(), data_type{type_id::UINT32}, stream, mr);
+  auto const key_map   = dictionary_column_view(encoded->view()).indices();
+  auto const d_first   = cudf::detail::make_device_uvector_async(first_rows, stream);
+  auto const d_offsets = cudf::detail::make_device_uvector_async(key_offsets, stream);
+  auto const d_indices = column_device_view::create(indices, stream);
+  auto output_indices  = make_numeric_column(
+    data_type{type_id::UINT32}, indices.size(), mask_state::UNALLOCATED, stream, mr);
+  auto const num_chunks = static_cast<size_type>(chunks.size());
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(indices.size()),
+                    output_indices->mutable_view().begin<uint32_t>(),
+                    [indices    = *d_indices,
+                     first_rows = d_first.data(),
+                     offsets    = d_offsets.data(),
+                     key_map    = key_map.data<uint32_t>(),
+                     num_chunks] __device__(size_type row) -> uint32_t {
+                      if (indices.is_null(row)) { return 0; }
+                      auto const chunk =
+                        thrust::upper_bound(thrust::seq, first_rows, first_rows + num_chunks, row) -
+                        first_rows - 1;
+                      auto const index = indices.element<int32_t>(row);
+                      if (index < 0 || index >= offsets[chunk + 1] - offsets[chunk]) { return 0; }
+                      return key_map[offsets[chunk] + index];
+                    });
+
+  auto contents = encoded->release();
+  return cudf::make_dictionary_column(
+    std::move(contents.children[dictionary_column_view::keys_column_index]),
+    std::move(output_indices),
+    cudf::detail::copy_bitmask(indices, stream, mr),
+    indices.null_count());
+}
+
 }  // namespace
 
 std::string name_from_path(const std::vector<std::string>& path_in_schema)
@@ -278,6 +688,8 @@ std::string name_from_path(const std::vector<std::string>& path_in_schema)
  * @brief Class for parsing dataset metadata
  */
 struct metadata : public FileMetaData {
+  size_t footer_size = 0;  // Size of the serialized footer
+
   explicit metadata(datasource* source)
   {
     constexpr auto header_len = sizeof(file_header_s);
@@ -298,9 +710,56 @@ struct metadata : public FileMetaData {
     CompactProtocolReader cp(buffer->data(), ender->footer_len);
     CUDF_EXPECTS(cp.read(this), "Cannot parse metadata");
     CUDF_EXPECTS(cp.InitSchema(this), "Cannot initialize schema");
+    footer_size = ender->footer_len;
   }
 };
 
+/**
+ * @brief Page headers of a column chunk, as decoded from its data
+ */
+struct cached_page_headers {
+  int32_t num_dict_pages = 0;
+  int32_t num_data_pages = 0;
+  std::vector<gpu::PageInfo> pages;  // Dictionary pages first, `page_data` is unset
+  std::vector<size_t> page_offsets;  // Offset of the data of each page within the chunk data
+};
+
+/**
+ * @brief Entry of the metadata cache, holding either a parsed footer or the page headers of a
+ * column chunk
+ */
+struct metadata_cache_value {
+  std::shared_ptr<metadata const> footer;
+  std::shared_ptr<cached_page_headers const> page_headers;
+};
+
+/**
+ * @brief Returns the process-wide cache of the metadata of Parquet files
+ */
+lru_cache<metadata_cache_key, metadata_cache_value>& get_metadata_cache()
+{
+  static lru_cache<metadata_cache_key, metadata_cache_value> cache;
+  return cache;
+}
+
+/**
+ * @brief Returns the identities of the source files, or an empty vector if the metadata cache is
+ * disabled or the sources are not files
+ *
+ * Sources that are not regular files have no identity.
+ */
+std::vector<std::optional<file_identity>> get_source_files(
+  std::vector<std::string> const& filepaths, size_t num_sources)
+{
+  if (get_metadata_cache().capacity() == 0 || filepaths.size() != num_sources) { return {}; }
+  std::vector<std::optional<file_identity>> files;
+  std::transform(filepaths.cbegin(),
+                 filepaths.cend(),
+                 std::back_inserter(files),
+                 [](auto const& path) { return get_file_identity(path); });
+  return files;
+}
+
 class aggregate_reader_metadata {
   std::vector<metadata> const per_file_metadata;
   std::map<std::string, std::string> const agg_keyval_map;
@@ -308,14 +767,42 @@ class aggregate_reader_metadata {
   size_type const num_row_groups;
   /**
    * @brief Create a metadata object from each element in the source vector
+   *
+   * The footers of multiple sources are read and parsed in parallel.
    */
-  auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const& sources)
+  auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const& sources,
+                              std::vector<std::optional<file_identity>> const& files)
   {
+    // Footers of files are looked up in the metadata cache first, and added to it once parsed
+    auto load = [&](size_t i) {
+      if (files.empty() || !files[i].has_value()) { return metadata(sources[i].get()); }
+      auto& cache    = get_metadata_cache();
+      auto const key = metadata_cache_key{*files[i], std::nullopt};
+      auto const hit = cache.find(key);
+      if (hit.has_value()) { return *hit->footer; }
+      auto footer = std::make_shared<metadata const>(sources[i].get());
+      cache.insert(key, {footer, nullptr}, footer->footer_size + key.file.path.size());
+      return *footer;
+    };
+
     std::vector<metadata> metadatas;
-    std::transform(
-      sources.cbegin(), sources.cend(), std::back_inserter(metadatas), [](auto const& source) {
-        return metadata(source.get());
-      });
+    if (sources.size() <= 1) {
+      for (size_t i = 0; i < sources.size(); ++i) {
+        metadatas.push_back(load(i));
+      }
+      return metadatas;
+    }
+
+    auto& pool = cudf::detail::host_worker_pool();
+    std::vector<std::future<metadata>> tasks;
+    tasks.reserve(sources.size());
+    for (size_t i = 0; i < sources.size(); ++i) {
+      tasks.push_back(pool.submit([&load, i] { return load(i); }));
+    }
+    metadatas.reserve(sources.size());
+    for (auto& task : tasks) {
+      metadatas.push_back(task.get());
+    }
     return metadatas;
   }
 
@@ -357,8 +844,9 @@ class aggregate_reader_metadata {
   }
 
  public:
-  aggregate_reader_metadata(std::vector<std::unique_ptr<datasource>> const& sources)
-    : per_file_metadata(metadatas_from_sources(sources)),
+  aggregate_reader_metadata(std::vector<std::unique_ptr<datasource>> const& sources,
+                            std::vector<std::optional<file_identity>> const& files)
+    : per_file_metadata(metadatas_from_sources(sources, files)),
       agg_keyval_map(merge_keyval_metadata()),
       num_rows(calc_num_rows()),
       num_row_groups(calc_num_row_groups())
@@ -388,9 +876,9 @@ class aggregate_reader_metadata {
     return per_file_metadata[src_idx].row_groups[row_group_index];
   }
 
-  [[nodiscard]] auto const& get_column_metadata(size_type row_group_index,
-                                                size_type src_idx,
-                                                int schema_idx) const
+  [[nodiscard]] auto const& get_column_chunk(size_type row_group_index,
+                                             size_type src_idx,
+                                             int schema_idx) const
   {
     auto col = std::find_if(
       per_file_metadata[src_idx].row_groups[row_group_index].columns.begin(),
@@ -398,13 +886,25 @@ class aggregate_reader_metadata {
       [schema_idx](ColumnChunk const& col) { return col.schema_idx == schema_idx ? true : false; });
     CUDF_EXPECTS(col != std::end(per_file_metadata[src_idx].row_groups[row_group_index].columns),
                  "Found no metadata for schema index");
-    return col->meta_data;
+    return *col;
+  }
+
+  [[nodiscard]] auto const& get_column_metadata(size_type row_group_index,
+                                                size_type src_idx,
+                                                int schema_idx) const
+  {
+    return get_column_chunk(row_group_index, src_idx, schema_idx).meta_data;
   }
 
   [[nodiscard]] auto get_num_rows() const { return num_rows; }
 
   [[nodiscard]] auto get_num_row_groups() const { return num_row_groups; }
 
+  [[nodiscard]] auto get_num_sources() const
+  {
+    return static_cast<size_type>(per_file_metadata.size());
+  }
+
   [[nodiscard]] auto const& get_schema(int schema_idx) const
   {
     return per_file_metadata[0].schema[schema_idx];
@@ -495,16 +995,6 @@ class aggregate_reader_metadata {
     return names;
   }
 
-  struct row_group_info {
-    size_type const index;
-    size_t const start_row;  // TODO source index
-    size_type const source_index;
-    row_group_info(size_type index, size_t start_row, size_type source_index)
-      : index(index), start_row(start_row), source_index(source_index)
-    {
-    }
-  };
-
   /**
    * @brief Filters and reduces down to a selection of row groups
    *
@@ -562,6 +1052,60 @@ class aggregate_reader_metadata {
     return selection;
   }
 
+  /**
+   * @brief Removes the row groups whose statistics prove that no row satisfies a filter
+   *
+   * @param selection Row groups selected for reading
+   * @param filter Boolean expression over the output columns
+   * @param output_column_schemas Schema indices of the top-level output columns
+   * @param strings_to_categorical Type conversion parameter
+   * @param timestamp_type_id Type conversion parameter
+   * @param stream CUDA stream used to read the filter literals
+   *
+   * @return Remaining row groups, with starting rows relative to the first remaining row group
+   */
+  [[nodiscard]] std::vector<row_group_info> filter_row_groups(
+    std::vector<row_group_info> const& selection,
+    ast::expression const& filter,
+    std::vector<int> const& output_column_schemas,
+    bool strings_to_categorical,
+    type_id timestamp_type_id,
+    rmm::cuda_stream_view stream) const
+  {
+    std::vector<row_group_info> filtered;
+    size_t start_row = 0;
+    for (auto const& rg : selection) {
+      auto const& row_group = get_row_group(rg.index, rg.source_index);
+      auto column_range     = [&](size_type col_idx) -> std::optional<column_chunk_range> {
+        if (col_idx < 0 || col_idx >= static_cast<size_type>(output_column_schemas.size())) {
+          return std::nullopt;
+        }
+        auto const schema_idx = output_column_schemas[col_idx];
+        auto const& schema    = get_schema(schema_idx);
+        // only leaf columns have a column chunk with statistics
+        if (schema.num_children != 0) { return std::nullopt; }
+        auto const& col_meta = get_column_metadata(rg.index, rg.source_index, schema_idx);
+        // decode the statistics using the type stored in the file; min/max of columns that the
+        // reader converts to a different type are not comparable with the literals
+        auto const file_type   = to_type_id(schema, strings_to_categorical, type_id::EMPTY);
+        auto const output_type = to_type_id(schema, strings_to_categorical, timestamp_type_id);
+        auto range =
+          decode_column_chunk_range(col_meta, schema, data_type{file_type}, row_group.num_rows);
+        if (range && file_type != output_type) {
+          range->type = data_type{output_type};
+          range->min.reset();
+          range->max.reset();
+        }
+        return range;
+      };
+      if (may_satisfy(filter, column_range, stream)) {
+        filtered.emplace_back(rg.index, start_row, rg.source_index);
+        start_row += row_group.num_rows;
+      }
+    }
+    return filtered;
+  }
+
   /**
    * @brief Filters and reduces down to a selection of columns
    *
@@ -943,21 +1487,31 @@ std::future<void> reader::impl::read_column_chunks(
   size_t begin_chunk,
   size_t end_chunk,
   const std::vector<size_t>& column_chunk_offsets,
+  std::vector<std::pair<size_t, size_t>> const& column_chunk_gaps,
   std::vector<size_type> const& chunk_source_map,
   rmm::cuda_stream_view stream)
 {
-  // Transfer chunk data, coalescing adjacent chunks
-  std::vector<std::future<size_t>> read_tasks;
+  // Ranges to read from each source, into device memory or into host memory to copy from
+  std::vector<std::vector<datasource::read_request>> device_requests(_sources.size());
+  std::vector<std::vector<datasource::read_request>> host_requests(_sources.size());
+  std::vector<std::pair<size_t, std::vector<uint8_t>>> host_buffers;
+  // First chunk of each read, and the chunk after its last one
+  std::vector<std::pair<size_t, size_t>> read_chunks;
+
+  // Collect the chunk data to transfer, coalescing adjacent chunks
   for (size_t chunk = begin_chunk; chunk < end_chunk;) {
     const size_t io_offset   = column_chunk_offsets[chunk];
     size_t io_size           = chunks[chunk].compressed_size;
     size_t next_chunk        = chunk + 1;
     const bool is_compressed = (chunks[chunk].codec != parquet::Compression::UNCOMPRESSED);
-    while (next_chunk < end_chunk) {
+
+    auto const [gap_offset, gap_size] = column_chunk_gaps[chunk];
+    while (gap_size == 0 && next_chunk < end_chunk) {
       const size_t next_offset = column_chunk_offsets[next_chunk];
       const bool is_next_compressed =
         (chunks[next_chunk].codec != parquet::Compression::UNCOMPRESSED);
-      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed) {
+      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed ||
+          column_chunk_gaps[next_chunk].second != 0) {
         // Can't merge if not contiguous or mixing compressed and uncompressed
         // Not coalescing uncompressed with compressed chunks is so that compressed buffers can be
         // freed earlier (immediately after decompression stage) to limit peak memory requirements
@@ -966,27 +1520,58 @@ std::future<void> reader::impl::read_column_chunks(
       io_size += chunks[next_chunk].compressed_size;
       next_chunk++;
     }
-    if (io_size != 0) {
-      auto& source = _sources[chunk_source_map[chunk]];
-      if (source->is_device_read_preferred(io_size)) {
-        auto buffer        = rmm::device_buffer(io_size, stream);
-        auto fut_read_size = source->device_read_async(
-          io_offset, io_size, static_cast<uint8_t*>(buffer.data()), stream);
-        read_tasks.emplace_back(std::move(fut_read_size));
-        page_data[chunk] = datasource::buffer::create(std::move(buffer));
-      } else {
-        auto const buffer = source->host_read(io_offset, io_size);
-        page_data[chunk] =
-          datasource::buffer::create(rmm::device_buffer(buffer->data(), buffer->size(), stream));
-      }
-      auto d_compdata = page_data[chunk]->data();
-      do {
-        chunks[chunk].compressed_data = d_compdata;
-        d_compdata += chunks[chunk].compressed_size;
-      } while (++chunk != next_chunk);
-    } else {
+    if (io_size == 0) {
       chunk = next_chunk;
+      continue;
+    }
+
+    auto const source_idx = chunk_source_map[chunk];
+    uint8_t* dst          = nullptr;
+    std::vector<datasource::read_request>* requests;
+    if (_sources[source_idx]->is_device_read_preferred(io_size)) {
+      auto buffer      = rmm::device_buffer(io_size, stream);
+      dst              = static_cast<uint8_t*>(buffer.data());
+      page_data[chunk] = datasource::buffer::create(std::move(buffer));
+      requests         = &device_requests[source_idx];
+    } else {
+      host_buffers.emplace_back(chunk, std::vector<uint8_t>(io_size));
+      dst      = host_buffers.back().second.data();
+      requests = &host_requests[source_idx];
+    }
+    if (_profiler != nullptr) { _profiler->counters().bytes_read += io_size; }
+    if (gap_size != 0) {
+      // The chunk data is read in two parts around the skipped bytes
+      requests->push_back({io_offset, gap_offset, dst});
+      requests->push_back(
+        {io_offset + gap_offset + gap_size, io_size - gap_offset, dst + gap_offset});
+    } else {
+      requests->push_back({io_offset, io_size, dst});
     }
+    read_chunks.emplace_back(chunk, next_chunk);
+    chunk = next_chunk;
+  }
+
+  // Issue the reads of each source as a single batch; device reads first, to overlap the host ones
+  std::vector<std::future<size_t>> read_tasks;
+  for (size_t src = 0; src < _sources.size(); ++src) {
+    if (not device_requests[src].empty()) {
+      read_tasks.emplace_back(_sources[src]->device_read_v(device_requests[src], stream));
+    }
+  }
+  for (size_t src = 0; src < _sources.size(); ++src) {
+    if (not host_requests[src].empty()) { _sources[src]->host_read_v(host_requests[src]); }
+  }
+  for (auto const& [chunk, buffer] : host_buffers) {
+    page_data[chunk] =
+      datasource::buffer::create(rmm::device_buffer(buffer.data(), buffer.size(), stream));
+  }
+
+  for (auto [chunk, next_chunk] : read_chunks) {
+    auto d_compdata = page_data[chunk]->data();
+    do {
+      chunks[chunk].compressed_data = d_compdata;
+      d_compdata += chunks[chunk].compressed_size;
+    } while (++chunk != next_chunk);
   }
   auto sync_fn = [](decltype(read_tasks) read_tasks) {
     for (auto& task : read_tasks) {
@@ -996,6 +1581,82 @@ std::future<void> reader::impl::read_column_chunks(
   return std::async(std::launch::deferred, sync_fn, std::move(read_tasks));
 }
 
+/**
+ * @copydoc cudf::io::detail::parquet::read_page_indexes
+ */
+std::vector<column_chunk_page_index> reader::impl::read_page_indexes(
+  std::vector<row_group_info> const& row_groups,
+  std::vector<int> const& schema_indices,
+  bool with_column_index)
+{
+  std::vector<column_chunk_page_index> indexes(row_groups.size() * schema_indices.size());
+
+  // Location of each index structure within the sources
+  struct index_location {
+    size_type source;
+    size_t offset;
+    size_t size;
+    size_t chunk;
+    bool is_column_index;
+  };
+  std::vector<index_location> locations;
+  for (size_t r = 0; r < row_groups.size(); ++r) {
+    auto const& rg = row_groups[r];
+    for (size_t c = 0; c < schema_indices.size(); ++c) {
+      auto const& chunk = _metadata->get_column_chunk(rg.index, rg.source_index, schema_indices[c]);
+      auto const chunk_idx = r * schema_indices.size() + c;
+      if (chunk.offset_index_length > 0) {
+        locations.push_back({rg.source_index,
+                             static_cast<size_t>(chunk.offset_index_offset),
+                             static_cast<size_t>(chunk.offset_index_length),
+                             chunk_idx,
+                             false});
+      }
+      if (with_column_index && chunk.column_index_length > 0) {
+        locations.push_back({rg.source_index,
+                             static_cast<size_t>(chunk.column_index_offset),
+                             static_cast<size_t>(chunk.column_index_length),
+                             chunk_idx,
+                             true});
+      }
+    }
+  }
+  std::sort(locations.begin(), locations.end(), [](auto const& lhs, auto const& rhs) {
+    return std::tie(lhs.source, lhs.offset) < std::tie(rhs.source, rhs.offset);
+  });
+
+  // Writers usually store the page indexes of all column chunks next to each other, so nearby
+  // structures are fetched together
+  for (size_t begin = 0; begin < locations.size();) {
+    auto const source      = locations[begin].source;
+    auto const read_offset = locations[begin].offset;
+    auto read_end          = read_offset + locations[begin].size;
+    auto end               = begin + 1;
+    while (end < locations.size() && locations[end].source == source &&
+           locations[end].offset <= read_end + PAGE_INDEX_MAX_READ_GAP) {
+      read_end = std::max(read_end, locations[end].offset + locations[end].size);
+      ++end;
+    }
+    auto const buffer = _sources[source]->host_read(read_offset, read_end - read_offset);
+    for (auto i = begin; i < end; ++i) {
+      auto const& location = locations[i];
+      // a truncated read leaves the index missing; the chunk is then read without it
+      if (location.offset + location.size > read_offset + buffer->size()) { continue; }
+      CompactProtocolReader cp(buffer->data() + (location.offset - read_offset), location.size);
+      auto& index = indexes[location.chunk];
+      if (location.is_column_index) {
+        ColumnIndex column_index;
+        if (cp.read(&column_index)) { index.column_index = std::move(column_index); }
+      } else {
+        OffsetIndex offset_index;
+        if (cp.read(&offset_index)) { index.offset_index = std::move(offset_index); }
+      }
+    }
+    begin = end;
+  }
+  return indexes;
+}
+
 /**
  * @copydoc cudf::io::detail::parquet::count_page_headers
  */
@@ -1035,71 +1696,79 @@ void reader::impl::decode_page_headers(hostdevice_vector<gpu::ColumnChunkDesc>&
   pages.device_to_host(stream, true);
 }
 
-void snappy_decompress(device_span<gpu_inflate_input_s> comp_in,
-                       device_span<gpu_inflate_status_s> comp_stat,
-                       size_t max_uncomp_page_size,
-                       rmm::cuda_stream_view stream)
+/**
+ * @copydoc cudf::io::detail::parquet::load_page_headers
+ */
+hostdevice_vector<gpu::PageInfo> reader::impl::load_page_headers(
+  hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
+  std::vector<std::optional<metadata_cache_key>> const& cache_keys,
+  rmm::cuda_stream_view stream)
 {
-  size_t num_comp_pages = comp_in.size();
-  size_t temp_size;
-
-  nvcompStatus_t nvcomp_status =
-    nvcompBatchedSnappyDecompressGetTempSize(num_comp_pages, max_uncomp_page_size, &temp_size);
-  CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
-               "Unable to get scratch size for snappy decompression");
-
-  // Not needed now but nvcomp API makes no promises about future
-  rmm::device_buffer scratch(temp_size, stream);
-  // Analogous to comp_in.srcDevice
-  rmm::device_uvector<void const*> compressed_data_ptrs(num_comp_pages, stream);
-  // Analogous to comp_in.srcSize
-  rmm::device_uvector<size_t> compressed_data_sizes(num_comp_pages, stream);
-  // Analogous to comp_in.dstDevice
-  rmm::device_uvector<void*> uncompressed_data_ptrs(num_comp_pages, stream);
-  // Analogous to comp_in.dstSize
-  rmm::device_uvector<size_t> uncompressed_data_sizes(num_comp_pages, stream);
-
-  // Analogous to comp_stat.bytes_written
-  rmm::device_uvector<size_t> actual_uncompressed_data_sizes(num_comp_pages, stream);
-  // Convertible to comp_stat.status
-  rmm::device_uvector<nvcompStatus_t> statuses(num_comp_pages, stream);
-
-  // Prepare the vectors
-  auto comp_it = thrust::make_zip_iterator(compressed_data_ptrs.begin(),
-                                           compressed_data_sizes.begin(),
-                                           uncompressed_data_ptrs.begin(),
-                                           uncompressed_data_sizes.data());
-  thrust::transform(rmm::exec_policy(stream),
-                    comp_in.begin(),
-                    comp_in.end(),
-                    comp_it,
-                    [] __device__(gpu_inflate_input_s in) {
-                      return thrust::make_tuple(in.srcDevice, in.srcSize, in.dstDevice, in.dstSize);
-                    });
+  cudf::metrics::detail::scope const stage{
+    "parquet::load_page_headers", 0, stream, cudf::metrics::detail::scope::kind::stage};
+  reader_profiler::stage_timer const timer{_profiler, "page_headers", stream};
+  auto& cache = get_metadata_cache();
+  std::vector<std::shared_ptr<cached_page_headers const>> cached(chunks.size());
+  auto all_cached = !cache_keys.empty();
+  for (size_t c = 0; c < chunks.size() && all_cached; c++) {
+    if (cache_keys[c].has_value()) {
+      auto const hit = cache.find(*cache_keys[c]);
+      if (hit.has_value()) { cached[c] = hit->page_headers; }
+    }
+    all_cached = cached[c] != nullptr;
+  }
+
+  if (all_cached) {
+    // The pages are laid out as `decode_page_headers` does, pointing into this read's chunk data
+    size_t total_pages = 0;
+    for (size_t c = 0; c < chunks.size(); c++) {
+      chunks[c].num_dict_pages = cached[c]->num_dict_pages;
+      chunks[c].num_data_pages = cached[c]->num_data_pages;
+      total_pages += chunks[c].num_dict_pages + chunks[c].num_data_pages;
+    }
+    if (total_pages == 0) { return {}; }
+    hostdevice_vector<gpu::PageInfo> pages(total_pages, total_pages, stream);
+    for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+      chunks[c].max_num_pages = chunks[c].num_data_pages + chunks[c].num_dict_pages;
+      chunks[c].page_info     = pages.device_ptr(page_count);
+      for (size_t p = 0; p < cached[c]->pages.size(); p++) {
+        auto& page     = pages[page_count + p];
+        page           = cached[c]->pages[p];
+        page.chunk_idx = c;
+        page.page_data =
+          const_cast<uint8_t*>(chunks[c].compressed_data) + cached[c]->page_offsets[p];
+      }
+      page_count += chunks[c].max_num_pages;
+    }
+    chunks.host_to_device(stream);
+    pages.host_to_device(stream);
+    return pages;
+  }
 
-  nvcomp_status = nvcompBatchedSnappyDecompressAsync(compressed_data_ptrs.data(),
-                                                     compressed_data_sizes.data(),
-                                                     uncompressed_data_sizes.data(),
-                                                     actual_uncompressed_data_sizes.data(),
-                                                     num_comp_pages,
-                                                     scratch.data(),
-                                                     scratch.size(),
-                                                     uncompressed_data_ptrs.data(),
-                                                     statuses.data(),
-                                                     stream.value());
-  CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
-               "unable to perform snappy decompression");
-
-  CUDF_EXPECTS(thrust::equal(rmm::exec_policy(stream),
-                             uncompressed_data_sizes.begin(),
-                             uncompressed_data_sizes.end(),
-                             actual_uncompressed_data_sizes.begin()),
-               "Mismatch in expected and actual decompressed size during snappy decompression");
-  CUDF_EXPECTS(thrust::equal(rmm::exec_policy(stream),
-                             statuses.begin(),
-                             statuses.end(),
-                             thrust::make_constant_iterator(nvcompStatus_t::nvcompSuccess)),
-               "Error during snappy decompression");
+  auto const total_pages = count_page_headers(chunks, stream);
+  if (total_pages == 0) { return {}; }
+  hostdevice_vector<gpu::PageInfo> pages(total_pages, total_pages, stream);
+  decode_page_headers(chunks, pages, stream);
+
+  for (size_t c = 0, page_count = 0; c < cache_keys.size(); c++) {
+    auto const num_pages = chunks[c].max_num_pages;
+    if (cache_keys[c].has_value() && cached[c] == nullptr) {
+      auto headers            = std::make_shared<cached_page_headers>();
+      headers->num_dict_pages = chunks[c].num_dict_pages;
+      headers->num_data_pages = chunks[c].num_data_pages;
+      for (auto p = 0; p < num_pages; p++) {
+        auto page = pages[page_count + p];
+        headers->page_offsets.push_back(page.page_data - chunks[c].compressed_data);
+        page.page_data = nullptr;
+        headers->pages.push_back(page);
+      }
+      auto const size = num_pages * (sizeof(gpu::PageInfo) + sizeof(size_t)) +
+                        sizeof(cached_page_headers) + cache_keys[c]->file.path.size();
+      cache.insert(*cache_keys[c], {nullptr, std::move(headers)}, size);
+    }
+    page_count += num_pages;
+  }
+  return pages;
 }
 
 /**
@@ -1110,6 +1779,9 @@ rmm::device_buffer reader::impl::decompress_page_data(
   hostdevice_vector<gpu::PageInfo>& pages,
   rmm::cuda_stream_view stream)
 {
+  cudf::metrics::detail::scope const stage{
+    "parquet::decompress_page_data", 0, stream, cudf::metrics::detail::scope::kind::stage};
+  reader_profiler::stage_timer const timer{_profiler, "decompress", stream};
   auto for_each_codec_page = [&](parquet::Compression codec, const std::function<void(size_t)>& f) {
     for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
       const auto page_stride = chunks[c].max_num_pages;
@@ -1122,9 +1794,6 @@ rmm::device_buffer reader::impl::decompress_page_data(
     }
   };
 
-  // Brotli scratch memory for decompressing
-  rmm::device_buffer debrotli_scratch;
-
   // Count the exact number of compressed pages
   size_t num_comp_pages    = 0;
   size_t total_decomp_size = 0;
@@ -1135,25 +1804,30 @@ rmm::device_buffer reader::impl::decompress_page_data(
     int32_t max_decompressed_size;
   };
 
-  std::array<codec_stats, 3> codecs{codec_stats{parquet::GZIP, 0, 0},
+  std::array<codec_stats, 5> codecs{codec_stats{parquet::GZIP, 0, 0},
                                     codec_stats{parquet::SNAPPY, 0, 0},
-                                    codec_stats{parquet::BROTLI, 0, 0}};
+                                    codec_stats{parquet::BROTLI, 0, 0},
+                                    codec_stats{parquet::ZSTD, 0, 0},
+                                    codec_stats{parquet::LZ4_RAW, 0, 0}};
 
   for (auto& codec : codecs) {
     for_each_codec_page(codec.compression_type, [&](size_t page) {
       auto page_uncomp_size = pages[page].uncompressed_page_size;
       total_decomp_size += page_uncomp_size;
+      if (_profiler != nullptr) {
+        _profiler->counters().compressed_bytes += pages[page].compressed_page_size;
+        _profiler->counters().uncompressed_bytes += page_uncomp_size;
+      }
       codec.max_decompressed_size = std::max(codec.max_decompressed_size, page_uncomp_size);
       codec.num_pages++;
       num_comp_pages++;
     });
-    if (codec.compression_type == parquet::BROTLI && codec.num_pages > 0) {
-      debrotli_scratch.resize(get_gpu_debrotli_scratch_size(codec.num_pages), stream);
-    }
   }
 
   // Dispatch batches of pages to decompress for each codec
-  rmm::device_buffer decomp_pages(total_decomp_size, stream);
+  auto const decomp_mr = _decompression_arena != nullptr ? _decompression_arena.get()
+                                                         : rmm::mr::get_current_device_resource();
+  rmm::device_buffer decomp_pages(total_decomp_size, stream, decomp_mr);
   hostdevice_vector<gpu_inflate_input_s> inflate_in(0, num_comp_pages, stream);
   hostdevice_vector<gpu_inflate_status_s> inflate_out(0, num_comp_pages, stream);
 
@@ -1167,20 +1841,40 @@ rmm::device_buffer reader::impl::decompress_page_data(
       int32_t start_pos = argc;
 
       for_each_codec_page(codec.compression_type, [&](size_t page) {
-        auto dst_base              = static_cast<uint8_t*>(decomp_pages.data());
-        inflate_in[argc].srcDevice = pages[page].page_data;
-        inflate_in[argc].srcSize   = pages[page].compressed_page_size;
-        inflate_in[argc].dstDevice = dst_base + decomp_offset;
-        inflate_in[argc].dstSize   = pages[page].uncompressed_page_size;
-
-        inflate_out[argc].bytes_written = 0;
-        inflate_out[argc].status        = static_cast<uint32_t>(-1000);
-        inflate_out[argc].reserved      = 0;
-
-        pages[page].page_data = static_cast<uint8_t*>(inflate_in[argc].dstDevice);
-        decomp_offset += inflate_in[argc].dstSize;
-        argc++;
+        auto& page_info     = pages[page];
+        auto const dst_base = static_cast<uint8_t*>(decomp_pages.data()) + decomp_offset;
+
+        // The levels of data pages v2 are never compressed, and their values may not be either.
+        // The uncompressed bytes are copied as-is.
+        auto const is_v2    = (page_info.flags & gpu::PAGEINFO_FLAGS_V2) != 0;
+        auto const lvl_size = is_v2 ? page_info.lvl_bytes[gpu::level_type::DEFINITION] +
+                                        page_info.lvl_bytes[gpu::level_type::REPETITION]
+                                    : 0;
+        auto const copy_size =
+          (is_v2 && !page_info.is_compressed) ? page_info.uncompressed_page_size : lvl_size;
+        if (copy_size > 0) {
+          CUDA_TRY(cudaMemcpyAsync(dst_base,
+                                   page_info.page_data,
+                                   copy_size,
+                                   cudaMemcpyDeviceToDevice,
+                                   stream.value()));
+        }
+        if (copy_size < page_info.uncompressed_page_size) {
+          inflate_in[argc].srcDevice = page_info.page_data + lvl_size;
+          inflate_in[argc].srcSize   = page_info.compressed_page_size - lvl_size;
+          inflate_in[argc].dstDevice = dst_base + lvl_size;
+          inflate_in[argc].dstSize   = page_info.uncompressed_page_size - lvl_size;
+
+          inflate_out[argc].bytes_written = 0;
+          inflate_out[argc].status        = static_cast<uint32_t>(-1000);
+          inflate_out[argc].reserved      = 0;
+          argc++;
+        }
+
+        page_info.page_data = dst_base;
+        decomp_offset += page_info.uncompressed_page_size;
       });
+      if (argc == start_pos) { continue; }
 
       CUDA_TRY(cudaMemcpyAsync(inflate_in.device_ptr(start_pos),
                                inflate_in.host_ptr(start_pos),
@@ -1193,37 +1887,13 @@ rmm::device_buffer reader::impl::decompress_page_data(
                                cudaMemcpyHostToDevice,
                                stream.value()));
 
-      switch (codec.compression_type) {
-        case parquet::GZIP:
-          CUDA_TRY(gpuinflate(inflate_in.device_ptr(start_pos),
-                              inflate_out.device_ptr(start_pos),
-                              argc - start_pos,
-                              1,
-                              stream))
-          break;
-        case parquet::SNAPPY:
-          if (nvcomp_integration::is_stable_enabled()) {
-            snappy_decompress(inflate_in_view.subspan(start_pos, argc - start_pos),
-                              inflate_out_view.subspan(start_pos, argc - start_pos),
-                              codec.max_decompressed_size,
-                              stream);
-          } else {
-            CUDA_TRY(gpu_unsnap(inflate_in.device_ptr(start_pos),
-                                inflate_out.device_ptr(start_pos),
-                                argc - start_pos,
-                                stream));
-          }
-          break;
-        case parquet::BROTLI:
-          CUDA_TRY(gpu_debrotli(inflate_in.device_ptr(start_pos),
-                                inflate_out.device_ptr(start_pos),
-                                debrotli_scratch.data(),
-                                debrotli_scratch.size(),
-                                argc - start_pos,
-                                stream));
-          break;
-        default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
-      }
+      batched_decompress(to_compression_type(codec.compression_type),
+                         inflate_in_view.subspan(start_pos, argc - start_pos),
+                         inflate_out_view.subspan(start_pos, argc - start_pos),
+                         codec.max_decompressed_size,
+                         true,
+                         stream,
+                         decomp_mr);
       CUDA_TRY(cudaMemcpyAsync(inflate_out.host_ptr(start_pos),
                                inflate_out.device_ptr(start_pos),
                                sizeof(decltype(inflate_out)::value_type) * (argc - start_pos),
@@ -1240,6 +1910,45 @@ rmm::device_buffer reader::impl::decompress_page_data(
   return decomp_pages;
 }
 
+/**
+ * @copydoc cudf::io::detail::parquet::rewrite_delta_pages
+ */
+rmm::device_buffer reader::impl::rewrite_delta_pages(
+  hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
+  hostdevice_vector<gpu::PageInfo>& pages,
+  rmm::cuda_stream_view stream)
+{
+  auto const has_delta_pages =
+    std::any_of(pages.host_ptr(), pages.host_ptr(pages.size()), [](auto const& page) {
+      return !(page.flags & gpu::PAGEINFO_FLAGS_DICTIONARY) && gpu::is_rewritten_as_plain(page);
+    });
+  if (!has_delta_pages) { return {}; }
+
+  // Size of each rewritten page, scanned in place into its offset followed by the total size
+  rmm::device_uvector<size_t> page_offsets(pages.size() + 1, stream);
+  CUDA_TRY(cudaMemsetAsync(
+    page_offsets.data(), 0, page_offsets.size() * sizeof(size_t), stream.value()));
+  gpu::ComputeDeltaPageSizes(
+    pages, chunks, device_span<size_t>{page_offsets.data(), pages.size()}, stream);
+  thrust::exclusive_scan(rmm::exec_policy(stream),
+                         page_offsets.begin(),
+                         page_offsets.end(),
+                         page_offsets.begin());
+  auto const total_size = page_offsets.back_element(stream);
+
+  rmm::device_buffer delta_pages(total_size, stream);
+  gpu::DecodeDeltaPages(pages,
+                        chunks,
+                        page_offsets,
+                        static_cast<uint8_t*>(delta_pages.data()),
+                        stream);
+
+  // The rewritten pages are now plain encoded and point to the new buffer
+  pages.device_to_host(stream, true);
+
+  return delta_pages;
+}
+
 /**
  * @copydoc cudf::io::detail::parquet::allocate_nesting_info
  */
@@ -1374,15 +2083,7 @@ void reader::impl::preprocess_columns(hostdevice_vector<gpu::ColumnChunkDesc>& c
   // if there are no lists, simply allocate every allocate every output
   // column to be of size num_rows
   if (!has_lists) {
-    std::function<void(std::vector<column_buffer>&)> create_columns =
-      [&](std::vector<column_buffer>& cols) {
-        for (size_t idx = 0; idx < cols.size(); idx++) {
-          auto& col = cols[idx];
-          col.create(total_rows, stream, _mr);
-          create_columns(col.children);
-        }
-      };
-    create_columns(_output_columns);
+    allocate_columns(total_rows, stream);
   } else {
     // preprocess per-nesting level sizes by page
     gpu::PreprocessColumnData(
@@ -1392,15 +2093,114 @@ void reader::impl::preprocess_columns(hostdevice_vector<gpu::ColumnChunkDesc>& c
 }
 
 /**
- * @copydoc cudf::io::detail::parquet::decode_page_data
+ * @copydoc cudf::io::detail::parquet::allocate_columns
  */
-void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
-                                    hostdevice_vector<gpu::PageInfo>& pages,
-                                    hostdevice_vector<gpu::PageNestingInfo>& page_nesting,
+void reader::impl::allocate_columns(size_t total_rows, rmm::cuda_stream_view stream)
+{
+  std::function<void(std::vector<column_buffer>&)> create_columns =
+    [&](std::vector<column_buffer>& cols) {
+      for (size_t idx = 0; idx < cols.size(); idx++) {
+        auto& col = cols[idx];
+        col.create(total_rows, stream, _mr);
+        create_columns(col.children);
+      }
+    };
+  create_columns(_output_columns);
+}
+
+/**
+ * @copydoc cudf::io::detail::parquet::decode_pipelined
+ */
+void reader::impl::decode_pipelined(hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
+                                    std::vector<std::unique_ptr<datasource::buffer>>& page_data,
+                                    std::vector<rmm::device_buffer>& decomp_page_data,
+                                    std::vector<std::pair<size_t, size_t>> const& batches,
+                                    std::vector<size_t> const& column_chunk_offsets,
+                                    std::vector<std::pair<size_t, size_t>> const& column_chunk_gaps,
+                                    std::vector<size_type> const& chunk_source_map,
+                                    std::vector<std::optional<metadata_cache_key>> const&
+                                      chunk_cache_keys,
                                     size_t min_row,
                                     size_t total_rows,
                                     rmm::cuda_stream_view stream)
 {
+  // Without lists the output sizes are known upfront, and every batch decodes into its rows
+  allocate_columns(total_rows, stream);
+
+  // The reads are issued from a separate thread and copied on a separate stream, so that they
+  // proceed while the previous batch is decoded on `stream`
+  if (!_io_stream.has_value()) { _io_stream.emplace(); }
+  auto const io_stream = _io_stream->view();
+  auto read_batch      = [&](size_t batch) {
+    return std::async(std::launch::async, [&, batch] {
+      read_column_chunks(page_data,
+                         chunks,
+                         batches[batch].first,
+                         batches[batch].second,
+                         column_chunk_offsets,
+                         column_chunk_gaps,
+                         chunk_source_map,
+                         io_stream)
+        .wait();
+      io_stream.synchronize();
+    });
+  };
+
+  auto next_read = read_batch(0);
+  for (size_t batch = 0; batch < batches.size(); ++batch) {
+    {
+      reader_profiler::stage_timer const read_timer{_profiler, "read", stream};
+      next_read.get();
+    }
+    if (batch + 1 < batches.size()) { next_read = read_batch(batch + 1); }
+
+    auto const [begin, end] = batches[batch];
+    hostdevice_vector<gpu::ColumnChunkDesc> batch_chunks(0, end - begin, stream);
+    for (auto c = begin; c < end; ++c) {
+      batch_chunks.insert(chunks[c]);
+    }
+
+    auto const batch_cache_keys =
+      chunk_cache_keys.empty()
+        ? std::vector<std::optional<metadata_cache_key>>{}
+        : std::vector<std::optional<metadata_cache_key>>(chunk_cache_keys.begin() + begin,
+                                                         chunk_cache_keys.begin() + end);
+    auto pages = load_page_headers(batch_chunks, batch_cache_keys, stream);
+    if (pages.size() == 0) { continue; }
+
+    auto const is_compressed = std::any_of(
+      batch_chunks.host_ptr(), batch_chunks.host_ptr(batch_chunks.size()), [](auto const& chunk) {
+        return chunk.codec != parquet::Compression::UNCOMPRESSED;
+      });
+    if (is_compressed) {
+      decomp_page_data.push_back(decompress_page_data(batch_chunks, pages, stream));
+      // Free compressed data
+      for (auto c = begin; c < end; ++c) {
+        if (chunks[c].codec != parquet::Compression::UNCOMPRESSED) { page_data[c].reset(); }
+      }
+    }
+    decomp_page_data.push_back(rewrite_delta_pages(batch_chunks, pages, stream));
+
+    hostdevice_vector<gpu::PageNestingInfo> page_nesting_info;
+    allocate_nesting_info(batch_chunks, pages, page_nesting_info, stream);
+    decode_page_data(batch_chunks, pages, page_nesting_info, min_row, total_rows, stream);
+  }
+}
+
+/**
+ * @copydoc cudf::io::detail::parquet::decode_page_data
+ */
+rmm::device_uvector<string_index_pair> reader::impl::decode_page_data(
+  hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
+  hostdevice_vector<gpu::PageInfo>& pages,
+  hostdevice_vector<gpu::PageNestingInfo>& page_nesting,
+  size_t min_row,
+  size_t total_rows,
+  rmm::cuda_stream_view stream)
+{
+  cudf::metrics::detail::scope const stage{
+    "parquet::decode_page_data", 0, stream, cudf::metrics::detail::scope::kind::stage};
+  reader_profiler::stage_timer const timer{_profiler, "decode", stream};
   auto is_dict_chunk = [](const gpu::ColumnChunkDesc& chunk) {
     return (chunk.data_type & 0x7) == BYTE_ARRAY && chunk.num_dict_pages > 0;
   };
@@ -1582,47 +2382,55 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc>& chu
   }
 
   stream.synchronize();
+  return str_dict_index;
 }
 
-reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
-                   parquet_reader_options const& options,
-                   rmm::mr::device_memory_resource* mr)
-  : _mr(mr), _sources(std::move(sources))
+/**
+ * @copydoc cudf::io::detail::parquet::read_columns
+ */
+std::vector<std::unique_ptr<column>> reader::impl::read_columns(
+  std::vector<row_group_info> const& selected_row_groups,
+  size_type skip_rows,
+  size_type num_rows,
+  std::vector<size_type> const& column_indices,
+  std::vector<column_name_info>& schema_info,
+  rmm::cuda_stream_view stream)
 {
-  // Open and parse the source dataset metadata
-  _metadata = std::make_unique<aggregate_reader_metadata>(_sources);
-
-  // Override output timestamp resolution if requested
-  if (options.get_timestamp_type().id() != type_id::EMPTY) {
-    _timestamp_type = options.get_timestamp_type();
+  // Restrict the decode to the requested top-level output columns. The decoding steps work on
+  // `_input_columns` and `_output_columns`, so the selection is swapped in for their duration.
+  // Fresh buffers are used so that the column selection can be decoded more than once.
+  std::vector<input_column_info> input_columns;
+  std::vector<column_buffer> output_columns;
+  for (auto const idx : column_indices) {
+    output_columns.push_back(make_empty_buffer(_output_columns[idx]));
   }
+  for (auto const& input_col : _input_columns) {
+    auto const it = std::find(column_indices.cbegin(), column_indices.cend(), input_col.nesting[0]);
+    if (it != column_indices.cend()) {
+      auto& col      = input_columns.emplace_back(input_col);
+      col.nesting[0] = std::distance(column_indices.cbegin(), it);
+    }
+  }
+  std::swap(_input_columns, input_columns);
+  std::swap(_output_columns, output_columns);
 
-  // Strings may be returned as either string or categorical columns
-  _strings_to_categorical = options.is_enabled_convert_strings_to_categories();
-
-  // Select only columns required by the options
-  std::tie(_input_columns, _output_columns, _output_column_schemas) =
-    _metadata->select_columns(options.get_columns(),
-                              options.is_enabled_use_pandas_metadata(),
-                              _strings_to_categorical,
-                              _timestamp_type.id());
-}
-
-table_with_metadata reader::impl::read(size_type skip_rows,
-                                       size_type num_rows,
-                                       std::vector<std::vector<size_type>> const& row_group_list,
-                                       rmm::cuda_stream_view stream)
-{
-  // Select only row groups required
-  const auto selected_row_groups =
-    _metadata->select_row_groups(row_group_list, skip_rows, num_rows);
-
-  table_metadata out_metadata;
-
-  // output cudf columns as determined by the top level schema
   std::vector<std::unique_ptr<column>> out_columns;
   out_columns.reserve(_output_columns.size());
 
+  // Flat string columns to return as dictionaries
+  std::vector<bool> dictionary_output(_output_columns.size(), false);
+  if (_strings_to_dictionary) {
+    for (auto const& input_col : _input_columns) {
+      if (input_col.nesting_depth() == 1 &&
+          _output_columns[input_col.nesting[0]].type.id() == type_id::STRING) {
+        dictionary_output[input_col.nesting[0]] = true;
+      }
+    }
+  }
+  auto const has_dictionary_output =
+    std::find(dictionary_output.cbegin(), dictionary_output.cend(), true) !=
+    dictionary_output.cend();
+
   if (selected_row_groups.size() != 0 && _input_columns.size() != 0) {
     // Descriptors for all the chunks that make up the selected columns
     const auto num_input_columns = _input_columns.size();
@@ -1638,13 +2446,23 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     // Keep track of column chunk file offsets
     std::vector<size_t> column_chunk_offsets(num_chunks);
 
+    // Bytes skipped within each column chunk
+    std::vector<std::pair<size_t, size_t>> column_chunk_gaps(num_chunks);
+
+    std::vector<int> input_schema_indices;
+    std::transform(_input_columns.cbegin(),
+                   _input_columns.cend(),
+                   std::back_inserter(input_schema_indices),
+                   [](auto const& col) { return col.schema_idx; });
+
     // if there are lists present, we need to preprocess
     bool has_lists = false;
 
     // Initialize column chunk information
     size_t total_decompressed_size = 0;
     auto remaining_rows            = num_rows;
-    std::vector<std::future<void>> read_rowgroup_tasks;
+    // Range of column chunks of each row group
+    std::vector<std::pair<size_t, size_t>> row_group_chunks;
     for (const auto& rg : selected_row_groups) {
       const auto& row_group       = _metadata->get_row_group(rg.index, rg.source_index);
       auto const row_group_start  = rg.start_row;
@@ -1652,6 +2470,16 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       auto const row_group_rows   = std::min<int>(remaining_rows, row_group.num_rows);
       auto const io_chunk_idx     = chunks.size();
 
+      // The first and last row groups may only be read in part; their offset index then allows
+      // reading only the data pages that hold the requested rows
+      auto const first_row = std::max<size_t>(row_group_start, skip_rows) - row_group_start;
+      auto const end_row =
+        std::min<size_t>(row_group_start + row_group.num_rows, skip_rows + num_rows) -
+        row_group_start;
+      auto const page_indexes = (first_row > 0 || end_row < static_cast<size_t>(row_group.num_rows))
+                                  ? read_page_indexes({rg}, input_schema_indices, false)
+                                  : std::vector<column_chunk_page_index>{};
+
       // generate ColumnChunkDesc objects for everything to be decoded (all input columns)
       for (size_t i = 0; i < num_input_columns; ++i) {
         auto col = _input_columns[i];
@@ -1685,13 +2513,39 @@ table_with_metadata reader::impl::read(size_type skip_rows,
             ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
             : col_meta.data_page_offset;
 
-        chunks.insert(gpu::ColumnChunkDesc(col_meta.total_compressed_size,
+        size_t chunk_size      = col_meta.total_compressed_size;
+        size_t chunk_values    = col_meta.num_values;
+        size_t chunk_start_row = row_group_start;
+        uint32_t chunk_rows    = row_group_rows;
+        // Pages can only be located by row for flat columns, where each value is one row
+        if (!page_indexes.empty() && page_indexes[i].offset_index.has_value() &&
+            schema.max_repetition_level == 0) {
+          auto const selection = select_pages(page_indexes[i].offset_index->page_locations,
+                                              column_chunk_offsets[chunks.size()],
+                                              chunk_size,
+                                              first_row,
+                                              end_row,
+                                              row_group.num_rows);
+          if (selection.has_value()) {
+            column_chunk_offsets[chunks.size()] = selection->io_offset;
+            column_chunk_gaps[chunks.size()]    = {selection->gap_offset, selection->gap_size};
+            chunk_size                          = selection->io_size;
+            chunk_values                        = selection->num_rows;
+            chunk_start_row                     = row_group_start + selection->first_row;
+            chunk_rows                          = selection->num_rows;
+            if (_profiler != nullptr) {
+              _profiler->counters().pages_skipped += selection->num_skipped_pages;
+            }
+          }
+        }
+
+        chunks.insert(gpu::ColumnChunkDesc(chunk_size,
                                            nullptr,
-                                           col_meta.num_values,
+                                           chunk_values,
                                            schema.type,
                                            type_width,
-                                           row_group_start,
-                                           row_group_rows,
+                                           chunk_start_row,
+                                           chunk_rows,
                                            schema.max_definition_level,
                                            schema.max_repetition_level,
                                            _metadata->get_output_nesting_depth(col.schema_idx),
@@ -1711,86 +2565,544 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           total_decompressed_size += col_meta.total_uncompressed_size;
         }
       }
-      // Read compressed chunk data to device memory
-      read_rowgroup_tasks.push_back(read_column_chunks(page_data,
-                                                       chunks,
-                                                       io_chunk_idx,
-                                                       chunks.size(),
-                                                       column_chunk_offsets,
-                                                       chunk_source_map,
-                                                       stream));
+      row_group_chunks.emplace_back(io_chunk_idx, chunks.size());
 
       remaining_rows -= row_group.num_rows;
     }
-    for (auto& task : read_rowgroup_tasks) {
-      task.wait();
-    }
     assert(remaining_rows <= 0);
 
-    // Process dataset chunk pages into output columns
-    const auto total_pages = count_page_headers(chunks, stream);
-    if (total_pages > 0) {
-      hostdevice_vector<gpu::PageInfo> pages(total_pages, total_pages, stream);
-      rmm::device_buffer decomp_page_data;
-
-      // decoding of column/page information
-      decode_page_headers(chunks, pages, stream);
-      if (total_decompressed_size > 0) {
-        decomp_page_data = decompress_page_data(chunks, pages, stream);
-        // Free compressed data
-        for (size_t c = 0; c < chunks.size(); c++) {
-          if (chunks[c].codec != parquet::Compression::UNCOMPRESSED) { page_data[c].reset(); }
-        }
+    // The page headers of chunks read from files are cached, keyed by the data they are read from
+    std::vector<std::optional<metadata_cache_key>> chunk_cache_keys;
+    if (!_source_files.empty()) {
+      chunk_cache_keys.resize(chunks.size());
+      for (size_t c = 0; c < chunks.size(); ++c) {
+        auto const& file = _source_files[chunk_source_map[c]];
+        if (!file.has_value()) { continue; }
+        chunk_cache_keys[c] = metadata_cache_key{*file,
+                                                 chunk_location{column_chunk_offsets[c],
+                                                                chunks[c].compressed_size,
+                                                                column_chunk_gaps[c].first,
+                                                                column_chunk_gaps[c].second,
+                                                                chunks[c].num_values}};
       }
+    }
 
-      // build output column info
-      // walk the schema, building out_buffers that mirror what our final cudf columns will look
-      // like. important : there is not necessarily a 1:1 mapping between input columns and output
-      // columns. For example, parquet does not explicitly store a ColumnChunkDesc for struct
-      // columns. The "structiness" is simply implied by the schema.  For example, this schema:
-      //  required group field_id=1 name {
-      //    required binary field_id=2 firstname (String);
-      //    required binary field_id=3 middlename (String);
-      //    required binary field_id=4 lastname (String);
-      // }
-      // will only contain 3 columns of data (firstname, middlename, lastname).  But of course
-      // "name" is a struct column that we want to return, so we have to make sure that we
-      // create it ourselves.
-      // std::vector<output_column_info> output_info = build_output_column_info();
-
-      // nesting information (sizes, etc) stored -per page-
-      // note : even for flat schemas, we allocate 1 level of "nesting" info
-      hostdevice_vector<gpu::PageNestingInfo> page_nesting_info;
-      allocate_nesting_info(chunks, pages, page_nesting_info, stream);
-
-      // - compute column sizes and allocate output buffers.
-      //   important:
-      //   for nested schemas, we have to do some further preprocessing to determine:
-      //    - real column output sizes per level of nesting (in a flat schema, there's only 1 level
-      //    of
-      //      nesting and it's size is the row count)
-      //
-      // - for nested schemas, output buffer offset values per-page, per nesting-level for the
-      // purposes of decoding.
-      preprocess_columns(chunks, pages, skip_rows, num_rows, has_lists, stream);
-
-      // decoding of column data itself
-      decode_page_data(chunks, pages, page_nesting_info, skip_rows, num_rows, stream);
+    // Large reads of flat columns are processed in batches of row groups, so that reading the
+    // data of a batch overlaps with decoding the previous one. Dictionary outputs need the pages
+    // of all row groups to choose how their columns are decoded, so they are read at once.
+    auto const batches = (has_lists || has_dictionary_output)
+                           ? std::vector<std::pair<size_t, size_t>>{}
+                           : make_read_batches(row_group_chunks, chunks, _pipeline_batch_size);
+    if (batches.size() > 1) {
+      std::vector<rmm::device_buffer> decomp_page_data;
+      decode_pipelined(chunks,
+                       page_data,
+                       decomp_page_data,
+                       batches,
+                       column_chunk_offsets,
+                       column_chunk_gaps,
+                       chunk_source_map,
+                       chunk_cache_keys,
+                       skip_rows,
+                       num_rows,
+                       stream);
 
       // create the final output cudf columns
+      reader_profiler::stage_timer const assemble_timer{_profiler, "assemble", stream};
       for (size_t i = 0; i < _output_columns.size(); ++i) {
-        column_name_info& col_name = out_metadata.schema_info.emplace_back("");
-        out_columns.emplace_back(make_column(_output_columns[i], &col_name, stream, _mr));
+        out_columns.emplace_back(
+          make_column(_output_columns[i], &schema_info[column_indices[i]], stream, _mr));
+      }
+    } else {
+      // Read compressed chunk data to device memory
+      {
+        reader_profiler::stage_timer const read_timer{_profiler, "read", stream};
+        std::vector<std::future<void>> read_rowgroup_tasks;
+        for (auto const& [begin, end] : row_group_chunks) {
+          read_rowgroup_tasks.push_back(read_column_chunks(page_data,
+                                                           chunks,
+                                                           begin,
+                                                           end,
+                                                           column_chunk_offsets,
+                                                           column_chunk_gaps,
+                                                           chunk_source_map,
+                                                           stream));
+        }
+        for (auto& task : read_rowgroup_tasks) {
+          task.wait();
+        }
+      }
+
+      // Process dataset chunk pages into output columns
+      auto pages = load_page_headers(chunks, chunk_cache_keys, stream);
+      if (pages.size() > 0) {
+        rmm::device_buffer decomp_page_data;
+
+        if (total_decompressed_size > 0) {
+          decomp_page_data = decompress_page_data(chunks, pages, stream);
+          // Free compressed data
+          for (size_t c = 0; c < chunks.size(); c++) {
+            if (chunks[c].codec != parquet::Compression::UNCOMPRESSED) { page_data[c].reset(); }
+          }
+        }
+        auto const delta_page_data = rewrite_delta_pages(chunks, pages, stream);
+
+        // build output column info
+        // walk the schema, building out_buffers that mirror what our final cudf columns will look
+        // like. important : there is not necessarily a 1:1 mapping between input columns and output
+        // columns. For example, parquet does not explicitly store a ColumnChunkDesc for struct
+        // columns. The "structiness" is simply implied by the schema.  For example, this schema:
+        //  required group field_id=1 name {
+        //    required binary field_id=2 firstname (String);
+        //    required binary field_id=3 middlename (String);
+        //    required binary field_id=4 lastname (String);
+        // }
+        // will only contain 3 columns of data (firstname, middlename, lastname).  But of course
+        // "name" is a struct column that we want to return, so we have to make sure that we
+        // create it ourselves.
+        // std::vector<output_column_info> output_info = build_output_column_info();
+
+        // nesting information (sizes, etc) stored -per page-
+        // note : even for flat schemas, we allocate 1 level of "nesting" info
+        hostdevice_vector<gpu::PageNestingInfo> page_nesting_info;
+        allocate_nesting_info(chunks, pages, page_nesting_info, stream);
+
+        // String columns whose chunks are all entirely dictionary encoded are decoded to the
+        // indices of their values in the chunk dictionaries, from which the output dictionary is
+        // built without materializing the strings
+        std::vector<bool> decode_dict_indices(dictionary_output);
+        for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+          auto const out_idx = _input_columns[chunks[c].src_col_index].nesting[0];
+          if (chunks[c].num_dict_pages == 0) { decode_dict_indices[out_idx] = false; }
+          for (auto p = page_count + chunks[c].num_dict_pages;
+               p < page_count + chunks[c].num_data_pages + chunks[c].num_dict_pages;
+               ++p) {
+            if (pages[p].encoding != Encoding::PLAIN_DICTIONARY &&
+                pages[p].encoding != Encoding::RLE_DICTIONARY) {
+              decode_dict_indices[out_idx] = false;
+            }
+          }
+          page_count += chunks[c].max_num_pages;
+        }
+        for (size_t c = 0; c < chunks.size(); c++) {
+          auto const out_idx = _input_columns[chunks[c].src_col_index].nesting[0];
+          chunks[c].output_dict_index = decode_dict_indices[out_idx];
+        }
+        for (size_t i = 0; i < _output_columns.size(); ++i) {
+          if (decode_dict_indices[i]) { _output_columns[i].type = data_type{type_id::INT32}; }
+        }
+
+        // - compute column sizes and allocate output buffers.
+        //   important:
+        //   for nested schemas, we have to do some further preprocessing to determine:
+        //    - real column output sizes per level of nesting (in a flat schema, there's only 1
+        //      level of nesting and it's size is the row count)
+        //
+        // - for nested schemas, output buffer offset values per-page, per nesting-level for the
+        // purposes of decoding.
+        preprocess_columns(chunks, pages, skip_rows, num_rows, has_lists, stream);
+
+        // decoding of column data itself
+        auto const str_dict_index =
+          decode_page_data(chunks, pages, page_nesting_info, skip_rows, num_rows, stream);
+
+        // create the final output cudf columns
+        reader_profiler::stage_timer const assemble_timer{_profiler, "assemble", stream};
+        for (size_t i = 0; i < _output_columns.size(); ++i) {
+          out_columns.emplace_back(
+            make_column(_output_columns[i], &schema_info[column_indices[i]], stream, _mr));
+          if (!decode_dict_indices[i]) { continue; }
+
+          std::vector<dictionary_chunk> dict_chunks;
+          for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+            if (static_cast<size_t>(_input_columns[chunks[c].src_col_index].nesting[0]) == i) {
+              auto const first_row = std::max(chunks[c].start_row, static_cast<size_t>(skip_rows));
+              dict_chunks.push_back({static_cast<size_type>(first_row - skip_rows),
+                                     chunks[c].str_dict_index,
+                                     pages[page_count].num_input_values});
+            }
+            page_count += chunks[c].max_num_pages;
+          }
+          out_columns.back() =
+            make_dictionary_output(out_columns.back()->view(), dict_chunks, stream, _mr);
+        }
       }
     }
   }
 
   // Create empty columns as needed (this can happen if we've ended up with no actual data to read)
   for (size_t i = out_columns.size(); i < _output_columns.size(); ++i) {
-    column_name_info& col_name = out_metadata.schema_info.emplace_back("");
-    out_columns.emplace_back(io::detail::empty_like(_output_columns[i], &col_name, stream, _mr));
+    out_columns.emplace_back(
+      io::detail::empty_like(_output_columns[i], &schema_info[column_indices[i]], stream, _mr));
   }
 
+  // Dictionary outputs that could not be decoded from indices are encoded from their strings
+  for (size_t i = 0; i < out_columns.size(); ++i) {
+    if (!dictionary_output[i]) { continue; }
+    if (out_columns[i]->type().id() == type_id::STRING) {
+      out_columns[i] = cudf::dictionary::detail::encode(
+        out_columns[i]->view(), data_type{type_id::UINT32}, stream, _mr);
+    }
+    schema_info[column_indices[i]].children.clear();
+  }
+
+  // Restore the full column selection
+  std::swap(_input_columns, input_columns);
+  std::swap(_output_columns, output_columns);
+
+  return out_columns;
+}
+
+/**
+ * @copydoc cudf::io::detail::parquet::read_filtered
+ */
+std::vector<std::unique_ptr<column>> reader::impl::read_filtered(
+  std::vector<row_group_info> const& selected_row_groups,
+  size_type skip_rows,
+  size_type num_rows,
+  ast::operation const& filter,
+  std::vector<column_name_info>& schema_info,
+  rmm::cuda_stream_view stream)
+{
+  auto const num_columns = static_cast<size_type>(_output_columns.size());
+
+  // Split the output columns into the ones the filter references and the remaining payload
+  std::set<size_type> referenced;
+  collect_column_references(filter, referenced);
+  CUDF_EXPECTS(referenced.empty() || *referenced.rbegin() < num_columns,
+               "The filter references a column that is not read");
+  std::vector<size_type> filter_columns;
+  std::vector<size_type> payload_columns;
+  for (size_type i = 0; i < num_columns; ++i) {
+    // without any column reference the filter is evaluated on all columns
+    if (referenced.empty() || referenced.count(i) != 0) {
+      filter_columns.push_back(i);
+    } else {
+      payload_columns.push_back(i);
+    }
+  }
+  if (filter_columns.empty()) { return {}; }
+
+  // Decode the filter columns first and evaluate the filter
+  auto filter_data =
+    read_columns(selected_row_groups, skip_rows, num_rows, filter_columns, schema_info, stream);
+  // Unreferenced columns are never accessed by the expression; any column of the right size can
+  // take their place in the evaluated table
+  std::vector<column_view> filter_views(num_columns, filter_data.front()->view());
+  for (size_t i = 0; i < filter_columns.size(); ++i) {
+    filter_views[filter_columns[i]] = filter_data[i]->view();
+  }
+  auto const mask = cudf::detail::compute_column(table_view{filter_views}, filter, stream);
+  CUDF_EXPECTS(mask->type().id() == type_id::BOOL8, "The filter expression must return booleans");
+
+  // Start of each selected row group within the selection, and its rows among the decoded ones
+  std::vector<size_type> row_group_starts{0};
+  std::vector<size_type> row_group_offsets{0};
+  for (auto const& rg : selected_row_groups) {
+    row_group_starts.push_back(row_group_starts.back() +
+                               _metadata->get_row_group(rg.index, rg.source_index).num_rows);
+    row_group_offsets.push_back(std::clamp(row_group_starts.back() - skip_rows, 0, num_rows));
+  }
+  auto const matches = count_matches_per_segment(mask->view(), row_group_offsets, stream);
+  auto const [first_match, last_match] = find_match_bounds(mask->view(), stream);
+
+  // Only the row groups with matching rows need their payload columns decoded, and only from the
+  // first to the last matching row, so that the pages outside of those can be skipped
+  std::vector<row_group_info> matching_row_groups;
+  std::vector<size_type> matching_ranges;
+  size_type matching_row_group_rows = 0;
+  size_type payload_skip_rows       = 0;
+  size_type payload_end_row         = 0;
+  for (size_t r = 0; r < selected_row_groups.size(); ++r) {
+    if (matches[r] == 0) { continue; }
+    auto const& rg = selected_row_groups[r];
+    // decoded rows of the row group between the first and the last match
+    auto const begin = std::max(row_group_offsets[r], first_match);
+    auto const end   = std::min(row_group_offsets[r + 1], last_match + 1);
+    // position of the decoded rows within the matching row groups
+    auto const offset = matching_row_group_rows + skip_rows - row_group_starts[r];
+    if (matching_row_groups.empty()) { payload_skip_rows = offset + begin; }
+    payload_end_row = offset + end;
+    matching_row_groups.emplace_back(rg.index, matching_row_group_rows, rg.source_index);
+    matching_row_group_rows += row_group_starts[r + 1] - row_group_starts[r];
+    // merge with the previous range when the row groups are adjacent
+    if (!matching_ranges.empty() && matching_ranges.back() == begin) {
+      matching_ranges.back() = end;
+    } else {
+      matching_ranges.push_back(begin);
+      matching_ranges.push_back(end);
+    }
+  }
+  auto const num_matching_rows = payload_end_row - payload_skip_rows;
+
+  auto payload_data = read_columns(matching_row_groups,
+                                   payload_skip_rows,
+                                   num_matching_rows,
+                                   payload_columns,
+                                   schema_info,
+                                   stream);
+
+  // Restrict the filter columns and the mask to the matching row groups
+  std::vector<column_view> filter_data_views;
+  std::transform(filter_data.cbegin(),
+                 filter_data.cend(),
+                 std::back_inserter(filter_data_views),
+                 [](auto const& col) { return col->view(); });
+  auto const filter_table = table_view{filter_data_views};
+  std::unique_ptr<table> matching_filter_table;
+  std::unique_ptr<column> matching_mask;
+  auto matching_filter_view = filter_table;
+  auto matching_mask_view   = mask->view();
+  if (matching_ranges.empty()) {
+    matching_filter_view = cudf::slice(filter_table, {0, 0})[0];
+    matching_mask_view   = cudf::slice(mask->view(), {0, 0})[0];
+  } else if (num_matching_rows != filter_table.num_rows()) {
+    matching_filter_table =
+      cudf::detail::concatenate(cudf::slice(filter_table, matching_ranges), stream);
+    matching_mask = cudf::detail::concatenate(cudf::slice(mask->view(), matching_ranges), stream);
+    matching_filter_view = matching_filter_table->view();
+    matching_mask_view   = matching_mask->view();
+  }
+
+  // Assemble the columns in output order and drop the rows that do not satisfy the filter
+  std::vector<column_view> all_views(num_columns);
+  for (size_t i = 0; i < filter_columns.size(); ++i) {
+    all_views[filter_columns[i]] = matching_filter_view.column(i);
+  }
+  for (size_t i = 0; i < payload_columns.size(); ++i) {
+    all_views[payload_columns[i]] = payload_data[i]->view();
+  }
+  return cudf::detail::apply_boolean_mask(table_view{all_views}, matching_mask_view, stream, _mr)
+    ->release();
+}
+
+std::shared_ptr<aggregate_reader_metadata const> read_metadata(
+  std::vector<std::unique_ptr<datasource>> const& sources,
+  std::vector<std::string> const& filepaths)
+{
+  return std::make_shared<aggregate_reader_metadata const>(
+    sources, get_source_files(filepaths, sources.size()));
+}
+
+void set_metadata_cache_capacity(size_t capacity) { get_metadata_cache().set_capacity(capacity); }
+
+size_t get_metadata_cache_capacity() { return get_metadata_cache().capacity(); }
+
+reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
+                   parquet_reader_options const& options,
+                   rmm::mr::device_memory_resource* mr)
+  : _mr(mr), _sources(std::move(sources))
+{
+  _source_files = get_source_files(options.get_source().filepaths(), _sources.size());
+
+  // Open and parse the source dataset metadata, unless it was parsed by an earlier call
+  if (options.get_dataset_metadata().has_value()) {
+    _metadata = options.get_dataset_metadata().get();
+    CUDF_EXPECTS(_metadata->get_num_sources() == static_cast<size_type>(_sources.size()),
+                 "Dataset metadata does not match the number of sources");
+  } else {
+    _metadata = std::make_shared<aggregate_reader_metadata const>(_sources, _source_files);
+  }
+  _decompression_arena = options.get_decompression_arena();
+  _profile             = options.is_enabled_profile();
+  _pipeline_batch_size = options.get_pipeline_batch_size();
+
+  // Override output timestamp resolution if requested
+  if (options.get_timestamp_type().id() != type_id::EMPTY) {
+    _timestamp_type = options.get_timestamp_type();
+  }
+
+  // Strings may be returned as either string, categorical or dictionary columns
+  _strings_to_categorical = options.is_enabled_convert_strings_to_categories();
+  _strings_to_dictionary  = options.is_enabled_convert_strings_to_dictionary();
+  CUDF_EXPECTS(!(_strings_to_categorical && _strings_to_dictionary),
+               "Strings cannot be converted to both categories and dictionaries");
+
+  // Select only columns required by the options
+  std::tie(_input_columns, _output_columns, _output_column_schemas) =
+    _metadata->select_columns(options.get_columns(),
+                              options.is_enabled_use_pandas_metadata(),
+                              _strings_to_categorical,
+                              _timestamp_type.id());
+}
+
+std::vector<row_group_info> reader::impl::select_row_groups(
+  size_type& skip_rows,
+  size_type& num_rows,
+  std::vector<std::vector<size_type>> const& row_group_list,
+  std::optional<std::reference_wrapper<ast::expression const>> filter,
+  rmm::cuda_stream_view stream)
+{
+  // Select only row groups required
+  auto selected_row_groups = _metadata->select_row_groups(row_group_list, skip_rows, num_rows);
+
+  // Skip the row groups that cannot contain rows matching the filter
+  _num_skipped_row_groups = 0;
+  if (filter.has_value()) {
+    auto const num_selected = selected_row_groups.size();
+
+    selected_row_groups = _metadata->filter_row_groups(selected_row_groups,
+                                                       filter->get(),
+                                                       _output_column_schemas,
+                                                       _strings_to_categorical,
+                                                       _timestamp_type.id(),
+                                                       stream);
+    selected_row_groups = apply_bloom_filters(selected_row_groups, filter->get(), stream);
+    skip_rows           = 0;
+    num_rows  = std::accumulate(
+      selected_row_groups.cbegin(), selected_row_groups.cend(), 0, [&](auto sum, auto const& rg) {
+        return sum + _metadata->get_row_group(rg.index, rg.source_index).num_rows;
+      });
+    filter_pages(selected_row_groups, skip_rows, num_rows, filter->get(), stream);
+    _num_skipped_row_groups = num_selected - selected_row_groups.size();
+  }
+  return selected_row_groups;
+}
+
+std::vector<row_group_info> reader::impl::apply_bloom_filters(
+  std::vector<row_group_info> const& selected_row_groups,
+  ast::expression const& filter,
+  rmm::cuda_stream_view stream)
+{
+  auto const columns = equality_columns(filter, stream);
+  if (columns.empty()) { return selected_row_groups; }
+
+  std::vector<row_group_info> filtered;
+  size_t start_row = 0;
+  for (auto const& rg : selected_row_groups) {
+    std::map<size_type, bloom_filter_data> bloom_filters;
+    for (auto const col_idx : columns) {
+      if (col_idx < 0 || col_idx >= static_cast<size_type>(_output_column_schemas.size())) {
+        continue;
+      }
+      auto const schema_idx = _output_column_schemas[col_idx];
+      auto const& schema    = _metadata->get_schema(schema_idx);
+      // only flat leaf columns have a column chunk holding the values of the output column
+      if (schema.num_children != 0 || schema.max_repetition_level != 0) { continue; }
+      auto const& col_meta = _metadata->get_column_metadata(rg.index, rg.source_index, schema_idx);
+      auto bloom_filter    = read_bloom_filter(*_sources[rg.source_index], col_meta);
+      if (bloom_filter.bitset != nullptr) {
+        bloom_filters.emplace(col_idx, std::move(bloom_filter));
+      }
+    }
+
+    auto const lookup = [&](size_type col_idx) -> std::optional<column_chunk_bloom_filter> {
+      auto const it = bloom_filters.find(col_idx);
+      if (it == bloom_filters.end()) { return std::nullopt; }
+      auto const& schema = _metadata->get_schema(_output_column_schemas[col_idx]);
+      auto const type =
+        data_type{to_type_id(schema, _strings_to_categorical, _timestamp_type.id())};
+      return column_chunk_bloom_filter{
+        type, schema.type, it->second.bitset, it->second.num_bytes};
+    };
+    if (bloom_filters.empty() || may_contain(filter, lookup, stream)) {
+      filtered.emplace_back(rg.index, start_row, rg.source_index);
+      start_row += _metadata->get_row_group(rg.index, rg.source_index).num_rows;
+    }
+  }
+  return filtered;
+}
+
+void reader::impl::filter_pages(std::vector<row_group_info>& selected_row_groups,
+                                size_type& skip_rows,
+                                size_type& num_rows,
+                                ast::expression const& filter,
+                                rmm::cuda_stream_view stream)
+{
+  // Only leaf columns have a page index
+  std::set<size_type> referenced;
+  collect_column_references(filter, referenced);
+  std::vector<size_type> columns;
+  std::vector<int> schema_indices;
+  for (auto const col_idx : referenced) {
+    if (col_idx < 0 || col_idx >= static_cast<size_type>(_output_column_schemas.size())) {
+      continue;
+    }
+    auto const schema_idx = _output_column_schemas[col_idx];
+    if (_metadata->get_schema(schema_idx).num_children != 0) { continue; }
+    columns.push_back(col_idx);
+    schema_indices.push_back(schema_idx);
+  }
+  if (columns.empty() || selected_row_groups.empty()) { return; }
+
+  auto const page_indexes = read_page_indexes(selected_row_groups, schema_indices, true);
+
+  std::vector<row_group_info> candidates;
+  size_t start_row       = 0;
+  size_t first_candidate = 0;
+  size_t end_candidate   = 0;
+  for (size_t r = 0; r < selected_row_groups.size(); ++r) {
+    auto const& rg     = selected_row_groups[r];
+    auto const rg_rows = _metadata->get_row_group(rg.index, rg.source_index).num_rows;
+    auto page_ranges   = [&](size_type col_idx) -> std::optional<std::vector<page_range>> {
+      auto const it = std::find(columns.cbegin(), columns.cend(), col_idx);
+      if (it == columns.cend()) { return std::nullopt; }
+      auto const c      = std::distance(columns.cbegin(), it);
+      auto const& index = page_indexes[r * columns.size() + c];
+      if (!index.column_index.has_value() || !index.offset_index.has_value()) {
+        return std::nullopt;
+      }
+      // as for the column chunk statistics, the values of converted columns are not comparable
+      auto const& schema     = _metadata->get_schema(schema_indices[c]);
+      auto const file_type   = to_type_id(schema, _strings_to_categorical, type_id::EMPTY);
+      auto const output_type = to_type_id(schema, _strings_to_categorical, _timestamp_type.id());
+      auto pages             = decode_page_ranges(
+        *index.column_index, *index.offset_index, schema, data_type{file_type}, rg_rows);
+      if (pages.has_value() && file_type != output_type) {
+        for (auto& page : *pages) {
+          page.values.type = data_type{output_type};
+          page.values.min.reset();
+          page.values.max.reset();
+        }
+      }
+      return pages;
+    };
+    auto const rows = candidate_rows(filter, page_ranges, rg_rows, stream);
+    if (rows.first >= rows.second) { continue; }
+    if (candidates.empty()) { first_candidate = start_row + rows.first; }
+    end_candidate = start_row + rows.second;
+    candidates.emplace_back(rg.index, start_row, rg.source_index);
+    start_row += rg_rows;
+  }
+
+  selected_row_groups = std::move(candidates);
+  skip_rows           = first_candidate;
+  num_rows            = end_candidate - first_candidate;
+}
+
+table_with_metadata reader::impl::read_rows(
+  std::vector<row_group_info> const& selected_row_groups,
+  size_type skip_rows,
+  size_type num_rows,
+  std::optional<std::reference_wrapper<ast::expression const>> filter,
+  rmm::cuda_stream_view stream)
+{
+  std::vector<column_name_info> schema_info(_output_columns.size());
+
+  std::optional<reader_profiler> profiler;
+  if (_profile) { profiler.emplace(); }
+  _profiler = profiler.has_value() ? &profiler.value() : nullptr;
+  // The row groups skipped by the filter are counted once, by the first chunk of a chunked read
+  auto const num_skipped_row_groups = std::exchange(_num_skipped_row_groups, 0);
+  if (_profiler != nullptr) { _profiler->counters().pages_skipped += num_skipped_row_groups; }
+
+  // output cudf columns as determined by the top level schema
+  std::vector<std::unique_ptr<column>> out_columns;
+  if (filter.has_value()) {
+    auto const filter_op = dynamic_cast<ast::operation const*>(&filter->get());
+    CUDF_EXPECTS(filter_op != nullptr, "The filter expression must be an operation");
+    out_columns =
+      read_filtered(selected_row_groups, skip_rows, num_rows, *filter_op, schema_info, stream);
+  } else {
+    std::vector<size_type> all_columns(_output_columns.size());
+    std::iota(all_columns.begin(), all_columns.end(), 0);
+    out_columns =
+      read_columns(selected_row_groups, skip_rows, num_rows, all_columns, schema_info, stream);
+  }
+
+  table_metadata out_metadata;
+  out_metadata.schema_info = std::move(schema_info);
+
   // Return column names (must match order of returned columns)
   out_metadata.column_names.resize(_output_columns.size());
   for (size_t i = 0; i < _output_column_schemas.size(); i++) {
@@ -1801,9 +3113,106 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   // Return user metadata
   out_metadata.user_data = _metadata->get_key_value_metadata();
 
+  if (profiler.has_value()) {
+    out_metadata.profile = profiler->finish(stream);
+    _profiler            = nullptr;
+  }
+
   return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
 }
 
+table_with_metadata reader::impl::read(
+  size_type skip_rows,
+  size_type num_rows,
+  std::vector<std::vector<size_type>> const& row_group_list,
+  std::optional<std::reference_wrapper<ast::expression const>> filter,
+  rmm::cuda_stream_view stream)
+{
+  auto const selected_row_groups =
+    select_row_groups(skip_rows, num_rows, row_group_list, filter, stream);
+  return read_rows(selected_row_groups, skip_rows, num_rows, filter, stream);
+}
+
+void reader::impl::setup_chunks(
+  std::size_t chunk_read_limit,
+  size_type skip_rows,
+  size_type num_rows,
+  std::vector<std::vector<size_type>> const& row_group_list,
+  std::optional<std::reference_wrapper<ast::expression const>> filter,
+  rmm::cuda_stream_view stream)
+{
+  auto const selected_row_groups =
+    select_row_groups(skip_rows, num_rows, row_group_list, filter, stream);
+  _chunk_filter  = filter;
+  _current_chunk = 0;
+  _chunks.clear();
+
+  // The filtered read evaluates the filter over whole row groups, so those are never split
+  auto const split_row_groups = not filter.has_value();
+  auto const end_row          = static_cast<size_t>(skip_rows) + num_rows;
+
+  chunk_read_info chunk;
+  size_t chunk_bytes          = 0;  // estimated decoded size of the rows in `chunk`
+  size_t chunk_row_group_rows = 0;  // total number of rows of the row groups in `chunk`
+  auto add_rows = [&](row_group_info const& rg, size_t first_row, size_t last_row, size_t bytes) {
+    if (chunk.num_rows > 0 && chunk_read_limit > 0 && chunk_bytes + bytes > chunk_read_limit) {
+      _chunks.push_back(std::move(chunk));
+      chunk                = chunk_read_info{};
+      chunk_bytes          = 0;
+      chunk_row_group_rows = 0;
+    }
+    auto const rg_rows = _metadata->get_row_group(rg.index, rg.source_index).num_rows;
+    if (chunk.row_groups.empty()) { chunk.skip_rows = static_cast<size_type>(first_row - rg.start_row); }
+    if (chunk.row_groups.empty() || chunk.row_groups.back().index != rg.index ||
+        chunk.row_groups.back().source_index != rg.source_index) {
+      chunk.row_groups.emplace_back(rg.index, chunk_row_group_rows, rg.source_index);
+      chunk_row_group_rows += rg_rows;
+    }
+    chunk.num_rows += static_cast<size_type>(last_row - first_row);
+    chunk_bytes += bytes;
+  };
+
+  for (auto const& rg : selected_row_groups) {
+    // rows of the row group within the requested range
+    auto const rg_rows   = _metadata->get_row_group(rg.index, rg.source_index).num_rows;
+    auto const first_row = std::max<size_t>(rg.start_row, skip_rows);
+    auto const last_row  = std::min<size_t>(rg.start_row + rg_rows, end_row);
+    if (first_row >= last_row) { continue; }
+
+    // estimate the decoded size from the uncompressed size of the selected column chunks
+    size_t const rg_bytes = std::accumulate(
+      _input_columns.cbegin(), _input_columns.cend(), size_t{0}, [&](auto sum, auto const& col) {
+        return sum +
+               _metadata->get_column_metadata(rg.index, rg.source_index, col.schema_idx)
+                 .total_uncompressed_size;
+      });
+    auto const bytes_per_row = static_cast<double>(rg_bytes) / rg_rows;
+    auto const rows_bytes    = static_cast<size_t>(bytes_per_row * (last_row - first_row));
+
+    if (not split_row_groups || chunk_read_limit == 0 || rows_bytes <= chunk_read_limit) {
+      add_rows(rg, first_row, last_row, rows_bytes);
+      continue;
+    }
+    // split the row group into pieces that each fit within the limit
+    auto const piece_rows =
+      std::max<size_t>(1, static_cast<size_t>(chunk_read_limit / bytes_per_row));
+    for (auto row = first_row; row < last_row; row += piece_rows) {
+      auto const piece_end = std::min(row + piece_rows, last_row);
+      add_rows(rg, row, piece_end, static_cast<size_t>(bytes_per_row * (piece_end - row)));
+    }
+  }
+
+  // Always produce at least one chunk so that an empty selection yields an empty table
+  if (chunk.num_rows > 0 || _chunks.empty()) { _chunks.push_back(std::move(chunk)); }
+}
+
+table_with_metadata reader::impl::read_chunk(rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(has_next(), "No more chunks to read");
+  auto const& chunk = _chunks[_current_chunk++];
+  return read_rows(chunk.row_groups, chunk.skip_rows, chunk.num_rows, _chunk_filter, stream);
+}
+
 // Forward to implementation
 reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
                parquet_reader_options const& options,
@@ -1819,11 +3228,58 @@ reader::~reader() = default;
 table_with_metadata reader::read(parquet_reader_options const& options,
                                  rmm::cuda_stream_view stream)
 {
-  return _impl->read(
-    options.get_skip_rows(), options.get_num_rows(), options.get_row_groups(), stream);
+  return _impl->read(options.get_skip_rows(),
+                     options.get_num_rows(),
+                     options.get_row_groups(),
+                     options.get_filter(),
+                     stream);
 }
 
+// Forward to implementation
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                               parquet_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+  : reader(std::move(sources), options, mr), _stream(stream)
+{
+  _impl->setup_chunks(chunk_read_limit,
+                      options.get_skip_rows(),
+                      options.get_num_rows(),
+                      options.get_row_groups(),
+                      options.get_filter(),
+                      stream);
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk() { return _impl->read_chunk(_stream); }
+
 }  // namespace parquet
 }  // namespace detail
+
+size_type parquet_dataset_metadata::num_sources() const
+{
+  CUDF_EXPECTS(has_value(), "Dataset metadata has not been read");
+  return _metadata->get_num_sources();
+}
+
+size_type parquet_dataset_metadata::num_rows() const
+{
+  CUDF_EXPECTS(has_value(), "Dataset metadata has not been read");
+  return _metadata->get_num_rows();
+}
+
+size_type parquet_dataset_metadata::num_row_groups() const
+{
+  CUDF_EXPECTS(has_value(), "Dataset metadata has not been read");
+  return _metadata->get_num_row_groups();
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,19 +21,25 @@
 
 #pragma once
 
+#include "metadata_cache.hpp"
 #include "parquet.hpp"
 #include "parquet_gpu.hpp"
 
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/reader_profiler.hpp>
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/detail/parquet.hpp>
 #include <cudf/io/parquet.hpp>
 
+#include <rmm/cuda_stream.hpp>
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -48,6 +54,36 @@ using namespace cudf::io;
 // Forward declarations
 class aggregate_reader_metadata;
 
+/**
+ * @brief Row group selected for reading
+ */
+struct row_group_info {
+  size_type const index;
+  size_t const start_row;  // TODO source index
+  size_type const source_index;
+  row_group_info(size_type index, size_t start_row, size_type source_index)
+    : index(index), start_row(start_row), source_index(source_index)
+  {
+  }
+};
+
+/**
+ * @brief Page index of a column chunk; the parts that are absent from the file are empty
+ */
+struct column_chunk_page_index {
+  std::optional<OffsetIndex> offset_index;
+  std::optional<ColumnIndex> column_index;
+};
+
+/**
+ * @brief Rows decoded by one `read_chunk()` call of the chunked reader
+ */
+struct chunk_read_info {
+  std::vector<row_group_info> row_groups;  // starting rows are relative to the chunk
+  size_type skip_rows = 0;                 // rows to skip from the start of the first row group
+  size_type num_rows  = 0;                 // rows to read
+};
+
 /**
  * @brief Implementation for Parquet reader
  */
@@ -70,6 +106,7 @@ class reader::impl {
    * @param skip_rows Number of rows to skip from the start
    * @param num_rows Number of rows to read
    * @param row_group_indices TODO
+   * @param filter Optional expression used to skip row groups based on column statistics
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return The set of columns along with metadata
@@ -77,27 +114,198 @@ class reader::impl {
   table_with_metadata read(size_type skip_rows,
                            size_type num_rows,
                            std::vector<std::vector<size_type>> const& row_group_indices,
+                           std::optional<std::reference_wrapper<ast::expression const>> filter,
                            rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Splits the data selected by the options into chunks for the chunked reader
+   *
+   * @param chunk_read_limit Limit on the estimated size in bytes of each chunk, or `0` for no limit
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read
+   * @param row_group_indices Lists of row groups to read, one per source
+   * @param filter Optional boolean expression that rows must satisfy
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void setup_chunks(std::size_t chunk_read_limit,
+                    size_type skip_rows,
+                    size_type num_rows,
+                    std::vector<std::vector<size_type>> const& row_group_indices,
+                    std::optional<std::reference_wrapper<ast::expression const>> filter,
+                    rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns whether the chunked reader has chunks left to read
+   */
+  [[nodiscard]] bool has_next() const { return _current_chunk < _chunks.size(); }
+
+  /**
+   * @brief Reads the next chunk set up by `setup_chunks`
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns of the chunk along with metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream);
+
  private:
+  /**
+   * @brief Selects the row groups to read, skipping those that cannot satisfy the filter
+   *
+   * @param[in,out] skip_rows Number of rows to skip from the start
+   * @param[in,out] num_rows Number of rows to read
+   * @param row_group_indices Lists of row groups to read, one per source
+   * @param filter Optional boolean expression that rows must satisfy
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The selected row groups
+   */
+  std::vector<row_group_info> select_row_groups(
+    size_type& skip_rows,
+    size_type& num_rows,
+    std::vector<std::vector<size_type>> const& row_group_indices,
+    std::optional<std::reference_wrapper<ast::expression const>> filter,
+    rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Removes the row groups whose bloom filters prove that no row can satisfy a filter
+   *
+   * Bloom filters are only read for the columns that the filter compares for equality with a
+   * literal. Nothing changes for files without bloom filters.
+   *
+   * @param selected_row_groups Row groups to read
+   * @param filter Boolean expression over the output columns
+   * @param stream CUDA stream used to read the filter literals
+   *
+   * @return Remaining row groups, with starting rows relative to the first remaining row group
+   */
+  std::vector<row_group_info> apply_bloom_filters(
+    std::vector<row_group_info> const& selected_row_groups,
+    ast::expression const& filter,
+    rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Narrows a selection of row groups down to the pages whose statistics allow rows to
+   * satisfy a filter
+   *
+   * Uses the page index of the columns referenced by the filter. Row groups without any such page
+   * are removed, and the leading and trailing rows of the selection that are held by pages that
+   * cannot satisfy the filter are skipped. Nothing changes for files without a page index.
+   *
+   * @param[in,out] selected_row_groups Row groups to read, with starting rows relative to the first
+   * @param[out] skip_rows Number of rows to skip from the start of the selection
+   * @param[out] num_rows Number of rows to read
+   * @param filter Boolean expression over the output columns
+   * @param stream CUDA stream used to read the filter literals
+   */
+  void filter_pages(std::vector<row_group_info>& selected_row_groups,
+                    size_type& skip_rows,
+                    size_type& num_rows,
+                    ast::expression const& filter,
+                    rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Reads the rows of a selection of row groups into a table
+   *
+   * @param selected_row_groups Row groups to read
+   * @param skip_rows Number of rows to skip from the start of the selection
+   * @param num_rows Number of rows to read
+   * @param filter Optional boolean expression that rows must satisfy
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_rows(
+    std::vector<row_group_info> const& selected_row_groups,
+    size_type skip_rows,
+    size_type num_rows,
+    std::optional<std::reference_wrapper<ast::expression const>> filter,
+    rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Reads and decodes a subset of the top-level output columns
+   *
+   * @param selected_row_groups Row groups to read
+   * @param skip_rows Number of rows to skip from the start of the selection
+   * @param num_rows Number of rows to read
+   * @param column_indices Indices of the top-level output columns to read
+   * @param schema_info Names of all output columns; the entries of the read columns are filled
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The decoded columns, in the order of `column_indices`
+   */
+  std::vector<std::unique_ptr<column>> read_columns(
+    std::vector<row_group_info> const& selected_row_groups,
+    size_type skip_rows,
+    size_type num_rows,
+    std::vector<size_type> const& column_indices,
+    std::vector<column_name_info>& schema_info,
+    rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Reads the rows that satisfy a filter, decoding payload columns late
+   *
+   * The columns referenced by the filter are decoded first and the filter is evaluated on them.
+   * The remaining columns are then only decoded for the row groups that contain matching rows,
+   * from the first to the last matching row.
+   *
+   * @param selected_row_groups Row groups to read
+   * @param skip_rows Number of rows to skip from the start of the selection
+   * @param num_rows Number of rows to read
+   * @param filter Boolean expression over the output columns
+   * @param schema_info Names of all output columns, filled by this function
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return All output columns, holding only the rows that satisfy the filter
+   */
+  std::vector<std::unique_ptr<column>> read_filtered(
+    std::vector<row_group_info> const& selected_row_groups,
+    size_type skip_rows,
+    size_type num_rows,
+    ast::operation const& filter,
+    std::vector<column_name_info>& schema_info,
+    rmm::cuda_stream_view stream);
+
   /**
    * @brief Reads compressed page data to device memory
    *
+   * The ranges read from each source are passed to it in a single vectored read, the host reads
+   * and the device reads separately.
+   *
    * @param page_data Buffers to hold compressed page data for each chunk
    * @param chunks List of column chunk descriptors
    * @param begin_chunk Index of first column chunk to read
    * @param end_chunk Index after the last column chunk to read
    * @param column_chunk_offsets File offset for all chunks
+   * @param column_chunk_gaps Offset, relative to the chunk's file offset, and size of the bytes
+   * skipped within each chunk; the size is zero when the chunk data is contiguous
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    */
-  std::future<void> read_column_chunks(std::vector<std::unique_ptr<datasource::buffer>>& page_data,
-                                       hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
-                                       size_t begin_chunk,
-                                       size_t end_chunk,
-                                       const std::vector<size_t>& column_chunk_offsets,
-                                       std::vector<size_type> const& chunk_source_map,
-                                       rmm::cuda_stream_view stream);
+  std::future<void> read_column_chunks(
+    std::vector<std::unique_ptr<datasource::buffer>>& page_data,
+    hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
+    size_t begin_chunk,
+    size_t end_chunk,
+    const std::vector<size_t>& column_chunk_offsets,
+    std::vector<std::pair<size_t, size_t>> const& column_chunk_gaps,
+    std::vector<size_type> const& chunk_source_map,
+    rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Reads the page indexes of a set of column chunks
+   *
+   * @param row_groups Row groups holding the column chunks
+   * @param schema_indices Schema indices of the leaf columns of the column chunks
+   * @param with_column_index Whether to read the column indexes in addition to the offset indexes
+   *
+   * @return The page index of each column chunk, row group by row group in the order of
+   * `schema_indices`
+   */
+  std::vector<column_chunk_page_index> read_page_indexes(
+    std::vector<row_group_info> const& row_groups,
+    std::vector<int> const& schema_indices,
+    bool with_column_index);
 
   /**
    * @brief Returns the number of total pages from the given column chunks
@@ -121,6 +329,24 @@ class reader::impl {
                            hostdevice_vector<gpu::PageInfo>& pages,
                            rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Returns the page information from the given column chunks, reusing the page headers
+   * decoded by earlier reads when all of them are cached.
+   *
+   * The page headers of the chunks that were not cached are added to the cache.
+   *
+   * @param chunks List of column chunk descriptors
+   * @param cache_keys Cache key of each chunk, unset for chunks that cannot be cached; empty if
+   * the cache is disabled
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The page information, empty if the chunks hold no pages
+   */
+  hostdevice_vector<gpu::PageInfo> load_page_headers(
+    hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
+    std::vector<std::optional<metadata_cache_key>> const& cache_keys,
+    rmm::cuda_stream_view stream);
+
   /**
    * @brief Decompresses the page data, at page granularity.
    *
@@ -128,12 +354,28 @@ class reader::impl {
    * @param pages List of page information
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
-   * @return Device buffer to decompressed page data
+   * @return Device buffer to decompressed page data, allocated from the decompression arena if
+   * one is set
    */
   rmm::device_buffer decompress_page_data(hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
                                           hostdevice_vector<gpu::PageInfo>& pages,
                                           rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Rewrites the delta-encoded and byte-stream-split data pages with the plain encoding.
+   *
+   * The rewritten pages point to the returned buffer; other pages are left untouched.
+   *
+   * @param chunks List of column chunk descriptors
+   * @param pages List of page information
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Device buffer to the rewritten page data, empty if there are no such pages
+   */
+  rmm::device_buffer rewrite_delta_pages(hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
+                                         hostdevice_vector<gpu::PageInfo>& pages,
+                                         rmm::cuda_stream_view stream);
+
   /**
    * @brief Allocate nesting information storage for all pages and set pointers
    *        to it.
@@ -180,26 +422,75 @@ class reader::impl {
                           rmm::cuda_stream_view stream);
 
   /**
-   * @brief Converts the page data and outputs to columns.
+   * @brief Allocates every output column, and all of its children, to hold `total_rows` rows.
+   *
+   * Only valid for schemas without lists, whose output sizes are known upfront.
+   *
+   * @param total_rows Number of rows to output
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void allocate_columns(size_t total_rows, rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Reads and decodes the column chunks in batches of row groups, reading each batch while
+   * the previous one is decoded.
+   *
+   * Only valid for schemas without lists. The output columns are allocated and filled with the
+   * decoded data.
    *
    * @param chunks List of column chunk descriptors
-   * @param pages List of page information
-   * @param page_nesting Page nesting array
+   * @param page_data Buffers to hold the compressed page data of each chunk
+   * @param decomp_page_data Buffers holding the decompressed page data of each batch, which must
+   * be kept alive until the output columns are created
+   * @param batches Range of column chunks of each batch
+   * @param column_chunk_offsets File offset of each chunk
+   * @param column_chunk_gaps Offset and size of the bytes skipped within each chunk
+   * @param chunk_source_map Source index of each chunk
+   * @param chunk_cache_keys Page header cache key of each chunk, empty if the cache is disabled
    * @param min_row Minimum number of rows from start
    * @param total_rows Number of rows to output
    * @param stream CUDA stream used for device memory operations and kernel launches.
    */
-  void decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
-                        hostdevice_vector<gpu::PageInfo>& pages,
-                        hostdevice_vector<gpu::PageNestingInfo>& page_nesting,
+  void decode_pipelined(hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
+                        std::vector<std::unique_ptr<datasource::buffer>>& page_data,
+                        std::vector<rmm::device_buffer>& decomp_page_data,
+                        std::vector<std::pair<size_t, size_t>> const& batches,
+                        std::vector<size_t> const& column_chunk_offsets,
+                        std::vector<std::pair<size_t, size_t>> const& column_chunk_gaps,
+                        std::vector<size_type> const& chunk_source_map,
+                        std::vector<std::optional<metadata_cache_key>> const& chunk_cache_keys,
                         size_t min_row,
                         size_t total_rows,
                         rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Converts the page data and outputs to columns.
+   *
+   * @param chunks List of column chunk descriptors
+   * @param pages List of page information
+   * @param page_nesting Page nesting array
+   * @param min_row Minimum number of rows from start
+   * @param total_rows Number of rows to output
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Index of the string dictionaries, which the chunks' `str_dict_index` point into
+   */
+  rmm::device_uvector<string_index_pair> decode_page_data(
+    hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
+    hostdevice_vector<gpu::PageInfo>& pages,
+    hostdevice_vector<gpu::PageNestingInfo>& page_nesting,
+    size_t min_row,
+    size_t total_rows,
+    rmm::cuda_stream_view stream);
+
  private:
   rmm::mr::device_memory_resource* _mr = nullptr;
   std::vector<std::unique_ptr<datasource>> _sources;
-  std::unique_ptr<aggregate_reader_metadata> _metadata;
+  // Identities of the source files, if the metadata cache is enabled and the sources are files
+  std::vector<std::optional<file_identity>> _source_files;
+  std::shared_ptr<aggregate_reader_metadata const> _metadata;
+  // Arena the decompressed pages are allocated from; null is the current device resource
+  std::shared_ptr<decompression_arena> _decompression_arena;
 
   // input columns to be processed
   std::vector<input_column_info> _input_columns;
@@ -209,7 +500,24 @@ class reader::impl {
   std::vector<int> _output_column_schemas;
 
   bool _strings_to_categorical = false;
+  bool _strings_to_dictionary  = false;
   data_type _timestamp_type{type_id::EMPTY};
+
+  // chunks to be decoded by the chunked reader
+  std::vector<chunk_read_info> _chunks;
+  size_t _current_chunk = 0;
+  std::optional<std::reference_wrapper<ast::expression const>> _chunk_filter;
+
+  // stream the reads of pipelined decodes are issued on, created on first use
+  std::optional<rmm::cuda_stream> _io_stream;
+  // compressed size of the row group batches whose reads overlap with decoding the previous one
+  size_t _pipeline_batch_size = default_pipeline_batch_size;
+
+  // whether reads return a profile, and the profiler of the read in progress if they do
+  bool _profile              = false;
+  reader_profiler* _profiler = nullptr;
+  // number of row groups the filter of the read skipped, counted into its profile
+  size_t _num_skipped_row_groups = 0;
 };
 
 }  // namespace parquet
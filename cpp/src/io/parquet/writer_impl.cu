@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,7 +22,9 @@
 #include "writer_impl.hpp"
 #include <io/statistics/column_statistics.cuh>
 
+#include "bloom_filter.hpp"
 #include "compact_protocol_writer.hpp"
+#include <io/comp/nvcomp_adapter.hpp>
 #include <io/utilities/column_utils.cuh>
 #include <io/utilities/config_utils.hpp>
 
@@ -39,8 +41,6 @@
 #include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
 
-#include <nvcomp/snappy.h>
-
 #include <thrust/binary_search.h>
 
 #include <algorithm>
@@ -62,6 +62,19 @@ namespace {
 template <typename T>
 using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
 
+/**
+ * @brief Function that translates parquet compression to the nvcomp format used for its pages
+ */
+nvcomp::compression_type to_nvcomp_compression(parquet::Compression compression)
+{
+  switch (compression) {
+    case parquet::Compression::SNAPPY: return nvcomp::compression_type::SNAPPY;
+    case parquet::Compression::ZSTD: return nvcomp::compression_type::ZSTD;
+    case parquet::Compression::LZ4_RAW: return nvcomp::compression_type::LZ4;
+    default: CUDF_FAIL("Unsupported compression type");
+  }
+}
+
 /**
  * @brief Function that translates GDF compression to parquet compression
  */
@@ -70,6 +83,8 @@ parquet::Compression to_parquet_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return parquet::Compression::SNAPPY;
+    case compression_type::ZSTD: return parquet::Compression::ZSTD;
+    case compression_type::LZ4: return parquet::Compression::LZ4_RAW;
     case compression_type::NONE: return parquet::Compression::UNCOMPRESSED;
     default:
       CUDF_EXPECTS(false, "Unsupported compression type");
@@ -77,6 +92,169 @@ parquet::Compression to_parquet_compression(compression_type compression)
   }
 }
 
+/**
+ * @brief Function that translates the declared sort order of the rows to parquet sorting columns
+ */
+std::vector<SortingColumn> to_parquet_sorting_columns(std::vector<sorting_column> const& columns)
+{
+  std::vector<SortingColumn> sorting_columns;
+  sorting_columns.reserve(columns.size());
+  for (auto const& column : columns) {
+    sorting_columns.push_back({column.column_idx, column.is_descending, column.is_nulls_first});
+  }
+  return sorting_columns;
+}
+
+/**
+ * @brief Function that translates the encoding of the data pages of a chunk to the encoding
+ * reported to the user
+ */
+column_encoding to_column_encoding(Encoding encoding)
+{
+  switch (encoding) {
+    case Encoding::PLAIN_DICTIONARY: return column_encoding::DICTIONARY;
+    case Encoding::DELTA_BINARY_PACKED: return column_encoding::DELTA_BINARY_PACKED;
+    case Encoding::DELTA_BYTE_ARRAY: return column_encoding::DELTA_BYTE_ARRAY;
+    case Encoding::BYTE_STREAM_SPLIT: return column_encoding::BYTE_STREAM_SPLIT;
+    default: return column_encoding::PLAIN;
+  }
+}
+
+/**
+ * @brief Selects the encoding with the smallest estimated size for the data pages of a chunk
+ *
+ * The dictionary encoding is only a candidate if the chunk can be dictionary encoded, and the
+ * delta encodings only if their size was estimated, i.e. for integer and string chunks.
+ *
+ * @param ck Column chunk, with its sizes computed
+ * @param physical_type Physical type of the column
+ * @param is_compressed Whether the pages are compressed
+ */
+Encoding select_chunk_encoding(gpu::EncColumnChunk const& ck,
+                               Type physical_type,
+                               bool is_compressed)
+{
+  // The chunk only uses a dictionary at this point if it is smaller than the plain encoding
+  auto encoding     = Encoding::PLAIN;
+  auto encoded_size = static_cast<int64_t>(ck.plain_data_size);
+  if (ck.use_dictionary) {
+    encoding     = Encoding::PLAIN_DICTIONARY;
+    encoded_size = ck.uniq_data_size + util::div_rounding_up_safe<int64_t>(
+                                         static_cast<int64_t>(ck.num_values) * ck.dict_rle_bits, 8);
+  }
+  if (ck.delta_data_size > 0 && ck.delta_data_size < encoded_size) {
+    switch (physical_type) {
+      case Type::INT32:
+      case Type::INT64: return Encoding::DELTA_BINARY_PACKED;
+      case Type::BYTE_ARRAY: return Encoding::DELTA_BYTE_ARRAY;
+      default: break;
+    }
+  }
+  // Splitting the bytes of floating-point values does not change their size, but groups the
+  // bytes holding the exponents, which compress well
+  if (encoding == Encoding::PLAIN && is_compressed &&
+      (physical_type == Type::FLOAT || physical_type == Type::DOUBLE)) {
+    return Encoding::BYTE_STREAM_SPLIT;
+  }
+  return encoding;
+}
+
+/**
+ * @brief Pages of a batch of row groups and their statistics, used to build the page indexes
+ */
+struct batch_page_info {
+  std::vector<gpu::EncPage> pages;        // Pages, with their encoded sizes
+  std::vector<statistics_chunk> stats;    // Statistics of each page
+  std::vector<Statistics> encoded_stats;  // Statistics of each page, with encoded min and max
+};
+
+/**
+ * @brief Copies the encoded pages of a batch and their statistics to host
+ *
+ * @param pages Pages of the batch, after their headers have been encoded
+ * @param page_stats Statistics of the pages of the batch
+ * @param truncate_length Maximum length of the encoded string minimum and maximum values
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+batch_page_info gather_batch_page_info(device_span<gpu::EncPage const> pages,
+                                       device_span<statistics_chunk const> page_stats,
+                                       uint32_t truncate_length,
+                                       rmm::cuda_stream_view stream)
+{
+  batch_page_info info;
+  info.pages = cudf::detail::make_std_vector_sync(pages, stream);
+  info.stats = cudf::detail::make_std_vector_sync(page_stats, stream);
+
+  // The statistics of a page are no larger than its header
+  std::vector<size_t> blob_offsets(pages.size() + 1, 0);
+  for (size_t i = 0; i < pages.size(); ++i) {
+    blob_offsets[i + 1] = blob_offsets[i] + info.pages[i].max_hdr_size;
+  }
+  auto const d_blob_offsets = cudf::detail::make_device_uvector_async(blob_offsets, stream);
+  rmm::device_uvector<uint8_t> blobs(blob_offsets.back(), stream);
+  rmm::device_uvector<uint32_t> blob_sizes(pages.size(), stream);
+  gpu::EncodePageStatistics(
+    pages, page_stats, d_blob_offsets, blobs.data(), blob_sizes, truncate_length, stream);
+  auto const h_blobs      = cudf::detail::make_std_vector_sync(blobs, stream);
+  auto const h_blob_sizes = cudf::detail::make_std_vector_sync(blob_sizes, stream);
+
+  info.encoded_stats.resize(pages.size());
+  for (size_t i = 0; i < pages.size(); ++i) {
+    CompactProtocolReader cp(h_blobs.data() + blob_offsets[i], h_blob_sizes[i]);
+    CUDF_EXPECTS(cp.read(&info.encoded_stats[i]), "Cannot parse the encoded page statistics");
+  }
+  return info;
+}
+
+/**
+ * @brief Encodes the ColumnIndex and OffsetIndex of a column chunk
+ *
+ * The ColumnIndex is left empty if the min and max of a page holding non-null values are not
+ * known, as readers would otherwise skip the page.
+ *
+ * @param ck Column chunk, after encoding
+ * @param batch Pages of the batch of the chunk
+ * @param first_page_in_batch Index of the first page of the batch
+ * @param chunk_offset File offset of the chunk
+ *
+ * @return The encoded ColumnIndex and OffsetIndex
+ */
+std::pair<std::vector<uint8_t>, std::vector<uint8_t>> encode_page_indexes(
+  gpu::EncColumnChunk const& ck,
+  batch_page_info const& batch,
+  size_t first_page_in_batch,
+  size_t chunk_offset)
+{
+  ColumnIndex column_index;
+  OffsetIndex offset_index;
+  bool has_minmax          = true;
+  auto offset              = chunk_offset;
+  auto const first_page_id = ck.first_page - first_page_in_batch;
+  for (auto p = first_page_id; p < first_page_id + ck.num_pages; ++p) {
+    auto const& page     = batch.pages[p];
+    auto const page_size = page.hdr_size + page.max_data_size;
+    if (page.page_type == PageType::DATA_PAGE) {
+      offset_index.page_locations.push_back({static_cast<int64_t>(offset),
+                                             static_cast<int32_t>(page_size),
+                                             static_cast<int64_t>(page.start_row - ck.start_row)});
+      auto const& stats   = batch.stats[p];
+      auto const& encoded = batch.encoded_stats[p];
+      has_minmax          = has_minmax && (stats.has_minmax || stats.non_nulls == 0);
+      column_index.null_pages.push_back(stats.non_nulls == 0);
+      column_index.min_values.push_back(encoded.min_value);
+      column_index.max_values.push_back(encoded.max_value);
+      column_index.null_counts.push_back(stats.null_count);
+    }
+    offset += page_size;
+  }
+
+  std::vector<uint8_t> encoded_column_index;
+  std::vector<uint8_t> encoded_offset_index;
+  if (has_minmax) { CompactProtocolWriter(&encoded_column_index).write(column_index); }
+  CompactProtocolWriter(&encoded_offset_index).write(offset_index);
+  return {std::move(encoded_column_index), std::move(encoded_offset_index)};
+}
+
 }  // namespace
 
 struct aggregate_writer_metadata {
@@ -180,6 +358,9 @@ struct aggregate_writer_metadata {
     int64_t num_rows = 0;
     std::vector<RowGroup> row_groups;
     std::vector<KeyValue> key_value_metadata;
+    // Encoded ColumnIndex and OffsetIndex of each column chunk, in the order of the chunks
+    std::vector<std::vector<uint8_t>> column_indexes;
+    std::vector<std::vector<uint8_t>> offset_indexes;
   };
   std::vector<per_file_metadata> files;
   std::string created_by         = "";
@@ -249,6 +430,7 @@ struct schema_tree_node : public SchemaElement {
   LinkedColPtr leaf_column;
   statistics_dtype stats_dtype;
   int32_t ts_scale;
+  bool bloom_filter = false;  // Whether to write a bloom filter for each column chunk
 
   // TODO(fut): Think about making schema a class that holds a vector of schema_tree_nodes. The
   // function construct_schema_tree could be its constructor. It can have method to get the per
@@ -649,6 +831,9 @@ std::vector<schema_tree_node> construct_schema_tree(LinkedColVector const& linke
         col_schema.name = (schema[parent_idx].name == "list") ? "element" : col_meta.get_name();
         col_schema.parent_idx  = parent_idx;
         col_schema.leaf_column = col;
+        // bloom filters are only written for top-level columns of a supported type
+        col_schema.bloom_filter = col_meta.is_enabled_bloom_filter() && parent_idx == 0 &&
+                                  gpu::is_bloom_filter_supported(col->type());
         schema.push_back(col_schema);
       }
     };
@@ -683,6 +868,7 @@ struct parquet_column_view {
 
   [[nodiscard]] column_view cudf_column_view() const { return cudf_col; }
   [[nodiscard]] parquet::Type physical_type() const { return schema_node.type; }
+  [[nodiscard]] bool has_bloom_filter() const { return schema_node.bloom_filter; }
 
   std::vector<std::string> const& get_path_in_schema() { return path_in_schema; }
 
@@ -880,13 +1066,24 @@ void writer::impl::init_page_sizes(hostdevice_2dvector<gpu::EncColumnChunk>& chu
                                    uint32_t num_columns)
 {
   chunks.host_to_device(stream);
-  gpu::InitEncoderPages(chunks, {}, col_desc, num_columns, nullptr, nullptr, 0, stream);
+  gpu::InitEncoderPages(chunks,
+                        {},
+                        col_desc,
+                        num_columns,
+                        nullptr,
+                        nullptr,
+                        0,
+                        max_page_size_bytes,
+                        max_page_size_rows,
+                        stream);
   chunks.device_to_host(stream, true);
 }
 
 auto build_chunk_dictionaries(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
                               host_span<gpu::parquet_column_device_view const> col_desc,
                               device_2dspan<gpu::PageFragment const> frags,
+                              bool adaptive_encoding,
+                              bool is_compressed,
                               rmm::cuda_stream_view stream)
 {
   // At this point, we know all chunks and their sizes. We want to allocate dictionaries for each
@@ -917,6 +1114,7 @@ auto build_chunk_dictionaries(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
 
   gpu::initialize_chunk_hash_maps(chunks.device_view().flat_view(), stream);
   gpu::populate_chunk_hash_maps(chunks, frags, stream);
+  if (adaptive_encoding) { gpu::estimate_delta_sizes(chunks, frags, stream); }
 
   chunks.device_to_host(stream, true);
 
@@ -950,6 +1148,19 @@ auto build_chunk_dictionaries(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
     }();
   }
 
+  for (auto& ck : h_chunks) {
+    if (adaptive_encoding) {
+      auto const physical_type = col_desc[ck.col_desc_id].physical_type;
+      ck.encoding              = select_chunk_encoding(ck, physical_type, is_compressed);
+    } else {
+      ck.encoding = ck.use_dictionary ? Encoding::PLAIN_DICTIONARY : Encoding::PLAIN;
+    }
+    if (ck.encoding != Encoding::PLAIN_DICTIONARY) {
+      ck.use_dictionary = false;
+      ck.dict_rle_bits  = 0;
+    }
+  }
+
   // TODO: (enh) Deallocate hash map storage for chunks that don't use dict and clear pointers.
 
   dict_data.reserve(h_chunks.size());
@@ -989,6 +1200,8 @@ void writer::impl::init_encoder_pages(hostdevice_2dvector<gpu::EncColumnChunk>&
                    (num_stats_bfr) ? page_stats_mrg.data() : nullptr,
                    (num_stats_bfr > num_pages) ? page_stats_mrg.data() + num_pages : nullptr,
                    max_page_comp_data_size,
+                   max_page_size_bytes,
+                   max_page_size_rows,
                    stream);
   if (num_stats_bfr > 0) {
     detail::merge_group_statistics<detail::io_file_format::PARQUET>(
@@ -1005,79 +1218,6 @@ void writer::impl::init_encoder_pages(hostdevice_2dvector<gpu::EncColumnChunk>&
   stream.synchronize();
 }
 
-void snappy_compress(device_span<gpu_inflate_input_s const> comp_in,
-                     device_span<gpu_inflate_status_s> comp_stat,
-                     size_t max_page_uncomp_data_size,
-                     rmm::cuda_stream_view stream)
-{
-  size_t num_comp_pages = comp_in.size();
-  try {
-    size_t temp_size;
-    nvcompStatus_t nvcomp_status = nvcompBatchedSnappyCompressGetTempSize(
-      num_comp_pages, max_page_uncomp_data_size, nvcompBatchedSnappyDefaultOpts, &temp_size);
-
-    CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
-                 "Error in getting snappy compression scratch size");
-
-    // Not needed now but nvcomp API makes no promises about future
-    rmm::device_buffer scratch(temp_size, stream);
-    // Analogous to comp_in.srcDevice
-    rmm::device_uvector<void const*> uncompressed_data_ptrs(num_comp_pages, stream);
-    // Analogous to comp_in.srcSize
-    rmm::device_uvector<size_t> uncompressed_data_sizes(num_comp_pages, stream);
-    // Analogous to comp_in.dstDevice
-    rmm::device_uvector<void*> compressed_data_ptrs(num_comp_pages, stream);
-    // Analogous to comp_stat.bytes_written
-    rmm::device_uvector<size_t> compressed_bytes_written(num_comp_pages, stream);
-    // nvcomp does not currently use comp_in.dstSize. Cannot assume that the output will fit in
-    // the space allocated unless one uses the API nvcompBatchedSnappyCompressGetOutputSize()
-
-    // Prepare the vectors
-    auto comp_it = thrust::make_zip_iterator(uncompressed_data_ptrs.begin(),
-                                             uncompressed_data_sizes.begin(),
-                                             compressed_data_ptrs.begin());
-    thrust::transform(rmm::exec_policy(stream),
-                      comp_in.begin(),
-                      comp_in.end(),
-                      comp_it,
-                      [] __device__(gpu_inflate_input_s in) {
-                        return thrust::make_tuple(in.srcDevice, in.srcSize, in.dstDevice);
-                      });
-    nvcomp_status = nvcompBatchedSnappyCompressAsync(uncompressed_data_ptrs.data(),
-                                                     uncompressed_data_sizes.data(),
-                                                     max_page_uncomp_data_size,
-                                                     num_comp_pages,
-                                                     scratch.data(),  // Not needed rn but future
-                                                     scratch.size(),
-                                                     compressed_data_ptrs.data(),
-                                                     compressed_bytes_written.data(),
-                                                     nvcompBatchedSnappyDefaultOpts,
-                                                     stream.value());
-
-    CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess, "Error in snappy compression");
-
-    // nvcomp also doesn't use comp_out.status . It guarantees that given enough output space,
-    // compression will succeed.
-    // The other `comp_out` field is `reserved` which is for internal cuIO debugging and can be 0.
-    thrust::transform(rmm::exec_policy(stream),
-                      compressed_bytes_written.begin(),
-                      compressed_bytes_written.end(),
-                      comp_stat.begin(),
-                      [] __device__(size_t size) {
-                        gpu_inflate_status_s status{};
-                        status.bytes_written = size;
-                        return status;
-                      });
-    return;
-  } catch (...) {
-    // If we reach this then there was an error in compressing so set an error status for each page
-    thrust::for_each(rmm::exec_policy(stream),
-                     comp_stat.begin(),
-                     comp_stat.end(),
-                     [] __device__(gpu_inflate_status_s & stat) { stat.status = 1; });
-  };
-}
-
 void writer::impl::encode_pages(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
                                 device_span<gpu::EncPage> pages,
                                 size_t max_page_uncomp_data_size,
@@ -1108,18 +1248,32 @@ void writer::impl::encode_pages(hostdevice_2dvector<gpu::EncColumnChunk>& chunks
   switch (compression_) {
     case parquet::Compression::SNAPPY:
       if (nvcomp_integration::is_stable_enabled()) {
-        snappy_compress(comp_in, comp_stat, max_page_uncomp_data_size, stream);
+        nvcomp::batched_compress(nvcomp::compression_type::SNAPPY,
+                                 comp_in,
+                                 comp_stat,
+                                 max_page_uncomp_data_size,
+                                 stream);
       } else {
         CUDA_TRY(gpu_snap(comp_in.data(), comp_stat.data(), pages_in_batch, stream));
       }
       break;
+    case parquet::Compression::ZSTD:
+    case parquet::Compression::LZ4_RAW:
+      nvcomp::batched_compress(
+        to_nvcomp_compression(compression_), comp_in, comp_stat, max_page_uncomp_data_size, stream);
+      break;
     default: break;
   }
   // TBD: Not clear if the official spec actually allows dynamically turning off compression at the
   // chunk-level
   auto d_chunks_in_batch = chunks.device_view().subspan(first_rowgroup, rowgroups_in_batch);
   DecideCompression(d_chunks_in_batch.flat_view(), stream);
-  EncodePageHeaders(batch_pages, comp_stat, batch_pages_stats, chunk_stats, stream);
+  EncodePageHeaders(batch_pages,
+                    comp_stat,
+                    batch_pages_stats,
+                    chunk_stats,
+                    statistics_truncate_length_,
+                    stream);
   GatherPages(d_chunks_in_batch.flat_view(), pages, stream);
 
   auto h_chunks_in_batch = chunks.host_view().subspan(first_rowgroup, rowgroups_in_batch);
@@ -1140,9 +1294,14 @@ writer::impl::impl(std::vector<std::unique_ptr<data_sink>> sinks,
     stream(stream),
     max_row_group_size{options.get_row_group_size_bytes()},
     max_row_group_rows{options.get_row_group_size_rows()},
+    max_page_size_bytes{options.get_max_page_size_bytes()},
+    max_page_size_rows{options.get_max_page_size_rows()},
     compression_(to_parquet_compression(options.get_compression())),
     stats_granularity_(options.get_stats_level()),
     int96_timestamps(options.is_enabled_int96_timestamps()),
+    adaptive_encoding_(options.is_enabled_adaptive_encoding()),
+    statistics_truncate_length_(options.get_statistics_truncate_length()),
+    sorting_columns_(to_parquet_sorting_columns(options.get_sorting_columns())),
     kv_md(options.get_key_value_metadata()),
     single_write_mode(mode == SingleWriteMode::YES),
     out_sink_(std::move(sinks))
@@ -1162,9 +1321,14 @@ writer::impl::impl(std::vector<std::unique_ptr<data_sink>> sinks,
     stream(stream),
     max_row_group_size{options.get_row_group_size_bytes()},
     max_row_group_rows{options.get_row_group_size_rows()},
+    max_page_size_bytes{options.get_max_page_size_bytes()},
+    max_page_size_rows{options.get_max_page_size_rows()},
     compression_(to_parquet_compression(options.get_compression())),
     stats_granularity_(options.get_stats_level()),
     int96_timestamps(options.is_enabled_int96_timestamps()),
+    adaptive_encoding_(options.is_enabled_adaptive_encoding()),
+    statistics_truncate_length_(options.get_statistics_truncate_length()),
+    sorting_columns_(to_parquet_sorting_columns(options.get_sorting_columns())),
     kv_md(options.get_key_value_metadata()),
     single_write_mode(mode == SingleWriteMode::YES),
     out_sink_(std::move(sinks))
@@ -1172,6 +1336,9 @@ writer::impl::impl(std::vector<std::unique_ptr<data_sink>> sinks,
   if (options.get_metadata()) {
     table_meta = std::make_unique<table_input_metadata>(*options.get_metadata());
   }
+  if (options.get_max_in_flight_writes() > 0) {
+    async_writer_ = std::make_unique<async_sink_writer>(options.get_max_in_flight_writes());
+  }
   init_state();
 }
 
@@ -1225,6 +1392,10 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
   }
   table_view single_streams_table(cudf_cols);
   size_type num_columns = single_streams_table.num_columns();
+  for (auto const& column : sorting_columns_) {
+    CUDF_EXPECTS(column.column_idx >= 0 && column.column_idx < num_columns,
+                 "Sorting column index out of range of the leaf columns");
+  }
 
   std::vector<SchemaElement> this_table_schema(schema_tree.begin(), schema_tree.end());
 
@@ -1251,40 +1422,53 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
     });
 
   // Init page fragments
-  // 5000 is good enough for up to ~200-character strings. Longer strings will start producing
-  // fragments larger than the desired page size -> TODO: keep track of the max fragment size, and
-  // iteratively reduce this value if the largest fragment exceeds the max page size limit (we
-  // ideally want the page size to be below 1MB so as to have enough pages to get good
-  // compression/decompression performance).
+  // Fragments hold up to 5000 rows, which is good enough for up to ~200-character strings. When
+  // the largest fragment exceeds the target page size, the fragments are rebuilt with
+  // proportionally fewer rows, so that pages of columns with long values stay close to the target.
   using cudf::io::parquet::gpu::max_page_fragment_size;
 
-  std::vector<int> num_frag_in_part;
-  std::transform(partitions.begin(),
-                 partitions.end(),
-                 std::back_inserter(num_frag_in_part),
-                 [](auto const& part) {
-                   return util::div_rounding_up_unsafe(part.num_rows, max_page_fragment_size);
-                 });
-
-  size_type num_fragments = std::reduce(num_frag_in_part.begin(), num_frag_in_part.end());
-
-  std::vector<int> part_frag_offset;  // Store the idx of the first fragment in each partition
-  std::exclusive_scan(
-    num_frag_in_part.begin(), num_frag_in_part.end(), std::back_inserter(part_frag_offset), 0);
-  part_frag_offset.push_back(part_frag_offset.back() + num_frag_in_part.back());
-
-  auto d_part_frag_offset = cudf::detail::make_device_uvector_async(part_frag_offset, stream);
-  cudf::detail::hostdevice_2dvector<gpu::PageFragment> fragments(
-    num_columns, num_fragments, stream);
-
-  if (num_fragments != 0) {
+  if (single_streams_table.num_rows() != 0) {
     // Move column info to device
     col_desc.host_to_device(stream);
     leaf_column_views = create_leaf_column_device_views<gpu::parquet_column_device_view>(
       col_desc, *parent_column_table_device_view, stream);
+  }
 
-    init_page_fragments(
-      fragments, col_desc, partitions, d_part_frag_offset, max_page_fragment_size);
+  auto fragment_size = std::min<size_type>(max_page_fragment_size, max_page_size_rows);
+  std::vector<int> num_frag_in_part(partitions.size());
+  std::vector<int> part_frag_offset;  // Store the idx of the first fragment in each partition
+  rmm::device_uvector<int> d_part_frag_offset(0, stream);
+  cudf::detail::hostdevice_2dvector<gpu::PageFragment> fragments(num_columns, 0, stream);
+  size_type num_fragments = 0;
+  while (true) {
+    std::transform(partitions.begin(),
+                   partitions.end(),
+                   num_frag_in_part.begin(),
+                   [fragment_size](auto const& part) {
+                     return util::div_rounding_up_unsafe(part.num_rows, fragment_size);
+                   });
+
+    num_fragments = std::reduce(num_frag_in_part.begin(), num_frag_in_part.end());
+
+    part_frag_offset.clear();
+    std::exclusive_scan(
+      num_frag_in_part.begin(), num_frag_in_part.end(), std::back_inserter(part_frag_offset), 0);
+    part_frag_offset.push_back(part_frag_offset.back() + num_frag_in_part.back());
+
+    d_part_frag_offset = cudf::detail::make_device_uvector_async(part_frag_offset, stream);
+    fragments = cudf::detail::hostdevice_2dvector<gpu::PageFragment>(
+      num_columns, num_fragments, stream);
+
+    if (num_fragments == 0) { break; }
+    init_page_fragments(fragments, col_desc, partitions, d_part_frag_offset, fragment_size);
+
+    uint32_t max_fragment_data_size = 0;
+    for (auto const& frag : fragments.host_view().flat_view()) {
+      max_fragment_data_size = std::max(max_fragment_data_size, frag.fragment_data_size);
+    }
+    if (max_fragment_data_size <= max_page_size_bytes || fragment_size == 1) { break; }
+    fragment_size = std::max<size_type>(
+      1, static_cast<size_t>(fragment_size) * max_page_size_bytes / max_fragment_data_size);
   }
 
   std::vector<size_t> const global_rowgroup_base = md->num_row_groups_per_file();
@@ -1309,8 +1493,9 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
       if (f > first_frag_in_rg &&  // There has to be at least one fragment in row group
           (curr_rg_data_size + fragment_data_size > max_row_group_size ||
            curr_rg_num_rows + fragment_num_rows > max_row_group_rows)) {
-        auto& rg    = md->file(p).row_groups.emplace_back();
-        rg.num_rows = curr_rg_num_rows;
+        auto& rg           = md->file(p).row_groups.emplace_back();
+        rg.num_rows        = curr_rg_num_rows;
+        rg.sorting_columns = sorting_columns_;
         num_rowgroups++;
         num_rg_in_part[p]++;
         curr_rg_num_rows  = 0;
@@ -1322,8 +1507,9 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
 
       // TODO: (wishful) refactor to consolidate with above if block
       if (f == last_frag_in_part) {
-        auto& rg    = md->file(p).row_groups.emplace_back();
-        rg.num_rows = curr_rg_num_rows;
+        auto& rg           = md->file(p).row_groups.emplace_back();
+        rg.num_rows        = curr_rg_num_rows;
+        rg.sorting_columns = sorting_columns_;
         num_rowgroups++;
         num_rg_in_part[p]++;
       }
@@ -1356,7 +1542,7 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
       size_t global_r = global_rowgroup_base[p] + r;  // Number of rowgroups already in file/part
       auto& row_group = md->file(p).row_groups[global_r];
       uint32_t fragments_in_chunk =
-        util::div_rounding_up_unsafe(row_group.num_rows, max_page_fragment_size);
+        util::div_rounding_up_unsafe(row_group.num_rows, fragment_size);
       row_group.total_byte_size = 0;
       row_group.columns.resize(num_columns);
       for (int c = 0; c < num_columns; c++) {
@@ -1398,15 +1584,23 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
   }
 
   fragments.host_to_device(stream);
-  auto dict_info_owner = build_chunk_dictionaries(chunks, col_desc, fragments, stream);
+  auto dict_info_owner = build_chunk_dictionaries(chunks,
+                                                  col_desc,
+                                                  fragments,
+                                                  adaptive_encoding_,
+                                                  compression_ != Compression::UNCOMPRESSED,
+                                                  stream);
   for (size_t p = 0; p < partitions.size(); p++) {
     for (int rg = 0; rg < num_rg_in_part[p]; rg++) {
-      size_t global_rg = global_rowgroup_base[p] + rg;
+      size_t global_rg   = global_rowgroup_base[p] + rg;
+      auto& rg_encodings = encoding_report_.emplace_back();
       for (int col = 0; col < num_columns; col++) {
-        if (chunks.host_view()[rg][col].use_dictionary) {
+        auto const& ck = chunks.host_view()[rg + first_rg_in_part[p]][col];
+        if (ck.encoding != Encoding::PLAIN) {
           md->file(p).row_groups[global_rg].columns[col].meta_data.encodings.push_back(
-            Encoding::PLAIN_DICTIONARY);
+            ck.encoding);
         }
+        rg_encodings.push_back(to_column_encoding(ck.encoding));
       }
     }
   }
@@ -1425,10 +1619,11 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
 
   size_t max_page_comp_data_size = 0;
   if (compression_ != parquet::Compression::UNCOMPRESSED) {
-    auto status = nvcompBatchedSnappyCompressGetMaxOutputChunkSize(
-      max_page_uncomp_data_size, nvcompBatchedSnappyDefaultOpts, &max_page_comp_data_size);
-    CUDF_EXPECTS(status == nvcompStatus_t::nvcompSuccess,
-                 "Error in getting compressed size from nvcomp");
+    CUDF_EXPECTS(compression_ == parquet::Compression::SNAPPY ||
+                   nvcomp_integration::is_stable_enabled(),
+                 "ZSTD and LZ4 compression require nvCOMP use to be enabled");
+    max_page_comp_data_size = nvcomp::compress_max_output_chunk_size(
+      to_nvcomp_compression(compression_), max_page_uncomp_data_size);
   }
 
   // Find which partition a rg belongs to
@@ -1523,6 +1718,16 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
 
   pinned_buffer<uint8_t> host_bfr{nullptr, cudaFreeHost};
 
+  // Device views of the columns bloom filters are written for
+  std::vector<std::unique_ptr<column_device_view, std::function<void(column_device_view*)>>>
+    bloom_filter_cols(num_columns);
+  for (auto i = 0; i < num_columns; i++) {
+    if (parquet_columns[i].has_bloom_filter()) {
+      bloom_filter_cols[i] =
+        column_device_view::create(parquet_columns[i].cudf_column_view(), stream);
+    }
+  }
+
   // Encode row groups in batches
   for (auto b = 0, r = 0; b < static_cast<size_type>(batch_list.size()); b++) {
     // Count pages in this batch
@@ -1543,6 +1748,14 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
       (stats_granularity_ == statistics_freq::STATISTICS_PAGE) ? page_stats.data() : nullptr,
       (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? page_stats.data() + num_pages
                                                                : nullptr);
+    batch_page_info batch_pages;
+    if (stats_granularity_ == statistics_freq::STATISTICS_COLUMN) {
+      batch_pages = gather_batch_page_info(
+        {pages.data() + first_page_in_batch, static_cast<size_t>(pages_in_batch)},
+        {page_stats.data() + first_page_in_batch, static_cast<size_t>(pages_in_batch)},
+        statistics_truncate_length_,
+        stream);
+    }
     std::vector<std::future<void>> write_tasks;
     for (; r < rnext; r++) {
       int p           = rg_to_part[r];
@@ -1560,6 +1773,8 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
         }
 
         if (out_sink_[p]->is_device_write_preferred(ck.compressed_size)) {
+          // Queued writes to the sink must complete first to keep the chunks in order
+          if (async_writer_) { async_writer_->wait(); }
           // let the writer do what it wants to retrieve the data from the gpu.
           write_tasks.push_back(out_sink_[p]->device_write_async(
             dev_bfr + ck.ck_stat_size, ck.compressed_size, stream));
@@ -1573,6 +1788,19 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
                                      stream.value()));
             stream.synchronize();
           }
+        } else if (async_writer_) {
+          // Written from a bounce buffer while the following chunks are encoded
+          async_writer_->device_write(
+            out_sink_[p].get(), dev_bfr + ck.ck_stat_size, ck.compressed_size, stream);
+          if (ck.ck_stat_size != 0) {
+            column_chunk_meta.statistics_blob.resize(ck.ck_stat_size);
+            CUDA_TRY(cudaMemcpyAsync(column_chunk_meta.statistics_blob.data(),
+                                     dev_bfr,
+                                     ck.ck_stat_size,
+                                     cudaMemcpyDeviceToHost,
+                                     stream.value()));
+            stream.synchronize();
+          }
         } else {
           if (!host_bfr) {
             host_bfr = pinned_buffer<uint8_t>{[](size_t size) {
@@ -1602,8 +1830,47 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
           (ck.use_dictionary) ? current_chunk_offset[p] : 0;
         column_chunk_meta.total_uncompressed_size = ck.bfr_size;
         column_chunk_meta.total_compressed_size   = ck.compressed_size;
+        if (stats_granularity_ == statistics_freq::STATISTICS_COLUMN) {
+          auto [column_index, offset_index] =
+            encode_page_indexes(ck, batch_pages, first_page_in_batch, current_chunk_offset[p]);
+          md->file(p).column_indexes.push_back(std::move(column_index));
+          md->file(p).offset_indexes.push_back(std::move(offset_index));
+        }
         current_chunk_offset[p] += ck.compressed_size;
       }
+      // Bloom filters follow the column chunks of their row group
+      for (auto i = 0; i < num_columns; i++) {
+        if (!bloom_filter_cols[i]) { continue; }
+        auto const& ck = chunks[r][i];
+        rmm::device_uvector<uint32_t> bitset(
+          bloom_filter_num_bytes(ck.num_rows) / sizeof(uint32_t), stream);
+        CUDA_TRY(
+          cudaMemsetAsync(bitset.data(), 0, bitset.size() * sizeof(uint32_t), stream.value()));
+        gpu::insert_bloom_filter_values(
+          *bloom_filter_cols[i], ck.start_row, ck.num_rows, bitset, stream);
+        auto const host_bitset = cudf::detail::make_std_vector_sync(bitset, stream);
+
+        BloomFilterHeader header;
+        header.num_bytes = static_cast<int32_t>(host_bitset.size() * sizeof(uint32_t));
+        header.algorithm.isset.BLOCK          = true;
+        header.hash.isset.XXHASH              = true;
+        header.compression.isset.UNCOMPRESSED = true;
+        std::vector<uint8_t> buffer;
+        CompactProtocolWriter cpw(&buffer);
+        cpw.write(header);
+        if (async_writer_) {
+          async_writer_->host_write(out_sink_[p].get(), buffer.data(), buffer.size());
+          async_writer_->host_write(out_sink_[p].get(), host_bitset.data(), header.num_bytes);
+        } else {
+          out_sink_[p]->host_write(buffer.data(), buffer.size());
+          out_sink_[p]->host_write(host_bitset.data(), header.num_bytes);
+        }
+
+        auto& column_chunk_meta               = row_group.columns[i].meta_data;
+        column_chunk_meta.bloom_filter_offset = current_chunk_offset[p];
+        column_chunk_meta.bloom_filter_length = buffer.size() + header.num_bytes;
+        current_chunk_offset[p] += column_chunk_meta.bloom_filter_length;
+      }
     }
     for (auto const& task : write_tasks) {
       task.wait();
@@ -1618,7 +1885,34 @@ std::unique_ptr<std::vector<uint8_t>> writer::impl::close(
   if (closed) { return nullptr; }
   closed = true;
   if (not last_write_successful) { return nullptr; }
+  // The footers follow the column chunks still queued for writing
+  if (async_writer_) { async_writer_->wait(); }
   for (size_t p = 0; p < out_sink_.size(); p++) {
+    // The page indexes of all column chunks precede the footer
+    auto& file = md->file(p);
+    if (not file.offset_indexes.empty()) {
+      size_t chunk = 0;
+      for (auto& rowgroup : file.row_groups) {
+        for (auto& column : rowgroup.columns) {
+          auto const& column_index = file.column_indexes[chunk++];
+          if (column_index.empty()) { continue; }
+          column.column_index_offset = current_chunk_offset[p];
+          column.column_index_length = column_index.size();
+          out_sink_[p]->host_write(column_index.data(), column_index.size());
+          current_chunk_offset[p] += column_index.size();
+        }
+      }
+      chunk = 0;
+      for (auto& rowgroup : file.row_groups) {
+        for (auto& column : rowgroup.columns) {
+          auto const& offset_index   = file.offset_indexes[chunk++];
+          column.offset_index_offset = current_chunk_offset[p];
+          column.offset_index_length = offset_index.size();
+          out_sink_[p]->host_write(offset_index.data(), offset_index.size());
+          current_chunk_offset[p] += offset_index.size();
+        }
+      }
+    }
     std::vector<uint8_t> buffer;
     CompactProtocolWriter cpw(&buffer);
     file_ender_s fendr;
@@ -1690,6 +1984,11 @@ std::unique_ptr<std::vector<uint8_t>> writer::close(
   return _impl->close(column_chunks_file_path);
 }
 
+std::vector<std::vector<column_encoding>> const& writer::encoding_report() const
+{
+  return _impl->encoding_report();
+}
+
 std::unique_ptr<std::vector<uint8_t>> writer::merge_row_group_metadata(
   std::vector<std::unique_ptr<std::vector<uint8_t>>> const& metadata_list)
 {
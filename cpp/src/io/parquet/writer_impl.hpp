@@ -25,6 +25,7 @@
 #include "parquet_gpu.hpp"
 
 #include <cudf/io/data_sink.hpp>
+#include <io/utilities/async_sink_writer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
 
 #include <cudf/detail/utilities/integer_utils.hpp>
@@ -118,6 +119,14 @@ class writer::impl {
   std::unique_ptr<std::vector<uint8_t>> close(
     std::vector<std::string> const& column_chunks_file_path = {});
 
+  /**
+   * @brief Returns the encoding of each column chunk written so far, per row group
+   */
+  [[nodiscard]] std::vector<std::vector<column_encoding>> const& encoding_report() const
+  {
+    return encoding_report_;
+  }
+
  private:
   /**
    * @brief Gather page fragments
@@ -208,11 +217,17 @@ class writer::impl {
   // Cuda stream to be used
   rmm::cuda_stream_view stream;
 
-  size_t max_row_group_size          = default_row_group_size_bytes;
-  size_type max_row_group_rows       = default_row_group_size_rows;
-  Compression compression_           = Compression::UNCOMPRESSED;
-  statistics_freq stats_granularity_ = statistics_freq::STATISTICS_NONE;
-  bool int96_timestamps              = false;
+  size_t max_row_group_size             = default_row_group_size_bytes;
+  size_type max_row_group_rows          = default_row_group_size_rows;
+  size_t max_page_size_bytes            = default_max_page_size_bytes;
+  size_type max_page_size_rows          = default_max_page_size_rows;
+  Compression compression_              = Compression::UNCOMPRESSED;
+  statistics_freq stats_granularity_    = statistics_freq::STATISTICS_NONE;
+  bool int96_timestamps                 = false;
+  bool adaptive_encoding_               = false;
+  size_type statistics_truncate_length_ = default_statistics_truncate_length;
+  // Declared sort order of the rows of each row group
+  std::vector<SortingColumn> sorting_columns_;
   // Overall file metadata.  Filled in during the process and written during write_chunked_end()
   std::unique_ptr<aggregate_writer_metadata> md;
   // File footer key-value metadata. Written during write_chunked_end()
@@ -225,11 +240,16 @@ class writer::impl {
   bool last_write_successful = false;
   // current write position for rowgroups/chunks
   std::vector<std::size_t> current_chunk_offset;
+  // encoding of each column chunk written, per row group
+  std::vector<std::vector<column_encoding>> encoding_report_;
   // special parameter only used by detail::write() to indicate that we are guaranteeing
   // a single table write.  this enables some internal optimizations.
   bool const single_write_mode = true;
 
   std::vector<std::unique_ptr<data_sink>> out_sink_;
+  // Background writer the column chunks are written through, if they are written asynchronously.
+  // Declared after the sinks so that it completes its writes before they are destroyed
+  std::unique_ptr<async_sink_writer> async_writer_;
 };
 
 }  // namespace parquet
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,20 +18,27 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/io/text/byte_range_info.hpp>
 #include <cudf/io/text/data_chunk_source.hpp>
 #include <cudf/io/text/detail/multistate.hpp>
 #include <cudf/io/text/detail/tile_state.hpp>
 #include <cudf/io/text/detail/trie.hpp>
+#include <cudf/io/text/multibyte_split.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_pool.hpp>
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_scalar.hpp>
 #include <rmm/mr/device/device_memory_resource.hpp>
 
 #include <cub/block/block_load.cuh>
 #include <cub/block/block_scan.cuh>
 
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace {
 
@@ -121,6 +128,11 @@ __global__ void multibyte_split_seed_kernel(
   }
 }
 
+// Offsets within the kernel are relative to the first scanned byte. Only delimiters which end
+// within [range_begin, range_end) are output, and their offsets are output relative to
+// `output_begin`, the offset of the first output char. When not null, `first_row_begin` and
+// `last_row_end` receive the end of the first delimiter ending at or after `range_begin` and
+// `range_end` respectively.
 __global__ void multibyte_split_kernel(
   cudf::size_type base_tile_idx,
   cudf::io::text::detail::scan_tile_state_view<multistate> tile_multistates,
@@ -128,8 +140,13 @@ __global__ void multibyte_split_kernel(
   cudf::io::text::detail::trie_device_view trie,
   int32_t chunk_input_offset,
   cudf::device_span<char const> chunk_input_chars,
+  int32_t range_begin,
+  int32_t range_end,
+  int32_t output_begin,
   cudf::device_span<int32_t> abs_output_delimiter_offsets,
-  cudf::device_span<char> abs_output_chars)
+  cudf::device_span<char> abs_output_chars,
+  int32_t* first_row_begin,
+  int32_t* last_row_end)
 {
   using InputLoad =
     cub::BlockLoad<char, THREADS_PER_TILE, ITEMS_PER_THREAD, cub::BLOCK_LOAD_VECTORIZE>;
@@ -168,8 +185,25 @@ __global__ void multibyte_split_kernel(
 
   uint32_t thread_offsets[ITEMS_PER_THREAD];
 
+  int32_t const thread_abs_offset = base_tile_idx * ITEMS_PER_TILE + thread_input_offset;
+
   for (int32_t i = 0; i < ITEMS_PER_THREAD; i++) {
-    thread_offsets[i] = i < thread_input_size and trie.is_match(thread_states[i]);
+    auto const match_end = thread_abs_offset + i + 1;
+    thread_offsets[i] = i < thread_input_size and trie.is_match(thread_states[i]) and
+                        match_end >= range_begin and match_end < range_end;
+  }
+
+  if (first_row_begin != nullptr) {
+    for (int32_t i = 0; i < ITEMS_PER_THREAD and i < thread_input_size; i++) {
+      if (not trie.is_match(thread_states[i])) { continue; }
+      auto const match_end = thread_abs_offset + i + 1;
+      if (match_end >= range_begin and match_end < *first_row_begin) {
+        atomicMin(first_row_begin, match_end);
+      }
+      if (match_end >= range_end and match_end < *last_row_end) {
+        atomicMin(last_row_end, match_end);
+      }
+    }
   }
 
   // STEP 4: Scan flags to determine absolute thread output offset
@@ -184,15 +218,18 @@ __global__ void multibyte_split_kernel(
 
   if (abs_output_chars.size() > 0) {
     for (int32_t i = 0; i < ITEMS_PER_THREAD and i < thread_input_size; i++) {
-      abs_output_chars[chunk_input_offset + thread_input_offset + i] = thread_chars[i];
+      auto const output_idx = chunk_input_offset + thread_input_offset + i - output_begin;
+      if (output_idx >= 0 and output_idx < static_cast<int32_t>(abs_output_chars.size())) {
+        abs_output_chars[output_idx] = thread_chars[i];
+      }
     }
   }
 
   if (abs_output_delimiter_offsets.size() > 0) {
     for (int32_t i = 0; i < ITEMS_PER_THREAD and i < thread_input_size; i++) {
-      if (trie.is_match(thread_states[i])) {
-        auto const match_end = base_tile_idx * ITEMS_PER_TILE + thread_input_offset + i + 1;
-        abs_output_delimiter_offsets[thread_offsets[i]] = match_end;
+      auto const match_end = thread_abs_offset + i + 1;
+      if (trie.is_match(thread_states[i]) and match_end >= range_begin and match_end < range_end) {
+        abs_output_delimiter_offsets[thread_offsets[i]] = match_end - output_begin;
       }
     }
   }
@@ -236,12 +273,27 @@ std::vector<rmm::cuda_stream_view> get_streams(int32_t count, rmm::cuda_stream_p
   return streams;
 }
 
+/**
+ * @brief Scans the source for delimiters, beginning `scan_offset` bytes into it.
+ *
+ * Scanning stops at the end of the source or after `max_bytes` bytes. When `first_row_begin` and
+ * `last_row_end` are given, it also stops once a delimiter ending at or after `range_end` is found.
+ *
+ * @return The number of bytes scanned
+ */
 cudf::size_type multibyte_split_scan_full_source(cudf::io::text::data_chunk_source const& source,
                                                  cudf::io::text::detail::trie const& trie,
                                                  scan_tile_state<multistate>& tile_multistates,
                                                  scan_tile_state<uint32_t>& tile_offsets,
+                                                 std::size_t scan_offset,
+                                                 cudf::size_type max_bytes,
+                                                 cudf::size_type range_begin,
+                                                 cudf::size_type range_end,
+                                                 cudf::size_type output_begin,
                                                  device_span<cudf::size_type> output_buffer,
                                                  device_span<char> output_char_buffer,
+                                                 rmm::device_scalar<int32_t>* first_row_begin,
+                                                 rmm::device_scalar<int32_t>* last_row_end,
                                                  rmm::cuda_stream_view stream,
                                                  std::vector<rmm::cuda_stream_view> const& streams)
 {
@@ -270,14 +322,16 @@ cudf::size_type multibyte_split_scan_full_source(cudf::io::text::data_chunk_sour
   fork_stream(streams, stream);
 
   auto reader = source.create_reader();
+  if (scan_offset > 0) { reader->skip_bytes(scan_offset); }
 
   cudaEvent_t last_launch_event;
   cudaEventCreate(&last_launch_event);
 
-  for (int32_t i = 0; true; i++) {
+  for (int32_t i = 0; chunk_offset < max_bytes; i++) {
     auto base_tile_idx = i * TILES_PER_CHUNK;
     auto chunk_stream  = streams[i % streams.size()];
-    auto chunk         = reader->get_next_chunk(ITEMS_PER_CHUNK, chunk_stream);
+    auto read_size     = std::min(ITEMS_PER_CHUNK, max_bytes - chunk_offset);
+    auto chunk         = reader->get_next_chunk(read_size, chunk_stream);
 
     if (chunk->size() == 0) { break; }
 
@@ -300,12 +354,23 @@ cudf::size_type multibyte_split_scan_full_source(cudf::io::text::data_chunk_sour
       trie.view(),
       chunk_offset,
       *chunk,
+      range_begin,
+      range_end,
+      output_begin,
       output_buffer,
-      output_char_buffer);
+      output_char_buffer,
+      first_row_begin != nullptr ? first_row_begin->data() : nullptr,
+      last_row_end != nullptr ? last_row_end->data() : nullptr);
 
     cudaEventRecord(last_launch_event, chunk_stream);
 
     chunk_offset += chunk->size();
+
+    // the rows of the range are complete once a delimiter past its end is found
+    if (last_row_end != nullptr and chunk_offset >= range_end and
+        last_row_end->value(chunk_stream) != std::numeric_limits<int32_t>::max()) {
+      break;
+    }
   }
 
   cudaEventDestroy(last_launch_event);
@@ -316,13 +381,24 @@ cudf::size_type multibyte_split_scan_full_source(cudf::io::text::data_chunk_sour
 }
 
 std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
-                                              std::string const& delimiter,
+                                              std::vector<std::string> const& delimiters,
+                                              byte_range_info byte_range,
                                               rmm::cuda_stream_view stream,
                                               rmm::mr::device_memory_resource* mr,
                                               rmm::cuda_stream_pool& stream_pool)
 {
   CUDF_FUNC_RANGE();
-  auto const trie = cudf::io::text::detail::trie::create({delimiter}, stream);
+  CUDF_EXPECTS(not delimiters.empty(), "at least one delimiter is required.");
+  CUDF_EXPECTS(std::none_of(delimiters.begin(),
+                            delimiters.end(),
+                            [](auto const& delimiter) { return delimiter.empty(); }),
+               "delimiters must not be empty.");
+  CUDF_EXPECTS(byte_range.offset() >= 0 and byte_range.size() >= 0,
+               "byte range offset and size must not be negative.");
+
+  if (byte_range.is_empty()) { return make_empty_column(type_id::STRING); }
+
+  auto const trie = cudf::io::text::detail::trie::create(delimiters, stream);
 
   CUDF_EXPECTS(trie.max_duplicate_tokens() < multistate::max_segment_count,
                "delimiter contains too many duplicate tokens to produce a deterministic result.");
@@ -330,6 +406,18 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
   CUDF_EXPECTS(trie.size() < multistate::max_segment_value,
                "delimiter contains too many total tokens to produce a deterministic result.");
 
+  // A delimiter ending at the range offset begins the first row of the range, so scanning begins
+  // early enough to match it. Offsets from here on are relative to the first scanned byte.
+  auto const max_delimiter_size = static_cast<int64_t>(
+    std::max_element(delimiters.begin(), delimiters.end(), [](auto const& a, auto const& b) {
+      return a.size() < b.size();
+    })->size());
+  auto const scan_offset = std::max<int64_t>(0, byte_range.offset() - max_delimiter_size);
+  auto const max_offset  = static_cast<int64_t>(std::numeric_limits<cudf::size_type>::max());
+  auto const range_begin = static_cast<cudf::size_type>(byte_range.offset() - scan_offset);
+  auto const range_end   = static_cast<cudf::size_type>(
+    range_begin + std::min(byte_range.size(), max_offset - range_begin));
+
   auto concurrency = 2;
   // must be at least 32 when using warp-reduce on partials
   // must be at least 1 more than max possible concurrent tiles
@@ -340,35 +428,67 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
 
   auto streams = get_streams(concurrency, stream_pool);
 
+  auto first_row_begin = rmm::device_scalar<int32_t>(std::numeric_limits<int32_t>::max(), stream);
+  auto last_row_end    = rmm::device_scalar<int32_t>(std::numeric_limits<int32_t>::max(), stream);
+
   auto bytes_total =
     multibyte_split_scan_full_source(source,
                                      trie,
                                      tile_multistates,
                                      tile_offsets,
+                                     scan_offset,
+                                     std::numeric_limits<cudf::size_type>::max(),
+                                     range_begin,
+                                     range_end,
+                                     0,
                                      cudf::device_span<int32_t>(static_cast<int32_t*>(nullptr), 0),
                                      cudf::device_span<char>(static_cast<char*>(nullptr), 0),
+                                     &first_row_begin,
+                                     &last_row_end,
                                      stream,
                                      streams);
 
-  // allocate results
-  auto num_tiles      = cudf::util::div_rounding_up_safe(bytes_total, ITEMS_PER_TILE);
-  auto num_results    = tile_offsets.get_inclusive_prefix(num_tiles - 1, stream);
-  auto string_offsets = rmm::device_uvector<int32_t>(num_results + 2, stream, mr);
-  auto string_chars   = rmm::device_uvector<char>(bytes_total, stream, mr);
+  // the first row of the source begins at its first byte, any other row after a delimiter.
+  auto const is_first_range = byte_range.offset() == 0;
+  auto const output_begin   = is_first_range ? 0 : first_row_begin.value(stream);
+  auto const output_end     = std::min(last_row_end.value(stream), bytes_total);
+
+  if (output_begin >= range_end or output_begin > bytes_total) {
+    return make_empty_column(type_id::STRING);
+  }
 
-  // first and last element are set manually to zero and size of input, respectively.
+  // allocate results
+  auto num_tiles   = cudf::util::div_rounding_up_safe(bytes_total, ITEMS_PER_TILE);
+  auto num_results = static_cast<cudf::size_type>(
+    tile_offsets.get_inclusive_prefix(num_tiles - 1, stream));
+
+  // the delimiter beginning the first row of a later range is among the results, and its offset
+  // relative to `output_begin` is the leading zero.
+  auto const num_leading_offsets = is_first_range ? 1 : 0;
+  auto string_offsets =
+    rmm::device_uvector<int32_t>(num_leading_offsets + num_results + 1, stream, mr);
+  auto string_chars = rmm::device_uvector<char>(output_end - output_begin, stream, mr);
+
+  // first and last element are set manually to zero and size of output, respectively.
   // kernel is only responsible for determining delimiter offsets
   auto string_count = static_cast<cudf::size_type>(string_offsets.size() - 1);
-  string_offsets.set_element_to_zero_async(0, stream);
-  string_offsets.set_element_async(string_count, bytes_total, stream);
+  if (is_first_range) { string_offsets.set_element_to_zero_async(0, stream); }
+  string_offsets.set_element_async(string_count, output_end - output_begin, stream);
 
   multibyte_split_scan_full_source(
     source,
     trie,
     tile_multistates,
     tile_offsets,
-    cudf::device_span<int32_t>(string_offsets).subspan(1, num_results),
+    scan_offset,
+    output_end,
+    range_begin,
+    range_end,
+    output_begin,
+    cudf::device_span<int32_t>(string_offsets).subspan(num_leading_offsets, num_results),
     string_chars,
+    nullptr,
+    nullptr,
     stream,
     streams);
 
@@ -380,11 +500,20 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
 
 std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
                                               std::string const& delimiter,
+                                              byte_range_info byte_range,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  return multibyte_split(source, std::vector<std::string>{delimiter}, byte_range, mr);
+}
+
+std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
+                                              std::vector<std::string> const& delimiters,
+                                              byte_range_info byte_range,
                                               rmm::mr::device_memory_resource* mr)
 {
   auto stream      = rmm::cuda_stream_default;
   auto stream_pool = rmm::cuda_stream_pool(2);
-  auto result      = detail::multibyte_split(source, delimiter, stream, mr, stream_pool);
+  auto result = detail::multibyte_split(source, delimiters, byte_range, stream, mr, stream_pool);
 
   stream.synchronize();
 
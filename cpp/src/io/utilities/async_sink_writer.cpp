@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "async_sink_writer.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <chrono>
+#include <cstring>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+async_sink_writer::async_sink_writer(size_t max_in_flight) : _max_in_flight(max_in_flight)
+{
+  CUDF_EXPECTS(max_in_flight > 0, "At least one write must be allowed in flight");
+}
+
+async_sink_writer::~async_sink_writer()
+{
+  for (auto& write : _pending) {
+    write.done.wait();
+  }
+}
+
+void async_sink_writer::device_write(data_sink* sink,
+                                     void const* gpu_data,
+                                     size_t size,
+                                     rmm::cuda_stream_view stream)
+{
+  if (size == 0) { return; }
+  auto const buffer = acquire_buffer(size);
+  auto const data   = _buffers[buffer].data.get();
+  CUDA_TRY(cudaMemcpyAsync(data, gpu_data, size, cudaMemcpyDeviceToHost, stream.value()));
+  stream.synchronize();
+  _pending.push_back(
+    {buffer, _pool.submit([sink, data, size]() { sink->host_write(data, size); })});
+}
+
+void async_sink_writer::host_write(data_sink* sink, void const* data, size_t size)
+{
+  if (size == 0) { return; }
+  auto copy = std::make_shared<std::vector<uint8_t>>(size);
+  std::memcpy(copy->data(), data, size);
+  _pending.push_back(
+    {std::nullopt, _pool.submit([sink, copy]() { sink->host_write(copy->data(), copy->size()); })});
+}
+
+void async_sink_writer::wait()
+{
+  while (!_pending.empty()) {
+    retire_oldest();
+  }
+}
+
+size_t async_sink_writer::acquire_buffer(size_t size)
+{
+  // Release the buffers of the writes that already completed, then wait if none is left
+  while (!_pending.empty() &&
+         _pending.front().done.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+    retire_oldest();
+  }
+  while (_free_buffers.empty() && _buffers.size() == _max_in_flight) {
+    retire_oldest();
+  }
+
+  size_t index;
+  if (!_free_buffers.empty()) {
+    index = _free_buffers.back();
+    _free_buffers.pop_back();
+  } else {
+    index = _buffers.size();
+    _buffers.emplace_back();
+  }
+
+  auto& buffer = _buffers[index];
+  if (buffer.size < size) {
+    buffer.data.reset();
+    uint8_t* ptr = nullptr;
+    CUDA_TRY(cudaMallocHost(&ptr, size));
+    buffer.data.reset(ptr);
+    buffer.size = size;
+  }
+  return index;
+}
+
+void async_sink_writer::retire_oldest()
+{
+  auto write = std::move(_pending.front());
+  _pending.pop_front();
+  if (write.buffer.has_value()) { _free_buffers.push_back(write.buffer.value()); }
+  write.done.get();
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "thread_pool.hpp"
+
+#include <cudf/io/data_sink.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Writes to data sinks from a background thread, so that the caller can keep the GPU busy
+ * while previous writes are in progress
+ *
+ * Device data is staged through a bounded pool of pinned host bounce buffers; once all of them
+ * hold pending writes, the next write waits for the oldest one to complete. Writes complete in the
+ * order they were issued, across all sinks. Errors raised by a write are rethrown by a later call.
+ */
+class async_sink_writer {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param max_in_flight Maximum number of device writes that may be pending at a time
+   */
+  explicit async_sink_writer(size_t max_in_flight);
+
+  async_sink_writer(async_sink_writer const&) = delete;
+  async_sink_writer& operator=(async_sink_writer const&) = delete;
+
+  /**
+   * @brief Destructor; waits for the pending writes, ignoring their errors
+   */
+  ~async_sink_writer();
+
+  /**
+   * @brief Copies device data to a bounce buffer and queues its write to `sink`
+   *
+   * Returns once the data has been copied; the device memory can then be reused.
+   *
+   * @param sink Sink to write to; must outlive the write
+   * @param gpu_data Device data to write
+   * @param size Number of bytes to write
+   * @param stream CUDA stream to copy the data on
+   */
+  void device_write(data_sink* sink,
+                    void const* gpu_data,
+                    size_t size,
+                    rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Queues the write of a copy of host data to `sink`
+   *
+   * @param sink Sink to write to; must outlive the write
+   * @param data Host data to write
+   * @param size Number of bytes to write
+   */
+  void host_write(data_sink* sink, void const* data, size_t size);
+
+  /**
+   * @brief Waits for all pending writes, rethrowing the first error raised by any of them
+   */
+  void wait();
+
+ private:
+  using pinned_buffer = std::unique_ptr<uint8_t, decltype(&cudaFreeHost)>;
+
+  struct bounce_buffer {
+    pinned_buffer data{nullptr, cudaFreeHost};
+    size_t size = 0;
+  };
+
+  struct pending_write {
+    std::optional<size_t> buffer;  // Index of the bounce buffer released on completion, if any
+    std::future<void> done;
+  };
+
+  /**
+   * @brief Returns the index of a free bounce buffer of at least `size` bytes
+   */
+  size_t acquire_buffer(size_t size);
+
+  /**
+   * @brief Waits for the oldest pending write and releases its bounce buffer
+   */
+  void retire_oldest();
+
+  size_t const _max_in_flight;
+  std::vector<bounce_buffer> _buffers;
+  std::vector<size_t> _free_buffers;
+  std::deque<pending_write> _pending;
+  // Declared last so that its destructor, which waits for the queued tasks, runs first
+  cudf::detail::thread_pool _pool{1};
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "byte_range_reader.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+byte_range_reader::byte_range_reader(std::unique_ptr<datasource>&& source, std::size_t range_size)
+  : _source(std::move(source)), _range_size(range_size)
+{
+  CUDF_EXPECTS(range_size > 0, "The chunk read size must be positive");
+  prefetch();
+}
+
+bool byte_range_reader::append_next_range()
+{
+  if (not _prefetched.valid()) { return false; }
+  auto const buffer = _prefetched.get();
+  prefetch();
+  auto const begin = reinterpret_cast<char const*>(buffer->data());
+  _data.insert(_data.end(), begin, begin + buffer->size());
+  return true;
+}
+
+std::optional<std::size_t> byte_range_reader::find_line_end(std::size_t begin,
+                                                            std::string const& terminator)
+{
+  auto search_begin = std::min(begin, _data.size());
+  while (true) {
+    auto const it = std::search(
+      _data.begin() + search_begin, _data.end(), terminator.begin(), terminator.end());
+    if (it != _data.end()) { return it - _data.begin() + terminator.size(); }
+    // A terminator split by the end of the data is found once the next range is appended
+    search_begin = std::max(search_begin, _data.size() - std::min(_data.size(), terminator.size()));
+    if (not append_next_range()) { return std::nullopt; }
+  }
+}
+
+std::size_t byte_range_reader::find_last_line_end(std::size_t begin, std::string const& terminator)
+{
+  auto search_begin = std::min(begin, _data.size());
+  while (true) {
+    auto const it =
+      std::find_end(_data.begin() + search_begin, _data.end(), terminator.begin(), terminator.end());
+    if (it != _data.end()) { return it - _data.begin() + terminator.size(); }
+    search_begin = std::max(search_begin, _data.size() - std::min(_data.size(), terminator.size()));
+    if (not append_next_range()) { return _data.size(); }
+  }
+}
+
+void byte_range_reader::prefetch()
+{
+  if (_read_offset >= _source->size()) { return; }
+  auto const size = std::min(_range_size, _source->size() - _read_offset);
+  _prefetched     = _pool.submit(
+    [this, offset = _read_offset, size]() { return _source->host_read(offset, size); });
+  _read_offset += size;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "thread_pool.hpp"
+
+#include <cudf/io/datasource.hpp>
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Reads a source in ranges of a fixed number of bytes into host memory, for the chunked
+ * readers of line-delimited formats
+ *
+ * The next range is read on a background thread while the data read so far is parsed. The data
+ * is kept until the caller erases it, so that a line split by the end of a range is completed by
+ * the next one.
+ */
+class byte_range_reader {
+ public:
+  /**
+   * @brief Constructor; starts reading the first range
+   *
+   * @param source Source to read
+   * @param range_size Number of bytes of each read of the source
+   */
+  byte_range_reader(std::unique_ptr<datasource>&& source, std::size_t range_size);
+
+  /**
+   * @brief Whether ranges of the source are left to append to the data
+   */
+  [[nodiscard]] bool has_ranges() const { return _prefetched.valid(); }
+
+  /**
+   * @brief Returns the data read from the source and not erased yet
+   */
+  [[nodiscard]] std::vector<char>& data() { return _data; }
+  [[nodiscard]] std::vector<char> const& data() const { return _data; }
+
+  /**
+   * @brief Appends the next range to the data and starts reading the one after
+   *
+   * @return Whether a range was appended, `false` once the source is exhausted
+   */
+  bool append_next_range();
+
+  /**
+   * @brief Returns the end of the first line that ends at or after `begin`, appending ranges until
+   * the data holds one
+   *
+   * @param begin Offset in the data to search from
+   * @param terminator Line terminator
+   * @return Offset past the terminator of the line, or `std::nullopt` if the source ends first
+   */
+  std::optional<std::size_t> find_line_end(std::size_t begin, std::string const& terminator);
+
+  /**
+   * @brief Returns the end of the last complete line that starts at or after `begin`, appending
+   * ranges until the data holds one
+   *
+   * @param begin Offset in the data to search from
+   * @param terminator Line terminator
+   * @return Offset past the last terminator, or the size of the data if the source ends before
+   * any terminator
+   */
+  std::size_t find_last_line_end(std::size_t begin, std::string const& terminator);
+
+ private:
+  /**
+   * @brief Starts reading the next range of the source on the background thread
+   */
+  void prefetch();
+
+  std::unique_ptr<datasource> _source;
+  std::size_t const _range_size;
+  std::size_t _read_offset = 0;  // Offset in the source of the first range not yet requested
+  std::vector<char> _data;
+  std::future<std::unique_ptr<datasource::buffer>> _prefetched;
+  // Declared last so that its destructor, which waits for the queued read of `_source`, runs first
+  cudf::detail::thread_pool _pool{1};
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
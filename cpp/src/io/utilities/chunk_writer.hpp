@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "async_sink_writer.hpp"
+
+#include <cudf/io/data_sink.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <future>
+#include <optional>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Writes the formatted chunks of a text output to a sink, overlapping each write with the
+ * formatting of the next chunk
+ *
+ * Sinks that prefer device writes get the chunks with `device_write_async`. The other sinks get
+ * them from a pinned bounce buffer, written from a background thread.
+ */
+class chunk_writer {
+ public:
+  explicit chunk_writer(data_sink* sink) : _sink(sink) {}
+
+  /**
+   * @brief Queues the write of a chunk, after waiting for the write of the previous one
+   */
+  void write(rmm::device_uvector<char>&& chunk, rmm::cuda_stream_view stream)
+  {
+    wait();
+    if (chunk.is_empty()) { return; }
+    if (_sink->is_device_write_preferred(chunk.size())) {
+      _pending_chunk  = std::move(chunk);
+      _pending_device =
+        _sink->device_write_async(_pending_chunk->data(), _pending_chunk->size(), stream);
+    } else {
+      // Returns once the chunk is copied to the bounce buffer
+      _host_writer.device_write(_sink, chunk.data(), chunk.size(), stream);
+    }
+  }
+
+  /**
+   * @brief Waits for the pending write, rethrowing its error
+   */
+  void wait()
+  {
+    _host_writer.wait();
+    if (_pending_device.valid()) { _pending_device.get(); }
+    _pending_chunk.reset();
+  }
+
+ private:
+  data_sink* _sink;
+  // Chunk kept alive until its device write completes
+  std::optional<rmm::device_uvector<char>> _pending_chunk;
+  std::future<void> _pending_device;
+  async_sink_writer _host_writer{1};
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
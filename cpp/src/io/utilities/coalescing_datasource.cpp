@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/thread_pool.hpp>
+
+#include <cudf/io/coalescing_datasource.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+namespace cudf {
+namespace io {
+
+struct coalescing_datasource::prefetch_pool {
+  cudf::detail::thread_pool pool{1};
+};
+
+coalescing_datasource::coalescing_datasource(std::unique_ptr<datasource> source,
+                                             size_t hole_size_limit,
+                                             size_t cache_size,
+                                             size_t prefetch_size)
+  : _source(std::move(source)),
+    _size(_source->size()),
+    _hole_size_limit(hole_size_limit),
+    _cache_size(cache_size),
+    _prefetch_size(prefetch_size),
+    _pool(std::make_unique<prefetch_pool>())
+{
+}
+
+coalescing_datasource::~coalescing_datasource() = default;
+
+std::unique_ptr<datasource::buffer> coalescing_datasource::host_read(size_t offset, size_t size)
+{
+  auto const read_size = offset < _size ? std::min(size, _size - offset) : 0;
+  std::vector<uint8_t> data(read_size);
+  host_read(offset, read_size, data.data());
+  return buffer::create(std::move(data));
+}
+
+size_t coalescing_datasource::host_read(size_t offset, size_t size, uint8_t* dst)
+{
+  read_request const request{offset, size, dst};
+  return host_read_v(host_span<read_request const>{&request, 1});
+}
+
+size_t coalescing_datasource::host_read_v(host_span<read_request const> requests)
+{
+  // Ranges are clamped to the end of the source
+  auto clamped_size = [&](read_request const& request) {
+    return request.offset < _size ? std::min(request.size, _size - request.offset) : 0;
+  };
+  auto copy_from = [&](cached_range const& range, read_request const& request) {
+    auto const& data = range.data.get();
+    auto const begin = data.begin() + (request.offset - range.offset);
+    std::copy(begin, begin + clamped_size(request), request.dst);
+  };
+
+  // Serve the ranges found in the cache, and merge the others into fewer, larger ranges
+  std::vector<read_request> missing;
+  for (auto const& request : requests) {
+    if (clamped_size(request) == 0) { continue; }
+    auto const cached = find_cached(request.offset, clamped_size(request));
+    if (cached.has_value()) {
+      copy_from(*cached, request);
+    } else {
+      missing.push_back(request);
+    }
+  }
+  std::sort(missing.begin(), missing.end(), [](auto const& lhs, auto const& rhs) {
+    return lhs.offset < rhs.offset;
+  });
+  std::vector<cached_range> merged;
+  std::vector<std::pair<size_t, size_t>> merged_requests;  // Requests covered by each range
+  for (size_t i = 0; i < missing.size(); ++i) {
+    auto const end = missing[i].offset + clamped_size(missing[i]);
+    if (not merged.empty() and
+        missing[i].offset <= merged.back().offset + merged.back().size + _hole_size_limit) {
+      merged.back().size            = std::max(merged.back().size, end - merged.back().offset);
+      merged_requests.back().second = i + 1;
+    } else {
+      merged.push_back({missing[i].offset, end - missing[i].offset, {}});
+      merged_requests.emplace_back(i, i + 1);
+    }
+  }
+
+  // Read the merged ranges with a single vectored read of the source
+  if (not merged.empty()) {
+    std::vector<std::vector<uint8_t>> buffers;
+    std::vector<read_request> reads;
+    for (auto const& range : merged) {
+      buffers.emplace_back(range.size);
+      reads.push_back({range.offset, range.size, buffers.back().data()});
+    }
+    _source->host_read_v(reads);
+    for (size_t r = 0; r < merged.size(); ++r) {
+      std::promise<std::vector<uint8_t>> data;
+      data.set_value(std::move(buffers[r]));
+      merged[r].data = data.get_future().share();
+      for (auto i = merged_requests[r].first; i < merged_requests[r].second; ++i) {
+        copy_from(merged[r], missing[i]);
+      }
+      add_cached(merged[r]);
+    }
+  }
+
+  if (_prefetch_size > 0 and not requests.empty()) {
+    auto const last = std::max_element(
+      requests.begin(), requests.end(), [&](auto const& lhs, auto const& rhs) {
+        return lhs.offset + clamped_size(lhs) < rhs.offset + clamped_size(rhs);
+      });
+    prefetch(last->offset + clamped_size(*last));
+  }
+
+  return std::accumulate(
+    requests.begin(), requests.end(), size_t{0}, [&](size_t sum, auto const& request) {
+      return sum + clamped_size(request);
+    });
+}
+
+std::optional<coalescing_datasource::cached_range> coalescing_datasource::find_cached(
+  size_t offset, size_t size) const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto const it = std::find_if(_cache.crbegin(), _cache.crend(), [&](auto const& range) {
+    return range.offset <= offset and offset + size <= range.offset + range.size;
+  });
+  if (it == _cache.crend()) { return std::nullopt; }
+  return *it;
+}
+
+void coalescing_datasource::add_cached(cached_range range)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (range.size > _cache_size) { return; }
+  _cached_bytes += range.size;
+  _cache.push_back(std::move(range));
+  while (_cached_bytes > _cache_size) {
+    _cached_bytes -= _cache.front().size;
+    _cache.pop_front();
+  }
+}
+
+void coalescing_datasource::prefetch(size_t offset)
+{
+  if (offset >= _size) { return; }
+  auto const size = std::min(_prefetch_size, _size - offset);
+  if (find_cached(offset, size).has_value()) { return; }
+
+  auto data = _pool->pool.submit([this, offset, size]() {
+    std::vector<uint8_t> data(size);
+    _source->host_read(offset, size, data.data());
+    return data;
+  });
+  add_cached({offset, size, data.share()});
+}
+
+}  // namespace io
+}  // namespace cudf
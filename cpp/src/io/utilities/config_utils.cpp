@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,8 +18,10 @@
 
 #include <cudf/utilities/error.hpp>
 
+#include <algorithm>
 #include <cstdlib>
 #include <string>
+#include <thread>
 
 namespace cudf::io::detail {
 
@@ -29,6 +31,33 @@ std::string getenv_or(std::string const& env_var_name, std::string_view default_
   return std::string{(env_val == nullptr) ? default_val : env_val};
 }
 
+namespace {
+/**
+ * @brief Parses the value of an environment variable as a positive integer.
+ */
+size_t parse_positive(std::string const& env_val, std::string const& env_var_name)
+{
+  size_t parsed_size = 0;
+  size_t value       = 0;
+  try {
+    value = std::stoull(env_val, &parsed_size);
+  } catch (std::logic_error const&) {
+    parsed_size = 0;
+  }
+  CUDF_EXPECTS(parsed_size == env_val.size() and value > 0,
+               "Invalid " + env_var_name + " value: " + env_val);
+  return value;
+}
+}  // namespace
+
+unsigned int io_thread_count()
+{
+  auto const default_count  = std::max(1u, std::thread::hardware_concurrency());
+  static auto const env_val = getenv_or("LIBCUDF_IO_THREAD_COUNT", std::to_string(default_count));
+  static auto const count   = parse_positive(env_val, "LIBCUDF_IO_THREAD_COUNT");
+  return static_cast<unsigned int>(count);
+}
+
 namespace cufile_integration {
 
 namespace {
@@ -54,6 +83,13 @@ bool is_always_enabled() { return get_env_policy() == usage_policy::ALWAYS; }
 
 bool is_gds_enabled() { return is_always_enabled() or get_env_policy() == usage_policy::GDS; }
 
+size_t slice_size()
+{
+  static auto const env_val = getenv_or("LIBCUDF_CUFILE_SLICE_SIZE", std::to_string(4 << 20));
+  static auto const size    = parse_positive(env_val, "LIBCUDF_CUFILE_SLICE_SIZE");
+  return size;
+}
+
 }  // namespace cufile_integration
 
 namespace nvcomp_integration {
@@ -83,4 +119,28 @@ bool is_stable_enabled() { return is_all_enabled() or get_env_policy() == usage_
 
 }  // namespace nvcomp_integration
 
+namespace io_uring_integration {
+
+namespace {
+/**
+ * @brief Defines whether to use io_uring.
+ */
+enum class usage_policy : uint8_t { OFF, ON };
+
+/**
+ * @brief Get the current usage policy.
+ */
+usage_policy get_env_policy()
+{
+  static auto const env_val = getenv_or("LIBCUDF_IO_URING_POLICY", "OFF");
+  if (env_val == "OFF") return usage_policy::OFF;
+  if (env_val == "ON") return usage_policy::ON;
+  CUDF_FAIL("Invalid LIBCUDF_IO_URING_POLICY value: " + env_val);
+}
+}  // namespace
+
+bool is_enabled() { return get_env_policy() == usage_policy::ON; }
+
+}  // namespace io_uring_integration
+
 }  // namespace cudf::io::detail
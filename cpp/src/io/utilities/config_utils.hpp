@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 namespace cudf::io::detail {
@@ -25,6 +26,13 @@ namespace cudf::io::detail {
  */
 std::string getenv_or(std::string const& env_var_name, std::string_view default_val);
 
+/**
+ * @brief Returns the initial number of threads of the thread pool shared by readers and writers.
+ *
+ * Set with `LIBCUDF_IO_THREAD_COUNT`; the default is the number of hardware threads.
+ */
+unsigned int io_thread_count();
+
 namespace cufile_integration {
 
 /**
@@ -37,6 +45,13 @@ bool is_always_enabled();
  */
 bool is_gds_enabled();
 
+/**
+ * @brief Returns the size of the slices that cuFile reads and writes are split into, in bytes.
+ *
+ * Set with `LIBCUDF_CUFILE_SLICE_SIZE`; the default is 4MB.
+ */
+size_t slice_size();
+
 }  // namespace cufile_integration
 
 namespace nvcomp_integration {
@@ -53,4 +68,13 @@ bool is_stable_enabled();
 
 }  // namespace nvcomp_integration
 
+namespace io_uring_integration {
+
+/**
+ * @brief Returns true if host reads of local files through io_uring are enabled.
+ */
+bool is_enabled();
+
+}  // namespace io_uring_integration
+
 }  // namespace cudf::io::detail
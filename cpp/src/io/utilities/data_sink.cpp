@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,11 +17,19 @@
 #include <fstream>
 
 #include "file_io_utilities.hpp"
+#include "thread_pool.hpp"
 #include <cudf/io/data_sink.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <cuda_runtime_api.h>
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <mutex>
+
 namespace cudf {
 namespace io {
 /**
@@ -81,6 +89,212 @@ class file_sink : public data_sink {
   std::unique_ptr<detail::cufile_output_impl> _cufile_out;
 };
 
+namespace {
+
+using pinned_buffer = std::unique_ptr<uint8_t, decltype(&cudaFreeHost)>;
+
+// Size of the pinned buffers that small writes are gathered into
+constexpr size_t staging_buffer_size = 4 << 20;
+// Number of staging buffers of a sink that may be written to the file at the same time
+constexpr size_t max_pending_flushes = 2;
+// Number of free staging buffers kept for the sinks created later
+constexpr size_t max_retained_staging_buffers = 8;
+
+/**
+ * @brief Free staging buffers, shared by all sinks so that short-lived sinks do not pay for the
+ * allocation of pinned memory
+ */
+struct staging_buffer_cache {
+  std::mutex mutex;
+  std::vector<pinned_buffer> buffers;
+};
+
+staging_buffer_cache& get_staging_buffer_cache()
+{
+  // Never destroyed, as the CUDA runtime may already be shut down when static objects are
+  static auto* cache = new staging_buffer_cache;
+  return *cache;
+}
+
+pinned_buffer acquire_staging_buffer()
+{
+  auto& cache = get_staging_buffer_cache();
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    if (not cache.buffers.empty()) {
+      auto buffer = std::move(cache.buffers.back());
+      cache.buffers.pop_back();
+      return buffer;
+    }
+  }
+  uint8_t* ptr = nullptr;
+  CUDA_TRY(cudaMallocHost(&ptr, staging_buffer_size));
+  return pinned_buffer{ptr, cudaFreeHost};
+}
+
+void release_staging_buffer(pinned_buffer buffer)
+{
+  auto& cache = get_staging_buffer_cache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  if (cache.buffers.size() < max_retained_staging_buffers) {
+    cache.buffers.push_back(std::move(buffer));
+  }
+}
+
+}  // namespace
+
+/**
+ * @brief Sink that gathers the writes to another sink into large pinned buffers.
+ *
+ * Host writes and device writes are copied one after the other into a staging buffer; each full
+ * buffer is written to the wrapped sink from a background thread while the next one fills, so that
+ * the wrapped sink receives few large, sequential writes. Host writes larger than a staging buffer
+ * are passed through, and device writes that the wrapped sink prefers to do directly, such as
+ * large cuFile writes, are forwarded once the staged data is written. Errors raised by a
+ * background write are rethrown by a later call.
+ */
+class buffered_sink : public data_sink {
+ public:
+  explicit buffered_sink(std::unique_ptr<data_sink> sink) : _sink(std::move(sink)) {}
+
+  ~buffered_sink() override
+  {
+    try {
+      flush();
+    } catch (...) {
+      // Errors cannot be reported from the destructor
+    }
+  }
+
+  void host_write(void const* data, size_t size) override
+  {
+    if (size >= staging_buffer_size) {
+      drain();
+      _sink->host_write(data, size);
+    } else {
+      stage(static_cast<uint8_t const*>(data), size, [](uint8_t* dst, auto src, size_t size) {
+        std::memcpy(dst, src, size);
+      });
+    }
+    _bytes_written += size;
+  }
+
+  [[nodiscard]] bool supports_device_write() const override { return true; }
+
+  [[nodiscard]] bool is_device_write_preferred(size_t) const override
+  {
+    // Device data is copied straight into the staging buffers, saving the writers a copy
+    return true;
+  }
+
+  void device_write(void const* gpu_data, size_t size, rmm::cuda_stream_view stream) override
+  {
+    if (_sink->is_device_write_preferred(size)) {
+      drain();
+      _sink->device_write(gpu_data, size, stream);
+    } else {
+      stage(static_cast<uint8_t const*>(gpu_data),
+            size,
+            [stream](uint8_t* dst, auto src, size_t size) {
+              CUDA_TRY(cudaMemcpyAsync(dst, src, size, cudaMemcpyDeviceToHost, stream.value()));
+              stream.synchronize();
+            });
+    }
+    _bytes_written += size;
+  }
+
+  std::future<void> device_write_async(void const* gpu_data,
+                                       size_t size,
+                                       rmm::cuda_stream_view stream) override
+  {
+    if (_sink->is_device_write_preferred(size)) {
+      drain();
+      _bytes_written += size;
+      return _sink->device_write_async(gpu_data, size, stream);
+    }
+    device_write(gpu_data, size, stream);
+    return std::async(std::launch::deferred, [] {});
+  }
+
+  void flush() override
+  {
+    drain();
+    _sink->flush();
+  }
+
+  size_t bytes_written() override { return _bytes_written; }
+
+ private:
+  /**
+   * @brief Copies data into the staging buffers, in pieces when it does not fit in the current one
+   */
+  template <typename CopyFn>
+  void stage(uint8_t const* data, size_t size, CopyFn copy)
+  {
+    while (size > 0) {
+      if (_current_size == staging_buffer_size) { submit_current(); }
+      if (_current == nullptr) { _current = acquire_staging_buffer(); }
+      auto const copy_size = std::min(size, staging_buffer_size - _current_size);
+      // Small writes start a new buffer rather than being split
+      if (copy_size < size and size < staging_buffer_size and _current_size > 0) {
+        submit_current();
+        continue;
+      }
+      copy(_current.get() + _current_size, data, copy_size);
+      _current_size += copy_size;
+      data += copy_size;
+      size -= copy_size;
+    }
+  }
+
+  /**
+   * @brief Queues the write of the current staging buffer to the wrapped sink
+   */
+  void submit_current()
+  {
+    if (_current_size == 0) { return; }
+    while (_pending.size() >= max_pending_flushes) {
+      retire_oldest();
+    }
+    auto buffer = std::make_shared<pinned_buffer>(std::move(_current));
+    _pending.push_back(_pool.submit([sink = _sink.get(), buffer, size = _current_size]() {
+      sink->host_write(buffer->get(), size);
+      release_staging_buffer(std::move(*buffer));
+    }));
+    _current      = pinned_buffer{nullptr, cudaFreeHost};
+    _current_size = 0;
+  }
+
+  /**
+   * @brief Waits for the oldest queued write, rethrowing its error, if any
+   */
+  void retire_oldest()
+  {
+    auto write = std::move(_pending.front());
+    _pending.pop_front();
+    write.get();
+  }
+
+  /**
+   * @brief Writes all the staged data to the wrapped sink
+   */
+  void drain()
+  {
+    submit_current();
+    while (not _pending.empty()) {
+      retire_oldest();
+    }
+  }
+
+  std::unique_ptr<data_sink> _sink;
+  size_t _bytes_written = 0;
+  pinned_buffer _current{nullptr, cudaFreeHost};
+  size_t _current_size = 0;
+  std::deque<std::future<void>> _pending;
+  // Declared last so that its destructor, which waits for the queued writes, runs first
+  cudf::detail::thread_pool _pool{1};
+};
+
 /**
  * @brief Implementation class for storing data into a std::vector.
  */
@@ -177,7 +391,7 @@ class user_sink_wrapper : public data_sink {
 
 std::unique_ptr<data_sink> data_sink::create(const std::string& filepath)
 {
-  return std::make_unique<file_sink>(filepath);
+  return std::make_unique<buffered_sink>(std::make_unique<file_sink>(filepath));
 }
 
 std::unique_ptr<data_sink> data_sink::create(std::vector<char>* buffer)
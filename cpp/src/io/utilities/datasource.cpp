@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,6 +15,7 @@
  */
 
 #include "file_io_utilities.hpp"
+#include "io_uring_reader.hpp"
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/utilities/error.hpp>
@@ -189,6 +190,75 @@ class direct_read_source : public file_source {
   }
 };
 
+/**
+ * @brief Implementation class for reading from a file with batches of io_uring reads
+ *
+ * Each read is split into slices that are all in flight at the same time, so that reads from
+ * NVMe drives reach their bandwidth without memory mapping the file.
+ */
+class io_uring_source : public file_source {
+ public:
+  explicit io_uring_source(const char* filepath, std::unique_ptr<detail::io_uring_reader>&& reader)
+    : file_source(filepath), _reader(std::move(reader))
+  {
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    // Clamp length to available data
+    auto const read_size = std::min(size, _file.size() - offset);
+
+    std::vector<uint8_t> v(read_size);
+    host_read(offset, read_size, v.data());
+    return buffer::create(std::move(v));
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    CUDF_EXPECTS(offset <= _file.size(), "Offset is past end of file");
+
+    // Clamp length to available data
+    auto const read_size = std::min(size, _file.size() - offset);
+
+    std::vector<detail::host_read_request> slices;
+    append_slices(offset, read_size, dst, slices);
+    _reader->read(_file.desc(), slices);
+    return read_size;
+  }
+
+  size_t host_read_v(host_span<read_request const> requests) override
+  {
+    // The slices of all the ranges are submitted as a single batch
+    std::vector<detail::host_read_request> slices;
+    size_t total_read = 0;
+    for (auto const& request : requests) {
+      CUDF_EXPECTS(request.offset <= _file.size(), "Offset is past end of file");
+      auto const read_size = std::min(request.size, _file.size() - request.offset);
+      append_slices(request.offset, read_size, request.dst, slices);
+      total_read += read_size;
+    }
+    _reader->read(_file.desc(), slices);
+    return total_read;
+  }
+
+  static constexpr unsigned queue_depth   = 64;
+  static constexpr size_t max_slice_bytes = 4 * 1024 * 1024;
+
+ private:
+  static void append_slices(size_t offset,
+                            size_t size,
+                            uint8_t* dst,
+                            std::vector<detail::host_read_request>& slices)
+  {
+    for (size_t slice_offset = 0; slice_offset < size; slice_offset += max_slice_bytes) {
+      auto const slice_size = std::min(max_slice_bytes, size - slice_offset);
+      slices.push_back({offset + slice_offset, slice_size, dst + slice_offset});
+    }
+  }
+
+  std::unique_ptr<detail::io_uring_reader> _reader;
+};
+
 /**
  * @brief Wrapper class for user implemented data sources
  *
@@ -210,11 +280,21 @@ class user_datasource_wrapper : public datasource {
     return source->host_read(offset, size);
   }
 
+  size_t host_read_v(host_span<read_request const> requests) override
+  {
+    return source->host_read_v(requests);
+  }
+
   [[nodiscard]] bool supports_device_read() const override
   {
     return source->supports_device_read();
   }
 
+  [[nodiscard]] bool is_device_read_preferred(size_t size) const override
+  {
+    return source->is_device_read_preferred(size);
+  }
+
   size_t device_read(size_t offset,
                      size_t size,
                      uint8_t* dst,
@@ -223,6 +303,14 @@ class user_datasource_wrapper : public datasource {
     return source->device_read(offset, size, dst, stream);
   }
 
+  std::future<size_t> device_read_async(size_t offset,
+                                        size_t size,
+                                        uint8_t* dst,
+                                        rmm::cuda_stream_view stream) override
+  {
+    return source->device_read_async(offset, size, dst, stream);
+  }
+
   std::unique_ptr<buffer> device_read(size_t offset,
                                       size_t size,
                                       rmm::cuda_stream_view stream) override
@@ -230,6 +318,12 @@ class user_datasource_wrapper : public datasource {
     return source->device_read(offset, size, stream);
   }
 
+  std::future<size_t> device_read_v(host_span<read_request const> requests,
+                                    rmm::cuda_stream_view stream) override
+  {
+    return source->device_read_v(requests, stream);
+  }
+
   [[nodiscard]] size_t size() const override { return source->size(); }
 
  private:
@@ -238,6 +332,33 @@ class user_datasource_wrapper : public datasource {
 
 }  // namespace
 
+size_t datasource::host_read_v(host_span<read_request const> requests)
+{
+  size_t total_read = 0;
+  for (auto const& request : requests) {
+    total_read += host_read(request.offset, request.size, request.dst);
+  }
+  return total_read;
+}
+
+std::future<size_t> datasource::device_read_v(host_span<read_request const> requests,
+                                              rmm::cuda_stream_view stream)
+{
+  std::vector<std::future<size_t>> reads;
+  reads.reserve(requests.size());
+  for (auto const& request : requests) {
+    reads.push_back(device_read_async(request.offset, request.size, request.dst, stream));
+  }
+  auto waiter = [](std::vector<std::future<size_t>> reads) {
+    size_t total_read = 0;
+    for (auto& read : reads) {
+      total_read += read.get();
+    }
+    return total_read;
+  };
+  return std::async(std::launch::deferred, waiter, std::move(reads));
+}
+
 std::unique_ptr<datasource> datasource::create(const std::string& filepath,
                                                size_t offset,
                                                size_t size)
@@ -248,6 +369,12 @@ std::unique_ptr<datasource> datasource::create(const std::string& filepath,
     return std::make_unique<direct_read_source>(filepath.c_str());
   }
 #endif
+  if (detail::io_uring_integration::is_enabled()) {
+    auto reader = detail::io_uring_reader::create(io_uring_source::queue_depth);
+    if (reader != nullptr) {
+      return std::make_unique<io_uring_source>(filepath.c_str(), std::move(reader));
+    }
+  }
   // Use our own memory mapping implementation for direct file reads
   return std::make_unique<memory_mapped_source>(filepath.c_str(), offset, size);
 }
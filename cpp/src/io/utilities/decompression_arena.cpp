@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/io/decompression_arena.hpp>
+#include <cudf/utilities/error.hpp>
+
+namespace cudf {
+namespace io {
+
+decompression_arena::decompression_arena(std::size_t max_retained_bytes,
+                                         rmm::mr::device_memory_resource* upstream)
+  : _upstream(upstream), _max_retained_bytes(max_retained_bytes)
+{
+  CUDF_EXPECTS(upstream != nullptr, "Unexpected null upstream memory resource");
+}
+
+decompression_arena::~decompression_arena() { release(); }
+
+std::size_t decompression_arena::retained_bytes() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _retained_bytes;
+}
+
+void decompression_arena::release()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  for (auto const& buffer : _retained) {
+    _upstream->deallocate(buffer.ptr, buffer.size, buffer.stream);
+  }
+  _retained.clear();
+  _retained_bytes = 0;
+}
+
+void* decompression_arena::do_allocate(std::size_t bytes, rmm::cuda_stream_view stream)
+{
+  if (bytes == 0) { return nullptr; }
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  // Reuse the smallest retained buffer that is large enough
+  auto best = _retained.end();
+  for (auto it = _retained.begin(); it != _retained.end(); ++it) {
+    if (it->size >= bytes && (best == _retained.end() || it->size < best->size)) { best = it; }
+  }
+  if (best != _retained.end()) {
+    auto const buffer = *best;
+    _retained.erase(best);
+    _retained_bytes -= buffer.size;
+    if (buffer.stream.value() != stream.value()) { buffer.stream.synchronize(); }
+    _allocated.emplace(buffer.ptr, buffer.size);
+    return buffer.ptr;
+  }
+
+  auto ptr = _upstream->allocate(bytes, stream);
+  _allocated.emplace(ptr, bytes);
+  return ptr;
+}
+
+void decompression_arena::do_deallocate(void* ptr, std::size_t, rmm::cuda_stream_view stream)
+{
+  if (ptr == nullptr) { return; }
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto const it = _allocated.find(ptr);
+  CUDF_EXPECTS(it != _allocated.end(), "Buffer was not allocated from this arena");
+  auto const size = it->second;
+  _allocated.erase(it);
+
+  if (_retained_bytes + size <= _max_retained_bytes) {
+    _retained.push_back({ptr, size, stream});
+    _retained_bytes += size;
+  } else {
+    _upstream->deallocate(ptr, size, stream);
+  }
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,11 +16,13 @@
 #include "file_io_utilities.hpp"
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <io/utilities/config_utils.hpp>
+#include <io/utilities/thread_pool.hpp>
 
 #include <rmm/device_buffer.hpp>
 
 #include <dlfcn.h>
 
+#include <algorithm>
 #include <fstream>
 #include <numeric>
 
@@ -169,10 +171,8 @@ cufile_registered_file::~cufile_registered_file() { shim->handle_deregister(cf_h
 
 cufile_input_impl::cufile_input_impl(std::string const& filepath)
   : shim{cufile_shim::instance()},
-    cf_file(shim, filepath, O_RDONLY | O_DIRECT),
-    pool(16)  // The benefit from multithreaded read plateaus around 16 threads
+    cf_file(shim, filepath, O_RDONLY | O_DIRECT)
 {
-  pool.sleep_duration = 10;
 }
 
 std::unique_ptr<datasource::buffer> cufile_input_impl::read(size_t offset,
@@ -190,17 +190,20 @@ namespace {
 template <typename DataT,
           typename F,
           typename ResultT = std::invoke_result_t<F, DataT*, size_t, size_t>>
-std::vector<std::future<ResultT>> make_sliced_tasks(
-  F function, DataT* ptr, size_t offset, size_t size, cudf::detail::thread_pool& pool)
+std::vector<std::future<ResultT>> make_sliced_tasks(F function,
+                                                    DataT* ptr,
+                                                    size_t offset,
+                                                    size_t size)
 {
+  auto& pool = cudf::detail::host_worker_pool();
   std::vector<std::future<ResultT>> slice_tasks;
-  constexpr size_t max_slice_bytes = 4 * 1024 * 1024;
-  size_t const n_slices            = util::div_rounding_up_safe(size, max_slice_bytes);
-  size_t slice_offset              = 0;
+  auto const max_slice_bytes = cufile_integration::slice_size();
+  size_t const n_slices      = util::div_rounding_up_safe(size, max_slice_bytes);
+  size_t slice_offset        = 0;
   for (size_t t = 0; t < n_slices; ++t) {
     DataT* ptr_slice = ptr + slice_offset;
 
-    size_t const slice_size = (t == n_slices - 1) ? size % max_slice_bytes : max_slice_bytes;
+    size_t const slice_size = std::min(size - slice_offset, max_slice_bytes);
     slice_tasks.push_back(pool.submit(function, ptr_slice, slice_size, offset + slice_offset));
 
     slice_offset += slice_size;
@@ -226,12 +229,13 @@ std::future<size_t> cufile_input_impl::read_async(size_t offset,
     return read_size;
   };
 
-  auto slice_tasks = make_sliced_tasks(read_slice, dst, offset, size, pool);
+  auto slice_tasks = make_sliced_tasks(read_slice, dst, offset, size);
 
   auto waiter = [](auto slice_tasks) -> size_t {
-    return std::accumulate(slice_tasks.begin(), slice_tasks.end(), 0, [](auto sum, auto& task) {
-      return sum + task.get();
-    });
+    return std::accumulate(
+      slice_tasks.begin(), slice_tasks.end(), size_t{0}, [](auto sum, auto& task) {
+        return sum + task.get();
+      });
   };
   // The future returned from this function is deferred, not async because we want to avoid creating
   // threads for each read_async call. This overhead is significant in case of multiple small reads.
@@ -249,8 +253,7 @@ size_t cufile_input_impl::read(size_t offset,
 
 cufile_output_impl::cufile_output_impl(std::string const& filepath)
   : shim{cufile_shim::instance()},
-    cf_file(shim, filepath, O_CREAT | O_RDWR | O_DIRECT, 0664),
-    pool(16)
+    cf_file(shim, filepath, O_CREAT | O_RDWR | O_DIRECT, 0664)
 {
 }
 
@@ -273,7 +276,7 @@ std::future<void> cufile_output_impl::write_async(void const* data, size_t offse
   };
 
   auto source      = static_cast<uint8_t const*>(data);
-  auto slice_tasks = make_sliced_tasks(write_slice, source, offset, size, pool);
+  auto slice_tasks = make_sliced_tasks(write_slice, source, offset, size);
 
   auto waiter = [](auto slice_tasks) -> void {
     for (auto const& task : slice_tasks) {
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io_uring_reader.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#define CUDF_IO_URING_FOUND
+#endif
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+namespace {
+
+/**
+ * @brief Reads the range with `pread` calls, until it is complete
+ *
+ * @return Whether the whole range was read
+ */
+bool pread_all(int fd, host_read_request request)
+{
+  while (request.size > 0) {
+    auto const read_size = pread(fd, request.dst, request.size, request.offset);
+    if (read_size < 0 && errno == EINTR) { continue; }
+    if (read_size <= 0) { return false; }
+    request.offset += read_size;
+    request.size -= read_size;
+    request.dst += read_size;
+  }
+  return true;
+}
+
+}  // namespace
+
+#ifdef CUDF_IO_URING_FOUND
+
+namespace {
+
+int io_uring_setup(unsigned entries, io_uring_params* params)
+{
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int io_uring_enter(int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags)
+{
+  return static_cast<int>(
+    syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+template <typename T>
+T* ring_field(void* ring, uint32_t offset)
+{
+  return reinterpret_cast<T*>(static_cast<uint8_t*>(ring) + offset);
+}
+
+}  // namespace
+
+std::unique_ptr<io_uring_reader> io_uring_reader::create(unsigned queue_depth)
+{
+  io_uring_params params{};
+  auto const ring_fd = io_uring_setup(queue_depth, &params);
+  if (ring_fd < 0) { return nullptr; }
+
+  std::unique_ptr<io_uring_reader> reader(new io_uring_reader());
+  reader->_ring_fd     = ring_fd;
+  reader->_queue_depth = params.sq_entries;
+
+  reader->_sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  reader->_cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  auto const single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+  if (single_mmap) {
+    reader->_sq_ring_size = std::max(reader->_sq_ring_size, reader->_cq_ring_size);
+  }
+  auto map = [&](size_t size, off_t offset) {
+    auto const ptr =
+      mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, offset);
+    return ptr == MAP_FAILED ? nullptr : ptr;
+  };
+  reader->_sq_ring = map(reader->_sq_ring_size, IORING_OFF_SQ_RING);
+  if (reader->_sq_ring == nullptr) { return nullptr; }
+  if (single_mmap) {
+    reader->_cq_ring = reader->_sq_ring;
+  } else {
+    reader->_cq_ring = map(reader->_cq_ring_size, IORING_OFF_CQ_RING);
+    if (reader->_cq_ring == nullptr) { return nullptr; }
+  }
+  reader->_sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+  reader->_sqes      = map(reader->_sqes_size, IORING_OFF_SQES);
+  if (reader->_sqes == nullptr) { return nullptr; }
+
+  reader->_sq_tail  = ring_field<unsigned>(reader->_sq_ring, params.sq_off.tail);
+  reader->_sq_mask  = ring_field<unsigned>(reader->_sq_ring, params.sq_off.ring_mask);
+  reader->_sq_array = ring_field<unsigned>(reader->_sq_ring, params.sq_off.array);
+  reader->_cq_head  = ring_field<unsigned>(reader->_cq_ring, params.cq_off.head);
+  reader->_cq_tail  = ring_field<unsigned>(reader->_cq_ring, params.cq_off.tail);
+  reader->_cq_mask  = ring_field<unsigned>(reader->_cq_ring, params.cq_off.ring_mask);
+  reader->_cqes     = ring_field<void>(reader->_cq_ring, params.cq_off.cqes);
+  return reader;
+}
+
+io_uring_reader::~io_uring_reader()
+{
+  if (_sqes != nullptr) { munmap(_sqes, _sqes_size); }
+  if (_cq_ring != nullptr && _cq_ring != _sq_ring) { munmap(_cq_ring, _cq_ring_size); }
+  if (_sq_ring != nullptr) { munmap(_sq_ring, _sq_ring_size); }
+  if (_ring_fd >= 0) { close(_ring_fd); }
+}
+
+void io_uring_reader::read(int fd, host_span<host_read_request const> requests)
+{
+  // A single read of the kernel is limited to less than 2GB
+  constexpr size_t max_read_size = 1 << 30;
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  std::deque<host_read_request> pending(requests.begin(), requests.end());
+  // Reads in flight, indexed by the `user_data` of their submissions
+  std::vector<host_read_request> in_flight(_queue_depth);
+  std::vector<unsigned> free_slots(_queue_depth);
+  for (unsigned i = 0; i < _queue_depth; ++i) {
+    free_slots[i] = _queue_depth - 1 - i;
+  }
+
+  auto const sqes = static_cast<io_uring_sqe*>(_sqes);
+  auto const cqes = static_cast<io_uring_cqe*>(_cqes);
+  unsigned queued = 0;  // Entries of the submission queue not yet consumed by the kernel
+  bool failed     = false;
+  while (not pending.empty() or free_slots.size() < _queue_depth) {
+    // Queue as many of the pending reads as there are free entries
+    auto tail = *_sq_tail;
+    while (not pending.empty() and not free_slots.empty()) {
+      auto const request = pending.front();
+      pending.pop_front();
+      if (request.size == 0) { continue; }
+      auto const slot = free_slots.back();
+      free_slots.pop_back();
+      in_flight[slot] = request;
+
+      auto const index = tail & *_sq_mask;
+      auto& sqe        = sqes[index];
+      std::memset(&sqe, 0, sizeof(sqe));
+      sqe.opcode       = IORING_OP_READ;
+      sqe.fd           = fd;
+      sqe.addr         = reinterpret_cast<uint64_t>(request.dst);
+      sqe.len          = static_cast<uint32_t>(std::min(request.size, max_read_size));
+      sqe.off          = request.offset;
+      sqe.user_data    = slot;
+      _sq_array[index] = index;
+      ++tail;
+      ++queued;
+    }
+    __atomic_store_n(_sq_tail, tail, __ATOMIC_RELEASE);
+    if (free_slots.size() == _queue_depth) { break; }
+
+    // Submit the new reads and wait for at least one completion
+    int submitted = 0;
+    do {
+      submitted = io_uring_enter(_ring_fd, queued, 1, IORING_ENTER_GETEVENTS);
+    } while (submitted < 0 && errno == EINTR);
+    CUDF_EXPECTS(submitted >= 0, "Failed to submit reads to io_uring");
+    queued -= submitted;
+
+    auto head       = *_cq_head;
+    auto const last = __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE);
+    for (; head != last; ++head) {
+      auto const& cqe    = cqes[head & *_cq_mask];
+      auto const slot    = static_cast<unsigned>(cqe.user_data);
+      auto const request = in_flight[slot];
+      free_slots.push_back(slot);
+      if (cqe.res < 0) {
+        failed |= not pread_all(fd, request);
+      } else if (cqe.res == 0) {
+        failed = true;
+      } else if (static_cast<size_t>(cqe.res) < request.size) {
+        auto const read_size = static_cast<size_t>(cqe.res);
+        pending.push_back(
+          {request.offset + read_size, request.size - read_size, request.dst + read_size});
+      }
+    }
+    __atomic_store_n(_cq_head, head, __ATOMIC_RELEASE);
+    // Stop queueing reads after a failure, but wait for those in flight
+    if (failed) { pending.clear(); }
+  }
+  CUDF_EXPECTS(not failed, "Failed to read from the file");
+}
+
+#else
+
+std::unique_ptr<io_uring_reader> io_uring_reader::create(unsigned) { return nullptr; }
+
+io_uring_reader::~io_uring_reader() = default;
+
+void io_uring_reader::read(int fd, host_span<host_read_request const> requests)
+{
+  for (auto const& request : requests) {
+    CUDF_EXPECTS(pread_all(fd, request), "Failed to read from the file");
+  }
+}
+
+#endif
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
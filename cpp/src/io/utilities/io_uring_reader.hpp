@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Range of a file to read into host memory
+ */
+struct host_read_request {
+  size_t offset;  ///< Offset of the range in the file
+  size_t size;    ///< Size of the range
+  uint8_t* dst;   ///< Host memory to read the range into
+};
+
+/**
+ * @brief Submits batches of reads of a file through an io_uring submission queue.
+ *
+ * All the reads of a batch are in flight at the same time, up to the depth of the queue; this
+ * keeps enough requests queued for NVMe drives to reach their bandwidth, without a thread per
+ * read. The ring is shared by the calls to `read`, which are serialized.
+ */
+class io_uring_reader {
+ public:
+  /**
+   * @brief Creates a reader with a submission queue of the given depth.
+   *
+   * @param queue_depth Maximum number of reads in flight
+   * @return The reader, or null if the kernel does not support io_uring or denies its use
+   */
+  static std::unique_ptr<io_uring_reader> create(unsigned queue_depth);
+
+  io_uring_reader(io_uring_reader const&) = delete;
+  io_uring_reader& operator=(io_uring_reader const&) = delete;
+  ~io_uring_reader();
+
+  /**
+   * @brief Reads all the requested ranges of a file.
+   *
+   * Reads that complete partially are resubmitted for their remainder. Reads that the kernel
+   * rejects, as older kernels do for the opcode used, are done with `pread` instead.
+   *
+   * @throws cudf::logic_error if a range cannot be read completely
+   *
+   * @param fd Descriptor of the file to read from
+   * @param requests Ranges to read
+   */
+  void read(int fd, host_span<host_read_request const> requests);
+
+ private:
+  io_uring_reader() = default;
+
+  int _ring_fd          = -1;
+  unsigned _queue_depth = 0;
+
+  // Shared ring mappings
+  void* _sq_ring       = nullptr;
+  size_t _sq_ring_size = 0;
+  void* _cq_ring       = nullptr;
+  size_t _cq_ring_size = 0;
+  void* _sqes          = nullptr;
+  size_t _sqes_size    = 0;
+
+  // Locations of the fields of the rings within the mappings
+  unsigned* _sq_tail  = nullptr;
+  unsigned* _sq_mask  = nullptr;
+  unsigned* _sq_array = nullptr;
+  unsigned* _cq_head  = nullptr;
+  unsigned* _cq_tail  = nullptr;
+  unsigned* _cq_mask  = nullptr;
+  void* _cqes         = nullptr;
+
+  std::mutex _mutex;
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
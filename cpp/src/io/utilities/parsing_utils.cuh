@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -31,6 +31,38 @@ using cudf::device_span;
 namespace cudf {
 namespace io {
 
+/**
+ * @brief Multi-character delimiter or line terminator
+ *
+ * An empty sequence matches nowhere.
+ */
+struct char_sequence {
+  static constexpr int max_size = 8;
+
+  char bytes[max_size] = {};
+  int size             = 0;
+
+  /**
+   * @brief Returns whether the sequence starts at `pos`, in data ending at `end`
+   */
+  CUDF_HOST_DEVICE inline bool starts_at(char const* pos, char const* end) const
+  {
+    if (size == 0 || end - pos < size) { return false; }
+    for (int i = 0; i < size; ++i) {
+      if (pos[i] != bytes[i]) { return false; }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Returns whether the sequence ends at `last`, in data starting at `begin`
+   */
+  CUDF_HOST_DEVICE inline bool ends_at(char const* last, char const* begin) const
+  {
+    return last + 1 - begin >= size && starts_at(last + 1 - size, last + 1);
+  }
+};
+
 /**
  * @brief Structure for holding various options used when parsing and
  * converting CSV/json data to cuDF data type values.
@@ -50,6 +82,8 @@ struct parse_options_view {
   cudf::detail::trie_view trie_false;
   cudf::detail::trie_view trie_na;
   bool multi_delimiter;
+  char_sequence delimiter_seq;
+  char_sequence terminator_seq;
 };
 
 struct parse_options {
@@ -67,6 +101,9 @@ struct parse_options {
   cudf::detail::optional_trie trie_false;
   cudf::detail::optional_trie trie_na;
   bool multi_delimiter;
+  // Delimiter and line terminator as sequences; multi-character when `size` is greater than one
+  char_sequence delimiter_seq;
+  char_sequence terminator_seq;
 
   [[nodiscard]] parse_options_view view() const
   {
@@ -83,7 +120,9 @@ struct parse_options {
             cudf::detail::make_trie_view(trie_true),
             cudf::detail::make_trie_view(trie_false),
             cudf::detail::make_trie_view(trie_na),
-            multi_delimiter};
+            multi_delimiter,
+            delimiter_seq,
+            terminator_seq};
   }
 };
 
@@ -243,7 +282,8 @@ namespace gpu {
  * just a character.
  *
  * @return Pointer to the last character in the field, including the
- *  delimiter(s) following the field data
+ *  delimiter(s) following the field data; multi-character delimiters are not included, see
+ *  `next_field_start`
  */
 __device__ __inline__ char const* seek_field_end(char const* begin,
                                                  char const* end,
@@ -262,12 +302,14 @@ __device__ __inline__ char const* seek_field_end(char const* begin,
     if (*current == opts.quotechar and not escape_next) {
       quotation = !quotation;
     } else if (!quotation) {
-      if (*current == opts.delimiter) {
+      if (opts.delimiter_seq.size > 1 ? opts.delimiter_seq.starts_at(current, end)
+                                      : *current == opts.delimiter) {
         while (opts.multi_delimiter && (current + 1 < end) && *(current + 1) == opts.delimiter) {
           ++current;
         }
         break;
-      } else if (*current == opts.terminator) {
+      } else if (opts.terminator_seq.size > 1 ? opts.terminator_seq.starts_at(current, end)
+                                              : *current == opts.terminator) {
         break;
       } else if (*current == '\r' && (current + 1 < end && *(current + 1) == '\n')) {
         --end;
@@ -289,6 +331,18 @@ __device__ __inline__ char const* seek_field_end(char const* begin,
   return current;
 }
 
+/**
+ * @brief Returns the start of the field following the delimiter returned by `seek_field_end`
+ *
+ * @param field_end Pointer returned by `seek_field_end`
+ * @param opts A set of parsing options
+ */
+__device__ __inline__ char const* next_field_start(char const* field_end,
+                                                   parse_options_view const& opts)
+{
+  return field_end + (opts.delimiter_seq.size > 1 ? opts.delimiter_seq.size : 1);
+}
+
 /**
  * @brief Lexicographically compare digits in input against string
  * representing an integer
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "reader_profiler.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+
+namespace cudf::io::detail {
+
+reader_profiler::stage_timer::stage_timer(reader_profiler* profiler,
+                                          char const* name,
+                                          rmm::cuda_stream_view stream)
+  : _profiler{profiler}, _stream{stream}
+{
+  if (_profiler == nullptr) { return; }
+  stage_events stage{name, nullptr, nullptr};
+  CUDA_TRY(cudaEventCreate(&stage.start));
+  if (cudaEventCreate(&stage.stop) != cudaSuccess) {
+    cudaEventDestroy(stage.start);
+    CUDF_FAIL("Failed to create the events of a reader stage");
+  }
+  _index = _profiler->_stages.size();
+  _profiler->_stages.push_back(stage);
+  CUDA_TRY(cudaEventRecord(stage.start, _stream.value()));
+}
+
+reader_profiler::stage_timer::~stage_timer()
+{
+  if (_profiler == nullptr) { return; }
+  // the stage is left untimed if the event cannot be recorded
+  if (cudaEventRecord(_profiler->_stages[_index].stop, _stream.value()) != cudaSuccess) {
+    cudaGetLastError();
+    _profiler->_stages[_index].name = nullptr;
+  }
+}
+
+reader_profiler::~reader_profiler()
+{
+  for (auto const& stage : _stages) {
+    cudaEventDestroy(stage.start);
+    cudaEventDestroy(stage.stop);
+  }
+}
+
+reader_profile reader_profiler::finish(rmm::cuda_stream_view stream)
+{
+  stream.synchronize();
+  auto profile = _profile;
+  for (auto const& stage : _stages) {
+    if (stage.name == nullptr) { continue; }
+    float time_ms = 0;
+    CUDA_TRY(cudaEventElapsedTime(&time_ms, stage.start, stage.stop));
+    auto it = std::find_if(profile.stage_times.begin(),
+                           profile.stage_times.end(),
+                           [&stage](auto const& t) { return t.name == stage.name; });
+    if (it == profile.stage_times.end()) {
+      it = profile.stage_times.insert(it, reader_profile::stage_time{stage.name, 0});
+    }
+    it->time_ms += time_ms;
+  }
+  return profile;
+}
+
+}  // namespace cudf::io::detail
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <vector>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Collects the `reader_profile` of one read.
+ *
+ * The reader counts the bytes and pages it processes into `counters()` and times each of its
+ * stages with a `stage_timer`. The times are only read back by `finish()`, so profiling adds no
+ * synchronization to the read besides the one at its end.
+ */
+class reader_profiler {
+ public:
+  /**
+   * @brief Records the start and end of a stage on the stream of the read.
+   *
+   * Does nothing if the profiler is null, so that the stages of a reader can be timed
+   * unconditionally.
+   */
+  class stage_timer {
+   public:
+    /**
+     * @brief Starts the stage.
+     *
+     * @param profiler Profiler of the read, or null if the read is not profiled
+     * @param name Name of the stage, which must outlive the profiler
+     * @param stream Stream of the read
+     */
+    stage_timer(reader_profiler* profiler, char const* name, rmm::cuda_stream_view stream);
+
+    stage_timer(stage_timer const&) = delete;
+    stage_timer& operator=(stage_timer const&) = delete;
+
+    /**
+     * @brief Ends the stage.
+     */
+    ~stage_timer();
+
+   private:
+    reader_profiler* _profiler;
+    rmm::cuda_stream_view _stream;
+    std::size_t _index = 0;
+  };
+
+  reader_profiler() = default;
+  reader_profiler(reader_profiler const&) = delete;
+  reader_profiler& operator=(reader_profiler const&) = delete;
+
+  /**
+   * @brief Destroys the events of the stages.
+   */
+  ~reader_profiler();
+
+  /**
+   * @brief Returns the profile whose counters the reader increments.
+   */
+  reader_profile& counters() { return _profile; }
+
+  /**
+   * @brief Waits for the last stage to complete and returns the profile with the stage times.
+   *
+   * @param stream Stream of the read
+   * @return Profile of the read
+   */
+  reader_profile finish(rmm::cuda_stream_view stream);
+
+ private:
+  /**
+   * @brief Events recorded at the start and end of one run of a stage
+   */
+  struct stage_events {
+    char const* name;
+    cudaEvent_t start;
+    cudaEvent_t stop;
+  };
+
+  reader_profile _profile;
+  std::vector<stage_events> _stages;
+};
+
+}  // namespace cudf::io::detail
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "thread_pool.hpp"
+
+#include <io/utilities/config_utils.hpp>
+
+namespace cudf {
+namespace detail {
+
+thread_pool& host_worker_pool()
+{
+  static thread_pool pool(cudf::io::detail::io_thread_count());
+  return pool;
+}
+
+void set_host_worker_pool_size(unsigned int thread_count)
+{
+  host_worker_pool().reset(thread_count);
+}
+
+}  // namespace detail
+}  // namespace cudf
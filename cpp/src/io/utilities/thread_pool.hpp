@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,29 +22,33 @@
  *            See file LICENSE for detail or copy at https://opensource.org/licenses/MIT
  */
 
-#include <atomic>       // std::atomic
-#include <chrono>       // std::chrono
-#include <cstdint>      // std::int_fast64_t, std::uint_fast32_t
-#include <functional>   // std::function
-#include <future>       // std::future, std::promise
-#include <memory>       // std::shared_ptr, std::unique_ptr
-#include <mutex>        // std::mutex, std::scoped_lock
-#include <queue>        // std::queue
-#include <thread>       // std::this_thread, std::thread
+#include <atomic>              // std::atomic
+#include <condition_variable>  // std::condition_variable
+#include <deque>               // std::deque
+#include <functional>          // std::function
+#include <future>              // std::future, std::promise
+#include <memory>              // std::shared_ptr, std::unique_ptr
+#include <mutex>               // std::mutex, std::scoped_lock, std::unique_lock
+#include <thread>              // std::thread
 #include <type_traits>  // std::decay_t, std::enable_if_t, std::is_void_v, std::invoke_result_t
 #include <utility>      // std::move, std::swap
+#include <vector>       // std::vector
 
 namespace cudf {
 namespace detail {
 
 /**
- * @brief A C++17 thread pool class. The user submits tasks to be executed into a queue. Whenever a
- * thread becomes available, it pops a task from the queue and executes it. Each task is
- * automatically assigned a future, which can be used to wait for the task to finish executing
- * and/or obtain its eventual return value.
+ * @brief A C++17 thread pool class. The user submits tasks to be executed by the threads of the
+ * pool. Each task is automatically assigned a future, which can be used to wait for the task to
+ * finish executing and/or obtain its eventual return value.
+ *
+ * Each thread has its own queue of tasks. Tasks submitted from outside the pool are distributed
+ * over the queues in turn, and tasks submitted from a thread of the pool go to the queue of that
+ * thread. A thread runs the tasks of its queue in order, and steals tasks from the other queues
+ * once its own is empty. Idle threads wait on a condition variable until a task is submitted.
  */
 class thread_pool {
-  using ui32 = int;
+  using ui32 = unsigned int;
 
  public:
   /**
@@ -56,34 +60,25 @@ class thread_pool {
    * instead.
    */
   thread_pool(const ui32& _thread_count = std::thread::hardware_concurrency())
-    : thread_count(_thread_count ? _thread_count : std::thread::hardware_concurrency()),
-      threads(new std::thread[_thread_count ? _thread_count : std::thread::hardware_concurrency()])
   {
-    create_threads();
+    create_threads(_thread_count);
   }
 
   /**
    * @brief Destruct the thread pool. Waits for all tasks to complete, then destroys all threads.
-   * Note that if the variable paused is set to true, then any tasks still in the queue will never
-   * be executed.
    */
   ~thread_pool()
   {
     wait_for_tasks();
-    running = false;
     destroy_threads();
   }
 
   /**
-   * @brief Get the number of tasks currently waiting in the queue to be executed by the threads.
+   * @brief Get the number of tasks currently waiting in the queues to be executed by the threads.
    *
    * @return The number of queued tasks.
    */
-  [[nodiscard]] size_t get_tasks_queued() const
-  {
-    const std::scoped_lock lock(queue_mutex);
-    return tasks.size();
-  }
+  [[nodiscard]] size_t get_tasks_queued() const { return tasks_queued; }
 
   /**
    * @brief Get the number of tasks currently being executed by the threads.
@@ -93,7 +88,7 @@ class thread_pool {
   [[nodiscard]] ui32 get_tasks_running() const { return tasks_total - (ui32)get_tasks_queued(); }
 
   /**
-   * @brief Get the total number of unfinished tasks - either still in the queue, or running in a
+   * @brief Get the total number of unfinished tasks - either still in a queue, or running in a
    * thread.
    *
    * @return The total number of tasks.
@@ -131,24 +126,23 @@ class thread_pool {
       block_size = 1;
       num_tasks  = (ui32)total_size > 1 ? (ui32)total_size : 1;
     }
-    std::atomic<ui32> blocks_running = 0;
+    std::vector<std::future<void>> blocks;
+    blocks.reserve(num_tasks);
     for (ui32 t = 0; t < num_tasks; t++) {
       T start = (T)(t * block_size + first_index);
       T end   = (t == num_tasks - 1) ? last_index : (T)((t + 1) * block_size + first_index - 1);
-      blocks_running++;
-      push_task([start, end, &loop, &blocks_running] {
+      blocks.push_back(submit([start, end, &loop] {
         for (T i = start; i <= end; i++)
           loop(i);
-        blocks_running--;
-      });
+      }));
     }
-    while (blocks_running != 0) {
-      sleep_or_yield();
+    for (auto& block : blocks) {
+      block.get();
     }
   }
 
   /**
-   * @brief Push a function with no arguments or return value into the task queue.
+   * @brief Push a function with no arguments or return value into a task queue.
    *
    * @tparam F The type of the function.
    * @param task The function to push.
@@ -157,18 +151,23 @@ class thread_pool {
   void push_task(const F& task)
   {
     tasks_total++;
+    // Tasks submitted from a thread of this pool stay in the queue of that thread
+    auto const index =
+      current_pool == this ? current_index : next_queue.fetch_add(1) % thread_count;
     {
-      const std::scoped_lock lock(queue_mutex);
-      tasks.push(std::function<void()>(task));
+      const std::scoped_lock lock(queues[index].mutex);
+      tasks_queued++;
+      queues[index].tasks.emplace_back(task);
     }
+    notify(task_available, false);
   }
 
   /**
-   * @brief Push a function with arguments, but no return value, into the task queue.
+   * @brief Push a function with arguments, but no return value, into a task queue.
    * @details The function is wrapped inside a lambda in order to hide the arguments, as the tasks
-   * in the queue must be of type std::function<void()>, so they cannot have any arguments or return
-   * value. If no arguments are provided, the other overload will be used, in order to avoid the
-   * (slight) overhead of using a lambda.
+   * in the queues must be of type std::function<void()>, so they cannot have any arguments or
+   * return value. If no arguments are provided, the other overload will be used, in order to avoid
+   * the (slight) overhead of using a lambda.
    *
    * @tparam F The type of the function.
    * @tparam A The types of the arguments.
@@ -182,11 +181,10 @@ class thread_pool {
   }
 
   /**
-   * @brief Reset the number of threads in the pool. Waits for all currently running tasks to be
-   * completed, then destroys all threads in the pool and creates a new thread pool with the new
-   * number of threads. Any tasks that were waiting in the queue before the pool was reset will then
-   * be executed by the new threads. If the pool was paused before resetting it, the new pool will
-   * be paused as well.
+   * @brief Reset the number of threads in the pool. Waits for all tasks to be completed, then
+   * destroys all threads in the pool and creates new threads with the new number of threads.
+   *
+   * Tasks must not be submitted while the pool is being reset.
    *
    * @param _thread_count The number of threads to use. The default value is the total number of
    * hardware threads available, as reported by the implementation. With a hyperthreaded CPU, this
@@ -195,20 +193,13 @@ class thread_pool {
    */
   void reset(const ui32& _thread_count = std::thread::hardware_concurrency())
   {
-    bool was_paused = paused;
-    paused          = true;
     wait_for_tasks();
-    running = false;
     destroy_threads();
-    thread_count = _thread_count ? _thread_count : std::thread::hardware_concurrency();
-    threads.reset(new std::thread[thread_count]);
-    paused = was_paused;
-    create_threads();
-    running = true;
+    create_threads(_thread_count);
   }
 
   /**
-   * @brief Submit a function with zero or more arguments and a return value into the task queue,
+   * @brief Submit a function with zero or more arguments and a return value into a task queue,
    * and get a future for its eventual returned value.
    *
    * @tparam F The type of the function.
@@ -242,140 +233,201 @@ class thread_pool {
   }
 
   /**
-   * @brief Wait for tasks to be completed. Normally, this function waits for all tasks, both those
-   * that are currently running in the threads and those that are still waiting in the queue.
-   * However, if the variable paused is set to true, this function only waits for the currently
-   * running tasks (otherwise it would wait forever). To wait for a specific task, use submit()
+   * @brief Wait for tasks to be completed, both those that are currently running in the threads
+   * and those that are still waiting in the queues. To wait for a specific task, use submit()
    * instead, and call the wait() member function of the generated future.
    */
   void wait_for_tasks()
   {
-    while (true) {
-      if (!paused) {
-        if (tasks_total == 0) break;
-      } else {
-        if (get_tasks_running() == 0) break;
-      }
-      sleep_or_yield();
-    }
+    std::unique_lock<std::mutex> lock(state_mutex);
+    tasks_done.wait(lock, [this] { return tasks_total == 0; });
   }
 
+ private:
   /**
-   * @brief An atomic variable indicating to the workers to pause. When set to true, the workers
-   * temporarily stop popping new tasks out of the queue, although any tasks already executed will
-   * keep running until they are done. Set to false again to resume popping tasks.
-   */
-  std::atomic<bool> paused = false;
-
-  /**
-   * @brief The duration, in microseconds, that the worker function should sleep for when it cannot
-   * find any tasks in the queue. If set to 0, then instead of sleeping, the worker function will
-   * execute std::this_thread::yield() if there are no tasks in the queue. The default value is
-   * 1000.
+   * @brief A queue of tasks, owned by one of the threads.
    */
-  ui32 sleep_duration = 1000;
+  struct task_queue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
 
- private:
   /**
-   * @brief Create the threads in the pool and assign a worker to each thread.
+   * @brief Create the threads in the pool and their queues, and assign a worker to each thread.
    */
-  void create_threads()
+  void create_threads(ui32 _thread_count)
   {
+    thread_count = _thread_count ? _thread_count : std::thread::hardware_concurrency();
+    if (thread_count == 0) thread_count = 1;
+    running = true;
+    queues.reset(new task_queue[thread_count]);
+    threads.clear();
     for (ui32 i = 0; i < thread_count; i++) {
-      threads[i] = std::thread(&thread_pool::worker, this);
+      threads.emplace_back(&thread_pool::worker, this, i);
     }
   }
 
   /**
-   * @brief Destroy the threads in the pool by joining them.
+   * @brief Destroy the threads in the pool by waking them up and joining them.
    */
   void destroy_threads()
   {
-    for (ui32 i = 0; i < thread_count; i++) {
-      threads[i].join();
+    {
+      const std::scoped_lock lock(state_mutex);
+      running = false;
+    }
+    task_available.notify_all();
+    for (auto& thread : threads) {
+      thread.join();
     }
   }
 
   /**
-   * @brief Try to pop a new task out of the queue.
+   * @brief Notify a condition variable that waits on `state_mutex`.
+   *
+   * Taking the mutex first orders the notification after the check of the condition by a thread
+   * that is about to wait, so that the wakeup cannot be missed.
    *
-   * @param task A reference to the task. Will be populated with a function if the queue is not
-   * empty.
-   * @return true if a task was found, false if the queue is empty.
+   * @param condition The condition variable to notify.
+   * @param all Whether to wake up all the waiting threads, or only one.
    */
-  bool pop_task(std::function<void()>& task)
+  void notify(std::condition_variable& condition, bool all)
   {
-    const std::scoped_lock lock(queue_mutex);
-    if (tasks.empty())
-      return false;
-    else {
-      task = std::move(tasks.front());
-      tasks.pop();
-      return true;
-    }
+    { const std::scoped_lock lock(state_mutex); }
+    if (all)
+      condition.notify_all();
+    else
+      condition.notify_one();
   }
 
   /**
-   * @brief Sleep for sleep_duration microseconds. If that variable is set to zero, yield instead.
+   * @brief Try to pop a task out of the queue of the given thread, or to steal one from the queue
+   * of another thread.
    *
+   * @param index The index of the thread.
+   * @param task A reference to the task. Will be populated with a function if a task was found.
+   * @return true if a task was found, false if all the queues are empty.
    */
-  void sleep_or_yield()
+  bool pop_task(ui32 index, std::function<void()>& task)
   {
-    if (sleep_duration)
-      std::this_thread::sleep_for(std::chrono::microseconds(sleep_duration));
-    else
-      std::this_thread::yield();
+    for (ui32 i = 0; i < thread_count; i++) {
+      auto& queue = queues[(index + i) % thread_count];
+      const std::scoped_lock lock(queue.mutex);
+      if (queue.tasks.empty()) continue;
+      // The owner takes the oldest task, and thieves take the most recent one
+      if (i == 0) {
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+      } else {
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+      }
+      tasks_queued--;
+      return true;
+    }
+    return false;
   }
 
   /**
-   * @brief A worker function to be assigned to each thread in the pool. Continuously pops tasks out
-   * of the queue and executes them, as long as the atomic variable running is set to true.
+   * @brief A worker function to be assigned to each thread in the pool. Runs the tasks of the
+   * queues, and waits for new tasks while all the queues are empty, until the pool is destroyed.
+   *
+   * @param index The index of the thread, and of its queue.
    */
-  void worker()
+  void worker(ui32 index)
   {
-    while (running) {
+    current_pool  = this;
+    current_index = index;
+    while (true) {
       std::function<void()> task;
-      if (!paused && pop_task(task)) {
+      if (pop_task(index, task)) {
         task();
-        tasks_total--;
-      } else {
-        sleep_or_yield();
+        if (--tasks_total == 0) notify(tasks_done, true);
+        continue;
       }
+      std::unique_lock<std::mutex> lock(state_mutex);
+      task_available.wait(lock, [this] { return !running || tasks_queued > 0; });
+      if (!running && tasks_queued == 0) break;
     }
+    current_pool = nullptr;
   }
 
   /**
-   * @brief A mutex to synchronize access to the task queue by different threads.
+   * @brief The pool that the current thread belongs to, if any, and the index of the thread in it.
+   */
+  inline static thread_local thread_pool const* current_pool = nullptr;
+  inline static thread_local ui32 current_index              = 0;
+
+  /**
+   * @brief A mutex to synchronize the waits on the condition variables below.
+   */
+  std::mutex state_mutex;
+
+  /**
+   * @brief Notified when a task is submitted, or when the threads are destroyed.
+   */
+  std::condition_variable task_available;
+
+  /**
+   * @brief Notified when the last unfinished task completes.
+   */
+  std::condition_variable tasks_done;
+
+  /**
+   * @brief A variable indicating to the workers to keep running. When set to false, the workers
+   * stop once the queues are empty.
    */
-  mutable std::mutex queue_mutex;
+  bool running = true;
 
   /**
-   * @brief An atomic variable indicating to the workers to keep running. When set to false, the
-   * workers permanently stop working.
+   * @brief The queues of tasks to be executed by the threads, one per thread.
    */
-  std::atomic<bool> running = true;
+  std::unique_ptr<task_queue[]> queues;
 
   /**
-   * @brief A queue of tasks to be executed by the threads.
+   * @brief The threads of the pool.
    */
-  std::queue<std::function<void()>> tasks;
+  std::vector<std::thread> threads;
 
   /**
    * @brief The number of threads in the pool.
    */
-  ui32 thread_count;
+  ui32 thread_count = 0;
 
   /**
-   * @brief A smart pointer to manage the memory allocated for the threads.
+   * @brief The queue that the next task submitted from outside the pool goes to.
    */
-  std::unique_ptr<std::thread[]> threads;
+  std::atomic<ui32> next_queue = 0;
+
+  /**
+   * @brief An atomic variable to keep track of the number of tasks waiting in the queues.
+   */
+  std::atomic<size_t> tasks_queued = 0;
 
   /**
    * @brief An atomic variable to keep track of the total number of unfinished tasks - either still
-   * in the queue, or running in a thread.
+   * in a queue, or running in a thread.
    */
   std::atomic<ui32> tasks_total = 0;
 };
 
+/**
+ * @brief Returns the thread pool shared by the readers and writers of the process.
+ *
+ * The pool is created on first use, with the number of threads given by `LIBCUDF_IO_THREAD_COUNT`
+ * (the number of hardware threads by default). Tasks submitted to it must not wait for other tasks
+ * of the pool, since all of its threads could end up waiting.
+ */
+thread_pool& host_worker_pool();
+
+/**
+ * @brief Sets the number of threads of the shared thread pool.
+ *
+ * Waits for the tasks of the pool to complete; no reads or writes may be in progress.
+ *
+ * @param thread_count The number of threads; zero uses the number of hardware threads
+ */
+void set_host_worker_pool_size(unsigned int thread_count);
+
 }  // namespace detail
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -58,8 +58,10 @@ std::filesystem::path get_user_home_cache_dir()
  * The default cache directory is `$HOME/.cudf/$CUDF_VERSION`. If no overrides
  * are used and if $HOME is not defined, returns an empty path and file
  * caching is not used.
+ *
+ * @param compute_capability The compute capability of the device the kernels are compiled for
  */
-std::filesystem::path get_cache_dir()
+std::filesystem::path get_cache_dir(int compute_capability)
 {
   // The environment variable always overrides the
   // default/compile-time value of `LIBCUDF_KERNEL_CACHE_PATH`
@@ -74,15 +76,7 @@ std::filesystem::path get_cache_dir()
 
     // Make per device cache based on compute capability. This is to avoid multiple devices of
     // different compute capability to access the same kernel cache.
-    int device;
-    int cc_major;
-    int cc_minor;
-    CUDA_TRY(cudaGetDevice(&device));
-    CUDA_TRY(cudaDeviceGetAttribute(&cc_major, cudaDevAttrComputeCapabilityMajor, device));
-    CUDA_TRY(cudaDeviceGetAttribute(&cc_minor, cudaDevAttrComputeCapabilityMinor, device));
-    int cc = cc_major * 10 + cc_minor;
-
-    kernel_cache_path /= std::to_string(cc);
+    kernel_cache_path /= std::to_string(compute_capability);
 
     try {
       // `mkdir -p` the kernel cache path if it doesn't exist
@@ -95,10 +89,32 @@ std::filesystem::path get_cache_dir()
   return kernel_cache_path;
 }
 
+int get_compute_capability()
+{
+  int device;
+  int cc_major;
+  int cc_minor;
+  CUDA_TRY(cudaGetDevice(&device));
+  CUDA_TRY(cudaDeviceGetAttribute(&cc_major, cudaDevAttrComputeCapabilityMajor, device));
+  CUDA_TRY(cudaDeviceGetAttribute(&cc_minor, cudaDevAttrComputeCapabilityMinor, device));
+  return cc_major * 10 + cc_minor;
+}
+
+/**
+ * @brief Get the string path to the JITIFY kernel cache directory of the current device.
+ *
+ * Resolving the directory reads the environment and creates the directory, so it is only done
+ * for the first program compiled for a compute capability rather than for every program. Must be
+ * called with the program caches lock held.
+ */
 std::string get_program_cache_dir()
 {
 #if defined(JITIFY_USE_CACHE)
-  return get_cache_dir().string();
+  static std::unordered_map<int, std::string> cache_dirs{};
+  auto const cc = get_compute_capability();
+  auto dir      = cache_dirs.find(cc);
+  if (dir == cache_dirs.end()) { dir = cache_dirs.insert({cc, get_cache_dir(cc).string()}).first; }
+  return dir->second;
 #else
   return {};
 #endif
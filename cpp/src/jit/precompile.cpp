@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/jit/precompile.hpp>
+#include <cudf/utilities/error.hpp>
+
+namespace cudf {
+namespace jit {
+
+void precompile(std::vector<kernel_signature> const& kernels)
+{
+  CUDF_FUNC_RANGE();
+  for (auto const& kernel : kernels) {
+    switch (kernel.kind) {
+      case kernel_kind::TRANSFORM:
+        CUDF_EXPECTS(kernel.input_types.size() == 1, "A transform has one input type.");
+        detail::precompile_transform(
+          kernel.udf, kernel.input_types[0], kernel.output_type, kernel.is_ptx);
+        break;
+      case kernel_kind::BINARY_OPERATION:
+        CUDF_EXPECTS(kernel.input_types.size() == 2, "A binary operation has two input types.");
+        CUDF_EXPECTS(kernel.is_ptx, "A binary operation only compiles PTX code.");
+        detail::precompile_binary_operation(
+          kernel.udf, kernel.input_types[0], kernel.input_types[1], kernel.output_type);
+        break;
+      default: CUDF_FAIL("Unsupported kernel kind.");
+    }
+  }
+}
+
+}  // namespace jit
+}  // namespace cudf
@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <join/conditional_join.hpp>
+#include <join/conditional_join_kernels.cuh>
+#include <join/join_common_utils.hpp>
+
+#include <cudf/ast/detail/expression_parser.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/uninitialized_fill.h>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Bound of a banded column by a column of the other table.
+ */
+struct band_bound {
+  size_type column_index;  // Column of the other table
+  bool inclusive;          // Whether rows equal to the bound are within the band
+};
+
+/**
+ * @brief Column of one table whose rows matching a row of the other table lie between two
+ * columns of that row.
+ */
+struct band_condition {
+  ast::table_reference banded_table;
+  size_type banded_column;
+  band_bound lower;
+  band_bound upper;
+  bool covers_predicate;  // Whether the predicate is only made of the two bounds
+};
+
+/**
+ * @brief Appends the conjuncts of the top level conjunction of an expression.
+ */
+void collect_conjuncts(ast::expression const& expr, std::vector<ast::expression const*>& conjuncts)
+{
+  auto const op = dynamic_cast<ast::operation const*>(&expr);
+  if (op != nullptr and (op->get_operator() == ast::ast_operator::LOGICAL_AND or
+                         op->get_operator() == ast::ast_operator::NULL_LOGICAL_AND)) {
+    for (auto const& operand : op->get_operands()) {
+      collect_conjuncts(operand.get(), conjuncts);
+    }
+  } else {
+    conjuncts.push_back(&expr);
+  }
+}
+
+/**
+ * @brief Finds a column of either table bounded from below and above by columns of the other
+ * table in the conjuncts of the predicate, e.g. `l.ts >= r.start AND l.ts <= r.end`.
+ *
+ * When several columns qualify, the column of the smaller table is banded, which is the table that
+ * gets sorted.
+ */
+std::optional<band_condition> find_band_condition(ast::expression const& predicate,
+                                                  table_view const& left,
+                                                  table_view const& right)
+{
+  std::vector<ast::expression const*> conjuncts;
+  collect_conjuncts(predicate, conjuncts);
+
+  using column_key = std::pair<ast::table_reference, size_type>;
+  std::map<column_key, std::pair<std::optional<band_bound>, std::optional<band_bound>>> bounds;
+  auto const table_of = [&](ast::table_reference ref) -> table_view const& {
+    return ref == ast::table_reference::LEFT ? left : right;
+  };
+
+  for (auto const conjunct : conjuncts) {
+    auto const op = dynamic_cast<ast::operation const*>(conjunct);
+    if (op == nullptr) { continue; }
+    auto const oper = op->get_operator();
+    auto const is_less =
+      oper == ast::ast_operator::LESS or oper == ast::ast_operator::LESS_EQUAL;
+    auto const is_greater =
+      oper == ast::ast_operator::GREATER or oper == ast::ast_operator::GREATER_EQUAL;
+    if (not is_less and not is_greater) { continue; }
+
+    auto const operands = op->get_operands();
+    auto const lhs      = dynamic_cast<ast::column_reference const*>(&operands[0].get());
+    auto const rhs      = dynamic_cast<ast::column_reference const*>(&operands[1].get());
+    if (lhs == nullptr or rhs == nullptr) { continue; }
+    auto const lhs_table = lhs->get_table_source();
+    auto const rhs_table = rhs->get_table_source();
+    if (lhs_table == rhs_table or lhs_table == ast::table_reference::OUTPUT or
+        rhs_table == ast::table_reference::OUTPUT) {
+      continue;
+    }
+    if (lhs->get_column_index() >= table_of(lhs_table).num_columns() or
+        rhs->get_column_index() >= table_of(rhs_table).num_columns()) {
+      continue;
+    }
+
+    // `lhs < rhs` bounds `lhs` from above by `rhs` and `rhs` from below by `lhs`
+    auto const inclusive =
+      oper == ast::ast_operator::LESS_EQUAL or oper == ast::ast_operator::GREATER_EQUAL;
+    auto& lhs_bounds = bounds[{lhs_table, lhs->get_column_index()}];
+    auto& rhs_bounds = bounds[{rhs_table, rhs->get_column_index()}];
+    auto& lhs_bound  = is_less ? lhs_bounds.second : lhs_bounds.first;
+    auto& rhs_bound  = is_less ? rhs_bounds.first : rhs_bounds.second;
+    if (not lhs_bound.has_value()) { lhs_bound = band_bound{rhs->get_column_index(), inclusive}; }
+    if (not rhs_bound.has_value()) { rhs_bound = band_bound{lhs->get_column_index(), inclusive}; }
+  }
+
+  std::optional<band_condition> band;
+  for (auto const& [key, column_bounds] : bounds) {
+    auto const& [lower, upper] = column_bounds;
+    if (not lower.has_value() or not upper.has_value()) { continue; }
+
+    // The binary searches compare the banded column with the bounds, so all must be the same type
+    auto const& banded  = table_of(key.first);
+    auto const& other   = table_of(key.first == ast::table_reference::LEFT
+                                     ? ast::table_reference::RIGHT
+                                     : ast::table_reference::LEFT);
+    auto const type     = banded.column(key.second).type();
+    auto const has_type = [&](size_type i) { return other.column(i).type() == type; };
+    if (not is_fixed_width(type) or not has_type(lower->column_index) or
+        not has_type(upper->column_index)) {
+      continue;
+    }
+
+    if (not band.has_value() or banded.num_rows() < table_of(band->banded_table).num_rows()) {
+      band = band_condition{key.first, key.second, *lower, *upper, conjuncts.size() == 2};
+    }
+  }
+  return band;
+}
+
+/**
+ * @brief Device functor returning the number of banded rows within the band of each row of the
+ * other table.
+ */
+struct band_candidate_count {
+  size_type const* begin;         // First sorted banded row within the band of each row
+  size_type const* end;           // One past the last sorted banded row within the band
+  size_type null_count;           // Number of null banded rows, which are sorted first
+  bitmask_type const* row_valid;  // Rows whose bounds are both valid, or null if all are
+
+  __device__ size_type first(size_type i) const noexcept { return max(begin[i], null_count); }
+
+  __device__ std::size_t operator()(size_type i) const noexcept
+  {
+    if (row_valid != nullptr and not bit_is_set(row_valid, i)) { return 0; }
+    auto const first_row = first(i);
+    return end[i] > first_row ? end[i] - first_row : 0;
+  }
+};
+
+/**
+ * @brief Device functor returning the banded row of each candidate pair.
+ */
+struct band_candidate_row {
+  band_candidate_count count;
+  std::size_t const* offsets;  // First candidate pair of each row of the other table
+  size_type const* order;      // Banded row of each sorted banded row
+
+  __device__ size_type operator()(std::size_t p, size_type i) const noexcept
+  {
+    return order[count.first(i) + (p - offsets[i])];
+  }
+};
+
+}  // namespace
+
+std::optional<std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                        std::unique_ptr<rmm::device_uvector<size_type>>>>
+conditional_band_inner_join(table_view const& left,
+                            table_view const& right,
+                            ast::expression const& binary_predicate,
+                            rmm::cuda_stream_view stream,
+                            rmm::mr::device_memory_resource* mr)
+{
+  auto const band = find_band_condition(binary_predicate, left, right);
+  if (not band.has_value()) { return std::nullopt; }
+
+  auto const has_nulls = binary_predicate.may_evaluate_null(left, right, stream);
+  auto const parser =
+    ast::detail::expression_parser{binary_predicate, left, right, has_nulls, stream, mr};
+  CUDF_EXPECTS(parser.output_type().id() == type_id::BOOL8,
+               "The expression must produce a boolean output.");
+
+  auto const banded_is_left = band->banded_table == ast::table_reference::LEFT;
+  auto const& banded        = banded_is_left ? left : right;
+  auto const& other         = banded_is_left ? right : left;
+  auto const other_num_rows = other.num_rows();
+
+  // Sort the banded column, with the nulls first, and find the range of sorted rows within the
+  // band of each row of the other table
+  auto const banded_column = table_view{{banded.column(band->banded_column)}};
+  std::vector<order> const column_order{order::ASCENDING};
+  std::vector<null_order> const null_precedence{null_order::BEFORE};
+  auto const sorted_order =
+    detail::sorted_order(banded_column, column_order, null_precedence, stream);
+  auto const sorted = detail::gather(banded_column,
+                                     sorted_order->view(),
+                                     out_of_bounds_policy::DONT_CHECK,
+                                     negative_index_policy::NOT_ALLOWED,
+                                     stream);
+
+  auto const lower_values = table_view{{other.column(band->lower.column_index)}};
+  auto const upper_values = table_view{{other.column(band->upper.column_index)}};
+  auto const begin =
+    band->lower.inclusive
+      ? detail::lower_bound(sorted->view(), lower_values, column_order, null_precedence, stream)
+      : detail::upper_bound(sorted->view(), lower_values, column_order, null_precedence, stream);
+  auto const end =
+    band->upper.inclusive
+      ? detail::upper_bound(sorted->view(), upper_values, column_order, null_precedence, stream)
+      : detail::lower_bound(sorted->view(), upper_values, column_order, null_precedence, stream);
+
+  // Rows with a null bound match nothing
+  auto const row_bitmask =
+    detail::bitmask_and(table_view{{lower_values.column(0), upper_values.column(0)}}, stream).first;
+  band_candidate_count const count{begin->view().data<size_type>(),
+                                   end->view().data<size_type>(),
+                                   sorted->get_column(0).null_count(),
+                                   static_cast<bitmask_type const*>(row_bitmask.data())};
+  rmm::device_uvector<std::size_t> offsets(other_num_rows + 1, stream);
+  offsets.set_element_to_zero_async(0, stream);
+  auto const counts = cudf::detail::make_counting_transform_iterator(0, count);
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), counts, counts + other_num_rows, offsets.begin() + 1);
+  auto const num_candidates = offsets.back_element(stream);
+
+  // The band conditions select exactly the matching pairs unless the predicate has other
+  // conditions, or floating point bounds, which the searches order differently for NaN
+  auto const filter =
+    not band->covers_predicate or is_floating_point(banded_column.column(0).type());
+  auto const candidate_mr = filter ? rmm::mr::get_current_device_resource() : mr;
+
+  auto other_indices =
+    std::make_unique<rmm::device_uvector<size_type>>(num_candidates, stream, candidate_mr);
+  auto banded_indices =
+    std::make_unique<rmm::device_uvector<size_type>>(num_candidates, stream, candidate_mr);
+  if (num_candidates > 0) {
+    // Mark the first candidate of each row of the other table with its index, and extend it to
+    // the following candidates of the same row
+    thrust::uninitialized_fill(
+      rmm::exec_policy(stream), other_indices->begin(), other_indices->end(), 0);
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       other_num_rows,
+                       [count, offsets = offsets.data(), out = other_indices->data()] __device__(
+                         size_type i) {
+                         if (count(i) > 0) { out[offsets[i]] = i; }
+                       });
+    thrust::inclusive_scan(rmm::exec_policy(stream),
+                           other_indices->begin(),
+                           other_indices->end(),
+                           other_indices->begin(),
+                           thrust::maximum<size_type>{});
+
+    thrust::transform(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<std::size_t>(0),
+      thrust::make_counting_iterator<std::size_t>(num_candidates),
+      other_indices->begin(),
+      banded_indices->begin(),
+      band_candidate_row{count, offsets.data(), sorted_order->view().data<size_type>()});
+  }
+
+  auto& left_candidates  = banded_is_left ? banded_indices : other_indices;
+  auto& right_candidates = banded_is_left ? other_indices : banded_indices;
+  if (not filter or num_candidates == 0) {
+    return std::make_pair(std::move(left_candidates), std::move(right_candidates));
+  }
+
+  // Evaluate the whole predicate on the candidate pairs and keep the pairs it is true for
+  auto left_table  = table_device_view::create(left, stream);
+  auto right_table = table_device_view::create(right, stream);
+  rmm::device_uvector<bool> matches(num_candidates, stream);
+  detail::grid_1d const config(
+    static_cast<size_type>(
+      std::min<std::size_t>(num_candidates, std::numeric_limits<size_type>::max())),
+    DEFAULT_JOIN_BLOCK_SIZE);
+  auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
+  if (has_nulls) {
+    evaluate_conditional_join_pairs<DEFAULT_JOIN_BLOCK_SIZE, true>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+        *left_table,
+        *right_table,
+        parser.device_expression_data,
+        left_candidates->data(),
+        right_candidates->data(),
+        num_candidates,
+        matches.data());
+  } else {
+    evaluate_conditional_join_pairs<DEFAULT_JOIN_BLOCK_SIZE, false>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+        *left_table,
+        *right_table,
+        parser.device_expression_data,
+        left_candidates->data(),
+        right_candidates->data(),
+        num_candidates,
+        matches.data());
+  }
+
+  auto const join_size = static_cast<std::size_t>(
+    thrust::count(rmm::exec_policy(stream), matches.begin(), matches.end(), true));
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  auto const candidates = thrust::make_zip_iterator(
+    thrust::make_tuple(left_candidates->begin(), right_candidates->begin()));
+  thrust::copy_if(rmm::exec_policy(stream),
+                  candidates,
+                  candidates + num_candidates,
+                  matches.begin(),
+                  thrust::make_zip_iterator(
+                    thrust::make_tuple(left_indices->begin(), right_indices->begin())),
+                  thrust::identity<bool>{});
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -81,6 +81,13 @@ conditional_join(table_view const& left,
     }
   }
 
+  // Inner joins on a band condition only evaluate the pairs within the band,
+  // which does not need the output size.
+  if (join_type == join_kind::INNER_JOIN) {
+    auto band_join = conditional_band_inner_join(left, right, binary_predicate, stream, mr);
+    if (band_join.has_value()) { return std::move(*band_join); }
+  }
+
   // If evaluating the expression may produce null outputs we create a nullable
   // output column and follow the null-supporting expression evaluation code
   // path.
@@ -232,6 +239,13 @@ std::size_t compute_conditional_join_output_size(table_view const& left,
     }
   }
 
+  // The band join finds the matching pairs faster than the nested loop
+  // kernel counts them.
+  if (join_type == join_kind::INNER_JOIN) {
+    auto const band_join = conditional_band_inner_join(left, right, binary_predicate, stream, mr);
+    if (band_join.has_value()) { return band_join->first->size(); }
+  }
+
   // Prepare output column. Whether or not the output column is nullable is
   // determined by whether any of the columns in the input table are nullable.
   // If none of the input columns actually contain nulls, we can still use the
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -70,5 +70,30 @@ std::size_t compute_conditional_join_output_size(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes an inner join whose predicate bounds a column of one table from below and above
+ * by columns of the other table, e.g. `l.ts >= r.start AND l.ts <= r.end`.
+ *
+ * The banded column is sorted and the rows within the band of each row of the other table are
+ * found with binary searches, so that only these candidate pairs, rather than all pairs of rows,
+ * are evaluated against the rest of the predicate.
+ *
+ * @param left  Table of left columns to join
+ * @param right Table of right columns to join
+ * @param binary_predicate The condition on which to join
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return Join output indices vector pair, or nothing if the predicate has no band condition
+ */
+std::optional<std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                        std::unique_ptr<rmm::device_uvector<size_type>>>>
+conditional_band_inner_join(
+  table_view const& left,
+  table_view const& right,
+  ast::expression const& binary_predicate,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace detail
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -258,6 +258,57 @@ __global__ void conditional_join(table_device_view left_table,
   }
 }
 
+/**
+ * @brief Evaluates a join predicate for the given pairs of rows of the left and right tables.
+ *
+ * Used to filter the candidate pairs of a join whose candidates were found without evaluating the
+ * predicate, e.g. from the band conditions of the predicate.
+ *
+ * @tparam block_size The number of threads per block for this kernel
+ * @tparam has_nulls Whether or not the inputs may contain nulls.
+ *
+ * @param[in] left_table The left table
+ * @param[in] right_table The right table
+ * @param[in] device_expression_data Container of device data required to evaluate the desired
+ * expression.
+ * @param[in] left_indices The left row of each pair
+ * @param[in] right_indices The right row of each pair
+ * @param[in] num_pairs The number of pairs
+ * @param[out] matches Whether the predicate is true for each pair
+ */
+template <int block_size, bool has_nulls>
+__global__ void evaluate_conditional_join_pairs(
+  table_device_view left_table,
+  table_device_view right_table,
+  ast::detail::expression_device_view device_expression_data,
+  cudf::size_type const* left_indices,
+  cudf::size_type const* right_indices,
+  std::size_t num_pairs,
+  bool* matches)
+{
+  extern __shared__ char raw_intermediate_storage[];
+  cudf::ast::detail::IntermediateDataType<has_nulls>* intermediate_storage =
+    reinterpret_cast<cudf::ast::detail::IntermediateDataType<has_nulls>*>(raw_intermediate_storage);
+  auto thread_intermediate_storage =
+    &intermediate_storage[threadIdx.x * device_expression_data.num_intermediates];
+
+  auto evaluator = cudf::ast::detail::expression_evaluator<has_nulls>(
+    left_table, right_table, device_expression_data);
+
+  std::size_t const stride = static_cast<std::size_t>(block_size) * gridDim.x;
+  for (std::size_t pair_index = threadIdx.x + static_cast<std::size_t>(blockIdx.x) * block_size;
+       pair_index < num_pairs;
+       pair_index += stride) {
+    auto output_dest = cudf::ast::detail::value_expression_result<bool, has_nulls>();
+    evaluator.evaluate(output_dest,
+                       left_indices[pair_index],
+                       right_indices[pair_index],
+                       0,
+                       thread_intermediate_storage);
+    matches[pair_index] = output_dest.is_valid() && output_dest.value();
+  }
+}
+
 }  // namespace detail
 
 }  // namespace cudf
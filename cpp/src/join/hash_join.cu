@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -44,7 +44,9 @@ std::pair<std::unique_ptr<table>, std::unique_ptr<table>> get_empty_joined_table
 /**
  * @brief Probes the `hash_table` built from `build_table` for tuples in `probe_table`,
  * and returns the output indices of `build_table` and `probe_table` as a combined table.
- * Behavior is undefined if the provided `output_size` is smaller than the actual output size.
+ * Behavior is undefined if the provided `output_size` is smaller than the actual output size. For
+ * inner joins, `output_size` may be larger than the actual output size, which the output is then
+ * trimmed to.
  *
  * @tparam JoinKind The type of join to be performed.
  *
@@ -116,8 +118,20 @@ probe_join_hash_table(cudf::table_device_view build_table,
       right_indices->resize(actual_size, stream);
     }
   } else {
-    hash_table.pair_retrieve(
+    auto [out1_zip_end, out2_zip_end] = hash_table.pair_retrieve(
       iter, iter + probe_table_num_rows, out1_zip_begin, out2_zip_begin, equality, stream.value());
+
+    // The output size may be an upper bound, computed from the multiplicity of the build keys
+    auto const actual_size = static_cast<std::size_t>(out1_zip_end - out1_zip_begin);
+    if (actual_size < join_size) {
+      left_indices->resize(actual_size, stream);
+      right_indices->resize(actual_size, stream);
+      // Release the unused memory when the bound was far off
+      if (actual_size < join_size / 2) {
+        left_indices->shrink_to_fit(stream);
+        right_indices->shrink_to_fit(stream);
+      }
+    }
   }
   return std::make_pair(std::move(left_indices), std::move(right_indices));
 }
@@ -236,7 +250,7 @@ hash_join::hash_join_impl::hash_join_impl(cudf::table_view const& build,
                                           rmm::cuda_stream_view stream)
   : _is_empty{build.num_rows() == 0},
     _hash_table{compute_hash_table_size(build.num_rows()),
-                std::numeric_limits<hash_value_type>::max(),
+                std::numeric_limits<join_hash_value_type>::max(),
                 cudf::detail::JoinNoneValue,
                 stream.value(),
                 detail::hash_table_allocator_type{default_allocator<char>{}, stream}}
@@ -329,6 +343,9 @@ std::size_t hash_join::hash_join_impl::left_join_size(cudf::table_view const& pr
   // Trivial left join case - exit early
   if (_is_empty) { return probe.num_rows(); }
 
+  // Each probe row is in the output exactly once when it matches at most one build row
+  if (has_unique_keys(stream)) { return probe.num_rows(); }
+
   auto flattened_probe = structs::detail::flatten_nested_columns(
     probe, {}, {}, structs::detail::column_nullability::FORCE);
   auto const flattened_probe_table = flattened_probe.flattened_columns();
@@ -423,6 +440,12 @@ hash_join::hash_join_impl::probe_join_indices(cudf::table_view const& probe,
 
   CUDF_EXPECTS(!_is_empty, "Hash table of hash join is null.");
 
+  // Each probe row has at most one match, so the number of probe rows bounds the size of an inner
+  // join and is the exact size of a left join, or of the left join part of a full join
+  if (not output_size.has_value() and has_unique_keys(stream)) {
+    output_size = static_cast<std::size_t>(probe.num_rows());
+  }
+
   auto build_table_ptr = cudf::table_device_view::create(_build, stream);
   auto probe_table_ptr = cudf::table_device_view::create(probe, stream);
 
@@ -444,4 +467,27 @@ hash_join::hash_join_impl::probe_join_indices(cudf::table_view const& probe,
   return join_indices;
 }
 
+bool hash_join::hash_join_impl::has_unique_keys(rmm::cuda_stream_view stream) const
+{
+  // The check costs about as much as the counting pass of a probe, so it only pays off for a hash
+  // join probed several times. The one-shot joins, which probe their hash join once, skip it.
+  if (_num_unsized_probes.fetch_add(1) == 0) { return false; }
+  std::call_once(_unique_keys_flag, [&]() {
+    // In a left join of the build table with itself, every row is in the output at least once,
+    // and exactly once if no other row has equal keys. Rows with nulls compare equal here, as
+    // they do when the hash table is probed with `null_equality::EQUAL`.
+    auto build_table_ptr = cudf::table_device_view::create(_build, stream);
+    auto const self_join_size =
+      cudf::detail::compute_join_output_size<cudf::detail::join_kind::LEFT_JOIN>(
+        *build_table_ptr,
+        *build_table_ptr,
+        _hash_table,
+        cudf::has_nulls(_build),
+        null_equality::EQUAL,
+        stream);
+    _has_unique_keys = self_join_size == static_cast<std::size_t>(_build.num_rows());
+  });
+  return _has_unique_keys;
+}
+
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -34,8 +34,10 @@
 
 #include <thrust/sequence.h>
 
+#include <atomic>
 #include <cstddef>
 #include <limits>
+#include <mutex>
 
 namespace cudf {
 namespace detail {
@@ -59,7 +61,7 @@ constexpr auto remap_sentinel_hash(H hash, S sentinel)
 class make_pair_function {
  public:
   CUDF_HOST_DEVICE make_pair_function(row_hash const& hash,
-                                      hash_value_type const empty_key_sentinel)
+                                      join_hash_value_type const empty_key_sentinel)
     : _hash{hash}, _empty_key_sentinel{empty_key_sentinel}
   {
   }
@@ -68,12 +70,13 @@ class make_pair_function {
   {
     // Compute the hash value of row `i`
     auto row_hash_value = remap_sentinel_hash(_hash(i), _empty_key_sentinel);
-    return cuco::make_pair<hash_value_type, size_type>(std::move(row_hash_value), std::move(i));
+    return cuco::make_pair<join_hash_value_type, size_type>(std::move(row_hash_value),
+                                                            std::move(i));
   }
 
  private:
   row_hash _hash;
-  hash_value_type const _empty_key_sentinel;
+  join_hash_value_type const _empty_key_sentinel;
 };
 
 /**
@@ -145,6 +148,30 @@ std::pair<std::unique_ptr<table>, std::unique_ptr<table>> get_empty_joined_table
 std::unique_ptr<cudf::table> combine_table_pair(std::unique_ptr<cudf::table>&& left,
                                                 std::unique_ptr<cudf::table>&& right);
 
+/**
+ * @brief Gathers the columns of both tables of a join into the joined table.
+ *
+ * The fixed-width columns of both tables are gathered by a single kernel, which reads the gather
+ * maps once for all of them; the other columns are gathered with `gather`.
+ *
+ * @param left The left columns to gather
+ * @param right The right columns to gather
+ * @param left_indices The row of `left` of each output row
+ * @param right_indices The row of `right` of each output row
+ * @param bounds_policy Whether out-of-bounds indices are gathered as nulls
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @return The gathered columns of `left`, followed by the gathered columns of `right`
+ */
+std::unique_ptr<cudf::table> gather_join_columns(table_view const& left,
+                                                 table_view const& right,
+                                                 device_span<size_type const> left_indices,
+                                                 device_span<size_type const> right_indices,
+                                                 out_of_bounds_policy bounds_policy,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr);
+
 /**
  * @brief Builds the hash table based on the given `build_table`.
  *
@@ -202,6 +229,11 @@ struct hash_join::hash_join_impl {
   std::vector<std::unique_ptr<cudf::column>> _created_null_columns;
   cudf::structs::detail::flattened_table _flattened_build_table;
   cudf::detail::multimap_type _hash_table;
+  // Number of probes without an output size, the first of which does not check for unique keys
+  mutable std::atomic<std::size_t> _num_unsized_probes{0};
+  // Whether no two rows of `_build` have equal keys, computed by the second probe that needs it
+  mutable std::once_flag _unique_keys_flag;
+  mutable bool _has_unique_keys = false;
 
  public:
   /**
@@ -291,6 +323,17 @@ struct hash_join::hash_join_impl {
                      std::optional<std::size_t> output_size,
                      rmm::cuda_stream_view stream,
                      rmm::mr::device_memory_resource* mr) const;
+
+  /**
+   * @brief Returns whether each probe row matches at most one row of the build table.
+   *
+   * The first call returns false without checking, so that a hash join probed once does not pay
+   * for the check. The second call probes the hash table with the build table itself; the result
+   * is kept for the later probes, which then size their output without a counting pass.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  [[nodiscard]] bool has_unique_keys(rmm::cuda_stream_view stream) const;
 };
 
 }  // namespace cudf
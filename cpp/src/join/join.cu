@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,7 +16,8 @@
 #include <join/hash_join.cuh>
 #include <join/join_common_utils.hpp>
 
-#include <cudf/detail/gather.cuh>
+#include <cudf/detail/utilities/temporary_arena.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/join.hpp>
 #include <cudf/table/table.hpp>
@@ -42,9 +43,9 @@ inner_join(table_view const& left_input,
     stream,
     rmm::mr::get_current_device_resource());  // temporary objects returned
 
-  // now rebuild the table views with the updated ones
-  auto const left  = matched.second.front();
-  auto const right = matched.second.back();
+  // now rebuild the table views with the updated ones, joining the dictionaries by their indices
+  auto const left  = cudf::dictionary::detail::indices_view(matched.second.front());
+  auto const right = cudf::dictionary::detail::indices_view(matched.second.back());
 
   // For `inner_join`, we can freely choose either the `left` or `right` table to use for
   // building/probing the hash map. Because building is typically more expensive than probing, we
@@ -78,20 +79,17 @@ std::unique_ptr<table> inner_join(table_view const& left_input,
   auto const left  = scatter_columns(matched.second.front(), left_on, left_input);
   auto const right = scatter_columns(matched.second.back(), right_on, right_input);
 
-  auto join_indices = inner_join(left.select(left_on), right.select(right_on), compare_nulls, mr);
-  std::unique_ptr<table> left_result  = detail::gather(left,
-                                                      join_indices.first->begin(),
-                                                      join_indices.first->end(),
-                                                      out_of_bounds_policy::DONT_CHECK,
-                                                      stream,
-                                                      mr);
-  std::unique_ptr<table> right_result = detail::gather(right,
-                                                       join_indices.second->begin(),
-                                                       join_indices.second->end(),
-                                                       out_of_bounds_policy::DONT_CHECK,
-                                                       stream,
-                                                       mr);
-  return combine_table_pair(std::move(left_result), std::move(right_result));
+  // The join indices are only needed to gather the joined columns
+  temporary_arena temp_mr{stream};
+  auto join_indices =
+    inner_join(left.select(left_on), right.select(right_on), compare_nulls, stream, &temp_mr);
+  return gather_join_columns(left,
+                             right,
+                             *join_indices.first,
+                             *join_indices.second,
+                             out_of_bounds_policy::DONT_CHECK,
+                             stream,
+                             mr);
 }
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
@@ -108,9 +106,9 @@ left_join(table_view const& left_input,
     {left_input, right_input},  // these should match
     stream,
     rmm::mr::get_current_device_resource());  // temporary objects returned
-  // now rebuild the table views with the updated ones
-  table_view const left  = matched.second.front();
-  table_view const right = matched.second.back();
+  // now rebuild the table views with the updated ones, joining the dictionaries by their indices
+  table_view const left  = cudf::dictionary::detail::indices_view(matched.second.front());
+  table_view const right = cudf::dictionary::detail::indices_view(matched.second.back());
 
   cudf::hash_join hj_obj(right, compare_nulls, stream);
   return hj_obj.left_join(left, compare_nulls, std::nullopt, stream, mr);
@@ -134,7 +132,10 @@ std::unique_ptr<table> left_join(table_view const& left_input,
   table_view const left  = scatter_columns(matched.second.front(), left_on, left_input);
   table_view const right = scatter_columns(matched.second.back(), right_on, right_input);
 
-  auto join_indices = left_join(left.select(left_on), right.select(right_on), compare_nulls);
+  // The join indices are only needed to gather the joined columns
+  temporary_arena temp_mr{stream};
+  auto join_indices =
+    left_join(left.select(left_on), right.select(right_on), compare_nulls, stream, &temp_mr);
 
   if ((left_on.empty() || right_on.empty()) ||
       is_trivial_join(left, right, cudf::detail::join_kind::LEFT_JOIN)) {
@@ -142,19 +143,13 @@ std::unique_ptr<table> left_join(table_view const& left_input,
     return cudf::detail::combine_table_pair(std::move(probe_build_pair.first),
                                             std::move(probe_build_pair.second));
   }
-  std::unique_ptr<table> left_result  = detail::gather(left,
-                                                      join_indices.first->begin(),
-                                                      join_indices.first->end(),
-                                                      out_of_bounds_policy::NULLIFY,
-                                                      stream,
-                                                      mr);
-  std::unique_ptr<table> right_result = detail::gather(right,
-                                                       join_indices.second->begin(),
-                                                       join_indices.second->end(),
-                                                       out_of_bounds_policy::NULLIFY,
-                                                       stream,
-                                                       mr);
-  return combine_table_pair(std::move(left_result), std::move(right_result));
+  return gather_join_columns(left,
+                             right,
+                             *join_indices.first,
+                             *join_indices.second,
+                             out_of_bounds_policy::NULLIFY,
+                             stream,
+                             mr);
 }
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
@@ -171,9 +166,9 @@ full_join(table_view const& left_input,
     {left_input, right_input},  // these should match
     stream,
     rmm::mr::get_current_device_resource());  // temporary objects returned
-  // now rebuild the table views with the updated ones
-  table_view const left  = matched.second.front();
-  table_view const right = matched.second.back();
+  // now rebuild the table views with the updated ones, joining the dictionaries by their indices
+  table_view const left  = cudf::dictionary::detail::indices_view(matched.second.front());
+  table_view const right = cudf::dictionary::detail::indices_view(matched.second.back());
 
   cudf::hash_join hj_obj(right, compare_nulls, stream);
   return hj_obj.full_join(left, compare_nulls, std::nullopt, stream, mr);
@@ -197,7 +192,10 @@ std::unique_ptr<table> full_join(table_view const& left_input,
   table_view const left  = scatter_columns(matched.second.front(), left_on, left_input);
   table_view const right = scatter_columns(matched.second.back(), right_on, right_input);
 
-  auto join_indices = full_join(left.select(left_on), right.select(right_on), compare_nulls);
+  // The join indices are only needed to gather the joined columns
+  temporary_arena temp_mr{stream};
+  auto join_indices =
+    full_join(left.select(left_on), right.select(right_on), compare_nulls, stream, &temp_mr);
 
   if ((left_on.empty() || right_on.empty()) ||
       is_trivial_join(left, right, cudf::detail::join_kind::FULL_JOIN)) {
@@ -205,19 +203,38 @@ std::unique_ptr<table> full_join(table_view const& left_input,
     return cudf::detail::combine_table_pair(std::move(probe_build_pair.first),
                                             std::move(probe_build_pair.second));
   }
-  std::unique_ptr<table> left_result  = detail::gather(left,
-                                                      join_indices.first->begin(),
-                                                      join_indices.first->end(),
-                                                      out_of_bounds_policy::NULLIFY,
-                                                      stream,
-                                                      mr);
-  std::unique_ptr<table> right_result = detail::gather(right,
-                                                       join_indices.second->begin(),
-                                                       join_indices.second->end(),
-                                                       out_of_bounds_policy::NULLIFY,
-                                                       stream,
-                                                       mr);
-  return combine_table_pair(std::move(left_result), std::move(right_result));
+  return gather_join_columns(left,
+                             right,
+                             *join_indices.first,
+                             *join_indices.second,
+                             out_of_bounds_policy::NULLIFY,
+                             stream,
+                             mr);
+}
+
+join_result lazy_join(join_kind kind,
+                      table_view const& left,
+                      table_view const& right,
+                      std::vector<size_type> const& left_on,
+                      std::vector<size_type> const& right_on,
+                      null_equality compare_nulls,
+                      rmm::cuda_stream_view stream,
+                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(left_on.size() == right_on.size(), "Mismatch in number of columns to be joined on");
+  auto const left_keys  = left.select(left_on);
+  auto const right_keys = right.select(right_on);
+  auto join_indices =
+    kind == join_kind::INNER_JOIN
+      ? inner_join(left_keys, right_keys, compare_nulls, stream, mr)
+      : kind == join_kind::LEFT_JOIN ? left_join(left_keys, right_keys, compare_nulls, stream, mr)
+                                     : full_join(left_keys, right_keys, compare_nulls, stream, mr);
+
+  // The rows of the outer joins without a match are gathered as nulls
+  auto const bounds_policy = kind == join_kind::INNER_JOIN ? out_of_bounds_policy::DONT_CHECK
+                                                           : out_of_bounds_policy::NULLIFY;
+  return join_result{
+    left, right, std::move(join_indices.first), std::move(join_indices.second), bounds_policy};
 }
 
 }  // namespace detail
@@ -293,10 +310,11 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
 inner_join(table_view const& left,
            table_view const& right,
            null_equality compare_nulls,
+           rmm::cuda_stream_view stream,
            rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::inner_join(left, right, compare_nulls, rmm::cuda_stream_default, mr);
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(left, stream);
+  return detail::inner_join(left, right, compare_nulls, stream, mr);
 }
 
 std::unique_ptr<table> inner_join(table_view const& left,
@@ -304,11 +322,11 @@ std::unique_ptr<table> inner_join(table_view const& left,
                                   std::vector<size_type> const& left_on,
                                   std::vector<size_type> const& right_on,
                                   null_equality compare_nulls,
+                                  rmm::cuda_stream_view stream,
                                   rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::inner_join(
-    left, right, left_on, right_on, compare_nulls, rmm::cuda_stream_default, mr);
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(left, stream);
+  return detail::inner_join(left, right, left_on, right_on, compare_nulls, stream, mr);
 }
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
@@ -316,10 +334,11 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
 left_join(table_view const& left,
           table_view const& right,
           null_equality compare_nulls,
+          rmm::cuda_stream_view stream,
           rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::left_join(left, right, compare_nulls, rmm::cuda_stream_default, mr);
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(left, stream);
+  return detail::left_join(left, right, compare_nulls, stream, mr);
 }
 
 std::unique_ptr<table> left_join(table_view const& left,
@@ -327,11 +346,11 @@ std::unique_ptr<table> left_join(table_view const& left,
                                  std::vector<size_type> const& left_on,
                                  std::vector<size_type> const& right_on,
                                  null_equality compare_nulls,
+                                 rmm::cuda_stream_view stream,
                                  rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::left_join(
-    left, right, left_on, right_on, compare_nulls, rmm::cuda_stream_default, mr);
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(left, stream);
+  return detail::left_join(left, right, left_on, right_on, compare_nulls, stream, mr);
 }
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
@@ -339,10 +358,11 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
 full_join(table_view const& left,
           table_view const& right,
           null_equality compare_nulls,
+          rmm::cuda_stream_view stream,
           rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::full_join(left, right, compare_nulls, rmm::cuda_stream_default, mr);
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(left, stream);
+  return detail::full_join(left, right, compare_nulls, stream, mr);
 }
 
 std::unique_ptr<table> full_join(table_view const& left,
@@ -350,11 +370,50 @@ std::unique_ptr<table> full_join(table_view const& left,
                                  std::vector<size_type> const& left_on,
                                  std::vector<size_type> const& right_on,
                                  null_equality compare_nulls,
+                                 rmm::cuda_stream_view stream,
                                  rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::full_join(
-    left, right, left_on, right_on, compare_nulls, rmm::cuda_stream_default, mr);
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(left, stream);
+  return detail::full_join(left, right, left_on, right_on, compare_nulls, stream, mr);
+}
+
+join_result lazy_inner_join(table_view const& left,
+                            table_view const& right,
+                            std::vector<size_type> const& left_on,
+                            std::vector<size_type> const& right_on,
+                            null_equality compare_nulls,
+                            rmm::cuda_stream_view stream,
+                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(left, stream);
+  return detail::lazy_join(
+    detail::join_kind::INNER_JOIN, left, right, left_on, right_on, compare_nulls, stream, mr);
+}
+
+join_result lazy_left_join(table_view const& left,
+                           table_view const& right,
+                           std::vector<size_type> const& left_on,
+                           std::vector<size_type> const& right_on,
+                           null_equality compare_nulls,
+                           rmm::cuda_stream_view stream,
+                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(left, stream);
+  return detail::lazy_join(
+    detail::join_kind::LEFT_JOIN, left, right, left_on, right_on, compare_nulls, stream, mr);
+}
+
+join_result lazy_full_join(table_view const& left,
+                           table_view const& right,
+                           std::vector<size_type> const& left_on,
+                           std::vector<size_type> const& right_on,
+                           null_equality compare_nulls,
+                           rmm::cuda_stream_view stream,
+                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(left, stream);
+  return detail::lazy_join(
+    detail::join_kind::FULL_JOIN, left, right, left_on, right_on, compare_nulls, stream, mr);
 }
 
 }  // namespace cudf
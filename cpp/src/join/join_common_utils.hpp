@@ -39,32 +39,34 @@ constexpr int DEFAULT_JOIN_BLOCK_SIZE = 128;
 constexpr int DEFAULT_JOIN_CACHE_SIZE = 128;
 constexpr size_type JoinNoneValue     = std::numeric_limits<size_type>::min();
 
-using pair_type = cuco::pair_type<hash_value_type, size_type>;
+/**
+ * @brief The type of the row hash values keying the join hash tables.
+ *
+ * 64-bit, so that the rows of large build tables rarely share the hash value of other rows, each
+ * of which the probe has to compare for equality.
+ */
+using join_hash_value_type = uint64_t;
+
+using pair_type = cuco::pair_type<join_hash_value_type, size_type>;
 
-using hash_type = cuco::detail::MurmurHash3_32<hash_value_type>;
+/// The pairs of the semi join maps, keyed by row index
+using semi_pair_type = cuco::pair_type<hash_value_type, size_type>;
+
+using hash_type = cuco::detail::MurmurHash3_32<join_hash_value_type>;
 
 using hash_table_allocator_type = rmm::mr::stream_allocator_adaptor<default_allocator<char>>;
 
 using multimap_type =
-  cuco::static_multimap<hash_value_type,
+  cuco::static_multimap<join_hash_value_type,
                         size_type,
                         cuda::thread_scope_device,
                         hash_table_allocator_type,
                         cuco::double_hashing<DEFAULT_JOIN_CG_SIZE, hash_type, hash_type>>;
 
-// Multimap type used for mixed joins. TODO: This is a temporary alias used
-// until the mixed joins are converted to using CGs properly. Right now it's
-// using a cooperative group of size 1.
-using mixed_multimap_type = cuco::static_multimap<hash_value_type,
-                                                  size_type,
-                                                  cuda::thread_scope_device,
-                                                  hash_table_allocator_type,
-                                                  cuco::double_hashing<1, hash_type, hash_type>>;
-
 using semi_map_type = cuco::
   static_map<hash_value_type, size_type, cuda::thread_scope_device, hash_table_allocator_type>;
 
-using row_hash = cudf::row_hasher<default_hash, cudf::nullate::DYNAMIC>;
+using row_hash = cudf::row_hasher<XXHash_64, cudf::nullate::DYNAMIC>;
 
 using row_equality = cudf::row_equality_comparator<cudf::nullate::DYNAMIC>;
 
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <join/hash_join.cuh>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Fixed-width column gathered by `fused_fixed_width_gather`.
+ */
+struct fixed_width_gather_column {
+  uint8_t const* source;            // Data of the source column, at its offset
+  bitmask_type const* source_mask;  // Null mask of the source column, or null if it has none
+  size_type source_offset;          // Offset of the source column in its null mask
+  size_type width;                  // Size of the elements in bytes
+  bool right;                       // Whether the column is of the right table
+  uint8_t* target;                  // Data of the gathered column
+  bitmask_type* target_mask;        // Null mask of the gathered column, or null if it has none
+};
+
+__device__ inline void copy_element(uint8_t const* source,
+                                    uint8_t* target,
+                                    size_type width,
+                                    size_type source_row,
+                                    size_type target_row)
+{
+  switch (width) {
+    case 1: target[target_row] = source[source_row]; break;
+    case 2:
+      reinterpret_cast<uint16_t*>(target)[target_row] =
+        reinterpret_cast<uint16_t const*>(source)[source_row];
+      break;
+    case 4:
+      reinterpret_cast<uint32_t*>(target)[target_row] =
+        reinterpret_cast<uint32_t const*>(source)[source_row];
+      break;
+    case 8:
+      reinterpret_cast<uint64_t*>(target)[target_row] =
+        reinterpret_cast<uint64_t const*>(source)[source_row];
+      break;
+    default:
+      for (size_type b = 0; b < width; ++b) {
+        target[target_row * width + b] = source[source_row * width + b];
+      }
+  }
+}
+
+/**
+ * @brief Gathers fixed-width columns of both tables of a join.
+ *
+ * Each thread reads the left and right rows of an output row once, and copies the element of
+ * every column from its table. The warps process 32 consecutive output rows at a time, so that
+ * each word of the output null masks is formed by a ballot of the lanes of a warp.
+ *
+ * @param columns The columns to gather
+ * @param left_map The left row of each output row
+ * @param right_map The right row of each output row
+ * @param left_num_rows The number of rows of the left table
+ * @param right_num_rows The number of rows of the right table
+ * @param num_rows The number of output rows
+ * @param valid_counts The number of valid rows of each gathered column with a null mask
+ */
+template <int block_size>
+__global__ void fused_fixed_width_gather(device_span<fixed_width_gather_column const> columns,
+                                         size_type const* left_map,
+                                         size_type const* right_map,
+                                         size_type left_num_rows,
+                                         size_type right_num_rows,
+                                         size_type num_rows,
+                                         size_type* valid_counts)
+{
+  auto const lane      = threadIdx.x % warp_size;
+  int64_t const end    = (int64_t{num_rows} + warp_size - 1) / warp_size * warp_size;
+  int64_t const stride = int64_t{block_size} * gridDim.x;
+  for (int64_t i = threadIdx.x + int64_t{blockIdx.x} * block_size; i < end; i += stride) {
+    auto const row             = static_cast<size_type>(i);
+    auto const in_range        = i < num_rows;
+    auto const left_row        = in_range ? left_map[row] : -1;
+    auto const right_row       = in_range ? right_map[row] : -1;
+    auto const left_in_bounds  = left_row >= 0 and left_row < left_num_rows;
+    auto const right_in_bounds = right_row >= 0 and right_row < right_num_rows;
+
+    for (std::size_t c = 0; c < columns.size(); ++c) {
+      auto const& col       = columns[c];
+      auto const source_row = col.right ? right_row : left_row;
+      auto const in_bounds  = col.right ? right_in_bounds : left_in_bounds;
+      auto const valid =
+        in_bounds and (col.source_mask == nullptr or
+                       bit_is_set(col.source_mask, col.source_offset + source_row));
+      if (valid) { copy_element(col.source, col.target, col.width, source_row, row); }
+      if (col.target_mask != nullptr) {
+        auto const word = __ballot_sync(0xffff'ffff, valid);
+        if (lane == 0) {
+          col.target_mask[word_index(row)] = word;
+          atomicAdd(valid_counts + c, __popc(word));
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
+std::unique_ptr<table> gather_join_columns(table_view const& left,
+                                           table_view const& right,
+                                           device_span<size_type const> left_indices,
+                                           device_span<size_type const> right_indices,
+                                           out_of_bounds_policy bounds_policy,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(left_indices.size() == right_indices.size(),
+               "Mismatch in number of rows of the gather maps");
+  auto const num_rows = static_cast<size_type>(left_indices.size());
+  auto const nullify  = bounds_policy == out_of_bounds_policy::NULLIFY;
+
+  std::vector<std::unique_ptr<column>> columns(left.num_columns() + right.num_columns());
+  std::vector<fixed_width_gather_column> fixed_width;
+  std::vector<size_type> fixed_width_positions;
+
+  // The fixed-width columns are gathered together below, and the other columns of each table
+  // with `gather`
+  auto const add_columns = [&](table_view const& input,
+                               device_span<size_type const> gather_map,
+                               bool right_side,
+                               size_type first_position) {
+    std::vector<size_type> others;
+    for (size_type i = 0; i < input.num_columns(); ++i) {
+      auto const& col = input.column(i);
+      if (not is_fixed_width(col.type())) {
+        others.push_back(i);
+        continue;
+      }
+      auto const has_mask = col.nullable() or nullify;
+      auto result         = make_fixed_width_column(
+        col.type(),
+        num_rows,
+        has_mask ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED,
+        stream,
+        mr);
+      auto const width = static_cast<size_type>(size_of(col.type()));
+      fixed_width.push_back({static_cast<uint8_t const*>(col.head()) + col.offset() * width,
+                             col.nullable() ? col.null_mask() : nullptr,
+                             col.offset(),
+                             width,
+                             right_side,
+                             static_cast<uint8_t*>(result->mutable_view().head()),
+                             has_mask ? result->mutable_view().null_mask() : nullptr});
+      fixed_width_positions.push_back(first_position + i);
+      columns[first_position + i] = std::move(result);
+    }
+    if (others.empty()) { return; }
+
+    auto gathered = detail::gather(input.select(others),
+                                   gather_map,
+                                   bounds_policy,
+                                   negative_index_policy::NOT_ALLOWED,
+                                   stream,
+                                   mr)
+                      ->release();
+    for (std::size_t i = 0; i < others.size(); ++i) {
+      columns[first_position + others[i]] = std::move(gathered[i]);
+    }
+  };
+  add_columns(left, left_indices, false, 0);
+  add_columns(right, right_indices, true, left.num_columns());
+
+  if (not fixed_width.empty() and num_rows > 0) {
+    auto const d_columns = make_device_uvector_async(fixed_width, stream);
+    auto valid_counts    = make_zeroed_device_uvector_async<size_type>(fixed_width.size(), stream);
+    detail::grid_1d const config(num_rows, DEFAULT_JOIN_BLOCK_SIZE);
+    fused_fixed_width_gather<DEFAULT_JOIN_BLOCK_SIZE>
+      <<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+        d_columns,
+        left_indices.data(),
+        right_indices.data(),
+        left.num_rows(),
+        right.num_rows(),
+        num_rows,
+        valid_counts.data());
+
+    auto const h_valid_counts = make_std_vector_sync(valid_counts, stream);
+    for (std::size_t c = 0; c < fixed_width.size(); ++c) {
+      if (fixed_width[c].target_mask == nullptr) { continue; }
+      columns[fixed_width_positions[c]]->set_null_count(num_rows - h_valid_counts[c]);
+    }
+  } else {
+    for (auto const position : fixed_width_positions) {
+      if (columns[position]->nullable()) { columns[position]->set_null_count(0); }
+    }
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace detail
+
+join_result::join_result(cudf::table_view left,
+                         cudf::table_view right,
+                         std::unique_ptr<rmm::device_uvector<size_type>> left_indices,
+                         std::unique_ptr<rmm::device_uvector<size_type>> right_indices,
+                         out_of_bounds_policy bounds_policy)
+  : _left{left},
+    _right{right},
+    _left_indices{std::move(left_indices)},
+    _right_indices{std::move(right_indices)},
+    _bounds_policy{bounds_policy}
+{
+  CUDF_EXPECTS(_left_indices->size() == _right_indices->size(),
+               "Mismatch in number of rows of the gather maps");
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+join_result::release()
+{
+  return std::make_pair(std::move(_left_indices), std::move(_right_indices));
+}
+
+std::unique_ptr<cudf::table> join_result::materialize(std::vector<size_type> const& left_columns,
+                                                      std::vector<size_type> const& right_columns,
+                                                      rmm::cuda_stream_view stream,
+                                                      rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return detail::gather_join_columns(_left.select(left_columns),
+                                     _right.select(right_columns),
+                                     *_left_indices,
+                                     *_right_indices,
+                                     _bounds_policy,
+                                     stream,
+                                     mr);
+}
+
+}  // namespace cudf
@@ -30,6 +30,9 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <optional>
 #include <utility>
 
@@ -63,7 +66,7 @@ mixed_join(
   auto const swap_tables = (join_type == join_kind::INNER_JOIN) && (right_num_rows > left_num_rows);
 
   // The "outer" table is the larger of the two tables. The kernels are
-  // launched with one thread per row of the outer table, which also means that
+  // launched with one tile of threads per row of the outer table, which also means that
   // it is the probe table for the hash
   auto const outer_num_rows{swap_tables ? right_num_rows : left_num_rows};
 
@@ -120,10 +123,9 @@ mixed_join(
   row_equality equality_probe{
     cudf::nullate::DYNAMIC{has_nulls}, *probe_view, *build_view, compare_nulls};
 
-  // Don't use multimap_type because we want a CG size of 1.
-  mixed_multimap_type hash_table{
+  multimap_type hash_table{
     compute_hash_table_size(build.num_rows()),
-    std::numeric_limits<hash_value_type>::max(),
+    std::numeric_limits<join_hash_value_type>::max(),
     cudf::detail::JoinNoneValue,
     stream.value(),
     detail::hash_table_allocator_type{default_allocator<char>{}, stream}};
@@ -137,9 +139,14 @@ mixed_join(
   auto left_conditional_view  = table_device_view::create(left_conditional, stream);
   auto right_conditional_view = table_device_view::create(right_conditional, stream);
 
-  // For inner joins we support optimizing the join by launching one thread for
-  // whichever table is larger rather than always using the left table.
-  detail::grid_1d const config(outer_num_rows, DEFAULT_JOIN_BLOCK_SIZE);
+  // For inner joins we support optimizing the join by launching one tile of
+  // DEFAULT_JOIN_CG_SIZE threads per row of whichever table is larger rather
+  // than always using the left table. The kernels stride over the rows beyond
+  // the size of the grid.
+  detail::grid_1d const config(
+    static_cast<size_type>(std::min<int64_t>(int64_t{outer_num_rows} * DEFAULT_JOIN_CG_SIZE,
+                                             std::numeric_limits<size_type>::max())),
+    DEFAULT_JOIN_BLOCK_SIZE);
   auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
   join_kind const kernel_join_type =
     join_type == join_kind::FULL_JOIN ? join_kind::LEFT_JOIN : join_type;
@@ -299,7 +306,7 @@ compute_mixed_join_output_size(table_view const& left_equality,
   auto const swap_tables = (join_type == join_kind::INNER_JOIN) && (right_num_rows > left_num_rows);
 
   // The "outer" table is the larger of the two tables. The kernels are
-  // launched with one thread per row of the outer table, which also means that
+  // launched with one tile of threads per row of the outer table, which also means that
   // it is the probe table for the hash
   auto const outer_num_rows{swap_tables ? right_num_rows : left_num_rows};
 
@@ -366,10 +373,9 @@ compute_mixed_join_output_size(table_view const& left_equality,
   row_equality equality_probe{
     cudf::nullate::DYNAMIC{has_nulls}, *probe_view, *build_view, compare_nulls};
 
-  // Don't use multimap_type because we want a CG size of 1.
-  mixed_multimap_type hash_table{
+  multimap_type hash_table{
     compute_hash_table_size(build.num_rows()),
-    std::numeric_limits<hash_value_type>::max(),
+    std::numeric_limits<join_hash_value_type>::max(),
     cudf::detail::JoinNoneValue,
     stream.value(),
     detail::hash_table_allocator_type{default_allocator<char>{}, stream}};
@@ -383,9 +389,14 @@ compute_mixed_join_output_size(table_view const& left_equality,
   auto left_conditional_view  = table_device_view::create(left_conditional, stream);
   auto right_conditional_view = table_device_view::create(right_conditional, stream);
 
-  // For inner joins we support optimizing the join by launching one thread for
-  // whichever table is larger rather than always using the left table.
-  detail::grid_1d const config(outer_num_rows, DEFAULT_JOIN_BLOCK_SIZE);
+  // For inner joins we support optimizing the join by launching one tile of
+  // DEFAULT_JOIN_CG_SIZE threads per row of whichever table is larger rather
+  // than always using the left table. The kernels stride over the rows beyond
+  // the size of the grid.
+  detail::grid_1d const config(
+    static_cast<size_type>(std::min<int64_t>(int64_t{outer_num_rows} * DEFAULT_JOIN_CG_SIZE,
+                                             std::numeric_limits<size_type>::max())),
+    DEFAULT_JOIN_BLOCK_SIZE);
   auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
 
   // Allocate storage for the counter used to get the size of the join output
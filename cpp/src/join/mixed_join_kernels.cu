@@ -41,7 +41,7 @@ __global__ void mixed_join(table_device_view left_table,
                            table_device_view build,
                            row_equality const equality_probe,
                            join_kind const join_type,
-                           cudf::detail::mixed_multimap_type::device_view hash_table_view,
+                           cudf::detail::multimap_type::device_view hash_table_view,
                            size_type* join_output_l,
                            size_type* join_output_r,
                            cudf::ast::detail::expression_device_view device_expression_data,
@@ -62,7 +62,14 @@ __global__ void mixed_join(table_device_view left_table,
   cudf::size_type const right_num_rows = right_table.num_rows();
   auto const outer_num_rows            = (swap_tables ? right_num_rows : left_num_rows);
 
-  cudf::size_type outer_row_index = threadIdx.x + blockIdx.x * block_size;
+  // Each outer row is probed by a tile of threads, each of which compares the
+  // slots of its own probe window and evaluates the expression for its own
+  // matching pairs in its own intermediate storage.
+  auto const tile = cg::tiled_partition<DEFAULT_JOIN_CG_SIZE>(cg::this_thread_block());
+  cudf::size_type constexpr tiles_per_block = block_size / DEFAULT_JOIN_CG_SIZE;
+  cudf::size_type const start_idx =
+    threadIdx.x / DEFAULT_JOIN_CG_SIZE + blockIdx.x * tiles_per_block;
+  cudf::size_type const stride = tiles_per_block * gridDim.x;
 
   auto evaluator = cudf::ast::detail::expression_evaluator<has_nulls>(
     left_table, right_table, device_expression_data);
@@ -71,13 +78,12 @@ __global__ void mixed_join(table_device_view left_table,
   auto const empty_key_sentinel = hash_table_view.get_empty_key_sentinel();
   make_pair_function pair_func{hash_probe, empty_key_sentinel};
 
-  if (outer_row_index < outer_num_rows) {
-    // Figure out the number of elements for this key.
-    cg::thread_block_tile<1> this_thread = cg::this_thread();
-    // Figure out the number of elements for this key.
+  auto equality = pair_expression_equality<has_nulls>{
+    evaluator, thread_intermediate_storage, swap_tables, equality_probe};
+
+  for (cudf::size_type outer_row_index = start_idx; outer_row_index < outer_num_rows;
+       outer_row_index += stride) {
     auto query_pair = pair_func(outer_row_index);
-    auto equality   = pair_expression_equality<has_nulls>{
-      evaluator, thread_intermediate_storage, swap_tables, equality_probe};
 
     auto probe_key_begin       = thrust::make_discard_iterator();
     auto probe_value_begin     = swap_tables ? join_output_r + join_result_offsets[outer_row_index]
@@ -87,7 +93,7 @@ __global__ void mixed_join(table_device_view left_table,
                                              : join_output_r + join_result_offsets[outer_row_index];
 
     if (join_type == join_kind::LEFT_JOIN || join_type == join_kind::FULL_JOIN) {
-      hash_table_view.pair_retrieve_outer(this_thread,
+      hash_table_view.pair_retrieve_outer(tile,
                                           query_pair,
                                           probe_key_begin,
                                           probe_value_begin,
@@ -95,7 +101,7 @@ __global__ void mixed_join(table_device_view left_table,
                                           contained_value_begin,
                                           equality);
     } else {
-      hash_table_view.pair_retrieve(this_thread,
+      hash_table_view.pair_retrieve(tile,
                                     query_pair,
                                     probe_key_begin,
                                     probe_value_begin,
@@ -113,7 +119,7 @@ template __global__ void mixed_join<DEFAULT_JOIN_BLOCK_SIZE, true>(
   table_device_view build,
   row_equality const equality_probe,
   join_kind const join_type,
-  cudf::detail::mixed_multimap_type::device_view hash_table_view,
+  cudf::detail::multimap_type::device_view hash_table_view,
   size_type* join_output_l,
   size_type* join_output_r,
   cudf::ast::detail::expression_device_view device_expression_data,
@@ -127,7 +133,7 @@ template __global__ void mixed_join<DEFAULT_JOIN_BLOCK_SIZE, false>(
   table_device_view build,
   row_equality const equality_probe,
   join_kind const join_type,
-  cudf::detail::mixed_multimap_type::device_view hash_table_view,
+  cudf::detail::multimap_type::device_view hash_table_view,
   size_type* join_output_l,
   size_type* join_output_r,
   cudf::ast::detail::expression_device_view device_expression_data,
@@ -46,8 +46,8 @@ namespace detail {
  * @param[in] hash_table_view The hash table built from `build`.
  * @param[in] device_expression_data Container of device data required to evaluate the desired
  * expression.
- * @param[in] swap_tables If true, the kernel was launched with one thread per right row and
- * the kernel needs to internally loop over left rows. Otherwise, loop over right rows.
+ * @param[in] swap_tables If true, the kernel was launched with one tile of threads per right row
+ * and the kernel needs to internally loop over left rows. Otherwise, loop over right rows.
  * @param[out] output_size The resulting output size
  * @param[out] matches_per_row The number of matches in one pair of
  * equality/conditional tables for each row in the other pair of tables. If
@@ -64,7 +64,7 @@ __global__ void compute_mixed_join_output_size(
   table_device_view build,
   row_equality const equality_probe,
   join_kind const join_type,
-  cudf::detail::mixed_multimap_type::device_view hash_table_view,
+  cudf::detail::multimap_type::device_view hash_table_view,
   ast::detail::expression_device_view device_expression_data,
   bool const swap_tables,
   std::size_t* output_size,
@@ -97,8 +97,8 @@ __global__ void compute_mixed_join_output_size(
  * @param[in] join_result_offsets The starting indices in join_output[l|r]
  * where the matches for each row begin. Equivalent to a prefix sum of
  * matches_per_row.
- * @param[in] swap_tables If true, the kernel was launched with one thread per right row and
- * the kernel needs to internally loop over left rows. Otherwise, loop over right rows.
+ * @param[in] swap_tables If true, the kernel was launched with one tile of threads per right row
+ * and the kernel needs to internally loop over left rows. Otherwise, loop over right rows.
  */
 template <cudf::size_type block_size, bool has_nulls>
 __global__ void mixed_join(table_device_view left_table,
@@ -107,7 +107,7 @@ __global__ void mixed_join(table_device_view left_table,
                            table_device_view build,
                            row_equality const equality_probe,
                            join_kind const join_type,
-                           cudf::detail::mixed_multimap_type::device_view hash_table_view,
+                           cudf::detail::multimap_type::device_view hash_table_view,
                            size_type* join_output_l,
                            size_type* join_output_r,
                            cudf::ast::detail::expression_device_view device_expression_data,
@@ -30,6 +30,9 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <optional>
 #include <utility>
 
@@ -41,7 +44,7 @@ namespace {
  * @brief Device functor to create a pair of hash value and index for a given row.
  */
 struct make_pair_function_semi {
-  __device__ __forceinline__ cudf::detail::pair_type operator()(size_type i) const noexcept
+  __device__ __forceinline__ cudf::detail::semi_pair_type operator()(size_type i) const noexcept
   {
     // The value is irrelevant since we only ever use the hash map to check for
     // membership of a particular row index.
@@ -98,7 +101,7 @@ std::unique_ptr<rmm::device_uvector<size_type>> mixed_join_semi(
   auto const swap_tables = (join_type == join_kind::INNER_JOIN) && (right_num_rows > left_num_rows);
 
   // The "outer" table is the larger of the two tables. The kernels are
-  // launched with one thread per row of the outer table, which also means that
+  // launched with one tile of threads per row of the outer table, which also means that
   // it is the probe table for the hash
   auto const outer_num_rows{swap_tables ? right_num_rows : left_num_rows};
 
@@ -195,9 +198,14 @@ std::unique_ptr<rmm::device_uvector<size_type>> mixed_join_semi(
 
   auto hash_table_view = hash_table.get_device_view();
 
-  // For inner joins we support optimizing the join by launching one thread for
-  // whichever table is larger rather than always using the left table.
-  detail::grid_1d const config(outer_num_rows, DEFAULT_JOIN_BLOCK_SIZE);
+  // For inner joins we support optimizing the join by launching one tile of
+  // DEFAULT_JOIN_CG_SIZE threads per row of whichever table is larger rather
+  // than always using the left table. The kernels stride over the rows beyond
+  // the size of the grid.
+  detail::grid_1d const config(
+    static_cast<size_type>(std::min<int64_t>(int64_t{outer_num_rows} * DEFAULT_JOIN_CG_SIZE,
+                                             std::numeric_limits<size_type>::max())),
+    DEFAULT_JOIN_BLOCK_SIZE);
   auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
   join_kind const kernel_join_type =
     join_type == join_kind::FULL_JOIN ? join_kind::LEFT_JOIN : join_type;
@@ -328,7 +336,7 @@ compute_mixed_join_output_size_semi(table_view const& left_equality,
   auto const swap_tables = (join_type == join_kind::INNER_JOIN) && (right_num_rows > left_num_rows);
 
   // The "outer" table is the larger of the two tables. The kernels are
-  // launched with one thread per row of the outer table, which also means that
+  // launched with one tile of threads per row of the outer table, which also means that
   // it is the probe table for the hash
   auto const outer_num_rows{swap_tables ? right_num_rows : left_num_rows};
 
@@ -433,9 +441,14 @@ compute_mixed_join_output_size_semi(table_view const& left_equality,
 
   auto hash_table_view = hash_table.get_device_view();
 
-  // For inner joins we support optimizing the join by launching one thread for
-  // whichever table is larger rather than always using the left table.
-  detail::grid_1d const config(outer_num_rows, DEFAULT_JOIN_BLOCK_SIZE);
+  // For inner joins we support optimizing the join by launching one tile of
+  // DEFAULT_JOIN_CG_SIZE threads per row of whichever table is larger rather
+  // than always using the left table. The kernels stride over the rows beyond
+  // the size of the grid.
+  detail::grid_1d const config(
+    static_cast<size_type>(std::min<int64_t>(int64_t{outer_num_rows} * DEFAULT_JOIN_CG_SIZE,
+                                             std::numeric_limits<size_type>::max())),
+    DEFAULT_JOIN_BLOCK_SIZE);
   auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
 
   // Allocate storage for the counter used to get the size of the join output
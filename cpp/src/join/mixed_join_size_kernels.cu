@@ -26,6 +26,7 @@
 #include <cudf/utilities/span.hpp>
 
 #include <cooperative_groups.h>
+#include <cooperative_groups/reduce.h>
 
 #include <cub/cub.cuh>
 #include <thrust/iterator/discard_iterator.h>
@@ -42,7 +43,7 @@ __global__ void compute_mixed_join_output_size(
   table_device_view build,
   row_equality const equality_probe,
   join_kind const join_type,
-  cudf::detail::mixed_multimap_type::device_view hash_table_view,
+  cudf::detail::multimap_type::device_view hash_table_view,
   ast::detail::expression_device_view device_expression_data,
   bool const swap_tables,
   std::size_t* output_size,
@@ -59,12 +60,18 @@ __global__ void compute_mixed_join_output_size(
     intermediate_storage + (threadIdx.x * device_expression_data.num_intermediates);
 
   std::size_t thread_counter{0};
-  cudf::size_type const start_idx      = threadIdx.x + blockIdx.x * block_size;
-  cudf::size_type const stride         = block_size * gridDim.x;
   cudf::size_type const left_num_rows  = left_table.num_rows();
   cudf::size_type const right_num_rows = right_table.num_rows();
   auto const outer_num_rows            = (swap_tables ? right_num_rows : left_num_rows);
 
+  // Each outer row is probed by a tile of threads, each of which counts the
+  // matches in the slots of its own probe window.
+  auto const tile = cg::tiled_partition<DEFAULT_JOIN_CG_SIZE>(cg::this_thread_block());
+  cudf::size_type constexpr tiles_per_block = block_size / DEFAULT_JOIN_CG_SIZE;
+  cudf::size_type const start_idx =
+    threadIdx.x / DEFAULT_JOIN_CG_SIZE + blockIdx.x * tiles_per_block;
+  cudf::size_type const stride = tiles_per_block * gridDim.x;
+
   auto evaluator = cudf::ast::detail::expression_evaluator<has_nulls>(
     left_table, right_table, device_expression_data);
 
@@ -72,8 +79,6 @@ __global__ void compute_mixed_join_output_size(
   auto const empty_key_sentinel = hash_table_view.get_empty_key_sentinel();
   make_pair_function pair_func{hash_probe, empty_key_sentinel};
 
-  // Figure out the number of elements for this key.
-  cg::thread_block_tile<1> this_thread = cg::this_thread();
   // TODO: Address asymmetry in operator.
   auto count_equality = pair_expression_equality<has_nulls>{
     evaluator, thread_intermediate_storage, swap_tables, equality_probe};
@@ -81,14 +86,16 @@ __global__ void compute_mixed_join_output_size(
   for (cudf::size_type outer_row_index = start_idx; outer_row_index < outer_num_rows;
        outer_row_index += stride) {
     auto query_pair = pair_func(outer_row_index);
-    if (join_type == join_kind::LEFT_JOIN || join_type == join_kind::FULL_JOIN) {
-      matches_per_row[outer_row_index] =
-        hash_table_view.pair_count_outer(this_thread, query_pair, count_equality);
-    } else {
-      matches_per_row[outer_row_index] =
-        hash_table_view.pair_count(this_thread, query_pair, count_equality);
+    auto const thread_matches =
+      (join_type == join_kind::LEFT_JOIN || join_type == join_kind::FULL_JOIN)
+        ? hash_table_view.pair_count_outer(tile, query_pair, count_equality)
+        : hash_table_view.pair_count(tile, query_pair, count_equality);
+    auto const row_matches =
+      cg::reduce(tile, static_cast<cudf::size_type>(thread_matches), cg::plus<cudf::size_type>());
+    if (tile.thread_rank() == 0) {
+      matches_per_row[outer_row_index] = row_matches;
+      thread_counter += row_matches;
     }
-    thread_counter += matches_per_row[outer_row_index];
   }
 
   using BlockReduce = cub::BlockReduce<cudf::size_type, block_size>;
@@ -106,7 +113,7 @@ template __global__ void compute_mixed_join_output_size<DEFAULT_JOIN_BLOCK_SIZE,
   table_device_view build,
   row_equality const equality_probe,
   join_kind const join_type,
-  cudf::detail::mixed_multimap_type::device_view hash_table_view,
+  cudf::detail::multimap_type::device_view hash_table_view,
   ast::detail::expression_device_view device_expression_data,
   bool const swap_tables,
   std::size_t* output_size,
@@ -119,7 +126,7 @@ template __global__ void compute_mixed_join_output_size<DEFAULT_JOIN_BLOCK_SIZE,
   table_device_view build,
   row_equality const equality_probe,
   join_kind const join_type,
-  cudf::detail::mixed_multimap_type::device_view hash_table_view,
+  cudf::detail::multimap_type::device_view hash_table_view,
   ast::detail::expression_device_view device_expression_data,
   bool const swap_tables,
   std::size_t* output_size,
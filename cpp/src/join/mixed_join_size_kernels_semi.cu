@@ -24,6 +24,8 @@
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/span.hpp>
 
+#include <cooperative_groups.h>
+
 #include <cub/cub.cuh>
 
 namespace cudf {
@@ -56,12 +58,18 @@ __global__ void compute_mixed_join_output_size_semi(
     intermediate_storage + (threadIdx.x * device_expression_data.num_intermediates);
 
   std::size_t thread_counter{0};
-  cudf::size_type const start_idx      = threadIdx.x + blockIdx.x * block_size;
-  cudf::size_type const stride         = block_size * gridDim.x;
   cudf::size_type const left_num_rows  = left_table.num_rows();
   cudf::size_type const right_num_rows = right_table.num_rows();
   auto const outer_num_rows            = (swap_tables ? right_num_rows : left_num_rows);
 
+  // Each outer row is probed by a tile of threads, each of which compares the
+  // slots of its own probe window.
+  auto const tile = cg::tiled_partition<DEFAULT_JOIN_CG_SIZE>(cg::this_thread_block());
+  cudf::size_type constexpr tiles_per_block = block_size / DEFAULT_JOIN_CG_SIZE;
+  cudf::size_type const start_idx =
+    threadIdx.x / DEFAULT_JOIN_CG_SIZE + blockIdx.x * tiles_per_block;
+  cudf::size_type const stride = tiles_per_block * gridDim.x;
+
   auto evaluator = cudf::ast::detail::expression_evaluator<has_nulls>(
     left_table, right_table, device_expression_data);
   row_hash hash_probe{nullate::DYNAMIC{has_nulls}, probe};
@@ -71,10 +79,11 @@ __global__ void compute_mixed_join_output_size_semi(
 
   for (cudf::size_type outer_row_index = start_idx; outer_row_index < outer_num_rows;
        outer_row_index += stride) {
-    matches_per_row[outer_row_index] =
-      ((join_type == join_kind::LEFT_ANTI_JOIN) !=
-       (hash_table_view.contains(outer_row_index, hash_probe, equality)));
-    thread_counter += matches_per_row[outer_row_index];
+    auto const contained = hash_table_view.contains(tile, outer_row_index, hash_probe, equality);
+    if (tile.thread_rank() == 0) {
+      matches_per_row[outer_row_index] = ((join_type == join_kind::LEFT_ANTI_JOIN) != contained);
+      thread_counter += matches_per_row[outer_row_index];
+    }
   }
 
   using BlockReduce = cub::BlockReduce<cudf::size_type, block_size>;
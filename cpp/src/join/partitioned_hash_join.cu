@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <join/hash_join.cuh>
+#include <join/join_common_utils.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/join.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/spill.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <thrust/host_vector.h>
+#include <thrust/system/cuda/experimental/pinned_allocator.h>
+
+#include <map>
+#include <stdexcept>
+#include <utility>
+
+namespace cudf {
+namespace {
+
+/**
+ * @brief Partition store that copies the chunks to pinned host memory.
+ */
+class host_join_partition_store : public join_partition_store {
+  using pinned_buffer =
+    thrust::host_vector<uint8_t, thrust::system::cuda::experimental::pinned_allocator<uint8_t>>;
+
+  struct host_chunk {
+    std::unique_ptr<packed_columns::metadata> metadata;
+    pinned_buffer data;
+  };
+
+ public:
+  void store(join_side side,
+             size_type partition,
+             packed_columns&& chunk,
+             rmm::cuda_stream_view stream) override
+  {
+    host_chunk spilled{std::move(chunk.metadata_), pinned_buffer(chunk.gpu_data->size())};
+    CUDA_TRY(cudaMemcpyAsync(spilled.data.data(),
+                             chunk.gpu_data->data(),
+                             chunk.gpu_data->size(),
+                             cudaMemcpyDeviceToHost,
+                             stream.value()));
+    stream.synchronize();
+    chunk.gpu_data.reset();
+    _chunks[{side, partition}].push_back(std::move(spilled));
+  }
+
+  std::vector<packed_columns> retrieve(join_side side,
+                                       size_type partition,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr) override
+  {
+    auto const it = _chunks.find({side, partition});
+    if (it == _chunks.end()) { return {}; }
+
+    std::vector<packed_columns> chunks;
+    for (auto& spilled : it->second) {
+      auto data = std::make_unique<rmm::device_buffer>(spilled.data.size(), stream, mr);
+      CUDA_TRY(cudaMemcpyAsync(data->data(),
+                               spilled.data.data(),
+                               spilled.data.size(),
+                               cudaMemcpyHostToDevice,
+                               stream.value()));
+      chunks.emplace_back(std::move(spilled.metadata), std::move(data));
+    }
+    // The host buffers are released below, so the copies must be done by then
+    stream.synchronize();
+    _chunks.erase(it);
+    return chunks;
+  }
+
+ private:
+  std::map<std::pair<join_side, size_type>, std::vector<host_chunk>> _chunks;
+};
+
+/**
+ * @brief Partition store whose chunks stay in device memory until a spill manager spills them.
+ */
+class spilling_join_partition_store : public join_partition_store {
+ public:
+  explicit spilling_join_partition_store(spill_manager& manager) : _manager{manager} {}
+
+  void store(join_side side,
+             size_type partition,
+             packed_columns&& chunk,
+             rmm::cuda_stream_view stream) override
+  {
+    _chunks[{side, partition}].emplace_back(std::move(chunk), _manager, stream);
+  }
+
+  std::vector<packed_columns> retrieve(join_side side,
+                                       size_type partition,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr) override
+  {
+    auto const it = _chunks.find({side, partition});
+    if (it == _chunks.end()) { return {}; }
+
+    std::vector<packed_columns> chunks;
+    for (auto& spillable : it->second) {
+      auto chunk = spillable.release(stream);
+      if (chunk.gpu_data->memory_resource() != mr) {
+        chunk.gpu_data = std::make_unique<rmm::device_buffer>(*chunk.gpu_data, stream, mr);
+      }
+      chunks.push_back(std::move(chunk));
+    }
+    _chunks.erase(it);
+    return chunks;
+  }
+
+ private:
+  spill_manager& _manager;
+  std::map<std::pair<join_side, size_type>, std::vector<spillable_table>> _chunks;
+};
+
+}  // namespace
+
+std::unique_ptr<join_partition_store> make_host_join_partition_store()
+{
+  return std::make_unique<host_join_partition_store>();
+}
+
+std::unique_ptr<join_partition_store> make_spilling_join_partition_store(spill_manager& manager)
+{
+  return std::make_unique<spilling_join_partition_store>(manager);
+}
+
+struct partitioned_hash_join::partitioned_hash_join_impl {
+  size_type const _num_partitions;
+  std::vector<size_type> const _build_on;
+  std::vector<size_type> const _probe_on;
+  null_equality const _compare_nulls;
+  std::unique_ptr<join_partition_store> const _store;
+
+  // Empty tables with the columns of each side, for the partitions without any rows
+  std::unique_ptr<table> _build_schema;
+  std::unique_ptr<table> _probe_schema;
+
+  partitioned_hash_join_impl(size_type num_partitions,
+                             std::vector<size_type> build_on,
+                             std::vector<size_type> probe_on,
+                             null_equality compare_nulls,
+                             std::unique_ptr<join_partition_store> store)
+    : _num_partitions{num_partitions},
+      _build_on{std::move(build_on)},
+      _probe_on{std::move(probe_on)},
+      _compare_nulls{compare_nulls},
+      _store{std::move(store)}
+  {
+    CUDF_EXPECTS(_num_partitions > 0, "Number of partitions must be positive");
+    CUDF_EXPECTS(not _build_on.empty() and _build_on.size() == _probe_on.size(),
+                 "Mismatch in number of columns to be joined on");
+    CUDF_EXPECTS(_store != nullptr, "Partition store must not be null");
+  }
+
+  /**
+   * @brief Hash partitions a chunk of one side on its join keys and stores the partitions.
+   */
+  void add(join_side side, table_view const& input, rmm::cuda_stream_view stream)
+  {
+    auto& schema = side == join_side::BUILD ? _build_schema : _probe_schema;
+    if (schema == nullptr) { schema = empty_like(input); }
+    if (input.num_rows() == 0) { return; }
+
+    // Both sides use the same hash function and seed, so equal keys land in the same partition
+    auto const& on                    = side == join_side::BUILD ? _build_on : _probe_on;
+    auto const [partitioned, offsets] = cudf::hash_partition(
+      input, on, _num_partitions, hash_id::HASH_MURMUR3, DEFAULT_HASH_SEED, stream);
+
+    std::vector<size_type> const splits(offsets.begin() + 1, offsets.end());
+    auto chunks = detail::contiguous_split(partitioned->view(), splits, stream);
+    for (size_type p = 0; p < _num_partitions; ++p) {
+      if (chunks[p].table.num_rows() == 0) { continue; }
+      _store->store(side, p, std::move(chunks[p].data), stream);
+    }
+  }
+
+  /**
+   * @brief Retrieves the chunks of a partition of one side into a single table.
+   */
+  std::unique_ptr<table> load(join_side side, size_type partition, rmm::cuda_stream_view stream)
+  {
+    auto const& schema = side == join_side::BUILD ? _build_schema : _probe_schema;
+    auto const chunks =
+      _store->retrieve(side, partition, stream, rmm::mr::get_current_device_resource());
+    if (chunks.empty()) { return std::make_unique<table>(schema->view(), stream); }
+
+    std::vector<table_view> views;
+    for (auto const& chunk : chunks) {
+      views.push_back(unpack(chunk));
+    }
+    return detail::concatenate(views, stream);
+  }
+
+  std::unique_ptr<table> join(detail::join_kind kind,
+                              size_type partition,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+  {
+    CUDF_EXPECTS(_build_schema != nullptr and _probe_schema != nullptr,
+                 "Both tables must be added before joining");
+    if (partition < 0 or partition >= _num_partitions) {
+      throw std::out_of_range("Partition index out of range");
+    }
+
+    auto const probe = load(join_side::PROBE, partition, stream);
+    auto const build = load(join_side::BUILD, partition, stream);
+
+    cudf::hash_join const hash_table(build->select(_build_on), _compare_nulls, stream);
+    auto const probe_keys = probe->select(_probe_on);
+    auto const indices =
+      kind == detail::join_kind::INNER_JOIN
+        ? hash_table.inner_join(probe_keys, _compare_nulls, std::nullopt, stream)
+        : kind == detail::join_kind::LEFT_JOIN
+            ? hash_table.left_join(probe_keys, _compare_nulls, std::nullopt, stream)
+            : hash_table.full_join(probe_keys, _compare_nulls, std::nullopt, stream);
+
+    // Rows of the outer joins without a match are gathered as nulls
+    auto const bounds_policy = kind == detail::join_kind::INNER_JOIN
+                                 ? out_of_bounds_policy::DONT_CHECK
+                                 : out_of_bounds_policy::NULLIFY;
+    auto probe_result = detail::gather(probe->view(),
+                                       indices.first->begin(),
+                                       indices.first->end(),
+                                       bounds_policy,
+                                       stream,
+                                       mr);
+    auto build_result = detail::gather(build->view(),
+                                       indices.second->begin(),
+                                       indices.second->end(),
+                                       bounds_policy,
+                                       stream,
+                                       mr);
+    return detail::combine_table_pair(std::move(probe_result), std::move(build_result));
+  }
+};
+
+partitioned_hash_join::~partitioned_hash_join() = default;
+
+partitioned_hash_join::partitioned_hash_join(size_type num_partitions,
+                                             std::vector<size_type> build_on,
+                                             std::vector<size_type> probe_on,
+                                             null_equality compare_nulls,
+                                             std::unique_ptr<join_partition_store> store)
+  : impl{std::make_unique<partitioned_hash_join_impl>(
+      num_partitions, std::move(build_on), std::move(probe_on), compare_nulls, std::move(store))}
+{
+}
+
+void partitioned_hash_join::add_build(cudf::table_view const& build, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  impl->add(join_side::BUILD, build, stream);
+}
+
+void partitioned_hash_join::add_probe(cudf::table_view const& probe, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  impl->add(join_side::PROBE, probe, stream);
+}
+
+size_type partitioned_hash_join::num_partitions() const { return impl->_num_partitions; }
+
+std::unique_ptr<cudf::table> partitioned_hash_join::inner_join(size_type partition,
+                                                               rmm::cuda_stream_view stream,
+                                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return impl->join(detail::join_kind::INNER_JOIN, partition, stream, mr);
+}
+
+std::unique_ptr<cudf::table> partitioned_hash_join::left_join(size_type partition,
+                                                              rmm::cuda_stream_view stream,
+                                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return impl->join(detail::join_kind::LEFT_JOIN, partition, stream, mr);
+}
+
+std::unique_ptr<cudf::table> partitioned_hash_join::full_join(size_type partition,
+                                                              rmm::cuda_stream_view stream,
+                                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return impl->join(detail::join_kind::FULL_JOIN, partition, stream, mr);
+}
+
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,7 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/structs/utilities.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/join.hpp>
 #include <cudf/table/table.hpp>
@@ -35,7 +36,11 @@
 #include <thrust/copy.h>
 #include <thrust/distance.h>
 #include <thrust/sequence.h>
+#include <thrust/transform.h>
 #include <thrust/tuple.h>
+#include <thrust/uninitialized_fill.h>
+
+#include <algorithm>
 
 namespace cudf {
 namespace detail {
@@ -45,7 +50,7 @@ namespace {
  * @brief Device functor to create a pair of hash value and index for a given row.
  */
 struct make_pair_function {
-  __device__ __forceinline__ cudf::detail::pair_type operator()(size_type i) const noexcept
+  __device__ __forceinline__ cudf::detail::semi_pair_type operator()(size_type i) const noexcept
   {
     // The value is irrelevant since we only ever use the hash map to check for
     // membership of a particular row index.
@@ -53,6 +58,23 @@ struct make_pair_function {
   }
 };
 
+/**
+ * @brief Device functor returning whether a probe row is, or is not, in the hash table.
+ */
+struct probe_contains {
+  semi_map_type::device_view hash_table_view;
+  row_hash hash_probe;
+  row_equality equality_probe;
+  bool contained;  // Result for the rows found in the hash table
+
+  __device__ bool operator()(size_type const idx) const noexcept
+  {
+    // Look up this row. The hash function used here needs to map a (left) row index to the hash
+    // of the row, so it's a row hash. The equality check needs to verify
+    return hash_table_view.contains(idx, hash_probe, equality_probe) == contained;
+  }
+};
+
 }  // namespace
 
 std::unique_ptr<rmm::device_uvector<cudf::size_type>> left_semi_anti_join(
@@ -76,82 +98,9 @@ std::unique_ptr<rmm::device_uvector<cudf::size_type>> left_semi_anti_join(
     return result;
   }
 
-  auto const left_num_rows  = left_keys.num_rows();
-  auto const right_num_rows = right_keys.num_rows();
-
-  // flatten structs for the right and left and use that for the hash table
-  auto right_flattened_tables = structs::detail::flatten_nested_columns(
-    right_keys, {}, {}, structs::detail::column_nullability::FORCE);
-  auto left_flattened_tables = structs::detail::flatten_nested_columns(
-    left_keys, {}, {}, structs::detail::column_nullability::FORCE);
-
-  auto right_flattened_keys = right_flattened_tables.flattened_columns();
-  auto left_flattened_keys  = left_flattened_tables.flattened_columns();
-
-  // Create hash table.
-  semi_map_type hash_table{compute_hash_table_size(right_num_rows),
-                           std::numeric_limits<hash_value_type>::max(),
-                           cudf::detail::JoinNoneValue,
-                           hash_table_allocator_type{default_allocator<char>{}, stream},
-                           stream.value()};
-
-  // Create hash table containing all keys found in right table
-  auto right_rows_d      = table_device_view::create(right_flattened_keys, stream);
-  auto const right_nulls = cudf::nullate::DYNAMIC{cudf::has_nulls(right_flattened_keys)};
-  row_hash const hash_build{right_nulls, *right_rows_d};
-  row_equality equality_build{right_nulls, *right_rows_d, *right_rows_d, compare_nulls};
-  make_pair_function pair_func_build{};
-
-  auto iter = cudf::detail::make_counting_transform_iterator(0, pair_func_build);
-
-  // skip rows that are null here.
-  if ((compare_nulls == null_equality::EQUAL) or (not nullable(right_keys))) {
-    hash_table.insert(iter, iter + right_num_rows, hash_build, equality_build, stream.value());
-  } else {
-    thrust::counting_iterator<size_type> stencil(0);
-    auto const [row_bitmask, _] = cudf::detail::bitmask_and(right_flattened_keys, stream);
-    row_is_valid pred{static_cast<bitmask_type const*>(row_bitmask.data())};
-
-    // insert valid rows
-    hash_table.insert_if(
-      iter, iter + right_num_rows, stencil, pred, hash_build, equality_build, stream.value());
-  }
-
-  // Now we have a hash table, we need to iterate over the rows of the left table
-  // and check to see if they are contained in the hash table
-  auto left_rows_d      = table_device_view::create(left_flattened_keys, stream);
-  auto const left_nulls = cudf::nullate::DYNAMIC{cudf::has_nulls(left_flattened_keys)};
-  row_hash hash_probe{left_nulls, *left_rows_d};
-  // Note: This equality comparator violates symmetry of equality and is
-  // therefore relying on the implementation detail of the order in which its
-  // operator is invoked. If cuco makes no promises about the order of
-  // invocation this seems a bit unsafe.
-  row_equality equality_probe{left_nulls, *right_rows_d, *left_rows_d, compare_nulls};
-
-  // For semi join we want contains to be true, for anti join we want contains to be false
-  bool const join_type_boolean = (kind == join_kind::LEFT_SEMI_JOIN);
-
-  auto hash_table_view = hash_table.get_device_view();
-
-  auto gather_map =
-    std::make_unique<rmm::device_uvector<cudf::size_type>>(left_num_rows, stream, mr);
-
-  // gather_map_end will be the end of valid data in gather_map
-  auto gather_map_end = thrust::copy_if(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator(0),
-    thrust::make_counting_iterator(left_num_rows),
-    gather_map->begin(),
-    [hash_table_view, join_type_boolean, hash_probe, equality_probe] __device__(
-      size_type const idx) {
-      // Look up this row. The hash function used here needs to map a (left) row index to the hash
-      // of the row, so it's a row hash. The equality check needs to verify
-      return hash_table_view.contains(idx, hash_probe, equality_probe) == join_type_boolean;
-    });
-
-  auto join_size = thrust::distance(gather_map->begin(), gather_map_end);
-  gather_map->resize(join_size, stream);
-  return gather_map;
+  semi_join_hash_table const hash_table(right_keys, compare_nulls, stream);
+  return kind == join_kind::LEFT_SEMI_JOIN ? hash_table.left_semi_join(left_keys, stream, mr)
+                                           : hash_table.left_anti_join(left_keys, stream, mr);
 }
 
 /**
@@ -219,8 +168,12 @@ std::unique_ptr<cudf::table> left_semi_anti_join(
   auto const left_selected  = matched.second.front();
   auto const right_selected = matched.second.back();
 
-  auto gather_vector =
-    left_semi_anti_join(kind, left_selected, right_selected, compare_nulls, stream);
+  // the dictionaries are joined by their indices
+  auto gather_vector = left_semi_anti_join(kind,
+                                           cudf::dictionary::detail::indices_view(left_selected),
+                                           cudf::dictionary::detail::indices_view(right_selected),
+                                           compare_nulls,
+                                           stream);
 
   // wrapping the device vector with a column view allows calling the non-iterator
   // version of detail::gather, improving compile time by 10% and reducing the
@@ -242,33 +195,209 @@ std::unique_ptr<cudf::table> left_semi_anti_join(
 
 }  // namespace detail
 
+struct semi_join_hash_table::semi_join_hash_table_impl {
+ private:
+  bool _is_empty;
+  null_equality _compare_nulls;
+  cudf::structs::detail::flattened_table _flattened_build_table;
+  cudf::table_view _build;
+  cudf::detail::semi_map_type _hash_table;
+
+ public:
+  semi_join_hash_table_impl(cudf::table_view const& build,
+                            null_equality compare_nulls,
+                            rmm::cuda_stream_view stream)
+    : _is_empty{build.num_rows() == 0},
+      _compare_nulls{compare_nulls},
+      _hash_table{compute_hash_table_size(std::max(build.num_rows(), 1)),
+                  std::numeric_limits<hash_value_type>::max(),
+                  cudf::detail::JoinNoneValue,
+                  detail::hash_table_allocator_type{default_allocator<char>{}, stream},
+                  stream.value()}
+  {
+    CUDF_EXPECTS(0 != build.num_columns(), "Right table is empty");
+
+    // flatten structs for the right and use that for the hash table
+    _flattened_build_table = structs::detail::flatten_nested_columns(
+      build, {}, {}, structs::detail::column_nullability::FORCE);
+    _build = _flattened_build_table.flattened_columns();
+
+    if (_is_empty) { return; }
+
+    // Create hash table containing all keys found in right table
+    auto build_rows_d      = table_device_view::create(_build, stream);
+    auto const build_nulls = cudf::nullate::DYNAMIC{cudf::has_nulls(_build)};
+    detail::row_hash const hash_build{build_nulls, *build_rows_d};
+    detail::row_equality equality_build{build_nulls, *build_rows_d, *build_rows_d, _compare_nulls};
+    detail::make_pair_function pair_func_build{};
+
+    auto iter = cudf::detail::make_counting_transform_iterator(0, pair_func_build);
+
+    // skip rows that are null here.
+    auto const build_num_rows = _build.num_rows();
+    if ((_compare_nulls == null_equality::EQUAL) or (not nullable(build))) {
+      _hash_table.insert(iter, iter + build_num_rows, hash_build, equality_build, stream.value());
+    } else {
+      thrust::counting_iterator<size_type> stencil(0);
+      auto const [row_bitmask, _] = cudf::detail::bitmask_and(_build, stream);
+      detail::row_is_valid pred{static_cast<bitmask_type const*>(row_bitmask.data())};
+
+      // insert valid rows
+      _hash_table.insert_if(
+        iter, iter + build_num_rows, stencil, pred, hash_build, equality_build, stream.value());
+    }
+  }
+
+  std::unique_ptr<rmm::device_uvector<size_type>> semi_anti_join(
+    cudf::table_view const& probe,
+    bool contained,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr) const
+  {
+    auto const probe_num_rows = probe.num_rows();
+    auto gather_map = std::make_unique<rmm::device_uvector<size_type>>(probe_num_rows, stream, mr);
+
+    // Nothing is contained in an empty table
+    if (_is_empty) {
+      if (contained) {
+        gather_map->resize(0, stream);
+      } else {
+        thrust::sequence(rmm::exec_policy(stream), gather_map->begin(), gather_map->end());
+      }
+      return gather_map;
+    }
+
+    auto flattened_probe = structs::detail::flatten_nested_columns(
+      probe, {}, {}, structs::detail::column_nullability::FORCE);
+    auto const flattened_probe_table = flattened_probe.flattened_columns();
+    CUDF_EXPECTS(_build.num_columns() == flattened_probe_table.num_columns(),
+                 "Mismatch in number of columns to be joined on");
+
+    auto build_rows_d = table_device_view::create(_build, stream);
+    auto probe_rows_d = table_device_view::create(flattened_probe_table, stream);
+
+    // gather_map_end will be the end of valid data in gather_map
+    auto gather_map_end =
+      thrust::copy_if(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator(0),
+                      thrust::make_counting_iterator(probe_num_rows),
+                      gather_map->begin(),
+                      make_probe(*build_rows_d, *probe_rows_d, flattened_probe_table, contained));
+
+    auto join_size = thrust::distance(gather_map->begin(), gather_map_end);
+    gather_map->resize(join_size, stream);
+    return gather_map;
+  }
+
+  std::unique_ptr<column> contains(cudf::table_view const& probe,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr) const
+  {
+    auto result = make_numeric_column(
+      data_type{type_id::BOOL8}, probe.num_rows(), mask_state::UNALLOCATED, stream, mr);
+    auto const result_begin = result->mutable_view().begin<bool>();
+    if (_is_empty) {
+      thrust::uninitialized_fill(
+        rmm::exec_policy(stream), result_begin, result_begin + probe.num_rows(), false);
+      return result;
+    }
+
+    auto flattened_probe = structs::detail::flatten_nested_columns(
+      probe, {}, {}, structs::detail::column_nullability::FORCE);
+    auto const flattened_probe_table = flattened_probe.flattened_columns();
+    CUDF_EXPECTS(_build.num_columns() == flattened_probe_table.num_columns(),
+                 "Mismatch in number of columns to be joined on");
+
+    auto build_rows_d = table_device_view::create(_build, stream);
+    auto probe_rows_d = table_device_view::create(flattened_probe_table, stream);
+
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator(0),
+                      thrust::make_counting_iterator(probe.num_rows()),
+                      result_begin,
+                      make_probe(*build_rows_d, *probe_rows_d, flattened_probe_table, true));
+    return result;
+  }
+
+ private:
+  /**
+   * @brief Returns the functor probing the hash table for the rows of `probe`.
+   */
+  detail::probe_contains make_probe(table_device_view const& build_rows_d,
+                                    table_device_view const& probe_rows_d,
+                                    cudf::table_view const& probe,
+                                    bool contained) const
+  {
+    auto const nulls = cudf::nullate::DYNAMIC{cudf::has_nulls(probe) or cudf::has_nulls(_build)};
+    detail::row_hash hash_probe{nulls, probe_rows_d};
+    // Note: This equality comparator violates symmetry of equality and is
+    // therefore relying on the implementation detail of the order in which its
+    // operator is invoked. If cuco makes no promises about the order of
+    // invocation this seems a bit unsafe.
+    detail::row_equality equality_probe{nulls, build_rows_d, probe_rows_d, _compare_nulls};
+    return detail::probe_contains{
+      _hash_table.get_device_view(), hash_probe, equality_probe, contained};
+  }
+};
+
+semi_join_hash_table::~semi_join_hash_table() = default;
+
+semi_join_hash_table::semi_join_hash_table(cudf::table_view const& build,
+                                           null_equality compare_nulls,
+                                           rmm::cuda_stream_view stream)
+  : impl{std::make_unique<const semi_join_hash_table_impl>(build, compare_nulls, stream)}
+{
+}
+
+std::unique_ptr<rmm::device_uvector<size_type>> semi_join_hash_table::left_semi_join(
+  cudf::table_view const& probe,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->semi_anti_join(probe, true, stream, mr);
+}
+
+std::unique_ptr<rmm::device_uvector<size_type>> semi_join_hash_table::left_anti_join(
+  cudf::table_view const& probe,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->semi_anti_join(probe, false, stream, mr);
+}
+
+std::unique_ptr<column> semi_join_hash_table::contains(cudf::table_view const& probe,
+                                                       rmm::cuda_stream_view stream,
+                                                       rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->contains(probe, stream, mr);
+}
+
 std::unique_ptr<cudf::table> left_semi_join(cudf::table_view const& left,
                                             cudf::table_view const& right,
                                             std::vector<cudf::size_type> const& left_on,
                                             std::vector<cudf::size_type> const& right_on,
                                             null_equality compare_nulls,
+                                            rmm::cuda_stream_view stream,
                                             rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::left_semi_anti_join(detail::join_kind::LEFT_SEMI_JOIN,
-                                     left,
-                                     right,
-                                     left_on,
-                                     right_on,
-                                     compare_nulls,
-                                     rmm::cuda_stream_default,
-                                     mr);
+  return detail::left_semi_anti_join(
+    detail::join_kind::LEFT_SEMI_JOIN, left, right, left_on, right_on, compare_nulls, stream, mr);
 }
 
 std::unique_ptr<rmm::device_uvector<cudf::size_type>> left_semi_join(
   cudf::table_view const& left,
   cudf::table_view const& right,
   null_equality compare_nulls,
+  rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::left_semi_anti_join(
-    detail::join_kind::LEFT_SEMI_JOIN, left, right, compare_nulls, rmm::cuda_stream_default, mr);
+    detail::join_kind::LEFT_SEMI_JOIN, left, right, compare_nulls, stream, mr);
 }
 
 std::unique_ptr<cudf::table> left_anti_join(cudf::table_view const& left,
@@ -276,28 +405,24 @@ std::unique_ptr<cudf::table> left_anti_join(cudf::table_view const& left,
                                             std::vector<cudf::size_type> const& left_on,
                                             std::vector<cudf::size_type> const& right_on,
                                             null_equality compare_nulls,
+                                            rmm::cuda_stream_view stream,
                                             rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::left_semi_anti_join(detail::join_kind::LEFT_ANTI_JOIN,
-                                     left,
-                                     right,
-                                     left_on,
-                                     right_on,
-                                     compare_nulls,
-                                     rmm::cuda_stream_default,
-                                     mr);
+  return detail::left_semi_anti_join(
+    detail::join_kind::LEFT_ANTI_JOIN, left, right, left_on, right_on, compare_nulls, stream, mr);
 }
 
 std::unique_ptr<rmm::device_uvector<cudf::size_type>> left_anti_join(
   cudf::table_view const& left,
   cudf::table_view const& right,
   null_equality compare_nulls,
+  rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::left_semi_anti_join(
-    detail::join_kind::LEFT_ANTI_JOIN, left, right, compare_nulls, rmm::cuda_stream_default, mr);
+    detail::join_kind::LEFT_ANTI_JOIN, left, right, compare_nulls, stream, mr);
 }
 
 }  // namespace cudf
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <join/join_common_utils.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+#include <thrust/uninitialized_fill.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Device functor returning the number of output rows of each left row.
+ */
+struct join_output_count {
+  size_type const* lower;         // First right row equal to each left row
+  size_type const* upper;         // One past the last right row equal to each left row
+  bitmask_type const* row_valid;  // Left rows that may match, or null if all may
+  bool outer;                     // Whether left rows without a match are in the output
+
+  __device__ size_type matches(size_type i) const noexcept
+  {
+    return (row_valid == nullptr or bit_is_set(row_valid, i)) ? upper[i] - lower[i] : 0;
+  }
+
+  __device__ std::size_t operator()(size_type i) const noexcept
+  {
+    auto const num_matches = matches(i);
+    return (outer and num_matches == 0) ? 1 : num_matches;
+  }
+};
+
+/**
+ * @brief Computes the gather maps of an inner or left join of tables sorted in the given order.
+ *
+ * Each left row is joined with the range of equal right rows, found by binary searches of the
+ * right table. The output rows of each left row are at the offsets given by a scan of the sizes of
+ * the ranges, so the output is in the order of the left rows.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sorted_join(join_kind kind,
+            table_view const& left,
+            table_view const& right,
+            std::vector<order> const& column_order,
+            std::vector<null_order> const& null_precedence,
+            null_equality compare_nulls,
+            rmm::cuda_stream_view stream,
+            rmm::mr::device_memory_resource* mr)
+{
+  auto const left_num_rows = left.num_rows();
+  auto const lower = detail::lower_bound(right, left, column_order, null_precedence, stream);
+  auto const upper = detail::upper_bound(right, left, column_order, null_precedence, stream);
+
+  // The searches treat null keys as equal; with `null_equality::UNEQUAL`, left rows with a null
+  // key match nothing
+  rmm::device_buffer row_bitmask{};
+  if (compare_nulls == null_equality::UNEQUAL and nullable(left)) {
+    row_bitmask = detail::bitmask_and(left, stream).first;
+  }
+  join_output_count const count{lower->view().data<size_type>(),
+                                upper->view().data<size_type>(),
+                                static_cast<bitmask_type const*>(row_bitmask.data()),
+                                kind == join_kind::LEFT_JOIN};
+
+  rmm::device_uvector<std::size_t> offsets(left_num_rows + 1, stream);
+  offsets.set_element_to_zero_async(0, stream);
+  auto const counts = cudf::detail::make_counting_transform_iterator(0, count);
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), counts, counts + left_num_rows, offsets.begin() + 1);
+  auto const join_size = offsets.back_element(stream);
+
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  if (join_size == 0) { return std::make_pair(std::move(left_indices), std::move(right_indices)); }
+
+  // Mark the first output row of each left row with its index, and extend it to the following
+  // output rows of the same left row
+  thrust::uninitialized_fill(
+    rmm::exec_policy(stream), left_indices->begin(), left_indices->end(), 0);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     left_num_rows,
+                     [count, offsets = offsets.data(), out = left_indices->data()] __device__(
+                       size_type i) {
+                       if (count(i) > 0) { out[offsets[i]] = i; }
+                     });
+  thrust::inclusive_scan(rmm::exec_policy(stream),
+                         left_indices->begin(),
+                         left_indices->end(),
+                         left_indices->begin(),
+                         thrust::maximum<size_type>{});
+
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<std::size_t>(0),
+                    thrust::make_counting_iterator<std::size_t>(join_size),
+                    left_indices->begin(),
+                    right_indices->begin(),
+                    [count, offsets = offsets.data()] __device__(std::size_t p, size_type i) {
+                      if (count.matches(i) == 0) { return cudf::detail::JoinNoneValue; }
+                      return static_cast<size_type>(count.lower[i] + (p - offsets[i]));
+                    });
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_join(join_kind kind,
+                table_view const& left_keys,
+                table_view const& right_keys,
+                std::vector<order> const& column_order,
+                std::vector<null_order> const& null_precedence,
+                null_equality compare_nulls,
+                rmm::cuda_stream_view stream,
+                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(0 != left_keys.num_columns(), "Left table is empty");
+  CUDF_EXPECTS(0 != right_keys.num_columns(), "Right table is empty");
+  CUDF_EXPECTS(left_keys.num_columns() == right_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+
+  auto const sorted = cudf::is_sorted(left_keys, column_order, null_precedence, stream) and
+                      cudf::is_sorted(right_keys, column_order, null_precedence, stream);
+  if (not sorted) {
+    return kind == join_kind::INNER_JOIN
+             ? cudf::inner_join(left_keys, right_keys, compare_nulls, stream, mr)
+             : cudf::left_join(left_keys, right_keys, compare_nulls, stream, mr);
+  }
+  return sorted_join(
+    kind, left_keys, right_keys, column_order, null_precedence, compare_nulls, stream, mr);
+}
+
+}  // namespace
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_inner_join(cudf::table_view const& left_keys,
+                      cudf::table_view const& right_keys,
+                      std::vector<order> const& column_order,
+                      std::vector<null_order> const& null_precedence,
+                      null_equality compare_nulls,
+                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sort_merge_join(detail::join_kind::INNER_JOIN,
+                                 left_keys,
+                                 right_keys,
+                                 column_order,
+                                 null_precedence,
+                                 compare_nulls,
+                                 rmm::cuda_stream_default,
+                                 mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_left_join(cudf::table_view const& left_keys,
+                     cudf::table_view const& right_keys,
+                     std::vector<order> const& column_order,
+                     std::vector<null_order> const& null_precedence,
+                     null_equality compare_nulls,
+                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sort_merge_join(detail::join_kind::LEFT_JOIN,
+                                 left_keys,
+                                 right_keys,
+                                 column_order,
+                                 null_precedence,
+                                 compare_nulls,
+                                 rmm::cuda_stream_default,
+                                 mr);
+}
+
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,9 +18,12 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/label_bins.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/labeling/label_bins.hpp>
+#include <cudf/strings/detail/utilities.cuh>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
@@ -28,14 +31,17 @@
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 #include <rmm/mr/device/device_memory_resource.hpp>
 
 #include <thrust/advance.h>
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/distance.h>
 #include <thrust/execution_policy.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/pair.h>
 
 #include <limits>
@@ -102,20 +108,14 @@ struct filter_null_sentinel {
   __device__ bool operator()(size_type i) { return i != NULL_VALUE; }
 };
 
-// Bin the input by the edges in left_edges and right_edges.
+// Write the bin labels of the input, by the edges in left_edges and right_edges, to output.
 template <typename T, typename LeftComparator, typename RightComparator>
-std::unique_ptr<column> label_bins(column_view const& input,
-                                   column_view const& left_edges,
-                                   column_view const& right_edges,
-                                   rmm::cuda_stream_view stream,
-                                   rmm::mr::device_memory_resource* mr)
+void find_bins(column_view const& input,
+               column_view const& left_edges,
+               column_view const& right_edges,
+               size_type* output,
+               rmm::cuda_stream_view stream)
 {
-  auto output = make_numeric_column(
-    data_type(type_to_id<size_type>()), input.size(), mask_state::UNALLOCATED, stream, mr);
-  auto output_mutable_view = output->mutable_view();
-  auto output_begin        = output_mutable_view.begin<size_type>();
-  auto output_end          = output_mutable_view.end<size_type>();
-
   // These device column views are necessary for creating iterators that work
   // for columns of compound types. The column_view iterators fail for compound
   // types because they return raw pointers to the start of the data. The output
@@ -134,22 +134,17 @@ std::unique_ptr<column> label_bins(column_view const& input,
     thrust::transform(rmm::exec_policy(stream),
                       input_device_view->pair_begin<T, true>(),
                       input_device_view->pair_end<T, true>(),
-                      output_begin,
+                      output,
                       bin_finder<T, RandomAccessIterator, LeftComparator, RightComparator>(
                         left_begin, left_end, right_begin));
   } else {
     thrust::transform(rmm::exec_policy(stream),
                       input_device_view->pair_begin<T, false>(),
                       input_device_view->pair_end<T, false>(),
-                      output_begin,
+                      output,
                       bin_finder<T, RandomAccessIterator, LeftComparator, RightComparator>(
                         left_begin, left_end, right_begin));
   }
-
-  auto mask_and_count = valid_if(output_begin, output_end, filter_null_sentinel(), stream, mr);
-
-  output->set_null_mask(std::move(mask_and_count.first), mask_and_count.second);
-  return output;
 }
 
 template <typename T>
@@ -160,39 +155,71 @@ constexpr auto is_supported_bin_type()
 
 struct bin_type_dispatcher {
   template <typename T, typename... Args>
-  std::enable_if_t<not detail::is_supported_bin_type<T>(), std::unique_ptr<column>> operator()(
-    Args&&...)
+  std::enable_if_t<not detail::is_supported_bin_type<T>()> operator()(Args&&...)
   {
     CUDF_FAIL("Type not support for cudf::bin");
   }
 
   template <typename T>
-  std::enable_if_t<detail::is_supported_bin_type<T>(), std::unique_ptr<column>> operator()(
+  std::enable_if_t<detail::is_supported_bin_type<T>()> operator()(
     column_view const& input,
     column_view const& left_edges,
     inclusive left_inclusive,
     column_view const& right_edges,
     inclusive right_inclusive,
-    rmm::cuda_stream_view stream,
-    rmm::mr::device_memory_resource* mr)
+    size_type* output,
+    rmm::cuda_stream_view stream)
   {
     if ((left_inclusive == inclusive::YES) && (right_inclusive == inclusive::YES))
-      return label_bins<T, thrust::less_equal<T>, thrust::less_equal<T>>(
-        input, left_edges, right_edges, stream, mr);
+      return find_bins<T, thrust::less_equal<T>, thrust::less_equal<T>>(
+        input, left_edges, right_edges, output, stream);
     if ((left_inclusive == inclusive::YES) && (right_inclusive == inclusive::NO))
-      return label_bins<T, thrust::less_equal<T>, thrust::less<T>>(
-        input, left_edges, right_edges, stream, mr);
+      return find_bins<T, thrust::less_equal<T>, thrust::less<T>>(
+        input, left_edges, right_edges, output, stream);
     if ((left_inclusive == inclusive::NO) && (right_inclusive == inclusive::YES))
-      return label_bins<T, thrust::less<T>, thrust::less_equal<T>>(
-        input, left_edges, right_edges, stream, mr);
+      return find_bins<T, thrust::less<T>, thrust::less_equal<T>>(
+        input, left_edges, right_edges, output, stream);
     if ((left_inclusive == inclusive::NO) && (right_inclusive == inclusive::NO))
-      return label_bins<T, thrust::less<T>, thrust::less<T>>(
-        input, left_edges, right_edges, stream, mr);
+      return find_bins<T, thrust::less<T>, thrust::less<T>>(
+        input, left_edges, right_edges, output, stream);
 
     CUDF_FAIL("Undefined inclusive setting.");
   }
 };
 
+// Check that the input can be binned by the edges in left_edges and right_edges.
+void validate_bins(column_view const& input,
+                   column_view const& left_edges,
+                   column_view const& right_edges)
+{
+  CUDF_EXPECTS((input.type() == left_edges.type()) && (input.type() == right_edges.type()),
+               "The input and edge columns must have the same types.");
+  CUDF_EXPECTS(left_edges.size() == right_edges.size(),
+               "The left and right edge columns must be of the same length.");
+  CUDF_EXPECTS(!left_edges.has_nulls() && !right_edges.has_nulls(),
+               "The left and right edge columns cannot contain nulls.");
+}
+
+// Write the bin labels of the input to output, NULL_VALUE for the values in no bin.
+void find_bins(column_view const& input,
+               column_view const& left_edges,
+               inclusive left_inclusive,
+               column_view const& right_edges,
+               inclusive right_inclusive,
+               size_type* output,
+               rmm::cuda_stream_view stream)
+{
+  type_dispatcher<dispatch_storage_type>(input.type(),
+                                         detail::bin_type_dispatcher{},
+                                         input,
+                                         left_edges,
+                                         left_inclusive,
+                                         right_edges,
+                                         right_inclusive,
+                                         output,
+                                         stream);
+}
+
 }  // anonymous namespace
 
 /// Bin the input by the edges in left_edges and right_edges.
@@ -205,25 +232,70 @@ std::unique_ptr<column> label_bins(column_view const& input,
                                    rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE()
-  CUDF_EXPECTS((input.type() == left_edges.type()) && (input.type() == right_edges.type()),
-               "The input and edge columns must have the same types.");
-  CUDF_EXPECTS(left_edges.size() == right_edges.size(),
-               "The left and right edge columns must be of the same length.");
-  CUDF_EXPECTS(!left_edges.has_nulls() && !right_edges.has_nulls(),
-               "The left and right edge columns cannot contain nulls.");
+  validate_bins(input, left_edges, right_edges);
 
   // Handle empty inputs.
   if (input.is_empty()) { return make_empty_column(type_to_id<size_type>()); }
 
-  return type_dispatcher<dispatch_storage_type>(input.type(),
-                                                detail::bin_type_dispatcher{},
-                                                input,
-                                                left_edges,
-                                                left_inclusive,
-                                                right_edges,
-                                                right_inclusive,
-                                                stream,
-                                                mr);
+  auto output = make_numeric_column(
+    data_type(type_to_id<size_type>()), input.size(), mask_state::UNALLOCATED, stream, mr);
+  auto output_begin = output->mutable_view().begin<size_type>();
+  auto output_end   = output->mutable_view().end<size_type>();
+  find_bins(input, left_edges, left_inclusive, right_edges, right_inclusive, output_begin, stream);
+
+  auto mask_and_count = valid_if(output_begin, output_end, filter_null_sentinel(), stream, mr);
+
+  output->set_null_mask(std::move(mask_and_count.first), mask_and_count.second);
+  return output;
+}
+
+/// One-hot encode the input by the edges in left_edges and right_edges, as the index of its bin.
+std::unique_ptr<column> one_hot_encode_bins(column_view const& input,
+                                            column_view const& left_edges,
+                                            inclusive left_inclusive,
+                                            column_view const& right_edges,
+                                            inclusive right_inclusive,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE()
+  validate_bins(input, left_edges, right_edges);
+
+  auto const index_type = data_type{type_to_id<size_type>()};
+  if (input.is_empty()) {
+    return make_lists_column(0,
+                             make_empty_column(type_to_id<offset_type>()),
+                             make_empty_column(index_type),
+                             0,
+                             rmm::device_buffer{0, stream, mr},
+                             stream,
+                             mr);
+  }
+
+  rmm::device_uvector<size_type> labels(input.size(), stream);
+  find_bins(
+    input, left_edges, left_inclusive, right_edges, right_inclusive, labels.data(), stream);
+
+  // Each value is in at most one bin, so its list has at most one index
+  auto const counts = thrust::make_transform_iterator(
+    labels.begin(), [] __device__(size_type label) { return label != NULL_VALUE ? 1 : 0; });
+  auto offsets =
+    strings::detail::make_offsets_child_column(counts, counts + labels.size(), stream, mr);
+  auto const num_indices = get_value<offset_type>(offsets->view(), input.size(), stream);
+  auto indices = make_numeric_column(index_type, num_indices, mask_state::UNALLOCATED, stream, mr);
+  thrust::copy_if(rmm::exec_policy(stream),
+                  labels.begin(),
+                  labels.end(),
+                  indices->mutable_view().begin<size_type>(),
+                  filter_null_sentinel());
+
+  return make_lists_column(input.size(),
+                           std::move(offsets),
+                           std::move(indices),
+                           0,
+                           rmm::device_buffer{0, stream, mr},
+                           stream,
+                           mr);
 }
 
 }  // namespace detail
@@ -239,4 +311,16 @@ std::unique_ptr<column> label_bins(column_view const& input,
   return detail::label_bins(
     input, left_edges, left_inclusive, right_edges, right_inclusive, rmm::cuda_stream_default, mr);
 }
+
+/// One-hot encode the input by the edges in left_edges and right_edges, as the index of its bin.
+std::unique_ptr<column> one_hot_encode_bins(column_view const& input,
+                                            column_view const& left_edges,
+                                            inclusive left_inclusive,
+                                            column_view const& right_edges,
+                                            inclusive right_inclusive,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  return detail::one_hot_encode_bins(
+    input, left_edges, left_inclusive, right_edges, right_inclusive, rmm::cuda_stream_default, mr);
+}
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,8 +14,15 @@
  * limitations under the License.
  */
 
+#include <hash/hash_allocator.cuh>
+#include <hash/helper_functions.cuh>
+
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/lists/contains.hpp>
 #include <cudf/lists/list_device_view.cuh>
@@ -24,10 +31,24 @@
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/polymorphic_allocator.hpp>
+
+#include <cuco/static_map.cuh>
+
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/logical.h>
+#include <thrust/partition.h>
+#include <thrust/sequence.h>
+#include <thrust/tabulate.h>
+#include <thrust/uninitialized_fill.h>
+
+#include <algorithm>
+#include <limits>
 #include <type_traits>
 
 namespace cudf {
@@ -37,6 +58,31 @@ namespace {
 
 auto constexpr absent_index = size_type{-1};
 
+/**
+ * @brief Average list length threshold for deciding between a thread per list row and a warp per
+ * list row to scan the lists.
+ */
+constexpr size_type ELEMENTS_PER_VALID_ROW_THRESHOLD = 64;
+
+/**
+ * @brief Number of warps in the threadblocks of the warp-parallel kernel.
+ */
+constexpr int WARPS_PER_BLOCK = 8;
+
+/**
+ * @brief Returns whether the valid list rows are long enough, on average, to be scanned by a warp
+ * per row.
+ */
+bool is_warp_parallel(lists_column_view const& lists, rmm::cuda_stream_view stream)
+{
+  auto const valid_count = lists.size() - lists.null_count();
+  if (valid_count == 0) return false;
+  auto const num_elements =
+    cudf::detail::get_value<offset_type>(lists.offsets(), lists.offset() + lists.size(), stream) -
+    cudf::detail::get_value<offset_type>(lists.offsets(), lists.offset(), stream);
+  return num_elements / valid_count >= ELEMENTS_PER_VALID_ROW_THRESHOLD;
+}
+
 auto get_search_keys_device_iterable_view(cudf::column_view const& search_keys,
                                           rmm::cuda_stream_view stream)
 {
@@ -101,6 +147,253 @@ struct finder {
   };
 };
 
+/**
+ * @brief Returns the position of the first, or last, element of `list` equal to `search_key`,
+ * found by binary search, or `absent_index` if there is none.
+ *
+ * The valid elements of `list` must be sorted in ascending or descending order, and its nulls must
+ * be at its start or at its end.
+ */
+template <typename ElementType>
+__device__ size_type sorted_find(list_device_view const& list,
+                                 ElementType const& search_key,
+                                 bool find_first)
+{
+  auto const size    = list.size();
+  auto const indices = thrust::make_counting_iterator<size_type>(0);
+  if (size == 0) { return absent_index; }
+
+  // the valid elements are at [begin, end)
+  auto begin = size_type{0};
+  auto end   = size;
+  if (list.is_null(0)) {
+    begin = *thrust::partition_point(
+      thrust::seq, indices, indices + size, [&list](auto i) { return list.is_null(i); });
+  } else if (list.is_null(size - 1)) {
+    end = *thrust::partition_point(
+      thrust::seq, indices, indices + size, [&list](auto i) { return not list.is_null(i); });
+  }
+  if (begin == end) { return absent_index; }
+
+  auto const descending =
+    relational_compare(list.element<ElementType>(begin), list.element<ElementType>(end - 1)) ==
+    weak_ordering::GREATER;
+  auto const is_ordered = [&](size_type i, weak_ordering ordering) {
+    auto const element_ordering = relational_compare(list.element<ElementType>(i), search_key);
+    return element_ordering == ordering;
+  };
+  auto const before = descending ? weak_ordering::GREATER : weak_ordering::LESS;
+  auto const after  = descending ? weak_ordering::LESS : weak_ordering::GREATER;
+
+  if (find_first) {
+    auto const position = *thrust::partition_point(
+      thrust::seq, indices + begin, indices + end, [&](auto i) { return is_ordered(i, before); });
+    return position < end && equality_compare(list.element<ElementType>(position), search_key)
+             ? position
+             : absent_index;
+  }
+  auto const position =
+    *thrust::partition_point(
+      thrust::seq, indices + begin, indices + end, [&](auto i) { return !is_ordered(i, after); }) -
+    1;
+  return position >= begin && equality_compare(list.element<ElementType>(position), search_key)
+           ? position
+           : absent_index;
+}
+
+/**
+ * @brief Kernel searching each list row for its search key with a warp per row.
+ *
+ * Each round checks the consecutive elements assigned to the threads of the warp, and the search
+ * stops at the first round with a match.
+ *
+ * The kernel must be launched with `WARPS_PER_BLOCK * cudf::detail::warp_size` threads per
+ * threadblock.
+ */
+template <typename ElementType, bool search_keys_have_nulls, typename SearchKeyPairIter>
+__global__ void search_each_list_row_warp_parallel(
+  cudf::detail::lists_column_device_view const d_lists,
+  SearchKeyPairIter const search_key_pair_iter,
+  bool const find_first,
+  size_type* d_positions,
+  bool* d_validity)
+{
+  int const lane_idx     = threadIdx.x % cudf::detail::warp_size;
+  size_type const nwarps = gridDim.x * WARPS_PER_BLOCK;
+  for (size_type idx = blockIdx.x * WARPS_PER_BLOCK + threadIdx.x / cudf::detail::warp_size;
+       idx < d_lists.size();
+       idx += nwarps) {
+    auto const search_key_and_validity = search_key_pair_iter[idx];
+    auto const list                    = cudf::list_device_view(d_lists, idx);
+    if ((search_keys_have_nulls && !search_key_and_validity.second) || list.is_null()) {
+      if (lane_idx == 0) {
+        d_positions[idx] = absent_index;
+        d_validity[idx]  = false;
+      }
+      continue;
+    }
+
+    auto const search_key  = search_key_and_validity.first;
+    auto const size        = list.size();
+    auto const is_match_at = [&list, &search_key](size_type pos) {
+      return !list.is_null(pos) &&
+             cudf::equality_compare(list.element<ElementType>(pos), search_key);
+    };
+    auto position = absent_index;
+    if (find_first) {
+      for (size_type base = 0; base < size; base += cudf::detail::warp_size) {
+        auto const pos  = base + lane_idx;
+        auto const mask = __ballot_sync(0xFFFFFFFF, pos < size && is_match_at(pos));
+        if (mask) {
+          position = base + __ffs(mask) - 1;
+          break;
+        }
+      }
+    } else {
+      for (size_type base = size - 1; base >= 0; base -= cudf::detail::warp_size) {
+        auto const pos  = base - lane_idx;
+        auto const mask = __ballot_sync(0xFFFFFFFF, pos >= 0 && is_match_at(pos));
+        if (mask) {
+          position = base - __ffs(mask) + 1;
+          break;
+        }
+      }
+    }
+    if (lane_idx == 0) {
+      d_positions[idx] = position;
+      d_validity[idx]  = true;
+    }
+  }
+}
+
+using hash_table_allocator_type = rmm::mr::stream_allocator_adaptor<default_allocator<char>>;
+
+/**
+ * @brief Hash map of the list elements, from the index of an element to the index of the first
+ * equal element of the same list row inserted.
+ */
+using map_type =
+  cuco::static_map<size_type, size_type, cuda::thread_scope_device, hash_table_allocator_type>;
+
+/**
+ * @brief Searches each list row for its search key by probing a hash set of the elements of each
+ * list row.
+ *
+ * The list elements and the search keys are hashed as the rows of the index of their list row
+ * and their value, so that a single hash table holds the sets of all the list rows, and the work
+ * does not depend on how the elements are distributed among the lists.
+ *
+ * @param lists Lists column whose rows are to be searched
+ * @param search_keys Column of the search keys of the list rows
+ * @param find_option Whether to find the position of the first match or of the last one
+ * @param d_positions The positions of the search keys in the list rows
+ * @param d_validity Whether both the search key and the list row of each row are valid
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void search_each_list_row_hashed(lists_column_view const& lists,
+                                 column_view const& search_keys,
+                                 duplicate_find_option find_option,
+                                 size_type* d_positions,
+                                 bool* d_validity,
+                                 rmm::cuda_stream_view stream)
+{
+  auto const elements     = lists.get_sliced_child(stream);
+  auto const num_elements = elements.size();
+  auto const num_rows     = lists.size();
+  auto const d_lists      = column_device_view::create(lists.parent(), stream);
+  auto const d_skeys      = column_device_view::create(search_keys, stream);
+  auto const find_first   = find_option == duplicate_find_option::FIND_FIRST;
+
+  // the index of the list row of each element, followed by the index of each search key
+  rmm::device_uvector<size_type> labels(num_elements + num_rows, stream);
+  auto const offsets_begin = lists.offsets_begin();
+  auto const offsets       = thrust::make_transform_iterator(
+    offsets_begin, [offsets_begin] __device__(auto const idx) { return idx - *offsets_begin; });
+  thrust::upper_bound(rmm::exec_policy(stream),
+                      offsets + 1,
+                      offsets + 1 + num_rows,
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_elements),
+                      labels.begin());
+  thrust::sequence(rmm::exec_policy(stream), labels.begin() + num_elements, labels.end());
+
+  auto const values =
+    cudf::detail::concatenate(std::vector<column_view>{elements, search_keys}, stream);
+  auto const labels_view = column_view(
+    data_type{type_to_id<size_type>()}, static_cast<size_type>(labels.size()), labels.data());
+  auto const rows      = table_view{{labels_view, values->view()}};
+  auto const d_rows    = table_device_view::create(rows, stream);
+  auto const has_nulls = nullate::DYNAMIC{cudf::has_nulls(rows)};
+  auto const hasher    = row_hasher<default_hash, nullate::DYNAMIC>{has_nulls, *d_rows};
+  // null elements do not match any search key
+  auto const equal = row_equality_comparator<nullate::DYNAMIC>{
+    has_nulls, *d_rows, *d_rows, null_equality::UNEQUAL};
+
+  // the first, or last, element of each set of equal elements, at the index of the element
+  // inserted for the set
+  rmm::device_uvector<size_type> extremes(num_elements, stream);
+  map_type map{compute_hash_table_size(std::max(num_elements, size_type{1})),
+               std::numeric_limits<size_type>::max(),
+               std::numeric_limits<size_type>::max(),
+               hash_table_allocator_type{default_allocator<char>{}, stream},
+               stream.value()};
+  if (num_elements > 0) {
+    thrust::uninitialized_fill(rmm::exec_policy(stream),
+                               extremes.begin(),
+                               extremes.end(),
+                               find_first ? std::numeric_limits<size_type>::max() : size_type{-1});
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      num_elements,
+      [d_map = map.get_device_mutable_view(), hasher, equal] __device__(size_type idx) mutable {
+        d_map.insert(thrust::make_pair(idx, idx), hasher, equal);
+      });
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      num_elements,
+      [d_map    = map.get_device_view(),
+       hasher,
+       equal,
+       find_first,
+       extremes = extremes.data()] __device__(size_type idx) {
+        auto const slot = d_map.find(idx, hasher, equal);
+        if (slot == d_map.end()) { return; }  // null elements are never found
+        auto const representative = slot->second.load(cuda::std::memory_order_relaxed);
+        if (find_first) {
+          atomicMin(extremes + representative, idx);
+        } else {
+          atomicMax(extremes + representative, idx);
+        }
+      });
+  }
+
+  auto output_iterator = thrust::make_zip_iterator(thrust::make_tuple(d_positions, d_validity));
+  thrust::tabulate(
+    rmm::exec_policy(stream),
+    output_iterator,
+    output_iterator + num_rows,
+    [d_map    = map.get_device_view(),
+     hasher,
+     equal,
+     d_lists  = *d_lists,
+     d_skeys  = *d_skeys,
+     offsets_begin,
+     num_elements,
+     extremes = extremes.data()] __device__(auto row_index) -> thrust::pair<size_type, bool> {
+      if (d_skeys.is_null(row_index) || d_lists.is_null(row_index)) {
+        return {absent_index, false};
+      }
+      if (num_elements == 0) { return {absent_index, true}; }
+      auto const slot = d_map.find(num_elements + row_index, hasher, equal);
+      if (slot == d_map.end()) { return {absent_index, true}; }
+      auto const representative = slot->second.load(cuda::std::memory_order_relaxed);
+      auto const list_begin     = offsets_begin[row_index] - offsets_begin[0];
+      return {extremes[representative] - list_begin, true};
+    });
+}
+
 /**
  * @brief Functor to search each list row for the specified search keys.
  */
@@ -140,6 +433,7 @@ struct lookup_functor {
   void search_each_list_row(cudf::detail::lists_column_device_view const& d_lists,
                             SearchKeyPairIter search_key_pair_iter,
                             duplicate_find_option find_option,
+                            bool binary_search,
                             cudf::mutable_column_device_view ret_positions,
                             cudf::mutable_column_device_view ret_validity,
                             rmm::cuda_stream_view stream) const
@@ -151,8 +445,11 @@ struct lookup_functor {
       rmm::exec_policy(stream),
       output_iterator,
       output_iterator + d_lists.size(),
-      [d_lists, search_key_pair_iter, absent_index = absent_index, find_option] __device__(
-        auto row_index) -> thrust::pair<size_type, bool> {
+      [d_lists,
+       search_key_pair_iter,
+       absent_index = absent_index,
+       find_option,
+       binary_search] __device__(auto row_index) -> thrust::pair<size_type, bool> {
         auto [search_key, search_key_is_valid] = search_key_pair_iter[row_index];
 
         if (search_keys_have_nulls && !search_key_is_valid) { return {absent_index, false}; }
@@ -160,6 +457,10 @@ struct lookup_functor {
         auto list = cudf::list_device_view(d_lists, row_index);
         if (list.is_null()) { return {absent_index, false}; }
 
+        if (binary_search) {
+          return {sorted_find(list, search_key, find_option == duplicate_find_option::FIND_FIRST),
+                  true};
+        }
         auto const position = find_option == duplicate_find_option::FIND_FIRST
                                 ? finder<duplicate_find_option::FIND_FIRST>{}(list, search_key)
                                 : finder<duplicate_find_option::FIND_LAST>{}(list, search_key);
@@ -172,6 +473,7 @@ struct lookup_functor {
     cudf::lists_column_view const& lists,
     SearchKeyType const& search_key,
     duplicate_find_option find_option,
+    search_strategy strategy,
     rmm::cuda_stream_view stream,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const
   {
@@ -210,12 +512,35 @@ struct lookup_functor {
     auto search_key_iter =
       cudf::detail::make_pair_rep_iterator<ElementType, search_keys_have_nulls>(*d_skeys);
 
-    search_each_list_row<ElementType>(d_lists,
-                                      search_key_iter,
-                                      find_option,
-                                      *mutable_result_positions,
-                                      *mutable_result_validity,
-                                      stream);
+    if (strategy == search_strategy::HASH_TABLE) {
+      // scalar search keys are broadcast to columns before dispatching to the hash table search
+      if constexpr (not search_key_is_scalar) {
+        search_each_list_row_hashed(lists,
+                                    search_key,
+                                    find_option,
+                                    result_positions->mutable_view().data<size_type>(),
+                                    result_validity->mutable_view().data<bool>(),
+                                    stream);
+      }
+    } else if (strategy == search_strategy::LINEAR_SCAN && is_warp_parallel(lists, stream)) {
+      search_each_list_row_warp_parallel<ElementType, search_keys_have_nulls>
+        <<<std::min(65536, cudf::util::div_rounding_up_unsafe(lists.size(), WARPS_PER_BLOCK)),
+           WARPS_PER_BLOCK * cudf::detail::warp_size,
+           0,
+           stream.value()>>>(d_lists,
+                             search_key_iter,
+                             find_option == duplicate_find_option::FIND_FIRST,
+                             result_positions->mutable_view().data<size_type>(),
+                             result_validity->mutable_view().data<bool>());
+    } else {
+      search_each_list_row<ElementType>(d_lists,
+                                        search_key_iter,
+                                        find_option,
+                                        strategy == search_strategy::BINARY_SEARCH,
+                                        *mutable_result_positions,
+                                        *mutable_result_validity,
+                                        stream);
+    }
 
     auto [null_mask, num_nulls] = construct_null_mask(lists, result_validity->view(), stream, mr);
     result_positions->set_null_mask(std::move(null_mask), num_nulls);
@@ -252,65 +577,78 @@ std::unique_ptr<column> to_contains(std::unique_ptr<column>&& key_positions,
 namespace detail {
 /**
  * @copydoc cudf::lists::index_of(cudf::lists_column_view const&,
- *                                cudf::scalar const&,
+ *                                cudf::column_view const&,
  *                                duplicate_find_option,
+ *                                search_strategy,
  *                                rmm::mr::device_memory_resource*)
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
 std::unique_ptr<column> index_of(
   cudf::lists_column_view const& lists,
-  cudf::scalar const& search_key,
+  cudf::column_view const& search_keys,
   duplicate_find_option find_option,
+  search_strategy strategy,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
-  return search_key.is_valid(stream)
-           ? cudf::type_dispatcher(search_key.type(),
-                                   lookup_functor<false>{},  // No nulls in search key
+  CUDF_EXPECTS(search_keys.size() == lists.size(),
+               "Number of search keys must match list column size.");
+
+  return search_keys.has_nulls()
+           ? cudf::type_dispatcher(search_keys.type(),
+                                   lookup_functor<true>{},  // Nulls in search keys
                                    lists,
-                                   search_key,
+                                   search_keys,
                                    find_option,
+                                   strategy,
                                    stream,
                                    mr)
-           : cudf::type_dispatcher(search_key.type(),
-                                   lookup_functor<true>{},  // Nulls in search key
+           : cudf::type_dispatcher(search_keys.type(),
+                                   lookup_functor<false>{},  // No nulls in search keys
                                    lists,
-                                   search_key,
+                                   search_keys,
                                    find_option,
+                                   strategy,
                                    stream,
                                    mr);
 }
 
 /**
  * @copydoc cudf::lists::index_of(cudf::lists_column_view const&,
- *                                cudf::column_view const&,
+ *                                cudf::scalar const&,
  *                                duplicate_find_option,
+ *                                search_strategy,
  *                                rmm::mr::device_memory_resource*)
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
 std::unique_ptr<column> index_of(
   cudf::lists_column_view const& lists,
-  cudf::column_view const& search_keys,
+  cudf::scalar const& search_key,
   duplicate_find_option find_option,
+  search_strategy strategy,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
-  CUDF_EXPECTS(search_keys.size() == lists.size(),
-               "Number of search keys must match list column size.");
-
-  return search_keys.has_nulls()
-           ? cudf::type_dispatcher(search_keys.type(),
-                                   lookup_functor<true>{},  // Nulls in search keys
+  // the hash table is probed with a search key per list row
+  if (strategy == search_strategy::HASH_TABLE && search_key.is_valid(stream)) {
+    auto const search_keys = make_column_from_scalar(search_key, lists.size(), stream);
+    return index_of(lists, search_keys->view(), find_option, strategy, stream, mr);
+  }
+  return search_key.is_valid(stream)
+           ? cudf::type_dispatcher(search_key.type(),
+                                   lookup_functor<false>{},  // No nulls in search key
                                    lists,
-                                   search_keys,
+                                   search_key,
                                    find_option,
+                                   strategy,
                                    stream,
                                    mr)
-           : cudf::type_dispatcher(search_keys.type(),
-                                   lookup_functor<false>{},  // No nulls in search keys
+           : cudf::type_dispatcher(search_key.type(),
+                                   lookup_functor<true>{},  // Nulls in search key
                                    lists,
-                                   search_keys,
+                                   search_key,
                                    find_option,
+                                   strategy,
                                    stream,
                                    mr);
 }
@@ -318,26 +656,32 @@ std::unique_ptr<column> index_of(
 /**
  * @copydoc cudf::lists::contains(cudf::lists_column_view const&,
  *                                cudf::scalar const&,
+ *                                search_strategy,
  *                                rmm::mr::device_memory_resource*)
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
 std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
                                  cudf::scalar const& search_key,
+                                 search_strategy strategy,
                                  rmm::cuda_stream_view stream,
                                  rmm::mr::device_memory_resource* mr)
 {
   return to_contains(
-    index_of(lists, search_key, duplicate_find_option::FIND_FIRST, stream), stream, mr);
+    index_of(lists, search_key, duplicate_find_option::FIND_FIRST, strategy, stream),
+    stream,
+    mr);
 }
 
 /**
  * @copydoc cudf::lists::contains(cudf::lists_column_view const&,
  *                                cudf::column_view const&,
+ *                                search_strategy,
  *                                rmm::mr::device_memory_resource*)
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
 std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
                                  cudf::column_view const& search_keys,
+                                 search_strategy strategy,
                                  rmm::cuda_stream_view stream,
                                  rmm::mr::device_memory_resource* mr)
 {
@@ -345,7 +689,9 @@ std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
                "Number of search keys must match list column size.");
 
   return to_contains(
-    index_of(lists, search_keys, duplicate_find_option::FIND_FIRST, stream), stream, mr);
+    index_of(lists, search_keys, duplicate_find_option::FIND_FIRST, strategy, stream),
+    stream,
+    mr);
 }
 
 /**
@@ -388,18 +734,20 @@ std::unique_ptr<column> contains_nulls(cudf::lists_column_view const& input_list
 
 std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
                                  cudf::scalar const& search_key,
+                                 search_strategy strategy,
                                  rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::contains(lists, search_key, rmm::cuda_stream_default, mr);
+  return detail::contains(lists, search_key, strategy, rmm::cuda_stream_default, mr);
 }
 
 std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
                                  cudf::column_view const& search_keys,
+                                 search_strategy strategy,
                                  rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::contains(lists, search_keys, rmm::cuda_stream_default, mr);
+  return detail::contains(lists, search_keys, strategy, rmm::cuda_stream_default, mr);
 }
 
 std::unique_ptr<column> contains_nulls(cudf::lists_column_view const& input_lists,
@@ -412,19 +760,22 @@ std::unique_ptr<column> contains_nulls(cudf::lists_column_view const& input_list
 std::unique_ptr<column> index_of(cudf::lists_column_view const& lists,
                                  cudf::scalar const& search_key,
                                  duplicate_find_option find_option,
+                                 search_strategy strategy,
                                  rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::index_of(lists, search_key, find_option, rmm::cuda_stream_default, mr);
+  return detail::index_of(lists, search_key, find_option, strategy, rmm::cuda_stream_default, mr);
 }
 
 std::unique_ptr<column> index_of(cudf::lists_column_view const& lists,
                                  cudf::column_view const& search_keys,
                                  duplicate_find_option find_option,
+                                 search_strategy strategy,
                                  rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::index_of(lists, search_keys, find_option, rmm::cuda_stream_default, mr);
+  return detail::index_of(
+    lists, search_keys, find_option, strategy, rmm::cuda_stream_default, mr);
 }
 
 }  // namespace lists
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,13 +21,20 @@
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/concatenate.cuh>
-#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/tabulate.h>
+
 #include <memory>
+#include <vector>
 
 namespace cudf {
 namespace lists {
@@ -35,13 +42,51 @@ namespace detail {
 
 namespace {
 
+/**
+ * @brief Returns the bounds in its child of the lists of each column.
+ *
+ * The bounds of all the columns are copied back together, so that slicing the children of many
+ * small columns synchronizes once instead of once per column.
+ *
+ * @param[in] columns               Vector of lists columns to concatenate
+ * @param[in] stream                CUDA stream used for device memory operations
+ * and kernel launches.
+ * @return The first and one past the last child rows of each column, interleaved
+ */
+std::vector<size_type> child_bounds(host_span<lists_column_view const> columns,
+                                    rmm::cuda_stream_view stream)
+{
+  std::vector<size_type const*> h_offsets;
+  std::vector<size_type> h_sizes;
+  for (auto const& c : columns) {
+    h_offsets.push_back(c.size() > 0 ? c.offsets().data<size_type>() + c.offset() : nullptr);
+    h_sizes.push_back(c.size());
+  }
+  auto const d_offsets = cudf::detail::make_device_uvector_async(h_offsets, stream);
+  auto const d_sizes   = cudf::detail::make_device_uvector_async(h_sizes, stream);
+
+  rmm::device_uvector<size_type> bounds(2 * columns.size(), stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<std::size_t>(0),
+                     columns.size(),
+                     [offsets = d_offsets.data(),
+                      sizes   = d_sizes.data(),
+                      bounds  = bounds.data()] __device__(std::size_t i) {
+                       bounds[2 * i]     = offsets[i] ? offsets[i][0] : 0;
+                       bounds[2 * i + 1] = offsets[i] ? offsets[i][sizes[i]] : 0;
+                     });
+  return cudf::detail::make_std_vector_sync(bounds, stream);
+}
+
 /**
  * @brief Merges the offsets child columns of multiple list columns into one.
  *
  * Since offsets are all relative to the start of their respective column,
- * all offsets are shifted to account for the new starting position
+ * all offsets are shifted to account for the new starting position. All the
+ * columns are shifted by a single kernel.
  *
  * @param[in] columns               Vector of lists columns to concatenate
+ * @param[in] bounds                Bounds of the lists of each column, from `child_bounds`
  * @param[in] total_list_count      Total number of lists contained in the columns
  * @param[in] stream                CUDA stream used for device memory operations
  * and kernel launches.
@@ -49,6 +94,7 @@ namespace {
  * returned column's device memory.
  */
 std::unique_ptr<column> merge_offsets(host_span<lists_column_view const> columns,
+                                      host_span<size_type const> bounds,
                                       size_type total_list_count,
                                       rmm::cuda_stream_view stream,
                                       rmm::mr::device_memory_resource* mr)
@@ -56,30 +102,43 @@ std::unique_ptr<column> merge_offsets(host_span<lists_column_view const> columns
   // outgoing offsets
   auto merged_offsets = cudf::make_fixed_width_column(
     data_type{type_id::INT32}, total_list_count + 1, mask_state::UNALLOCATED, stream, mr);
-  mutable_column_device_view d_merged_offsets(*merged_offsets, 0, 0);
 
-  // merge offsets
-  // TODO : this could probably be done as a single gpu operation if done as a kernel.
+  // the first output list, offsets and shift of each column
+  std::vector<size_type> h_list_starts;
+  std::vector<size_type const*> h_offsets;
+  std::vector<size_type> h_shifts;
   size_type shift = 0;
   size_type count = 0;
-  std::for_each(columns.begin(), columns.end(), [&](lists_column_view const& c) {
-    if (c.size() > 0) {
-      // handle sliced columns
-      int const local_shift =
-        shift -
-        (c.offset() > 0 ? cudf::detail::get_value<size_type>(c.offsets(), c.offset(), stream) : 0);
-      column_device_view offsets(c.offsets(), nullptr, nullptr);
-      thrust::transform(
-        rmm::exec_policy(stream),
-        offsets.begin<size_type>() + c.offset(),
-        offsets.begin<size_type>() + c.offset() + c.size() + 1,
-        d_merged_offsets.begin<size_type>() + count,
-        [local_shift] __device__(size_type offset) { return offset + local_shift; });
-
-      shift += c.get_sliced_child(stream).size();
-      count += c.size();
-    }
-  });
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    auto const& c = columns[i];
+    if (c.size() == 0) { continue; }
+    h_list_starts.push_back(count);
+    h_offsets.push_back(c.offsets().data<size_type>() + c.offset());
+    // handle sliced columns
+    h_shifts.push_back(shift - bounds[2 * i]);
+    shift += bounds[2 * i + 1] - bounds[2 * i];
+    count += c.size();
+  }
+  auto const d_list_starts = cudf::detail::make_device_uvector_async(h_list_starts, stream);
+  auto const d_offsets     = cudf::detail::make_device_uvector_async(h_offsets, stream);
+  auto const d_shifts      = cudf::detail::make_device_uvector_async(h_shifts, stream);
+
+  thrust::tabulate(
+    rmm::exec_policy(stream),
+    merged_offsets->mutable_view().begin<size_type>(),
+    merged_offsets->mutable_view().end<size_type>(),
+    [list_starts      = d_list_starts.data(),
+     offsets          = d_offsets.data(),
+     shifts           = d_shifts.data(),
+     num_columns      = d_list_starts.size(),
+     total_child_size = shift,
+     total_list_count] __device__(size_type row) {
+      if (row == total_list_count) { return total_child_size; }
+      auto const index =
+        thrust::upper_bound(thrust::seq, list_starts, list_starts + num_columns, row) -
+        list_starts - 1;
+      return offsets[index][row - list_starts[index]] + shifts[index];
+    });
 
   return merged_offsets;
 }
@@ -102,20 +161,20 @@ std::unique_ptr<column> concatenate(
     });
 
   // concatenate children. also prep data needed for offset merging
+  auto const bounds = child_bounds(lists_columns, stream);
   std::vector<column_view> children;
   children.reserve(columns.size());
   size_type total_list_count = 0;
-  std::for_each(lists_columns.begin(),
-                lists_columns.end(),
-                [&total_list_count, &children, stream](lists_column_view const& l) {
-                  // count total # of lists
-                  total_list_count += l.size();
-                  children.push_back(l.get_sliced_child(stream));
-                });
+  for (std::size_t i = 0; i < lists_columns.size(); ++i) {
+    // count total # of lists
+    total_list_count += lists_columns[i].size();
+    children.push_back(
+      cudf::detail::slice(lists_columns[i].child(), bounds[2 * i], bounds[2 * i + 1]));
+  }
   auto data = cudf::detail::concatenate(children, stream, mr);
 
   // merge offsets
-  auto offsets = merge_offsets(lists_columns, total_list_count, stream, mr);
+  auto offsets = merge_offsets(lists_columns, bounds, total_list_count, stream, mr);
 
   // if any of the input columns have nulls, construct the output mask
   bool const has_nulls =
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -43,11 +43,34 @@ constexpr size_type InvalidIndex = -1;
 
 namespace {
 
+/**
+ * @brief Maps the index of an exploded row to the index of the list it comes from, with a binary
+ * search of the offsets of the explode column.
+ *
+ * Gathering the other columns through this functor does not materialize a gather map of the
+ * size of the exploded table.
+ */
+struct exploded_row_to_list_index {
+  offset_type const* offsets;  // The offsets of the explode column, which may be sliced
+  size_type num_lists;
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    // The list of row `idx` is the first one that ends after it
+    auto const list_ends = offsets + 1;
+    auto const list_end =
+      thrust::upper_bound(thrust::seq, list_ends, list_ends + num_lists, offsets[0] + idx);
+    return static_cast<size_type>(thrust::distance(list_ends, list_end));
+  }
+};
+
+template <typename GatherMapIterator>
 std::unique_ptr<table> build_table(
   table_view const& input_table,
   size_type const explode_column_idx,
   column_view const& sliced_child,
-  cudf::device_span<size_type const> gather_map,
+  GatherMapIterator gather_map_begin,
+  size_type gather_map_size,
   thrust::optional<cudf::device_span<size_type const>> explode_col_gather_map,
   thrust::optional<rmm::device_uvector<size_type>> position_array,
   rmm::cuda_stream_view stream,
@@ -59,8 +82,8 @@ std::unique_ptr<table> build_table(
 
   auto gathered_table =
     detail::gather(input_table.select(select_iter, select_iter + input_table.num_columns() - 1),
-                   gather_map.begin(),
-                   gather_map.end(),
+                   gather_map_begin,
+                   gather_map_begin + gather_map_size,
                    cudf::out_of_bounds_policy::DONT_CHECK,
                    stream,
                    mr);
@@ -109,29 +132,18 @@ std::unique_ptr<table> explode(table_view const& input_table,
 {
   lists_column_view explode_col{input_table.column(explode_column_idx)};
   auto sliced_child = explode_col.get_sliced_child(stream);
-  rmm::device_uvector<size_type> gather_map(sliced_child.size(), stream);
-
-  // Sliced columns may require rebasing of the offsets.
-  auto offsets = explode_col.offsets_begin();
-  // offsets + 1 here to skip the 0th offset, which removes a - 1 operation later.
-  auto offsets_minus_one = thrust::make_transform_iterator(
-    thrust::next(offsets), [offsets] __device__(auto i) { return (i - offsets[0]) - 1; });
-  auto counting_iter = thrust::make_counting_iterator(0);
 
-  // This looks like an off-by-one bug, but what is going on here is that we need to reduce each
-  // result from `lower_bound` by 1 to build the correct gather map. This can be accomplished by
-  // skipping the first entry and using the result of `lower_bound` directly.
-  thrust::lower_bound(rmm::exec_policy(stream),
-                      offsets_minus_one,
-                      offsets_minus_one + explode_col.size(),
-                      counting_iter,
-                      counting_iter + gather_map.size(),
-                      gather_map.begin());
+  // The other columns are gathered through the list index of each exploded row, computed on the
+  // fly from the offsets.
+  auto gather_map = thrust::make_transform_iterator(
+    thrust::make_counting_iterator(0),
+    exploded_row_to_list_index{explode_col.offsets_begin(), explode_col.size()});
 
   return build_table(input_table,
                      explode_column_idx,
                      sliced_child,
                      gather_map,
+                     sliced_child.size(),
                      thrust::nullopt,
                      thrust::nullopt,
                      stream,
@@ -145,40 +157,27 @@ std::unique_ptr<table> explode_position(table_view const& input_table,
 {
   lists_column_view explode_col{input_table.column(explode_column_idx)};
   auto sliced_child = explode_col.get_sliced_child(stream);
-  rmm::device_uvector<size_type> gather_map(sliced_child.size(), stream);
 
-  // Sliced columns may require rebasing of the offsets.
-  auto offsets = explode_col.offsets_begin();
-  // offsets + 1 here to skip the 0th offset, which removes a - 1 operation later.
-  auto offsets_minus_one = thrust::make_transform_iterator(
-    offsets + 1, [offsets] __device__(auto i) { return (i - offsets[0]) - 1; });
-  auto counting_iter = thrust::make_counting_iterator(0);
+  auto const offsets = explode_col.offsets_begin();
+  auto gather_map    = thrust::make_transform_iterator(
+    thrust::make_counting_iterator(0), exploded_row_to_list_index{offsets, explode_col.size()});
 
+  // The position of each exploded row in its list
   rmm::device_uvector<size_type> pos(sliced_child.size(), stream, mr);
-
-  // This looks like an off-by-one bug, but what is going on here is that we need to reduce each
-  // result from `lower_bound` by 1 to build the correct gather map. This can be accomplished by
-  // skipping the first entry and using the result of `lower_bound` directly.
-  thrust::transform(
-    rmm::exec_policy(stream),
-    counting_iter,
-    counting_iter + gather_map.size(),
-    gather_map.begin(),
-    [position_array = pos.data(),
-     offsets_minus_one,
-     offsets,
-     offset_size = explode_col.size()] __device__(auto idx) -> size_type {
-      auto lb_idx = thrust::distance(
-        offsets_minus_one,
-        thrust::lower_bound(thrust::seq, offsets_minus_one, offsets_minus_one + offset_size, idx));
-      position_array[idx] = idx - (offsets[lb_idx] - offsets[0]);
-      return lb_idx;
-    });
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator(0),
+                    thrust::make_counting_iterator(sliced_child.size()),
+                    gather_map,
+                    pos.begin(),
+                    [offsets] __device__(auto idx, auto list_idx) {
+                      return idx - (offsets[list_idx] - offsets[0]);
+                    });
 
   return build_table(input_table,
                      explode_column_idx,
                      sliced_child,
                      gather_map,
+                     sliced_child.size(),
                      thrust::nullopt,
                      std::move(pos),
                      stream,
@@ -273,7 +272,8 @@ std::unique_ptr<table> explode_outer(table_view const& input_table,
     input_table,
     explode_column_idx,
     sliced_child,
-    gather_map,
+    gather_map.begin(),
+    static_cast<size_type>(gather_map.size()),
     explode_col_gather_map,
     include_position ? std::move(pos) : thrust::optional<rmm::device_uvector<size_type>>{},
     stream,
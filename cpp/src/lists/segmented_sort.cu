@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -35,8 +35,9 @@
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/copy.h>
+#include <thrust/sequence.h>
 
-#include <cub/device/device_segmented_radix_sort.cuh>
+#include <cub/device/device_segmented_sort.cuh>
 
 namespace cudf {
 namespace lists {
@@ -56,34 +57,30 @@ struct SegmentedSortColumn {
   {
     rmm::device_buffer d_temp_storage;
     size_t temp_storage_bytes = 0;
-    cub::DeviceSegmentedRadixSort::SortPairs(d_temp_storage.data(),
-                                             temp_storage_bytes,
-                                             keys_in,
-                                             keys_out,
-                                             values_in,
-                                             values_out,
-                                             num_items,
-                                             num_segments,
-                                             begin_offsets,
-                                             end_offsets,
-                                             0,
-                                             sizeof(KeyT) * 8,
-                                             stream.value());
+    cub::DeviceSegmentedSort::SortPairs(d_temp_storage.data(),
+                                        temp_storage_bytes,
+                                        keys_in,
+                                        keys_out,
+                                        values_in,
+                                        values_out,
+                                        num_items,
+                                        num_segments,
+                                        begin_offsets,
+                                        end_offsets,
+                                        stream.value());
     d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
 
-    cub::DeviceSegmentedRadixSort::SortPairs(d_temp_storage.data(),
-                                             temp_storage_bytes,
-                                             keys_in,
-                                             keys_out,
-                                             values_in,
-                                             values_out,
-                                             num_items,
-                                             num_segments,
-                                             begin_offsets,
-                                             end_offsets,
-                                             0,
-                                             sizeof(KeyT) * 8,
-                                             stream.value());
+    cub::DeviceSegmentedSort::SortPairs(d_temp_storage.data(),
+                                        temp_storage_bytes,
+                                        keys_in,
+                                        keys_out,
+                                        values_in,
+                                        values_out,
+                                        num_items,
+                                        num_segments,
+                                        begin_offsets,
+                                        end_offsets,
+                                        stream.value());
   }
 
   template <typename KeyT, typename ValueT, typename OffsetIteratorT>
@@ -99,34 +96,30 @@ struct SegmentedSortColumn {
   {
     rmm::device_buffer d_temp_storage;
     size_t temp_storage_bytes = 0;
-    cub::DeviceSegmentedRadixSort::SortPairsDescending(d_temp_storage.data(),
-                                                       temp_storage_bytes,
-                                                       keys_in,
-                                                       keys_out,
-                                                       values_in,
-                                                       values_out,
-                                                       num_items,
-                                                       num_segments,
-                                                       begin_offsets,
-                                                       end_offsets,
-                                                       0,
-                                                       sizeof(KeyT) * 8,
-                                                       stream.value());
+    cub::DeviceSegmentedSort::SortPairsDescending(d_temp_storage.data(),
+                                                  temp_storage_bytes,
+                                                  keys_in,
+                                                  keys_out,
+                                                  values_in,
+                                                  values_out,
+                                                  num_items,
+                                                  num_segments,
+                                                  begin_offsets,
+                                                  end_offsets,
+                                                  stream.value());
     d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
 
-    cub::DeviceSegmentedRadixSort::SortPairsDescending(d_temp_storage.data(),
-                                                       temp_storage_bytes,
-                                                       keys_in,
-                                                       keys_out,
-                                                       values_in,
-                                                       values_out,
-                                                       num_items,
-                                                       num_segments,
-                                                       begin_offsets,
-                                                       end_offsets,
-                                                       0,
-                                                       sizeof(KeyT) * 8,
-                                                       stream.value());
+    cub::DeviceSegmentedSort::SortPairsDescending(d_temp_storage.data(),
+                                                  temp_storage_bytes,
+                                                  keys_in,
+                                                  keys_out,
+                                                  values_in,
+                                                  values_out,
+                                                  num_items,
+                                                  num_segments,
+                                                  begin_offsets,
+                                                  end_offsets,
+                                                  stream.value());
   }
 
   template <typename T>
@@ -157,20 +150,7 @@ struct SegmentedSortColumn {
     rmm::cuda_stream_view stream,
     rmm::mr::device_memory_resource* mr)
   {
-    // the average list size at which to prefer radixsort:
-    constexpr cudf::size_type MIN_AVG_LIST_SIZE_FOR_RADIXSORT{100};
-
-    if ((child.size() / offsets.size()) < MIN_AVG_LIST_SIZE_FOR_RADIXSORT) {
-      auto child_table = segmented_sort_by_key(table_view{{child}},
-                                               table_view{{child}},
-                                               offsets,
-                                               {column_order},
-                                               {null_precedence},
-                                               stream,
-                                               mr);
-      return std::move(child_table->release().front());
-    }
-
+    // The lists are binned by size, and sorted by a warp, a block or the whole device
     auto output =
       cudf::detail::allocate_like(child, child.size(), mask_allocation_policy::NEVER, stream, mr);
     mutable_column_view mutable_output_view = output->mutable_view();
@@ -194,15 +174,14 @@ struct SegmentedSortColumn {
     std::unique_ptr<column> sorted_indices = cudf::make_numeric_column(
       data_type(type_to_id<size_type>()), child.size(), mask_state::UNALLOCATED, stream, mr);
     mutable_column_view mutable_indices_view = sorted_indices->mutable_view();
-    thrust::sequence(rmm::exec_policy(stream),
-                     mutable_indices_view.begin<size_type>(),
-                     mutable_indices_view.end<size_type>(),
-                     0);
+    // The segmented sort does not sort in place
+    rmm::device_uvector<size_type> indices(child.size(), stream);
+    thrust::sequence(rmm::exec_policy(stream), indices.begin(), indices.end(), 0);
 
     if (column_order == order::ASCENDING)
       SortPairsAscending(child.nullable() ? keys.data() : child.begin<T>(),
                          mutable_output_view.begin<T>(),
-                         mutable_indices_view.begin<size_type>(),
+                         indices.data(),
                          mutable_indices_view.begin<size_type>(),
                          child.size(),
                          offsets.size() - 1,
@@ -212,7 +191,7 @@ struct SegmentedSortColumn {
     else
       SortPairsDescending(child.nullable() ? keys.data() : child.begin<T>(),
                           mutable_output_view.begin<T>(),
-                          mutable_indices_view.begin<size_type>(),
+                          indices.data(),
                           mutable_indices_view.begin<size_type>(),
                           child.size(),
                           offsets.size() - 1,
@@ -248,7 +227,7 @@ std::unique_ptr<column> sort_lists(lists_column_view const& input,
                     [first = input.offsets_begin()] __device__(auto offset_index) {
                       return offset_index - *first;
                     });
-  // for numeric columns, calls Faster segmented radix sort path
+  // for numeric columns, calls Faster segmented sort path
   // for non-numeric columns, calls segmented_sort_by_key.
   auto output_child = type_dispatcher(input.child().type(),
                                       SegmentedSortColumn{},
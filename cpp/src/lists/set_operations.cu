@@ -0,0 +1,680 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <hash/hash_allocator.cuh>
+#include <hash/helper_functions.cuh>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/structs/utilities.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/lists/detail/set_operations.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/polymorphic_allocator.hpp>
+
+#include <cuco/static_map.cuh>
+
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+#include <thrust/uninitialized_fill.h>
+
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace cudf::lists {
+namespace detail {
+namespace {
+
+using hash_table_allocator_type = rmm::mr::stream_allocator_adaptor<default_allocator<char>>;
+
+/**
+ * @brief Hash map of the list entries, from the index of an entry to the index of the first equal
+ * entry of the same list inserted.
+ */
+using map_type =
+  cuco::static_map<size_type, size_type, cuda::thread_scope_device, hash_table_allocator_type>;
+
+constexpr size_type unused_key{std::numeric_limits<size_type>::max()};
+constexpr size_type unused_value{std::numeric_limits<size_type>::max()};
+
+/**
+ * @brief Marks the valid rows of a floating-point column that are NaN, and returns whether the
+ * column is of a floating-point type.
+ */
+struct mark_nans_fn {
+  template <typename T, CUDF_ENABLE_IF(std::is_floating_point_v<T>)>
+  bool operator()(column_view const& input, bool* nans, rmm::cuda_stream_view stream) const
+  {
+    auto const d_input = column_device_view::create(input, stream);
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       input.size(),
+                       [d_input = *d_input, nans] __device__(size_type idx) {
+                         if (d_input.is_valid(idx) and isnan(d_input.element<T>(idx))) {
+                           nans[idx] = true;
+                         }
+                       });
+    return true;
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not std::is_floating_point_v<T>)>
+  bool operator()(column_view const&, bool*, rmm::cuda_stream_view) const
+  {
+    return false;
+  }
+};
+
+/**
+ * @brief Returns the flags of the valid entries that have a NaN in any of the floating-point
+ * columns of their flattened rows, or an empty vector if there is no such column.
+ */
+rmm::device_uvector<bool> nan_entries(column_view const& entries,
+                                      table_view const& rows,
+                                      rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<bool> nans(entries.size(), stream);
+  thrust::uninitialized_fill(rmm::exec_policy(stream), nans.begin(), nans.end(), false);
+  auto has_floats = false;
+  for (auto const& col : rows) {
+    has_floats |= type_dispatcher(col.type(), mark_nans_fn{}, col, nans.data(), stream);
+  }
+  if (not has_floats) { return rmm::device_uvector<bool>(0, stream); }
+
+  // the members of null structs are not compared
+  if (entries.nullable()) {
+    auto const d_entries = column_device_view::create(entries, stream);
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       entries.size(),
+                       [d_entries = *d_entries, nans = nans.data()] __device__(size_type idx) {
+                         if (d_entries.is_null(idx)) { nans[idx] = false; }
+                       });
+  }
+  return nans;
+}
+
+/**
+ * @brief Compares the rows of two list entries, prefixed by the indices of their lists so that
+ * only the entries of the same list may be equal.
+ *
+ * The entries that have a NaN are unequal to all entries when `nans` is not null.
+ */
+struct entries_equal_fn {
+  row_equality_comparator<nullate::DYNAMIC> equal;
+  bool const* nans;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const noexcept
+  {
+    if (nans != nullptr and (nans[lhs] or nans[rhs])) { return false; }
+    return equal(lhs, rhs);
+  }
+};
+
+using entries_hasher = row_hasher<default_hash, nullate::DYNAMIC>;
+
+/**
+ * @brief Calls `fn` with the hasher and comparator of the entries of lists, as the rows of the
+ * index of their list and their value.
+ *
+ * @param entries The entries of the lists
+ * @param labels The index of the list of each entry
+ * @param nulls_equal Whether null entries are equal
+ * @param nans_equal Whether the NaNs of floating-point entries are equal
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param fn Callable with the `entries_hasher` and `entries_equal_fn` of the entries
+ * @return The result of `fn`
+ */
+template <typename Fn>
+auto with_entries_rows(column_view const& entries,
+                       device_span<size_type const> labels,
+                       null_equality nulls_equal,
+                       nan_equality nans_equal,
+                       rmm::cuda_stream_view stream,
+                       Fn&& fn)
+{
+  auto const labels_view = column_view(
+    data_type{type_to_id<size_type>()}, static_cast<size_type>(labels.size()), labels.data());
+  auto const flattened = structs::detail::flatten_nested_columns(
+    table_view{{labels_view, entries}}, {}, {}, structs::detail::column_nullability::FORCE);
+  table_view const rows = flattened;
+  auto const d_rows     = table_device_view::create(rows, stream);
+  auto const has_nulls  = nullate::DYNAMIC{cudf::has_nulls(rows)};
+
+  auto const nans = nans_equal == nan_equality::UNEQUAL ? nan_entries(entries, rows, stream)
+                                                        : rmm::device_uvector<bool>(0, stream);
+  auto const hasher = entries_hasher{has_nulls, *d_rows};
+  auto const equal  = entries_equal_fn{
+    row_equality_comparator<nullate::DYNAMIC>{has_nulls, *d_rows, *d_rows, nulls_equal},
+    nans.is_empty() ? nullptr : nans.data()};
+  return fn(hasher, equal);
+}
+
+/**
+ * @brief Returns the flags of the entries of `[begin, end)` that are the first of the equal
+ * entries of their list in that range.
+ */
+rmm::device_uvector<bool> first_occurrences(entries_hasher const& hasher,
+                                            entries_equal_fn const& equal,
+                                            size_type begin,
+                                            size_type end,
+                                            rmm::cuda_stream_view stream)
+{
+  auto const num_entries = end - begin;
+  rmm::device_uvector<bool> flags(num_entries, stream);
+  if (num_entries == 0) { return flags; }
+
+  map_type map{compute_hash_table_size(num_entries),
+               unused_key,
+               unused_value,
+               hash_table_allocator_type{default_allocator<char>{}, stream},
+               stream.value()};
+  auto const entries = thrust::make_counting_iterator<size_type>(begin);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    entries,
+    num_entries,
+    [d_map = map.get_device_mutable_view(), hasher, equal] __device__(size_type idx) mutable {
+      d_map.insert(thrust::make_pair(idx, idx), hasher, equal);
+    });
+
+  // Reduce the first entry of each set of equal entries into the slot of the entry inserted for
+  // the set. Entries unequal to themselves are never found, and are sets of their own.
+  rmm::device_uvector<size_type> representatives(num_entries, stream);
+  rmm::device_uvector<size_type> firsts(num_entries, stream);
+  thrust::uninitialized_fill(
+    rmm::exec_policy(stream), firsts.begin(), firsts.end(), std::numeric_limits<size_type>::max());
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     entries,
+                     num_entries,
+                     [d_map           = map.get_device_view(),
+                      hasher,
+                      equal,
+                      begin,
+                      representatives = representatives.data(),
+                      firsts          = firsts.data()] __device__(size_type idx) {
+                       auto const slot = d_map.find(idx, hasher, equal);
+                       auto const representative =
+                         slot == d_map.end() ? idx
+                                             : slot->second.load(cuda::std::memory_order_relaxed);
+                       representatives[idx - begin] = representative - begin;
+                       atomicMin(firsts + representative - begin, idx);
+                     });
+  thrust::transform(rmm::exec_policy(stream),
+                    entries,
+                    entries + num_entries,
+                    flags.begin(),
+                    [begin,
+                     representatives = representatives.data(),
+                     firsts          = firsts.data()] __device__(size_type idx) {
+                      return firsts[representatives[idx - begin]] == idx;
+                    });
+  return flags;
+}
+
+/**
+ * @brief Returns the flags of the entries of `[probe_begin, probe_end)` that are equal to an
+ * entry of their list in `[build_begin, build_end)`.
+ */
+rmm::device_uvector<bool> contained_entries(entries_hasher const& hasher,
+                                            entries_equal_fn const& equal,
+                                            size_type build_begin,
+                                            size_type build_end,
+                                            size_type probe_begin,
+                                            size_type probe_end,
+                                            rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<bool> flags(probe_end - probe_begin, stream);
+  if (build_begin == build_end) {
+    thrust::uninitialized_fill(rmm::exec_policy(stream), flags.begin(), flags.end(), false);
+    return flags;
+  }
+
+  map_type map{compute_hash_table_size(build_end - build_begin),
+               unused_key,
+               unused_value,
+               hash_table_allocator_type{default_allocator<char>{}, stream},
+               stream.value()};
+  thrust::for_each(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(build_begin),
+    thrust::make_counting_iterator<size_type>(build_end),
+    [d_map = map.get_device_mutable_view(), hasher, equal] __device__(size_type idx) mutable {
+      d_map.insert(thrust::make_pair(idx, idx), hasher, equal);
+    });
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(probe_begin),
+                    thrust::make_counting_iterator<size_type>(probe_end),
+                    flags.begin(),
+                    [d_map = map.get_device_view(), hasher, equal] __device__(size_type idx) {
+                      return d_map.find(idx, hasher, equal) != d_map.end();
+                    });
+  return flags;
+}
+
+/**
+ * @brief Writes the index of the list of each entry of the child of a lists column.
+ */
+void entry_list_indices(lists_column_view const& input,
+                        size_type* output,
+                        rmm::cuda_stream_view stream)
+{
+  auto const offsets_begin = input.offsets_begin();
+  auto const offsets       = thrust::make_transform_iterator(
+    offsets_begin, [offsets_begin] __device__(auto const idx) { return idx - *offsets_begin; });
+  auto const num_entries = static_cast<size_type>(input.get_sliced_child(stream).size());
+  thrust::upper_bound(rmm::exec_policy(stream),
+                      offsets + 1,
+                      offsets + 1 + input.size(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_entries),
+                      output);
+}
+
+/**
+ * @brief Returns the entries of `lhs` followed by those of `rhs`, and the index of the list of
+ * each of them.
+ */
+std::pair<std::unique_ptr<column>, rmm::device_uvector<size_type>> concatenate_entries(
+  lists_column_view const& lhs, lists_column_view const& rhs, rmm::cuda_stream_view stream)
+{
+  auto const lhs_entries = lhs.get_sliced_child(stream);
+  auto const rhs_entries = rhs.get_sliced_child(stream);
+  auto entries =
+    cudf::detail::concatenate(std::vector<column_view>{lhs_entries, rhs_entries}, stream);
+  rmm::device_uvector<size_type> labels(entries->size(), stream);
+  entry_list_indices(lhs, labels.data(), stream);
+  entry_list_indices(rhs, labels.data() + lhs_entries.size(), stream);
+  return {std::move(entries), std::move(labels)};
+}
+
+/**
+ * @brief Makes the lists of the kept entries of each row of `lhs`, followed by the kept entries of
+ * the same row of `rhs` when it is given.
+ *
+ * @param entries The entries of `lhs` followed by those of `rhs`
+ * @param labels The index of the list of each entry
+ * @param keep The flags of the entries to keep, of the entries of `lhs` when `rhs` is not given,
+ *        cleared for the entries of the null rows of the result
+ * @param lhs The lists of the first entries
+ * @param rhs The lists of the entries following those of `lhs`
+ * @param null_count The number of null rows of the result
+ * @param null_mask The null mask of the result
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The lists of the kept entries
+ */
+std::unique_ptr<column> make_lists_of_kept_entries(column_view const& entries,
+                                                   device_span<size_type const> labels,
+                                                   device_span<bool> keep,
+                                                   lists_column_view const& lhs,
+                                                   std::optional<lists_column_view> const& rhs,
+                                                   size_type null_count,
+                                                   rmm::device_buffer&& null_mask,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  auto const num_lists = lhs.size();
+  auto const num_kept  = static_cast<size_type>(keep.size());
+  auto const num_lhs   = static_cast<size_type>(lhs.get_sliced_child(stream).size());
+
+  // the null rows are empty
+  if (null_count > 0) {
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      num_kept,
+      [keep      = keep.data(),
+       labels    = labels.data(),
+       null_mask = static_cast<bitmask_type const*>(null_mask.data())] __device__(size_type idx) {
+        if (not bit_is_set(null_mask, labels[idx])) { keep[idx] = false; }
+      });
+  }
+
+  // the number of kept entries before each entry
+  rmm::device_uvector<size_type> kept_before(num_kept + 1, stream);
+  auto const kept = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [keep = keep.data(), num_kept] __device__(size_type idx) -> size_type {
+      return idx < num_kept and keep[idx];
+    });
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), kept, kept + num_kept + 1, kept_before.begin(), size_type{0});
+
+  // The kept entries of `lhs` of each list come before all the kept entries of the next lists.
+  // The kept entries of `rhs` of a list follow all the kept entries of `lhs` of the same list.
+  auto const lhs_offsets = lhs.offsets_begin();
+  auto const rhs_offsets = rhs ? rhs->offsets_begin() : nullptr;
+  auto offsets           = rmm::device_uvector<offset_type>(num_lists + 1, stream, mr);
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_lists + 1),
+    offsets.begin(),
+    [lhs_offsets, rhs_offsets, num_lhs, kept_before = kept_before.data()] __device__(
+      size_type idx) {
+      auto const lhs_kept = kept_before[lhs_offsets[idx] - lhs_offsets[0]];
+      if (rhs_offsets == nullptr) { return lhs_kept; }
+      return lhs_kept + kept_before[num_lhs + rhs_offsets[idx] - rhs_offsets[0]] -
+             kept_before[num_lhs];
+    });
+
+  auto const num_output = kept_before.element(num_kept, stream);
+  rmm::device_uvector<size_type> gather_map(num_output, stream);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_kept,
+    [keep        = keep.data(),
+     labels      = labels.data(),
+     lhs_offsets,
+     rhs_offsets,
+     num_lhs,
+     kept_before = kept_before.data(),
+     gather_map  = gather_map.data()] __device__(size_type idx) {
+      if (not keep[idx]) { return; }
+      auto const list = labels[idx];
+      auto position   = kept_before[idx];
+      if (idx < num_lhs) {
+        if (rhs_offsets != nullptr) {
+          position += kept_before[num_lhs + rhs_offsets[list] - rhs_offsets[0]] -
+                      kept_before[num_lhs];
+        }
+      } else {
+        position += kept_before[lhs_offsets[list + 1] - lhs_offsets[0]] - kept_before[num_lhs];
+      }
+      gather_map[position] = idx;
+    });
+
+  auto child = std::move(cudf::detail::gather(table_view{{entries}},
+                                              gather_map,
+                                              out_of_bounds_policy::DONT_CHECK,
+                                              cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                              stream,
+                                              mr)
+                           ->release()
+                           .front());
+  auto offsets_column = std::make_unique<column>(
+    data_type{type_to_id<offset_type>()}, num_lists + 1, offsets.release());
+  return make_lists_column(num_lists,
+                           std::move(offsets_column),
+                           std::move(child),
+                           null_count,
+                           std::move(null_mask),
+                           stream,
+                           mr);
+}
+
+void check_entries_type(lists_column_view const& input)
+{
+  auto const child_type = input.child().type();
+  CUDF_EXPECTS(not cudf::is_nested(child_type) or child_type.id() == type_id::STRUCT,
+               "Entries of nested types other than STRUCT are not supported.");
+}
+
+void check_inputs(lists_column_view const& lhs, lists_column_view const& rhs)
+{
+  CUDF_EXPECTS(lhs.size() == rhs.size(), "The input lists columns must have the same size.");
+  CUDF_EXPECTS(lhs.child().type() == rhs.child().type(),
+               "The input lists columns must have the same type of entries.");
+  check_entries_type(lhs);
+}
+
+/**
+ * @brief Returns the null mask and null count of the rows that are valid in both inputs.
+ */
+std::pair<rmm::device_buffer, size_type> rows_valid_in_both(lists_column_view const& lhs,
+                                                            lists_column_view const& rhs,
+                                                            rmm::cuda_stream_view stream,
+                                                            rmm::mr::device_memory_resource* mr)
+{
+  return cudf::detail::bitmask_and(table_view{{lhs.parent(), rhs.parent()}}, stream, mr);
+}
+
+/**
+ * @brief Returns the lists of the distinct entries of `lhs` that are, or are not, in the lists of
+ * the same rows of `rhs`.
+ */
+std::unique_ptr<column> filter_distinct(lists_column_view const& lhs,
+                                        lists_column_view const& rhs,
+                                        bool contained,
+                                        null_equality nulls_equal,
+                                        nan_equality nans_equal,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  check_inputs(lhs, rhs);
+  if (lhs.is_empty()) { return empty_like(lhs.parent()); }
+
+  auto const concatenated = concatenate_entries(lhs, rhs, stream);
+  auto const& entries     = concatenated.first;
+  auto const& labels      = concatenated.second;
+  auto const num_lhs      = static_cast<size_type>(lhs.get_sliced_child(stream).size());
+  auto keep               = with_entries_rows(
+    entries->view(), labels, nulls_equal, nans_equal, stream, [&](auto hasher, auto equal) {
+      auto firsts = first_occurrences(hasher, equal, 0, num_lhs, stream);
+      auto const found =
+        contained_entries(hasher, equal, num_lhs, entries->size(), 0, num_lhs, stream);
+      thrust::transform(rmm::exec_policy(stream),
+                        firsts.begin(),
+                        firsts.end(),
+                        found.begin(),
+                        firsts.begin(),
+                        [contained] __device__(bool first, bool found) {
+                          return first and found == contained;
+                        });
+      return firsts;
+    });
+
+  auto [null_mask, null_count] = rows_valid_in_both(lhs, rhs, stream, mr);
+  return make_lists_of_kept_entries(entries->view(),
+                                    labels,
+                                    keep,
+                                    lhs,
+                                    std::nullopt,
+                                    null_count,
+                                    std::move(null_mask),
+                                    stream,
+                                    mr);
+}
+
+}  // namespace
+
+std::unique_ptr<column> distinct(lists_column_view const& input,
+                                 null_equality nulls_equal,
+                                 nan_equality nans_equal,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  check_entries_type(input);
+  if (input.is_empty()) { return empty_like(input.parent()); }
+
+  auto const entries = input.get_sliced_child(stream);
+  rmm::device_uvector<size_type> labels(entries.size(), stream);
+  entry_list_indices(input, labels.data(), stream);
+  auto keep = with_entries_rows(
+    entries, labels, nulls_equal, nans_equal, stream, [&](auto hasher, auto equal) {
+      return first_occurrences(hasher, equal, 0, entries.size(), stream);
+    });
+
+  return make_lists_of_kept_entries(entries,
+                                    labels,
+                                    keep,
+                                    input,
+                                    std::nullopt,
+                                    input.null_count(),
+                                    cudf::detail::copy_bitmask(input.parent(), stream, mr),
+                                    stream,
+                                    mr);
+}
+
+std::unique_ptr<column> have_overlap(lists_column_view const& lhs,
+                                     lists_column_view const& rhs,
+                                     null_equality nulls_equal,
+                                     nan_equality nans_equal,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  check_inputs(lhs, rhs);
+  auto const num_lists         = lhs.size();
+  auto [null_mask, null_count] = rows_valid_in_both(lhs, rhs, stream, mr);
+  auto result                  = make_numeric_column(
+    data_type{type_id::BOOL8}, num_lists, std::move(null_mask), null_count, stream, mr);
+  if (num_lists == 0) { return result; }
+
+  auto const overlap = result->mutable_view().data<bool>();
+  thrust::uninitialized_fill(rmm::exec_policy(stream), overlap, overlap + num_lists, false);
+
+  auto const concatenated = concatenate_entries(lhs, rhs, stream);
+  auto const& entries     = concatenated.first;
+  auto const& labels      = concatenated.second;
+  auto const num_lhs      = static_cast<size_type>(lhs.get_sliced_child(stream).size());
+  auto const found        = with_entries_rows(
+    entries->view(), labels, nulls_equal, nans_equal, stream, [&](auto hasher, auto equal) {
+      return contained_entries(hasher, equal, num_lhs, entries->size(), 0, num_lhs, stream);
+    });
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_lhs,
+    [found = found.data(), labels = labels.data(), overlap] __device__(size_type idx) {
+      if (found[idx]) { overlap[labels[idx]] = true; }
+    });
+  return result;
+}
+
+std::unique_ptr<column> intersect_distinct(lists_column_view const& lhs,
+                                           lists_column_view const& rhs,
+                                           null_equality nulls_equal,
+                                           nan_equality nans_equal,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  return filter_distinct(lhs, rhs, true, nulls_equal, nans_equal, stream, mr);
+}
+
+std::unique_ptr<column> union_distinct(lists_column_view const& lhs,
+                                       lists_column_view const& rhs,
+                                       null_equality nulls_equal,
+                                       nan_equality nans_equal,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  check_inputs(lhs, rhs);
+  if (lhs.is_empty()) { return empty_like(lhs.parent()); }
+
+  // the entries of `lhs` come first, so they are the first occurrences of the entries of both
+  auto const concatenated = concatenate_entries(lhs, rhs, stream);
+  auto const& entries     = concatenated.first;
+  auto const& labels      = concatenated.second;
+  auto keep               = with_entries_rows(
+    entries->view(), labels, nulls_equal, nans_equal, stream, [&](auto hasher, auto equal) {
+      return first_occurrences(hasher, equal, 0, entries->size(), stream);
+    });
+
+  auto [null_mask, null_count] = rows_valid_in_both(lhs, rhs, stream, mr);
+  return make_lists_of_kept_entries(entries->view(),
+                                    labels,
+                                    keep,
+                                    lhs,
+                                    rhs,
+                                    null_count,
+                                    std::move(null_mask),
+                                    stream,
+                                    mr);
+}
+
+std::unique_ptr<column> difference_distinct(lists_column_view const& lhs,
+                                            lists_column_view const& rhs,
+                                            null_equality nulls_equal,
+                                            nan_equality nans_equal,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  return filter_distinct(lhs, rhs, false, nulls_equal, nans_equal, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> distinct(lists_column_view const& input,
+                                 null_equality nulls_equal,
+                                 nan_equality nans_equal,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::distinct(input, nulls_equal, nans_equal, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> have_overlap(lists_column_view const& lhs,
+                                     lists_column_view const& rhs,
+                                     null_equality nulls_equal,
+                                     nan_equality nans_equal,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::have_overlap(lhs, rhs, nulls_equal, nans_equal, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> intersect_distinct(lists_column_view const& lhs,
+                                           lists_column_view const& rhs,
+                                           null_equality nulls_equal,
+                                           nan_equality nans_equal,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::intersect_distinct(
+    lhs, rhs, nulls_equal, nans_equal, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> union_distinct(lists_column_view const& lhs,
+                                       lists_column_view const& rhs,
+                                       null_equality nulls_equal,
+                                       nan_equality nans_equal,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::union_distinct(lhs, rhs, nulls_equal, nans_equal, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> difference_distinct(lists_column_view const& lhs,
+                                            lists_column_view const& rhs,
+                                            null_equality nulls_equal,
+                                            nan_equality nans_equal,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::difference_distinct(
+    lhs, rhs, nulls_equal, nans_equal, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf::lists
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,7 +14,9 @@
  * limitations under the License.
  */
 #include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/merge.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
@@ -24,19 +26,27 @@
 #include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/strings/detail/merge.cuh>
 #include <cudf/structs/structs_column_view.hpp>
+#include <cudf/table/row_operators.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 
+#include <sort/sort_impl.cuh>
+
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/merge.h>
 #include <thrust/pair.h>
 
 #include "cudf/utilities/traits.hpp"
+#include <algorithm>
+#include <functional>
+#include <numeric>
 #include <queue>
 #include <vector>
 
@@ -428,6 +438,117 @@ table_ptr_type merge(cudf::table_view const& left_table,
   return std::make_unique<cudf::table>(std::move(merged_cols));
 }
 
+/**
+ * @brief Device functor comparing rows by their packed sort keys.
+ */
+struct packed_key_less {
+  uint64_t const* keys;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const noexcept
+  {
+    return keys[lhs] < keys[rhs];
+  }
+};
+
+/**
+ * @brief Device functor writing the index of each row of the concatenated sorted tables at its
+ * position in the merged table, into `gather_map`.
+ *
+ * The position of a row is its index in its table plus the number of rows of each other table
+ * that precede it, found by a binary search in that table. The rows equal to it precede it when
+ * from a table before its own, so that the merge is stable.
+ */
+template <typename Less>
+struct merge_path_fn {
+  Less less;
+  size_type const* offsets;  ///< Offsets of the tables in the concatenation, then its size
+  size_type num_tables;
+  size_type* gather_map;
+
+  __device__ void operator()(size_type row) const
+  {
+    auto const table = static_cast<size_type>(
+      thrust::upper_bound(thrust::seq, offsets, offsets + num_tables + 1, row) - offsets - 1);
+    auto position = row - offsets[table];
+    for (size_type t = 0; t < num_tables; ++t) {
+      if (t == table) { continue; }
+      auto first = offsets[t];
+      auto last  = offsets[t + 1];
+      while (first < last) {
+        auto const middle   = first + (last - first) / 2;
+        auto const precedes = t < table ? not less(row, middle) : less(middle, row);
+        if (precedes) {
+          first = middle + 1;
+        } else {
+          last = middle;
+        }
+      }
+      position += first - offsets[t];
+    }
+    gather_map[position] = row;
+  }
+};
+
+/**
+ * @brief Merges more than two non-empty sorted tables in a single pass.
+ *
+ * The tables are concatenated, and each row is moved once to its position in the merged table,
+ * which only depends on its rank in each of the other tables. The keys are compared by their
+ * packed sort keys when they fit in 64 bits.
+ */
+table_ptr_type k_way_merge(std::vector<table_view> const& tables,
+                           std::vector<cudf::size_type> const& key_cols,
+                           std::vector<cudf::order> const& column_order,
+                           std::vector<cudf::null_order> const& null_precedence,
+                           rmm::cuda_stream_view stream,
+                           rmm::mr::device_memory_resource* mr)
+{
+  auto const concatenated = cudf::detail::concatenate(tables, stream);
+  auto const keys         = concatenated->select(key_cols);
+  auto const num_rows     = concatenated->num_rows();
+
+  std::vector<size_type> offsets(tables.size() + 1, 0);
+  std::transform_inclusive_scan(tables.begin(),
+                                tables.end(),
+                                offsets.begin() + 1,
+                                std::plus<size_type>{},
+                                [](auto const& table) { return table.num_rows(); });
+  auto const d_offsets  = cudf::detail::make_device_uvector_async(offsets, stream);
+  auto const num_tables = static_cast<size_type>(tables.size());
+
+  rmm::device_uvector<size_type> gather_map(num_rows, stream);
+  auto const rank_rows = [&](auto less) {
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      num_rows,
+      merge_path_fn<decltype(less)>{less, d_offsets.data(), num_tables, gather_map.data()});
+  };
+
+  if (can_use_packed_sort_keys(keys) and packed_sort_key_bits(keys) <= 64) {
+    auto const packed = make_packed_sort_keys(keys, column_order, null_precedence, stream);
+    rank_rows(packed_key_less{packed.data()});
+  } else {
+    auto const d_keys         = table_device_view::create(keys, stream);
+    auto const d_column_order = cudf::detail::make_device_uvector_async(column_order, stream);
+    auto const d_null_precedence =
+      cudf::detail::make_device_uvector_async(null_precedence, stream);
+    rank_rows(row_lexicographic_comparator<nullate::DYNAMIC>(
+      nullate::DYNAMIC{cudf::has_nulls(keys)},
+      *d_keys,
+      *d_keys,
+      d_column_order.data(),
+      null_precedence.empty() ? nullptr : d_null_precedence.data()));
+  }
+
+  return cudf::detail::gather(concatenated->view(),
+                              gather_map,
+                              out_of_bounds_policy::DONT_CHECK,
+                              negative_index_policy::NOT_ALLOWED,
+                              stream,
+                              mr);
+}
+
 struct merge_queue_item {
   table_view view;
   table_ptr_type table;
@@ -502,6 +623,16 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
   // No inputs have rows, return a table with same columns as the first one
   if (merge_queue.empty()) { return empty_like(first_table); }
 
+  // More than two tables are merged at once rather than pairwise
+  if (merge_queue.size() > 2) {
+    std::vector<table_view> non_empty_tables;
+    std::copy_if(merge_tables.begin(),
+                 merge_tables.end(),
+                 std::back_inserter(non_empty_tables),
+                 [](auto const& table) { return table.num_rows() > 0; });
+    return k_way_merge(non_empty_tables, key_cols, column_order, null_precedence, stream, mr);
+  }
+
   // Pick the two smallest tables and merge them
   // Until there is only one table left in the queue
   while (merge_queue.size() > 1) {
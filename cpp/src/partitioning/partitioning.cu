@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,19 +17,29 @@
 #include <cub/cub.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/scatter.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/partitioning.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
 namespace cudf {
 namespace {
 // Launch configuration for optimized hash partition
@@ -38,10 +48,6 @@ constexpr size_type OPTIMIZED_ROWS_PER_THREAD                = 8;
 constexpr size_type ELEMENTS_PER_THREAD                      = 2;
 constexpr size_type THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL = 1024;
 
-// Launch configuration for fallback hash partition
-constexpr size_type FALLBACK_BLOCK_SIZE      = 256;
-constexpr size_type FALLBACK_ROWS_PER_THREAD = 1;
-
 /**
  * @brief  Functor to map a hash value to a particular 'bin' or partition number
  * that uses the modulo operation.
@@ -140,7 +146,7 @@ __global__ void compute_row_partition_numbers(row_hasher_t the_hasher,
   // and compute the partition to which the hash value belongs and increment
   // the shared memory counter for that partition
   while (row_number < num_rows) {
-    const hash_value_type row_hash_value = the_hasher(row_number);
+    auto const row_hash_value = the_hasher(row_number);
 
     const size_type partition_number = the_partitioner(row_hash_value);
 
@@ -169,62 +175,6 @@ __global__ void compute_row_partition_numbers(row_hasher_t the_hasher,
   }
 }
 
-/**
- * @brief  Given an array of partition numbers, computes the final output
- location for each element in the output such that all rows with the same
- partition are contiguous in memory.
- *
- * @param row_partition_numbers The array that records the partition number for
- each row
- * @param num_rows The number of rows
- * @param num_partitions THe number of partitions
- * @param[out] block_partition_offsets Array that holds the offset of each
- partition for each thread block,
- * i.e., { {block0 partition0 offset, block1 partition0 offset, ...},
-         {block0 partition1 offset, block1 partition1 offset, ...},
-         ...
-         {block0 partition(num_partitions-1) offset, block1
- partition(num_partitions -1) offset, ...} }
- */
-__global__ void compute_row_output_locations(size_type* __restrict__ row_partition_numbers,
-                                             const size_type num_rows,
-                                             const size_type num_partitions,
-                                             size_type* __restrict__ block_partition_offsets)
-{
-  // Shared array that holds the offset of this blocks partitions in
-  // global memory
-  extern __shared__ size_type shared_partition_offsets[];
-
-  // Initialize array of this blocks offsets from global array
-  size_type partition_number = threadIdx.x;
-  while (partition_number < num_partitions) {
-    shared_partition_offsets[partition_number] =
-      block_partition_offsets[partition_number * gridDim.x + blockIdx.x];
-    partition_number += blockDim.x;
-  }
-  __syncthreads();
-
-  size_type row_number = threadIdx.x + blockIdx.x * blockDim.x;
-
-  // Get each row's partition number, and get it's output location by
-  // incrementing block's offset counter for that partition number
-  // and store the row's output location in-place
-  while (row_number < num_rows) {
-    // Get partition number of this row
-    const size_type partition_number = row_partition_numbers[row_number];
-
-    // Get output location based on partition number by incrementing the
-    // corresponding partition offset for this block
-    const size_type row_output_location =
-      atomicAdd(&(shared_partition_offsets[partition_number]), size_type(1));
-
-    // Store the row's output location in-place
-    row_partition_numbers[row_number] = row_output_location;
-
-    row_number += blockDim.x * gridDim.x;
-  }
-}
-
 /**
  * @brief Move one column from the input table to the hashed table.
  *
@@ -443,6 +393,327 @@ struct copy_block_partitions_dispatcher {
   }
 };
 
+/**
+ * @brief Functor computing the partition number of a row from its hash value.
+ */
+template <typename row_hasher_t, typename partitioner_type>
+struct row_partition_number_fn {
+  row_hasher_t hasher;
+  partitioner_type partitioner;
+
+  __device__ size_type operator()(size_type row) const { return partitioner(hasher(row)); }
+};
+
+/**
+ * @brief Computes the partitioned order of the rows hashed by `hasher` by radix sorting their
+ * partition numbers.
+ *
+ * Used above `THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL` partitions, where the per-block
+ * histograms of the shared-memory partitioner no longer fit in shared memory and grow with the
+ * number of blocks times the number of partitions. The radix sort only goes through the bits of
+ * the partition numbers, in passes of a few bits whose histograms stay in shared memory, so that
+ * the number of passes and the extra memory do not depend on the number of partitions.
+ *
+ * @return The gather map of the rows in partitioned order, and the offsets of the partitions in
+ * it followed by the number of rows
+ */
+template <typename row_hasher_t>
+std::pair<rmm::device_uvector<size_type>, rmm::device_uvector<size_type>> radix_partition_order(
+  row_hasher_t const& hasher,
+  size_type num_rows,
+  size_type num_partitions,
+  rmm::cuda_stream_view stream)
+{
+  auto const rows = thrust::make_counting_iterator<size_type>(0);
+
+  using hash_value_t = typename row_hasher_t::result_type;
+  rmm::device_uvector<size_type> row_partition_numbers(num_rows, stream);
+  if (is_power_two(num_partitions)) {
+    using partitioner_type = bitwise_partitioner<hash_value_t>;
+    thrust::transform(rmm::exec_policy(stream),
+                      rows,
+                      rows + num_rows,
+                      row_partition_numbers.begin(),
+                      row_partition_number_fn<row_hasher_t, partitioner_type>{
+                        hasher, partitioner_type(num_partitions)});
+  } else {
+    using partitioner_type = modulo_partitioner<hash_value_t>;
+    thrust::transform(rmm::exec_policy(stream),
+                      rows,
+                      rows + num_rows,
+                      row_partition_numbers.begin(),
+                      row_partition_number_fn<row_hasher_t, partitioner_type>{
+                        hasher, partitioner_type(num_partitions)});
+  }
+
+  int num_bits = 1;
+  while ((size_type{1} << num_bits) < num_partitions) {
+    ++num_bits;
+  }
+  rmm::device_uvector<size_type> row_indices(num_rows, stream);
+  thrust::sequence(rmm::exec_policy(stream), row_indices.begin(), row_indices.end(), 0);
+  rmm::device_uvector<size_type> sorted_partition_numbers(num_rows, stream);
+  rmm::device_uvector<size_type> gather_map(num_rows, stream);
+  std::size_t temp_storage_bytes = 0;
+  cub::DeviceRadixSort::SortPairs(nullptr,
+                                  temp_storage_bytes,
+                                  row_partition_numbers.data(),
+                                  sorted_partition_numbers.data(),
+                                  row_indices.data(),
+                                  gather_map.data(),
+                                  num_rows,
+                                  0,
+                                  num_bits,
+                                  stream.value());
+  rmm::device_buffer temp_storage(temp_storage_bytes, stream);
+  cub::DeviceRadixSort::SortPairs(temp_storage.data(),
+                                  temp_storage_bytes,
+                                  row_partition_numbers.data(),
+                                  sorted_partition_numbers.data(),
+                                  row_indices.data(),
+                                  gather_map.data(),
+                                  num_rows,
+                                  0,
+                                  num_bits,
+                                  stream.value());
+
+  // The offset of each partition is the position of its first row in the sorted order
+  rmm::device_uvector<size_type> offsets(num_partitions + 1, stream);
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      sorted_partition_numbers.begin(),
+                      sorted_partition_numbers.end(),
+                      rows,
+                      rows + num_partitions + 1,
+                      offsets.begin());
+  return std::make_pair(std::move(gather_map), std::move(offsets));
+}
+
+/**
+ * @brief Partitions the rows of `input` in the order of `radix_partition_order`.
+ */
+template <typename row_hasher_t>
+std::pair<std::unique_ptr<table>, std::vector<size_type>> radix_partition_table(
+  table_view const& input,
+  row_hasher_t const& hasher,
+  size_type num_partitions,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const [gather_map, offsets] =
+    radix_partition_order(hasher, input.num_rows(), num_partitions, stream);
+  auto partition_offsets = cudf::detail::make_std_vector_async(offsets, stream);
+
+  auto output = detail::gather(input,
+                               gather_map,
+                               out_of_bounds_policy::DONT_CHECK,
+                               detail::negative_index_policy::NOT_ALLOWED,
+                               stream,
+                               mr);
+
+  stream.synchronize();  // Async D2H copy must finish before returning host vec
+  partition_offsets.pop_back();
+  return std::make_pair(std::move(output), std::move(partition_offsets));
+}
+
+/**
+ * @brief Alignment of the buffers of the columns in the packed partitions, as by
+ * `contiguous_split`.
+ */
+constexpr std::size_t pack_align = 64;
+
+/**
+ * @brief Returns the partition of the `i`-th item of the partitions of the given `offsets`.
+ */
+__device__ size_type partition_of(size_type const* offsets, size_type num_partitions, size_type i)
+{
+  return static_cast<size_type>(
+    thrust::upper_bound(thrust::seq, offsets, offsets + num_partitions + 1, i) - offsets - 1);
+}
+
+/**
+ * @brief Device functor copying the elements of a column, in partitioned order, to its data in
+ * the packed buffers of their partitions.
+ */
+template <typename T>
+struct copy_to_partitions_fn {
+  T const* source;
+  size_type const* gather_map;
+  size_type const* partition_offsets;  ///< Offsets of the partitions, then the number of rows
+  size_type num_partitions;
+  uint8_t* const* partition_data;  ///< Data of the column in the packed buffer of each partition
+
+  __device__ void operator()(size_type row) const
+  {
+    auto const partition = partition_of(partition_offsets, num_partitions, row);
+    reinterpret_cast<T*>(partition_data[partition])[row - partition_offsets[partition]] =
+      source[gather_map[row]];
+  }
+};
+
+struct copy_to_partitions_dispatcher {
+  template <typename T, CUDF_ENABLE_IF(is_fixed_width<T>())>
+  void operator()(column_view const& input,
+                  size_type const* gather_map,
+                  size_type const* partition_offsets,
+                  size_type num_partitions,
+                  uint8_t* const* partition_data,
+                  rmm::cuda_stream_view stream) const
+  {
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      input.size(),
+      copy_to_partitions_fn<T>{
+        input.data<T>(), gather_map, partition_offsets, num_partitions, partition_data});
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_fixed_width<T>()> operator()(Args&&...) const
+  {
+    CUDF_FAIL("Unsupported type for packed partitions.");
+  }
+};
+
+/**
+ * @brief Device functor computing each word of the null masks of a column in the packed buffers
+ * of the partitions, and counting the nulls of each partition.
+ */
+struct copy_masks_to_partitions_fn {
+  column_device_view source;
+  size_type const* gather_map;
+  size_type const* partition_offsets;  ///< Offsets of the partitions, then the number of rows
+  size_type const* word_offsets;       ///< Offsets of the partitions in the mask words
+  size_type num_partitions;
+  bitmask_type* const* partition_masks;
+  size_type* null_counts;
+
+  __device__ void operator()(size_type word) const
+  {
+    auto const partition = partition_of(word_offsets, num_partitions, word);
+    auto const mask_word = word - word_offsets[partition];
+    auto const first_row =
+      partition_offsets[partition] + mask_word * detail::size_in_bits<bitmask_type>();
+    auto const last_row = thrust::min(first_row + detail::size_in_bits<bitmask_type>(),
+                                      partition_offsets[partition + 1]);
+    bitmask_type bits   = 0;
+    for (auto row = first_row; row < last_row; ++row) {
+      if (source.is_valid_nocheck(gather_map[row])) {
+        bits |= bitmask_type{1} << (row - first_row);
+      }
+    }
+    partition_masks[partition][mask_word] = bits;
+    auto const num_nulls                  = (last_row - first_row) - __popc(bits);
+    if (num_nulls > 0) { atomicAdd(&null_counts[partition], num_nulls); }
+  }
+};
+
+/**
+ * @brief Writes the rows of the fixed-width `input` in the partitioned order of `gather_map`
+ * straight to the packed buffers of their partitions.
+ *
+ * The data and null mask of each column of a partition are aligned to `pack_align` in its
+ * buffer.
+ */
+std::vector<packed_table> pack_partitions(table_view const& input,
+                                          device_span<size_type const> gather_map,
+                                          device_span<size_type const> offsets,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  auto const num_partitions = static_cast<size_type>(offsets.size() - 1);
+  auto const num_columns    = input.num_columns();
+  auto const h_offsets      = cudf::detail::make_std_vector_sync(offsets, stream);
+
+  // Layout of the packed buffers, with the data and mask of column `c` of partition `p` at
+  // index `c * num_partitions + p`
+  std::vector<std::size_t> data_offsets(num_columns * num_partitions);
+  std::vector<std::size_t> mask_offsets(num_columns * num_partitions);
+  std::vector<std::size_t> buffer_sizes(num_partitions, 0);
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto const num_rows = h_offsets[p + 1] - h_offsets[p];
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const& col                      = input.column(c);
+      data_offsets[c * num_partitions + p] = buffer_sizes[p];
+      buffer_sizes[p] += util::round_up_safe(num_rows * cudf::size_of(col.type()), pack_align);
+      mask_offsets[c * num_partitions + p] = buffer_sizes[p];
+      if (col.nullable()) {
+        buffer_sizes[p] +=
+          util::round_up_safe(bitmask_allocation_size_bytes(num_rows), pack_align);
+      }
+    }
+  }
+
+  std::vector<std::unique_ptr<rmm::device_buffer>> buffers;
+  std::vector<uint8_t*> data_ptrs(num_columns * num_partitions, nullptr);
+  std::vector<bitmask_type*> mask_ptrs(num_columns * num_partitions, nullptr);
+  std::vector<size_type> word_offsets(num_partitions + 1, 0);
+  for (size_type p = 0; p < num_partitions; ++p) {
+    buffers.push_back(std::make_unique<rmm::device_buffer>(buffer_sizes[p], stream, mr));
+    auto const base = static_cast<uint8_t*>(buffers.back()->data());
+    if (h_offsets[p + 1] > h_offsets[p]) {
+      for (size_type c = 0; c < num_columns; ++c) {
+        data_ptrs[c * num_partitions + p] = base + data_offsets[c * num_partitions + p];
+        if (input.column(c).nullable()) {
+          mask_ptrs[c * num_partitions + p] =
+            reinterpret_cast<bitmask_type*>(base + mask_offsets[c * num_partitions + p]);
+        }
+      }
+    }
+    word_offsets[p + 1] = word_offsets[p] + num_bitmask_words(h_offsets[p + 1] - h_offsets[p]);
+  }
+
+  auto const d_data_ptrs    = cudf::detail::make_device_uvector_async(data_ptrs, stream);
+  auto const d_mask_ptrs    = cudf::detail::make_device_uvector_async(mask_ptrs, stream);
+  auto const d_word_offsets = cudf::detail::make_device_uvector_async(word_offsets, stream);
+  auto null_counts          = cudf::detail::make_zeroed_device_uvector_async<size_type>(
+    num_columns * num_partitions, stream);
+  for (size_type c = 0; c < num_columns; ++c) {
+    auto const& col = input.column(c);
+    cudf::type_dispatcher<dispatch_storage_type>(col.type(),
+                                                 copy_to_partitions_dispatcher{},
+                                                 col,
+                                                 gather_map.data(),
+                                                 offsets.data(),
+                                                 num_partitions,
+                                                 d_data_ptrs.data() + c * num_partitions,
+                                                 stream);
+    if (col.nullable()) {
+      auto const d_col = column_device_view::create(col, stream);
+      thrust::for_each_n(rmm::exec_policy(stream),
+                         thrust::make_counting_iterator<size_type>(0),
+                         word_offsets.back(),
+                         copy_masks_to_partitions_fn{*d_col,
+                                                     gather_map.data(),
+                                                     offsets.data(),
+                                                     d_word_offsets.data(),
+                                                     num_partitions,
+                                                     d_mask_ptrs.data() + c * num_partitions,
+                                                     null_counts.data() + c * num_partitions});
+    }
+  }
+  auto const h_null_counts = cudf::detail::make_std_vector_sync(null_counts, stream);
+
+  std::vector<packed_table> result;
+  for (size_type p = 0; p < num_partitions; ++p) {
+    std::vector<column_view> columns;
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const i = c * num_partitions + p;
+      columns.emplace_back(input.column(c).type(),
+                           h_offsets[p + 1] - h_offsets[p],
+                           data_ptrs[i],
+                           mask_ptrs[i],
+                           mask_ptrs[i] == nullptr ? 0 : h_null_counts[i]);
+    }
+    table_view const partition{columns};
+    auto const base = static_cast<uint8_t const*>(buffers[p]->data());
+    auto metadata   = std::make_unique<packed_columns::metadata>(
+      cudf::pack_metadata(partition, base, buffers[p]->size()));
+    result.push_back(
+      packed_table{partition, packed_columns{std::move(metadata), std::move(buffers[p])}});
+  }
+  return result;
+}
+
 // NOTE hash_has_nulls must be true if table_to_hash has nulls
 template <template <typename> class hash_function, bool hash_has_nulls>
 std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
@@ -453,13 +724,20 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
+  using hash_value_t   = cudf::detail::hash_result_t<hash_function>;
   auto const num_rows = table_to_hash.num_rows();
 
-  bool const use_optimization{num_partitions <= THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL};
-  auto const block_size = use_optimization ? OPTIMIZED_BLOCK_SIZE : FALLBACK_BLOCK_SIZE;
-  auto const rows_per_thread =
-    use_optimization ? OPTIMIZED_ROWS_PER_THREAD : FALLBACK_ROWS_PER_THREAD;
-  auto const rows_per_block = block_size * rows_per_thread;
+  auto const device_input = table_device_view::create(table_to_hash, stream);
+  auto const hasher       = row_hasher<hash_function, nullate::DYNAMIC>(
+    nullate::DYNAMIC{hash_has_nulls}, *device_input, seed);
+
+  // Too many partitions for the shared-memory partitioner are partitioned by a radix sort
+  if (num_partitions > THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL) {
+    return radix_partition_table(input, hasher, num_partitions, stream, mr);
+  }
+
+  auto const block_size     = OPTIMIZED_BLOCK_SIZE;
+  auto const rows_per_block = block_size * OPTIMIZED_ROWS_PER_THREAD;
 
   // NOTE grid_size is non-const to workaround lambda capture bug in gcc 5.4
   auto grid_size = util::div_rounding_up_safe(num_rows, rows_per_block);
@@ -485,16 +763,12 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
   auto row_partition_offset =
     cudf::detail::make_zeroed_device_uvector_async<size_type>(num_rows, stream);
 
-  auto const device_input = table_device_view::create(table_to_hash, stream);
-  auto const hasher       = row_hasher<hash_function, nullate::DYNAMIC>(
-    nullate::DYNAMIC{hash_has_nulls}, *device_input, seed);
-
   // If the number of partitions is a power of two, we can compute the partition
   // number of each row more efficiently with bitwise operations
   if (is_power_two(num_partitions)) {
     // Determines how the mapping between hash value and partition number is
     // computed
-    using partitioner_type = bitwise_partitioner<hash_value_type>;
+    using partitioner_type = bitwise_partitioner<hash_value_t>;
 
     // Computes which partition each row belongs to by hashing the row and
     // performing a partitioning operator on the hash value. Also computes the
@@ -514,7 +788,7 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
   } else {
     // Determines how the mapping between hash value and partition number is
     // computed
-    using partitioner_type = modulo_partitioner<hash_value_type>;
+    using partitioner_type = modulo_partitioner<hash_value_t>;
 
     // Computes which partition each row belongs to by hashing the row and
     // performing a partitioning operator on the hash value. Also computes the
@@ -553,64 +827,42 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
   auto const partition_offsets =
     cudf::detail::make_std_vector_async(global_partition_sizes, stream);
 
-  // When the number of partitions is less than a threshold, we can apply an
-  // optimization using shared memory to copy values to the output buffer.
-  // Otherwise, fallback to using scatter.
-  if (use_optimization) {
-    std::vector<std::unique_ptr<column>> output_cols(input.num_columns());
-
-    // Copy input to output by partition per column
-    std::transform(input.begin(), input.end(), output_cols.begin(), [&](auto const& col) {
-      return cudf::type_dispatcher<dispatch_storage_type>(col.type(),
-                                                          copy_block_partitions_dispatcher{},
-                                                          col,
-                                                          num_partitions,
-                                                          row_partition_numbers.data(),
-                                                          row_partition_offset.data(),
-                                                          block_partition_sizes.data(),
-                                                          scanned_block_partition_sizes.data(),
-                                                          grid_size,
-                                                          stream,
-                                                          mr);
-    });
-
-    if (has_nulls(input)) {
-      // Use copy_block_partitions to compute a gather map
-      auto gather_map = compute_gather_map(num_rows,
-                                           num_partitions,
-                                           row_partition_numbers.data(),
-                                           row_partition_offset.data(),
-                                           block_partition_sizes.data(),
-                                           scanned_block_partition_sizes.data(),
-                                           grid_size,
-                                           stream);
-
-      // Handle bitmask using gather to take advantage of ballot_sync
-      detail::gather_bitmask(
-        input, gather_map.begin(), output_cols, detail::gather_bitmask_op::DONT_CHECK, stream, mr);
-    }
+  std::vector<std::unique_ptr<column>> output_cols(input.num_columns());
+
+  // Copy input to output by partition per column
+  std::transform(input.begin(), input.end(), output_cols.begin(), [&](auto const& col) {
+    return cudf::type_dispatcher<dispatch_storage_type>(col.type(),
+                                                        copy_block_partitions_dispatcher{},
+                                                        col,
+                                                        num_partitions,
+                                                        row_partition_numbers.data(),
+                                                        row_partition_offset.data(),
+                                                        block_partition_sizes.data(),
+                                                        scanned_block_partition_sizes.data(),
+                                                        grid_size,
+                                                        stream,
+                                                        mr);
+  });
+
+  if (has_nulls(input)) {
+    // Use copy_block_partitions to compute a gather map
+    auto gather_map = compute_gather_map(num_rows,
+                                         num_partitions,
+                                         row_partition_numbers.data(),
+                                         row_partition_offset.data(),
+                                         block_partition_sizes.data(),
+                                         scanned_block_partition_sizes.data(),
+                                         grid_size,
+                                         stream);
 
-    stream.synchronize();  // Async D2H copy must finish before returning host vec
-    return std::make_pair(std::make_unique<table>(std::move(output_cols)),
-                          std::move(partition_offsets));
-  } else {
-    // Compute a scatter map from input to output such that the output rows are
-    // sorted by partition number
-    auto row_output_locations{row_partition_numbers.data()};
-    auto scanned_block_partition_sizes_ptr{scanned_block_partition_sizes.data()};
-    compute_row_output_locations<<<grid_size,
-                                   block_size,
-                                   num_partitions * sizeof(size_type),
-                                   stream.value()>>>(
-      row_output_locations, num_rows, num_partitions, scanned_block_partition_sizes_ptr);
-
-    // Use the resulting scatter map to materialize the output
-    auto output = detail::scatter(
-      input, row_partition_numbers.begin(), row_partition_numbers.end(), input, false, stream, mr);
-
-    stream.synchronize();  // Async D2H copy must finish before returning host vec
-    return std::make_pair(std::move(output), std::move(partition_offsets));
+    // Handle bitmask using gather to take advantage of ballot_sync
+    detail::gather_bitmask(
+      input, gather_map.begin(), output_cols, detail::gather_bitmask_op::DONT_CHECK, stream, mr);
   }
+
+  stream.synchronize();  // Async D2H copy must finish before returning host vec
+  return std::make_pair(std::make_unique<table>(std::move(output_cols)),
+                        std::move(partition_offsets));
 }
 
 struct dispatch_map_type {
@@ -735,6 +987,39 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
       input, table_to_hash, num_partitions, seed, stream, mr);
   }
 }
+
+template <template <typename> class hash_function>
+std::vector<packed_table> hash_partition_and_pack(table_view const& input,
+                                                  std::vector<size_type> const& columns_to_hash,
+                                                  int num_partitions,
+                                                  uint32_t seed,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  auto table_to_hash = input.select(columns_to_hash);
+
+  // Return empty result if there are no partitions or nothing to hash
+  if (num_partitions <= 0 || input.num_rows() == 0 || table_to_hash.num_columns() == 0) {
+    return {};
+  }
+
+  // Other than fixed-width columns are packed from the partitioned table
+  if (not std::all_of(input.begin(), input.end(), [](auto const& col) {
+        return is_fixed_width(col.type());
+      })) {
+    auto [partitioned, offsets] = hash_partition<hash_function>(
+      input, columns_to_hash, num_partitions, seed, stream, rmm::mr::get_current_device_resource());
+    offsets.erase(offsets.begin());
+    return detail::contiguous_split(partitioned->view(), offsets, stream, mr);
+  }
+
+  auto const device_input = table_device_view::create(table_to_hash, stream);
+  auto const hasher       = row_hasher<hash_function, nullate::DYNAMIC>(
+    nullate::DYNAMIC{has_nulls(table_to_hash)}, *device_input, seed);
+  auto const [gather_map, offsets] =
+    radix_partition_order(hasher, input.num_rows(), num_partitions, stream);
+  return pack_partitions(input, gather_map, offsets, stream, mr);
+}
 }  // namespace local
 
 std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
@@ -780,10 +1065,48 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
     case (hash_id::HASH_MURMUR3):
       return detail::local::hash_partition<MurmurHash3_32>(
         input, columns_to_hash, num_partitions, seed, stream, mr);
+    case (hash_id::HASH_XXHASH64):
+      return detail::local::hash_partition<XXHash_64>(
+        input, columns_to_hash, num_partitions, seed, stream, mr);
+    case (hash_id::HASH_MURMUR3_64):
+      return detail::local::hash_partition<MurmurHash3_64>(
+        input, columns_to_hash, num_partitions, seed, stream, mr);
     default: CUDF_FAIL("Unsupported hash function in hash_partition");
   }
 }
 
+// Partition based on hash values, straight into packed partitions
+std::vector<packed_table> hash_partition_and_pack(table_view const& input,
+                                                  std::vector<size_type> const& columns_to_hash,
+                                                  int num_partitions,
+                                                  hash_id hash_function,
+                                                  uint32_t seed,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  switch (hash_function) {
+    case (hash_id::HASH_IDENTITY):
+      for (const size_type& column_id : columns_to_hash) {
+        if (!is_numeric(input.column(column_id).type()))
+          CUDF_FAIL("IdentityHash does not support this data type");
+      }
+      return detail::local::hash_partition_and_pack<IdentityHash>(
+        input, columns_to_hash, num_partitions, seed, stream, mr);
+    case (hash_id::HASH_MURMUR3):
+      return detail::local::hash_partition_and_pack<MurmurHash3_32>(
+        input, columns_to_hash, num_partitions, seed, stream, mr);
+    case (hash_id::HASH_XXHASH64):
+      return detail::local::hash_partition_and_pack<XXHash_64>(
+        input, columns_to_hash, num_partitions, seed, stream, mr);
+    case (hash_id::HASH_MURMUR3_64):
+      return detail::local::hash_partition_and_pack<MurmurHash3_64>(
+        input, columns_to_hash, num_partitions, seed, stream, mr);
+    default: CUDF_FAIL("Unsupported hash function in hash_partition_and_pack");
+  }
+}
+
 // Partition based on an explicit partition map
 std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   table_view const& t,
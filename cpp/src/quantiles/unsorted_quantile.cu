@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <quantiles/quantiles_util.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/quantiles.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+constexpr int radix_bits        = 8;
+constexpr size_type radix_size  = 1 << radix_bits;
+constexpr size_type block_size  = 256;
+constexpr size_type max_blocks  = 1024;
+constexpr size_type shared_bins = 16 * radix_size;
+
+template <std::size_t size>
+struct unsigned_key;
+template <>
+struct unsigned_key<1> {
+  using type = uint8_t;
+};
+template <>
+struct unsigned_key<2> {
+  using type = uint16_t;
+};
+template <>
+struct unsigned_key<4> {
+  using type = uint32_t;
+};
+template <>
+struct unsigned_key<8> {
+  using type = uint64_t;
+};
+template <>
+struct unsigned_key<16> {
+  using type = __uint128_t;
+};
+
+/**
+ * @brief Unsigned integer whose order is the order of the values of `T`.
+ */
+template <typename T>
+using radix_key_t = typename unsigned_key<sizeof(T)>::type;
+
+template <typename Key>
+constexpr Key sign_bit = Key{1} << (8 * sizeof(Key) - 1);
+
+template <typename T>
+CUDF_HOST_DEVICE inline radix_key_t<T> to_radix_key(T value)
+{
+  using Key = radix_key_t<T>;
+  if constexpr (std::is_floating_point_v<T>) {
+    // All the NaNs are ordered after the infinity, as by the sort
+    if (std::isnan(value)) { value = std::numeric_limits<T>::quiet_NaN(); }
+    Key bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    return (bits & sign_bit<Key>) ? static_cast<Key>(~bits)
+                                  : static_cast<Key>(bits | sign_bit<Key>);
+  } else if constexpr (T(-1) < T(0)) {
+    return static_cast<Key>(value) ^ sign_bit<Key>;
+  } else {
+    return static_cast<Key>(value);
+  }
+}
+
+template <typename T>
+CUDF_HOST_DEVICE inline T from_radix_key(radix_key_t<T> key)
+{
+  using Key = radix_key_t<T>;
+  if constexpr (std::is_floating_point_v<T>) {
+    Key const bits = (key & sign_bit<Key>) ? static_cast<Key>(key ^ sign_bit<Key>)
+                                           : static_cast<Key>(~key);
+    T value;
+    std::memcpy(&value, &bits, sizeof(T));
+    return value;
+  } else if constexpr (T(-1) < T(0)) {
+    return static_cast<T>(key ^ sign_bit<Key>);
+  } else {
+    return static_cast<T>(key);
+  }
+}
+
+/**
+ * @brief Returns the bits of `key` above bit `shift`.
+ */
+template <typename Key>
+CUDF_HOST_DEVICE inline Key high_bits(Key key, int shift)
+{
+  return shift >= static_cast<int>(8 * sizeof(Key)) ? Key{0} : static_cast<Key>(key >> shift);
+}
+
+/**
+ * @brief Counts the digits at bit `shift` of the valid values whose higher bits are one of the
+ * sorted `prefixes`, into `radix_size` bins per prefix.
+ *
+ * The bins are accumulated in shared memory when they fit, and in global memory otherwise.
+ */
+template <typename T>
+__global__ void radix_histogram_kernel(column_device_view input,
+                                       radix_key_t<T> const* prefixes,
+                                       size_type num_prefixes,
+                                       int shift,
+                                       size_type* histogram)
+{
+  __shared__ size_type shared_histogram[shared_bins];
+  auto const num_bins   = num_prefixes * radix_size;
+  auto const use_shared = num_bins <= shared_bins;
+  if (use_shared) {
+    for (size_type bin = threadIdx.x; bin < num_bins; bin += blockDim.x) {
+      shared_histogram[bin] = 0;
+    }
+    __syncthreads();
+  }
+  auto const bins = use_shared ? shared_histogram : histogram;
+
+  size_type i = threadIdx.x + blockIdx.x * blockDim.x;
+  while (i < input.size()) {
+    if (input.is_valid(i)) {
+      auto const key    = to_radix_key(input.element<T>(i));
+      auto const prefix = high_bits(key, shift + radix_bits);
+      auto const end    = prefixes + num_prefixes;
+      auto const match  = thrust::lower_bound(thrust::seq, prefixes, end, prefix);
+      auto const digit  = static_cast<size_type>((key >> shift) & (radix_size - 1));
+      if (match != end and *match == prefix) {
+        atomicAdd(bins + (match - prefixes) * radix_size + digit, 1);
+      }
+    }
+    i += blockDim.x * gridDim.x;
+  }
+
+  if (use_shared) {
+    __syncthreads();
+    for (size_type bin = threadIdx.x; bin < num_bins; bin += blockDim.x) {
+      if (shared_histogram[bin] != 0) { atomicAdd(histogram + bin, shared_histogram[bin]); }
+    }
+  }
+}
+
+/**
+ * @brief Returns the values of the given ranks in the sorted order of the valid values.
+ *
+ * Each pass selects the next `radix_bits` bits of every rank from a histogram of the values
+ * matching its bits selected so far, so that all the ranks are selected in `sizeof(T)` passes.
+ */
+template <typename T>
+std::vector<T> select_ranks(column_view const& input,
+                            std::vector<size_type> const& ranks,
+                            rmm::cuda_stream_view stream)
+{
+  using Key               = radix_key_t<T>;
+  auto constexpr key_bits = static_cast<int>(8 * sizeof(Key));
+
+  auto const d_input = column_device_view::create(input, stream);
+  auto const grid    = grid_1d{input.size(), block_size};
+  auto const blocks  = std::min(grid.num_blocks, max_blocks);
+  rmm::device_uvector<size_type> d_histogram(ranks.size() * radix_size, stream);
+
+  std::vector<Key> prefixes(ranks.size(), 0);
+  std::vector<size_type> remaining(ranks);
+  for (int shift = key_bits - radix_bits; shift >= 0; shift -= radix_bits) {
+    auto distinct_prefixes = prefixes;
+    std::sort(distinct_prefixes.begin(), distinct_prefixes.end());
+    distinct_prefixes.erase(std::unique(distinct_prefixes.begin(), distinct_prefixes.end()),
+                            distinct_prefixes.end());
+    auto const d_prefixes = make_device_uvector_async(distinct_prefixes, stream);
+    auto const num_bins   = static_cast<size_type>(distinct_prefixes.size()) * radix_size;
+
+    CUDA_TRY(
+      cudaMemsetAsync(d_histogram.data(), 0, num_bins * sizeof(size_type), stream.value()));
+    radix_histogram_kernel<T>
+      <<<blocks, block_size, 0, stream.value()>>>(*d_input,
+                                                 d_prefixes.data(),
+                                                 static_cast<size_type>(distinct_prefixes.size()),
+                                                 shift,
+                                                 d_histogram.data());
+    auto const histogram =
+      make_std_vector_sync(device_span<size_type const>{d_histogram.data(), num_bins}, stream);
+
+    for (std::size_t j = 0; j < ranks.size(); ++j) {
+      auto const p =
+        std::lower_bound(distinct_prefixes.begin(), distinct_prefixes.end(), prefixes[j]) -
+        distinct_prefixes.begin();
+      auto const bins = histogram.data() + p * radix_size;
+      size_type digit = 0;
+      while (remaining[j] >= bins[digit]) {
+        remaining[j] -= bins[digit++];
+      }
+      prefixes[j] = static_cast<Key>(static_cast<Key>(prefixes[j] << radix_bits) | digit);
+    }
+  }
+
+  std::vector<T> values(ranks.size());
+  std::transform(prefixes.begin(), prefixes.end(), values.begin(), from_radix_key<T>);
+  return values;
+}
+
+struct unsorted_quantile_functor {
+  template <typename T, typename... Args>
+  std::enable_if_t<not std::is_arithmetic_v<T> and not cudf::is_fixed_point<T>(),
+                   std::unique_ptr<column>>
+  operator()(Args&&...)
+  {
+    CUDF_FAIL("quantile does not support non-numeric types");
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_arithmetic_v<T> or cudf::is_fixed_point<T>(), std::unique_ptr<column>>
+  operator()(column_view const& input,
+             std::vector<double> const& q,
+             interpolation interp,
+             bool exact,
+             rmm::cuda_stream_view stream,
+             rmm::mr::device_memory_resource* mr)
+  {
+    if (exact and not cudf::is_fixed_point<T>()) {
+      return compute<T, double>(input, q, interp, stream, mr);
+    }
+    return compute<T, device_storage_type_t<T>>(input, q, interp, stream, mr);
+  }
+
+  template <typename T, typename Result>
+  std::unique_ptr<column> compute(column_view const& input,
+                                  std::vector<double> const& q,
+                                  interpolation interp,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+  {
+    using StorageType = device_storage_type_t<T>;
+
+    auto const type =
+      is_fixed_point(input.type()) ? input.type() : data_type{type_to_id<Result>()};
+    auto const count = input.size() - input.null_count();
+    if (q.empty()) { return make_empty_column(type); }
+    if (count == 0) {
+      return make_fixed_width_column(type, q.size(), mask_state::ALL_NULL, stream, mr);
+    }
+
+    // The ranks of the values that the quantiles interpolate between
+    std::vector<size_type> ranks;
+    for (auto const quantile : q) {
+      auto const idx = quantile_index(count, quantile);
+      ranks.insert(ranks.end(), {idx.lower, idx.higher, idx.nearest});
+    }
+    std::sort(ranks.begin(), ranks.end());
+    ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+    auto const values = select_ranks<StorageType>(input, ranks, stream);
+
+    // Interpolates as `select_quantile_data` does between the sorted values
+    auto const value = [&](size_type rank) {
+      return values[std::lower_bound(ranks.begin(), ranks.end(), rank) - ranks.begin()];
+    };
+    std::vector<Result> results(q.size());
+    std::transform(q.begin(), q.end(), results.begin(), [&](double quantile) {
+      auto const idx = quantile_index(count, quantile);
+      switch (interp) {
+        case interpolation::LOWER: return static_cast<Result>(value(idx.lower));
+        case interpolation::HIGHER: return static_cast<Result>(value(idx.higher));
+        case interpolation::NEAREST: return static_cast<Result>(value(idx.nearest));
+        case interpolation::LINEAR:
+          return interpolate::linear<Result>(value(idx.lower), value(idx.higher), idx.fraction);
+        case interpolation::MIDPOINT:
+          return interpolate::midpoint<Result>(value(idx.lower), value(idx.higher));
+      }
+      CUDF_FAIL("Invalid interpolation operation for quantiles.");
+    });
+
+    auto d_results = make_device_uvector_sync(results, stream, mr);
+    return std::make_unique<column>(type, q.size(), d_results.release());
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> unsorted_quantile(column_view const& input,
+                                          std::vector<double> const& q,
+                                          interpolation interp,
+                                          bool exact,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(not cudf::is_dictionary(input.type()), "quantile does not support dictionaries");
+  return type_dispatcher(
+    input.type(), unsorted_quantile_functor{}, input, q, interp, exact, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> unsorted_quantile(column_view const& input,
+                                          std::vector<double> const& q,
+                                          interpolation interp,
+                                          bool exact,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::unsorted_quantile(input, q, interp, exact, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/reduction_functions.hpp>
+#include <cudf/detail/reduction_operators.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <cub/device/device_reduce.cuh>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace cudf {
+namespace reduction {
+namespace {
+
+bool is_fused_kind(aggregation::Kind kind)
+{
+  return kind == aggregation::SUM or kind == aggregation::SUM_OF_SQUARES or
+         kind == aggregation::MIN or kind == aggregation::MAX or kind == aggregation::MEAN or
+         kind == aggregation::VARIANCE or kind == aggregation::STD;
+}
+
+/**
+ * @brief The partial results of all the fused reductions of a column of `T`.
+ *
+ * The sums have the types of the SUM and SUM_OF_SQUARES reductions, and the moments the type of
+ * the MEAN, VARIANCE and STD reductions, so that the results are the same as theirs.
+ */
+template <typename T>
+struct fused_accumulator {
+  using sum_type = cudf::detail::target_type_t<T, aggregation::SUM>;
+
+  sum_type sum;
+  sum_type sum_of_squares;
+  var_std<double> moments;
+  T min;
+  T max;
+
+  CUDF_HOST_DEVICE inline static fused_accumulator identity()
+  {
+    return {0, 0, {}, DeviceMin::identity<T>(), DeviceMax::identity<T>()};
+  }
+};
+
+/**
+ * @brief Creates the accumulator of row `i` of a column, or the identity if it is null.
+ */
+template <typename T>
+struct fused_element_transformer {
+  column_device_view col;
+
+  __device__ inline fused_accumulator<T> operator()(size_type i) const
+  {
+    using sum_type = typename fused_accumulator<T>::sum_type;
+    if (col.is_null(i)) { return fused_accumulator<T>::identity(); }
+    auto const value     = col.element<T>(i);
+    auto const sum_value = static_cast<sum_type>(value);
+    auto const moment    = static_cast<double>(value);
+    return {sum_value, sum_value * sum_value, {moment, moment * moment}, value, value};
+  }
+};
+
+template <typename T>
+struct fused_binary_op {
+  __device__ inline fused_accumulator<T> operator()(fused_accumulator<T> const& lhs,
+                                                    fused_accumulator<T> const& rhs) const
+  {
+    return {lhs.sum + rhs.sum,
+            lhs.sum_of_squares + rhs.sum_of_squares,
+            lhs.moments + rhs.moments,
+            DeviceMin{}(lhs.min, rhs.min),
+            DeviceMax{}(lhs.max, rhs.max)};
+  }
+};
+
+template <typename T>
+constexpr bool is_fused_type()
+{
+  return std::is_arithmetic_v<T> and not std::is_same_v<T, bool>;
+}
+
+/**
+ * @brief Returns the size of the accumulator of a column, or 0 if its reductions are not fused.
+ */
+struct fused_accumulator_size {
+  template <typename T>
+  std::size_t operator()(column_view const& col)
+  {
+    if constexpr (is_fused_type<T>()) {
+      if (col.size() > col.null_count()) { return sizeof(fused_accumulator<T>); }
+    }
+    return 0;
+  }
+};
+
+/**
+ * @brief Reduces a column into its accumulator in device memory.
+ */
+struct fused_reduce_functor {
+  template <typename T>
+  void operator()(column_view const& col, void* accumulator, rmm::cuda_stream_view stream)
+  {
+    if constexpr (is_fused_type<T>()) {
+      auto const d_col    = column_device_view::create(col, stream);
+      auto const it       = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                      fused_element_transformer<T>{*d_col});
+      auto const d_out    = static_cast<fused_accumulator<T>*>(accumulator);
+      auto const identity = fused_accumulator<T>::identity();
+
+      std::size_t temp_storage_bytes = 0;
+      cub::DeviceReduce::Reduce(nullptr,
+                                temp_storage_bytes,
+                                it,
+                                d_out,
+                                col.size(),
+                                fused_binary_op<T>{},
+                                identity,
+                                stream.value());
+      auto d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
+      cub::DeviceReduce::Reduce(d_temp_storage.data(),
+                                temp_storage_bytes,
+                                it,
+                                d_out,
+                                col.size(),
+                                fused_binary_op<T>{},
+                                identity,
+                                stream.value());
+    }
+  }
+};
+
+/**
+ * @brief Makes the scalars of the fused aggregations of a column from its accumulator in host
+ * memory.
+ */
+struct fused_result_functor {
+  template <typename T>
+  void operator()(column_view const& col,
+                  uint8_t const* accumulator,
+                  std::vector<std::unique_ptr<aggregation>> const& aggs,
+                  std::vector<std::unique_ptr<scalar>>& results,
+                  rmm::cuda_stream_view stream,
+                  rmm::mr::device_memory_resource* mr)
+  {
+    if constexpr (is_fused_type<T>()) {
+      fused_accumulator<T> result;
+      std::memcpy(&result, accumulator, sizeof(result));
+
+      auto const count    = col.size() - col.null_count();
+      auto const variance = [&](aggregation const& agg) {
+        auto const ddof = dynamic_cast<cudf::detail::std_var_aggregation const&>(agg)._ddof;
+        return op::variance::intermediate<double>::compute_result(result.moments, count, ddof);
+      };
+      auto const make_scalar = [&](auto value) -> std::unique_ptr<scalar> {
+        return std::make_unique<numeric_scalar<decltype(value)>>(value, true, stream, mr);
+      };
+      for (std::size_t j = 0; j < aggs.size(); ++j) {
+        switch (aggs[j]->kind) {
+          case aggregation::SUM: results[j] = make_scalar(result.sum); break;
+          case aggregation::SUM_OF_SQUARES: results[j] = make_scalar(result.sum_of_squares); break;
+          case aggregation::MIN: results[j] = make_scalar(result.min); break;
+          case aggregation::MAX: results[j] = make_scalar(result.max); break;
+          case aggregation::MEAN: results[j] = make_scalar(result.moments.value / count); break;
+          case aggregation::VARIANCE: results[j] = make_scalar(variance(*aggs[j])); break;
+          case aggregation::STD: results[j] = make_scalar(std::sqrt(variance(*aggs[j]))); break;
+          default: break;
+        }
+      }
+    }
+  }
+};
+
+}  // namespace
+
+std::vector<std::vector<std::unique_ptr<scalar>>> fused_reduce(
+  std::vector<column_view> const& columns,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  std::vector<std::vector<std::unique_ptr<scalar>>> results(columns.size());
+  for (auto& column_results : results) {
+    column_results.resize(aggs.size());
+  }
+  auto const has_fused_kind = std::any_of(
+    aggs.begin(), aggs.end(), [](auto const& agg) { return is_fused_kind(agg->kind); });
+  if (not has_fused_kind) { return results; }
+
+  // The accumulators of all the columns share a buffer, so that they are copied back at once
+  auto constexpr alignment = alignof(std::max_align_t);
+  std::vector<std::size_t> offsets(columns.size(), 0);
+  std::vector<std::size_t> fused_columns;
+  std::size_t buffer_size = 0;
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    auto const size = type_dispatcher(columns[i].type(), fused_accumulator_size{}, columns[i]);
+    if (size == 0) { continue; }
+    fused_columns.push_back(i);
+    offsets[i]  = buffer_size;
+    buffer_size = cudf::util::round_up_safe(buffer_size + size, alignment);
+  }
+  if (fused_columns.empty()) { return results; }
+
+  auto accumulators = rmm::device_buffer{buffer_size, stream};
+  for (auto const i : fused_columns) {
+    type_dispatcher(columns[i].type(),
+                    fused_reduce_functor{},
+                    columns[i],
+                    static_cast<uint8_t*>(accumulators.data()) + offsets[i],
+                    stream);
+  }
+  std::vector<uint8_t> host_accumulators(buffer_size);
+  CUDA_TRY(cudaMemcpyAsync(host_accumulators.data(),
+                           accumulators.data(),
+                           buffer_size,
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+  stream.synchronize();
+
+  for (auto const i : fused_columns) {
+    type_dispatcher(columns[i].type(),
+                    fused_result_functor{},
+                    columns[i],
+                    host_accumulators.data() + offsets[i],
+                    aggs,
+                    results[i],
+                    stream,
+                    mr);
+  }
+  return results;
+}
+
+}  // namespace reduction
+}  // namespace cudf
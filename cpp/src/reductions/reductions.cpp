@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/hyperloglog/hyperloglog.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/quantiles.hpp>
 #include <cudf/detail/reduction_functions.hpp>
@@ -26,8 +27,11 @@
 #include <cudf/scalar/scalar_factories.hpp>
 
 #include <cudf/structs/structs_column_view.hpp>
+#include <cudf/table/table_view.hpp>
 #include <rmm/cuda_stream_view.hpp>
 
+#include <vector>
+
 namespace cudf {
 namespace detail {
 struct reduce_dispatch_functor {
@@ -67,6 +71,10 @@ struct reduce_dispatch_functor {
         return reduction::standard_deviation(col, output_dtype, var_agg->_ddof, stream, mr);
       } break;
       case aggregation::MEDIAN: {
+        if (not is_dictionary(col.type())) {
+          auto col_ptr = unsorted_quantile(col, {0.5}, interpolation::LINEAR, true, stream);
+          return get_element(*col_ptr, 0, stream, mr);
+        }
         auto sorted_indices = sorted_order(table_view{{col}}, {}, {null_order::AFTER}, stream);
         auto valid_sorted_indices =
           split(*sorted_indices, {col.size() - col.null_count()}, stream)[0];
@@ -78,6 +86,11 @@ struct reduce_dispatch_functor {
         auto quantile_agg = dynamic_cast<quantile_aggregation const*>(agg.get());
         CUDF_EXPECTS(quantile_agg->_quantiles.size() == 1,
                      "Reduction quantile accepts only one quantile value");
+        if (not is_dictionary(col.type())) {
+          auto col_ptr = unsorted_quantile(
+            col, quantile_agg->_quantiles, quantile_agg->_interpolation, true, stream);
+          return get_element(*col_ptr, 0, stream, mr);
+        }
         auto sorted_indices = sorted_order(table_view{{col}}, {}, {null_order::AFTER}, stream);
         auto valid_sorted_indices =
           split(*sorted_indices, {col.size() - col.null_count()}, stream)[0];
@@ -102,6 +115,22 @@ struct reduce_dispatch_functor {
         auto nth_agg = dynamic_cast<nth_element_aggregation const*>(agg.get());
         return reduction::nth_element(col, nth_agg->_n, nth_agg->_null_handling, stream, mr);
       } break;
+      case aggregation::HLL: {
+        auto hll_agg = dynamic_cast<hll_aggregation const*>(agg.get());
+        auto sketch  = hyperloglog::make_sketch(col, hll_agg->precision, stream);
+        return get_element(*sketch, 0, stream, mr);
+      } break;
+      case aggregation::MERGE_HLL: {
+        auto merge_agg = dynamic_cast<merge_hll_aggregation const*>(agg.get());
+        auto sketch    = hyperloglog::merge_sketch(col, merge_agg->precision, stream);
+        return get_element(*sketch, 0, stream, mr);
+      } break;
+      case aggregation::APPROX_NUNIQUE: {
+        auto approx_agg = dynamic_cast<approx_nunique_aggregation const*>(agg.get());
+        auto sketch     = hyperloglog::make_sketch(col, approx_agg->precision, stream);
+        auto estimate   = hyperloglog::estimate_distinct_count(*sketch, stream);
+        return get_element(*estimate, 0, stream, mr);
+      } break;
       default: CUDF_FAIL("Unsupported reduction operator");
     }
   }
@@ -115,8 +144,12 @@ std::unique_ptr<scalar> reduce(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
   // Returns default scalar if input column is non-valid. In terms of nested columns, we need to
-  // handcraft the default scalar with input column.
-  if (col.size() <= col.null_count()) {
+  // handcraft the default scalar with input column. The HyperLogLog sketches of such a column
+  // are still valid, with all their registers zero.
+  auto const is_sketch_aggregation = agg->kind == aggregation::HLL or
+                                     agg->kind == aggregation::MERGE_HLL or
+                                     agg->kind == aggregation::APPROX_NUNIQUE;
+  if (col.size() <= col.null_count() and not is_sketch_aggregation) {
     if (col.type().id() == type_id::EMPTY || col.type() != output_dtype) {
       return make_default_constructed_scalar(output_dtype, stream, mr);
     }
@@ -126,6 +159,25 @@ std::unique_ptr<scalar> reduce(
   return aggregation_dispatcher(
     agg->kind, reduce_dispatch_functor{col, output_dtype, stream, mr}, agg);
 }
+
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce(
+  table_view const& input,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  auto const columns = std::vector<column_view>(input.begin(), input.end());
+  auto results       = reduction::fused_reduce(columns, aggs, stream, mr);
+  // The aggregations that are not fused are reduced one column at a time
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    for (std::size_t j = 0; j < aggs.size(); ++j) {
+      if (results[i][j]) { continue; }
+      auto const output_dtype = target_type(columns[i].type(), aggs[j]->kind);
+      results[i][j]           = reduce(columns[i], aggs[j], output_dtype, stream, mr);
+    }
+  }
+  return results;
+}
 }  // namespace detail
 
 std::unique_ptr<scalar> reduce(column_view const& col,
@@ -137,4 +189,13 @@ std::unique_ptr<scalar> reduce(column_view const& col,
   return detail::reduce(col, agg, output_dtype, rmm::cuda_stream_default, mr);
 }
 
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce(
+  table_view const& input,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce(input, aggs, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
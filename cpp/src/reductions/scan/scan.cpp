@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -48,4 +48,15 @@ std::unique_ptr<column> scan(column_view const& input,
            : detail::scan_inclusive(input, agg, null_handling, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> segmented_scan(column_view const& input,
+                                       column_view const& segment_offsets,
+                                       std::unique_ptr<aggregation> const& agg,
+                                       null_policy null_handling,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_scan_inclusive(
+    input, segment_offsets, agg, null_handling, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/scan.hpp>
+#include <cudf/detail/structs/utilities.hpp>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/transform_output_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/uninitialized_fill.h>
+
+#include <algorithm>
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Element of a segmented scan: a value, whether no null was found so far in its segment,
+ * and whether it starts a segment.
+ */
+template <typename T>
+struct segmented_value {
+  T value;
+  bool valid;
+  bool head;
+};
+
+/**
+ * @brief Applies `Op` to the values of the same segment, and restarts the scan at each head.
+ *
+ * This operator is associative, so that a segmented scan is a single inclusive scan over all the
+ * segments, using the decoupled look-back of the device-wide scan instead of the group labels of
+ * a scan by key.
+ */
+template <typename Op>
+struct segmented_scan_op {
+  template <typename T>
+  __device__ inline segmented_value<T> operator()(segmented_value<T> const& lhs,
+                                                  segmented_value<T> const& rhs) const
+  {
+    if (rhs.head) { return rhs; }
+    return {static_cast<T>(Op{}(lhs.value, rhs.value)), lhs.valid and rhs.valid, lhs.head};
+  }
+};
+
+template <typename T, typename Op>
+struct segmented_element {
+  column_device_view input;
+  bool const* heads;
+
+  __device__ inline segmented_value<T> operator()(size_type i) const
+  {
+    auto const valid = input.is_valid(i);
+    return {valid ? input.element<T>(i) : Op::template identity<T>(), valid, i == 0 or heads[i]};
+  }
+};
+
+template <typename T>
+struct segmented_value_writer {
+  __device__ inline T operator()(segmented_value<T> const& element) const
+  {
+    return element.value;
+  }
+};
+
+template <typename T>
+struct segmented_value_validity_writer {
+  __device__ inline thrust::tuple<T, bool> operator()(segmented_value<T> const& element) const
+  {
+    return thrust::make_tuple(element.value, element.valid);
+  }
+};
+
+/**
+ * @brief Returns whether each row starts a segment, except the first row, which always does.
+ */
+rmm::device_uvector<bool> segment_heads(size_type num_rows,
+                                        column_view const& segment_offsets,
+                                        rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<bool> heads(num_rows, stream);
+  thrust::uninitialized_fill(rmm::exec_policy(stream), heads.begin(), heads.end(), false);
+  thrust::for_each(rmm::exec_policy(stream),
+                   segment_offsets.begin<size_type>(),
+                   segment_offsets.end<size_type>(),
+                   [heads = heads.data(), num_rows] __device__(size_type offset) {
+                     if (offset >= 0 and offset < num_rows) { heads[offset] = true; }
+                   });
+  return heads;
+}
+
+template <typename Op>
+struct segmented_scan_dispatcher {
+ private:
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return cudf::is_fixed_width<T>() and std::is_invocable_v<Op, T, T>;
+  }
+
+ public:
+  template <typename T, std::enable_if_t<is_supported<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     device_span<bool const> heads,
+                                     null_policy null_handling,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    auto output =
+      detail::allocate_like(input, input.size(), mask_allocation_policy::NEVER, stream, mr);
+    auto d_input        = column_device_view::create(input, stream);
+    auto const elements = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      segmented_element<T, Op>{*d_input, heads.data()});
+    auto const scan = [&](auto out) {
+      thrust::inclusive_scan(rmm::exec_policy(stream),
+                             elements,
+                             elements + input.size(),
+                             out,
+                             segmented_scan_op<Op>{});
+    };
+    auto const out_values = output->mutable_view().begin<T>();
+
+    if (null_handling == null_policy::INCLUDE and input.has_nulls()) {
+      // A null value makes the rest of its segment null
+      rmm::device_uvector<bool> validity(input.size(), stream);
+      scan(thrust::make_transform_output_iterator(
+        thrust::make_zip_iterator(thrust::make_tuple(out_values, validity.begin())),
+        segmented_value_validity_writer<T>{}));
+      auto [null_mask, null_count] =
+        detail::valid_if(validity.begin(), validity.end(), thrust::identity{}, stream, mr);
+      output->set_null_mask(std::move(null_mask), null_count);
+    } else {
+      scan(thrust::make_transform_output_iterator(out_values, segmented_value_writer<T>{}));
+      if (input.nullable()) {
+        output->set_null_mask(detail::copy_bitmask(input, stream, mr), input.null_count());
+      }
+    }
+    return output;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<!is_supported<T>(), std::unique_ptr<column>> operator()(Args&&...)
+  {
+    CUDF_FAIL("Unsupported type for segmented scan operation");
+  }
+};
+
+/**
+ * @brief The rows that start the segment and the last run of equal rows of a rank scan.
+ */
+struct rank_state {
+  size_type segment_start;
+  size_type run_start;
+};
+
+struct rank_state_op {
+  __device__ inline rank_state operator()(rank_state const& lhs, rank_state const& rhs) const
+  {
+    return {lhs.segment_start, std::max(lhs.run_start, rhs.run_start)};
+  }
+};
+
+struct rank_writer {
+  __device__ inline size_type operator()(segmented_value<rank_state> const& element) const
+  {
+    return element.value.run_start - element.value.segment_start + 1;
+  }
+};
+
+std::unique_ptr<column> segmented_rank_scan(column_view const& order_by,
+                                            device_span<bool const> heads,
+                                            aggregation::Kind kind,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(!cudf::structs::detail::is_or_has_nested_lists(order_by),
+               "Unsupported list type in segmented rank scan.");
+  auto const flattened = cudf::structs::detail::flatten_nested_columns(
+    table_view{{order_by}}, {}, {}, structs::detail::column_nullability::MATCH_INCOMING);
+  auto const d_flat_order = table_device_view::create(flattened, stream);
+  row_equality_comparator comparator(nullate::DYNAMIC{has_nested_nulls(table_view{{order_by}})},
+                                     *d_flat_order,
+                                     *d_flat_order,
+                                     null_equality::EQUAL);
+  auto ranks      = make_fixed_width_column(
+    data_type{type_to_id<size_type>()}, order_by.size(), mask_state::UNALLOCATED, stream, mr);
+  auto const rows = thrust::make_counting_iterator<size_type>(0);
+
+  if (kind == aggregation::RANK) {
+    auto const elements = thrust::make_transform_iterator(
+      rows, [comparator, heads = heads.data()] __device__(size_type i) {
+        bool const head      = i == 0 or heads[i];
+        bool const run_start = head or not comparator(i, i - 1);
+        return segmented_value<rank_state>{{i, run_start ? i : 0}, true, head};
+      });
+    thrust::inclusive_scan(
+      rmm::exec_policy(stream),
+      elements,
+      elements + order_by.size(),
+      thrust::make_transform_output_iterator(ranks->mutable_view().begin<size_type>(),
+                                             rank_writer{}),
+      segmented_scan_op<rank_state_op>{});
+  } else {
+    auto const elements = thrust::make_transform_iterator(
+      rows, [comparator, heads = heads.data()] __device__(size_type i) {
+        bool const head      = i == 0 or heads[i];
+        bool const run_start = head or not comparator(i, i - 1);
+        return segmented_value<size_type>{run_start ? 1 : 0, true, head};
+      });
+    thrust::inclusive_scan(
+      rmm::exec_policy(stream),
+      elements,
+      elements + order_by.size(),
+      thrust::make_transform_output_iterator(ranks->mutable_view().begin<size_type>(),
+                                             segmented_value_writer<size_type>{}),
+      segmented_scan_op<DeviceSum>{});
+  }
+  return ranks;
+}
+
+}  // namespace
+
+std::unique_ptr<column> segmented_scan_inclusive(column_view const& input,
+                                                 column_view const& segment_offsets,
+                                                 std::unique_ptr<aggregation> const& agg,
+                                                 null_policy null_handling,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(segment_offsets.type() == data_type(type_to_id<size_type>()),
+               "segment_offsets must be of type size_type");
+  auto const heads = segment_heads(input.size(), segment_offsets, stream);
+
+  switch (agg->kind) {
+    case aggregation::SUM:
+      return type_dispatcher<dispatch_storage_type>(input.type(),
+                                                    segmented_scan_dispatcher<DeviceSum>{},
+                                                    input,
+                                                    heads,
+                                                    null_handling,
+                                                    stream,
+                                                    mr);
+    case aggregation::MIN:
+      return type_dispatcher<dispatch_storage_type>(input.type(),
+                                                    segmented_scan_dispatcher<DeviceMin>{},
+                                                    input,
+                                                    heads,
+                                                    null_handling,
+                                                    stream,
+                                                    mr);
+    case aggregation::MAX:
+      return type_dispatcher<dispatch_storage_type>(input.type(),
+                                                    segmented_scan_dispatcher<DeviceMax>{},
+                                                    input,
+                                                    heads,
+                                                    null_handling,
+                                                    stream,
+                                                    mr);
+    case aggregation::PRODUCT:
+      if (is_fixed_point(input.type())) CUDF_FAIL("decimal32/64/128 cannot support product scan");
+      return type_dispatcher<dispatch_storage_type>(input.type(),
+                                                    segmented_scan_dispatcher<DeviceProduct>{},
+                                                    input,
+                                                    heads,
+                                                    null_handling,
+                                                    stream,
+                                                    mr);
+    case aggregation::RANK:
+    case aggregation::DENSE_RANK:
+      return segmented_rank_scan(input, heads, agg->kind, stream, mr);
+    default: CUDF_FAIL("Unsupported aggregation operator for segmented scan");
+  }
+}
+
+}  // namespace detail
+}  // namespace cudf
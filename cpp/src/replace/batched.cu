@@ -0,0 +1,477 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file batched.cu
+ * @brief Table-level replace_nulls and clamp, processing all the fixed-width columns of a table
+ * with one kernel launch per element size or type.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/replace.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/replace.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/host_vector.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+constexpr size_type block_size = 256;
+
+/**
+ * @brief Returns the launch grid of a batched kernel.
+ *
+ * The blocks stride over the rows of a column along x, and over the columns of the batch along y.
+ */
+dim3 batch_grid(size_type num_rows, std::size_t num_columns)
+{
+  return dim3(grid_1d(num_rows, block_size).num_blocks,
+              std::min<std::size_t>(num_columns, std::numeric_limits<uint16_t>::max()));
+}
+
+/**
+ * @brief Copies the null mask of a column, starting at bit `offset` of `source`, by the threads
+ * of the blocks along x.
+ */
+__device__ void copy_mask_words(bitmask_type const* source,
+                                size_type offset,
+                                bitmask_type* destination,
+                                size_type size)
+{
+  auto const num_words = word_index(size - 1) + 1;
+  for (size_type w = blockIdx.x * blockDim.x + threadIdx.x; w < num_words;
+       w += blockDim.x * gridDim.x) {
+    destination[w] = get_mask_offset_word(source, w, offset, offset + size);
+  }
+}
+
+/**
+ * @brief Returns the device pointer to the value of a fixed-width scalar.
+ */
+struct scalar_data_fn {
+  template <typename T, std::enable_if_t<is_fixed_width<T>()>* = nullptr>
+  void const* operator()(scalar const& value)
+  {
+    return static_cast<scalar_type_t<T> const&>(value).data();
+  }
+
+  template <typename T, std::enable_if_t<not is_fixed_width<T>()>* = nullptr>
+  void const* operator()(scalar const&)
+  {
+    CUDF_FAIL("Batched operations only support fixed-width scalars");
+  }
+};
+
+template <typename T>
+T const* scalar_data(scalar const& value)
+{
+  return static_cast<T const*>(type_dispatcher(value.type(), scalar_data_fn{}, value));
+}
+
+/**
+ * @brief Returns the validity of scalars, all copied to the host at once.
+ */
+thrust::host_vector<bool> scalars_validity(std::vector<scalar const*> const& scalars,
+                                           rmm::cuda_stream_view stream)
+{
+  std::vector<bool const*> h_validity(scalars.size());
+  std::transform(scalars.begin(), scalars.end(), h_validity.begin(), [](auto value) {
+    return value->validity_data();
+  });
+  auto const d_validity = make_device_uvector_async(h_validity, stream);
+  rmm::device_uvector<bool> is_valid(scalars.size(), stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    d_validity.begin(),
+                    d_validity.end(),
+                    is_valid.begin(),
+                    [] __device__(bool const* validity) { return *validity; });
+  return make_host_vector_sync(is_valid, stream);
+}
+
+/**
+ * @brief Groups the indices of the fixed-width columns of a table by a key of their type.
+ */
+template <typename Key, typename KeyFn>
+std::vector<std::pair<Key, std::vector<size_type>>> group_fixed_width_columns(
+  table_view const& input, KeyFn key_fn)
+{
+  std::vector<std::pair<Key, std::vector<size_type>>> groups;
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    if (not is_fixed_width(input.column(i).type())) { continue; }
+    auto const key = key_fn(input.column(i).type());
+    auto group     = std::find_if(
+      groups.begin(), groups.end(), [&key](auto const& g) { return g.first == key; });
+    if (group == groups.end()) {
+      groups.emplace_back(key, std::vector<size_type>{i});
+    } else {
+      group->second.push_back(i);
+    }
+  }
+  return groups;
+}
+
+/**
+ * @brief Allocates the output of a batched operation on a fixed-width column.
+ *
+ * The null mask is allocated if the mask of `input` is to be copied to it.
+ */
+std::unique_ptr<column> allocate_batch_output(column_view const& input,
+                                              bool copy_mask,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  return make_fixed_width_column(input.type(),
+                                 input.size(),
+                                 copy_mask ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED,
+                                 stream,
+                                 mr);
+}
+
+/**
+ * @brief Parameters of the batched replace_nulls of a column.
+ */
+template <typename T>
+struct replace_nulls_batch {
+  T const* input;
+  bitmask_type const* input_mask;
+  size_type offset;
+  T* output;
+  bitmask_type* output_mask;  ///< Set when the null mask of the input is copied
+  T const* replacement;       ///< Set when the input has nulls and the replacement is valid
+};
+
+template <typename T>
+__global__ void replace_nulls_batch_kernel(device_span<replace_nulls_batch<T> const> batch,
+                                           size_type num_rows)
+{
+  for (auto c = static_cast<std::size_t>(blockIdx.y); c < batch.size(); c += gridDim.y) {
+    auto const column = batch[c];
+    for (size_type i = blockIdx.x * blockDim.x + threadIdx.x; i < num_rows;
+         i += blockDim.x * gridDim.x) {
+      auto const replace =
+        column.replacement != nullptr && not bit_is_set(column.input_mask, column.offset + i);
+      column.output[i] = replace ? *column.replacement : column.input[i];
+    }
+    if (column.output_mask != nullptr) {
+      copy_mask_words(column.input_mask, column.offset, column.output_mask, num_rows);
+    }
+  }
+}
+
+/**
+ * @brief Replaces the nulls of fixed-width columns of the same element size, moving the elements
+ * as unsigned integers of that size.
+ */
+template <typename T>
+void replace_nulls_batched(table_view const& input,
+                           std::vector<size_type> const& indices,
+                           std::vector<std::reference_wrapper<scalar const>> const& replacements,
+                           thrust::host_vector<bool> const& replacements_valid,
+                           std::vector<std::unique_ptr<column>>& output,
+                           rmm::cuda_stream_view stream,
+                           rmm::mr::device_memory_resource* mr)
+{
+  std::vector<replace_nulls_batch<T>> h_batch;
+  h_batch.reserve(indices.size());
+  for (auto const i : indices) {
+    auto const& column = input.column(i);
+    auto const replace   = column.has_nulls() and replacements_valid[i];
+    auto const copy_mask = column.nullable() and not replace;
+    output[i]            = allocate_batch_output(column, copy_mask, stream, mr);
+    if (copy_mask) { output[i]->set_null_count(column.null_count()); }
+    h_batch.push_back({static_cast<T const*>(column.head()) + column.offset(),
+                       column.null_mask(),
+                       column.offset(),
+                       static_cast<T*>(output[i]->mutable_view().head()),
+                       output[i]->mutable_view().null_mask(),
+                       replace ? scalar_data<T>(replacements[i].get()) : nullptr});
+  }
+
+  auto const d_batch = make_device_uvector_async(h_batch, stream);
+  replace_nulls_batch_kernel<T>
+    <<<batch_grid(input.num_rows(), d_batch.size()), block_size, 0, stream.value()>>>(
+      d_batch, input.num_rows());
+  CHECK_CUDA(stream.value());
+}
+
+/**
+ * @brief Parameters of the batched clamp of a column.
+ */
+template <typename T>
+struct clamp_batch {
+  T const* input;
+  bitmask_type const* input_mask;
+  size_type offset;
+  T* output;
+  bitmask_type* output_mask;  ///< Set when the input is nullable
+  T const* lo;
+  bool const* lo_valid;
+  T const* lo_replace;
+  T const* hi;
+  bool const* hi_valid;
+  T const* hi_replace;
+};
+
+template <typename T>
+__global__ void clamp_batch_kernel(device_span<clamp_batch<T> const> batch, size_type num_rows)
+{
+  for (auto c = static_cast<std::size_t>(blockIdx.y); c < batch.size(); c += gridDim.y) {
+    auto const column   = batch[c];
+    auto const lo_valid = *column.lo_valid;
+    auto const hi_valid = *column.hi_valid;
+    // The replacements may be null only when their limits are
+    auto const lo         = lo_valid ? *column.lo : T{};
+    auto const lo_replace = lo_valid ? *column.lo_replace : T{};
+    auto const hi         = hi_valid ? *column.hi : T{};
+    auto const hi_replace = hi_valid ? *column.hi_replace : T{};
+    for (size_type i = blockIdx.x * blockDim.x + threadIdx.x; i < num_rows;
+         i += blockDim.x * gridDim.x) {
+      auto const element = column.input[i];
+      column.output[i]   = lo_valid && element < lo   ? lo_replace
+                           : hi_valid && element > hi ? hi_replace
+                                                      : element;
+    }
+    if (column.output_mask != nullptr) {
+      copy_mask_words(column.input_mask, column.offset, column.output_mask, num_rows);
+    }
+  }
+}
+
+/**
+ * @brief Clamps fixed-width columns of the same type.
+ */
+struct clamp_batched_fn {
+  template <typename T, std::enable_if_t<is_fixed_width<T>()>* = nullptr>
+  void operator()(table_view const& input,
+                  std::vector<size_type> const& indices,
+                  std::vector<std::reference_wrapper<scalar const>> const& lo,
+                  std::vector<std::reference_wrapper<scalar const>> const& lo_replace,
+                  std::vector<std::reference_wrapper<scalar const>> const& hi,
+                  std::vector<std::reference_wrapper<scalar const>> const& hi_replace,
+                  std::vector<std::unique_ptr<column>>& output,
+                  rmm::cuda_stream_view stream,
+                  rmm::mr::device_memory_resource* mr)
+  {
+    std::vector<clamp_batch<T>> h_batch;
+    h_batch.reserve(indices.size());
+    for (auto const i : indices) {
+      auto const& column = input.column(i);
+      output[i]          = allocate_batch_output(column, column.nullable(), stream, mr);
+      if (column.nullable()) { output[i]->set_null_count(column.null_count()); }
+      h_batch.push_back({static_cast<T const*>(column.head()) + column.offset(),
+                         column.null_mask(),
+                         column.offset(),
+                         static_cast<T*>(output[i]->mutable_view().head()),
+                         output[i]->mutable_view().null_mask(),
+                         scalar_data<T>(lo[i].get()),
+                         lo[i].get().validity_data(),
+                         scalar_data<T>(lo_replace[i].get()),
+                         scalar_data<T>(hi[i].get()),
+                         hi[i].get().validity_data(),
+                         scalar_data<T>(hi_replace[i].get())});
+    }
+
+    auto const d_batch = make_device_uvector_async(h_batch, stream);
+    clamp_batch_kernel<T>
+      <<<batch_grid(input.num_rows(), d_batch.size()), block_size, 0, stream.value()>>>(
+        d_batch, input.num_rows());
+    CHECK_CUDA(stream.value());
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_fixed_width<T>()> operator()(Args&&...)
+  {
+    CUDF_FAIL("Batched clamp only supports fixed-width columns");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<table> replace_nulls(
+  table_view const& input,
+  std::vector<std::reference_wrapper<scalar const>> const& replacements,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(static_cast<std::size_t>(input.num_columns()) == replacements.size(),
+               "Number of replacements must match the number of columns");
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    CUDF_EXPECTS(input.column(i).type() == replacements[i].get().type(), "Data type mismatch");
+  }
+  if (input.num_rows() == 0) { return empty_like(input); }
+
+  std::vector<scalar const*> scalars(replacements.size());
+  std::transform(replacements.begin(), replacements.end(), scalars.begin(), [](auto value) {
+    return &value.get();
+  });
+  auto const replacements_valid = scalars_validity(scalars, stream);
+
+  std::vector<std::unique_ptr<column>> output(input.num_columns());
+  auto const groups =
+    group_fixed_width_columns<std::size_t>(input, [](data_type type) { return size_of(type); });
+  for (auto const& [element_size, indices] : groups) {
+    auto const replace = [&, &indices = indices](auto element) {
+      replace_nulls_batched<decltype(element)>(
+        input, indices, replacements, replacements_valid, output, stream, mr);
+    };
+    switch (element_size) {
+      case 1: replace(uint8_t{}); break;
+      case 2: replace(uint16_t{}); break;
+      case 4: replace(uint32_t{}); break;
+      case 8: replace(uint64_t{}); break;
+      case 16: replace(__int128_t{}); break;
+      default: CUDF_FAIL("Unsupported element size");
+    }
+  }
+
+  // The other columns are processed one by one
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    if (output[i] == nullptr) {
+      output[i] = replace_nulls(input.column(i), replacements[i].get(), stream, mr);
+    }
+  }
+  return std::make_unique<table>(std::move(output));
+}
+
+std::unique_ptr<table> clamp(table_view const& input,
+                             std::vector<std::reference_wrapper<scalar const>> const& lo,
+                             std::vector<std::reference_wrapper<scalar const>> const& lo_replace,
+                             std::vector<std::reference_wrapper<scalar const>> const& hi,
+                             std::vector<std::reference_wrapper<scalar const>> const& hi_replace,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr)
+{
+  auto const num_columns = static_cast<std::size_t>(input.num_columns());
+  CUDF_EXPECTS(lo.size() == num_columns && lo_replace.size() == num_columns &&
+                 hi.size() == num_columns && hi_replace.size() == num_columns,
+               "Number of limit and replace scalars must match the number of columns");
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    CUDF_EXPECTS(lo[i].get().type() == hi[i].get().type(), "mismatching types of limit scalars");
+    CUDF_EXPECTS(lo_replace[i].get().type() == hi_replace[i].get().type(),
+                 "mismatching types of replace scalars");
+    CUDF_EXPECTS(lo[i].get().type() == lo_replace[i].get().type(),
+                 "mismatching types of limit and replace scalars");
+    CUDF_EXPECTS(lo[i].get().type() == input.column(i).type(),
+                 "mismatching types of scalar and input");
+  }
+
+  // The validity of all the scalars is checked with a single copy to the host
+  std::vector<scalar const*> scalars;
+  scalars.reserve(4 * num_columns);
+  for (auto const* limits : {&lo, &lo_replace, &hi, &hi_replace}) {
+    std::transform(limits->begin(), limits->end(), std::back_inserter(scalars), [](auto value) {
+      return &value.get();
+    });
+  }
+  auto const valid = scalars_validity(scalars, stream);
+  for (std::size_t i = 0; i < num_columns; ++i) {
+    CUDF_EXPECTS(not valid[i] or valid[num_columns + i],
+                 "lo_replace can't be null if lo is not null");
+    CUDF_EXPECTS(not valid[2 * num_columns + i] or valid[3 * num_columns + i],
+                 "hi_replace can't be null if hi is not null");
+  }
+  if (input.num_rows() == 0) { return empty_like(input); }
+
+  std::vector<std::unique_ptr<column>> output(input.num_columns());
+  auto const groups = group_fixed_width_columns<data_type>(input, [](data_type type) {
+    return type;
+  });
+  for (auto const& [type, indices] : groups) {
+    type_dispatcher<dispatch_storage_type>(type,
+                                           clamp_batched_fn{},
+                                           input,
+                                           indices,
+                                           lo,
+                                           lo_replace,
+                                           hi,
+                                           hi_replace,
+                                           output,
+                                           stream,
+                                           mr);
+  }
+
+  // The other columns are processed one by one
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    if (output[i] == nullptr) {
+      output[i] = clamp(input.column(i),
+                        lo[i].get(),
+                        lo_replace[i].get(),
+                        hi[i].get(),
+                        hi_replace[i].get(),
+                        stream,
+                        mr);
+    }
+  }
+  return std::make_unique<table>(std::move(output));
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> replace_nulls(
+  table_view const& input,
+  std::vector<std::reference_wrapper<scalar const>> const& replacements,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::replace_nulls(input, replacements, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<table> clamp(table_view const& input,
+                             std::vector<std::reference_wrapper<scalar const>> const& lo,
+                             std::vector<std::reference_wrapper<scalar const>> const& lo_replace,
+                             std::vector<std::reference_wrapper<scalar const>> const& hi,
+                             std::vector<std::reference_wrapper<scalar const>> const& hi_replace,
+                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::clamp(input, lo, lo_replace, hi, hi_replace, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<table> clamp(table_view const& input,
+                             std::vector<std::reference_wrapper<scalar const>> const& lo,
+                             std::vector<std::reference_wrapper<scalar const>> const& hi,
+                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::clamp(input, lo, lo, hi, hi, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
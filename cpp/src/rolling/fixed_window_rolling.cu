@@ -0,0 +1,469 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rolling/fixed_window_rolling.hpp"
+#include "rolling/rolling_detail.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/reverse_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <cuda/std/limits>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief The aggregated value of the valid rows of a range and the number of these rows.
+ */
+template <typename T>
+struct window_value {
+  T value;
+  size_type count;
+};
+
+/**
+ * @brief Combines the values of two ranges with the binary operator of the aggregation.
+ */
+template <typename T, typename Op>
+struct combine_values_fn {
+  __device__ window_value<T> operator()(window_value<T> const& lhs,
+                                        window_value<T> const& rhs) const
+  {
+    return {Op{}(lhs.value, rhs.value), lhs.count + rhs.count};
+  }
+};
+
+/**
+ * @brief Returns the value of each row to aggregate, the identity of the operator for nulls.
+ */
+template <typename T, typename OutputType, typename Op>
+struct element_value_fn {
+  column_device_view const d_input;
+
+  __device__ window_value<OutputType> operator()(size_type idx) const
+  {
+    if (d_input.is_null(idx)) { return {Op::template identity<OutputType>(), 0}; }
+    return {static_cast<OutputType>(d_input.element<T>(idx)), 1};
+  }
+};
+
+/**
+ * @brief The number, mean and sum of the squared differences to the mean of the valid rows of a
+ * range.
+ */
+struct window_moments {
+  size_type count;
+  double mean;
+  double m2;
+};
+
+/**
+ * @brief Combines the moments of two ranges.
+ *
+ * See https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+ */
+struct combine_moments_fn {
+  __device__ window_moments operator()(window_moments const& lhs, window_moments const& rhs) const
+  {
+    if (lhs.count == 0) { return rhs; }
+    if (rhs.count == 0) { return lhs; }
+    auto const count = lhs.count + rhs.count;
+    auto const delta = rhs.mean - lhs.mean;
+    auto const ratio = static_cast<double>(rhs.count) / count;
+    return {count, lhs.mean + delta * ratio, lhs.m2 + rhs.m2 + delta * delta * lhs.count * ratio};
+  }
+};
+
+/**
+ * @brief Returns the moments of each row, of no rows for nulls.
+ */
+template <typename T>
+struct element_moments_fn {
+  column_device_view const d_input;
+
+  __device__ window_moments operator()(size_type idx) const
+  {
+    if (d_input.is_null(idx)) { return {0, 0.0, 0.0}; }
+    return {1, static_cast<double>(d_input.element<T>(idx)), 0.0};
+  }
+};
+
+/**
+ * @brief Returns 1 for the valid rows, 0 for nulls.
+ */
+struct element_count_fn {
+  column_device_view const d_input;
+
+  __device__ size_type operator()(size_type idx) const { return d_input.is_valid(idx); }
+};
+
+struct block_index_fn {
+  size_type const block_size;
+
+  __device__ size_type operator()(size_type idx) const { return idx / block_size; }
+};
+
+/**
+ * @brief Computes the aggregation of each window from the scans of the blocks.
+ *
+ * `d_prefix[i]` aggregates the rows from the start of the block of row `i` to row `i` and
+ * `d_suffix[i]` those from row `i` to the end of its block. The blocks are as long as the
+ * windows, so that a window spanning two blocks ends in the block after the one it starts in.
+ * A window within a single block is either a whole block, or shorter than the blocks because it
+ * was clamped to the start or the end of the column: it then starts a block or ends the column.
+ */
+template <typename Value, typename CombineOp, typename FinalizeFn>
+struct window_result_fn {
+  Value const* d_prefix;
+  Value const* d_suffix;
+  Value const identity;
+  CombineOp const combine;
+  FinalizeFn const finalize;
+  size_type const size;
+  size_type const block_size;
+  size_type const preceding_window;
+  size_type const following_window;
+
+  __device__ auto operator()(size_type idx) const
+  {
+    // same bounds as the gpu_rolling kernel
+    auto const start = static_cast<size_type>(
+      min(static_cast<int64_t>(size), max(0L, static_cast<int64_t>(idx) - preceding_window + 1)));
+    auto const end = static_cast<size_type>(
+      min(static_cast<int64_t>(size), max(0L, static_cast<int64_t>(idx) + following_window + 1)));
+
+    auto const window = [&] {
+      if (start >= end) { return identity; }
+      auto const last = end - 1;
+      if (start / block_size != last / block_size) {
+        return combine(d_suffix[start], d_prefix[last]);
+      }
+      return start % block_size == 0 ? d_prefix[last] : d_suffix[start];
+    }();
+    return finalize(window, max(end - start, 0));
+  }
+};
+
+/**
+ * @brief Aggregates the windows of the values of the rows with `combine`.
+ *
+ * @tparam OutputType The type of the aggregation results
+ * @param output_type The type of the output column
+ * @param elements The values to aggregate of each row
+ * @param identity The value of an empty range
+ * @param combine The associative operator aggregating the values of two ranges
+ * @param finalize Returns the result of a window and its validity, from the value of the window
+ *        and its number of rows
+ */
+template <typename OutputType,
+          typename Value,
+          typename ElementIterator,
+          typename CombineOp,
+          typename FinalizeFn>
+std::unique_ptr<column> aggregate_windows(data_type output_type,
+                                          size_type size,
+                                          size_type preceding_window,
+                                          size_type following_window,
+                                          ElementIterator elements,
+                                          Value identity,
+                                          CombineOp combine,
+                                          FinalizeFn finalize,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  auto const window_size = static_cast<int64_t>(preceding_window) + following_window;
+  auto const block_size  = static_cast<size_type>(std::min<int64_t>(window_size, size));
+
+  rmm::device_uvector<Value> prefix(size, stream);
+  rmm::device_uvector<Value> suffix(size, stream);
+  auto const blocks =
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                    block_index_fn{block_size});
+  thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                blocks,
+                                blocks + size,
+                                elements,
+                                prefix.begin(),
+                                thrust::equal_to<size_type>{},
+                                combine);
+  thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                thrust::make_reverse_iterator(blocks + size),
+                                thrust::make_reverse_iterator(blocks),
+                                thrust::make_reverse_iterator(elements + size),
+                                thrust::make_reverse_iterator(suffix.end()),
+                                thrust::equal_to<size_type>{},
+                                combine);
+
+  auto const fn = window_result_fn<Value, CombineOp, FinalizeFn>{prefix.data(),
+                                                                 suffix.data(),
+                                                                 identity,
+                                                                 combine,
+                                                                 finalize,
+                                                                 size,
+                                                                 block_size,
+                                                                 preceding_window,
+                                                                 following_window};
+
+  auto output = make_fixed_width_column(output_type, size, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(size),
+                    output->mutable_view().begin<OutputType>(),
+                    [fn] __device__(size_type idx) { return fn(idx).first; });
+
+  auto [null_mask, null_count] = valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(size),
+    [fn] __device__(size_type idx) { return fn(idx).second; },
+    stream,
+    mr);
+  if (null_count > 0) { output->set_null_mask(std::move(null_mask), null_count); }
+  return output;
+}
+
+/**
+ * @brief Result of the SUM, MIN and MAX aggregations, or of MEAN with `is_mean`.
+ */
+template <typename OutputType, bool is_mean>
+struct finalize_value_fn {
+  size_type const min_periods;
+
+  __device__ thrust::pair<OutputType, bool> operator()(window_value<OutputType> window,
+                                                       size_type) const
+  {
+    OutputType result{};
+    rolling_store_output_functor<OutputType, is_mean>{}(result, window.value, window.count);
+    return {result, window.count >= min_periods};
+  }
+};
+
+/**
+ * @brief Result of the VARIANCE aggregation, or of STD with `is_std`.
+ */
+template <bool is_std>
+struct finalize_moments_fn {
+  size_type const min_periods;
+  size_type const ddof;
+
+  __device__ thrust::pair<double, bool> operator()(window_moments window, size_type) const
+  {
+    auto const count    = window.count;
+    auto const variance = count >= ddof ? window.m2 / (count - ddof)
+                                        : cuda::std::numeric_limits<double>::signaling_NaN();
+    return {is_std ? sqrt(variance) : variance, count > 0 && count >= min_periods};
+  }
+};
+
+/**
+ * @brief Result of the COUNT_VALID aggregation.
+ */
+struct finalize_count_fn {
+  size_type const min_periods;
+
+  __device__ thrust::pair<size_type, bool> operator()(size_type count, size_type rows) const
+  {
+    return {count, rows >= min_periods};
+  }
+};
+
+template <typename T>
+constexpr bool is_fixed_window_type()
+{
+  return cudf::is_numeric<T>() && !cudf::is_boolean<T>();
+}
+
+struct fixed_window_dispatch {
+  template <typename T, aggregation::Kind k, typename Op, bool is_mean>
+  std::unique_ptr<column> aggregate_values(column_view const& input,
+                                           size_type preceding_window,
+                                           size_type following_window,
+                                           size_type min_periods,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+  {
+    using OutputType   = target_type_t<T, k>;
+    auto const d_input = column_device_view::create(input, stream);
+    auto const elements =
+      thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                      element_value_fn<T, OutputType, Op>{*d_input});
+    return aggregate_windows<OutputType>(
+      data_type{type_to_id<OutputType>()},
+      input.size(),
+      preceding_window,
+      following_window,
+      elements,
+      window_value<OutputType>{Op::template identity<OutputType>(), 0},
+      combine_values_fn<OutputType, Op>{},
+      finalize_value_fn<OutputType, is_mean>{min_periods},
+      stream,
+      mr);
+  }
+
+  template <typename T, bool is_std>
+  std::unique_ptr<column> aggregate_moments(column_view const& input,
+                                            size_type preceding_window,
+                                            size_type following_window,
+                                            size_type min_periods,
+                                            size_type ddof,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+  {
+    auto const d_input  = column_device_view::create(input, stream);
+    auto const elements = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0), element_moments_fn<T>{*d_input});
+    return aggregate_windows<double>(data_type{type_id::FLOAT64},
+                                     input.size(),
+                                     preceding_window,
+                                     following_window,
+                                     elements,
+                                     window_moments{0, 0.0, 0.0},
+                                     combine_moments_fn{},
+                                     finalize_moments_fn<is_std>{min_periods, ddof},
+                                     stream,
+                                     mr);
+  }
+
+  template <typename T, std::enable_if_t<is_fixed_window_type<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     size_type preceding_window,
+                                     size_type following_window,
+                                     size_type min_periods,
+                                     rolling_aggregation const& agg,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    switch (agg.kind) {
+      case aggregation::SUM:
+        return aggregate_values<T, aggregation::SUM, DeviceSum, false>(
+          input, preceding_window, following_window, min_periods, stream, mr);
+      case aggregation::MEAN:
+        return aggregate_values<T, aggregation::MEAN, DeviceSum, true>(
+          input, preceding_window, following_window, min_periods, stream, mr);
+      case aggregation::MIN:
+        return aggregate_values<T, aggregation::MIN, DeviceMin, false>(
+          input, preceding_window, following_window, min_periods, stream, mr);
+      case aggregation::MAX:
+        return aggregate_values<T, aggregation::MAX, DeviceMax, false>(
+          input, preceding_window, following_window, min_periods, stream, mr);
+      case aggregation::VARIANCE:
+      case aggregation::STD: {
+        auto const ddof = dynamic_cast<std_var_aggregation const&>(agg)._ddof;
+        return agg.kind == aggregation::STD
+                 ? aggregate_moments<T, true>(
+                     input, preceding_window, following_window, min_periods, ddof, stream, mr)
+                 : aggregate_moments<T, false>(
+                     input, preceding_window, following_window, min_periods, ddof, stream, mr);
+      }
+      default: CUDF_FAIL("Unsupported aggregation for fixed window rolling");
+    }
+  }
+
+  template <typename T, std::enable_if_t<!is_fixed_window_type<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     size_type,
+                                     size_type,
+                                     size_type,
+                                     rolling_aggregation const&,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Unsupported type for fixed window rolling");
+  }
+};
+
+}  // namespace
+
+bool is_fixed_window_rolling(column_view const& input,
+                             column_view const& default_outputs,
+                             size_type preceding_window,
+                             size_type following_window,
+                             rolling_aggregation const& agg)
+{
+  auto const window_size = static_cast<int64_t>(preceding_window) + following_window;
+  if (window_size < fixed_window_rolling_threshold || !default_outputs.is_empty() ||
+      is_dictionary(input.type())) {
+    return false;
+  }
+  // without nulls, the count of the rows of a window is already computed in constant time
+  if (agg.kind == aggregation::COUNT_VALID) { return input.has_nulls(); }
+  return is_numeric(input.type()) && !is_boolean(input.type()) &&
+         (agg.kind == aggregation::SUM || agg.kind == aggregation::MEAN ||
+          agg.kind == aggregation::MIN || agg.kind == aggregation::MAX ||
+          agg.kind == aggregation::VARIANCE || agg.kind == aggregation::STD);
+}
+
+std::unique_ptr<column> fixed_window_rolling(column_view const& input,
+                                             size_type preceding_window,
+                                             size_type following_window,
+                                             size_type min_periods,
+                                             rolling_aggregation const& agg,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_fixed_window_rolling(
+                 input, column_view{}, preceding_window, following_window, agg),
+               "Unsupported fixed window rolling aggregation");
+
+  if (agg.kind != aggregation::COUNT_VALID) {
+    return type_dispatcher(input.type(),
+                           fixed_window_dispatch{},
+                           input,
+                           preceding_window,
+                           following_window,
+                           min_periods,
+                           agg,
+                           stream,
+                           mr);
+  }
+
+  auto const d_input  = column_device_view::create(input, stream);
+  auto const elements = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0), element_count_fn{*d_input});
+  return aggregate_windows<size_type>(data_type{type_to_id<size_type>()},
+                                      input.size(),
+                                      preceding_window,
+                                      following_window,
+                                      elements,
+                                      size_type{0},
+                                      thrust::plus<size_type>{},
+                                      finalize_count_fn{min_periods},
+                                      stream,
+                                      mr);
+}
+
+}  // namespace detail
+}  // namespace cudf
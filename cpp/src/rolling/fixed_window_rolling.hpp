@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Smallest window, `preceding_window + following_window`, aggregated by
+ * `fixed_window_rolling` instead of one loop over the rows of each window.
+ */
+constexpr size_type fixed_window_rolling_threshold = 128;
+
+/**
+ * @brief Returns whether `fixed_window_rolling` supports the rolling aggregation of the column
+ * in windows of these sizes.
+ *
+ * The aggregations supported are SUM, MEAN, MIN, MAX, VARIANCE and STD of the numeric columns,
+ * and COUNT_VALID of the columns with nulls, in windows of at least
+ * `fixed_window_rolling_threshold` rows.
+ */
+bool is_fixed_window_rolling(column_view const& input,
+                             column_view const& default_outputs,
+                             size_type preceding_window,
+                             size_type following_window,
+                             rolling_aggregation const& agg);
+
+/**
+ * @brief Applies a fixed-size rolling window aggregation in constant time per row.
+ *
+ * The rows are split in blocks of the window size and each block is scanned from its start and
+ * from its end. A window then overlaps at most two blocks: it is the combination of the scan of
+ * its first block from the window start and the scan of its last block up to the window end.
+ *
+ * The results are those of `rolling_window` with the same arguments, but for the rounding of
+ * the floating-point sums, which add the values of each window in a different order.
+ *
+ * @throw cudf::logic_error if `is_fixed_window_rolling` is false for the arguments
+ *
+ * @param input The input column
+ * @param preceding_window The static rolling window size in the backward direction
+ * @param following_window The static rolling window size in the forward direction
+ * @param min_periods Minimum number of observations in window required to have a value
+ * @param agg The rolling window aggregation type
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The column of the aggregation of each window
+ */
+std::unique_ptr<column> fixed_window_rolling(column_view const& input,
+                                             size_type preceding_window,
+                                             size_type following_window,
+                                             size_type min_periods,
+                                             rolling_aggregation const& agg,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr);
+
+}  // namespace detail
+}  // namespace cudf
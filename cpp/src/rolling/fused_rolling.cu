@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rolling/fixed_window_rolling.hpp"
+#include "rolling/prefix_sum_rolling.hpp"
+#include "rolling/rolling_detail.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/rolling.hpp>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/rolling.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns whether the aggregation is computed by `fused_rolling_window`.
+ */
+bool is_fused_aggregation(column_view const& input, rolling_aggregation const& agg)
+{
+  return is_numeric(input.type()) && !is_boolean(input.type()) &&
+         (agg.kind == aggregation::SUM || agg.kind == aggregation::MEAN ||
+          agg.kind == aggregation::MIN || agg.kind == aggregation::MAX ||
+          agg.kind == aggregation::COUNT_VALID || agg.kind == aggregation::COUNT_ALL);
+}
+
+/**
+ * @brief Returns whether a window with `count` rows has at least `min_periods` of them.
+ */
+struct min_periods_fn {
+  size_type const min_periods;
+
+  __device__ bool operator()(size_type count) const { return count >= min_periods; }
+};
+
+/**
+ * @brief The outputs written by `fused_window_fn`, null for the aggregations not requested.
+ */
+template <typename T>
+struct fused_outputs {
+  using SumType = target_type_t<T, aggregation::SUM>;
+
+  SumType* d_sum{};
+  double* d_mean{};
+  T* d_min{};
+  T* d_max{};
+  size_type* d_count_valid{};
+  size_type* d_count_all{};
+  size_type* d_valid_counts{};  ///< Number of valid rows of each window
+  size_type* d_row_counts{};    ///< Number of rows of each window
+};
+
+/**
+ * @brief Aggregates each window in a single loop over its rows, for all the aggregations.
+ */
+template <typename T, typename PrecedingWindowIterator, typename FollowingWindowIterator>
+struct fused_window_fn {
+  using SumType = typename fused_outputs<T>::SumType;
+
+  column_device_view const d_input;
+  PrecedingWindowIterator const preceding_window_begin;
+  FollowingWindowIterator const following_window_begin;
+  fused_outputs<T> const outputs;
+
+  __device__ void operator()(size_type idx) const
+  {
+    // same bounds as the gpu_rolling kernel
+    int64_t const preceding_window = preceding_window_begin[idx];
+    int64_t const following_window = following_window_begin[idx];
+    auto const size                = static_cast<int64_t>(d_input.size());
+    auto const start = static_cast<size_type>(min(size, max(0L, idx - preceding_window + 1)));
+    auto const end   = static_cast<size_type>(min(size, max(0L, idx + following_window + 1)));
+    auto const start_index = min(start, end);
+    auto const end_index   = max(start, end);
+
+    SumType sum     = DeviceSum::identity<SumType>();
+    double mean_sum = 0;
+    T min_value     = DeviceMin::identity<T>();
+    T max_value     = DeviceMax::identity<T>();
+    size_type count = 0;
+    for (size_type j = start_index; j < end_index; ++j) {
+      if (d_input.is_null(j)) { continue; }
+      auto const element = d_input.element<T>(j);
+      sum                = DeviceSum{}(static_cast<SumType>(element), sum);
+      mean_sum           = DeviceSum{}(static_cast<double>(element), mean_sum);
+      min_value          = DeviceMin{}(element, min_value);
+      max_value          = DeviceMax{}(element, max_value);
+      ++count;
+    }
+
+    if (outputs.d_sum) { outputs.d_sum[idx] = sum; }
+    if (outputs.d_mean) {
+      rolling_store_output_functor<double, true>{}(outputs.d_mean[idx], mean_sum, count);
+    }
+    if (outputs.d_min) { outputs.d_min[idx] = min_value; }
+    if (outputs.d_max) { outputs.d_max[idx] = max_value; }
+    if (outputs.d_count_valid) { outputs.d_count_valid[idx] = count; }
+    if (outputs.d_count_all) { outputs.d_count_all[idx] = end_index - start_index; }
+    outputs.d_valid_counts[idx] = count;
+    outputs.d_row_counts[idx]   = end_index - start_index;
+  }
+};
+
+struct fused_rolling_dispatch {
+  template <typename T,
+            typename PrecedingWindowIterator,
+            typename FollowingWindowIterator,
+            std::enable_if_t<is_numeric<T>() && !is_boolean<T>()>* = nullptr>
+  std::vector<std::unique_ptr<column>> operator()(column_view const& input,
+                                                  PrecedingWindowIterator preceding_window_begin,
+                                                  FollowingWindowIterator following_window_begin,
+                                                  size_type min_periods,
+                                                  std::vector<aggregation::Kind> const& kinds,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+  {
+    auto const size = input.size();
+
+    // one output column for each kind of aggregation, shared by the repeated aggregations
+    std::vector<aggregation::Kind> unique_kinds(kinds);
+    std::sort(unique_kinds.begin(), unique_kinds.end());
+    unique_kinds.erase(std::unique(unique_kinds.begin(), unique_kinds.end()), unique_kinds.end());
+    std::vector<std::unique_ptr<column>> unique_results;
+    for (auto const kind : unique_kinds) {
+      unique_results.push_back(make_fixed_width_column(
+        target_type(input.type(), kind), size, mask_state::UNALLOCATED, stream, mr));
+    }
+
+    rmm::device_uvector<size_type> valid_counts(size, stream);
+    rmm::device_uvector<size_type> row_counts(size, stream);
+    fused_outputs<T> outputs;
+    for (std::size_t i = 0; i < unique_kinds.size(); ++i) {
+      auto view = unique_results[i]->mutable_view();
+      switch (unique_kinds[i]) {
+        case aggregation::SUM:
+          outputs.d_sum = view.data<typename fused_outputs<T>::SumType>();
+          break;
+        case aggregation::MEAN: outputs.d_mean = view.data<double>(); break;
+        case aggregation::MIN: outputs.d_min = view.data<T>(); break;
+        case aggregation::MAX: outputs.d_max = view.data<T>(); break;
+        case aggregation::COUNT_VALID: outputs.d_count_valid = view.data<size_type>(); break;
+        case aggregation::COUNT_ALL: outputs.d_count_all = view.data<size_type>(); break;
+        default: CUDF_FAIL("Unsupported fused rolling aggregation");
+      }
+    }
+    outputs.d_valid_counts = valid_counts.data();
+    outputs.d_row_counts   = row_counts.data();
+
+    auto const d_input = column_device_view::create(input, stream);
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      size,
+      fused_window_fn<T, PrecedingWindowIterator, FollowingWindowIterator>{
+        *d_input, preceding_window_begin, following_window_begin, outputs});
+
+    // The values are valid with enough valid rows in their window, the counts with enough rows.
+    auto const [values_mask, values_null_count] =
+      valid_if(valid_counts.begin(), valid_counts.end(), min_periods_fn{min_periods}, stream, mr);
+    auto const [counts_mask, counts_null_count] =
+      valid_if(row_counts.begin(), row_counts.end(), min_periods_fn{min_periods}, stream, mr);
+    for (std::size_t i = 0; i < unique_kinds.size(); ++i) {
+      auto const is_count = unique_kinds[i] == aggregation::COUNT_VALID ||
+                            unique_kinds[i] == aggregation::COUNT_ALL;
+      auto const null_count = is_count ? counts_null_count : values_null_count;
+      if (null_count > 0) {
+        auto const& mask = is_count ? counts_mask : values_mask;
+        unique_results[i]->set_null_mask(
+          rmm::device_buffer{mask.data(), mask.size(), stream, mr}, null_count);
+      }
+    }
+
+    // the first aggregation of each kind takes its column, the others copy it
+    std::vector<std::unique_ptr<column>> results(kinds.size());
+    std::vector<std::size_t> first_results(unique_kinds.size());
+    for (std::size_t i = 0; i < kinds.size(); ++i) {
+      auto const index = std::distance(
+        unique_kinds.begin(), std::lower_bound(unique_kinds.begin(), unique_kinds.end(), kinds[i]));
+      if (unique_results[index]) {
+        results[i]           = std::move(unique_results[index]);
+        first_results[index] = i;
+      } else {
+        results[i] = std::make_unique<column>(results[first_results[index]]->view(), stream, mr);
+      }
+    }
+    return results;
+  }
+
+  template <typename T,
+            typename PrecedingWindowIterator,
+            typename FollowingWindowIterator,
+            std::enable_if_t<!(is_numeric<T>() && !is_boolean<T>())>* = nullptr>
+  std::vector<std::unique_ptr<column>> operator()(column_view const&,
+                                                  PrecedingWindowIterator,
+                                                  FollowingWindowIterator,
+                                                  size_type,
+                                                  std::vector<aggregation::Kind> const&,
+                                                  rmm::cuda_stream_view,
+                                                  rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Unsupported type for fused rolling aggregations");
+  }
+};
+
+/**
+ * @brief Applies the rolling window aggregations, computing together those that are not better
+ * computed one at a time by `single_rolling_window`, such as the aggregations computed in
+ * constant time per row.
+ *
+ * @param single_rolling_window Returns the result of a single aggregation
+ * @param is_computed_alone Returns whether an aggregation is better computed by itself
+ */
+template <typename PrecedingWindowIterator,
+          typename FollowingWindowIterator,
+          typename SingleRollingWindow,
+          typename AlonePredicate>
+std::unique_ptr<table> fused_rolling_window(
+  column_view const& input,
+  PrecedingWindowIterator preceding_window_begin,
+  FollowingWindowIterator following_window_begin,
+  size_type min_periods,
+  std::vector<std::unique_ptr<rolling_aggregation>> const& aggs,
+  SingleRollingWindow single_rolling_window,
+  AlonePredicate is_computed_alone,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  std::vector<size_type> fused_indices;
+  std::vector<aggregation::Kind> fused_kinds;
+  if (!input.is_empty()) {
+    for (std::size_t i = 0; i < aggs.size(); ++i) {
+      if (is_fused_aggregation(input, *aggs[i]) && !is_computed_alone(*aggs[i])) {
+        fused_indices.push_back(i);
+        fused_kinds.push_back(aggs[i]->kind);
+      }
+    }
+  }
+  // a single aggregation is not worth a pass of its own
+  if (fused_indices.size() < 2) {
+    fused_indices.clear();
+    fused_kinds.clear();
+  }
+
+  std::vector<std::unique_ptr<column>> results(aggs.size());
+  if (!fused_indices.empty()) {
+    auto fused_results = type_dispatcher(input.type(),
+                                         fused_rolling_dispatch{},
+                                         input,
+                                         preceding_window_begin,
+                                         following_window_begin,
+                                         std::max(min_periods, 0),
+                                         fused_kinds,
+                                         stream,
+                                         mr);
+    for (std::size_t i = 0; i < fused_indices.size(); ++i) {
+      results[fused_indices[i]] = std::move(fused_results[i]);
+    }
+  }
+  for (std::size_t i = 0; i < aggs.size(); ++i) {
+    if (!results[i]) { results[i] = single_rolling_window(*aggs[i]); }
+  }
+  return std::make_unique<table>(std::move(results));
+}
+
+}  // namespace
+
+// Applies fixed-size rolling window functions to the values in a column.
+std::unique_ptr<table> rolling_window(column_view const& input,
+                                      size_type preceding_window,
+                                      size_type following_window,
+                                      size_type min_periods,
+                                      std::vector<std::unique_ptr<rolling_aggregation>> const& aggs,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  CUDF_EXPECTS((min_periods >= 0), "min_periods must be non-negative");
+
+  auto const defaults =
+    is_dictionary(input.type()) ? dictionary_column_view(input).indices() : input;
+  auto const empty_defaults = empty_like(defaults);
+  return fused_rolling_window(
+    input,
+    thrust::make_constant_iterator(preceding_window),
+    thrust::make_constant_iterator(following_window),
+    min_periods,
+    aggs,
+    [&](rolling_aggregation const& agg) {
+      return rolling_window(input,
+                            empty_defaults->view(),
+                            preceding_window,
+                            following_window,
+                            min_periods,
+                            agg,
+                            stream,
+                            mr);
+    },
+    [&](rolling_aggregation const& agg) {
+      return is_fixed_window_rolling(
+        input, column_view{}, preceding_window, following_window, agg);
+    },
+    stream,
+    mr);
+}
+
+// Applies variable-size rolling window functions to the values in a column.
+std::unique_ptr<table> rolling_window(column_view const& input,
+                                      column_view const& preceding_window,
+                                      column_view const& following_window,
+                                      size_type min_periods,
+                                      std::vector<std::unique_ptr<rolling_aggregation>> const& aggs,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  if (!preceding_window.is_empty() && !following_window.is_empty() && !input.is_empty()) {
+    CUDF_EXPECTS(preceding_window.type().id() == type_id::INT32 &&
+                   following_window.type().id() == type_id::INT32,
+                 "preceding_window/following_window must have type_id::INT32 type");
+
+    CUDF_EXPECTS(
+      preceding_window.size() == input.size() && following_window.size() == input.size(),
+      "preceding_window/following_window size must match input size");
+  }
+
+  return fused_rolling_window(
+    input,
+    preceding_window.begin<size_type>(),
+    following_window.begin<size_type>(),
+    min_periods,
+    aggs,
+    [&](rolling_aggregation const& agg) {
+      return rolling_window(
+        input, preceding_window, following_window, min_periods, agg, stream, mr);
+    },
+    [&](rolling_aggregation const& agg) {
+      return preceding_window.is_empty() || following_window.is_empty() ||
+             is_prefix_sum_rolling(input, column_view{}, agg);
+    },
+    stream,
+    mr);
+}
+
+}  // namespace detail
+
+// Applies fixed-size rolling window functions to the values in a column.
+std::unique_ptr<table> rolling_window(column_view const& input,
+                                      size_type preceding_window,
+                                      size_type following_window,
+                                      size_type min_periods,
+                                      std::vector<std::unique_ptr<rolling_aggregation>> const& aggs,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  return detail::rolling_window(input,
+                                preceding_window,
+                                following_window,
+                                min_periods,
+                                aggs,
+                                rmm::cuda_stream_default,
+                                mr);
+}
+
+// Applies variable-size rolling window functions to the values in a column.
+std::unique_ptr<table> rolling_window(column_view const& input,
+                                      column_view const& preceding_window,
+                                      column_view const& following_window,
+                                      size_type min_periods,
+                                      std::vector<std::unique_ptr<rolling_aggregation>> const& aggs,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  return detail::rolling_window(
+    input, preceding_window, following_window, min_periods, aggs, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -25,6 +25,15 @@
 #include <cudf/types.hpp>
 #include <cudf/unary.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/merge.h>
+#include <thrust/tuple.h>
+#include <thrust/uninitialized_fill.h>
+
 namespace cudf {
 std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
                                                column_view const& input,
@@ -258,28 +267,6 @@ __device__ T subtract_safe(T const& value, T const& delta)
                                                             : std::numeric_limits<T>::min();
 }
 
-/// Given a single, ungrouped order-by column, return the indices corresponding
-/// to the first null element, and (one past) the last null timestamp.
-/// The input column is sorted, with all null values clustered either
-/// at the beginning of the column or at the end.
-/// If no null values are founds, null_begin and null_end are 0.
-std::tuple<size_type, size_type> get_null_bounds_for_orderby_column(
-  column_view const& orderby_column)
-{
-  auto const num_rows  = orderby_column.size();
-  auto const num_nulls = orderby_column.null_count();
-
-  if (num_nulls == num_rows || num_nulls == 0) {
-    // Short-circuit: All nulls, or no nulls.
-    return std::make_tuple(0, num_nulls);
-  }
-
-  auto const first_row_is_null = orderby_column.null_count(0, 1) == 1;
-
-  return first_row_is_null ? std::make_tuple(0, num_nulls)
-                           : std::make_tuple(num_rows - num_nulls, num_rows);
-}
-
 template <typename Calculator>
 std::unique_ptr<column> expand_to_column(Calculator const& calc,
                                          size_type const& num_rows,
@@ -297,93 +284,6 @@ std::unique_ptr<column> expand_to_column(Calculator const& calc,
   return window_column;
 }
 
-/// Range window computation, with
-///   1. no grouping keys specified
-///   2. rows in ASCENDING order.
-/// Treat as one single group.
-template <typename T>
-std::unique_ptr<column> range_window_ASC(column_view const& input,
-                                         column_view const& orderby_column,
-                                         T preceding_window,
-                                         bool preceding_window_is_unbounded,
-                                         T following_window,
-                                         bool following_window_is_unbounded,
-                                         size_type min_periods,
-                                         rolling_aggregation const& aggr,
-                                         rmm::cuda_stream_view stream,
-                                         rmm::mr::device_memory_resource* mr)
-{
-  auto [h_nulls_begin_idx, h_nulls_end_idx] = get_null_bounds_for_orderby_column(orderby_column);
-
-  auto preceding_calculator =
-    [nulls_begin_idx = h_nulls_begin_idx,
-     nulls_end_idx   = h_nulls_end_idx,
-     d_orderby       = orderby_column.data<T>(),
-     preceding_window,
-     preceding_window_is_unbounded] __device__(size_type idx) -> size_type {
-    if (preceding_window_is_unbounded) {
-      return idx + 1;  // Technically `idx - 0 + 1`,
-                       // where 0 == Group start,
-                       // and   1 accounts for the current row
-    }
-    if (idx >= nulls_begin_idx && idx < nulls_end_idx) {
-      // Current row is in the null group.
-      // Must consider beginning of null-group as window start.
-      return idx - nulls_begin_idx + 1;
-    }
-
-    // orderby[idx] not null. Binary search the group, excluding null group.
-    // If nulls_begin_idx == 0, either
-    //  1. NULLS FIRST ordering: Binary search starts where nulls_end_idx.
-    //  2. NO NULLS: Binary search starts at 0 (also nulls_end_idx).
-    // Otherwise, NULLS LAST ordering. Start at 0.
-    auto group_start      = nulls_begin_idx == 0 ? nulls_end_idx : 0;
-    auto lowest_in_window = subtract_safe(d_orderby[idx], preceding_window);
-
-    return ((d_orderby + idx) - thrust::lower_bound(thrust::seq,
-                                                    d_orderby + group_start,
-                                                    d_orderby + idx,
-                                                    lowest_in_window)) +
-           1;  // Add 1, for `preceding` to account for current row.
-  };
-
-  auto preceding_column = expand_to_column(preceding_calculator, input.size(), stream, mr);
-
-  auto following_calculator =
-    [nulls_begin_idx = h_nulls_begin_idx,
-     nulls_end_idx   = h_nulls_end_idx,
-     num_rows        = input.size(),
-     d_orderby       = orderby_column.data<T>(),
-     following_window,
-     following_window_is_unbounded] __device__(size_type idx) -> size_type {
-    if (following_window_is_unbounded) { return num_rows - idx - 1; }
-    if (idx >= nulls_begin_idx && idx < nulls_end_idx) {
-      // Current row is in the null group.
-      // Window ends at the end of the null group.
-      return nulls_end_idx - idx - 1;
-    }
-
-    // orderby[idx] not null. Binary search the group, excluding null group.
-    // If nulls_begin_idx == 0, either
-    //  1. NULLS FIRST ordering: Binary search ends at num_rows.
-    //  2. NO NULLS: Binary search also ends at num_rows.
-    // Otherwise, NULLS LAST ordering. End at nulls_begin_idx.
-
-    auto group_end         = nulls_begin_idx == 0 ? num_rows : nulls_begin_idx;
-    auto highest_in_window = add_safe(d_orderby[idx], following_window);
-
-    return (thrust::upper_bound(
-              thrust::seq, d_orderby + idx, d_orderby + group_end, highest_in_window) -
-            (d_orderby + idx)) -
-           1;
-  };
-
-  auto following_column = expand_to_column(following_calculator, input.size(), stream, mr);
-
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
-}
-
 // Given an orderby column grouped as specified in group_offsets,
 // return the following two vectors:
 //  1. Vector with one entry per group, indicating the offset in the group
@@ -462,233 +362,202 @@ get_null_bounds_for_orderby_column(column_view const& orderby_column,
   }
 }
 
-// Range window computation, for orderby column in ASCENDING order.
+/**
+ * @brief Returns the group label and the order-by value of a row.
+ */
 template <typename T>
-std::unique_ptr<column> range_window_ASC(column_view const& input,
-                                         column_view const& orderby_column,
-                                         rmm::device_uvector<cudf::size_type> const& group_offsets,
-                                         rmm::device_uvector<cudf::size_type> const& group_labels,
-                                         T preceding_window,
-                                         bool preceding_window_is_unbounded,
-                                         T following_window,
-                                         bool following_window_is_unbounded,
-                                         size_type min_periods,
-                                         rolling_aggregation const& aggr,
-                                         rmm::cuda_stream_view stream,
-                                         rmm::mr::device_memory_resource* mr)
-{
-  auto [null_start, null_end] =
-    get_null_bounds_for_orderby_column(orderby_column, group_offsets, stream);
-
-  auto preceding_calculator =
-    [d_group_offsets = group_offsets.data(),
-     d_group_labels  = group_labels.data(),
-     d_orderby       = orderby_column.data<T>(),
-     d_nulls_begin   = null_start.data(),
-     d_nulls_end     = null_end.data(),
-     preceding_window,
-     preceding_window_is_unbounded] __device__(size_type idx) -> size_type {
-    auto group_label = d_group_labels[idx];
-    auto group_start = d_group_offsets[group_label];
-    auto nulls_begin = d_nulls_begin[group_label];
-    auto nulls_end   = d_nulls_end[group_label];
-
-    if (preceding_window_is_unbounded) { return idx - group_start + 1; }
-
-    // If idx lies in the null-range, the window is the null range.
-    if (idx >= nulls_begin && idx < nulls_end) {
-      // Current row is in the null group.
-      // The window starts at the start of the null group.
-      return idx - nulls_begin + 1;
-    }
-
-    // orderby[idx] not null. Search must exclude the null group.
-    // If nulls_begin == group_start, either of the following is true:
-    //  1. NULLS FIRST ordering: Search must begin at nulls_end.
-    //  2. NO NULLS: Search must begin at group_start (which also equals nulls_end.)
-    // Otherwise, NULLS LAST ordering. Search must start at nulls group_start.
-    auto search_start = nulls_begin == group_start ? nulls_end : group_start;
-
-    auto lowest_in_window = subtract_safe(d_orderby[idx], preceding_window);
-
-    return ((d_orderby + idx) - thrust::lower_bound(thrust::seq,
-                                                    d_orderby + search_start,
-                                                    d_orderby + idx,
-                                                    lowest_in_window)) +
-           1;  // Add 1, for `preceding` to account for current row.
-  };
-
-  auto preceding_column = expand_to_column(preceding_calculator, input.size(), stream, mr);
-
-  auto following_calculator =
-    [d_group_offsets = group_offsets.data(),
-     d_group_labels  = group_labels.data(),
-     d_orderby       = orderby_column.data<T>(),
-     d_nulls_begin   = null_start.data(),
-     d_nulls_end     = null_end.data(),
-     following_window,
-     following_window_is_unbounded] __device__(size_type idx) -> size_type {
-    auto group_label = d_group_labels[idx];
-    auto group_start = d_group_offsets[group_label];
-    auto group_end   = d_group_offsets[group_label + 1];  // Cannot fall off the end, since offsets
-                                                          // is capped with `input.size()`.
-    auto nulls_begin = d_nulls_begin[group_label];
-    auto nulls_end   = d_nulls_end[group_label];
-
-    if (following_window_is_unbounded) { return (group_end - idx) - 1; }
-
-    // If idx lies in the null-range, the window is the null range.
-    if (idx >= nulls_begin && idx < nulls_end) {
-      // Current row is in the null group.
-      // The window ends at the end of the null group.
-      return nulls_end - idx - 1;
-    }
-
-    // orderby[idx] not null. Search must exclude the null group.
-    // If nulls_begin == group_start, either of the following is true:
-    //  1. NULLS FIRST ordering: Search ends at group_end.
-    //  2. NO NULLS: Search ends at group_end.
-    // Otherwise, NULLS LAST ordering. Search ends at nulls_begin.
-    auto search_end = nulls_begin == group_start ? group_end : nulls_begin;
-
-    auto highest_in_window = add_safe(d_orderby[idx], following_window);
+struct row_key_fn {
+  size_type const* d_group_labels;
+  T const* d_orderby;
 
-    return (thrust::upper_bound(
-              thrust::seq, d_orderby + idx, d_orderby + search_end, highest_in_window) -
-            (d_orderby + idx)) -
-           1;
-  };
-
-  auto following_column = expand_to_column(following_calculator, input.size(), stream, mr);
-
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
-}
+  __device__ thrust::tuple<size_type, T> operator()(size_type row) const
+  {
+    return thrust::make_tuple(d_group_labels[row], d_orderby[row]);
+  }
+};
 
-/// Range window computation, with
-///   1. no grouping keys specified
-///   2. rows in DESCENDING order.
-/// Treat as one single group.
+/**
+ * @brief Returns the group label and the order-by value of a row, moved by `delta`.
+ */
 template <typename T>
-std::unique_ptr<column> range_window_DESC(column_view const& input,
-                                          column_view const& orderby_column,
-                                          T preceding_window,
-                                          bool preceding_window_is_unbounded,
-                                          T following_window,
-                                          bool following_window_is_unbounded,
-                                          size_type min_periods,
-                                          rolling_aggregation const& aggr,
-                                          rmm::cuda_stream_view stream,
-                                          rmm::mr::device_memory_resource* mr)
-{
-  auto [h_nulls_begin_idx, h_nulls_end_idx] = get_null_bounds_for_orderby_column(orderby_column);
+struct shifted_row_key_fn {
+  size_type const* d_group_labels;
+  T const* d_orderby;
+  T const delta;
+  bool const add;
 
-  auto preceding_calculator =
-    [nulls_begin_idx = h_nulls_begin_idx,
-     nulls_end_idx   = h_nulls_end_idx,
-     d_orderby       = orderby_column.data<T>(),
-     preceding_window,
-     preceding_window_is_unbounded] __device__(size_type idx) -> size_type {
-    if (preceding_window_is_unbounded) {
-      return idx + 1;  // Technically `idx - 0 + 1`,
-                       // where 0 == Group start,
-                       // and   1 accounts for the current row
-    }
-    if (idx >= nulls_begin_idx && idx < nulls_end_idx) {
-      // Current row is in the null group.
-      // Must consider beginning of null-group as window start.
-      return idx - nulls_begin_idx + 1;
-    }
-
-    // orderby[idx] not null. Binary search the group, excluding null group.
-    // If nulls_begin_idx == 0, either
-    //  1. NULLS FIRST ordering: Binary search starts where nulls_end_idx.
-    //  2. NO NULLS: Binary search starts at 0 (also nulls_end_idx).
-    // Otherwise, NULLS LAST ordering. Start at 0.
-    auto group_start       = nulls_begin_idx == 0 ? nulls_end_idx : 0;
-    auto highest_in_window = add_safe(d_orderby[idx], preceding_window);
-
-    return ((d_orderby + idx) -
-            thrust::lower_bound(thrust::seq,
-                                d_orderby + group_start,
-                                d_orderby + idx,
-                                highest_in_window,
-                                thrust::greater<decltype(highest_in_window)>())) +
-           1;  // Add 1, for `preceding` to account for current row.
-  };
-
-  auto preceding_column = expand_to_column(preceding_calculator, input.size(), stream, mr);
-
-  auto following_calculator =
-    [nulls_begin_idx = h_nulls_begin_idx,
-     nulls_end_idx   = h_nulls_end_idx,
-     num_rows        = input.size(),
-     d_orderby       = orderby_column.data<T>(),
-     following_window,
-     following_window_is_unbounded] __device__(size_type idx) -> size_type {
-    if (following_window_is_unbounded) { return (num_rows - idx) - 1; }
-    if (idx >= nulls_begin_idx && idx < nulls_end_idx) {
-      // Current row is in the null group.
-      // Window ends at the end of the null group.
-      return nulls_end_idx - idx - 1;
-    }
+  __device__ thrust::tuple<size_type, T> operator()(size_type row) const
+  {
+    auto const value = d_orderby[row];
+    return thrust::make_tuple(d_group_labels[row],
+                              add ? add_safe(value, delta) : subtract_safe(value, delta));
+  }
+};
 
-    // orderby[idx] not null. Search must exclude null group.
-    // If nulls_begin_idx = 0, either
-    //  1. NULLS FIRST ordering: Search ends at num_rows.
-    //  2. NO NULLS: Search also ends at num_rows.
-    // Otherwise, NULLS LAST ordering: End at nulls_begin_idx.
-
-    auto group_end        = nulls_begin_idx == 0 ? num_rows : nulls_begin_idx;
-    auto lowest_in_window = subtract_safe(d_orderby[idx], following_window);
-
-    return (thrust::upper_bound(thrust::seq,
-                                d_orderby + idx,
-                                d_orderby + group_end,
-                                lowest_in_window,
-                                thrust::greater<decltype(lowest_in_window)>()) -
-            (d_orderby + idx)) -
-           1;
-  };
+/**
+ * @brief Orders the keys of the rows by group, then by order-by value with `Comparator`.
+ */
+template <typename Comparator>
+struct row_key_comparator {
+  template <typename T>
+  __device__ bool operator()(thrust::tuple<size_type, T> const& lhs,
+                             thrust::tuple<size_type, T> const& rhs) const
+  {
+    auto const lhs_group = thrust::get<0>(lhs);
+    auto const rhs_group = thrust::get<0>(rhs);
+    return lhs_group < rhs_group ||
+           (lhs_group == rhs_group && Comparator{}(thrust::get<1>(lhs), thrust::get<1>(rhs)));
+  }
+};
 
-  auto following_column = expand_to_column(following_calculator, input.size(), stream, mr);
+/**
+ * @brief Searches the keys of `rows` for the key of each of these rows, moved by `delta`.
+ *
+ * The result, indexed by row, is the number of keys of `rows` ordered before the moved key: the
+ * lower bound of the moved key, or its upper bound with `inclusive`. The rows of `rows` are in
+ * the order of their keys, and so are the moved keys, since moving by `delta` saturates at the
+ * limits of `T` instead of wrapping around. All the bounds are then found in linear time, by
+ * merging the moved keys with the keys: the position of each moved key in the merged sequence
+ * is its own index plus its bound.
+ *
+ * @param rows The rows with non-null order-by values, in increasing order
+ * @param num_rows The number of rows of the order-by column
+ * @param d_group_labels The group label of each row
+ * @param d_orderby The order-by values
+ * @param delta The distance to move the order-by values by
+ * @param add Whether `delta` is added to the values, subtracted otherwise
+ * @param inclusive Whether the bounds count the keys equal to the moved key
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The bound of each row of `rows`, undefined for the other rows
+ */
+template <typename T, typename Comparator>
+rmm::device_uvector<size_type> merge_window_bounds(device_span<size_type const> rows,
+                                                   size_type num_rows,
+                                                   size_type const* d_group_labels,
+                                                   T const* d_orderby,
+                                                   T delta,
+                                                   bool add,
+                                                   bool inclusive,
+                                                   rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<size_type> bounds(num_rows, stream);
+  auto const count = static_cast<int64_t>(rows.size());
+  if (count == 0) { return bounds; }
+
+  auto const keys = thrust::make_transform_iterator(rows.begin(),
+                                                    row_key_fn<T>{d_group_labels, d_orderby});
+  auto const shifted_keys = thrust::make_transform_iterator(
+    rows.begin(), shifted_row_key_fn<T>{d_group_labels, d_orderby, delta, add});
+  auto const key_ids         = thrust::make_constant_iterator<size_type>(-1);
+  auto const shifted_key_ids = thrust::make_counting_iterator<size_type>(0);
+
+  // The merge is stable: the keys of the first sequence come before the equal keys of the second.
+  rmm::device_uvector<size_type> merged_ids(2 * count, stream);
+  if (inclusive) {
+    thrust::merge_by_key(rmm::exec_policy(stream),
+                         keys,
+                         keys + count,
+                         shifted_keys,
+                         shifted_keys + count,
+                         key_ids,
+                         shifted_key_ids,
+                         thrust::make_discard_iterator(),
+                         merged_ids.begin(),
+                         row_key_comparator<Comparator>{});
+  } else {
+    thrust::merge_by_key(rmm::exec_policy(stream),
+                         shifted_keys,
+                         shifted_keys + count,
+                         keys,
+                         keys + count,
+                         shifted_key_ids,
+                         key_ids,
+                         thrust::make_discard_iterator(),
+                         merged_ids.begin(),
+                         row_key_comparator<Comparator>{});
+  }
 
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<int64_t>(0),
+    2 * count,
+    [d_merged_ids = merged_ids.data(), d_rows = rows.data(), d_bounds = bounds.data()] __device__(
+      int64_t position) {
+      auto const id = d_merged_ids[position];
+      if (id >= 0) { d_bounds[d_rows[id]] = static_cast<size_type>(position - id); }
+    });
+  return bounds;
 }
 
-// Range window computation, for rows in DESCENDING order.
+/// Range window computation, for an orderby column grouped as specified in group_offsets.
+/// Each group must be sorted in the order `order`, with its null values clustered at its start
+/// or at its end.
 template <typename T>
-std::unique_ptr<column> range_window_DESC(column_view const& input,
-                                          column_view const& orderby_column,
-                                          rmm::device_uvector<cudf::size_type> const& group_offsets,
-                                          rmm::device_uvector<cudf::size_type> const& group_labels,
-                                          T preceding_window,
-                                          bool preceding_window_is_unbounded,
-                                          T following_window,
-                                          bool following_window_is_unbounded,
-                                          size_type min_periods,
-                                          rolling_aggregation const& aggr,
-                                          rmm::cuda_stream_view stream,
-                                          rmm::mr::device_memory_resource* mr)
+std::unique_ptr<column> range_window(column_view const& input,
+                                     column_view const& orderby_column,
+                                     cudf::order order,
+                                     cudf::device_span<size_type const> group_offsets,
+                                     cudf::device_span<size_type const> group_labels,
+                                     T preceding_window,
+                                     bool preceding_window_is_unbounded,
+                                     T following_window,
+                                     bool following_window_is_unbounded,
+                                     size_type min_periods,
+                                     rolling_aggregation const& aggr,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
 {
   auto [null_start, null_end] =
     get_null_bounds_for_orderby_column(orderby_column, group_offsets, stream);
 
+  // The rows with non-null orderby values, whose windows are searched by value.
+  auto const num_rows = input.size();
+  rmm::device_uvector<size_type> valid_rows(num_rows, stream);
+  auto const p_orderby_device_view = column_device_view::create(orderby_column, stream);
+  auto const valid_rows_end =
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    valid_rows.begin(),
+                    [d_orderby = *p_orderby_device_view] __device__(size_type row) {
+                      return d_orderby.is_valid(row);
+                    });
+  valid_rows.resize(thrust::distance(valid_rows.begin(), valid_rows_end), stream);
+
+  // For ASCENDING order, the window of a row starts at the first value not less than its value
+  // minus `preceding_window`, and ends after the last value not greater than its value plus
+  // `following_window`. For DESCENDING order, the comparisons and the moves are reversed.
+  auto const ascending      = order == cudf::order::ASCENDING;
+  auto const d_orderby      = orderby_column.data<T>();
+  auto const d_group_labels = group_labels.data();
+  auto const search_bounds  = [&](T delta, bool following) {
+    // Moving towards the following rows adds to ascending values and subtracts from descending.
+    auto const add = following == ascending;
+    return ascending
+             ? merge_window_bounds<T, thrust::less<T>>(
+                 valid_rows, num_rows, d_group_labels, d_orderby, delta, add, following, stream)
+             : merge_window_bounds<T, thrust::greater<T>>(
+                 valid_rows, num_rows, d_group_labels, d_orderby, delta, add, following, stream);
+  };
+  auto const starts = preceding_window_is_unbounded ? rmm::device_uvector<size_type>(0, stream)
+                                                    : search_bounds(preceding_window, false);
+  auto const ends   = following_window_is_unbounded ? rmm::device_uvector<size_type>(0, stream)
+                                                    : search_bounds(following_window, true);
+
   auto preceding_calculator =
     [d_group_offsets = group_offsets.data(),
-     d_group_labels  = group_labels.data(),
-     d_orderby       = orderby_column.data<T>(),
+     d_group_labels,
      d_nulls_begin   = null_start.data(),
      d_nulls_end     = null_end.data(),
-     preceding_window,
+     d_valid_rows    = valid_rows.data(),
+     d_starts        = starts.data(),
      preceding_window_is_unbounded] __device__(size_type idx) -> size_type {
     auto group_label = d_group_labels[idx];
     auto group_start = d_group_offsets[group_label];
     auto nulls_begin = d_nulls_begin[group_label];
     auto nulls_end   = d_nulls_end[group_label];
 
-    if (preceding_window_is_unbounded) { return (idx - group_start) + 1; }
+    if (preceding_window_is_unbounded) { return idx - group_start + 1; }
 
     // If idx lies in the null-range, the window is the null range.
     if (idx >= nulls_begin && idx < nulls_end) {
@@ -697,37 +566,24 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
       return idx - nulls_begin + 1;
     }
 
-    // orderby[idx] not null. Search must exclude the null group.
-    // If nulls_begin == group_start, either of the following is true:
-    //  1. NULLS FIRST ordering: Search must begin at nulls_end.
-    //  2. NO NULLS: Search must begin at group_start (which also equals nulls_end.)
-    // Otherwise, NULLS LAST ordering. Search must start at nulls group_start.
-    auto search_start = nulls_begin == group_start ? nulls_end : group_start;
-
-    auto highest_in_window = add_safe(d_orderby[idx], preceding_window);
-
-    return ((d_orderby + idx) -
-            thrust::lower_bound(thrust::seq,
-                                d_orderby + search_start,
-                                d_orderby + idx,
-                                highest_in_window,
-                                thrust::greater<decltype(highest_in_window)>())) +
-           1;  // Add 1, for `preceding` to account for current row.
+    // orderby[idx] not null. The window starts at the valid row after the d_starts[idx] valid
+    // rows ordered before its lowest value, a row of the group no later than idx.
+    return idx - d_valid_rows[d_starts[idx]] + 1;  // Add 1, to account for current row.
   };
 
   auto preceding_column = expand_to_column(preceding_calculator, input.size(), stream, mr);
 
   auto following_calculator =
     [d_group_offsets = group_offsets.data(),
-     d_group_labels  = group_labels.data(),
-     d_orderby       = orderby_column.data<T>(),
+     d_group_labels,
      d_nulls_begin   = null_start.data(),
      d_nulls_end     = null_end.data(),
-     following_window,
+     d_valid_rows    = valid_rows.data(),
+     d_ends          = ends.data(),
      following_window_is_unbounded] __device__(size_type idx) -> size_type {
     auto group_label = d_group_labels[idx];
-    auto group_start = d_group_offsets[group_label];
-    auto group_end   = d_group_offsets[group_label + 1];
+    auto group_end   = d_group_offsets[group_label + 1];  // Cannot fall off the end, since offsets
+                                                          // is capped with `input.size()`.
     auto nulls_begin = d_nulls_begin[group_label];
     auto nulls_end   = d_nulls_end[group_label];
 
@@ -740,32 +596,15 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
       return nulls_end - idx - 1;
     }
 
-    // orderby[idx] not null. Search must exclude the null group.
-    // If nulls_begin == group_start, either of the following is true:
-    //  1. NULLS FIRST ordering: Search ends at group_end.
-    //  2. NO NULLS: Search ends at group_end.
-    // Otherwise, NULLS LAST ordering. Search ends at nulls_begin.
-    auto search_end = nulls_begin == group_start ? group_end : nulls_begin;
-
-    auto lowest_in_window = subtract_safe(d_orderby[idx], following_window);
-
-    return (thrust::upper_bound(thrust::seq,
-                                d_orderby + idx,
-                                d_orderby + search_end,
-                                lowest_in_window,
-                                thrust::greater<decltype(lowest_in_window)>()) -
-            (d_orderby + idx)) -
-           1;
+    // orderby[idx] not null. The window ends at the last of the d_ends[idx] valid rows ordered
+    // no later than its highest value, a row of the group no earlier than idx.
+    return d_valid_rows[d_ends[idx] - 1] - idx;
   };
 
   auto following_column = expand_to_column(following_calculator, input.size(), stream, mr);
 
-  if (aggr.kind == aggregation::CUDA || aggr.kind == aggregation::PTX) {
-    CUDF_FAIL("Ranged rolling window does NOT (yet) support UDF.");
-  } else {
-    return cudf::detail::rolling_window(
-      input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
-  }
+  return cudf::detail::rolling_window(
+    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
 }
 
 template <typename OrderByT>
@@ -785,53 +624,31 @@ std::unique_ptr<column> grouped_range_rolling_window_impl(
   auto preceding_value = detail::range_comparable_value<OrderByT>(preceding_window);
   auto following_value = detail::range_comparable_value<OrderByT>(following_window);
 
-  if (timestamp_ordering == cudf::order::ASCENDING) {
-    return group_offsets.is_empty() ? range_window_ASC(input,
-                                                       orderby_column,
-                                                       preceding_value,
-                                                       preceding_window.is_unbounded(),
-                                                       following_value,
-                                                       following_window.is_unbounded(),
-                                                       min_periods,
-                                                       aggr,
-                                                       stream,
-                                                       mr)
-                                    : range_window_ASC(input,
-                                                       orderby_column,
-                                                       group_offsets,
-                                                       group_labels,
-                                                       preceding_value,
-                                                       preceding_window.is_unbounded(),
-                                                       following_value,
-                                                       following_window.is_unbounded(),
-                                                       min_periods,
-                                                       aggr,
-                                                       stream,
-                                                       mr);
-  } else {
-    return group_offsets.is_empty() ? range_window_DESC(input,
-                                                        orderby_column,
-                                                        preceding_value,
-                                                        preceding_window.is_unbounded(),
-                                                        following_value,
-                                                        following_window.is_unbounded(),
-                                                        min_periods,
-                                                        aggr,
-                                                        stream,
-                                                        mr)
-                                    : range_window_DESC(input,
-                                                        orderby_column,
-                                                        group_offsets,
-                                                        group_labels,
-                                                        preceding_value,
-                                                        preceding_window.is_unbounded(),
-                                                        following_value,
-                                                        following_window.is_unbounded(),
-                                                        min_periods,
-                                                        aggr,
-                                                        stream,
-                                                        mr);
-  }
+  auto const compute_window = [&](auto const& offsets, auto const& labels) {
+    return range_window(input,
+                        orderby_column,
+                        timestamp_ordering,
+                        offsets,
+                        labels,
+                        preceding_value,
+                        preceding_window.is_unbounded(),
+                        following_value,
+                        following_window.is_unbounded(),
+                        min_periods,
+                        aggr,
+                        stream,
+                        mr);
+  };
+
+  if (!group_offsets.is_empty()) { return compute_window(group_offsets, group_labels); }
+
+  // No grouping keys specified: treat as one single group.
+  auto const single_group_offsets = cudf::detail::make_device_uvector_async(
+    std::vector<size_type>{0, input.size()}, stream);
+  rmm::device_uvector<size_type> single_group_labels(input.size(), stream);
+  thrust::uninitialized_fill(
+    rmm::exec_policy(stream), single_group_labels.begin(), single_group_labels.end(), 0);
+  return compute_window(single_group_offsets, single_group_labels);
 }
 
 struct dispatch_grouped_range_rolling_window {
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rolling/prefix_sum_rolling.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief The sum and the number of the valid rows of a range.
+ *
+ * The sum wraps around as unsigned, so that the difference of two prefix sums is the sum of the
+ * rows between them even when the prefix sums overflow.
+ */
+struct prefix_value {
+  uint64_t sum;
+  size_type count;
+};
+
+struct prefix_value_plus {
+  __device__ prefix_value operator()(prefix_value const& lhs, prefix_value const& rhs) const
+  {
+    return {lhs.sum + rhs.sum, lhs.count + rhs.count};
+  }
+};
+
+/**
+ * @brief Returns the value and the count of each row, only the count for `T = void`.
+ */
+template <typename T>
+struct prefix_element_fn {
+  column_device_view const d_input;
+
+  __device__ prefix_value operator()(size_type idx) const
+  {
+    if (d_input.is_null(idx)) { return {0, 0}; }
+    if constexpr (std::is_void_v<T>) {
+      return {0, 1};
+    } else {
+      return {static_cast<uint64_t>(static_cast<int64_t>(d_input.element<T>(idx))), 1};
+    }
+  }
+};
+
+/**
+ * @brief Computes the SUM, MEAN or COUNT_VALID of each window from the prefix sums at its
+ * bounds.
+ */
+template <aggregation::Kind k>
+struct prefix_window_fn {
+  using OutputType =
+    std::conditional_t<k == aggregation::COUNT_VALID,
+                       size_type,
+                       std::conditional_t<k == aggregation::MEAN, double, int64_t>>;
+
+  prefix_value const* d_prefix;
+  size_type const* d_preceding;
+  size_type const* d_following;
+  size_type const size;
+  size_type const min_periods;
+
+  __device__ thrust::pair<OutputType, bool> operator()(size_type idx) const
+  {
+    // same bounds as the gpu_rolling kernel
+    int64_t const preceding_window = d_preceding[idx];
+    int64_t const following_window = d_following[idx];
+    auto const start               = static_cast<size_type>(
+      min(static_cast<int64_t>(size), max(0L, idx - preceding_window + 1)));
+    auto const end = static_cast<size_type>(
+      min(static_cast<int64_t>(size), max(0L, idx + following_window + 1)));
+    auto const start_index = min(start, end);
+    auto const end_index   = max(start, end);
+
+    auto const count = d_prefix[end_index].count - d_prefix[start_index].count;
+    auto const sum   = static_cast<int64_t>(d_prefix[end_index].sum - d_prefix[start_index].sum);
+    if constexpr (k == aggregation::COUNT_VALID) {
+      return {count, (end_index - start_index) >= min_periods};
+    } else if constexpr (k == aggregation::MEAN) {
+      return {static_cast<double>(sum) / count, count >= min_periods};
+    } else {
+      return {sum, count >= min_periods};
+    }
+  }
+};
+
+template <typename T, aggregation::Kind k>
+std::unique_ptr<column> prefix_sum_aggregate(column_view const& input,
+                                             column_view const& preceding_window,
+                                             column_view const& following_window,
+                                             size_type min_periods,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  auto const size    = input.size();
+  auto const d_input = column_device_view::create(input, stream);
+
+  // prefix[i] is the sum of the rows before row i
+  rmm::device_uvector<prefix_value> prefix(size + 1, stream);
+  CUDA_TRY(cudaMemsetAsync(prefix.data(), 0, sizeof(prefix_value), stream.value()));
+  auto const elements = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0), prefix_element_fn<T>{*d_input});
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), elements, elements + size, prefix.begin() + 1, prefix_value_plus{});
+
+  using OutputType = typename prefix_window_fn<k>::OutputType;
+  auto const fn    = prefix_window_fn<k>{prefix.data(),
+                                      preceding_window.begin<size_type>(),
+                                      following_window.begin<size_type>(),
+                                      size,
+                                      min_periods};
+
+  auto output = make_fixed_width_column(
+    data_type{type_to_id<OutputType>()}, size, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(size),
+                    output->mutable_view().begin<OutputType>(),
+                    [fn] __device__(size_type idx) { return fn(idx).first; });
+
+  auto [null_mask, null_count] = valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(size),
+    [fn] __device__(size_type idx) { return fn(idx).second; },
+    stream,
+    mr);
+  if (null_count > 0) { output->set_null_mask(std::move(null_mask), null_count); }
+  return output;
+}
+
+struct prefix_sum_dispatch {
+  template <typename T, std::enable_if_t<is_index_type<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     column_view const& preceding_window,
+                                     column_view const& following_window,
+                                     size_type min_periods,
+                                     aggregation::Kind kind,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    return kind == aggregation::MEAN
+             ? prefix_sum_aggregate<T, aggregation::MEAN>(
+                 input, preceding_window, following_window, min_periods, stream, mr)
+             : prefix_sum_aggregate<T, aggregation::SUM>(
+                 input, preceding_window, following_window, min_periods, stream, mr);
+  }
+
+  template <typename T, std::enable_if_t<!is_index_type<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     column_view const&,
+                                     column_view const&,
+                                     size_type,
+                                     aggregation::Kind,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Unsupported type for prefix sum rolling");
+  }
+};
+
+}  // namespace
+
+bool is_prefix_sum_rolling(column_view const& input,
+                           column_view const& default_outputs,
+                           rolling_aggregation const& agg)
+{
+  if (!default_outputs.is_empty() || is_dictionary(input.type())) { return false; }
+  // without nulls, the count of the rows of a window is already computed in constant time
+  if (agg.kind == aggregation::COUNT_VALID) { return input.has_nulls(); }
+  return is_index_type(input.type()) &&
+         (agg.kind == aggregation::SUM || agg.kind == aggregation::MEAN);
+}
+
+std::unique_ptr<column> prefix_sum_rolling(column_view const& input,
+                                           column_view const& preceding_window,
+                                           column_view const& following_window,
+                                           size_type min_periods,
+                                           rolling_aggregation const& agg,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_prefix_sum_rolling(input, column_view{}, agg),
+               "Unsupported prefix sum rolling aggregation");
+
+  if (agg.kind == aggregation::COUNT_VALID) {
+    return prefix_sum_aggregate<void, aggregation::COUNT_VALID>(
+      input, preceding_window, following_window, min_periods, stream, mr);
+  }
+  return type_dispatcher(input.type(),
+                         prefix_sum_dispatch{},
+                         input,
+                         preceding_window,
+                         following_window,
+                         min_periods,
+                         agg.kind,
+                         stream,
+                         mr);
+}
+
+}  // namespace detail
+}  // namespace cudf
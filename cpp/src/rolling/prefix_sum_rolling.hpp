@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Returns whether `prefix_sum_rolling` supports the rolling aggregation of the column.
+ *
+ * The aggregations supported are SUM and MEAN of the integral columns, whose sums are exact, and
+ * COUNT_VALID of the columns with nulls.
+ */
+bool is_prefix_sum_rolling(column_view const& input,
+                           column_view const& default_outputs,
+                           rolling_aggregation const& agg);
+
+/**
+ * @brief Applies a variable-size rolling window aggregation in constant time per row.
+ *
+ * The result of each window is the difference of the prefix sums of the column at the bounds of
+ * the window, so that the cost does not depend on the sizes of the windows.
+ *
+ * @throw cudf::logic_error if `is_prefix_sum_rolling` is false for the arguments
+ *
+ * @param input The input column
+ * @param preceding_window The INT32 rolling window size in the backward direction of each row
+ * @param following_window The INT32 rolling window size in the forward direction of each row
+ * @param min_periods Minimum number of observations in window required to have a value
+ * @param agg The rolling window aggregation type
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The column of the aggregation of each window
+ */
+std::unique_ptr<column> prefix_sum_rolling(column_view const& input,
+                                           column_view const& preceding_window,
+                                           column_view const& following_window,
+                                           size_type min_periods,
+                                           rolling_aggregation const& agg,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr);
+
+}  // namespace detail
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include "rolling/fixed_window_rolling.hpp"
+#include "rolling/prefix_sum_rolling.hpp"
 #include "rolling_detail.cuh"
 #include <cudf/detail/aggregation/aggregation.hpp>
 
@@ -49,6 +51,10 @@ std::unique_ptr<column> rolling_window(column_view const& input,
                                             agg,
                                             stream,
                                             mr);
+  } else if (is_fixed_window_rolling(
+               input, default_outputs, preceding_window, following_window, agg)) {
+    return fixed_window_rolling(
+      input, preceding_window, following_window, min_periods, agg, stream, mr);
   } else {
     auto preceding_window_begin = thrust::make_constant_iterator(preceding_window);
     auto following_window_begin = thrust::make_constant_iterator(following_window);
@@ -96,6 +102,9 @@ std::unique_ptr<column> rolling_window(column_view const& input,
                                             agg,
                                             stream,
                                             mr);
+  } else if (is_prefix_sum_rolling(input, column_view{}, agg)) {
+    return prefix_sum_rolling(
+      input, preceding_window, following_window, min_periods, agg, stream, mr);
   } else {
     auto defaults_col =
       cudf::is_dictionary(input.type()) ? dictionary_column_view(input).indices() : input;
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/rolling.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/rolling.hpp>
+#include <cudf/table/table.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace detail {
+
+// Evaluates an expression over the results of fixed-size rolling window functions.
+std::unique_ptr<column> rolling_window(
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<rolling_aggregation>> const& aggs,
+  ast::expression const& expr,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const statistics = rolling_window(input,
+                                         preceding_window,
+                                         following_window,
+                                         min_periods,
+                                         aggs,
+                                         stream,
+                                         rmm::mr::get_current_device_resource());
+  return compute_column(statistics->view(), expr, stream, mr);
+}
+
+// Evaluates an expression over the results of variable-size rolling window functions.
+std::unique_ptr<column> rolling_window(
+  column_view const& input,
+  column_view const& preceding_window,
+  column_view const& following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<rolling_aggregation>> const& aggs,
+  ast::expression const& expr,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const statistics = rolling_window(input,
+                                         preceding_window,
+                                         following_window,
+                                         min_periods,
+                                         aggs,
+                                         stream,
+                                         rmm::mr::get_current_device_resource());
+  return compute_column(statistics->view(), expr, stream, mr);
+}
+
+}  // namespace detail
+
+// Evaluates an expression over the results of fixed-size rolling window functions.
+std::unique_ptr<column> rolling_window(
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<rolling_aggregation>> const& aggs,
+  ast::expression const& expr,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::rolling_window(input,
+                                preceding_window,
+                                following_window,
+                                min_periods,
+                                aggs,
+                                expr,
+                                rmm::cuda_stream_default,
+                                mr);
+}
+
+// Evaluates an expression over the results of variable-size rolling window functions.
+std::unique_ptr<column> rolling_window(
+  column_view const& input,
+  column_view const& preceding_window,
+  column_view const& following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<rolling_aggregation>> const& aggs,
+  ast::expression const& expr,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::rolling_window(input,
+                                preceding_window,
+                                following_window,
+                                min_periods,
+                                aggs,
+                                expr,
+                                rmm::cuda_stream_default,
+                                mr);
+}
+
+}  // namespace cudf
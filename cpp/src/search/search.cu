@@ -29,12 +29,14 @@
 #include <cudf/table/table_view.hpp>
 
 #include <hash/unordered_multiset.cuh>
+#include <sort/sort_impl.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/functional.h>
 
 namespace cudf {
 namespace {
@@ -96,6 +98,27 @@ std::unique_ptr<column> search_ordered(table_view const& t,
     return result;
   }
 
+  // Keys of fixed-width columns packed into 64-bit integers are searched for as integers
+  if (t.num_columns() == values.num_columns() and have_same_types(t, values) and
+      detail::can_use_packed_sort_keys(t) and detail::can_use_packed_sort_keys(values)) {
+    auto const null_bits = detail::packed_search_null_bits(t, values);
+    if (detail::packed_sort_key_bits(t, null_bits) <= 64) {
+      auto const haystack =
+        detail::make_packed_sort_keys(t, column_order, null_precedence, null_bits, stream);
+      auto const needles =
+        detail::make_packed_sort_keys(values, column_order, null_precedence, null_bits, stream);
+      launch_search(haystack.begin(),
+                    needles.begin(),
+                    t.num_rows(),
+                    values.num_rows(),
+                    result_out,
+                    thrust::less<uint64_t>{},
+                    find_first,
+                    stream);
+      return result;
+    }
+  }
+
   // This utility will ensure all corresponding dictionary columns have matching keys.
   // It will return any new dictionary columns created as well as updated table_views.
   auto const matched = dictionary::detail::match_dictionaries({t, values}, stream);
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sort/sort_impl.cuh>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/search.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/gather.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace cudf {
+namespace {
+
+/**
+ * @brief Sets the sorted positions of the nodes of the subtree of `node` in the Eytzinger layout
+ * of `tree_rows.size()` rows, from `next_row` on.
+ *
+ * The nodes are numbered from one, and the children of node `i` are the nodes `2i` and `2i + 1`.
+ */
+void eytzinger_rows(std::vector<size_type>& tree_rows, int64_t node, size_type& next_row)
+{
+  if (node > static_cast<int64_t>(tree_rows.size())) { return; }
+  eytzinger_rows(tree_rows, 2 * node, next_row);
+  tree_rows[node - 1] = next_row++;
+  eytzinger_rows(tree_rows, 2 * node + 1, next_row);
+}
+
+/**
+ * @brief Device functor returning the insertion point of a packed key in the Eytzinger search
+ * tree of the packed keys of the sorted rows.
+ */
+struct eytzinger_search_fn {
+  uint64_t const* tree;
+  size_type const* tree_rows;  ///< Sorted position of the row of each node
+  size_type num_rows;
+  bool find_first;
+
+  __device__ size_type operator()(uint64_t needle) const
+  {
+    // The bits of `node` below its leading one are the turns taken, one for each right turn
+    uint64_t node = 1;
+    while (node <= static_cast<uint64_t>(num_rows)) {
+      auto const key = tree[node - 1];
+      node           = 2 * node + (find_first ? key < needle : key <= needle);
+    }
+    // The insertion point is the row of the node of the last left turn, and the end of the rows
+    // when the search only turned right
+    node >>= __ffsll(static_cast<long long>(~node));
+    return node == 0 ? num_rows : tree_rows[node - 1];
+  }
+};
+
+}  // namespace
+
+struct sorted_index::sorted_index_impl {
+  rmm::cuda_stream_view const _stream = rmm::cuda_stream_default;
+  std::unique_ptr<table> _keys;
+  std::vector<order> const _column_order;
+  std::vector<null_order> const _null_precedence;
+
+  bool _has_tree = false;
+  std::vector<bool> _null_bits;  ///< Whether the packed keys have a null bit for each column
+  rmm::device_uvector<uint64_t> _tree;
+  rmm::device_uvector<size_type> _tree_rows;
+
+  sorted_index_impl(table_view const& sorted_keys,
+                    std::vector<order> const& column_order,
+                    std::vector<null_order> const& null_precedence,
+                    rmm::mr::device_memory_resource* mr)
+    : _keys{std::make_unique<table>(sorted_keys, _stream, mr)},
+      _column_order{column_order},
+      _null_precedence{null_precedence},
+      _tree{0, _stream, mr},
+      _tree_rows{0, _stream, mr}
+  {
+    CUDF_EXPECTS(column_order.empty() or
+                   static_cast<std::size_t>(sorted_keys.num_columns()) == column_order.size(),
+                 "Mismatch between number of columns and column order.");
+    CUDF_EXPECTS(null_precedence.empty() or
+                   static_cast<std::size_t>(sorted_keys.num_columns()) == null_precedence.size(),
+                 "Mismatch between number of columns and null precedence.");
+
+    if (not detail::can_use_packed_sort_keys(sorted_keys)) { return; }
+    _null_bits = detail::packed_search_null_bits(sorted_keys, sorted_keys);
+    if (detail::packed_sort_key_bits(sorted_keys, _null_bits) > 64) { return; }
+
+    auto const num_rows = sorted_keys.num_rows();
+    std::vector<size_type> tree_rows(num_rows);
+    size_type next_row = 0;
+    eytzinger_rows(tree_rows, 1, next_row);
+    _tree_rows = detail::make_device_uvector_async(tree_rows, _stream, mr);
+
+    auto const keys = detail::make_packed_sort_keys(
+      sorted_keys, _column_order, _null_precedence, _null_bits, _stream);
+    _tree = rmm::device_uvector<uint64_t>(num_rows, _stream, mr);
+    thrust::gather(
+      rmm::exec_policy(_stream), _tree_rows.begin(), _tree_rows.end(), keys.begin(), _tree.begin());
+    _has_tree = true;
+    _stream.synchronize();
+  }
+
+  /**
+   * @brief Returns whether the packed keys of the tree can be searched for the rows of `values`.
+   */
+  [[nodiscard]] bool can_use_tree(table_view const& values) const
+  {
+    if (not _has_tree or values.num_columns() != _keys->num_columns() or
+        not have_same_types(_keys->view(), values)) {
+      return false;
+    }
+    for (size_type c = 0; c < values.num_columns(); ++c) {
+      if (values.column(c).has_nulls() and not _null_bits[c]) { return false; }
+    }
+    return true;
+  }
+
+  std::unique_ptr<column> search(table_view const& values,
+                                 bool find_first,
+                                 rmm::mr::device_memory_resource* mr) const
+  {
+    if (not can_use_tree(values)) {
+      return find_first ? detail::lower_bound(
+                            _keys->view(), values, _column_order, _null_precedence, _stream, mr)
+                        : detail::upper_bound(
+                            _keys->view(), values, _column_order, _null_precedence, _stream, mr);
+    }
+
+    auto result = make_numeric_column(data_type{type_to_id<size_type>()},
+                                      values.num_rows(),
+                                      mask_state::UNALLOCATED,
+                                      _stream,
+                                      mr);
+    auto const needles = detail::make_packed_sort_keys(
+      values, _column_order, _null_precedence, _null_bits, _stream);
+    thrust::transform(
+      rmm::exec_policy(_stream),
+      needles.begin(),
+      needles.end(),
+      result->mutable_view().begin<size_type>(),
+      eytzinger_search_fn{_tree.data(), _tree_rows.data(), _keys->num_rows(), find_first});
+    return result;
+  }
+};
+
+sorted_index::~sorted_index() = default;
+
+sorted_index::sorted_index(table_view const& sorted_keys,
+                           std::vector<order> const& column_order,
+                           std::vector<null_order> const& null_precedence,
+                           rmm::mr::device_memory_resource* mr)
+  : impl{std::make_unique<sorted_index_impl>(sorted_keys, column_order, null_precedence, mr)}
+{
+}
+
+std::unique_ptr<column> sorted_index::lower_bound(table_view const& values,
+                                                  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->search(values, true, mr);
+}
+
+std::unique_ptr<column> sorted_index::upper_bound(table_view const& values,
+                                                  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->search(values, false, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/merge.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/datasource.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <thrust/host_vector.h>
+#include <thrust/system/cuda/experimental/pinned_allocator.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+namespace cudf {
+namespace {
+
+using pinned_buffer =
+  thrust::host_vector<uint8_t, thrust::system::cuda::experimental::pinned_allocator<uint8_t>>;
+
+/**
+ * @brief A block of a sorted run, packed by `contiguous_split` and spilled to pinned host memory
+ * or to the spill file.
+ */
+struct spilled_block {
+  std::unique_ptr<packed_columns::metadata> metadata;
+  pinned_buffer data;       ///< The packed data, when not spilled to the file
+  std::size_t file_offset;  ///< Offset of the packed data in the spill file
+  std::size_t size;         ///< Size in bytes of the packed data
+};
+
+/**
+ * @brief A sorted run, made of the blocks yet to be merged.
+ */
+struct sorted_run {
+  std::deque<spilled_block> blocks;
+  std::unique_ptr<table> last_keys;  ///< Keys of the last row of the last block loaded
+};
+
+}  // namespace
+
+struct external_sorter::external_sorter_impl {
+  std::vector<size_type> const _key_columns;
+  std::vector<order> const _column_order;
+  std::vector<null_order> const _null_precedence;
+  size_type const _block_rows;
+  rmm::cuda_stream_view const _stream = rmm::cuda_stream_default;
+
+  std::string _spill_path;
+  std::unique_ptr<io::data_sink> _spill_sink;
+  std::unique_ptr<io::datasource> _spill_source;
+
+  std::unique_ptr<table> _schema;  ///< Empty table of the schema of the chunks
+  std::vector<sorted_run> _runs;
+  bool _merging = false;
+  // Rows of the loaded blocks not returned yet, in sorted order
+  std::unique_ptr<table> _merged;
+
+  external_sorter_impl(std::vector<size_type> key_columns,
+                       std::vector<order> column_order,
+                       std::vector<null_order> null_precedence,
+                       size_type block_rows,
+                       std::string const& spill_directory)
+    : _key_columns{std::move(key_columns)},
+      _column_order{std::move(column_order)},
+      // The merge of nullable keys requires the null order of each key column
+      _null_precedence{null_precedence.empty()
+                         ? std::vector<null_order>(_key_columns.size(), null_order::BEFORE)
+                         : std::move(null_precedence)},
+      _block_rows{block_rows}
+  {
+    CUDF_EXPECTS(not _key_columns.empty(), "External sort requires at least one key column");
+    CUDF_EXPECTS(_column_order.size() == _key_columns.size(),
+                 "Mismatch between number of key columns and column order.");
+    CUDF_EXPECTS(_null_precedence.size() == _key_columns.size(),
+                 "Mismatch between number of key columns and null_precedence size.");
+    CUDF_EXPECTS(_block_rows > 0, "Number of rows of the blocks must be positive");
+
+    if (not spill_directory.empty()) {
+      std::string path = spill_directory + "/cudf_external_sort_XXXXXX";
+      auto const fd    = mkstemp(path.data());
+      CUDF_EXPECTS(fd != -1, "Cannot create the spill file of the external sort");
+      close(fd);
+      _spill_path = path;
+      _spill_sink = io::data_sink::create(_spill_path);
+    }
+  }
+
+  ~external_sorter_impl()
+  {
+    if (not _spill_path.empty()) {
+      _spill_sink.reset();
+      _spill_source.reset();
+      std::remove(_spill_path.c_str());
+    }
+  }
+
+  /**
+   * @brief Spills the packed `block` to host memory, or to the spill file.
+   *
+   * The copy to host memory is only queued on the stream, so that the blocks of a run are copied
+   * before waiting on any of them.
+   */
+  spilled_block spill(packed_columns&& block)
+  {
+    auto const size = block.gpu_data ? block.gpu_data->size() : 0;
+    spilled_block spilled{std::move(block.metadata_), pinned_buffer(size), 0, size};
+    if (size > 0) {
+      CUDA_TRY(cudaMemcpyAsync(spilled.data.data(),
+                               block.gpu_data->data(),
+                               size,
+                               cudaMemcpyDeviceToHost,
+                               _stream.value()));
+    }
+    return spilled;
+  }
+
+  /**
+   * @brief Copies `block` back to device memory and returns it.
+   */
+  packed_columns load(spilled_block& block)
+  {
+    auto gpu_data = std::make_unique<rmm::device_buffer>(block.size, _stream);
+    if (_spill_source) {
+      block.data = pinned_buffer(block.size);
+      _spill_source->host_read(block.file_offset, block.size, block.data.data());
+    }
+    if (block.size > 0) {
+      CUDA_TRY(cudaMemcpyAsync(gpu_data->data(),
+                               block.data.data(),
+                               block.size,
+                               cudaMemcpyHostToDevice,
+                               _stream.value()));
+    }
+    // The host buffer is released with the block, so the copy must be done by then
+    _stream.synchronize();
+    return packed_columns{std::move(block.metadata), std::move(gpu_data)};
+  }
+
+  void push(table_view const& chunk)
+  {
+    CUDF_EXPECTS(not _merging, "External sort chunks cannot be pushed once merging has started");
+    if (not _schema) {
+      CUDF_EXPECTS(
+        std::all_of(_key_columns.begin(),
+                    _key_columns.end(),
+                    [&chunk](auto i) { return i >= 0 and i < chunk.num_columns(); }),
+        "Key column index out of range of the chunk");
+      _schema = empty_like(chunk);
+    }
+    auto const schema    = _schema->view();
+    auto const same_type = [](column_view const& lhs, column_view const& rhs) {
+      return lhs.type() == rhs.type();
+    };
+    CUDF_EXPECTS(std::equal(chunk.begin(), chunk.end(), schema.begin(), schema.end(), same_type),
+                 "Mismatch in the schema of the chunks");
+    if (chunk.num_rows() == 0) { return; }
+
+    auto const sorted = cudf::detail::sort_by_key(
+      chunk, chunk.select(_key_columns), _column_order, _null_precedence, _stream);
+    std::vector<size_type> splits;
+    for (auto row = _block_rows; row < sorted->num_rows(); row += _block_rows) {
+      splits.push_back(row);
+    }
+    auto blocks = cudf::detail::contiguous_split(sorted->view(), splits, _stream);
+
+    sorted_run run;
+    for (auto& block : blocks) {
+      run.blocks.push_back(spill(std::move(block.data)));
+    }
+    _stream.synchronize();
+    if (_spill_sink) {
+      for (auto& block : run.blocks) {
+        block.file_offset = _spill_sink->bytes_written();
+        _spill_sink->host_write(block.data.data(), block.size);
+        block.data = pinned_buffer{};
+      }
+    }
+    _runs.push_back(std::move(run));
+  }
+
+  /**
+   * @brief Loads the next block of `run` and merges it with the rows not returned yet.
+   */
+  void load_next_block(sorted_run& run)
+  {
+    auto const packed = load(run.blocks.front());
+    run.blocks.pop_front();
+    auto const block = unpack(packed);
+
+    auto const last_row = block.num_rows() - 1;
+    run.last_keys       = std::make_unique<table>(
+      cudf::slice(block.select(_key_columns), {last_row, last_row + 1}).front(), _stream);
+
+    _merged = cudf::detail::merge({_merged->view(), block},
+                                  _key_columns,
+                                  _column_order,
+                                  _null_precedence,
+                                  _stream,
+                                  rmm::mr::get_current_device_resource());
+  }
+
+  /**
+   * @brief Returns the run of the smallest last loaded keys among the runs with blocks left to
+   * load, and the number of merged rows that are not larger than these keys.
+   *
+   * These rows precede all the rows left to load, so that they can be returned. When all the
+   * blocks have been loaded, all the merged rows can be returned.
+   */
+  std::pair<sorted_run*, size_type> next_to_load()
+  {
+    std::vector<sorted_run*> pending;
+    std::vector<table_view> last_keys;
+    for (auto& run : _runs) {
+      if (not run.blocks.empty()) {
+        pending.push_back(&run);
+        last_keys.push_back(run.last_keys->view());
+      }
+    }
+    if (pending.empty()) { return {nullptr, _merged->num_rows()}; }
+
+    auto const frontiers = cudf::detail::concatenate(last_keys, _stream);
+    auto const order =
+      cudf::detail::sorted_order(frontiers->view(), _column_order, _null_precedence, _stream);
+    auto const smallest = cudf::detail::get_value<size_type>(order->view(), 0, _stream);
+
+    auto const frontier = cudf::slice(frontiers->view(), {smallest, smallest + 1}).front();
+    auto const bound    = cudf::detail::upper_bound(_merged->select(_key_columns),
+                                                    frontier,
+                                                    _column_order,
+                                                    _null_precedence,
+                                                    _stream);
+    return {pending[smallest], cudf::detail::get_value<size_type>(bound->view(), 0, _stream)};
+  }
+
+  void start_merging()
+  {
+    _merging = true;
+    if (_spill_sink) {
+      _spill_sink->flush();
+      _spill_sink.reset();
+      _spill_source = io::datasource::create(_spill_path);
+    }
+    _merged = empty_like(_schema->view());
+    for (auto& run : _runs) {
+      load_next_block(run);
+    }
+  }
+
+  [[nodiscard]] bool has_next() const
+  {
+    if (not _merging) { return not _runs.empty(); }
+    return _merged->num_rows() > 0 or std::any_of(_runs.begin(), _runs.end(), [](auto const& run) {
+             return not run.blocks.empty();
+           });
+  }
+
+  std::unique_ptr<table> next(size_type max_rows, rmm::mr::device_memory_resource* mr)
+  {
+    CUDF_EXPECTS(max_rows > 0, "Number of rows to return must be positive");
+    CUDF_EXPECTS(_schema != nullptr, "External sort requires at least one chunk");
+    if (not _merging) { start_merging(); }
+
+    auto [run, num_ready] = next_to_load();
+    while (run != nullptr and num_ready < max_rows) {
+      load_next_block(*run);
+      std::tie(run, num_ready) = next_to_load();
+    }
+
+    auto const num_rows = std::min(num_ready, max_rows);
+    auto const parts    = cudf::split(_merged->view(), {num_rows});
+    auto result         = std::make_unique<table>(parts[0], _stream, mr);
+    _merged             = std::make_unique<table>(parts[1], _stream);
+    return result;
+  }
+};
+
+external_sorter::~external_sorter() = default;
+
+external_sorter::external_sorter(std::vector<size_type> key_columns,
+                                 std::vector<order> column_order,
+                                 std::vector<null_order> null_precedence,
+                                 size_type block_rows,
+                                 std::string const& spill_directory)
+  : impl{std::make_unique<external_sorter_impl>(std::move(key_columns),
+                                                std::move(column_order),
+                                                std::move(null_precedence),
+                                                block_rows,
+                                                spill_directory)}
+{
+}
+
+void external_sorter::push(table_view const& chunk)
+{
+  CUDF_FUNC_RANGE();
+  impl->push(chunk);
+}
+
+bool external_sorter::has_next() const { return impl->has_next(); }
+
+std::unique_ptr<table> external_sorter::next(size_type max_rows,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return impl->next(max_rows, mr);
+}
+
+}  // namespace cudf
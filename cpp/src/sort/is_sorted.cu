@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,8 +15,8 @@
  */
 
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/structs/utilities.hpp>
-#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
@@ -24,7 +24,6 @@
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
-#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/sort.h>
@@ -32,40 +31,26 @@
 namespace cudf {
 namespace detail {
 
-auto is_sorted(cudf::table_view const& in,
-               std::vector<order> const& column_order,
-               bool has_nulls,
-               std::vector<null_order> const& null_precedence,
-               rmm::cuda_stream_view stream)
+bool is_sorted(structs::detail::preprocessed_table const& keys, rmm::cuda_stream_view stream)
 {
-  // 0-table_view, 1-column_order, 2-null_precedence, 3-validity_columns
-  auto flattened = structs::detail::flatten_nested_columns(in, column_order, null_precedence);
-
-  auto const d_input           = table_device_view::create(flattened, stream);
-  auto const d_column_order    = make_device_uvector_async(flattened.orders(), stream);
-  auto const d_null_precedence = has_nulls
-                                   ? make_device_uvector_async(flattened.null_orders(), stream)
-                                   : rmm::device_uvector<null_order>(0, stream);
+  auto const comparator = row_lexicographic_comparator(nullate::DYNAMIC{keys.has_nulls()},
+                                                       keys.device_view(),
+                                                       keys.device_view(),
+                                                       keys.d_column_order(),
+                                                       keys.d_null_precedence());
 
-  auto comparator = row_lexicographic_comparator(nullate::DYNAMIC{has_nulls},
-                                                 *d_input,
-                                                 *d_input,
-                                                 d_column_order.data(),
-                                                 d_null_precedence.data());
-
-  auto sorted = thrust::is_sorted(rmm::exec_policy(stream),
-                                  thrust::make_counting_iterator(0),
-                                  thrust::make_counting_iterator(in.num_rows()),
-                                  comparator);
-
-  return sorted;
+  return thrust::is_sorted(rmm::exec_policy(stream),
+                           thrust::make_counting_iterator(0),
+                           thrust::make_counting_iterator(keys.flattened_columns().num_rows()),
+                           comparator);
 }
 
 }  // namespace detail
 
 bool is_sorted(cudf::table_view const& in,
                std::vector<order> const& column_order,
-               std::vector<null_order> const& null_precedence)
+               std::vector<null_order> const& null_precedence,
+               rmm::cuda_stream_view stream)
 {
   CUDF_FUNC_RANGE();
   if (in.num_columns() == 0 || in.num_rows() == 0) { return true; }
@@ -81,8 +66,13 @@ bool is_sorted(cudf::table_view const& in,
       "Number of columns in the table doesn't match the vector null_precedence's size .\n");
   }
 
-  return detail::is_sorted(
-    in, column_order, has_nulls(in), null_precedence, rmm::cuda_stream_default);
+  auto const keys = structs::detail::preprocessed_table::create(
+    in,
+    column_order,
+    null_precedence,
+    structs::detail::column_nullability::MATCH_INCOMING,
+    stream);
+  return detail::is_sorted(*keys, stream);
 }
 
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,7 +18,9 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table.hpp>
@@ -29,10 +31,15 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/for_each.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/permutation_iterator.h>
+#include <thrust/reduce.h>
 #include <thrust/sequence.h>
 
+#include <algorithm>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 namespace {
@@ -73,118 +80,7 @@ rmm::device_uvector<size_type> sorted_dense_rank(column_view input_col,
   return dense_rank_sorted;
 }
 
-/**
- * @brief Breaks the ties among equal value groups using binary operator and
- * transform this tied value to final rank.
- *
- * @param dense_rank dense rank of sorted input column (acts as key for value
- * groups).
- * @param tie_iter  iterator of rank to break ties among equal value groups.
- * @param sorted_order_view sorted order indices of input column
- * @param rank_iter output rank iterator
- * @param tie_breaker tie breaking operator. For example, maximum & minimum.
- * @param transformer transform after tie breaking (useful for average).
- * @param stream CUDA stream used for device memory operations and kernel launches.
- */
-template <typename TieType,
-          typename outputIterator,
-          typename TieBreaker,
-          typename Transformer,
-          typename TieIterator>
-void tie_break_ranks_transform(cudf::device_span<size_type const> dense_rank_sorted,
-                               TieIterator tie_iter,
-                               column_view const& sorted_order_view,
-                               outputIterator rank_iter,
-                               TieBreaker tie_breaker,
-                               Transformer transformer,
-                               rmm::cuda_stream_view stream)
-{
-  auto const input_size = sorted_order_view.size();
-  // algorithm: reduce_by_key(dense_rank, 1, n, reduction_tie_breaker)
-  // reduction_tie_breaker = min, max, min_count
-  rmm::device_uvector<TieType> tie_sorted(sorted_order_view.size(), stream);
-  thrust::reduce_by_key(rmm::exec_policy(stream),
-                        dense_rank_sorted.begin(),
-                        dense_rank_sorted.end(),
-                        tie_iter,
-                        thrust::make_discard_iterator(),
-                        tie_sorted.begin(),
-                        thrust::equal_to{},
-                        tie_breaker);
-  auto sorted_tied_rank = thrust::make_transform_iterator(
-    dense_rank_sorted.begin(),
-    [tied_rank = tie_sorted.begin(), transformer] __device__(auto dense_pos) {
-      return transformer(tied_rank[dense_pos - 1]);
-    });
-  thrust::scatter(rmm::exec_policy(stream),
-                  sorted_tied_rank,
-                  sorted_tied_rank + input_size,
-                  sorted_order_view.begin<size_type>(),
-                  rank_iter);
-}
-
-template <typename outputType>
-void rank_first(column_view sorted_order_view,
-                mutable_column_view rank_mutable_view,
-                rmm::cuda_stream_view stream)
-{
-  // stable sort order ranking (no ties)
-  thrust::scatter(rmm::exec_policy(stream),
-                  thrust::make_counting_iterator<size_type>(1),
-                  thrust::make_counting_iterator<size_type>(rank_mutable_view.size() + 1),
-                  sorted_order_view.begin<size_type>(),
-                  rank_mutable_view.begin<outputType>());
-}
-
-template <typename outputType>
-void rank_dense(cudf::device_span<size_type const> dense_rank_sorted,
-                column_view sorted_order_view,
-                mutable_column_view rank_mutable_view,
-                rmm::cuda_stream_view stream)
-{
-  // All equal values have same rank and rank always increases by 1 between groups
-  thrust::scatter(rmm::exec_policy(stream),
-                  dense_rank_sorted.begin(),
-                  dense_rank_sorted.end(),
-                  sorted_order_view.begin<size_type>(),
-                  rank_mutable_view.begin<outputType>());
-}
-
-template <typename outputType>
-void rank_min(cudf::device_span<size_type const> group_keys,
-              column_view sorted_order_view,
-              mutable_column_view rank_mutable_view,
-              rmm::cuda_stream_view stream)
-{
-  // min of first in the group
-  // All equal values have min of ranks among them.
-  // algorithm: reduce_by_key(dense_rank, 1, n, min), scatter
-  tie_break_ranks_transform<size_type>(group_keys,
-                                       thrust::make_counting_iterator<size_type>(1),
-                                       sorted_order_view,
-                                       rank_mutable_view.begin<outputType>(),
-                                       thrust::minimum{},
-                                       thrust::identity{},
-                                       stream);
-}
-
-template <typename outputType>
-void rank_max(cudf::device_span<size_type const> group_keys,
-              column_view sorted_order_view,
-              mutable_column_view rank_mutable_view,
-              rmm::cuda_stream_view stream)
-{
-  // max of first in the group
-  // All equal values have max of ranks among them.
-  // algorithm: reduce_by_key(dense_rank, 1, n, max), scatter
-  tie_break_ranks_transform<size_type>(group_keys,
-                                       thrust::make_counting_iterator<size_type>(1),
-                                       sorted_order_view,
-                                       rank_mutable_view.begin<outputType>(),
-                                       thrust::maximum{},
-                                       thrust::identity{},
-                                       stream);
-}
+using MinCount = thrust::pair<size_type, size_type>;
 
 // Returns index, count
 template <typename T>
@@ -192,140 +88,220 @@ struct index_counter {
   __device__ T operator()(size_type i) { return T{i, 1}; }
 };
 
-void rank_average(cudf::device_span<size_type const> group_keys,
-                  column_view sorted_order_view,
-                  mutable_column_view rank_mutable_view,
-                  rmm::cuda_stream_view stream)
+/**
+ * @brief Returns the min rank and the count of the rows of each group of equal values, indexed by
+ * their dense rank minus one.
+ *
+ * @param dense_rank_sorted dense rank of sorted input column (acts as key for value groups)
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+rmm::device_uvector<MinCount> sorted_rank_groups(
+  cudf::device_span<size_type const> dense_rank_sorted, rmm::cuda_stream_view stream)
 {
-  // k, k+1, .. k+n-1
-  // average = (n*k+ n*(n-1)/2)/n
-  // average = k + (n-1)/2 = min + (count-1)/2
-  // Calculate Min of ranks and Count of equal values
   // algorithm: reduce_by_key(dense_rank, 1, n, min_count)
-  //            transform(min+(count-1)/2), scatter
-  using MinCount = thrust::pair<size_type, size_type>;
-  tie_break_ranks_transform<MinCount>(
-    group_keys,
+  rmm::device_uvector<MinCount> groups(dense_rank_sorted.size(), stream);
+  thrust::reduce_by_key(
+    rmm::exec_policy(stream),
+    dense_rank_sorted.begin(),
+    dense_rank_sorted.end(),
     // Use device functor with return type. Cannot use device lambda due to limitation.
     // https://docs.nvidia.com/cuda/cuda-c-programming-guide/index.html#extended-lambda-restrictions
     cudf::detail::make_counting_transform_iterator(1, index_counter<MinCount>{}),
-    sorted_order_view,
-    rank_mutable_view.begin<double>(),
+    thrust::make_discard_iterator(),
+    groups.begin(),
+    thrust::equal_to{},
     [] __device__(auto rank_count1, auto rank_count2) {
       return MinCount{std::min(rank_count1.first, rank_count2.first),
                       rank_count1.second + rank_count2.second};
-    },
-    [] __device__(MinCount minrank_count) {  // min+(count-1)/2
-      return static_cast<double>(thrust::get<0>(minrank_count)) +
-             (static_cast<double>(thrust::get<1>(minrank_count)) - 1) / 2.0;
-    },
-    stream);
+    });
+  return groups;
 }
 
+/**
+ * @brief A requested rank column, written as `double` or `size_type` values.
+ */
+struct rank_output {
+  rank_method method;
+  void* data;
+  bool is_double;
+};
+
+/**
+ * @brief Device functor writing the ranks of the row at a position of the sorted order to every
+ * requested rank column.
+ */
+struct rank_writer_fn {
+  size_type const* sorted_order;
+  size_type const* dense_rank_sorted;  ///< Empty when only FIRST ranks are requested
+  MinCount const* groups;              ///< Empty unless MIN, MAX or AVERAGE ranks are requested
+  rank_output const* outputs;
+  size_type num_outputs;
+  bool percentage;
+  double count;        ///< Divisor of the percentage ranks
+  double dense_count;  ///< Divisor of the percentage DENSE ranks
+
+  __device__ double sorted_rank(rank_method method, size_type position) const
+  {
+    switch (method) {
+      // stable sort order ranking (no ties)
+      case rank_method::FIRST: return position + 1;
+      // All equal values have same rank and rank always increases by 1 between groups
+      case rank_method::DENSE: return dense_rank_sorted[position];
+      default: break;
+    }
+    auto const group = groups[dense_rank_sorted[position] - 1];
+    switch (method) {
+      case rank_method::MIN: return group.first;
+      case rank_method::MAX: return group.first + group.second - 1;
+      // k, k+1, .. k+n-1
+      // average = (n*k+ n*(n-1)/2)/n
+      // average = k + (n-1)/2 = min + (count-1)/2
+      default: return group.first + (group.second - 1) / 2.0;
+    }
+  }
+
+  __device__ void operator()(size_type position) const
+  {
+    auto const row = sorted_order[position];
+    for (size_type i = 0; i < num_outputs; ++i) {
+      auto const& output = outputs[i];
+      auto rank          = sorted_rank(output.method, position);
+      if (percentage) { rank /= output.method == rank_method::DENSE ? dense_count : count; }
+      if (output.is_double) {
+        static_cast<double*>(output.data)[row] = rank;
+      } else {
+        static_cast<size_type*>(output.data)[row] = static_cast<size_type>(rank);
+      }
+    }
+  }
+};
+
 }  // anonymous namespace
 
-std::unique_ptr<column> rank(column_view const& input,
-                             rank_method method,
-                             order column_order,
-                             null_policy null_handling,
-                             null_order null_precedence,
-                             bool percentage,
-                             rmm::cuda_stream_view stream,
-                             rmm::mr::device_memory_resource* mr)
+std::vector<std::unique_ptr<column>> rank(column_view const& input,
+                                          std::vector<rank_method> const& methods,
+                                          order column_order,
+                                          null_policy null_handling,
+                                          null_order null_precedence,
+                                          bool percentage,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
 {
-  data_type const output_type         = (percentage or method == rank_method::AVERAGE)
-                                          ? data_type(type_id::FLOAT64)
-                                          : data_type(type_to_id<size_type>());
-  std::unique_ptr<column> rank_column = [&null_handling, &output_type, &input, &stream, &mr] {
+  auto const has_method = [&methods](rank_method method) {
+    return std::find(methods.begin(), methods.end(), method) != methods.end();
+  };
+
+  std::vector<std::unique_ptr<column>> rank_columns;
+  std::vector<rank_output> outputs;
+  for (auto const method : methods) {
+    CUDF_EXPECTS(method == rank_method::FIRST or method == rank_method::AVERAGE or
+                   method == rank_method::MIN or method == rank_method::MAX or
+                   method == rank_method::DENSE,
+                 "Unexpected rank_method for rank()");
+    data_type const output_type = (percentage or method == rank_method::AVERAGE)
+                                    ? data_type(type_id::FLOAT64)
+                                    : data_type(type_to_id<size_type>());
     // na_option=keep assign NA to NA values
-    if (null_handling == null_policy::EXCLUDE)
-      return make_numeric_column(output_type,
-                                 input.size(),
-                                 detail::copy_bitmask(input, stream, mr),
-                                 input.null_count(),
-                                 stream,
-                                 mr);
-    else
-      return make_numeric_column(output_type, input.size(), mask_state::UNALLOCATED, stream, mr);
-  }();
-  auto rank_mutable_view = rank_column->mutable_view();
+    rank_columns.push_back(
+      null_handling == null_policy::EXCLUDE
+        ? make_numeric_column(output_type,
+                              input.size(),
+                              detail::copy_bitmask(input, stream, mr),
+                              input.null_count(),
+                              stream,
+                              mr)
+        : make_numeric_column(output_type, input.size(), mask_state::UNALLOCATED, stream, mr));
+    outputs.push_back(rank_output{
+      method, rank_columns.back()->mutable_view().head(), output_type.id() == type_id::FLOAT64});
+  }
+  if (input.is_empty() or methods.empty()) { return rank_columns; }
 
-  std::unique_ptr<column> sorted_order =
-    (method == rank_method::FIRST)
-      ? detail::stable_sorted_order(
-          table_view{{input}}, {column_order}, {null_precedence}, stream, mr)
-      : detail::sorted_order(table_view{{input}}, {column_order}, {null_precedence}, stream, mr);
+  // A single sort serves all the methods, stable for the FIRST ranks
+  auto const sorted_order =
+    has_method(rank_method::FIRST)
+      ? detail::stable_sorted_order(table_view{{input}},
+                                    {column_order},
+                                    {null_precedence},
+                                    stream,
+                                    rmm::mr::get_current_device_resource())
+      : detail::sorted_order(table_view{{input}},
+                             {column_order},
+                             {null_precedence},
+                             stream,
+                             rmm::mr::get_current_device_resource());
   column_view sorted_order_view = sorted_order->view();
 
   // dense: All equal values have same rank and rank always increases by 1 between groups
   // acts as key for min, max, average to denote equal value groups
-  rmm::device_uvector<size_type> const dense_rank_sorted =
-    [&method, &input, &sorted_order_view, &stream] {
-      if (method != rank_method::FIRST)
-        return sorted_dense_rank(input, sorted_order_view, stream);
-      else
-        return rmm::device_uvector<size_type>(0, stream);
-    }();
+  auto const needs_groups = has_method(rank_method::MIN) or has_method(rank_method::MAX) or
+                            has_method(rank_method::AVERAGE);
+  auto const dense_rank_sorted = needs_groups or has_method(rank_method::DENSE)
+                                   ? sorted_dense_rank(input, sorted_order_view, stream)
+                                   : rmm::device_uvector<size_type>(0, stream);
+  auto const groups            = needs_groups ? sorted_rank_groups(dense_rank_sorted, stream)
+                                              : rmm::device_uvector<MinCount>(0, stream);
 
-  if (output_type.id() == type_id::FLOAT64) {
-    switch (method) {
-      case rank_method::FIRST:
-        rank_first<double>(sorted_order_view, rank_mutable_view, stream);
-        break;
-      case rank_method::DENSE:
-        rank_dense<double>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
-        break;
-      case rank_method::MIN:
-        rank_min<double>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
-        break;
-      case rank_method::MAX:
-        rank_max<double>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
-        break;
-      case rank_method::AVERAGE:
-        rank_average(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
-        break;
-      default: CUDF_FAIL("Unexpected rank_method for rank()");
-    }
-  } else {
-    switch (method) {
-      case rank_method::FIRST:
-        rank_first<size_type>(sorted_order_view, rank_mutable_view, stream);
-        break;
-      case rank_method::DENSE:
-        rank_dense<size_type>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
-        break;
-      case rank_method::MIN:
-        rank_min<size_type>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
-        break;
-      case rank_method::MAX:
-        rank_max<size_type>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
-        break;
-      case rank_method::AVERAGE:
-        rank_average(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
-        break;
-      default: CUDF_FAIL("Unexpected rank_method for rank()");
-    }
-  }
+  size_type const count =
+    (null_handling == null_policy::EXCLUDE) ? input.size() - input.null_count() : input.size();
+  auto const dense_count = percentage and has_method(rank_method::DENSE) and count > 0
+                             ? dense_rank_sorted.element(count - 1, stream)
+                             : 1;
 
-  // pct inplace transform
-  if (percentage) {
-    auto rank_iter = rank_mutable_view.begin<double>();
-    size_type const count =
-      (null_handling == null_policy::EXCLUDE) ? input.size() - input.null_count() : input.size();
-    auto drs            = dense_rank_sorted.data();
-    bool const is_dense = (method == rank_method::DENSE);
-    thrust::transform(rmm::exec_policy(stream),
-                      rank_iter,
-                      rank_iter + input.size(),
-                      rank_iter,
-                      [is_dense, drs, count] __device__(double r) -> double {
-                        return is_dense ? r / drs[count - 1] : r / count;
-                      });
-  }
-  return rank_column;
+  auto const d_outputs = cudf::detail::make_device_uvector_async(outputs, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     input.size(),
+                     rank_writer_fn{sorted_order_view.begin<size_type>(),
+                                    dense_rank_sorted.data(),
+                                    groups.data(),
+                                    d_outputs.data(),
+                                    static_cast<size_type>(d_outputs.size()),
+                                    percentage,
+                                    static_cast<double>(count),
+                                    static_cast<double>(dense_count)});
+  return rank_columns;
+}
+
+std::unique_ptr<column> rank(column_view const& input,
+                             rank_method method,
+                             order column_order,
+                             null_policy null_handling,
+                             null_order null_precedence,
+                             bool percentage,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr)
+{
+  return std::move(detail::rank(input,
+                                std::vector<rank_method>{method},
+                                column_order,
+                                null_handling,
+                                null_precedence,
+                                percentage,
+                                stream,
+                                mr)
+                     .front());
 }
 }  // namespace detail
 
+std::vector<std::unique_ptr<column>> rank(column_view const& input,
+                                          std::vector<rank_method> const& methods,
+                                          order column_order,
+                                          null_policy null_handling,
+                                          null_order null_precedence,
+                                          bool percentage,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::rank(input,
+                      methods,
+                      column_order,
+                      null_handling,
+                      null_precedence,
+                      percentage,
+                      rmm::cuda_stream_default,
+                      mr);
+}
+
 std::unique_ptr<column> rank(column_view const& input,
                              rank_method method,
                              order column_order,
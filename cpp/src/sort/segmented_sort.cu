@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,16 +14,27 @@
  * limitations under the License.
  */
 
+#include <sort/sort_impl.cuh>
+
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
 
+#include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <cub/device/device_segmented_sort.cuh>
+
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/extrema.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
 
 namespace cudf {
 namespace detail {
@@ -55,6 +66,78 @@ rmm::device_uvector<size_type> get_segment_indices(size_type num_rows,
   return segment_ids;
 }
 
+/**
+ * @brief Calls the stable or unstable `cub::DeviceSegmentedSort::SortPairs` with `args`.
+ */
+template <typename... Args>
+void segmented_sort_pairs(sort_method sorting, Args... args)
+{
+  if (sorting == sort_method::STABLE) {
+    cub::DeviceSegmentedSort::StableSortPairs(args...);
+  } else {
+    cub::DeviceSegmentedSort::SortPairs(args...);
+  }
+}
+
+/**
+ * @brief Sort indices of the rows of each segment by sorting their packed keys with
+ * `cub::DeviceSegmentedSort`.
+ *
+ * The segments are binned by size, so that small segments are sorted by a warp, medium ones by a
+ * block and large ones by a device-wide radix sort, whatever the skew of their sizes. The rows
+ * before the first offset and after the last one are sorted as two more segments.
+ */
+std::unique_ptr<column> packed_keys_segmented_sorted_order(
+  table_view const& keys,
+  column_view const& segment_offsets,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  sort_method sorting,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = keys.num_rows();
+  rmm::device_uvector<size_type> offsets(segment_offsets.size() + 2, stream);
+  offsets.set_element_to_zero_async(0, stream);
+  // Offsets out of the rows are clamped so that no segment reads past them
+  thrust::transform(rmm::exec_policy(stream),
+                    segment_offsets.begin<size_type>(),
+                    segment_offsets.end<size_type>(),
+                    offsets.begin() + 1,
+                    [num_rows] __device__(size_type offset) {
+                      return thrust::min(thrust::max(offset, 0), num_rows);
+                    });
+  offsets.set_element_async(offsets.size() - 1, num_rows, stream);
+  auto const num_segments = static_cast<int>(offsets.size() - 1);
+
+  auto const packed = make_packed_sort_keys(keys, column_order, null_precedence, stream);
+  rmm::device_uvector<uint64_t> sorted_keys(num_rows, stream);
+  rmm::device_uvector<size_type> indices(num_rows, stream);
+  thrust::sequence(rmm::exec_policy(stream), indices.begin(), indices.end(), 0);
+  auto result = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_rows, mask_state::UNALLOCATED, stream, mr);
+
+  std::size_t temp_storage_bytes = 0;
+  rmm::device_buffer d_temp_storage;
+  // The first call only computes the size of the temporary storage
+  for (auto pass = 0; pass < 2; ++pass) {
+    if (pass == 1) { d_temp_storage = rmm::device_buffer(temp_storage_bytes, stream); }
+    segmented_sort_pairs(sorting,
+                         d_temp_storage.data(),
+                         temp_storage_bytes,
+                         packed.data(),
+                         sorted_keys.data(),
+                         indices.data(),
+                         result->mutable_view().begin<size_type>(),
+                         num_rows,
+                         num_segments,
+                         offsets.data(),
+                         offsets.data() + 1,
+                         stream.value());
+  }
+  return result;
+}
+
 std::unique_ptr<column> segmented_sorted_order_common(
   table_view const& keys,
   column_view const& segment_offsets,
@@ -66,6 +149,20 @@ std::unique_ptr<column> segmented_sorted_order_common(
 {
   CUDF_EXPECTS(segment_offsets.type() == data_type(type_to_id<size_type>()),
                "segment offsets should be size_type");
+  CUDF_EXPECTS(column_order.empty() or
+                 static_cast<std::size_t>(keys.num_columns()) == column_order.size(),
+               "Mismatch between number of columns and column order.");
+  CUDF_EXPECTS(null_precedence.empty() or
+                 static_cast<std::size_t>(keys.num_columns()) == null_precedence.size(),
+               "Mismatch between number of columns and null_precedence size.");
+
+  // Keys of fixed-width columns packed into 64 bits are sorted segment by segment
+  if (keys.num_columns() > 0 and keys.num_rows() > 0 and can_use_packed_sort_keys(keys) and
+      packed_sort_key_bits(keys) <= 64) {
+    return packed_keys_segmented_sorted_order(
+      keys, segment_offsets, column_order, null_precedence, sorting, stream, mr);
+  }
+
   // Get segment id of each element in all segments.
   auto segment_ids = get_segment_indices(keys.num_rows(), segment_offsets, stream);
 
@@ -185,6 +282,49 @@ std::unique_ptr<table> stable_segmented_sort_by_key(table_view const& values,
     values, keys, segment_offsets, column_order, null_precedence, sort_method::STABLE, stream, mr);
 }
 
+std::unique_ptr<column> segmented_top_k(table_view const& keys,
+                                        column_view const& segment_offsets,
+                                        size_type k,
+                                        std::vector<order> const& column_order,
+                                        std::vector<null_order> const& null_precedence,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(k >= 0, "Number of rows k must not be negative");
+  auto const sorted = stable_segmented_sorted_order(keys,
+                                                    segment_offsets,
+                                                    column_order,
+                                                    null_precedence,
+                                                    stream,
+                                                    rmm::mr::get_current_device_resource());
+
+  // The segments come in order in the sorted indices, so that the row at a position of the
+  // sorted indices is in the segment of the row at that same position of the input
+  auto const segment_ids = get_segment_indices(keys.num_rows(), segment_offsets, stream);
+  auto const num_ids     = static_cast<size_type>(segment_offsets.size());
+  auto const is_selected = [segment_ids = segment_ids.data(),
+                            offsets     = segment_offsets.begin<size_type>(),
+                            num_ids,
+                            k] __device__(size_type position) {
+    // Rows before the first offset have id 0, and rows after the last one have id `num_ids`
+    auto const id = segment_ids[position];
+    return id > 0 and id < num_ids and position - offsets[id - 1] < k;
+  };
+
+  auto const positions    = thrust::make_counting_iterator<size_type>(0);
+  auto const num_selected = thrust::count_if(
+    rmm::exec_policy(stream), positions, positions + keys.num_rows(), is_selected);
+  auto result             = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_selected, mask_state::UNALLOCATED, stream, mr);
+  thrust::copy_if(rmm::exec_policy(stream),
+                  sorted->view().begin<size_type>(),
+                  sorted->view().end<size_type>(),
+                  positions,
+                  result->mutable_view().begin<size_type>(),
+                  is_selected);
+  return result;
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> segmented_sorted_order(table_view const& keys,
@@ -234,4 +374,16 @@ std::unique_ptr<table> stable_segmented_sort_by_key(table_view const& values,
     values, keys, segment_offsets, column_order, null_precedence, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> segmented_top_k(table_view const& keys,
+                                        column_view const& segment_offsets,
+                                        size_type k,
+                                        std::vector<order> const& column_order,
+                                        std::vector<null_order> const& null_precedence,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_top_k(
+    keys, segment_offsets, k, column_order, null_precedence, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
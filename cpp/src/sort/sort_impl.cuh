@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/structs/utilities.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/error.hpp>
@@ -80,32 +81,130 @@ std::unique_ptr<column> sorted_order(column_view const& input,
                                      rmm::mr::device_memory_resource* mr);
 
 /**
- * @copydoc
- * sorted_order(table_view&,std::vector<order>,std::vector<null_order>,rmm::mr::device_memory_resource*)
+ * @brief Stable sort indices of a strings column by a radix sort on its bytes.
  *
+ * The strings are radix sorted on a window of their first bytes, and the rows tied on a
+ * window are radix sorted again on the next one, until they are no longer tied or, after a few
+ * rounds, by comparing their strings.
+ *
+ * @param input Strings column to sort
+ * @param column_order Ascending or descending sort order
+ * @param null_precedence How null rows are to be ordered, reversed for descending order
  * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Sorted indices for the input column.
  */
-template <bool stable = false>
-std::unique_ptr<column> sorted_order(table_view input,
-                                     std::vector<order> const& column_order,
-                                     std::vector<null_order> const& null_precedence,
-                                     rmm::cuda_stream_view stream,
-                                     rmm::mr::device_memory_resource* mr)
-{
-  if (input.num_rows() == 0 or input.num_columns() == 0) {
-    return cudf::make_numeric_column(data_type(type_to_id<size_type>()), 0);
-  }
+std::unique_ptr<column> strings_sorted_order(column_view const& input,
+                                             order column_order,
+                                             null_order null_precedence,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr);
 
-  if (not column_order.empty()) {
-    CUDF_EXPECTS(static_cast<std::size_t>(input.num_columns()) == column_order.size(),
-                 "Mismatch between number of columns and column order.");
-  }
+/**
+ * @brief Returns whether the rows of `input` fit in the packed keys of `packed_keys_sorted_order`.
+ *
+ * The keys are made of the bits of the fixed-width columns of up to 64 bits, preceded by a null
+ * bit for the columns with nulls, and must be at most 128 bits long.
+ */
+bool can_use_packed_sort_keys(table_view const& input);
 
-  if (not null_precedence.empty()) {
-    CUDF_EXPECTS(static_cast<std::size_t>(input.num_columns()) == null_precedence.size(),
-                 "Mismatch between number of columns and null_precedence size.");
-  }
+/**
+ * @brief Returns the number of bits of the packed keys of the rows of `input`.
+ *
+ * @param input Table whose columns pass `can_use_packed_sort_keys`
+ */
+int packed_sort_key_bits(table_view const& input);
 
+/**
+ * @brief Returns the number of bits of the packed keys of the rows of `input`, with a null bit
+ * for the columns of set `null_bits`.
+ *
+ * @param input Table whose columns pass `can_use_packed_sort_keys`
+ * @param null_bits Whether the keys have a null bit for each column
+ */
+int packed_sort_key_bits(table_view const& input, std::vector<bool> const& null_bits);
+
+/**
+ * @brief Returns the packed keys of the rows of `input`, whose unsigned order is the
+ * lexicographic order of the rows.
+ *
+ * @throw cudf::logic_error if `can_use_packed_sort_keys(input)` is false or the keys are longer
+ * than 64 bits
+ *
+ * @param input Table to pack the rows of
+ * @param column_order Ascending or descending sort order of each column, ascending if empty
+ * @param null_precedence How null rows are to be ordered in each column, before if empty
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The keys, in their lowest `packed_sort_key_bits(input)` bits
+ */
+rmm::device_uvector<uint64_t> make_packed_sort_keys(table_view const& input,
+                                                    std::vector<order> const& column_order,
+                                                    std::vector<null_order> const& null_precedence,
+                                                    rmm::cuda_stream_view stream);
+
+/**
+ * @brief Returns the null bits of the packed keys of two tables of the same types to compare the
+ * rows of, set for the columns with nulls in either table.
+ */
+std::vector<bool> packed_search_null_bits(table_view const& lhs, table_view const& rhs);
+
+/**
+ * @brief Returns the packed keys of the rows of `input`, with a null bit for the columns of set
+ * `null_bits`.
+ *
+ * The keys of tables of the same types and `null_bits` compare as their rows, so that the keys
+ * of one table can be searched for those of another.
+ *
+ * @throw cudf::logic_error if a column with nulls has no null bit
+ *
+ * @param input Table to pack the rows of
+ * @param column_order Ascending or descending sort order of each column, ascending if empty
+ * @param null_precedence How null rows are to be ordered in each column, before if empty
+ * @param null_bits Whether the keys have a null bit for each column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The keys, in their lowest `packed_sort_key_bits(input, null_bits)` bits
+ */
+rmm::device_uvector<uint64_t> make_packed_sort_keys(table_view const& input,
+                                                    std::vector<order> const& column_order,
+                                                    std::vector<null_order> const& null_precedence,
+                                                    std::vector<bool> const& null_bits,
+                                                    rmm::cuda_stream_view stream);
+
+/**
+ * @brief Sort indices of the rows of a table by radix sorting their packed keys.
+ *
+ * The columns of a row are normalized to unsigned integers of the same order, inverted for the
+ * descending columns, and bit-packed with their null bits into a key whose unsigned order is the
+ * lexicographic order of the rows. The sort is stable.
+ *
+ * @throw cudf::logic_error if `can_use_packed_sort_keys(input)` is false
+ *
+ * @param input Table to sort
+ * @param column_order Ascending or descending sort order of each column, ascending if empty
+ * @param null_precedence How null rows are to be ordered in each column, before if empty
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Sorted indices for the input table.
+ */
+std::unique_ptr<column> packed_keys_sorted_order(table_view const& input,
+                                                 std::vector<order> const& column_order,
+                                                 std::vector<null_order> const& null_precedence,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Sorted indices of a table through the single column or packed keys fast paths, if
+ * either applies to its columns.
+ *
+ * @return Sorted indices for the input table, or nullptr if no fast path applies.
+ */
+template <bool stable>
+std::unique_ptr<column> fast_path_sorted_order(table_view const& input,
+                                               std::vector<order> const& column_order,
+                                               std::vector<null_order> const& null_precedence,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
   // fast-path for single column sort
   if (input.num_columns() == 1 and not cudf::is_nested(input.column(0).type())) {
     auto const single_col = input.column(0);
@@ -115,6 +214,41 @@ std::unique_ptr<column> sorted_order(table_view input,
                   : sorted_order<false>(single_col, col_order, null_prec, stream, mr);
   }
 
+  // Keys of several fixed-width columns are radix sorted once packed into integers
+  if (can_use_packed_sort_keys(input)) {
+    return packed_keys_sorted_order(input, column_order, null_precedence, stream, mr);
+  }
+
+  return nullptr;
+}
+
+/**
+ * @brief Sorted indices of keys already flattened and copied to the device.
+ *
+ * The fast paths still apply to the flattened columns, so that preprocessing keys shared with
+ * other operations never makes their sort slower. Dictionary keys are to be preprocessed as
+ * their `dictionary::detail::indices_view()`, since their keys are sorted.
+ *
+ * @param keys Preprocessed keys to sort
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Sorted indices for the keys.
+ */
+template <bool stable = false>
+std::unique_ptr<column> sorted_order(structs::detail::preprocessed_table const& keys,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  auto const input = keys.flattened_columns();
+  if (input.num_rows() == 0 or input.num_columns() == 0) {
+    return cudf::make_numeric_column(data_type(type_to_id<size_type>()), 0);
+  }
+
+  if (auto result =
+        fast_path_sorted_order<stable>(input, keys.orders(), keys.null_orders(), stream, mr)) {
+    return result;
+  }
+
   std::unique_ptr<column> sorted_indices = cudf::make_numeric_column(
     data_type(type_to_id<size_type>()), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
   mutable_column_view mutable_indices_view = sorted_indices->mutable_view();
@@ -123,16 +257,11 @@ std::unique_ptr<column> sorted_order(table_view input,
                    mutable_indices_view.end<size_type>(),
                    0);
 
-  auto flattened    = structs::detail::flatten_nested_columns(input, column_order, null_precedence);
-  auto device_table = table_device_view::create(flattened, stream);
-  auto const d_column_order = make_device_uvector_async(flattened.orders(), stream);
-
-  auto const d_null_precedence = make_device_uvector_async(flattened.null_orders(), stream);
-  auto const comparator = row_lexicographic_comparator(nullate::DYNAMIC{has_nulls(flattened)},
-                                                       *device_table,
-                                                       *device_table,
-                                                       d_column_order.data(),
-                                                       d_null_precedence.data());
+  auto const comparator = row_lexicographic_comparator(nullate::DYNAMIC{keys.has_nulls()},
+                                                       keys.device_view(),
+                                                       keys.device_view(),
+                                                       keys.d_column_order(),
+                                                       keys.d_null_precedence());
   if (stable) {
     thrust::stable_sort(rmm::exec_policy(stream),
                         mutable_indices_view.begin<size_type>(),
@@ -144,7 +273,53 @@ std::unique_ptr<column> sorted_order(table_view input,
                  mutable_indices_view.end<size_type>(),
                  comparator);
   }
-  // protection for temporary d_column_order and d_null_precedence
+
+  return sorted_indices;
+}
+
+/**
+ * @copydoc
+ * sorted_order(table_view&,std::vector<order>,std::vector<null_order>,rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+template <bool stable = false>
+std::unique_ptr<column> sorted_order(table_view input,
+                                     std::vector<order> const& column_order,
+                                     std::vector<null_order> const& null_precedence,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  if (input.num_rows() == 0 or input.num_columns() == 0) {
+    return cudf::make_numeric_column(data_type(type_to_id<size_type>()), 0);
+  }
+
+  if (not column_order.empty()) {
+    CUDF_EXPECTS(static_cast<std::size_t>(input.num_columns()) == column_order.size(),
+                 "Mismatch between number of columns and column order.");
+  }
+
+  if (not null_precedence.empty()) {
+    CUDF_EXPECTS(static_cast<std::size_t>(input.num_columns()) == null_precedence.size(),
+                 "Mismatch between number of columns and null_precedence size.");
+  }
+
+  // Dictionary columns are ordered by their indices, since their keys are sorted
+  input = dictionary::detail::indices_view(input);
+
+  if (auto result =
+        fast_path_sorted_order<stable>(input, column_order, null_precedence, stream, mr)) {
+    return result;
+  }
+
+  auto const keys =
+    structs::detail::preprocessed_table::create(input,
+                                                column_order,
+                                                null_precedence,
+                                                structs::detail::column_nullability::MATCH_INCOMING,
+                                                stream);
+  auto sorted_indices = sorted_order<stable>(*keys, stream, mr);
+  // protection for the temporary preprocessed keys
   stream.synchronize();
 
   return sorted_indices;
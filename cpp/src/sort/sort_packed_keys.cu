@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sort/sort_impl.cuh>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/utilities/assert.cuh>
+#include <cudf/detail/utilities/temporary_arena.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cub/device/device_radix_sort.cuh>
+
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+
+#include <algorithm>
+#include <limits>
+#include <iterator>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Largest number of bits of the packed keys of a row.
+ */
+constexpr int max_packed_key_bits = 128;
+
+/**
+ * @brief Layout of the bits of a column in the packed keys.
+ */
+struct packed_column_info {
+  int width;        ///< Number of bits of the values
+  bool nullable;    ///< Whether a null bit precedes the bits of the values
+  bool descending;  ///< Whether the bits of the values are inverted
+  bool null_bit;    ///< Value of the null bit of the null rows
+};
+
+/**
+ * @brief Returns the number of bits of the values of a column in the packed keys.
+ */
+int packed_value_width(data_type type)
+{
+  return type.id() == type_id::BOOL8 ? 1 : static_cast<int>(cudf::size_of(type) * 8);
+}
+
+/**
+ * @brief Device functor mapping an element to an unsigned integer of the same order.
+ *
+ * Signed integers have their sign bit flipped, and floating point values are mapped so that
+ * `-0.0` equals `0.0` and all the `NaN`s are equal and larger than any other value, as in
+ * `relational_compare`.
+ */
+struct normalize_element_fn {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return (cudf::is_numeric<T>() or cudf::is_chrono<T>()) and sizeof(T) <= sizeof(uint64_t);
+  }
+
+  template <typename T, CUDF_ENABLE_IF(is_supported<T>())>
+  __device__ uint64_t operator()(column_device_view const& col, size_type row) const
+  {
+    if constexpr (cudf::is_chrono<T>()) {
+      using Rep = typename T::rep;
+      return normalize<Rep>(col.element<T>(row).time_since_epoch().count());
+    } else {
+      return normalize<T>(col.element<T>(row));
+    }
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not is_supported<T>())>
+  __device__ uint64_t operator()(column_device_view const&, size_type) const
+  {
+    cudf_assert(false && "Unsupported type for packed sort keys.");
+    return 0;
+  }
+
+ private:
+  template <typename T>
+  __device__ static uint64_t normalize(T value)
+  {
+    if constexpr (std::is_same_v<T, bool>) {
+      return value ? 1 : 0;
+    } else if constexpr (std::is_floating_point_v<T>) {
+      using U             = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+      constexpr U sign    = U{1} << (sizeof(U) * 8 - 1);
+      if (isnan(value)) { return std::numeric_limits<U>::max(); }
+      U bits = 0;
+      if (value != T{0}) { memcpy(&bits, &value, sizeof(U)); }
+      return (bits & sign) ? static_cast<U>(~bits) : static_cast<U>(bits | sign);
+    } else if constexpr (std::is_signed_v<T>) {
+      using U = std::make_unsigned_t<T>;
+      return static_cast<U>(static_cast<U>(value) ^ (U{1} << (sizeof(U) * 8 - 1)));
+    } else {
+      return value;
+    }
+  }
+};
+
+/**
+ * @brief Device functor packing the columns of a row into a key of up to 128 bits, whose
+ * unsigned order is the lexicographic order of the rows.
+ *
+ * The lower 64 bits of the key go to `lower` and, when not null, the upper ones to `upper`.
+ */
+template <typename KeyT>
+struct pack_keys_fn {
+  table_device_view input;
+  packed_column_info const* infos;
+  KeyT* lower;
+  uint64_t* upper;
+
+  __device__ void operator()(size_type row) const
+  {
+    __uint128_t key = 0;
+    for (size_type c = 0; c < input.num_columns(); ++c) {
+      auto const info    = infos[c];
+      auto const col     = input.column(c);
+      auto const is_null = info.nullable and col.is_null(row);
+      if (info.nullable) { key = (key << 1) | (is_null == info.null_bit ? 1 : 0); }
+      uint64_t value = 0;
+      if (not is_null) {
+        value = type_dispatcher<dispatch_storage_type>(
+          col.type(), normalize_element_fn{}, col, row);
+        if (info.descending) {
+          auto const mask = info.width == 64 ? ~uint64_t{0} : (uint64_t{1} << info.width) - 1;
+          value           = ~value & mask;
+        }
+      }
+      key = (key << info.width) | value;
+    }
+    lower[row] = static_cast<KeyT>(key);
+    if (upper != nullptr) { upper[row] = static_cast<uint64_t>(key >> 64); }
+  }
+};
+
+/**
+ * @brief Stable radix sort of `indices` by the lowest `num_bits` bits of `keys`, into
+ * `sorted_indices`, with the scratch space allocated from `temp_mr`.
+ */
+template <typename KeyT>
+void radix_sort_indices(rmm::device_uvector<KeyT> const& keys,
+                        size_type const* indices,
+                        size_type* sorted_indices,
+                        int num_bits,
+                        rmm::cuda_stream_view stream,
+                        rmm::mr::device_memory_resource* temp_mr)
+{
+  auto const num_items = static_cast<int>(keys.size());
+  rmm::device_uvector<KeyT> sorted_keys(keys.size(), stream, temp_mr);
+  std::size_t temp_storage_bytes = 0;
+  cub::DeviceRadixSort::SortPairs(nullptr,
+                                  temp_storage_bytes,
+                                  keys.data(),
+                                  sorted_keys.data(),
+                                  indices,
+                                  sorted_indices,
+                                  num_items,
+                                  0,
+                                  num_bits,
+                                  stream.value());
+  rmm::device_buffer d_temp_storage(temp_storage_bytes, stream, temp_mr);
+  cub::DeviceRadixSort::SortPairs(d_temp_storage.data(),
+                                  temp_storage_bytes,
+                                  keys.data(),
+                                  sorted_keys.data(),
+                                  indices,
+                                  sorted_indices,
+                                  num_items,
+                                  0,
+                                  num_bits,
+                                  stream.value());
+}
+
+/**
+ * @brief Returns whether each column of `input` has nulls.
+ */
+std::vector<bool> columns_with_nulls(table_view const& input)
+{
+  std::vector<bool> null_bits;
+  std::transform(input.begin(), input.end(), std::back_inserter(null_bits), [](auto const& col) {
+    return col.has_nulls();
+  });
+  return null_bits;
+}
+
+/**
+ * @brief Returns the layout of the columns of `input` in the packed keys.
+ */
+std::vector<packed_column_info> make_packed_column_infos(
+  table_view const& input,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  std::vector<bool> const& null_bits)
+{
+  std::vector<packed_column_info> infos;
+  for (size_type c = 0; c < input.num_columns(); ++c) {
+    auto const descending = not column_order.empty() and column_order[c] == order::DESCENDING;
+    auto const nulls_after =
+      not null_precedence.empty() and null_precedence[c] == null_order::AFTER;
+    // The null order is reversed with the order of the values, as by `row_lexicographic_comparator`
+    infos.push_back({packed_value_width(input.column(c).type()),
+                     null_bits[c],
+                     descending,
+                     nulls_after != descending});
+  }
+  return infos;
+}
+
+}  // namespace
+
+bool can_use_packed_sort_keys(table_view const& input)
+{
+  auto const packable = [](column_view const& col) {
+    return cudf::is_fixed_width(col.type()) and cudf::size_of(col.type()) <= sizeof(uint64_t);
+  };
+  return std::all_of(input.begin(), input.end(), packable) and
+         packed_sort_key_bits(input) <= max_packed_key_bits;
+}
+
+int packed_sort_key_bits(table_view const& input)
+{
+  return packed_sort_key_bits(input, columns_with_nulls(input));
+}
+
+int packed_sort_key_bits(table_view const& input, std::vector<bool> const& null_bits)
+{
+  auto num_bits = 0;
+  for (size_type c = 0; c < input.num_columns(); ++c) {
+    num_bits += packed_value_width(input.column(c).type()) + (null_bits[c] ? 1 : 0);
+  }
+  return num_bits;
+}
+
+std::vector<bool> packed_search_null_bits(table_view const& lhs, table_view const& rhs)
+{
+  std::vector<bool> null_bits;
+  std::transform(lhs.begin(),
+                 lhs.end(),
+                 rhs.begin(),
+                 std::back_inserter(null_bits),
+                 [](auto const& lhs_col, auto const& rhs_col) {
+                   return lhs_col.has_nulls() or rhs_col.has_nulls();
+                 });
+  return null_bits;
+}
+
+rmm::device_uvector<uint64_t> make_packed_sort_keys(table_view const& input,
+                                                    std::vector<order> const& column_order,
+                                                    std::vector<null_order> const& null_precedence,
+                                                    rmm::cuda_stream_view stream)
+{
+  return make_packed_sort_keys(
+    input, column_order, null_precedence, columns_with_nulls(input), stream);
+}
+
+rmm::device_uvector<uint64_t> make_packed_sort_keys(table_view const& input,
+                                                    std::vector<order> const& column_order,
+                                                    std::vector<null_order> const& null_precedence,
+                                                    std::vector<bool> const& null_bits,
+                                                    rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(can_use_packed_sort_keys(input) and packed_sort_key_bits(input, null_bits) <= 64,
+               "Sort keys do not fit in 64-bit packed keys");
+  for (size_type c = 0; c < input.num_columns(); ++c) {
+    CUDF_EXPECTS(null_bits[c] or not input.column(c).has_nulls(),
+                 "Packed keys of a column with nulls require a null bit");
+  }
+  auto const d_input = table_device_view::create(input, stream);
+  auto const infos   = make_packed_column_infos(input, column_order, null_precedence, null_bits);
+  auto const d_infos = make_device_uvector_async(infos, stream);
+  rmm::device_uvector<uint64_t> keys(input.num_rows(), stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator(0),
+                     input.num_rows(),
+                     pack_keys_fn<uint64_t>{*d_input, d_infos.data(), keys.data(), nullptr});
+  return keys;
+}
+
+std::unique_ptr<column> packed_keys_sorted_order(table_view const& input,
+                                                 std::vector<order> const& column_order,
+                                                 std::vector<null_order> const& null_precedence,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(can_use_packed_sort_keys(input), "Sort keys do not fit in packed keys");
+  auto const num_bits = packed_sort_key_bits(input);
+  auto const infos =
+    make_packed_column_infos(input, column_order, null_precedence, columns_with_nulls(input));
+
+  auto const num_rows = input.num_rows();
+  // The indices, keys and sort scratch space of the common case fit in the first block
+  temporary_arena temp_mr{
+    stream,
+    std::max(temporary_arena::default_block_size,
+             static_cast<std::size_t>(num_rows) * (sizeof(size_type) + 2 * sizeof(uint64_t)))};
+  auto const d_input = table_device_view::create(input, stream);
+  auto const d_infos = make_device_uvector_async(infos, stream, &temp_mr);
+
+  auto sorted_indices = cudf::make_numeric_column(
+    data_type(type_to_id<size_type>()), num_rows, mask_state::UNALLOCATED, stream, mr);
+  auto const out = sorted_indices->mutable_view().data<size_type>();
+  rmm::device_uvector<size_type> indices(num_rows, stream, &temp_mr);
+  thrust::sequence(rmm::exec_policy(stream), indices.begin(), indices.end(), 0);
+
+  auto pack_and_sort = [&](auto key) {
+    using KeyT = decltype(key);
+    rmm::device_uvector<KeyT> keys(num_rows, stream, &temp_mr);
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator(0),
+                       num_rows,
+                       pack_keys_fn<KeyT>{*d_input, d_infos.data(), keys.data(), nullptr});
+    radix_sort_indices(keys, indices.data(), out, num_bits, stream, &temp_mr);
+  };
+
+  if (num_bits <= 32) {
+    pack_and_sort(uint32_t{});
+  } else if (num_bits <= 64) {
+    pack_and_sort(uint64_t{});
+  } else {
+    // The stable sort by the upper bits keeps the order of the sort by the lower bits for the
+    // rows of equal upper bits
+    rmm::device_uvector<uint64_t> lower(num_rows, stream, &temp_mr);
+    rmm::device_uvector<uint64_t> upper(num_rows, stream, &temp_mr);
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator(0),
+      num_rows,
+      pack_keys_fn<uint64_t>{*d_input, d_infos.data(), lower.data(), upper.data()});
+
+    rmm::device_uvector<size_type> lower_order(num_rows, stream, &temp_mr);
+    radix_sort_indices(lower, indices.data(), lower_order.data(), 64, stream, &temp_mr);
+    // The upper bits in the order of the lower bits reuse the storage of the lower bits
+    auto& ordered_upper = lower;
+    thrust::gather(rmm::exec_policy(stream),
+                   lower_order.begin(),
+                   lower_order.end(),
+                   upper.begin(),
+                   ordered_upper.begin());
+    radix_sort_indices(ordered_upper, lower_order.data(), out, num_bits - 64, stream, &temp_mr);
+  }
+  return sorted_indices;
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sort/sort_impl.cuh>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/strings/string_view.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cub/device/device_radix_sort.cuh>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Number of bytes of the strings in the key of each round of the radix sort.
+ */
+constexpr size_type window_bytes = 7;
+
+/**
+ * @brief Number of rounds of the radix sort before the rows still tied are sorted by comparing
+ * their strings.
+ */
+constexpr int max_radix_rounds = 4;
+
+/**
+ * @brief Device functor returning the radix sort key of a string for the round whose window
+ * starts at byte `offset`.
+ *
+ * The key is made of the `window_bytes` bytes of the window, padded with zeros, followed by the
+ * number of bytes from the window on, capped at `window_bytes + 1`. Strings of different keys
+ * compare as their keys, and strings of equal keys are equal unless they both go on past the
+ * window.
+ */
+struct window_key_fn {
+  column_device_view const d_strings;
+  size_type const* rows;
+  size_type offset;
+  bool descending;
+
+  __device__ uint64_t operator()(size_type i) const
+  {
+    auto const d_str     = d_strings.element<string_view>(rows[i]);
+    auto const bytes     = reinterpret_cast<uint8_t const*>(d_str.data()) + offset;
+    auto const remaining = d_str.size_bytes() - offset;
+    uint64_t key         = 0;
+    for (size_type b = 0; b < window_bytes; ++b) {
+      key = (key << 8) | (b < remaining ? bytes[b] : 0);
+    }
+    auto const length = remaining < 0 ? 0 : thrust::min(remaining, window_bytes + 1);
+    key               = (key << 8) | static_cast<uint64_t>(length);
+    return descending ? ~key : key;
+  }
+};
+
+/**
+ * @brief Device functor returning whether the `i`-th row in sorted order has the same key and
+ * segment as the previous row.
+ */
+struct same_as_previous_fn {
+  uint64_t const* keys;
+  size_type const* segments;
+  size_type const* permutation;  ///< The sorted order of the keys and segments
+
+  __device__ bool operator()(size_type i) const
+  {
+    return i > 0 and keys[permutation[i]] == keys[permutation[i - 1]] and
+           segments[permutation[i]] == segments[permutation[i - 1]];
+  }
+};
+
+/**
+ * @brief Device functor returning whether the `i`-th row in sorted order is tied with another
+ * row of its segment, and has bytes past the window to be sorted by in the next round.
+ */
+struct is_tied_fn {
+  same_as_previous_fn same_as_previous;
+  column_device_view const d_strings;
+  size_type const* rows;
+  size_type const* permutation;
+  size_type num_rows;
+  size_type offset;
+
+  __device__ bool operator()(size_type i) const
+  {
+    auto const d_str = d_strings.element<string_view>(rows[permutation[i]]);
+    return (same_as_previous(i) or (i + 1 < num_rows and same_as_previous(i + 1))) and
+           d_str.size_bytes() - offset > window_bytes;
+  }
+};
+
+/**
+ * @brief Stable radix sort of the `[0, num_items)` indices by the lowest `num_bits` bits of
+ * `keys`, into `sorted_indices`.
+ */
+template <typename KeyT>
+void radix_sorted_indices(KeyT const* keys,
+                          size_type* sorted_indices,
+                          size_type num_items,
+                          int num_bits,
+                          rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<size_type> indices(num_items, stream);
+  thrust::sequence(rmm::exec_policy(stream), indices.begin(), indices.end(), 0);
+  rmm::device_uvector<KeyT> sorted_keys(num_items, stream);
+  std::size_t temp_storage_bytes = 0;
+  cub::DeviceRadixSort::SortPairs(nullptr,
+                                  temp_storage_bytes,
+                                  keys,
+                                  sorted_keys.data(),
+                                  indices.data(),
+                                  sorted_indices,
+                                  num_items,
+                                  0,
+                                  num_bits,
+                                  stream.value());
+  rmm::device_buffer d_temp_storage(temp_storage_bytes, stream);
+  cub::DeviceRadixSort::SortPairs(d_temp_storage.data(),
+                                  temp_storage_bytes,
+                                  keys,
+                                  sorted_keys.data(),
+                                  indices.data(),
+                                  sorted_indices,
+                                  num_items,
+                                  0,
+                                  num_bits,
+                                  stream.value());
+}
+
+}  // namespace
+
+std::unique_ptr<column> strings_sorted_order(column_view const& input,
+                                             order column_order,
+                                             null_order null_precedence,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  auto sorted_indices = cudf::make_numeric_column(
+    data_type(type_to_id<size_type>()), input.size(), mask_state::UNALLOCATED, stream, mr);
+  if (input.is_empty()) { return sorted_indices; }
+
+  auto const d_strings  = column_device_view::create(input, stream);
+  auto const descending = column_order == order::DESCENDING;
+  // The null order is reversed for descending order, as by `simple_comparator`
+  auto const nulls_first = (null_precedence == null_order::BEFORE) != descending;
+  auto const num_valid   = input.size() - input.null_count();
+
+  // The null rows are placed as they come, and the others are sorted in place
+  auto const out       = sorted_indices->mutable_view().begin<size_type>();
+  auto const valid_out = out + (nulls_first ? input.null_count() : 0);
+  auto const all_rows  = thrust::make_counting_iterator<size_type>(0);
+  auto const is_valid  = [d_strings = *d_strings] __device__(size_type row) {
+    return d_strings.is_valid(row);
+  };
+  thrust::copy_if(
+    rmm::exec_policy(stream), all_rows, all_rows + input.size(), valid_out, is_valid);
+  if (input.has_nulls()) {
+    thrust::copy_if(rmm::exec_policy(stream),
+                    all_rows,
+                    all_rows + input.size(),
+                    out + (nulls_first ? 0 : num_valid),
+                    [is_valid] __device__(size_type row) { return not is_valid(row); });
+  }
+
+  // Each round sorts the rows at the `active` positions of `valid_out` within their segment of
+  // rows tied by the previous rounds, given by the position of its first row
+  rmm::device_uvector<size_type> active(num_valid, stream);
+  rmm::device_uvector<size_type> segments(num_valid, stream);
+  thrust::sequence(rmm::exec_policy(stream), active.begin(), active.end(), 0);
+  thrust::fill(rmm::exec_policy(stream), segments.begin(), segments.end(), 0);
+
+  for (auto round = 0; not active.is_empty(); ++round) {
+    auto const num_active = static_cast<size_type>(active.size());
+    auto const offset     = round * window_bytes;
+    auto const positions  = thrust::make_counting_iterator<size_type>(0);
+    rmm::device_uvector<size_type> rows(num_active, stream);
+    thrust::gather(
+      rmm::exec_policy(stream), active.begin(), active.end(), valid_out, rows.begin());
+
+    // The sorted order of the active rows, as indices into `rows`
+    rmm::device_uvector<size_type> permutation(num_active, stream);
+    rmm::device_uvector<size_type> next_active(0, stream);
+    rmm::device_uvector<size_type> next_segments(0, stream);
+    if (round == max_radix_rounds) {
+      thrust::sequence(rmm::exec_policy(stream), permutation.begin(), permutation.end(), 0);
+      thrust::stable_sort(
+        rmm::exec_policy(stream),
+        permutation.begin(),
+        permutation.end(),
+        [d_strings = *d_strings,
+         rows      = rows.data(),
+         segments  = segments.data(),
+         descending] __device__(size_type lhs, size_type rhs) {
+          if (segments[lhs] != segments[rhs]) { return segments[lhs] < segments[rhs]; }
+          auto const result = d_strings.element<string_view>(rows[lhs]).compare(
+            d_strings.element<string_view>(rows[rhs]));
+          return descending ? result > 0 : result < 0;
+        });
+    } else {
+      rmm::device_uvector<uint64_t> keys(num_active, stream);
+      thrust::transform(rmm::exec_policy(stream),
+                        positions,
+                        positions + num_active,
+                        keys.begin(),
+                        window_key_fn{*d_strings, rows.data(), offset, descending});
+      radix_sorted_indices(keys.data(), permutation.data(), num_active, 64, stream);
+      if (round > 0) {
+        // The stable sort by segment keeps the order of the keys within each segment
+        rmm::device_uvector<size_type> sorted_segments(num_active, stream);
+        thrust::gather(rmm::exec_policy(stream),
+                       permutation.begin(),
+                       permutation.end(),
+                       segments.begin(),
+                       sorted_segments.begin());
+        rmm::device_uvector<size_type> segment_order(num_active, stream);
+        radix_sorted_indices(sorted_segments.data(), segment_order.data(), num_active, 32, stream);
+        thrust::gather(rmm::exec_policy(stream),
+                       segment_order.begin(),
+                       segment_order.end(),
+                       permutation.begin(),
+                       sorted_segments.begin());
+        permutation = std::move(sorted_segments);
+      }
+
+      auto const same_as_previous =
+        same_as_previous_fn{keys.data(), segments.data(), permutation.data()};
+      auto const is_tied = is_tied_fn{
+        same_as_previous, *d_strings, rows.data(), permutation.data(), num_active, offset};
+      rmm::device_uvector<size_type> run_starts(num_active, stream);
+      thrust::transform_inclusive_scan(
+        rmm::exec_policy(stream),
+        positions,
+        positions + num_active,
+        run_starts.begin(),
+        [same_as_previous] __device__(size_type i) { return same_as_previous(i) ? 0 : i; },
+        thrust::maximum<size_type>{});
+
+      auto const num_tied = thrust::count_if(
+        rmm::exec_policy(stream), positions, positions + num_active, is_tied);
+      next_active.resize(num_tied, stream);
+      next_segments.resize(num_tied, stream);
+      thrust::copy_if(rmm::exec_policy(stream),
+                      active.begin(),
+                      active.end(),
+                      positions,
+                      next_active.begin(),
+                      is_tied);
+      auto const run_start_positions = thrust::make_transform_iterator(
+        run_starts.begin(),
+        [active = active.data()] __device__(size_type start) { return active[start]; });
+      thrust::copy_if(rmm::exec_policy(stream),
+                      run_start_positions,
+                      run_start_positions + num_active,
+                      positions,
+                      next_segments.begin(),
+                      is_tied);
+    }
+
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       positions,
+                       num_active,
+                       [valid_out,
+                        active      = active.data(),
+                        rows        = rows.data(),
+                        permutation = permutation.data()] __device__(size_type i) {
+                         valid_out[active[i]] = rows[permutation[i]];
+                       });
+    active   = std::move(next_active);
+    segments = std::move(next_segments);
+  }
+  return sorted_indices;
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sort/sort_impl.cuh>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cub/device/device_histogram.cuh>
+
+#include <thrust/copy.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/sort.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Number of bits of the digits of the radix select.
+ */
+constexpr int radix_bits = 8;
+
+/**
+ * @brief Number of values of the digits of the radix select.
+ */
+constexpr int num_buckets = 1 << radix_bits;
+
+/**
+ * @brief The bits of a row selected by the previous passes of the radix select, in its packed
+ * key followed by its index.
+ */
+struct select_prefix {
+  uint64_t key_bits;    ///< Selected bits of the packed key
+  uint64_t key_mask;    ///< Mask of the selected bits of the packed key
+  uint32_t index_bits;  ///< Selected bits of the index
+  uint32_t index_mask;  ///< Mask of the selected bits of the index
+};
+
+/**
+ * @brief Device functor returning the digit of a row in a pass of the radix select, or
+ * `num_buckets` when the row does not match the prefix selected by the previous passes.
+ */
+struct select_digit_fn {
+  uint64_t const* keys;
+  select_prefix prefix;
+  bool on_index;  ///< Whether the digit is one of the index rather than of the packed key
+  int shift;
+
+  __device__ int operator()(size_type row) const
+  {
+    auto const index = static_cast<uint32_t>(row);
+    if ((keys[row] & prefix.key_mask) != prefix.key_bits or
+        (index & prefix.index_mask) != prefix.index_bits) {
+      return num_buckets;
+    }
+    auto const bits = on_index ? static_cast<uint64_t>(index) : keys[row];
+    return static_cast<int>((bits >> shift) & (num_buckets - 1));
+  }
+};
+
+/**
+ * @brief Device functor returning whether a row is one of the `k` smallest, which are those whose
+ * packed key followed by its index is not larger than those of the `k`-th smallest row.
+ */
+struct is_selected_fn {
+  uint64_t const* keys;
+  uint64_t last_key;
+  uint32_t last_index;
+
+  __device__ bool operator()(size_type row) const
+  {
+    return keys[row] < last_key or
+           (keys[row] == last_key and static_cast<uint32_t>(row) <= last_index);
+  }
+};
+
+/**
+ * @brief Returns the mask of the bits of a value above its lowest `num_bits` bits.
+ */
+template <typename T>
+T upper_bits_mask(int num_bits)
+{
+  return num_bits >= static_cast<int>(sizeof(T) * 8) ? T{0} : ~((T{1} << num_bits) - 1);
+}
+
+/**
+ * @brief Runs the passes of the radix select over the digits of `keys` and of the row indices,
+ * most significant first, and returns the prefix of the `k`-th smallest row.
+ *
+ * The `k`-th smallest row is the largest of the rows matching the returned prefix, so that the
+ * `k` smallest rows are those not larger than the prefix with all its other bits set.
+ */
+select_prefix radix_select(rmm::device_uvector<uint64_t> const& keys,
+                           int key_bits,
+                           size_type k,
+                           rmm::cuda_stream_view stream)
+{
+  auto const num_rows = static_cast<size_type>(keys.size());
+  int index_bits      = 1;
+  while ((int64_t{1} << index_bits) < num_rows) {
+    ++index_bits;
+  }
+  key_bits   = util::round_up_safe(key_bits, radix_bits);
+  index_bits = util::round_up_safe(index_bits, radix_bits);
+  // The bits above those of the keys and of the indices are zero in all the rows
+  select_prefix prefix{
+    0, upper_bits_mask<uint64_t>(key_bits), 0, upper_bits_mask<uint32_t>(index_bits)};
+
+  rmm::device_uvector<int> histogram(num_buckets, stream);
+  rmm::device_buffer d_temp_storage;
+  auto remaining = k;  // Rank of the k-th row among the rows matching the prefix
+  for (auto pass = 0; pass < (key_bits + index_bits) / radix_bits; ++pass) {
+    auto const on_index = pass * radix_bits >= key_bits;
+    auto const shift    = (on_index ? key_bits + index_bits : key_bits) - (pass + 1) * radix_bits;
+    auto const digits   = thrust::make_transform_iterator(
+      thrust::make_counting_iterator(0), select_digit_fn{keys.data(), prefix, on_index, shift});
+
+    std::size_t temp_storage_bytes = 0;
+    cub::DeviceHistogram::HistogramEven(nullptr,
+                                        temp_storage_bytes,
+                                        digits,
+                                        histogram.data(),
+                                        num_buckets + 1,
+                                        0,
+                                        num_buckets,
+                                        num_rows,
+                                        stream.value());
+    if (temp_storage_bytes > d_temp_storage.size()) {
+      d_temp_storage = rmm::device_buffer(temp_storage_bytes, stream);
+    }
+    cub::DeviceHistogram::HistogramEven(d_temp_storage.data(),
+                                        temp_storage_bytes,
+                                        digits,
+                                        histogram.data(),
+                                        num_buckets + 1,
+                                        0,
+                                        num_buckets,
+                                        num_rows,
+                                        stream.value());
+    auto const h_histogram = make_std_vector_sync(histogram, stream);
+
+    // The digit of the k-th row, and its rank among the rows of that digit
+    auto digit = 0;
+    while (remaining > h_histogram[digit]) {
+      remaining -= h_histogram[digit++];
+    }
+    if (on_index) {
+      prefix.index_bits |= static_cast<uint32_t>(digit) << shift;
+      prefix.index_mask |= static_cast<uint32_t>(num_buckets - 1) << shift;
+    } else {
+      prefix.key_bits |= static_cast<uint64_t>(digit) << shift;
+      prefix.key_mask |= static_cast<uint64_t>(num_buckets - 1) << shift;
+    }
+    // The k-th row is the last one of its digit, so that all the rows of its prefix are selected
+    if (remaining == h_histogram[digit]) { break; }
+  }
+  return prefix;
+}
+
+}  // namespace
+
+std::unique_ptr<column> top_k(table_view const& keys,
+                              size_type k,
+                              std::vector<order> const& column_order,
+                              std::vector<null_order> const& null_precedence,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(k >= 0, "Number of rows k must not be negative");
+  if (not column_order.empty()) {
+    CUDF_EXPECTS(static_cast<std::size_t>(keys.num_columns()) == column_order.size(),
+                 "Mismatch between number of columns and column order.");
+  }
+  if (not null_precedence.empty()) {
+    CUDF_EXPECTS(static_cast<std::size_t>(keys.num_columns()) == null_precedence.size(),
+                 "Mismatch between number of columns and null_precedence size.");
+  }
+  if (k >= keys.num_rows() or keys.num_columns() == 0) {
+    return stable_sorted_order(keys, column_order, null_precedence, stream, mr);
+  }
+  if (k == 0) { return make_empty_column(data_type{type_to_id<size_type>()}); }
+
+  if (not can_use_packed_sort_keys(keys) or packed_sort_key_bits(keys) > 64) {
+    auto const sorted = stable_sorted_order(keys, column_order, null_precedence, stream);
+    return std::make_unique<column>(cudf::slice(sorted->view(), {0, k}).front(), stream, mr);
+  }
+
+  auto const packed = make_packed_sort_keys(keys, column_order, null_precedence, stream);
+  auto const prefix = radix_select(packed, packed_sort_key_bits(keys), k, stream);
+
+  auto result = make_numeric_column(
+    data_type{type_to_id<size_type>()}, k, mask_state::UNALLOCATED, stream, mr);
+  auto const indices = result->mutable_view().begin<size_type>();
+  thrust::copy_if(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator(0),
+                  thrust::make_counting_iterator(keys.num_rows()),
+                  indices,
+                  is_selected_fn{packed.data(),
+                                 prefix.key_bits | ~prefix.key_mask,
+                                 prefix.index_bits | ~prefix.index_mask});
+
+  // The selected rows are in the order of their indices, which the stable sort keeps for ties
+  rmm::device_uvector<uint64_t> selected_keys(k, stream);
+  thrust::gather(
+    rmm::exec_policy(stream), indices, indices + k, packed.begin(), selected_keys.begin());
+  thrust::stable_sort_by_key(
+    rmm::exec_policy(stream), selected_keys.begin(), selected_keys.end(), indices);
+  return result;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> top_k(table_view const& keys,
+                              size_type k,
+                              std::vector<order> const& column_order,
+                              std::vector<null_order> const& null_precedence,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::top_k(keys, k, column_order, null_precedence, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/spill.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/detail/error.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <thrust/host_vector.h>
+#include <thrust/system/cuda/experimental/pinned_allocator.h>
+
+#include <list>
+#include <mutex>
+#include <utility>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Packed table registered with a `spill_manager`.
+ *
+ * The `ready` event is recorded after the last work that reads or writes the device or host data,
+ * so that a copy between the two, or freeing either, can be ordered after it on any stream.
+ */
+struct spill_entry {
+  using pinned_buffer =
+    thrust::host_vector<uint8_t, thrust::system::cuda::experimental::pinned_allocator<uint8_t>>;
+
+  std::unique_ptr<packed_columns::metadata> metadata;
+  std::unique_ptr<rmm::device_buffer> device_data;  // null while the table is spilled
+  pinned_buffer host_data;
+  bool has_host_copy{false};
+  std::size_t const size;
+  int lock_count{0};
+  cudaEvent_t ready{};
+  rmm::mr::device_memory_resource* const mr;
+  std::list<spill_entry>::iterator position;
+
+  spill_entry(packed_columns&& input, rmm::mr::device_memory_resource* mr)
+    : metadata{std::move(input.metadata_)},
+      device_data{std::move(input.gpu_data)},
+      size{device_data->size()},
+      mr{mr}
+  {
+    CUDA_TRY(cudaEventCreateWithFlags(&ready, cudaEventDisableTiming));
+  }
+
+  spill_entry(spill_entry const&) = delete;
+  spill_entry& operator=(spill_entry const&) = delete;
+
+  ~spill_entry()
+  {
+    // The copies in flight must be done before the buffers are freed
+    cudaEventSynchronize(ready);
+    cudaEventDestroy(ready);
+  }
+};
+
+}  // namespace detail
+
+struct spill_manager::spill_manager_impl {
+  // The manager may be re-entered by a `spilling_resource_adaptor` allocating for one of its calls
+  mutable std::recursive_mutex _mutex;
+  std::list<detail::spill_entry> _entries;  // least recently used first
+  std::size_t _device_limit;
+  std::size_t _device_bytes{0};
+  std::size_t _host_bytes{0};
+
+  explicit spill_manager_impl(std::size_t device_limit) : _device_limit{device_limit} {}
+
+  detail::spill_entry* add(packed_columns&& input,
+                           rmm::cuda_stream_view stream,
+                           rmm::mr::device_memory_resource* mr)
+  {
+    CUDF_EXPECTS(input.metadata_ != nullptr and input.gpu_data != nullptr,
+                 "Packed table must have metadata and device data");
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    auto& entry    = _entries.emplace_back(std::move(input), mr);
+    entry.position = std::prev(_entries.end());
+    CUDA_TRY(cudaEventRecord(entry.ready, stream.value()));
+    _device_bytes += entry.size;
+    enforce_limit(stream);
+    return &entry;
+  }
+
+  void remove(detail::spill_entry* entry)
+  {
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    if (entry->device_data != nullptr) { _device_bytes -= entry->size; }
+    if (entry->has_host_copy) { _host_bytes -= entry->size; }
+    _entries.erase(entry->position);
+  }
+
+  /**
+   * @brief Copies the device data of an entry to host memory, unless it was copied by an earlier
+   * spill, and frees it, all in order on `stream`.
+   */
+  void spill_one(detail::spill_entry& entry, rmm::cuda_stream_view stream)
+  {
+    CUDA_TRY(cudaStreamWaitEvent(stream.value(), entry.ready, 0));
+    if (not entry.has_host_copy) {
+      entry.host_data = detail::spill_entry::pinned_buffer(entry.size);
+      CUDA_TRY(cudaMemcpyAsync(entry.host_data.data(),
+                               entry.device_data->data(),
+                               entry.size,
+                               cudaMemcpyDeviceToHost,
+                               stream.value()));
+      entry.has_host_copy = true;
+      _host_bytes += entry.size;
+    }
+    CUDA_TRY(cudaEventRecord(entry.ready, stream.value()));
+    entry.device_data->set_stream(stream);
+    entry.device_data.reset();
+    _device_bytes -= entry.size;
+  }
+
+  /**
+   * @brief Allocates the device data of a spilled entry and copies it back from host memory, in
+   * order on `stream`.
+   */
+  void unspill_one(detail::spill_entry& entry, rmm::cuda_stream_view stream)
+  {
+    auto data = std::make_unique<rmm::device_buffer>(entry.size, stream, entry.mr);
+    CUDA_TRY(cudaStreamWaitEvent(stream.value(), entry.ready, 0));
+    CUDA_TRY(cudaMemcpyAsync(data->data(),
+                             entry.host_data.data(),
+                             entry.size,
+                             cudaMemcpyHostToDevice,
+                             stream.value()));
+    CUDA_TRY(cudaEventRecord(entry.ready, stream.value()));
+    entry.device_data = std::move(data);
+    _device_bytes += entry.size;
+  }
+
+  std::size_t spill(std::size_t bytes, rmm::cuda_stream_view stream)
+  {
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    std::size_t freed = 0;
+    for (auto it = _entries.begin(); it != _entries.end() and freed < bytes; ++it) {
+      if (it->device_data == nullptr or it->lock_count > 0) { continue; }
+      freed += it->size;
+      spill_one(*it, stream);
+    }
+    return freed;
+  }
+
+  void enforce_limit(rmm::cuda_stream_view stream)
+  {
+    if (_device_bytes > _device_limit) { spill(_device_bytes - _device_limit, stream); }
+  }
+
+  /**
+   * @brief Locks an entry and makes its device data valid on `stream`, copying it back from host
+   * memory if it was spilled.
+   */
+  void acquire(detail::spill_entry* entry, rmm::cuda_stream_view stream)
+  {
+    // Counted before unspilling, so that spills triggered by the allocation skip the entry
+    ++entry->lock_count;
+    try {
+      if (entry->device_data == nullptr) {
+        unspill_one(*entry, stream);
+      } else {
+        CUDA_TRY(cudaStreamWaitEvent(stream.value(), entry->ready, 0));
+      }
+    } catch (...) {
+      --entry->lock_count;
+      throw;
+    }
+  }
+
+  table_view lock(detail::spill_entry* entry, rmm::cuda_stream_view stream)
+  {
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    acquire(entry, stream);
+    _entries.splice(_entries.end(), _entries, entry->position);
+    enforce_limit(stream);
+    return unpack(entry->metadata->data(),
+                  static_cast<uint8_t const*>(entry->device_data->data()));
+  }
+
+  void unlock(detail::spill_entry* entry, rmm::cuda_stream_view stream)
+  {
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    // Called from the destructor of the lock, so the error, if any, is left to later calls
+    cudaEventRecord(entry->ready, stream.value());
+    --entry->lock_count;
+  }
+
+  packed_columns release(detail::spill_entry* entry, rmm::cuda_stream_view stream)
+  {
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    CUDF_EXPECTS(entry->lock_count == 0, "A locked table cannot be released");
+    acquire(entry, stream);
+    // The entry synchronizes with the copy back, if any, before freeing the host copy
+    CUDA_TRY(cudaEventRecord(entry->ready, stream.value()));
+    auto data = std::move(entry->device_data);
+    data->set_stream(stream);
+    packed_columns result{std::move(entry->metadata), std::move(data)};
+    _device_bytes -= entry->size;
+    if (entry->has_host_copy) { _host_bytes -= entry->size; }
+    _entries.erase(entry->position);
+    return result;
+  }
+};
+
+spill_manager::spill_manager(std::size_t device_limit)
+  : impl{std::make_unique<spill_manager_impl>(device_limit)}
+{
+}
+
+spill_manager::~spill_manager() = default;
+
+std::size_t spill_manager::spill(std::size_t bytes, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  return impl->spill(bytes, stream);
+}
+
+std::size_t spill_manager::device_bytes() const
+{
+  std::lock_guard<std::recursive_mutex> lock(impl->_mutex);
+  return impl->_device_bytes;
+}
+
+std::size_t spill_manager::host_bytes() const
+{
+  std::lock_guard<std::recursive_mutex> lock(impl->_mutex);
+  return impl->_host_bytes;
+}
+
+std::size_t spill_manager::device_limit() const
+{
+  std::lock_guard<std::recursive_mutex> lock(impl->_mutex);
+  return impl->_device_limit;
+}
+
+void spill_manager::set_device_limit(std::size_t device_limit, rmm::cuda_stream_view stream)
+{
+  std::lock_guard<std::recursive_mutex> lock(impl->_mutex);
+  impl->_device_limit = device_limit;
+  impl->enforce_limit(stream);
+}
+
+spillable_table::device_lock::device_lock(detail::spill_entry* entry,
+                                          spill_manager* manager,
+                                          table_view view,
+                                          rmm::cuda_stream_view stream)
+  : _entry{entry}, _manager{manager}, _view{std::move(view)}, _stream{stream}
+{
+}
+
+spillable_table::device_lock::device_lock(device_lock&& other) noexcept
+  : _entry{std::exchange(other._entry, nullptr)},
+    _manager{other._manager},
+    _view{std::move(other._view)},
+    _stream{other._stream}
+{
+}
+
+spillable_table::device_lock::~device_lock()
+{
+  if (_entry != nullptr) { spillable_table::unlock(_entry, _manager, _stream); }
+}
+
+spillable_table::spillable_table(table_view const& input,
+                                 spill_manager& manager,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+  : spillable_table(detail::pack(input, stream, mr), manager, stream, mr)
+{
+}
+
+spillable_table::spillable_table(packed_columns&& input,
+                                 spill_manager& manager,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+  : _entry{manager.impl->add(std::move(input), stream, mr)}, _manager{&manager}
+{
+}
+
+spillable_table::spillable_table(spillable_table&& other) noexcept
+  : _entry{std::exchange(other._entry, nullptr)}, _manager{other._manager}
+{
+}
+
+spillable_table& spillable_table::operator=(spillable_table&& other) noexcept
+{
+  if (this != &other) {
+    if (_entry != nullptr) { _manager->impl->remove(_entry); }
+    _entry   = std::exchange(other._entry, nullptr);
+    _manager = other._manager;
+  }
+  return *this;
+}
+
+spillable_table::~spillable_table()
+{
+  if (_entry != nullptr) { _manager->impl->remove(_entry); }
+}
+
+spillable_table::device_lock spillable_table::lock(rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(_entry != nullptr, "The table was released");
+  return device_lock{_entry, _manager, _manager->impl->lock(_entry, stream), stream};
+}
+
+void spillable_table::unlock(detail::spill_entry* entry,
+                             spill_manager* manager,
+                             rmm::cuda_stream_view stream)
+{
+  manager->impl->unlock(entry, stream);
+}
+
+bool spillable_table::is_spilled() const
+{
+  CUDF_EXPECTS(_entry != nullptr, "The table was released");
+  std::lock_guard<std::recursive_mutex> lock(_manager->impl->_mutex);
+  return _entry->device_data == nullptr;
+}
+
+std::size_t spillable_table::packed_size() const
+{
+  CUDF_EXPECTS(_entry != nullptr, "The table was released");
+  return _entry->size;
+}
+
+packed_columns spillable_table::release(rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(_entry != nullptr, "The table was released");
+  auto result = _manager->impl->release(_entry, stream);
+  _entry      = nullptr;
+  return result;
+}
+
+spilling_resource_adaptor::spilling_resource_adaptor(spill_manager& manager,
+                                                     rmm::mr::device_memory_resource* upstream)
+  : _manager{&manager}, _upstream{upstream}
+{
+  CUDF_EXPECTS(upstream != nullptr, "Unexpected null upstream memory resource");
+}
+
+void* spilling_resource_adaptor::do_allocate(std::size_t bytes, rmm::cuda_stream_view stream)
+{
+  // The memory of the spilled tables is freed on `stream`, so the retry can reuse it in order
+  while (true) {
+    try {
+      return _upstream->allocate(bytes, stream);
+    } catch (rmm::bad_alloc const&) {
+      if (_manager->spill(bytes, stream) == 0) { throw; }
+    }
+  }
+}
+
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,7 @@
 #include <cudf/detail/copy_if.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/stream_capture.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -69,6 +70,8 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
   if (boolean_mask.is_empty()) { return empty_like(input); }
 
   CUDF_EXPECTS(boolean_mask.type().id() == type_id::BOOL8, "Mask must be Boolean type");
+  // The output is allocated once the number of rows passing the mask has been read on the host
+  CUDF_EXPECTS(not is_capturing(stream), "apply_boolean_mask cannot be captured into a CUDA graph");
   // zero-size inputs are OK, but otherwise input size must match mask size
   CUDF_EXPECTS(input.num_rows() == 0 || input.num_rows() == boolean_mask.size(),
                "Column size mismatch");
@@ -89,9 +92,10 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
  */
 std::unique_ptr<table> apply_boolean_mask(table_view const& input,
                                           column_view const& boolean_mask,
+                                          rmm::cuda_stream_view stream,
                                           rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::apply_boolean_mask(input, boolean_mask, rmm::cuda_stream_default, mr);
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(input, stream);
+  return detail::apply_boolean_mask(input, boolean_mask, stream, mr);
 }
 }  // namespace cudf
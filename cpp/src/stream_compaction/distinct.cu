@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <hash/hash_allocator.cuh>
+#include <hash/helper_functions.cuh>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/polymorphic_allocator.hpp>
+
+#include <cuco/static_map.cuh>
+
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/uninitialized_fill.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+using hash_table_allocator_type = rmm::mr::stream_allocator_adaptor<default_allocator<char>>;
+
+/**
+ * @brief Hash map of the key rows, from the index of a row to the index of the first equal row
+ * inserted.
+ */
+using map_type =
+  cuco::static_map<size_type, size_type, cuda::thread_scope_device, hash_table_allocator_type>;
+
+constexpr size_type unused_key{std::numeric_limits<size_type>::max()};
+constexpr size_type unused_value{std::numeric_limits<size_type>::max()};
+
+/**
+ * @brief Returns the initial value of the reduction of the row indices of each set of equal
+ * rows for `keep`: the minimum index for KEEP_FIRST, the maximum for KEEP_LAST, and the number of
+ * rows for KEEP_NONE.
+ */
+size_type reduction_init(duplicate_keep_option keep)
+{
+  switch (keep) {
+    case duplicate_keep_option::KEEP_FIRST: return std::numeric_limits<size_type>::max();
+    case duplicate_keep_option::KEEP_LAST: return -1;
+    default: return 0;
+  }
+}
+
+}  // namespace
+
+std::unique_ptr<table> distinct(table_view const& input,
+                                std::vector<size_type> const& keys,
+                                duplicate_keep_option keep,
+                                null_equality nulls_equal,
+                                rmm::cuda_stream_view stream,
+                                rmm::mr::device_memory_resource* mr)
+{
+  if (0 == input.num_rows() || 0 == input.num_columns() || 0 == keys.size()) {
+    return empty_like(input);
+  }
+
+  auto const keys_view = input.select(keys);
+  auto const num_rows  = keys_view.num_rows();
+  auto const d_keys    = table_device_view::create(keys_view, stream);
+  auto const has_nulls = nullate::DYNAMIC{cudf::has_nulls(keys_view)};
+  row_hasher<default_hash, nullate::DYNAMIC> hasher{has_nulls, *d_keys};
+  row_equality_comparator<nullate::DYNAMIC> rows_equal{has_nulls, *d_keys, *d_keys, nulls_equal};
+
+  map_type map{compute_hash_table_size(num_rows),
+               unused_key,
+               unused_value,
+               hash_table_allocator_type{default_allocator<char>{}, stream},
+               stream.value()};
+  auto const rows = thrust::make_counting_iterator<size_type>(0);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    rows,
+    num_rows,
+    [d_map = map.get_device_mutable_view(), hasher, rows_equal] __device__(size_type idx) mutable {
+      d_map.insert(thrust::make_pair(idx, idx), hasher, rows_equal);
+    });
+
+  // Reduce the indices of the rows of each set of equal rows into the slot of the row inserted
+  // for the set. Rows with nulls unequal to themselves are never found, and are sets of their own.
+  rmm::device_uvector<size_type> representatives(num_rows, stream);
+  rmm::device_uvector<size_type> reductions(num_rows, stream);
+  thrust::uninitialized_fill(
+    rmm::exec_policy(stream), reductions.begin(), reductions.end(), reduction_init(keep));
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     rows,
+                     num_rows,
+                     [d_map           = map.get_device_view(),
+                      hasher,
+                      rows_equal,
+                      keep,
+                      representatives = representatives.data(),
+                      reductions      = reductions.data()] __device__(size_type idx) {
+                       auto const slot = d_map.find(idx, hasher, rows_equal);
+                       auto const representative =
+                         slot == d_map.end() ? idx
+                                             : slot->second.load(cuda::std::memory_order_relaxed);
+                       representatives[idx] = representative;
+                       switch (keep) {
+                         case duplicate_keep_option::KEEP_FIRST:
+                           atomicMin(reductions + representative, idx);
+                           break;
+                         case duplicate_keep_option::KEEP_LAST:
+                           atomicMax(reductions + representative, idx);
+                           break;
+                         default: atomicAdd(reductions + representative, 1);
+                       }
+                     });
+
+  // keep the rows selected by the reductions, in input order
+  rmm::device_uvector<size_type> gather_map(num_rows, stream);
+  auto const gather_map_end = thrust::copy_if(
+    rmm::exec_policy(stream),
+    rows,
+    rows + num_rows,
+    gather_map.begin(),
+    [keep,
+     representatives = representatives.data(),
+     reductions      = reductions.data()] __device__(size_type idx) {
+      auto const reduction = reductions[representatives[idx]];
+      return keep == duplicate_keep_option::KEEP_NONE ? reduction == 1 : reduction == idx;
+    });
+  gather_map.resize(thrust::distance(gather_map.begin(), gather_map_end), stream);
+
+  return detail::gather(input,
+                        gather_map,
+                        out_of_bounds_policy::DONT_CHECK,
+                        detail::negative_index_policy::NOT_ALLOWED,
+                        stream,
+                        mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> distinct(table_view const& input,
+                                std::vector<size_type> const& keys,
+                                duplicate_keep_option const keep,
+                                null_equality nulls_equal,
+                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::distinct(input, keys, keep, nulls_equal, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/detail/expression_evaluator.cuh>
+#include <cudf/ast/detail/expression_parser.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/detail/copy_if.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Evaluates a boolean expression on the rows of a table into a bitmask.
+ *
+ * Bit `i` of `mask` is set if the expression is non-null and true on row `i`. Each warp writes
+ * whole words of `mask`, so that the block size must be a multiple of the warp size.
+ */
+template <cudf::size_type max_block_size, bool has_nulls>
+__launch_bounds__(max_block_size) __global__
+  void filter_mask_kernel(table_device_view const table,
+                          ast::detail::expression_device_view device_expression_data,
+                          bitmask_type* mask)
+{
+  // The (required) extern storage of the shared memory array leads to
+  // conflicting declarations between different templates. The easiest
+  // workaround is to declare an arbitrary (here char) array type then cast it
+  // after the fact to the appropriate type.
+  extern __shared__ char raw_intermediate_storage[];
+  ast::detail::IntermediateDataType<has_nulls>* intermediate_storage =
+    reinterpret_cast<ast::detail::IntermediateDataType<has_nulls>*>(raw_intermediate_storage);
+
+  auto thread_intermediate_storage =
+    &intermediate_storage[threadIdx.x * device_expression_data.num_intermediates];
+  auto const lane_id = threadIdx.x % warp_size;
+  auto const stride  = static_cast<cudf::size_type>(blockDim.x * gridDim.x);
+  auto evaluator =
+    cudf::ast::detail::expression_evaluator<has_nulls>(table, device_expression_data);
+
+  auto row_index   = static_cast<cudf::size_type>(threadIdx.x + blockIdx.x * blockDim.x);
+  auto active_mask = __ballot_sync(0xFFFF'FFFF, row_index < table.num_rows());
+  while (row_index < table.num_rows()) {
+    auto result = ast::detail::value_expression_result<bool, has_nulls>();
+    evaluator.evaluate(result, row_index, thread_intermediate_storage);
+    auto const ballot = __ballot_sync(active_mask, result.is_valid() && result.value());
+    if (lane_id == 0) { mask[word_index(row_index)] = ballot; }
+    row_index += stride;
+    active_mask = __ballot_sync(active_mask, row_index < table.num_rows());
+  }
+}
+
+/**
+ * @brief Returns true if the bit of row `i` of the mask is set.
+ *
+ * This is the filter functor for `filter`.
+ */
+struct bitmask_filter {
+  bitmask_type const* mask;
+
+  __device__ inline bool operator()(cudf::size_type i) { return bit_is_set(mask, i); }
+};
+
+}  // namespace
+
+std::unique_ptr<table> filter(table_view const& input,
+                              ast::expression const& predicate,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  auto const has_nulls = predicate.may_evaluate_null(input, stream);
+  auto const parser    = ast::detail::expression_parser{predicate, input, has_nulls, stream, mr};
+  CUDF_EXPECTS(parser.output_type().id() == type_id::BOOL8,
+               "The predicate must evaluate to a boolean type.");
+
+  if (input.num_rows() == 0 || input.num_columns() == 0) { return empty_like(input); }
+
+  // Configure kernel parameters
+  int device_id;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  int shmem_limit_per_block;
+  CUDA_TRY(
+    cudaDeviceGetAttribute(&shmem_limit_per_block, cudaDevAttrMaxSharedMemoryPerBlock, device_id));
+  auto constexpr MAX_BLOCK_SIZE = 128;
+  auto const block_size =
+    parser.shmem_per_thread != 0
+      ? std::min(MAX_BLOCK_SIZE, shmem_limit_per_block / parser.shmem_per_thread) / warp_size *
+          warp_size
+      : MAX_BLOCK_SIZE;
+  if (block_size == 0) {
+    // Not even a warp of intermediates fits in shared memory.
+    auto const boolean_mask = cudf::detail::compute_column(input, predicate, stream);
+    return apply_boolean_mask(input, boolean_mask->view(), stream, mr);
+  }
+  auto const config          = cudf::detail::grid_1d{input.num_rows(), block_size};
+  auto const shmem_per_block = parser.shmem_per_thread * config.num_threads_per_block;
+
+  // Evaluate the predicate into a bitmask, then compact the rows whose bits are set
+  auto mask = create_null_mask(input.num_rows(), mask_state::UNINITIALIZED, stream);
+  auto const table_device = table_device_view::create(input, stream);
+  if (has_nulls) {
+    filter_mask_kernel<MAX_BLOCK_SIZE, true>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_per_block, stream.value()>>>(
+        *table_device, parser.device_expression_data, static_cast<bitmask_type*>(mask.data()));
+  } else {
+    filter_mask_kernel<MAX_BLOCK_SIZE, false>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_per_block, stream.value()>>>(
+        *table_device, parser.device_expression_data, static_cast<bitmask_type*>(mask.data()));
+  }
+  CHECK_CUDA(stream.value());
+
+  return copy_if(input, bitmask_filter{static_cast<bitmask_type const*>(mask.data())}, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> filter(table_view const& input,
+                              ast::expression const& predicate,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::filter(input, predicate, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,412 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/hyperloglog/hyperloglog.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
+#include <thrust/sequence.h>
+#include <thrust/tabulate.h>
+
+#include <cmath>
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace hyperloglog {
+namespace {
+
+// Seed of the upper 32 bits of the 64-bit hash of a value, the lower ones using the default seed
+constexpr uint32_t upper_hash_seed = 0x9e3779b9;
+
+void validate_precision(int precision)
+{
+  CUDF_EXPECTS(precision >= min_precision and precision <= max_precision,
+               "HyperLogLog precision must be in [4, 18]");
+}
+
+/**
+ * @brief Makes a sketches column of `num_sketches` rows whose registers are all zero.
+ */
+std::unique_ptr<column> make_empty_sketches(size_type num_sketches,
+                                            int precision,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  auto const num_registers = size_type{1} << precision;
+  CUDF_EXPECTS(static_cast<int64_t>(num_sketches) * num_registers <=
+                 std::numeric_limits<size_type>::max(),
+               "Size of the HyperLogLog sketches exceeds the column size limit");
+
+  auto offsets = make_numeric_column(
+    data_type{type_to_id<offset_type>()}, num_sketches + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::sequence(rmm::exec_policy(stream),
+                   offsets->mutable_view().begin<offset_type>(),
+                   offsets->mutable_view().end<offset_type>(),
+                   0,
+                   num_registers);
+  auto registers = make_numeric_column(data_type{type_id::UINT8},
+                                       num_sketches * num_registers,
+                                       mask_state::UNALLOCATED,
+                                       stream,
+                                       mr);
+  CUDA_TRY(cudaMemsetAsync(registers->mutable_view().data<uint8_t>(),
+                           0,
+                           registers->size() * sizeof(uint8_t),
+                           stream.value()));
+  return make_lists_column(
+    num_sketches, std::move(offsets), std::move(registers), 0, rmm::device_buffer{}, stream, mr);
+}
+
+/**
+ * @brief Raises the register `index` of `registers` to `value` if it is lower.
+ *
+ * The registers are bytes, updated with a compare-and-swap of the aligned word holding them.
+ */
+__device__ inline void update_register(uint8_t* registers, size_type index, uint8_t value)
+{
+  auto const word =
+    reinterpret_cast<unsigned int*>(registers + (index & ~size_type{3}));  // NOLINT
+  auto const shift = static_cast<unsigned int>(index & 3) * 8;
+  auto old         = *word;
+  unsigned int assumed;
+  do {
+    if (((old >> shift) & 0xffu) >= value) { return; }
+    assumed = old;
+    old     = atomicCAS(word, assumed, (assumed & ~(0xffu << shift)) | (value << shift));
+  } while (old != assumed);
+}
+
+/**
+ * @brief Finalizer of the 64-bit MurmurHash3, mixing the two 32-bit hashes of a value together.
+ */
+__device__ inline uint64_t fmix64(uint64_t k)
+{
+  k ^= k >> 33;
+  k *= 0xff51afd7ed558ccdull;
+  k ^= k >> 33;
+  k *= 0xc4ceb9fe1a85ec53ull;
+  k ^= k >> 33;
+  return k;
+}
+
+/**
+ * @brief Device functor adding each valid row of `values` to the sketch of its group.
+ */
+template <typename LabelIterator>
+struct insert_values_fn {
+  column_device_view values;
+  LabelIterator group_labels;
+  uint8_t* registers;
+  int precision;
+
+  __device__ void operator()(size_type i) const
+  {
+    if (values.is_null(i)) { return; }
+    auto const group = group_labels[i];
+    if (group < 0) { return; }
+
+    auto const lower = type_dispatcher<dispatch_storage_type>(
+      values.type(),
+      element_hasher_with_seed<MurmurHash3_32, nullate::NO>{nullate::NO{}, DEFAULT_HASH_SEED},
+      values,
+      i);
+    auto const upper = type_dispatcher<dispatch_storage_type>(
+      values.type(),
+      element_hasher_with_seed<MurmurHash3_32, nullate::NO>{nullate::NO{}, upper_hash_seed},
+      values,
+      i);
+    auto const hash = fmix64((static_cast<uint64_t>(upper) << 32) | lower);
+
+    // The first bits select the register, which keeps the largest position of the first set bit
+    // of the remaining ones
+    auto const index     = static_cast<size_type>(hash >> (64 - precision));
+    auto const remaining = hash << precision;
+    auto const rank =
+      static_cast<uint8_t>(remaining == 0 ? 64 - precision + 1 : __clzll(remaining) + 1);
+    update_register(registers, (group << precision) + index, rank);
+  }
+};
+
+/**
+ * @brief Device functor merging each register of the valid sketches of `sketches` into the
+ * sketch of its group.
+ */
+template <typename LabelIterator>
+struct merge_registers_fn {
+  column_device_view sketches;
+  offset_type const* offsets;
+  uint8_t const* input_registers;
+  LabelIterator group_labels;
+  uint8_t* registers;
+  int precision;
+
+  __device__ void operator()(size_type i) const
+  {
+    auto const row = i >> precision;
+    if (sketches.is_null(row)) { return; }
+    auto const group = group_labels[row];
+    if (group < 0) { return; }
+    auto const index = i & ((size_type{1} << precision) - 1);
+    auto const value = input_registers[offsets[row] + index];
+    if (value != 0) { update_register(registers, (group << precision) + index, value); }
+  }
+};
+
+template <typename LabelIterator>
+std::unique_ptr<column> make_sketches_impl(column_view const& values,
+                                           LabelIterator group_labels,
+                                           size_type num_groups,
+                                           int precision,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  validate_precision(precision);
+  CUDF_EXPECTS(not cudf::is_nested(values.type()) and not cudf::is_dictionary(values.type()),
+               "HyperLogLog sketches do not support nested or dictionary values");
+
+  auto sketches = make_empty_sketches(num_groups, precision, stream, mr);
+  if (values.is_empty()) { return sketches; }
+
+  auto const d_values = column_device_view::create(values, stream);
+  auto registers      = sketches->child(lists_column_view::child_column_index).mutable_view();
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator(0),
+                     values.size(),
+                     insert_values_fn<LabelIterator>{
+                       *d_values, group_labels, registers.data<uint8_t>(), precision});
+  return sketches;
+}
+
+template <typename LabelIterator>
+std::unique_ptr<column> merge_sketches_impl(column_view const& sketches,
+                                            LabelIterator group_labels,
+                                            size_type num_groups,
+                                            int precision,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  validate_precision(precision);
+  CUDF_EXPECTS(sketches.type().id() == type_id::LIST,
+               "HyperLogLog sketches must be a LIST<UINT8> column");
+  lists_column_view const input(sketches);
+  CUDF_EXPECTS(input.child().type().id() == type_id::UINT8,
+               "HyperLogLog sketches must be a LIST<UINT8> column");
+
+  auto const num_registers = size_type{1} << precision;
+  CUDF_EXPECTS(static_cast<int64_t>(sketches.size()) * num_registers <=
+                 std::numeric_limits<size_type>::max(),
+               "Size of the HyperLogLog sketches exceeds the column size limit");
+  auto const d_sketches = column_device_view::create(sketches, stream);
+  auto const offsets    = input.offsets_begin();
+  CUDF_EXPECTS(thrust::all_of(rmm::exec_policy(stream),
+                              thrust::make_counting_iterator(0),
+                              thrust::make_counting_iterator(sketches.size()),
+                              [d_sketches = *d_sketches, offsets, num_registers] __device__(
+                                size_type row) {
+                                return d_sketches.is_null(row) or
+                                       offsets[row + 1] - offsets[row] == num_registers;
+                              }),
+               "HyperLogLog sketches must all be of the aggregation precision");
+
+  auto result = make_empty_sketches(num_groups, precision, stream, mr);
+  if (sketches.is_empty()) { return result; }
+
+  auto registers = result->child(lists_column_view::child_column_index).mutable_view();
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator(0),
+                     sketches.size() * num_registers,
+                     merge_registers_fn<LabelIterator>{*d_sketches,
+                                                       offsets,
+                                                       input.child().data<uint8_t>(),
+                                                       group_labels,
+                                                       registers.data<uint8_t>(),
+                                                       precision});
+  return result;
+}
+
+__device__ inline double sigma(double x)
+{
+  if (x == 1.0) { return std::numeric_limits<double>::infinity(); }
+  double y = 1.0;
+  double z = x;
+  double previous;
+  do {
+    x *= x;
+    previous = z;
+    z += x * y;
+    y += y;
+  } while (z != previous);
+  return z;
+}
+
+__device__ inline double tau(double x)
+{
+  if (x == 0.0 or x == 1.0) { return 0.0; }
+  double y = 1.0;
+  double z = 1.0 - x;
+  double previous;
+  do {
+    x        = sqrt(x);
+    previous = z;
+    y *= 0.5;
+    z -= (1.0 - x) * (1.0 - x) * y;
+  } while (z != previous);
+  return z / 3.0;
+}
+
+/**
+ * @brief Device functor estimating the distinct count of a sketch.
+ *
+ * Uses the improved raw estimator of Ertl ("New cardinality estimation algorithms for
+ * HyperLogLog sketches"), which is unbiased over the whole range of cardinalities without the
+ * empirical bias correction of HyperLogLog++.
+ */
+struct estimate_fn {
+  offset_type const* offsets;
+  uint8_t const* registers;
+
+  __device__ int64_t operator()(size_type row) const
+  {
+    auto const begin         = offsets[row];
+    auto const num_registers = offsets[row + 1] - begin;
+    if (num_registers == 0) { return 0; }
+    auto const precision = __ffs(num_registers) - 1;
+    auto const q         = 64 - precision;
+
+    // Histogram of the register values, which are at most q + 1
+    size_type histogram[64 - min_precision + 2] = {0};
+    for (size_type i = 0; i < num_registers; ++i) {
+      ++histogram[min(static_cast<int>(registers[begin + i]), q + 1)];
+    }
+
+    double const m = num_registers;
+    double z       = m * tau(1.0 - histogram[q + 1] / m);
+    for (int k = q; k >= 1; --k) {
+      z = 0.5 * (z + histogram[k]);
+    }
+    z += m * sigma(histogram[0] / m);
+    return llround(m * m / (2.0 * M_LN2 * z));
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> make_sketches(column_view const& values,
+                                      device_span<size_type const> group_labels,
+                                      size_type num_groups,
+                                      int precision,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(static_cast<size_type>(group_labels.size()) == values.size(),
+               "Size mismatch between the values and their group labels");
+  return make_sketches_impl(values, group_labels.begin(), num_groups, precision, stream, mr);
+}
+
+std::unique_ptr<column> make_sketch(column_view const& values,
+                                    int precision,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  return make_sketches_impl(
+    values, thrust::make_constant_iterator(size_type{0}), 1, precision, stream, mr);
+}
+
+std::unique_ptr<column> merge_sketches(column_view const& sketches,
+                                       device_span<size_type const> group_labels,
+                                       size_type num_groups,
+                                       int precision,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(static_cast<size_type>(group_labels.size()) == sketches.size(),
+               "Size mismatch between the sketches and their group labels");
+  return merge_sketches_impl(sketches, group_labels.begin(), num_groups, precision, stream, mr);
+}
+
+std::unique_ptr<column> merge_sketch(column_view const& sketches,
+                                     int precision,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  return merge_sketches_impl(
+    sketches, thrust::make_constant_iterator(size_type{0}), 1, precision, stream, mr);
+}
+
+std::unique_ptr<column> estimate_distinct_count(column_view const& sketches,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(sketches.type().id() == type_id::LIST,
+               "HyperLogLog sketches must be a LIST<UINT8> column");
+  lists_column_view const input(sketches);
+  CUDF_EXPECTS(input.child().type().id() == type_id::UINT8,
+               "HyperLogLog sketches must be a LIST<UINT8> column");
+
+  auto const d_sketches = column_device_view::create(sketches, stream);
+  auto const offsets    = input.offsets_begin();
+  CUDF_EXPECTS(thrust::all_of(rmm::exec_policy(stream),
+                              thrust::make_counting_iterator(0),
+                              thrust::make_counting_iterator(sketches.size()),
+                              [d_sketches = *d_sketches, offsets] __device__(size_type row) {
+                                auto const size = offsets[row + 1] - offsets[row];
+                                return d_sketches.is_null(row) or size == 0 or
+                                       (size >= (1 << min_precision) and
+                                        size <= (1 << max_precision) and (size & (size - 1)) == 0);
+                              }),
+               "HyperLogLog sketches must have a power of 2 number of registers");
+
+  auto result = make_numeric_column(data_type{type_id::INT64},
+                                    sketches.size(),
+                                    cudf::detail::copy_bitmask(sketches, stream, mr),
+                                    sketches.null_count(),
+                                    stream,
+                                    mr);
+  thrust::tabulate(rmm::exec_policy(stream),
+                   result->mutable_view().begin<int64_t>(),
+                   result->mutable_view().end<int64_t>(),
+                   estimate_fn{offsets, input.child().data<uint8_t>()});
+  return result;
+}
+
+}  // namespace hyperloglog
+}  // namespace detail
+
+std::unique_ptr<column> hll_distinct_count(column_view const& sketches,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hyperloglog::estimate_distinct_count(sketches, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
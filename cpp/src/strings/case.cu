@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,10 +18,12 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/case.hpp>
 #include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/error.hpp>
@@ -34,6 +36,13 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/extrema.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <cstdint>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -110,6 +119,102 @@ struct upper_lower_fn {
   }
 };
 
+/**
+ * @brief Converts the case of the ASCII letters among 8 ASCII characters at once.
+ *
+ * A byte below 0x80 added to `0x80 - c` has its high bit set when it is at least `c`, and the
+ * sums never carry into the next byte. The letters in range have their 0x20 bit flipped.
+ */
+__device__ uint64_t convert_ascii_case(uint64_t chars, character_flags_table_type case_flag)
+{
+  constexpr uint64_t ones = 0x0101010101010101UL;
+  auto const in_range     = [chars](uint64_t first, uint64_t last) {
+    return ((chars + ones * (0x80 - first)) ^ (chars + ones * (0x80 - last - 1))) & (ones * 0x80);
+  };
+  uint64_t flips = 0;
+  if (IS_UPPER(case_flag)) flips |= in_range('A', 'Z');
+  if (IS_LOWER(case_flag)) flips |= in_range('a', 'z');
+  return chars ^ (flips >> 2);
+}
+
+/**
+ * @brief Converts the case of the output chars word `word_idx` of only ASCII strings.
+ *
+ * The case conversion of ASCII characters does not change their size, so the output chars are
+ * written in a single pass.
+ */
+struct ascii_case_fn {
+  char const* d_input;
+  char* d_output;  // aligned to 8 bytes
+  int64_t const num_bytes;
+  character_flags_table_type const case_flag;
+
+  __device__ void operator()(int64_t word_idx) const
+  {
+    constexpr int64_t word_size = sizeof(uint64_t);
+    auto const first            = word_idx * word_size;
+    auto const count            = thrust::min(word_size, num_bytes - first);
+    auto const in_ptr           = d_input + first;
+    uint64_t chars              = 0;
+    if (count == word_size && reinterpret_cast<std::uintptr_t>(in_ptr) % word_size == 0) {
+      chars = *reinterpret_cast<uint64_t const*>(in_ptr);
+    } else {
+      for (int64_t idx = 0; idx < count; ++idx)
+        chars |= static_cast<uint64_t>(static_cast<uint8_t>(in_ptr[idx])) << (8 * idx);
+    }
+    chars = convert_ascii_case(chars, case_flag);
+    if (count == word_size) {
+      *reinterpret_cast<uint64_t*>(d_output + first) = chars;
+    } else {
+      for (int64_t idx = 0; idx < count; ++idx)
+        d_output[first + idx] = static_cast<char>(chars >> (8 * idx));
+    }
+  }
+};
+
+/**
+ * @brief Converts the case of a strings column with only ASCII characters.
+ *
+ * The output has the offsets of the input, and its chars are converted 8 bytes at a time.
+ */
+std::unique_ptr<column> convert_ascii_case(strings_column_view const& strings,
+                                           character_flags_table_type case_flag,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  auto const offsets = strings.offsets();
+  auto const begin   = cudf::detail::get_value<offset_type>(offsets, strings.offset(), stream);
+  auto const end =
+    cudf::detail::get_value<offset_type>(offsets, strings.offset() + strings.size(), stream);
+
+  auto offsets_column = make_numeric_column(
+    data_type{type_id::INT32}, strings.size() + 1, mask_state::UNALLOCATED, stream, mr);
+  auto const d_in_offsets = offsets.data<offset_type>() + strings.offset();
+  thrust::transform(rmm::exec_policy(stream),
+                    d_in_offsets,
+                    d_in_offsets + strings.size() + 1,
+                    offsets_column->mutable_view().data<offset_type>(),
+                    [begin] __device__(offset_type offset) { return offset - begin; });
+
+  constexpr int64_t word_size = sizeof(uint64_t);
+  auto const num_bytes         = static_cast<int64_t>(end - begin);
+  auto const num_words         = (num_bytes + word_size - 1) / word_size;
+  auto chars_column            = create_chars_child_column(end - begin, stream, mr);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<int64_t>(0),
+                     num_words,
+                     ascii_case_fn{strings.chars().data<char>() + begin,
+                                   chars_column->mutable_view().data<char>(),
+                                   num_bytes,
+                                   case_flag});
+
+  return make_strings_column(strings.size(),
+                             std::move(offsets_column),
+                             std::move(chars_column),
+                             strings.null_count(),
+                             cudf::detail::copy_bitmask(strings.parent(), stream, mr));
+}
+
 /**
  * @brief Utility method for converting upper and lower case characters
  * in a strings column.
@@ -126,6 +231,7 @@ std::unique_ptr<column> convert_case(strings_column_view const& strings,
                                      rmm::mr::device_memory_resource* mr)
 {
   if (strings.is_empty()) return make_empty_column(type_id::STRING);
+  if (is_all_ascii(strings, stream)) return convert_ascii_case(strings, case_flag, stream, mr);
 
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_column       = *strings_column;
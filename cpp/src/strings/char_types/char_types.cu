@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -59,29 +59,40 @@ std::unique_ptr<column> all_characters_of_type(
   auto d_results    = results_view.data<bool>();
   // get the static character types table
   auto d_flags = detail::get_character_flags_table();
+  // the flags of ASCII strings are read by byte, without decoding the characters
+  auto const ascii = is_all_ascii(strings, stream);
   // set the output values by checking the character types for each string
-  thrust::transform(rmm::exec_policy(stream),
-                    thrust::make_counting_iterator<size_type>(0),
-                    thrust::make_counting_iterator<size_type>(strings_count),
-                    d_results,
-                    [d_column, d_flags, types, verify_types, d_results] __device__(size_type idx) {
-                      if (d_column.is_null(idx)) return false;
-                      auto d_str            = d_column.element<string_view>(idx);
-                      bool check            = !d_str.empty();  // require at least one character
-                      size_type check_count = 0;
-                      for (auto itr = d_str.begin(); check && (itr != d_str.end()); ++itr) {
-                        auto code_point = detail::utf8_to_codepoint(*itr);
-                        // lookup flags in table by code-point
-                        auto flag = code_point <= 0x00FFFF ? d_flags[code_point] : 0;
-                        if ((verify_types & flag) ||                   // should flag be verified
-                            (flag == 0 && verify_types == ALL_TYPES))  // special edge case
-                        {
-                          check = (types & flag) > 0;
-                          ++check_count;
-                        }
-                      }
-                      return check && (check_count > 0);
-                    });
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(strings_count),
+    d_results,
+    [d_column, d_flags, types, verify_types, ascii] __device__(size_type idx) {
+      if (d_column.is_null(idx)) return false;
+      auto d_str            = d_column.element<string_view>(idx);
+      bool check            = !d_str.empty();  // require at least one character
+      size_type check_count = 0;
+      auto const check_flag = [&](character_flags_table_type flag) {
+        if ((verify_types & flag) ||                   // should flag be verified
+            (flag == 0 && verify_types == ALL_TYPES))  // special edge case
+        {
+          check = (types & flag) > 0;
+          ++check_count;
+        }
+      };
+      if (ascii) {
+        auto const d_chars = reinterpret_cast<uint8_t const*>(d_str.data());
+        for (size_type i = 0; check && (i < d_str.size_bytes()); ++i)
+          check_flag(d_flags[d_chars[i]]);
+        return check && (check_count > 0);
+      }
+      for (auto itr = d_str.begin(); check && (itr != d_str.end()); ++itr) {
+        auto code_point = detail::utf8_to_codepoint(*itr);
+        // lookup flags in table by code-point
+        check_flag(code_point <= 0x00FFFF ? d_flags[code_point] : 0);
+      }
+      return check && (check_count > 0);
+    });
   //
   results->set_null_count(strings.null_count());
   return results;
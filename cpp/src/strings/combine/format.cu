@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/scalar/scalar_device_view.cuh>
+#include <cudf/strings/combine.hpp>
+#include <cudf/strings/detail/combine.hpp>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+
+/**
+ * @brief A piece of the output strings: either a literal of the pattern, or the string of a
+ * column in the row.
+ */
+struct format_item {
+  size_type column;  ///< Index of the column of a placeholder, -1 for a literal
+  size_type offset;  ///< Byte position of a literal in the literals of the pattern
+  size_type length;  ///< Size in bytes of a literal
+};
+
+/**
+ * @brief Parses a format pattern into its items and the bytes of its literals.
+ */
+std::vector<format_item> parse_pattern(std::string const& pattern,
+                                       size_type num_columns,
+                                       std::string& literals)
+{
+  std::vector<format_item> items;
+  size_type literal_start = 0;
+  auto const add_literal  = [&] {
+    auto const size = static_cast<size_type>(literals.size());
+    if (size > literal_start) items.push_back({-1, literal_start, size - literal_start});
+    literal_start = size;
+  };
+
+  size_type next_column = 0;
+  std::size_t pos       = 0;
+  while (pos < pattern.size()) {
+    auto const ch = pattern[pos];
+    if (ch == '}') {
+      CUDF_EXPECTS(pos + 1 < pattern.size() && pattern[pos + 1] == '}',
+                   "Unmatched '}' in format pattern");
+      literals.push_back(ch);
+      pos += 2;
+    } else if (ch != '{') {
+      literals.push_back(ch);
+      ++pos;
+    } else if (pos + 1 < pattern.size() && pattern[pos + 1] == '{') {
+      literals.push_back(ch);
+      pos += 2;
+    } else {
+      auto const close = pattern.find('}', pos + 1);
+      CUDF_EXPECTS(close != std::string::npos, "Unmatched '{' in format pattern");
+      auto const index = pattern.substr(pos + 1, close - pos - 1);
+      CUDF_EXPECTS(index.size() < 10 &&
+                     std::all_of(index.begin(),
+                                 index.end(),
+                                 [](unsigned char c) { return std::isdigit(c) != 0; }),
+                   "Invalid placeholder in format pattern");
+      auto const column = index.empty() ? next_column : static_cast<size_type>(std::stoi(index));
+      CUDF_EXPECTS(column < num_columns, "Placeholder refers to a column out of range");
+      add_literal();
+      items.push_back({column, 0, 0});
+      next_column = column + 1;
+      pos         = close + 1;
+    }
+  }
+  add_literal();
+  return items;
+}
+
+/**
+ * @brief Format functor writing the items of the pattern for each row.
+ *
+ * This is called twice. The first pass calculates the size of each output string.
+ * The final pass copies the results to the output strings column memory.
+ */
+struct format_fn {
+  table_device_view const d_table;
+  device_span<format_item const> const d_items;
+  char const* d_literals;
+  string_scalar_device_view const d_narep;
+  offset_type* d_offsets{};
+  char* d_chars{};
+
+  /**
+   * @brief Returns whether the output row is null: a string it refers to is null and there is
+   * no replacement for it.
+   */
+  __device__ bool is_null_row(size_type idx) const
+  {
+    return !d_narep.is_valid() &&
+           thrust::any_of(thrust::seq, d_items.begin(), d_items.end(), [&](auto const& item) {
+             return item.column >= 0 && d_table.column(item.column).is_null(idx);
+           });
+  }
+
+  __device__ void operator()(size_type idx)
+  {
+    if (is_null_row(idx)) {
+      if (!d_chars) d_offsets[idx] = 0;
+      return;
+    }
+
+    char* d_buffer    = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    offset_type bytes = 0;
+    for (auto const& item : d_items) {
+      auto const d_str = [&] {
+        if (item.column < 0) { return string_view(d_literals + item.offset, item.length); }
+        auto const& d_column = d_table.column(item.column);
+        return d_column.is_null(idx) ? d_narep.value() : d_column.element<string_view>(idx);
+      }();
+      if (d_buffer) d_buffer = detail::copy_string(d_buffer, d_str);
+      bytes += d_str.size_bytes();
+    }
+
+    if (!d_chars) d_offsets[idx] = bytes;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> format(std::string const& pattern,
+                               table_view const& strings_columns,
+                               string_scalar const& narep,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(std::all_of(strings_columns.begin(),
+                           strings_columns.end(),
+                           [](auto c) { return c.type().id() == type_id::STRING; }),
+               "All columns must be of type string");
+  std::string literals;
+  auto const items = parse_pattern(pattern, strings_columns.num_columns(), literals);
+
+  auto const strings_count = strings_columns.num_rows();
+  if (strings_count == 0)  // empty begets empty
+    return make_empty_column(type_id::STRING);
+
+  auto const d_items    = cudf::detail::make_device_uvector_async(items, stream);
+  auto const d_literals = cudf::detail::make_device_uvector_async(
+    std::vector<char>(literals.begin(), literals.end()), stream);
+  auto d_narep  = get_scalar_device_view(const_cast<string_scalar&>(narep));
+  auto d_table  = table_device_view::create(strings_columns, stream);
+  format_fn fn{*d_table, d_items, d_literals.data(), d_narep};
+  auto children = make_strings_children(fn, strings_count, stream, mr);
+
+  // create resulting null mask
+  auto [null_mask, null_count] = cudf::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(strings_count),
+    [fn] __device__(size_type idx) { return !fn.is_null_row(idx); },
+    stream,
+    mr);
+
+  return make_strings_column(strings_count,
+                             std::move(children.first),
+                             std::move(children.second),
+                             null_count,
+                             std::move(null_mask));
+}
+
+}  // namespace detail
+
+// external API
+
+std::unique_ptr<column> format(std::string const& pattern,
+                               table_view const& strings_columns,
+                               string_scalar const& narep,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::format(pattern, strings_columns, narep, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace strings
+}  // namespace cudf
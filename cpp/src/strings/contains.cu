@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/contains.hpp>
 #include <cudf/strings/detail/utilities.hpp>
@@ -55,18 +56,46 @@ struct contains_fn {
   {
     if (d_strings.is_null(idx)) return false;
     string_view d_str = d_strings.element<string_view>(idx);
-    int32_t begin     = 0;
-    int32_t end       = bmatch ? 1    // match only the beginning of the string;
-                               : -1;  // this handles empty strings too
+    if (!prog.is_candidate(d_str, bmatch)) return false;
+    int32_t begin = 0;
+    int32_t end   = bmatch ? 1    // match only the beginning of the string;
+                           : -1;  // this handles empty strings too
     return static_cast<bool>(prog.find<stack_size>(idx, d_str, begin, end));
   }
 };
 
+/**
+ * @brief Number of strings evaluated by each thread of `contains_dfa_kernel`, so that the tables
+ * loaded into the shared memory of a block are used for several strings.
+ */
+constexpr size_type dfa_strings_per_thread = 8;
+
+/**
+ * @brief Kernel handling both contains_re and match_re with the automaton of the regex pattern.
+ *
+ * The tables of the automaton are loaded into the shared memory of each block, and each string
+ * is then evaluated one character at a time with a single lookup for each character.
+ */
+__global__ void contains_dfa_kernel(column_device_view const d_strings,
+                                    redfa_device const dfa,
+                                    bool* d_results)
+{
+  extern __shared__ uint32_t shared_dfa[];  // words keep the tables aligned
+  auto const d_dfa = dfa.load(reinterpret_cast<uint8_t*>(shared_dfa));
+
+  auto const stride = static_cast<size_type>(blockDim.x * gridDim.x);
+  for (auto idx = static_cast<size_type>(threadIdx.x + blockIdx.x * blockDim.x);
+       idx < d_strings.size();
+       idx += stride) {
+    d_results[idx] =
+      d_strings.is_valid(idx) && d_dfa.is_match(d_strings.element<string_view>(idx));
+  }
+}
+
 //
 std::unique_ptr<column> contains_util(
   strings_column_view const& strings,
-  std::string const& pattern,
-  regex_flags const flags,
+  regex_program const& prog,
   bool beginning_only                 = false,
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
@@ -75,11 +104,6 @@ std::unique_ptr<column> contains_util(
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_column       = *strings_column;
 
-  // compile regex into device object
-  auto prog =
-    reprog_device::create(pattern, flags, get_character_flags_table(), strings_count, stream);
-  auto d_prog = *prog;
-
   // create the output column
   auto results   = make_numeric_column(data_type{type_id::BOOL8},
                                      strings_count,
@@ -88,6 +112,23 @@ std::unique_ptr<column> contains_util(
                                      stream,
                                      mr);
   auto d_results = results->mutable_view().data<bool>();
+  if (strings_count == 0) return results;
+
+  // patterns the automaton can evaluate do not need the regex instructions
+  auto const d_dfa = regex_device_builder::create_dfa_device(prog, beginning_only, stream);
+  if (d_dfa) {
+    constexpr size_type block_size = 256;
+    cudf::detail::grid_1d grid{strings_count, block_size, dfa_strings_per_thread};
+    contains_dfa_kernel<<<grid.num_blocks,
+                          grid.num_threads_per_block,
+                          d_dfa->size_bytes(),
+                          stream.value()>>>(d_column, *d_dfa, d_results);
+    results->set_null_count(strings.null_count());
+    return results;
+  }
+
+  // get the device object of the compiled regex
+  auto d_prog = regex_device_builder::create_prog_device(prog, strings_count, stream);
 
   // fill the output column
   int regex_insts = d_prog.insts_counts();
@@ -122,6 +163,15 @@ std::unique_ptr<column> contains_util(
 
 }  // namespace
 
+std::unique_ptr<column> contains_re(
+  strings_column_view const& strings,
+  regex_program const& prog,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  return contains_util(strings, prog, false, stream, mr);
+}
+
 std::unique_ptr<column> contains_re(
   strings_column_view const& strings,
   std::string const& pattern,
@@ -129,7 +179,17 @@ std::unique_ptr<column> contains_re(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
-  return contains_util(strings, pattern, flags, false, stream, mr);
+  auto const prog = regex_program::create(pattern, flags);
+  return contains_util(strings, *prog, false, stream, mr);
+}
+
+std::unique_ptr<column> matches_re(
+  strings_column_view const& strings,
+  regex_program const& prog,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  return contains_util(strings, prog, true, stream, mr);
 }
 
 std::unique_ptr<column> matches_re(
@@ -139,7 +199,8 @@ std::unique_ptr<column> matches_re(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
-  return contains_util(strings, pattern, flags, true, stream, mr);
+  auto const prog = regex_program::create(pattern, flags);
+  return contains_util(strings, *prog, true, stream, mr);
 }
 
 }  // namespace detail
@@ -164,6 +225,22 @@ std::unique_ptr<column> matches_re(strings_column_view const& strings,
   return detail::matches_re(strings, pattern, flags, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> contains_re(strings_column_view const& strings,
+                                    regex_program const& prog,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains_re(strings, prog, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> matches_re(strings_column_view const& strings,
+                                   regex_program const& prog,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::matches_re(strings, prog, rmm::cuda_stream_default, mr);
+}
+
 namespace detail {
 namespace {
 /**
@@ -177,7 +254,8 @@ struct count_fn {
   __device__ int32_t operator()(unsigned int idx)
   {
     if (d_strings.is_null(idx)) return 0;
-    string_view d_str  = d_strings.element<string_view>(idx);
+    string_view d_str = d_strings.element<string_view>(idx);
+    if (!prog.is_candidate(d_str, false)) return 0;
     auto const nchars  = d_str.length();
     int32_t find_count = 0;
     int32_t begin      = 0;
@@ -195,8 +273,7 @@ struct count_fn {
 
 std::unique_ptr<column> count_re(
   strings_column_view const& strings,
-  std::string const& pattern,
-  regex_flags const flags,
+  regex_program const& prog,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
@@ -204,10 +281,8 @@ std::unique_ptr<column> count_re(
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_column       = *strings_column;
 
-  // compile regex into device object
-  auto prog =
-    reprog_device::create(pattern, flags, get_character_flags_table(), strings_count, stream);
-  auto d_prog = *prog;
+  // get the device object of the compiled regex
+  auto d_prog = regex_device_builder::create_prog_device(prog, strings_count, stream);
 
   // create the output column
   auto results   = make_numeric_column(data_type{type_id::INT32},
@@ -249,6 +324,17 @@ std::unique_ptr<column> count_re(
   return results;
 }
 
+std::unique_ptr<column> count_re(
+  strings_column_view const& strings,
+  std::string const& pattern,
+  regex_flags const flags,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  auto const prog = regex_program::create(pattern, flags);
+  return count_re(strings, *prog, stream, mr);
+}
+
 }  // namespace detail
 
 // external API
@@ -262,5 +348,13 @@ std::unique_ptr<column> count_re(strings_column_view const& strings,
   return detail::count_re(strings, pattern, flags, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> count_re(strings_column_view const& strings,
+                                 regex_program const& prog,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::count_re(strings, prog, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
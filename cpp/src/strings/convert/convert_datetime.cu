@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -37,9 +37,12 @@
 #include <thrust/functional.h>
 #include <thrust/logical.h>
 #include <thrust/optional.h>
+#include <thrust/sequence.h>
 
+#include <limits>
 #include <map>
 #include <numeric>
+#include <string_view>
 #include <vector>
 
 namespace cudf {
@@ -96,25 +99,26 @@ struct alignas(4) format_item {
  */
 using specifier_map = std::map<char, int8_t>;
 
+// Specifiers supported by to_timestamps and is_timestamp; from_timestamps supports them all
+constexpr std::string_view parse_specifiers = "YymdHIMSfzZpj";
+
 struct format_compiler {
   std::string const format;
-  rmm::device_uvector<format_item> d_items;
+  std::vector<format_item> items;
 
   // clang-format off
   // The specifiers are documented here (not all are supported):
   // https://en.cppreference.com/w/cpp/chrono/system_clock/formatter
   specifier_map specifiers = {
     {'Y', 4}, {'y', 2}, {'m', 2}, {'d', 2}, {'H', 2}, {'I', 2}, {'M', 2},
-    {'S', 2}, {'f', 6}, {'z', 5}, {'Z', 3}, {'p', 2}, {'j', 3}};
+    {'S', 2}, {'f', 6}, {'z', 5}, {'Z', 3}, {'p', 2}, {'j', 3},
+    // These are only supported by from_timestamps
+    {'w', 1}, {'W', 2}, {'u', 1}, {'U', 2}, {'V', 2}, {'G', 4},
+    {'a', 3}, {'A', 3}, {'b', 3}, {'B', 3}};
   // clang-format on
 
-  format_compiler(std::string fmt,
-                  rmm::cuda_stream_view stream,
-                  specifier_map extra_specifiers = {})
-    : format(fmt), d_items(0, stream)
+  format_compiler(std::string fmt) : format(fmt)
   {
-    specifiers.insert(extra_specifiers.begin(), extra_specifiers.end());
-    std::vector<format_item> items;
     const char* str = format.c_str();
     auto length     = format.length();
     while (length > 0) {
@@ -149,16 +153,81 @@ struct format_compiler {
       // create the format item for this specifier
       items.push_back(format_item::new_specifier(ch, specifiers[ch]));
     }
-
-    // copy format_items to device memory
-    d_items = cudf::detail::make_device_uvector_async(items, stream);
   }
 
-  device_span<format_item const> format_items() { return device_span<format_item const>(d_items); }
-
   [[nodiscard]] int8_t subsecond_precision() const { return specifiers.at('f'); }
 };
 
+}  // namespace
+}  // namespace detail
+
+struct datetime_format::datetime_format_impl {
+  std::vector<detail::format_item> items;            // compiled format, on the host
+  rmm::device_uvector<detail::format_item> d_items;  // compiled format, on the device
+  int8_t subsecond_precision;                        // digits of the last %f specifier
+};
+
+/**
+ * @brief Reads the compiled items of a `datetime_format`.
+ */
+struct datetime_format_reader {
+  static datetime_format::datetime_format_impl const& impl(datetime_format const& format)
+  {
+    return *format._impl;
+  }
+
+  /**
+   * @brief Compiles a format whose device copy is made on `stream`, to be used only on it.
+   */
+  static datetime_format create(std::string const& format, rmm::cuda_stream_view stream)
+  {
+    return datetime_format(format, stream);
+  }
+};
+
+std::unique_ptr<datetime_format> datetime_format::create(std::string const& format)
+{
+  auto result = std::unique_ptr<datetime_format>(
+    new datetime_format(format, rmm::cuda_stream_default));
+  // the device copy may then be used on any stream
+  rmm::cuda_stream_default.synchronize();
+  return result;
+}
+
+datetime_format::datetime_format(std::string const& format, rmm::cuda_stream_view stream)
+  : _format(format)
+{
+  CUDF_EXPECTS(!format.empty(), "Format parameter must not be empty.");
+  detail::format_compiler compiler(format);
+  auto d_items = cudf::detail::make_device_uvector_async(compiler.items, stream);
+  _impl        = std::make_unique<datetime_format_impl>(datetime_format_impl{
+    std::move(compiler.items), std::move(d_items), compiler.subsecond_precision()});
+}
+
+datetime_format::datetime_format(datetime_format&& other) noexcept = default;
+datetime_format& datetime_format::operator=(datetime_format&& other) noexcept = default;
+datetime_format::~datetime_format()                                           = default;
+
+std::string datetime_format::format() const { return _format; }
+
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the compiled items of `format` on the device, after checking that
+ * `to_timestamps` and `is_timestamp` support all its specifiers.
+ */
+device_span<format_item const> parse_format_items(datetime_format const& format)
+{
+  auto const& impl = datetime_format_reader::impl(format);
+  for (auto const& item : impl.items) {
+    CUDF_EXPECTS(item.item_type == format_char_type::literal or
+                   parse_specifiers.find(item.value) != std::string_view::npos,
+                 "invalid format specifier: " + std::string(1, item.value));
+  }
+  return impl.d_items;
+}
+
 /**
  * @brief Specialized function to return the integer value reading up to the specified
  * bytes or until an invalid character is encountered.
@@ -355,12 +424,13 @@ struct parse_datetime {
 struct dispatch_to_timestamps_fn {
   template <typename T, std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
   void operator()(column_device_view const& d_strings,
-                  std::string const& format,
+                  datetime_format const& format,
                   mutable_column_view& results_view,
                   rmm::cuda_stream_view stream) const
   {
-    format_compiler compiler(format, stream);
-    parse_datetime<T> pfn{d_strings, compiler.format_items(), compiler.subsecond_precision()};
+    auto const d_format_items = parse_format_items(format);
+    parse_datetime<T> pfn{
+      d_strings, d_format_items, datetime_format_reader::impl(format).subsecond_precision};
     thrust::transform(rmm::exec_policy(stream),
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(results_view.size()),
@@ -369,7 +439,7 @@ struct dispatch_to_timestamps_fn {
   }
   template <typename T, std::enable_if_t<not cudf::is_timestamp<T>()>* = nullptr>
   void operator()(column_device_view const&,
-                  std::string const&,
+                  datetime_format const&,
                   mutable_column_view&,
                   rmm::cuda_stream_view) const
   {
@@ -382,15 +452,13 @@ struct dispatch_to_timestamps_fn {
 //
 std::unique_ptr<cudf::column> to_timestamps(strings_column_view const& input,
                                             data_type timestamp_type,
-                                            std::string const& format,
+                                            datetime_format const& format,
                                             rmm::cuda_stream_view stream,
                                             rmm::mr::device_memory_resource* mr)
 {
   if (input.is_empty())
     return make_empty_column(timestamp_type);  // make_timestamp_column(timestamp_type, 0);
 
-  CUDF_EXPECTS(!format.empty(), "Format parameter must not be empty.");
-
   auto d_strings = column_device_view::create(input.parent(), stream);
 
   auto results = make_timestamp_column(timestamp_type,
@@ -408,6 +476,20 @@ std::unique_ptr<cudf::column> to_timestamps(strings_column_view const& input,
   return results;
 }
 
+std::unique_ptr<cudf::column> to_timestamps(strings_column_view const& input,
+                                            data_type timestamp_type,
+                                            std::string const& format,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  if (input.is_empty())
+    return make_empty_column(timestamp_type);  // make_timestamp_column(timestamp_type, 0);
+
+  CUDF_EXPECTS(!format.empty(), "Format parameter must not be empty.");
+  auto const compiled = datetime_format_reader::create(format, stream);
+  return to_timestamps(input, timestamp_type, compiled, stream, mr);
+}
+
 /**
  * @brief Functor checks the strings against the given format items.
  *
@@ -603,15 +685,13 @@ struct check_datetime_format {
 };
 
 std::unique_ptr<cudf::column> is_timestamp(strings_column_view const& input,
-                                           std::string const& format,
+                                           datetime_format const& format,
                                            rmm::cuda_stream_view stream,
                                            rmm::mr::device_memory_resource* mr)
 {
   size_type strings_count = input.size();
   if (strings_count == 0) return make_empty_column(type_id::BOOL8);
 
-  CUDF_EXPECTS(!format.empty(), "Format parameter must not be empty.");
-
   auto d_strings = column_device_view::create(input.parent(), stream);
 
   auto results   = make_numeric_column(data_type{type_id::BOOL8},
@@ -622,17 +702,28 @@ std::unique_ptr<cudf::column> is_timestamp(strings_column_view const& input,
                                      mr);
   auto d_results = results->mutable_view().data<bool>();
 
-  format_compiler compiler(format, stream);
   thrust::transform(rmm::exec_policy(stream),
                     thrust::make_counting_iterator<size_type>(0),
                     thrust::make_counting_iterator<size_type>(strings_count),
                     d_results,
-                    check_datetime_format{*d_strings, compiler.format_items()});
+                    check_datetime_format{*d_strings, parse_format_items(format)});
 
   results->set_null_count(input.null_count());
   return results;
 }
 
+std::unique_ptr<cudf::column> is_timestamp(strings_column_view const& input,
+                                           std::string const& format,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  if (input.size() == 0) return make_empty_column(type_id::BOOL8);
+
+  CUDF_EXPECTS(!format.empty(), "Format parameter must not be empty.");
+  auto const compiled = datetime_format_reader::create(format, stream);
+  return is_timestamp(input, compiled, stream, mr);
+}
+
 }  // namespace detail
 
 // external APIs
@@ -654,6 +745,23 @@ std::unique_ptr<cudf::column> is_timestamp(strings_column_view const& input,
   return detail::is_timestamp(input, format, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<cudf::column> to_timestamps(strings_column_view const& input,
+                                            data_type timestamp_type,
+                                            datetime_format const& format,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_timestamps(input, timestamp_type, format, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<cudf::column> is_timestamp(strings_column_view const& input,
+                                           datetime_format const& format,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::is_timestamp(input, format, rmm::cuda_stream_default, mr);
+}
+
 namespace detail {
 namespace {
 
@@ -1048,6 +1156,49 @@ struct datetime_formatter : public from_timestamp_base<T> {
   }
 };
 
+/**
+ * @brief Returns the number of bytes of every formatted timestamp, or nullopt if it depends on
+ * the timestamp.
+ *
+ * Only the specifiers writing strings from the format names vary in length, so formats without
+ * names or without these specifiers, as the ISO-8601 formats, are fixed-width.
+ */
+thrust::optional<size_type> fixed_format_width(std::vector<format_item> const& items,
+                                                bool has_names)
+{
+  size_type width = 0;
+  for (auto const& item : items) {
+    if (item.item_type == format_char_type::specifier) {
+      switch (item.value) {
+        case 'a':
+        case 'A':
+        case 'b':
+        case 'B':
+          // nothing is written for these without names
+          if (has_names) { return thrust::nullopt; }
+          continue;
+        case 'p':
+          if (has_names) { return thrust::nullopt; }
+          break;
+        default: break;
+      }
+    }
+    width += item.length;
+  }
+  return width;
+}
+
+// Size of each formatted timestamp of a fixed-width format, zero for null timestamps
+struct fixed_width_size_fn {
+  column_device_view const d_timestamps;
+  size_type const width;
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    return d_timestamps.is_null(idx) ? 0 : width;
+  }
+};
+
 //
 using strings_children = std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>>;
 struct dispatch_from_timestamps_fn {
@@ -1055,20 +1206,47 @@ struct dispatch_from_timestamps_fn {
   strings_children operator()(column_device_view const& d_timestamps,
                               column_device_view const& d_format_names,
                               device_span<format_item const> d_format_items,
+                              thrust::optional<size_type> fixed_width,
                               rmm::cuda_stream_view stream,
                               rmm::mr::device_memory_resource* mr) const
   {
     size_type const strings_count = d_timestamps.size();
     // build offsets column
-    auto offsets_transformer_itr = cudf::detail::make_counting_transform_iterator(
-      0, from_timestamps_size_fn<T>{d_timestamps, d_format_names, d_format_items});
-    auto offsets_column = make_offsets_child_column(
-      offsets_transformer_itr, offsets_transformer_itr + strings_count, stream, mr);
+    auto offsets_column = [&] {
+      if (!fixed_width.has_value()) {
+        auto offsets_transformer_itr = cudf::detail::make_counting_transform_iterator(
+          0, from_timestamps_size_fn<T>{d_timestamps, d_format_names, d_format_items});
+        return make_offsets_child_column(
+          offsets_transformer_itr, offsets_transformer_itr + strings_count, stream, mr);
+      }
+      auto const width = fixed_width.value();
+      if (d_timestamps.nullable()) {
+        auto offsets_transformer_itr = cudf::detail::make_counting_transform_iterator(
+          0, fixed_width_size_fn{d_timestamps, width});
+        return make_offsets_child_column(
+          offsets_transformer_itr, offsets_transformer_itr + strings_count, stream, mr);
+      }
+      // every string has the same length, so no pass is needed to size them
+      CUDF_EXPECTS(static_cast<int64_t>(width) * strings_count <
+                     static_cast<int64_t>(std::numeric_limits<size_type>::max()),
+                   "Size of output exceeds column size limit");
+      auto offsets = make_numeric_column(data_type{type_id::INT32},
+                                         strings_count + 1,
+                                         mask_state::UNALLOCATED,
+                                         stream,
+                                         mr);
+      auto d_new_offsets = offsets->mutable_view().template data<offset_type>();
+      thrust::sequence(
+        rmm::exec_policy(stream), d_new_offsets, d_new_offsets + strings_count + 1, 0, width);
+      return offsets;
+    }();
     auto d_offsets = offsets_column->mutable_view().template data<offset_type>();
 
     // build chars column
     auto const bytes =
-      cudf::detail::get_value<offset_type>(offsets_column->view(), strings_count, stream);
+      fixed_width.has_value() && !d_timestamps.nullable()
+        ? fixed_width.value() * strings_count
+        : cudf::detail::get_value<offset_type>(offsets_column->view(), strings_count, stream);
     auto chars_column = create_chars_child_column(bytes, stream, mr);
     auto d_chars      = chars_column->mutable_view().template data<char>();
 
@@ -1091,26 +1269,21 @@ struct dispatch_from_timestamps_fn {
 
 //
 std::unique_ptr<column> from_timestamps(column_view const& timestamps,
-                                        std::string const& format,
+                                        datetime_format const& format,
                                         strings_column_view const& names,
                                         rmm::cuda_stream_view stream,
                                         rmm::mr::device_memory_resource* mr)
 {
   if (timestamps.is_empty()) return make_empty_column(type_id::STRING);
 
-  CUDF_EXPECTS(!format.empty(), "Format parameter must not be empty.");
   CUDF_EXPECTS(names.is_empty() || names.size() == format_names_size,
                "Invalid size for format names.");
 
   auto const d_names = column_device_view::create(names.parent(), stream);
 
-  // This API supports a few more specifiers than to_timestamps.
-  // clang-format off
-  format_compiler compiler(format, stream,
-    specifier_map{{'w', 1}, {'W', 2}, {'u', 1}, {'U', 2}, {'V', 2}, {'G', 4},
-                  {'a', 3}, {'A', 3}, {'b', 3}, {'B', 3}});
-  // clang-format on
-  auto const d_format_items = compiler.format_items();
+  auto const& impl          = datetime_format_reader::impl(format);
+  auto const fixed_width    = fixed_format_width(impl.items, !names.is_empty());
+  auto const d_format_items = device_span<format_item const>(impl.d_items);
   auto const d_timestamps   = column_device_view::create(timestamps, stream);
 
   // dispatcher is called to handle the different timestamp types
@@ -1119,6 +1292,7 @@ std::unique_ptr<column> from_timestamps(column_view const& timestamps,
                                                               *d_timestamps,
                                                               *d_names,
                                                               d_format_items,
+                                                              fixed_width,
                                                               stream,
                                                               mr);
 
@@ -1129,6 +1303,19 @@ std::unique_ptr<column> from_timestamps(column_view const& timestamps,
                              cudf::detail::copy_bitmask(timestamps, stream, mr));
 }
 
+std::unique_ptr<column> from_timestamps(column_view const& timestamps,
+                                        std::string const& format,
+                                        strings_column_view const& names,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  if (timestamps.is_empty()) return make_empty_column(type_id::STRING);
+
+  CUDF_EXPECTS(!format.empty(), "Format parameter must not be empty.");
+  auto const compiled = datetime_format_reader::create(format, stream);
+  return from_timestamps(timestamps, compiled, names, stream, mr);
+}
+
 }  // namespace detail
 
 // external API
@@ -1142,5 +1329,14 @@ std::unique_ptr<column> from_timestamps(column_view const& timestamps,
   return detail::from_timestamps(timestamps, format, names, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> from_timestamps(column_view const& timestamps,
+                                        datetime_format const& format,
+                                        strings_column_view const& names,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::from_timestamps(timestamps, format, names, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
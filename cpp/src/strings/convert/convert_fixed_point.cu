@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -94,32 +94,7 @@ struct string_to_decimal_check_fn {
   {
     if (d_strings.is_null(idx)) { return false; }
     auto const d_str = d_strings.element<string_view>(idx);
-    if (d_str.empty()) { return false; }
-
-    auto iter = d_str.data() + static_cast<int>((d_str.data()[0] == '-' || d_str.data()[0] == '+'));
-
-    auto const iter_end = d_str.data() + d_str.size_bytes();
-
-    using UnsignedDecimalType = cuda::std::make_unsigned_t<DecimalType>;
-    auto [value, exp_offset]  = parse_integer<UnsignedDecimalType>(iter, iter_end);
-
-    // only exponent notation is expected here
-    if ((iter < iter_end) && (*iter != 'e' && *iter != 'E')) { return false; }
-    ++iter;
-
-    int32_t exp_ten = 0;  // check exponent overflow
-    if (iter < iter_end) {
-      auto exp_result = parse_exponent<true>(iter, iter_end);
-      if (!exp_result) { return false; }
-      exp_ten = exp_result.value();
-    }
-    exp_ten += exp_offset;
-
-    // finally, check for overflow based on the exp_ten and scale values
-    return (exp_ten < scale) or
-           value <= static_cast<UnsignedDecimalType>(
-                      cuda::std::numeric_limits<DecimalType>::max() /
-                      static_cast<DecimalType>(exp10(static_cast<double>(exp_ten - scale))));
+    return is_parsable_decimal<DecimalType>(d_str.data(), d_str.data() + d_str.size_bytes(), scale);
   }
 };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,10 +14,13 @@
  * limitations under the License.
  */
 
+#include <strings/convert/utilities.cuh>
+
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/strings/convert/convert_floats.hpp>
 #include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/detail/utilities.cuh>
@@ -29,8 +32,10 @@
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform.h>
 
@@ -41,99 +46,6 @@ namespace cudf {
 namespace strings {
 namespace detail {
 namespace {
-/**
- * @brief This function converts the given string into a
- * floating point double value.
- *
- * This will also map strings containing "NaN", "Inf", etc.
- * to the appropriate float values.
- *
- * This function will also handle scientific notation format.
- */
-__device__ inline double stod(string_view const& d_str)
-{
-  const char* in_ptr = d_str.data();
-  const char* end    = in_ptr + d_str.size_bytes();
-  if (end == in_ptr) return 0.0;
-  double sign{1.0};
-  if (*in_ptr == '-' || *in_ptr == '+') {
-    sign = (*in_ptr == '-' ? -1 : 1);
-    ++in_ptr;
-  }
-
-  // special strings: NaN, Inf
-  if ((in_ptr < end) && *in_ptr > '9') {
-    auto const inf_nan = string_view(in_ptr, static_cast<size_type>(thrust::distance(in_ptr, end)));
-    if (string::is_nan_str(inf_nan)) return std::numeric_limits<double>::quiet_NaN();
-    if (string::is_inf_str(inf_nan)) return sign * std::numeric_limits<double>::infinity();
-  }
-
-  // Parse and store the mantissa as much as we can,
-  // until we are about to exceed the limit of uint64_t
-  constexpr uint64_t max_holding = (std::numeric_limits<uint64_t>::max() - 9L) / 10L;
-  uint64_t digits                = 0;
-  int exp_off                    = 0;
-  bool decimal                   = false;
-  while (in_ptr < end) {
-    char ch = *in_ptr;
-    if (ch == '.') {
-      decimal = true;
-      ++in_ptr;
-      continue;
-    }
-    if (ch < '0' || ch > '9') break;
-    if (digits > max_holding)
-      exp_off += (int)!decimal;
-    else {
-      digits = (digits * 10L) + static_cast<uint64_t>(ch - '0');
-      if (digits > max_holding) {
-        digits = digits / 10L;
-        exp_off += (int)!decimal;
-      } else
-        exp_off -= (int)decimal;
-    }
-    ++in_ptr;
-  }
-  if (digits == 0) return sign * static_cast<double>(0);
-
-  // check for exponent char
-  int exp_ten  = 0;
-  int exp_sign = 1;
-  if (in_ptr < end) {
-    char ch = *in_ptr++;
-    if (ch == 'e' || ch == 'E') {
-      if (in_ptr < end) {
-        ch = *in_ptr;
-        if (ch == '-' || ch == '+') {
-          exp_sign = (ch == '-' ? -1 : 1);
-          ++in_ptr;
-        }
-        while (in_ptr < end) {
-          ch = *in_ptr++;
-          if (ch < '0' || ch > '9') break;
-          exp_ten = (exp_ten * 10) + (int)(ch - '0');
-        }
-      }
-    }
-  }
-
-  int const num_digits = static_cast<int>(log10(digits)) + 1;
-  exp_ten *= exp_sign;
-  exp_ten += exp_off;
-  exp_ten += num_digits - 1;
-  if (exp_ten > std::numeric_limits<double>::max_exponent10)
-    return sign > 0 ? std::numeric_limits<double>::infinity()
-                    : -std::numeric_limits<double>::infinity();
-  else if (exp_ten < std::numeric_limits<double>::min_exponent10)
-    return double{0};
-
-  // exp10() is faster than pow(10.0,exp_ten)
-  double const base =
-    sign * static_cast<double>(digits) * exp10(static_cast<double>(1 - num_digits));
-  double const exponent = exp10(static_cast<double>(exp_ten));
-  return base * exponent;
-}
-
 /**
  * @brief Converts strings column entries into floats.
  *
@@ -217,6 +129,92 @@ std::unique_ptr<column> to_floats(strings_column_view const& strings,
   return detail::to_floats(strings, output_type, rmm::cuda_stream_default, mr);
 }
 
+namespace detail {
+namespace {
+/**
+ * @brief Converts strings into floats, returning whether each string is valid as `is_float`
+ * checks it.
+ *
+ * The invalid strings are set to 0.
+ */
+template <typename FloatType>
+struct string_to_float_or_null_fn {
+  column_device_view const d_strings;
+  FloatType* d_results;
+
+  __device__ bool operator()(size_type idx) const
+  {
+    if (d_strings.is_null(idx)) {
+      d_results[idx] = FloatType{0};
+      return false;
+    }
+    auto const d_str = d_strings.element<string_view>(idx);
+    auto const valid = string::is_float(d_str);
+    d_results[idx]   = valid ? static_cast<FloatType>(stod(d_str)) : FloatType{0};
+    return valid;
+  }
+};
+
+/**
+ * @brief The dispatch functions for converting strings to floats with nulls for the invalid
+ * strings.
+ */
+struct dispatch_to_floats_or_null_fn {
+  template <typename FloatType,
+            std::enable_if_t<std::is_floating_point<FloatType>::value>* = nullptr>
+  std::unique_ptr<column> operator()(strings_column_view const& strings,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr) const
+  {
+    auto const d_strings = column_device_view::create(strings.parent(), stream);
+    auto results         = make_numeric_column(data_type{type_to_id<FloatType>()},
+                                       strings.size(),
+                                       mask_state::UNALLOCATED,
+                                       stream,
+                                       mr);
+    // each string is checked and converted at once
+    rmm::device_uvector<bool> valids(strings.size(), stream);
+    thrust::transform(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(strings.size()),
+      valids.begin(),
+      string_to_float_or_null_fn<FloatType>{*d_strings, results->mutable_view().data<FloatType>()});
+    auto [null_mask, null_count] = cudf::detail::valid_if(
+      valids.begin(), valids.end(), thrust::identity<bool>{}, stream, mr);
+    results->set_null_mask(std::move(null_mask), null_count);
+    return results;
+  }
+
+  template <typename T, std::enable_if_t<not std::is_floating_point<T>::value>* = nullptr>
+  std::unique_ptr<column> operator()(strings_column_view const&,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*) const
+  {
+    CUDF_FAIL("Output for to_floats_or_null must be a float type.");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> to_floats_or_null(strings_column_view const& strings,
+                                          data_type output_type,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  return type_dispatcher(output_type, dispatch_to_floats_or_null_fn{}, strings, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> to_floats_or_null(strings_column_view const& strings,
+                                          data_type output_type,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_floats_or_null(strings, output_type, rmm::cuda_stream_default, mr);
+}
+
 namespace detail {
 namespace {
 /**
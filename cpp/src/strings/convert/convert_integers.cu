@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/strings/convert/convert_integers.hpp>
 #include <cudf/strings/detail/converters.hpp>
@@ -30,8 +31,10 @@
 #include <strings/convert/utilities.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform.h>
 
@@ -48,33 +51,8 @@ template <typename IntegerType>
 struct string_to_integer_check_fn {
   __device__ bool operator()(thrust::pair<string_view, bool> const& p) const
   {
-    if (!p.second || p.first.empty()) { return false; }
-
-    auto const d_str = p.first.data();
-    if (d_str[0] == '-' && std::is_unsigned<IntegerType>::value) { return false; }
-
-    auto iter           = d_str + static_cast<int>((d_str[0] == '-' || d_str[0] == '+'));
-    auto const iter_end = d_str + p.first.size_bytes();
-    if (iter == iter_end) { return false; }
-
-    auto const sign = d_str[0] == '-' ? IntegerType{-1} : IntegerType{1};
-    auto const bound_val =
-      sign > 0 ? std::numeric_limits<IntegerType>::max() : std::numeric_limits<IntegerType>::min();
-
-    IntegerType value = 0;      // parse the string to integer and check for overflow along the way
-    while (iter != iter_end) {  // check all bytes for valid characters
-      auto const chr = *iter++;
-      // Check for valid character
-      if (chr < '0' || chr > '9') { return false; }
-
-      // Check for underflow and overflow:
-      auto const digit       = static_cast<IntegerType>(chr - '0');
-      auto const bound_check = (bound_val - sign * digit) / IntegerType{10} * sign;
-      if (value > bound_check) return false;
-      value = value * IntegerType{10} + digit;
-    }
-
-    return true;
+    IntegerType value;
+    return p.second && string_to_integer_checked(p.first, value);
   }
 };
 
@@ -284,6 +262,92 @@ std::unique_ptr<column> to_integers(strings_column_view const& strings,
   return detail::to_integers(strings, output_type, rmm::cuda_stream_default, mr);
 }
 
+namespace detail {
+namespace {
+/**
+ * @brief Converts strings into integers, returning whether each string is a valid integer of
+ * the type.
+ *
+ * The invalid strings are set to 0.
+ */
+template <typename IntegerType>
+struct string_to_integer_or_null_fn {
+  column_device_view const d_strings;
+  IntegerType* d_results;
+
+  __device__ bool operator()(size_type idx) const
+  {
+    IntegerType value{0};
+    auto const valid = d_strings.is_valid(idx) &&
+                       string_to_integer_checked(d_strings.element<string_view>(idx), value);
+    d_results[idx] = valid ? value : IntegerType{0};
+    return valid;
+  }
+};
+
+/**
+ * @brief The dispatch functions for converting strings to integers with nulls for the invalid
+ * strings.
+ */
+struct dispatch_to_integers_or_null_fn {
+  template <typename IntegerType,
+            std::enable_if_t<std::is_integral<IntegerType>::value and
+                             not std::is_same_v<IntegerType, bool>>* = nullptr>
+  std::unique_ptr<column> operator()(strings_column_view const& strings,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr) const
+  {
+    auto const d_strings = column_device_view::create(strings.parent(), stream);
+    auto results         = make_numeric_column(data_type{type_to_id<IntegerType>()},
+                                       strings.size(),
+                                       mask_state::UNALLOCATED,
+                                       stream,
+                                       mr);
+    // each string is checked and converted at once
+    rmm::device_uvector<bool> valids(strings.size(), stream);
+    thrust::transform(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(strings.size()),
+      valids.begin(),
+      string_to_integer_or_null_fn<IntegerType>{*d_strings,
+                                                results->mutable_view().data<IntegerType>()});
+    auto [null_mask, null_count] = cudf::detail::valid_if(
+      valids.begin(), valids.end(), thrust::identity<bool>{}, stream, mr);
+    results->set_null_mask(std::move(null_mask), null_count);
+    return results;
+  }
+
+  template <typename T,
+            std::enable_if_t<not std::is_integral<T>::value or std::is_same_v<T, bool>>* = nullptr>
+  std::unique_ptr<column> operator()(strings_column_view const&,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*) const
+  {
+    CUDF_FAIL("Output for to_integers_or_null must be an integral type other than boolean.");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> to_integers_or_null(strings_column_view const& strings,
+                                            data_type output_type,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  return type_dispatcher(output_type, dispatch_to_integers_or_null_fn{}, strings, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> to_integers_or_null(strings_column_view const& strings,
+                                            data_type output_type,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_integers_or_null(strings, output_type, rmm::cuda_stream_default, mr);
+}
+
 namespace detail {
 namespace {
 /**
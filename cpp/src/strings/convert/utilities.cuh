@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,12 +16,57 @@
 #pragma once
 
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/strings/string.cuh>
 #include <cudf/strings/string_view.cuh>
 
+#include <thrust/distance.h>
+
+#include <cmath>
+#include <limits>
+
 namespace cudf {
 namespace strings {
 namespace detail {
 
+/**
+ * @brief Returns the 8 bytes at `ptr` as an integer with the first byte in its lowest bits.
+ */
+__device__ inline uint64_t load_eight_bytes(char const* ptr)
+{
+  uint64_t chunk;
+  memcpy(&chunk, ptr, sizeof(chunk));
+  return chunk;
+}
+
+/**
+ * @brief Returns whether all the 8 bytes loaded by `load_eight_bytes` are [0-9] characters.
+ *
+ * Adding 6 to each byte only keeps the high nibble of the digits at 3, so the bytes are all
+ * digits when both their high nibble and that of the sum are 3.
+ */
+__device__ inline bool is_eight_digits(uint64_t chunk)
+{
+  return ((chunk & 0xF0F0F0F0F0F0F0F0) |
+          (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+}
+
+/**
+ * @brief Returns the value of the 8 digits loaded by `load_eight_bytes`.
+ *
+ * The digits are combined in pairs, then in groups of four and then all together, each step
+ * with a single multiplication of the whole register.
+ */
+__device__ inline uint32_t eight_digits_to_integer(uint64_t chunk)
+{
+  constexpr uint64_t mask   = 0x000000FF000000FF;
+  constexpr uint64_t mul100 = 100 + (1000000ULL << 32);
+  constexpr uint64_t mul1   = 1 + (10000ULL << 32);
+  chunk -= 0x3030303030303030;
+  chunk = (chunk * 10) + (chunk >> 8);
+  chunk = (((chunk & mask) * mul100) + (((chunk >> 16) & mask) * mul1)) >> 32;
+  return static_cast<uint32_t>(chunk);
+}
+
 /**
  * @brief Converts a single string into an integer.
  *
@@ -32,9 +77,9 @@ namespace detail {
  */
 __device__ inline int64_t string_to_integer(string_view const& d_str)
 {
-  int64_t value   = 0;
+  uint64_t value  = 0;  // wraps around as the int64 value would
   size_type bytes = d_str.size_bytes();
-  if (bytes == 0) return value;
+  if (bytes == 0) return 0;
   const char* ptr = d_str.data();
   int sign        = 1;
   if (*ptr == '-' || *ptr == '+') {
@@ -42,12 +87,67 @@ __device__ inline int64_t string_to_integer(string_view const& d_str)
     ++ptr;
     --bytes;
   }
-  for (size_type idx = 0; idx < bytes; ++idx) {
-    char chr = *ptr++;
+  const char* const end = ptr + bytes;
+  // convert the digits 8 at a time while there are enough of them
+  while (end - ptr >= 8) {
+    auto const chunk = load_eight_bytes(ptr);
+    if (!is_eight_digits(chunk)) break;
+    value = (value * 100000000) + eight_digits_to_integer(chunk);
+    ptr += 8;
+  }
+  for (; ptr < end; ++ptr) {
+    char chr = *ptr;
     if (chr < '0' || chr > '9') break;
-    value = (value * 10) + static_cast<int64_t>(chr - '0');
+    value = (value * 10) + static_cast<uint64_t>(chr - '0');
+  }
+  return static_cast<int64_t>(sign < 0 ? 0 - value : value);
+}
+
+/**
+ * @brief Converts a single string into an integer of type `IntegerType`, checking that it is
+ * valid as `is_integer` with the `IntegerType` type does.
+ *
+ * @tparam IntegerType Integer type of the value
+ * @param d_str String to convert
+ * @param[out] value The converted value, when the string is valid
+ * @return Whether the string is a valid integer of type `IntegerType`
+ */
+template <typename IntegerType>
+__device__ inline bool string_to_integer_checked(string_view const& d_str, IntegerType& value)
+{
+  const char* ptr       = d_str.data();
+  const char* const end = ptr + d_str.size_bytes();
+  if (ptr == end) { return false; }
+  bool const negative = *ptr == '-';
+  if (negative && cuda::std::is_unsigned<IntegerType>()) { return false; }
+  ptr += static_cast<int>(negative || *ptr == '+');
+  if (ptr == end) { return false; }
+
+  // the leading zeros aside, the values of 64-bit integers have at most 20 digits
+  while (ptr < end && *ptr == '0')
+    ++ptr;
+  if (end - ptr > cuda::std::numeric_limits<uint64_t>::digits10 + 1) { return false; }
+  uint64_t magnitude = 0;
+  while (end - ptr >= 8) {  // at most twice, so this cannot overflow
+    auto const chunk = load_eight_bytes(ptr);
+    if (!is_eight_digits(chunk)) { return false; }
+    magnitude = (magnitude * 100000000) + eight_digits_to_integer(chunk);
+    ptr += 8;
   }
-  return value * static_cast<int64_t>(sign);
+  for (; ptr < end; ++ptr) {
+    auto const chr = *ptr;
+    if (chr < '0' || chr > '9') { return false; }
+    auto const digit = static_cast<uint64_t>(chr - '0');
+    if (magnitude > (cuda::std::numeric_limits<uint64_t>::max() - digit) / 10) { return false; }
+    magnitude = (magnitude * 10) + digit;
+  }
+
+  auto const limit =
+    negative ? static_cast<uint64_t>(-(cuda::std::numeric_limits<IntegerType>::min() + 1)) + 1
+             : static_cast<uint64_t>(cuda::std::numeric_limits<IntegerType>::max());
+  if (magnitude > limit) { return false; }
+  value = static_cast<IntegerType>(negative ? 0 - magnitude : magnitude);
+  return true;
 }
 
 /**
@@ -120,6 +220,110 @@ constexpr size_type count_digits(IntegerType value)
   return digits + static_cast<size_type>(is_negative);
 }
 
+/**
+ * @brief This function converts the given string into a
+ * floating point double value.
+ *
+ * This will also map strings containing "NaN", "Inf", etc.
+ * to the appropriate float values.
+ *
+ * This function will also handle scientific notation format.
+ */
+__device__ inline double stod(string_view const& d_str)
+{
+  const char* in_ptr = d_str.data();
+  const char* end    = in_ptr + d_str.size_bytes();
+  if (end == in_ptr) return 0.0;
+  double sign{1.0};
+  if (*in_ptr == '-' || *in_ptr == '+') {
+    sign = (*in_ptr == '-' ? -1 : 1);
+    ++in_ptr;
+  }
+
+  // special strings: NaN, Inf
+  if ((in_ptr < end) && *in_ptr > '9') {
+    auto const inf_nan = string_view(in_ptr, static_cast<size_type>(thrust::distance(in_ptr, end)));
+    if (string::is_nan_str(inf_nan)) return std::numeric_limits<double>::quiet_NaN();
+    if (string::is_inf_str(inf_nan)) return sign * std::numeric_limits<double>::infinity();
+  }
+
+  // Parse and store the mantissa as much as we can,
+  // until we are about to exceed the limit of uint64_t
+  constexpr uint64_t max_holding = (std::numeric_limits<uint64_t>::max() - 9L) / 10L;
+  // limit below which 8 more digits can be added without exceeding max_holding
+  constexpr uint64_t max_eight_holding = (max_holding - 99999999L) / 100000000L;
+  uint64_t digits                      = 0;
+  int exp_off                          = 0;
+  bool decimal                         = false;
+  while (in_ptr < end) {
+    if (end - in_ptr >= 8 && digits <= max_eight_holding) {
+      auto const chunk = load_eight_bytes(in_ptr);
+      if (is_eight_digits(chunk)) {
+        digits = (digits * 100000000L) + eight_digits_to_integer(chunk);
+        exp_off -= 8 * static_cast<int>(decimal);
+        in_ptr += 8;
+        continue;
+      }
+    }
+    char ch = *in_ptr;
+    if (ch == '.') {
+      decimal = true;
+      ++in_ptr;
+      continue;
+    }
+    if (ch < '0' || ch > '9') break;
+    if (digits > max_holding)
+      exp_off += (int)!decimal;
+    else {
+      digits = (digits * 10L) + static_cast<uint64_t>(ch - '0');
+      if (digits > max_holding) {
+        digits = digits / 10L;
+        exp_off += (int)!decimal;
+      } else
+        exp_off -= (int)decimal;
+    }
+    ++in_ptr;
+  }
+  if (digits == 0) return sign * static_cast<double>(0);
+
+  // check for exponent char
+  int exp_ten  = 0;
+  int exp_sign = 1;
+  if (in_ptr < end) {
+    char ch = *in_ptr++;
+    if (ch == 'e' || ch == 'E') {
+      if (in_ptr < end) {
+        ch = *in_ptr;
+        if (ch == '-' || ch == '+') {
+          exp_sign = (ch == '-' ? -1 : 1);
+          ++in_ptr;
+        }
+        while (in_ptr < end) {
+          ch = *in_ptr++;
+          if (ch < '0' || ch > '9') break;
+          exp_ten = (exp_ten * 10) + (int)(ch - '0');
+        }
+      }
+    }
+  }
+
+  int const num_digits = static_cast<int>(log10(digits)) + 1;
+  exp_ten *= exp_sign;
+  exp_ten += exp_off;
+  exp_ten += num_digits - 1;
+  if (exp_ten > std::numeric_limits<double>::max_exponent10)
+    return sign > 0 ? std::numeric_limits<double>::infinity()
+                    : -std::numeric_limits<double>::infinity();
+  else if (exp_ten < std::numeric_limits<double>::min_exponent10)
+    return double{0};
+
+  // exp10() is faster than pow(10.0,exp_ten)
+  double const base =
+    sign * static_cast<double>(digits) * exp10(static_cast<double>(1 - num_digits));
+  double const exponent = exp10(static_cast<double>(exp_ten));
+  return base * exponent;
+}
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
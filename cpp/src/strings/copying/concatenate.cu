@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,8 +16,8 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
-#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/utilities/batched_memcpy.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/strings/detail/concatenate.hpp>
@@ -27,28 +27,18 @@
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/binary_search.h>
 #include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform_scan.h>
 
 namespace cudf {
 namespace strings {
 namespace detail {
-// Benchmark data, shared at https://github.com/rapidsai/cudf/pull/4703, shows
-// that the single kernel optimization generally performs better, but when the
-// number of chars/col is beyond a certain threshold memcpy performs better.
-// This heuristic estimates which strategy will give better performance by
-// comparing the mean chars/col with values from the above table.
-constexpr bool use_fused_kernel_heuristic(bool const has_nulls,
-                                          size_t const total_bytes,
-                                          size_t const num_columns)
-{
-  return has_nulls ? total_bytes < num_columns * 1572864  // midpoint of 1048576 and 2097152
-                   : total_bytes < num_columns * 393216;  // midpoint of 262144 and 524288
-}
-
 // Using a functor instead of a lambda as a workaround for:
 // error: The enclosing parent function ("create_strings_device_views") for an
 // extended __device__ lambda must not have deduced return type
@@ -168,36 +158,42 @@ __global__ void fused_concatenate_string_offset_kernel(column_device_view const*
   }
 }
 
-__global__ void fused_concatenate_string_chars_kernel(column_device_view const* input_views,
-                                                      size_t const* partition_offsets,
-                                                      size_type const num_input_views,
-                                                      size_type const output_size,
-                                                      char* output_data)
+/**
+ * @brief Copies the chars of all the columns with a single batched memcpy.
+ */
+void copy_chars(column_device_view const* input_views,
+                size_t const* partition_offsets,
+                size_type const num_input_views,
+                char* output_data,
+                rmm::cuda_stream_view stream)
 {
-  size_type output_index = threadIdx.x + blockIdx.x * blockDim.x;
-
-  while (output_index < output_size) {
-    // Lookup input index by searching for output index in offsets
-    // thrust::prev isn't in CUDA 10.0, so subtracting 1 here instead
-    auto const offset_it =
-      -1 + thrust::upper_bound(
-             thrust::seq, partition_offsets, partition_offsets + num_input_views, output_index);
-    size_type const partition_index = offset_it - partition_offsets;
-
-    auto const offset_index = output_index - *offset_it;
-    auto const& input_view  = input_views[partition_index];
-
-    constexpr auto offsets_child   = strings_column_view::offsets_column_index;
-    auto const* input_offsets_data = input_view.child(offsets_child).data<int32_t>();
-
-    constexpr auto chars_child   = strings_column_view::chars_column_index;
-    auto const* input_chars_data = input_view.child(chars_child).data<char>();
-
-    auto const first_char     = input_offsets_data[input_view.offset()];
-    output_data[output_index] = input_chars_data[offset_index + first_char];
-
-    output_index += blockDim.x * gridDim.x;
-  }
+  rmm::device_uvector<uint8_t*> dst_bufs(num_input_views, stream);
+  rmm::device_uvector<uint8_t const*> src_bufs(num_input_views, stream);
+  rmm::device_uvector<std::size_t> buf_sizes(num_input_views, stream);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_input_views,
+    [input_views,
+     partition_offsets,
+     output_data,
+     dst_bufs  = dst_bufs.data(),
+     src_bufs  = src_bufs.data(),
+     buf_sizes = buf_sizes.data()] __device__(size_type i) {
+      auto const& input_view = input_views[i];
+      buf_sizes[i]           = partition_offsets[i + 1] - partition_offsets[i];
+      dst_bufs[i]            = reinterpret_cast<uint8_t*>(output_data + partition_offsets[i]);
+      src_bufs[i]            = nullptr;
+      // empty column may not have children
+      if (buf_sizes[i] == 0) { return; }
+      constexpr auto offsets_child = strings_column_view::offsets_column_index;
+      constexpr auto chars_child   = strings_column_view::chars_column_index;
+      auto const first_char =
+        input_view.child(offsets_child).data<int32_t>()[input_view.offset()];
+      src_bufs[i] =
+        reinterpret_cast<uint8_t const*>(input_view.child(chars_child).data<char>() + first_char);
+    });
+  cudf::detail::batched_memcpy(dst_bufs, src_bufs, buf_sizes, stream);
 }
 
 std::unique_ptr<column> concatenate(host_span<column_view const> columns,
@@ -262,45 +258,13 @@ std::unique_ptr<column> concatenate(host_span<column_view const> columns,
     if (has_nulls) { null_count = strings_count - d_valid_count.value(stream); }
   }
 
+  // Copy chars columns with a single batched memcpy
   if (total_bytes > 0) {
-    // Use a heuristic to guess when the fused kernel will be faster than memcpy
-    if (use_fused_kernel_heuristic(has_nulls, total_bytes, columns.size())) {
-      // Use single kernel launch to copy chars columns
-      constexpr size_type block_size{256};
-      cudf::detail::grid_1d config(total_bytes, block_size);
-      auto const kernel = fused_concatenate_string_chars_kernel;
-      kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
-        d_views,
-        d_partition_offsets.data(),
-        static_cast<size_type>(columns.size()),
-        total_bytes,
-        d_new_chars);
-    } else {
-      // Memcpy each input chars column (more efficient for very large strings)
-      for (auto column = columns.begin(); column != columns.end(); ++column) {
-        size_type column_size = column->size();
-        if (column_size == 0)  // nothing to do
-          continue;            // empty column may not have children
-        size_type column_offset   = column->offset();
-        column_view offsets_child = column->child(strings_column_view::offsets_column_index);
-        column_view chars_child   = column->child(strings_column_view::chars_column_index);
-
-        auto bytes_offset =
-          cudf::detail::get_value<offset_type>(offsets_child, column_offset, stream);
-
-        // copy the chars column data
-        auto d_chars = chars_child.data<char>() + bytes_offset;
-        auto const bytes =
-          cudf::detail::get_value<offset_type>(offsets_child, column_size + column_offset, stream) -
-          bytes_offset;
-
-        CUDA_TRY(
-          cudaMemcpyAsync(d_new_chars, d_chars, bytes, cudaMemcpyDeviceToDevice, stream.value()));
-
-        // get ready for the next column
-        d_new_chars += bytes;
-      }
-    }
+    copy_chars(d_views,
+               d_partition_offsets.data(),
+               static_cast<size_type>(columns.size()),
+               d_new_chars,
+               stream);
   }
 
   return make_strings_column(strings_count,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -82,7 +82,7 @@ struct extract_fn {
 //
 std::unique_ptr<table> extract(
   strings_column_view const& strings,
-  std::string const& pattern,
+  regex_program const& prog,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
@@ -90,9 +90,8 @@ std::unique_ptr<table> extract(
   auto const strings_column = column_device_view::create(strings.parent(), stream);
   auto const d_strings      = *strings_column;
 
-  // compile regex into device object
-  auto prog   = reprog_device::create(pattern, get_character_flags_table(), strings_count, stream);
-  auto d_prog = *prog;
+  // get the device object of the compiled regex
+  auto d_prog = regex_device_builder::create_prog_device(prog, strings_count, stream);
   // extract should include groups
   auto const groups = d_prog.group_counts();
   CUDF_EXPECTS(groups > 0, "Group indicators not found in regex pattern");
@@ -144,6 +143,16 @@ std::unique_ptr<table> extract(
   return std::make_unique<table>(std::move(results));
 }
 
+std::unique_ptr<table> extract(
+  strings_column_view const& strings,
+  std::string const& pattern,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  auto const prog = regex_program::create(pattern, regex_flags::MULTILINE);
+  return extract(strings, *prog, stream, mr);
+}
+
 }  // namespace detail
 
 // external API
@@ -156,5 +165,13 @@ std::unique_ptr<table> extract(strings_column_view const& strings,
   return detail::extract(strings, pattern, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<table> extract(strings_column_view const& strings,
+                               regex_program const& prog,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::extract(strings, prog, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
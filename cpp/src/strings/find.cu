@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,8 +16,11 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/find.hpp>
@@ -30,10 +33,192 @@
 
 #include <thrust/transform.h>
 
+#include <algorithm>
+
 namespace cudf {
 namespace strings {
 namespace detail {
 namespace {
+
+/**
+ * @brief Average string byte-length threshold for deciding between a thread per string and
+ * a warp per string to search the strings.
+ */
+constexpr size_type BYTES_PER_VALID_ROW_THRESHOLD = 64;
+
+/**
+ * @brief Number of warps in the threadblocks of the warp-parallel kernels.
+ */
+constexpr int WARPS_PER_BLOCK = 8;
+
+/**
+ * @brief Returns whether the valid strings of the column are long enough, on average, to be
+ * searched by a warp per string.
+ */
+bool is_warp_parallel(strings_column_view const& strings, rmm::cuda_stream_view stream)
+{
+  auto const valid_count = strings.size() - strings.null_count();
+  if (valid_count == 0) return false;
+  auto const chars_bytes =
+    cudf::detail::get_value<offset_type>(
+      strings.offsets(), strings.offset() + strings.size(), stream) -
+    cudf::detail::get_value<offset_type>(strings.offsets(), strings.offset(), stream);
+  return chars_bytes / valid_count >= BYTES_PER_VALID_ROW_THRESHOLD;
+}
+
+/**
+ * @brief Returns the number of characters in the first `bytes` bytes of `d_str`.
+ *
+ * All the threads of the warp must call this function with the same arguments.
+ */
+__device__ size_type warp_count_characters(string_view d_str, size_type bytes, int lane_idx)
+{
+  size_type count = 0;
+  for (size_type base = 0; base < bytes; base += cudf::detail::warp_size) {
+    auto const idx = base + lane_idx;
+    count += __popc(__ballot_sync(
+      0xFFFFFFFF, idx < bytes && is_begin_utf8_char(static_cast<uint8_t>(d_str.data()[idx]))));
+  }
+  return count;
+}
+
+/**
+ * @brief Returns the byte offset of the character at `char_pos` in `d_str`, or the size of the
+ * string if it has no such character.
+ *
+ * All the threads of the warp must call this function with the same arguments.
+ */
+__device__ size_type warp_byte_offset(string_view d_str, size_type char_pos, int lane_idx)
+{
+  auto const bytes = d_str.size_bytes();
+  size_type count  = 0;
+  for (size_type base = 0; base < bytes; base += cudf::detail::warp_size) {
+    auto const idx = base + lane_idx;
+    auto mask      = __ballot_sync(
+      0xFFFFFFFF, idx < bytes && is_begin_utf8_char(static_cast<uint8_t>(d_str.data()[idx])));
+    auto const skip = char_pos - count;
+    count += __popc(mask);
+    if (count > char_pos) {
+      // drop the characters before `char_pos` to find its byte among those of the warp
+      for (auto n = 0; n < skip; ++n)
+        mask &= mask - 1;
+      return base + __ffs(mask) - 1;
+    }
+  }
+  return bytes;
+}
+
+/**
+ * @brief Returns the byte offset of the first, or last, occurrence of `d_target` within the
+ * bytes `[spos, epos)` of `d_str`, or -1 if not found.
+ *
+ * Each round checks a match at the consecutive positions assigned to the threads of the warp,
+ * and the search stops at the first round with a match.
+ * All the threads of the warp must call this function with the same arguments.
+ */
+__device__ size_type warp_find(string_view d_str,
+                               string_view d_target,
+                               size_type spos,
+                               size_type epos,
+                               bool forward,
+                               int lane_idx)
+{
+  auto const bytes       = d_target.size_bytes();
+  auto const last        = epos - bytes;  // last position a match can start at
+  auto const is_match_at = [d_str, d_target, bytes](size_type pos) {
+    return d_target.compare(d_str.data() + pos, bytes) == 0;
+  };
+  if (forward) {
+    for (size_type base = spos; base <= last; base += cudf::detail::warp_size) {
+      auto const pos  = base + lane_idx;
+      auto const mask = __ballot_sync(0xFFFFFFFF, pos <= last && is_match_at(pos));
+      if (mask) return base + __ffs(mask) - 1;
+    }
+  } else {
+    for (size_type base = last; base >= spos; base -= cudf::detail::warp_size) {
+      auto const pos  = base - lane_idx;
+      auto const mask = __ballot_sync(0xFFFFFFFF, pos >= spos && is_match_at(pos));
+      if (mask) return base - __ffs(mask) + 1;
+    }
+  }
+  return -1;
+}
+
+/**
+ * @brief Kernel computing the character position of the target in each string with a warp
+ * per string, as the `find` and `rfind` functions of `find_fn`.
+ *
+ * The kernel must be launched with `WARPS_PER_BLOCK * cudf::detail::warp_size` threads per
+ * threadblock.
+ */
+__global__ void find_warp_parallel_fn(column_device_view const d_strings,
+                                      string_view const d_target,
+                                      size_type const start,
+                                      size_type const stop,
+                                      bool const forward,
+                                      int32_t* d_results)
+{
+  int const lane_idx     = threadIdx.x % cudf::detail::warp_size;
+  size_type const nwarps = gridDim.x * WARPS_PER_BLOCK;
+  for (size_type idx = blockIdx.x * WARPS_PER_BLOCK + threadIdx.x / cudf::detail::warp_size;
+       idx < d_strings.size();
+       idx += nwarps) {
+    if (d_strings.is_null(idx)) {
+      if (lane_idx == 0) d_results[idx] = -1;
+      continue;
+    }
+    auto const d_str  = d_strings.element<string_view>(idx);
+    auto const length = warp_count_characters(d_str, d_str.size_bytes(), lane_idx);
+    auto const begin  = (start > length) ? length : start;
+    auto const end    = (stop < 0) || (stop > length) ? length : stop;
+    int32_t position  = -1;
+    if (d_target.empty()) {
+      position = start > length ? -1 : (forward ? start : end);
+    } else {
+      // string_view::find searches to the end of the string when `end` is before `begin`
+      auto const last = (forward && end < begin) ? length : end;
+      auto const spos = warp_byte_offset(d_str, begin, lane_idx);
+      auto const epos = warp_byte_offset(d_str, last, lane_idx);
+      auto const pos  = warp_find(d_str, d_target, spos, epos, forward, lane_idx);
+      if (pos >= 0) position = warp_count_characters(d_str, pos, lane_idx);
+    }
+    if (lane_idx == 0) d_results[idx] = position;
+  }
+}
+
+/**
+ * @brief Kernel setting whether the non-empty target is found in each string with a warp per
+ * string.
+ *
+ * The kernel must be launched with `WARPS_PER_BLOCK * cudf::detail::warp_size` threads per
+ * threadblock.
+ */
+__global__ void contains_warp_parallel_fn(column_device_view const d_strings,
+                                          string_view const d_target,
+                                          bool* d_results)
+{
+  int const lane_idx     = threadIdx.x % cudf::detail::warp_size;
+  size_type const nwarps = gridDim.x * WARPS_PER_BLOCK;
+  for (size_type idx = blockIdx.x * WARPS_PER_BLOCK + threadIdx.x / cudf::detail::warp_size;
+       idx < d_strings.size();
+       idx += nwarps) {
+    bool found = false;
+    if (!d_strings.is_null(idx)) {
+      auto const d_str = d_strings.element<string_view>(idx);
+      found = warp_find(d_str, d_target, 0, d_str.size_bytes(), true, lane_idx) >= 0;
+    }
+    if (lane_idx == 0) d_results[idx] = found;
+  }
+}
+
+/**
+ * @brief Returns the number of threadblocks to launch the warp-parallel kernels with.
+ */
+int warp_parallel_blocks(size_type strings_count)
+{
+  return std::min(65536, cudf::util::div_rounding_up_unsafe(strings_count, WARPS_PER_BLOCK));
+}
+
 /**
  * @brief Utility to return integer column indicating the position of
  * target string within each string in a strings column.
@@ -47,6 +232,8 @@ namespace {
  * @param start First character position to start the search.
  * @param stop Last character position (exclusive) to end the search.
  * @param pfn Functor used for locating `target` in each string.
+ * @param forward Whether `pfn` locates the first occurrence rather than the last one, for
+ *        searching long strings with a warp per string instead.
  * @param stream CUDA stream used for device memory operations and kernel launches.
  * @param mr Device memory resource used to allocate the returned column's device memory.
  * @return New integer column with character position values.
@@ -57,6 +244,7 @@ std::unique_ptr<column> find_fn(strings_column_view const& strings,
                                 size_type start,
                                 size_type stop,
                                 FindFunction& pfn,
+                                bool forward,
                                 rmm::cuda_stream_view stream,
                                 rmm::mr::device_memory_resource* mr)
 {
@@ -77,6 +265,14 @@ std::unique_ptr<column> find_fn(strings_column_view const& strings,
                                      mr);
   auto results_view = results->mutable_view();
   auto d_results    = results_view.data<int32_t>();
+  if (is_warp_parallel(strings, stream)) {
+    find_warp_parallel_fn<<<warp_parallel_blocks(strings_count),
+                            WARPS_PER_BLOCK * cudf::detail::warp_size,
+                            0,
+                            stream.value()>>>(d_strings, d_target, start, stop, forward, d_results);
+    results->set_null_count(strings.null_count());
+    return results;
+  }
   // set the position values by evaluating the passed function
   thrust::transform(rmm::exec_policy(stream),
                     thrust::make_counting_iterator<size_type>(0),
@@ -112,7 +308,7 @@ std::unique_ptr<column> find(
     return d_string.find(d_target, begin, end - begin);
   };
 
-  return find_fn(strings, target, start, stop, pfn, stream, mr);
+  return find_fn(strings, target, start, stop, pfn, true, stream, mr);
 }
 
 std::unique_ptr<column> rfind(
@@ -132,7 +328,7 @@ std::unique_ptr<column> rfind(
     return d_string.rfind(d_target, begin, end - begin);
   };
 
-  return find_fn(strings, target, start, stop, pfn, stream, mr);
+  return find_fn(strings, target, start, stop, pfn, false, stream, mr);
 }
 
 }  // namespace detail
@@ -282,6 +478,37 @@ std::unique_ptr<column> contains_fn(strings_column_view const& strings,
   return results;
 }
 
+/**
+ * @brief Returns a bool column indicating the presence of a non-empty target string in
+ * each string, searched with a warp per string.
+ *
+ * @param strings Column of long strings to check for target.
+ * @param d_target Non-empty string to check in strings column.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New BOOL column.
+ */
+std::unique_ptr<column> contains_warp_parallel(strings_column_view const& strings,
+                                               string_view d_target,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  auto results        = make_numeric_column(data_type{type_id::BOOL8},
+                                     strings.size(),
+                                     cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                                     strings.null_count(),
+                                     stream,
+                                     mr);
+  contains_warp_parallel_fn<<<warp_parallel_blocks(strings.size()),
+                              WARPS_PER_BLOCK * cudf::detail::warp_size,
+                              0,
+                              stream.value()>>>(
+    *strings_column, d_target, results->mutable_view().data<bool>());
+  results->set_null_count(strings.null_count());
+  return results;
+}
+
 }  // namespace
 
 std::unique_ptr<column> contains(
@@ -290,6 +517,10 @@ std::unique_ptr<column> contains(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
+  if (!strings.is_empty() && target.is_valid(stream) && target.size() > 0 &&
+      is_warp_parallel(strings, stream)) {
+    return contains_warp_parallel(strings, string_view(target.data(), target.size()), stream, mr);
+  }
   auto pfn = [] __device__(string_view d_string, string_view d_target) {
     return d_string.find(d_target) >= 0;
   };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -25,6 +25,7 @@
 #include <cudf/strings/json.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
@@ -36,6 +37,11 @@
 
 #include <thrust/optional.h>
 
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -297,6 +303,12 @@ class json_state : private parser {
   // skip the next element
   __device__ parse_result skip_element() { return extract_element(nullptr, false); }
 
+  // type of the current element
+  [[nodiscard]] __device__ json_element_type element_type() const { return cur_el_type; }
+
+  // name of the current element (if applicable)
+  [[nodiscard]] __device__ string_view const& element_name() const { return cur_el_name; }
+
   // advance to the next element
   __device__ parse_result next_element() { return next_element_internal(false); }
 
@@ -625,17 +637,17 @@ class path_state : private parser {
 };
 
 /**
- * @brief Preprocess the incoming JSONPath string on the host to generate a
- * command buffer for use by the GPU.
+ * @brief Parse the incoming JSONPath string on the host into the operators of a command buffer.
  *
- * @param json_path The incoming json path
- * @param stream Cuda stream to perform any gpu actions on
- * @returns A pair containing the command buffer, and maximum stack depth required.
+ * @param h_json_path The incoming json path
+ * @param d_json_path The same json path in device memory, which the names of the operators
+ * point into
+ * @returns A pair containing the operators, empty if the path is, and maximum stack depth
+ * required.
  */
-std::pair<thrust::optional<rmm::device_uvector<path_operator>>, int> build_command_buffer(
-  cudf::string_scalar const& json_path, rmm::cuda_stream_view stream)
+std::pair<std::vector<path_operator>, int> parse_command_buffer(std::string const& h_json_path,
+                                                                char const* d_json_path)
 {
-  std::string h_json_path = json_path.to_string(stream);
   path_state p_state(h_json_path.data(), static_cast<size_type>(h_json_path.size()));
 
   std::vector<path_operator> h_operators;
@@ -651,7 +663,7 @@ std::pair<thrust::optional<rmm::device_uvector<path_operator>>, int> build_comma
     // convert pointer to device pointer
     if (op.name.size_bytes() > 0) {
       op.name =
-        string_view(json_path.data() + (op.name.data() - h_json_path.data()), op.name.size_bytes());
+        string_view(d_json_path + (op.name.data() - h_json_path.data()), op.name.size_bytes());
     }
     if (op.type == path_operator_type::ROOT) {
       CUDF_EXPECTS(h_operators.size() == 0, "Root operator ($) can only exist at the root");
@@ -666,7 +678,25 @@ std::pair<thrust::optional<rmm::device_uvector<path_operator>>, int> build_comma
   } while (op.type != path_operator_type::END);
 
   auto const is_empty = h_operators.size() == 1 && h_operators[0].type == path_operator_type::END;
-  return is_empty
+  if (is_empty) { h_operators.clear(); }
+  return {std::move(h_operators), is_empty ? 0 : max_stack_depth};
+}
+
+/**
+ * @brief Preprocess the incoming JSONPath string on the host to generate a
+ * command buffer for use by the GPU.
+ *
+ * @param json_path The incoming json path
+ * @param stream Cuda stream to perform any gpu actions on
+ * @returns A pair containing the command buffer, and maximum stack depth required.
+ */
+std::pair<thrust::optional<rmm::device_uvector<path_operator>>, int> build_command_buffer(
+  cudf::string_scalar const& json_path, rmm::cuda_stream_view stream)
+{
+  std::string h_json_path = json_path.to_string(stream);
+  auto const [h_operators, max_stack_depth] = parse_command_buffer(h_json_path, json_path.data());
+
+  return h_operators.empty()
            ? std::make_pair(thrust::nullopt, 0)
            : std::make_pair(
                thrust::make_optional(cudf::detail::make_device_uvector_sync(h_operators, stream)),
@@ -946,6 +976,205 @@ __launch_bounds__(block_size) __global__
   }
 }
 
+// number of paths applied in one walk over each json string; one bit of a mask for each
+constexpr int max_paths_per_pass = 32;
+
+// paths made of more child operators than this are applied one at a time
+constexpr int max_simple_path_depth = 16;
+
+/**
+ * @brief A JSONPath query of `get_json_objects_kernel` and its output buffers.
+ */
+struct json_path_query {
+  path_operator const* commands;  // command buffer; nullptr if the path is empty
+  bool is_simple;                 // whether the path has only child operators, no wildcards
+  offset_type* output_offsets;    // output sizes on the first pass, offsets on the second
+  char* out_buf;                  // output chars; nullptr on the first pass
+  bitmask_type* out_validity;     // output validity; nullptr on the first pass
+};
+
+/**
+ * @brief Apply JSONPath queries made of child operators to a single json string in one walk.
+ *
+ * The children of an element are scanned once for all of the paths, stepping into each child
+ * that the next operator of any of the paths selects, so the string is parsed once regardless of
+ * the number of paths.
+ *
+ * @param j_state The incoming json string and associated parser
+ * @param queries The queries; those in `paths` must be simple
+ * @param paths Bitmask of the indices in `queries` of the paths to apply
+ * @param outputs Buffers used to store the results of the queries, one per query
+ * @returns Bitmask of the paths that matched an element
+ */
+__device__ uint32_t parse_simple_json_paths(json_state const& j_state,
+                                            json_path_query const* queries,
+                                            uint32_t paths,
+                                            json_output* outputs)
+{
+  // the children of an element being scanned
+  struct level {
+    json_state j_state;  // positioned at the current child
+    uint32_t waiting;    // paths whose operator at `depth` has not selected a child yet
+    int depth;           // index of the operator selecting among the children
+    int index;           // index of the current child
+  };
+  level stack[max_simple_path_depth];
+  int stack_pos    = 0;
+  uint32_t matched = 0;
+
+  // output the element for the paths ending at it, and scan its children for the others
+  auto visit = [&](json_state const& element, uint32_t active, int depth) {
+    uint32_t descending = 0;
+    for (auto bits = active; bits != 0; bits &= bits - 1) {
+      auto const p   = __ffs(bits) - 1;
+      auto const& op = queries[p].commands[depth];
+      if (op.type == path_operator_type::END) {
+        json_state value(element);
+        if (value.extract_element(&outputs[p], false) == parse_result::SUCCESS) {
+          matched |= 1u << p;
+        }
+      } else if (element.element_type() == op.expected_type) {
+        descending |= 1u << p;
+      }
+    }
+    if (descending == 0) { return; }
+    auto& children   = stack[stack_pos];
+    children.j_state = element;
+    if (children.j_state.child_element(NONE) == parse_result::SUCCESS) {
+      children.waiting = descending;
+      children.depth   = depth;
+      children.index   = 0;
+      stack_pos++;
+    }
+  };
+
+  json_state root(j_state);
+  if (root.next_element() == parse_result::SUCCESS) { visit(root, paths, 1); }
+
+  while (stack_pos > 0) {
+    auto& children   = stack[stack_pos - 1];
+    auto const depth = children.depth;
+
+    // each path selects the first child matching its operator
+    uint32_t selected = 0;
+    for (auto bits = children.waiting; bits != 0; bits &= bits - 1) {
+      auto const p   = __ffs(bits) - 1;
+      auto const& op = queries[p].commands[depth];
+      if (op.type == path_operator_type::CHILD ? children.j_state.element_name() == op.name
+                                               : children.index == op.index) {
+        selected |= 1u << p;
+      }
+    }
+    children.waiting &= ~selected;
+    json_state const child(children.j_state);
+
+    // move on to the next child first, as visiting this one may push the level of its children
+    if (children.waiting == 0 ||
+        children.j_state.next_matching_element({"*", 1}, false) != parse_result::SUCCESS) {
+      stack_pos--;
+    } else {
+      children.index++;
+    }
+    if (selected != 0) { visit(child, selected, depth + 1); }
+  }
+
+  return matched;
+}
+
+/**
+ * @brief Kernel for running several JSONPath queries in one pass over the input.
+ *
+ * Like `get_json_object_kernel`, this kernel computes output sizes on the first pass and fills in
+ * the output buffers of the queries on the second. Simple queries are applied together in one
+ * walk over each json string; the others are applied one at a time.
+ *
+ * @param col Device view of the incoming string
+ * @param queries The queries and their output buffers, at most `max_paths_per_pass`
+ * @param out_valid_counts Output count of # of valid bits of each query
+ * @param options Options controlling behavior
+ */
+template <int block_size>
+__launch_bounds__(block_size) __global__
+  void get_json_objects_kernel(column_device_view col,
+                               device_span<json_path_query const> queries,
+                               thrust::optional<size_type*> out_valid_counts,
+                               get_json_object_options options)
+{
+  size_type tid    = threadIdx.x + (blockDim.x * blockIdx.x);
+  size_type stride = blockDim.x * gridDim.x;
+
+  auto const num_queries = static_cast<int>(queries.size());
+  uint32_t simple_paths  = 0;
+  for (int p = 0; p < num_queries; p++) {
+    if (queries[p].is_simple) { simple_paths |= 1u << p; }
+  }
+  size_type warp_valid_counts[max_paths_per_pass] = {0};
+
+  auto active_threads = __ballot_sync(0xffffffff, tid < col.size());
+  while (tid < col.size()) {
+    string_view const str = col.element<string_view>(tid);
+
+    json_output outputs[max_paths_per_pass];
+    for (int p = 0; p < num_queries; p++) {
+      auto const& query = queries[p];
+      if (query.out_buf != nullptr) {
+        auto const offset = query.output_offsets[tid];
+        outputs[p]        = json_output{
+          static_cast<size_t>(query.output_offsets[tid + 1] - offset), query.out_buf + offset};
+      } else {
+        outputs[p] = json_output{0, nullptr};
+      }
+    }
+
+    uint32_t valid = 0;
+    if (str.size_bytes() > 0) {
+      json_state const j_state(str.data(), str.size_bytes(), options);
+      if (simple_paths != 0) {
+        valid = parse_simple_json_paths(j_state, queries.data(), simple_paths, outputs);
+      }
+      for (int p = 0; p < num_queries; p++) {
+        if (queries[p].is_simple || queries[p].commands == nullptr) { continue; }
+        json_state path_j_state(j_state);
+        auto const result =
+          parse_json_path<max_command_stack_depth>(path_j_state, queries[p].commands, outputs[p]);
+        if (outputs[p].output_len.has_value() && result == parse_result::SUCCESS) {
+          valid |= 1u << p;
+        }
+      }
+    }
+
+    for (int p = 0; p < num_queries; p++) {
+      // filled in only during the precompute step
+      if (queries[p].out_buf == nullptr) {
+        queries[p].output_offsets[tid] =
+          static_cast<offset_type>(outputs[p].output_len.value_or(0));
+      }
+
+      // validity filled in only during the output step
+      if (queries[p].out_validity != nullptr) {
+        uint32_t mask = __ballot_sync(active_threads, (valid >> p) & 1);
+        // 0th lane of the warp writes the validity
+        if (!(tid % cudf::detail::warp_size)) {
+          queries[p].out_validity[cudf::word_index(tid)] = mask;
+          warp_valid_counts[p] += __popc(mask);
+        }
+      }
+    }
+
+    tid += stride;
+    active_threads = __ballot_sync(active_threads, tid < col.size());
+  }
+
+  // sum the valid counts across the whole block
+  if (out_valid_counts) {
+    for (int p = 0; p < num_queries; p++) {
+      size_type block_valid_count =
+        cudf::detail::single_lane_block_sum_reduce<block_size, 0>(warp_valid_counts[p]);
+      if (threadIdx.x == 0) { atomicAdd(out_valid_counts.value() + p, block_valid_count); }
+    }
+  }
+}
+
 /**
  * @copydoc cudf::strings::detail::get_json_object
  */
@@ -1028,6 +1257,110 @@ std::unique_ptr<cudf::column> get_json_object(cudf::strings_column_view const& c
                              std::move(validity));
 }
 
+/**
+ * @copydoc cudf::strings::get_json_object(cudf::strings_column_view const&,
+ * std::vector<std::string> const&, get_json_object_options, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::unique_ptr<cudf::table> get_json_object(cudf::strings_column_view const& col,
+                                             std::vector<std::string> const& json_paths,
+                                             get_json_object_options options,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  // copy all of the paths to the device at once; the names of the commands point into them
+  std::string const h_json_paths =
+    std::accumulate(json_paths.begin(), json_paths.end(), std::string{});
+  auto const d_json_paths = cudf::detail::make_device_uvector_async(
+    host_span<char const>{h_json_paths.data(), h_json_paths.size()}, stream);
+
+  // preprocess the paths into one command buffer
+  std::vector<path_operator> h_commands;
+  std::vector<int64_t> command_offsets;  // offset of the commands of each path; -1 if empty
+  std::vector<bool> is_simple;
+  size_t path_offset = 0;
+  for (auto const& json_path : json_paths) {
+    auto const [h_operators, max_stack_depth] =
+      parse_command_buffer(json_path, d_json_paths.data() + path_offset);
+    CUDF_EXPECTS(max_stack_depth <= max_command_stack_depth,
+                 "Encountered JSONPath string that is too complex");
+    command_offsets.push_back(h_operators.empty() ? -1 : static_cast<int64_t>(h_commands.size()));
+    // each wildcard adds to the stack depth
+    is_simple.push_back(!h_operators.empty() && max_stack_depth == 1 &&
+                        h_operators.size() <= static_cast<size_t>(max_simple_path_depth) + 2);
+    h_commands.insert(h_commands.end(), h_operators.begin(), h_operators.end());
+    path_offset += json_path.size();
+  }
+  auto const d_commands = cudf::detail::make_device_uvector_async(h_commands, stream);
+
+  constexpr int block_size = 512;
+  cudf::detail::grid_1d const grid{col.size(), block_size};
+
+  auto cdv = column_device_view::create(col.parent(), stream);
+
+  std::vector<std::unique_ptr<column>> results;
+  for (size_t first = 0; first < json_paths.size(); first += max_paths_per_pass) {
+    auto const num_queries = std::min<size_t>(max_paths_per_pass, json_paths.size() - first);
+
+    // allocate output offsets buffers.
+    std::vector<std::unique_ptr<column>> offsets;
+    std::vector<json_path_query> h_queries;
+    for (size_t q = first; q < first + num_queries; q++) {
+      offsets.emplace_back(cudf::make_fixed_width_column(
+        data_type{type_id::INT32}, col.size() + 1, mask_state::UNALLOCATED, stream, mr));
+      h_queries.push_back(
+        json_path_query{command_offsets[q] < 0 ? nullptr : d_commands.data() + command_offsets[q],
+                        is_simple[q],
+                        offsets.back()->mutable_view().head<offset_type>(),
+                        nullptr,
+                        nullptr});
+    }
+
+    // preprocess sizes (returned in the offsets buffers)
+    auto d_queries = cudf::detail::make_device_uvector_sync(h_queries, stream);
+    get_json_objects_kernel<block_size>
+      <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+        *cdv, d_queries, thrust::nullopt, options);
+
+    // convert sizes to offsets and allocate the output string columns
+    std::vector<std::unique_ptr<column>> chars;
+    std::vector<rmm::device_buffer> validity;
+    for (size_t q = 0; q < num_queries; q++) {
+      auto const d_offsets = h_queries[q].output_offsets;
+      thrust::exclusive_scan(
+        rmm::exec_policy(stream), d_offsets, d_offsets + col.size() + 1, d_offsets, 0);
+      size_type const output_size =
+        cudf::detail::get_value<offset_type>(offsets[q]->view(), col.size(), stream);
+
+      chars.emplace_back(create_chars_child_column(output_size, stream, mr));
+      validity.emplace_back(
+        cudf::detail::create_null_mask(col.size(), mask_state::UNINITIALIZED, stream, mr));
+      h_queries[q].out_buf      = chars.back()->mutable_view().head<char>();
+      h_queries[q].out_validity = static_cast<bitmask_type*>(validity.back().data());
+    }
+
+    // compute results
+    d_queries = cudf::detail::make_device_uvector_sync(h_queries, stream);
+    auto d_valid_counts =
+      cudf::detail::make_zeroed_device_uvector_async<size_type>(num_queries, stream);
+    get_json_objects_kernel<block_size>
+      <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+        *cdv, d_queries, d_valid_counts.data(), options);
+
+    auto const h_valid_counts = cudf::detail::make_std_vector_sync(d_valid_counts, stream);
+    for (size_t q = 0; q < num_queries; q++) {
+      results.emplace_back(make_strings_column(col.size(),
+                                               std::move(offsets[q]),
+                                               std::move(chars[q]),
+                                               col.size() - h_valid_counts[q],
+                                               std::move(validity[q])));
+    }
+  }
+
+  return std::make_unique<cudf::table>(std::move(results));
+}
+
 }  // namespace
 }  // namespace detail
 
@@ -1043,5 +1376,18 @@ std::unique_ptr<cudf::column> get_json_object(cudf::strings_column_view const& c
   return detail::get_json_object(col, json_path, options, rmm::cuda_stream_default, mr);
 }
 
+/**
+ * @copydoc cudf::strings::get_json_object(cudf::strings_column_view const&,
+ * std::vector<std::string> const&, get_json_object_options, rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<cudf::table> get_json_object(cudf::strings_column_view const& col,
+                                             std::vector<std::string> const& json_paths,
+                                             get_json_object_options options,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::get_json_object(col, json_paths, options, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
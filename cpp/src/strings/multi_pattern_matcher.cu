@@ -0,0 +1,501 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <strings/utilities.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/multi_pattern_matcher.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/distance.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <map>
+#include <queue>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace {
+
+/**
+ * @brief The Aho-Corasick automaton of the patterns, as read by the kernels.
+ *
+ * The trie nodes are numbered from the root, node 0, and their edges are stored in the order of
+ * their bytes so that each step of a string is a binary search among the edges of a node.
+ */
+struct device_automaton {
+  int32_t const* child_offsets;    ///< First edge of each node
+  uint8_t const* child_bytes;      ///< Byte of each edge
+  int32_t const* child_nodes;      ///< Node each edge leads to
+  int32_t const* fail_links;       ///< Node of the longest proper suffix of each node in the trie
+  int32_t const* output_links;     ///< Nearest node along the fail links ending patterns, or -1
+  int32_t const* pattern_offsets;  ///< First pattern ending at each node
+  size_type const* pattern_ids;    ///< Patterns ending at each node, in increasing order
+  size_type const* pattern_chars;  ///< Number of characters of each pattern
+  size_type const* pattern_bytes;  ///< Number of bytes of each pattern
+
+  /**
+   * @brief Returns the child of `node` along `byte`, or -1 if there is none.
+   */
+  __device__ int32_t child(int32_t node, uint8_t byte) const
+  {
+    auto const begin = child_bytes + child_offsets[node];
+    auto const end   = child_bytes + child_offsets[node + 1];
+    auto const itr   = thrust::lower_bound(thrust::seq, begin, end, byte);
+    return (itr != end && *itr == byte) ? child_nodes[itr - child_bytes] : -1;
+  }
+
+  /**
+   * @brief Returns whether some patterns end at `node`.
+   */
+  __device__ bool ends_patterns(int32_t node) const
+  {
+    return pattern_offsets[node] < pattern_offsets[node + 1];
+  }
+
+  /**
+   * @brief Calls `fn(pattern_id, chars)` for each occurrence of a pattern in the string, in the
+   * order of their last byte, where `chars` is the number of characters up to the end of the
+   * occurrence.
+   */
+  template <typename Fn>
+  __device__ void for_each_occurrence(string_view const& d_str, Fn fn) const
+  {
+    auto const data = reinterpret_cast<uint8_t const*>(d_str.data());
+    int32_t node    = 0;
+    size_type chars = 0;
+    for (size_type i = 0; i < d_str.size_bytes(); ++i) {
+      auto const byte = data[i];
+      chars += detail::is_begin_utf8_char(byte);
+      auto next = child(node, byte);
+      while (next < 0 && node != 0) {
+        node = fail_links[node];
+        next = child(node, byte);
+      }
+      node = next < 0 ? 0 : next;
+      for (auto n = ends_patterns(node) ? node : output_links[node]; n >= 0; n = output_links[n]) {
+        for (auto k = pattern_offsets[n]; k < pattern_offsets[n + 1]; ++k) {
+          fn(pattern_ids[k], chars);
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Returns the first pattern, in the order of the patterns, starting at `data`, or -1.
+   */
+  __device__ size_type first_pattern_at(uint8_t const* data, size_type bytes) const
+  {
+    size_type result = -1;
+    int32_t node     = 0;
+    for (size_type i = 0; i < bytes; ++i) {
+      node = child(node, data[i]);
+      if (node < 0) break;
+      if (ends_patterns(node)) {
+        auto const id = pattern_ids[pattern_offsets[node]];
+        if (result < 0 || id < result) result = id;
+      }
+    }
+    return result;
+  }
+};
+
+/**
+ * @brief Functor replacing the patterns found in each string, as `replace_multi_fn` does for the
+ * targets of `replace`.
+ */
+struct replace_patterns_fn {
+  column_device_view const d_strings;
+  column_device_view const d_repls;
+  device_automaton const automaton;
+  int32_t* d_offsets{};
+  char* d_chars{};
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_strings.is_null(idx)) {
+      if (!d_chars) d_offsets[idx] = 0;
+      return;
+    }
+    auto const d_str   = d_strings.element<string_view>(idx);
+    char const* in_ptr = d_str.data();
+
+    size_type bytes = d_str.size_bytes();
+    size_type spos  = 0;
+    size_type lpos  = 0;
+    char* out_ptr   = d_chars ? d_chars + d_offsets[idx] : nullptr;
+
+    // a single walk down the trie finds the first pattern starting at each position
+    while (spos < d_str.size_bytes()) {
+      auto const id = automaton.first_pattern_at(
+        reinterpret_cast<uint8_t const*>(in_ptr + spos), d_str.size_bytes() - spos);
+      if (id >= 0) {
+        auto const d_repl = (d_repls.size() == 1) ? d_repls.element<string_view>(0)
+                                                  : d_repls.element<string_view>(id);
+        auto const pattern_bytes = automaton.pattern_bytes[id];
+        bytes += d_repl.size_bytes() - pattern_bytes;
+        if (out_ptr) {
+          out_ptr = detail::copy_and_increment(out_ptr, in_ptr + lpos, spos - lpos);
+          out_ptr = detail::copy_string(out_ptr, d_repl);
+          lpos    = spos + pattern_bytes;
+        }
+        spos += pattern_bytes;
+      } else {
+        ++spos;
+      }
+    }
+    if (out_ptr)  // copy remainder
+      memcpy(out_ptr, in_ptr + lpos, d_str.size_bytes() - lpos);
+    else
+      d_offsets[idx] = bytes;
+  }
+};
+
+}  // namespace
+
+struct multi_pattern_matcher::multi_pattern_matcher_impl {
+  rmm::cuda_stream_view const _stream = rmm::cuda_stream_default;
+  size_type const _size;
+  rmm::device_uvector<int32_t> _child_offsets;
+  rmm::device_uvector<uint8_t> _child_bytes;
+  rmm::device_uvector<int32_t> _child_nodes;
+  rmm::device_uvector<int32_t> _fail_links;
+  rmm::device_uvector<int32_t> _output_links;
+  rmm::device_uvector<int32_t> _pattern_offsets;
+  rmm::device_uvector<size_type> _pattern_ids;
+  rmm::device_uvector<size_type> _pattern_chars;
+  rmm::device_uvector<size_type> _pattern_bytes;
+
+  multi_pattern_matcher_impl(strings_column_view const& patterns,
+                             rmm::mr::device_memory_resource* mr)
+    : _size{patterns.size()},
+      _child_offsets{0, _stream, mr},
+      _child_bytes{0, _stream, mr},
+      _child_nodes{0, _stream, mr},
+      _fail_links{0, _stream, mr},
+      _output_links{0, _stream, mr},
+      _pattern_offsets{0, _stream, mr},
+      _pattern_ids{0, _stream, mr},
+      _pattern_chars{0, _stream, mr},
+      _pattern_bytes{0, _stream, mr}
+  {
+    CUDF_EXPECTS(patterns.size() > 0, "Must include at least one pattern");
+    CUDF_EXPECTS(!patterns.has_nulls(), "Patterns cannot contain null strings");
+
+    auto const h_offsets = cudf::detail::make_std_vector_sync(
+      device_span<offset_type const>(
+        patterns.offsets().data<offset_type>() + patterns.offset(), patterns.size() + 1),
+      _stream);
+    auto const h_chars = cudf::detail::make_std_vector_sync(
+      device_span<char const>(patterns.chars().data<char>(), patterns.chars_size()), _stream);
+
+    // the trie of the bytes of the patterns
+    std::vector<std::map<uint8_t, int32_t>> children(1);
+    std::vector<std::vector<size_type>> node_patterns(1);
+    std::vector<size_type> pattern_chars(_size);
+    std::vector<size_type> pattern_bytes(_size);
+    for (size_type p = 0; p < _size; ++p) {
+      int32_t node = 0;
+      for (auto i = h_offsets[p]; i < h_offsets[p + 1]; ++i) {
+        auto const byte = static_cast<uint8_t>(h_chars[i]);
+        auto const itr  = children[node].find(byte);
+        if (itr != children[node].end()) {
+          node = itr->second;
+          continue;
+        }
+        auto const next = static_cast<int32_t>(children.size());
+        children[node].emplace(byte, next);
+        children.emplace_back();
+        node_patterns.emplace_back();
+        node = next;
+      }
+      pattern_bytes[p] = h_offsets[p + 1] - h_offsets[p];
+      pattern_chars[p] = static_cast<size_type>(std::count_if(
+        h_chars.begin() + h_offsets[p], h_chars.begin() + h_offsets[p + 1], [](char c) {
+          return detail::is_begin_utf8_char(static_cast<uint8_t>(c));
+        }));
+      if (node != 0) node_patterns[node].push_back(p);  // empty patterns are never found
+    }
+
+    // the links of the nodes, set in breadth-first order so the links of shorter nodes are known
+    auto const num_nodes = static_cast<int32_t>(children.size());
+    std::vector<int32_t> fail_links(num_nodes, 0);
+    std::vector<int32_t> output_links(num_nodes, -1);
+    std::queue<int32_t> queue;
+    queue.push(0);
+    while (!queue.empty()) {
+      auto const node = queue.front();
+      queue.pop();
+      for (auto const& [byte, next] : children[node]) {
+        auto suffix = fail_links[node];
+        while (suffix != 0 && children[suffix].count(byte) == 0) {
+          suffix = fail_links[suffix];
+        }
+        auto const itr  = children[suffix].find(byte);
+        auto const fail = (itr != children[suffix].end() && itr->second != next) ? itr->second : 0;
+
+        fail_links[next]   = fail;
+        output_links[next] = node_patterns[fail].empty() ? output_links[fail] : fail;
+        queue.push(next);
+      }
+    }
+
+    // flatten the edges and the patterns of the nodes
+    std::vector<int32_t> child_offsets{0};
+    std::vector<uint8_t> child_bytes;
+    std::vector<int32_t> child_nodes;
+    std::vector<int32_t> pattern_offsets{0};
+    std::vector<size_type> pattern_ids;
+    for (int32_t node = 0; node < num_nodes; ++node) {
+      for (auto const& [byte, next] : children[node]) {
+        child_bytes.push_back(byte);
+        child_nodes.push_back(next);
+      }
+      child_offsets.push_back(static_cast<int32_t>(child_bytes.size()));
+      pattern_ids.insert(pattern_ids.end(), node_patterns[node].begin(), node_patterns[node].end());
+      pattern_offsets.push_back(static_cast<int32_t>(pattern_ids.size()));
+    }
+
+    _child_offsets   = cudf::detail::make_device_uvector_async(child_offsets, _stream, mr);
+    _child_bytes     = cudf::detail::make_device_uvector_async(child_bytes, _stream, mr);
+    _child_nodes     = cudf::detail::make_device_uvector_async(child_nodes, _stream, mr);
+    _fail_links      = cudf::detail::make_device_uvector_async(fail_links, _stream, mr);
+    _output_links    = cudf::detail::make_device_uvector_async(output_links, _stream, mr);
+    _pattern_offsets = cudf::detail::make_device_uvector_async(pattern_offsets, _stream, mr);
+    _pattern_ids     = cudf::detail::make_device_uvector_async(pattern_ids, _stream, mr);
+    _pattern_chars   = cudf::detail::make_device_uvector_async(pattern_chars, _stream, mr);
+    _pattern_bytes   = cudf::detail::make_device_uvector_async(pattern_bytes, _stream, mr);
+    _stream.synchronize();
+  }
+
+  [[nodiscard]] device_automaton automaton() const
+  {
+    return device_automaton{_child_offsets.data(),
+                            _child_bytes.data(),
+                            _child_nodes.data(),
+                            _fail_links.data(),
+                            _output_links.data(),
+                            _pattern_offsets.data(),
+                            _pattern_ids.data(),
+                            _pattern_chars.data(),
+                            _pattern_bytes.data()};
+  }
+
+  std::unique_ptr<column> contains(strings_column_view const& strings,
+                                   rmm::mr::device_memory_resource* mr) const
+  {
+    auto const strings_count = strings.size();
+    if (strings_count == 0) {
+      return make_lists_column(0,
+                               make_empty_column(type_to_id<offset_type>()),
+                               make_empty_column(type_id::INT32),
+                               0,
+                               rmm::device_buffer{},
+                               _stream,
+                               mr);
+    }
+    auto const d_strings   = column_device_view::create(strings.parent(), _stream);
+    auto const d_automaton = automaton();
+    auto const rows        = thrust::make_counting_iterator<size_type>(0);
+
+    // each occurrence of a pattern is recorded as its row followed by its pattern id
+    rmm::device_uvector<size_type> offsets(strings_count + 1, _stream);
+    thrust::transform(rmm::exec_policy(_stream),
+                      rows,
+                      rows + strings_count,
+                      offsets.begin(),
+                      [d_strings = *d_strings, d_automaton] __device__(size_type idx) {
+                        if (d_strings.is_null(idx)) return size_type{0};
+                        size_type count = 0;
+                        d_automaton.for_each_occurrence(
+                          d_strings.element<string_view>(idx),
+                          [&count](size_type, size_type) { ++count; });
+                        return count;
+                      });
+    thrust::exclusive_scan(
+      rmm::exec_policy(_stream), offsets.begin(), offsets.end(), offsets.begin());
+    auto const total_occurrences = offsets.back_element(_stream);
+
+    rmm::device_uvector<uint64_t> occurrences(total_occurrences, _stream);
+    thrust::for_each_n(
+      rmm::exec_policy(_stream),
+      rows,
+      strings_count,
+      [d_strings = *d_strings,
+       d_automaton,
+       d_offsets     = offsets.data(),
+       d_occurrences = occurrences.data()] __device__(size_type idx) {
+        if (d_strings.is_null(idx)) return;
+        auto out = d_occurrences + d_offsets[idx];
+        d_automaton.for_each_occurrence(d_strings.element<string_view>(idx),
+                                        [&out, idx](size_type id, size_type) {
+                                          *out++ = (static_cast<uint64_t>(idx) << 32) |
+                                                   static_cast<uint32_t>(id);
+                                        });
+      });
+
+    // the distinct occurrences are the pattern ids of each row in increasing order
+    thrust::sort(rmm::exec_policy(_stream), occurrences.begin(), occurrences.end());
+    auto const end =
+      thrust::unique(rmm::exec_policy(_stream), occurrences.begin(), occurrences.end());
+    auto const num_ids = static_cast<size_type>(thrust::distance(occurrences.begin(), end));
+
+    auto list_offsets = make_numeric_column(data_type{type_to_id<offset_type>()},
+                                            strings_count + 1,
+                                            mask_state::UNALLOCATED,
+                                            _stream,
+                                            mr);
+    auto const row_starts = thrust::make_transform_iterator(
+      rows, [] __device__(size_type row) { return static_cast<uint64_t>(row) << 32; });
+    thrust::lower_bound(rmm::exec_policy(_stream),
+                        occurrences.begin(),
+                        end,
+                        row_starts,
+                        row_starts + strings_count + 1,
+                        list_offsets->mutable_view().begin<offset_type>());
+
+    auto ids = make_numeric_column(
+      data_type{type_id::INT32}, num_ids, mask_state::UNALLOCATED, _stream, mr);
+    thrust::transform(rmm::exec_policy(_stream),
+                      occurrences.begin(),
+                      end,
+                      ids->mutable_view().begin<int32_t>(),
+                      [] __device__(uint64_t occurrence) {
+                        return static_cast<int32_t>(occurrence & 0xFFFFFFFFu);
+                      });
+
+    return make_lists_column(strings_count,
+                             std::move(list_offsets),
+                             std::move(ids),
+                             strings.null_count(),
+                             cudf::detail::copy_bitmask(strings.parent(), _stream, mr),
+                             _stream,
+                             mr);
+  }
+
+  std::unique_ptr<column> find(strings_column_view const& strings,
+                               rmm::mr::device_memory_resource* mr) const
+  {
+    auto const strings_count = strings.size();
+    auto results             = make_numeric_column(data_type{type_id::INT32},
+                                       strings_count * _size,
+                                       mask_state::UNALLOCATED,
+                                       _stream,
+                                       mr);
+    if (strings_count == 0) return results;
+    auto const d_results = results->mutable_view().data<int32_t>();
+    thrust::fill(rmm::exec_policy(_stream), d_results, d_results + strings_count * _size, -1);
+
+    auto const d_strings = column_device_view::create(strings.parent(), _stream);
+    thrust::for_each_n(
+      rmm::exec_policy(_stream),
+      thrust::make_counting_iterator<size_type>(0),
+      strings_count,
+      [d_strings = *d_strings, d_automaton = automaton(), d_results, size = _size] __device__(
+        size_type idx) {
+        if (d_strings.is_null(idx)) return;
+        auto const row_results = d_results + idx * size;
+        // the first occurrence of each pattern is the first one to end
+        d_automaton.for_each_occurrence(
+          d_strings.element<string_view>(idx),
+          [row_results, d_automaton](size_type id, size_type chars) {
+            if (row_results[id] < 0) row_results[id] = chars - d_automaton.pattern_chars[id];
+          });
+      });
+    return results;
+  }
+
+  std::unique_ptr<column> replace(strings_column_view const& strings,
+                                  strings_column_view const& repls,
+                                  rmm::mr::device_memory_resource* mr) const
+  {
+    CUDF_EXPECTS(repls.size() > 0 && !repls.has_nulls(),
+                 "Parameter repls must not be empty and must not have nulls");
+    if (repls.size() > 1)
+      CUDF_EXPECTS(repls.size() == _size, "Sizes for patterns and repls must match");
+    if (strings.is_empty()) return make_empty_column(type_id::STRING);
+
+    auto const d_strings = column_device_view::create(strings.parent(), _stream);
+    auto const d_repls   = column_device_view::create(repls.parent(), _stream);
+
+    // this utility calls the given functor to build the offsets and chars columns
+    auto children = detail::make_strings_children(
+      replace_patterns_fn{*d_strings, *d_repls, automaton()}, strings.size(), _stream, mr);
+
+    return make_strings_column(strings.size(),
+                               std::move(children.first),
+                               std::move(children.second),
+                               strings.null_count(),
+                               cudf::detail::copy_bitmask(strings.parent(), _stream, mr));
+  }
+};
+
+multi_pattern_matcher::~multi_pattern_matcher() = default;
+
+multi_pattern_matcher::multi_pattern_matcher(strings_column_view const& patterns,
+                                             rmm::mr::device_memory_resource* mr)
+  : impl{std::make_unique<multi_pattern_matcher_impl>(patterns, mr)}
+{
+}
+
+size_type multi_pattern_matcher::size() const { return impl->_size; }
+
+std::unique_ptr<column> multi_pattern_matcher::contains(strings_column_view const& strings,
+                                                        rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->contains(strings, mr);
+}
+
+std::unique_ptr<column> multi_pattern_matcher::find(strings_column_view const& strings,
+                                                    rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->find(strings, mr);
+}
+
+std::unique_ptr<column> multi_pattern_matcher::replace(strings_column_view const& strings,
+                                                       strings_column_view const& repls,
+                                                       rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->replace(strings, repls, mr);
+}
+
+}  // namespace strings
+}  // namespace cudf
@@ -16,6 +16,7 @@
 
 #include <strings/regex/regcomp.h>
 
+#include <cudf/strings/string_view.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <algorithm>
@@ -103,6 +104,10 @@ const int32_t* reprog::starts_data() const { return _startinst_ids.data(); }
 
 int32_t reprog::starts_count() const { return static_cast<int>(_startinst_ids.size()); }
 
+const std::string& reprog::required_literal() const { return _required_literal; }
+
+const std::string& reprog::literal_prefix() const { return _literal_prefix; }
+
 /**
  * @brief Converts pattern into regex classes
  */
@@ -830,6 +835,7 @@ class regex_compiler {
     m_prog.set_start_inst(andstack[andstack.size() - 1].id_first);
     m_prog.optimize1();
     m_prog.optimize2();
+    m_prog.find_required_literals();
     m_prog.set_groups_count(cursubid);
   }
 };
@@ -926,6 +932,74 @@ void reprog::optimize2()
   _startinst_ids.push_back(-1);  // terminator mark
 }
 
+// find the literals every match contains, so the strings without them can be skipped
+void reprog::find_required_literals()
+{
+  _required_literal.clear();
+  _literal_prefix.clear();
+  // the search for the instructions every match goes through is quadratic
+  if (insts_count() > max_literal_search_insts) return;
+
+  std::vector<int> starts(_startinst_ids.begin(), _startinst_ids.end() - 1);
+  std::vector<bool> visited(insts_count());
+  // returns whether the END instruction can be reached without going through skip_id
+  auto reaches_end = [&](int skip_id) {
+    std::fill(visited.begin(), visited.end(), false);
+    std::vector<int> stack(starts);
+    while (!stack.empty()) {
+      int id = stack.back();
+      stack.pop_back();
+      if (id == skip_id || visited[id]) continue;
+      visited[id]        = true;
+      const reinst& inst = _insts[id];
+      if (inst.type == END) return true;
+      if (inst.type == OR) stack.push_back(inst.u1.right_id);
+      stack.push_back(inst.u2.next_id);  // also the left_id of OR
+    }
+    return false;
+  };
+  // groups and anchors between characters do not consume any
+  auto skip_non_consuming = [&](int id) {
+    for (int i = 0; i < insts_count(); ++i) {
+      int type = _insts[id].type;
+      if (type != LBRA && type != RBRA && type != BOL && type != EOL && type != BOW &&
+          type != NBOW)
+        break;
+      id = _insts[id].u2.next_id;
+    }
+    return id;
+  };
+  // returns the characters matched one after the other from instruction id, as UTF-8
+  auto literal_from = [&](int id) {
+    std::string literal;
+    for (int i = 0; i < max_literal_chars && _insts[id].type == CHAR; ++i) {
+      char bytes[4];
+      literal.append(bytes, from_char_utf8(_insts[id].u1.c, bytes));
+      id = skip_non_consuming(_insts[id].u2.next_id);
+    }
+    return literal;
+  };
+
+  // a literal starting at a CHAR every match goes through is in every match
+  reaches_end(-1);
+  std::vector<bool> reachable(visited);
+  std::vector<bool> in_literal(insts_count());
+  for (int id = 0; id < insts_count(); ++id) {
+    if (_insts[id].type != CHAR || !reachable[id] || in_literal[id] || reaches_end(id)) continue;
+    // the characters following this one are also gone through by every match
+    int next_id = id;
+    for (int i = 0; i < max_literal_chars && _insts[next_id].type == CHAR; ++i) {
+      in_literal[next_id] = true;
+      next_id             = skip_non_consuming(_insts[next_id].u2.next_id);
+    }
+    auto literal = literal_from(id);
+    if (literal.size() > _required_literal.size()) _required_literal = literal;
+  }
+
+  // the matches starting at a single instruction begin with its literal
+  if (starts.size() == 1) _literal_prefix = literal_from(skip_non_consuming(starts.front()));
+}
+
 #ifndef NDEBUG
 void reprog::print(regex_flags const flags)
 {
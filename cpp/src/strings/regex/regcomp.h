@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -111,11 +111,22 @@ class reprog {
   [[nodiscard]] const int32_t* starts_data() const;
   [[nodiscard]] int32_t starts_count() const;
 
+  /**
+   * @brief Returns the longest literal found in every match, as UTF-8, or an empty string.
+   */
+  [[nodiscard]] const std::string& required_literal() const;
+
+  /**
+   * @brief Returns the literal every match begins with, as UTF-8, or an empty string.
+   */
+  [[nodiscard]] const std::string& literal_prefix() const;
+
   void set_start_inst(int32_t id);
   [[nodiscard]] int32_t get_start_inst() const;
 
   void optimize1();
   void optimize2();
+  void find_required_literals();
   void print(regex_flags const flags);
 
  private:
@@ -124,6 +135,11 @@ class reprog {
   int32_t _startinst_id;
   std::vector<int32_t> _startinst_ids;  // short-cut to speed-up ORs
   int32_t _num_capturing_groups;
+  std::string _required_literal;  // found in every match
+  std::string _literal_prefix;    // every match begins with it
+
+  static constexpr int32_t max_literal_search_insts = 1000;
+  static constexpr int32_t max_literal_chars        = 64;
 };
 
 }  // namespace detail
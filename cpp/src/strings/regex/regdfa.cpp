@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <strings/regex/regdfa.h>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <utility>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+
+/**
+ * @brief Where a character position is, as needed by the beginning of line instructions.
+ */
+enum class line_context : int8_t {
+  STRING_BEGIN,  // first position of the string
+  LINE_BEGIN,    // position after a new-line, only told apart when the pattern is multi-line
+  OTHER
+};
+
+/**
+ * @brief The instructions evaluated at a character position and the context of that position.
+ */
+using dfa_state = std::pair<std::vector<int32_t>, line_context>;
+
+/**
+ * @brief Returns whether the instruction consuming a character matches `ch`.
+ */
+bool is_match(reprog& prog, reinst const& inst, char32_t ch)
+{
+  switch (inst.type) {
+    case CHAR: return inst.u1.c == ch;
+    case ANY: return ch != '\n';
+    case ANYNL: return true;
+    case CCLASS:
+    case NCCLASS: {
+      auto const& literals = prog.class_at(inst.u1.cls_id).literals;
+      bool found           = false;
+      for (std::size_t i = 0; !found && i + 1 < literals.size(); i += 2)
+        found = (ch >= literals[i]) && (ch <= literals[i + 1]);
+      return found == (inst.type == CCLASS);
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+std::optional<redfa> redfa::create_from(reprog& prog, bool anchored)
+{
+  auto const insts       = prog.insts_data();
+  auto const insts_count = prog.insts_count();
+
+  // the new-line is a class of its own since the dot and the end of line anchors test it
+  std::vector<char32_t> boundaries{'\n', '\n' + 1};
+  auto const add_range = [&boundaries](char32_t first, char32_t last) {
+    boundaries.push_back(first);
+    if (last < std::numeric_limits<char32_t>::max()) boundaries.push_back(last + 1);
+  };
+  bool multiline_bol = false;
+  for (int32_t id = 0; id < insts_count; ++id) {
+    auto const& inst = insts[id];
+    switch (inst.type) {
+      case CHAR: add_range(inst.u1.c, inst.u1.c); break;
+      case CCLASS:
+      case NCCLASS: {
+        auto const& cls = prog.class_at(inst.u1.cls_id);
+        // the builtin classes depend on the character types table
+        if (cls.builtins) return std::nullopt;
+        for (std::size_t i = 0; i + 1 < cls.literals.size(); i += 2)
+          add_range(cls.literals[i], cls.literals[i + 1]);
+        break;
+      }
+      case BOL: multiline_bol = multiline_bol || (inst.u1.c == '^'); break;
+      case ANY:
+      case ANYNL:
+      case EOL:
+      case LBRA:
+      case RBRA:
+      case OR:
+      case END: break;
+      default: return std::nullopt;  // the word boundaries depend on the character types table
+    }
+  }
+  std::sort(boundaries.begin(), boundaries.end());
+  boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+  if (boundaries.front() == 0) boundaries.erase(boundaries.begin());
+  if (static_cast<int32_t>(boundaries.size()) >= max_classes) return std::nullopt;
+
+  redfa dfa;
+  dfa.num_classes = static_cast<int32_t>(boundaries.size()) + 1;
+  // the first character of each class stands for the whole class
+  std::vector<char32_t> class_chars{0};
+  class_chars.insert(class_chars.end(), boundaries.begin(), boundaries.end());
+  for (char32_t ch = 0; ch < static_cast<char32_t>(ascii_count); ++ch) {
+    auto const cls = std::upper_bound(boundaries.begin(), boundaries.end(), ch);
+    dfa.ascii_classes.push_back(static_cast<uint8_t>(cls - boundaries.begin()));
+  }
+
+  std::vector<int32_t> starts;
+  for (int32_t i = 0; i < prog.starts_count() && prog.starts_data()[i] >= 0; ++i)
+    starts.push_back(prog.starts_data()[i]);
+
+  // Follows the instructions not consuming a character from those of `state`, as regexec
+  // expands them, into the instructions consuming the character. Returns whether END is reached.
+  std::vector<bool> visited(insts_count);
+  std::vector<int32_t> stack;
+  auto const expand = [&](dfa_state const& state,
+                          bool at_end,
+                          bool at_newline,
+                          std::vector<int32_t>& consumers) {
+    std::fill(visited.begin(), visited.end(), false);
+    stack.assign(state.first.begin(), state.first.end());
+    consumers.clear();
+    bool found = false;
+    while (!stack.empty()) {
+      auto const id = stack.back();
+      stack.pop_back();
+      if (visited[id]) continue;
+      visited[id]      = true;
+      auto const& inst = insts[id];
+      switch (inst.type) {
+        case LBRA:
+        case RBRA: stack.push_back(inst.u2.next_id); break;
+        case OR:
+          stack.push_back(inst.u1.right_id);
+          stack.push_back(inst.u2.left_id);
+          break;
+        case BOL:
+          if ((state.second == line_context::STRING_BEGIN) ||
+              ((inst.u1.c == '^') && (state.second == line_context::LINE_BEGIN)))
+            stack.push_back(inst.u2.next_id);
+          break;
+        case EOL:
+          if (at_end || (at_newline && (inst.u1.c == '$'))) stack.push_back(inst.u2.next_id);
+          break;
+        case END: found = true; break;
+        default: consumers.push_back(id);
+      }
+    }
+    return found;
+  };
+
+  // subset construction of the states reachable from the first position of the strings
+  std::map<dfa_state, int16_t> state_ids;
+  std::vector<dfa_state> states;
+  auto const add_state = [&](dfa_state&& state) {
+    auto const result = state_ids.emplace(state, static_cast<int16_t>(states.size()));
+    if (result.second) states.push_back(std::move(state));
+    return result.first->second;
+  };
+  add_state({starts, line_context::STRING_BEGIN});
+
+  std::vector<int32_t> consumers;
+  for (std::size_t id = 0; id < states.size(); ++id) {
+    if (static_cast<int32_t>(states.size()) > max_states ||
+        (id + 1) * dfa.num_classes > static_cast<std::size_t>(max_transitions))
+      return std::nullopt;
+    auto const state = states[id];
+    if (state.first.empty() && state.second == line_context::OTHER)
+      dfa.dead_state = static_cast<int16_t>(id);
+    dfa.accepts_at_end.push_back(expand(state, true, false, consumers));
+    for (auto const ch : class_chars) {
+      if (expand(state, false, ch == '\n', consumers)) {
+        dfa.transitions.push_back(match_state);
+        continue;
+      }
+      std::vector<int32_t> next;
+      for (auto const inst_id : consumers) {
+        if (is_match(prog, insts[inst_id], ch)) next.push_back(insts[inst_id].u2.next_id);
+      }
+      // the unanchored matches may start at any position
+      if (!anchored) next.insert(next.end(), starts.begin(), starts.end());
+      std::sort(next.begin(), next.end());
+      next.erase(std::unique(next.begin(), next.end()), next.end());
+      auto const context =
+        (multiline_bol && ch == '\n') ? line_context::LINE_BEGIN : line_context::OTHER;
+      dfa.transitions.push_back(add_state({std::move(next), context}));
+    }
+  }
+  if (static_cast<int32_t>(states.size()) > max_states) return std::nullopt;
+  dfa.num_states = static_cast<int32_t>(states.size());
+  return dfa;
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
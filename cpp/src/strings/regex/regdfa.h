@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <strings/regex/regcomp.h>
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief Deterministic automaton deciding whether a string has a match of a regex program.
+ *
+ * The characters are grouped into classes of consecutive UTF-8 characters which every
+ * instruction of the program treats the same, and each state has a transition for each class.
+ * A state is the set of instructions the program evaluates at a character position, along with
+ * whether that position is the beginning of a line.
+ *
+ * Only the programs made of literal characters, classes without builtins, alternations, groups
+ * and line anchors can be converted. The others, and those needing more states or transitions
+ * than the tables can hold in shared memory, are left to the regex instructions.
+ */
+struct redfa {
+  static constexpr int32_t max_states      = 256;    ///< Largest number of states
+  static constexpr int32_t max_classes     = 255;    ///< Largest number of character classes
+  static constexpr int32_t max_transitions = 16384;  ///< Largest number of states times classes
+  static constexpr int16_t match_state     = -1;     ///< Transition taken when a match is found
+  static constexpr int16_t ascii_count     = 128;    ///< Characters whose class is read directly
+
+  std::vector<char32_t> boundaries;     ///< First character of each class after the first one
+  std::vector<uint8_t> ascii_classes;   ///< Class of each of the first `ascii_count` characters
+  std::vector<int16_t> transitions;     ///< Next state for each state and class
+  std::vector<uint8_t> accepts_at_end;  ///< Whether a string ending in each state matches
+  int32_t num_states{0};
+  int32_t num_classes{0};
+  int16_t dead_state{-1};  ///< State from which no match can be found, if any
+
+  /**
+   * @brief Converts a regex program into an automaton.
+   *
+   * @param prog The compiled regex program
+   * @param anchored Whether matches may only start at the beginning of the strings
+   * @return The automaton, or no value if the program cannot be converted
+   */
+  static std::optional<redfa> create_from(reprog& prog, bool anchored);
+};
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
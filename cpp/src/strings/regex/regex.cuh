@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,8 +16,10 @@
 #pragma once
 
 #include <strings/regex/regcomp.h>
+#include <strings/regex/regdfa.h>
 
 #include <cudf/strings/regex/flags.hpp>
+#include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/types.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -27,6 +29,7 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 
 namespace cudf {
 
@@ -124,6 +127,21 @@ class reprog_device {
     size_type strings_count,
     rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Create the device program instance from a compiled regex program.
+   *
+   * @param h_prog The compiled regex program.
+   * @param codepoint_flags The code point lookup table for character types.
+   * @param strings_count Number of strings that will be evaluated.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return The program device object.
+   */
+  static std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> create(
+    reprog& h_prog,
+    uint8_t const* codepoint_flags,
+    size_type strings_count,
+    rmm::cuda_stream_view stream);
+
   /**
    * @brief Called automatically by the unique_ptr returned from create().
    */
@@ -165,6 +183,18 @@ class reprog_device {
    */
   [[nodiscard]] __device__ inline int32_t* startinst_ids() const;
 
+  /**
+   * @brief Returns whether the string holds the literals every match contains.
+   *
+   * The strings for which this returns false have no match, and need not be evaluated.
+   *
+   * @param d_str The string to check.
+   * @param anchored Whether the matches may only start at the beginning of the string.
+   * @return false if the string cannot have a match
+   */
+  [[nodiscard]] __device__ inline bool is_candidate(string_view const& d_str,
+                                                    bool anchored) const;
+
   /**
    * @brief Does a find evaluation using the compiled expression on the given string.
    *
@@ -217,6 +247,9 @@ class reprog_device {
   int32_t* _startinst_ids{};          // array of start instruction ids
   reclass_device* _classes{};         // array of regex classes
   void* _relists_mem{};               // runtime relist memory for regexec
+  const char* _required_literal{};    // UTF-8 literal found in every match
+  const char* _literal_prefix{};      // UTF-8 literal every match begins with
+  int32_t _required_bytes{}, _prefix_bytes{};
 
   /**
    * @brief Executes the regex pattern on the given string.
@@ -234,7 +267,109 @@ class reprog_device {
   reprog_device(reprog&);  // must use create()
 };
 
+/**
+ * @brief Automaton of a regex program stored on the device, deciding whether strings match.
+ *
+ * The tables of the automaton are kept in a single buffer of `size_bytes()` bytes, which the
+ * kernels copy into shared memory with `load()` before evaluating their strings.
+ */
+class redfa_device {
+ public:
+  redfa_device()                    = delete;
+  ~redfa_device()                   = default;
+  redfa_device(const redfa_device&) = default;
+  redfa_device(redfa_device&&)      = default;
+  redfa_device& operator=(const redfa_device&) = default;
+  redfa_device& operator=(redfa_device&&) = default;
+
+  /**
+   * @brief Create the device automaton instance from an automaton.
+   *
+   * @param h_dfa The automaton of a regex program.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return The automaton device object.
+   */
+  static std::unique_ptr<redfa_device, std::function<void(redfa_device*)>> create(
+    redfa const& h_dfa, rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Called automatically by the unique_ptr returned from create().
+   */
+  void destroy();
+
+  /**
+   * @brief Returns the number of bytes of the tables of the automaton.
+   */
+  [[nodiscard]] __host__ __device__ size_t size_bytes() const { return _size; }
+
+  /**
+   * @brief Copies the tables into `shared` and returns the automaton reading them from there.
+   *
+   * This must be called by all the threads of the block. The `shared` memory must be aligned
+   * for 4-byte words and hold `size_bytes()` bytes.
+   *
+   * @param shared Shared memory of the block
+   * @return The automaton reading its tables from `shared`
+   */
+  [[nodiscard]] __device__ inline redfa_device load(uint8_t* shared) const;
+
+  /**
+   * @brief Returns whether the string has a match of the regex program.
+   *
+   * @param d_str The string to evaluate
+   * @return true if a match is found
+   */
+  [[nodiscard]] __device__ inline bool is_match(string_view const& d_str) const;
+
+ private:
+  int32_t _num_classes, _boundaries_count;
+  int16_t _dead_state;
+  size_t _size;                  // size of the tables, a multiple of 4 bytes
+  size_t _transitions_offset{};  // sections of the tables buffer
+  size_t _ascii_classes_offset{};
+  size_t _accepts_at_end_offset{};
+  uint8_t const* _data{};  // tables buffer, starting with the class boundaries
+
+  redfa_device(redfa const&);  // must use create()
+};
+
 }  // namespace detail
+
+/**
+ * @brief Makes the device programs of the regex programs passed to the regex APIs.
+ */
+struct regex_device_builder {
+  /**
+   * @brief Returns the device program of `prog`, able to evaluate `strings_count` strings.
+   *
+   * The device program is made by the first call and kept by `prog`, and is only made again when
+   * its working memory is too small for `strings_count` strings.
+   *
+   * @param prog The compiled regex program
+   * @param strings_count Number of strings that will be evaluated
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return The device program, to be passed by value to the kernels
+   */
+  static detail::reprog_device create_prog_device(regex_program const& prog,
+                                                  size_type strings_count,
+                                                  rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns the device automaton of `prog`, if the program can be evaluated by one.
+   *
+   * The automaton is made by the first call for each kind of match and kept by `prog`.
+   *
+   * @param prog The compiled regex program
+   * @param anchored Whether the matches must start at the beginning of the strings
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return The device automaton, to be passed by value to the kernels, or no value if the
+   *         program cannot be converted into an automaton
+   */
+  static std::optional<detail::redfa_device> create_dfa_device(regex_program const& prog,
+                                                              bool anchored,
+                                                              rmm::cuda_stream_view stream);
+};
+
 }  // namespace strings
 }  // namespace cudf
 
@@ -21,6 +21,7 @@
 #include <cudf/strings/string_view.cuh>
 
 #include <memory.h>
+#include <thrust/binary_search.h>
 #include <thrust/execution_policy.h>
 #include <thrust/functional.h>
 #include <thrust/logical.h>
@@ -179,6 +180,28 @@ __device__ inline reclass_device reprog_device::get_class(int32_t idx) const
 
 __device__ inline int32_t* reprog_device::startinst_ids() const { return _startinst_ids; }
 
+__device__ inline bool reprog_device::is_candidate(string_view const& d_str, bool anchored) const
+{
+  auto const data  = d_str.data();
+  auto const bytes = d_str.size_bytes();
+  if (anchored && _prefix_bytes > 0) {
+    if (bytes < _prefix_bytes) return false;
+    for (int32_t i = 0; i < _prefix_bytes; ++i)
+      if (data[i] != _literal_prefix[i]) return false;
+  }
+  if (_required_bytes == 0) return true;
+  // UTF-8 sequences cannot start inside another character, so a byte search is enough
+  auto const first = _required_literal[0];
+  for (size_type pos = 0; pos + _required_bytes <= bytes; ++pos) {
+    if (data[pos] != first) continue;
+    int32_t i = 1;
+    while (i < _required_bytes && data[pos + i] == _required_literal[i])
+      ++i;
+    if (i == _required_bytes) return true;
+  }
+  return false;
+}
+
 /**
  * @brief Evaluate a specific string against regex pattern compiled to this instance.
  *
@@ -425,6 +448,42 @@ __device__ inline int32_t reprog_device::call_regexec<RX_STACK_ANY>(
   return regexec(dstr, jnk, begin, end, group_id);
 }
 
+__device__ inline redfa_device redfa_device::load(uint8_t* shared) const
+{
+  auto const words     = static_cast<uint32_t>(_size / sizeof(uint32_t));
+  auto const src_words = reinterpret_cast<uint32_t const*>(_data);
+  auto dst_words       = reinterpret_cast<uint32_t*>(shared);
+  for (auto i = threadIdx.x; i < words; i += blockDim.x)
+    dst_words[i] = src_words[i];
+  __syncthreads();
+  auto result  = *this;
+  result._data = shared;
+  return result;
+}
+
+__device__ inline bool redfa_device::is_match(string_view const& d_str) const
+{
+  auto const boundaries    = reinterpret_cast<char32_t const*>(_data);
+  auto const transitions   = reinterpret_cast<int16_t const*>(_data + _transitions_offset);
+  auto const ascii_classes = _data + _ascii_classes_offset;
+
+  int32_t state = 0;
+  for (auto itr = d_str.begin(); itr != d_str.end(); ++itr) {
+    auto const c   = static_cast<char32_t>(*itr);
+    auto const cls = c < static_cast<char32_t>(redfa::ascii_count)
+                       ? static_cast<int32_t>(ascii_classes[c])
+                       : static_cast<int32_t>(thrust::upper_bound(thrust::seq,
+                                                                  boundaries,
+                                                                  boundaries + _boundaries_count,
+                                                                  c) -
+                                              boundaries);
+    state = transitions[state * _num_classes + cls];
+    if (state == redfa::match_state) return true;
+    if (state == _dead_state) return false;
+  }
+  return _data[_accepts_at_end_offset + state] != 0;
+}
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,6 +16,7 @@
 
 #include <strings/regex/regcomp.h>
 #include <strings/regex/regex.cuh>
+#include <strings/utilities.hpp>
 
 #include <cudf/detail/utilities/integer_utils.hpp>
 
@@ -23,6 +24,8 @@
 #include <rmm/device_buffer.hpp>
 
 #include <algorithm>
+#include <array>
+#include <optional>
 
 namespace cudf {
 namespace strings {
@@ -92,6 +95,16 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
   std::vector<char32_t> pattern32 = string_to_char32_vector(pattern);
   // compile pattern into host object
   reprog h_prog = reprog::create_from(pattern32.data(), flags);
+  return reprog_device::create(h_prog, codepoint_flags, strings_count, stream);
+}
+
+// Create instance of a compiled reprog that can be passed into a device kernel
+std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_device::create(
+  reprog& h_prog,
+  uint8_t const* codepoint_flags,
+  size_type strings_count,
+  rmm::cuda_stream_view stream)
+{
   // compute size to hold all the member data
   auto insts_count   = h_prog.insts_count();
   auto classes_count = h_prog.classes_count();
@@ -105,7 +118,10 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
     cudf::util::round_up_safe<size_t>(classes_count * sizeof(_classes[0]), sizeof(size_t));
   for (int32_t idx = 0; idx < classes_count; ++idx)
     classes_size += static_cast<int32_t>((h_prog.class_at(idx).literals.size()) * sizeof(char32_t));
-  size_t memsize  = insts_size + startids_size + classes_size;
+  auto const& required_literal = h_prog.required_literal();
+  auto const& literal_prefix   = h_prog.literal_prefix();
+  size_t memsize = insts_size + startids_size + classes_size + required_literal.size() +
+                   literal_prefix.size();
   size_t rlm_size = 0;
   // check memory size needed for executing regex
   if (insts_count > RX_LARGE_INSTS) {
@@ -150,6 +166,15 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
     h_end += h_class.literals.size() * sizeof(char32_t);
     d_end += h_class.literals.size() * sizeof(char32_t);
   }
+  // append the literals used for skipping the strings without matches
+  memcpy(h_end, required_literal.data(), required_literal.size());
+  d_prog->_required_literal = reinterpret_cast<const char*>(d_end);
+  d_prog->_required_bytes   = static_cast<int32_t>(required_literal.size());
+  h_end += required_literal.size();
+  d_end += required_literal.size();
+  memcpy(h_end, literal_prefix.data(), literal_prefix.size());
+  d_prog->_literal_prefix = reinterpret_cast<const char*>(d_end);
+  d_prog->_prefix_bytes   = static_cast<int32_t>(literal_prefix.size());
   // initialize the rest of the elements
   d_prog->_insts_count     = insts_count;
   d_prog->_starts_count    = starts_count;
@@ -176,6 +201,146 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
 
 void reprog_device::destroy() { delete this; }
 
+redfa_device::redfa_device(redfa const& h_dfa)
+  : _num_classes{h_dfa.num_classes},
+    _boundaries_count{static_cast<int32_t>(h_dfa.boundaries.size())},
+    _dead_state{h_dfa.dead_state}
+{
+}
+
+// Create instance of the automaton that can be passed into a device kernel
+std::unique_ptr<redfa_device, std::function<void(redfa_device*)>> redfa_device::create(
+  redfa const& h_dfa, rmm::cuda_stream_view stream)
+{
+  // compute size of each section; each is aligned for the 4-byte words copied by load()
+  auto const word_size = sizeof(uint32_t);
+  auto boundaries_size = h_dfa.boundaries.size() * sizeof(h_dfa.boundaries[0]);
+  auto transitions_size =
+    cudf::util::round_up_safe(h_dfa.transitions.size() * sizeof(h_dfa.transitions[0]), word_size);
+  auto ascii_classes_size  = cudf::util::round_up_safe(h_dfa.ascii_classes.size(), word_size);
+  auto accepts_at_end_size = cudf::util::round_up_safe(h_dfa.accepts_at_end.size(), word_size);
+
+  auto* d_dfa                   = new redfa_device(h_dfa);
+  d_dfa->_transitions_offset    = boundaries_size;
+  d_dfa->_ascii_classes_offset  = d_dfa->_transitions_offset + transitions_size;
+  d_dfa->_accepts_at_end_offset = d_dfa->_ascii_classes_offset + ascii_classes_size;
+  d_dfa->_size                  = d_dfa->_accepts_at_end_offset + accepts_at_end_size;
+
+  // put everything into a flat host buffer first
+  std::vector<u_char> h_buffer(d_dfa->_size);
+  memcpy(h_buffer.data(), h_dfa.boundaries.data(), boundaries_size);
+  memcpy(h_buffer.data() + d_dfa->_transitions_offset,
+         h_dfa.transitions.data(),
+         h_dfa.transitions.size() * sizeof(h_dfa.transitions[0]));
+  memcpy(h_buffer.data() + d_dfa->_ascii_classes_offset,
+         h_dfa.ascii_classes.data(),
+         h_dfa.ascii_classes.size());
+  memcpy(h_buffer.data() + d_dfa->_accepts_at_end_offset,
+         h_dfa.accepts_at_end.data(),
+         h_dfa.accepts_at_end.size());
+
+  // copy flat tables to device memory
+  auto* d_buffer = new rmm::device_buffer(d_dfa->_size, stream);
+  d_dfa->_data   = reinterpret_cast<uint8_t const*>(d_buffer->data());
+  CUDA_TRY(cudaMemcpyAsync(
+    d_buffer->data(), h_buffer.data(), d_dfa->_size, cudaMemcpyHostToDevice, stream.value()));
+
+  auto deleter = [d_buffer](redfa_device* t) {
+    t->destroy();
+    delete d_buffer;
+  };
+  return std::unique_ptr<redfa_device, std::function<void(redfa_device*)>>(d_dfa, deleter);
+}
+
+void redfa_device::destroy() { delete this; }
+
 }  // namespace detail
+
+struct regex_program::regex_program_impl {
+  using redfa_device_ptr =
+    std::unique_ptr<detail::redfa_device, std::function<void(detail::redfa_device*)>>;
+
+  detail::reprog prog;  // compiled host program
+  std::unique_ptr<detail::reprog_device, std::function<void(detail::reprog_device*)>> d_prog;
+  size_type d_prog_strings{0};          // number of strings the working memory is sized for
+  rmm::cuda_stream_view d_prog_stream;  // stream of the last call using d_prog
+  // automata of the unanchored and anchored matches, once made; null when there is none
+  std::array<std::optional<redfa_device_ptr>, 2> d_dfas;
+  rmm::cuda_stream_view d_dfa_stream;  // stream of the last call using d_dfas
+};
+
+std::unique_ptr<regex_program> regex_program::create(std::string const& pattern,
+                                                     regex_flags flags)
+{
+  return std::unique_ptr<regex_program>(new regex_program(pattern, flags));
+}
+
+regex_program::regex_program(std::string const& pattern, regex_flags flags)
+  : _pattern(pattern), _flags(flags), _impl(std::make_unique<regex_program_impl>())
+{
+  auto const pattern32 = detail::string_to_char32_vector(pattern);
+  _impl->prog          = detail::reprog::create_from(pattern32.data(), flags);
+}
+
+regex_program::regex_program(regex_program&& other) noexcept = default;
+regex_program& regex_program::operator=(regex_program&& other) noexcept = default;
+regex_program::~regex_program()                                         = default;
+
+std::string regex_program::pattern() const { return _pattern; }
+
+regex_flags regex_program::flags() const { return _flags; }
+
+int32_t regex_program::instructions_count() const { return _impl->prog.insts_count(); }
+
+int32_t regex_program::groups_count() const { return _impl->prog.groups_count(); }
+
+detail::reprog_device regex_device_builder::create_prog_device(regex_program const& prog,
+                                                               size_type strings_count,
+                                                               rmm::cuda_stream_view stream)
+{
+  auto& impl = *prog._impl;
+  // only the programs evaluated in global memory need working memory for each string
+  auto const needs_working_memory = impl.prog.insts_count() > detail::RX_LARGE_INSTS;
+  if (!impl.d_prog || (needs_working_memory && strings_count > impl.d_prog_strings)) {
+    // the previous device program may still be in use by the last call
+    if (impl.d_prog) { impl.d_prog_stream.synchronize(); }
+    impl.d_prog = detail::reprog_device::create(
+      impl.prog, detail::get_character_flags_table(), strings_count, stream);
+    impl.d_prog_strings = strings_count;
+  } else if (impl.d_prog_stream.value() != stream.value()) {
+    // the device program was copied or last used on another stream
+    impl.d_prog_stream.synchronize();
+  }
+  impl.d_prog_stream = stream;
+  return *impl.d_prog;
+}
+
+std::optional<detail::redfa_device> regex_device_builder::create_dfa_device(
+  regex_program const& prog, bool anchored, rmm::cuda_stream_view stream)
+{
+  auto& impl  = *prog._impl;
+  auto& d_dfa = impl.d_dfas[anchored];
+  if (!d_dfa) {
+    auto const h_dfa = detail::redfa::create_from(impl.prog, anchored);
+    if (!h_dfa) {
+      d_dfa = regex_program_impl::redfa_device_ptr{};
+      return std::nullopt;
+    }
+    // the other automaton may still be copied on the stream of the last call
+    auto const& other = impl.d_dfas[!anchored];
+    if (other && *other && impl.d_dfa_stream.value() != stream.value()) {
+      impl.d_dfa_stream.synchronize();
+    }
+    d_dfa = detail::redfa_device::create(*h_dfa, stream);
+  } else if (!*d_dfa) {
+    return std::nullopt;
+  } else if (impl.d_dfa_stream.value() != stream.value()) {
+    // the device automata were copied or last used on another stream
+    impl.d_dfa_stream.synchronize();
+  }
+  impl.d_dfa_stream = stream;
+  return **d_dfa;
+}
+
 }  // namespace strings
 }  // namespace cudf
@@ -53,22 +53,14 @@ struct replace_regex_fn {
   reprog_device prog;
   string_view const d_repl;
   size_type const maxrepl;
-  int32_t* d_offsets{};
-  char* d_chars{};
 
-  __device__ void operator()(size_type idx)
+  __device__ void operator()(size_type idx, bounded_chars_writer& out)
   {
-    if (d_strings.is_null(idx)) {
-      if (!d_chars) d_offsets[idx] = 0;
-      return;
-    }
+    if (d_strings.is_null(idx)) return;
 
     auto const d_str = d_strings.element<string_view>(idx);
-    auto nbytes      = d_str.size_bytes();                  // number of bytes in input string
     auto mxn = maxrepl < 0 ? d_str.length() + 1 : maxrepl;  // max possible replaces for this string
     auto in_ptr        = d_str.data();                      // input pointer (i)
-    auto out_ptr       = d_chars ? d_chars + d_offsets[idx]  // output pointer (o)
-                                 : nullptr;
     size_type last_pos = 0;
     int32_t begin      = 0;   // these are for calling prog.find
     int32_t end        = -1;  // matches final word-boundary if at the end of the string
@@ -80,31 +72,39 @@ struct replace_regex_fn {
         break;  // no more matches
       }
 
-      auto const start_pos = d_str.byte_offset(begin);        // get offset for these
-      auto const end_pos   = d_str.byte_offset(end);          // character position values
-      nbytes += d_repl.size_bytes() - (end_pos - start_pos);  // and compute new size
-
-      if (out_ptr) {                                         // replace:
-                                                             // i:bbbbsssseeee
-        out_ptr = copy_and_increment(out_ptr,                //   ^
-                                     in_ptr + last_pos,      // o:bbbb
-                                     start_pos - last_pos);  //       ^
-        out_ptr = copy_string(out_ptr, d_repl);              // o:bbbbrrrrrr
-                                                             //  out_ptr ---^
-        last_pos = end_pos;                                  // i:bbbbsssseeee
-      }                                                      //  in_ptr --^
-
+      auto const start_pos = d_str.byte_offset(begin);  // get offset for these
+      auto const end_pos   = d_str.byte_offset(end);    // character position values
+                                                        // replace:
+                                                        // i:bbbbsssseeee
+      out.write(in_ptr + last_pos,                      //   ^
+                start_pos - last_pos);                  // o:bbbb
+      out.write(d_repl);                                // o:bbbbrrrrrr
+      last_pos = end_pos;                               // i:bbbbsssseeee
+                                                        //  in_ptr --^
       begin = end + (begin == end);
       end   = -1;
     }
 
-    if (out_ptr) {
-      memcpy(out_ptr,                         // copy the remainder
-             in_ptr + last_pos,               // o:bbbbrrrrrreeee
-             d_str.size_bytes() - last_pos);  //             ^   ^
-    } else {
-      d_offsets[idx] = static_cast<int32_t>(nbytes);
-    }
+    out.write(in_ptr + last_pos,               // copy the remainder
+              d_str.size_bytes() - last_pos);  // o:bbbbrrrrrreeee
+  }
+};
+
+/**
+ * @brief Returns the estimated size of each output string of `replace_regex_fn`.
+ *
+ * The output cannot be longer than the input when the replacement is empty. Otherwise room is
+ * left for the output to double, the strings growing further being written a second time.
+ */
+struct replace_regex_capacity_fn {
+  column_device_view const d_strings;
+  string_view const d_repl;
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    if (d_strings.is_null(idx)) return 0;
+    auto const bytes = d_strings.element<string_view>(idx).size_bytes();
+    return d_repl.empty() ? bytes : 2 * bytes + d_repl.size_bytes();
   }
 };
 
@@ -113,10 +113,9 @@ struct replace_regex_fn {
 //
 std::unique_ptr<column> replace_re(
   strings_column_view const& strings,
-  std::string const& pattern,
+  regex_program const& prog,
   string_scalar const& replacement,
   std::optional<size_type> max_replace_count,
-  regex_flags const flags,
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
@@ -128,10 +127,8 @@ std::unique_ptr<column> replace_re(
 
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_strings      = *strings_column;
-  // compile regex into device object
-  auto prog =
-    reprog_device::create(pattern, flags, get_character_flags_table(), strings_count, stream);
-  auto d_prog            = *prog;
+  // get the device object of the compiled regex
+  auto d_prog            = regex_device_builder::create_prog_device(prog, strings_count, stream);
   auto const regex_insts = d_prog.insts_counts();
 
   // copy null mask
@@ -139,22 +136,23 @@ std::unique_ptr<column> replace_re(
   auto const null_count = strings.null_count();
   auto const maxrepl    = max_replace_count.value_or(-1);
 
-  // create child columns
+  // create child columns, each string being written once unless it outgrows its estimate
+  replace_regex_capacity_fn const capacity_fn{d_strings, d_repl};
   auto children = [&] {
     // Each invocation is predicated on the stack size which is dependent on the number of regex
     // instructions
     if (regex_insts <= RX_SMALL_INSTS) {
       replace_regex_fn<RX_STACK_SMALL> fn{d_strings, d_prog, d_repl, maxrepl};
-      return make_strings_children(fn, strings_count, stream, mr);
+      return make_strings_children_speculative(fn, capacity_fn, strings_count, stream, mr);
     } else if (regex_insts <= RX_MEDIUM_INSTS) {
       replace_regex_fn<RX_STACK_MEDIUM> fn{d_strings, d_prog, d_repl, maxrepl};
-      return make_strings_children(fn, strings_count, stream, mr);
+      return make_strings_children_speculative(fn, capacity_fn, strings_count, stream, mr);
     } else if (regex_insts <= RX_LARGE_INSTS) {
       replace_regex_fn<RX_STACK_LARGE> fn{d_strings, d_prog, d_repl, maxrepl};
-      return make_strings_children(fn, strings_count, stream, mr);
+      return make_strings_children_speculative(fn, capacity_fn, strings_count, stream, mr);
     } else {
       replace_regex_fn<RX_STACK_ANY> fn{d_strings, d_prog, d_repl, maxrepl};
-      return make_strings_children(fn, strings_count, stream, mr);
+      return make_strings_children_speculative(fn, capacity_fn, strings_count, stream, mr);
     }
   }();
 
@@ -165,6 +163,19 @@ std::unique_ptr<column> replace_re(
                              std::move(null_mask));
 }
 
+std::unique_ptr<column> replace_re(
+  strings_column_view const& strings,
+  std::string const& pattern,
+  string_scalar const& replacement,
+  std::optional<size_type> max_replace_count,
+  regex_flags const flags,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  auto const prog = regex_program::create(pattern, flags);
+  return replace_re(strings, *prog, replacement, max_replace_count, stream, mr);
+}
+
 }  // namespace detail
 
 // external API
@@ -181,5 +192,16 @@ std::unique_ptr<column> replace_re(strings_column_view const& strings,
     strings, pattern, replacement, max_replace_count, flags, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> replace_re(strings_column_view const& strings,
+                                   regex_program const& prog,
+                                   string_scalar const& replacement,
+                                   std::optional<size_type> max_replace_count,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::replace_re(
+    strings, prog, replacement, max_replace_count, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
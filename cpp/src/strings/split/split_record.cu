@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -28,9 +28,15 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/remove.h>
 #include <thrust/scan.h>
 #include <thrust/transform.h>
 
+#include <string>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -217,8 +223,212 @@ struct whitespace_token_reader_fn {
   }
 };
 
+/**
+ * @brief Average string byte-length threshold for deciding between splitting each string with
+ * a thread and splitting all the characters of the column in parallel.
+ */
+constexpr size_type BYTES_PER_VALID_ROW_THRESHOLD = 64;
+
+/**
+ * @brief Returns whether the delimiter occurrences found at every byte position never overlap,
+ * so they are the same as those found from the beginning, or the end, of each string.
+ *
+ * This is the case when no proper prefix of the delimiter is also its suffix.
+ */
+bool is_non_overlapping(std::string const& delimiter)
+{
+  auto const length = delimiter.size();
+  for (std::size_t width = 1; width < length; ++width) {
+    if (delimiter.compare(0, width, delimiter, length - width, width) == 0) { return false; }
+  }
+  return true;
+}
+
+/**
+ * @brief Returns whether the delimiter starts at the byte position `idx` of the chars buffer.
+ */
+struct delimiter_match_fn {
+  char const* d_chars;
+  string_view const d_delimiter;
+
+  __device__ bool operator()(size_type idx) const
+  {
+    return d_delimiter.compare(d_chars + idx, d_delimiter.size_bytes()) == 0;
+  }
+};
+
+/**
+ * @brief Returns whether the delimiter matched at the byte position `idx` of the chars buffer
+ * is not wholly within a valid string.
+ */
+struct delimiter_outside_fn {
+  column_device_view const d_strings;
+  int32_t const* d_offsets;  // offsets of the strings in the chars buffer
+  size_type const delimiter_bytes;
+
+  __device__ bool operator()(size_type idx) const
+  {
+    auto const row = static_cast<size_type>(
+      thrust::upper_bound(thrust::seq, d_offsets, d_offsets + d_strings.size() + 1, idx) -
+      d_offsets - 1);
+    return row < 0 || row >= d_strings.size() || d_strings.is_null(row) ||
+           idx + delimiter_bytes > d_offsets[row + 1];
+  }
+};
+
+/**
+ * @brief Returns the number of delimiters used for splitting the `idx'th` string element of
+ * `d_strings`, out of those it contains.
+ */
+__device__ size_type used_delimiters(size_type const* d_string_delimiters,
+                                     size_type max_tokens,
+                                     size_type idx)
+{
+  auto const count = d_string_delimiters[idx + 1] - d_string_delimiters[idx];
+  return count < max_tokens - 1 ? count : max_tokens - 1;
+}
+
+/**
+ * @brief Computes the number of tokens of the `idx'th` string element of `d_strings` from the
+ * delimiters it contains.
+ */
+struct char_parallel_token_counter_fn {
+  column_device_view const d_strings;
+  size_type const* d_string_delimiters;  // first delimiter of each string
+  size_type const max_tokens;
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    if (d_strings.is_null(idx)) { return 0; }
+    return used_delimiters(d_string_delimiters, max_tokens, idx) + 1;
+  }
+};
+
+/**
+ * @brief Identifies the `idx'th` output token from the positions of the delimiters.
+ *
+ * When there are more delimiters in a string than used, the first ones are used moving forward
+ * and the last ones moving backward.
+ */
+template <Dir dir>
+struct char_parallel_token_reader_fn {
+  column_device_view const d_strings;
+  char const* d_chars;
+  int32_t const* d_offsets;              // offsets of the strings in the chars buffer
+  size_type const* d_delimiters;         // byte positions of the delimiters in the chars buffer
+  size_type const* d_string_delimiters;  // first delimiter of each string
+  int32_t const* d_token_offsets;        // first token of each string
+  size_type const delimiter_bytes;
+  size_type const max_tokens;
+
+  __device__ string_index_pair operator()(size_type idx) const
+  {
+    auto const row = static_cast<size_type>(
+      thrust::upper_bound(
+        thrust::seq, d_token_offsets, d_token_offsets + d_strings.size() + 1, idx) -
+      d_token_offsets - 1);
+    auto const token_idx = idx - d_token_offsets[row];
+    auto const count     = used_delimiters(d_string_delimiters, max_tokens, row);
+    auto const first     = dir == Dir::FORWARD ? d_string_delimiters[row]
+                                               : d_string_delimiters[row + 1] - count;
+    auto const begin =
+      token_idx == 0 ? d_offsets[row] : d_delimiters[first + token_idx - 1] + delimiter_bytes;
+    auto const end = token_idx == count ? d_offsets[row + 1] : d_delimiters[first + token_idx];
+    return string_index_pair{d_chars + begin, end - begin};
+  }
+};
+
 }  // namespace
 
+/**
+ * @brief Splits each string by locating the delimiters at all the byte positions of the chars
+ * in parallel, so that the work stays balanced however long the strings are.
+ *
+ * The delimiter must not overlap with itself, so that the delimiters found are those located
+ * by searching each string from the beginning or the end.
+ */
+template <Dir dir>
+std::unique_ptr<column> split_record_char_parallel(strings_column_view const& strings,
+                                                   string_view d_delimiter,
+                                                   size_type max_tokens,
+                                                   size_type chars_start,
+                                                   size_type chars_end,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  auto const strings_count  = strings.size();
+  auto const d_strings      = column_device_view::create(strings.parent(), stream);
+  auto const d_offsets      = strings.offsets().data<int32_t>() + strings.offset();
+  auto const d_chars        = strings.chars().data<char>();
+  auto const bytes          = d_delimiter.size_bytes();
+  auto const positions_end  = std::max(chars_end - bytes + 1, chars_start);
+  auto const positions      = thrust::make_counting_iterator<size_type>(chars_start);
+  auto const positions_size = positions_end - chars_start;
+
+  // locate the delimiters, then drop those across strings or within null strings
+  auto const match_fn = delimiter_match_fn{d_chars, d_delimiter};
+  rmm::device_uvector<size_type> delimiters(
+    thrust::count_if(rmm::exec_policy(stream), positions, positions + positions_size, match_fn),
+    stream);
+  thrust::copy_if(rmm::exec_policy(stream),
+                  positions,
+                  positions + positions_size,
+                  delimiters.begin(),
+                  match_fn);
+  auto const delimiters_end = thrust::remove_if(rmm::exec_policy(stream),
+                                                delimiters.begin(),
+                                                delimiters.end(),
+                                                delimiter_outside_fn{*d_strings, d_offsets, bytes});
+  delimiters.resize(thrust::distance(delimiters.begin(), delimiters_end), stream);
+
+  // the delimiters of each string are those between the string offsets
+  rmm::device_uvector<size_type> string_delimiters(strings_count + 1, stream);
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      delimiters.begin(),
+                      delimiters.end(),
+                      d_offsets,
+                      d_offsets + strings_count + 1,
+                      string_delimiters.begin());
+
+  auto offsets = make_numeric_column(
+    data_type{type_id::INT32}, strings_count + 1, mask_state::UNALLOCATED, stream, mr);
+  auto d_token_offsets = offsets->mutable_view().data<int32_t>();
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(strings_count),
+    d_token_offsets,
+    char_parallel_token_counter_fn{*d_strings, string_delimiters.data(), max_tokens});
+  thrust::exclusive_scan(rmm::exec_policy(stream),
+                         d_token_offsets,
+                         d_token_offsets + strings_count + 1,
+                         d_token_offsets);
+
+  auto const total_tokens =
+    cudf::detail::get_value<int32_t>(offsets->view(), strings_count, stream);
+  rmm::device_uvector<string_index_pair> tokens(total_tokens, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(total_tokens),
+                    tokens.begin(),
+                    char_parallel_token_reader_fn<dir>{*d_strings,
+                                                       d_chars,
+                                                       d_offsets,
+                                                       delimiters.data(),
+                                                       string_delimiters.data(),
+                                                       d_token_offsets,
+                                                       bytes,
+                                                       max_tokens});
+  auto strings_output = make_strings_column(tokens.begin(), tokens.end(), stream, mr);
+  return make_lists_column(strings_count,
+                           std::move(offsets),
+                           std::move(strings_output),
+                           strings.null_count(),
+                           copy_bitmask(strings.parent(), stream, mr),
+                           stream,
+                           mr);
+}
+
 // The output is one list item per string
 template <typename TokenCounter, typename TokenReader>
 std::unique_ptr<column> split_record_fn(strings_column_view const& strings,
@@ -282,6 +492,19 @@ std::unique_ptr<column> split_record(
                            mr);
   } else {
     string_view d_delimiter(delimiter.data(), delimiter.size());
+
+    // long strings are split in parallel over their characters
+    auto const valid_count = strings.size() - strings.null_count();
+    if (valid_count > 0 && is_non_overlapping(delimiter.to_string(stream))) {
+      auto const chars_start =
+        cudf::detail::get_value<int32_t>(strings.offsets(), strings.offset(), stream);
+      auto const chars_end = cudf::detail::get_value<int32_t>(
+        strings.offsets(), strings.offset() + strings.size(), stream);
+      if ((chars_end - chars_start) / valid_count >= BYTES_PER_VALID_ROW_THRESHOLD) {
+        return split_record_char_parallel<dir>(
+          strings, d_delimiter, max_tokens, chars_start, chars_end, stream, mr);
+      }
+    }
     return split_record_fn(strings,
                            token_counter_fn{*d_strings_column_ptr, d_delimiter, max_tokens},
                            token_reader_fn<dir>{*d_strings_column_ptr, d_delimiter},
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -28,9 +28,13 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/extrema.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
 #include <thrust/transform_reduce.h>
 #include <thrust/transform_scan.h>
 
+#include <cstdint>
 #include <cstring>
 
 namespace cudf {
@@ -107,6 +111,58 @@ std::unique_ptr<column> create_chars_child_column(cudf::size_type total_bytes,
     data_type{type_id::INT8}, total_bytes, mask_state::UNALLOCATED, stream, mr);
 }
 
+namespace {
+
+/**
+ * @brief Returns whether a byte in the 8-byte word `word_idx` of `d_chars` is not ASCII.
+ *
+ * The words entirely within `[begin, end)` are read at once, and the bytes of the first and last
+ * words are read one at a time.
+ */
+struct non_ascii_word_fn {
+  char const* d_chars;  // aligned to 8 bytes
+  int64_t const begin;
+  int64_t const end;
+
+  __device__ bool operator()(int64_t word_idx) const
+  {
+    constexpr uint64_t high_bits = 0x8080808080808080UL;
+    auto const first             = word_idx * static_cast<int64_t>(sizeof(uint64_t));
+    auto const last              = first + static_cast<int64_t>(sizeof(uint64_t));
+    if (first >= begin && last <= end) {
+      return (reinterpret_cast<uint64_t const*>(d_chars)[word_idx] & high_bits) != 0;
+    }
+    bool result = false;
+    for (auto idx = thrust::max(first, begin); idx < thrust::min(last, end); ++idx) {
+      result = result || (static_cast<uint8_t>(d_chars[idx]) & 0x80);
+    }
+    return result;
+  }
+};
+
+}  // namespace
+
+bool is_all_ascii(cudf::strings_column_view const& strings, rmm::cuda_stream_view stream)
+{
+  if (strings.is_empty()) return true;
+  auto const offsets = strings.offsets();
+  auto const begin   = cudf::detail::get_value<offset_type>(offsets, strings.offset(), stream);
+  auto const end =
+    cudf::detail::get_value<offset_type>(offsets, strings.offset() + strings.size(), stream);
+  if (begin == end) return true;
+
+  constexpr int64_t word_size = sizeof(uint64_t);
+  auto const d_chars   = strings.chars().data<char>() + begin;
+  auto const address   = reinterpret_cast<std::uintptr_t>(d_chars);
+  auto const skew      = static_cast<int64_t>(address % word_size);
+  auto const num_bytes = static_cast<int64_t>(end - begin);
+  auto const num_words = (skew + num_bytes + word_size - 1) / word_size;
+  return !thrust::any_of(rmm::exec_policy(stream),
+                         thrust::make_counting_iterator<int64_t>(0),
+                         thrust::make_counting_iterator<int64_t>(num_words),
+                         non_ascii_word_fn{d_chars - skew, skew, skew + num_bytes});
+}
+
 namespace {
 // The device variables are created here to avoid using a singleton that may cause issues
 // with RMM initialize/finalize. See PR #3159 for details on this approach.
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/structs/utilities.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace structs {
+namespace detail {
+
+std::shared_ptr<preprocessed_table> preprocessed_table::create(
+  table_view const& input,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  column_nullability nullability,
+  rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(column_order.empty() or
+                 static_cast<std::size_t>(input.num_columns()) == column_order.size(),
+               "Mismatch between number of columns and column order.");
+  CUDF_EXPECTS(null_precedence.empty() or
+                 static_cast<std::size_t>(input.num_columns()) == null_precedence.size(),
+               "Mismatch between number of columns and null_precedence size.");
+
+  auto flattened = flatten_nested_columns(input, column_order, null_precedence, nullability);
+
+  auto d_table           = table_device_view::create(flattened.flattened_columns(), stream);
+  auto device_view       = table_device_view_owner{d_table.release(), d_table.get_deleter()};
+  auto d_column_order    = cudf::detail::make_device_uvector_async(flattened.orders(), stream);
+  auto d_null_precedence = cudf::detail::make_device_uvector_async(flattened.null_orders(), stream);
+  auto const nulls       = cudf::has_nulls(flattened.flattened_columns());
+
+  // The host orders copied from are temporaries of `flattened`
+  stream.synchronize();
+
+  return std::shared_ptr<preprocessed_table>(new preprocessed_table(std::move(flattened),
+                                                                    std::move(device_view),
+                                                                    std::move(d_column_order),
+                                                                    std::move(d_null_precedence),
+                                                                    nulls));
+}
+
+}  // namespace detail
+}  // namespace structs
+}  // namespace cudf
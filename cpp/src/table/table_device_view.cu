@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,6 +15,9 @@
  */
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/device_view_cache.hpp>
+#include <cudf/detail/utilities/stream_capture.hpp>
+#include <cudf/table/cached_table_device_view.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
@@ -23,6 +26,16 @@
 
 #include <thrust/logical.h>
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 template <typename ColumnDeviceView, typename HostTableView>
@@ -54,6 +67,294 @@ template class table_device_view_base<column_device_view, table_view>;
 // Explicit instantiation for a device table of mutable views
 template class table_device_view_base<mutable_column_device_view, mutable_table_view>;
 
+struct cached_device_views {
+  using column_view_ptr =
+    std::unique_ptr<column_device_view, std::function<void(column_device_view*)>>;
+
+  cached_device_views(table_view source, rmm::cuda_stream_view stream)
+    : source{std::move(source)}, stream{stream}
+  {
+  }
+
+  cached_device_views(cached_device_views const&) = delete;
+  cached_device_views& operator=(cached_device_views const&) = delete;
+
+  // The views are freed in the order of `stream`, after the work of the other streams using them
+  ~cached_device_views()
+  {
+    for (auto const& stream_event : stream_events) {
+      cudaEventSynchronize(stream_event.second);
+      cudaEventDestroy(stream_event.second);
+    }
+  }
+
+  /**
+   * @brief Creates the event recording the use of the views on `other_stream`, unless it exists.
+   */
+  void add_stream(rmm::cuda_stream_view other_stream) const
+  {
+    if (other_stream == stream) { return; }
+    std::lock_guard<std::mutex> lock(mutex);
+    if (find_event(other_stream) != stream_events.end()) { return; }
+    cudaEvent_t event;
+    CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    stream_events.emplace_back(other_stream.value(), event);
+  }
+
+  /**
+   * @brief Records the work enqueued on `other_stream` so far, which the views are freed after.
+   */
+  void record_stream(rmm::cuda_stream_view other_stream) const noexcept
+  {
+    if (other_stream == stream) { return; }
+    std::lock_guard<std::mutex> lock(mutex);
+    auto const it       = find_event(other_stream);
+    auto const recorded = it != stream_events.end() and
+                          cudaEventRecord(it->second, other_stream.value()) == cudaSuccess;
+    if (not recorded) { cudaStreamSynchronize(other_stream.value()); }
+  }
+
+  table_view source;
+  rmm::cuda_stream_view stream;
+  std::unique_ptr<table_device_view, table_device_view_deleter> table;
+  // The views of the columns of `source` that have children, with their indices
+  std::vector<std::pair<size_type, column_view_ptr>> columns;
+
+ private:
+  auto find_event(rmm::cuda_stream_view other_stream) const
+  {
+    return std::find_if(stream_events.begin(), stream_events.end(), [&](auto const& stream_event) {
+      return stream_event.first == other_stream.value();
+    });
+  }
+
+  mutable std::mutex mutex;
+  // An event of each other stream the views were returned for
+  mutable std::vector<std::pair<cudaStream_t, cudaEvent_t>> stream_events;
+};
+
+void release_cached_device_view(cached_device_views const& owner,
+                                rmm::cuda_stream_view stream) noexcept
+{
+  owner.record_stream(stream);
+}
+
+namespace {
+/**
+ * @brief Returns whether the device views of two columns are the same.
+ */
+bool is_same_view(column_view const& lhs, column_view const& rhs)
+{
+  return lhs.type() == rhs.type() and lhs.size() == rhs.size() and lhs.head() == rhs.head() and
+         lhs.null_mask() == rhs.null_mask() and lhs.offset() == rhs.offset() and
+         lhs.num_children() == rhs.num_children() and
+         std::equal(lhs.child_begin(), lhs.child_end(), rhs.child_begin(), [](auto& l, auto& r) {
+           return is_same_view(l, r);
+         });
+}
+
+/**
+ * @brief Returns whether the device views of two tables are the same.
+ */
+bool is_same_view(table_view const& lhs, table_view const& rhs)
+{
+  return lhs.num_columns() == rhs.num_columns() and lhs.num_rows() == rhs.num_rows() and
+         std::equal(lhs.begin(), lhs.end(), rhs.begin(), [](auto& l, auto& r) {
+           return is_same_view(l, r);
+         });
+}
+
+std::size_t combine_hash(std::size_t seed, std::size_t hash)
+{
+  return seed ^ (hash + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+/**
+ * @brief Returns a hash of the pointers and offsets of a column and its descendants, so that the
+ * columns with the same device views have the same hash.
+ *
+ * The parents of strings, lists and structs columns have no data, which is why the children are
+ * part of the hash.
+ */
+std::size_t view_hash(column_view const& source)
+{
+  auto hash = combine_hash(std::hash<void const*>{}(source.head()),
+                           std::hash<size_type>{}(source.offset()));
+  hash      = combine_hash(hash, std::hash<bitmask_type const*>{}(source.null_mask()));
+  return std::accumulate(source.child_begin(), source.child_end(), hash, [](auto seed, auto& c) {
+    return combine_hash(seed, view_hash(c));
+  });
+}
+
+std::size_t view_hash(table_view const& source)
+{
+  return std::accumulate(source.begin(), source.end(), std::size_t{0}, [](auto seed, auto& c) {
+    return combine_hash(seed, view_hash(c));
+  });
+}
+
+/**
+ * @brief The process-wide registry of the cached device views, indexed by the hashes of the
+ * tables and of the columns with children whose views they hold.
+ *
+ * The registry does not own the entries, which unregister themselves once no handle and no view
+ * returned from them refers to them.
+ */
+class device_view_cache {
+ public:
+  using entry_ptr = std::shared_ptr<cached_device_views const>;
+
+  static device_view_cache& instance()
+  {
+    static device_view_cache cache;
+    return cache;
+  }
+
+  /**
+   * @brief Returns the live entry holding the device view of a table equal to `source`, or null.
+   */
+  entry_ptr find(table_view const& source)
+  {
+    return find_if(_tables, source, [&](auto const& entry, auto) {
+      return is_same_view(entry.source, source);
+    });
+  }
+
+  /**
+   * @brief Returns the live entry holding the device view of a column equal to `source`, with
+   * the index of the column in its table, or null.
+   */
+  entry_ptr find(column_view const& source, size_type& index)
+  {
+    return find_if(_columns, source, [&](auto const& entry, auto column_index) {
+      index = column_index;
+      return is_same_view(entry.source.column(column_index), source);
+    });
+  }
+
+  /**
+   * @brief Creates an entry of the registry, with the views returned by `make_views`.
+   */
+  template <typename MakeViews>
+  entry_ptr make_entry(table_view const& source, rmm::cuda_stream_view stream, MakeViews make_views)
+  {
+    auto entry = std::shared_ptr<cached_device_views>{new cached_device_views(source, stream),
+                                                      [](cached_device_views* entry) {
+                                                        instance().remove(*entry);
+                                                        delete entry;
+                                                      }};
+    make_views(*entry);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _tables.emplace(view_hash(source), registered_entry{entry.get(), entry, 0});
+    for (auto const& column : entry->columns) {
+      _columns.emplace(view_hash(source.column(column.first)),
+                       registered_entry{entry.get(), entry, column.first});
+    }
+    ++_num_entries;
+    return entry;
+  }
+
+ private:
+  struct registered_entry {
+    cached_device_views const* raw;
+    std::weak_ptr<cached_device_views const> weak;
+    size_type column_index;  // The index of the column in the table of the entry
+  };
+  using index_type = std::unordered_multimap<std::size_t, registered_entry>;
+
+  template <typename View, typename Predicate>
+  entry_ptr find_if(index_type const& index, View const& source, Predicate predicate)
+  {
+    // Creating the views of uncached tables neither hashes them nor waits for the lock
+    if (_num_entries.load(std::memory_order_relaxed) == 0) { return nullptr; }
+    auto const hash = view_hash(source);
+    // Declared before the lock so that the entries whose last reference is one of these unregister
+    // themselves after it is released
+    std::vector<entry_ptr> candidates;
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto const [first, last] = index.equal_range(hash);
+    for (auto it = first; it != last; ++it) {
+      auto entry = it->second.weak.lock();
+      if (entry == nullptr) { continue; }
+      candidates.push_back(entry);
+      if (predicate(*entry, it->second.column_index)) { return entry; }
+    }
+    return nullptr;
+  }
+
+  void remove(cached_device_views const& entry)
+  {
+    auto const erase = [&](index_type& index, std::size_t hash) {
+      auto const [first, last] = index.equal_range(hash);
+      for (auto it = first; it != last; ++it) {
+        if (it->second.raw == &entry) {
+          index.erase(it);
+          return true;
+        }
+      }
+      return false;
+    };
+    std::lock_guard<std::mutex> lock(_mutex);
+    // An entry whose views failed to be created was never registered
+    if (not erase(_tables, view_hash(entry.source))) { return; }
+    for (auto const& column : entry.columns) {
+      erase(_columns, view_hash(entry.source.column(column.first)));
+    }
+    --_num_entries;
+  }
+
+  std::mutex _mutex;
+  index_type _tables;
+  index_type _columns;
+  std::atomic<std::size_t> _num_entries{0};
+};
+}  // namespace
+
+std::shared_ptr<cached_device_views const> cache_device_views(table_view const& source,
+                                                               rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(not is_capturing(stream), "Device views cannot be cached during stream capture");
+  auto& cache = device_view_cache::instance();
+  if (auto entry = cache.find(source)) { return entry; }
+
+  return cache.make_entry(source, stream, [&](cached_device_views& entry) {
+    entry.table = table_device_view::create(source, stream);
+    for (size_type col = 0; col < source.num_columns(); ++col) {
+      if (source.column(col).num_children() > 0) {
+        entry.columns.emplace_back(col, column_device_view::create(source.column(col), stream));
+      }
+    }
+    // The views may be used on any stream
+    stream.synchronize();
+  });
+}
+
+cached_device_view<table_device_view> find_cached_device_view(table_view const& source,
+                                                               rmm::cuda_stream_view stream)
+{
+  // A graph may be launched after the cached views are freed
+  if (is_capturing(stream)) { return {}; }
+  auto entry = device_view_cache::instance().find(source);
+  if (entry == nullptr) { return {}; }
+  entry->add_stream(stream);
+  return {entry->table.get(), std::move(entry)};
+}
+
+cached_device_view<column_device_view> find_cached_device_view(column_view const& source,
+                                                                rmm::cuda_stream_view stream)
+{
+  if (is_capturing(stream)) { return {}; }
+  size_type index = 0;
+  auto entry      = device_view_cache::instance().find(source, index);
+  if (entry == nullptr) { return {}; }
+  entry->add_stream(stream);
+  auto const column = std::find_if(entry->columns.begin(),
+                                   entry->columns.end(),
+                                   [index](auto const& cached) { return cached.first == index; });
+  return {column->second.get(), std::move(entry)};
+}
+
 namespace {
 struct is_relationally_comparable_functor {
   template <typename T>
@@ -95,4 +396,15 @@ template bool is_relationally_comparable<mutable_table_device_view>(
   mutable_table_device_view const& lhs, mutable_table_device_view const& rhs);
 
 }  // namespace detail
+
+cached_table_device_view::cached_table_device_view(table_view const& source,
+                                                   rmm::cuda_stream_view stream)
+  : _views{detail::cache_device_views(source, stream)}
+{
+}
+
+table_view const& cached_table_device_view::source() const { return _views->source; }
+
+table_device_view const& cached_table_device_view::view() const { return *_views->table; }
+
 }  // namespace cudf
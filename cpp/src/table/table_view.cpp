@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,10 +15,13 @@
  */
 
 #include <cudf/column/column_view.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
 #include <algorithm>
 #include <cassert>
 #include <vector>
@@ -85,6 +88,13 @@ mutable_table_view::mutable_table_view(std::vector<mutable_table_view> const& vi
 {
 }
 
+bool has_nulls(table_view const& view)
+{
+  std::vector<column_view> const columns(view.begin(), view.end());
+  auto const null_counts = detail::batch_null_count(columns, rmm::cuda_stream_default);
+  return std::any_of(null_counts.begin(), null_counts.end(), [](auto count) { return count > 0; });
+}
+
 table_view scatter_columns(table_view const& source,
                            std::vector<size_type> const& map,
                            table_view const& target)
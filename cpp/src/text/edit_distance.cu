@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -31,62 +31,154 @@
 #include <thrust/transform.h>
 #include <thrust/transform_scan.h>
 
+#include <algorithm>
+#include <limits>
+
 namespace nvtext {
 namespace detail {
 namespace {
 
+/**
+ * @brief Distance limit used when the distances are not limited.
+ */
+constexpr int32_t no_limit = std::numeric_limits<int32_t>::max();
+
+/**
+ * @brief Characters of the shorter string processed together by the bit-parallel algorithm.
+ */
+constexpr cudf::size_type block_size = 64;
+
+/**
+ * @brief Returns the number of 64-bit words for the temporary buffer of the edit distance of
+ * two strings given the number of characters of the shorter string.
+ *
+ * No buffer is needed if the shorter string fits one block: its characters and the vertical
+ * deltas are then kept in registers. Otherwise the buffer holds 2 words of vertical deltas for
+ * each block and the characters of the shorter string.
+ */
+__device__ int32_t compute_buffer_size(cudf::size_type length)
+{
+  if (length <= block_size) return 0;
+  auto const blocks = (length + block_size - 1) / block_size;
+  return 2 * blocks + (length + 1) / 2;
+}
+
+/**
+ * @brief Advances one block of the bit-parallel algorithm by one character of the longer
+ * string.
+ *
+ * The bits of `pv` and `mv` are the vertical deltas of the block: +1 and -1 respectively.
+ * The horizontal delta into the block is `hin` and the one out of it is returned.
+ * This is the `advance_block` of Myers, "A fast bit-vector algorithm for approximate
+ * string matching based on dynamic programming", 1999.
+ */
+__device__ int32_t advance_block(
+  uint64_t eq, uint64_t high, int32_t hin, uint64_t& pv, uint64_t& mv)
+{
+  auto const xv = eq | mv;
+  if (hin < 0) eq |= 1;
+  auto const xh   = (((eq & pv) + pv) ^ pv) | eq;
+  auto ph         = mv | ~(xh | pv);
+  auto mh         = pv & xh;
+  auto const hout = (ph & high) ? 1 : ((mh & high) ? -1 : 0);
+  ph <<= 1;
+  mh <<= 1;
+  if (hin < 0) {
+    mh |= 1;
+  } else if (hin > 0) {
+    ph |= 1;
+  }
+  pv = mh | ~(xv | ph);
+  mv = ph & xv;
+  return hout;
+}
+
+/**
+ * @brief Returns the bits of the characters of `chars` equal to `chr`.
+ */
+__device__ uint64_t match_bits(cudf::char_utf8 const* chars,
+                               cudf::size_type count,
+                               cudf::char_utf8 chr)
+{
+  uint64_t eq = 0;
+  for (cudf::size_type i = 0; i < count; ++i)
+    eq |= static_cast<uint64_t>(chars[i] == chr) << i;
+  return eq;
+}
+
 /**
  * @brief Compute the edit-distance between two strings
  *
- * The temporary buffer must be able to hold 3 int16 values for each character
- * in the smaller of the two provided strings.
+ * The characters of the shorter string are the rows of the Levenshtein matrix, processed
+ * as the bits of 64-bit words, and the characters of the longer string are its columns.
+ * The distance to the last row is tracked along the columns, so the calculation stops once
+ * the columns left cannot bring it under `limit`.
+ *
+ * The temporary buffer must hold `compute_buffer_size()` words for the shorter string.
  *
  * @param d_str First string
  * @param d_tgt Second string
+ * @param limit Distances greater than or equal to this are returned as `limit`
  * @param buffer Temporary memory buffer used for the calculation.
  * @return Edit distance value
  */
 __device__ int32_t compute_distance(cudf::string_view const& d_str,
                                     cudf::string_view const& d_tgt,
-                                    int16_t* buffer)
+                                    int32_t limit,
+                                    uint64_t* buffer)
 {
   auto const str_length = d_str.length();
   auto const tgt_length = d_tgt.length();
-  if (str_length == 0) return tgt_length;
-  if (tgt_length == 0) return str_length;
-
-  auto itr_A = str_length < tgt_length ? d_str.begin() : d_tgt.begin();
-  auto itr_B = str_length < tgt_length ? d_tgt.begin() : d_str.begin();
+  auto const& d_rows    = str_length < tgt_length ? d_str : d_tgt;
+  auto const& d_columns = str_length < tgt_length ? d_tgt : d_str;
   // .first is min and .second is max
   auto const lengths = std::minmax(str_length, tgt_length);
-  // setup compute buffer pointers
-  auto line2 = buffer;
-  auto line1 = line2 + lengths.first;
-  auto line0 = line1 + lengths.first;
-  // range is both lengths
-  auto const range = lengths.first + lengths.second - 1;
-  for (cudf::size_type i = 0; i < range; ++i) {
-    auto tmp = line2;
-    line2    = line1;
-    line1    = line0;
-    line0    = tmp;
-    // checking pairs of characters
-    for (int x = (i < lengths.second ? 0 : i - lengths.second + 1);
-         (x < lengths.first) && (x < i + 1);
-         ++x) {
-      int const y = i - x;
-      itr_A += (x - itr_A.position());  // point to next
-      itr_B += (y - itr_B.position());  // characters to check
-      int16_t const w =
-        (((x > 0) && (y > 0)) ? line2[x - 1] : static_cast<int16_t>(std::max(x, y))) +
-        static_cast<int16_t>(*itr_A != *itr_B);  // add 1 if characters do not match
-      int16_t const u = (y > 0 ? line1[x] : x + 1) + 1;
-      int16_t const v = (x > 0 ? line1[x - 1] : y + 1) + 1;
-      // store min(u,v,w)
-      line0[x] = std::min(std::min(u, v), w);
+  if (lengths.first == 0) return std::min(lengths.second, limit);
+  if (lengths.second - lengths.first >= limit) return limit;
+
+  auto const last_high = uint64_t{1} << ((lengths.first - 1) % block_size);
+  int32_t distance     = lengths.first;
+  int32_t remaining    = lengths.second;
+
+  if (lengths.first <= block_size) {
+    cudf::char_utf8 chars[block_size];
+    cudf::size_type count = 0;
+    for (auto const chr : d_rows)
+      chars[count++] = chr;
+    uint64_t pv = ~uint64_t{0};
+    uint64_t mv = 0;
+    for (auto const chr : d_columns) {
+      distance += advance_block(match_bits(chars, count, chr), last_high, 1, pv, mv);
+      if (distance - --remaining >= limit) return limit;
+    }
+    return std::min(distance, limit);
+  }
+
+  auto const blocks = (lengths.first + block_size - 1) / block_size;
+  auto const d_pv   = buffer;
+  auto const d_mv   = d_pv + blocks;
+  auto const chars  = reinterpret_cast<cudf::char_utf8*>(d_mv + blocks);
+
+  cudf::size_type count = 0;
+  for (auto const chr : d_rows)
+    chars[count++] = chr;
+  for (cudf::size_type b = 0; b < blocks; ++b) {
+    d_pv[b] = ~uint64_t{0};
+    d_mv[b] = 0;
+  }
+  for (auto const chr : d_columns) {
+    int32_t delta = 1;  // the first row grows by 1 with each column
+    for (cudf::size_type b = 0; b < blocks; ++b) {
+      auto const begin = b * block_size;
+      auto const size  = std::min(block_size, lengths.first - begin);
+      auto const high  = (b + 1 < blocks) ? (uint64_t{1} << (block_size - 1)) : last_high;
+      auto const eq    = match_bits(chars + begin, size, chr);
+      delta            = advance_block(eq, high, delta, d_pv[b], d_mv[b]);
     }
+    distance += delta;
+    if (distance - --remaining >= limit) return limit;
   }
-  return static_cast<int32_t>(line0[lengths.first - 1]);
+  return std::min(distance, limit);
 }
 
 /**
@@ -98,7 +190,8 @@ __device__ int32_t compute_distance(cudf::string_view const& d_str,
 struct edit_distance_levenshtein_algorithm {
   cudf::column_device_view d_strings;  // computing these
   cudf::column_device_view d_targets;  // against these;
-  int16_t* d_buffer;                   // compute buffer for each string
+  int32_t limit;                       // distances are limited to this
+  uint64_t* d_buffer;                  // compute buffer for each string
   int32_t* d_results;                  // input is buffer offset; output is edit distance
 
   __device__ void operator()(cudf::size_type idx)
@@ -110,13 +203,14 @@ struct edit_distance_levenshtein_algorithm {
       return d_targets.size() == 1 ? d_targets.element<cudf::string_view>(0)
                                    : d_targets.element<cudf::string_view>(idx);
     }();
-    d_results[idx] = compute_distance(d_str, d_tgt, d_buffer + d_results[idx]);
+    d_results[idx] = compute_distance(d_str, d_tgt, limit, d_buffer + d_results[idx]);
   }
 };
 
 struct edit_distance_matrix_levenshtein_algorithm {
   cudf::column_device_view d_strings;  // computing these against itself
-  int16_t* d_buffer;                   // compute buffer for each string
+  int32_t limit;                       // distances are limited to this
+  uint64_t* d_buffer;                  // compute buffer for each string
   int32_t const* d_offsets;            // locate sub-buffer for each string
   int32_t* d_results;                  // edit distance values
 
@@ -130,22 +224,26 @@ struct edit_distance_matrix_levenshtein_algorithm {
       d_strings.is_null(row) ? cudf::string_view{} : d_strings.element<cudf::string_view>(row);
     cudf::string_view d_str2 =
       d_strings.is_null(col) ? cudf::string_view{} : d_strings.element<cudf::string_view>(col);
+    if (row == col) {
+      d_results[idx] = 0;
+      return;
+    }
     auto work_buffer       = d_buffer + d_offsets[idx - ((row + 1) * (row + 2)) / 2];
-    int32_t const distance = (row == col) ? 0 : compute_distance(d_str1, d_str2, work_buffer);
+    int32_t const distance = compute_distance(d_str1, d_str2, limit, work_buffer);
     d_results[idx]         = distance;                // top half of matrix
     d_results[col * strings_count + row] = distance;  // bottom half of matrix
   }
 };
 
-}  // namespace
-
 /**
- * @copydoc nvtext::edit_distance
+ * @brief Compute the edit distance between individual strings in two strings columns,
+ * with the distances greater than or equal to `limit` returned as `limit`.
  */
-std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& strings,
-                                            cudf::strings_column_view const& targets,
-                                            rmm::cuda_stream_view stream,
-                                            rmm::mr::device_memory_resource* mr)
+std::unique_ptr<cudf::column> limited_edit_distance(cudf::strings_column_view const& strings,
+                                                    cudf::strings_column_view const& targets,
+                                                    int32_t limit,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
 {
   cudf::size_type strings_count = strings.size();
   if (strings_count == 0) return cudf::make_empty_column(cudf::data_type{cudf::type_id::INT32});
@@ -178,8 +276,7 @@ std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& str
                       auto d_tgt = d_targets.size() == 1
                                      ? d_targets.element<cudf::string_view>(0)
                                      : d_targets.element<cudf::string_view>(idx);
-                      // just need 3 int16's for each character of the shorter string
-                      return static_cast<int32_t>(std::min(d_str.length(), d_tgt.length()) * 3);
+                      return compute_buffer_size(std::min(d_str.length(), d_tgt.length()));
                     });
 
   // get the total size of the temporary compute buffer
@@ -188,7 +285,7 @@ std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& str
   // convert sizes to offsets in-place
   thrust::exclusive_scan(rmm::exec_policy(stream), d_results, d_results + strings_count, d_results);
   // create the temporary compute buffer
-  rmm::device_uvector<int16_t> compute_buffer(compute_size, stream);
+  rmm::device_uvector<uint64_t> compute_buffer(compute_size, stream);
   auto d_buffer = compute_buffer.data();
 
   // compute the edit distance into the output column in-place
@@ -198,16 +295,19 @@ std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& str
     rmm::exec_policy(stream),
     thrust::make_counting_iterator<cudf::size_type>(0),
     strings_count,
-    edit_distance_levenshtein_algorithm{d_strings, d_targets, d_buffer, d_results});
+    edit_distance_levenshtein_algorithm{d_strings, d_targets, limit, d_buffer, d_results});
   return results;
 }
 
 /**
- * @copydoc nvtext::edit_distance_matrix
+ * @brief Compute the edit distance between all the strings in the input column,
+ * with the distances greater than or equal to `limit` returned as `limit`.
  */
-std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view const& strings,
-                                                   rmm::cuda_stream_view stream,
-                                                   rmm::mr::device_memory_resource* mr)
+std::unique_ptr<cudf::column> limited_edit_distance_matrix(
+  cudf::strings_column_view const& strings,
+  int32_t limit,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
 {
   cudf::size_type strings_count = strings.size();
   if (strings_count == 0) return cudf::make_empty_column(cudf::data_type{cudf::type_id::INT32});
@@ -240,8 +340,8 @@ std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view con
       cudf::string_view const d_str2 =
         d_strings.is_null(col) ? cudf::string_view{} : d_strings.element<cudf::string_view>(col);
       if (d_str1.empty() || d_str2.empty()) return;
-      // the temp size needed is 3 int16s per character of the shorter string
-      d_offsets[idx - ((row + 1) * (row + 2)) / 2] = std::min(d_str1.length(), d_str2.length()) * 3;
+      d_offsets[idx - ((row + 1) * (row + 2)) / 2] =
+        compute_buffer_size(std::min(d_str1.length(), d_str2.length()));
     });
 
   // get the total size for the compute buffer
@@ -250,7 +350,7 @@ std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view con
   // convert sizes to offsets in-place
   thrust::exclusive_scan(rmm::exec_policy(stream), offsets.begin(), offsets.end(), offsets.begin());
   // create the compute buffer
-  rmm::device_uvector<int16_t> compute_buffer(compute_size, stream);
+  rmm::device_uvector<uint64_t> compute_buffer(compute_size, stream);
   auto d_buffer = compute_buffer.data();
 
   // compute the edit distance into the output column
@@ -265,7 +365,7 @@ std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view con
     rmm::exec_policy(stream),
     thrust::make_counting_iterator<cudf::size_type>(0),
     strings_count * strings_count,
-    edit_distance_matrix_levenshtein_algorithm{d_strings, d_buffer, d_offsets, d_results});
+    edit_distance_matrix_levenshtein_algorithm{d_strings, limit, d_buffer, d_offsets, d_results});
 
   // build a lists column of the results
   auto offsets_column = cudf::make_fixed_width_column(cudf::data_type{cudf::type_id::INT32},
@@ -291,6 +391,58 @@ std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view con
                                  mr);
 }
 
+}  // namespace
+
+/**
+ * @copydoc nvtext::edit_distance
+ */
+std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& strings,
+                                            cudf::strings_column_view const& targets,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  return limited_edit_distance(strings, targets, no_limit, stream, mr);
+}
+
+/**
+ * @copydoc nvtext::edit_distance(cudf::strings_column_view const&,cudf::strings_column_view
+ * const&,cudf::size_type,rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& strings,
+                                            cudf::strings_column_view const& targets,
+                                            cudf::size_type max_distance,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(max_distance >= 0, "Parameter max_distance must not be negative");
+  auto const limit = max_distance < no_limit ? max_distance + 1 : no_limit;
+  return limited_edit_distance(strings, targets, limit, stream, mr);
+}
+
+/**
+ * @copydoc nvtext::edit_distance_matrix
+ */
+std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view const& strings,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  return limited_edit_distance_matrix(strings, no_limit, stream, mr);
+}
+
+/**
+ * @copydoc nvtext::edit_distance_matrix(cudf::strings_column_view const&,cudf::size_type,
+ * rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view const& strings,
+                                                   cudf::size_type max_distance,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(max_distance >= 0, "Parameter max_distance must not be negative");
+  auto const limit = max_distance < no_limit ? max_distance + 1 : no_limit;
+  return limited_edit_distance_matrix(strings, limit, stream, mr);
+}
+
 }  // namespace detail
 
 // external APIs
@@ -316,4 +468,21 @@ std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view con
   return detail::edit_distance_matrix(strings, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& strings,
+                                            cudf::strings_column_view const& targets,
+                                            cudf::size_type max_distance,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::edit_distance(strings, targets, max_distance, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view const& strings,
+                                                   cudf::size_type max_distance,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::edit_distance_matrix(strings, max_distance, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace nvtext
@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nvtext/minhash.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/logical.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace nvtext {
+namespace detail {
+namespace {
+
+/**
+ * @brief Computes one hash of the signature of one string: the minimum of the hashes of its
+ * shingles with one seed.
+ *
+ * The shingles are the windows of `width` characters sliding over the bytes of the string.
+ */
+struct minhash_fn {
+  cudf::column_device_view const d_strings;
+  uint32_t const* d_seeds;
+  cudf::size_type const num_seeds;
+  cudf::size_type const width;
+  cudf::size_type const* d_offsets;
+  uint32_t* d_hashes;
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    auto const row = idx / num_seeds;
+    if (d_strings.is_null(row)) { return; }
+    auto const seed_idx = idx % num_seeds;
+
+    auto const d_str     = d_strings.element<cudf::string_view>(row);
+    auto const str_end   = d_str.data() + d_str.size_bytes();
+    auto const next_char = [str_end](char const* ptr) {
+      do {
+        ++ptr;
+      } while (ptr < str_end && !cudf::strings::detail::is_begin_utf8_char(*ptr));
+      return ptr;
+    };
+
+    cudf::detail::MurmurHash3_32<cudf::string_view> const hasher(d_seeds[seed_idx]);
+    auto begin = d_str.data();
+    auto end   = begin;
+    for (cudf::size_type chars = 0; chars < width && end < str_end; ++chars)
+      end = next_char(end);
+    auto hash = hasher(cudf::string_view(begin, static_cast<cudf::size_type>(end - begin)));
+    while (end < str_end) {
+      begin = next_char(begin);
+      end   = next_char(end);
+      hash  = thrust::min(
+        hash, hasher(cudf::string_view(begin, static_cast<cudf::size_type>(end - begin))));
+    }
+    d_hashes[d_offsets[row] + seed_idx] = hash;
+  }
+};
+
+/**
+ * @brief Returns the key of each band of each signature.
+ *
+ * The band index is in the upper 32 bits of the key, so that only the same bands of two
+ * signatures can have the same key.
+ */
+struct band_key_fn {
+  cudf::size_type const* d_offsets;
+  uint32_t const* d_hashes;
+  cudf::size_type const bands;
+  cudf::size_type const band_size;
+
+  __device__ uint64_t operator()(cudf::size_type idx) const
+  {
+    auto const row  = idx / bands;
+    auto const band = idx % bands;
+    cudf::detail::MurmurHash3_32<uint32_t> const hasher{};
+    auto const band_hashes = d_hashes + d_offsets[row] + band * band_size;
+    uint32_t hash          = 0;
+    for (cudf::size_type i = 0; i < band_size; ++i)
+      hash = hasher.hash_combine(hash, hasher(band_hashes[i]));
+    return (static_cast<uint64_t>(band) << 32) | hash;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& strings,
+                                      cudf::column_view const& seeds,
+                                      cudf::size_type width,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(width >= 2, "Parameter width should be an integer value of 2 or greater");
+  CUDF_EXPECTS(!seeds.is_empty(), "Parameter seeds cannot be empty");
+  CUDF_EXPECTS(seeds.type().id() == cudf::type_id::UINT32, "Parameter seeds must be UINT32");
+  CUDF_EXPECTS(!seeds.has_nulls(), "Parameter seeds must not contain nulls");
+
+  auto const strings_count = strings.size();
+  auto const num_seeds     = seeds.size();
+  CUDF_EXPECTS(static_cast<int64_t>(strings_count) * num_seeds <=
+                 std::numeric_limits<cudf::size_type>::max(),
+               "Size of output exceeds column size limit");
+
+  // the null rows have no hashes
+  auto offsets = cudf::make_numeric_column(cudf::data_type{cudf::type_to_id<cudf::offset_type>()},
+                                           strings_count + 1,
+                                           cudf::mask_state::UNALLOCATED,
+                                           stream,
+                                           mr);
+  auto d_offsets = offsets->mutable_view().data<cudf::offset_type>();
+  auto d_strings = cudf::column_device_view::create(strings.parent(), stream);
+  auto sizes     = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    [d_strings = *d_strings, num_seeds, strings_count] __device__(cudf::size_type idx) {
+      return idx < strings_count && d_strings.is_valid(idx) ? num_seeds : 0;
+    });
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), sizes, sizes + strings_count + 1, d_offsets, cudf::size_type{0});
+
+  auto const num_hashes = (strings_count - strings.null_count()) * num_seeds;
+  auto hashes           = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                          num_hashes,
+                                          cudf::mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count * num_seeds,
+                     minhash_fn{*d_strings,
+                                seeds.data<uint32_t>(),
+                                num_seeds,
+                                width,
+                                d_offsets,
+                                hashes->mutable_view().data<uint32_t>()});
+
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets),
+                                 std::move(hashes),
+                                 strings.null_count(),
+                                 cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
+std::unique_ptr<cudf::table> minhash_candidates(cudf::lists_column_view const& signatures,
+                                                cudf::size_type bands,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(bands >= 1, "Parameter bands should be an integer value of 1 or greater");
+  CUDF_EXPECTS(signatures.child().type().id() == cudf::type_id::UINT32,
+               "Signatures must be lists of UINT32");
+
+  auto const num_rows  = signatures.size();
+  auto const d_lists   = cudf::column_device_view::create(signatures.parent(), stream);
+  auto const d_offsets = signatures.offsets_begin();
+  auto const row_size  = [d_lists = *d_lists, d_offsets] __device__(cudf::size_type row) {
+    return d_lists.is_valid(row) ? d_offsets[row + 1] - d_offsets[row] : 0;
+  };
+  auto const rows_begin = thrust::make_counting_iterator<cudf::size_type>(0);
+  auto const rows_end   = rows_begin + num_rows;
+  auto const num_hashes = thrust::transform_reduce(rmm::exec_policy(stream),
+                                                   rows_begin,
+                                                   rows_end,
+                                                   row_size,
+                                                   cudf::size_type{0},
+                                                   thrust::maximum<cudf::size_type>{});
+  CUDF_EXPECTS(thrust::all_of(rmm::exec_policy(stream),
+                              rows_begin,
+                              rows_end,
+                              [d_lists = *d_lists, row_size, num_hashes] __device__(
+                                cudf::size_type row) {
+                                return d_lists.is_null(row) || row_size(row) == num_hashes;
+                              }),
+               "Signatures must all have the same number of hashes");
+  CUDF_EXPECTS(num_hashes % bands == 0, "Number of hashes must be a multiple of bands");
+
+  // the key of each band of the non-null signatures along with its row, grouped by key
+  auto const num_valid = num_rows - signatures.null_count();
+  auto const num_keys  = num_hashes > 0 ? num_valid * bands : 0;
+  rmm::device_uvector<cudf::size_type> band_ids(num_keys, stream);
+  thrust::copy_if(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator<cudf::size_type>(0),
+                  thrust::make_counting_iterator<cudf::size_type>(num_rows * bands),
+                  band_ids.begin(),
+                  [d_lists = *d_lists, bands] __device__(cudf::size_type idx) {
+                    return d_lists.is_valid(idx / bands);
+                  });
+  rmm::device_uvector<uint64_t> keys(num_keys, stream);
+  auto const d_hashes = signatures.child().data<uint32_t>();
+  thrust::transform(rmm::exec_policy(stream),
+                    band_ids.begin(),
+                    band_ids.end(),
+                    keys.begin(),
+                    band_key_fn{d_offsets, d_hashes, bands, num_hashes / bands});
+  rmm::device_uvector<cudf::size_type> rows(num_keys, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    band_ids.begin(),
+                    band_ids.end(),
+                    rows.begin(),
+                    [bands] __device__(cudf::size_type idx) { return idx / bands; });
+  // stable so that the rows of each bucket remain in increasing order
+  thrust::stable_sort_by_key(rmm::exec_policy(stream), keys.begin(), keys.end(), rows.begin());
+
+  // each band pairs with the bands of its bucket before it
+  rmm::device_uvector<cudf::size_type> bucket_starts(num_keys, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(num_keys),
+                    bucket_starts.begin(),
+                    [d_keys = keys.data()] __device__(cudf::size_type idx) {
+                      return (idx == 0 || d_keys[idx] != d_keys[idx - 1]) ? idx : 0;
+                    });
+  thrust::inclusive_scan(rmm::exec_policy(stream),
+                         bucket_starts.begin(),
+                         bucket_starts.end(),
+                         bucket_starts.begin(),
+                         thrust::maximum<cudf::size_type>{});
+  rmm::device_uvector<int64_t> pair_offsets(num_keys + 1, stream);
+  auto const pair_counts = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    [d_starts = bucket_starts.data(), num_keys] __device__(cudf::size_type idx) {
+      return idx < num_keys ? static_cast<int64_t>(idx - d_starts[idx]) : int64_t{0};
+    });
+  thrust::exclusive_scan(rmm::exec_policy(stream),
+                         pair_counts,
+                         pair_counts + num_keys + 1,
+                         pair_offsets.begin(),
+                         int64_t{0});
+  auto const total_pairs = pair_offsets.element(num_keys, stream);
+  CUDF_EXPECTS(total_pairs <= std::numeric_limits<cudf::size_type>::max(),
+               "Size of output exceeds column size limit");
+
+  rmm::device_uvector<cudf::size_type> lefts(total_pairs, stream);
+  rmm::device_uvector<cudf::size_type> rights(total_pairs, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     num_keys,
+                     [d_starts       = bucket_starts.data(),
+                      d_rows         = rows.data(),
+                      d_pair_offsets = pair_offsets.data(),
+                      d_lefts        = lefts.data(),
+                      d_rights       = rights.data()] __device__(cudf::size_type idx) {
+                       auto out = d_pair_offsets[idx];
+                       for (auto left = d_starts[idx]; left < idx; ++left, ++out) {
+                         d_lefts[out]  = d_rows[left];
+                         d_rights[out] = d_rows[idx];
+                       }
+                     });
+
+  // a pair sharing several bands is a candidate once
+  auto pairs_begin = thrust::make_zip_iterator(thrust::make_tuple(lefts.begin(), rights.begin()));
+  thrust::sort(rmm::exec_policy(stream), pairs_begin, pairs_begin + total_pairs);
+  auto const num_pairs = static_cast<cudf::size_type>(thrust::distance(
+    pairs_begin, thrust::unique(rmm::exec_policy(stream), pairs_begin, pairs_begin + total_pairs)));
+
+  std::vector<std::unique_ptr<cudf::column>> results;
+  for (auto const& pairs : {std::cref(lefts), std::cref(rights)}) {
+    auto result = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                            num_pairs,
+                                            cudf::mask_state::UNALLOCATED,
+                                            stream,
+                                            mr);
+    thrust::copy_n(rmm::exec_policy(stream),
+                   pairs.get().begin(),
+                   num_pairs,
+                   result->mutable_view().data<cudf::size_type>());
+    results.emplace_back(std::move(result));
+  }
+  return std::make_unique<cudf::table>(std::move(results));
+}
+
+}  // namespace detail
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& strings,
+                                      cudf::column_view const& seeds,
+                                      cudf::size_type width,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash(strings, seeds, width, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<cudf::table> minhash_candidates(cudf::lists_column_view const& signatures,
+                                                cudf::size_type bands,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash_candidates(signatures, bands, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace nvtext
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <text/subword/detail/codepoint_normalizer.cuh>
+#include <text/subword/detail/tokenizer_utils.cuh>
 #include <text/utilities/tokenize_ops.cuh>
 
 #include <nvtext/detail/tokenize.hpp>
@@ -126,6 +128,154 @@ struct ngram_builder_fn {
   }
 };
 
+/**
+ * @brief Calls `fn` with the byte positions and the normalized size in bytes of each token of
+ * the normalized characters of a string.
+ *
+ * The tokens are separated by the whitespace of the normalized characters. The positions of a
+ * token are those of the input characters it is normalized from. Only the leading or trailing
+ * code points of a character may be spaces, so normalizing these characters again and dropping
+ * the spaces produces the token.
+ */
+template <typename TokenFn>
+__device__ void for_each_normalized_token(codepoint_normalizer const& normalizer,
+                                          cudf::string_view const& d_str,
+                                          TokenFn fn)
+{
+  auto const bytes = reinterpret_cast<unsigned char const*>(d_str.data());
+  auto const size  = static_cast<cudf::size_type>(d_str.size_bytes());
+
+  cudf::size_type token_start = -1;  // no token in progress
+  cudf::size_type token_end   = 0;
+  cudf::size_type token_size  = 0;
+  for (cudf::size_type pos = 0; pos < size; ++pos) {
+    if (!is_head_byte(bytes[pos])) continue;
+    auto char_end = pos + 1;
+    while (char_end < size && !is_head_byte(bytes[char_end]))
+      ++char_end;
+
+    uint32_t cps[MAX_NEW_CHARS];
+    auto const count = normalizer(extract_code_points_from_utf8(bytes, size, pos), cps);
+    for (uint32_t i = 0; i < count; ++i) {
+      if (cps[i] > SPACE_CODE_POINT) {
+        if (token_start < 0) token_start = pos;
+        token_end = char_end;
+        token_size += codepoint_utf8_size(cps[i]);
+      } else if (token_start >= 0) {
+        fn(position_pair{token_start, token_end}, token_size);
+        token_start = -1;
+        token_size  = 0;
+      }
+    }
+  }
+  if (token_start >= 0) fn(position_pair{token_start, token_end}, token_size);
+}
+
+/**
+ * @brief Writes the normalized characters of a token, without the spaces they may be padded
+ * with.
+ *
+ * @return The position after the bytes written
+ */
+__device__ char* write_normalized_token(codepoint_normalizer const& normalizer,
+                                        cudf::string_view const& d_str,
+                                        position_pair token,
+                                        char* out_ptr)
+{
+  auto const bytes = reinterpret_cast<unsigned char const*>(d_str.data());
+  auto const size  = static_cast<cudf::size_type>(d_str.size_bytes());
+  for (auto pos = token.first; pos < token.second; ++pos) {
+    if (!is_head_byte(bytes[pos])) continue;
+    uint32_t cps[MAX_NEW_CHARS];
+    auto const count = normalizer(extract_code_points_from_utf8(bytes, size, pos), cps);
+    for (uint32_t i = 0; i < count; ++i)
+      if (cps[i] > SPACE_CODE_POINT) out_ptr = write_codepoint_utf8(cps[i], out_ptr);
+  }
+  return out_ptr;
+}
+
+/**
+ * @brief Records the byte positions and the normalized size of each token of each string.
+ */
+struct normalized_tokens_positions_fn {
+  cudf::column_device_view const d_strings;  // strings to tokenize
+  codepoint_normalizer const normalizer;     // normalizes the characters of the strings
+  int32_t const* d_token_offsets{};          // offsets into the token vectors for each string
+  position_pair* d_token_positions{};        // token positions in each string
+  int32_t* d_token_sizes{};                  // normalized size of each token
+
+  /**
+   * @brief Returns the number of tokens of the string, or records its tokens once the offsets
+   * are set.
+   */
+  __device__ cudf::size_type operator()(cudf::size_type idx)
+  {
+    if (d_strings.is_null(idx)) return 0;
+    cudf::size_type token_index = 0;
+    auto const offset           = d_token_offsets ? d_token_offsets[idx] : 0;
+    for_each_normalized_token(normalizer,
+                              d_strings.element<cudf::string_view>(idx),
+                              [&](position_pair token, cudf::size_type token_size) {
+                                if (d_token_positions) {
+                                  d_token_positions[offset + token_index] = token;
+                                  d_token_sizes[offset + token_index]     = token_size;
+                                }
+                                ++token_index;
+                              });
+    return token_index;
+  }
+};
+
+/**
+ * @brief Generate the ngrams of the normalized tokens for each string.
+ *
+ * This is the same as the ngram_builder_fn except the size of each token is its normalized size
+ * and the tokens are normalized as they are written.
+ */
+struct normalized_ngram_builder_fn {
+  cudf::column_device_view const d_strings;  // strings to generate ngrams from
+  codepoint_normalizer const normalizer;     // normalizes the characters of the strings
+  cudf::string_view const d_separator;       // separator to place between them 'grams
+  cudf::size_type ngrams;                    // ngram number to generate (2=bi-gram, 3=tri-gram)
+  int32_t const* d_token_offsets;            // offsets for token position for each string
+  position_pair const* d_token_positions;    // token positions for each string
+  int32_t const* d_token_sizes;              // normalized size of each token
+  int32_t const* d_chars_offsets{};          // offsets for each string's ngrams
+  char* d_chars{};                           // write ngram strings to here
+  int32_t const* d_ngram_offsets{};          // offsets for sizes of each string's ngrams
+  int32_t* d_ngram_sizes{};                  // write ngram sizes to here
+
+  __device__ cudf::size_type operator()(cudf::size_type idx)
+  {
+    if (d_strings.is_null(idx)) return 0;
+    cudf::string_view d_str     = d_strings.element<cudf::string_view>(idx);
+    auto token_positions        = d_token_positions + d_token_offsets[idx];
+    auto token_sizes            = d_token_sizes + d_token_offsets[idx];
+    auto token_count            = d_token_offsets[idx + 1] - d_token_offsets[idx];
+    cudf::size_type nbytes      = 0;  // total number of output bytes needed for this string
+    cudf::size_type ngram_index = 0;
+    char* out_ptr               = d_chars ? d_chars + d_chars_offsets[idx] : nullptr;
+    int32_t* d_sizes            = d_ngram_sizes ? d_ngram_sizes + d_ngram_offsets[idx] : nullptr;
+    for (cudf::size_type token_index = (ngrams - 1); token_index < token_count; ++token_index) {
+      cudf::size_type length = 0;                          // calculate size of each ngram in bytes
+      for (cudf::size_type n = (ngrams - 1); n >= 0; --n)  // sliding window of tokens
+      {
+        length += token_sizes[token_index - n];
+        if (out_ptr)
+          out_ptr =
+            write_normalized_token(normalizer, d_str, token_positions[token_index - n], out_ptr);
+        if (n > 0) {  // include the separator (except for the last one)
+          if (out_ptr) out_ptr = cudf::strings::detail::copy_string(out_ptr, d_separator);
+          length += d_separator.size_bytes();
+        }
+      }
+      if (d_sizes) d_sizes[ngram_index++] = length;
+      nbytes += length;
+    }
+    return nbytes;
+  }
+};
+
 }  // namespace
 
 // detail APIs
@@ -247,6 +397,104 @@ std::unique_ptr<cudf::column> ngrams_tokenize(
     total_ngrams, std::move(offsets_column), std::move(chars_column), 0, rmm::device_buffer{});
 }
 
+std::unique_ptr<cudf::column> normalized_ngrams_tokenize(cudf::strings_column_view const& strings,
+                                                         cudf::size_type ngrams,
+                                                         bool do_lower_case,
+                                                         cudf::string_scalar const& separator,
+                                                         rmm::cuda_stream_view stream,
+                                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(separator.is_valid(stream), "Parameter separator must be valid");
+  cudf::string_view d_separator(separator.data(), separator.size());
+  CUDF_EXPECTS(ngrams >= 1, "Parameter ngrams should be an integer value of 1 or greater");
+  auto strings_count = strings.size();
+  if (strings.is_empty()) return cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
+
+  auto strings_column = cudf::column_device_view::create(strings.parent(), stream);
+  auto d_strings      = *strings_column;
+  codepoint_normalizer const normalizer{
+    get_codepoint_metadata(stream), get_aux_codepoint_data(stream), do_lower_case};
+
+  // first pass over the characters: count the normalized tokens of each string
+  // and record their positions and sizes
+  rmm::device_uvector<int32_t> token_offsets(strings_count + 1, stream);
+  auto d_token_offsets = token_offsets.data();
+  thrust::transform_inclusive_scan(rmm::exec_policy(stream),
+                                   thrust::make_counting_iterator<cudf::size_type>(0),
+                                   thrust::make_counting_iterator<cudf::size_type>(strings_count),
+                                   d_token_offsets + 1,
+                                   normalized_tokens_positions_fn{d_strings, normalizer},
+                                   thrust::plus<int32_t>());
+  token_offsets.set_element_to_zero_async(0, stream);
+  auto const total_tokens = token_offsets.back_element(stream);
+
+  rmm::device_uvector<position_pair> token_positions(total_tokens, stream);
+  rmm::device_uvector<int32_t> token_sizes(total_tokens, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count,
+                     normalized_tokens_positions_fn{d_strings,
+                                                    normalizer,
+                                                    d_token_offsets,
+                                                    token_positions.data(),
+                                                    token_sizes.data()});
+
+  // compute the number of ngrams per string to get the total number of ngrams to generate
+  rmm::device_uvector<int32_t> ngram_offsets(strings_count + 1, stream);
+  auto d_ngram_offsets = ngram_offsets.data();
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(strings_count),
+    d_ngram_offsets + 1,
+    [d_token_offsets, ngrams] __device__(cudf::size_type idx) {
+      auto token_count = d_token_offsets[idx + 1] - d_token_offsets[idx];
+      return (token_count >= ngrams) ? token_count - ngrams + 1 : 0;
+    },
+    thrust::plus<int32_t>());
+  ngram_offsets.set_element_to_zero_async(0, stream);
+  auto const total_ngrams = ngram_offsets.back_element(stream);
+
+  // the sizes of the ngrams come from the token sizes without normalizing again
+  rmm::device_uvector<int32_t> chars_offsets(strings_count + 1, stream);
+  auto d_chars_offsets = chars_offsets.data();
+  normalized_ngram_builder_fn builder{d_strings,
+                                      normalizer,
+                                      d_separator,
+                                      ngrams,
+                                      d_token_offsets,
+                                      token_positions.data(),
+                                      token_sizes.data()};
+  thrust::transform_inclusive_scan(rmm::exec_policy(stream),
+                                   thrust::make_counting_iterator<cudf::size_type>(0),
+                                   thrust::make_counting_iterator<cudf::size_type>(strings_count),
+                                   d_chars_offsets + 1,
+                                   builder,
+                                   thrust::plus<int32_t>());
+  chars_offsets.set_element_to_zero_async(0, stream);
+  auto const output_chars_size = chars_offsets.back_element(stream);
+
+  rmm::device_uvector<int32_t> ngram_sizes(total_ngrams, stream);
+
+  // second pass over the characters: normalize the tokens into the ngrams
+  auto chars_column =
+    cudf::strings::detail::create_chars_child_column(output_chars_size, stream, mr);
+  builder.d_chars_offsets = d_chars_offsets;
+  builder.d_chars         = chars_column->mutable_view().data<char>();
+  builder.d_ngram_offsets = d_ngram_offsets;
+  builder.d_ngram_sizes   = ngram_sizes.data();
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<int32_t>(0),
+                     strings_count,
+                     builder);
+  auto offsets_column = cudf::strings::detail::make_offsets_child_column(
+    ngram_sizes.begin(), ngram_sizes.end(), stream, mr);
+  chars_column->set_null_count(0);
+  offsets_column->set_null_count(0);
+  return make_strings_column(
+    total_ngrams, std::move(offsets_column), std::move(chars_column), 0, rmm::device_buffer{});
+}
+
 }  // namespace detail
 
 // external APIs
@@ -262,4 +510,15 @@ std::unique_ptr<cudf::column> ngrams_tokenize(cudf::strings_column_view const& s
     strings, ngrams, delimiter, separator, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<cudf::column> normalized_ngrams_tokenize(cudf::strings_column_view const& strings,
+                                                         cudf::size_type ngrams,
+                                                         bool do_lower_case,
+                                                         cudf::string_scalar const& separator,
+                                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::normalized_ngrams_tokenize(
+    strings, ngrams, do_lower_case, separator, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace nvtext
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <text/subword/detail/codepoint_normalizer.cuh>
 #include <text/subword/detail/data_normalizer.hpp>
 #include <text/utilities/tokenize_ops.cuh>
 
@@ -90,11 +91,6 @@ struct normalize_spaces_fn {
   }
 };
 
-// code-point to multi-byte range limits
-constexpr uint32_t UTF8_1BYTE = 0x0080;
-constexpr uint32_t UTF8_2BYTE = 0x0800;
-constexpr uint32_t UTF8_3BYTE = 0x010000;
-
 /**
  * @brief Convert code-point arrays into UTF-8 bytes for each string.
  */
@@ -118,7 +114,7 @@ struct codepoint_to_utf8_fn {
       thrust::seq,
       str_cps,
       str_cps + count,
-      [](auto cp) { return 1 + (cp >= UTF8_1BYTE) + (cp >= UTF8_2BYTE) + (cp >= UTF8_3BYTE); },
+      [](auto cp) { return codepoint_utf8_size(cp); },
       0,
       thrust::plus<int32_t>());
   }
@@ -138,29 +134,8 @@ struct codepoint_to_utf8_fn {
     }
     // convert each code-point to 1-4 UTF-8 encoded bytes
     char* out_ptr = d_chars + d_offsets[idx];
-    for (uint32_t jdx = 0; jdx < count; ++jdx) {
-      uint32_t code_point = *str_cps++;
-      if (code_point < UTF8_1BYTE)  // ASCII range
-        *out_ptr++ = static_cast<char>(code_point);
-      else if (code_point < UTF8_2BYTE) {  // create two-byte UTF-8
-        // b00001xxx:byyyyyyyy => b110xxxyy:b10yyyyyy
-        *out_ptr++ = static_cast<char>((((code_point << 2) & 0x001F00) | 0x00C000) >> 8);
-        *out_ptr++ = static_cast<char>((code_point & 0x3F) | 0x0080);
-      } else if (code_point < UTF8_3BYTE) {  // create three-byte UTF-8
-        // bxxxxxxxx:byyyyyyyy => b1110xxxx:b10xxxxyy:b10yyyyyy
-        *out_ptr++ = static_cast<char>((((code_point << 4) & 0x0F0000) | 0x00E00000) >> 16);
-        *out_ptr++ = static_cast<char>((((code_point << 2) & 0x003F00) | 0x008000) >> 8);
-        *out_ptr++ = static_cast<char>((code_point & 0x3F) | 0x0080);
-      } else {  // create four-byte UTF-8
-        // maximum code-point value is 0x00110000
-        // b000xxxxx:byyyyyyyy:bzzzzzzzz => b11110xxx:b10xxyyyy:b10yyyyzz:b10zzzzzz
-        *out_ptr++ =
-          static_cast<char>((((code_point << 6) & 0x07000000) | unsigned{0xF0000000}) >> 24);
-        *out_ptr++ = static_cast<char>((((code_point << 4) & 0x003F0000) | 0x00800000) >> 16);
-        *out_ptr++ = static_cast<char>((((code_point << 2) & 0x003F00) | 0x008000) >> 8);
-        *out_ptr++ = static_cast<char>((code_point & 0x3F) | 0x0080);
-      }
-    }
+    for (uint32_t jdx = 0; jdx < count; ++jdx)
+      out_ptr = write_codepoint_utf8(*str_cps++, out_ptr);
   }
 };
 
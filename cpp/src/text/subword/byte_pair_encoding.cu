@@ -0,0 +1,494 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nvtext/byte_pair_encoding.hpp>
+
+#include <hash/hash_allocator.cuh>
+#include <hash/helper_functions.cuh>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/polymorphic_allocator.hpp>
+
+#include <cuco/static_map.cuh>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/transform.h>
+#include <thrust/uninitialized_fill.h>
+
+#include <cuda/std/atomic>
+
+#include <functional>
+#include <limits>
+
+namespace nvtext {
+namespace detail {
+namespace {
+
+using hash_table_allocator_type = rmm::mr::stream_allocator_adaptor<default_allocator<char>>;
+
+/**
+ * @brief Hash map from the 64-bit hash of a merge pair or a token to its row.
+ */
+using bpe_map_type =
+  cuco::static_map<uint64_t, cudf::size_type, cuda::thread_scope_device, hash_table_allocator_type>;
+
+constexpr uint64_t unused_key{std::numeric_limits<uint64_t>::max()};
+constexpr cudf::size_type unused_value{-1};
+constexpr cudf::size_type no_merge{std::numeric_limits<cudf::size_type>::max()};
+
+/**
+ * @brief Returns the 64-bit FNV-1a hash of the size of `left`, and of the bytes of `left` and
+ * `right`, so that pairs with the same bytes but split differently hash apart.
+ *
+ * A token is hashed as a pair with an empty right token.
+ */
+__device__ uint64_t bpe_key(cudf::string_view const& left, cudf::string_view const& right)
+{
+  uint64_t hash  = 0xcbf29ce484222325UL;
+  auto const add = [&hash](uint8_t byte) {
+    hash ^= byte;
+    hash *= 0x100000001b3UL;
+  };
+  auto const left_size = static_cast<uint32_t>(left.size_bytes());
+  for (int shift = 0; shift < 32; shift += 8)
+    add(static_cast<uint8_t>(left_size >> shift));
+  for (auto ptr = left.data(); ptr < left.data() + left.size_bytes(); ++ptr)
+    add(static_cast<uint8_t>(*ptr));
+  for (auto ptr = right.data(); ptr < right.data() + right.size_bytes(); ++ptr)
+    add(static_cast<uint8_t>(*ptr));
+  return hash == unused_key ? hash - 1 : hash;
+}
+
+/**
+ * @brief Returns an empty map sized for `num_rows` rows.
+ */
+std::unique_ptr<bpe_map_type> make_map(cudf::size_type num_rows, rmm::cuda_stream_view stream)
+{
+  return std::make_unique<bpe_map_type>(
+    compute_hash_table_size(std::max(num_rows, 1)),
+    unused_key,
+    unused_value,
+    hash_table_allocator_type{default_allocator<char>{}, stream},
+    stream.value());
+}
+
+/**
+ * @brief Inserts the row of each merge pair in `map`.
+ *
+ * The row kept for a repeated pair is that of any of its occurrences.
+ */
+void insert_merges(bpe_map_type& map,
+                   cudf::column_device_view const& d_left,
+                   cudf::column_device_view const& d_right,
+                   rmm::cuda_stream_view stream)
+{
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    d_left.size(),
+    [d_map = map.get_device_mutable_view(), d_left, d_right] __device__(
+      cudf::size_type idx) mutable {
+      auto const key =
+        bpe_key(d_left.element<cudf::string_view>(idx), d_right.element<cudf::string_view>(idx));
+      d_map.insert(thrust::make_pair(key, idx));
+    });
+}
+
+/**
+ * @brief Inserts the row of each token in `map`.
+ */
+void insert_tokens(bpe_map_type& map,
+                   cudf::column_device_view const& d_tokens,
+                   rmm::cuda_stream_view stream)
+{
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    d_tokens.size(),
+    [d_map = map.get_device_mutable_view(), d_tokens] __device__(cudf::size_type idx) mutable {
+      auto const key = bpe_key(d_tokens.element<cudf::string_view>(idx), cudf::string_view{});
+      d_map.insert(thrust::make_pair(key, idx));
+    });
+}
+
+/**
+ * @brief Device functor finding the merge pairs and the tokens of the vocabulary.
+ */
+struct bpe_lookup_fn {
+  bpe_map_type::device_view merges_map;
+  cudf::column_device_view const d_merge_left;
+  cudf::column_device_view const d_merge_right;
+  bpe_map_type::device_view tokens_map;
+  cudf::column_device_view const d_tokens;
+  uint32_t const unknown_token_id;
+
+  /**
+   * @brief Returns the rank of the merge pair of `left` and `right`, `no_merge` if there is no
+   * such pair.
+   */
+  __device__ cudf::size_type rank(cudf::string_view const& left,
+                                  cudf::string_view const& right) const
+  {
+    auto const slot = merges_map.find(bpe_key(left, right));
+    if (slot == merges_map.end()) { return no_merge; }
+    auto const row = slot->second.load(cuda::std::memory_order_relaxed);
+    return (d_merge_left.element<cudf::string_view>(row) == left &&
+            d_merge_right.element<cudf::string_view>(row) == right)
+             ? row
+             : no_merge;
+  }
+
+  /**
+   * @brief Returns the id of `token`, `unknown_token_id` if it is not a token.
+   */
+  __device__ uint32_t token_id(cudf::string_view const& token) const
+  {
+    auto const slot = tokens_map.find(bpe_key(token, cudf::string_view{}));
+    if (slot == tokens_map.end()) { return unknown_token_id; }
+    auto const row = slot->second.load(cuda::std::memory_order_relaxed);
+    return d_tokens.element<cudf::string_view>(row) == token ? static_cast<uint32_t>(row)
+                                                             : unknown_token_id;
+  }
+};
+
+/**
+ * @brief Returns the row of the byte at `pos` given the offsets of the rows.
+ */
+__device__ cudf::size_type row_of(cudf::size_type const* d_offsets,
+                                  cudf::size_type num_rows,
+                                  cudf::size_type pos)
+{
+  auto const itr = thrust::upper_bound(thrust::seq, d_offsets, d_offsets + num_rows + 1, pos);
+  return static_cast<cudf::size_type>(thrust::distance(d_offsets, itr)) - 1;
+}
+
+/**
+ * @brief Returns whether the byte at `pos` starts a word.
+ *
+ * A word is either a run of non-space bytes along with the space before it, or a run of spaces
+ * not followed by a word. The bytes of the null rows start no word.
+ */
+struct word_start_fn {
+  cudf::column_device_view const d_strings;
+  char const* d_chars;
+  cudf::size_type const* d_offsets;
+
+  __device__ bool operator()(cudf::size_type pos) const
+  {
+    auto const row = row_of(d_offsets, d_strings.size(), pos);
+    if (d_strings.is_null(row)) { return false; }
+    if (pos == d_offsets[row]) { return true; }
+    auto const chr = d_chars[pos];
+    if (chr != ' ') { return false; }
+    if (d_chars[pos - 1] != ' ') { return true; }
+    return (pos + 1 < d_offsets[row + 1]) && (d_chars[pos + 1] != ' ');
+  }
+};
+
+/**
+ * @brief Merges the bytes of each word into its tokens.
+ *
+ * A byte of `d_starts` is set where a token starts, and an entry of `d_ranks` is the rank of
+ * the pair of the token starting there with the next token of the word.
+ */
+struct merge_word_fn {
+  bpe_lookup_fn const lookup;
+  char const* d_chars;
+  cudf::size_type const* d_offsets;
+  cudf::size_type const num_rows;
+  cudf::size_type const* d_word_starts;
+  cudf::size_type const num_words;
+  cudf::size_type const num_bytes;
+  uint8_t* d_starts;
+  cudf::size_type* d_ranks;
+
+  __device__ void operator()(cudf::size_type word_idx) const
+  {
+    auto const begin    = d_word_starts[word_idx];
+    auto const row_end  = d_offsets[row_of(d_offsets, num_rows, begin) + 1];
+    auto const word_end = word_idx + 1 < num_words ? d_word_starts[word_idx + 1] : num_bytes;
+    auto const end      = thrust::min(word_end, row_end);
+
+    auto const next = [&](cudf::size_type pos) {
+      do {
+        ++pos;
+      } while (pos < end && !d_starts[pos]);
+      return pos;
+    };
+    auto const pair_rank = [&](cudf::size_type pos) {
+      auto const second = next(pos);
+      if (second >= end) { return no_merge; }
+      auto const third = next(second);
+      return lookup.rank(cudf::string_view(d_chars + pos, second - pos),
+                         cudf::string_view(d_chars + second, third - second));
+    };
+
+    // every byte is a token to begin with
+    for (auto pos = begin; pos < end; ++pos)
+      d_starts[pos] = 1;
+    for (auto pos = begin; pos < end; ++pos)
+      d_ranks[pos] = pair_rank(pos);
+
+    while (true) {
+      auto min_rank = no_merge;
+      for (auto pos = begin; pos < end; pos = next(pos))
+        min_rank = thrust::min(min_rank, d_ranks[pos]);
+      if (min_rank == no_merge) { break; }
+
+      // merge the occurrences of the pair from left to right, marking the merged tokens
+      for (auto pos = begin; pos < end; pos = next(pos)) {
+        if (d_ranks[pos] != min_rank) { continue; }
+        d_starts[next(pos)] = 0;
+        d_ranks[pos]        = unused_value;
+      }
+      // the pairs of the merged tokens and of the tokens before them have changed
+      cudf::size_type prev = unused_value;
+      for (auto pos = begin; pos < end; pos = next(pos)) {
+        if (d_ranks[pos] == unused_value) {
+          d_ranks[pos] = pair_rank(pos);
+          if (prev != unused_value) { d_ranks[prev] = pair_rank(prev); }
+        }
+        prev = pos;
+      }
+    }
+  }
+};
+
+/**
+ * @brief Returns the id of the token starting at each position.
+ */
+struct token_id_fn {
+  bpe_lookup_fn const lookup;
+  char const* d_chars;
+  cudf::size_type const* d_offsets;
+  cudf::size_type const num_rows;
+  cudf::size_type const* d_token_starts;
+  cudf::size_type const num_tokens;
+
+  __device__ uint32_t operator()(cudf::size_type token_idx) const
+  {
+    auto const begin   = d_token_starts[token_idx];
+    auto const row_end = d_offsets[row_of(d_offsets, num_rows, begin) + 1];
+    auto const end =
+      token_idx + 1 < num_tokens ? thrust::min(d_token_starts[token_idx + 1], row_end) : row_end;
+    return lookup.token_id(cudf::string_view(d_chars + begin, end - begin));
+  }
+};
+
+}  // namespace
+}  // namespace detail
+
+struct bpe_vocabulary::bpe_vocabulary_impl {
+  rmm::cuda_stream_view const _stream = rmm::cuda_stream_default;
+  std::unique_ptr<cudf::column> _merge_left;
+  std::unique_ptr<cudf::column> _merge_right;
+  std::unique_ptr<cudf::column> _tokens;
+  uint32_t const _unknown_token_id;
+
+  using device_view_type =
+    std::unique_ptr<cudf::column_device_view, std::function<void(cudf::column_device_view*)>>;
+  device_view_type _d_merge_left;
+  device_view_type _d_merge_right;
+  device_view_type _d_tokens;
+  std::unique_ptr<detail::bpe_map_type> _merges_map;
+  std::unique_ptr<detail::bpe_map_type> _tokens_map;
+
+  bpe_vocabulary_impl(cudf::strings_column_view const& merge_left,
+                      cudf::strings_column_view const& merge_right,
+                      cudf::strings_column_view const& tokens,
+                      uint32_t unknown_token_id,
+                      rmm::mr::device_memory_resource* mr)
+    : _merge_left{std::make_unique<cudf::column>(merge_left.parent(), _stream, mr)},
+      _merge_right{std::make_unique<cudf::column>(merge_right.parent(), _stream, mr)},
+      _tokens{std::make_unique<cudf::column>(tokens.parent(), _stream, mr)},
+      _unknown_token_id{unknown_token_id},
+      _d_merge_left{cudf::column_device_view::create(_merge_left->view(), _stream)},
+      _d_merge_right{cudf::column_device_view::create(_merge_right->view(), _stream)},
+      _d_tokens{cudf::column_device_view::create(_tokens->view(), _stream)},
+      _merges_map{detail::make_map(merge_left.size(), _stream)},
+      _tokens_map{detail::make_map(tokens.size(), _stream)}
+  {
+    CUDF_EXPECTS(merge_left.size() == merge_right.size(),
+                 "merge_left and merge_right must have the same size");
+    CUDF_EXPECTS(!merge_left.has_nulls() && !merge_right.has_nulls() && !tokens.has_nulls(),
+                 "merge pairs and tokens must not contain nulls");
+
+    detail::insert_merges(*_merges_map, *_d_merge_left, *_d_merge_right, _stream);
+    detail::insert_tokens(*_tokens_map, *_d_tokens, _stream);
+    _stream.synchronize();
+  }
+
+  [[nodiscard]] detail::bpe_lookup_fn lookup() const
+  {
+    return detail::bpe_lookup_fn{_merges_map->get_device_view(),
+                                 *_d_merge_left,
+                                 *_d_merge_right,
+                                 _tokens_map->get_device_view(),
+                                 *_d_tokens,
+                                 _unknown_token_id};
+  }
+};
+
+bpe_vocabulary::~bpe_vocabulary() = default;
+
+bpe_vocabulary::bpe_vocabulary(cudf::strings_column_view const& merge_left,
+                               cudf::strings_column_view const& merge_right,
+                               cudf::strings_column_view const& tokens,
+                               uint32_t unknown_token_id,
+                               rmm::mr::device_memory_resource* mr)
+  : impl{std::make_unique<bpe_vocabulary_impl>(
+      merge_left, merge_right, tokens, unknown_token_id, mr)}
+{
+}
+
+cudf::size_type bpe_vocabulary::merges_count() const { return impl->_merge_left->size(); }
+
+cudf::size_type bpe_vocabulary::tokens_count() const { return impl->_tokens->size(); }
+
+namespace detail {
+
+std::unique_ptr<cudf::column> byte_pair_encoding(cudf::strings_column_view const& strings,
+                                                 bpe_vocabulary::bpe_vocabulary_impl const& vocab,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  auto const strings_count = strings.size();
+  if (strings_count == 0) {
+    return cudf::make_lists_column(
+      0,
+      cudf::make_empty_column(cudf::data_type{cudf::type_to_id<cudf::offset_type>()}),
+      cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
+      0,
+      rmm::device_buffer{0, stream, mr},
+      stream,
+      mr);
+  }
+
+  // the offsets of the rows relative to the first byte of the strings
+  auto const offsets      = strings.offsets();
+  auto const d_in_offsets = offsets.data<cudf::offset_type>() + strings.offset();
+  auto const begin =
+    cudf::detail::get_value<cudf::offset_type>(offsets, strings.offset(), stream);
+  rmm::device_uvector<cudf::size_type> row_offsets(strings_count + 1, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    d_in_offsets,
+                    d_in_offsets + strings_count + 1,
+                    row_offsets.begin(),
+                    [begin] __device__(cudf::offset_type offset) { return offset - begin; });
+  auto const num_bytes = row_offsets.element(strings_count, stream);
+  auto const d_chars   = strings.chars_size() > 0 ? strings.chars().data<char>() + begin : nullptr;
+  auto const d_strings = cudf::column_device_view::create(strings.parent(), stream);
+  auto const lookup    = vocab.lookup();
+
+  // split the strings into words, and merge the bytes of each word
+  auto const bytes_begin = thrust::make_counting_iterator<cudf::size_type>(0);
+  auto const bytes_end   = bytes_begin + num_bytes;
+  auto const word_start  = word_start_fn{*d_strings, d_chars, row_offsets.data()};
+  auto const num_words   = static_cast<cudf::size_type>(
+    thrust::count_if(rmm::exec_policy(stream), bytes_begin, bytes_end, word_start));
+  rmm::device_uvector<cudf::size_type> word_starts(num_words, stream);
+  thrust::copy_if(
+    rmm::exec_policy(stream), bytes_begin, bytes_end, word_starts.begin(), word_start);
+
+  // the bytes of the null rows start no token
+  rmm::device_uvector<uint8_t> starts(num_bytes, stream);
+  rmm::device_uvector<cudf::size_type> ranks(num_bytes, stream);
+  thrust::uninitialized_fill(rmm::exec_policy(stream), starts.begin(), starts.end(), 0);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     num_words,
+                     merge_word_fn{lookup,
+                                   d_chars,
+                                   row_offsets.data(),
+                                   strings_count,
+                                   word_starts.data(),
+                                   num_words,
+                                   num_bytes,
+                                   starts.data(),
+                                   ranks.data()});
+
+  // the tokens are the bytes starting them
+  auto const is_start = [d_starts = starts.data()] __device__(cudf::size_type pos) {
+    return d_starts[pos] != 0;
+  };
+  auto const num_tokens = static_cast<cudf::size_type>(
+    thrust::count_if(rmm::exec_policy(stream), bytes_begin, bytes_end, is_start));
+  rmm::device_uvector<cudf::size_type> token_starts(num_tokens, stream);
+  thrust::copy_if(rmm::exec_policy(stream), bytes_begin, bytes_end, token_starts.begin(), is_start);
+
+  auto token_ids = cudf::make_numeric_column(
+    cudf::data_type{cudf::type_id::UINT32}, num_tokens, cudf::mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(num_tokens),
+                    token_ids->mutable_view().data<uint32_t>(),
+                    token_id_fn{lookup,
+                                d_chars,
+                                row_offsets.data(),
+                                strings_count,
+                                token_starts.data(),
+                                num_tokens});
+
+  // the tokens of each row start within its bytes
+  auto list_offsets = cudf::make_numeric_column(
+    cudf::data_type{cudf::type_to_id<cudf::offset_type>()},
+    strings_count + 1,
+    cudf::mask_state::UNALLOCATED,
+    stream,
+    mr);
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      token_starts.begin(),
+                      token_starts.end(),
+                      row_offsets.begin(),
+                      row_offsets.end(),
+                      list_offsets->mutable_view().data<cudf::offset_type>());
+
+  return cudf::make_lists_column(strings_count,
+                                 std::move(list_offsets),
+                                 std::move(token_ids),
+                                 strings.null_count(),
+                                 cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<cudf::column> byte_pair_encoding(cudf::strings_column_view const& strings,
+                                                 bpe_vocabulary const& vocabulary,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::byte_pair_encoding(strings, *vocabulary.impl, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace nvtext
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <text/subword/detail/codepoint_normalizer.cuh>
 #include <text/subword/detail/data_normalizer.hpp>
 #include <text/subword/detail/tokenizer_utils.cuh>
 
@@ -39,146 +40,6 @@ namespace {
  */
 constexpr uint32_t FILTER_BIT = 22;
 
-/**
- * @brief Retrieve new code point from metadata value.
- *
- * @param metadata Value from the codepoint_metadata table.
- * @return The replacement character if appropriate.
- */
-__device__ uint32_t get_first_cp(uint32_t metadata) { return metadata & NEW_CP_MASK; }
-
-/**
- * @brief Retrieve token category from the metadata value.
- *
- * Category values are 0-5:
- * 0 - character should be padded
- * 1 - pad character if lower-case
- * 2 - character should be removed
- * 3 - remove character if lower-case
- * 4 - whitespace character -- always replace
- * 5 - uncategorized
- *
- * @param metadata Value from the codepoint_metadata table.
- * @return Category value.
- */
-__device__ uint32_t extract_token_cat(uint32_t metadata)
-{
-  return (metadata >> TOKEN_CAT_SHIFT) & TOKEN_CAT_MASK;
-}
-
-/**
- * @brief Return true if category of metadata value specifies the character should be replaced.
- */
-__device__ bool should_remove_cp(uint32_t metadata, bool lower_case)
-{
-  auto const cat = extract_token_cat(metadata);
-  return (cat == TOKEN_CAT_REMOVE_CHAR) || (lower_case && (cat == TOKEN_CAT_REMOVE_CHAR_IF_LOWER));
-}
-
-/**
- * @brief Return true if category of metadata value specifies the character should be padded.
- */
-__device__ bool should_add_spaces(uint32_t metadata, bool lower_case)
-{
-  auto const cat = extract_token_cat(metadata);
-  return (cat == TOKEN_CAT_ADD_SPACE) || (lower_case && (cat == TOKEN_CAT_ADD_SPACE_IF_LOWER));
-}
-
-/**
- * @brief Return true if category of metadata value specifies the character should be replaced.
- */
-__device__ bool always_replace(uint32_t metadata)
-{
-  return extract_token_cat(metadata) == TOKEN_CAT_ALWAYS_REPLACE;
-}
-
-/**
- * @brief Returns true if metadata value includes a multi-character transform bit equal to 1.
- */
-__device__ bool is_multi_char_transform(uint32_t metadata)
-{
-  return (metadata >> MULTICHAR_SHIFT) & MULTICHAR_MASK;
-}
-
-/**
- * @brief Returns true if the byte passed in could be a valid head byte for
- * a utf8 character. That is, not binary `10xxxxxx`
- */
-__device__ bool is_head_byte(unsigned char utf8_byte) { return (utf8_byte >> 6) != 2; }
-
-/**
- * @brief Converts a UTF-8 character into a unicode code point value.
- *
- * If the byte at start_byte_for_thread is the first byte of a UTF-8 character (head byte),
- * the UTF-8 character is converted to a unicode code point and returned.
- *
- * If the byte at start_byte_for_thread is not a head byte, 0 is returned.
- *
- * All threads start reading bytes from the pointer denoted by strings.
- *
- * @param strings A pointer to the start of the sequence of characters to be analyzed.
- * @param start_byte_for_thread Which byte to start analyzing
- * @return New code point value for this byte.
- */
-__device__ uint32_t extract_code_points_from_utf8(unsigned char const* strings,
-                                                  size_t const total_bytes,
-                                                  uint32_t const start_byte_for_thread)
-{
-  constexpr uint8_t max_utf8_blocks_for_char    = 4;
-  uint8_t utf8_blocks[max_utf8_blocks_for_char] = {0};
-
-  for (int i = 0; i < std::min(static_cast<size_t>(max_utf8_blocks_for_char),
-                               total_bytes - start_byte_for_thread);
-       ++i) {
-    utf8_blocks[i] = strings[start_byte_for_thread + i];
-  }
-
-  const uint8_t length_encoding_bits = utf8_blocks[0] >> 3;
-  // UTF-8 format is variable-width character encoding using up to 4 bytes.
-  // If the first byte is:
-  // - [x00-x7F] -- beginning of a 1-byte character (ASCII)
-  // - [xC0-xDF] -- beginning of a 2-byte character
-  // - [xE0-xEF] -- beginning of a 3-byte character
-  // - [xF0-xF7] -- beginning of a 3-byte character
-  // Anything else is an intermediate byte [x80-xBF].
-  // So shifted by 3 bits this becomes
-  // - [x00-x0F]  or leb < 16
-  // - [x18-x1B]  or 24 <= leb <= 27
-  // - [x1C-x1D]  or 28 <= leb <= 29
-  // - [x1E-x1F]  or leb >= 30
-  // The remaining bits are part of the value as specified by the mask
-  // specified by x's below.
-  // - b0xxxxxxx = x7F
-  // - b110xxxxx = x1F
-  // - b1110xxxx = x0F
-  // - b11110xxx = x07
-  using encoding_length_pair = thrust::pair<uint8_t, uint8_t>;
-  // Set the number of characters and the top masks based on the length encoding bits.
-  encoding_length_pair const char_encoding_length = [length_encoding_bits] {
-    if (length_encoding_bits < 16) return encoding_length_pair{1, 0x7F};
-    if (length_encoding_bits >= 24 && length_encoding_bits <= 27)
-      return encoding_length_pair{2, 0x1F};
-    if (length_encoding_bits == 28 || length_encoding_bits == 29)
-      return encoding_length_pair{3, 0x0F};
-    if (length_encoding_bits == 30) return encoding_length_pair{4, 0x07};
-    return encoding_length_pair{0, 0};
-  }();
-
-  // Now pack up the bits into a uint32_t.
-  // Move the first set of values into bits 19-24 in the 32-bit value.
-  uint32_t code_point = (utf8_blocks[0] & char_encoding_length.second) << 18;
-  // Move the remaining values which are 6 bits (mask b10xxxxxx = x3F)
-  // from the remaining bytes into successive positions in the 32-bit result.
-  code_point |= ((utf8_blocks[1] & 0x3F) << 12);
-  code_point |= ((utf8_blocks[2] & 0x3F) << 6);
-  code_point |= utf8_blocks[3] & 0x3F;
-
-  // Adjust the final result by shifting by the character length.
-  uint8_t const shift_amt = 24 - 6 * char_encoding_length.first;
-  code_point >>= shift_amt;
-  return code_point;
-}
-
 /**
  * @brief Normalize the characters for the strings input.
  *
@@ -213,39 +74,10 @@ __global__ void kernel_data_normalizer(unsigned char const* strings,
   uint32_t const char_for_thread = blockDim.x * blockIdx.x + threadIdx.x;
   uint32_t num_new_chars         = 0;
 
-  if (char_for_thread < total_bytes) {
+  if (char_for_thread < total_bytes && is_head_byte(strings[char_for_thread])) {
     auto const code_point = extract_code_points_from_utf8(strings, total_bytes, char_for_thread);
-    auto const metadata   = cp_metadata[code_point];
-
-    if (is_head_byte(strings[char_for_thread]) && !should_remove_cp(metadata, do_lower_case)) {
-      num_new_chars = 1;
-      // Apply lower cases and accent stripping if necessary
-      auto const new_cp =
-        do_lower_case || always_replace(metadata) ? get_first_cp(metadata) : code_point;
-      replacement_code_points[0] = new_cp == 0 ? code_point : new_cp;
-
-      if (do_lower_case && is_multi_char_transform(metadata)) {
-        auto const next_cps          = aux_table[code_point];
-        replacement_code_points[1]   = static_cast<uint32_t>(next_cps >> 32);
-        auto const potential_next_cp = static_cast<uint32_t>(next_cps);
-        replacement_code_points[2] =
-          potential_next_cp != 0 ? potential_next_cp : replacement_code_points[2];
-        num_new_chars = 2 + (potential_next_cp != 0);
-      }
-
-      if (should_add_spaces(metadata, do_lower_case)) {
-        // Need to shift all existing code-points up one
-        // This is a rotate right. There is no thrust equivalent at this time.
-        for (int loc = num_new_chars; loc > 0; --loc) {
-          replacement_code_points[loc] = replacement_code_points[loc - 1];
-        }
-
-        // Write the required spaces at the end
-        replacement_code_points[0]                 = SPACE_CODE_POINT;
-        replacement_code_points[num_new_chars + 1] = SPACE_CODE_POINT;
-        num_new_chars += 2;
-      }
-    }
+    auto const normalizer = codepoint_normalizer{cp_metadata, aux_table, do_lower_case};
+    num_new_chars         = normalizer(code_point, replacement_code_points);
   }
 
   chars_per_thread[char_for_thread] = num_new_chars;
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <text/subword/detail/cp_data.h>
+
+#include <thrust/pair.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace nvtext {
+namespace detail {
+
+/**
+ * @brief Retrieve new code point from metadata value.
+ *
+ * @param metadata Value from the codepoint_metadata table.
+ * @return The replacement character if appropriate.
+ */
+__device__ inline uint32_t get_first_cp(uint32_t metadata) { return metadata & NEW_CP_MASK; }
+
+/**
+ * @brief Retrieve token category from the metadata value.
+ *
+ * Category values are 0-5:
+ * 0 - character should be padded
+ * 1 - pad character if lower-case
+ * 2 - character should be removed
+ * 3 - remove character if lower-case
+ * 4 - whitespace character -- always replace
+ * 5 - uncategorized
+ *
+ * @param metadata Value from the codepoint_metadata table.
+ * @return Category value.
+ */
+__device__ inline uint32_t extract_token_cat(uint32_t metadata)
+{
+  return (metadata >> TOKEN_CAT_SHIFT) & TOKEN_CAT_MASK;
+}
+
+/**
+ * @brief Return true if category of metadata value specifies the character should be replaced.
+ */
+__device__ inline bool should_remove_cp(uint32_t metadata, bool lower_case)
+{
+  auto const cat = extract_token_cat(metadata);
+  return (cat == TOKEN_CAT_REMOVE_CHAR) || (lower_case && (cat == TOKEN_CAT_REMOVE_CHAR_IF_LOWER));
+}
+
+/**
+ * @brief Return true if category of metadata value specifies the character should be padded.
+ */
+__device__ inline bool should_add_spaces(uint32_t metadata, bool lower_case)
+{
+  auto const cat = extract_token_cat(metadata);
+  return (cat == TOKEN_CAT_ADD_SPACE) || (lower_case && (cat == TOKEN_CAT_ADD_SPACE_IF_LOWER));
+}
+
+/**
+ * @brief Return true if category of metadata value specifies the character should be replaced.
+ */
+__device__ inline bool always_replace(uint32_t metadata)
+{
+  return extract_token_cat(metadata) == TOKEN_CAT_ALWAYS_REPLACE;
+}
+
+/**
+ * @brief Returns true if metadata value includes a multi-character transform bit equal to 1.
+ */
+__device__ inline bool is_multi_char_transform(uint32_t metadata)
+{
+  return (metadata >> MULTICHAR_SHIFT) & MULTICHAR_MASK;
+}
+
+/**
+ * @brief Returns true if the byte passed in could be a valid head byte for
+ * a utf8 character. That is, not binary `10xxxxxx`
+ */
+__device__ inline bool is_head_byte(unsigned char utf8_byte) { return (utf8_byte >> 6) != 2; }
+
+/**
+ * @brief Converts a UTF-8 character into a unicode code point value.
+ *
+ * If the byte at start_byte_for_thread is the first byte of a UTF-8 character (head byte),
+ * the UTF-8 character is converted to a unicode code point and returned.
+ *
+ * If the byte at start_byte_for_thread is not a head byte, 0 is returned.
+ *
+ * All threads start reading bytes from the pointer denoted by strings.
+ *
+ * @param strings A pointer to the start of the sequence of characters to be analyzed.
+ * @param start_byte_for_thread Which byte to start analyzing
+ * @return New code point value for this byte.
+ */
+__device__ inline uint32_t extract_code_points_from_utf8(unsigned char const* strings,
+                                                         size_t const total_bytes,
+                                                         uint32_t const start_byte_for_thread)
+{
+  constexpr uint8_t max_utf8_blocks_for_char    = 4;
+  uint8_t utf8_blocks[max_utf8_blocks_for_char] = {0};
+
+  for (int i = 0; i < std::min(static_cast<size_t>(max_utf8_blocks_for_char),
+                               total_bytes - start_byte_for_thread);
+       ++i) {
+    utf8_blocks[i] = strings[start_byte_for_thread + i];
+  }
+
+  const uint8_t length_encoding_bits = utf8_blocks[0] >> 3;
+  // UTF-8 format is variable-width character encoding using up to 4 bytes.
+  // If the first byte is:
+  // - [x00-x7F] -- beginning of a 1-byte character (ASCII)
+  // - [xC0-xDF] -- beginning of a 2-byte character
+  // - [xE0-xEF] -- beginning of a 3-byte character
+  // - [xF0-xF7] -- beginning of a 3-byte character
+  // Anything else is an intermediate byte [x80-xBF].
+  // So shifted by 3 bits this becomes
+  // - [x00-x0F]  or leb < 16
+  // - [x18-x1B]  or 24 <= leb <= 27
+  // - [x1C-x1D]  or 28 <= leb <= 29
+  // - [x1E-x1F]  or leb >= 30
+  // The remaining bits are part of the value as specified by the mask
+  // specified by x's below.
+  // - b0xxxxxxx = x7F
+  // - b110xxxxx = x1F
+  // - b1110xxxx = x0F
+  // - b11110xxx = x07
+  using encoding_length_pair = thrust::pair<uint8_t, uint8_t>;
+  // Set the number of characters and the top masks based on the length encoding bits.
+  encoding_length_pair const char_encoding_length = [length_encoding_bits] {
+    if (length_encoding_bits < 16) return encoding_length_pair{1, 0x7F};
+    if (length_encoding_bits >= 24 && length_encoding_bits <= 27)
+      return encoding_length_pair{2, 0x1F};
+    if (length_encoding_bits == 28 || length_encoding_bits == 29)
+      return encoding_length_pair{3, 0x0F};
+    if (length_encoding_bits == 30) return encoding_length_pair{4, 0x07};
+    return encoding_length_pair{0, 0};
+  }();
+
+  // Now pack up the bits into a uint32_t.
+  // Move the first set of values into bits 19-24 in the 32-bit value.
+  uint32_t code_point = (utf8_blocks[0] & char_encoding_length.second) << 18;
+  // Move the remaining values which are 6 bits (mask b10xxxxxx = x3F)
+  // from the remaining bytes into successive positions in the 32-bit result.
+  code_point |= ((utf8_blocks[1] & 0x3F) << 12);
+  code_point |= ((utf8_blocks[2] & 0x3F) << 6);
+  code_point |= utf8_blocks[3] & 0x3F;
+
+  // Adjust the final result by shifting by the character length.
+  uint8_t const shift_amt = 24 - 6 * char_encoding_length.first;
+  code_point >>= shift_amt;
+  return code_point;
+}
+
+// code-point to multi-byte range limits
+constexpr uint32_t UTF8_1BYTE = 0x0080;
+constexpr uint32_t UTF8_2BYTE = 0x0800;
+constexpr uint32_t UTF8_3BYTE = 0x010000;
+
+/**
+ * @brief Returns the number of bytes of the UTF-8 encoding of a code point.
+ */
+__device__ inline int32_t codepoint_utf8_size(uint32_t code_point)
+{
+  return 1 + (code_point >= UTF8_1BYTE) + (code_point >= UTF8_2BYTE) +
+         (code_point >= UTF8_3BYTE);
+}
+
+/**
+ * @brief Writes the 1-4 UTF-8 encoded bytes of a code point.
+ *
+ * @param code_point The code point to encode
+ * @param out_ptr Where to write the bytes
+ * @return The position after the bytes written
+ */
+__device__ inline char* write_codepoint_utf8(uint32_t code_point, char* out_ptr)
+{
+  if (code_point < UTF8_1BYTE)  // ASCII range
+    *out_ptr++ = static_cast<char>(code_point);
+  else if (code_point < UTF8_2BYTE) {  // create two-byte UTF-8
+    // b00001xxx:byyyyyyyy => b110xxxyy:b10yyyyyy
+    *out_ptr++ = static_cast<char>((((code_point << 2) & 0x001F00) | 0x00C000) >> 8);
+    *out_ptr++ = static_cast<char>((code_point & 0x3F) | 0x0080);
+  } else if (code_point < UTF8_3BYTE) {  // create three-byte UTF-8
+    // bxxxxxxxx:byyyyyyyy => b1110xxxx:b10xxxxyy:b10yyyyyy
+    *out_ptr++ = static_cast<char>((((code_point << 4) & 0x0F0000) | 0x00E00000) >> 16);
+    *out_ptr++ = static_cast<char>((((code_point << 2) & 0x003F00) | 0x008000) >> 8);
+    *out_ptr++ = static_cast<char>((code_point & 0x3F) | 0x0080);
+  } else {  // create four-byte UTF-8
+    // maximum code-point value is 0x00110000
+    // b000xxxxx:byyyyyyyy:bzzzzzzzz => b11110xxx:b10xxyyyy:b10yyyyzz:b10zzzzzz
+    *out_ptr++ = static_cast<char>((((code_point << 6) & 0x07000000) | unsigned{0xF0000000}) >> 24);
+    *out_ptr++ = static_cast<char>((((code_point << 4) & 0x003F0000) | 0x00800000) >> 16);
+    *out_ptr++ = static_cast<char>((((code_point << 2) & 0x003F00) | 0x008000) >> 8);
+    *out_ptr++ = static_cast<char>((code_point & 0x3F) | 0x0080);
+  }
+  return out_ptr;
+}
+
+/**
+ * @brief Normalizes a single code point as `data_normalizer` does.
+ *
+ * The code point is replaced, padded with spaces, or removed depending on `do_lower_case` and
+ * on its values in the metadata tables.
+ */
+struct codepoint_normalizer {
+  codepoint_metadata_type const* d_cp_metadata;
+  aux_codepoint_data_type const* d_aux_table;
+  bool do_lower_case;
+
+  /**
+   * @brief Writes the normalized code points of `code_point` to `out`.
+   *
+   * @param code_point The code point of a character
+   * @param out At least MAX_NEW_CHARS code points to write to
+   * @return The number of code points written, 0 if the character is removed
+   */
+  __device__ uint32_t operator()(uint32_t code_point, uint32_t* out) const
+  {
+    auto const metadata = d_cp_metadata[code_point];
+    if (should_remove_cp(metadata, do_lower_case)) { return 0; }
+
+    uint32_t num_new_chars = 1;
+    // Apply lower cases and accent stripping if necessary
+    auto const new_cp =
+      do_lower_case || always_replace(metadata) ? get_first_cp(metadata) : code_point;
+    out[0] = new_cp == 0 ? code_point : new_cp;
+
+    if (do_lower_case && is_multi_char_transform(metadata)) {
+      auto const next_cps          = d_aux_table[code_point];
+      out[1]                       = static_cast<uint32_t>(next_cps >> 32);
+      auto const potential_next_cp = static_cast<uint32_t>(next_cps);
+      if (potential_next_cp != 0) { out[2] = potential_next_cp; }
+      num_new_chars = 2 + (potential_next_cp != 0);
+    }
+
+    if (should_add_spaces(metadata, do_lower_case)) {
+      // Need to shift all existing code-points up one
+      // This is a rotate right. There is no thrust equivalent at this time.
+      for (int loc = num_new_chars; loc > 0; --loc) {
+        out[loc] = out[loc - 1];
+      }
+
+      // Write the required spaces at the end
+      out[0]                 = SPACE_CODE_POINT;
+      out[num_new_chars + 1] = SPACE_CODE_POINT;
+      num_new_chars += 2;
+    }
+    return num_new_chars;
+  }
+};
+
+}  // namespace detail
+}  // namespace nvtext
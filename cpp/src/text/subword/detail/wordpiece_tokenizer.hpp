@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -49,9 +49,6 @@ class wordpiece_tokenizer {
    * @brief Creates a full tokenizer that cleans the text and splits it into tokens.
    *
    * @param vocab_table The preprocessed hashed vocabulary data.
-   * @param max_rows_final_tensor Maximum number of rows in tensor_token-ids expected by tokenizer.
-   *        Used to allocate temporary working memory on the GPU.
-   *        If the output contains a larger number of rows, behavior is undefined.
    * @param max_sequence_length Limit the number of token-ids per row in the output
    * @param stride Each row in tensor-token-ids will replicate `max_sequence_length - stride`
    *        token-ids from the previous row, unless it is the first string.
@@ -67,7 +64,6 @@ class wordpiece_tokenizer {
    *        specified in the `vocab_file`.
    */
   wordpiece_tokenizer(hashed_vocabulary const& vocab_table,
-                      uint32_t max_rows_final_tensor,
                       uint32_t max_sequence_length,
                       uint32_t stride,
                       bool do_truncate,
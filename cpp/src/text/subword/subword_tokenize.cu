@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,7 @@
 #include <cudf/utilities/error.hpp>
 #include <nvtext/detail/load_hash_file.hpp>
 #include <nvtext/subword_tokenize.hpp>
+#include <text/subword/detail/tokenizer_utils.cuh>
 #include <text/subword/detail/wordpiece_tokenizer.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -121,23 +122,18 @@ __global__ void kernel_compute_tensor_metadata(
   }
 }
 
-}  // namespace
-
-tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
+/**
+ * @brief Tokenizes the strings into the output tensors, sized from the number of tokens found.
+ */
+tokenizer_result tokenize_strings(cudf::strings_column_view const& strings,
                                   hashed_vocabulary const& vocab_table,
                                   uint32_t max_sequence_length,
                                   uint32_t stride,
                                   bool do_lower_case,
                                   bool do_truncate,
-                                  uint32_t max_rows_tensor,
                                   rmm::cuda_stream_view stream,
                                   rmm::mr::device_memory_resource* mr)
 {
-  CUDF_EXPECTS(stride <= max_sequence_length,
-               "stride must be less than or equal to max_sequence_length");
-  CUDF_EXPECTS(max_sequence_length * max_rows_tensor <
-                 static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
-               "max_sequence_length x max_rows_tensor is too large for cudf output column size");
   auto const strings_count = strings.size();
   if (strings_count == 0 || strings.chars_size() == 0)
     return tokenizer_result{0,
@@ -153,7 +149,7 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
 
   // Create tokenizer
   wordpiece_tokenizer tokenizer(
-    vocab_table, max_rows_tensor, max_sequence_length, stride, do_truncate, do_lower_case, stream);
+    vocab_table, max_sequence_length, stride, do_truncate, do_lower_case, stream);
   // Run tokenizer
   auto const tokens = tokenizer.tokenize(d_chars, d_offsets, strings_count, stream);
   // assign output components
@@ -183,6 +179,9 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
     thrust::plus<uint32_t>());
   // last element is the total number of output rows
   uint32_t const nrows_tensor_token_ids = offsets_per_tensor.element(strings_count, stream);
+  CUDF_EXPECTS(static_cast<std::size_t>(nrows_tensor_token_ids) * max_sequence_length <
+                 static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
+               "output token-ids are too large for cudf output column size");
 
   // compute global_row to tensor, and global_row to within_tensor_row correspondence
   rmm::device_uvector<uint32_t> row2tensor(nrows_tensor_token_ids, stream);
@@ -247,8 +246,59 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                           std::move(tensor_metadata)};
 }
 
+}  // namespace
+
+tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
+                                  hashed_vocabulary const& vocab_table,
+                                  uint32_t max_sequence_length,
+                                  uint32_t stride,
+                                  bool do_lower_case,
+                                  bool do_truncate,
+                                  uint32_t max_rows_tensor,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(stride <= max_sequence_length,
+               "stride must be less than or equal to max_sequence_length");
+  CUDF_EXPECTS(max_sequence_length * max_rows_tensor <
+                 static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
+               "max_sequence_length x max_rows_tensor is too large for cudf output column size");
+  return tokenize_strings(
+    strings, vocab_table, max_sequence_length, stride, do_lower_case, do_truncate, stream, mr);
+}
+
 }  // namespace detail
 
+subword_tokenizer::~subword_tokenizer() = default;
+
+subword_tokenizer::subword_tokenizer(std::unique_ptr<hashed_vocabulary> vocabulary)
+  : _vocabulary{std::move(vocabulary)}
+{
+  CUDF_EXPECTS(_vocabulary != nullptr, "vocabulary must not be null");
+  // the normalizer tables are made resident before any call may use them on another stream
+  auto const stream = rmm::cuda_stream_default;
+  detail::get_codepoint_metadata(stream);
+  detail::get_aux_codepoint_data(stream);
+  stream.synchronize();
+}
+
+hashed_vocabulary const& subword_tokenizer::vocabulary() const { return *_vocabulary; }
+
+tokenizer_result subword_tokenizer::tokenize(cudf::strings_column_view const& strings,
+                                             uint32_t max_sequence_length,
+                                             uint32_t stride,
+                                             bool do_lower_case,
+                                             bool do_truncate,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(stride <= max_sequence_length,
+               "stride must be less than or equal to max_sequence_length");
+  return detail::tokenize_strings(
+    strings, *_vocabulary, max_sequence_length, stride, do_lower_case, do_truncate, stream, mr);
+}
+
 tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                                   hashed_vocabulary const& vocabulary_table,
                                   uint32_t max_sequence_length,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,23 +16,43 @@
 
 #include <cudf/ast/detail/expression_evaluator.cuh>
 #include <cudf/ast/detail/expression_parser.hpp>
+#include <cudf/ast/detail/operators.hpp>
 #include <cudf/ast/expressions.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/stream_capture.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/transform.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <jit_preprocessed_files/transform/jit/compute_column_kernel.cu.jit.hpp>
+
+#include <jit/cache.hpp>
+#include <jit/type.hpp>
+
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/mr/device/device_memory_resource.hpp>
 
+#include <thrust/logical.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 
@@ -78,6 +98,240 @@ __launch_bounds__(max_block_size) __global__
   }
 }
 
+namespace {
+
+using ast::ast_operator;
+using ast::detail::device_data_reference_type;
+
+/**
+ * @brief Returns whether the JIT evaluation supports values of this type, the arithmetic and
+ * boolean types.
+ */
+bool is_jit_supported_type(data_type type) { return is_numeric(type); }
+
+/**
+ * @brief Returns the CUDA source of `func` applied to an operand of this type, with the overload
+ * `std::func` would choose: `funcf` for `float`, `func` for `double` and the integral types
+ * promoted to `double`.
+ */
+std::string math_function_source(std::string const& func,
+                                 std::vector<std::string> const& operands,
+                                 data_type type)
+{
+  auto const cast = [&](std::string const& operand) {
+    return is_floating_point(type) ? operand : "static_cast<double>(" + operand + ")";
+  };
+  auto const name = func + (type.id() == type_id::FLOAT32 ? "f" : "");
+  auto source     = name + "(" + cast(operands[0]);
+  if (operands.size() > 1) { source += ", " + cast(operands[1]); }
+  return source + ")";
+}
+
+/**
+ * @brief Returns the CUDA source of an operator applied to operands of this type, computing the
+ * same value as its `ast::detail::operator_functor`.
+ *
+ * @return The source, or nothing if the JIT evaluation does not support the operator
+ */
+std::optional<std::string> operator_source(ast_operator op,
+                                           std::vector<std::string> const& operands,
+                                           data_type type)
+{
+  auto const& a      = operands.front();
+  auto const& b      = operands.back();
+  auto const binary  = [&](std::string const& symbol) { return a + " " + symbol + " " + b; };
+  auto const to_real = [](std::string const& operand) {
+    return "static_cast<double>(" + operand + ")";
+  };
+  switch (op) {
+    case ast_operator::ADD: return binary("+");
+    case ast_operator::SUB: return binary("-");
+    case ast_operator::MUL: return binary("*");
+    case ast_operator::DIV: return binary("/");
+    case ast_operator::TRUE_DIV: return to_real(a) + " / " + to_real(b);
+    case ast_operator::FLOOR_DIV: return "floor(" + to_real(a) + " / " + to_real(b) + ")";
+    case ast_operator::MOD:
+      if (!is_floating_point(type)) { return binary("%"); }
+      return math_function_source("fmod", operands, type);
+    case ast_operator::PYMOD:
+      if (!is_floating_point(type)) { return "((" + binary("%") + ") + " + b + ") % " + b; }
+      return math_function_source(
+        "fmod", {math_function_source("fmod", operands, type) + " + " + b, b}, type);
+    case ast_operator::POW: return math_function_source("pow", operands, type);
+    // without nulls, the null-aware operators are the same as the others, and IS_NULL is false
+    case ast_operator::EQUAL:
+    case ast_operator::NULL_EQUAL: return binary("==");
+    case ast_operator::NOT_EQUAL: return binary("!=");
+    case ast_operator::LESS: return binary("<");
+    case ast_operator::GREATER: return binary(">");
+    case ast_operator::LESS_EQUAL: return binary("<=");
+    case ast_operator::GREATER_EQUAL: return binary(">=");
+    case ast_operator::BITWISE_AND: return binary("&");
+    case ast_operator::BITWISE_OR: return binary("|");
+    case ast_operator::BITWISE_XOR: return binary("^");
+    case ast_operator::LOGICAL_AND:
+    case ast_operator::NULL_LOGICAL_AND: return binary("&&");
+    case ast_operator::LOGICAL_OR:
+    case ast_operator::NULL_LOGICAL_OR: return binary("||");
+    case ast_operator::IDENTITY: return a;
+    case ast_operator::SIN: return math_function_source("sin", operands, type);
+    case ast_operator::COS: return math_function_source("cos", operands, type);
+    case ast_operator::TAN: return math_function_source("tan", operands, type);
+    case ast_operator::ARCSIN: return math_function_source("asin", operands, type);
+    case ast_operator::ARCCOS: return math_function_source("acos", operands, type);
+    case ast_operator::ARCTAN: return math_function_source("atan", operands, type);
+    case ast_operator::SINH: return math_function_source("sinh", operands, type);
+    case ast_operator::COSH: return math_function_source("cosh", operands, type);
+    case ast_operator::TANH: return math_function_source("tanh", operands, type);
+    case ast_operator::ARCSINH: return math_function_source("asinh", operands, type);
+    case ast_operator::ARCCOSH: return math_function_source("acosh", operands, type);
+    case ast_operator::ARCTANH: return math_function_source("atanh", operands, type);
+    case ast_operator::EXP: return math_function_source("exp", operands, type);
+    case ast_operator::LOG: return math_function_source("log", operands, type);
+    case ast_operator::SQRT: return math_function_source("sqrt", operands, type);
+    case ast_operator::CBRT: return math_function_source("cbrt", operands, type);
+    case ast_operator::CEIL: return math_function_source("ceil", operands, type);
+    case ast_operator::FLOOR: return math_function_source("floor", operands, type);
+    case ast_operator::RINT: return math_function_source("rint", operands, type);
+    case ast_operator::ABS:
+      if (is_floating_point(type)) { return math_function_source("fabs", operands, type); }
+      if (!is_unsigned(type)) { return "(" + a + " < 0 ? -" + a + " : " + a + ")"; }
+      return a;
+    case ast_operator::BIT_INVERT: return "~" + a;
+    case ast_operator::NOT: return "!" + a;
+    case ast_operator::CAST_TO_INT64: return "static_cast<int64_t>(" + a + ")";
+    case ast_operator::CAST_TO_UINT64: return "static_cast<uint64_t>(" + a + ")";
+    case ast_operator::CAST_TO_FLOAT64: return to_real(a);
+    case ast_operator::IS_NULL: return "false";
+    default: return std::nullopt;
+  }
+}
+
+/**
+ * @brief Generates the `GENERIC_EXPRESSION_OP` function evaluating the plan of the parser for one
+ * row, with one local variable for each operand and each operator result.
+ *
+ * @return The source, or nothing if the JIT evaluation does not support the expression
+ */
+std::optional<std::string> expression_source(ast::detail::expression_parser const& parser)
+{
+  auto const& data_references = parser.data_references();
+  auto const& source_indices  = parser.operator_source_indices();
+
+  std::string loads;
+  for (std::size_t i = 0; i < data_references.size(); ++i) {
+    auto const& reference = data_references[i];
+    if (reference.reference_type == device_data_reference_type::INTERMEDIATE ||
+        reference.table_source == ast::table_reference::OUTPUT) {
+      continue;
+    }
+    if (!is_jit_supported_type(reference.data_type)) { return std::nullopt; }
+    auto const type_name = jit::get_type_name(reference.data_type);
+    auto const index     = std::to_string(reference.data_index);
+    loads += "  " + type_name + " const ref" + std::to_string(i) + " = ";
+    loads += reference.reference_type == device_data_reference_type::COLUMN
+               ? "static_cast<" + type_name + " const*>(columns[" + index + "])[row];\n"
+               : "*reinterpret_cast<" + type_name + " const*>(literals + " + index + ");\n";
+  }
+
+  // the variable and the type of the value last stored in each intermediate
+  std::vector<std::pair<std::string, data_type>> intermediates(
+    parser.device_expression_data.num_intermediates);
+  auto const operand = [&](size_type index) {
+    auto const& reference = data_references[index];
+    return reference.reference_type == device_data_reference_type::INTERMEDIATE
+             ? intermediates[reference.data_index]
+             : std::pair{"ref" + std::to_string(index), reference.data_type};
+  };
+
+  std::string operations;
+  std::string result;
+  auto source_index = std::size_t{0};
+  for (std::size_t i = 0; i < parser.operators().size(); ++i) {
+    auto const op    = parser.operators()[i];
+    auto const arity = static_cast<std::size_t>(ast::detail::ast_operator_arity(op));
+    std::vector<std::string> operands;
+    std::vector<data_type> operand_types;
+    for (std::size_t j = 0; j < arity; ++j) {
+      auto const [name, type] = operand(source_indices[source_index + j]);
+      operands.push_back(name);
+      operand_types.push_back(type);
+    }
+    auto const& output = data_references[source_indices[source_index + arity]];
+    source_index += arity + 1;
+
+    auto const type = ast::detail::ast_operator_return_type(op, operand_types);
+    auto const body = operator_source(op, operands, operand_types.front());
+    if (!body || !is_jit_supported_type(type)) { return std::nullopt; }
+    auto const name = "value" + std::to_string(i);
+    operations += "  " + jit::get_type_name(type) + " const " + name + " = " + *body + ";\n";
+    if (output.reference_type == device_data_reference_type::INTERMEDIATE) {
+      intermediates[output.data_index] = {name, type};
+    } else {
+      result = name;
+    }
+  }
+
+  return "#pragma once\n\n"
+         "template <typename TypeOut>\n"
+         "__device__ inline void GENERIC_EXPRESSION_OP(TypeOut* out,\n"
+         "                                             cudf::size_type row,\n"
+         "                                             void const* const* columns,\n"
+         "                                             int64_t const* literals)\n"
+         "{\n" +
+         loads + operations + "  *out = static_cast<TypeOut>(" + result + ");\n}\n";
+}
+
+/**
+ * @brief Returns a literal value stored in 8 bytes, as read by the JIT kernel.
+ */
+struct literal_value_fn {
+  template <typename T>
+  __device__ int64_t operator()(ast::generic_scalar_device_view const& literal) const
+  {
+    int64_t result{};
+    if constexpr (is_numeric<T>() && sizeof(T) <= sizeof(int64_t)) {
+      auto const value = literal.value<T>();
+      memcpy(&result, &value, sizeof(T));
+    }
+    return result;
+  }
+
+  __device__ int64_t operator()(ast::generic_scalar_device_view const& literal) const
+  {
+    return type_dispatcher(literal.type(), *this, literal);
+  }
+};
+
+struct literal_is_valid_fn {
+  __device__ bool operator()(ast::generic_scalar_device_view const& literal) const
+  {
+    return literal.is_valid();
+  }
+};
+
+/**
+ * @brief Returns whether the output of the expression is null exactly when one of the columns
+ * it references is null, so that its null mask is the `bitmask_and` of their masks.
+ */
+bool has_propagated_nulls(ast::detail::expression_parser const& parser,
+                          rmm::cuda_stream_view stream)
+{
+  auto const& operators = parser.operators();
+  auto const& literals  = parser.device_expression_data.literals;
+  return std::none_of(operators.begin(),
+                      operators.end(),
+                      [](auto op) {
+                        return op == ast_operator::NULL_EQUAL ||
+                               op == ast_operator::NULL_LOGICAL_AND ||
+                               op == ast_operator::NULL_LOGICAL_OR || op == ast_operator::IS_NULL;
+                      }) &&
+         thrust::all_of(
+           rmm::exec_policy(stream), literals.begin(), literals.end(), literal_is_valid_fn{});
+}
+
+}  // namespace
+
 std::unique_ptr<column> compute_column(table_view const& table,
                                        ast::expression const& expr,
                                        rmm::cuda_stream_view stream,
@@ -95,6 +349,8 @@ std::unique_ptr<column> compute_column(table_view const& table,
 
   auto output_column = cudf::make_fixed_width_column(
     parser.output_type(), table.num_rows(), output_column_mask_state, stream, mr);
+  // While capturing, the null count is left to be computed once the graph has been launched
+  if (is_capturing(stream)) { output_column->defer_null_count(); }
   auto mutable_output_device =
     cudf::mutable_column_device_view::create(output_column->mutable_view(), stream);
 
@@ -128,14 +384,81 @@ std::unique_ptr<column> compute_column(table_view const& table,
   return output_column;
 }
 
+std::unique_ptr<column> compute_column_jit(table_view const& table,
+                                           ast::expression const& expr,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  auto const has_nulls = expr.may_evaluate_null(table, stream);
+  auto const parser    = ast::detail::expression_parser{expr, table, has_nulls, stream, mr};
+  auto const source    = expression_source(parser);
+  // Checking the validity of the literals reads it on the host, which cannot be captured
+  if (!source || table.num_rows() == 0 ||
+      (has_nulls && (is_capturing(stream) || !has_propagated_nulls(parser, stream)))) {
+    return compute_column(table, expr, stream, mr);
+  }
+
+  std::vector<size_type> column_indices;
+  std::vector<void const*> columns(table.num_columns());
+  for (auto const& reference : parser.data_references()) {
+    if (reference.reference_type == device_data_reference_type::COLUMN &&
+        reference.table_source == ast::table_reference::LEFT) {
+      column_indices.push_back(reference.data_index);
+      columns[reference.data_index] = jit::get_data_ptr(table.column(reference.data_index));
+    }
+  }
+  auto const d_columns = make_device_uvector_async(columns, stream);
+
+  auto const& literals = parser.device_expression_data.literals;
+  rmm::device_uvector<int64_t> d_literals(literals.size(), stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    literals.begin(),
+                    literals.end(),
+                    d_literals.begin(),
+                    literal_value_fn{});
+
+  auto output = make_fixed_width_column(
+    parser.output_type(), table.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  if (has_nulls) {
+    auto [null_mask, null_count] = bitmask_and(table.select(column_indices), stream, mr);
+    output->set_null_mask(std::move(null_mask), null_count);
+    if (is_capturing(stream)) { output->defer_null_count(); }
+  }
+
+  auto const kernel_name =
+    jitify2::reflection::Template("cudf::transformation::jit::compute_column_kernel")
+      .instantiate(jit::get_type_name(output->type()));
+
+  jit::get_program_cache(*transform_jit_compute_column_kernel_cu_jit)
+    .get_kernel(
+      kernel_name, {}, {{"transform/jit/expression-udf.hpp", *source}}, {"-arch=sm_."})  //
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())                              //
+    ->launch(table.num_rows(),
+             jit::get_data_ptr(output->mutable_view()),
+             d_columns.data(),
+             d_literals.data());
+
+  return output;
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> compute_column(table_view const& table,
                                        ast::expression const& expr,
+                                       rmm::cuda_stream_view stream,
                                        rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::compute_column(table, expr, rmm::cuda_stream_default, mr);
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(table, stream);
+  return detail::compute_column(table, expr, stream, mr);
+}
+
+std::unique_ptr<column> compute_column_jit(table_view const& table,
+                                           ast::expression const& expr,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(table, stream);
+  return detail::compute_column_jit(table, expr, stream, mr);
 }
 
 }  // namespace cudf
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include Jitify's cstddef header first
+#include <cstddef>
+
+#include <cuda/std/climits>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/limits>
+
+#include <cudf/types.hpp>
+
+#include <transform/jit/expression-udf.hpp>
+
+namespace cudf {
+namespace transformation {
+namespace jit {
+
+/**
+ * @brief Evaluates the generated `GENERIC_EXPRESSION_OP` for each row of a table.
+ *
+ * @param size The number of rows
+ * @param out_data The output of each row
+ * @param columns The data of each column of the table
+ * @param literals The value of each literal of the expression, stored in 8 bytes
+ */
+template <typename TypeOut>
+__global__ void compute_column_kernel(cudf::size_type size,
+                                      TypeOut* out_data,
+                                      void const* const* columns,
+                                      int64_t const* literals)
+{
+  int tid    = threadIdx.x;
+  int blkid  = blockIdx.x;
+  int blksz  = blockDim.x;
+  int gridsz = gridDim.x;
+
+  int start = tid + blkid * blksz;
+  int step  = blksz * gridsz;
+
+  for (cudf::size_type i = start; i < size; i += step) {
+    GENERIC_EXPRESSION_OP(&out_data[i], i, columns, literals);
+  }
+}
+
+}  // namespace jit
+}  // namespace transformation
+}  // namespace cudf
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include Jitify's cstddef header first
+#include <cstddef>
+
+#include <cuda/std/climits>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include <cudf/types.hpp>
+#include <cudf/wrappers/durations.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <transform/jit/table-udf.hpp>
+
+namespace cudf {
+namespace transformation {
+namespace jit {
+
+/**
+ * @brief Calls the generated `GENERIC_TABLE_OP` for each row of a table.
+ *
+ * @param size The number of rows
+ * @param outputs The data of each output column
+ * @param inputs The data of each input column
+ * @param valid The rows on which to call the function, or nullptr for all rows
+ */
+__global__ void table_kernel(cudf::size_type size,
+                             void* const* outputs,
+                             void const* const* inputs,
+                             cudf::bitmask_type const* valid)
+{
+  int tid    = threadIdx.x;
+  int blkid  = blockIdx.x;
+  int blksz  = blockDim.x;
+  int gridsz = gridDim.x;
+
+  int start = tid + blkid * blksz;
+  int step  = blksz * gridsz;
+
+  for (cudf::size_type i = start; i < size; i += step) {
+    // same as cudf::bit_is_set, whose header is not needed in the kernel otherwise
+    if (valid == nullptr || ((valid[i / 32] >> (i % 32)) & 1)) {
+      GENERIC_TABLE_OP(i, outputs, inputs);
+    }
+  }
+}
+
+}  // namespace jit
+}  // namespace transformation
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,13 +17,21 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/strings/detail/utilities.cuh>
 #include <cudf/table/row_operators.cuh>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 
+#include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform.h>
 
@@ -121,8 +129,83 @@ std::pair<std::unique_ptr<column>, table_view> one_hot_encode(column_view const&
   return type_dispatcher(input.type(), one_hot_encode_launcher{}, input, categories, stream, mr);
 }
 
+std::unique_ptr<column> one_hot_encode_sparse(column_view const& input,
+                                              column_view const& categories,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(input.type() == categories.type(), "Mismatch type between input and categories.");
+
+  auto const index_type = data_type{type_to_id<size_type>()};
+  if (input.is_empty()) {
+    return make_lists_column(0,
+                             make_empty_column(type_to_id<offset_type>()),
+                             make_empty_column(index_type),
+                             0,
+                             rmm::device_buffer{0, stream, mr},
+                             stream,
+                             mr);
+  }
+
+  // The categories matching each input element are found by binary search in the sorted
+  // categories, instead of comparing each element with every category
+  auto const column_order    = std::vector<order>{order::ASCENDING};
+  auto const null_precedence = std::vector<null_order>{null_order::BEFORE};
+  auto const categories_view = table_view{{categories}};
+  auto const input_view      = table_view{{input}};
+  auto const sort_order =
+    detail::stable_sorted_order(categories_view, column_order, null_precedence, stream);
+  auto const sorted_categories = detail::gather(categories_view,
+                                                sort_order->view(),
+                                                out_of_bounds_policy::DONT_CHECK,
+                                                negative_index_policy::NOT_ALLOWED,
+                                                stream);
+  auto const lower = detail::lower_bound(
+    sorted_categories->view(), input_view, column_order, null_precedence, stream);
+  auto const upper = detail::upper_bound(
+    sorted_categories->view(), input_view, column_order, null_precedence, stream);
+
+  auto const d_lower = lower->view().data<size_type>();
+  auto const d_upper = upper->view().data<size_type>();
+  auto const counts  = make_counting_transform_iterator(
+    0, [d_lower, d_upper] __device__(size_type i) { return d_upper[i] - d_lower[i]; });
+  auto offsets = strings::detail::make_offsets_child_column(
+    counts, counts + input.size(), stream, mr);
+  auto const d_offsets = offsets->view().data<offset_type>();
+
+  auto const num_indices = get_value<offset_type>(offsets->view(), input.size(), stream);
+  auto indices = make_numeric_column(index_type, num_indices, mask_state::UNALLOCATED, stream, mr);
+  auto const d_sort_order = sort_order->view().data<size_type>();
+  auto const d_indices    = indices->mutable_view().data<size_type>();
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    input.size(),
+    [d_lower, d_upper, d_offsets, d_sort_order, d_indices] __device__(size_type i) {
+      for (auto k = d_lower[i]; k < d_upper[i]; ++k) {
+        d_indices[d_offsets[i] + k - d_lower[i]] = d_sort_order[k];
+      }
+    });
+
+  return make_lists_column(input.size(),
+                           std::move(offsets),
+                           std::move(indices),
+                           0,
+                           rmm::device_buffer{0, stream, mr},
+                           stream,
+                           mr);
+}
+
 }  // namespace detail
 
+std::unique_ptr<column> one_hot_encode_sparse(column_view const& input,
+                                              column_view const& categories,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::one_hot_encode_sparse(input, categories, rmm::cuda_stream_default, mr);
+}
+
 std::pair<std::unique_ptr<column>, table_view> one_hot_encode(column_view const& input,
                                                               column_view const& categories,
                                                               rmm::mr::device_memory_resource* mr)
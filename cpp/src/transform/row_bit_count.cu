@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,19 +17,28 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
 #include <thrust/optional.h>
+#include <thrust/scan.h>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <climits>
+#include <limits>
+
 namespace cudf {
 namespace detail {
 
@@ -397,9 +406,10 @@ __device__ size_type row_size_functor::operator()<struct_view>(column_device_vie
  * @param output Output span of size (# rows) where per-row bit sizes are stored
  * @param max_branch_depth Maximum depth of the span stack needed per-thread
  */
+template <typename SizeType>
 __global__ void compute_row_sizes(device_span<column_device_view const> cols,
                                   device_span<column_info const> info,
-                                  device_span<size_type> output,
+                                  device_span<SizeType> output,
                                   size_type max_branch_depth)
 {
   extern __shared__ row_span thread_branch_stacks[];
@@ -416,8 +426,8 @@ __global__ void compute_row_sizes(device_span<column_device_view const> cols,
   row_span cur_span{tid, tid + 1};
 
   // output size
-  size_type& size = output[tid];
-  size            = 0;
+  SizeType& size = output[tid];
+  size           = 0;
 
   size_type last_branch_depth{0};
   for (size_type idx = 0; idx < cols.size(); idx++) {
@@ -458,19 +468,18 @@ __global__ void compute_row_sizes(device_span<column_device_view const> cols,
   }
 }
 
-}  // anonymous namespace
-
 /**
- * @copydoc cudf::detail::row_bit_count
+ * @brief Computes the per-row sizes in bits of a table into `output`.
  *
+ * @param t The table to compute the row sizes of, with at least one row
+ * @param output Output span of size (# rows) where per-row bit sizes are stored
+ * @param stream CUDA stream used for device memory operations and kernel launches
  */
-std::unique_ptr<column> row_bit_count(table_view const& t,
-                                      rmm::cuda_stream_view stream,
-                                      rmm::mr::device_memory_resource* mr)
+template <typename SizeType>
+void compute_row_bit_counts(table_view const& t,
+                            device_span<SizeType> output,
+                            rmm::cuda_stream_view stream)
 {
-  // no rows
-  if (t.num_rows() <= 0) { return cudf::make_empty_column(type_id::INT32); }
-
   // flatten the hierarchy and determine some information about it.
   std::vector<cudf::column_view> cols;
   std::vector<column_info> info;
@@ -478,19 +487,14 @@ std::unique_ptr<column> row_bit_count(table_view const& t,
   flatten_hierarchy(t.begin(), t.end(), cols, info, h_info, stream);
   CUDF_EXPECTS(info.size() == cols.size(), "Size/info mismatch");
 
-  // create output buffer and view
-  auto output = cudf::make_fixed_width_column(
-    data_type{type_id::INT32}, t.num_rows(), mask_state::UNALLOCATED, stream, mr);
-  mutable_column_view mcv = output->mutable_view();
-
   // simple case.  if we have no complex types (lists, strings, etc), the per-row size is already
   // trivially computed
   if (h_info.complex_type_count <= 0) {
     thrust::fill(rmm::exec_policy(stream),
-                 mcv.begin<size_type>(),
-                 mcv.end<size_type>(),
-                 h_info.simple_per_row_size);
-    return output;
+                 output.begin(),
+                 output.end(),
+                 static_cast<SizeType>(h_info.simple_per_row_size));
+    return;
   }
 
   // create a contiguous block of column_device_views
@@ -521,12 +525,104 @@ std::unique_ptr<column> row_bit_count(table_view const& t,
   compute_row_sizes<<<grid.num_blocks, block_size, shared_mem_size, stream.value()>>>(
     {std::get<1>(d_cols), cols.size()},
     {d_info.data(), info.size()},
-    {mcv.data<size_type>(), static_cast<std::size_t>(t.num_rows())},
+    output,
     h_info.max_branch_depth);
+}
+
+/**
+ * @brief Kernel for finding the split points of the batches of rows of at most `max_bits` bits.
+ *
+ * Runs in a single thread, since each batch starts where the previous one ends. Each boundary is
+ * found with a binary search in the inclusive prefix sum of the row sizes, so the kernel only
+ * visits O(# batches * log(# rows)) elements.
+ *
+ * @param row_ends Inclusive prefix sum of the per-row sizes in bits
+ * @param max_bits Maximum size in bits of a batch
+ * @param splits Output span where the split points are stored
+ * @param num_splits Output number of split points stored in `splits`
+ */
+__global__ void find_batch_splits(device_span<int64_t const> row_ends,
+                                  int64_t max_bits,
+                                  device_span<size_type> splits,
+                                  size_type* num_splits)
+{
+  auto const num_rows = static_cast<size_type>(row_ends.size());
+  size_type count{0};
+  size_type start{0};
+  int64_t batch_base{0};
+  while (start < num_rows) {
+    auto const end_it = thrust::upper_bound(
+      thrust::seq, row_ends.begin() + start, row_ends.end(), batch_base + max_bits);
+    // a row larger than `max_bits` is a batch of its own
+    auto const end = std::max(static_cast<size_type>(end_it - row_ends.begin()), start + 1);
+    if (end < num_rows) { splits[count++] = end; }
+    batch_base = row_ends[end - 1];
+    start      = end;
+  }
+  *num_splits = count;
+}
+
+}  // anonymous namespace
+
+/**
+ * @copydoc cudf::detail::row_bit_count
+ *
+ */
+std::unique_ptr<column> row_bit_count(table_view const& t,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  // no rows
+  if (t.num_rows() <= 0) { return cudf::make_empty_column(type_id::INT32); }
+
+  // create output buffer and view
+  auto output = cudf::make_fixed_width_column(
+    data_type{type_id::INT32}, t.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  mutable_column_view mcv = output->mutable_view();
+
+  compute_row_bit_counts(
+    t,
+    device_span<size_type>{mcv.data<size_type>(), static_cast<std::size_t>(t.num_rows())},
+    stream);
 
   return output;
 }
 
+/**
+ * @copydoc cudf::detail::make_batches
+ *
+ */
+std::vector<size_type> make_batches(table_view const& t,
+                                    std::size_t max_bytes,
+                                    rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(max_bytes > 0, "The maximum batch size must be positive");
+  if (t.num_rows() <= 0) { return {}; }
+
+  // row sizes are accumulated in 64 bits so the running total of large tables doesn't overflow
+  rmm::device_uvector<int64_t> row_ends(t.num_rows(), stream);
+  compute_row_bit_counts(t, device_span<int64_t>{row_ends}, stream);
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), row_ends.begin(), row_ends.end(), row_ends.begin());
+
+  auto const total_bits = row_ends.back_element(stream);
+  auto const max_bytes_in_bits =
+    std::min<std::size_t>(max_bytes, std::numeric_limits<int64_t>::max() / CHAR_BIT);
+  auto const max_bits = static_cast<int64_t>(max_bytes_in_bits) * CHAR_BIT;
+  if (total_bits <= max_bits) { return {}; }
+
+  // any two consecutive batches are larger than `max_bits`, which bounds the number of batches
+  auto const max_batches = std::min<int64_t>(2 * util::div_rounding_up_safe(total_bits, max_bits),
+                                             t.num_rows());
+  rmm::device_uvector<size_type> splits(max_batches - 1, stream);
+  rmm::device_scalar<size_type> num_splits(stream);
+  find_batch_splits<<<1, 1, 0, stream.value()>>>(row_ends, max_bits, splits, num_splits.data());
+  CHECK_CUDA(stream.value());
+
+  splits.resize(num_splits.value(stream), stream);
+  return cudf::detail::make_std_vector_sync(splits, stream);
+}
+
 }  // namespace detail
 
 /**
@@ -538,4 +634,14 @@ std::unique_ptr<column> row_bit_count(table_view const& t, rmm::mr::device_memor
   return detail::row_bit_count(t, rmm::cuda_stream_default, mr);
 }
 
+/**
+ * @copydoc cudf::make_batches
+ *
+ */
+std::vector<size_type> make_batches(table_view const& t, std::size_t max_bytes)
+{
+  CUDF_FUNC_RANGE();
+  return detail::make_batches(t, max_bytes, rmm::cuda_stream_default);
+}
+
 }  // namespace cudf
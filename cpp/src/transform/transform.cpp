@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,13 +16,18 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <jit_preprocessed_files/transform/jit/kernel.cu.jit.hpp>
+#include <jit_preprocessed_files/transform/jit/table_kernel.cu.jit.hpp>
 
 #include <jit/cache.hpp>
 #include <jit/parser.hpp>
@@ -30,21 +35,24 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace transformation {
 namespace jit {
 
-void unary_operation(mutable_column_view output,
-                     column_view input,
-                     const std::string& udf,
-                     data_type output_type,
-                     bool is_ptx,
-                     rmm::cuda_stream_view stream)
+auto get_unary_operation_kernel(data_type output_type,
+                                data_type input_type,
+                                std::string const& udf,
+                                bool is_ptx)
 {
   std::string kernel_name =
     jitify2::reflection::Template("cudf::transformation::jit::kernel")  //
-      .instantiate(cudf::jit::get_type_name(output.type()),  // list of template arguments
-                   cudf::jit::get_type_name(input.type()));
+      .instantiate(cudf::jit::get_type_name(output_type),  // list of template arguments
+                   cudf::jit::get_type_name(input_type));
 
   std::string cuda_source =
     is_ptx ? cudf::jit::parse_single_function_ptx(udf,  //
@@ -54,15 +62,94 @@ void unary_operation(mutable_column_view output,
            : cudf::jit::parse_single_function_cuda(udf,  //
                                                    "GENERIC_UNARY_OP");
 
-  cudf::jit::get_program_cache(*transform_jit_kernel_cu_jit)
+  return cudf::jit::get_program_cache(*transform_jit_kernel_cu_jit)
     .get_kernel(
-      kernel_name, {}, {{"transform/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})  //
-    ->configure_1d_max_occupancy(0, 0, 0, stream.value())                                   //
-    ->launch(output.size(),                                                                 //
+      kernel_name, {}, {{"transform/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."});
+}
+
+void unary_operation(mutable_column_view output,
+                     column_view input,
+                     const std::string& udf,
+                     data_type output_type,
+                     bool is_ptx,
+                     rmm::cuda_stream_view stream)
+{
+  get_unary_operation_kernel(output_type, input.type(), udf, is_ptx)  //
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())             //
+    ->launch(output.size(),                                           //
              cudf::jit::get_data_ptr(output),
              cudf::jit::get_data_ptr(input));
 }
 
+/**
+ * @brief Generates the source of `GENERIC_TABLE_OP`, which calls the UDF on row `i` of the
+ * output and input columns.
+ */
+std::string table_operation_source(std::vector<data_type> const& output_types,
+                                   std::vector<data_type> const& input_types,
+                                   std::string const& udf,
+                                   bool is_ptx)
+{
+  // the PTX parser types the first pointer argument, and the others are opaque addresses
+  std::set<int> output_pointer_args;
+  for (int o = 0; o < static_cast<int>(output_types.size()); ++o) {
+    output_pointer_args.insert(o);
+  }
+  std::string source =
+    is_ptx ? cudf::jit::parse_single_function_ptx(udf,  //
+                                                  "GENERIC_TABLE_UDF",
+                                                  cudf::jit::get_type_name(output_types[0]),
+                                                  output_pointer_args)
+           : cudf::jit::parse_single_function_cuda(udf,  //
+                                                   "GENERIC_TABLE_UDF");
+
+  source += "\n__device__ inline void GENERIC_TABLE_OP(cudf::size_type i, void* const* outputs, ";
+  source += "void const* const* inputs)\n{\n  GENERIC_TABLE_UDF(";
+  std::string separator;
+  for (std::size_t o = 0; o < output_types.size(); ++o) {
+    source += separator + "static_cast<" + cudf::jit::get_type_name(output_types[o]) +
+              "*>(outputs[" + std::to_string(o) + "]) + i";
+    separator = ", ";
+  }
+  for (std::size_t c = 0; c < input_types.size(); ++c) {
+    source += separator + "static_cast<" + cudf::jit::get_type_name(input_types[c]) +
+              " const*>(inputs[" + std::to_string(c) + "])[i]";
+  }
+  return source + ");\n}\n";
+}
+
+void table_operation(mutable_table_view output,
+                     table_view input,
+                     std::string const& udf,
+                     bool is_ptx,
+                     bitmask_type const* valid,
+                     rmm::cuda_stream_view stream)
+{
+  std::vector<data_type> output_types;
+  std::vector<void*> outputs;
+  for (auto const& column : output) {
+    output_types.push_back(column.type());
+    outputs.push_back(const_cast<void*>(cudf::jit::get_data_ptr(column)));
+  }
+  std::vector<data_type> input_types;
+  std::vector<void const*> inputs;
+  for (auto const& column : input) {
+    input_types.push_back(column.type());
+    inputs.push_back(cudf::jit::get_data_ptr(column));
+  }
+  auto const d_outputs = cudf::detail::make_device_uvector_async(outputs, stream);
+  auto const d_inputs  = cudf::detail::make_device_uvector_async(inputs, stream);
+
+  auto const source = table_operation_source(output_types, input_types, udf, is_ptx);
+  cudf::jit::get_program_cache(*transform_jit_table_kernel_cu_jit)
+    .get_kernel("cudf::transformation::jit::table_kernel",
+                {},
+                {{"transform/jit/table-udf.hpp", source}},
+                {"-arch=sm_."})                            //
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
+    ->launch(input.num_rows(), d_outputs.data(), d_inputs.data(), valid);
+}
+
 }  // namespace jit
 }  // namespace transformation
 
@@ -89,6 +176,65 @@ std::unique_ptr<column> transform(column_view const& input,
   return output;
 }
 
+std::unique_ptr<table> transform(table_view const& input,
+                                 std::string const& udf,
+                                 std::vector<data_type> const& output_types,
+                                 bool is_ptx,
+                                 bool propagate_nulls,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(!output_types.empty(), "The UDF must have at least one output.");
+  CUDF_EXPECTS(std::all_of(input.begin(),
+                           input.end(),
+                           [](auto const& column) { return is_fixed_width(column.type()); }),
+               "Unexpected non-fixed-width type.");
+  CUDF_EXPECTS(std::all_of(output_types.begin(),
+                           output_types.end(),
+                           [](auto const& type) { return is_fixed_width(type); }),
+               "Unexpected non-fixed-width type.");
+
+  auto const propagated_nulls = propagate_nulls && has_nulls(input);
+  auto const [null_mask, null_count] =
+    propagated_nulls ? cudf::detail::bitmask_and(input, stream)
+                     : std::pair<rmm::device_buffer, size_type>{rmm::device_buffer{}, 0};
+
+  std::vector<std::unique_ptr<column>> outputs;
+  for (auto const& output_type : output_types) {
+    outputs.push_back(make_fixed_width_column(output_type,
+                                              input.num_rows(),
+                                              rmm::device_buffer{null_mask, stream, mr},
+                                              null_count,
+                                              stream,
+                                              mr));
+  }
+  auto output = std::make_unique<table>(std::move(outputs));
+
+  if (input.num_rows() == 0) { return output; }
+
+  // the rows with a null input are skipped, so that the UDF only sees valid values
+  transformation::jit::table_operation(
+    output->mutable_view(),
+    input,
+    udf,
+    is_ptx,
+    propagated_nulls ? static_cast<bitmask_type const*>(null_mask.data()) : nullptr,
+    stream);
+
+  return output;
+}
+
+void precompile_transform(std::string const& unary_udf,
+                          data_type input_type,
+                          data_type output_type,
+                          bool is_ptx)
+{
+  CUDF_EXPECTS(is_fixed_width(input_type), "Unexpected non-fixed-width type.");
+  // configuring the kernel loads it, or throws if it did not compile
+  transformation::jit::get_unary_operation_kernel(output_type, input_type, unary_udf, is_ptx)
+    ->configure_1d_max_occupancy(0, 0, 0, rmm::cuda_stream_default.value());
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> transform(column_view const& input,
@@ -101,4 +247,16 @@ std::unique_ptr<column> transform(column_view const& input,
   return detail::transform(input, unary_udf, output_type, is_ptx, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<table> transform(table_view const& input,
+                                 std::string const& udf,
+                                 std::vector<data_type> const& output_types,
+                                 bool is_ptx,
+                                 bool propagate_nulls,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::transform(
+    input, udf, output_types, is_ptx, propagate_nulls, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
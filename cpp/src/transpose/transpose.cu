@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -13,21 +13,286 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/reshape.hpp>
 #include <cudf/detail/transpose.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/detail/utilities.hpp>
+#include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/transpose.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <algorithm>
+#include <limits>
 
 namespace cudf {
 namespace detail {
+namespace {
+
+// A warp loads or stores one row of a tile, so that both the reads of the input columns and the
+// writes of the transposed rows are coalesced
+constexpr size_type tile_dim   = detail::warp_size;
+constexpr size_type block_rows = 8;
+
+/**
+ * @brief Reads the elements of a fixed-width column as the unsigned integers of their size.
+ */
+template <typename T>
+struct fixed_width_element_fn {
+  __device__ T operator()(column_device_view const& column, size_type row) const
+  {
+    return static_cast<T const*>(column.head())[column.offset() + row];
+  }
+};
+
+/**
+ * @brief Reads the sizes in bytes of the strings of a strings column, 0 for the nulls.
+ */
+struct string_size_fn {
+  __device__ size_type operator()(column_device_view const& column, size_type row) const
+  {
+    if (column.is_null(row)) { return 0; }
+    auto const d_offsets =
+      column.child(strings_column_view::offsets_column_index).data<offset_type>() +
+      column.offset();
+    return d_offsets[row + 1] - d_offsets[row];
+  }
+};
+
+/**
+ * @brief Sets the bits of a tile row in a null mask.
+ *
+ * The bits start at `begin`, which may be unaligned, so they may span two words. Other tiles
+ * write the neighbouring bits of the same words concurrently, hence the atomics.
+ */
+__device__ void set_tile_bits(bitmask_type* mask, size_type begin, bitmask_type bits)
+{
+  if (bits == 0) { return; }
+  auto const word  = word_index(begin);
+  auto const shift = intra_word_index(begin);
+  atomicOr(mask + word, bits << shift);
+  if (shift != 0) {
+    auto const high_bits = bits >> (detail::size_in_bits<bitmask_type>() - shift);
+    if (high_bits != 0) { atomicOr(mask + word + 1, high_bits); }
+  }
+}
+
+/**
+ * @brief Transposes the elements read by `element_fn` from the columns of `input` into the
+ * row-major `output`, through tiles of `tile_dim x tile_dim` elements in shared memory.
+ *
+ * Blocks cover `tile_dim` rows of the input and stride over its columns. The validity of the
+ * elements is transposed along with them, and each warp sets the output bits of its tile row at
+ * once.
+ *
+ * @param input The columns to transpose
+ * @param element_fn Reads the element of a row of a column
+ * @param output The transposed elements, `input.num_columns()` per input row
+ * @param output_mask The transposed null mask, initialized to all nulls
+ * @param valid_count Incremented by the number of valid elements
+ */
+template <typename T, bool has_nulls, typename ElementFn>
+__global__ void transpose_tiles_kernel(table_device_view input,
+                                       ElementFn element_fn,
+                                       T* output,
+                                       bitmask_type* output_mask,
+                                       size_type* valid_count)
+{
+  // Padded so that reading a column of a tile is free of bank conflicts
+  __shared__ T tile[tile_dim][tile_dim + 1];
+  __shared__ bool tile_valid[tile_dim][tile_dim + 1];
+
+  auto const num_rows    = input.num_rows();
+  auto const num_columns = input.num_columns();
+  auto const tx          = static_cast<size_type>(threadIdx.x);
+  auto const ty          = static_cast<size_type>(threadIdx.y);
+  auto const row_begin   = static_cast<size_type>(blockIdx.x) * tile_dim;
+
+  for (auto column_begin = static_cast<size_type>(blockIdx.y) * tile_dim;
+       column_begin < num_columns;
+       column_begin += static_cast<size_type>(gridDim.y) * tile_dim) {
+    // Each warp reads consecutive rows of an input column
+    for (auto i = ty; i < tile_dim; i += block_rows) {
+      auto const col = column_begin + i;
+      auto const row = row_begin + tx;
+      if (col < num_columns && row < num_rows) {
+        auto const& column = input.column(col);
+        tile[i][tx]        = element_fn(column, row);
+        if constexpr (has_nulls) { tile_valid[i][tx] = column.is_valid(row); }
+      }
+    }
+    __syncthreads();
+
+    // Each warp writes consecutive elements of an output row
+    for (auto i = ty; i < tile_dim; i += block_rows) {
+      auto const row       = row_begin + i;
+      auto const col       = column_begin + tx;
+      auto const in_bounds = row < num_rows && col < num_columns;
+      if (in_bounds) { output[row * num_columns + col] = tile[tx][i]; }
+      if constexpr (has_nulls) {
+        auto const valid_bits = __ballot_sync(0xffff'ffffu, in_bounds && tile_valid[tx][i]);
+        if (tx == 0 && row < num_rows) {
+          set_tile_bits(output_mask, row * num_columns + column_begin, valid_bits);
+          atomicAdd(valid_count, __popc(valid_bits));
+        }
+      }
+    }
+    // The tile is reloaded by the next iteration
+    __syncthreads();
+  }
+}
+
+/**
+ * @brief Transposes the elements read by `element_fn` from the columns of `input` into `output`.
+ *
+ * @return The transposed null mask and null count, an empty mask if `has_nulls` is false
+ */
+template <typename T, typename ElementFn>
+std::pair<rmm::device_buffer, size_type> transpose_tiles(table_view const& input,
+                                                         ElementFn element_fn,
+                                                         T* output,
+                                                         bool has_nulls,
+                                                         rmm::cuda_stream_view stream,
+                                                         rmm::mr::device_memory_resource* mr)
+{
+  auto const d_input     = table_device_view::create(input, stream);
+  auto const output_size = input.num_rows() * input.num_columns();
+
+  dim3 const block(tile_dim, block_rows);
+  dim3 const grid(util::div_rounding_up_safe(input.num_rows(), tile_dim),
+                  std::min(util::div_rounding_up_safe(input.num_columns(), tile_dim),
+                           static_cast<size_type>(std::numeric_limits<uint16_t>::max())));
+
+  if (!has_nulls) {
+    transpose_tiles_kernel<T, false><<<grid, block, 0, stream.value()>>>(
+      *d_input, element_fn, output, nullptr, nullptr);
+    CHECK_CUDA(stream.value());
+    return {rmm::device_buffer{0, stream, mr}, 0};
+  }
+
+  auto null_mask = create_null_mask(output_size, mask_state::ALL_NULL, stream, mr);
+  rmm::device_scalar<size_type> valid_count(0, stream);
+  transpose_tiles_kernel<T, true>
+    <<<grid, block, 0, stream.value()>>>(*d_input,
+                                         element_fn,
+                                         output,
+                                         static_cast<bitmask_type*>(null_mask.data()),
+                                         valid_count.data());
+  CHECK_CUDA(stream.value());
+  return {std::move(null_mask), output_size - valid_count.value(stream)};
+}
+
+template <typename T>
+std::unique_ptr<column> transpose_fixed_width(table_view const& input,
+                                              bool has_nulls,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  auto output = make_fixed_width_column(input.column(0).type(),
+                                        input.num_rows() * input.num_columns(),
+                                        mask_state::UNALLOCATED,
+                                        stream,
+                                        mr);
+  auto [null_mask, null_count] = transpose_tiles(input,
+                                                 fixed_width_element_fn<T>{},
+                                                 static_cast<T*>(output->mutable_view().head()),
+                                                 has_nulls,
+                                                 stream,
+                                                 mr);
+  if (has_nulls) { output->set_null_mask(std::move(null_mask), null_count); }
+  return output;
+}
+
+/**
+ * @brief Transposes fixed-width columns, moving their elements as integers of the same size so
+ * that only one kernel is instantiated per element size.
+ */
+std::unique_ptr<column> transpose_fixed_width(table_view const& input,
+                                              bool has_nulls,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  switch (size_of(input.column(0).type())) {
+    case 1: return transpose_fixed_width<uint8_t>(input, has_nulls, stream, mr);
+    case 2: return transpose_fixed_width<uint16_t>(input, has_nulls, stream, mr);
+    case 4: return transpose_fixed_width<uint32_t>(input, has_nulls, stream, mr);
+    case 8: return transpose_fixed_width<uint64_t>(input, has_nulls, stream, mr);
+    case 16: return transpose_fixed_width<__int128_t>(input, has_nulls, stream, mr);
+    default: CUDF_FAIL("Unsupported element size");
+  }
+}
+
+/**
+ * @brief Transposes strings columns.
+ *
+ * The sizes of the strings are transposed by the tiled kernel, along with the null mask, and
+ * scanned into the output offsets. The chars of each output string are then copied from its
+ * input string.
+ */
+std::unique_ptr<column> transpose_strings(table_view const& input,
+                                          bool has_nulls,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  auto const num_columns = input.num_columns();
+  auto const num_strings = input.num_rows() * num_columns;
+
+  rmm::device_uvector<size_type> sizes(num_strings, stream);
+  auto [null_mask, null_count] =
+    transpose_tiles(input, string_size_fn{}, sizes.data(), has_nulls, stream, mr);
+
+  auto offsets_column =
+    strings::detail::make_offsets_child_column(sizes.begin(), sizes.end(), stream, mr);
+  auto const d_offsets = offsets_column->view().data<offset_type>();
+  auto const bytes     = get_value<offset_type>(offsets_column->view(), num_strings, stream);
+  auto chars_column    = strings::detail::create_chars_child_column(bytes, stream, mr);
+
+  auto const d_input = table_device_view::create(input, stream);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_strings,
+    [d_input = *d_input,
+     num_columns,
+     d_offsets,
+     d_chars = chars_column->mutable_view().data<char>()] __device__(size_type idx) {
+      auto const& column = d_input.column(idx % num_columns);
+      auto const row     = idx / num_columns;
+      if (column.is_null(row)) { return; }
+      auto const d_str = column.element<string_view>(row);
+      memcpy(d_chars + d_offsets[idx], d_str.data(), d_str.size_bytes());
+    });
+
+  return make_strings_column(num_strings,
+                             std::move(offsets_column),
+                             std::move(chars_column),
+                             null_count,
+                             std::move(null_mask));
+}
+
+}  // namespace
+
 std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input,
                                                          rmm::cuda_stream_view stream,
                                                          rmm::mr::device_memory_resource* mr)
@@ -43,8 +308,18 @@ std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input
     std::all_of(
       input.begin(), input.end(), [dtype](auto const& col) { return dtype == col.type(); }),
     "Column type mismatch");
+  CUDF_EXPECTS(static_cast<std::size_t>(input.num_rows()) * input.num_columns() <=
+                 static_cast<std::size_t>(std::numeric_limits<size_type>::max()),
+               "Size of the transposed table exceeds the column size limit");
+
+  auto const has_nulls = std::any_of(
+    input.begin(), input.end(), [](auto const& col) { return col.nullable(); });
 
-  auto output_column = cudf::detail::interleave_columns(input, stream, mr);
+  // Nested columns are interleaved element by element
+  auto output_column = is_fixed_width(dtype) ? transpose_fixed_width(input, has_nulls, stream, mr)
+                       : dtype.id() == type_id::STRING
+                         ? transpose_strings(input, has_nulls, stream, mr)
+                         : interleave_columns(input, stream, mr);
   auto one_iter      = thrust::make_counting_iterator<size_type>(1);
   auto splits_iter   = thrust::make_transform_iterator(
     one_iter, [width = input.num_columns()](size_type idx) { return idx * width; });
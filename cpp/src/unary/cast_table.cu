@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file cast_table.cu
+ * @brief Table-level cast, converting all the columns of a table with the same input and output
+ * types with one kernel launch that also computes the validity of the converted elements.
+ */
+
+#include <strings/convert/utilities.cuh>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/fixed_point/fixed_point.hpp>
+#include <cudf/strings/detail/convert/fixed_point.cuh>
+#include <cudf/strings/string.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/unary.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/fill.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+constexpr size_type block_size = 256;
+
+/**
+ * @brief Parameters of the batched cast of a column.
+ */
+struct cast_batch {
+  void const* input;           ///< Elements of a fixed-width input, from its offset
+  offset_type const* offsets;  ///< Offsets of a strings input, from its offset
+  char const* chars;           ///< Characters of a strings input
+  bitmask_type const* input_mask;
+  size_type offset;
+  void* output;
+  bitmask_type* output_mask;
+  int32_t scale;  ///< Scale of a fixed-point output
+  size_type* valid_count;
+  size_type* error_count;
+};
+
+/**
+ * @brief Returns whether a cast from `Source` to `Target` is done by the batched kernels.
+ */
+template <typename Source, typename Target>
+constexpr bool is_batched_cast()
+{
+  constexpr bool is_number = is_numeric<Target>() and not is_boolean<Target>();
+  if constexpr (std::is_same_v<Source, string_view>) {
+    return is_number or is_fixed_point<Target>();
+  } else {
+    return is_number and is_numeric<Source>() and not is_boolean<Source>();
+  }
+}
+
+/**
+ * @brief Parses a string as a number, returning false if it is not a number of type `Target`.
+ */
+template <typename Target>
+__device__ bool parse_element(string_view const& d_str,
+                              int32_t scale,
+                              device_storage_type_t<Target>& value)
+{
+  if constexpr (std::is_integral_v<Target>) {
+    return strings::detail::string_to_integer_checked(d_str, value);
+  } else if constexpr (std::is_floating_point_v<Target>) {
+    if (not strings::string::is_float(d_str)) { return false; }
+    value = static_cast<Target>(strings::detail::stod(d_str));
+    return true;
+  } else {
+    using DecimalType = device_storage_type_t<Target>;
+    auto const begin  = d_str.data();
+    auto const end    = begin + d_str.size_bytes();
+    if (not strings::detail::is_parsable_decimal<DecimalType>(begin, end, scale)) { return false; }
+    value = strings::detail::parse_decimal<DecimalType>(begin, end, scale);
+    return true;
+  }
+}
+
+/**
+ * @brief Converts a number to another type, returning false if it is out of range of `Target`.
+ *
+ * Floating-point numbers are converted to integers if their truncated values are in range, while
+ * doubles are converted to floats if they are not finite or do not overflow once rounded.
+ */
+template <typename Target, typename Source>
+__device__ bool convert_element(Source element, Target& value)
+{
+  if constexpr (std::is_integral_v<Target> and std::is_floating_point_v<Source>) {
+    // The bounds are powers of two, exactly represented in floating-point
+    constexpr auto upper = static_cast<Source>(std::numeric_limits<Target>::max() / 2 + 1) * 2;
+    constexpr auto lower = std::is_signed_v<Target> ? -upper : Source{0};
+    auto const whole     = std::trunc(element);
+    if (not(whole >= lower and whole < upper)) { return false; }
+  } else if constexpr (std::is_integral_v<Target>) {
+    auto const wide = static_cast<__int128_t>(element);
+    if (wide < static_cast<__int128_t>(std::numeric_limits<Target>::lowest()) or
+        wide > static_cast<__int128_t>(std::numeric_limits<Target>::max())) {
+      return false;
+    }
+  } else if constexpr (sizeof(Target) < sizeof(Source) and std::is_floating_point_v<Source>) {
+    if (std::isfinite(element) and
+        std::abs(element) > static_cast<Source>(std::numeric_limits<Target>::max())) {
+      return false;
+    }
+  }
+  value = static_cast<Target>(element);
+  return true;
+}
+
+/**
+ * @brief Casts the columns of a batch, computing the output null masks with warp ballots.
+ *
+ * The blocks stride over the rows of a column along x, and over the columns of the batch along y.
+ * An output element is valid if the input element is, and if it could be converted when
+ * `nullify` is set. The valid and the unconverted elements of each column are counted.
+ */
+template <typename Source, typename Target>
+__global__ void cast_batch_kernel(device_span<cast_batch const> batch,
+                                  size_type num_rows,
+                                  bool nullify)
+{
+  using OutputType = device_storage_type_t<Target>;
+  auto const lane  = static_cast<size_type>(threadIdx.x % warp_size);
+  for (auto c = static_cast<std::size_t>(blockIdx.y); c < batch.size(); c += gridDim.y) {
+    auto const column     = batch[c];
+    size_type valid_count = 0;
+    size_type error_count = 0;
+    // The rows of a warp are those of an output mask word, so the warps loop over whole words
+    for (size_type i = blockIdx.x * blockDim.x + threadIdx.x; i - lane < num_rows;
+         i += blockDim.x * gridDim.x) {
+      bool valid = false;
+      if (i < num_rows) {
+        OutputType value{};
+        if (column.input_mask == nullptr or bit_is_set(column.input_mask, column.offset + i)) {
+          bool converted = false;
+          if constexpr (std::is_same_v<Source, string_view>) {
+            auto const begin = column.offsets[i];
+            auto const d_str = string_view(column.chars + begin, column.offsets[i + 1] - begin);
+            converted        = parse_element<Target>(d_str, column.scale, value);
+          } else {
+            converted = convert_element(static_cast<Source const*>(column.input)[i], value);
+          }
+          error_count += static_cast<size_type>(not converted);
+          valid = converted or not nullify;
+        }
+        static_cast<OutputType*>(column.output)[i] = value;
+      }
+      auto const word = __ballot_sync(0xffff'ffffu, valid);
+      if (lane == 0) {
+        column.output_mask[word_index(i)] = word;
+        valid_count += __popc(word);
+      }
+    }
+    if (valid_count > 0) { atomicAdd(column.valid_count, valid_count); }
+    if (error_count > 0) { atomicAdd(column.error_count, error_count); }
+  }
+}
+
+/**
+ * @brief Casts the columns of a table with the same input type to the same output type.
+ */
+struct cast_batched_fn {
+  template <typename Source, typename Target>
+  std::enable_if_t<is_batched_cast<Source, Target>()> operator()(
+    table_view const& input,
+    std::vector<size_type> const& indices,
+    std::vector<data_type> const& out_types,
+    cast_error_policy error_policy,
+    size_type* counts,
+    std::vector<std::unique_ptr<column>>& output,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr)
+  {
+    std::vector<cast_batch> h_batch;
+    h_batch.reserve(indices.size());
+    for (auto const i : indices) {
+      auto const& column = input.column(i);
+      output[i] = make_fixed_width_column(
+        out_types[i], column.size(), mask_state::UNINITIALIZED, stream, mr);
+      cast_batch params{nullptr,
+                        nullptr,
+                        nullptr,
+                        column.null_mask(),
+                        column.offset(),
+                        output[i]->mutable_view().head(),
+                        output[i]->mutable_view().null_mask(),
+                        out_types[i].scale(),
+                        counts + 2 * i,
+                        counts + 2 * i + 1};
+      if constexpr (std::is_same_v<Source, string_view>) {
+        auto const strings = strings_column_view(column);
+        params.offsets     = strings.offsets_begin();
+        params.chars       = strings.chars_begin();
+      } else {
+        params.input = column.data<Source>();
+      }
+      h_batch.push_back(params);
+    }
+
+    auto const d_batch  = make_device_uvector_async(h_batch, stream);
+    auto const num_rows = input.num_rows();
+    auto const grid =
+      dim3(grid_1d(num_rows, block_size).num_blocks,
+           std::min<std::size_t>(d_batch.size(), std::numeric_limits<uint16_t>::max()));
+    cast_batch_kernel<Source, Target><<<grid, block_size, 0, stream.value()>>>(
+      d_batch, num_rows, error_policy == cast_error_policy::NULLIFY);
+    CHECK_CUDA(stream.value());
+  }
+
+  template <typename Source, typename Target, typename... Args>
+  std::enable_if_t<not is_batched_cast<Source, Target>()> operator()(Args&&...)
+  {
+    CUDF_FAIL("Unsupported batched cast");
+  }
+};
+
+/**
+ * @brief Returns whether the cast from a type to another is done by the batched kernels.
+ */
+struct is_batched_cast_fn {
+  template <typename Source, typename Target>
+  bool operator()()
+  {
+    return is_batched_cast<Source, Target>();
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<table> cast(table_view const& input,
+                            std::vector<data_type> const& out_types,
+                            cast_error_policy error_policy,
+                            rmm::cuda_stream_view stream,
+                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(static_cast<std::size_t>(input.num_columns()) == out_types.size(),
+               "Number of output types must match the number of columns");
+
+  std::vector<std::unique_ptr<column>> output(input.num_columns());
+  if (input.num_rows() == 0) {
+    std::transform(out_types.begin(), out_types.end(), output.begin(), [](auto type) {
+      return make_empty_column(type);
+    });
+    return std::make_unique<table>(std::move(output));
+  }
+
+  // Group the columns by their input and output types
+  std::vector<std::pair<std::pair<data_type, data_type>, std::vector<size_type>>> groups;
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const key = std::pair{input.column(i).type(), out_types[i]};
+    if (not double_type_dispatcher(key.first, key.second, is_batched_cast_fn{})) { continue; }
+    auto group = std::find_if(
+      groups.begin(), groups.end(), [&key](auto const& g) { return g.first == key; });
+    if (group == groups.end()) {
+      groups.emplace_back(key, std::vector<size_type>{i});
+    } else {
+      group->second.push_back(i);
+    }
+  }
+
+  // The valid and unconverted elements of each column, all copied to the host at once
+  rmm::device_uvector<size_type> counts(2 * input.num_columns(), stream);
+  thrust::fill(rmm::exec_policy(stream), counts.begin(), counts.end(), 0);
+  for (auto const& [types, indices] : groups) {
+    double_type_dispatcher(types.first,
+                           types.second,
+                           cast_batched_fn{},
+                           input,
+                           indices,
+                           out_types,
+                           error_policy,
+                           counts.data(),
+                           output,
+                           stream,
+                           mr);
+  }
+
+  if (not groups.empty()) {
+    auto const h_counts = make_std_vector_sync(counts, stream);
+    for (size_type i = 0; i < input.num_columns(); ++i) {
+      if (output[i] == nullptr) { continue; }
+      CUDF_EXPECTS(error_policy == cast_error_policy::NULLIFY or h_counts[2 * i + 1] == 0,
+                   "Some elements cannot be converted to the output type");
+      auto const null_count = input.num_rows() - h_counts[2 * i];
+      if (null_count == 0 and not input.column(i).nullable()) {
+        output[i]->set_null_mask(rmm::device_buffer{0, stream, mr}, 0);
+      } else {
+        output[i]->set_null_count(null_count);
+      }
+    }
+  }
+
+  // The other columns are cast one by one
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    if (output[i] == nullptr) { output[i] = cast(input.column(i), out_types[i], stream, mr); }
+  }
+  return std::make_unique<table>(std::move(output));
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> cast(table_view const& input,
+                            std::vector<data_type> const& out_types,
+                            cast_error_policy error_policy,
+                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::cast(input, out_types, error_policy, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/batched_memcpy.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/scan.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// buffers of at most this many bytes are copied by a single warp
+constexpr std::size_t small_buffer_size = 4 * 1024;
+// larger buffers are split into tiles of this many bytes, each copied by a block
+constexpr std::size_t tile_size     = 64 * 1024;
+constexpr size_type block_size      = 256;
+constexpr size_type warps_per_block = block_size / warp_size;
+
+/**
+ * @brief Copy `size` bytes with `Vector` loads and stores, and the bytes before the first and
+ * after the last aligned vectors one by one.
+ *
+ * The source and destination must be equally misaligned for `Vector`.
+ */
+template <typename Vector>
+__device__ void copy_vectorized(
+  uint8_t* dst, uint8_t const* src, std::size_t size, std::size_t thread, std::size_t num_threads)
+{
+  auto const misalignment = reinterpret_cast<std::uintptr_t>(dst) % sizeof(Vector);
+  auto const head =
+    thrust::min(size, static_cast<std::size_t>((sizeof(Vector) - misalignment) % sizeof(Vector)));
+  auto const num_vectors = (size - head) / sizeof(Vector);
+  auto const tail        = head + num_vectors * sizeof(Vector);
+
+  for (auto i = thread; i < head; i += num_threads) {
+    dst[i] = src[i];
+  }
+  auto const dst_vectors = reinterpret_cast<Vector*>(dst + head);
+  auto const src_vectors = reinterpret_cast<Vector const*>(src + head);
+  for (auto i = thread; i < num_vectors; i += num_threads) {
+    dst_vectors[i] = src_vectors[i];
+  }
+  for (auto i = tail + thread; i < size; i += num_threads) {
+    dst[i] = src[i];
+  }
+}
+
+/**
+ * @brief Copy `size` bytes with `num_threads` threads, using the widest loads and stores that the
+ * relative alignment of the source and destination permits.
+ */
+__device__ void copy_bytes(
+  uint8_t* dst, uint8_t const* src, std::size_t size, std::size_t thread, std::size_t num_threads)
+{
+  auto const dst_address = reinterpret_cast<std::uintptr_t>(dst);
+  auto const src_address = reinterpret_cast<std::uintptr_t>(src);
+  if (dst_address % sizeof(uint4) == src_address % sizeof(uint4)) {
+    copy_vectorized<uint4>(dst, src, size, thread, num_threads);
+  } else if (dst_address % sizeof(uint32_t) == src_address % sizeof(uint32_t)) {
+    copy_vectorized<uint32_t>(dst, src, size, thread, num_threads);
+  } else {
+    copy_vectorized<uint8_t>(dst, src, size, thread, num_threads);
+  }
+}
+
+/**
+ * @brief Kernel copying each small buffer with a single warp.
+ */
+__global__ void copy_small_buffers(uint8_t* const* dst_bufs,
+                                   uint8_t const* const* src_bufs,
+                                   std::size_t const* buf_sizes,
+                                   size_type num_bufs)
+{
+  auto const buf_index =
+    static_cast<size_type>(blockIdx.x) * warps_per_block + threadIdx.x / warp_size;
+  if (buf_index >= num_bufs) { return; }
+  auto const size = buf_sizes[buf_index];
+  if (size > small_buffer_size) { return; }
+  copy_bytes(dst_bufs[buf_index], src_bufs[buf_index], size, threadIdx.x % warp_size, warp_size);
+}
+
+/**
+ * @brief Kernel copying each tile of the large buffers with a block.
+ *
+ * Since the tiles start at multiples of `tile_size` in their buffer, the relative alignment of the
+ * source and destination of a tile is that of its buffer.
+ */
+__global__ void copy_large_buffers(uint8_t* const* dst_bufs,
+                                   uint8_t const* const* src_bufs,
+                                   std::size_t const* buf_sizes,
+                                   std::size_t const* tile_offsets,
+                                   size_type num_bufs)
+{
+  std::size_t const tile = blockIdx.x;
+  auto const buf_index   = static_cast<size_type>(
+    thrust::upper_bound(thrust::seq, tile_offsets, tile_offsets + num_bufs + 1, tile) -
+    tile_offsets - 1);
+  auto const begin = (tile - tile_offsets[buf_index]) * tile_size;
+  auto const size  = thrust::min(tile_size, buf_sizes[buf_index] - begin);
+  copy_bytes(
+    dst_bufs[buf_index] + begin, src_bufs[buf_index] + begin, size, threadIdx.x, blockDim.x);
+}
+
+}  // namespace
+
+void batched_memcpy(device_span<uint8_t* const> dst_bufs,
+                    device_span<uint8_t const* const> src_bufs,
+                    device_span<std::size_t const> buf_sizes,
+                    rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(dst_bufs.size() == src_bufs.size() && src_bufs.size() == buf_sizes.size(),
+               "The numbers of destination buffers, source buffers and sizes must match");
+  auto const num_bufs = static_cast<size_type>(buf_sizes.size());
+  if (num_bufs == 0) { return; }
+
+  auto const num_small_blocks = util::div_rounding_up_safe(num_bufs, warps_per_block);
+  copy_small_buffers<<<num_small_blocks, block_size, 0, stream.value()>>>(
+    dst_bufs.data(), src_bufs.data(), buf_sizes.data(), num_bufs);
+
+  // the tiles of the large buffers
+  rmm::device_uvector<std::size_t> tile_offsets(num_bufs + 1, stream);
+  auto const num_buf_tiles = cudf::detail::make_counting_transform_iterator(
+    0, [buf_sizes = buf_sizes.data(), num_bufs] __device__(size_type i) -> std::size_t {
+      if (i == num_bufs or buf_sizes[i] <= small_buffer_size) { return 0; }
+      return util::div_rounding_up_unsafe(buf_sizes[i], tile_size);
+    });
+  thrust::exclusive_scan(rmm::exec_policy(stream),
+                         num_buf_tiles,
+                         num_buf_tiles + num_bufs + 1,
+                         tile_offsets.begin(),
+                         std::size_t{0});
+  auto const num_tiles = tile_offsets.back_element(stream);
+  if (num_tiles == 0) { return; }
+  copy_large_buffers<<<num_tiles, block_size, 0, stream.value()>>>(
+    dst_bufs.data(), src_bufs.data(), buf_sizes.data(), tile_offsets.data(), num_bufs);
+}
+
+}  // namespace detail
+}  // namespace cudf
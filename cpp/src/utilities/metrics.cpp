@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/metrics.hpp>
+#include <cudf/detail/utilities/stream_capture.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cudf {
+namespace metrics {
+namespace {
+
+// Number of timings left pending before the completed ones are collected without a snapshot
+constexpr std::size_t max_pending_timings = 1024;
+
+struct accumulator {
+  std::size_t calls{0};
+  std::size_t timed_calls{0};
+  double gpu_time_ms{0};
+  int64_t bytes{0};
+  std::size_t peak_temporary_bytes{0};
+};
+
+struct pending_timing {
+  accumulator* acc;
+  int device;
+  cudaEvent_t start;
+  cudaEvent_t stop;
+};
+
+struct registry {
+  std::mutex mutex;
+  std::map<std::string, accumulator, std::less<>> apis;
+  std::vector<pending_timing> pending;
+  std::map<int, std::vector<cudaEvent_t>> free_events;
+};
+
+// Never destroyed, so that no event is destroyed after the CUDA runtime is torn down at exit
+registry& get_registry()
+{
+  static auto* const r = new registry{};
+  return *r;
+}
+
+std::atomic<bool>& enabled_flag()
+{
+  static std::atomic<bool> flag{[] {
+    auto const env_val = std::getenv("LIBCUDF_METRICS");
+    return env_val != nullptr and std::string{env_val} != "0";
+  }()};
+  return flag;
+}
+
+// Outermost API scope active on the thread
+thread_local detail::scope* current_api = nullptr;
+
+bool acquire_event(registry& r, int device, cudaEvent_t& event)
+{
+  auto& events = r.free_events[device];
+  if (!events.empty()) {
+    event = events.back();
+    events.pop_back();
+    return true;
+  }
+  if (cudaEventCreate(&event) == cudaSuccess) { return true; }
+  // metrics must not fail the call, nor leave an error to be reported by the next check
+  cudaGetLastError();
+  return false;
+}
+
+void release_events(registry& r, int device, cudaEvent_t start, cudaEvent_t stop)
+{
+  auto& events = r.free_events[device];
+  events.push_back(start);
+  events.push_back(stop);
+}
+
+// Adds the GPU time of the calls whose work has completed, the lock must be held
+void collect_pending(registry& r)
+{
+  auto const completed = std::partition(r.pending.begin(), r.pending.end(), [](auto const& t) {
+    return cudaEventQuery(t.stop) == cudaErrorNotReady;
+  });
+  std::for_each(completed, r.pending.end(), [&r](auto const& t) {
+    float ms = 0;
+    if (cudaEventElapsedTime(&ms, t.start, t.stop) == cudaSuccess) {
+      t.acc->gpu_time_ms += ms;
+      ++t.acc->timed_calls;
+    } else {
+      cudaGetLastError();
+    }
+    release_events(r, t.device, t.start, t.stop);
+  });
+  r.pending.erase(completed, r.pending.end());
+}
+
+}  // namespace
+
+bool is_enabled() { return enabled_flag().load(std::memory_order_relaxed); }
+
+void set_enabled(bool enabled) { enabled_flag().store(enabled, std::memory_order_relaxed); }
+
+std::vector<api_metrics> snapshot()
+{
+  auto& r = get_registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  collect_pending(r);
+  std::vector<api_metrics> result;
+  result.reserve(r.apis.size());
+  std::transform(r.apis.begin(), r.apis.end(), std::back_inserter(result), [](auto const& api) {
+    auto const& acc = api.second;
+    return api_metrics{
+      api.first, acc.calls, acc.timed_calls, acc.gpu_time_ms, acc.bytes, acc.peak_temporary_bytes};
+  });
+  return result;
+}
+
+void reset()
+{
+  auto& r = get_registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  // an event may be recorded again before its previous work has completed
+  for (auto const& t : r.pending) {
+    release_events(r, t.device, t.start, t.stop);
+  }
+  r.pending.clear();
+  r.apis.clear();
+}
+
+namespace detail {
+
+scope::scope(char const* name) noexcept : _name{name}
+{
+  if (is_enabled()) { start(kind::api); }
+}
+
+scope::scope(char const* name, int64_t bytes, rmm::cuda_stream_view stream, kind k)
+  : _name{name}, _kind{k}, _bytes{bytes}
+{
+  if (!is_enabled()) { return; }
+  // the events of a captured call would only be timed when the graph is launched
+  auto const capturing = cudf::detail::is_capturing(stream);
+  start(k);
+  if (_active and not capturing) { start_timing(stream); }
+}
+
+void scope::start(kind k) noexcept
+{
+  if (k == kind::api) {
+    if (current_api != nullptr) { return; }
+    current_api = this;
+  }
+  _active = true;
+}
+
+void scope::start_timing(rmm::cuda_stream_view stream) noexcept
+{
+  if (cudaGetDevice(&_device) != cudaSuccess) {
+    cudaGetLastError();
+    return;
+  }
+  auto& r = get_registry();
+  {
+    std::lock_guard<std::mutex> lock(r.mutex);
+    if (!acquire_event(r, _device, _start)) { return; }
+    if (!acquire_event(r, _device, _stop)) {
+      r.free_events[_device].push_back(_start);
+      return;
+    }
+  }
+  if (cudaEventRecord(_start, stream.value()) != cudaSuccess) {
+    cudaGetLastError();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    release_events(r, _device, _start, _stop);
+    return;
+  }
+  _stream = stream;
+  _timed  = true;
+}
+
+scope::~scope()
+{
+  if (!_active) { return; }
+  if (_kind == kind::api) { current_api = nullptr; }
+
+  auto const stopped = _timed and cudaEventRecord(_stop, _stream.value()) == cudaSuccess;
+  if (_timed and not stopped) { cudaGetLastError(); }
+
+  auto& r = get_registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  auto entry = r.apis.find(std::string_view{_name});
+  if (entry == r.apis.end()) { entry = r.apis.emplace(_name, accumulator{}).first; }
+  auto& acc = entry->second;
+  ++acc.calls;
+  acc.bytes += _bytes;
+  acc.peak_temporary_bytes = std::max(acc.peak_temporary_bytes, _peak_temporary_bytes);
+  if (stopped) {
+    r.pending.push_back({&acc, _device, _start, _stop});
+    if (r.pending.size() >= max_pending_timings) { collect_pending(r); }
+  } else if (_timed) {
+    release_events(r, _device, _start, _stop);
+  }
+}
+
+void record_temporary_bytes(std::size_t bytes) noexcept
+{
+  if (current_api != nullptr) {
+    current_api->_peak_temporary_bytes = std::max(current_api->_peak_temporary_bytes, bytes);
+  }
+}
+
+}  // namespace detail
+}  // namespace metrics
+}  // namespace cudf
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <cstdlib>
+#include <numeric>
+#include <string>
+
+namespace cudf {
+namespace detail {
+
+bool nvtx_payloads_enabled()
+{
+  static bool const enabled = [] {
+    auto const env_val = std::getenv("LIBCUDF_NVTX_PAYLOADS");
+    return env_val != nullptr and std::string{env_val} != "0";
+  }();
+  return enabled;
+}
+
+range_payload make_range_payload(column_view const& input)
+{
+  auto const size = input.size();
+  int64_t bytes   = input.nullable() ? bitmask_allocation_size_bytes(size) : 0;
+  if (is_fixed_width(input.type())) { bytes += static_cast<int64_t>(size_of(input.type())) * size; }
+  bytes = std::accumulate(input.child_begin(), input.child_end(), bytes, [](auto sum, auto child) {
+    return sum + make_range_payload(child).bytes;
+  });
+  return {size, bytes};
+}
+
+range_payload make_range_payload(table_view const& input)
+{
+  auto const bytes =
+    std::accumulate(input.begin(), input.end(), int64_t{0}, [](auto sum, auto col) {
+      return sum + make_range_payload(col).bytes;
+    });
+  return {input.num_rows(), bytes};
+}
+
+void payload_range::push(char const* func, range_payload const& payload)
+{
+  auto const msg = std::string{func} + " rows=" + std::to_string(payload.rows) +
+                   " bytes=" + std::to_string(payload.bytes);
+  // the message is copied by NVTX when the range is pushed
+  _range.emplace(::nvtx3::event_attributes{::nvtx3::message{msg}, ::nvtx3::payload{payload.rows}});
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/stream_capture.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// bytes passed by value to each launch of the copy kernel, well below the 4KB limit on the size
+// of the parameters of a kernel
+constexpr std::size_t chunk_size = 2048;
+constexpr int block_size         = 256;
+
+struct host_chunk {
+  uint8_t bytes[chunk_size];
+};
+
+__global__ void copy_chunk(uint8_t* dst, host_chunk const chunk, std::size_t size)
+{
+  for (auto i = static_cast<std::size_t>(threadIdx.x); i < size; i += blockDim.x) {
+    dst[i] = chunk.bytes[i];
+  }
+}
+
+}  // namespace
+
+bool is_capturing(rmm::cuda_stream_view stream)
+{
+  // querying the legacy default stream fails while another stream is capturing
+  if (stream.is_default()) { return false; }
+  cudaStreamCaptureStatus status;
+  CUDA_TRY(cudaStreamIsCapturing(stream.value(), &status));
+  return status == cudaStreamCaptureStatusActive;
+}
+
+void copy_host_to_device(void* dst,
+                         void const* src,
+                         std::size_t size,
+                         rmm::cuda_stream_view stream)
+{
+  if (size == 0) { return; }
+  if (not is_capturing(stream)) {
+    CUDA_TRY(cudaMemcpyAsync(dst, src, size, cudaMemcpyDefault, stream.value()));
+    return;
+  }
+
+  auto const d_dst = static_cast<uint8_t*>(dst);
+  auto const h_src = static_cast<uint8_t const*>(src);
+  for (std::size_t begin = 0; begin < size; begin += chunk_size) {
+    auto const bytes = std::min(chunk_size, size - begin);
+    host_chunk chunk{};
+    std::memcpy(chunk.bytes, h_src + begin, bytes);
+    copy_chunk<<<1, block_size, 0, stream.value()>>>(d_dst + begin, chunk, bytes);
+  }
+  // CHECK_CUDA would synchronize the stream in debug builds
+  CUDA_TRY(cudaPeekAtLastError());
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/metrics.hpp>
+#include <cudf/detail/utilities/temporary_arena.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// The same alignment as the allocations of the RMM resources
+constexpr std::size_t allocation_alignment = 256;
+
+}  // namespace
+
+temporary_arena::temporary_arena(rmm::cuda_stream_view stream,
+                                 std::size_t initial_block_size,
+                                 rmm::mr::device_memory_resource* upstream)
+  : _upstream(upstream),
+    _stream(stream),
+    _next_block_size(std::max(initial_block_size, allocation_alignment))
+{
+  CUDF_EXPECTS(upstream != nullptr, "Unexpected null upstream memory resource");
+}
+
+temporary_arena::~temporary_arena()
+{
+  if (metrics::is_enabled()) { metrics::detail::record_temporary_bytes(reserved_bytes()); }
+  for (auto const& b : _blocks) {
+    _upstream->deallocate(b.ptr, b.size, _stream);
+  }
+}
+
+std::size_t temporary_arena::reserved_bytes() const
+{
+  return std::accumulate(
+    _blocks.begin(), _blocks.end(), std::size_t{0}, [](auto sum, auto const& b) {
+      return sum + b.size;
+    });
+}
+
+void* temporary_arena::do_allocate(std::size_t bytes, rmm::cuda_stream_view stream)
+{
+  if (bytes == 0) { return nullptr; }
+  if (stream.value() != _stream.value()) { return _upstream->allocate(bytes, stream); }
+
+  auto const size = util::round_up_safe(bytes, allocation_alignment);
+  if (_blocks.empty() || _blocks.back().size - _blocks.back().used < size) {
+    // The space left in the current block is abandoned until the arena is destroyed
+    auto const block_size = std::max(_next_block_size, size);
+    auto const ptr        = static_cast<char*>(_upstream->allocate(block_size, _stream));
+    _blocks.push_back({ptr, block_size, 0});
+    _next_block_size *= 2;
+  }
+  auto& current  = _blocks.back();
+  auto const ptr = current.ptr + current.used;
+  current.used += size;
+  return ptr;
+}
+
+void temporary_arena::do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream)
+{
+  if (ptr == nullptr) { return; }
+  auto const p     = static_cast<char*>(ptr);
+  auto const owner = std::find_if(_blocks.begin(), _blocks.end(), [p](auto const& b) {
+    return p >= b.ptr && p < b.ptr + b.size;
+  });
+  if (owner == _blocks.end()) {
+    _upstream->deallocate(ptr, bytes, stream);
+    return;
+  }
+
+  // Only the most recent allocation can be given back, to be reused in stream order
+  auto& current   = _blocks.back();
+  auto const size = util::round_up_safe(bytes, allocation_alignment);
+  if (stream.value() == _stream.value() && p + size == current.ptr + current.used) {
+    current.used -= size;
+  }
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cudf/ast/detail/expression_parser.hpp>
 #include <cudf/ast/expressions.hpp>
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
@@ -271,6 +272,58 @@ TEST_F(TransformTest, ImbalancedTreeArithmetic)
   cudf::test::expect_columns_equal(expected, result->view(), verbosity);
 }
 
+TEST_F(TransformTest, CommonSubexpression)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto c_2   = column_wrapper<int32_t>{-3, 66, 2, -99};
+  auto table = cudf::table_view{{c_0, c_1, c_2}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto col_ref_2 = cudf::ast::column_reference(2);
+  auto product_0 = cudf::ast::operation(cudf::ast::ast_operator::MUL, col_ref_0, col_ref_1);
+  auto product_1 = cudf::ast::operation(cudf::ast::ast_operator::MUL, col_ref_0, col_ref_1);
+  auto sum       = cudf::ast::operation(cudf::ast::ast_operator::ADD, product_0, product_1);
+
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::SUB, sum, col_ref_2);
+
+  // the product is only evaluated once, and its intermediate is reused by the sum
+  auto const parser = cudf::ast::detail::expression_parser{
+    expression, table, false, rmm::cuda_stream_default, rmm::mr::get_current_device_resource()};
+  EXPECT_EQ(parser.operators().size(), 3u);
+  EXPECT_EQ(parser.device_expression_data.num_intermediates, 1);
+
+  auto expected = column_wrapper<int32_t>{63, 214, 38, 99};
+  auto result   = cudf::compute_column(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, ConstantFolding)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto table = cudf::table_view{{c_0}};
+
+  auto two_value   = cudf::numeric_scalar<int32_t>(2);
+  auto three_value = cudf::numeric_scalar<int32_t>(3);
+  auto two         = cudf::ast::literal(two_value);
+  auto three       = cudf::ast::literal(three_value);
+  auto col_ref_0   = cudf::ast::column_reference(0);
+  auto product     = cudf::ast::operation(cudf::ast::ast_operator::MUL, two, three);
+
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, product);
+
+  auto const parser = cudf::ast::detail::expression_parser{
+    expression, table, false, rmm::cuda_stream_default, rmm::mr::get_current_device_resource()};
+  EXPECT_EQ(parser.operators().size(), 1u);
+
+  auto expected = column_wrapper<int32_t>{9, 26, 7, 56};
+  auto result   = cudf::compute_column(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), verbosity);
+}
+
 TEST_F(TransformTest, MultiLevelTreeComparator)
 {
   auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
@@ -395,6 +448,43 @@ TEST_F(TransformTest, StringComparison)
   cudf::test::expect_columns_equal(expected, result->view(), verbosity);
 }
 
+TEST_F(TransformTest, StringLiteralComparison)
+{
+  auto c_0   = cudf::test::strings_column_wrapper({"a", "bb", "ccc", "bb"});
+  auto c_1   = column_wrapper<int32_t>{20, 5, 30, 15};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto literal_value = cudf::string_scalar("bb");
+  auto literal       = cudf::ast::literal(literal_value);
+  auto ten_value     = cudf::numeric_scalar<int32_t>(10);
+  auto ten           = cudf::ast::literal(ten_value);
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto col_ref_1     = cudf::ast::column_reference(1);
+  auto is_bb         = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref_0, literal);
+  auto is_large      = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_1, ten);
+
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, is_bb, is_large);
+
+  auto expected = column_wrapper<bool>{false, false, false, true};
+  auto result   = cudf::compute_column(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, IsNull)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 0, 1, 0}};
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::IS_NULL, col_ref_0);
+
+  auto expected = column_wrapper<bool>{false, true, false, true};
+  auto result   = cudf::compute_column(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), verbosity);
+}
+
 TEST_F(TransformTest, CopyColumn)
 {
   auto c_0   = column_wrapper<int32_t>{3, 0, 1, 50};
@@ -639,3 +729,49 @@ TEST_F(TransformTest, NullLogicalOr)
 }
 
 CUDF_TEST_PROGRAM_MAIN()
+
+TEST_F(TransformTest, JitMultiLevelTreeNulls)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50, 7}, {1, 1, 0, 1, 1}};
+  auto c_1   = column_wrapper<double>{{10.5, 7.25, 2.0, 0.5, -4.0}, {1, 0, 1, 1, 1}};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto col_ref_1     = cudf::ast::column_reference(1);
+  auto literal_value = cudf::numeric_scalar<int32_t>(4);
+  auto literal       = cudf::ast::literal(literal_value);
+
+  // (c_0 % 4) cast to double, times sqrt(abs(c_1)), compared to c_1
+  auto mod        = cudf::ast::operation(cudf::ast::ast_operator::PYMOD, col_ref_0, literal);
+  auto mod_real   = cudf::ast::operation(cudf::ast::ast_operator::CAST_TO_FLOAT64, mod);
+  auto abs        = cudf::ast::operation(cudf::ast::ast_operator::ABS, col_ref_1);
+  auto sqrt       = cudf::ast::operation(cudf::ast::ast_operator::SQRT, abs);
+  auto product    = cudf::ast::operation(cudf::ast::ast_operator::MUL, mod_real, sqrt);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LESS, product, col_ref_1);
+
+  auto expected = cudf::compute_column(table, expression);
+  auto result   = cudf::compute_column_jit(table, expression);
+
+  cudf::test::expect_columns_equal(expected->view(), result->view(), verbosity);
+}
+
+TEST_F(TransformTest, JitNullLogicalAnd)
+{
+  auto c_0   = column_wrapper<bool>{{false, false, true, true, false, false, true, true},
+                                  {1, 1, 1, 1, 1, 0, 0, 0}};
+  auto c_1   = column_wrapper<bool>{{false, true, false, true, true, true, false, true},
+                                  {1, 1, 1, 1, 0, 1, 1, 0}};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto expression =
+    cudf::ast::operation(cudf::ast::ast_operator::NULL_LOGICAL_AND, col_ref_0, col_ref_1);
+
+  // evaluated by the interpreter, the null-aware operators do not propagate the nulls
+  auto expected = column_wrapper<bool>{{false, false, false, true, false, false, false, true},
+                                       {1, 1, 1, 1, 1, 0, 1, 0}};
+  auto result   = cudf::compute_column_jit(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), verbosity);
+}
@@ -710,6 +710,77 @@ TEST_F(BinaryOperationCompiledTest_NullOpsString, NullMin_Vector_Vector)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, result->view());
 }
 
+struct BinaryOperationCompiledTest_Chained : public BinaryOperationTest {
+};
+
+TEST_F(BinaryOperationCompiledTest_Chained, Arithmetic_Vector_Vector)
+{
+  // (a + b) * c - d, and (((a + b) * c - d) / a) % b, which runs its modulo alone
+  auto a = fixed_width_column_wrapper<int32_t>{{1, 2, 3, 4, 5}, {1, 1, 0, 1, 1}};
+  auto b = fixed_width_column_wrapper<int32_t>{{6, 7, 8, 9, 10}};
+  auto c = fixed_width_column_wrapper<int32_t>{{2, 3, 4, 5, 6}, {1, 1, 1, 0, 1}};
+  auto d = fixed_width_column_wrapper<int32_t>{{1, 1, 2, 2, 3}};
+
+  auto const type = data_type{type_id::INT32};
+
+  using cudf::binary_operator;
+  auto const sum      = cudf::binary_operation(a, b, binary_operator::ADD, type);
+  auto const product  = cudf::binary_operation(*sum, c, binary_operator::MUL, type);
+  auto const expected = cudf::binary_operation(*product, d, binary_operator::SUB, type);
+  auto const result   = cudf::chained_binary_operation(
+    {a, b, c, d}, {binary_operator::ADD, binary_operator::MUL, binary_operator::SUB}, type);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, *result);
+
+  auto const quotient = cudf::binary_operation(*expected, a, binary_operator::DIV, type);
+  auto const modulo   = cudf::binary_operation(*quotient, b, binary_operator::MOD, type);
+  auto const chained  = cudf::chained_binary_operation(
+    {a, b, c, d, a, b},
+    {binary_operator::ADD,
+     binary_operator::MUL,
+     binary_operator::SUB,
+     binary_operator::DIV,
+     binary_operator::MOD},
+    type);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*modulo, *chained);
+
+  EXPECT_THROW(cudf::chained_binary_operation({a, b}, {}, type), cudf::logic_error);
+  EXPECT_THROW(
+    cudf::chained_binary_operation({a, b}, {binary_operator::ADD, binary_operator::ADD}, type),
+    cudf::logic_error);
+}
+
+TEST_F(BinaryOperationCompiledTest_Chained, Decimal128AndTimestamps_Vector_Vector)
+{
+  using cudf::binary_operator;
+  using decimal128_wrapper = fixed_point_column_wrapper<__int128_t>;
+
+  auto a = decimal128_wrapper{{100, 250, 375}, numeric::scale_type{-2}};
+  auto b = decimal128_wrapper{{15, 20, 25}, numeric::scale_type{-1}};
+  auto c = decimal128_wrapper{{3, 4, 5}, numeric::scale_type{0}};
+
+  // (a + b) * c, with the scale of the intermediate given by ADD
+  auto const sum_type = cudf::binary_operation_fixed_point_output_type(
+    binary_operator::ADD, column_view{a}.type(), column_view{b}.type());
+  auto const out_type = cudf::binary_operation_fixed_point_output_type(
+    binary_operator::MUL, sum_type, column_view{c}.type());
+  auto const sum      = cudf::binary_operation(a, b, binary_operator::ADD, sum_type);
+  auto const expected = cudf::binary_operation(*sum, c, binary_operator::MUL, out_type);
+  auto const result   = cudf::chained_binary_operation(
+    {a, b, c}, {binary_operator::ADD, binary_operator::MUL}, out_type);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, *result);
+
+  // t + d1 - d2
+  auto t  = fixed_width_column_wrapper<timestamp_s, timestamp_s::rep>{{100, 200, 300}, {1, 0, 1}};
+  auto d1 = fixed_width_column_wrapper<duration_s, duration_s::rep>{{10, 20, 30}};
+  auto d2 = fixed_width_column_wrapper<duration_s, duration_s::rep>{{1, 2, 3}};
+  auto const t_expected =
+    fixed_width_column_wrapper<timestamp_s, timestamp_s::rep>{{109, 0, 327}, {1, 0, 1}};
+  auto const t_result = cudf::chained_binary_operation({t, d1, d2},
+                                                       {binary_operator::ADD, binary_operator::SUB},
+                                                       data_type{type_id::TIMESTAMP_SECONDS});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(t_expected, *t_result);
+}
+
 }  // namespace cudf::test::binop
 
 CUDF_TEST_PROGRAM_MAIN()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -338,6 +338,31 @@ TEST_F(CountBitmaskTest, MultipleWordsSingleBit)
   EXPECT_THAT(valid_counts, ::testing::ElementsAreArray(std::vector<cudf::size_type>{1, 1, 1}));
 }
 
+TEST_F(CountBitmaskTest, BatchNullCount)
+{
+  auto valid_mask = make_mask(5000, true);
+  auto null_mask  = make_mask(10);
+
+  // the first range spans several blocks of the counting kernel
+  std::vector<cudf::bitmask_type const*> bitmasks{valid_mask.data(),
+                                                  null_mask.data(),
+                                                  nullptr,
+                                                  null_mask.data(),
+                                                  valid_mask.data(),
+                                                  null_mask.data()};
+  std::vector<cudf::size_type> begin_bits{3, 67, 0, 31, 5, 0};
+  std::vector<cudf::size_type> end_bits{150001, 293, 100, 33, 5, 320};
+  auto null_counts =
+    cudf::detail::batch_null_count(bitmasks, begin_bits, end_bits, rmm::cuda_stream_default);
+  EXPECT_THAT(null_counts,
+              ::testing::ElementsAreArray(std::vector<cudf::size_type>{0, 226, 0, 2, 0, 320}));
+
+  std::vector<cudf::size_type> invalid_end_bits{150001, 66, 100, 33, 5, 320};
+  EXPECT_THROW(cudf::detail::batch_null_count(
+                 bitmasks, begin_bits, invalid_end_bits, rmm::cuda_stream_default),
+               cudf::logic_error);
+}
+
 using CountUnsetBitsTest = CountBitmaskTest;
 
 TEST_F(CountUnsetBitsTest, SingleBitAllSet)
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/ipc_table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+extern char** environ;
+
+namespace {
+
+// Environment variable holding the handle of the exported table, in the importing process
+constexpr char const* handle_env_var = "CUDF_TEST_IPC_TABLE_HANDLE";
+
+struct IpcTableTest : public cudf::test::BaseFixture {
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{{5, 4, 3, 2, 1}, {1, 0, 1, 1, 0}};
+  cudf::test::strings_column_wrapper strings{"a", "", "ccc", "dd", "eeee"};
+
+  cudf::table_view input() { return cudf::table_view{{ints, strings}}; }
+};
+
+std::string to_hex(std::vector<uint8_t> const& bytes)
+{
+  std::string hex;
+  for (auto const byte : bytes) {
+    char digits[3];
+    std::snprintf(digits, sizeof(digits), "%02x", byte);
+    hex += digits;
+  }
+  return hex;
+}
+
+std::vector<uint8_t> from_hex(std::string const& hex)
+{
+  std::vector<uint8_t> bytes;
+  for (std::size_t i = 0; i + 1 < hex.size(); i += 2) {
+    bytes.push_back(static_cast<uint8_t>(std::stoi(hex.substr(i, 2), nullptr, 16)));
+  }
+  return bytes;
+}
+
+}  // namespace
+
+// The importing side of `RoundTripAcrossProcesses`, which runs it in a new process, since a
+// process cannot map its own CUDA IPC handles and a forked process cannot use CUDA
+TEST_F(IpcTableTest, ImportInChildProcess)
+{
+  auto const hex_handle = std::getenv(handle_env_var);
+  if (hex_handle == nullptr) { GTEST_SKIP() << "Only run by RoundTripAcrossProcesses"; }
+
+  auto const handle   = from_hex(hex_handle);
+  auto const imported = cudf::import_ipc(handle);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input(), imported->view());
+}
+
+TEST_F(IpcTableTest, RoundTripAcrossProcesses)
+{
+  if (std::getenv(handle_env_var) != nullptr) { GTEST_SKIP() << "Running as the importer"; }
+
+  auto const exported = cudf::export_ipc(input());
+  EXPECT_EQ(exported->num_importers(), 0);
+
+  // The importer is this test program, with only its importing test selected
+  auto const handle_var = std::string{handle_env_var} + "=" + to_hex(exported->handle());
+  std::vector<char*> envp{const_cast<char*>(handle_var.c_str())};
+  for (auto env = environ; *env != nullptr; ++env) {
+    envp.push_back(*env);
+  }
+  envp.push_back(nullptr);
+  std::string program = "/proc/self/exe";
+  std::string filter  = "--gtest_filter=IpcTableTest.ImportInChildProcess";
+  char* argv[]        = {program.data(), filter.data(), nullptr};
+
+  pid_t pid;
+  ASSERT_EQ(posix_spawn(&pid, program.c_str(), nullptr, nullptr, argv, envp.data()), 0);
+  int status = 0;
+  ASSERT_EQ(waitpid(pid, &status, 0), pid);
+  ASSERT_TRUE(WIFEXITED(status));
+  EXPECT_EQ(WEXITSTATUS(status), 0);
+
+  // The import was released when the importing process exited its test
+  EXPECT_EQ(exported->num_importers(), 0);
+}
+
+TEST_F(IpcTableTest, InvalidHandle)
+{
+  std::vector<uint8_t> const handle(4);
+  EXPECT_THROW(cudf::import_ipc(handle), cudf::logic_error);
+}
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/comms/shuffle.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream.hpp>
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+using strcol_wrapper = cudf::test::strings_column_wrapper;
+
+namespace {
+
+/**
+ * @brief Ranks of a group run by threads of the test process, all on the same device.
+ */
+class local_group {
+ public:
+  explicit local_group(int size) : _size{size}, _host(size), _device(size) {}
+
+  [[nodiscard]] int size() const { return _size; }
+
+  std::vector<std::vector<uint8_t>> all_to_all(int rank,
+                                               std::vector<std::vector<uint8_t>> const& send)
+  {
+    _host[rank] = &send;
+    arrive_and_wait();
+    std::vector<std::vector<uint8_t>> received;
+    for (int r = 0; r < _size; ++r) {
+      received.push_back((*_host[r])[rank]);
+    }
+    // The buffers sent stay alive until all the ranks have copied them
+    arrive_and_wait();
+    return received;
+  }
+
+  void all_to_all(int rank,
+                  std::vector<cudf::device_span<uint8_t const>> const& send,
+                  std::vector<cudf::device_span<uint8_t>> const& recv,
+                  rmm::cuda_stream_view stream)
+  {
+    stream.synchronize();
+    _device[rank] = &send;
+    arrive_and_wait();
+    for (int r = 0; r < _size; ++r) {
+      auto const& from = (*_device[r])[rank];
+      EXPECT_EQ(from.size(), recv[r].size());
+      CUDA_TRY(cudaMemcpyAsync(
+        recv[r].data(), from.data(), from.size(), cudaMemcpyDeviceToDevice, stream.value()));
+    }
+    stream.synchronize();
+    arrive_and_wait();
+  }
+
+ private:
+  void arrive_and_wait()
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    auto const generation = _generation;
+    if (++_arrived == _size) {
+      _arrived = 0;
+      ++_generation;
+      _all_arrived.notify_all();
+    } else {
+      _all_arrived.wait(lock, [&] { return _generation != generation; });
+    }
+  }
+
+  int const _size;
+  std::vector<std::vector<std::vector<uint8_t>> const*> _host;
+  std::vector<std::vector<cudf::device_span<uint8_t const>> const*> _device;
+  std::mutex _mutex;
+  std::condition_variable _all_arrived;
+  int _arrived{0};
+  int _generation{0};
+};
+
+class local_communicator : public cudf::comms::communicator {
+ public:
+  local_communicator(local_group& group, int rank) : _group{group}, _rank{rank} {}
+
+  [[nodiscard]] int rank() const override { return _rank; }
+  [[nodiscard]] int size() const override { return _group.size(); }
+
+  std::vector<std::vector<uint8_t>> all_to_all(
+    std::vector<std::vector<uint8_t>> const& send) override
+  {
+    return _group.all_to_all(_rank, send);
+  }
+
+  void all_to_all(std::vector<cudf::device_span<uint8_t const>> const& send,
+                  std::vector<cudf::device_span<uint8_t>> const& recv,
+                  rmm::cuda_stream_view stream) override
+  {
+    _group.all_to_all(_rank, send, recv, stream);
+  }
+
+ private:
+  local_group& _group;
+  int const _rank;
+};
+
+}  // namespace
+
+struct ShuffleTest : public cudf::test::BaseFixture {
+  column_wrapper<int32_t> keys{{3, 1, 2, 0, 3, 7, 5, 2, 8, 1, 4},
+                               {1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1}};
+  strcol_wrapper values{"a", "b", "c", "d", "e", "f", "g", "h", "i", "j", "k"};
+
+  cudf::table_view input() { return cudf::table_view{{keys, values}}; }
+
+  std::unique_ptr<cudf::table> sorted(cudf::table_view const& table)
+  {
+    return cudf::gather(table, cudf::sorted_order(table)->view());
+  }
+
+  /**
+   * @brief Shuffles a slice of the input per rank, each from its own thread, and returns the
+   * result of each rank.
+   */
+  std::vector<std::unique_ptr<cudf::table>> shuffle(std::vector<cudf::size_type> const& splits,
+                                                    cudf::size_type chunk_rows)
+  {
+    auto const slices = cudf::split(input(), splits);
+    auto const size   = static_cast<int>(slices.size());
+    local_group group(size);
+    std::vector<std::unique_ptr<cudf::table>> results(size);
+    std::vector<std::exception_ptr> errors(size);
+    std::vector<std::thread> ranks;
+    for (int r = 0; r < size; ++r) {
+      ranks.emplace_back([&, r] {
+        try {
+          rmm::cuda_stream stream;
+          local_communicator comm(group, r);
+          results[r] = cudf::comms::shuffle(slices[r], {0}, comm, chunk_rows, stream.view());
+          stream.synchronize();
+        } catch (...) {
+          errors[r] = std::current_exception();
+        }
+      });
+    }
+    for (auto& rank : ranks) {
+      rank.join();
+    }
+    for (auto const& error : errors) {
+      if (error) { std::rethrow_exception(error); }
+    }
+    return results;
+  }
+};
+
+TEST_F(ShuffleTest, SingleRank)
+{
+  auto const results = shuffle({}, 4);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted(input()), *sorted(results[0]->view()));
+}
+
+TEST_F(ShuffleTest, RowsOfEqualKeysLandOnTheSameRank)
+{
+  // The ranks hold different numbers of rows, so they have different numbers of chunks
+  auto const results = shuffle({2, 9}, 2);
+  ASSERT_EQ(results.size(), 3u);
+
+  // The rows of each rank are those of its partition of the whole input
+  auto const [partitioned, offsets] = cudf::hash_partition(input(), {0}, 3);
+  auto const expected               = cudf::split(partitioned->view(), {offsets[1], offsets[2]});
+  std::vector<cudf::table_view> views;
+  for (std::size_t r = 0; r < results.size(); ++r) {
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted(expected[r]), *sorted(results[r]->view()));
+    views.push_back(results[r]->view());
+  }
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted(input()), *sorted(cudf::concatenate(views)->view()));
+}
+
+TEST_F(ShuffleTest, RankWithoutRows)
+{
+  auto const results = shuffle({0}, 3);
+  ASSERT_EQ(results.size(), 2u);
+  std::vector<cudf::table_view> views{results[0]->view(), results[1]->view()};
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted(input()), *sorted(cudf::concatenate(views)->view()));
+}
+
+TEST_F(ShuffleTest, InvalidArguments)
+{
+  local_group group(1);
+  local_communicator comm(group, 0);
+  EXPECT_THROW(cudf::comms::shuffle(input(), {0}, comm, 0), cudf::logic_error);
+  EXPECT_THROW(cudf::comms::shuffle(input(), {2}, comm), std::out_of_range);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -1474,6 +1474,30 @@ TEST_F(ListsColumnTest, SlicedColumnsWithNulls)
   }
 }
 
+TEST_F(ListsColumnTest, ManySlices)
+{
+  using LCW = cudf::test::lists_column_wrapper<int>;
+
+  // every row in its own slice, with empty slices in between
+  LCW a{{{1, 2}, {3}},
+        {LCW{}},
+        {{4, 5, 6}, LCW{}, {7}},
+        {{8}},
+        LCW{},
+        {{9, 10}, {11, 12, 13}},
+        {{14}, {15}},
+        {{16, 17, 18, 19}}};
+  auto const pieces = cudf::split(a, {1, 1, 2, 3, 3, 4, 5, 6, 7, 7});
+
+  auto const result = cudf::concatenate(pieces);
+  cudf::test::expect_columns_equivalent(*result, a);
+
+  cudf::test::strings_column_wrapper s{"", "a", "bc", "def", "", "", "ghij", "k"};
+  auto const string_pieces = cudf::split(s, {1, 1, 2, 3, 3, 4, 5, 6, 7, 7});
+  auto const string_result = cudf::concatenate(string_pieces);
+  cudf::test::expect_columns_equivalent(*string_result, s);
+}
+
 TEST_F(ListsColumnTest, ListOfStructs)
 {
   using namespace cudf::test;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -25,6 +25,10 @@
 #include <cudf_test/table_utilities.hpp>
 #include <tests/strings/utilities.h>
 
+#include <numeric>
+#include <string>
+#include <vector>
+
 class GatherTestStr : public cudf::test::BaseFixture {
 };
 
@@ -150,3 +154,56 @@ TEST_F(GatherTestStr, GatherZeroSizeStringsColumn)
                                       cudf::detail::negative_index_policy::NOT_ALLOWED);
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, results->get_column(0).view());
 }
+
+TEST_F(GatherTestStr, GatherContiguousRuns)
+{
+  constexpr cudf::size_type source_size{5000};
+  std::vector<std::string> h_strings(source_size);
+  std::vector<int32_t> h_values(source_size);
+  std::vector<bool> h_validity(source_size);
+  for (cudf::size_type i = 0; i < source_size; ++i) {
+    h_strings[i]  = std::to_string(i);
+    h_values[i]   = i;
+    h_validity[i] = i % 7 != 0;
+  }
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(
+    h_values.begin(), h_values.end(), h_validity.begin());
+  cudf::test::strings_column_wrapper col2(h_strings.begin(), h_strings.end(), h_validity.begin());
+  cudf::table_view source_table{{col1, col2}};
+
+  // three long runs of consecutive indices
+  std::vector<int32_t> h_map(2000);
+  std::iota(h_map.begin(), h_map.end(), 3000);
+  h_map.resize(4000);
+  std::iota(h_map.begin() + 2000, h_map.end(), 0);
+  h_map.resize(5500);
+  std::iota(h_map.begin() + 4000, h_map.end(), 1000);
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map(h_map.begin(), h_map.end());
+
+  std::vector<std::string> exp_strings;
+  std::vector<int32_t> exp_values;
+  std::vector<bool> exp_validity;
+  for (auto const i : h_map) {
+    exp_strings.push_back(h_strings[i]);
+    exp_values.push_back(h_values[i]);
+    exp_validity.push_back(h_validity[i]);
+  }
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col1(
+    exp_values.begin(), exp_values.end(), exp_validity.begin());
+  cudf::test::strings_column_wrapper exp_col2(
+    exp_strings.begin(), exp_strings.end(), exp_validity.begin());
+  cudf::table_view expected{{exp_col1, exp_col2}};
+
+  auto got = cudf::gather(source_table, gather_map);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, got->view());
+
+  // a single run nullifying out of bounds rows has a null mask like any other nullified gather
+  cudf::test::strings_column_wrapper no_nulls(h_strings.begin(), h_strings.end());
+  cudf::test::fixed_width_column_wrapper<int32_t> run_map(h_values.begin() + 1000,
+                                                          h_values.end());
+  auto nullified = cudf::gather(
+    cudf::table_view{{no_nulls}}, run_map, cudf::out_of_bounds_policy::NULLIFY);
+  cudf::test::strings_column_wrapper exp_run(
+    h_strings.begin() + 1000, h_strings.end(), std::vector<bool>(source_size - 1000, true).begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(exp_run, nullified->get_column(0));
+}
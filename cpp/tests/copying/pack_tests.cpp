@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,13 @@
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/table_utilities.hpp>
 
+#include <rmm/device_buffer.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <string>
+
 namespace cudf {
 namespace test {
 
@@ -541,5 +548,48 @@ TEST_F(PackUnpackTest, SlicedEmpty)
 
 // clang-format on
 
+TEST_F(PackUnpackTest, ChunkedPack)
+{
+  // large enough to need several chunks of the smallest user buffer
+  auto const num_rows = 1000000;
+  auto values         = thrust::make_counting_iterator(0);
+  auto validity       = thrust::make_transform_iterator(values, [](auto i) { return i % 3 != 0; });
+  fixed_width_column_wrapper<int64_t> a(values, values + num_rows, validity);
+  auto strings = thrust::make_transform_iterator(values, [](auto i) { return std::to_string(i); });
+  strings_column_wrapper b(strings, strings + num_rows, validity);
+  auto const t = cudf::slice(cudf::table_view({a, b}), {7, num_rows - 5})[0];
+
+  std::size_t const user_buffer_size = 1024 * 1024;
+  rmm::device_buffer user_buffer(user_buffer_size, rmm::cuda_stream_default);
+  cudf::chunked_pack packer(t, user_buffer_size);
+  rmm::device_buffer packed(packer.get_total_contiguous_size(), rmm::cuda_stream_default);
+  std::size_t offset     = 0;
+  std::size_t num_chunks = 0;
+  while (packer.has_next()) {
+    auto const bytes = packer.next(
+      {static_cast<uint8_t*>(user_buffer.data()), static_cast<std::size_t>(user_buffer.size())});
+    EXPECT_LE(bytes, user_buffer_size);
+    CUDA_TRY(cudaMemcpyAsync(static_cast<uint8_t*>(packed.data()) + offset,
+                             user_buffer.data(),
+                             bytes,
+                             cudaMemcpyDeviceToDevice,
+                             rmm::cuda_stream_default.value()));
+    offset += bytes;
+    ++num_chunks;
+  }
+  EXPECT_EQ(offset, packed.size());
+  EXPECT_GT(num_chunks, 1);
+
+  auto metadata = packer.build_metadata();
+  cudf::test::expect_tables_equal(
+    t, cudf::unpack(metadata->data(), static_cast<uint8_t const*>(packed.data())));
+
+  // the metadata matches that of pack
+  auto expected = cudf::pack(t);
+  EXPECT_EQ(metadata->size(), expected.metadata_->size());
+  EXPECT_TRUE(
+    std::equal(metadata->data(), metadata->data() + metadata->size(), expected.metadata_->data()));
+}
+
 }  // namespace test
 }  // namespace cudf
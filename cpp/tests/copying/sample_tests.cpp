@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -24,9 +24,13 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
+#include <algorithm>
+#include <map>
+
 struct SampleTest : public cudf::test::BaseFixture {
 };
 
@@ -112,3 +116,53 @@ INSTANTIATE_TEST_CASE_P(
                     std::make_tuple(1024, cudf::sample_with_replacement::TRUE),
                     std::make_tuple(1024, cudf::sample_with_replacement::FALSE),
                     std::make_tuple(2048, cudf::sample_with_replacement::TRUE)));
+
+TEST_F(SampleTest, SmallSampleWithoutReplacement)
+{
+  cudf::size_type const table_size = 10000;
+  cudf::size_type const n_samples  = 100;
+  auto data = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(data, data + table_size);
+  cudf::table_view input({col1});
+
+  auto const out = cudf::sample(input, n_samples, cudf::sample_with_replacement::FALSE, 7);
+  EXPECT_EQ(out->num_rows(), n_samples);
+  EXPECT_EQ(cudf::distinct_count(out->view()), n_samples);
+
+  auto const again = cudf::sample(input, n_samples, cudf::sample_with_replacement::FALSE, 7);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(out->view(), again->view());
+}
+
+TEST_F(SampleTest, Stratified)
+{
+  // Strata of 100, 40 and 10 rows
+  auto keys_data = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i % 15 == 0 ? 2 : (i % 15 < 5 ? 1 : 0); });
+  auto values_data = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int8_t> keys(keys_data, keys_data + 150);
+  cudf::test::fixed_width_column_wrapper<int32_t> values(values_data, values_data + 150);
+  cudf::table_view input({keys, values});
+
+  auto const out = cudf::stratified_sample(input, {0}, 0.5, 3);
+  EXPECT_EQ(out->num_rows(), 75);
+  EXPECT_EQ(cudf::distinct_count(out->view()), 75);
+
+  auto const [out_keys, out_keys_mask] = cudf::test::to_host<int8_t>(out->get_column(0));
+  auto const [out_values, out_values_mask] = cudf::test::to_host<int32_t>(out->get_column(1));
+  std::map<int8_t, int> counts;
+  for (std::size_t i = 0; i < out_keys.size(); ++i) {
+    ++counts[out_keys[i]];
+    EXPECT_EQ(out_keys[i], keys_data[out_values[i]]);
+  }
+  EXPECT_EQ(counts[0], 50);
+  EXPECT_EQ(counts[1], 20);
+  EXPECT_EQ(counts[2], 5);
+
+  auto const again = cudf::stratified_sample(input, {0}, 0.5, 3);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(out->view(), again->view());
+
+  EXPECT_EQ(cudf::stratified_sample(input, {0}, 0.0)->num_rows(), 0);
+  EXPECT_EQ(cudf::stratified_sample(input, {0}, 1.0)->num_rows(), 150);
+  EXPECT_EQ(cudf::stratified_sample(input, {}, 0.2)->num_rows(), 30);
+  EXPECT_THROW(cudf::stratified_sample(input, {0}, 1.5), cudf::logic_error);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,6 +16,7 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
@@ -337,6 +338,35 @@ TEST_F(SliceCornerCases, NegativeOffset)
   EXPECT_THROW(cudf::slice(col, indices), cudf::logic_error);
 }
 
+TEST_F(SliceCornerCases, LazyNullCounts)
+{
+  auto valids = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  cudf::test::fixed_width_column_wrapper<int8_t> col =
+    create_fixed_columns<int8_t>(0, 10, valids);
+  cudf::test::fixed_width_column_wrapper<int8_t> no_nulls({1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+                                                          {1, 1, 1, 1, 1, 1, 1, 1, 1, 1});
+  std::vector<cudf::size_type> indices{0, 4, 2, 2, 3, 10, 0, 10};
+
+  auto const slices = cudf::slice(col, indices);
+  EXPECT_FALSE(slices[0].is_null_count_known());
+  EXPECT_EQ(slices[1].null_count(), 0);
+  EXPECT_FALSE(slices[2].is_null_count_known());
+  EXPECT_EQ(slices[3].null_count(), 4);
+
+  auto const counted = cudf::detail::with_null_counts(slices);
+  std::vector<cudf::size_type> expected{2, 0, 3, 4};
+  for (std::size_t i = 0; i < counted.size(); ++i) {
+    EXPECT_TRUE(counted[i].is_null_count_known());
+    EXPECT_EQ(counted[i].null_count(), expected[i]);
+    cudf::test::expect_columns_equal(slices[i], counted[i]);
+  }
+
+  for (auto const& slice : cudf::slice(no_nulls, indices)) {
+    EXPECT_TRUE(slice.is_null_count_known());
+    EXPECT_EQ(slice.null_count(), 0);
+  }
+}
+
 template <typename T>
 struct SliceTableTest : public cudf::test::BaseFixture {
 };
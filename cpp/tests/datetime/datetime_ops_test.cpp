@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,7 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/datetime.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/wrappers/timestamps.hpp>
 #include <cudf_test/base_fixture.hpp>
@@ -769,6 +770,81 @@ TEST_F(BasicDatetimeOpsTest, TestQuarter)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*extract_quarter(timestamps_s), quarter);
 }
 
+TEST_F(BasicDatetimeOpsTest, TestConvertTimezone)
+{
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+  using namespace cudf::test::iterators;
+
+  using timestamps_ms = fixed_width_column_wrapper<cudf::timestamp_ms, cudf::timestamp_ms::rep>;
+
+  // 2020-01-01, 2020-07-01, null, 2050-07-01 and 1950-01-01, all at 00:00:00 GMT
+  auto const utc = timestamps_ms{
+    {1577836800000L, 1593561600000L, 0L, 2540246400000L, -631152000000L}, null_at(2)};
+  // PST, PDT, PDT past the transitions of the TZif file, and PST
+  auto const los_angeles = timestamps_ms{
+    {1577808000000L, 1593536400000L, 0L, 2540221200000L, -631180800000L}, null_at(2)};
+  // Always 05:30:00 later
+  auto const kolkata = timestamps_ms{
+    {1577856600000L, 1593581400000L, 0L, 2540266200000L, -631132200000L}, null_at(2)};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*convert_timezone(utc, "UTC", "America/Los_Angeles"),
+                                 los_angeles);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*convert_timezone(los_angeles, "America/Los_Angeles", "UTC"),
+                                 utc);
+  // Cached tables are reused in both directions
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *convert_timezone(los_angeles, "America/Los_Angeles", "Asia/Kolkata"), kolkata);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*convert_timezone(utc, "", "UTC"), utc);
+
+  EXPECT_THROW(convert_timezone(fixed_width_column_wrapper<int64_t>{1}, "UTC", "UTC"),
+               cudf::logic_error);
+}
+
+TYPED_TEST(TypedDatetimeOpsTest, TestExtractComponents)
+{
+  using T = TypeParam;
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+  using namespace cuda::std::chrono;
+
+  auto start = milliseconds(-2500000000000);  // Sat, 11 Oct 1890 19:33:20 GMT
+  auto stop  = milliseconds(2500000000000);   // Mon, 22 Mar 2049 04:26:40 GMT
+
+  auto const input =
+    generate_timestamps<T, true>(this->size(), time_point_ms(start), time_point_ms(stop));
+
+  // Components in any order and repeated, each as by its own extraction
+  auto const components = std::vector<datetime_component>{datetime_component::SECOND,
+                                                           datetime_component::YEAR,
+                                                           datetime_component::MONTH,
+                                                           datetime_component::DAY,
+                                                           datetime_component::WEEKDAY,
+                                                           datetime_component::HOUR,
+                                                           datetime_component::MINUTE,
+                                                           datetime_component::DAY_OF_YEAR,
+                                                           datetime_component::QUARTER,
+                                                           datetime_component::DAYS_IN_MONTH,
+                                                           datetime_component::YEAR};
+  auto const results = extract_components(input, components);
+  ASSERT_EQ(results->num_columns(), static_cast<cudf::size_type>(components.size()));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0), *extract_second(input));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1), *extract_year(input));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(2), *extract_month(input));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(3), *extract_day(input));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(4), *extract_weekday(input));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(5), *extract_hour(input));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(6), *extract_minute(input));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(7), *day_of_year(input));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(8), *extract_quarter(input));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(9), *days_in_month(input));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(10), *extract_year(input));
+
+  cudf::column empty{this->type(), 0, rmm::device_buffer{}};
+  EXPECT_EQ(extract_components(empty, components)->num_columns(), 11);
+  EXPECT_EQ(extract_components(input, {})->num_columns(), 0);
+}
+
 TYPED_TEST(TypedDatetimeOpsTest, TestCeilDatetime)
 {
   using T = TypeParam;
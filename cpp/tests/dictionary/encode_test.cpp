@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -76,3 +76,43 @@ TEST_F(DictionaryEncodeTest, InvalidEncode)
   EXPECT_THROW(cudf::dictionary::encode(input, cudf::data_type{cudf::type_id::INT16}),
                cudf::logic_error);
 }
+
+TEST_F(DictionaryEncodeTest, HashEncode)
+{
+  cudf::test::strings_column_wrapper strings(
+    {"eee", "aaa", "", "ddd", "bbb", "ccc", "ccc", "ccc", "eee", "aaa"},
+    {1, 1, 0, 1, 1, 1, 1, 1, 1, 1});
+
+  auto dictionary = cudf::dictionary::hash_encode(strings);
+  cudf::dictionary_column_view view(dictionary->view());
+  cudf::test::strings_column_wrapper keys_expected({"eee", "aaa", "ddd", "bbb", "ccc"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.keys(), keys_expected);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::dictionary::decode(view)->view(), strings);
+
+  auto sorted = cudf::dictionary::hash_encode(strings, true, cudf::data_type{cudf::type_id::UINT8});
+  auto expected = cudf::dictionary::encode(strings, cudf::data_type{cudf::type_id::UINT8});
+  cudf::dictionary_column_view sorted_view(sorted->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sorted_view.keys(),
+                                 cudf::dictionary_column_view(expected->view()).keys());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::dictionary::decode(sorted_view)->view(), strings);
+}
+
+TEST_F(DictionaryEncodeTest, HashEncoder)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> keys{429, 111, 213};
+  cudf::dictionary::hash_encoder encoder(keys);
+
+  cudf::test::fixed_width_column_wrapper<int64_t> input{{111, 0, 213, 500, 429, 111},
+                                                        {1, 0, 1, 1, 1, 1}};
+  auto dictionary = encoder.encode(input);
+  cudf::dictionary_column_view view(dictionary->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.keys(), keys);
+  cudf::test::fixed_width_column_wrapper<int64_t> expected{{111, 0, 213, 0, 429, 111},
+                                                           {1, 0, 1, 0, 1, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(cudf::dictionary::decode(view)->view(), expected);
+
+  cudf::test::fixed_width_column_wrapper<int64_t> repeated{429, 111, 429};
+  EXPECT_THROW(cudf::dictionary::hash_encoder{repeated}, cudf::logic_error);
+  cudf::test::fixed_width_column_wrapper<int32_t> other_type{111};
+  EXPECT_THROW(encoder.encode(other_type), cudf::logic_error);
+}
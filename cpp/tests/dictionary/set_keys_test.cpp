@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/encode.hpp>
 #include <cudf/dictionary/update_keys.hpp>
@@ -107,3 +108,27 @@ TEST_F(DictionarySetKeysTest, MatchDictionaries)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result1->view(), expected1->view());
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result2->view(), expected2->view());
 }
+
+TEST_F(DictionarySetKeysTest, MatchTablesWithSameKeys)
+{
+  cudf::test::dictionary_column_wrapper<int32_t> col1{5, 0, 4, 1, 2, 2, 2, 5, 0};
+  cudf::test::dictionary_column_wrapper<int32_t> col2{1, 0, 4, 1, 2, 5, 2, 5, 0};
+  cudf::test::dictionary_column_wrapper<int32_t> col3{1, 0, 3, 1, 4, 5, 6, 5, 0};
+
+  // columns with the same keys are not copied
+  auto matched = cudf::dictionary::detail::match_dictionaries(
+    {cudf::table_view{{col1}}, cudf::table_view{{col2}}});
+  EXPECT_TRUE(matched.first.empty());
+  auto indices_of = [](cudf::column_view const& col) {
+    return cudf::dictionary_column_view(col).indices().head();
+  };
+  EXPECT_EQ(indices_of(matched.second.front().column(0)), indices_of(col1));
+  EXPECT_EQ(indices_of(matched.second.back().column(0)), indices_of(col2));
+
+  matched = cudf::dictionary::detail::match_dictionaries(
+    {cudf::table_view{{col1}}, cudf::table_view{{col3}}});
+  EXPECT_EQ(matched.first.size(), 2u);
+  auto keys1 = cudf::dictionary_column_view(matched.second.front().column(0)).keys();
+  auto keys3 = cudf::dictionary_column_view(matched.second.back().column(0)).keys();
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(keys1, keys3);
+}
@@ -331,6 +331,35 @@ TYPED_TEST(FixedPointTestAllReps, BoolConversion)
   EXPECT_EQ(!falsy_value, true);
 }
 
+TEST_F(FixedPointTest, Decimal128RescaleAndDivision)
+{
+  // 12345678901234567890123456789012345678 does not fit in 64 bits
+  auto const big = static_cast<__int128_t>(1234567890123456789) * 10'000'000'000'000'000'000ul +
+                   static_cast<__int128_t>(123456789012345678);
+
+  for (int32_t scale = 1; scale <= 38; ++scale) {
+    auto expected = big;
+    for (int32_t i = 0; i < scale; ++i) {
+      expected /= 10;
+    }
+    decimal128 num{scaled_integer<__int128_t>{big, scale_type{0}}};
+    EXPECT_EQ(expected, num.rescaled(scale_type{scale}).value());
+    decimal128 negative{scaled_integer<__int128_t>{-big, scale_type{0}}};
+    EXPECT_EQ(-expected, negative.rescaled(scale_type{scale}).value());
+  }
+
+  auto const min = cuda::std::numeric_limits<__int128_t>::min();
+  decimal128 smallest{scaled_integer<__int128_t>{min, scale_type{0}}};
+  EXPECT_EQ(min / 1000, smallest.rescaled(scale_type{3}).value());
+
+  decimal128 dividend{scaled_integer<__int128_t>{big, scale_type{-2}}};
+  decimal128 small_dividend{scaled_integer<__int128_t>{-100, scale_type{-2}}};
+  decimal128 divisor{scaled_integer<__int128_t>{7, scale_type{-1}}};
+  EXPECT_EQ(big / 7, (dividend / divisor).value());
+  EXPECT_EQ(-14, (small_dividend / divisor).value());
+  EXPECT_EQ(scale_type{-1}, (dividend / divisor).scale());
+}
+
 // These two overflow tests only work in a Debug build.
 // Unfortunately, in a full debug build, the test will each take about
 // an hour to run.
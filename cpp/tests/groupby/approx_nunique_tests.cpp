@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <cstdlib>
+
+using namespace cudf::test::iterators;
+
+namespace cudf {
+namespace test {
+
+struct groupby_approx_nunique_test : public cudf::test::BaseFixture {
+};
+
+using K = int32_t;
+using R = cudf::detail::target_type_t<int32_t, aggregation::APPROX_NUNIQUE>;
+
+TEST_F(groupby_approx_nunique_test, small_groups_are_exact)
+{
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2, 1};
+  fixed_width_column_wrapper<int32_t> vals({0, 1, 2, 3, 4, 5, 3, 2, 2, 9, 7}, null_at(10));
+  strings_column_wrapper str_vals({"a", "b", "c", "d", "e", "f", "d", "c", "c", "j", "k"},
+                                  null_at(10));
+
+  fixed_width_column_wrapper<K> expect_keys{1, 2, 3};
+  fixed_width_column_wrapper<R> expect_vals{2, 4, 1};
+
+  auto make_agg = [] { return cudf::make_approx_nunique_aggregation<groupby_aggregation>(); };
+  test_single_agg(keys, vals, expect_keys, expect_vals, make_agg());
+  test_single_agg(keys, vals, expect_keys, expect_vals, make_agg(), force_use_sort_impl::YES);
+  test_single_agg(keys, str_vals, expect_keys, expect_vals, make_agg());
+}
+
+TEST_F(groupby_approx_nunique_test, large_groups_within_error)
+{
+  // Group k holds the values i, with i % 4 == k, each twice
+  constexpr size_type num_rows = 200000;
+  auto const key_it = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                      [](auto i) { return (i / 2) % 4; });
+  auto const val_it = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                      [](auto i) { return i / 2; });
+  fixed_width_column_wrapper<K> keys(key_it, key_it + num_rows);
+  fixed_width_column_wrapper<int32_t> vals(val_it, val_it + num_rows);
+
+  for (auto const use_sort : {force_use_sort_impl::NO, force_use_sort_impl::YES}) {
+    cudf::groupby::groupby gb_obj(table_view({keys}));
+    if (use_sort == force_use_sort_impl::YES) { gb_obj.get_groups(); }
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(
+      cudf::make_approx_nunique_aggregation<groupby_aggregation>());
+    auto const result = gb_obj.aggregate(requests);
+
+    auto const [estimates, mask] = to_host<R>(*result.second[0].results[0]);
+    ASSERT_EQ(estimates.size(), 4u);
+    for (auto const estimate : estimates) {
+      EXPECT_LT(std::abs(estimate - 25000), 25000 * 3 / 100);
+    }
+  }
+}
+
+TEST_F(groupby_approx_nunique_test, merged_sketches)
+{
+  fixed_width_column_wrapper<K> keys{1, 2, 1, 2, 1, 2, 1, 2, 1, 2};
+  fixed_width_column_wrapper<int32_t> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  // The sketches of the two halves merge into the sketches of all the values
+  std::vector<std::unique_ptr<table>> partial_keys;
+  std::vector<std::unique_ptr<column>> sketches;
+  for (auto const& half : cudf::split(table_view({keys, vals}), {4})) {
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = half.column(1);
+    requests[0].aggregations.push_back(cudf::make_hll_aggregation<groupby_aggregation>(12));
+    auto result = cudf::groupby::groupby(table_view({half.column(0)})).aggregate(requests);
+    partial_keys.push_back(std::move(result.first));
+    sketches.push_back(std::move(result.second[0].results[0]));
+  }
+  auto const merged_keys =
+    cudf::concatenate(std::vector<table_view>{partial_keys[0]->view(), partial_keys[1]->view()});
+  auto const merged_sketches =
+    cudf::concatenate(std::vector<column_view>{sketches[0]->view(), sketches[1]->view()});
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = merged_sketches->view();
+  requests[0].aggregations.push_back(cudf::make_merge_hll_aggregation<groupby_aggregation>(12));
+  auto const merged = cudf::groupby::groupby(merged_keys->view()).aggregate(requests);
+
+  requests[0].values = vals;
+  requests[0].aggregations.clear();
+  requests[0].aggregations.push_back(cudf::make_hll_aggregation<groupby_aggregation>(12));
+  auto const expected = cudf::groupby::groupby(table_view({keys})).aggregate(requests);
+
+  // The groups of the hash groupby come in an arbitrary order
+  auto const sorted_merged = cudf::sort_by_key(
+    table_view({merged.first->get_column(0), *merged.second[0].results[0]}), merged.first->view());
+  auto const sorted_expected =
+    cudf::sort_by_key(table_view({expected.first->get_column(0), *expected.second[0].results[0]}),
+                      expected.first->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(sorted_merged->view(), sorted_expected->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::hll_distinct_count(sorted_merged->get_column(1)),
+                                 fixed_width_column_wrapper<int64_t>{5, 5});
+
+  // Sketches of another precision cannot be merged
+  requests[0].values = merged_sketches->view();
+  requests[0].aggregations.clear();
+  requests[0].aggregations.push_back(cudf::make_merge_hll_aggregation<groupby_aggregation>(14));
+  EXPECT_THROW(cudf::groupby::groupby(merged_keys->view()).aggregate(requests), cudf::logic_error);
+
+  requests[0].values = vals;
+  requests[0].aggregations.clear();
+  requests[0].aggregations.push_back(cudf::make_hll_aggregation<groupby_aggregation>(3));
+  EXPECT_THROW(cudf::groupby::groupby(table_view({keys})).aggregate(requests), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -215,5 +215,38 @@ TYPED_TEST(groupby_collect_list_test, dictionary)
                   cudf::make_collect_list_aggregation<groupby_aggregation>());
 }
 
+struct groupby_collect_list_mixed_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_collect_list_mixed_test, WithHashAggregations)
+{
+  using K = int32_t;
+  using V = int32_t;
+
+  fixed_width_column_wrapper<K> keys{3, 1, 2, 1, 3, 2, 1};
+  fixed_width_column_wrapper<V> values{5, 1, 4, 2, 5, 3, 1};
+
+  // SUM and NUNIQUE are hash-based, and only COLLECT_LIST is left to the sort-based groupby
+  std::vector<groupby::aggregation_request> requests;
+  requests.emplace_back(groupby::aggregation_request());
+  requests[0].values = values;
+  requests[0].aggregations.push_back(cudf::make_collect_list_aggregation<groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_nunique_aggregation<groupby_aggregation>());
+
+  groupby::groupby gb_obj(table_view({keys}));
+  auto const result = gb_obj.aggregate(requests);
+
+  fixed_width_column_wrapper<K> expect_keys{1, 2, 3};
+  lists_column_wrapper<V> expect_lists{{1, 2, 1}, {4, 3}, {5, 5}};
+  fixed_width_column_wrapper<int64_t> expect_sums{4, 7, 10};
+  fixed_width_column_wrapper<size_type> expect_counts{2, 2, 1};
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), result.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_lists, *result.second[0].results[0]);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_sums, *result.second[0].results[1]);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_counts, *result.second[0].results[2]);
+}
+
 }  // namespace test
 }  // namespace cudf
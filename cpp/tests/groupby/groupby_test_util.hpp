@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -79,14 +79,15 @@ inline void test_single_agg(column_view const& keys,
 
   requests[0].aggregations.push_back(std::move(agg));
 
-  if (use_sort == force_use_sort_impl::YES) {
-    // WAR to force groupby to use sort implementation
-    requests[0].aggregations.push_back(make_nth_element_aggregation<groupby_aggregation>(0));
-  }
-
   groupby::groupby gb_obj(
     table_view({keys}), include_null_keys, keys_are_sorted, column_order, null_precedence);
 
+  if (use_sort == force_use_sort_impl::YES) {
+    // WAR to force groupby to use sort implementation: once the keys have been grouped by a
+    // sort, a groupby object keeps using it
+    gb_obj.get_groups();
+  }
+
   auto result = gb_obj.aggregate(requests);
 
   if (use_sort == force_use_sort_impl::YES) {
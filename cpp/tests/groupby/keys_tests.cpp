@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -226,6 +226,67 @@ TYPED_TEST(groupby_keys_test, pre_sorted_keys_nulls_before_include_nulls)
                   sorted::YES);
 }
 
+TYPED_TEST(groupby_keys_test, pre_sorted_keys_segmented_reductions)
+{
+  using K = TypeParam;
+  using V = int32_t;
+
+  // clang-format off
+  fixed_width_column_wrapper<K> keys        { 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 4};
+  fixed_width_column_wrapper<V> vals(       { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 4},
+                                            { 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 1});
+
+  fixed_width_column_wrapper<K> expect_keys { 1,       2,          3,       4};
+  fixed_width_column_wrapper<cudf::detail::target_type_t<V, aggregation::SUM>> expect_sums(
+                                            { 2,       18,         0,       4},
+                                            { 1,       1,          0,       1});
+  fixed_width_column_wrapper<double> expect_means(
+                                            { 1,       4.5,        0,       4},
+                                            { 1,       1,          0,       1});
+  fixed_width_column_wrapper<size_type> expect_counts
+                                            { 2,       4,          0,       1};
+  fixed_width_column_wrapper<V> expect_maxes(
+                                            { 2,       6,          0,       4},
+                                            { 1,       1,          0,       1});
+  // clang-format on
+
+  // Without a prior grouping of the keys, the groups are computed with segmented reductions
+  for (auto const use_sort : {force_use_sort_impl::NO, force_use_sort_impl::YES}) {
+    test_single_agg(keys,
+                    vals,
+                    expect_keys,
+                    expect_sums,
+                    cudf::make_sum_aggregation<groupby_aggregation>(),
+                    use_sort,
+                    null_policy::EXCLUDE,
+                    sorted::YES);
+    test_single_agg(keys,
+                    vals,
+                    expect_keys,
+                    expect_means,
+                    cudf::make_mean_aggregation<groupby_aggregation>(),
+                    use_sort,
+                    null_policy::EXCLUDE,
+                    sorted::YES);
+    test_single_agg(keys,
+                    vals,
+                    expect_keys,
+                    expect_counts,
+                    cudf::make_count_aggregation<groupby_aggregation>(),
+                    use_sort,
+                    null_policy::EXCLUDE,
+                    sorted::YES);
+    test_single_agg(keys,
+                    vals,
+                    expect_keys,
+                    expect_maxes,
+                    cudf::make_max_aggregation<groupby_aggregation>(),
+                    use_sort,
+                    null_policy::EXCLUDE,
+                    sorted::YES);
+  }
+}
+
 TYPED_TEST(groupby_keys_test, mismatch_num_rows)
 {
   using K = TypeParam;
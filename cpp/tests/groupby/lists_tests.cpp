@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,7 +21,11 @@
 #include <cudf_test/iterator_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/lists/count_elements.hpp>
+#include <cudf/lists/extract.hpp>
+#include <cudf/sorting.hpp>
 
 namespace cudf {
 namespace test {
@@ -44,17 +48,11 @@ void test_sort_based_sum_agg(column_view const& keys, column_view const& values)
     keys, values, keys, values, sum_agg(), force_use_sort_impl::YES, null_policy::INCLUDE);
 }
 
-void test_hash_based_sum_agg(column_view const& keys, column_view const& values)
-{
-  test_single_agg(
-    keys, values, keys, values, sum_agg(), force_use_sort_impl::NO, null_policy::INCLUDE);
-}
-
 }  // namespace
 
-TYPED_TEST(groupby_lists_test, top_level_lists_are_unsupported)
+TYPED_TEST(groupby_lists_test, top_level_lists_are_unsupported_by_sort)
 {
-  // Test that grouping on LISTS columns fails visibly.
+  // Test that grouping on LISTS columns with a sort fails visibly.
 
   // clang-format off
   auto keys   = lists_column_wrapper<TypeParam, int32_t> { {1,1},  {2,2},  {3,3},   {1,1},   {2,2} };
@@ -62,7 +60,39 @@ TYPED_TEST(groupby_lists_test, top_level_lists_are_unsupported)
   // clang-format on
 
   EXPECT_THROW(test_sort_based_sum_agg(keys, values), cudf::logic_error);
-  EXPECT_THROW(test_hash_based_sum_agg(keys, values), cudf::logic_error);
+}
+
+TYPED_TEST(groupby_lists_test, top_level_lists_hash_based)
+{
+  using R = cudf::detail::target_type_t<int32_t, aggregation::SUM>;
+
+  // clang-format off
+  auto keys   = lists_column_wrapper<TypeParam, int32_t> {{0,0},{1},{0,0},{1,1},{1},{0},{1,1}};
+  auto values = fixed_width_column_wrapper<int32_t>      {    0,  1,    2,    3,  4,  5,    6};
+  // clang-format on
+
+  std::vector<groupby::aggregation_request> requests;
+  requests.emplace_back(groupby::aggregation_request());
+  requests[0].values = values;
+  requests[0].aggregations.push_back(sum_agg());
+  groupby::groupby gb_obj(table_view({keys}));
+  auto const result = gb_obj.aggregate(requests);
+
+  // Order the groups by the first element and the size of their key
+  auto const out_keys    = lists_column_view(result.first->get_column(0).view());
+  auto const firsts      = cudf::lists::extract_list_element(out_keys, 0);
+  auto const sizes       = cudf::lists::count_elements(out_keys);
+  auto const order       = cudf::sorted_order(table_view({firsts->view(), *sizes}));
+  auto const sorted_keys = cudf::gather(result.first->view(), *order);
+  auto const sorted_sums = cudf::gather(table_view({*result.second[0].results[0]}), *order);
+
+  // clang-format off
+  auto expect_keys = lists_column_wrapper<TypeParam, int32_t> { {0},  {0,0},  {1},  {1,1} };
+  auto expect_sums = fixed_width_column_wrapper<R>            {   5,      2,    5,      9 };
+  // clang-format on
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_keys, sorted_keys->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_sums, sorted_sums->get_column(0));
 }
 
 }  // namespace test
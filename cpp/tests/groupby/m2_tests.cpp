@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,8 +20,11 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/aggregation.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
 
 using namespace cudf::test::iterators;
 
@@ -39,7 +42,13 @@ using vals_col = cudf::test::fixed_width_column_wrapper<T>;
 template <class T>
 using M2s_col = cudf::test::fixed_width_column_wrapper<T>;
 
-auto compute_M2(cudf::column_view const& keys, cudf::column_view const& values)
+/**
+ * @brief Computes M2 with the hash-based groupby, or with the sort-based one if `use_sort`, and
+ * returns the groups in the ascending order of their keys.
+ */
+auto compute_M2(cudf::column_view const& keys,
+                cudf::column_view const& values,
+                bool use_sort = false)
 {
   std::vector<cudf::groupby::aggregation_request> requests;
   requests.emplace_back(cudf::groupby::aggregation_request());
@@ -47,9 +56,15 @@ auto compute_M2(cudf::column_view const& keys, cudf::column_view const& values)
   requests[0].aggregations.emplace_back(cudf::make_m2_aggregation<cudf::groupby_aggregation>());
 
   auto gb_obj = cudf::groupby::groupby(cudf::table_view({keys}));
+  // A groupby object keeps using the sort-based implementation once its keys have been grouped
+  if (use_sort) { gb_obj.get_groups(); }
   auto result = gb_obj.aggregate(requests);
-  return std::make_pair(std::move(result.first->release()[0]),
-                        std::move(result.second[0].results[0]));
+
+  auto const sort_order = cudf::sorted_order(result.first->view(), {}, {cudf::null_order::AFTER});
+  auto sorted_keys      = cudf::gather(result.first->view(), *sort_order)->release();
+  auto sorted_M2s =
+    cudf::gather(cudf::table_view({result.second[0].results[0]->view()}), *sort_order)->release();
+  return std::make_pair(std::move(sorted_keys[0]), std::move(sorted_M2s[0]));
 }
 }  // namespace
 
@@ -241,3 +256,28 @@ TYPED_TEST(GroupbyM2TypedTest, SlicedColumnsInput)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_keys, *out_keys, verbosity);
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_M2s, *out_M2s, verbosity);
 }
+
+TYPED_TEST(GroupbyM2TypedTest, HashMatchesSort)
+{
+  using T = TypeParam;
+
+  // Enough rows for several blocks of threads over a few groups, with nulls in the keys and values
+  auto const num_rows = 10'000;
+  auto const keys_it  = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return static_cast<int32_t>((i * 7) % 13);
+  });
+  auto const vals_it  = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return static_cast<T>((i * 31) % 101);
+  });
+  auto const keys = keys_col<T>(keys_it, keys_it + num_rows, null_at(3));
+  auto const vals = vals_col<T>(
+    vals_it, vals_it + num_rows, cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+      return i % 5 != 0;
+    }));
+
+  auto const [hash_keys, hash_M2s] = compute_M2(keys, vals);
+  auto const [sort_keys, sort_M2s] = compute_M2(keys, vals, true);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*sort_keys, *hash_keys, verbosity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*sort_M2s, *hash_M2s, verbosity);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -160,6 +160,47 @@ TEST_F(groupby_dictionary_mean_test, basic)
     keys, vals, expect_keys, expect_vals, cudf::make_mean_aggregation<groupby_aggregation>());
 }
 
+TYPED_TEST(groupby_mean_test, sort_with_other_reductions)
+{
+  using V  = TypeParam;
+  using RS = cudf::detail::target_type_t<V, aggregation::SUM>;
+  using RM = cudf::detail::target_type_t<V, aggregation::MEAN>;
+
+  // clang-format off
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2, 4};
+  fixed_width_column_wrapper<V> vals({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 4},
+                                     {1, 1, 0, 1, 0, 1, 1, 0, 0, 1, 0});
+
+                                       //  { 1, 1, 1,   2, 2, 2,   3, 3, 3,   4}
+  fixed_width_column_wrapper<K> expect_keys{ 1,         2,         3,         4};
+  fixed_width_column_wrapper<RS> expect_sums({ 9,       15,        0,         0}, {1, 1, 0, 0});
+  fixed_width_column_wrapper<V> expect_mins(  { 0,       1,         0,         0}, {1, 1, 0, 0});
+  fixed_width_column_wrapper<V> expect_maxes( { 6,       9,         0,         0}, {1, 1, 0, 0});
+  fixed_width_column_wrapper<size_type> expect_counts{3, 3,         0,         0};
+  fixed_width_column_wrapper<RM> expect_means({ 3,       5,         0,         0}, {1, 1, 0, 0});
+  // clang-format on
+
+  // The mean and the other reductions of the request share the pass over the grouped values
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_mean_aggregation<groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_min_aggregation<groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_max_aggregation<groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_count_aggregation<groupby_aggregation>());
+
+  groupby::groupby gb_obj(table_view({keys}));
+  gb_obj.get_groups();
+  auto const result = gb_obj.aggregate(requests);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), result.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_means, *result.second[0].results[0]);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_sums, *result.second[0].results[1]);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_mins, *result.second[0].results[2]);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_maxes, *result.second[0].results[3]);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_counts, *result.second[0].results[4]);
+}
+
 template <typename T>
 struct FixedPointTestBothReps : public cudf::test::BaseFixture {
 };
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+using namespace cudf::test::iterators;
+
+namespace {
+using result_type = std::pair<std::unique_ptr<cudf::table>,
+                              std::vector<cudf::groupby::aggregation_result>>;
+
+/**
+ * @brief Returns the keys followed by the results of `result`, in the ascending order of the keys.
+ */
+std::unique_ptr<cudf::table> sorted_by_keys(result_type const& result)
+{
+  std::vector<cudf::column_view> columns;
+  for (auto const& col : result.first->view()) {
+    columns.push_back(col);
+  }
+  for (auto const& col : result.second[0].results) {
+    columns.push_back(*col);
+  }
+  auto const order = cudf::sorted_order(result.first->view());
+  return cudf::gather(cudf::table_view{columns}, *order);
+}
+
+std::vector<cudf::groupby::aggregation_request> make_requests(cudf::column_view const& values)
+{
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_count_aggregation<cudf::groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_max_aggregation<cudf::groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_min_aggregation<cudf::groupby_aggregation>());
+  return requests;
+}
+}  // namespace
+
+struct PartitionedGroupbyTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(PartitionedGroupbyTest, MatchesGroupby)
+{
+  auto const num_rows = 1000;
+  auto const key_it   = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                      [](auto i) { return (i * 7) % 311; });
+  auto const val_it   = thrust::make_counting_iterator(0);
+  auto const keys     = cudf::test::fixed_width_column_wrapper<int32_t>(
+    key_it, key_it + num_rows, nulls_at({3, 500}));
+  auto const vals = cudf::test::fixed_width_column_wrapper<int32_t>(
+    val_it, val_it + num_rows, nulls_at({10, 11}));
+  auto const keys_table = cudf::table_view{{keys}};
+
+  for (auto const null_handling : {cudf::null_policy::EXCLUDE, cudf::null_policy::INCLUDE}) {
+    auto const requests = make_requests(vals);
+    auto const expected = cudf::groupby::groupby(keys_table, null_handling).aggregate(requests);
+    auto const result =
+      cudf::groupby::partitioned_aggregate(keys_table, requests, 7, null_handling);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*sorted_by_keys(expected), *sorted_by_keys(result));
+  }
+}
+
+TEST_F(PartitionedGroupbyTest, EmptyInputAndInvalidUsage)
+{
+  auto const keys     = cudf::test::fixed_width_column_wrapper<int32_t>{};
+  auto const vals     = cudf::test::fixed_width_column_wrapper<int32_t>{};
+  auto const requests = make_requests(vals);
+
+  auto const result = cudf::groupby::partitioned_aggregate(cudf::table_view{{keys}}, requests, 4);
+  EXPECT_EQ(result.first->num_rows(), 0);
+  EXPECT_EQ(result.second[0].results.size(), 4);
+
+  EXPECT_THROW(cudf::groupby::partitioned_aggregate(cudf::table_view{{keys}}, requests, 0),
+               cudf::logic_error);
+}
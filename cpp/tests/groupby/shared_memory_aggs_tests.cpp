@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace cudf {
+namespace test {
+
+template <typename V>
+struct groupby_shared_memory_aggs_test : public cudf::test::BaseFixture {
+};
+
+using K               = int32_t;
+using supported_types = cudf::test::Types<int8_t, int16_t, int32_t, int64_t, float, double>;
+
+TYPED_TEST_SUITE(groupby_shared_memory_aggs_test, supported_types);
+
+namespace {
+
+template <typename V, aggregation::Kind k>
+using target_t = cudf::detail::target_type_t<V, k>;
+
+// Wrapping multiplication, as the device atomics do for integers
+template <typename T>
+T multiply(T lhs, T rhs)
+{
+  if constexpr (std::is_integral_v<T>) {
+    using U = std::make_unsigned_t<T>;
+    return static_cast<T>(static_cast<U>(lhs) * static_cast<U>(rhs));
+  } else {
+    return lhs * rhs;
+  }
+}
+
+}  // namespace
+
+// All the aggregations computed in shared memory at once, on enough rows for several blocks, with
+// fewer groups than the shared memory table of a block holds and with more. The values are small
+// integers so that the sums of floating-point values are exact in any order, and the products
+// either wrap or overflow to infinity in any order.
+TYPED_TEST(groupby_shared_memory_aggs_test, all_aggregations)
+{
+  using V = TypeParam;
+
+  constexpr size_type num_rows = 100'000;
+  V const values[]             = {1, -1, 2, -2};
+  for (size_type const num_groups : {7, 5'003}) {
+    auto const key_it = cudf::detail::make_counting_transform_iterator(
+      0, [num_groups](auto i) { return i % num_groups; });
+    auto const val_it =
+      cudf::detail::make_counting_transform_iterator(0, [&](auto i) { return values[i % 4]; });
+    auto const valid_it =
+      cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+    fixed_width_column_wrapper<K> keys(key_it, key_it + num_rows);
+    fixed_width_column_wrapper<V> vals(val_it, val_it + num_rows, valid_it);
+
+    std::vector<target_t<V, aggregation::SUM>> sums(num_groups, 0);
+    std::vector<target_t<V, aggregation::PRODUCT>> products(num_groups, 1);
+    std::vector<target_t<V, aggregation::MIN>> mins(num_groups, std::numeric_limits<V>::max());
+    std::vector<target_t<V, aggregation::MAX>> maxs(num_groups, std::numeric_limits<V>::lowest());
+    std::vector<target_t<V, aggregation::SUM_OF_SQUARES>> squares(num_groups, 0);
+    std::vector<target_t<V, aggregation::COUNT_VALID>> valid_counts(num_groups, 0);
+    std::vector<target_t<V, aggregation::COUNT_ALL>> counts(num_groups, 0);
+    for (size_type i = 0; i < num_rows; ++i) {
+      auto const g = i % num_groups;
+      ++counts[g];
+      if (not valid_it[i]) { continue; }
+      auto const v = val_it[i];
+      sums[g] += v;
+      products[g] = multiply<target_t<V, aggregation::PRODUCT>>(products[g], v);
+      mins[g]     = std::min(mins[g], v);
+      maxs[g]     = std::max(maxs[g], v);
+      squares[g] += static_cast<target_t<V, aggregation::SUM_OF_SQUARES>>(v) * v;
+      ++valid_counts[g];
+    }
+
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(make_sum_aggregation<groupby_aggregation>());
+    requests[0].aggregations.push_back(make_product_aggregation<groupby_aggregation>());
+    requests[0].aggregations.push_back(make_min_aggregation<groupby_aggregation>());
+    requests[0].aggregations.push_back(make_max_aggregation<groupby_aggregation>());
+    requests[0].aggregations.push_back(make_sum_of_squares_aggregation<groupby_aggregation>());
+    requests[0].aggregations.push_back(make_count_aggregation<groupby_aggregation>());
+    requests[0].aggregations.push_back(
+      make_count_aggregation<groupby_aggregation>(null_policy::INCLUDE));
+
+    groupby::groupby gb(table_view({keys}));
+    auto const result = gb.aggregate(requests);
+
+    auto const sort_order = sorted_order(result.first->view());
+    fixed_width_column_wrapper<K> expect_keys(key_it, key_it + num_groups);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}),
+                                  *gather(result.first->view(), *sort_order));
+
+    auto const expect_result = [&](size_type index, auto const& expected) {
+      using R = typename std::decay_t<decltype(expected)>::value_type;
+      fixed_width_column_wrapper<R> expect_vals(expected.begin(), expected.end());
+      auto const sorted =
+        gather(table_view({result.second[0].results[index]->view()}), *sort_order);
+      CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_vals, sorted->get_column(0));
+    };
+    expect_result(0, sums);
+    expect_result(1, products);
+    expect_result(2, mins);
+    expect_result(3, maxs);
+    expect_result(4, squares);
+    expect_result(5, valid_counts);
+    expect_result(6, counts);
+  }
+}
+
+}  // namespace test
+}  // namespace cudf
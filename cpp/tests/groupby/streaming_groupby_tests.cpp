@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+
+using namespace cudf::test::iterators;
+
+namespace {
+using keys_col   = cudf::test::fixed_width_column_wrapper<int32_t>;
+using vals_col   = cudf::test::fixed_width_column_wrapper<int32_t>;
+using lists_col  = cudf::test::lists_column_wrapper<int32_t>;
+using sums_col   = cudf::test::fixed_width_column_wrapper<int64_t>;
+using counts_col = cudf::test::fixed_width_column_wrapper<cudf::size_type>;
+using means_col  = cudf::test::fixed_width_column_wrapper<double>;
+
+/**
+ * @brief Returns the keys and the results of `result` in the ascending order of the keys.
+ */
+auto sorted_by_keys(std::pair<std::unique_ptr<cudf::table>,
+                              std::vector<cudf::groupby::aggregation_result>> const& result)
+{
+  std::vector<cudf::column_view> columns;
+  for (auto const& col : result.second[0].results) {
+    columns.push_back(*col);
+  }
+  auto const order = cudf::sorted_order(result.first->view());
+  return std::make_pair(cudf::gather(result.first->view(), *order),
+                        cudf::gather(cudf::table_view{columns}, *order));
+}
+
+std::vector<cudf::groupby::streaming_aggregation_request> make_requests()
+{
+  std::vector<cudf::groupby::streaming_aggregation_request> requests(1);
+  requests[0].values = 1;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_count_aggregation<cudf::groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_mean_aggregation<cudf::groupby_aggregation>());
+  requests[0].aggregations.push_back(
+    cudf::make_variance_aggregation<cudf::groupby_aggregation>());
+  requests[0].aggregations.push_back(
+    cudf::make_collect_list_aggregation<cudf::groupby_aggregation>());
+  return requests;
+}
+}  // namespace
+
+struct StreamingGroupbyTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(StreamingGroupbyTest, MatchesGroupbyOfAllBatches)
+{
+  auto const keys1 = keys_col{{1, 2, 1, 3, 0}, null_at(4)};
+  auto const vals1 = vals_col{{3, 4, 5, 6, 7}, null_at(3)};
+  auto const keys2 = keys_col{2, 1, 4};
+  auto const vals2 = vals_col{6, 7, 8};
+  auto const keys3 = keys_col{1, 3, 3};
+  auto const vals3 = vals_col{{2, 9, 1}, null_at(1)};
+
+  cudf::groupby::streaming_groupby gb_obj({0}, make_requests());
+  gb_obj.update(cudf::table_view{{keys1, vals1}});
+  gb_obj.update(cudf::table_view{{keys2, vals2}});
+  gb_obj.update(cudf::table_view{{keys3, vals3}});
+  auto const [keys, results] = sorted_by_keys(gb_obj.finalize());
+
+  // key = 1: vals = [3, 5, 7, 2]
+  // key = 2: vals = [4, 6]
+  // key = 3: vals = [null, null, 1]
+  // key = 4: vals = [8]
+  auto const expected_keys   = keys_col{1, 2, 3, 4};
+  auto const expected_sums   = sums_col{17, 10, 1, 8};
+  auto const expected_counts = counts_col{4, 2, 1, 1};
+  auto const expected_means  = means_col{4.25, 5.0, 1.0, 8.0};
+  auto const expected_vars   = means_col{{14.75 / 3, 2.0, 0, 0}, nulls_at({2, 3})};
+  auto const expected_lists =
+    lists_col{{3, 5, 7, 2}, {4, 6}, {{0, 0, 1}, nulls_at({0, 1})}, {8}};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_keys, keys->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_sums, results->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_counts, results->get_column(1));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_means, results->get_column(2));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_vars, results->get_column(3));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_lists, results->get_column(4));
+}
+
+TEST_F(StreamingGroupbyTest, InvalidUsage)
+{
+  std::vector<cudf::groupby::streaming_aggregation_request> requests(1);
+  requests[0].values = 1;
+  requests[0].aggregations.push_back(cudf::make_median_aggregation<cudf::groupby_aggregation>());
+  EXPECT_THROW(cudf::groupby::streaming_groupby({0}, std::move(requests)), cudf::logic_error);
+
+  cudf::groupby::streaming_groupby gb_obj({0}, make_requests());
+  EXPECT_THROW(gb_obj.finalize(), cudf::logic_error);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,6 +22,11 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <vector>
 
 using namespace cudf::test::iterators;
 
@@ -156,6 +161,38 @@ TYPED_TEST(groupby_sum_test, dictionary)
                   force_use_sort_impl::YES);
 }
 
+struct groupby_sum_many_rows_test : public cudf::test::BaseFixture {
+};
+
+// Enough rows for several blocks, with fewer groups than the shared memory table of a block holds
+// and with more. The group counts are coprime with 5 so that every group has valid rows.
+TEST_F(groupby_sum_many_rows_test, shared_memory)
+{
+  using V = int64_t;
+  using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+  constexpr size_type num_rows = 100'000;
+  for (size_type const num_groups : {7, 5'003}) {
+    auto const key_it            = cudf::detail::make_counting_transform_iterator(
+      0, [num_groups](auto i) { return i % num_groups; });
+    auto const null_at_every_5th = cudf::detail::make_counting_transform_iterator(
+      0, [](auto i) { return i % 5 != 0; });
+    fixed_width_column_wrapper<K> keys(key_it, key_it + num_rows);
+    auto const val_it = thrust::make_counting_iterator(0);
+    fixed_width_column_wrapper<V, int32_t> vals(val_it, val_it + num_rows, null_at_every_5th);
+
+    std::vector<R> sums(num_groups, 0);
+    for (size_type i = 0; i < num_rows; ++i) {
+      if (i % 5 != 0) { sums[i % num_groups] += i; }
+    }
+    fixed_width_column_wrapper<K> expect_keys(key_it, key_it + num_groups);
+    fixed_width_column_wrapper<R> expect_vals(sums.begin(), sums.end());
+
+    auto agg = cudf::make_sum_aggregation<groupby_aggregation>();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+  }
+}
+
 template <typename T>
 struct FixedPointTestAllReps : public cudf::test::BaseFixture {
 };
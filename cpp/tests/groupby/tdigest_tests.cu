@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,7 @@
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/tdigest/tdigest.hpp>
 #include <cudf/lists/lists_column_view.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/tdigest/tdigest_column_view.cuh>
 
 #include <cudf_test/base_fixture.hpp>
@@ -348,8 +349,10 @@ TYPED_TEST(TDigestAllTypes, LargeGroups)
   requests.push_back({*_values, std::move(aggregations)});
   auto result = gb.aggregate(requests);
 
-  // verify that they end up the same.
-  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*result.second[0].results[0], *merged_parts);
+  // verify that they end up the same. the hash groupby returns the groups in no particular order.
+  auto sorted_result =
+    cudf::sort_by_key(cudf::table_view({*result.second[0].results[0]}), result.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(sorted_result->get_column(0), *merged_parts);
 }
 
 struct TDigestTest : public cudf::test::BaseFixture {
@@ -381,6 +384,43 @@ TEST_F(TDigestTest, EmptyMixed)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result.second[0].results[0], *expected);
 }
 
+TEST_F(TDigestTest, HashGroupbyMatchesSortGroupby)
+{
+  auto values         = generate_standardized_percentile_distribution(data_type{type_id::FLOAT64});
+  auto const num_rows = values->size();
+
+  auto validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  values->set_null_mask(cudf::test::detail::make_null_mask(validity, validity + num_rows));
+  auto key_iter = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+  cudf::test::fixed_width_column_wrapper<int> keys(key_iter, key_iter + num_rows);
+  int const delta = 1000;
+
+  auto aggregate = [delta](cudf::groupby::groupby& gb, column_view const& values) {
+    std::vector<cudf::groupby::aggregation_request> requests;
+    std::vector<std::unique_ptr<cudf::groupby_aggregation>> aggregations;
+    aggregations.push_back(cudf::make_tdigest_aggregation<cudf::groupby_aggregation>(delta));
+    requests.push_back({values, std::move(aggregations)});
+    return gb.aggregate(requests);
+  };
+
+  // unsorted keys use the hash groupby
+  cudf::groupby::groupby hash_gb(cudf::table_view({keys}));
+  auto hash_result        = aggregate(hash_gb, *values);
+  auto sorted_hash_result = cudf::sort_by_key(
+    cudf::table_view({*hash_result.second[0].results[0]}), hash_result.first->view());
+
+  // presorted keys use the sort groupby
+  auto sorted_input =
+    cudf::sort_by_key(cudf::table_view({keys, *values}), cudf::table_view({keys}));
+  cudf::groupby::groupby sort_gb(
+    cudf::table_view({sorted_input->get_column(0)}), null_policy::EXCLUDE, sorted::YES);
+  auto sort_result = aggregate(sort_gb, sorted_input->get_column(1));
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(sorted_hash_result->get_column(0),
+                                      *sort_result.second[0].results[0]);
+}
+
 TEST_F(TDigestTest, LargeInputDouble)
 {
   // these tests are being done explicitly because of the way we have to precompute the correct
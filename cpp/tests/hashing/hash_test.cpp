@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -237,6 +237,68 @@ TYPED_TEST(HashTestFloatTyped, TestExtremes)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*spark_col, *spark_col_neg_nan);
 }
 
+class Hash64Test : public cudf::test::BaseFixture {
+};
+
+TEST_F(Hash64Test, StringsMatchReferenceHashes)
+{
+  strings_column_wrapper const strings_col(
+    {"", "a", "abc", "Nobody inspects the spammish repetition"});
+  // The reference xxHash64 values of the strings, combined into the initial row hash of 0
+  fixed_width_column_wrapper<int64_t> const xxhash_result(
+    {-8251064074018527826, 8108237083972659824, -2093146130496780882, -7348148401403197434});
+  auto const xxhash = cudf::hash(cudf::table_view({strings_col}), cudf::hash_id::HASH_XXHASH64);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*xxhash, xxhash_result, verbosity);
+
+  strings_column_wrapper const murmur_strings_col(
+    {"hello", "The quick brown fox jumps over the lazy dog"});
+  fixed_width_column_wrapper<int64_t> const murmur_result(
+    {7642645318626449175, -9114381618611382399});
+  auto const murmur =
+    cudf::hash(cudf::table_view({murmur_strings_col}), cudf::hash_id::HASH_MURMUR3_64);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*murmur, murmur_result, verbosity);
+}
+
+TEST_F(Hash64Test, MultiValueWithSeeds)
+{
+  strings_column_wrapper const strings_col({"",
+                                            "The quick brown fox",
+                                            "jumps over the lazy dog.",
+                                            "All work and no play makes Jack a dull boy"},
+                                           {1, 1, 0, 1});
+  fixed_width_column_wrapper<double> const doubles_col({0., -0., 1.5, -1.5});
+  fixed_width_column_wrapper<double> const doubles_col_neg_zero({-0., 0., 1.5, -1.5});
+  fixed_width_column_wrapper<bool> const bools_col1({0, 1, 1, 1});
+  fixed_width_column_wrapper<bool> const bools_col2({0, 1, 2, 255});
+
+  std::vector<std::unique_ptr<cudf::column>> struct_field_cols;
+  struct_field_cols.emplace_back(std::make_unique<cudf::column>(strings_col));
+  struct_field_cols.emplace_back(std::make_unique<cudf::column>(doubles_col));
+  structs_column_wrapper structs_col(std::move(struct_field_cols));
+
+  auto const combo1 = cudf::table_view({strings_col, doubles_col, bools_col1});
+  auto const combo2 = cudf::table_view({strings_col, doubles_col_neg_zero, bools_col2});
+  auto const fields = cudf::table_view({strings_col, doubles_col});
+
+  for (auto const hasher : {cudf::hash_id::HASH_XXHASH64, cudf::hash_id::HASH_MURMUR3_64}) {
+    auto const combo1_hash  = cudf::hash(combo1, hasher, 42);
+    auto const combo2_hash  = cudf::hash(combo2, hasher, 42);
+    auto const fields_hash  = cudf::hash(fields, hasher, 42);
+    auto const structs_hash = cudf::hash(cudf::table_view({structs_col}), hasher, 42);
+    auto const seeded_hash  = cudf::hash(combo1, hasher, 314);
+
+    EXPECT_EQ(combo1_hash->type().id(), cudf::type_id::INT64);
+    EXPECT_EQ(combo1.num_rows(), combo1_hash->size());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*combo1_hash, *combo2_hash, verbosity);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*structs_hash, *fields_hash, verbosity);
+    auto const combo1_host = cudf::test::to_host<int64_t>(*combo1_hash).first;
+    auto const seeded_host = cudf::test::to_host<int64_t>(*seeded_hash).first;
+    for (std::size_t i = 0; i < combo1_host.size(); ++i) {
+      EXPECT_NE(combo1_host[i], seeded_host[i]);
+    }
+  }
+}
+
 class SerialMurmurHash3Test : public cudf::test::BaseFixture {
 };
 
@@ -589,6 +651,34 @@ TEST_F(MD5HashTest, StringListsNulls)
 }
 
 template <typename T>
+TEST_F(MD5HashTest, LongStringsWarpCooperative)
+{
+  // Strings averaging more than 128 bytes per row are hashed by the warp-cooperative kernel
+  strings_column_wrapper const strings_col({std::string(200, 'a'),
+                                            "",
+                                            std::string(330, '0') + "abc",
+                                            std::string(2048, 'x')},
+                                           {1, 0, 1, 1});
+  using limits = std::numeric_limits<int32_t>;
+  fixed_width_column_wrapper<int32_t> const ints_col({100, -100, 0, limits::max()});
+  auto const input = cudf::table_view({strings_col, ints_col});
+
+  strings_column_wrapper const md5_results({"f148e8df7bb6fd156877c52496622608",
+                                            "7fb89558e395330c6a10ab98915fcafb",
+                                            "ec808d3d45316e89a22d19411ed7c000",
+                                            "52bc7dbdb7d53358aa5c213021062f82"});
+  strings_column_wrapper const sha256_results(
+    {"0eb623718031c18fc02d2f7502618fe0c8879e8b1937e0b37c90abc8947a6388",
+     "76aa0c2e5a1d299f82a3df17919d4d517a9e8c61b3f68d1b5c14685317e16ce0",
+     "75064fc0c0863afcd83f81fa53e7184fb23905dde546003d9b3df60497cf1dbf",
+     "743891491fcfb09b8174bdd2c7605edb68058ae2e2a9e85f4baabd96d01b64f1"});
+
+  auto const md5_output    = cudf::hash(input, cudf::hash_id::HASH_MD5);
+  auto const sha256_output = cudf::hash(input, cudf::hash_id::HASH_SHA256);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(md5_output->view(), md5_results, verbosity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sha256_output->view(), sha256_results, verbosity);
+}
+
 class MD5HashTestTyped : public cudf::test::BaseFixture {
 };
 
@@ -730,4 +820,36 @@ TYPED_TEST(MD5HashTestFloatTyped, TestListExtremes)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(output1->view(), output2->view(), verbosity);
 }
 
+class SHAHashTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SHAHashTest, MultiValue)
+{
+  strings_column_wrapper const strings_col(
+    {"",
+     "abc",
+     "A 60 character string to test MD5's message padding algorithm",
+     "All work and no play makes Jack a dull boy",
+     "A null string hashes like an empty string"},
+    {1, 1, 1, 1, 0});
+
+  strings_column_wrapper const sha1_results({"da39a3ee5e6b4b0d3255bfef95601890afd80709",
+                                             "a9993e364706816aba3e25717850c26c9cd0d89d",
+                                             "f2caf56e40565f0b1d1f758a4733d76ea218b4ab",
+                                             "a62ca720fbab830c8890044eacbeac216f1ca2e4",
+                                             "da39a3ee5e6b4b0d3255bfef95601890afd80709"});
+  strings_column_wrapper const sha256_results(
+    {"e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+     "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad",
+     "c3f3efa2031528717009b12f7223d3054748552e9cedc9beb947339d84deeb18",
+     "2ce9936a4a2234bf8a76c37d92e01d549d03949792242e7f8a1ad68575e4e4a8",
+     "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"});
+
+  auto const input         = cudf::table_view({strings_col});
+  auto const sha1_output   = cudf::hash(input, cudf::hash_id::HASH_SHA1);
+  auto const sha256_output = cudf::hash(input, cudf::hash_id::HASH_SHA256);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sha1_output->view(), sha1_results, verbosity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sha256_output->view(), sha256_results, verbosity);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
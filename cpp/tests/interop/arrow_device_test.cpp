@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/interop.hpp>
+#include <cudf/table/table.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <string>
+
+struct ArrowDeviceTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ArrowDeviceTest, RoundTrip)
+{
+  auto ints    = cudf::test::fixed_width_column_wrapper<int32_t>({1, 2, 3, 4}, {1, 0, 1, 1});
+  auto strings = cudf::test::strings_column_wrapper({"a", "", "bcd", "ef"}, {1, 1, 0, 1});
+  auto lists   = cudf::test::lists_column_wrapper<int64_t>{{1, 2}, {}, {3}, {4, 5, 6}};
+  auto child   = cudf::test::fixed_width_column_wrapper<double>{1.5, 2.5, 3.5, 4.5};
+  auto structs = cudf::test::structs_column_wrapper({child}, {1, 1, 0, 1});
+  auto input   = cudf::table_view{{ints, strings, lists, structs}};
+
+  auto const schema = cudf::to_arrow_schema(input, {{"a"}, {"b"}, {"c"}, {"d"}});
+  EXPECT_EQ(std::string(schema->format), "+s");
+  EXPECT_EQ(schema->n_children, 4);
+  EXPECT_EQ(std::string(schema->children[1]->format), "u");
+  EXPECT_EQ(std::string(schema->children[1]->name), "b");
+  EXPECT_EQ(std::string(schema->children[2]->format), "+l");
+  EXPECT_EQ(std::string(schema->children[2]->children[0]->format), "l");
+
+  auto const array = cudf::to_arrow_device(cudf::table{input});
+  EXPECT_EQ(array->device_type, ARROW_DEVICE_CUDA);
+  EXPECT_EQ(array->array.length, 4);
+  EXPECT_EQ(array->array.children[0]->null_count, 1);
+
+  auto const result = cudf::from_arrow_device(schema.get(), array.get());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, result);
+}
+
+TEST_F(ArrowDeviceTest, ChildOutlivesParent)
+{
+  auto col   = cudf::test::fixed_width_column_wrapper<int64_t>({1, 2, 3}, {1, 1, 0});
+  auto input = cudf::table_view{{col}};
+  auto array = cudf::to_arrow_device(cudf::table{input});
+
+  // a child moved out of its parent keeps the device memory alive after the parent is released
+  ArrowArray child = *array->array.children[0];
+  array->array.children[0]->release = nullptr;
+  array.reset();
+
+  EXPECT_EQ(child.length, 3);
+  EXPECT_EQ(child.null_count, 1);
+  auto const result = cudf::column_view{cudf::data_type{cudf::type_id::INT64},
+                                        3,
+                                        child.buffers[1],
+                                        static_cast<cudf::bitmask_type const*>(child.buffers[0]),
+                                        1};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(col, result);
+  child.release(&child);
+  EXPECT_EQ(child.release, nullptr);
+}
+
+TEST_F(ArrowDeviceTest, Booleans)
+{
+  auto col   = cudf::test::fixed_width_column_wrapper<bool>({true, false, true});
+  auto input = cudf::table_view{{col}};
+
+  auto const schema = cudf::to_arrow_schema(input);
+  EXPECT_EQ(std::string(schema->children[0]->format), "b");
+  auto const array = cudf::to_arrow_device(cudf::table{input});
+  EXPECT_EQ(array->array.children[0]->n_buffers, 2);
+
+  // Arrow booleans are bits, which cannot be viewed as cudf booleans
+  EXPECT_THROW(cudf::from_arrow_device(schema.get(), array.get()), cudf::logic_error);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -296,6 +296,54 @@ TYPED_TEST(DLPackNumericTests, ToDlpack2D)
   }
 }
 
+TYPED_TEST(DLPackNumericTests, ToDlpack2DRowMajor)
+{
+  using T         = TypeParam;
+  auto const col1 = cudf::test::make_type_param_vector<T>({1, 2, 3, 4});
+  auto const col2 = cudf::test::make_type_param_vector<T>({4, 5, 6, 7});
+  auto const rows = cudf::test::make_type_param_vector<T>({1, 4, 2, 5, 3, 6, 4, 7});
+  fixed_width_column_wrapper<T> first(col1.cbegin(), col1.cend());
+  fixed_width_column_wrapper<T> second(col2.cbegin(), col2.cend());
+  fixed_width_column_wrapper<T> expected(rows.cbegin(), rows.cend());
+
+  cudf::table_view input({first, second});
+  unique_managed_tensor result(cudf::to_dlpack(input, cudf::dlpack_layout::ROW_MAJOR));
+
+  auto const& tensor = result->dl_tensor;
+  validate_dtype<TypeParam>(tensor.dtype);
+  EXPECT_EQ(2, tensor.ndim);
+  EXPECT_EQ(2, tensor.strides[0]);
+  EXPECT_EQ(1, tensor.strides[1]);
+
+  constexpr cudf::data_type type{cudf::type_to_id<TypeParam>()};
+  cudf::column_view const result_view(type, 8, tensor.data);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result_view);
+
+  // Verify that from_dlpack(to_dlpack(input)) == input
+  auto roundtrip = cudf::from_dlpack(result.get());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, roundtrip->view());
+}
+
+TYPED_TEST(DLPackNumericTests, ToDlpackColumnWithoutCopy)
+{
+  fixed_width_column_wrapper<TypeParam> col({1, 2, 3, 4});
+  auto input      = col.release();
+  auto const data = input->view().head();
+  auto expected   = cudf::column(input->view());
+
+  unique_managed_tensor result(cudf::to_dlpack(std::move(input)));
+
+  auto const& tensor = result->dl_tensor;
+  validate_dtype<TypeParam>(tensor.dtype);
+  EXPECT_EQ(1, tensor.ndim);
+  EXPECT_EQ(4, tensor.shape[0]);
+  EXPECT_EQ(data, tensor.data);
+
+  constexpr cudf::data_type type{cudf::type_to_id<TypeParam>()};
+  cudf::column_view const result_view(type, tensor.shape[0], tensor.data);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result_view);
+}
+
 TYPED_TEST(DLPackNumericTests, FromDlpack1D)
 {
   // Use to_dlpack to generate an input tensor
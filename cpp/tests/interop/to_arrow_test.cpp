@@ -176,6 +176,24 @@ TEST_F(ToArrowTest, EmptyTable)
   ASSERT_EQ(expected_arrow_table->Equals(*got_arrow_table, true), true);
 }
 
+TEST_F(ToArrowTest, PinnedMemoryPool)
+{
+  auto tables = get_tables(1000);
+
+  auto cudf_table_view      = tables.first->view();
+  auto expected_arrow_table = tables.second;
+  auto struct_meta          = cudf::column_metadata{"f"};
+  struct_meta.children_meta = {{"integral"}, {"string"}};
+  auto const metadata =
+    std::vector<cudf::column_metadata>{{"a"}, {"b"}, {"c"}, {"d"}, {"e"}, struct_meta};
+
+  auto pool            = cudf::pinned_arrow_memory_pool();
+  auto got_arrow_table = cudf::to_arrow(cudf_table_view, metadata, pool);
+  EXPECT_GT(pool->bytes_allocated(), 0);
+
+  ASSERT_EQ(expected_arrow_table->Equals(*got_arrow_table, true), true);
+}
+
 TEST_F(ToArrowTest, DateTimeTable)
 {
   auto data = {1, 2, 3, 4, 5, 6};
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -27,9 +27,11 @@
 
 #include <arrow/io/api.h>
 
+#include <algorithm>
 #include <fstream>
 #include <memory>
 #include <string>
+#include <vector>
 
 // Global environment for temporary files
 auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
@@ -61,6 +63,34 @@ TEST_F(ArrowIOTest, URIFileSystem)
   ASSERT_EQ(2, tbl.tbl->num_rows());
 }
 
+TEST_F(ArrowIOTest, VectoredRead)
+{
+  std::string data(3 << 20, '\0');
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<char>(i % 251);
+  }
+  auto datasource = std::make_unique<cudf::io::arrow_io_source>(
+    std::make_shared<arrow::io::BufferReader>(arrow::Buffer::FromString(data)));
+
+  // unordered, overlapping, distant and past-the-end ranges
+  std::vector<std::pair<size_t, size_t>> const ranges{
+    {1000, 200}, {10, 50}, {1100, 300}, {(2 << 20) + 5, 100}, {data.size() - 10, 40}};
+  std::vector<std::vector<uint8_t>> outputs;
+  std::vector<cudf::io::datasource::read_request> requests;
+  for (auto const& [offset, size] : ranges) {
+    outputs.emplace_back(size);
+    requests.push_back({offset, size, outputs.back().data()});
+  }
+  EXPECT_EQ(datasource->host_read_v(requests), 200u + 50u + 300u + 100u + 10u);
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    auto const [offset, size] = ranges[i];
+    auto const read_size      = std::min(size, data.size() - offset);
+    EXPECT_TRUE(std::equal(outputs[i].begin(),
+                           outputs[i].begin() + read_size,
+                           reinterpret_cast<uint8_t const*>(data.data()) + offset));
+  }
+}
+
 #ifdef S3_ENABLED
 
 TEST_F(ArrowIOTest, S3FileSystem)
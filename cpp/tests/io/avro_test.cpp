@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <cudf/io/avro.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using int32_wrapper   = cudf::test::fixed_width_column_wrapper<int32_t>;
+using int64_wrapper   = cudf::test::fixed_width_column_wrapper<int64_t>;
+using float64_wrapper = cudf::test::fixed_width_column_wrapper<double>;
+using strings_wrapper = cudf::test::strings_column_wrapper;
+using structs_wrapper = cudf::test::structs_column_wrapper;
+using lists_wrapper   = cudf::test::lists_column_wrapper<int64_t>;
+
+constexpr char sync_marker[] = "0123456789abcdef";
+
+// Zigzag varint encoding of the ints and longs of the Avro binary encoding
+void write_long(std::vector<char>& out, int64_t value)
+{
+  auto u = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+  while (u >= 0x80) {
+    out.push_back(static_cast<char>((u & 0x7f) | 0x80));
+    u >>= 7;
+  }
+  out.push_back(static_cast<char>(u));
+}
+
+void write_double(std::vector<char>& out, double value)
+{
+  char bytes[sizeof(value)];
+  std::memcpy(bytes, &value, sizeof(value));
+  out.insert(out.end(), bytes, bytes + sizeof(value));
+}
+
+void write_string(std::vector<char>& out, std::string const& value)
+{
+  write_long(out, static_cast<int64_t>(value.size()));
+  out.insert(out.end(), value.begin(), value.end());
+}
+
+/**
+ * @brief Writes an uncompressed Avro object container file
+ *
+ * @param schema JSON schema of the objects
+ * @param blocks Number of objects and serialized objects of each data block
+ * @param user_data Metadata added to the header
+ */
+std::vector<char> make_avro_file(std::string const& schema,
+                                 std::vector<std::pair<int64_t, std::vector<char>>> const& blocks,
+                                 std::map<std::string, std::string> const& user_data = {})
+{
+  std::vector<char> out{'O', 'b', 'j', '\x01'};
+  write_long(out, static_cast<int64_t>(user_data.size() + 1));
+  write_string(out, "avro.schema");
+  write_string(out, schema);
+  for (auto const& [key, value] : user_data) {
+    write_string(out, key);
+    write_string(out, value);
+  }
+  write_long(out, 0);
+  out.insert(out.end(), sync_marker, sync_marker + 16);
+  for (auto const& [num_objects, data] : blocks) {
+    write_long(out, num_objects);
+    write_long(out, static_cast<int64_t>(data.size()));
+    out.insert(out.end(), data.begin(), data.end());
+    out.insert(out.end(), sync_marker, sync_marker + 16);
+  }
+  return out;
+}
+
+cudf::io::table_with_metadata read_avro(std::vector<char> const& file,
+                                        cudf::size_type skip_rows = 0,
+                                        cudf::size_type num_rows  = -1,
+                                        bool nested               = false)
+{
+  auto const options =
+    cudf::io::avro_reader_options::builder(cudf::io::source_info{file.data(), file.size()})
+      .skip_rows(skip_rows)
+      .num_rows(num_rows)
+      .nested(nested)
+      .build();
+  return cudf::io::read_avro(options);
+}
+
+auto const flat_schema = std::string{R"({"type": "record", "name": "root", "fields": [
+  {"name": "a", "type": "long"},
+  {"name": "b", "type": "string"},
+  {"name": "c", "type": ["null", "double"]}]})"};
+
+// Blocks of 3 and 5 rows, where `c` is null in every third row
+std::vector<char> make_flat_file(std::map<std::string, std::string> const& user_data = {})
+{
+  std::vector<std::pair<int64_t, std::vector<char>>> blocks;
+  for (auto const [first, last] : {std::pair{0, 3}, std::pair{3, 8}}) {
+    std::vector<char> data;
+    for (int i = first; i < last; ++i) {
+      write_long(data, i);
+      write_string(data, "s" + std::to_string(i));
+      write_long(data, (i % 3 == 0) ? 0 : 1);
+      if (i % 3 != 0) { write_double(data, i * 0.5); }
+    }
+    blocks.emplace_back(last - first, std::move(data));
+  }
+  return make_avro_file(flat_schema, blocks, user_data);
+}
+
+void expect_flat_rows(cudf::table_view const& result, int first, int last)
+{
+  std::vector<int64_t> a;
+  std::vector<std::string> b;
+  std::vector<double> c;
+  std::vector<bool> c_valid;
+  for (int i = first; i < last; ++i) {
+    a.push_back(i);
+    b.push_back("s" + std::to_string(i));
+    c.push_back((i % 3 == 0) ? 0 : i * 0.5);
+    c_valid.push_back(i % 3 != 0);
+  }
+  ASSERT_EQ(result.num_columns(), 3);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.column(0), int64_wrapper(a.begin(), a.end()));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.column(1), strings_wrapper(b.begin(), b.end()));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.column(2),
+                                 float64_wrapper(c.begin(), c.end(), c_valid.begin()));
+}
+
+}  // namespace
+
+struct AvroReaderTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(AvroReaderTest, MultipleBlocks)
+{
+  auto const result = read_avro(make_flat_file());
+
+  expect_flat_rows(result.tbl->view(), 0, 8);
+  EXPECT_EQ(result.metadata.column_names, (std::vector<std::string>{"a", "b", "c"}));
+}
+
+TEST_F(AvroReaderTest, SkipRowsAcrossBlocks)
+{
+  auto const result = read_avro(make_flat_file(), 2, 4);
+
+  expect_flat_rows(result.tbl->view(), 2, 6);
+}
+
+TEST_F(AvroReaderTest, SkipFirstBlock)
+{
+  auto const result = read_avro(make_flat_file(), 3);
+
+  expect_flat_rows(result.tbl->view(), 3, 8);
+}
+
+TEST_F(AvroReaderTest, LargeHeader)
+{
+  // The header does not fit in the first read of the file
+  auto const result = read_avro(make_flat_file({{"large", std::string(100'000, 'x')}}));
+
+  expect_flat_rows(result.tbl->view(), 0, 8);
+  EXPECT_EQ(result.metadata.user_data.at("large").size(), 100'000u);
+}
+
+TEST_F(AvroReaderTest, NoBlocks)
+{
+  auto const result = read_avro(make_avro_file(flat_schema, {}));
+
+  ASSERT_EQ(result.tbl->num_columns(), 3);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+}
+
+TEST_F(AvroReaderTest, CorruptSyncMarker)
+{
+  auto file = make_flat_file();
+  // The sync marker ending the last block
+  file[file.size() - 1] ^= 1;
+
+  EXPECT_THROW(read_avro(file), cudf::logic_error);
+}
+
+TEST_F(AvroReaderTest, TruncatedFile)
+{
+  auto file = make_flat_file();
+  file.resize(file.size() - 20);
+
+  EXPECT_THROW(read_avro(file), cudf::logic_error);
+}
+
+TEST_F(AvroReaderTest, TruncatedHeader)
+{
+  auto file = make_flat_file();
+  file.resize(flat_schema.size() / 2);
+
+  EXPECT_THROW(read_avro(file), cudf::logic_error);
+}
+
+TEST_F(AvroReaderTest, NestedColumns)
+{
+  auto const schema = std::string{R"({"type": "record", "name": "root", "fields": [
+    {"name": "s", "type": {"type": "record", "name": "s_t", "fields": [
+      {"name": "x", "type": "int"},
+      {"name": "y", "type": "string"}]}},
+    {"name": "l", "type": {"type": "array", "items": "long"}},
+    {"name": "o", "type": ["null", {"type": "record", "name": "o_t", "fields": [
+      {"name": "z", "type": "double"}]}]},
+    {"name": "e", "type": "int"}]})"};
+
+  std::vector<char> first_block;
+  // {"s": {"x": 1, "y": "a"}, "l": [10, 20], "o": {"z": 1.5}, "e": 7}, with the items of the array
+  // in two blocks
+  write_long(first_block, 1);
+  write_string(first_block, "a");
+  write_long(first_block, 1);
+  write_long(first_block, 10);
+  write_long(first_block, 1);
+  write_long(first_block, 20);
+  write_long(first_block, 0);
+  write_long(first_block, 1);
+  write_double(first_block, 1.5);
+  write_long(first_block, 7);
+  // {"s": {"x": 2, "y": "bb"}, "l": [], "o": null, "e": 8}
+  write_long(first_block, 2);
+  write_string(first_block, "bb");
+  write_long(first_block, 0);
+  write_long(first_block, 0);
+  write_long(first_block, 8);
+
+  std::vector<char> second_block;
+  // {"s": {"x": 3, "y": ""}, "l": [30], "o": {"z": 2.5}, "e": 9}, with the size in bytes of the
+  // block of items of the array
+  write_long(second_block, 3);
+  write_string(second_block, "");
+  write_long(second_block, -1);
+  write_long(second_block, 1);
+  write_long(second_block, 30);
+  write_long(second_block, 0);
+  write_long(second_block, 1);
+  write_double(second_block, 2.5);
+  write_long(second_block, 9);
+
+  auto const file =
+    make_avro_file(schema, {{2, std::move(first_block)}, {1, std::move(second_block)}});
+  auto const result = read_avro(file, 0, -1, true);
+
+  int32_wrapper x{1, 2, 3};
+  strings_wrapper y{"a", "bb", ""};
+  structs_wrapper s{x, y};
+  lists_wrapper l{{10, 20}, lists_wrapper{}, {30}};
+  float64_wrapper z{1.5, 0, 2.5};
+  structs_wrapper o({z}, {true, false, true});
+  int32_wrapper e{7, 8, 9};
+
+  auto const& view = result.tbl->view();
+  ASSERT_EQ(view.num_columns(), 4);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.column(0), s);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.column(1), l);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.column(2), o);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.column(3), e);
+  EXPECT_EQ(result.metadata.column_names, (std::vector<std::string>{"s", "l", "o", "e"}));
+  ASSERT_EQ(result.metadata.schema_info.size(), 4u);
+  ASSERT_EQ(result.metadata.schema_info[0].children.size(), 2u);
+  EXPECT_EQ(result.metadata.schema_info[0].children[1].name, "y");
+
+  // Without nested columns, the fields of the records are flattened and the arrays skipped
+  auto const flattened = read_avro(file);
+  EXPECT_EQ(flattened.tbl->num_columns(), 4);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(flattened.tbl->view().column(3), e);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
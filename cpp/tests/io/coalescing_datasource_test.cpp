@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <cudf/io/coalescing_datasource.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+/**
+ * @brief Host datasource that counts the reads it receives
+ */
+class counting_source : public cudf::io::datasource {
+ public:
+  counting_source(std::vector<uint8_t> const& data, std::atomic<int>& num_reads)
+    : _data(data), _num_reads(num_reads)
+  {
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    std::vector<uint8_t> data(std::min(size, _data.size() - offset));
+    host_read(offset, data.size(), data.data());
+    return buffer::create(std::move(data));
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    ++_num_reads;
+    auto const read_size = std::min(size, _data.size() - offset);
+    std::copy(_data.begin() + offset, _data.begin() + offset + read_size, dst);
+    return read_size;
+  }
+
+  [[nodiscard]] size_t size() const override { return _data.size(); }
+
+ private:
+  std::vector<uint8_t> const& _data;
+  std::atomic<int>& _num_reads;
+};
+
+struct CoalescingDatasourceTest : public cudf::test::BaseFixture {
+  CoalescingDatasourceTest() : data(1 << 20) { std::iota(data.begin(), data.end(), 0); }
+
+  std::vector<uint8_t> data;
+  std::atomic<int> num_reads{0};
+};
+
+TEST_F(CoalescingDatasourceTest, MergesAndCachesReads)
+{
+  cudf::io::coalescing_datasource coalescing(std::make_unique<counting_source>(data, num_reads),
+                                             1000);
+
+  // three ranges, two of them less than 1000 bytes apart
+  std::vector<std::vector<uint8_t>> outputs{
+    std::vector<uint8_t>(100), std::vector<uint8_t>(200), std::vector<uint8_t>(50)};
+  std::vector<cudf::io::datasource::read_request> requests{{5000, 100, outputs[0].data()},
+                                                            {100, 200, outputs[1].data()},
+                                                            {800, 50, outputs[2].data()}};
+  EXPECT_EQ(coalescing.host_read_v(requests), 350u);
+  EXPECT_EQ(num_reads, 2);
+  for (size_t i = 0; i < requests.size(); ++i) {
+    auto const expected = data.begin() + requests[i].offset;
+    EXPECT_TRUE(std::equal(outputs[i].begin(), outputs[i].end(), expected));
+  }
+
+  // sub-ranges of the merged reads are served from the cache
+  std::vector<uint8_t> cached(600);
+  EXPECT_EQ(coalescing.host_read(200, cached.size(), cached.data()), cached.size());
+  EXPECT_EQ(num_reads, 2);
+  EXPECT_TRUE(std::equal(cached.begin(), cached.end(), data.begin() + 200));
+
+  // ranges past the end are clamped
+  auto const last = coalescing.host_read((1 << 20) - 10, 100);
+  EXPECT_EQ(last->size(), 10u);
+  EXPECT_EQ(num_reads, 3);
+}
+
+TEST_F(CoalescingDatasourceTest, Prefetch)
+{
+  {
+    cudf::io::coalescing_datasource coalescing(
+      std::make_unique<counting_source>(data, num_reads), 0, 1 << 20, 4096);
+
+    // each read is followed by a read of the next 4096 bytes, which serves the next read
+    std::vector<uint8_t> output(4096);
+    coalescing.host_read(0, output.size(), output.data());
+    coalescing.host_read(4096, output.size(), output.data());
+    EXPECT_TRUE(std::equal(output.begin(), output.end(), data.begin() + 4096));
+    EXPECT_EQ(coalescing.host_read(8192, output.size(), output.data()), output.size());
+    EXPECT_TRUE(std::equal(output.begin(), output.end(), data.begin() + 8192));
+  }
+  // the first read, and one prefetch after each read; the last one ends with the datasource
+  EXPECT_EQ(num_reads, 4);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,7 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/concatenate.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/io/csv.hpp>
@@ -1072,6 +1073,123 @@ TEST_F(CsvReaderTest, ByteRangeStrings)
   expect_column_data_equal(std::vector<std::string>{"c"}, view.column(0));
 }
 
+TEST_F(CsvReaderTest, ChunkedReader)
+{
+  auto filepath = temp_env->get_temp_dir() + "ChunkedReader.csv";
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << "int,float,str\n";
+    for (int i = 0; i < 1000; ++i) {
+      outfile << i << "," << i * 0.25 << ",value" << i << "\n";
+    }
+  }
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{filepath});
+  auto const expected = cudf_io::read_csv(in_opts);
+
+  // Ranges of 100 bytes split most rows between two ranges
+  auto reader = cudf_io::chunked_csv_reader(100, in_opts);
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  while (reader.has_next()) {
+    auto chunk = reader.read_chunk();
+    EXPECT_EQ(chunk.metadata.column_names, expected.metadata.column_names);
+    chunks.push_back(std::move(chunk.tbl));
+  }
+  EXPECT_GT(chunks.size(), 1ul);
+  EXPECT_THROW(static_cast<void>(reader.read_chunk()), cudf::logic_error);
+
+  std::vector<cudf::table_view> views;
+  std::transform(chunks.begin(), chunks.end(), std::back_inserter(views), [](auto const& tbl) {
+    return tbl->view();
+  });
+  auto const result = cudf::concatenate(views);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), result->view());
+}
+
+TEST_F(CsvReaderTest, ChunkedReaderWithoutHeader)
+{
+  std::string const input = "1,a\n2,bb\n3,ccc\n4,dddd\n5,eeeee";
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{input.c_str(), input.size()})
+      .header(-1);
+  auto const expected = cudf_io::read_csv(in_opts);
+
+  auto reader = cudf_io::chunked_csv_reader(5, in_opts);
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  while (reader.has_next()) {
+    chunks.push_back(reader.read_chunk().tbl);
+  }
+  std::vector<cudf::table_view> views;
+  std::transform(chunks.begin(), chunks.end(), std::back_inserter(views), [](auto const& tbl) {
+    return tbl->view();
+  });
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), cudf::concatenate(views)->view());
+
+  in_opts.set_compression(cudf_io::compression_type::GZIP);
+  EXPECT_THROW(cudf_io::chunked_csv_reader(5, in_opts), cudf::logic_error);
+}
+
+TEST_F(CsvReaderTest, InferenceSampleRows)
+{
+  std::string const input = "A,B\n1,x\n2,y\n3,z\n4.5,w\n";
+  auto read_types         = [&](cudf::size_type sample_rows) {
+    cudf_io::csv_reader_options in_opts =
+      cudf_io::csv_reader_options::builder(cudf_io::source_info{input.c_str(), input.size()})
+        .inference_sample_rows(sample_rows);
+    auto const result = cudf_io::read_csv(in_opts);
+    EXPECT_EQ(result.tbl->num_rows(), 4);
+    return std::pair{result.tbl->get_column(0).type().id(), result.tbl->get_column(1).type().id()};
+  };
+
+  // All rows are sampled by default, or when the sample holds at least all the rows
+  EXPECT_EQ(read_types(0), std::pair(type_id::FLOAT64, type_id::STRING));
+  EXPECT_EQ(read_types(10), std::pair(type_id::FLOAT64, type_id::STRING));
+  // Only the first and third rows are sampled
+  EXPECT_EQ(read_types(2), std::pair(type_id::INT64, type_id::STRING));
+
+  EXPECT_THROW(cudf_io::csv_reader_options::builder(cudf_io::source_info{"file.csv"})
+                 .inference_sample_rows(-1),
+               cudf::logic_error);
+}
+
+TEST_F(CsvReaderTest, MultiCharDelimiter)
+{
+  std::string const input = "A||B\n1||\"x||y\"\n2||z\n3|||w\n";
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{input.c_str(), input.size()})
+      .delimiter_sequence("||");
+  auto const result = cudf_io::read_csv(in_opts);
+
+  auto const view = result.tbl->view();
+  ASSERT_EQ(view.num_columns(), 2);
+  EXPECT_EQ(result.metadata.column_names[0], "A");
+  EXPECT_EQ(result.metadata.column_names[1], "B");
+  ASSERT_EQ(view.column(0).type().id(), type_id::INT64);
+  expect_column_data_equal(std::vector<int64_t>{1, 2, 3}, view.column(0));
+  expect_column_data_equal(std::vector<std::string>{"x||y", "z", "|w"}, view.column(1));
+}
+
+TEST_F(CsvReaderTest, MultiCharLineTerminator)
+{
+  // The lone newline is part of the data, and the quoted terminator is part of the field
+  std::string const input = "A,B\r\n1,x\ny\r\n\r\n2,\"z\r\n\"\r\n3,w";
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{input.c_str(), input.size()})
+      .lineterminator_sequence("\r\n");
+  auto const result = cudf_io::read_csv(in_opts);
+
+  auto const view = result.tbl->view();
+  ASSERT_EQ(view.num_columns(), 2);
+  EXPECT_EQ(result.metadata.column_names[1], "B");
+  expect_column_data_equal(std::vector<int64_t>{1, 2, 3}, view.column(0));
+  expect_column_data_equal(std::vector<std::string>{"x\ny", "z\r\n", "w"}, view.column(1));
+
+  EXPECT_THROW(cudf_io::read_csv(cudf_io::csv_reader_options::builder(
+                                   cudf_io::source_info{input.c_str(), input.size()})
+                                   .lineterminator_sequence("123456789")),
+               cudf::logic_error);
+}
+
 TEST_F(CsvReaderTest, BlanksAndComments)
 {
   auto filepath = temp_env->get_temp_dir() + "BlanksAndComments.csv";
@@ -2200,6 +2318,37 @@ TEST_F(CsvReaderTest, DtypesMapInvalid)
   EXPECT_THROW(cudf_io::read_csv(in_opts), cudf::logic_error);
 }
 
+TEST_F(CsvReaderTest, WriterRowFormatting)
+{
+  auto const num_rows = 20;
+  auto valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto sequence   = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto int_column = column_wrapper<int32_t>(sequence, sequence + num_rows, valids);
+  auto strings    = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 4 + 1, 'a'); });
+  auto str_column  = column_wrapper<cudf::string_view>(strings, strings + num_rows);
+  auto input_table = cudf::table_view{std::vector<cudf::column_view>{int_column, str_column}};
+  std::vector<char> out_buffer;
+
+  // Three chunks of rows, with nulls and a multi-character line terminator
+  cudf_io::csv_writer_options writer_options =
+    cudf_io::csv_writer_options::builder(cudf_io::sink_info(&out_buffer), input_table)
+      .include_header(false)
+      .rows_per_chunk(8)
+      .na_rep("NA")
+      .inter_column_delimiter(';')
+      .line_terminator("\r\n");
+  cudf_io::write_csv(writer_options);
+
+  std::string expected;
+  for (int i = 0; i < num_rows; ++i) {
+    expected += (i % 3 != 0 ? std::to_string(i) : "NA") + ";" + std::string(i % 4 + 1, 'a');
+    expected += "\r\n";
+  }
+  EXPECT_EQ(std::string(out_buffer.data(), out_buffer.size()), expected);
+}
+
 TEST_F(CsvReaderTest, CsvDefaultOptionsWriteReadMatch)
 {
   auto const filepath = temp_env->get_temp_dir() + "issue.csv";
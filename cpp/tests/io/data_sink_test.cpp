@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/file_utilities.hpp>
+
+#include <cudf/io/data_sink.hpp>
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+struct DataSinkTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(DataSinkTest, FileSinkMixedWrites)
+{
+  auto const filepath = temp_env->get_temp_filepath("FileSinkMixedWrites.bin");
+
+  // Small host writes between device writes, some of them larger than the staging buffers
+  std::vector<uint8_t> expected(20 << 20);
+  std::iota(expected.begin(), expected.end(), 0);
+  auto const stream = rmm::cuda_stream_default;
+  rmm::device_buffer device_data(expected.data(), expected.size(), stream);
+  std::vector<size_t> const sizes{3, 100, 1 << 20, 7, 9 << 20, 1, 5 << 20, 4096, 2};
+  {
+    auto sink     = cudf::io::data_sink::create(filepath);
+    size_t offset = 0;
+    for (size_t i = 0; i < sizes.size(); ++i) {
+      if (i % 2 == 0) {
+        sink->host_write(expected.data() + offset, sizes[i]);
+      } else {
+        auto const src = static_cast<uint8_t const*>(device_data.data()) + offset;
+        ASSERT_TRUE(sink->supports_device_write());
+        sink->device_write_async(src, sizes[i], stream).wait();
+      }
+      offset += sizes[i];
+      EXPECT_EQ(sink->bytes_written(), offset);
+    }
+    sink->flush();
+  }
+
+  auto const total_size = std::accumulate(sizes.begin(), sizes.end(), size_t{0});
+  std::ifstream file(filepath, std::ios::binary);
+  std::vector<uint8_t> const written{std::istreambuf_iterator<char>(file), {}};
+  ASSERT_EQ(written.size(), total_size);
+  EXPECT_TRUE(std::equal(written.begin(), written.end(), expected.begin()));
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/io_uring_reader.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+struct IoUringReaderTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(IoUringReaderTest, ScatteredReads)
+{
+  auto reader = cudf::io::detail::io_uring_reader::create(8);
+  if (reader == nullptr) { GTEST_SKIP() << "io_uring is not available"; }
+
+  std::vector<uint8_t> data(1 << 20);
+  std::iota(data.begin(), data.end(), 0);
+  auto const filepath = temp_env->get_temp_filepath("ScatteredReads.bin");
+  std::ofstream(filepath, std::ios::binary)
+    .write(reinterpret_cast<char const*>(data.data()), data.size());
+  auto const fd = open(filepath.c_str(), O_RDONLY);
+  ASSERT_GE(fd, 0);
+
+  // more reads than the depth of the queue, of different sizes
+  std::vector<std::vector<uint8_t>> outputs(50);
+  std::vector<cudf::io::detail::host_read_request> requests;
+  for (size_t i = 0; i < outputs.size(); ++i) {
+    auto const offset = (i * 7919 * 13) % (data.size() / 2);
+    outputs[i].resize(i * 1000);
+    requests.push_back({offset, outputs[i].size(), outputs[i].data()});
+  }
+  reader->read(fd, requests);
+  for (size_t i = 0; i < outputs.size(); ++i) {
+    auto const expected = data.begin() + requests[i].offset;
+    EXPECT_TRUE(std::equal(outputs[i].begin(), outputs[i].end(), expected));
+  }
+
+  // ranges past the end of the file cannot be read completely
+  std::vector<uint8_t> past_end(100);
+  std::vector<cudf::io::detail::host_read_request> invalid{
+    {data.size() - 10, past_end.size(), past_end.data()}};
+  EXPECT_THROW(reader->read(fd, invalid), cudf::logic_error);
+
+  close(fd);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
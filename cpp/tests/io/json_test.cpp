@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,8 +18,11 @@
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/json.hpp>
@@ -30,6 +33,7 @@
 #include <arrow/io/api.h>
 
 #include <fstream>
+#include <limits>
 #include <type_traits>
 
 #define wrapper cudf::test::fixed_width_column_wrapper
@@ -915,4 +919,247 @@ TEST_F(JsonReaderTest, BadDtypeParams)
   EXPECT_THROW(cudf_io::read_json(options_map), cudf::logic_error);
 }
 
+TEST_F(JsonReaderTest, JsonLinesObjectsUseColsNames)
+{
+  std::string const data =
+    "{\"a\": 1, \"b\": \"skipped\", \"c\": 2.5}\n"
+    "{\"c\": 3.5, \"d\": 7}\n"
+    "{\"b\": \"x\", \"a\": 3}\n";
+
+  cudf_io::json_reader_options in_options =
+    cudf_io::json_reader_options::builder(cudf_io::source_info{data.data(), data.size()})
+      .lines(true)
+      .use_cols_names({"c", "a", "z"});
+
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_options);
+
+  EXPECT_EQ(result.tbl->num_columns(), 3);
+  EXPECT_EQ(result.tbl->num_rows(), 3);
+  EXPECT_EQ(result.metadata.column_names, (std::vector<std::string>{"c", "a", "z"}));
+
+  // Fields missing from a record are null; "z" is in no record
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0),
+                                 float64_wrapper{{2.5, 3.5, 0.}, {true, true, false}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(1),
+                                 float64_wrapper{{1., 0., 3.}, {true, false, true}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(2),
+                                 int8_wrapper{{0, 0, 0}, {false, false, false}});
+}
+
+TEST_F(JsonReaderTest, JsonLinesArraysUseColsNames)
+{
+  std::string const data = "[1, 2]\n[3, 4]\n";
+
+  cudf_io::json_reader_options in_options =
+    cudf_io::json_reader_options::builder(cudf_io::source_info{data.data(), data.size()})
+      .lines(true)
+      .use_cols_names({"0"});
+
+  // should throw because array rows have no field names
+  EXPECT_THROW(cudf_io::read_json(in_options), cudf::logic_error);
+}
+
+TEST_F(JsonReaderTest, ChunkedReader)
+{
+  std::string data;
+  for (int i = 0; i < 500; ++i) {
+    data += "{\"id\": " + std::to_string(i) + ", \"value\": " + std::to_string(i * 0.5) +
+            ", \"name\": \"row" + std::to_string(i) + "\"}\n";
+  }
+  // A field the first records do not have is not read
+  data += "{\"id\": 500, \"extra\": 1, \"value\": 250.0, \"name\": \"row500\"}\n";
+
+  cudf_io::json_reader_options in_options =
+    cudf_io::json_reader_options::builder(cudf_io::source_info{data.data(), data.size()})
+      .lines(true)
+      .use_cols_names({"id", "value", "name"});
+  auto const expected = cudf_io::read_json(in_options);
+
+  in_options.set_use_cols_names({});
+  // Ranges of 100 bytes split most records between two ranges
+  auto reader = cudf_io::chunked_json_reader(100, in_options);
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  while (reader.has_next()) {
+    auto chunk = reader.read_chunk();
+    EXPECT_EQ(chunk.metadata.column_names, expected.metadata.column_names);
+    chunks.push_back(std::move(chunk.tbl));
+  }
+  EXPECT_GT(chunks.size(), 1ul);
+  EXPECT_THROW(static_cast<void>(reader.read_chunk()), cudf::logic_error);
+
+  std::vector<cudf::table_view> views;
+  std::transform(chunks.begin(), chunks.end(), std::back_inserter(views), [](auto const& tbl) {
+    return tbl->view();
+  });
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), cudf::concatenate(views)->view());
+}
+
+TEST_F(JsonReaderTest, ChunkedReaderArrays)
+{
+  std::string const data = "[1, 1.5]\n[2, 2.5]\n[3, 3.5]\n[4, 4.5]";
+  cudf_io::json_reader_options in_options =
+    cudf_io::json_reader_options::builder(cudf_io::source_info{data.data(), data.size()})
+      .lines(true);
+  auto const expected = cudf_io::read_json(in_options);
+
+  auto reader = cudf_io::chunked_json_reader(7, in_options);
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  while (reader.has_next()) {
+    chunks.push_back(reader.read_chunk().tbl);
+  }
+  std::vector<cudf::table_view> views;
+  std::transform(chunks.begin(), chunks.end(), std::back_inserter(views), [](auto const& tbl) {
+    return tbl->view();
+  });
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), cudf::concatenate(views)->view());
+
+  in_options.set_byte_range_size(8);
+  EXPECT_THROW(cudf_io::chunked_json_reader(7, in_options), cudf::logic_error);
+}
+
+TEST_F(JsonReaderTest, NestedJsonLines)
+{
+  std::string const buffer =
+    "{\"a\": 1, \"b\": {\"c\": \"x\", \"d\": [1, 2]}}\n"
+    "{\"b\": {\"d\": []}, \"a\": null}\n"
+    "{\"a\": 3, \"b\": {\"c\": \"z,{q\", \"d\": [3]}}\n";
+
+  cudf_io::json_reader_options in_options =
+    cudf_io::json_reader_options::builder(cudf_io::source_info{buffer.c_str(), buffer.size()})
+      .lines(true)
+      .nested(true);
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_options);
+
+  ASSERT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.metadata.column_names[0], "a");
+  EXPECT_EQ(result.metadata.column_names[1], "b");
+  ASSERT_EQ(result.metadata.schema_info[1].children.size(), 2);
+  EXPECT_EQ(result.metadata.schema_info[1].children[0].name, "c");
+  EXPECT_EQ(result.metadata.schema_info[1].children[1].name, "d");
+
+  auto const a = cudf::test::strings_column_wrapper({"1", "", "3"}, {true, false, true});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result.tbl->get_column(0), a);
+
+  auto c = cudf::test::strings_column_wrapper({"x", "", "z,{q"}, {true, false, true});
+  auto d = cudf::test::lists_column_wrapper<cudf::string_view>{{"1", "2"}, {}, {"3"}};
+  auto const b = cudf::test::structs_column_wrapper({c, d});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result.tbl->get_column(1), b);
+}
+
+TEST_F(JsonReaderTest, NestedJsonLinesMixedTypes)
+{
+  std::string const buffer = "{\"a\": 1}\n{\"a\": {\"b\": 2}}\n";
+
+  cudf_io::json_reader_options in_options =
+    cudf_io::json_reader_options::builder(cudf_io::source_info{buffer.c_str(), buffer.size()})
+      .lines(true)
+      .nested(true);
+  EXPECT_THROW(cudf_io::read_json(in_options), cudf::logic_error);
+}
+
+struct JsonWriterTest : public cudf::test::BaseFixture {
+  std::string write(cudf::table_view const& input,
+                    cudf_io::table_metadata const* metadata,
+                    cudf::size_type rows_per_chunk,
+                    bool include_nulls = true)
+  {
+    std::vector<char> out_buffer;
+    cudf_io::json_writer_options options =
+      cudf_io::json_writer_options::builder(cudf_io::sink_info(&out_buffer), input)
+        .metadata(metadata)
+        .rows_per_chunk(rows_per_chunk)
+        .include_nulls(include_nulls);
+    cudf_io::write_json(options);
+    return std::string(out_buffer.data(), out_buffer.size());
+  }
+};
+
+TEST_F(JsonWriterTest, FlatColumns)
+{
+  int_wrapper ints{{1, -2, 3}, {1, 0, 1}};
+  column_wrapper<cudf::string_view> strings{"a", "q\"b\\", "line\n\x01"};
+  bool_wrapper bools{true, false, true};
+  float64_wrapper floats{1.5, std::numeric_limits<double>::quiet_NaN(), -0.25};
+  timestamp_ms_wrapper times{0, 1000, 1500};
+  cudf::table_view const input{{ints, strings, bools, floats, times}};
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"i", "s", "b", "f", "t"};
+
+  std::string const expected =
+    R"({"i":1,"s":"a","b":true,"f":1.5,"t":"1970-01-01T00:00:00.000Z"})"
+    "\n"
+    R"({"i":null,"s":"q\"b\\","b":false,"f":null,"t":"1970-01-01T00:00:01.000Z"})"
+    "\n"
+    R"({"i":3,"s":"line\n\u0001","b":true,"f":-0.25,"t":"1970-01-01T00:00:01.500Z"})"
+    "\n";
+  EXPECT_EQ(write(input, &metadata, 2), expected);
+}
+
+TEST_F(JsonWriterTest, NestedColumns)
+{
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i != 1; });
+  int_wrapper x{{1, 2, 3, 4}, {1, 1, 0, 1}};
+  cudf::test::lists_column_wrapper<int> y{{1, 2}, {}, {{3, 0}, valids}, {4, 5}};
+  cudf::test::structs_column_wrapper s({x, y}, {1, 1, 1, 0});
+  cudf::test::lists_column_wrapper<cudf::string_view> tags{{"a"}, {"b", "c"}, {}, {"d"}};
+  cudf::table_view const input{{s, tags}};
+  cudf_io::table_metadata metadata;
+  metadata.schema_info.emplace_back("s");
+  metadata.schema_info[0].children = {cudf_io::column_name_info{"x"},
+                                      cudf_io::column_name_info{"y"}};
+  metadata.schema_info.emplace_back("tags");
+
+  std::string const expected =
+    R"({"s":{"x":1,"y":[1,2]},"tags":["a"]})"
+    "\n"
+    R"({"s":{"x":2,"y":[]},"tags":["b","c"]})"
+    "\n"
+    R"({"s":{"x":null,"y":[3,null]},"tags":[]})"
+    "\n"
+    R"({"s":null,"tags":["d"]})"
+    "\n";
+  EXPECT_EQ(write(input, &metadata, 1), expected);
+  EXPECT_EQ(write(input, &metadata, 4), expected);
+
+  // Fields holding nulls are left out, but not null elements of lists
+  std::string const expected_without_nulls =
+    R"({"s":{"x":1,"y":[1,2]},"tags":["a"]})"
+    "\n"
+    R"({"s":{"x":2,"y":[]},"tags":["b","c"]})"
+    "\n"
+    R"({"s":{"y":[3,null]},"tags":[]})"
+    "\n"
+    R"({"tags":["d"]})"
+    "\n";
+  EXPECT_EQ(write(input, &metadata, 3, false), expected_without_nulls);
+
+  // Sliced columns, without names
+  auto const sliced = cudf::slice(input, {1, 3})[0];
+  std::string const expected_sliced =
+    R"({"0":{"0":2,"1":[]},"1":["b","c"]})"
+    "\n"
+    R"({"0":{"0":null,"1":[3,null]},"1":[]})"
+    "\n";
+  EXPECT_EQ(write(sliced, nullptr, 1), expected_sliced);
+}
+
+TEST_F(JsonWriterTest, EmptyTable)
+{
+  int_wrapper ints{};
+  EXPECT_EQ(write(cudf::table_view{{ints}}, nullptr, 8), "");
+}
+
+TEST_F(JsonWriterTest, InvalidArguments)
+{
+  int_wrapper ints{1, 2};
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"a", "b"};
+  EXPECT_THROW(write(cudf::table_view{{ints}}, &metadata, 8), cudf::logic_error);
+  EXPECT_THROW(write(cudf::table_view{{ints}}, nullptr, 0), cudf::logic_error);
+
+  cudf::test::dictionary_column_wrapper<int> dictionary{1, 2};
+  EXPECT_THROW(write(cudf::table_view{{dictionary}}, nullptr, 8), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
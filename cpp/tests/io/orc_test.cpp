@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,11 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <io/comp/nvcomp_adapter.hpp>
+#include <io/orc/bloom_filter.hpp>
+#include <io/orc/orc.h>
+
+#include <cudf/ast/expressions.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
@@ -33,6 +38,8 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <type_traits>
 
 namespace cudf_io = cudf::io;
@@ -92,6 +99,39 @@ std::unique_ptr<cudf::table> create_random_fixed_table(cudf::size_type num_colum
   return std::make_unique<cudf::table>(std::move(columns));
 }
 
+// Returns the footer of a stripe, to check how the writer encoded the stripe
+cudf::io::orc::StripeFooter read_stripe_footer(cudf::io::orc::metadata const& md, int stripe_idx)
+{
+  auto const& stripe       = md.ff.stripes[stripe_idx];
+  auto const footer_offset = stripe.offset + stripe.indexLength + stripe.dataLength;
+  auto const buffer        = md.source->host_read(footer_offset, stripe.footerLength);
+  size_t length   = 0;
+  auto const data = md.decompressor->Decompress(buffer->data(), buffer->size(), &length);
+  cudf::io::orc::StripeFooter footer;
+  cudf::io::orc::ProtobufReader(data, length).read(footer);
+  return footer;
+}
+
+// Returns the decompressed content of the first stream of the given kind and column of a stripe
+std::vector<uint8_t> read_stripe_stream(cudf::io::orc::metadata const& md,
+                                        int stripe_idx,
+                                        cudf::io::orc::StreamKind kind,
+                                        uint32_t column_id)
+{
+  auto const footer  = read_stripe_footer(md, stripe_idx);
+  auto stream_offset = md.ff.stripes[stripe_idx].offset;
+  for (auto const& stream : footer.streams) {
+    if (stream.kind == kind and stream.column_id == column_id) {
+      auto const buffer = md.source->host_read(stream_offset, stream.length);
+      size_t length     = 0;
+      auto const data   = md.decompressor->Decompress(buffer->data(), buffer->size(), &length);
+      return {data, data + length};
+    }
+    stream_offset += stream.length;
+  }
+  return {};
+}
+
 // Base test fixture for tests
 struct OrcWriterTest : public cudf::test::BaseFixture {
 };
@@ -525,6 +565,237 @@ TEST_F(OrcWriterTest, Strings)
   cudf::test::expect_metadata_equal(expected_metadata, result.metadata);
 }
 
+TEST_F(OrcWriterTest, NvcompCompression)
+{
+  constexpr auto num_rows = 20000;
+  auto ints    = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 300; });
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value" + std::to_string(i % 500); });
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+
+  int64_col col0(ints, ints + num_rows, validity);
+  str_col col1(strings, strings + num_rows);
+  table_view expected({col0, col1});
+
+  std::vector<std::pair<cudf_io::compression_type, cudf::io::nvcomp::compression_type>> formats{
+    {cudf_io::compression_type::ZSTD, cudf::io::nvcomp::compression_type::ZSTD},
+    {cudf_io::compression_type::LZ4, cudf::io::nvcomp::compression_type::LZ4}};
+  for (auto const& [compression, nvcomp_type] : formats) {
+    if (not cudf::io::nvcomp::is_compression_supported(nvcomp_type)) { continue; }
+
+    std::vector<char> out_buffer;
+    cudf_io::orc_writer_options out_opts =
+      cudf_io::orc_writer_options::builder(cudf_io::sink_info{&out_buffer}, expected)
+        .compression(compression);
+    cudf_io::write_orc(out_opts);
+
+    std::vector<char> uncompressed_buffer;
+    cudf_io::orc_writer_options uncompressed_opts =
+      cudf_io::orc_writer_options::builder(cudf_io::sink_info{&uncompressed_buffer}, expected)
+        .compression(cudf_io::compression_type::NONE);
+    cudf_io::write_orc(uncompressed_opts);
+    EXPECT_LT(out_buffer.size(), uncompressed_buffer.size());
+
+    cudf_io::orc_reader_options in_opts = cudf_io::orc_reader_options::builder(
+      cudf_io::source_info{out_buffer.data(), out_buffer.size()});
+    auto result = cudf_io::read_orc(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  }
+}
+
+TEST_F(OrcWriterTest, ZlibCompression)
+{
+  constexpr auto num_rows = 20000;
+  auto ints    = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 300; });
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value" + std::to_string(i % 500); });
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+
+  int64_col col0(ints, ints + num_rows, validity);
+  str_col col1(strings, strings + num_rows);
+  table_view expected({col0, col1});
+
+  std::vector<char> out_buffer;
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{&out_buffer}, expected)
+      .compression(cudf_io::compression_type::ZLIB);
+  cudf_io::write_orc(out_opts);
+
+  std::vector<char> uncompressed_buffer;
+  cudf_io::orc_writer_options uncompressed_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{&uncompressed_buffer}, expected)
+      .compression(cudf_io::compression_type::NONE);
+  cudf_io::write_orc(uncompressed_opts);
+  EXPECT_LT(out_buffer.size(), uncompressed_buffer.size());
+
+  cudf_io::orc_reader_options in_opts = cudf_io::orc_reader_options::builder(
+    cudf_io::source_info{out_buffer.data(), out_buffer.size()});
+  auto result = cudf_io::read_orc(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+TEST_F(OrcWriterTest, BloomFilters)
+{
+  constexpr auto num_rows = 30000;
+  auto ints    = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * 3; });
+  auto doubles = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * 0.5; });
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value" + std::to_string(i); });
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+
+  int64_col col0(ints, ints + num_rows, validity);
+  float64_col col1(doubles, doubles + num_rows);
+  str_col col2(strings, strings + num_rows, validity);
+  table_view expected({col0, col1, col2});
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  for (auto& col_meta : expected_metadata.column_metadata) {
+    col_meta.set_bloom_filter(true);
+  }
+
+  for (auto compression : {cudf_io::compression_type::NONE, cudf_io::compression_type::SNAPPY}) {
+    std::vector<char> out_buffer;
+    cudf_io::orc_writer_options out_opts =
+      cudf_io::orc_writer_options::builder(cudf_io::sink_info{&out_buffer}, expected)
+        .compression(compression)
+        .metadata(&expected_metadata);
+    cudf_io::write_orc(out_opts);
+
+    std::vector<char> no_filter_buffer;
+    cudf_io::orc_writer_options no_filter_opts =
+      cudf_io::orc_writer_options::builder(cudf_io::sink_info{&no_filter_buffer}, expected)
+        .compression(compression);
+    cudf_io::write_orc(no_filter_opts);
+    EXPECT_GT(out_buffer.size(), no_filter_buffer.size());
+
+    cudf_io::orc_reader_options in_opts = cudf_io::orc_reader_options::builder(
+      cudf_io::source_info{out_buffer.data(), out_buffer.size()});
+    auto result = cudf_io::read_orc(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+    // Each column has a BLOOM_FILTER_UTF8 stream with a filter per rowgroup of 10000 rows, in
+    // which the bits of the first valid row of its rowgroup are set
+    auto const source =
+      cudf_io::datasource::create(cudf_io::host_buffer{out_buffer.data(), out_buffer.size()});
+    cudf::io::orc::metadata const md(source.get());
+    ASSERT_EQ(md.get_num_stripes(), 1);
+    for (uint32_t column_id = 1; column_id <= 3; ++column_id) {
+      auto const stream = read_stripe_stream(md, 0, cudf::io::orc::BLOOM_FILTER_UTF8, column_id);
+      ASSERT_FALSE(stream.empty());
+      cudf::io::orc::BloomFilterIndex index;
+      cudf::io::orc::ProtobufReader(stream.data(), stream.size()).read(index);
+      ASSERT_EQ(index.bloomFilter.size(), 3u);
+      for (int rg = 0; rg < 3; ++rg) {
+        auto const& filter = index.bloomFilter[rg];
+        ASSERT_GT(filter.numHashFunctions, 0u);
+        ASSERT_FALSE(filter.utf8bitset.empty());
+        ASSERT_EQ(filter.utf8bitset.size() % 8, 0u);
+
+        auto const row = rg * 10000 + 1;
+        uint64_t hash  = 0;
+        if (column_id == 1) {
+          hash = cudf::io::orc::bloom_filter_long_hash(ints[row]);
+        } else if (column_id == 2) {
+          double const value = doubles[row];
+          int64_t bits;
+          std::memcpy(&bits, &value, sizeof(bits));
+          hash = cudf::io::orc::bloom_filter_long_hash(bits);
+        } else {
+          auto const value = strings[row];
+          hash             = cudf::io::orc::murmur3_hash64(
+            reinterpret_cast<uint8_t const*>(value.data()), value.size());
+        }
+        auto const num_bits = static_cast<uint32_t>(filter.utf8bitset.size() * 8);
+        for (uint32_t i = 1; i <= filter.numHashFunctions; ++i) {
+          auto const bit = cudf::io::orc::bloom_filter_bit(hash, i, num_bits);
+          EXPECT_TRUE(filter.utf8bitset[bit / 8] & (1 << (bit % 8)));
+        }
+      }
+    }
+  }
+}
+
+TEST_F(OrcWriterTest, BloomFilterHashes)
+{
+  // Values of `Murmur3.hash64` with the default seed, and of `BloomFilter.getLongHash`, of the ORC
+  // Java library; strings of eight bytes or more also go through the block loop of Murmur3
+  auto murmur3 = [](std::string const& input) {
+    return cudf::io::orc::murmur3_hash64(reinterpret_cast<uint8_t const*>(input.data()),
+                                         input.size());
+  };
+  EXPECT_EQ(murmur3(""), 0x74A18DC8F20ADB48ULL);
+  EXPECT_EQ(murmur3("a"), 0xDDD9B0AF19F61187ULL);
+  EXPECT_EQ(murmur3("abc"), 0xC76F181BE3EEA0CEULL);
+  EXPECT_EQ(murmur3("hello world!"), 0xE1D4853D8EC0C40CULL);
+  EXPECT_EQ(murmur3("The quick brown fox jumps over the lazy dog"), 0xB34AA68A89E971E8ULL);
+
+  EXPECT_EQ(cudf::io::orc::bloom_filter_long_hash(0), 0ULL);
+  EXPECT_EQ(cudf::io::orc::bloom_filter_long_hash(1), 0x5BCA7C69B794F8CEULL);
+  EXPECT_EQ(cudf::io::orc::bloom_filter_long_hash(-1), 0x5BCA868437950D03ULL);
+  EXPECT_EQ(cudf::io::orc::bloom_filter_long_hash(123456789), 0xE61EF031A43FDAF8ULL);
+}
+
+TEST_F(OrcWriterTest, DictionaryThreshold)
+{
+  constexpr auto num_rows = 20000;
+  auto low_card = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "low_cardinality_" + std::to_string(i % 10); });
+  auto mid_card = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "medium_cardinality_" + std::to_string(i % 5000); });
+  auto high_card = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "high_cardinality_" + std::to_string(i); });
+
+  str_col col0(low_card, low_card + num_rows);
+  str_col col1(mid_card, mid_card + num_rows);
+  str_col col2(high_card, high_card + num_rows);
+  table_view expected({col0, col1, col2});
+
+  // Returns the encoding of each column in the only stripe of the file
+  auto write = [&](double threshold) {
+    std::vector<char> out_buffer;
+    cudf_io::orc_writer_options out_opts =
+      cudf_io::orc_writer_options::builder(cudf_io::sink_info{&out_buffer}, expected)
+        .dictionary_threshold(threshold);
+    cudf_io::write_orc(out_opts);
+
+    cudf_io::orc_reader_options in_opts = cudf_io::orc_reader_options::builder(
+      cudf_io::source_info{out_buffer.data(), out_buffer.size()});
+    auto result = cudf_io::read_orc(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+    auto const source =
+      cudf_io::datasource::create(cudf_io::host_buffer{out_buffer.data(), out_buffer.size()});
+    cudf::io::orc::metadata const md(source.get());
+    EXPECT_EQ(md.get_num_stripes(), 1);
+    auto const footer = read_stripe_footer(md, 0);
+    std::vector<cudf::io::orc::ColumnEncodingKind> encodings;
+    // The encoding of column 0, the root struct, is left out
+    std::transform(footer.columns.cbegin() + 1,
+                   footer.columns.cend(),
+                   std::back_inserter(encodings),
+                   [](auto const& encoding) { return encoding.kind; });
+    return encodings;
+  };
+
+  using cudf::io::orc::DICTIONARY_V2;
+  using cudf::io::orc::DIRECT_V2;
+  using encodings = std::vector<cudf::io::orc::ColumnEncodingKind>;
+  // The distinct strings are 0.05% of the first column, 25% of the second and all of the third;
+  // the estimates of the distinct strings are far enough from the thresholds to be exact here
+  EXPECT_EQ(write(0.0), (encodings{DIRECT_V2, DIRECT_V2, DIRECT_V2}));
+  EXPECT_EQ(write(0.1), (encodings{DICTIONARY_V2, DIRECT_V2, DIRECT_V2}));
+  EXPECT_EQ(write(cudf::io::default_dictionary_threshold),
+            (encodings{DICTIONARY_V2, DICTIONARY_V2, DIRECT_V2}));
+  // Without the estimate, the third column is left out as its dictionary is not smaller
+  EXPECT_EQ(write(1.0), (encodings{DICTIONARY_V2, DICTIONARY_V2, DIRECT_V2}));
+
+  std::vector<char> out_buffer;
+  EXPECT_THROW(static_cast<void>(
+                 cudf_io::orc_writer_options::builder(cudf_io::sink_info{&out_buffer}, expected)
+                   .dictionary_threshold(1.5)),
+               cudf::logic_error);
+}
+
 TEST_F(OrcWriterTest, SlicedTable)
 {
   // This test checks for writing zero copy, offsetted views into existing cudf tables
@@ -1312,6 +1583,220 @@ TEST_F(OrcWriterTest, StripeSizeInvalid)
     cudf::logic_error);
 }
 
+TEST_F(OrcReaderTest, FilterStripes)
+{
+  constexpr auto num_rows = 20000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto doubles  = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * 0.5; });
+  auto strings  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "payload_" + std::to_string(i); });
+  int32_col col0(sequence, sequence + num_rows);
+  float64_col col1(doubles, doubles + num_rows);
+  str_col col2(strings, strings + num_rows);
+  table_view expected({col0, col1, col2});
+
+  // four stripes of 5000 rows each
+  std::vector<char> out_buffer;
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+      .stripe_size_rows(5000);
+  cudf_io::write_orc(out_opts);
+
+  auto read_filtered = [&](cudf::ast::expression const& filter,
+                           std::vector<std::vector<cudf::size_type>> stripes = {}) {
+    cudf_io::orc_reader_options in_opts =
+      cudf_io::orc_reader_options::builder(
+        cudf_io::source_info(out_buffer.data(), out_buffer.size()))
+        .stripes(std::move(stripes))
+        .filter(filter);
+    return cudf_io::read_orc(in_opts);
+  };
+  auto expected_rows = [&](std::vector<cudf::size_type> const& ranges) {
+    return cudf::concatenate(cudf::slice(expected, ranges));
+  };
+
+  auto ref0 = cudf::ast::column_reference(0);
+  auto ref1 = cudf::ast::column_reference(1);
+
+  // conjunction selecting rows of the third stripe
+  {
+    auto low        = cudf::numeric_scalar<int32_t>(12000);
+    auto high       = cudf::numeric_scalar<int32_t>(13000);
+    auto low_lit    = cudf::ast::literal(low);
+    auto high_lit   = cudf::ast::literal(high);
+    auto above_low  = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, ref0, low_lit);
+    auto below_high = cudf::ast::operation(cudf::ast::ast_operator::LESS, ref0, high_lit);
+    auto filter =
+      cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, above_low, below_high);
+    auto result = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected_rows({12000, 13000})->view(), result.tbl->view());
+  }
+  // literal on the left-hand side, on a floating point column
+  {
+    auto value  = cudf::numeric_scalar<double>(8000.);
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::operation(cudf::ast::ast_operator::LESS_EQUAL, lit, ref1);
+    auto result = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected_rows({16000, 20000})->view(), result.tbl->view());
+
+    // only the selected stripes are considered
+    result = read_filtered(filter, {{0, 1}});
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+  // no stripe can match
+  {
+    auto value  = cudf::numeric_scalar<int32_t>(num_rows);
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, ref0, lit);
+    auto result = read_filtered(filter);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+    EXPECT_EQ(result.tbl->num_columns(), expected.num_columns());
+  }
+
+  // a filter excludes skip_rows and num_rows
+  auto value  = cudf::numeric_scalar<int32_t>(10);
+  auto lit    = cudf::ast::literal(value);
+  auto filter = cudf::ast::operation(cudf::ast::ast_operator::LESS, ref0, lit);
+  auto opts   = cudf_io::orc_reader_options::builder(
+                cudf_io::source_info(out_buffer.data(), out_buffer.size()))
+                .skip_rows(10)
+                .build();
+  EXPECT_THROW(opts.set_filter(filter), cudf::logic_error);
+}
+
+TEST_F(OrcReaderTest, FilterRowGroups)
+{
+  constexpr auto num_rows = 20000;
+  // rowgroups of 5000 rows hold values in [0, 5000), [10000, 15000), [20000, 25000) and
+  // [30000, 35000), so that the gaps between them only show in the row index
+  auto values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return (i / 5000) * 10000 + i % 5000; });
+  int32_col col0(values, values + num_rows);
+  table_view expected({col0});
+
+  // two stripes of two rowgroups each
+  std::vector<char> out_buffer;
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+      .stripe_size_rows(10000)
+      .row_index_stride(5000);
+  cudf_io::write_orc(out_opts);
+
+  auto read_filtered = [&](cudf::ast::expression const& filter) {
+    cudf_io::orc_reader_options in_opts =
+      cudf_io::orc_reader_options::builder(
+        cudf_io::source_info(out_buffer.data(), out_buffer.size()))
+        .filter(filter)
+        .profile(true);
+    return cudf_io::read_orc(in_opts);
+  };
+  auto ref0 = cudf::ast::column_reference(0);
+
+  // within the range of the first stripe, but of none of its rowgroups
+  {
+    auto value  = cudf::numeric_scalar<int32_t>(7000);
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, ref0, lit);
+    auto result = read_filtered(filter);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+    EXPECT_EQ(result.metadata.profile->pages_skipped, 2u);
+  }
+  // held by the second rowgroup of the first stripe
+  {
+    auto value  = cudf::numeric_scalar<int32_t>(12000);
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, ref0, lit);
+    auto result = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {7000, 7001})[0], result.tbl->view());
+    EXPECT_EQ(result.metadata.profile->pages_skipped, 1u);
+  }
+  // within the range of the second stripe, between its rowgroups
+  {
+    auto low        = cudf::numeric_scalar<int32_t>(25000);
+    auto high       = cudf::numeric_scalar<int32_t>(30000);
+    auto low_lit    = cudf::ast::literal(low);
+    auto high_lit   = cudf::ast::literal(high);
+    auto above_low  = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, ref0, low_lit);
+    auto below_high = cudf::ast::operation(cudf::ast::ast_operator::LESS, ref0, high_lit);
+    auto filter =
+      cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, above_low, below_high);
+    auto result = read_filtered(filter);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+    EXPECT_EQ(result.metadata.profile->pages_skipped, 2u);
+  }
+}
+
+TEST_F(OrcReaderTest, ChunkedRead)
+{
+  constexpr auto num_rows = 20000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto doubles  = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * 0.5; });
+  int32_col col0(sequence, sequence + num_rows);
+  float64_col col1(doubles, doubles + num_rows);
+  table_view expected({col0, col1});
+
+  // four stripes of 5000 rows, each decoding to about 60KB
+  std::vector<char> out_buffer;
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+      .stripe_size_rows(5000);
+  cudf_io::write_orc(out_opts);
+
+  auto read_chunks = [&](std::size_t chunk_read_limit, cudf_io::orc_reader_options const& opts) {
+    auto reader = cudf_io::chunked_orc_reader(chunk_read_limit, opts);
+    std::vector<std::unique_ptr<cudf::table>> chunks;
+    while (reader.has_next()) {
+      chunks.push_back(std::move(reader.read_chunk().tbl));
+    }
+    EXPECT_THROW(static_cast<void>(reader.read_chunk()), cudf::logic_error);
+    return chunks;
+  };
+  auto concatenate = [](std::vector<std::unique_ptr<cudf::table>> const& chunks) {
+    std::vector<table_view> views;
+    std::transform(chunks.cbegin(), chunks.cend(), std::back_inserter(views), [](auto& chunk) {
+      return chunk->view();
+    });
+    return cudf::concatenate(views);
+  };
+  auto const source = cudf_io::source_info(out_buffer.data(), out_buffer.size());
+
+  // two stripes per chunk
+  {
+    auto const chunks = read_chunks(130'000, cudf_io::orc_reader_options::builder(source));
+    EXPECT_EQ(chunks.size(), 2);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, concatenate(chunks)->view());
+  }
+  // no limit
+  {
+    auto const chunks = read_chunks(0, cudf_io::orc_reader_options::builder(source));
+    EXPECT_EQ(chunks.size(), 1);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, chunks[0]->view());
+  }
+  // a row range starting and ending within stripes
+  {
+    auto const chunks = read_chunks(
+      70'000, cudf_io::orc_reader_options::builder(source).skip_rows(2500).num_rows(10000));
+    EXPECT_GT(chunks.size(), 1);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {2500, 12500})[0],
+                                  concatenate(chunks)->view());
+  }
+  // selected stripes, one per chunk
+  {
+    auto const chunks =
+      read_chunks(1, cudf_io::orc_reader_options::builder(source).stripes({{3, 1}}));
+    ASSERT_EQ(chunks.size(), 2);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {15000, 20000})[0], chunks[0]->view());
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {5000, 10000})[0], chunks[1]->view());
+  }
+  // an empty selection yields one empty table
+  {
+    auto const chunks =
+      read_chunks(1, cudf_io::orc_reader_options::builder(source).skip_rows(num_rows));
+    ASSERT_EQ(chunks.size(), 1);
+    EXPECT_EQ(chunks[0]->num_rows(), 0);
+  }
+}
+
 TEST_F(OrcWriterTest, TestMap)
 {
   auto const num_rows       = 1200000;
@@ -1362,6 +1847,33 @@ TEST_F(OrcWriterTest, TestMap)
   cudf::test::expect_metadata_equal(expected_metadata, result.metadata);
 }
 
+TEST_F(OrcReaderTest, DecompressionArena)
+{
+  constexpr auto num_rows = 20000;
+
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value" + std::to_string(i % 500); });
+  str_col col(strings, strings + num_rows);
+  table_view expected({col});
+
+  std::vector<char> out_buffer;
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{&out_buffer}, expected)
+      .compression(cudf_io::compression_type::SNAPPY);
+  cudf_io::write_orc(out_opts);
+
+  // the decompressed streams of each read are kept for the next one
+  auto arena = std::make_shared<cudf_io::decompression_arena>(64 << 20);
+  auto const source = cudf_io::source_info{out_buffer.data(), out_buffer.size()};
+  cudf_io::orc_reader_options in_opts =
+    cudf_io::orc_reader_options::builder(source).decompression_arena(arena);
+  for (int i = 0; i < 2; ++i) {
+    auto result = cudf_io::read_orc(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+    EXPECT_GT(arena->retained_bytes(), 0u);
+  }
+}
+
 TEST_F(OrcReaderTest, NestedColumnSelection)
 {
   auto const num_rows  = 1000;
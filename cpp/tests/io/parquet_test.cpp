@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,9 +14,15 @@
  * limitations under the License.
  */
 
+#include <io/comp/nvcomp_adapter.hpp>
+#include <io/parquet/bloom_filter.hpp>
+#include <io/parquet/parquet.hpp>
+
+#include <cudf/ast/expressions.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/parquet.hpp>
@@ -35,6 +41,8 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <type_traits>
 
@@ -595,6 +603,44 @@ TEST_F(ParquetWriterTest, Strings)
   cudf::test::expect_metadata_equal(expected_metadata, result.metadata);
 }
 
+TEST_F(ParquetWriterTest, NvcompCompression)
+{
+  constexpr auto num_rows = 20000;
+  auto ints    = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 300; });
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value" + std::to_string(i % 500); });
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+
+  column_wrapper<int64_t> col0(ints, ints + num_rows, validity);
+  column_wrapper<cudf::string_view> col1(strings, strings + num_rows);
+  table_view expected({col0, col1});
+
+  std::vector<std::pair<cudf_io::compression_type, cudf::io::nvcomp::compression_type>> formats{
+    {cudf_io::compression_type::ZSTD, cudf::io::nvcomp::compression_type::ZSTD},
+    {cudf_io::compression_type::LZ4, cudf::io::nvcomp::compression_type::LZ4}};
+  for (auto const& [compression, nvcomp_type] : formats) {
+    if (not cudf::io::nvcomp::is_compression_supported(nvcomp_type)) { continue; }
+
+    std::vector<char> out_buffer;
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info{&out_buffer}, expected)
+        .compression(compression);
+    cudf_io::write_parquet(out_opts);
+
+    std::vector<char> uncompressed_buffer;
+    cudf_io::parquet_writer_options uncompressed_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info{&uncompressed_buffer}, expected)
+        .compression(cudf_io::compression_type::NONE);
+    cudf_io::write_parquet(uncompressed_opts);
+    EXPECT_LT(out_buffer.size(), uncompressed_buffer.size());
+
+    cudf_io::parquet_reader_options in_opts = cudf_io::parquet_reader_options::builder(
+      cudf_io::source_info{out_buffer.data(), out_buffer.size()});
+    auto result = cudf_io::read_parquet(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  }
+}
+
 TEST_F(ParquetWriterTest, SlicedTable)
 {
   // This test checks for writing zero copy, offsetted views into existing cudf tables
@@ -1282,6 +1328,52 @@ std::string create_parquet_file(int num_cols)
   return filepath;
 }
 
+TEST_F(ParquetWriterTest, PartitionedWrite)
+{
+  // Sorted-by-key row order of each of the three partitions: {0, 3, 6, 9}, {1, 4, 7, 10}, ...
+  auto sequence = thrust::make_counting_iterator(0);
+  auto keys     = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  column_wrapper<int32_t> col_key(keys, keys + 12);
+  column_wrapper<int32_t> col_value(sequence, sequence + 12);
+  table_view input({col_key, col_value});
+
+  cudf_io::table_input_metadata metadata(input);
+  metadata.column_metadata[0].set_name("key");
+  metadata.column_metadata[1].set_name("value");
+
+  auto const base_path = temp_env->get_temp_filepath("PartitionedWrite");
+  cudf_io::partitioned_parquet_writer_options args =
+    cudf_io::partitioned_parquet_writer_options::builder(base_path, {0})
+      .metadata(&metadata)
+      .max_rows_per_file(3)
+      .max_open_files(2);
+  auto const files = cudf_io::write_partitioned_parquet(args, input);
+
+  std::vector<std::string> const expected_files{"key=0/part-00000.parquet",
+                                                "key=0/part-00001.parquet",
+                                                "key=1/part-00000.parquet",
+                                                "key=1/part-00001.parquet",
+                                                "key=2/part-00000.parquet",
+                                                "key=2/part-00001.parquet"};
+  ASSERT_EQ(files, expected_files);
+
+  for (size_t f = 0; f < files.size(); ++f) {
+    auto const key   = static_cast<int32_t>(f / 2);
+    auto const first = key + (f % 2 == 0 ? 0 : 9);
+    auto const count = f % 2 == 0 ? 3 : 1;
+    auto values      = cudf::detail::make_counting_transform_iterator(
+      0, [first](auto i) { return first + 3 * i; });
+    column_wrapper<int32_t> expected(values, values + count);
+
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{base_path + "/" + files[f]});
+    auto result = cudf_io::read_parquet(read_opts);
+    ASSERT_EQ(result.tbl->num_columns(), 1);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), expected);
+    EXPECT_EQ(result.metadata.column_names[0], "value");
+  }
+}
+
 TEST_F(ParquetWriterTest, MultipleMismatchedSources)
 {
   auto const int5file = create_parquet_file<int>(5);
@@ -1321,6 +1413,105 @@ TEST_F(ParquetWriterTest, Slice)
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(read_table.tbl->view(), tbl);
 }
 
+TEST_F(ParquetWriterTest, PageIndexWithSmallPages)
+{
+  constexpr auto num_rows = 20000;
+  auto sequence           = thrust::make_counting_iterator(0);
+  auto valids = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+  column_wrapper<int32_t> col_int(sequence, sequence + num_rows, valids);
+  // Long strings make fragments of the default size larger than the page size
+  std::vector<std::string> strings(num_rows);
+  std::transform(sequence, sequence + num_rows, strings.begin(), [](auto i) {
+    return std::string(200, 'a' + i % 26) + std::to_string(i);
+  });
+  cudf::test::strings_column_wrapper col_str(strings.begin(), strings.end());
+  table_view expected({col_int, col_str});
+
+  auto filepath = temp_env->get_temp_filepath("PageIndexWithSmallPages.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .stats_level(cudf_io::statistics_freq::STATISTICS_COLUMN)
+      .max_page_size_bytes(16 * 1024)
+      .max_page_size_rows(1000);
+  cudf_io::write_parquet(out_opts);
+
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto result = cudf_io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected);
+
+  // Partial reads select pages through the offset index
+  cudf_io::parquet_reader_options partial_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .skip_rows(12345)
+      .num_rows(1000);
+  auto partial = cudf_io::read_parquet(partial_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(partial.tbl->view(), cudf::slice(expected, {12345, 13345})[0]);
+}
+
+TEST_F(ParquetWriterTest, TruncatedStatisticsAndSortingColumns)
+{
+  // The minimum is truncated before its multi-byte character, the maximum is incremented
+  cudf::test::strings_column_wrapper col_str{"mmm", "aaaaaaaaa\u00e9bbbb", "zzzzzzzzzzzz"};
+  column_wrapper<int32_t> col_int{3, 2, 1};
+  table_view expected({col_str, col_int});
+
+  auto write = [&](std::vector<cudf_io::sorting_column> sorting_columns) {
+    std::vector<char> out_buffer;
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+        .stats_level(cudf_io::statistics_freq::STATISTICS_COLUMN)
+        .statistics_truncate_length(10)
+        .sorting_columns(std::move(sorting_columns));
+    cudf_io::write_parquet(out_opts);
+    return out_buffer;
+  };
+  auto const out_buffer = write({{1, true, false}});
+
+  cudf_io::parquet_reader_options in_opts = cudf_io::parquet_reader_options::builder(
+    cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+  auto const result = cudf_io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+  // The footer is followed by its length and the magic number
+  auto const file = reinterpret_cast<uint8_t const*>(out_buffer.data());
+  uint32_t footer_length;
+  std::memcpy(&footer_length, file + out_buffer.size() - 8, sizeof(footer_length));
+  cudf_io::parquet::FileMetaData fmd;
+  cudf_io::parquet::CompactProtocolReader footer_reader(
+    file + out_buffer.size() - 8 - footer_length, footer_length);
+  ASSERT_TRUE(footer_reader.read(&fmd));
+  ASSERT_EQ(fmd.row_groups.size(), 1);
+  auto const& row_group = fmd.row_groups[0];
+
+  ASSERT_EQ(row_group.sorting_columns.size(), 1);
+  EXPECT_EQ(row_group.sorting_columns[0].column_idx, 1);
+  EXPECT_TRUE(row_group.sorting_columns[0].descending);
+  EXPECT_FALSE(row_group.sorting_columns[0].nulls_first);
+
+  auto const as_string = [](std::vector<uint8_t> const& value) {
+    return std::string(value.begin(), value.end());
+  };
+  auto const& chunk = row_group.columns[0];
+  cudf_io::parquet::Statistics stats;
+  cudf_io::parquet::CompactProtocolReader stats_reader(chunk.meta_data.statistics_blob.data(),
+                                                       chunk.meta_data.statistics_blob.size());
+  ASSERT_TRUE(stats_reader.read(&stats));
+  EXPECT_EQ(as_string(stats.min_value), "aaaaaaaaa");
+  EXPECT_EQ(as_string(stats.max_value), "zzzzzzzzz{");
+
+  // The page statistics of the column index are truncated the same way
+  cudf_io::parquet::ColumnIndex column_index;
+  cudf_io::parquet::CompactProtocolReader index_reader(file + chunk.column_index_offset,
+                                                       chunk.column_index_length);
+  ASSERT_TRUE(index_reader.read(&column_index));
+  ASSERT_EQ(column_index.min_values.size(), 1);
+  EXPECT_EQ(as_string(column_index.min_values[0]), "aaaaaaaaa");
+  EXPECT_EQ(as_string(column_index.max_values[0]), "zzzzzzzzz{");
+
+  EXPECT_THROW(write({{2}}), cudf::logic_error);
+}
+
 TEST_F(ParquetChunkedWriterTest, SingleTable)
 {
   srand(31337);
@@ -1358,6 +1549,89 @@ TEST_F(ParquetChunkedWriterTest, SimpleTable)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *full_table);
 }
 
+TEST_F(ParquetChunkedWriterTest, AsyncWrites)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(64, 100000, true);
+  auto table2 = create_random_fixed_table<int>(64, 50000, true);
+  auto table3 = create_random_fixed_table<int>(64, 1000, false);
+
+  auto full_table = cudf::concatenate(std::vector<table_view>({*table1, *table2, *table3}));
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedAsync.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath})
+      .stats_level(cudf_io::statistics_freq::STATISTICS_PAGE)
+      .max_in_flight_writes(2);
+  cudf_io::parquet_chunked_writer(args).write(*table1).write(*table2).write(*table3);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto result = cudf_io::read_parquet(read_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *full_table);
+
+  EXPECT_THROW(cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath})
+                 .max_in_flight_writes(-1),
+               cudf::logic_error);
+}
+
+TEST_F(ParquetChunkedWriterTest, AdaptiveEncoding)
+{
+  constexpr auto num_rows = 20000;
+  auto sequence           = thrust::make_counting_iterator(0);
+  auto valids = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+
+  // Sorted integers, distinct strings sharing long prefixes, random doubles and few distinct values
+  auto int64_values = cudf::detail::make_counting_transform_iterator(
+    0, [](int64_t i) { return 1000000000000 + 3 * i; });
+  auto int32_values =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return 5 * i - 50000; });
+  auto few_values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 4; });
+  column_wrapper<int64_t> col_int64(int64_values, int64_values + num_rows, valids);
+  column_wrapper<int32_t> col_int32(int32_values, int32_values + num_rows);
+  std::vector<std::string> strings(num_rows);
+  std::transform(sequence, sequence + num_rows, strings.begin(), [](auto i) {
+    return "https://rapids.ai/datasets/parquet/encodings/" + std::to_string(100000 + i);
+  });
+  cudf::test::strings_column_wrapper col_str(strings.begin(), strings.end(), valids);
+  srand(6747);
+  std::vector<double> doubles(num_rows);
+  std::generate(
+    doubles.begin(), doubles.end(), []() { return 100.0 + (rand() % 100000) / 1000.0; });
+  column_wrapper<double> col_double(doubles.begin(), doubles.end());
+  column_wrapper<int32_t> col_few(few_values, few_values + num_rows);
+
+  table_view expected({col_int64, col_int32, col_str, col_double, col_few});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedAdaptiveEncoding.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath})
+      .compression(cudf_io::compression_type::SNAPPY)
+      .adaptive_encoding(true);
+  cudf_io::parquet_chunked_writer writer(args);
+  writer.write(expected).write(expected);
+
+  using cudf_io::column_encoding;
+  std::vector<column_encoding> const expected_encodings{column_encoding::DELTA_BINARY_PACKED,
+                                                        column_encoding::DELTA_BINARY_PACKED,
+                                                        column_encoding::DELTA_BYTE_ARRAY,
+                                                        column_encoding::BYTE_STREAM_SPLIT,
+                                                        column_encoding::DICTIONARY};
+  auto const& report = writer.encoding_report();
+  ASSERT_EQ(report.size(), 2);
+  EXPECT_EQ(report[0], expected_encodings);
+  EXPECT_EQ(report[1], expected_encodings);
+  writer.close();
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto result = cudf_io::read_parquet(read_opts);
+
+  auto const full_table = cudf::concatenate(std::vector<table_view>({expected, expected}));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *full_table);
+}
+
 TEST_F(ParquetChunkedWriterTest, LargeTables)
 {
   srand(31337);
@@ -3177,6 +3451,801 @@ TEST_F(ParquetReaderTest, EmptyOutput)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
 }
 
+TEST_F(ParquetReaderTest, Filter)
+{
+  constexpr cudf::size_type num_rows = 15000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto doubles  = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * 0.5; });
+  auto strings  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "payload_" + std::to_string(i); });
+  column_wrapper<int32_t> col0(sequence, sequence + num_rows);
+  column_wrapper<double> col1(doubles, doubles + num_rows);
+  column_wrapper<cudf::string_view> col2(strings, strings + num_rows);
+  table_view expected({col0, col1, col2});
+
+  // three row groups of 5000 rows each
+  auto filepath = temp_env->get_temp_filepath("Filter.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .row_group_size_rows(5000);
+  cudf_io::write_parquet(out_opts);
+
+  auto read_filtered = [&](cudf::ast::expression const& filter) {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(filter);
+    return cudf_io::read_parquet(read_opts);
+  };
+  auto expected_rows = [&](std::vector<cudf::size_type> const& ranges) {
+    return cudf::concatenate(cudf::slice(expected, ranges));
+  };
+
+  auto ref0 = cudf::ast::column_reference(0);
+  auto ref1 = cudf::ast::column_reference(1);
+
+  // matching rows are all in the first row group
+  {
+    auto value  = cudf::numeric_scalar<int32_t>(1000);
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::operation(cudf::ast::ast_operator::LESS, ref0, lit);
+    auto result = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected_rows({0, 1000})->view(), result.tbl->view());
+  }
+  // literal on the left-hand side, on a floating point column
+  {
+    auto value  = cudf::numeric_scalar<double>(6000.);
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::operation(cudf::ast::ast_operator::LESS_EQUAL, lit, ref1);
+    auto result = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected_rows({12000, 15000})->view(), result.tbl->view());
+  }
+  // conjunction selecting rows of the middle row group
+  {
+    auto low        = cudf::numeric_scalar<int32_t>(6000);
+    auto high       = cudf::numeric_scalar<int32_t>(7000);
+    auto low_lit    = cudf::ast::literal(low);
+    auto high_lit   = cudf::ast::literal(high);
+    auto above_low  = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, ref0, low_lit);
+    auto below_high = cudf::ast::operation(cudf::ast::ast_operator::LESS, ref0, high_lit);
+    auto filter =
+      cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, above_low, below_high);
+    auto result = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected_rows({6000, 7000})->view(), result.tbl->view());
+  }
+  // disjunction selecting rows of the first and last row groups
+  {
+    auto first     = cudf::numeric_scalar<int32_t>(10);
+    auto last      = cudf::numeric_scalar<int32_t>(14990);
+    auto first_lit = cudf::ast::literal(first);
+    auto last_lit  = cudf::ast::literal(last);
+    auto is_first  = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, ref0, first_lit);
+    auto is_last   = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, ref0, last_lit);
+    auto filter    = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_OR, is_first, is_last);
+    auto result    = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected_rows({10, 11, 14990, 14991})->view(),
+                                  result.tbl->view());
+  }
+  // no row group can match
+  {
+    auto value  = cudf::numeric_scalar<int32_t>(num_rows);
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, ref0, lit);
+    auto result = read_filtered(filter);
+    EXPECT_EQ(result.tbl->num_columns(), 3);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+  // statistics cannot prune row groups, but no row matches when the filter is evaluated
+  {
+    auto filter = cudf::ast::operation(cudf::ast::ast_operator::NOT_EQUAL, ref0, ref0);
+    auto result = read_filtered(filter);
+    EXPECT_EQ(result.tbl->num_columns(), 3);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+  // expressions that cannot be evaluated against statistics keep all row groups
+  {
+    auto filter = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, ref1, ref1);
+    auto result = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  }
+  // the filter must be valid for the output columns
+  {
+    auto value  = cudf::numeric_scalar<int64_t>(0);
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::operation(cudf::ast::ast_operator::LESS, ref0, lit);
+    EXPECT_THROW(read_filtered(filter), cudf::logic_error);
+
+    auto missing         = cudf::ast::column_reference(3);
+    auto missing_literal = cudf::numeric_scalar<int32_t>(0);
+    auto missing_lit     = cudf::ast::literal(missing_literal);
+    auto missing_filter =
+      cudf::ast::operation(cudf::ast::ast_operator::LESS, missing, missing_lit);
+    EXPECT_THROW(read_filtered(missing_filter), cudf::logic_error);
+  }
+}
+
+TEST_F(ParquetReaderTest, FilterWithPageIndex)
+{
+  constexpr cudf::size_type num_rows = 20000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto strings  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "payload_" + std::to_string(i); });
+  column_wrapper<int32_t> col0(sequence, sequence + num_rows);
+  column_wrapper<cudf::string_view> col1(strings, strings + num_rows);
+  table_view expected({col0, col1});
+
+  // A single row group of pages of 1000 rows, with or without a page index
+  auto write = [&](std::string const& name, cudf_io::statistics_freq stats_level) {
+    auto filepath = temp_env->get_temp_filepath(name);
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+        .stats_level(stats_level)
+        .max_page_size_rows(1000);
+    cudf_io::write_parquet(out_opts);
+    return filepath;
+  };
+  auto const indexed_path   = write("FilterWithPageIndex.parquet", cudf_io::STATISTICS_COLUMN);
+  auto const unindexed_path = write("FilterWithoutPageIndex.parquet", cudf_io::STATISTICS_ROWGROUP);
+
+  auto value  = cudf::numeric_scalar<int32_t>(15200);
+  auto lit    = cudf::ast::literal(value);
+  auto ref0   = cudf::ast::column_reference(0);
+  auto filter = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, ref0, lit);
+  auto read_filtered = [&](std::string const& filepath) {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+        .filter(filter)
+        .profile(true);
+    return cudf_io::read_parquet(read_opts);
+  };
+
+  auto const indexed   = read_filtered(indexed_path);
+  auto const unindexed = read_filtered(unindexed_path);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(unindexed.tbl->view(), indexed.tbl->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {15200, num_rows})[0], indexed.tbl->view());
+
+  // The page statistics exclude the 15 pages before the page holding row 15200, in each column
+  EXPECT_GE(indexed.metadata.profile->pages_skipped, 15u);
+  EXPECT_EQ(unindexed.metadata.profile->pages_skipped, 0u);
+}
+
+TEST_F(ParquetReaderTest, BloomFilter)
+{
+  constexpr cudf::size_type num_rows = 15000;
+  constexpr cudf::size_type rg_rows  = 5000;
+  // even ids, interleaved so that the range of every row group covers all values
+  auto ids = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return 2 * (int64_t{i % rg_rows} * 3 + i / rg_rows); });
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "payload_" + std::to_string(i); });
+  column_wrapper<int64_t> col0(ids, ids + num_rows);
+  column_wrapper<cudf::string_view> col1(strings, strings + num_rows);
+  table_view expected({col0, col1});
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_bloom_filter(true);
+  expected_metadata.column_metadata[1].set_bloom_filter(true);
+
+  auto filepath = temp_env->get_temp_filepath("BloomFilter.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .row_group_size_rows(rg_rows);
+  cudf_io::write_parquet(out_opts);
+
+  // bloom filters do not change the data that is read
+  {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+    auto result = cudf_io::read_parquet(read_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  }
+
+  // the profile counts the row groups that the bloom filters skip
+  auto read_filtered = [&](cudf::ast::expression const& filter) {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+        .filter(filter)
+        .profile(true);
+    return cudf_io::read_parquet(read_opts);
+  };
+  auto expected_rows = [&](std::vector<cudf::size_type> const& ranges) {
+    return cudf::concatenate(cudf::slice(expected, ranges));
+  };
+
+  auto ref0 = cudf::ast::column_reference(0);
+
+  // the value is only held by the second row group
+  {
+    auto value  = cudf::numeric_scalar<int64_t>(2 * (100 * 3 + 1));
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, ref0, lit);
+    auto result = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected_rows({5100, 5101})->view(), result.tbl->view());
+    EXPECT_EQ(result.metadata.profile->pages_skipped, 2u);
+  }
+  // IN list, expressed as a disjunction of equalities
+  {
+    auto first     = cudf::numeric_scalar<int64_t>(2 * (10 * 3));
+    auto last      = cudf::numeric_scalar<int64_t>(2 * (4990 * 3 + 2));
+    auto first_lit = cudf::ast::literal(first);
+    auto last_lit  = cudf::ast::literal(last);
+    auto is_first  = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, ref0, first_lit);
+    auto is_last   = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, ref0, last_lit);
+    auto filter    = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_OR, is_first, is_last);
+    auto result    = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected_rows({10, 11, 14990, 14991})->view(),
+                                  result.tbl->view());
+    EXPECT_EQ(result.metadata.profile->pages_skipped, 1u);
+  }
+  // a value within the range of every row group that is not in the file
+  {
+    auto value  = cudf::numeric_scalar<int64_t>(301);
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, ref0, lit);
+    auto result = read_filtered(filter);
+    EXPECT_EQ(result.tbl->num_columns(), 2);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+    EXPECT_EQ(result.metadata.profile->pages_skipped, 3u);
+  }
+}
+
+TEST_F(ParquetReaderTest, BloomFilterHash)
+{
+  // Reference values of the 64-bit xxHash with a seed of zero, for inputs shorter and longer
+  // than its 32-byte stripes
+  auto hash = [](std::string const& input) {
+    return cudf_io::parquet::xxhash64(reinterpret_cast<uint8_t const*>(input.data()),
+                                      input.size());
+  };
+  EXPECT_EQ(hash(""), 0xEF46DB3751D8E999ULL);
+  EXPECT_EQ(hash("a"), 0xD24EC4F1A98C6E5BULL);
+  EXPECT_EQ(hash("abc"), 0x44BC2CF5AD770999ULL);
+  EXPECT_EQ(hash("Nobody inspects the spammish repetition"), 0xFBCEA83C8A378BF1ULL);
+}
+
+TEST_F(ParquetReaderTest, FilterInvalidOptions)
+{
+  auto ref    = cudf::ast::column_reference(0);
+  auto value  = cudf::numeric_scalar<int32_t>(0);
+  auto lit    = cudf::ast::literal(value);
+  auto filter = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, ref, lit);
+
+  auto source = cudf_io::source_info{"unused.parquet"};
+  EXPECT_THROW(cudf_io::parquet_reader_options::builder(source).filter(filter).skip_rows(1),
+               cudf::logic_error);
+  EXPECT_THROW(cudf_io::parquet_reader_options::builder(source).num_rows(1).filter(filter),
+               cudf::logic_error);
+}
+
+TEST_F(ParquetReaderTest, ChunkedRead)
+{
+  constexpr cudf::size_type num_rows = 30000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto strings  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "chunk_" + std::to_string(i); });
+  auto valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  column_wrapper<int64_t> col0(sequence, sequence + num_rows, valids);
+  column_wrapper<cudf::string_view> col1(strings, strings + num_rows);
+  table_view expected({col0, col1});
+
+  // three row groups of 10000 rows each
+  auto filepath = temp_env->get_temp_filepath("ChunkedRead.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .compression(cudf_io::compression_type::NONE)
+      .row_group_size_rows(10000);
+  cudf_io::write_parquet(out_opts);
+
+  auto read_chunks = [&](std::size_t chunk_read_limit, cudf_io::parquet_reader_options opts) {
+    auto reader = cudf_io::chunked_parquet_reader(chunk_read_limit, opts);
+    std::vector<std::unique_ptr<table>> chunks;
+    while (reader.has_next()) {
+      chunks.push_back(std::move(reader.read_chunk().tbl));
+    }
+    EXPECT_THROW(static_cast<void>(reader.read_chunk()), cudf::logic_error);
+    return chunks;
+  };
+  auto concatenate = [](std::vector<std::unique_ptr<table>> const& chunks) {
+    std::vector<table_view> views;
+    std::transform(chunks.cbegin(), chunks.cend(), std::back_inserter(views), [](auto const& t) {
+      return t->view();
+    });
+    return cudf::concatenate(views);
+  };
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+
+  // no limit
+  {
+    auto chunks = read_chunks(0, read_opts);
+    ASSERT_EQ(chunks.size(), 1);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, chunks[0]->view());
+  }
+  // limit larger than the file
+  {
+    auto chunks = read_chunks(std::numeric_limits<std::size_t>::max(), read_opts);
+    ASSERT_EQ(chunks.size(), 1);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, chunks[0]->view());
+  }
+  // row groups are split to honor a small limit
+  {
+    auto chunks = read_chunks(32 * 1024, read_opts);
+    EXPECT_GT(chunks.size(), 3);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, concatenate(chunks)->view());
+  }
+  // limit smaller than a single row
+  {
+    cudf_io::parquet_reader_options opts = read_opts;
+    opts.set_skip_rows(29990);
+    auto chunks = read_chunks(1, opts);
+    EXPECT_EQ(chunks.size(), 10);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {29990, num_rows})[0],
+                                  concatenate(chunks)->view());
+  }
+  // skip_rows and num_rows spanning row groups
+  {
+    cudf_io::parquet_reader_options opts = read_opts;
+    opts.set_skip_rows(5000);
+    opts.set_num_rows(20000);
+    auto chunks = read_chunks(64 * 1024, opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {5000, 25000})[0],
+                                  concatenate(chunks)->view());
+  }
+  // filtered reads keep whole row groups in each chunk
+  {
+    auto ref    = cudf::ast::column_reference(0);
+    auto value  = cudf::numeric_scalar<int64_t>(15000);
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, ref, lit);
+    cudf_io::parquet_reader_options opts = read_opts;
+    opts.set_filter(filter);
+    auto chunks = read_chunks(1, opts);
+    ASSERT_EQ(chunks.size(), 2);
+    auto const filtered = chunks[0]->num_rows() + chunks[1]->num_rows();
+    EXPECT_EQ(filtered, 10000);
+  }
+  // empty selection
+  {
+    cudf_io::parquet_reader_options opts = read_opts;
+    opts.set_num_rows(0);
+    auto chunks = read_chunks(1024, opts);
+    ASSERT_EQ(chunks.size(), 1);
+    EXPECT_EQ(chunks[0]->num_rows(), 0);
+    EXPECT_EQ(chunks[0]->num_columns(), 2);
+  }
+}
+
+TEST_F(ParquetReaderTest, ReusedDatasetMetadata)
+{
+  constexpr cudf::size_type num_files = 4;
+  constexpr cudf::size_type file_rows = 1000;
+
+  std::vector<std::string> filepaths;
+  std::vector<std::unique_ptr<cudf::column>> file_columns;
+  for (cudf::size_type f = 0; f < num_files; ++f) {
+    auto sequence = cudf::detail::make_counting_transform_iterator(
+      0, [f](auto i) { return static_cast<int32_t>(f * file_rows + i); });
+    column_wrapper<int32_t> col(sequence, sequence + file_rows);
+    file_columns.push_back(col.release());
+    filepaths.push_back(
+      temp_env->get_temp_filepath("ReusedDatasetMetadata" + std::to_string(f) + ".parquet"));
+    table_view file_table({file_columns.back()->view()});
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepaths.back()}, file_table);
+    cudf_io::write_parquet(out_opts);
+  }
+  std::vector<column_view> file_views;
+  std::transform(file_columns.cbegin(),
+                 file_columns.cend(),
+                 std::back_inserter(file_views),
+                 [](auto const& col) { return col->view(); });
+  auto const expected = cudf::concatenate(file_views);
+
+  auto const source   = cudf_io::source_info{filepaths};
+  auto const metadata = cudf_io::read_parquet_metadata(source);
+  ASSERT_TRUE(metadata.has_value());
+  EXPECT_EQ(metadata.num_sources(), num_files);
+  EXPECT_EQ(metadata.num_rows(), num_files * file_rows);
+  EXPECT_EQ(metadata.num_row_groups(), num_files);
+
+  // the parsed footers can be used by multiple reads
+  for (int i = 0; i < 2; ++i) {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(source).dataset_metadata(metadata);
+    auto result = cudf_io::read_parquet(read_opts);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), result.tbl->view().column(0));
+  }
+
+  // the metadata must match the sources
+  cudf_io::parquet_reader_options mismatched_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepaths[0]})
+      .dataset_metadata(metadata);
+  EXPECT_THROW(cudf_io::read_parquet(mismatched_opts), cudf::logic_error);
+  EXPECT_THROW(static_cast<void>(cudf_io::parquet_dataset_metadata{}.num_rows()),
+               cudf::logic_error);
+}
+
+TEST_F(ParquetReaderTest, MetadataCache)
+{
+  constexpr cudf::size_type num_rows = 20000;
+  auto filepath = temp_env->get_temp_filepath("MetadataCache.parquet");
+
+  auto write = [&](int32_t base, cudf::size_type rows) {
+    auto sequence = cudf::detail::make_counting_transform_iterator(
+      0, [base](auto i) { return static_cast<int32_t>(base + i); });
+    column_wrapper<int32_t> col(sequence, sequence + rows);
+    auto strings = cudf::detail::make_counting_transform_iterator(
+      0, [base](auto i) { return "value_" + std::to_string((base + i) % 100); });
+    column_wrapper<cudf::string_view> str_col(strings, strings + rows);
+    auto table = table_view({col, str_col});
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, table)
+        .row_group_size_rows(5000);
+    cudf_io::write_parquet(out_opts);
+    return cudf::table(table);
+  };
+  auto read = [&](cudf::size_type skip_rows, cudf::size_type rows) {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+        .skip_rows(skip_rows)
+        .num_rows(rows);
+    return cudf_io::read_parquet(read_opts);
+  };
+
+  EXPECT_EQ(cudf_io::get_parquet_metadata_cache_capacity(), 0u);
+  cudf_io::set_parquet_metadata_cache_capacity(16 << 20);
+  EXPECT_EQ(cudf_io::get_parquet_metadata_cache_capacity(), static_cast<size_t>(16 << 20));
+
+  auto expected = write(0, num_rows);
+  // the second reads reuse the footer and page headers cached by the first ones
+  for (int i = 0; i < 2; ++i) {
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected.view(), read(0, -1).tbl->view());
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected.view(), {2500, 12500}).front(),
+                                  read(2500, 10000).tbl->view());
+  }
+
+  // a modified file is read anew
+  auto const modified = write(7, num_rows / 2);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(modified.view(), read(0, -1).tbl->view());
+
+  // the cache is disabled again, and its contents released
+  cudf_io::set_parquet_metadata_cache_capacity(0);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(modified.view(), read(0, -1).tbl->view());
+}
+
+TEST_F(ParquetReaderTest, DecompressionArena)
+{
+  constexpr cudf::size_type num_rows = 20000;
+
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i % 100); });
+  column_wrapper<cudf::string_view> col(strings, strings + num_rows);
+  auto expected = table_view({col});
+
+  auto filepath = temp_env->get_temp_filepath("DecompressionArena.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .compression(cudf_io::compression_type::SNAPPY);
+  cudf_io::write_parquet(out_opts);
+
+  // the decompressed pages of the first read are kept and reused by the second one
+  auto arena = std::make_shared<cudf_io::decompression_arena>(64 << 20);
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .decompression_arena(arena);
+  for (int i = 0; i < 2; ++i) {
+    auto result = cudf_io::read_parquet(read_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+    EXPECT_GT(arena->retained_bytes(), 0u);
+  }
+  auto const retained = arena->retained_bytes();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, cudf_io::read_parquet(read_opts).tbl->view());
+  EXPECT_EQ(arena->retained_bytes(), retained);
+  arena->release();
+  EXPECT_EQ(arena->retained_bytes(), 0u);
+
+  // nothing is kept beyond the cap
+  auto capped = std::make_shared<cudf_io::decompression_arena>(0);
+  read_opts.set_decompression_arena(capped);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, cudf_io::read_parquet(read_opts).tbl->view());
+  EXPECT_EQ(capped->retained_bytes(), 0u);
+}
+
+TEST_F(ParquetReaderTest, PipelinedRead)
+{
+  constexpr cudf::size_type num_rows = 20000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto strings  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "batch_" + std::to_string(i); });
+  auto valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  column_wrapper<int64_t> col0(sequence, sequence + num_rows, valids);
+  column_wrapper<cudf::string_view> col1(strings, strings + num_rows, valids);
+  table_view expected({col0, col1});
+
+  // four row groups of 5000 rows each
+  auto filepath = temp_env->get_temp_filepath("PipelinedRead.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .row_group_size_rows(5000);
+  cudf_io::write_parquet(out_opts);
+
+  // A batch size of one byte reads each row group in its own batch
+  auto read = [&](size_t pipeline_batch_size, cudf::size_type skip_rows) {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+        .skip_rows(skip_rows)
+        .pipeline_batch_size(pipeline_batch_size);
+    return cudf_io::read_parquet(read_opts);
+  };
+
+  auto const single_pass = read(cudf_io::default_pipeline_batch_size, 0);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, single_pass.tbl->view());
+  auto const pipelined = read(1, 0);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(single_pass.tbl->view(), pipelined.tbl->view());
+
+  // The first batch starts in the middle of a row group
+  auto const partial_single_pass = read(cudf_io::default_pipeline_batch_size, 7500);
+  auto const partial_pipelined   = read(1, 7500);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(partial_single_pass.tbl->view(), partial_pipelined.tbl->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {7500, num_rows})[0],
+                                partial_pipelined.tbl->view());
+
+  EXPECT_THROW(cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+                 .pipeline_batch_size(0),
+               cudf::logic_error);
+}
+
+TEST_F(ParquetReaderTest, Profile)
+{
+  constexpr cudf::size_type num_rows = 20000;
+
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i % 100); });
+  column_wrapper<cudf::string_view> col(strings, strings + num_rows);
+  auto expected = table_view({col});
+
+  auto filepath = temp_env->get_temp_filepath("Profile.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .compression(cudf_io::compression_type::SNAPPY);
+  cudf_io::write_parquet(out_opts);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  EXPECT_FALSE(cudf_io::read_parquet(read_opts).metadata.profile.has_value());
+
+  read_opts.enable_profile(true);
+  auto const result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  ASSERT_TRUE(result.metadata.profile.has_value());
+  auto const& profile = result.metadata.profile.value();
+  EXPECT_GT(profile.bytes_read, 0u);
+  EXPECT_GT(profile.compressed_bytes, 0u);
+  EXPECT_GT(profile.uncompressed_bytes, 0u);
+  for (auto const stage : {"read", "decompress", "decode", "assemble"}) {
+    auto const it = std::find_if(profile.stage_times.cbegin(),
+                                 profile.stage_times.cend(),
+                                 [stage](auto const& t) { return t.name == stage; });
+    ASSERT_NE(it, profile.stage_times.cend()) << stage;
+    EXPECT_GE(it->time_ms, 0.f);
+  }
+}
+
+TEST_F(ParquetReaderTest, StringsToDictionary)
+{
+  constexpr cudf::size_type num_rows = 15000;
+  // few distinct values, which differ between row groups
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i % 7 + i / 5000); });
+  auto valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 11 != 0; });
+  column_wrapper<cudf::string_view> col0(strings, strings + num_rows, valids);
+  column_wrapper<cudf::string_view> col1(strings, strings + num_rows);
+  table_view expected({col0, col1});
+
+  auto filepath = temp_env->get_temp_filepath("StringsToDictionary.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .row_group_size_rows(5000);
+  cudf_io::write_parquet(out_opts);
+
+  auto check = [&](cudf::size_type skip_rows, cudf::size_type rows) {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+        .convert_strings_to_dictionary(true)
+        .skip_rows(skip_rows)
+        .num_rows(rows);
+    auto result              = cudf_io::read_parquet(read_opts);
+    auto const expected_rows = cudf::slice(expected, {skip_rows, skip_rows + rows}).front();
+    ASSERT_EQ(result.tbl->num_columns(), 2);
+    for (cudf::size_type c = 0; c < 2; ++c) {
+      EXPECT_EQ(result.tbl->get_column(c).type().id(), cudf::type_id::DICTIONARY32);
+      auto const decoded = cudf::dictionary::decode(result.tbl->get_column(c).view());
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_rows.column(c), decoded->view());
+    }
+  };
+  check(0, num_rows);
+  // starts and ends within row groups
+  check(2500, 5000);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .convert_strings_to_dictionary(true)
+      .convert_strings_to_categories(true);
+  EXPECT_THROW(cudf_io::read_parquet(read_opts), cudf::logic_error);
+}
+
+TEST_F(ParquetReaderTest, DeltaEncodingV2)
+{
+  // Data pages v2 holding, for 150 rows:
+  //   a: required INT32, DELTA_BINARY_PACKED, i * i - 1000
+  //   b: required INT64, DELTA_BINARY_PACKED, i * 1234567891, negated for odd rows
+  //   c: optional BYTE_ARRAY, DELTA_BYTE_ARRAY, "str" + (i / 3), null every 5 rows
+  //   d: required BYTE_ARRAY, DELTA_LENGTH_BYTE_ARRAY, i * 7
+  // The delta streams use blocks of 128 values in 4 miniblocks, so the last block is partial.
+  const unsigned char delta_parquet[] = {
+    0x50, 0x41, 0x52, 0x31, 0x15, 0x06, 0x15, 0xbc, 0x02, 0x15, 0xbc, 0x02, 0x5c, 0x15, 0xac,
+    0x02, 0x15, 0x00, 0x15, 0xac, 0x02, 0x15, 0x0a, 0x15, 0x00, 0x15, 0x00, 0x12, 0x00, 0x00,
+    0x80, 0x01, 0x04, 0x96, 0x01, 0xcf, 0x0f, 0x02, 0x06, 0x07, 0x08, 0x08, 0x80, 0x40, 0x18,
+    0x88, 0xc2, 0x38, 0x90, 0x44, 0x59, 0x98, 0xc6, 0x79, 0xa0, 0x48, 0x9a, 0xa8, 0xca, 0xba,
+    0xb0, 0x4c, 0xdb, 0xb8, 0xce, 0xfb, 0x40, 0x21, 0xd1, 0x88, 0x54, 0x32, 0x9d, 0x50, 0x29,
+    0xd5, 0x8a, 0xd5, 0x72, 0xbd, 0x60, 0x31, 0xd9, 0x8c, 0x56, 0xb3, 0xdd, 0x70, 0x39, 0xdd,
+    0x8e, 0xd7, 0xf3, 0xfd, 0x80, 0x82, 0x84, 0x86, 0x88, 0x8a, 0x8c, 0x8e, 0x90, 0x92, 0x94,
+    0x96, 0x98, 0x9a, 0x9c, 0x9e, 0xa0, 0xa2, 0xa4, 0xa6, 0xa8, 0xaa, 0xac, 0xae, 0xb0, 0xb2,
+    0xb4, 0xb6, 0xb8, 0xba, 0xbc, 0xbe, 0xc0, 0xc2, 0xc4, 0xc6, 0xc8, 0xca, 0xcc, 0xce, 0xd0,
+    0xd2, 0xd4, 0xd6, 0xd8, 0xda, 0xdc, 0xde, 0xe0, 0xe2, 0xe4, 0xe6, 0xe8, 0xea, 0xec, 0xee,
+    0xf0, 0xf2, 0xf4, 0xf6, 0xf8, 0xfa, 0xfc, 0xfe, 0x82, 0x04, 0x06, 0x00, 0x00, 0x00, 0x80,
+    0x40, 0x18, 0x88, 0xc2, 0x38, 0x90, 0x44, 0x59, 0x98, 0xc6, 0x79, 0xa0, 0x48, 0x9a, 0x28,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x06, 0x15, 0xdc, 0x0c, 0x15, 0xdc,
+    0x0c, 0x5c, 0x15, 0xac, 0x02, 0x15, 0x00, 0x15, 0xac, 0x02, 0x15, 0x0a, 0x15, 0x00, 0x15,
+    0x00, 0x12, 0x00, 0x00, 0x80, 0x01, 0x04, 0x96, 0x01, 0x00, 0x8d, 0xaa, 0x86, 0x94, 0x97,
+    0x12, 0x27, 0x27, 0x27, 0x28, 0xb4, 0xc7, 0xaa, 0x6f, 0x48, 0x80, 0x69, 0x01, 0xcb, 0x24,
+    0x1a, 0xaf, 0x54, 0xd2, 0x91, 0xc9, 0x5b, 0x8b, 0x57, 0xc9, 0x11, 0xab, 0x2f, 0x62, 0xc4,
+    0x4c, 0x97, 0x15, 0x5f, 0x42, 0x97, 0x8a, 0xf2, 0x13, 0xc9, 0xe9, 0x15, 0x12, 0x9a, 0x84,
+    0x9a, 0x4a, 0xd6, 0x43, 0x18, 0x80, 0xb1, 0x17, 0x27, 0xce, 0xa3, 0xfc, 0xab, 0x90, 0x6f,
+    0x61, 0xb7, 0xea, 0xc9, 0x3e, 0xa8, 0x99, 0x18, 0x44, 0xb6, 0x98, 0xe0, 0x83, 0x82, 0xe2,
+    0x09, 0x8d, 0x01, 0x29, 0x44, 0xd6, 0x44, 0xa3, 0x54, 0x6d, 0xea, 0x3c, 0x3f, 0xb0, 0x96,
+    0x61, 0x64, 0x29, 0x82, 0x98, 0xa4, 0x85, 0x8f, 0x15, 0x67, 0xe3, 0x7d, 0xca, 0x6b, 0xa5,
+    0x03, 0xcf, 0xc3, 0x1f, 0x9a, 0xab, 0xa8, 0xc2, 0x2d, 0x89, 0x27, 0xef, 0x88, 0x9e, 0x96,
+    0x77, 0xac, 0x24, 0x40, 0x8a, 0xa3, 0x3a, 0x48, 0xad, 0x11, 0xb1, 0x2b, 0x36, 0x8d, 0x4c,
+    0x5f, 0x8e, 0xbb, 0x6c, 0x0f, 0x11, 0xcb, 0x98, 0xa2, 0x6d, 0x85, 0x43, 0x89, 0x9b, 0x76,
+    0xcd, 0x02, 0x79, 0x08, 0xc2, 0xdc, 0xe8, 0xf8, 0x56, 0xaa, 0xb5, 0xf4, 0x12, 0x2a, 0x0a,
+    0x36, 0xe0, 0xc3, 0xc1, 0xfd, 0x2d, 0xea, 0x81, 0xf4, 0x38, 0x8d, 0x61, 0x72, 0x3b, 0xa4,
+    0xcb, 0xc5, 0x9f, 0xd7, 0x3b, 0xc3, 0xf2, 0x9c, 0x41, 0xf2, 0x42, 0xc4, 0x87, 0x5c, 0xca,
+    0x48, 0x53, 0x17, 0xdd, 0xbe, 0xc4, 0xe5, 0xc9, 0x70, 0x31, 0x78, 0xda, 0x71, 0x4a, 0x30,
+    0x9e, 0x76, 0x9c, 0x12, 0x8c, 0x07, 0x78, 0x67, 0x37, 0xcc, 0xf2, 0x9c, 0x41, 0xf2, 0x42,
+    0x5c, 0x9e, 0x0c, 0x17, 0x83, 0x0f, 0x07, 0xf7, 0xb7, 0xa8, 0xad, 0xd7, 0x0f, 0xc8, 0x94,
+    0xb8, 0x69, 0xd7, 0x2c, 0x10, 0xf1, 0x21, 0x97, 0x32, 0x52, 0x6b, 0x44, 0xec, 0x8a, 0xad,
+    0x7d, 0x93, 0xca, 0xcc, 0x1f, 0x9a, 0xab, 0xa8, 0xc2, 0xc5, 0x9f, 0xd7, 0x3b, 0xc3, 0x5a,
+    0x86, 0x91, 0xa5, 0x08, 0x08, 0x98, 0x42, 0xd1, 0x64, 0x8b, 0x09, 0x3e, 0x28, 0xa8, 0x07,
+    0xd2, 0xe3, 0x34, 0x06, 0x60, 0xec, 0xc5, 0x89, 0x53, 0x83, 0xbf, 0x5d, 0xcd, 0x4c, 0x97,
+    0x15, 0x5f, 0x42, 0x2f, 0xa1, 0xa2, 0x60, 0x03, 0xa6, 0x05, 0x2c, 0x93, 0x68, 0x62, 0x58,
+    0x75, 0xda, 0x34, 0x5e, 0xa9, 0xa4, 0x23, 0x40, 0x1e, 0x82, 0x30, 0x37, 0xba, 0x54, 0x94,
+    0x9f, 0x88, 0xf9, 0x88, 0xeb, 0xf0, 0xcd, 0x79, 0x94, 0x7f, 0x15, 0xc2, 0x98, 0xa2, 0x6d,
+    0x85, 0x43, 0xf1, 0x84, 0xc6, 0x80, 0xc8, 0xbc, 0x18, 0xa8, 0xe3, 0x04, 0x31, 0x49, 0x0b,
+    0x1f, 0xd8, 0x34, 0x32, 0x7d, 0x39, 0x6e, 0x49, 0x3c, 0x79, 0x87, 0x9f, 0x8e, 0x17, 0x84,
+    0xce, 0xa6, 0x91, 0xe9, 0xcb, 0x41, 0x02, 0xa4, 0x38, 0xaa, 0x83, 0x3c, 0x04, 0x61, 0x6e,
+    0x28, 0x17, 0xd9, 0xda, 0xec, 0xd4, 0x03, 0xe9, 0x71, 0x1a, 0x70, 0x4b, 0xe2, 0xc9, 0x3b,
+    0x22, 0x3e, 0xe4, 0x52, 0x86, 0x45, 0x94, 0x43, 0x17, 0xcf, 0xd3, 0x8e, 0x53, 0x82, 0xc1,
+    0x6b, 0xa5, 0x03, 0xcf, 0xc3, 0x87, 0x83, 0xfb, 0x5b, 0x88, 0x71, 0x99, 0x0d, 0xf6, 0xa4,
+    0xd6, 0x88, 0xd8, 0x15, 0x08, 0x62, 0x92, 0x16, 0x3e, 0xd6, 0x32, 0x8c, 0x2c, 0x85, 0xeb,
+    0x99, 0x6f, 0xaa, 0xcf, 0x00, 0x8c, 0xbd, 0x38, 0x41, 0xd5, 0xa6, 0xce, 0xf3, 0x03, 0xd3,
+    0x02, 0x96, 0x49, 0xe8, 0xcb, 0x59, 0x40, 0xff, 0x74, 0xa9, 0x28, 0x3f, 0x11, 0x40, 0xf1,
+    0x84, 0xc6, 0x80, 0x28, 0x9e, 0xd0, 0x18, 0x10, 0x8c, 0xfc, 0xdc, 0xec, 0x81, 0xdc, 0x92,
+    0x78, 0xf2, 0x0e, 0xd8, 0x07, 0x35, 0x13, 0x83, 0x90, 0x87, 0x20, 0xcc, 0x0d, 0x24, 0x13,
+    0x8d, 0x39, 0x84, 0x44, 0x7c, 0xc8, 0xa5, 0x0c, 0x70, 0x1e, 0xe5, 0x5f, 0x85, 0xf8, 0x70,
+    0x70, 0x7f, 0x0b, 0xbc, 0x29, 0x3d, 0x86, 0x86, 0xac, 0x65, 0x18, 0x59, 0x0a, 0x08, 0x35,
+    0x95, 0xac, 0x87, 0x60, 0x5a, 0xc0, 0x32, 0x09, 0x54, 0x40, 0xed, 0xd2, 0x88, 0x14, 0x4f,
+    0x68, 0x0c, 0x08, 0xa0, 0x4b, 0x45, 0xf9, 0x89, 0xc8, 0x43, 0x10, 0xe6, 0x06, 0xec, 0x56,
+    0x9d, 0x1f, 0x8b, 0x7c, 0x38, 0xb8, 0xbf, 0x05, 0x38, 0x62, 0xf5, 0x45, 0x8c, 0x30, 0x2d,
+    0x60, 0x99, 0x04, 0x84, 0x6d, 0x4d, 0x6c, 0x8d, 0xe4, 0x21, 0x08, 0x73, 0x03, 0xd0, 0x78,
+    0xa5, 0x92, 0x8e, 0x98, 0x16, 0xb0, 0x4c, 0x02, 0x1c, 0x84, 0xfd, 0xb8, 0x8f, 0x4c, 0x0b,
+    0x58, 0x26, 0x01, 0x68, 0x8f, 0x55, 0xdf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x9a,
+    0xad, 0x05, 0x92, 0x95, 0x9b, 0xca, 0xf0, 0xab, 0x15, 0x28, 0x00, 0x00, 0x00, 0xf8, 0x70,
+    0x70, 0x7f, 0x0b, 0x44, 0x22, 0xce, 0xd1, 0x9f, 0xac, 0x65, 0x18, 0x59, 0x0a, 0x90, 0x2d,
+    0x26, 0xf8, 0xa0, 0x60, 0x5a, 0xc0, 0x32, 0x09, 0xdc, 0x38, 0x7e, 0x1e, 0xa2, 0x14, 0x4f,
+    0x68, 0x0c, 0x08, 0x28, 0x44, 0xd6, 0x44, 0xa3, 0xc8, 0x43, 0x10, 0xe6, 0x06, 0x74, 0x4f,
+    0x2e, 0x6b, 0xa4, 0x7c, 0x38, 0xb8, 0xbf, 0x05, 0xc0, 0x5a, 0x86, 0x91, 0xa5, 0x30, 0x2d,
+    0x60, 0x99, 0x04, 0x0c, 0x66, 0xde, 0xb7, 0xa6, 0xe4, 0x21, 0x08, 0x73, 0x03, 0x58, 0x71,
+    0x36, 0xde, 0xa7, 0x98, 0x16, 0xb0, 0x4c, 0x02, 0xa4, 0x7c, 0x8e, 0x04, 0xa9, 0x4c, 0x0b,
+    0x58, 0x26, 0x01, 0xf0, 0x87, 0xe6, 0x2a, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x06, 0x15, 0x82, 0x03, 0x15, 0x82,
+    0x03, 0x5c, 0x15, 0xac, 0x02, 0x15, 0x3c, 0x15, 0xac, 0x02, 0x15, 0x0e, 0x15, 0x28, 0x15,
+    0x00, 0x12, 0x00, 0x00, 0x27, 0xde, 0x7b, 0xef, 0xbd, 0xf7, 0xde, 0x7b, 0xef, 0xbd, 0xf7,
+    0xde, 0x7b, 0xef, 0xbd, 0xf7, 0xde, 0x7b, 0xef, 0x3d, 0x80, 0x01, 0x04, 0x78, 0x00, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0xce, 0x32, 0x65, 0x99, 0xb2, 0x2c, 0x53, 0x96, 0x29, 0xcc, 0x32,
+    0x65, 0x99, 0xb2, 0x2c, 0x53, 0x96, 0x09, 0xcc, 0x32, 0x65, 0x99, 0xb2, 0x2c, 0x53, 0x96,
+    0x09, 0xcc, 0x32, 0x65, 0x99, 0xb2, 0x2c, 0x53, 0x96, 0x09, 0xcc, 0x32, 0x65, 0x99, 0xb2,
+    0x2c, 0x53, 0x96, 0x09, 0x00, 0x00, 0x00, 0x80, 0x01, 0x04, 0x78, 0x08, 0x07, 0x03, 0x03,
+    0x03, 0x03, 0xe8, 0x3a, 0x76, 0x1d, 0xbb, 0xae, 0x63, 0xd7, 0xd1, 0xea, 0x3a, 0x76, 0x1d,
+    0xbb, 0xae, 0x63, 0xd7, 0xd1, 0xea, 0x3a, 0x76, 0x1d, 0xbb, 0xae, 0x63, 0xd7, 0xd1, 0xea,
+    0x3a, 0x76, 0x1d, 0xbb, 0xae, 0x63, 0xd7, 0xd1, 0xea, 0x3a, 0x76, 0x1d, 0xbb, 0xae, 0x63,
+    0xd7, 0x11, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+    0x37, 0x38, 0x39, 0x31, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x32,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x33, 0x30, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x34, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x15, 0x06, 0x15, 0xa0, 0x07, 0x15, 0xa0, 0x07, 0x5c, 0x15, 0xac, 0x02, 0x15,
+    0x00, 0x15, 0xac, 0x02, 0x15, 0x0c, 0x15, 0x00, 0x15, 0x00, 0x12, 0x00, 0x00, 0x80, 0x01,
+    0x04, 0x96, 0x01, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x30, 0x37, 0x31, 0x34, 0x32, 0x31, 0x32, 0x38,
+    0x33, 0x35, 0x34, 0x32, 0x34, 0x39, 0x35, 0x36, 0x36, 0x33, 0x37, 0x30, 0x37, 0x37, 0x38,
+    0x34, 0x39, 0x31, 0x39, 0x38, 0x31, 0x30, 0x35, 0x31, 0x31, 0x32, 0x31, 0x31, 0x39, 0x31,
+    0x32, 0x36, 0x31, 0x33, 0x33, 0x31, 0x34, 0x30, 0x31, 0x34, 0x37, 0x31, 0x35, 0x34, 0x31,
+    0x36, 0x31, 0x31, 0x36, 0x38, 0x31, 0x37, 0x35, 0x31, 0x38, 0x32, 0x31, 0x38, 0x39, 0x31,
+    0x39, 0x36, 0x32, 0x30, 0x33, 0x32, 0x31, 0x30, 0x32, 0x31, 0x37, 0x32, 0x32, 0x34, 0x32,
+    0x33, 0x31, 0x32, 0x33, 0x38, 0x32, 0x34, 0x35, 0x32, 0x35, 0x32, 0x32, 0x35, 0x39, 0x32,
+    0x36, 0x36, 0x32, 0x37, 0x33, 0x32, 0x38, 0x30, 0x32, 0x38, 0x37, 0x32, 0x39, 0x34, 0x33,
+    0x30, 0x31, 0x33, 0x30, 0x38, 0x33, 0x31, 0x35, 0x33, 0x32, 0x32, 0x33, 0x32, 0x39, 0x33,
+    0x33, 0x36, 0x33, 0x34, 0x33, 0x33, 0x35, 0x30, 0x33, 0x35, 0x37, 0x33, 0x36, 0x34, 0x33,
+    0x37, 0x31, 0x33, 0x37, 0x38, 0x33, 0x38, 0x35, 0x33, 0x39, 0x32, 0x33, 0x39, 0x39, 0x34,
+    0x30, 0x36, 0x34, 0x31, 0x33, 0x34, 0x32, 0x30, 0x34, 0x32, 0x37, 0x34, 0x33, 0x34, 0x34,
+    0x34, 0x31, 0x34, 0x34, 0x38, 0x34, 0x35, 0x35, 0x34, 0x36, 0x32, 0x34, 0x36, 0x39, 0x34,
+    0x37, 0x36, 0x34, 0x38, 0x33, 0x34, 0x39, 0x30, 0x34, 0x39, 0x37, 0x35, 0x30, 0x34, 0x35,
+    0x31, 0x31, 0x35, 0x31, 0x38, 0x35, 0x32, 0x35, 0x35, 0x33, 0x32, 0x35, 0x33, 0x39, 0x35,
+    0x34, 0x36, 0x35, 0x35, 0x33, 0x35, 0x36, 0x30, 0x35, 0x36, 0x37, 0x35, 0x37, 0x34, 0x35,
+    0x38, 0x31, 0x35, 0x38, 0x38, 0x35, 0x39, 0x35, 0x36, 0x30, 0x32, 0x36, 0x30, 0x39, 0x36,
+    0x31, 0x36, 0x36, 0x32, 0x33, 0x36, 0x33, 0x30, 0x36, 0x33, 0x37, 0x36, 0x34, 0x34, 0x36,
+    0x35, 0x31, 0x36, 0x35, 0x38, 0x36, 0x36, 0x35, 0x36, 0x37, 0x32, 0x36, 0x37, 0x39, 0x36,
+    0x38, 0x36, 0x36, 0x39, 0x33, 0x37, 0x30, 0x30, 0x37, 0x30, 0x37, 0x37, 0x31, 0x34, 0x37,
+    0x32, 0x31, 0x37, 0x32, 0x38, 0x37, 0x33, 0x35, 0x37, 0x34, 0x32, 0x37, 0x34, 0x39, 0x37,
+    0x35, 0x36, 0x37, 0x36, 0x33, 0x37, 0x37, 0x30, 0x37, 0x37, 0x37, 0x37, 0x38, 0x34, 0x37,
+    0x39, 0x31, 0x37, 0x39, 0x38, 0x38, 0x30, 0x35, 0x38, 0x31, 0x32, 0x38, 0x31, 0x39, 0x38,
+    0x32, 0x36, 0x38, 0x33, 0x33, 0x38, 0x34, 0x30, 0x38, 0x34, 0x37, 0x38, 0x35, 0x34, 0x38,
+    0x36, 0x31, 0x38, 0x36, 0x38, 0x38, 0x37, 0x35, 0x38, 0x38, 0x32, 0x38, 0x38, 0x39, 0x38,
+    0x39, 0x36, 0x39, 0x30, 0x33, 0x39, 0x31, 0x30, 0x39, 0x31, 0x37, 0x39, 0x32, 0x34, 0x39,
+    0x33, 0x31, 0x39, 0x33, 0x38, 0x39, 0x34, 0x35, 0x39, 0x35, 0x32, 0x39, 0x35, 0x39, 0x39,
+    0x36, 0x36, 0x39, 0x37, 0x33, 0x39, 0x38, 0x30, 0x39, 0x38, 0x37, 0x39, 0x39, 0x34, 0x31,
+    0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x38, 0x31, 0x30, 0x31, 0x35, 0x31, 0x30, 0x32, 0x32,
+    0x31, 0x30, 0x32, 0x39, 0x31, 0x30, 0x33, 0x36, 0x31, 0x30, 0x34, 0x33, 0x15, 0x02, 0x19,
+    0x5c, 0x48, 0x06, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x15, 0x08, 0x00, 0x15, 0x02, 0x25,
+    0x00, 0x18, 0x01, 0x61, 0x00, 0x15, 0x04, 0x25, 0x00, 0x18, 0x01, 0x62, 0x00, 0x15, 0x0c,
+    0x25, 0x02, 0x18, 0x01, 0x63, 0x25, 0x00, 0x00, 0x15, 0x0c, 0x25, 0x00, 0x18, 0x01, 0x64,
+    0x25, 0x00, 0x00, 0x16, 0xac, 0x02, 0x19, 0x1c, 0x19, 0x4c, 0x26, 0x08, 0x1c, 0x15, 0x02,
+    0x19, 0x25, 0x0a, 0x06, 0x19, 0x18, 0x01, 0x61, 0x15, 0x00, 0x16, 0xac, 0x02, 0x16, 0xf0,
+    0x02, 0x16, 0xf0, 0x02, 0x26, 0x08, 0x00, 0x00, 0x26, 0xf8, 0x02, 0x1c, 0x15, 0x04, 0x19,
+    0x25, 0x0a, 0x06, 0x19, 0x18, 0x01, 0x62, 0x15, 0x00, 0x16, 0xac, 0x02, 0x16, 0x90, 0x0d,
+    0x16, 0x90, 0x0d, 0x26, 0xf8, 0x02, 0x00, 0x00, 0x26, 0x88, 0x10, 0x1c, 0x15, 0x0c, 0x19,
+    0x25, 0x0e, 0x06, 0x19, 0x18, 0x01, 0x63, 0x15, 0x00, 0x16, 0xac, 0x02, 0x16, 0xb6, 0x03,
+    0x16, 0xb6, 0x03, 0x26, 0x88, 0x10, 0x00, 0x00, 0x26, 0xbe, 0x13, 0x1c, 0x15, 0x0c, 0x19,
+    0x25, 0x0c, 0x06, 0x19, 0x18, 0x01, 0x64, 0x15, 0x00, 0x16, 0xac, 0x02, 0x16, 0xd4, 0x07,
+    0x16, 0xd4, 0x07, 0x26, 0xbe, 0x13, 0x00, 0x00, 0x16, 0x8a, 0x1b, 0x16, 0xac, 0x02, 0x00,
+    0x00, 0xb8, 0x00, 0x00, 0x00, 0x50, 0x41, 0x52, 0x31};
+  unsigned int delta_parquet_len = 1929;
+
+  constexpr cudf::size_type num_rows = 150;
+  auto col0_data = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(i * i - 1000); });
+  auto col1_data = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return static_cast<int64_t>(i) * 1234567891 * (i % 2 ? -1 : 1);
+  });
+  auto col2_data = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "str" + std::to_string(i / 3); });
+  auto col2_valid =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+  auto col3_data = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::to_string(i * 7); });
+  column_wrapper<int32_t> col0(col0_data, col0_data + num_rows);
+  column_wrapper<int64_t> col1(col1_data, col1_data + num_rows);
+  column_wrapper<cudf::string_view> col2(col2_data, col2_data + num_rows, col2_valid);
+  column_wrapper<cudf::string_view> col3(col3_data, col3_data + num_rows);
+  table_view expected({col0, col1, col2, col3});
+
+  cudf_io::parquet_reader_options read_opts = cudf_io::parquet_reader_options::builder(
+    cudf_io::source_info{reinterpret_cast<const char*>(delta_parquet), delta_parquet_len});
+  auto result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+  // starts within the first block of each stream and ends within the last one
+  read_opts.set_skip_rows(40);
+  read_opts.set_num_rows(100);
+  result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {40, 140}).front(), result.tbl->view());
+}
+
 TEST_F(ParquetWriterTest, RowGroupSizeInvalid)
 {
   const auto unused_table = std::make_unique<table>();
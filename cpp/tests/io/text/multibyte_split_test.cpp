@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -141,3 +141,36 @@ TEST_F(MultibyteSplitTest, HandpickedInput)
 
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *out, debug_output_level::ALL_ERRORS);
 }
+
+TEST_F(MultibyteSplitTest, MultipleDelimiters)
+{
+  auto delimiters = std::vector<std::string>({"::|", "\n"});
+  auto host_input = std::string("aaa::|bbb\nccc::|\nddd");
+
+  auto expected = strings_column_wrapper{"aaa::|", "bbb\n", "ccc::|", "\n", "ddd"};
+
+  auto source = cudf::io::text::make_source(host_input);
+  auto out    = cudf::io::text::multibyte_split(*source, delimiters);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *out);
+}
+
+TEST_F(MultibyteSplitTest, ByteRanges)
+{
+  auto delimiter  = std::string("::|");
+  auto host_input = std::string("aaa::|bbbb::|cc::|ddddd::|e");
+  auto source     = cudf::io::text::make_source(host_input);
+
+  // rows belong to the range they begin in, and the last of them is read past the range end
+  auto const first  = cudf::io::text::byte_range_info{0, 8};
+  auto const second = cudf::io::text::byte_range_info{8, 10};
+  auto const third  = cudf::io::text::byte_range_info{18, 9};
+
+  auto out0 = cudf::io::text::multibyte_split(*source, delimiter, first);
+  auto out1 = cudf::io::text::multibyte_split(*source, delimiter, second);
+  auto out2 = cudf::io::text::multibyte_split(*source, delimiter, third);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(strings_column_wrapper{"aaa::|", "bbbb::|"}, *out0);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(strings_column_wrapper{"cc::|"}, *out1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(strings_column_wrapper{"ddddd::|", "e"}, *out2);
+}
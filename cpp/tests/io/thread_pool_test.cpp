@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/thread_pool.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <atomic>
+#include <future>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+struct ThreadPoolTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ThreadPoolTest, NestedSubmissions)
+{
+  cudf::detail::thread_pool pool(4);
+  std::atomic<int> nested{0};
+  std::vector<std::future<int>> tasks;
+  for (int i = 0; i < 1000; ++i) {
+    tasks.push_back(pool.submit([i, &pool, &nested] {
+      // Tasks submitted from a thread of the pool go to its own queue, and can be stolen
+      if (i % 10 == 0) { pool.push_task([&nested] { ++nested; }); }
+      return i;
+    }));
+  }
+  auto const sum = std::accumulate(
+    tasks.begin(), tasks.end(), 0, [](int sum, auto& task) { return sum + task.get(); });
+  EXPECT_EQ(sum, 999 * 1000 / 2);
+
+  pool.wait_for_tasks();
+  EXPECT_EQ(nested, 100);
+  EXPECT_EQ(pool.get_tasks_total(), 0u);
+
+  auto failing = pool.submit([]() -> int { throw std::runtime_error("task failed"); });
+  EXPECT_THROW(failing.get(), std::runtime_error);
+}
+
+TEST_F(ThreadPoolTest, Reset)
+{
+  cudf::detail::thread_pool pool(2);
+  std::vector<int> values(10000);
+  pool.parallelize_loop(0, 9999, [&](int i) { values[i] = i; });
+  EXPECT_EQ(std::accumulate(values.begin(), values.end(), 0l), 9999l * 10000 / 2);
+
+  pool.reset(5);
+  EXPECT_EQ(pool.get_thread_count(), 5u);
+  std::fill(values.begin(), values.end(), 0);
+  pool.parallelize_loop(0, 9999, [&](int i) { values[i] = i; });
+  EXPECT_EQ(std::accumulate(values.begin(), values.end(), 0l), 9999l * 10000 / 2);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -492,6 +492,42 @@ TYPED_TEST(ConditionalInnerJoinTest, TestSymmetry)
     {{0, 1, 2}}, {{1, 2, 3}}, expression_reverse, {{0, 0}, {0, 1}, {0, 2}, {1, 1}, {1, 2}, {2, 2}});
 };
 
+TYPED_TEST(ConditionalInnerJoinTest, TestBandCondition)
+{
+  auto col_ref_right_1 = cudf::ast::column_reference(1, cudf::ast::table_reference::RIGHT);
+  auto after_start =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref_left_0, col_ref_right_0);
+  auto before_end =
+    cudf::ast::operation(cudf::ast::ast_operator::LESS_EQUAL, col_ref_left_0, col_ref_right_1);
+  auto expression =
+    cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, after_start, before_end);
+
+  this->test({{0, 5, 10, 15}},
+             {{0, 4, 12}, {5, 11, 20}},
+             expression,
+             {{0, 0}, {1, 0}, {1, 1}, {2, 1}, {3, 2}});
+};
+
+TYPED_TEST(ConditionalInnerJoinTest, TestBandConditionWithFilter)
+{
+  auto col_ref_left_1  = cudf::ast::column_reference(1, cudf::ast::table_reference::LEFT);
+  auto col_ref_right_1 = cudf::ast::column_reference(1, cudf::ast::table_reference::RIGHT);
+  auto col_ref_right_2 = cudf::ast::column_reference(2, cudf::ast::table_reference::RIGHT);
+  auto after_start =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_left_0, col_ref_right_0);
+  auto before_end =
+    cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_left_0, col_ref_right_1);
+  auto band = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, after_start, before_end);
+  auto same_key =
+    cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref_left_1, col_ref_right_2);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, band, same_key);
+
+  this->test({{0, 5, 10, 15}, {1, 2, 1, 2}},
+             {{0, 4, 12}, {5, 11, 20}, {1, 2, 2}},
+             expression,
+             {{1, 1}, {3, 2}});
+};
+
 TYPED_TEST(ConditionalInnerJoinTest, TestCompareRandomToHash)
 {
   auto [left, right] = gen_random_repeated_columns<TypeParam>();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -1431,6 +1431,91 @@ TEST_F(JoinTest, HashJoinLargeOutputSize)
   EXPECT_EQ(col_size * col_size, output_size);
 }
 
+TEST_F(JoinTest, HashJoinUniqueBuildKeys)
+{
+  column_wrapper<int32_t> build_col{{4, 1, 3, 0, 2}, {1, 1, 1, 1, 0}};
+  column_wrapper<int32_t> probe_col{{1, 1, 5, 3, 0, 0}};
+  cudf::table_view build{{build_col}};
+  cudf::table_view probe{{probe_col}};
+
+  // Without output sizes, the first probe counts its matches and the later probes of unique keys
+  // are sized from the number of probe rows
+  cudf::hash_join hash_join(build, cudf::null_equality::EQUAL);
+  EXPECT_EQ(hash_join.left_join_size(probe), 6u);
+
+  {
+    auto result = hash_join.inner_join(probe);
+    column_wrapper<int32_t> col_gold_0{{0, 1, 3, 4, 5}};
+    column_wrapper<int32_t> col_gold_1{{1, 1, 2, 3, 3}};
+    auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+  }
+
+  {
+    auto result = hash_join.left_join(probe);
+    column_wrapper<int32_t> col_gold_0{{0, 1, 2, 3, 4, 5}};
+    column_wrapper<int32_t> col_gold_1{{1, 1, NoneValue, 2, 3, 3}};
+    auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+  }
+
+  {
+    auto result = hash_join.full_join(probe);
+    column_wrapper<int32_t> col_gold_0{{0, 1, 2, 3, 4, 5, NoneValue, NoneValue}};
+    column_wrapper<int32_t> col_gold_1{{1, 1, NoneValue, 2, 3, 3, 0, 4}};
+    auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+  }
+}
+
+TEST_F(JoinTest, LazyJoinMaterialize)
+{
+  column_wrapper<int32_t> left_key{{3, 1, 2, 0, 3}};
+  strcol_wrapper left_str{{"a", "b", "c", "d", "e"}, {1, 0, 1, 1, 1}};
+  column_wrapper<int64_t> left_val{{10, 11, 12, 13, 14}, {1, 1, 0, 1, 1}};
+  column_wrapper<int32_t> right_key{{1, 3, 4, 3}};
+  column_wrapper<double> right_val{{0.5, 1.5, 2.5, 3.5}, {1, 0, 1, 1}};
+  strcol_wrapper right_str{{"w", "x", "y", "z"}};
+  cudf::table_view left{{left_key, left_str, left_val}};
+  cudf::table_view right{{right_key, right_val, right_str}};
+
+  auto const as_column = [](cudf::device_span<cudf::size_type const> map) {
+    return cudf::column_view{
+      cudf::data_type{cudf::type_id::INT32}, static_cast<cudf::size_type>(map.size()), map.data()};
+  };
+
+  {
+    auto const result = cudf::lazy_left_join(left, right, {0}, {0});
+    EXPECT_EQ(result.size(), 7u);
+
+    // The materialized columns are those gathered separately from each table
+    auto const materialized = result.materialize({0, 1, 2}, {1, 2});
+    auto const left_gold    = cudf::gather(
+      left, as_column(result.left_indices()), cudf::out_of_bounds_policy::NULLIFY);
+    auto const right_gold = cudf::gather(
+      right.select({1, 2}), as_column(result.right_indices()), cudf::out_of_bounds_policy::NULLIFY);
+    auto gold_columns = left_gold->release();
+    for (auto& col : right_gold->release()) {
+      gold_columns.push_back(std::move(col));
+    }
+    cudf::table const gold{std::move(gold_columns)};
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(gold.view(), materialized->view());
+  }
+
+  {
+    auto result             = cudf::lazy_inner_join(left, right, {0}, {0});
+    auto const materialized = result.materialize({2}, {2});
+    auto const left_gold    = cudf::gather(left.select({2}), as_column(result.left_indices()));
+    auto const right_gold   = cudf::gather(right.select({2}), as_column(result.right_indices()));
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(left_gold->get_column(0), materialized->get_column(0));
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(right_gold->get_column(0), materialized->get_column(1));
+
+    auto const maps = result.release();
+    EXPECT_EQ(maps.first->size(), 5u);
+    EXPECT_EQ(maps.second->size(), 5u);
+  }
+}
+
 struct JoinDictionaryTest : public cudf::test::BaseFixture {
 };
 
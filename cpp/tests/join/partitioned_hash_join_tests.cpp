@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/spill.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <map>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+using strcol_wrapper = cudf::test::strings_column_wrapper;
+
+struct PartitionedHashJoinTest : public cudf::test::BaseFixture {
+  column_wrapper<int32_t> build_keys{{3, 1, 2, 0, 3, 7, 5}, {1, 1, 1, 1, 1, 0, 1}};
+  strcol_wrapper build_values{"b0", "b1", "b2", "b3", "b4", "b5", "b6"};
+  column_wrapper<int32_t> probe_keys{{2, 2, 0, 4, 3, 9, 6, 1}, {1, 1, 1, 1, 1, 0, 1, 1}};
+  strcol_wrapper probe_values{"p0", "p1", "p2", "p3", "p4", "p5", "p6", "p7"};
+
+  cudf::table_view build() { return cudf::table_view{{build_values, build_keys}}; }
+  cudf::table_view probe() { return cudf::table_view{{probe_keys, probe_values}}; }
+
+  /**
+   * @brief Adds both tables to the join in chunks of up to three rows.
+   */
+  void add_chunks(cudf::partitioned_hash_join& join)
+  {
+    for (auto const& chunk : cudf::split(build(), {3, 6})) {
+      join.add_build(chunk);
+    }
+    for (auto const& chunk : cudf::split(probe(), {3})) {
+      join.add_probe(chunk);
+    }
+  }
+
+  /**
+   * @brief Returns the results of joining all the partitions, sorted.
+   */
+  template <typename Join>
+  std::unique_ptr<cudf::table> join_partitions(cudf::partitioned_hash_join& join, Join join_one)
+  {
+    std::vector<std::unique_ptr<cudf::table>> results;
+    std::vector<cudf::table_view> views;
+    for (cudf::size_type p = 0; p < join.num_partitions(); ++p) {
+      results.push_back(join_one(join, p));
+      views.push_back(results.back()->view());
+    }
+    return sorted(cudf::concatenate(views)->view());
+  }
+
+  std::unique_ptr<cudf::table> sorted(cudf::table_view const& table)
+  {
+    return cudf::gather(table, cudf::sorted_order(table)->view());
+  }
+};
+
+TEST_F(PartitionedHashJoinTest, MatchesUnpartitionedJoins)
+{
+  auto const expected_inner = sorted(cudf::inner_join(probe(), build(), {0}, {1})->view());
+  auto const expected_left  = sorted(cudf::left_join(probe(), build(), {0}, {1})->view());
+  auto const expected_full  = sorted(cudf::full_join(probe(), build(), {0}, {1})->view());
+
+  cudf::partitioned_hash_join inner(4, {1}, {0});
+  add_chunks(inner);
+  auto const inner_result =
+    join_partitions(inner, [](auto& join, auto p) { return join.inner_join(p); });
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*expected_inner, *inner_result);
+
+  cudf::partitioned_hash_join left(4, {1}, {0});
+  add_chunks(left);
+  auto const left_result =
+    join_partitions(left, [](auto& join, auto p) { return join.left_join(p); });
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*expected_left, *left_result);
+
+  cudf::partitioned_hash_join full(4, {1}, {0});
+  add_chunks(full);
+  auto const full_result =
+    join_partitions(full, [](auto& join, auto p) { return join.full_join(p); });
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*expected_full, *full_result);
+}
+
+/**
+ * @brief Partition store that keeps the chunks in device memory and counts them.
+ */
+class counting_partition_store : public cudf::join_partition_store {
+ public:
+  explicit counting_partition_store(int& stored) : _stored(stored) {}
+
+  void store(cudf::join_side side,
+             cudf::size_type partition,
+             cudf::packed_columns&& chunk,
+             rmm::cuda_stream_view) override
+  {
+    ++_stored;
+    _chunks[{side, partition}].push_back(std::move(chunk));
+  }
+
+  std::vector<cudf::packed_columns> retrieve(cudf::join_side side,
+                                             cudf::size_type partition,
+                                             rmm::cuda_stream_view,
+                                             rmm::mr::device_memory_resource*) override
+  {
+    auto chunks = std::move(_chunks[{side, partition}]);
+    _chunks.erase({side, partition});
+    return chunks;
+  }
+
+ private:
+  int& _stored;
+  std::map<std::pair<cudf::join_side, cudf::size_type>, std::vector<cudf::packed_columns>> _chunks;
+};
+
+TEST_F(PartitionedHashJoinTest, CustomStore)
+{
+  int stored = 0;
+  cudf::partitioned_hash_join join(
+    3, {1}, {0}, cudf::null_equality::UNEQUAL, std::make_unique<counting_partition_store>(stored));
+  add_chunks(join);
+  // Each chunk is stored as one chunk per partition it has rows in
+  EXPECT_GE(stored, 5);
+  EXPECT_LE(stored, 5 * 3);
+
+  auto const expected =
+    sorted(cudf::inner_join(probe(), build(), {0}, {1}, cudf::null_equality::UNEQUAL)->view());
+  auto const result = join_partitions(join, [](auto& join, auto p) { return join.inner_join(p); });
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*expected, *result);
+
+  EXPECT_THROW(join.inner_join(3), std::out_of_range);
+}
+
+TEST_F(PartitionedHashJoinTest, SpillingStore)
+{
+  // A limit of one byte spills every partition as soon as it is stored
+  cudf::spill_manager manager(1);
+  cudf::partitioned_hash_join join(
+    3, {1}, {0}, cudf::null_equality::UNEQUAL, cudf::make_spilling_join_partition_store(manager));
+  add_chunks(join);
+  EXPECT_EQ(manager.device_bytes(), std::size_t{0});
+  EXPECT_GT(manager.host_bytes(), std::size_t{0});
+
+  auto const expected =
+    sorted(cudf::inner_join(probe(), build(), {0}, {1}, cudf::null_equality::UNEQUAL)->view());
+  auto const result = join_partitions(join, [](auto& join, auto p) { return join.inner_join(p); });
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*expected, *result);
+  EXPECT_EQ(manager.host_bytes(), std::size_t{0});
+}
+
+TEST_F(PartitionedHashJoinTest, InvalidArguments)
+{
+  EXPECT_THROW(cudf::partitioned_hash_join(0, {1}, {0}), cudf::logic_error);
+  EXPECT_THROW(cudf::partitioned_hash_join(2, {1}, {0, 1}), cudf::logic_error);
+
+  cudf::partitioned_hash_join join(2, {1}, {0});
+  join.add_build(build());
+  EXPECT_THROW(join.inner_join(0), cudf::logic_error);
+}
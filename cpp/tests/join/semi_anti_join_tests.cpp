@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -230,3 +230,42 @@ TEST_F(JoinTest, AntiJoinWithStructsAndNullsNotEqual)
 
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
 }
+
+TEST_F(JoinTest, SemiJoinHashTableRepeatedProbes)
+{
+  column_wrapper<int32_t> build_col{{0, 1, 3, 7}, {1, 1, 1, 0}};
+  column_wrapper<int32_t> probe_col0{0, 1, 2};
+  column_wrapper<int32_t> probe_col1{{3, 3, 9, 5}, {1, 1, 0, 1}};
+
+  cudf::semi_join_hash_table hash_table(cudf::table_view{{build_col}});
+  auto as_column = [](auto const& indices) {
+    return cudf::column_view(
+      cudf::data_type{cudf::type_to_id<cudf::size_type>()}, indices->size(), indices->data());
+  };
+
+  auto const probe0 = cudf::table_view{{probe_col0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<cudf::size_type>{0, 1},
+                                 as_column(hash_table.left_semi_join(probe0)));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<cudf::size_type>{2},
+                                 as_column(hash_table.left_anti_join(probe0)));
+
+  // Nulls match, as the hash table was built with null_equality::EQUAL
+  auto const probe1 = cudf::table_view{{probe_col1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<bool>{true, true, true, false},
+                                 hash_table.contains(probe1)->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<cudf::size_type>{3},
+                                 as_column(hash_table.left_anti_join(probe1)));
+}
+
+TEST_F(JoinTest, SemiJoinHashTableEmptyBuild)
+{
+  column_wrapper<int32_t> build_col{};
+  column_wrapper<int32_t> probe_col{4, 5};
+
+  cudf::semi_join_hash_table hash_table(cudf::table_view{{build_col}});
+  auto const probe = cudf::table_view{{probe_col}};
+  EXPECT_EQ(hash_table.left_semi_join(probe)->size(), 0u);
+  EXPECT_EQ(hash_table.left_anti_join(probe)->size(), 2u);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<bool>{false, false},
+                                 hash_table.contains(probe)->view());
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <limits>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+using strcol_wrapper = cudf::test::strings_column_wrapper;
+constexpr cudf::size_type NoneValue = std::numeric_limits<cudf::size_type>::min();
+
+struct SortMergeJoinTest : public cudf::test::BaseFixture {
+  using gather_maps = std::pair<std::unique_ptr<rmm::device_uvector<cudf::size_type>>,
+                                std::unique_ptr<rmm::device_uvector<cudf::size_type>>>;
+
+  static cudf::table_view as_table(gather_maps const& result)
+  {
+    auto const size = static_cast<cudf::size_type>(result.first->size());
+    return cudf::table_view{
+      {cudf::column_view{cudf::data_type{cudf::type_id::INT32}, size, result.first->data()},
+       cudf::column_view{cudf::data_type{cudf::type_id::INT32}, size, result.second->data()}}};
+  }
+};
+
+TEST_F(SortMergeJoinTest, SortedInputs)
+{
+  column_wrapper<int32_t> left_col0{{0, 1, 1, 1, 2, 5}, {0, 1, 1, 1, 1, 1}};
+  strcol_wrapper left_col1{"a", "a", "b", "b", "c", "c"};
+  column_wrapper<int32_t> right_col0{{0, 1, 1, 1, 2, 3}, {0, 1, 1, 1, 1, 1}};
+  strcol_wrapper right_col1{"a", "b", "b", "c", "c", "c"};
+  auto const left  = cudf::table_view{{left_col0, left_col1}};
+  auto const right = cudf::table_view{{right_col0, right_col1}};
+
+  // The output of the sorted inputs is ordered by left index
+  {
+    auto const result = cudf::sort_merge_inner_join(left, right);
+    column_wrapper<int32_t> expected_left{0, 2, 2, 3, 3, 4};
+    column_wrapper<int32_t> expected_right{0, 1, 2, 1, 2, 4};
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expected_left, expected_right}),
+                                  as_table(result));
+  }
+
+  {
+    auto const result =
+      cudf::sort_merge_left_join(left, right, {}, {}, cudf::null_equality::UNEQUAL);
+    column_wrapper<int32_t> expected_left{0, 1, 2, 2, 3, 3, 4, 5};
+    column_wrapper<int32_t> expected_right{NoneValue, NoneValue, 1, 2, 1, 2, 4, NoneValue};
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expected_left, expected_right}),
+                                  as_table(result));
+  }
+}
+
+TEST_F(SortMergeJoinTest, UnsortedInputsFallBack)
+{
+  column_wrapper<int32_t> left_col{5, 1, 3, 1};
+  column_wrapper<int32_t> right_col{1, 4, 3, 1};
+  auto const left  = cudf::table_view{{left_col}};
+  auto const right = cudf::table_view{{right_col}};
+
+  auto const result = cudf::sort_merge_inner_join(left, right);
+  auto const sorted = cudf::sort(as_table(result));
+  column_wrapper<int32_t> expected_left{1, 1, 2, 3, 3};
+  column_wrapper<int32_t> expected_right{0, 3, 2, 0, 3};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expected_left, expected_right}), *sorted);
+}
+
+TEST_F(SortMergeJoinTest, DescendingOrder)
+{
+  column_wrapper<int32_t> left_col{9, 4, 4, 1};
+  column_wrapper<int32_t> right_col{8, 4, 1, 1, 0};
+  auto const left  = cudf::table_view{{left_col}};
+  auto const right = cudf::table_view{{right_col}};
+
+  auto const result = cudf::sort_merge_left_join(left, right, {cudf::order::DESCENDING});
+  column_wrapper<int32_t> expected_left{0, 1, 2, 3, 3};
+  column_wrapper<int32_t> expected_right{NoneValue, 1, 1, 2, 3};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expected_left, expected_right}),
+                                as_table(result));
+}
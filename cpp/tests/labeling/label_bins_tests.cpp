@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 #include <cudf/labeling/label_bins.hpp>
 #include <cudf/types.hpp>
 #include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/type_list_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
@@ -435,6 +436,45 @@ TEST(TestStringData, SlicedNonAsciiStringTest)
   }
 }
 
+struct OneHotEncodeBinsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(OneHotEncodeBinsTest, MatchesLabels)
+{
+  using LCW = cudf::test::lists_column_wrapper<cudf::size_type>;
+  fwc_wrapper<double> input{{1, 5, 0, 12, 7, 10, 4.5}, {1, 1, 0, 1, 1, 1, 1}};
+  fwc_wrapper<double> left_edges{0, 5};
+  fwc_wrapper<double> right_edges{5, 10};
+
+  auto const result = cudf::one_hot_encode_bins(
+    input, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::NO);
+  auto const expected = LCW{LCW{0}, LCW{1}, LCW{}, LCW{}, LCW{1}, LCW{}, LCW{0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+
+  auto const sliced        = cudf::slice(input, {1, 6})[0];
+  auto const sliced_result = cudf::one_hot_encode_bins(
+    sliced, left_edges, cudf::inclusive::NO, right_edges, cudf::inclusive::YES);
+  auto const sliced_expected = LCW{LCW{0}, LCW{}, LCW{}, LCW{1}, LCW{1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sliced_expected, sliced_result->view());
+}
+
+TEST_F(OneHotEncodeBinsTest, EmptyAndErrors)
+{
+  fwc_wrapper<float> input{};
+  fwc_wrapper<float> left_edges{0, 5};
+  fwc_wrapper<float> right_edges{5};
+  fwc_wrapper<float> other_right_edges{5, 10};
+
+  EXPECT_EQ(cudf::one_hot_encode_bins(
+              input, left_edges, cudf::inclusive::YES, other_right_edges, cudf::inclusive::NO)
+              ->size(),
+            0);
+  EXPECT_THROW(
+    cudf::one_hot_encode_bins(
+      input, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::NO),
+    cudf::logic_error);
+}
+
 }  // anonymous namespace
 
 CUDF_TEST_PROGRAM_MAIN()
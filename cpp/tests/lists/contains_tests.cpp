@@ -718,6 +718,113 @@ TYPED_TEST(TypedVectorContainsTest, ListContainsVectorWithNullsInListsAndInSearc
   }
 }
 
+TYPED_TEST(TypedVectorContainsTest, HashTableWithNullsInListsAndInSearchKeys)
+{
+  using T = TypeParam;
+
+  auto numerals = fixed_width_column_wrapper<T>{{x, 1, 2, x, 4, 5, x, 7, 8, x, x, 1, 2, x, 1},
+                                                nulls_at({0, 3, 6, 9, 10, 13})};
+
+  auto input_null_mask_iter = null_at(4);
+
+  auto search_space = make_lists_column(
+    8,
+    indices{0, 1, 3, 7, 7, 7, 10, 11, 15}.release(),
+    numerals.release(),
+    1,
+    cudf::test::detail::make_null_mask(input_null_mask_iter, input_null_mask_iter + 8));
+  // Search space: [ [x], [1,2], [x,4,5,x], [], x, [7,8,x], [x], [1,2,x,1] ]
+
+  auto search_keys = fixed_width_column_wrapper<T, int32_t>{{1, 2, 3, x, 2, 3, 1, 1}, null_at(3)};
+  auto constexpr HASH_TABLE = lists::search_strategy::HASH_TABLE;
+  {
+    // CONTAINS
+    auto result   = lists::contains(search_space->view(), search_keys, HASH_TABLE);
+    auto expected = bools{{0, 1, 0, x, x, 0, 0, 1}, nulls_at({3, 4})};
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+  }
+  {
+    // FIND_FIRST
+    auto result   = lists::index_of(search_space->view(), search_keys, FIND_FIRST, HASH_TABLE);
+    auto expected = indices{{absent, 1, absent, x, x, absent, absent, 0}, nulls_at({3, 4})};
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+  }
+  {
+    // FIND_LAST
+    auto result   = lists::index_of(search_space->view(), search_keys, FIND_LAST, HASH_TABLE);
+    auto expected = indices{{absent, 1, absent, x, x, absent, absent, 3}, nulls_at({3, 4})};
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+  }
+  {
+    // Sliced lists, with a scalar search key broadcast to all the rows.
+    auto const sliced = cudf::slice(search_space->view(), {5, 8})[0];
+    auto result =
+      lists::index_of(sliced, *create_scalar_search_key<T>(1), FIND_LAST, HASH_TABLE);
+    auto expected = indices{absent, absent, 3};
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+  }
+}
+
+TEST_F(ContainsTest, BinarySearchInSortedLists)
+{
+  auto numerals = fixed_width_column_wrapper<int32_t>{
+    {x, x, 1, 2, 2, 2, 5, 5, 4, 2, 2, 1, x, 7, 1, 3, 3, 3, 3, 8}, nulls_at({0, 1, 12})};
+  auto search_space =
+    make_lists_column(6, indices{0, 6, 13, 13, 14, 15, 20}.release(), numerals.release(), 0, {});
+  // Search space: [ [x,x,1,2,2,2], [5,5,4,2,2,1,x], [], [7], [1], [3,3,3,3,8] ]
+
+  auto search_keys             = fixed_width_column_wrapper<int32_t>{2, 2, 2, 7, 0, 3};
+  auto constexpr BINARY_SEARCH = lists::search_strategy::BINARY_SEARCH;
+  {
+    // CONTAINS
+    auto result   = lists::contains(search_space->view(), search_keys, BINARY_SEARCH);
+    auto expected = bools{1, 1, 0, 1, 0, 1};
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+  }
+  {
+    // FIND_FIRST
+    auto result   = lists::index_of(search_space->view(), search_keys, FIND_FIRST, BINARY_SEARCH);
+    auto expected = indices{3, 3, absent, 0, absent, 0};
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+  }
+  {
+    // FIND_LAST
+    auto result   = lists::index_of(search_space->view(), search_keys, FIND_LAST, BINARY_SEARCH);
+    auto expected = indices{5, 4, absent, 0, absent, 3};
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+  }
+}
+
+TEST_F(ContainsTest, LongListsScannedByWarps)
+{
+  // Three lists of 100 elements, long enough on average to be scanned with a warp per list.
+  auto constexpr num_rows  = 3;
+  auto constexpr list_size = 100;
+  auto const elements      = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return (i % list_size) % 40; });
+  auto const validity = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i != list_size + 5; });
+  auto numerals =
+    fixed_width_column_wrapper<int32_t>(elements, elements + num_rows * list_size, validity);
+  auto search_space =
+    make_lists_column(num_rows, indices{0, 100, 200, 300}.release(), numerals.release(), 0, {});
+  // Search space: [ [0..39,0..39,0..19], [0..4,x,6..39,0..39,0..19], [0..39,0..39,0..19] ]
+
+  auto search_keys = fixed_width_column_wrapper<int32_t>{5, 5, 45};
+  {
+    // FIND_FIRST
+    auto result   = lists::index_of(search_space->view(), search_keys, FIND_FIRST);
+    auto expected = indices{5, 45, absent};
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+  }
+  {
+    // FIND_LAST
+    auto result   = lists::index_of(search_space->view(), search_keys, FIND_LAST);
+    auto expected = indices{85, 85, absent};
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+  }
+}
+
 TEST_F(ContainsTest, BoolKeyVectorWithNullsInListsAndInSearchKeys)
 {
   using T = bool;
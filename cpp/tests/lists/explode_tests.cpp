@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -537,6 +537,38 @@ TEST_F(ExplodeTest, SlicedList)
   CUDF_TEST_EXPECT_TABLES_EQUAL(pos_ret->view(), pos_expected);
 }
 
+TEST_F(ExplodeTest, SiblingColumnsAroundEmptyLists)
+{
+  //    a              b      c           d
+  //    []             100    "one"       [1]
+  //    [1, 2, 3]      200    "two"       []
+  //    []             300    "three"     [2, 3]
+  //    [4]            400    "four"      [4]
+  //    [5, 6]         500    "five"      []
+
+  LCW a{LCW{}, LCW{1, 2, 3}, LCW{}, LCW{4}, LCW{5, 6}};
+  FCW b{100, 200, 300, 400, 500};
+  strings_column_wrapper c{"one", "two", "three", "four", "five"};
+  LCW d{LCW{1}, LCW{}, LCW{2, 3}, LCW{4}, LCW{}};
+
+  FCW expected_a{1, 2, 3, 4, 5, 6};
+  FCW expected_b{200, 200, 200, 400, 500, 500};
+  strings_column_wrapper expected_c{"two", "two", "two", "four", "five", "five"};
+  LCW expected_d{LCW{}, LCW{}, LCW{}, LCW{4}, LCW{}, LCW{}};
+
+  cudf::table_view t({b, c, a, d});
+  cudf::table_view expected({expected_b, expected_c, expected_a, expected_d});
+
+  auto ret = cudf::explode(t, 2);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(ret->view(), expected);
+
+  FCW expected_pos_col{0, 1, 2, 0, 0, 1};
+  cudf::table_view pos_expected({expected_b, expected_c, expected_pos_col, expected_a, expected_d});
+
+  auto pos_ret = cudf::explode_position(t, 2);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(pos_ret->view(), pos_expected);
+}
+
 TEST_F(ExplodeOuterTest, Empty)
 {
   LCW a{};
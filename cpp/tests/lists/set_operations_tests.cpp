@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/lists/set_operations.hpp>
+
+#include <limits>
+
+using namespace cudf::test::iterators;
+
+using IntListsCol   = cudf::test::lists_column_wrapper<int32_t>;
+using FloatListsCol = cudf::test::lists_column_wrapper<float>;
+using StringsCol    = cudf::test::strings_column_wrapper;
+using StructsCol    = cudf::test::structs_column_wrapper;
+using IntsCol       = cudf::test::fixed_width_column_wrapper<int32_t>;
+using BoolsCol      = cudf::test::fixed_width_column_wrapper<bool>;
+
+auto constexpr NaN       = std::numeric_limits<float>::quiet_NaN();
+auto constexpr null      = int32_t{0};  // nulls at the children columns level
+auto constexpr verbosity = cudf::test::debug_output_level::FIRST_ERROR;
+
+struct ListsSetOperationsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ListsSetOperationsTest, DistinctKeepsFirstOccurrences)
+{
+  auto const input =
+    IntListsCol{{IntListsCol{1, 1, 2, 3},
+                 {4},
+                 {} /*NULL*/,
+                 {},
+                 IntListsCol{{null, null, null, 5, 6, 6, 6, 5}, nulls_at({0, 1, 2})},
+                 {3, 2, 1, 3, 2, 1}},
+                null_at(2)};
+
+  {
+    auto const expected = IntListsCol{{IntListsCol{1, 2, 3},
+                                       {4},
+                                       {} /*NULL*/,
+                                       {},
+                                       IntListsCol{{null, 5, 6}, null_at(0)},
+                                       {3, 2, 1}},
+                                      null_at(2)};
+    auto const results = cudf::lists::distinct(cudf::lists_column_view{input});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected, verbosity);
+  }
+
+  // Unequal nulls are all kept.
+  {
+    auto const expected =
+      IntListsCol{{IntListsCol{1, 2, 3},
+                   {4},
+                   {} /*NULL*/,
+                   {},
+                   IntListsCol{{null, null, null, 5, 6}, nulls_at({0, 1, 2})},
+                   {3, 2, 1}},
+                  null_at(2)};
+    auto const results =
+      cudf::lists::distinct(cudf::lists_column_view{input}, cudf::null_equality::UNEQUAL);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected, verbosity);
+  }
+
+  // The lists of a sliced column are read from their offsets.
+  {
+    auto const sliced   = cudf::slice(input, {3, 6})[0];
+    auto const expected = IntListsCol{{}, IntListsCol{{null, 5, 6}, null_at(0)}, {3, 2, 1}};
+    auto const results  = cudf::lists::distinct(cudf::lists_column_view{sliced});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected, verbosity);
+  }
+}
+
+TEST_F(ListsSetOperationsTest, DistinctNaNsAndStructs)
+{
+  auto const floats = FloatListsCol{{1, NaN, NaN, 2, 1}, {NaN}};
+  {
+    auto const expected = FloatListsCol{{1, NaN, 2}, {NaN}};
+    auto const results  = cudf::lists::distinct(cudf::lists_column_view{floats});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected, verbosity);
+  }
+  {
+    auto const expected = FloatListsCol{{1, NaN, NaN, 2}, {NaN}};
+    auto const results  = cudf::lists::distinct(
+      cudf::lists_column_view{floats}, cudf::null_equality::EQUAL, cudf::nan_equality::UNEQUAL);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected, verbosity);
+  }
+
+  auto const get_structs = [] {
+    auto ints    = IntsCol{1, 2, 1, 1, 2, 2, 1};
+    auto strings = StringsCol{"a", "b", "a", "b", "b", "b", "a"};
+    return StructsCol{{ints, strings}};
+  };
+  auto const get_structs_expected = [] {
+    auto ints    = IntsCol{1, 2, 1, 2, 1};
+    auto strings = StringsCol{"a", "b", "b", "b", "a"};
+    return StructsCol{{ints, strings}};
+  };
+  auto const structs =
+    cudf::make_lists_column(2, IntsCol{0, 4, 7}.release(), get_structs().release(), 0, {});
+  auto const expected = cudf::make_lists_column(
+    2, IntsCol{0, 3, 5}.release(), get_structs_expected().release(), 0, {});
+  auto const results = cudf::lists::distinct(cudf::lists_column_view{structs->view()});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected->view(), verbosity);
+}
+
+TEST_F(ListsSetOperationsTest, SetOperations)
+{
+  auto const lhs =
+    IntListsCol{{IntListsCol{2, 1, 2}, {1, 2}, {3}, {} /*NULL*/, {}, {1, 5}}, null_at(3)};
+  auto const rhs = IntListsCol{{IntListsCol{1, 2, 4}, {3}, {}, {1}, {5}, {} /*NULL*/}, null_at(5)};
+
+  {
+    auto const expected = BoolsCol{{1, 0, 0, 0, 0, 0}, nulls_at({3, 5})};
+    auto const results =
+      cudf::lists::have_overlap(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected, verbosity);
+  }
+  {
+    auto const expected = IntListsCol{
+      {IntListsCol{2, 1}, {}, {}, {} /*NULL*/, {}, {} /*NULL*/}, nulls_at({3, 5})};
+    auto const results =
+      cudf::lists::intersect_distinct(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected, verbosity);
+  }
+  {
+    auto const expected = IntListsCol{
+      {IntListsCol{2, 1, 4}, {1, 2, 3}, {3}, {} /*NULL*/, {5}, {} /*NULL*/}, nulls_at({3, 5})};
+    auto const results =
+      cudf::lists::union_distinct(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected, verbosity);
+  }
+  {
+    auto const expected = IntListsCol{
+      {IntListsCol{}, {1, 2}, {3}, {} /*NULL*/, {}, {} /*NULL*/}, nulls_at({3, 5})};
+    auto const results =
+      cudf::lists::difference_distinct(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected, verbosity);
+  }
+
+  auto const floats = FloatListsCol{{1, 2}};
+  EXPECT_THROW(
+    cudf::lists::union_distinct(cudf::lists_column_view{lhs}, cudf::lists_column_view{floats}),
+    cudf::logic_error);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/merge.hpp>
 #include <cudf/sorting.hpp>
@@ -30,6 +31,10 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <thrust/iterator/constant_iterator.h>
+
+#include <numeric>
+#include <string>
 #include <vector>
 
 template <typename T>
@@ -873,6 +878,50 @@ TEST_F(MergeTest, StructsNestedWithNulls)
   // clang-format on
 }
 
+TEST_F(MergeTest, ManyTables)
+{
+  // Many sorted tables of repeated keys are merged at once, stably in the order of the tables
+  constexpr cudf::size_type num_tables = 64;
+  std::vector<cudf::order> const column_order{cudf::order::DESCENDING, cudf::order::ASCENDING};
+  std::vector<cudf::null_order> const null_precedence{cudf::null_order::AFTER,
+                                                      cudf::null_order::BEFORE};
+
+  std::vector<std::unique_ptr<cudf::table>> sorted_tables;
+  std::vector<cudf::table_view> tables;
+  for (cudf::size_type t = 0; t < num_tables; ++t) {
+    auto const num_rows = (t * 37) % 50;
+    auto const keys_it  = cudf::detail::make_counting_transform_iterator(
+      0, [t](auto row) { return (row * 13 + t * 7) % 20; });
+    auto const valids_it = cudf::detail::make_counting_transform_iterator(
+      0, [t](auto row) { return (row + t) % 9 != 0; });
+    auto const names_it = cudf::detail::make_counting_transform_iterator(
+      0, [t](auto row) { return std::string(1 + (row + t) % 3, 'a' + (row * 5 + t) % 4); });
+    cudf::test::fixed_width_column_wrapper<int32_t> keys(keys_it, keys_it + num_rows, valids_it);
+    cudf::test::strings_column_wrapper names(names_it, names_it + num_rows);
+    cudf::test::fixed_width_column_wrapper<int32_t> source(
+      thrust::make_constant_iterator(t), thrust::make_constant_iterator(t) + num_rows);
+    cudf::table_view const input({keys, names, source});
+    sorted_tables.push_back(
+      cudf::stable_sort_by_key(input, input.select({0, 1}), column_order, null_precedence));
+    tables.push_back(sorted_tables.back()->view());
+  }
+  auto const all_rows = cudf::concatenate(tables);
+
+  // The integer keys are compared by their packed sort keys, and the strings keys by row
+  for (cudf::size_type num_keys : {1, 2}) {
+    std::vector<cudf::size_type> key_cols(num_keys);
+    std::iota(key_cols.begin(), key_cols.end(), 0);
+    std::vector<cudf::order> const orders(column_order.begin(), column_order.begin() + num_keys);
+    std::vector<cudf::null_order> const nulls(null_precedence.begin(),
+                                              null_precedence.begin() + num_keys);
+
+    auto const result   = cudf::merge(tables, key_cols, orders, nulls);
+    auto const expected = cudf::stable_sort_by_key(
+      all_rows->view(), all_rows->view().select(key_cols), orders, nulls);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+  }
+}
+
 template <typename T>
 struct FixedPointTestAllReps : public cudf::test::BaseFixture {
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/copying.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/hashing.hpp>
 #include <cudf/partitioning.hpp>
@@ -24,6 +25,11 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <string>
+
 using cudf::test::fixed_width_column_wrapper;
 using cudf::test::strings_column_wrapper;
 
@@ -354,6 +360,98 @@ TYPED_TEST(HashPartitionFixedWidth, HasNulls)
   run_fixed_width_test<TypeParam>(10, 1000, 10, cudf::hash_id::HASH_IDENTITY, true);
 }
 
+TYPED_TEST(HashPartitionFixedWidth, ManyPartitions)
+{
+  run_fixed_width_test<TypeParam>(3, 20000, 3000, cudf::hash_id::HASH_MURMUR3);
+  run_fixed_width_test<TypeParam>(3, 20000, 4096, cudf::hash_id::HASH_IDENTITY, true);
+}
+
+TEST_F(HashPartition, ManyPartitionsIdentityHash)
+{
+  // With the identity hash, the row of value `i` goes to the partition `i % num_partitions`
+  constexpr cudf::size_type num_rows       = 10000;
+  constexpr cudf::size_type num_partitions = 3000;
+  auto const values_it = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                         [](auto i) { return (i * 7) % num_rows; });
+  fixed_width_column_wrapper<int32_t> values(values_it, values_it + num_rows);
+  auto const names_it = thrust::make_transform_iterator(
+    values_it, [](auto value) { return std::to_string(value); });
+  strings_column_wrapper names(names_it, names_it + num_rows);
+  cudf::table_view const input({values, names});
+
+  std::unique_ptr<cudf::table> result;
+  std::vector<cudf::size_type> offsets;
+  std::tie(result, offsets) =
+    cudf::hash_partition(input, {0}, num_partitions, cudf::hash_id::HASH_IDENTITY);
+
+  ASSERT_EQ(static_cast<size_t>(num_partitions), offsets.size());
+  offsets.push_back(num_rows);
+  auto const h_values = cudf::test::to_host<int32_t>(result->get_column(0)).first;
+  for (cudf::size_type partition = 0; partition < num_partitions; ++partition) {
+    // Each partition has the values of its remainder, one per multiple of num_partitions
+    auto const expected_size = (num_rows - partition + num_partitions - 1) / num_partitions;
+    EXPECT_EQ(expected_size, offsets[partition + 1] - offsets[partition]);
+    for (auto row = offsets[partition]; row < offsets[partition + 1]; ++row) {
+      EXPECT_EQ(partition, h_values[row] % num_partitions);
+    }
+  }
+
+  auto const expected_names = thrust::make_transform_iterator(
+    h_values.begin(), [](auto value) { return std::to_string(value); });
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(strings_column_wrapper(expected_names, expected_names + num_rows),
+                                 result->get_column(1).view());
+}
+
+namespace {
+
+/**
+ * @brief Expects the packed partitions of `input` to have the rows of the partitions of
+ * `hash_partition`, in any order.
+ */
+void expect_packed_partitions(cudf::table_view const& input, cudf::size_type num_partitions)
+{
+  auto const packed = cudf::hash_partition_and_pack(input, {0}, num_partitions);
+  std::unique_ptr<cudf::table> partitioned;
+  std::vector<cudf::size_type> offsets;
+  std::tie(partitioned, offsets) = cudf::hash_partition(input, {0}, num_partitions);
+  ASSERT_EQ(static_cast<size_t>(num_partitions), packed.size());
+  offsets.push_back(input.num_rows());
+
+  for (cudf::size_type p = 0; p < num_partitions; ++p) {
+    auto const unpacked = cudf::unpack(packed[p].data);
+    auto const expected = cudf::slice(partitioned->view(), {offsets[p], offsets[p + 1]}).front();
+    ASSERT_EQ(expected.num_rows(), unpacked.num_rows());
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*cudf::sort(expected), *cudf::sort(unpacked));
+  }
+}
+
+}  // namespace
+
+TEST_F(HashPartition, PackFixedWidth)
+{
+  auto const keys_it = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                       [](auto i) { return (i * 31) % 1000; });
+  auto const valids_it = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                         [](auto i) { return i % 7 != 0; });
+  fixed_width_column_wrapper<int64_t> keys(keys_it, keys_it + 5000);
+  fixed_width_column_wrapper<int8_t, int32_t> bytes(keys_it, keys_it + 5000, valids_it);
+  fixed_width_column_wrapper<double, int32_t> values(keys_it, keys_it + 5000);
+  cudf::table_view const input({keys, bytes, values});
+
+  // More partitions than rows leave some partitions empty
+  for (cudf::size_type num_partitions : {1, 13, 64, 8000}) {
+    expect_packed_partitions(input, num_partitions);
+  }
+  EXPECT_TRUE(cudf::hash_partition_and_pack(input, {0}, 0).empty());
+}
+
+TEST_F(HashPartition, PackStrings)
+{
+  fixed_width_column_wrapper<int32_t> keys({5, 3, 9, 3, 1, 5, 7, 0});
+  strings_column_wrapper names({"e", "c", "", "c", "a", "e", "g", "z"}, {1, 1, 0, 1, 1, 1, 1, 1});
+  expect_packed_partitions(cudf::table_view({keys, names}), 3);
+}
+
 TEST_F(HashPartition, FixedPointColumnsToHash)
 {
   fixed_width_column_wrapper<int32_t> to_hash({1});
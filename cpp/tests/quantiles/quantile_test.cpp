@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,8 +14,10 @@
  * limitations under the License.
  */
 
+#include <cudf/copying.hpp>
 #include <cudf/quantiles.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf_test/base_fixture.hpp>
@@ -473,4 +475,33 @@ TEST_F(QuantileDictionaryTest, TestValid)
 
 }  // anonymous namespace
 
+template <typename T>
+struct UnsortedQuantileTest : public BaseFixture {
+};
+
+TYPED_TEST_SUITE(UnsortedQuantileTest, NumericTypes);
+
+TYPED_TEST(UnsortedQuantileTest, MatchesSortedQuantile)
+{
+  using T = TypeParam;
+  fixed_width_column_wrapper<T, int32_t> input({5, -3, 9, 9, 0, 7, 2, 11, -8, 4, 6},
+                                               {1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1});
+  auto const q = vector<double>{0.0, 0.1, 0.25, 0.5, 0.75, 0.99, 1.0};
+
+  auto const sorted_indices =
+    cudf::sorted_order(cudf::table_view{{input}}, {}, {null_order::AFTER});
+  auto const valid_sorted_indices = cudf::slice(*sorted_indices, {0, 9})[0];
+  for (auto const interp : {cudf::interpolation::LINEAR,
+                            cudf::interpolation::LOWER,
+                            cudf::interpolation::HIGHER,
+                            cudf::interpolation::MIDPOINT,
+                            cudf::interpolation::NEAREST}) {
+    for (bool const exact : {true, false}) {
+      auto const expected = cudf::quantile(input, q, interp, valid_sorted_indices, exact);
+      auto const result   = cudf::unsorted_quantile(input, q, interp, exact);
+      CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*expected, *result);
+    }
+  }
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,6 +15,7 @@
  */
 
 #include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/iterator_utilities.hpp>
 #include <cudf_test/table_utilities.hpp>
@@ -23,15 +24,18 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/dictionary/encode.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/reduction.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/wrappers/timestamps.hpp>
 
 #include <thrust/iterator/counting_iterator.h>
 
+#include <cstdlib>
 #include <iostream>
 #include <vector>
 
@@ -2345,4 +2349,84 @@ TEST_F(StructReductionTest, StructReductionMinMaxWithNulls)
   }
 }
 
+struct ApproxNUniqueReductionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ApproxNUniqueReductionTest, EstimatesUniqueCount)
+{
+  auto const out_type = cudf::data_type{cudf::type_id::INT64};
+  auto estimate       = [&](cudf::column_view const& col) {
+    auto const result = cudf::reduce(col, cudf::make_approx_nunique_aggregation(), out_type);
+    EXPECT_TRUE(result->is_valid());
+    return static_cast<cudf::scalar_type_t<int64_t>*>(result.get())->value();
+  };
+
+  // Small counts are exact, and nulls are ignored
+  cudf::test::fixed_width_column_wrapper<int32_t> small({1, 1, 2, 2, 3, 3, 4, 7},
+                                                        cudf::test::iterators::null_at(7));
+  EXPECT_EQ(estimate(small), 4);
+  cudf::test::fixed_width_column_wrapper<int32_t> all_nulls({1, 2},
+                                                            cudf::test::iterators::all_nulls());
+  EXPECT_EQ(estimate(all_nulls), 0);
+
+  // 50000 unique values, each twice
+  auto const it = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i / 2; });
+  cudf::test::fixed_width_column_wrapper<int64_t> large(it, it + 100000);
+  EXPECT_LT(std::abs(estimate(large) - 50000), 50000 * 3 / 100);
+}
+
+struct TableReductionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(TableReductionTest, MatchesColumnReductions)
+{
+  using cudf::test::iterators::null_at;
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({4, -2, 7, 1, 9, 3}, null_at(2));
+  cudf::test::fixed_width_column_wrapper<double> doubles({0.5, 2.25, -1.5, 8.0, 3.0, 1.0});
+  cudf::test::fixed_width_column_wrapper<int16_t> nulls({1, 2}, cudf::test::iterators::all_nulls());
+  cudf::test::strings_column_wrapper strings({"b", "a", "c", "a", "d", "b"});
+  auto const input = cudf::table_view{{ints, doubles, nulls}};
+
+  std::vector<std::unique_ptr<aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation());
+  aggs.push_back(cudf::make_min_aggregation());
+  aggs.push_back(cudf::make_max_aggregation());
+  aggs.push_back(cudf::make_sum_of_squares_aggregation());
+  aggs.push_back(cudf::make_mean_aggregation());
+  aggs.push_back(cudf::make_variance_aggregation(0));
+  aggs.push_back(cudf::make_std_aggregation());
+  aggs.push_back(cudf::make_nunique_aggregation());
+
+  auto const results = cudf::reduce(input, aggs);
+  ASSERT_EQ(results.size(), static_cast<std::size_t>(input.num_columns()));
+  for (cudf::size_type i = 0; i < input.num_columns(); ++i) {
+    ASSERT_EQ(results[i].size(), aggs.size());
+    for (std::size_t j = 0; j < aggs.size(); ++j) {
+      auto const col          = input.column(i);
+      auto const output_dtype = cudf::detail::target_type(col.type(), aggs[j]->kind);
+      auto const expected     = cudf::reduce(col, aggs[j], output_dtype);
+      auto const& result      = results[i][j];
+      ASSERT_EQ(result->type(), expected->type());
+      ASSERT_EQ(result->is_valid(), expected->is_valid());
+      if (not expected->is_valid()) { continue; }
+      if (output_dtype.id() == cudf::type_id::FLOAT64) {
+        EXPECT_NEAR(static_cast<cudf::scalar_type_t<double>*>(result.get())->value(),
+                    static_cast<cudf::scalar_type_t<double>*>(expected.get())->value(),
+                    1e-12);
+      } else {
+        CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::make_column_from_scalar(*result, 1),
+                                       *cudf::make_column_from_scalar(*expected, 1));
+      }
+    }
+  }
+
+  // Columns that are not arithmetic are reduced as by the column reduction
+  std::vector<std::unique_ptr<aggregation>> min_max;
+  min_max.push_back(cudf::make_min_aggregation());
+  min_max.push_back(cudf::make_max_aggregation());
+  auto const string_results = cudf::reduce(cudf::table_view{{strings}}, min_max);
+  EXPECT_EQ(static_cast<cudf::string_scalar*>(string_results[0][0].get())->to_string(), "a");
+  EXPECT_EQ(static_cast<cudf::string_scalar*>(string_results[0][1].get())->to_string(), "d");
+}
+
 CUDF_TEST_PROGRAM_MAIN()
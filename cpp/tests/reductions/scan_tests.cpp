@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -617,3 +617,46 @@ TEST_F(StructScanTest, StructScanMinMaxWithNulls)
     CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
   }
 }
+
+struct SegmentedScanTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SegmentedScanTest, SumMinMaxWithNulls)
+{
+  using cudf::test::iterators::nulls_at;
+  auto const input   = cudf::test::fixed_width_column_wrapper<int32_t>{{1, 2, 3, 4, 5, 6, 7, 8},
+                                                                     nulls_at({1, 5})};
+  auto const offsets = cudf::test::fixed_width_column_wrapper<cudf::size_type>{0, 3, 4};
+
+  auto const sum = cudf::segmented_scan(input, offsets, cudf::make_sum_aggregation());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::fixed_width_column_wrapper<int32_t>({1, 1, 4, 4, 5, 5, 12, 20}, nulls_at({1, 5})),
+    *sum);
+
+  auto const sum_include = cudf::segmented_scan(
+    input, offsets, cudf::make_sum_aggregation(), null_policy::INCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::fixed_width_column_wrapper<int32_t>({1, 0, 0, 4, 5, 0, 0, 0},
+                                                    nulls_at({1, 2, 5, 6, 7})),
+    *sum_include);
+
+  auto const max = cudf::segmented_scan(input, offsets, cudf::make_max_aggregation());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::fixed_width_column_wrapper<int32_t>({1, 1, 3, 4, 5, 5, 7, 8}, nulls_at({1, 5})),
+    *max);
+}
+
+TEST_F(SegmentedScanTest, RankAndDenseRank)
+{
+  auto const input   = cudf::test::fixed_width_column_wrapper<int32_t>{1, 1, 2, 2, 2, 3, 3, 5};
+  auto const offsets = cudf::test::fixed_width_column_wrapper<cudf::size_type>{0, 4};
+
+  auto const rank = cudf::segmented_scan(input, offsets, cudf::make_rank_aggregation());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::fixed_width_column_wrapper<cudf::size_type>{1, 1, 3, 3, 1, 2, 2, 4}, *rank);
+
+  auto const dense_rank =
+    cudf::segmented_scan(input, offsets, cudf::make_dense_rank_aggregation());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::fixed_width_column_wrapper<cudf::size_type>{1, 1, 2, 2, 1, 2, 2, 3}, *dense_rank);
+}
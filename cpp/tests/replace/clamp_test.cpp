@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,10 +14,12 @@
  * limitations under the License.
  */
 
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/dictionary/encode.hpp>
 #include <cudf/replace.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table_view.hpp>
 
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
@@ -661,4 +663,59 @@ TYPED_TEST(FixedPointTest, MismatchedColumnScalarScale)
   EXPECT_THROW(cudf::clamp(input, *lo, *hi), cudf::logic_error);
 }
 
+struct ClampTableTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ClampTableTest, MatchesColumns)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{{1, 2, 3, 4, 5, 6}, {1, 0, 1, 1, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> other_ints{{9, 8, 7, 6, 5, 4}};
+  cudf::test::fixed_width_column_wrapper<float> floats{{0.5, 1.5, 2.5, 3.5, 4.5, 5.5, 6.5},
+                                                       {1, 1, 0, 1, 1, 0, 1}};
+  cudf::test::strings_column_wrapper strings{{"a", "b", "c", "d", "e", "f"}, {1, 1, 1, 0, 1, 1}};
+  auto const sliced_floats = cudf::slice(floats, {1, 7})[0];
+
+  cudf::table_view const input{{ints, other_ints, sliced_floats, strings}};
+  cudf::numeric_scalar<int32_t> const ints_lo{2}, ints_lo_replace{0};
+  cudf::numeric_scalar<int32_t> const ints_hi{4}, ints_hi_replace{9};
+  cudf::numeric_scalar<int32_t> const other_lo{0, false}, other_hi{6};
+  cudf::numeric_scalar<float> const floats_lo{2.0}, floats_hi{0.0, false};
+  cudf::string_scalar const strings_lo{"b"}, strings_hi{"e"};
+
+  std::vector<std::reference_wrapper<cudf::scalar const>> const lo{
+    ints_lo, other_lo, floats_lo, strings_lo};
+  std::vector<std::reference_wrapper<cudf::scalar const>> const lo_replace{
+    ints_lo_replace, other_lo, floats_lo, strings_lo};
+  std::vector<std::reference_wrapper<cudf::scalar const>> const hi{
+    ints_hi, other_hi, floats_hi, strings_hi};
+  std::vector<std::reference_wrapper<cudf::scalar const>> const hi_replace{
+    ints_hi_replace, other_hi, floats_hi, strings_hi};
+
+  auto const result = cudf::clamp(input, lo, lo_replace, hi, hi_replace);
+  ASSERT_EQ(result->num_columns(), input.num_columns());
+  for (cudf::size_type i = 0; i < input.num_columns(); ++i) {
+    auto const expected = cudf::clamp(
+      input.column(i), lo[i].get(), lo_replace[i].get(), hi[i].get(), hi_replace[i].get());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), result->get_column(i).view());
+  }
+
+  auto const clamped = cudf::clamp(input, lo, hi);
+  for (cudf::size_type i = 0; i < input.num_columns(); ++i) {
+    auto const expected = cudf::clamp(input.column(i), lo[i].get(), hi[i].get());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), clamped->get_column(i).view());
+  }
+}
+
+TEST_F(ClampTableTest, Errors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{{1, 2, 3}};
+  cudf::table_view const input{{ints}};
+  cudf::numeric_scalar<int32_t> const lo{1}, hi{2}, null_replace{0, false};
+  cudf::numeric_scalar<int64_t> const mismatched{2};
+
+  EXPECT_THROW(cudf::clamp(input, {lo, lo}, {hi, hi}), cudf::logic_error);
+  EXPECT_THROW(cudf::clamp(input, {lo}, {mismatched}), cudf::logic_error);
+  EXPECT_THROW(cudf::clamp(input, {lo}, {null_replace}, {hi}, {hi}), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
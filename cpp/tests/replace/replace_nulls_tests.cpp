@@ -1,5 +1,5 @@
 /*
- * Copyright 2019-2021, NVIDIA CORPORATION.
+ * Copyright 2019-2022, NVIDIA CORPORATION.
  *
  * Copyright 2018 BlazingDB, Inc.
  *     Copyright 2018 Alexander Ocsa <cristhian@blazingdb.com>
@@ -23,9 +23,11 @@
 
 #include <cudf/dictionary/detail/replace.hpp>
 #include <cudf/dictionary/encode.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
@@ -765,4 +767,57 @@ TEST_F(ReplaceNullsPolicyDictionaryTest, FollowingFillTrailingNulls)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected->view());
 }
 
+struct ReplaceNullsTableTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ReplaceNullsTableTest, MatchesColumns)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{{1, 2, 3, 4, 5, 6}, {1, 0, 1, 0, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<double> doubles{{0.5, 1.5, 2.5, 3.5, 4.5, 5.5, 6.5},
+                                                         {1, 1, 0, 1, 1, 0, 0}};
+  cudf::test::fixed_width_column_wrapper<int8_t> bytes{{1, 2, 3, 4, 5, 6}};
+  cudf::test::fixed_width_column_wrapper<int64_t> null_replaced{{1, 2, 3, 4, 5, 6},
+                                                                {0, 1, 1, 0, 1, 1}};
+  cudf::test::strings_column_wrapper strings{{"a", "", "c", "", "e", "f"},
+                                             {1, 0, 1, 0, 1, 1}};
+  auto const sliced_doubles = cudf::slice(doubles, {1, 7})[0];
+
+  cudf::table_view const input{{ints, sliced_doubles, bytes, null_replaced, strings}};
+  cudf::numeric_scalar<int32_t> const int_replacement{-1};
+  cudf::numeric_scalar<double> const double_replacement{-0.5};
+  cudf::numeric_scalar<int8_t> const byte_replacement{-1};
+  cudf::numeric_scalar<int64_t> const null_replacement{0, false};
+  cudf::string_scalar const string_replacement{"z"};
+  std::vector<std::reference_wrapper<cudf::scalar const>> const replacements{
+    int_replacement, double_replacement, byte_replacement, null_replacement, string_replacement};
+
+  auto const result = cudf::replace_nulls(input, replacements);
+  ASSERT_EQ(result->num_columns(), input.num_columns());
+  for (cudf::size_type i = 0; i < input.num_columns(); ++i) {
+    auto const expected = cudf::replace_nulls(input.column(i), replacements[i].get());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), result->get_column(i).view());
+  }
+  EXPECT_EQ(result->get_column(0).null_count(), 0);
+  EXPECT_EQ(result->get_column(3).null_count(), 2);
+}
+
+TEST_F(ReplaceNullsTableTest, Empty)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{};
+  cudf::numeric_scalar<int32_t> const replacement{-1};
+  auto const result = cudf::replace_nulls(cudf::table_view{{ints}}, {replacement});
+  EXPECT_EQ(result->num_columns(), 1);
+  EXPECT_EQ(result->num_rows(), 0);
+}
+
+TEST_F(ReplaceNullsTableTest, Errors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{{1, 2}, {1, 0}};
+  cudf::numeric_scalar<int32_t> const replacement{-1};
+  cudf::numeric_scalar<int64_t> const mismatched{-1};
+  cudf::table_view const input{{ints, ints}};
+  EXPECT_THROW(cudf::replace_nulls(input, {replacement}), cudf::logic_error);
+  EXPECT_THROW(cudf::replace_nulls(input, {replacement, mismatched}), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
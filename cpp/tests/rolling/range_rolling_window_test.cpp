@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -315,6 +315,46 @@ TYPED_TEST(TypedIntegralRangeRollingTest, OrderByDesc)
   verify_results_for_descending(exec);
 }
 
+TYPED_TEST(TypedIntegralRangeRollingTest, OrderByWithTies)
+{
+  // Confirm that the rows of equal orderby values share their window,
+  // in both orders.
+  using namespace cudf;
+  using T = TypeParam;
+
+  // clang-format off
+  auto gby_column  = int_col { 0, 0, 0, 0, 0, 0,  1, 1, 1,  1};
+  auto agg_column  = int_col { 1, 2, 3, 4, 5, 6,  7, 8, 9, 10};
+  auto asc_column  = fwcw<T>{  1, 1, 2, 4, 4, 7,  3, 3, 3, 10};
+  auto desc_agg    = int_col { 6, 5, 4, 3, 2, 1, 10, 9, 8,  7};
+  auto desc_column = fwcw<T>{  7, 4, 4, 2, 1, 1, 10, 3, 3,  3};
+  // clang-format on
+
+  auto asc_exec = window_exec(gby_column,
+                              asc_column,
+                              order::ASCENDING,
+                              agg_column,
+                              numeric_scalar<T>(2),   // 2 preceding.
+                              numeric_scalar<T>(0));  // 0 following.
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    asc_exec(make_sum_aggregation<rolling_aggregation>())->view(),
+    fwcw<int64_t>{3, 3, 6, 12, 12, 6, 24, 24, 24, 10});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(asc_exec(make_count_aggregation<rolling_aggregation>())->view(),
+                                 size_col{2, 2, 3, 3, 3, 1, 3, 3, 3, 1});
+
+  auto desc_exec = window_exec(gby_column,
+                               desc_column,
+                               order::DESCENDING,
+                               desc_agg,
+                               numeric_scalar<T>(2),   // 2 preceding.
+                               numeric_scalar<T>(0));  // 0 following.
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    desc_exec(make_sum_aggregation<rolling_aggregation>())->view(),
+    fwcw<int64_t>{6, 9, 9, 12, 6, 6, 10, 24, 24, 24});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(desc_exec(make_min_aggregation<rolling_aggregation>())->view(),
+                                 int_col{6, 4, 4, 3, 1, 1, 10, 7, 7, 7});
+}
+
 template <typename T>
 struct TypedRangeRollingNullsTest : public RangeRollingTest {
 };
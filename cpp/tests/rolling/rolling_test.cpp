@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,12 +23,15 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/aggregation.hpp>
+#include <cudf/ast/expressions.hpp>
 #include <cudf/binaryop.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/dictionary/encode.hpp>
 #include <cudf/rolling.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/unary.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/traits.hpp>
@@ -928,6 +931,106 @@ TYPED_TEST(RollingTest, RandomDynamicWithInvalid)
   this->run_test_col_agg(input, preceding_window, following_window, max_window_size);
 }
 
+class RollingLargeWindowTest : public cudf::test::BaseFixture {
+};
+
+// windows of at least fixed_window_rolling_threshold rows against the same windows given
+// per row, which are aggregated one row at a time
+TEST_F(RollingLargeWindowTest, MatchesDynamicWindows)
+{
+  size_type const num_rows = 3000;
+  auto const values        = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>((i * 37) % 101) - 50; });
+  auto const validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 3; });
+  fixed_width_column_wrapper<int32_t> input(values, values + num_rows, validity);
+
+  std::vector<std::unique_ptr<cudf::rolling_aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation<cudf::rolling_aggregation>());
+  aggs.push_back(cudf::make_mean_aggregation<cudf::rolling_aggregation>());
+  aggs.push_back(cudf::make_min_aggregation<cudf::rolling_aggregation>());
+  aggs.push_back(cudf::make_max_aggregation<cudf::rolling_aggregation>());
+  aggs.push_back(cudf::make_count_aggregation<cudf::rolling_aggregation>());
+  aggs.push_back(cudf::make_variance_aggregation<cudf::rolling_aggregation>(1));
+  aggs.push_back(cudf::make_std_aggregation<cudf::rolling_aggregation>(0));
+
+  std::vector<std::pair<size_type, size_type>> const windows{
+    {200, 100}, {1000, -200}, {-100, 400}, {5000, 5000}};
+  for (auto const& [preceding, following] : windows) {
+    auto const preceding_col = cudf::make_column_from_scalar(
+      cudf::numeric_scalar<size_type>(preceding), num_rows);
+    auto const following_col = cudf::make_column_from_scalar(
+      cudf::numeric_scalar<size_type>(following), num_rows);
+    for (auto const& agg : aggs) {
+      auto const result   = cudf::rolling_window(input, preceding, following, 150, *agg);
+      auto const expected = cudf::rolling_window(
+        input, preceding_col->view(), following_col->view(), 150, *agg);
+      CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*result, *expected);
+    }
+  }
+}
+
+class RollingMultipleAggregationsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(RollingMultipleAggregationsTest, MatchesSingleAggregations)
+{
+  size_type const num_rows = 500;
+  auto const values        = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<double>((i * 37) % 101) / 4 - 12; });
+  auto const validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 3; });
+  fixed_width_column_wrapper<double> input(values, values + num_rows, validity);
+
+  std::vector<std::unique_ptr<cudf::rolling_aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation<cudf::rolling_aggregation>());
+  aggs.push_back(cudf::make_max_aggregation<cudf::rolling_aggregation>());
+  aggs.push_back(cudf::make_mean_aggregation<cudf::rolling_aggregation>());
+  aggs.push_back(cudf::make_variance_aggregation<cudf::rolling_aggregation>(1));
+  aggs.push_back(cudf::make_min_aggregation<cudf::rolling_aggregation>());
+  aggs.push_back(cudf::make_count_aggregation<cudf::rolling_aggregation>());
+  aggs.push_back(
+    cudf::make_count_aggregation<cudf::rolling_aggregation>(cudf::null_policy::INCLUDE));
+  aggs.push_back(cudf::make_sum_aggregation<cudf::rolling_aggregation>());
+
+  auto const preceding_values =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5 + 1; });
+  auto const following_values =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 - 1; });
+  fixed_width_column_wrapper<size_type> preceding_col(preceding_values,
+                                                      preceding_values + num_rows);
+  fixed_width_column_wrapper<size_type> following_col(following_values,
+                                                      following_values + num_rows);
+
+  auto const fixed_results    = cudf::rolling_window(input, 3, 2, 2, aggs);
+  auto const variable_results = cudf::rolling_window(input, preceding_col, following_col, 2, aggs);
+  ASSERT_EQ(fixed_results->num_columns(), static_cast<size_type>(aggs.size()));
+  ASSERT_EQ(variable_results->num_columns(), static_cast<size_type>(aggs.size()));
+  for (std::size_t i = 0; i < aggs.size(); ++i) {
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(fixed_results->get_column(i),
+                                        *cudf::rolling_window(input, 3, 2, 2, *aggs[i]));
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+      variable_results->get_column(i),
+      *cudf::rolling_window(input, preceding_col, following_col, 2, *aggs[i]));
+  }
+}
+
+TEST_F(RollingMultipleAggregationsTest, Expression)
+{
+  fixed_width_column_wrapper<int32_t> input({4, 9, 1, 7, 3, 8, 2, 6}, {1, 1, 0, 1, 1, 1, 1, 0});
+  std::vector<std::unique_ptr<cudf::rolling_aggregation>> aggs;
+  aggs.push_back(cudf::make_max_aggregation<cudf::rolling_aggregation>());
+  aggs.push_back(cudf::make_min_aggregation<cudf::rolling_aggregation>());
+
+  auto const max_ref = cudf::ast::column_reference(0);
+  auto const min_ref = cudf::ast::column_reference(1);
+  auto const range   = cudf::ast::operation(cudf::ast::ast_operator::SUB, max_ref, min_ref);
+
+  auto const result = cudf::rolling_window(input, 2, 1, 2, aggs, range);
+  fixed_width_column_wrapper<int32_t> expected({5, 5, 2, 4, 5, 6, 6, 0}, {1, 1, 1, 1, 1, 1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*result, expected);
+}
+
 // ------------- non-fixed-width types --------------------
 
 using RollingTestStrings = RollingTest<cudf::string_view>;
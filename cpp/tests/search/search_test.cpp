@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,10 @@
 
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/search.hpp>
+#include <cudf/sorting.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 
 struct SearchTest : public cudf::test::BaseFixture {
 };
@@ -1870,4 +1874,60 @@ TYPED_TEST(FixedPointTestAllReps, FixedPointUpperBound)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
 }
 
+TEST_F(SearchTest, sorted_index)
+{
+  fixed_width_column_wrapper<int64_t> column{10, 20, 20, 30, 50};
+  fixed_width_column_wrapper<int64_t> values{0, 20, 25, 50, 60};
+  cudf::sorted_index const index(cudf::table_view{{column}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*index.lower_bound(cudf::table_view{{values}}),
+                                 fixed_width_column_wrapper<size_type>{0, 1, 3, 4, 5});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*index.upper_bound(cudf::table_view{{values}}),
+                                 fixed_width_column_wrapper<size_type>{0, 3, 3, 5, 5});
+
+  // Values with nulls in a column of the index without nulls are searched as by lower_bound
+  fixed_width_column_wrapper<int64_t> null_values({0, 20, 25}, {1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*index.lower_bound(cudf::table_view{{null_values}}),
+                                 fixed_width_column_wrapper<size_type>{0, 0, 3});
+}
+
+TEST_F(SearchTest, sorted_index_descending_with_nulls)
+{
+  fixed_width_column_wrapper<int32_t> column({0, 0, 9, 7, 7, 3}, {0, 0, 1, 1, 1, 1});
+  fixed_width_column_wrapper<int32_t> values({0, 9, 8, 7, 0}, {0, 1, 1, 1, 1});
+  cudf::sorted_index const index(
+    cudf::table_view{{column}}, {cudf::order::DESCENDING}, {cudf::null_order::AFTER});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*index.lower_bound(cudf::table_view{{values}}),
+                                 fixed_width_column_wrapper<size_type>{0, 2, 3, 3, 6});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*index.upper_bound(cudf::table_view{{values}}),
+                                 fixed_width_column_wrapper<size_type>{2, 3, 3, 5, 6});
+}
+
+TEST_F(SearchTest, sorted_index_multi_column)
+{
+  // Repeated keys of two columns, probed with values in and out of the range of the keys
+  constexpr size_type num_rows = 10000;
+  auto const keys1_it          = thrust::make_transform_iterator(
+    thrust::make_counting_iterator(0), [](auto i) { return (i * 7919) % 101; });
+  auto const keys2_it = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                        [](auto i) { return (i * 31) % 17; });
+  fixed_width_column_wrapper<int32_t> keys1(keys1_it, keys1_it + num_rows);
+  fixed_width_column_wrapper<int16_t> keys2(keys2_it, keys2_it + num_rows);
+  std::vector<cudf::order> const column_order{cudf::order::ASCENDING, cudf::order::DESCENDING};
+  auto const sorted = cudf::sort(cudf::table_view{{keys1, keys2}}, column_order);
+
+  auto const values1_it = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                          [](auto i) { return i % 105 - 2; });
+  auto const values2_it = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                          [](auto i) { return i % 19 - 1; });
+  fixed_width_column_wrapper<int32_t> values1(values1_it, values1_it + 3000);
+  fixed_width_column_wrapper<int16_t> values2(values2_it, values2_it + 3000);
+  cudf::table_view const values{{values1, values2}};
+
+  cudf::sorted_index const index(sorted->view(), column_order);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*index.lower_bound(values),
+                                 *cudf::lower_bound(sorted->view(), values, column_order, {}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*index.upper_bound(values),
+                                 *cudf::upper_bound(sorted->view(), values, column_order, {}));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <algorithm>
+#include <vector>
+
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+namespace cudf {
+namespace test {
+
+struct ExternalSortTest : public BaseFixture {
+};
+
+namespace {
+
+/**
+ * @brief Sorts `input` chunk by chunk with `sorter` and returns the concatenated result.
+ */
+std::unique_ptr<table> external_sort(external_sorter& sorter,
+                                     table_view const& input,
+                                     size_type chunk_rows,
+                                     size_type max_rows)
+{
+  for (size_type row = 0; row < input.num_rows(); row += chunk_rows) {
+    auto const end = std::min(row + chunk_rows, input.num_rows());
+    sorter.push(cudf::slice(input, {row, end}).front());
+  }
+  std::vector<std::unique_ptr<table>> chunks;
+  while (sorter.has_next()) {
+    chunks.push_back(sorter.next(max_rows));
+    EXPECT_GT(chunks.back()->num_rows(), 0);
+    EXPECT_LE(chunks.back()->num_rows(), max_rows);
+  }
+  EXPECT_EQ(sorter.next(max_rows)->num_rows(), 0);
+
+  std::vector<table_view> views;
+  for (auto const& chunk : chunks) {
+    views.push_back(chunk->view());
+  }
+  return cudf::concatenate(views);
+}
+
+}  // namespace
+
+TEST_F(ExternalSortTest, HostSpill)
+{
+  // The keys are distinct, so that the order of the rows is unique
+  constexpr size_type num_rows = 10000;
+  auto const key_it            = thrust::make_transform_iterator(
+    thrust::make_counting_iterator(0), [](auto i) { return (i * 7919) % 10007; });
+  fixed_width_column_wrapper<int32_t> keys(key_it, key_it + num_rows);
+  fixed_width_column_wrapper<int32_t> vals(thrust::make_counting_iterator(0),
+                                           thrust::make_counting_iterator(num_rows));
+  table_view const input{{vals, keys}};
+
+  external_sorter sorter({1}, {order::ASCENDING}, {}, 300);
+  auto const result   = external_sort(sorter, input, 2500, 1000);
+  auto const expected = cudf::sort_by_key(input, table_view{{keys}});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+
+  EXPECT_THROW(sorter.push(input), cudf::logic_error);
+  EXPECT_THROW(external_sorter({}, {}), cudf::logic_error);
+  EXPECT_THROW(external_sorter({0}, {order::ASCENDING}, {}, 0), cudf::logic_error);
+}
+
+TEST_F(ExternalSortTest, FileSpillWithNulls)
+{
+  strings_column_wrapper keys1({"d", "a", "c", "", "b", "a", "c", "d", "b", "a", "e", "c"},
+                               {1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1});
+  fixed_width_column_wrapper<int64_t> keys2({4, 1, 9, 0, 2, 7, 3, 8, 5, 6, 0, 1},
+                                            {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1});
+  fixed_width_column_wrapper<int32_t> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+  table_view const input{{keys1, keys2, vals}};
+
+  std::vector<order> const column_order{order::DESCENDING, order::ASCENDING};
+  std::vector<null_order> const null_precedence{null_order::AFTER, null_order::BEFORE};
+  external_sorter sorter({0, 1}, column_order, null_precedence, 2, temp_env->get_temp_dir());
+  auto const result = external_sort(sorter, input, 5, 3);
+
+  auto const expected =
+    cudf::sort_by_key(input, table_view{{keys1, keys2}}, column_order, null_precedence);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -424,5 +424,40 @@ TEST_F(RankLarge, average_large)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected);
 }
 
+struct RankMultiple : public BaseFixture {
+};
+
+TEST_F(RankMultiple, MatchesSingleMethods)
+{
+  fixed_width_column_wrapper<int32_t> col{{5, 4, 3, 5, 8, 5, 3, 1}, {1, 1, 0, 1, 1, 1, 1, 1}};
+  std::vector<rank_method> const methods{rank_method::DENSE,
+                                         rank_method::FIRST,
+                                         rank_method::MAX,
+                                         rank_method::AVERAGE,
+                                         rank_method::MIN,
+                                         rank_method::DENSE};
+  for (auto const percentage : {false, true}) {
+    for (auto const null_handling : {null_policy::EXCLUDE, null_policy::INCLUDE}) {
+      auto const results = cudf::rank(
+        col, methods, order::DESCENDING, null_handling, null_order::BEFORE, percentage);
+      ASSERT_EQ(results.size(), methods.size());
+      for (std::size_t i = 0; i < methods.size(); ++i) {
+        auto const expected = cudf::rank(
+          col, methods[i], order::DESCENDING, null_handling, null_order::BEFORE, percentage);
+        CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), results[i]->view());
+      }
+    }
+  }
+
+  auto const results =
+    cudf::rank(col, methods, order::DESCENDING, null_policy::EXCLUDE, null_order::BEFORE, false);
+  fixed_width_column_wrapper<size_type> expected_min{{2, 5, 8, 2, 1, 2, 6, 7},
+                                                     {1, 1, 0, 1, 1, 1, 1, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_min, results[4]->view());
+
+  EXPECT_TRUE(
+    cudf::rank(col, std::vector<rank_method>{}, {}, null_policy::EXCLUDE, {}, false).empty());
+}
+
 }  // namespace test
 }  // namespace cudf
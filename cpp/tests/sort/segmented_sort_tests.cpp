@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -24,6 +24,8 @@
 #include <cudf/detail/sorting.hpp>
 #include <cudf/sorting.hpp>
 
+#include <algorithm>
+#include <numeric>
 #include <type_traits>
 #include <vector>
 
@@ -59,6 +61,7 @@ corner case
   sliced segment_offsets
   non-zero start of segment_offsets without offset
   non-zero start of segment_offsets with offset
+  skewed segment sizes
 mismatch sizes
   keys, values num_rows
   order, null_order
@@ -242,6 +245,45 @@ TEST_F(SegmentedSortInt, Sliced)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected3);
 }
 
+TEST_F(SegmentedSortInt, SkewedSegmentSizes)
+{
+  // Many tiny segments, a few medium ones and a huge one, sorted by different algorithms
+  std::vector<int> offsets{0};
+  for (int i = 0; i < 2000; ++i) {
+    offsets.push_back(offsets.back() + i % 4);
+  }
+  for (int i = 0; i < 5; ++i) {
+    offsets.push_back(offsets.back() + 1000 + i);
+  }
+  offsets.push_back(offsets.back() + 300000);
+  auto const num_rows = offsets.back();
+
+  std::vector<int64_t> keys(num_rows);
+  std::vector<bool> valids(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    keys[i]   = (i * 7919L) % 1009;
+    valids[i] = i % 13 != 0;
+  }
+  fixed_width_column_wrapper<int64_t> col(keys.begin(), keys.end(), valids.begin());
+  column_wrapper<int> segments(offsets.begin(), offsets.end());
+
+  // Nulls are last, and ties stay in the order of their rows
+  std::vector<int> expected(num_rows);
+  std::iota(expected.begin(), expected.end(), 0);
+  for (std::size_t s = 0; s + 1 < offsets.size(); ++s) {
+    std::stable_sort(
+      expected.begin() + offsets[s], expected.begin() + offsets[s + 1], [&](int lhs, int rhs) {
+        if (valids[lhs] != valids[rhs]) { return valids[lhs] > valids[rhs]; }
+        return valids[lhs] and keys[lhs] > keys[rhs];
+      });
+  }
+  column_wrapper<int> expected_order(expected.begin(), expected.end());
+
+  auto const results = cudf::stable_segmented_sorted_order(
+    table_view{{col}}, segments, {order::DESCENDING}, {null_order::BEFORE});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected_order);
+}
+
 TEST_F(SegmentedSortInt, ErrorsMismatchArgSizes)
 {
   using T = int;
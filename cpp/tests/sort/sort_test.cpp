@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,12 +22,21 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/structs/utilities.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <rmm/cuda_stream.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <string>
 #include <vector>
 
 namespace cudf {
@@ -654,6 +663,166 @@ TYPED_TEST(Sort, ZeroSizedColumns)
   run_sort_test(input, expected, column_order);
 }
 
+struct PackedKeysSort : public BaseFixture {
+};
+
+TEST_F(PackedKeysSort, MultiColumnFixedWidthKeys)
+{
+  // 113 bits of packed keys, sorted 64 bits at a time
+  fixed_width_column_wrapper<int64_t> col1({1, 0, 1, -3, 1, 0, -3, 1}, {1, 0, 1, 1, 1, 0, 1, 1});
+  fixed_width_column_wrapper<int16_t> col2{5, 2, 5, 7, 4, 2, 7, 5};
+  fixed_width_column_wrapper<float> col3{1.f, 0.f, -0.f, NAN, 2.f, -1.f, 1.f, 0.f};
+  table_view input{{col1, col2, col3}};
+
+  fixed_width_column_wrapper<int32_t> expected_asc{5, 1, 6, 3, 4, 2, 7, 0};
+  auto got = stable_sorted_order(input, {}, {});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_asc, got->view());
+
+  fixed_width_column_wrapper<int32_t> expected_desc{5, 1, 4, 2, 7, 0, 6, 3};
+  std::vector<order> column_order{order::DESCENDING, order::ASCENDING, order::ASCENDING};
+  std::vector<null_order> null_precedence(3, null_order::AFTER);
+  got = stable_sorted_order(input, column_order, null_precedence);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_desc, got->view());
+  run_sort_test(input, expected_desc, column_order, null_precedence);
+
+  // 24 bits of packed keys
+  fixed_width_column_wrapper<int8_t> small1{3, -1, 3, 0};
+  fixed_width_column_wrapper<int16_t> small2{-5, 2, 7, -5};
+  fixed_width_column_wrapper<int32_t> expected_small{0, 2, 3, 1};
+  got = sorted_order(table_view{{small1, small2}}, {order::DESCENDING, order::ASCENDING});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_small, got->view());
+}
+
+struct StringsSort : public BaseFixture {
+};
+
+TEST_F(StringsSort, SharedPrefixes)
+{
+  // Prefixes shared past several radix windows, equal strings, and strings differing only by
+  // trailing zero bytes
+  std::string const prefix = "https://www.example.com/some/long/path/";
+  std::vector<std::string> strings;
+  std::vector<bool> valids;
+  for (int i = 0; i < 300; ++i) {
+    auto const id = std::to_string((i * 37) % 101);
+    switch (i % 5) {
+      case 0: strings.push_back(prefix + id); break;
+      case 1: strings.push_back(prefix.substr(0, i % prefix.size()) + id); break;
+      case 2: strings.push_back(id); break;
+      case 3: strings.push_back(id + std::string(i % 3, '\0')); break;
+      default: strings.push_back(prefix + id + "/" + prefix); break;
+    }
+    valids.push_back(i % 17 != 0);
+  }
+  strings_column_wrapper input(strings.begin(), strings.end(), valids.begin());
+
+  for (auto const column_order : {order::ASCENDING, order::DESCENDING}) {
+    for (auto const null_precedence : {null_order::BEFORE, null_order::AFTER}) {
+      // Nulls come first when they are before and ascending, or after and descending
+      auto const nulls_first =
+        (null_precedence == null_order::BEFORE) == (column_order == order::ASCENDING);
+      std::vector<int32_t> expected(strings.size());
+      std::iota(expected.begin(), expected.end(), 0);
+      std::stable_sort(expected.begin(), expected.end(), [&](auto lhs, auto rhs) {
+        if (valids[lhs] != valids[rhs]) { return nulls_first ? !valids[lhs] : valids[lhs]; }
+        if (!valids[lhs]) { return false; }
+        return column_order == order::ASCENDING ? strings[lhs] < strings[rhs]
+                                                : strings[rhs] < strings[lhs];
+      });
+      fixed_width_column_wrapper<int32_t> expected_order(expected.begin(), expected.end());
+
+      auto got = stable_sorted_order(table_view{{input}}, {column_order}, {null_precedence});
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_order, got->view());
+      got = sorted_order(table_view{{input}}, {column_order}, {null_precedence});
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_order, got->view());
+    }
+  }
+}
+
+struct DictionarySort : public BaseFixture {
+};
+
+TEST_F(DictionarySort, OrderedAsKeys)
+{
+  // Dictionary columns are sorted by their indices, alone and along other columns
+  dictionary_column_wrapper<std::string> input(
+    {"eee", "aaa", "ddd", "bbb", "", "ccc", "ccc", "eee", "aaa"}, {1, 1, 1, 0, 1, 1, 1, 1, 1});
+  fixed_width_column_wrapper<int32_t> ints{3, 1, 4, 1, 5, 9, 2, 6, 5};
+  auto const decoded = cudf::dictionary::decode(cudf::dictionary_column_view(input));
+
+  for (auto const column_order : {order::ASCENDING, order::DESCENDING}) {
+    for (auto const null_precedence : {null_order::BEFORE, null_order::AFTER}) {
+      auto const expected =
+        stable_sorted_order(table_view{{*decoded}}, {column_order}, {null_precedence});
+      auto const got = stable_sorted_order(table_view{{input}}, {column_order}, {null_precedence});
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), got->view());
+
+      auto const orders      = std::vector<order>{column_order, order::DESCENDING};
+      auto const null_orders = std::vector<null_order>{null_precedence, null_order::BEFORE};
+      auto const expected_multi =
+        stable_sorted_order(table_view{{*decoded, ints}}, orders, null_orders);
+      auto const got_multi = stable_sorted_order(table_view{{input, ints}}, orders, null_orders);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_multi->view(), got_multi->view());
+    }
+  }
+}
+
+struct PreprocessedKeysSort : public BaseFixture {
+};
+
+TEST_F(PreprocessedKeysSort, SharedAcrossCalls)
+{
+  // Keys flattened once are sorted, stable sorted and checked like the keys they came from
+  strings_column_wrapper names({"b", "a", "c", "a", "", "b", "a"}, {1, 1, 1, 1, 0, 1, 1});
+  fixed_width_column_wrapper<int32_t> ages{{5, 3, 5, 3, 1, 2, 4}, {1, 1, 0, 1, 1, 1, 1}};
+  structs_column_wrapper people({names, ages}, {1, 1, 1, 1, 1, 0, 1});
+  fixed_width_column_wrapper<int64_t> ids{7, 1, 3, 1, 2, 9, 4};
+  table_view input{{people, ids}};
+  std::vector<order> column_order{order::DESCENDING, order::ASCENDING};
+  std::vector<null_order> null_precedence{null_order::AFTER, null_order::BEFORE};
+
+  auto const nullability = cudf::structs::detail::column_nullability::MATCH_INCOMING;
+  auto const keys        = cudf::structs::detail::preprocessed_table::create(
+    input, column_order, null_precedence, nullability, rmm::cuda_stream_default);
+
+  auto const expected = stable_sorted_order(input, column_order, null_precedence);
+  for (int i = 0; i < 2; ++i) {
+    auto const got = cudf::detail::stable_sorted_order(*keys);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), got->view());
+  }
+  auto const unstable = cudf::detail::sorted_order(*keys);
+  auto const sorted   = gather(input, unstable->view());
+  EXPECT_TRUE(is_sorted(sorted->view(), column_order, null_precedence));
+  EXPECT_FALSE(cudf::detail::is_sorted(*keys));
+
+  auto const sorted_keys = cudf::structs::detail::preprocessed_table::create(
+    sorted->view(), column_order, null_precedence, nullability, rmm::cuda_stream_default);
+  EXPECT_TRUE(cudf::detail::is_sorted(*sorted_keys));
+}
+
+struct ExplicitStreamSort : public BaseFixture {
+};
+
+TEST_F(ExplicitStreamSort, MatchesDefaultStream)
+{
+  fixed_width_column_wrapper<int32_t> ints{{3, 1, 2, 5, 1, 4}, {1, 1, 0, 1, 1, 1}};
+  strings_column_wrapper strings{"d", "b", "a", "e", "a", "c"};
+  table_view input{{ints, strings}};
+  std::vector<order> column_order{order::DESCENDING, order::ASCENDING};
+
+  rmm::cuda_stream stream;
+  auto const indices = sorted_order(input, column_order, {}, stream.view());
+  auto const sorted =
+    gather(input, indices->view(), out_of_bounds_policy::DONT_CHECK, stream.view());
+  auto const by_key = sort_by_key(input, input, column_order, {}, stream.view());
+  EXPECT_TRUE(is_sorted(sorted->view(), column_order, {}, stream.view()));
+  stream.synchronize();
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sorted_order(input, column_order)->view(), indices->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(sort(input, column_order)->view(), sorted->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(sorted->view(), by_key->view());
+}
+
 struct SortByKey : public BaseFixture {
 };
 
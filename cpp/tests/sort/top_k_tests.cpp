@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace cudf {
+namespace test {
+
+struct TopKTest : public BaseFixture {
+};
+
+TEST_F(TopKTest, MatchesStableSortedOrder)
+{
+  // Many equal keys, so that the ties are broken by the row indices
+  constexpr size_type num_rows = 5000;
+  auto const key_it            = thrust::make_transform_iterator(
+    thrust::make_counting_iterator(0), [](auto i) { return (i * 7919) % 97 - 40; });
+  auto const valid_it = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                        [](auto i) { return i % 13 != 0; });
+  fixed_width_column_wrapper<int32_t> keys1(key_it, key_it + num_rows, valid_it);
+  fixed_width_column_wrapper<int16_t> keys2(key_it, key_it + num_rows);
+  fixed_width_column_wrapper<double> keys3(key_it, key_it + num_rows);
+  strings_column_wrapper str_keys({"b", "a", "c", "a", "b", "d"});
+
+  std::vector<order> const column_order{order::DESCENDING, order::ASCENDING};
+  std::vector<null_order> const null_precedence{null_order::AFTER, null_order::BEFORE};
+  for (auto const& input : {table_view{{keys1}},
+                            table_view{{keys1, keys2}},
+                            table_view{{keys3, keys2}},
+                            table_view{{str_keys, keys2}}}) {
+    auto const expected = stable_sorted_order(input, column_order, null_precedence);
+    for (auto const k : {1, 2, 5, 77, 400, 4999}) {
+      auto const size = std::min(k, input.num_rows());
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::slice(expected->view(), {0, size}).front(),
+                                     top_k(input, k, column_order, null_precedence)->view());
+    }
+    EXPECT_EQ(top_k(input, 0)->size(), 0);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(),
+                                   top_k(input, num_rows, column_order, null_precedence)->view());
+  }
+
+  EXPECT_THROW(top_k(table_view{{keys1}}, -1), cudf::logic_error);
+}
+
+TEST_F(TopKTest, Segmented)
+{
+  fixed_width_column_wrapper<int32_t> keys{5, 1, 4, 1, 9, 2, 7, 3, 3};
+  fixed_width_column_wrapper<size_type> offsets{0, 4, 6, 6, 9};
+
+  fixed_width_column_wrapper<size_type> expected_desc{0, 2, 4, 5, 6, 7};
+  auto got = segmented_top_k(table_view{{keys}}, offsets, 2, {order::DESCENDING});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_desc, got->view());
+
+  fixed_width_column_wrapper<size_type> expected_asc{1, 3, 2, 5, 4, 7, 8, 6};
+  got = segmented_top_k(table_view{{keys}}, offsets, 3);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_asc, got->view());
+
+  // Rows outside of the segments are ignored
+  fixed_width_column_wrapper<size_type> inner_offsets{2, 5};
+  fixed_width_column_wrapper<size_type> expected_inner{3, 2};
+  got = segmented_top_k(table_view{{keys}}, inner_offsets, 2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_inner, got->view());
+}
+
+}  // namespace test
+}  // namespace cudf
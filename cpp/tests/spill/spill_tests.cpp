@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/spill.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/detail/error.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/limiting_resource_adaptor.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <limits>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+using strcol_wrapper = cudf::test::strings_column_wrapper;
+
+struct SpillTest : public cudf::test::BaseFixture {
+  column_wrapper<int32_t> keys{{3, 1, 2, 0, 3, 7, 5}, {1, 1, 1, 1, 1, 0, 1}};
+  strcol_wrapper values{{"a", "bb", "", "dddd", "e", "ff", "g"}, {1, 1, 0, 1, 1, 1, 1}};
+
+  cudf::table_view input() { return cudf::table_view{{keys, values}}; }
+
+  static constexpr auto all_bytes = std::numeric_limits<std::size_t>::max();
+};
+
+TEST_F(SpillTest, LockRoundTrip)
+{
+  cudf::spill_manager manager;
+  cudf::spillable_table table(input(), manager);
+  EXPECT_FALSE(table.is_spilled());
+  EXPECT_GT(table.packed_size(), std::size_t{0});
+  EXPECT_EQ(manager.device_bytes(), table.packed_size());
+  EXPECT_EQ(manager.host_bytes(), std::size_t{0});
+
+  auto const lock = table.lock();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input(), lock.view());
+}
+
+TEST_F(SpillTest, SpillAndUnspill)
+{
+  cudf::spill_manager manager;
+  cudf::spillable_table table(input(), manager);
+  auto const size = table.packed_size();
+
+  EXPECT_EQ(manager.spill(all_bytes), size);
+  EXPECT_TRUE(table.is_spilled());
+  EXPECT_EQ(manager.device_bytes(), std::size_t{0});
+  EXPECT_EQ(manager.host_bytes(), size);
+  EXPECT_EQ(manager.spill(all_bytes), std::size_t{0});
+
+  {
+    auto const lock = table.lock();
+    EXPECT_FALSE(table.is_spilled());
+    CUDF_TEST_EXPECT_TABLES_EQUAL(input(), lock.view());
+  }
+  // The host copy is kept, so spilling again only frees the device memory
+  EXPECT_EQ(manager.device_bytes(), size);
+  EXPECT_EQ(manager.host_bytes(), size);
+  EXPECT_EQ(manager.spill(1), size);
+
+  auto const packed = table.release();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input(), cudf::unpack(packed));
+  EXPECT_EQ(manager.device_bytes(), std::size_t{0});
+  EXPECT_EQ(manager.host_bytes(), std::size_t{0});
+}
+
+TEST_F(SpillTest, LeastRecentlyUsedFirst)
+{
+  cudf::spill_manager manager;
+  cudf::spillable_table first(input(), manager);
+  cudf::spillable_table second(input(), manager);
+  cudf::spillable_table third(input(), manager);
+  { auto const lock = first.lock(); }
+
+  EXPECT_EQ(manager.spill(1), second.packed_size());
+  EXPECT_FALSE(first.is_spilled());
+  EXPECT_TRUE(second.is_spilled());
+  EXPECT_FALSE(third.is_spilled());
+
+  EXPECT_EQ(manager.spill(1), third.packed_size());
+  EXPECT_TRUE(third.is_spilled());
+  EXPECT_FALSE(first.is_spilled());
+}
+
+TEST_F(SpillTest, DeviceLimit)
+{
+  cudf::spill_manager manager;
+  cudf::spillable_table first(input(), manager);
+  cudf::spillable_table second(input(), manager);
+
+  manager.set_device_limit(second.packed_size());
+  EXPECT_EQ(manager.device_limit(), second.packed_size());
+  EXPECT_TRUE(first.is_spilled());
+  EXPECT_FALSE(second.is_spilled());
+
+  // Copying the first table back exceeds the limit again, which spills the second one
+  auto const lock = first.lock();
+  EXPECT_FALSE(first.is_spilled());
+  EXPECT_TRUE(second.is_spilled());
+  EXPECT_EQ(manager.device_bytes(), first.packed_size());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input(), lock.view());
+}
+
+TEST_F(SpillTest, LockedTablesAreNotSpilled)
+{
+  cudf::spill_manager manager;
+  cudf::spillable_table first(input(), manager);
+  cudf::spillable_table second(input(), manager);
+
+  auto const lock = first.lock();
+  EXPECT_EQ(manager.spill(all_bytes), second.packed_size());
+  EXPECT_FALSE(first.is_spilled());
+  EXPECT_TRUE(second.is_spilled());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input(), lock.view());
+  EXPECT_THROW(first.release(), cudf::logic_error);
+}
+
+TEST_F(SpillTest, AdaptorSpillsOnOutOfMemory)
+{
+  column_wrapper<int32_t> large(thrust::make_counting_iterator(0),
+                                thrust::make_counting_iterator(1000));
+  cudf::table_view const large_input{{large}};
+
+  cudf::spill_manager manager;
+  // Room for one packed table, but not for another allocation of the same size
+  rmm::mr::limiting_resource_adaptor<rmm::mr::device_memory_resource> limited(
+    rmm::mr::get_current_device_resource(), 6000);
+  cudf::spilling_resource_adaptor mr(manager, &limited);
+
+  cudf::spillable_table table(large_input, manager, rmm::cuda_stream_default, &mr);
+  EXPECT_FALSE(table.is_spilled());
+  {
+    rmm::device_buffer const buffer(4000, rmm::cuda_stream_default, &mr);
+    EXPECT_TRUE(table.is_spilled());
+    // Nothing is left to spill
+    EXPECT_THROW(rmm::device_buffer(4000, rmm::cuda_stream_default, &mr), rmm::bad_alloc);
+  }
+
+  auto const lock = table.lock();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(large_input, lock.view());
+}
+
+TEST_F(SpillTest, InvalidArguments)
+{
+  cudf::spill_manager manager;
+  cudf::packed_columns empty{std::make_unique<cudf::packed_columns::metadata>(), nullptr};
+  EXPECT_THROW(cudf::spillable_table(std::move(empty), manager), cudf::logic_error);
+
+  cudf::spillable_table table(input(), manager);
+  auto const packed = table.release();
+  EXPECT_THROW(table.release(), cudf::logic_error);
+  EXPECT_THROW(table.lock(), cudf::logic_error);
+}
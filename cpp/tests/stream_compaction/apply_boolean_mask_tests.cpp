@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -127,6 +127,32 @@ TEST_F(ApplyBooleanMask, StringColumnTest)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected, got->view());
 }
 
+TEST_F(ApplyBooleanMask, MixedTypesTable)
+{
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+  cudf::test::strings_column_wrapper col1{{"a", "bb", "ccc", "dd", "e", "ff"}, {1, 0, 1, 1, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> col2{{1, 2, 3, 4, 5, 6}, {1, 1, 0, 1, 1, 1}};
+  LCW col3{{1, 2}, {3}, LCW{}, {4, 5, 6}, {7}, {8, 9}};
+  cudf::test::strings_column_wrapper col4{"u", "v", "w", "x", "y", "z"};
+  cudf::test::fixed_width_column_wrapper<double> col5{0.5, 1.5, 2.5, 3.5, 4.5, 5.5};
+  cudf::table_view input{{col1, col2, col3, col4, col5}};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{{1, 1, 0, 1, 0, 1}};
+
+  cudf::test::strings_column_wrapper col1_expected{{"a", "bb", "dd", "ff"}, {1, 0, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> col2_expected{1, 2, 4, 6};
+  LCW col3_expected{{1, 2}, {3}, {4, 5, 6}, {8, 9}};
+  cudf::test::strings_column_wrapper col4_expected{"u", "v", "x", "z"};
+  cudf::test::fixed_width_column_wrapper<double> col5_expected{0.5, 1.5, 3.5, 5.5};
+
+  auto got = cudf::apply_boolean_mask(input, boolean_mask);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(col1_expected, got->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(col2_expected, got->get_column(1));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(col3_expected, got->get_column(2));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(col4_expected, got->get_column(3));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(col5_expected, got->get_column(4));
+}
+
 TEST_F(ApplyBooleanMask, withoutNullString)
 {
   cudf::test::strings_column_wrapper col1({"d", "e", "a", "d", "k", "d", "l"});
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -394,3 +394,82 @@ TEST_F(DropDuplicate, EmptyKeys)
 
   CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{empty_col}}, got->view());
 }
+
+struct Distinct : public cudf::test::BaseFixture {
+};
+
+TEST_F(Distinct, NonNullTable)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{5, 4, 3, 5, 8, 5}};
+  cudf::test::fixed_width_column_wrapper<float> col2{{4, 5, 3, 4, 9, 4}};
+  cudf::test::fixed_width_column_wrapper<int32_t> col1_key{{20, 20, 20, 19, 21, 9}};
+  cudf::test::fixed_width_column_wrapper<int32_t> col2_key{{19, 19, 20, 20, 9, 21}};
+
+  cudf::table_view input{{col1, col2, col1_key, col2_key}};
+  std::vector<cudf::size_type> keys{2, 3};
+
+  // The expected tables are in the order of the input rows
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col1_first{{5, 3, 5, 8, 5}};
+  cudf::test::fixed_width_column_wrapper<float> exp_col2_first{{4, 3, 4, 9, 4}};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col1_key_first{{20, 20, 19, 21, 9}};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col2_key_first{{19, 20, 20, 9, 21}};
+  cudf::table_view expected_first{
+    {exp_col1_first, exp_col2_first, exp_col1_key_first, exp_col2_key_first}};
+
+  auto got_first = cudf::distinct(input, keys, cudf::duplicate_keep_option::KEEP_FIRST);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_first, got_first->view());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col1_last{{4, 3, 5, 8, 5}};
+  cudf::test::fixed_width_column_wrapper<float> exp_col2_last{{5, 3, 4, 9, 4}};
+  cudf::table_view expected_last{
+    {exp_col1_last, exp_col2_last, exp_col1_key_first, exp_col2_key_first}};
+
+  auto got_last = cudf::distinct(input, keys, cudf::duplicate_keep_option::KEEP_LAST);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_last, got_last->view());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col1_unique{{3, 5, 8, 5}};
+  cudf::test::fixed_width_column_wrapper<float> exp_col2_unique{{3, 4, 9, 4}};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col1_key_unique{{20, 19, 21, 9}};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col2_key_unique{{20, 20, 9, 21}};
+  cudf::table_view expected_unique{
+    {exp_col1_unique, exp_col2_unique, exp_col1_key_unique, exp_col2_key_unique}};
+
+  auto got_unique = cudf::distinct(input, keys, cudf::duplicate_keep_option::KEEP_NONE);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_unique, got_unique->view());
+}
+
+TEST_F(Distinct, WithNull)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{5, 4, 3, 5, 8, 1}, {1, 0, 1, 1, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> key{{20, 20, 20, 19, 21, 19}, {1, 0, 0, 1, 1, 1}};
+  cudf::table_view input{{col, key}};
+  std::vector<cudf::size_type> keys{1};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col_first{{5, 4, 5, 8}, {1, 0, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_key_col_first{{20, 20, 19, 21}, {1, 0, 1, 1}};
+  cudf::table_view expected_first{{exp_col_first, exp_key_col_first}};
+  auto got_first =
+    cudf::distinct(input, keys, cudf::duplicate_keep_option::KEEP_FIRST, null_equality::EQUAL);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_first, got_first->view());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col_last{{5, 3, 8, 1}, {1, 1, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_key_col_last{{20, 20, 21, 19}, {1, 0, 1, 1}};
+  cudf::table_view expected_last{{exp_col_last, exp_key_col_last}};
+  auto got_last = cudf::distinct(input, keys, cudf::duplicate_keep_option::KEEP_LAST);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_last, got_last->view());
+
+  // unequal nulls are unique
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col_unique{{5, 4, 3, 8}, {1, 0, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_key_col_unique{{20, 20, 20, 21},
+                                                                     {1, 0, 0, 1}};
+  cudf::table_view expected_unique{{exp_col_unique, exp_key_col_unique}};
+  auto got_unique =
+    cudf::distinct(input, keys, cudf::duplicate_keep_option::KEEP_NONE, null_equality::UNEQUAL);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_unique, got_unique->view());
+}
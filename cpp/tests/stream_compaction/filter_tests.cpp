@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/types.hpp>
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+struct FilterTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(FilterTest, Basic)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{10, 40, 70, 5, 2, 10}, {1, 1, 0, 1, 1, 1}};
+  cudf::test::strings_column_wrapper col2{{"a", "b", "c", "d", "e", "f"}, {1, 0, 1, 1, 1, 1}};
+  cudf::table_view input{{col1, col2}};
+
+  auto value      = cudf::numeric_scalar<int32_t>(5);
+  auto literal    = cudf::ast::literal(value);
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_0, literal);
+
+  // the row where the predicate is null is dropped
+  cudf::test::fixed_width_column_wrapper<int32_t> col1_expected{10, 40, 10};
+  cudf::test::strings_column_wrapper col2_expected{{"a", "b", "f"}, {1, 0, 1}};
+  cudf::table_view expected{{col1_expected, col2_expected}};
+
+  auto got = cudf::filter(input, expression);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, got->view());
+}
+
+TEST_F(FilterTest, MatchesApplyBooleanMask)
+{
+  auto const size = 10000;
+  auto values     = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                [](auto i) { return (i * 7919) % 1000; });
+  auto validity   = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                  [](auto i) { return i % 13 != 0; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(values, values + size, validity);
+  cudf::test::fixed_width_column_wrapper<int32_t> col2(values + 1, values + 1 + size);
+  cudf::table_view input{{col1, col2}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(1);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_0, col_ref_1);
+
+  auto boolean_mask = cudf::compute_column(input, expression);
+  auto expected     = cudf::apply_boolean_mask(input, boolean_mask->view());
+  auto got          = cudf::filter(input, expression);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), got->view());
+}
+
+TEST_F(FilterTest, NonBooleanPredicate)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{10, 40, 70};
+  cudf::table_view input{{col1}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_0);
+
+  EXPECT_THROW(cudf::filter(input, expression), cudf::logic_error);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/strings/capitalize.hpp>
 #include <cudf/strings/case.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -204,6 +205,34 @@ TEST_F(StringsCaseTest, MultiCharLower)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringsCaseTest, AsciiSliced)
+{
+  cudf::test::strings_column_wrapper input(
+    {"skip", "The Quick", "", "bRoWn fox jumps @[`{ ", "over the LAZY dog!", "xyz ABC 0123456789"},
+    {1, 1, 0, 1, 1, 1});
+  auto const sliced = cudf::slice(input, {1, 6}).front();
+  auto strings_view = cudf::strings_column_view(sliced);
+  auto const valids = std::vector<bool>{1, 0, 1, 1, 1};
+
+  auto results = cudf::strings::to_lower(strings_view);
+  cudf::test::strings_column_wrapper lower(
+    {"the quick", "", "brown fox jumps @[`{ ", "over the lazy dog!", "xyz abc 0123456789"},
+    valids.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, lower);
+
+  results = cudf::strings::to_upper(strings_view);
+  cudf::test::strings_column_wrapper upper(
+    {"THE QUICK", "", "BROWN FOX JUMPS @[`{ ", "OVER THE LAZY DOG!", "XYZ ABC 0123456789"},
+    valids.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, upper);
+
+  results = cudf::strings::swapcase(strings_view);
+  cudf::test::strings_column_wrapper swapped(
+    {"tHE qUICK", "", "BrOwN FOX JUMPS @[`{ ", "OVER THE lazy DOG!", "XYZ abc 0123456789"},
+    valids.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, swapped);
+}
+
 TEST_F(StringsCaseTest, EmptyStringsColumn)
 {
   cudf::column_view zero_size_strings_column(
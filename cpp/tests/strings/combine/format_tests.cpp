@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/combine.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+struct StringsFormatTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(StringsFormatTest, Format)
+{
+  cudf::test::strings_column_wrapper strings1({"aa", "", "cc", "éé"}, {1, 0, 1, 1});
+  cudf::test::strings_column_wrapper strings2({"1", "2", "", "4"}, {1, 1, 0, 1});
+  auto const table = cudf::table_view({strings1, strings2});
+
+  auto results = cudf::strings::format("{0}-{1}:{0}", table);
+  cudf::test::strings_column_wrapper expected({"aa-1:aa", "", "", "éé-4:éé"}, {1, 0, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  results = cudf::strings::format("{{{}}}={}", table, cudf::string_scalar("?"));
+  cudf::test::strings_column_wrapper expected_narep({"{aa}=1", "{?}=2", "{cc}=?", "{éé}=4"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_narep);
+
+  results = cudf::strings::format("key", table);
+  cudf::test::strings_column_wrapper expected_literal({"key", "key", "key", "key"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_literal);
+}
+
+TEST_F(StringsFormatTest, Errors)
+{
+  cudf::test::strings_column_wrapper strings({"aa"});
+  auto const table = cudf::table_view({strings});
+
+  EXPECT_THROW(cudf::strings::format("{0", table), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::format("0}", table), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::format("{a}", table), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::format("{1}", table), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::format("{}{}", table), cudf::logic_error);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> integers({1});
+  EXPECT_THROW(cudf::strings::format("{}", cudf::table_view({integers})), cudf::logic_error);
+}
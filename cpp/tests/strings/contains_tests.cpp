@@ -496,3 +496,106 @@ TEST_F(StringsContainsTests, ExtraLargeRegex)
     CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
   }
 }
+
+TEST_F(StringsContainsTests, RegexProgram)
+{
+  cudf::test::strings_column_wrapper strings({"abc", "123", "def456", "", "a1b2c3"},
+                                             {1, 1, 1, 0, 1});
+  auto strings_view = cudf::strings_column_view(strings);
+
+  auto const prog = cudf::strings::regex_program::create("\\d+");
+  EXPECT_EQ(prog->pattern(), "\\d+");
+  EXPECT_EQ(prog->flags(), cudf::strings::regex_flags::DEFAULT);
+  EXPECT_EQ(prog->groups_count(), 0);
+  EXPECT_GT(prog->instructions_count(), 0);
+
+  // The program is reused by each call, and gives the results of its pattern
+  for (int i = 0; i < 2; ++i) {
+    auto results = cudf::strings::contains_re(strings_view, *prog);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, *cudf::strings::contains_re(strings_view, "\\d+"));
+    results = cudf::strings::matches_re(strings_view, *prog);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, *cudf::strings::matches_re(strings_view, "\\d+"));
+    results = cudf::strings::count_re(strings_view, *prog);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, *cudf::strings::count_re(strings_view, "\\d+"));
+  }
+
+  EXPECT_THROW(cudf::strings::regex_program::create("*ab"), cudf::logic_error);
+}
+
+TEST_F(StringsContainsTests, RegexProgramWorkingMemory)
+{
+  // The ~950 instructions need working memory, which grows with the number of strings
+  std::string data(950, '0');
+  auto const prog = cudf::strings::regex_program::create(data);
+
+  cudf::test::strings_column_wrapper few({data, "00"});
+  auto results = cudf::strings::count_re(cudf::strings_column_view(few), *prog);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, cudf::test::fixed_width_column_wrapper<int32_t>({1, 0}));
+
+  cudf::test::strings_column_wrapper many({data, data, "00", data, data, data});
+  results = cudf::strings::count_re(cudf::strings_column_view(many), *prog);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 1, 0, 1, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(StringsContainsTests, AutomatonMatchesInstructions)
+{
+  // The patterns with literal classes are evaluated by an automaton, and their builtin class
+  // equivalents by the regex instructions
+  cudf::test::strings_column_wrapper strings(
+    {"ERROR disk 42", "WARN 12:30 net", "", "12:3", "abc\n123\nERROR x 7", "é 99:99", "1234", ""},
+    {1, 1, 1, 1, 1, 1, 1, 0});
+  auto strings_view = cudf::strings_column_view(strings);
+
+  std::vector<std::pair<std::string, std::string>> patterns{
+    {"[0-9]{2}:[0-9]{2}", "\\d{2}:\\d{2}"},
+    {"^[0-9]+$", "^\\d+$"},
+    {"(ERROR|WARN) [a-z]+ [0-9]", "(ERROR|WARN) [a-z]+ \\d"},
+    {"é [0-9]|^$", "é \\d|^$"}};
+  for (auto const& [dfa_pattern, nfa_pattern] : patterns) {
+    for (auto const flags :
+         {cudf::strings::regex_flags::DEFAULT, cudf::strings::regex_flags::MULTILINE}) {
+      auto results  = cudf::strings::contains_re(strings_view, dfa_pattern, flags);
+      auto expected = cudf::strings::contains_re(strings_view, nfa_pattern, flags);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, *expected);
+      results  = cudf::strings::matches_re(strings_view, dfa_pattern, flags);
+      expected = cudf::strings::matches_re(strings_view, nfa_pattern, flags);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, *expected);
+    }
+  }
+
+  auto results = cudf::strings::contains_re(
+    strings_view, "^[0-9]+$", cudf::strings::regex_flags::MULTILINE);
+  cudf::test::fixed_width_column_wrapper<bool> expected({0, 0, 0, 0, 1, 0, 1, 0},
+                                                        {1, 1, 1, 1, 1, 1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(StringsContainsTests, RequiredLiterals)
+{
+  // Only the strings holding the literals of the patterns are evaluated by the instructions
+  cudf::test::strings_column_wrapper strings({"ERROR: 42 disk",
+                                              "INFO: 42",
+                                              "ERROR 42",
+                                              "xx ERROR: 7",
+                                              "ERROR:",
+                                              "",
+                                              "ERRORERROR: 1"},
+                                             {1, 1, 1, 1, 1, 0, 1});
+  auto strings_view = cudf::strings_column_view(strings);
+
+  auto results = cudf::strings::contains_re(strings_view, ".*ERROR: (\\d+).*");
+  cudf::test::fixed_width_column_wrapper<bool> expected_contains({1, 0, 0, 1, 0, 0, 1},
+                                                                 {1, 1, 1, 1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_contains);
+
+  results = cudf::strings::matches_re(strings_view, "ERROR: \\d");
+  cudf::test::fixed_width_column_wrapper<bool> expected_matches({1, 0, 0, 0, 0, 0, 0},
+                                                                {1, 1, 1, 1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_matches);
+
+  results = cudf::strings::count_re(strings_view, "\\d+|ERROR");
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_count({2, 1, 2, 2, 1, 0, 3},
+                                                                 {1, 1, 1, 1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_count);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cudf/copying.hpp>
 #include <cudf/strings/convert/convert_datetime.hpp>
 #include <cudf/strings/convert/convert_durations.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -543,6 +544,52 @@ TEST_F(StringsDatetimeTest, FromTimestampAllSpecifiers)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringsDatetimeTest, DatetimeFormatReused)
+{
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep> timestamps{
+    {131246625L, 1563399277L, 0L, 1553085296L, 1582934400L, -1545730073L, -15L},
+    {1, 1, 0, 1, 1, 1, 1}};
+  cudf::test::strings_column_wrapper expected({"1974-02-28T01:23:45Z",
+                                               "2019-07-17T21:34:37Z",
+                                               "",
+                                               "2019-03-20T12:34:56Z",
+                                               "2020-02-29T00:00:00Z",
+                                               "1921-01-07T14:32:07Z",
+                                               "1969-12-31T23:59:45Z"},
+                                              {1, 1, 0, 1, 1, 1, 1});
+
+  auto const format = cudf::strings::datetime_format::create("%Y-%m-%dT%H:%M:%SZ");
+  EXPECT_EQ(format->format(), "%Y-%m-%dT%H:%M:%SZ");
+
+  auto results = cudf::strings::from_timestamps(timestamps, *format);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  auto const no_nulls = cudf::slice(timestamps, {3, 7})[0];
+  results             = cudf::strings::from_timestamps(no_nulls, *format);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, cudf::slice(expected, {3, 7})[0]);
+
+  auto const strings_view = cudf::strings_column_view(expected);
+  results                 = cudf::strings::to_timestamps(
+    strings_view, cudf::data_type{cudf::type_id::TIMESTAMP_SECONDS}, *format);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, timestamps);
+  results = cudf::strings::is_timestamp(strings_view, *format);
+  cudf::test::fixed_width_column_wrapper<bool> is_expected({1, 1, 0, 1, 1, 1, 1},
+                                                           {1, 1, 0, 1, 1, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, is_expected);
+
+  // names make the width of %A vary per row
+  auto const names_format = cudf::strings::datetime_format::create("%A %Y");
+  results                 = cudf::strings::from_timestamps(
+    no_nulls, *names_format, cudf::strings_column_view(format_names));
+  cudf::test::strings_column_wrapper names_expected(
+    {"Wednesday 2019", "Saturday 2020", "Friday 1921", "Wednesday 1969"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, names_expected);
+  EXPECT_THROW(cudf::strings::to_timestamps(
+                 strings_view, cudf::data_type{cudf::type_id::TIMESTAMP_SECONDS}, *names_format),
+               cudf::logic_error);
+
+  EXPECT_THROW(cudf::strings::datetime_format::create(""), cudf::logic_error);
+}
+
 TEST_F(StringsDatetimeTest, ZeroSizeStringsColumn)
 {
   cudf::column_view zero_size_column(
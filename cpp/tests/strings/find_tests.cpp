@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -24,6 +24,7 @@
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 
+#include <string>
 #include <vector>
 
 struct StringsFindTest : public cudf::test::BaseFixture {
@@ -80,6 +81,44 @@ TEST_F(StringsFindTest, Contains)
   }
 }
 
+TEST_F(StringsFindTest, LongStrings)
+{
+  // long enough for the strings to be searched by a warp per string
+  auto const s0 = std::string(100, 'a') + "é" + std::string(100, 'b') + "é";
+  std::string s1;
+  for (int i = 0; i < 70; ++i)
+    s1 += "é";
+  s1 += "x";
+  auto const s2 = std::string(200, 'z');
+  cudf::test::strings_column_wrapper strings({s0, s1, s2, s0}, {1, 1, 1, 0});
+  auto strings_view = cudf::strings_column_view(strings);
+  {
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({100, 0, -1, -1}, {1, 1, 1, 0});
+    auto results = cudf::strings::find(strings_view, cudf::string_scalar("é"));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({202, 69, -1, -1}, {1, 1, 1, 0});
+    auto results = cudf::strings::rfind(strings_view, cudf::string_scalar("é"));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({100, 5, -1, -1}, {1, 1, 1, 0});
+    auto results = cudf::strings::find(strings_view, cudf::string_scalar("é"), 5, 150);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({100, 69, -1, -1}, {1, 1, 1, 0});
+    auto results = cudf::strings::rfind(strings_view, cudf::string_scalar("é"), 5, 150);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<bool> expected({0, 1, 0, 0}, {1, 1, 1, 0});
+    auto results = cudf::strings::contains(strings_view, cudf::string_scalar("éx"));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
+
 TEST_F(StringsFindTest, StartsWith)
 {
   cudf::test::strings_column_wrapper strings({"Héllo", "thesé", "", "lease", "tést strings", ""},
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -92,6 +92,35 @@ TEST_F(StringsConvertTest, ToFloats32)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected, verbosity);
 }
 
+TEST_F(StringsConvertTest, ToFloatsOrNull)
+{
+  std::vector<const char*> h_strings{"1234",
+                                     nullptr,
+                                     "-876.5",
+                                     "",
+                                     "1234567890.123456789",
+                                     "abc123",
+                                     "123abc",
+                                     "-1.78e+5",
+                                     "0.000000001234567890123"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+
+  std::vector<bool> h_valids{1, 0, 1, 0, 1, 0, 0, 1, 1};
+  std::vector<double> h_expected;
+  for (std::size_t idx = 0; idx < h_strings.size(); ++idx) {
+    h_expected.push_back(h_valids[idx] ? std::atof(h_strings[idx]) : 0);
+  }
+
+  auto results = cudf::strings::to_floats_or_null(cudf::strings_column_view(strings),
+                                                  cudf::data_type{cudf::type_id::FLOAT64});
+  cudf::test::fixed_width_column_wrapper<double> expected(
+    h_expected.begin(), h_expected.end(), h_valids.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected, verbosity);
+}
+
 TEST_F(StringsConvertTest, FromFloats32)
 {
   std::vector<float> h_floats{100,
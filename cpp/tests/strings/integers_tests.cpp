@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -235,6 +235,54 @@ TEST_F(StringsConvertTest, ToInteger)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_u32);
 }
 
+TEST_F(StringsConvertTest, ToIntegersOrNull)
+{
+  cudf::test::strings_column_wrapper strings({"1234",
+                                              "-1281",
+                                              "",
+                                              "12345678901234567",
+                                              "-9223372036854775808",
+                                              "9223372036854775808",
+                                              "00000000000000000000042",
+                                              "+127",
+                                              "12345678x",
+                                              "-"},
+                                             {1, 1, 1, 1, 1, 1, 1, 1, 1, 0});
+  auto const strings_view = cudf::strings_column_view(strings);
+
+  auto results = cudf::strings::to_integers_or_null(strings_view,
+                                                    cudf::data_type{cudf::type_id::INT64});
+  cudf::test::fixed_width_column_wrapper<int64_t> expected_i64(
+    {1234L,
+     -1281L,
+     0L,
+     12345678901234567L,
+     std::numeric_limits<int64_t>::min(),
+     0L,
+     42L,
+     127L,
+     0L,
+     0L},
+    {1, 1, 0, 1, 1, 0, 1, 1, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_i64);
+
+  results = cudf::strings::to_integers_or_null(strings_view, cudf::data_type{cudf::type_id::INT8});
+  cudf::test::fixed_width_column_wrapper<int8_t> expected_i8({0, 0, 0, 0, 0, 0, 42, 127, 0, 0},
+                                                             {0, 0, 0, 0, 0, 0, 1, 1, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_i8);
+
+  results =
+    cudf::strings::to_integers_or_null(strings_view, cudf::data_type{cudf::type_id::UINT64});
+  cudf::test::fixed_width_column_wrapper<uint64_t> expected_u64(
+    {1234UL, 0UL, 0UL, 12345678901234567UL, 0UL, 9223372036854775808UL, 42UL, 127UL, 0UL, 0UL},
+    {1, 0, 0, 1, 0, 1, 1, 1, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_u64);
+
+  EXPECT_THROW(
+    cudf::strings::to_integers_or_null(strings_view, cudf::data_type{cudf::type_id::BOOL8}),
+    cudf::logic_error);
+}
+
 TEST_F(StringsConvertTest, FromInteger)
 {
   int32_t minint = std::numeric_limits<int32_t>::min();
@@ -967,4 +967,40 @@ TEST_F(JsonPathTests, EscapeSequences)
     // clang-format on
     CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*result, expected);
   }
-}
\ No newline at end of file
+}
+TEST_F(JsonPathTests, GetJsonObjectMultiplePaths)
+{
+  cudf::test::strings_column_wrapper input{
+    {json_string, "{\"expensive\": 5, \"store\": []}", "", "{\"a\": 1}"},
+    {true, true, true, false}};
+
+  // simple paths sharing prefixes, a path with a wildcard, invalid indices and an empty path
+  std::vector<std::string> const json_paths{"$.store.bicycle.color",
+                                            "$.expensive",
+                                            "$.store.book[2].isbn",
+                                            "$.store.book[*].price",
+                                            "$.store.book[1]",
+                                            "$.store.book[7].title",
+                                            "$[0]",
+                                            "",
+                                            "$.store.bicycle"};
+
+  auto const results =
+    cudf::strings::get_json_object(cudf::strings_column_view(input), json_paths);
+  ASSERT_EQ(results->num_columns(), static_cast<cudf::size_type>(json_paths.size()));
+
+  for (size_t i = 0; i < json_paths.size(); ++i) {
+    auto const expected = cudf::strings::get_json_object(
+      cudf::strings_column_view(input), cudf::string_scalar(json_paths[i]));
+    auto const result = results->get_column(i).view();
+    if (expected->has_nulls() && expected->null_count() == expected->size()) {
+      EXPECT_EQ(result.null_count(), result.size());
+    } else {
+      CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result, *expected);
+    }
+  }
+
+  cudf::test::strings_column_wrapper expected_color{{"red", "", "", ""},
+                                                    {true, false, false, false}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->get_column(0), expected_color);
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/find_multiple.hpp>
+#include <cudf/strings/multi_pattern_matcher.hpp>
+#include <cudf/strings/replace.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <vector>
+
+struct StringsMultiPatternMatcherTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(StringsMultiPatternMatcherTest, MatchesSinglePatternAPIs)
+{
+  std::vector<const char*> h_strings{
+    "Héllo", "thesé", nullptr, "lease", "test strings", "", "she sells sea shells"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  auto strings_view = cudf::strings_column_view(strings);
+
+  // overlapping patterns, and patterns that are suffixes or prefixes of others
+  cudf::test::strings_column_wrapper patterns({"é", "he", "she", "hers", "es", "e", "sea"});
+  auto patterns_view = cudf::strings_column_view(patterns);
+  cudf::strings::multi_pattern_matcher matcher(patterns_view);
+  EXPECT_EQ(matcher.size(), 7);
+
+  auto results = matcher.find(strings_view);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results,
+                                 *cudf::strings::find_multiple(strings_view, patterns_view));
+
+  cudf::test::strings_column_wrapper repls({"E", "HE", "SHE", "HERS", "ES", "e_", "SEA"});
+  results = matcher.replace(strings_view, cudf::strings_column_view(repls));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *results,
+    *cudf::strings::replace(strings_view, patterns_view, cudf::strings_column_view(repls)));
+
+  cudf::test::strings_column_wrapper repl({"_"});
+  results = matcher.replace(strings_view, cudf::strings_column_view(repl));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *results,
+    *cudf::strings::replace(strings_view, patterns_view, cudf::strings_column_view(repl)));
+
+  // empty patterns are never found
+  cudf::test::strings_column_wrapper with_empty({"e", ""});
+  results = cudf::strings::multi_pattern_matcher(cudf::strings_column_view{with_empty})
+              .find(strings_view);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *results, *cudf::strings::find_multiple(strings_view, cudf::strings_column_view{with_empty}));
+}
+
+TEST_F(StringsMultiPatternMatcherTest, Contains)
+{
+  cudf::test::strings_column_wrapper strings({"a cat", "dogs", "bird", "", "at the cat"},
+                                             {1, 1, 1, 1, 0});
+  cudf::test::strings_column_wrapper patterns({"cat", "dog", "at", "cat"});
+  cudf::strings::multi_pattern_matcher matcher(cudf::strings_column_view{patterns});
+
+  auto results = matcher.contains(cudf::strings_column_view(strings));
+  using LCW    = cudf::test::lists_column_wrapper<int32_t>;
+  LCW expected({LCW{0, 2, 3}, LCW{1}, LCW{}, LCW{}, LCW{}},
+               cudf::test::iterators::null_at(4));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+}
+
+TEST_F(StringsMultiPatternMatcherTest, ErrorTest)
+{
+  cudf::test::strings_column_wrapper patterns({"a", "b"}, {1, 0});
+  EXPECT_THROW(cudf::strings::multi_pattern_matcher(cudf::strings_column_view{patterns}),
+               cudf::logic_error);
+
+  cudf::test::strings_column_wrapper valid({"a", "b"});
+  cudf::strings::multi_pattern_matcher matcher(cudf::strings_column_view{valid});
+  cudf::test::strings_column_wrapper repls({"x", "y", "z"});
+  EXPECT_THROW(matcher.replace(cudf::strings_column_view{valid}, cudf::strings_column_view{repls}),
+               cudf::logic_error);
+}
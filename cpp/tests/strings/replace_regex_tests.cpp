@@ -59,6 +59,17 @@ TEST_F(StringsReplaceRegexTest, ReplaceRegexTest)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringsReplaceRegexTest, OutputLargerThanEstimate)
+{
+  // some strings grow past twice their size plus the replacement and are written again
+  cudf::test::strings_column_wrapper strings({"aaaa", "bab", "", "bbbb", "a"}, {1, 1, 1, 1, 0});
+  auto results = cudf::strings::replace_re(
+    cudf::strings_column_view(strings), "a", cudf::string_scalar("<+++++>"));
+  cudf::test::strings_column_wrapper expected(
+    {"<+++++><+++++><+++++><+++++>", "b<+++++>b", "", "bbbb", ""}, {1, 1, 1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
 TEST_F(StringsReplaceRegexTest, ReplaceMultiRegexTest)
 {
   std::vector<const char*> h_strings{"the quick brown fox jumps over the lazy dog",
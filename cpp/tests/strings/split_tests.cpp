@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/split/partition.hpp>
 #include <cudf/strings/split/split.hpp>
@@ -27,6 +28,7 @@
 #include <cudf_test/table_utilities.hpp>
 #include <tests/strings/utilities.h>
 
+#include <string>
 #include <vector>
 
 struct StringsSplitTest : public cudf::test::BaseFixture {
@@ -291,6 +293,46 @@ TEST_F(StringsSplitTest, SplitRecord)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected);
 }
 
+TEST_F(StringsSplitTest, SplitRecordLongStrings)
+{
+  // long enough for the delimiters to be located over all the characters in parallel
+  std::string s0;
+  for (int i = 0; i < 40; ++i)
+    s0 += "ab,";
+  s0 += "é";
+  auto const s3 = std::string(100, 'z') + ",";
+  cudf::test::strings_column_wrapper strings({s0, "", "", s3}, {1, 1, 0, 1});
+  auto const strings_view = cudf::strings_column_view(strings);
+
+  auto const expect_split = [](cudf::column_view const& result,
+                               std::vector<int32_t> const& offsets,
+                               std::vector<std::string> const& tokens) {
+    auto const lists = cudf::lists_column_view(result);
+    cudf::test::fixed_width_column_wrapper<int32_t> expected_offsets(offsets.begin(),
+                                                                     offsets.end());
+    cudf::test::strings_column_wrapper expected_tokens(tokens.begin(), tokens.end());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(lists.offsets(), expected_offsets);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(lists.child(), expected_tokens);
+    EXPECT_EQ(result.null_count(), 1);
+  };
+
+  std::vector<std::string> tokens(40, "ab");
+  tokens.insert(tokens.end(), {"é", "", std::string(100, 'z'), ""});
+  auto result = cudf::strings::split_record(strings_view, cudf::string_scalar(","));
+  expect_split(result->view(), {0, 41, 42, 42, 44}, tokens);
+  result = cudf::strings::rsplit_record(strings_view, cudf::string_scalar(","));
+  expect_split(result->view(), {0, 41, 42, 42, 44}, tokens);
+
+  result = cudf::strings::split_record(strings_view, cudf::string_scalar(","), 2);
+  expect_split(result->view(),
+               {0, 3, 4, 4, 6},
+               {"ab", "ab", s0.substr(6), "", std::string(100, 'z'), ""});
+  result = cudf::strings::rsplit_record(strings_view, cudf::string_scalar(","), 2);
+  expect_split(result->view(),
+               {0, 3, 4, 4, 6},
+               {s0.substr(0, s0.size() - 6), "ab", "é", "", std::string(100, 'z'), ""});
+}
+
 TEST_F(StringsSplitTest, SplitRecordWithMaxSplit)
 {
   std::vector<const char*> h_strings{" Héllo thesé", nullptr, "are some  ", "tést String", ""};
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/copying.hpp>
+#include <cudf/detail/device_view_cache.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/table/cached_table_device_view.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/cuda_stream.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform_reduce.h>
+
+#include <functional>
+
+struct CachedTableDeviceViewTest : public cudf::test::BaseFixture {
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{{3, 1, 2, 1}, {1, 1, 1, 0}};
+  cudf::test::strings_column_wrapper strings{"bb", "a", "dddd", "ccc"};
+
+  cudf::table_view input() { return cudf::table_view{{ints, strings}}; }
+};
+
+TEST_F(CachedTableDeviceViewTest, CreateReturnsCachedView)
+{
+  {
+    cudf::cached_table_device_view const cached(input());
+    EXPECT_EQ(cudf::table_device_view::create(input()).get(), &cached.view());
+    EXPECT_EQ(cached.source().num_columns(), 2);
+
+    // Handles of equal tables share the views
+    cudf::table_view const same{{input().column(0), input().column(1)}};
+    cudf::cached_table_device_view const other(same);
+    EXPECT_EQ(&other.view(), &cached.view());
+    EXPECT_EQ(cudf::table_device_view::create(same).get(), &cached.view());
+
+    // A slice of the table has other views
+    auto const sliced = cudf::slice(input(), {1, 3})[0];
+    EXPECT_NE(cudf::table_device_view::create(sliced).get(), &cached.view());
+    EXPECT_EQ(cudf::detail::find_cached_device_view(sliced).view, nullptr);
+
+    // Columns with children are cached too
+    auto const d_strings = cudf::column_device_view::create(input().column(1));
+    EXPECT_EQ(d_strings.get(), cudf::detail::find_cached_device_view(input().column(1)).view);
+  }
+  EXPECT_EQ(cudf::detail::find_cached_device_view(input()).view, nullptr);
+  EXPECT_EQ(cudf::detail::find_cached_device_view(input().column(1)).view, nullptr);
+}
+
+TEST_F(CachedTableDeviceViewTest, ViewsOutliveHandles)
+{
+  std::unique_ptr<cudf::column_device_view, std::function<void(cudf::column_device_view*)>>
+    d_strings;
+  {
+    cudf::cached_table_device_view const cached(input());
+    d_strings = cudf::column_device_view::create(input().column(1));
+  }
+  EXPECT_NE(cudf::detail::find_cached_device_view(input().column(1)).view, nullptr);
+
+  auto const total_size = thrust::transform_reduce(
+    rmm::exec_policy(),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(d_strings->size()),
+    [d_strings = *d_strings] __device__(cudf::size_type idx) {
+      return d_strings.element<cudf::string_view>(idx).size_bytes();
+    },
+    0,
+    thrust::plus<cudf::size_type>{});
+  EXPECT_EQ(total_size, 10);
+
+  d_strings.reset();
+  EXPECT_EQ(cudf::detail::find_cached_device_view(input().column(1)).view, nullptr);
+}
+
+TEST_F(CachedTableDeviceViewTest, ViewsUsedOnOtherStream)
+{
+  rmm::cuda_stream other_stream;
+  auto cached    = std::make_unique<cudf::cached_table_device_view>(input());
+  auto d_strings = cudf::column_device_view::create(input().column(1), other_stream.view());
+  EXPECT_EQ(d_strings.get(), cudf::detail::find_cached_device_view(input().column(1)).view);
+
+  rmm::device_scalar<cudf::size_type> total_size(0, other_stream.view());
+  thrust::for_each_n(rmm::exec_policy(other_stream.view()),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     d_strings->size(),
+                     [d_strings = *d_strings, total_size = total_size.data()] __device__(auto idx) {
+                       auto const size = d_strings.element<cudf::string_view>(idx).size_bytes();
+                       atomicAdd(total_size, size);
+                     });
+
+  // The views are freed after the work on the other stream completes
+  cached.reset();
+  d_strings.reset();
+  EXPECT_EQ(cudf::detail::find_cached_device_view(input().column(1)).view, nullptr);
+  EXPECT_EQ(total_size.value(other_stream.view()), 10);
+}
+
+TEST_F(CachedTableDeviceViewTest, AlgorithmsUseCachedViews)
+{
+  cudf::cached_table_device_view const cached(input());
+  auto const order = cudf::sorted_order(input());
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected{3, 1, 2, 0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, order->view());
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <nvtext/byte_pair_encoding.hpp>
+
+struct TextBytePairEncodingTest : public cudf::test::BaseFixture {
+};
+
+using LCW = cudf::test::lists_column_wrapper<uint32_t>;
+
+TEST_F(TextBytePairEncodingTest, Encoding)
+{
+  cudf::test::strings_column_wrapper merge_left({"l", "lo", " "});
+  cudf::test::strings_column_wrapper merge_right({"o", "w", "low"});
+  cudf::test::strings_column_wrapper tokens({"l", "o", "w", " ", "e", "r", "lo", "low", " low"});
+  nvtext::bpe_vocabulary vocabulary(cudf::strings_column_view(merge_left),
+                                    cudf::strings_column_view(merge_right),
+                                    cudf::strings_column_view(tokens),
+                                    99);
+  EXPECT_EQ(vocabulary.merges_count(), 3);
+  EXPECT_EQ(vocabulary.tokens_count(), 9);
+
+  cudf::test::strings_column_wrapper strings({"lower low", "", "", "lowly  "},
+                                             cudf::test::iterators::null_at(2));
+  auto results = nvtext::byte_pair_encoding(cudf::strings_column_view(strings), vocabulary);
+  LCW expected({LCW{7, 4, 5, 8}, LCW{}, LCW{}, LCW{7, 0, 99, 3, 3}},
+               cudf::test::iterators::null_at(2));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+
+  auto sliced = cudf::slice(strings, {3, 4}).front();
+  results     = nvtext::byte_pair_encoding(cudf::strings_column_view(sliced), vocabulary);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, LCW({LCW{7, 0, 99, 3, 3}}));
+}
+
+TEST_F(TextBytePairEncodingTest, RepeatedPairs)
+{
+  cudf::test::strings_column_wrapper merge_left({"a"});
+  cudf::test::strings_column_wrapper merge_right({"a"});
+  cudf::test::strings_column_wrapper tokens({"a", "aa", " "});
+  nvtext::bpe_vocabulary vocabulary(cudf::strings_column_view(merge_left),
+                                    cudf::strings_column_view(merge_right),
+                                    cudf::strings_column_view(tokens),
+                                    99);
+
+  cudf::test::strings_column_wrapper strings({"aaa ab", "aaaa"});
+  auto results = nvtext::byte_pair_encoding(cudf::strings_column_view(strings), vocabulary);
+  LCW expected({LCW{1, 0, 2, 0, 99}, LCW{1, 1}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+}
+
+TEST_F(TextBytePairEncodingTest, ErrorsAndEmpty)
+{
+  cudf::test::strings_column_wrapper merge_left({"a", "b"});
+  cudf::test::strings_column_wrapper merge_right({"b"});
+  cudf::test::strings_column_wrapper tokens({"a", "b", "ab"});
+  EXPECT_THROW(nvtext::bpe_vocabulary(cudf::strings_column_view(merge_left),
+                                      cudf::strings_column_view(merge_right),
+                                      cudf::strings_column_view(tokens),
+                                      0),
+               cudf::logic_error);
+
+  cudf::test::strings_column_wrapper left({"a"});
+  nvtext::bpe_vocabulary vocabulary(cudf::strings_column_view(left),
+                                    cudf::strings_column_view(merge_right),
+                                    cudf::strings_column_view(tokens),
+                                    0);
+  auto empty   = cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
+  auto results = nvtext::byte_pair_encoding(cudf::strings_column_view(empty->view()), vocabulary);
+  EXPECT_EQ(results->size(), 0);
+}
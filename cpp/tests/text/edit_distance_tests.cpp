@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,11 +22,30 @@
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 
+#include <algorithm>
+#include <numeric>
+#include <string>
 #include <vector>
 
 struct TextEditDistanceTest : public cudf::test::BaseFixture {
 };
 
+namespace {
+int32_t host_edit_distance(std::string const& a, std::string const& b)
+{
+  std::vector<int32_t> prev(b.size() + 1);
+  std::iota(prev.begin(), prev.end(), 0);
+  for (std::size_t i = 1; i <= a.size(); ++i) {
+    std::vector<int32_t> curr(b.size() + 1);
+    curr[0] = static_cast<int32_t>(i);
+    for (std::size_t j = 1; j <= b.size(); ++j)
+      curr[j] = std::min({prev[j] + 1, curr[j - 1] + 1, prev[j - 1] + (a[i - 1] != b[j - 1])});
+    prev = std::move(curr);
+  }
+  return prev.back();
+}
+}  // namespace
+
 TEST_F(TextEditDistanceTest, EditDistance)
 {
   std::vector<const char*> h_strings{"dog", nullptr, "cat", "mouse", "pup", "", "puppy", "thé"};
@@ -98,3 +117,68 @@ TEST_F(TextEditDistanceTest, ErrorsTest)
     cudf::logic_error);
   EXPECT_THROW(nvtext::edit_distance_matrix(cudf::strings_column_view(strings)), cudf::logic_error);
 }
+
+TEST_F(TextEditDistanceTest, LongStrings)
+{
+  // lengths around the 64 characters processed together
+  std::string const base = "the quick brown fox jumps over the lazy dog and keeps on running ";
+  std::vector<std::string> h_strings;
+  std::vector<std::string> h_targets;
+  for (std::size_t length : {10, 63, 64, 65, 127, 128, 129, 200}) {
+    std::string str;
+    while (str.size() < length)
+      str += base;
+    str.resize(length);
+    auto tgt = str;
+    for (std::size_t i = 3; i < tgt.size(); i += 7)
+      tgt[i] = 'x';
+    tgt.erase(length / 2, 3);
+    h_strings.push_back(str);
+    h_targets.push_back(tgt.substr(0, tgt.size() - (length % 3)) + "ab");
+  }
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+  cudf::test::strings_column_wrapper targets(h_targets.begin(), h_targets.end());
+
+  std::vector<int32_t> h_expected;
+  for (std::size_t i = 0; i < h_strings.size(); ++i)
+    h_expected.push_back(host_edit_distance(h_strings[i], h_targets[i]));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected(h_expected.begin(), h_expected.end());
+  auto results =
+    nvtext::edit_distance(cudf::strings_column_view(strings), cudf::strings_column_view(targets));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  // either argument may be the shorter one
+  results =
+    nvtext::edit_distance(cudf::strings_column_view(targets), cudf::strings_column_view(strings));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  for (cudf::size_type max_distance : {0, 5, 30}) {
+    std::vector<int32_t> h_limited(h_expected);
+    std::transform(h_limited.begin(), h_limited.end(), h_limited.begin(), [&](auto d) {
+      return std::min(d, max_distance + 1);
+    });
+    cudf::test::fixed_width_column_wrapper<int32_t> limited(h_limited.begin(), h_limited.end());
+    results = nvtext::edit_distance(
+      cudf::strings_column_view(strings), cudf::strings_column_view(targets), max_distance);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, limited);
+  }
+}
+
+TEST_F(TextEditDistanceTest, MaxDistance)
+{
+  cudf::test::strings_column_wrapper strings({"hello", "", "world"});
+  cudf::test::strings_column_wrapper targets({"hallo", "goodbye", "world"});
+  auto results = nvtext::edit_distance(
+    cudf::strings_column_view(strings), cudf::strings_column_view(targets), 2);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 3, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  cudf::test::strings_column_wrapper input({"hello", "hallo", "goodbye"});
+  results = nvtext::edit_distance_matrix(cudf::strings_column_view(input), 2);
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+  LCW expected_matrix({LCW{0, 1, 3}, LCW{1, 0, 3}, LCW{3, 3, 0}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_matrix);
+
+  EXPECT_THROW(nvtext::edit_distance(
+                 cudf::strings_column_view(strings), cudf::strings_column_view(targets), -1),
+               cudf::logic_error);
+}
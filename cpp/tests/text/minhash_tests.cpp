@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/hashing.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <nvtext/generate_ngrams.hpp>
+#include <nvtext/minhash.hpp>
+
+#include <algorithm>
+#include <vector>
+
+struct TextMinHashTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(TextMinHashTest, MinHash)
+{
+  cudf::test::strings_column_wrapper strings(
+    {"the quick brown fox", "", "jumped over", "héllo wörld", "ab", ""},
+    cudf::test::iterators::null_at(1));
+  std::vector<uint32_t> h_seeds{0, 1, 42};
+  cudf::test::fixed_width_column_wrapper<uint32_t> seeds(h_seeds.begin(), h_seeds.end());
+  auto const width = 4;
+
+  auto results = nvtext::minhash(cudf::strings_column_view(strings), seeds, width);
+
+  // the minimum of the hashes of the materialized shingles
+  std::vector<uint32_t> h_expected;
+  for (cudf::size_type row = 0; row < 6; ++row) {
+    if (row == 1) continue;
+    auto const str       = cudf::slice(strings, {row, row + 1}).front();
+    auto const too_short = cudf::strings_column_view(str).chars_size() < width;
+    auto const shingles  =
+      too_short ? std::make_unique<cudf::column>(str)
+                : nvtext::generate_character_ngrams(cudf::strings_column_view(str), width);
+    for (auto seed : h_seeds) {
+      auto const hashes = cudf::hash(
+        cudf::table_view({shingles->view()}), cudf::hash_id::HASH_SERIAL_MURMUR3, seed);
+      auto const h_hashes = cudf::test::to_host<uint32_t>(hashes->view()).first;
+      h_expected.push_back(*std::min_element(h_hashes.begin(), h_hashes.end()));
+    }
+  }
+  auto expected_hashes =
+    cudf::test::fixed_width_column_wrapper<uint32_t>(h_expected.begin(), h_expected.end());
+  cudf::lists_column_view result_lists(*results);
+  EXPECT_EQ(results->size(), 6);
+  EXPECT_EQ(results->null_count(), 1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result_lists.child(), expected_hashes);
+
+  auto sliced = cudf::slice(strings, {2, 4}).front();
+  results     = nvtext::minhash(cudf::strings_column_view(sliced), seeds, width);
+  auto const expected_sliced =
+    cudf::slice(expected_hashes, {static_cast<cudf::size_type>(h_seeds.size()),
+                                  static_cast<cudf::size_type>(3 * h_seeds.size())})
+      .front();
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::lists_column_view(*results).child(), expected_sliced);
+
+  EXPECT_THROW(nvtext::minhash(cudf::strings_column_view(strings), seeds, 1), cudf::logic_error);
+  cudf::test::fixed_width_column_wrapper<int32_t> bad_seeds({1, 2});
+  EXPECT_THROW(nvtext::minhash(cudf::strings_column_view(strings), bad_seeds), cudf::logic_error);
+}
+
+TEST_F(TextMinHashTest, Candidates)
+{
+  using LCW = cudf::test::lists_column_wrapper<uint32_t>;
+  LCW signatures({LCW{1, 2, 3, 4},
+                  LCW{1, 2, 5, 6},
+                  LCW{7, 8, 5, 6},
+                  LCW{9, 9, 9, 9},
+                  LCW{},
+                  LCW{1, 2, 5, 6}},
+                 cudf::test::iterators::null_at(4));
+
+  auto results = nvtext::minhash_candidates(cudf::lists_column_view(signatures), 2);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_left({0, 0, 1, 1, 2});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_right({1, 5, 2, 5, 5});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0), expected_left);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1), expected_right);
+
+  // a single band pairs only the same signatures
+  results = nvtext::minhash_candidates(cudf::lists_column_view(signatures), 1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0),
+                                 cudf::test::fixed_width_column_wrapper<int32_t>({1}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1),
+                                 cudf::test::fixed_width_column_wrapper<int32_t>({5}));
+
+  EXPECT_THROW(nvtext::minhash_candidates(cudf::lists_column_view(signatures), 3),
+               cudf::logic_error);
+  LCW uneven({LCW{1, 2}, LCW{1, 2, 3, 4}});
+  EXPECT_THROW(nvtext::minhash_candidates(cudf::lists_column_view(uneven), 2),
+               cudf::logic_error);
+}
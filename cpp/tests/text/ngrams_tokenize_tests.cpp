@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,9 +15,11 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <nvtext/ngrams_tokenize.hpp>
+#include <nvtext/normalize.hpp>
 
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
@@ -121,3 +123,39 @@ TEST_F(TextNgramsTokenizeTest, TokenizeErrorTest)
   cudf::strings_column_view strings_view(strings);
   EXPECT_THROW(nvtext::ngrams_tokenize(strings_view, 0), cudf::logic_error);
 }
+
+TEST_F(TextNgramsTokenizeTest, NormalizedTokenize)
+{
+  std::vector<const char*> h_strings{"The  Cat sat.",
+                                     "Hi",
+                                     nullptr,
+                                     "Éé ab\tcd",
+                                     "",
+                                     " [a,bb] ÀÉÎ　ß ",
+                                     "$24.08 ĂĆĖÑÜ"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  cudf::strings_column_view strings_view(strings);
+
+  cudf::test::strings_column_wrapper expected{"the_cat", "cat_sat", "sat_.", "ee_ab", "ab_cd"};
+  auto const sliced = cudf::slice(strings, {0, 4}).front();
+  auto results      = nvtext::normalized_ngrams_tokenize(cudf::strings_column_view(sliced));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  // the same as the steps run one after the other
+  for (bool do_lower_case : {true, false}) {
+    auto const normalized =
+      nvtext::normalize_characters(nvtext::normalize_spaces(strings_view)->view(), do_lower_case);
+    for (cudf::size_type ngrams : {1, 2, 3}) {
+      auto const expected = nvtext::ngrams_tokenize(
+        normalized->view(), ngrams, cudf::string_scalar(""), cudf::string_scalar("+"));
+      results = nvtext::normalized_ngrams_tokenize(
+        strings_view, ngrams, do_lower_case, cudf::string_scalar("+"));
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, *expected);
+    }
+  }
+
+  EXPECT_THROW(nvtext::normalized_ngrams_tokenize(strings_view, 0), cudf::logic_error);
+}
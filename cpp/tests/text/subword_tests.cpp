@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -145,6 +145,37 @@ TEST(TextSubwordTest, TokenizeMultiRow)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_metadata->view(), expected_metadata);
 }
 
+TEST(TextSubwordTest, Tokenizer)
+{
+  std::vector<const char*> h_strings{"This is a test.", "This is a test. This is a tést."};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+  nvtext::subword_tokenizer tokenizer(nvtext::load_vocabulary_file(hash_file));
+
+  for (bool do_truncate : {true, false}) {
+    auto const expected = nvtext::subword_tokenize(cudf::strings_column_view{strings},
+                                                   tokenizer.vocabulary(),
+                                                   8,
+                                                   6,
+                                                   true,
+                                                   do_truncate,
+                                                   MAX_ROWS_TENSOR);
+    auto const result =
+      tokenizer.tokenize(cudf::strings_column_view{strings}, 8, 6, true, do_truncate);
+    EXPECT_EQ(expected.nrows_tensor, result.nrows_tensor);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_token_ids->view(),
+                                   expected.tensor_token_ids->view());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_attention_mask->view(),
+                                   expected.tensor_attention_mask->view());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_metadata->view(),
+                                   expected.tensor_metadata->view());
+  }
+
+  EXPECT_THROW(tokenizer.tokenize(cudf::strings_column_view{strings}, 8, 9, true, true),
+               cudf::logic_error);
+}
+
 TEST(TextSubwordTest, TokenizeMaxEqualsTokens)
 {
   cudf::test::strings_column_wrapper strings({"This is a test."});
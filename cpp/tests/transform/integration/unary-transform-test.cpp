@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Copyright 2018-2019 BlazingDB, Inc.
  *     Copyright 2018 Christian Noboa Mardini <christian@blazingdb.com>
@@ -18,10 +18,14 @@
  */
 
 #include <cudf/detail/iterator.cuh>
+#include <cudf/jit/precompile.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/transform.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 
 #include "assert-unary.h"
@@ -225,6 +229,57 @@ __device__ inline void f(cudf::timestamp_us* output, cudf::timestamp_us input)
   test_udf<dtype>(cuda, op, data_init, 500, false);
 }
 
+TEST_F(UnaryOperationIntegrationTest, PrecompiledTransform)
+{
+  // c = a * a - a
+  const char cuda[] =
+    "__device__ inline void f(int* output,int input){*output = input*input - input;}";
+
+  auto const type = data_type{type_id::INT32};
+  cudf::jit::precompile({{cudf::jit::kernel_kind::TRANSFORM, cuda, false, {type}, type}});
+
+  using dtype    = int;
+  auto op        = [](dtype a) { return a * a - a; };
+  auto data_init = [](cudf::size_type row) { return row % 78; };
+
+  test_udf<dtype>(cuda, op, data_init, 500, false);
+}
+
+TEST_F(UnaryOperationIntegrationTest, PrecompileInvalidSignature)
+{
+  auto const type = data_type{type_id::INT32};
+  EXPECT_THROW(cudf::jit::precompile({{cudf::jit::kernel_kind::TRANSFORM, "", false, {}, type}}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::jit::precompile(
+                 {{cudf::jit::kernel_kind::BINARY_OPERATION, "", false, {type, type}, type}}),
+               cudf::logic_error);
+}
+
+TEST_F(UnaryOperationIntegrationTest, TableTransformMultipleOutputs)
+{
+  // the sum and the difference of a and b, sharing the conversion of b
+  const char cuda[] =
+    "__device__ inline void f(double* sum, double* difference, int a, float b)"
+    "{double c = b; *sum = a + c; *difference = a - c;}";
+
+  fixed_width_column_wrapper<int32_t> a{{1, 2, 3, 4}, {1, 1, 0, 1}};
+  fixed_width_column_wrapper<float> b{{0.5, 1.5, 2.5, 3.5}, {1, 0, 1, 1}};
+  auto const output_types =
+    std::vector<data_type>{data_type{type_id::FLOAT64}, data_type{type_id::FLOAT64}};
+
+  auto const propagated = cudf::transform(table_view{{a, b}}, cuda, output_types, false, true);
+  fixed_width_column_wrapper<double> sum{{1.5, 0, 0, 7.5}, {1, 0, 0, 1}};
+  fixed_width_column_wrapper<double> difference{{0.5, 0, 0, 0.5}, {1, 0, 0, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(propagated->get_column(0), sum);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(propagated->get_column(1), difference);
+
+  auto const ignored = cudf::transform(table_view{{a, b}}, cuda, output_types, false, false);
+  EXPECT_FALSE(ignored->get_column(0).has_nulls());
+  EXPECT_FALSE(ignored->get_column(1).has_nulls());
+
+  EXPECT_THROW(cudf::transform(table_view{{a, b}}, cuda, {}, false, true), cudf::logic_error);
+}
+
 }  // namespace transformation
 }  // namespace test
 }  // namespace cudf
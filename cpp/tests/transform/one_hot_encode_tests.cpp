@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,6 +15,7 @@
  */
 
 #include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
@@ -197,5 +198,42 @@ TEST_F(OneHotEncodingTest, MismatchTypes)
   EXPECT_THROW(one_hot_encode(input, category), cudf::logic_error);
 }
 
+TEST_F(OneHotEncodingTest, Sparse)
+{
+  using LCW     = lists_column_wrapper<size_type>;
+  auto input    = strings_column_wrapper{{"a", "c", "", "c", "b"}, {1, 1, 0, 1, 1}};
+  auto category = strings_column_wrapper{{"c", ""}, {1, 0}};
+
+  auto const expected = LCW{LCW{}, LCW{0}, LCW{1}, LCW{0}, LCW{}};
+  auto const got      = one_hot_encode_sparse(input, category);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+}
+
+TEST_F(OneHotEncodingTest, SparseMatchesDense)
+{
+  using LCW     = lists_column_wrapper<size_type>;
+  auto input    = fixed_width_column_wrapper<int32_t>{8, 3, 5, 3, 0, 8, 1};
+  auto category = fixed_width_column_wrapper<int32_t>{8, 1, 5, 3, 3};
+
+  // Duplicated categories are listed in their original order
+  auto const expected = LCW{LCW{0}, LCW{3, 4}, LCW{2}, LCW{3, 4}, LCW{}, LCW{0}, LCW{1}};
+  auto const got      = one_hot_encode_sparse(input, category);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+}
+
+TEST_F(OneHotEncodingTest, SparseEmpty)
+{
+  auto input    = fixed_width_column_wrapper<int32_t>{};
+  auto category = fixed_width_column_wrapper<int32_t>{1, 2};
+  EXPECT_EQ(one_hot_encode_sparse(input, category)->size(), 0);
+
+  using LCW          = lists_column_wrapper<size_type>;
+  auto values        = fixed_width_column_wrapper<int32_t>{1, 2};
+  auto no_categories = fixed_width_column_wrapper<int32_t>{};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(LCW({LCW{}, LCW{}}),
+                                 one_hot_encode_sparse(values, no_categories)->view());
+  EXPECT_THROW(one_hot_encode_sparse(values, strings_column_wrapper{"a"}), cudf::logic_error);
+}
+
 }  // namespace test
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -724,3 +724,48 @@ TEST_F(RowBitCount, EmptyTable)
     CUDF_EXPECTS(result != nullptr && result->size() == 0, "Expected an empty column");
   }
 }
+
+TEST_F(RowBitCount, MakeBatches)
+{
+  using splits = std::vector<size_type>;
+
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{1, 2, 3, 4, 5};
+  table_view t({ints});
+  EXPECT_EQ(cudf::make_batches(t, 8), (splits{2, 4}));
+  EXPECT_EQ(cudf::make_batches(t, 11), (splits{2, 4}));
+  EXPECT_EQ(cudf::make_batches(t, 12), (splits{3}));
+  EXPECT_EQ(cudf::make_batches(t, 20), splits{});
+
+  // a row larger than the batch size is a batch of its own
+  cudf::test::strings_column_wrapper strings{"a", "bbbbbbbbbbbbbbbbbbbb", "c", "d"};
+  EXPECT_EQ(cudf::make_batches(table_view({strings}), 12), (splits{1, 2}));
+  EXPECT_EQ(cudf::make_batches(table_view({strings}), 1), (splits{1, 2, 3}));
+
+  auto const sliced = cudf::slice(t, {1, 5})[0];
+  EXPECT_EQ(cudf::make_batches(sliced, 8), (splits{2}));
+
+  EXPECT_THROW(cudf::make_batches(t, 0), cudf::logic_error);
+}
+
+TEST_F(RowBitCount, MakeBatchesNested)
+{
+  cudf::test::lists_column_wrapper<cudf::string_view> lists{
+    {{"dogs", "yay"}, {"xyz", ""}, {"daïs"}}, {{"fast", "parrot"}, {"orange"}}};
+  cudf::test::fixed_width_column_wrapper<int16_t> c0{1, 2};
+  cudf::test::strings_column_wrapper c1{"banana", "metric"};
+  auto structs = cudf::test::structs_column_wrapper({c0, c1});
+  table_view t({lists, structs});
+
+  // the rows are 408 + 96 and 320 + 96 bits
+  EXPECT_EQ(cudf::make_batches(t, 114), std::vector<size_type>{1});
+  EXPECT_EQ(cudf::make_batches(t, 115), std::vector<size_type>{});
+}
+
+TEST_F(RowBitCount, MakeBatchesEmptyTable)
+{
+  cudf::table_view empty;
+  EXPECT_TRUE(cudf::make_batches(empty, 1).empty());
+
+  auto strings = cudf::make_empty_column(type_id::STRING);
+  EXPECT_TRUE(cudf::make_batches(cudf::table_view({*strings}), 1).empty());
+}
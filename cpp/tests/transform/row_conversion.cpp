@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/row_conversion.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct RowConversionTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+
+std::vector<cudf::data_type> schema_of(cudf::table_view const& tbl)
+{
+  std::vector<cudf::data_type> schema;
+  std::transform(tbl.begin(), tbl.end(), std::back_inserter(schema), [](auto const& c) {
+    return c.type();
+  });
+  return schema;
+}
+
+}  // namespace
+
+TEST_F(RowConversionTest, FixedWidthRoundTrip)
+{
+  auto const num_rows = 1000;
+  auto sequence       = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  auto bytes    = cudf::test::fixed_width_column_wrapper<int8_t>(
+    sequence, sequence + num_rows, validity);
+  auto ints    = cudf::test::fixed_width_column_wrapper<int32_t>(sequence, sequence + num_rows);
+  auto doubles = cudf::test::fixed_width_column_wrapper<double>(
+    sequence, sequence + num_rows, validity);
+  auto shorts = cudf::test::fixed_width_column_wrapper<int16_t>(sequence, sequence + num_rows);
+  auto input  = cudf::table_view{{bytes, ints, doubles, shorts}};
+  auto schema = schema_of(input);
+
+  auto const rows = cudf::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1u);
+  auto const result = cudf::convert_from_rows(cudf::lists_column_view(*rows[0]), schema);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, *result);
+
+  // both conversions lay the rows out the same way
+  auto const optimized_rows = cudf::convert_to_rows_fixed_width_optimized(input);
+  ASSERT_EQ(optimized_rows.size(), 1u);
+  auto const optimized_result = cudf::convert_from_rows_fixed_width_optimized(
+    cudf::lists_column_view(*rows[0]), schema);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, *optimized_result);
+  auto const tiled_result =
+    cudf::convert_from_rows(cudf::lists_column_view(*optimized_rows[0]), schema);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, *tiled_result);
+}
+
+TEST_F(RowConversionTest, StringsRoundTrip)
+{
+  auto ints    = cudf::test::fixed_width_column_wrapper<int32_t>({1, 2, 3, 4, 5, 6},
+                                                              {1, 1, 0, 1, 1, 1});
+  auto strings = cudf::test::strings_column_wrapper(
+    {"", "a", "bcd", "efghijklmnopqrstuvwxyz", "empty", "é"}, {1, 1, 1, 1, 0, 1});
+  auto more_strings = cudf::test::strings_column_wrapper({"1", "22", "333", "", "4444", "55555"});
+  auto doubles      = cudf::test::fixed_width_column_wrapper<double>({1., 2., 3., 4., 5., 6.});
+  auto input        = cudf::table_view{{ints, strings, more_strings, doubles}};
+  auto schema       = schema_of(input);
+
+  auto const rows = cudf::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1u);
+  auto const result = cudf::convert_from_rows(cudf::lists_column_view(*rows[0]), schema);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, *result);
+
+  // the columns of a sliced table are converted from their offsets
+  auto const sliced      = cudf::slice(input, {1, 5})[0];
+  auto const sliced_rows = cudf::convert_to_rows(sliced);
+  auto const sliced_result =
+    cudf::convert_from_rows(cudf::lists_column_view(*sliced_rows[0]), schema);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(sliced, *sliced_result);
+
+  EXPECT_THROW(cudf::convert_to_rows_fixed_width_optimized(input), cudf::logic_error);
+}
+
+TEST_F(RowConversionTest, StringLayout)
+{
+  auto ints    = cudf::test::fixed_width_column_wrapper<int32_t>({7});
+  auto strings = cudf::test::strings_column_wrapper({"abc"});
+  auto input   = cudf::table_view{{ints, strings}};
+
+  auto const rows = cudf::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1u);
+  auto const row = cudf::test::to_host<int8_t>(cudf::lists_column_view(*rows[0]).child()).first;
+
+  // the int, padding, the slot of the string, the validity, the characters and padding
+  ASSERT_EQ(row.size(), 24u);
+  int32_t value;
+  uint32_t slot[2];
+  std::memcpy(&value, row.data(), sizeof(value));
+  std::memcpy(slot, row.data() + 8, sizeof(slot));
+  EXPECT_EQ(value, 7);
+  EXPECT_EQ(slot[0], 17u);
+  EXPECT_EQ(slot[1], 3u);
+  EXPECT_EQ(row[16], 0b11);
+  EXPECT_EQ(std::string(row.data() + 17, row.data() + 20), "abc");
+}
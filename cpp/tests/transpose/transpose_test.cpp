@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/copying.hpp>
 #include <cudf/transpose.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
@@ -99,7 +100,17 @@ auto make_table_view(std::vector<ColumnWrapper> const& cols)
 }
 
 template <typename T>
-void run_test(size_t ncols, size_t nrows, bool add_nulls)
+auto drop_rows(std::vector<std::vector<T>> values, size_t offset)
+{
+  for (auto& col : values) {
+    col.erase(col.begin(), col.begin() + offset);
+  }
+  return values;
+}
+
+// Transposes the `nrows` rows of the input following the first `offset` ones
+template <typename T>
+void run_test(size_t ncols, size_t nrows, bool add_nulls, size_t offset = 0)
 {
   using ColumnWrapper = std::conditional_t<std::is_same_v<T, std::string>,
                                            cudf::test::strings_column_wrapper,
@@ -109,8 +120,8 @@ void run_test(size_t ncols, size_t nrows, bool add_nulls)
 
   // Generate values as vector of vectors
   auto const values = generate_vectors<T>(
-    ncols, nrows, [&rng]() { return cudf::test::make_type_param_scalar<T>(rng()); });
-  auto const valuesT = transpose_vectors(values);
+    ncols, nrows + offset, [&rng]() { return cudf::test::make_type_param_scalar<T>(rng()); });
+  auto const valuesT = transpose_vectors(drop_rows(values, offset));
 
   std::vector<ColumnWrapper> input_cols;
   std::vector<ColumnWrapper> expected_cols;
@@ -119,8 +130,10 @@ void run_test(size_t ncols, size_t nrows, bool add_nulls)
   if (add_nulls) {
     // Generate null mask as vector of vectors
     auto const valids = generate_vectors<cudf::size_type>(
-      ncols, nrows, [&rng]() { return static_cast<cudf::size_type>(rng() % 3 > 0 ? 1 : 0); });
-    auto const validsT = transpose_vectors(valids);
+      ncols, nrows + offset, [&rng]() {
+        return static_cast<cudf::size_type>(rng() % 3 > 0 ? 1 : 0);
+      });
+    auto const validsT = transpose_vectors(drop_rows(valids, offset));
 
     // Compute the null counts over each transposed column
     std::transform(validsT.begin(),
@@ -140,7 +153,13 @@ void run_test(size_t ncols, size_t nrows, bool add_nulls)
   }
 
   // Create table views from column wrappers
-  auto input_view    = make_table_view(input_cols);
+  auto input_view = make_table_view(input_cols);
+  if (offset > 0) {
+    input_view = cudf::slice(input_view,
+                             {static_cast<cudf::size_type>(offset),
+                              static_cast<cudf::size_type>(offset + nrows)})
+                   .front();
+  }
   auto expected_view = make_table_view(expected_cols);
 
   auto result      = transpose(input_view);
@@ -187,6 +206,10 @@ TYPED_TEST(TransposeTest, Fat) { run_test<TypeParam>(1000, 10, false); }
 
 TYPED_TEST(TransposeTest, FatNulls) { run_test<TypeParam>(1000, 10, true); }
 
+TYPED_TEST(TransposeTest, Sliced) { run_test<TypeParam>(100, 100, false, 37); }
+
+TYPED_TEST(TransposeTest, SlicedNulls) { run_test<TypeParam>(100, 100, true, 37); }
+
 TYPED_TEST(TransposeTest, EmptyTable) { run_test<TypeParam>(0, 0, false); }
 
 TYPED_TEST(TransposeTest, EmptyColumns) { run_test<TypeParam>(10, 0, false); }
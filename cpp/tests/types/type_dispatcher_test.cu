@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -86,6 +86,25 @@ TEST_P(IdDispatcherTest, IdToType)
   EXPECT_TRUE(cudf::type_dispatcher(cudf::data_type{t}, verify_dispatched_type{}, t));
 }
 
+TEST_P(IdDispatcherTest, ExcludedIdsThrow)
+{
+  auto const t = GetParam();
+  if (cudf::is_dispatched_type(t)) { return; }
+  EXPECT_THROW(cudf::type_dispatcher(cudf::data_type{t}, verify_dispatched_type{}, t),
+               cudf::logic_error);
+}
+
+TEST_F(DispatcherTest, TypesDispatchedInternallyCannotBeExcluded)
+{
+  static_assert(cudf::is_dispatched_type(cudf::type_id::BOOL8));
+  static_assert(cudf::is_dispatched_type(cudf::type_id::INT8));
+  static_assert(cudf::is_dispatched_type(cudf::type_id::INT32));
+  static_assert(cudf::is_dispatched_type(cudf::type_id::INT64));
+  static_assert(cudf::is_dispatched_type(cudf::type_id::STRING));
+  static_assert(cudf::is_dispatched_type(cudf::type_id::LIST));
+  static_assert(cudf::is_dispatched_type(cudf::type_id::STRUCT));
+}
+
 template <typename T>
 struct TypedDoubleDispatcherTest : public DispatcherTest {
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,13 +19,16 @@
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/unary.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/wrappers/timestamps.hpp>
 
+#include <limits>
 #include <type_traits>
 #include <vector>
 
@@ -1032,3 +1035,91 @@ TEST_F(FixedPointTestSingleType, Int32ToInt64Convert)
 
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
 }
+
+struct CastTableTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(CastTableTest, StringsAndNumbers)
+{
+  using namespace numeric;
+  cudf::test::strings_column_wrapper ints({"12", "-7", "", "x1", "2147483648"}, {1, 1, 0, 1, 1});
+  cudf::test::strings_column_wrapper floats{"1.5", "-2e3", "nan", "1.2.3", "inf"};
+  cudf::test::strings_column_wrapper decimals{"1.25", "-3", "4e1", "1e12", "0.5"};
+  auto const nan = std::numeric_limits<double>::quiet_NaN();
+  cudf::test::fixed_width_column_wrapper<double> doubles{1.9, -1.9, 3e9, nan, 1e300};
+  cudf::test::fixed_width_column_wrapper<int64_t> longs({1L, -1L, 1L << 40, 255L, -129L},
+                                                        {1, 1, 1, 1, 0});
+  auto const input = cudf::table_view{{ints, floats, decimals, doubles, longs, doubles}};
+
+  auto const result = cudf::cast(input,
+                                 {cudf::data_type{cudf::type_id::INT32},
+                                  cudf::data_type{cudf::type_id::FLOAT64},
+                                  make_fixed_point_data_type<decimal32>(-2),
+                                  cudf::data_type{cudf::type_id::INT32},
+                                  cudf::data_type{cudf::type_id::INT8},
+                                  cudf::data_type{cudf::type_id::FLOAT32}},
+                                 cudf::cast_error_policy::NULLIFY);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_ints({12, -7, 0, 0, 0}, {1, 1, 0, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_ints, result->get_column(0));
+  auto const inf = std::numeric_limits<double>::infinity();
+  cudf::test::fixed_width_column_wrapper<double> expected_floats({1.5, -2e3, nan, 0., inf},
+                                                                 {1, 1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_floats, result->get_column(1));
+  cudf::test::fixed_point_column_wrapper<int32_t> expected_decimals(
+    {125, -300, 4000, 0, 50}, {1, 1, 1, 0, 1}, scale_type{-2});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_decimals, result->get_column(2));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_doubles({1, -1, 0, 0, 0},
+                                                                   {1, 1, 0, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_doubles, result->get_column(3));
+  cudf::test::fixed_width_column_wrapper<int8_t> expected_longs({1, -1, 0, 0, 0}, {1, 1, 0, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_longs, result->get_column(4));
+  cudf::test::fixed_width_column_wrapper<float> expected_narrowed({1.9f, -1.9f, 3e9f, NAN, 0.f},
+                                                                  {1, 1, 1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_narrowed, result->get_column(5));
+}
+
+TEST_F(CastTableTest, FailOnError)
+{
+  cudf::test::strings_column_wrapper valid{"1", "2", "3"};
+  cudf::test::strings_column_wrapper invalid({"1", "two", "3"});
+  cudf::test::strings_column_wrapper invalid_nulls({"1", "two", "3"}, {1, 0, 1});
+  auto const type = cudf::data_type{cudf::type_id::INT64};
+
+  EXPECT_THROW(cudf::cast(cudf::table_view{{valid, invalid}}, {type, type}), cudf::logic_error);
+
+  auto const result = cudf::cast(cudf::table_view{{valid, invalid_nulls}}, {type, type});
+  cudf::test::fixed_width_column_wrapper<int64_t> expected{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int64_t> expected_nulls({1, 0, 3}, {1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_nulls, result->get_column(1));
+}
+
+TEST_F(CastTableTest, SlicedAndOtherColumns)
+{
+  cudf::test::strings_column_wrapper strings({"9", "10", "x", "300"}, {1, 1, 1, 0});
+  cudf::test::fixed_width_column_wrapper<int16_t> shorts{1, 2, 3, 4};
+  cudf::test::fixed_width_column_wrapper<bool> bools{true, false, true, false};
+  auto const input  = cudf::slice(cudf::table_view{{strings, shorts, bools}}, {1, 4})[0];
+  auto const result = cudf::cast(input,
+                                 {cudf::data_type{cudf::type_id::UINT8},
+                                  cudf::data_type{cudf::type_id::FLOAT64},
+                                  cudf::data_type{cudf::type_id::INT32}},
+                                 cudf::cast_error_policy::NULLIFY);
+
+  cudf::test::fixed_width_column_wrapper<uint8_t> expected_strings({10, 0, 0}, {1, 0, 0});
+  cudf::test::fixed_width_column_wrapper<double> expected_shorts{2., 3., 4.};
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_bools{0, 1, 0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_strings, result->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_shorts, result->get_column(1));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_bools, result->get_column(2));
+}
+
+TEST_F(CastTableTest, Empty)
+{
+  cudf::test::strings_column_wrapper strings{};
+  auto const result =
+    cudf::cast(cudf::table_view{{strings}}, {cudf::data_type{cudf::type_id::INT32}});
+  EXPECT_EQ(result->num_rows(), 0);
+  EXPECT_EQ(result->get_column(0).type(), cudf::data_type{cudf::type_id::INT32});
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <cudf/detail/utilities/batched_memcpy.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+struct BatchedMemcpyTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(BatchedMemcpyTest, MixedSizesAndAlignments)
+{
+  auto const stream = rmm::cuda_stream_default;
+
+  // small and large buffers, at source and destination offsets of any relative alignment
+  std::vector<std::size_t> const sizes{0, 1, 31, 1000, 4096, 4097, 70000, 5 * 1024 * 1024 + 3};
+  std::vector<std::size_t> const src_offsets{0, 3, 16, 5, 1, 0, 7, 2};
+  std::vector<std::size_t> const dst_offsets{0, 0, 32, 5, 2, 4, 8, 18};
+
+  std::vector<std::size_t> src_starts, dst_starts;
+  std::size_t src_size = 0, dst_size = 0;
+  for (std::size_t i = 0; i < sizes.size(); ++i) {
+    src_starts.push_back(src_size + src_offsets[i]);
+    dst_starts.push_back(dst_size + dst_offsets[i]);
+    src_size = src_starts.back() + sizes[i];
+    dst_size = dst_starts.back() + sizes[i];
+  }
+
+  std::vector<uint8_t> h_src(src_size);
+  std::iota(h_src.begin(), h_src.end(), 0);
+  auto const src = cudf::detail::make_device_uvector_sync(h_src, stream);
+  auto dst = cudf::detail::make_device_uvector_sync(std::vector<uint8_t>(dst_size, 0), stream);
+
+  std::vector<uint8_t const*> src_bufs;
+  std::vector<uint8_t*> dst_bufs;
+  for (std::size_t i = 0; i < sizes.size(); ++i) {
+    src_bufs.push_back(src.data() + src_starts[i]);
+    dst_bufs.push_back(dst.data() + dst_starts[i]);
+  }
+  auto const d_src_bufs = cudf::detail::make_device_uvector_sync(src_bufs, stream);
+  auto const d_dst_bufs = cudf::detail::make_device_uvector_sync(dst_bufs, stream);
+  auto const d_sizes    = cudf::detail::make_device_uvector_sync(sizes, stream);
+  cudf::detail::batched_memcpy(d_dst_bufs, d_src_bufs, d_sizes, stream);
+
+  std::vector<uint8_t> expected(dst_size, 0);
+  for (std::size_t i = 0; i < sizes.size(); ++i) {
+    std::copy(h_src.begin() + src_starts[i],
+              h_src.begin() + src_starts[i] + sizes[i],
+              expected.begin() + dst_starts[i]);
+  }
+  EXPECT_EQ(cudf::detail::make_std_vector_sync(dst, stream), expected);
+}
+
+TEST_F(BatchedMemcpyTest, MismatchedSizes)
+{
+  auto const stream     = rmm::cuda_stream_default;
+  auto const d_src_bufs = cudf::detail::make_device_uvector_sync(
+    std::vector<uint8_t const*>{nullptr, nullptr}, stream);
+  auto const d_dst_bufs =
+    cudf::detail::make_device_uvector_sync(std::vector<uint8_t*>{nullptr}, stream);
+  auto const d_sizes = cudf::detail::make_device_uvector_sync(std::vector<std::size_t>{0}, stream);
+  EXPECT_THROW(cudf::detail::batched_memcpy(d_dst_bufs, d_src_bufs, d_sizes, stream),
+               cudf::logic_error);
+}
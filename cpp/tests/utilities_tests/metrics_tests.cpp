@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/metrics.hpp>
+
+#include <rmm/cuda_stream.hpp>
+
+#include <algorithm>
+
+struct MetricsTest : public cudf::test::BaseFixture {
+  void SetUp() override
+  {
+    _was_enabled = cudf::metrics::is_enabled();
+    cudf::metrics::reset();
+  }
+
+  void TearDown() override
+  {
+    cudf::metrics::set_enabled(_was_enabled);
+    cudf::metrics::reset();
+  }
+
+  static cudf::metrics::api_metrics find(std::string const& name)
+  {
+    auto const metrics = cudf::metrics::snapshot();
+    auto const it      = std::find_if(
+      metrics.begin(), metrics.end(), [&name](auto const& m) { return m.name == name; });
+    return it == metrics.end() ? cudf::metrics::api_metrics{name} : *it;
+  }
+
+ private:
+  bool _was_enabled{false};
+};
+
+TEST_F(MetricsTest, RecordsCallsBytesAndTime)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> source{1, 2, 3, 4};
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map{3, 0};
+  auto const input = cudf::table_view{{source}};
+  rmm::cuda_stream stream;
+
+  cudf::metrics::set_enabled(true);
+  cudf::gather(input, gather_map, cudf::out_of_bounds_policy::DONT_CHECK, stream.view());
+  cudf::gather(input, gather_map, cudf::out_of_bounds_policy::DONT_CHECK, stream.view());
+  stream.synchronize();
+
+  auto const gather = find("gather");
+  EXPECT_EQ(gather.calls, 2u);
+  EXPECT_EQ(gather.timed_calls, 2u);
+  EXPECT_GE(gather.gpu_time_ms, 0.0);
+  EXPECT_EQ(gather.bytes, 2 * cudf::detail::make_range_payload(input).bytes);
+}
+
+TEST_F(MetricsTest, DisabledRecordsNothing)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> source{1, 2, 3, 4};
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map{3, 0};
+
+  cudf::metrics::set_enabled(false);
+  cudf::gather(cudf::table_view{{source}}, gather_map);
+  EXPECT_TRUE(cudf::metrics::snapshot().empty());
+}
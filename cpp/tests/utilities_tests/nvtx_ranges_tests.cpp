@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/table_view.hpp>
+
+struct NvtxRangesTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(NvtxRangesTest, FixedWidthPayload)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> col{{1, 2, 3, 4}, {1, 0, 1, 1}};
+  auto const payload = cudf::detail::make_range_payload(cudf::column_view{col});
+  EXPECT_EQ(payload.rows, 4);
+  auto const expected = 4 * sizeof(int64_t) + cudf::bitmask_allocation_size_bytes(4);
+  EXPECT_EQ(payload.bytes, static_cast<int64_t>(expected));
+}
+
+TEST_F(NvtxRangesTest, TablePayloadIncludesChildren)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{1, 2, 3};
+  cudf::test::strings_column_wrapper strings{"a", "bc", "def"};
+  auto const payload = cudf::detail::make_range_payload(cudf::table_view{{ints, strings}});
+  EXPECT_EQ(payload.rows, 3);
+  // the offsets and chars children of the strings column
+  auto const expected = 3 * sizeof(int32_t) + 4 * sizeof(cudf::offset_type) + 6;
+  EXPECT_EQ(payload.bytes, static_cast<int64_t>(expected));
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/utilities/stream_capture.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream.hpp>
+#include <rmm/mr/device/cuda_async_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+struct StreamCaptureTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(StreamCaptureTest, DefaultStreamIsNotCapturing)
+{
+  EXPECT_FALSE(cudf::detail::is_capturing(rmm::cuda_stream_default));
+  rmm::cuda_stream stream;
+  EXPECT_FALSE(cudf::detail::is_capturing(stream.view()));
+}
+
+TEST_F(StreamCaptureTest, ReplaysCapturedPipeline)
+{
+  using T = int32_t;
+  cudf::test::fixed_width_column_wrapper<T> lhs{{1, 2, 3, 4, 5}, {1, 1, 0, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<T> rhs{{10, 20, 30, 40, 50}, {1, 0, 1, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<T> gather_map{4, 3, 1, 0};
+  auto const offset = cudf::numeric_scalar<T>(100);
+  auto two          = cudf::numeric_scalar<T>(2);
+  auto const type   = cudf::data_type{cudf::type_to_id<T>()};
+
+  auto const column_ref = cudf::ast::column_reference(0);
+  auto const literal    = cudf::ast::literal(two);
+  auto const product    = cudf::ast::operation(cudf::ast::ast_operator::MUL, column_ref, literal);
+
+  // The memory allocated while capturing must outlive the captured calls
+  rmm::mr::cuda_async_memory_resource async_mr;
+  auto const previous_mr = rmm::mr::set_current_device_resource(&async_mr);
+  rmm::cuda_stream stream;
+
+  std::unique_ptr<cudf::column> sum;
+  std::unique_ptr<cudf::column> shifted;
+  std::unique_ptr<cudf::table> gathered;
+  std::unique_ptr<cudf::column> doubled;
+  cudaGraph_t graph;
+  CUDA_TRY(cudaStreamBeginCapture(stream.value(), cudaStreamCaptureModeRelaxed));
+  EXPECT_TRUE(cudf::detail::is_capturing(stream.view()));
+  sum      = cudf::binary_operation(lhs, rhs, cudf::binary_operator::ADD, type, stream.view());
+  shifted  = cudf::binary_operation(*sum, offset, cudf::binary_operator::ADD, type, stream.view());
+  gathered = cudf::gather(cudf::table_view{{*shifted}},
+                          gather_map,
+                          cudf::out_of_bounds_policy::DONT_CHECK,
+                          stream.view());
+  doubled  = cudf::compute_column(cudf::table_view{{lhs}}, product, stream.view());
+  CUDA_TRY(cudaStreamEndCapture(stream.value(), &graph));
+
+  cudaGraphExec_t graph_exec;
+  CUDA_TRY(cudaGraphInstantiate(&graph_exec, graph, nullptr, nullptr, 0));
+  CUDA_TRY(cudaGraphLaunch(graph_exec, stream.value()));
+  stream.synchronize();
+
+  // The null counts deferred while capturing are computed from the masks written by the graph
+  EXPECT_EQ(sum->null_count(), 2);
+  cudf::test::fixed_width_column_wrapper<T> expected_gathered{{155, 144, 0, 111}, {1, 1, 0, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(gathered->get_column(0), expected_gathered);
+  cudf::test::fixed_width_column_wrapper<T> expected_doubled{{2, 4, 0, 8, 10}, {1, 1, 0, 1, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*doubled, expected_doubled);
+
+  CUDA_TRY(cudaGraphExecDestroy(graph_exec));
+  CUDA_TRY(cudaGraphDestroy(graph));
+  sum.reset();
+  shifted.reset();
+  gathered.reset();
+  doubled.reset();
+  stream.synchronize();
+  rmm::mr::set_current_device_resource(previous_mr);
+}
+
+TEST_F(StreamCaptureTest, ApplyBooleanMaskIsNotCapturable)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<bool> mask{true, false, true};
+  rmm::cuda_stream stream;
+
+  cudaGraph_t graph;
+  CUDA_TRY(cudaStreamBeginCapture(stream.value(), cudaStreamCaptureModeRelaxed));
+  EXPECT_THROW(cudf::apply_boolean_mask(cudf::table_view{{input}}, mask, stream.view()),
+               cudf::logic_error);
+  CUDA_TRY(cudaStreamEndCapture(stream.value(), &graph));
+  CUDA_TRY(cudaGraphDestroy(graph));
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <cudf/detail/utilities/temporary_arena.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+
+#include <rmm/cuda_stream.hpp>
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+struct TemporaryArenaTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(TemporaryArenaTest, BumpsAllocationsFromBlocks)
+{
+  auto const stream = rmm::cuda_stream_default;
+  cudf::detail::temporary_arena arena{stream, 4096};
+  EXPECT_EQ(arena.reserved_bytes(), 0u);
+
+  rmm::device_buffer first(100, stream, &arena);
+  EXPECT_EQ(arena.reserved_bytes(), 4096u);
+  auto const second_ptr = [&] {
+    rmm::device_buffer second(200, stream, &arena);
+    EXPECT_EQ(static_cast<char*>(second.data()), static_cast<char*>(first.data()) + 256);
+    return second.data();
+  }();
+  // The released most recent allocation is reused
+  rmm::device_buffer third(200, stream, &arena);
+  EXPECT_EQ(third.data(), second_ptr);
+
+  // A new block is allocated once the current one is full
+  rmm::device_buffer large(10000, stream, &arena);
+  EXPECT_EQ(arena.reserved_bytes(), 4096u + 10240u);
+
+  std::vector<int32_t> h_values(5000);
+  std::iota(h_values.begin(), h_values.end(), 0);
+  auto const d_values = cudf::detail::make_device_uvector_sync(h_values, stream, &arena);
+  EXPECT_EQ(cudf::detail::make_std_vector_sync(d_values, stream), h_values);
+}
+
+TEST_F(TemporaryArenaTest, OtherStreamsUseUpstream)
+{
+  rmm::cuda_stream other;
+  cudf::detail::temporary_arena arena{rmm::cuda_stream_default, 4096};
+
+  rmm::device_buffer buffer(100, other.view(), &arena);
+  EXPECT_NE(buffer.data(), nullptr);
+  EXPECT_EQ(arena.reserved_bytes(), 0u);
+  other.synchronize();
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file cudf_jit_precompile.cpp
+ * @brief Compiles JIT kernels into the libcudf file cache, e.g. when building a container image.
+ *
+ * Usage: cudf_jit_precompile <cache directory> <manifest>...
+ *
+ * Each line of a manifest is a kernel signature, and `#` starts a comment:
+ *
+ *     transform INT32 FLOAT64 cuda udfs/scale.cu
+ *     binary_operation INT64,INT64 INT64 ptx udfs/add.ptx
+ *
+ * The fields are the API that compiles the kernel, the comma-separated input types, the output
+ * type, the language of the user-defined function and the path of its source, relative to the
+ * manifest. The kernels are compiled for the current device.
+ *
+ * The kernels are compiled into a staging directory next to the cache directory, whose files are
+ * then renamed into the cache directory. Each rename is atomic, so that the processes reading the
+ * cache directory at the same time never see partially written files.
+ */
+
+#include <cudf/jit/precompile.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <unistd.h>
+
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+cudf::data_type parse_type(std::string const& name)
+{
+  static std::map<std::string, cudf::type_id> const types{
+    {"INT8", cudf::type_id::INT8},
+    {"INT16", cudf::type_id::INT16},
+    {"INT32", cudf::type_id::INT32},
+    {"INT64", cudf::type_id::INT64},
+    {"UINT8", cudf::type_id::UINT8},
+    {"UINT16", cudf::type_id::UINT16},
+    {"UINT32", cudf::type_id::UINT32},
+    {"UINT64", cudf::type_id::UINT64},
+    {"FLOAT32", cudf::type_id::FLOAT32},
+    {"FLOAT64", cudf::type_id::FLOAT64},
+    {"BOOL8", cudf::type_id::BOOL8},
+    {"TIMESTAMP_DAYS", cudf::type_id::TIMESTAMP_DAYS},
+    {"TIMESTAMP_SECONDS", cudf::type_id::TIMESTAMP_SECONDS},
+    {"TIMESTAMP_MILLISECONDS", cudf::type_id::TIMESTAMP_MILLISECONDS},
+    {"TIMESTAMP_MICROSECONDS", cudf::type_id::TIMESTAMP_MICROSECONDS},
+    {"TIMESTAMP_NANOSECONDS", cudf::type_id::TIMESTAMP_NANOSECONDS},
+    {"DURATION_DAYS", cudf::type_id::DURATION_DAYS},
+    {"DURATION_SECONDS", cudf::type_id::DURATION_SECONDS},
+    {"DURATION_MILLISECONDS", cudf::type_id::DURATION_MILLISECONDS},
+    {"DURATION_MICROSECONDS", cudf::type_id::DURATION_MICROSECONDS},
+    {"DURATION_NANOSECONDS", cudf::type_id::DURATION_NANOSECONDS}};
+  auto const type = types.find(name);
+  CUDF_EXPECTS(type != types.end(), "Unsupported type " + name);
+  return cudf::data_type{type->second};
+}
+
+std::string read_file(std::filesystem::path const& path)
+{
+  std::ifstream file{path};
+  CUDF_EXPECTS(file.good(), "Unable to read " + path.string());
+  std::stringstream contents;
+  contents << file.rdbuf();
+  return contents.str();
+}
+
+std::vector<cudf::jit::kernel_signature> read_manifest(std::filesystem::path const& path)
+{
+  std::ifstream manifest{path};
+  CUDF_EXPECTS(manifest.good(), "Unable to read " + path.string());
+  std::vector<cudf::jit::kernel_signature> kernels;
+  std::string line;
+  while (std::getline(manifest, line)) {
+    line = line.substr(0, line.find('#'));
+    std::istringstream fields{line};
+    std::string kind, input_types, output_type, language, udf_path;
+    if (!(fields >> kind)) { continue; }
+    CUDF_EXPECTS(static_cast<bool>(fields >> input_types >> output_type >> language >> udf_path),
+                 "Incomplete kernel signature: " + line);
+    CUDF_EXPECTS(kind == "transform" || kind == "binary_operation", "Unsupported kind " + kind);
+    CUDF_EXPECTS(language == "ptx" || language == "cuda", "Unsupported language " + language);
+
+    cudf::jit::kernel_signature kernel{};
+    kernel.kind   = kind == "transform" ? cudf::jit::kernel_kind::TRANSFORM
+                                        : cudf::jit::kernel_kind::BINARY_OPERATION;
+    kernel.udf    = read_file(path.parent_path() / udf_path);
+    kernel.is_ptx = language == "ptx";
+    std::istringstream types{input_types};
+    for (std::string type; std::getline(types, type, ',');) {
+      kernel.input_types.push_back(parse_type(type));
+    }
+    kernel.output_type = parse_type(output_type);
+    kernels.push_back(std::move(kernel));
+  }
+  return kernels;
+}
+
+/**
+ * @brief Renames the files of the staging directory into the same paths under the cache directory.
+ */
+void publish(std::filesystem::path const& staging_dir, std::filesystem::path const& cache_dir)
+{
+  for (auto const& entry : std::filesystem::recursive_directory_iterator(staging_dir)) {
+    if (!entry.is_regular_file()) { continue; }
+    auto const target = cache_dir / std::filesystem::relative(entry.path(), staging_dir);
+    std::filesystem::create_directories(target.parent_path());
+    std::filesystem::rename(entry.path(), target);
+  }
+  std::filesystem::remove_all(staging_dir);
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  if (argc < 3) {
+    std::cerr << "Usage: " << argv[0] << " <cache directory> <manifest>..." << std::endl;
+    return EXIT_FAILURE;
+  }
+  auto const cache_dir   = std::filesystem::absolute(argv[1]);
+  auto const staging_dir = std::filesystem::path{cache_dir.string() + ".staging." +
+                                                 std::to_string(::getpid())};
+  try {
+    std::vector<cudf::jit::kernel_signature> kernels;
+    for (int i = 2; i < argc; ++i) {
+      auto manifest_kernels = read_manifest(argv[i]);
+      kernels.insert(kernels.end(), manifest_kernels.begin(), manifest_kernels.end());
+    }
+
+    // libcudf reads the cache path when it first compiles a kernel
+    ::setenv("LIBCUDF_KERNEL_CACHE_PATH", staging_dir.c_str(), 1);
+    cudf::jit::precompile(kernels);
+    if (std::filesystem::exists(staging_dir)) { publish(staging_dir, cache_dir); }
+    std::cout << "Compiled " << kernels.size() << " kernels into " << cache_dir << std::endl;
+  } catch (std::exception const& e) {
+    std::error_code ignored;
+    std::filesystem::remove_all(staging_dir, ignored);
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
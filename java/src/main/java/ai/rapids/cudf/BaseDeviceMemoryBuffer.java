@@ -1,6 +1,6 @@
 /*
  *
- *  Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ *  Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -76,6 +76,7 @@ public abstract class BaseDeviceMemoryBuffer extends MemoryBuffer {
     src.addressOutOfBoundsCheck(src.address + srcOffset, length, "copy range src");
     Cuda.asyncMemcpy(address + destOffset, src.address + srcOffset, length,
         CudaMemcpyKind.HOST_TO_DEVICE, stream);
+    src.releaseOn(stream);
   }
 
   /**
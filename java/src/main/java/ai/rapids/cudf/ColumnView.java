@@ -1,6 +1,6 @@
 /*
  *
- *  Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ *  Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -3944,13 +3944,16 @@ public class ColumnView implements AutoCloseable, BinaryOperable {
      * @param offsets offsets buffer
      * @param nullCount nullCount for the LIST column
      * @param child the host side nested column vector list
+     * @param copy gathers the copies of all the buffers, which fill the returned column once
+     *             they complete
      * @return new ColumnVector of type LIST at the moment
      */
     static ColumnVector createColumnVector(DType type, int rows, HostMemoryBuffer data,
-        HostMemoryBuffer valid, HostMemoryBuffer offsets, Optional<Long> nullCount, List<HostColumnVectorCore> child) {
+        HostMemoryBuffer valid, HostMemoryBuffer offsets, Optional<Long> nullCount,
+        List<HostColumnVectorCore> child, MultiBufferCopy copy) {
       List<NestedColumnVector> devChildren = new ArrayList<>();
       for (HostColumnVectorCore c : child) {
-        devChildren.add(createNewNestedColumnVector(c));
+        devChildren.add(createNewNestedColumnVector(c, copy));
       }
       int mainColRows = rows;
       DType mainColType = type;
@@ -3962,18 +3965,18 @@ public class ColumnView implements AutoCloseable, BinaryOperable {
       if (mainColValid != null) {
         long validLen = getNativeValidPointerSize(mainColRows);
         mainValidDevBuff = DeviceMemoryBuffer.allocate(validLen);
-        mainValidDevBuff.copyFromHostBuffer(mainColValid, 0, validLen);
+        copy.add(mainValidDevBuff, mainColValid, validLen);
       }
       if (data != null) {
         long dataLen = data.length;
         mainDataDevBuff = DeviceMemoryBuffer.allocate(dataLen);
-        mainDataDevBuff.copyFromHostBuffer(data, 0, dataLen);
+        copy.add(mainDataDevBuff, data, dataLen);
       }
       if (mainColOffsets != null) {
         // The offset buffer has (no. of rows + 1) entries, where each entry is INT32.sizeInBytes
         long offsetsLen = OFFSET_SIZE * (mainColRows + 1);
         mainOffsetsDevBuff = DeviceMemoryBuffer.allocate(offsetsLen);
-        mainOffsetsDevBuff.copyFromHostBuffer(mainColOffsets, 0, offsetsLen);
+        copy.add(mainOffsetsDevBuff, mainColOffsets, offsetsLen);
       }
       List<DeviceMemoryBuffer> toClose = new ArrayList<>();
       long[] childHandles = new long[devChildren.size()];
@@ -3988,7 +3991,7 @@ public class ColumnView implements AutoCloseable, BinaryOperable {
     }
 
     private static NestedColumnVector createNewNestedColumnVector(
-        HostColumnVectorCore nestedChildren) {
+        HostColumnVectorCore nestedChildren, MultiBufferCopy copy) {
       if (nestedChildren == null) {
         return null;
       }
@@ -4001,10 +4004,10 @@ public class ColumnView implements AutoCloseable, BinaryOperable {
 
       List<NestedColumnVector> children = new ArrayList<>();
       for (HostColumnVectorCore nhcv : nestedChildren.getNestedChildren()) {
-        children.add(createNewNestedColumnVector(nhcv));
+        children.add(createNewNestedColumnVector(nhcv, copy));
       }
       return createNestedColumnVector(colType, colRows, nullCount, colData, colValid, colOffsets,
-        children);
+        children, copy);
     }
 
     long getViewHandle() {
@@ -4050,7 +4053,7 @@ public class ColumnView implements AutoCloseable, BinaryOperable {
 
     private static NestedColumnVector createNestedColumnVector(DType type, long rows, Optional<Long> nullCount,
         HostMemoryBuffer dataBuffer, HostMemoryBuffer validityBuffer,
-        HostMemoryBuffer offsetBuffer, List<NestedColumnVector> child) {
+        HostMemoryBuffer offsetBuffer, List<NestedColumnVector> child, MultiBufferCopy copy) {
       DeviceMemoryBuffer data = null;
       DeviceMemoryBuffer valid = null;
       DeviceMemoryBuffer offsets = null;
@@ -4066,17 +4069,17 @@ public class ColumnView implements AutoCloseable, BinaryOperable {
           }
         }
         data = DeviceMemoryBuffer.allocate(dataLen);
-        data.copyFromHostBuffer(dataBuffer, 0, dataLen);
+        copy.add(data, dataBuffer, dataLen);
       }
       if (validityBuffer != null) {
         long validLen = getNativeValidPointerSize((int)rows);
         valid = DeviceMemoryBuffer.allocate(validLen);
-        valid.copyFromHostBuffer(validityBuffer, 0, validLen);
+        copy.add(valid, validityBuffer, validLen);
       }
       if (offsetBuffer != null) {
         long offsetsLen = OFFSET_SIZE * (rows + 1);
         offsets = DeviceMemoryBuffer.allocate(offsetsLen);
-        offsets.copyFromHostBuffer(offsetBuffer, 0, offsetsLen);
+        copy.add(offsets, offsetBuffer, offsetsLen);
       }
       NestedColumnVector ret = new NestedColumnVector(type, rows, nullCount, data, valid, offsets,
         child);
@@ -4090,7 +4093,7 @@ public class ColumnView implements AutoCloseable, BinaryOperable {
   /////////////////////////////////////////////////////////////////////////////
 
   private static HostColumnVectorCore copyToHostNestedHelper(
-      ColumnView deviceCvPointer) {
+      ColumnView deviceCvPointer, MultiBufferCopy copy) {
     if (deviceCvPointer == null) {
       return null;
     }
@@ -4111,20 +4114,20 @@ public class ColumnView implements AutoCloseable, BinaryOperable {
       currValidity = deviceCvPointer.getValid();
       if (currData != null) {
         hostData = HostMemoryBuffer.allocate(currData.length);
-        hostData.copyFromDeviceBuffer(currData);
+        copy.add(hostData, currData);
       }
       if (currValidity != null) {
         hostValid = HostMemoryBuffer.allocate(currValidity.length);
-        hostValid.copyFromDeviceBuffer(currValidity);
+        copy.add(hostValid, currValidity);
       }
       if (currOffsets != null) {
         hostOffsets = HostMemoryBuffer.allocate(currOffsets.length);
-        hostOffsets.copyFromDeviceBuffer(currOffsets);
+        copy.add(hostOffsets, currOffsets);
       }
       int numChildren = deviceCvPointer.getNumChildren();
       for (int i = 0; i < numChildren; i++) {
         try(ColumnView childDevPtr = deviceCvPointer.getChildColumnView(i)) {
-          children.add(copyToHostNestedHelper(childDevPtr));
+          children.add(copyToHostNestedHelper(childDevPtr, copy));
         }
       }
       currNullCount = deviceCvPointer.getNullCount();
@@ -4162,87 +4165,124 @@ public class ColumnView implements AutoCloseable, BinaryOperable {
    * Copy the data to the host.
    */
   public HostColumnVector copyToHost() {
+    return copyToHost(new ColumnView[]{this})[0];
+  }
+
+  /**
+   * Copy a set of columns to the host. All the buffers of all the columns are copied by a single
+   * batched copy on the default stream, which is synchronized once when all of them are queued.
+   * @param columns the columns to copy
+   * @return the columns on the host, which must each be closed
+   */
+  public static HostColumnVector[] copyToHost(ColumnView[] columns) {
     try (NvtxRange toHost = new NvtxRange("ensureOnHost", NvtxColor.BLUE)) {
-      HostMemoryBuffer hostDataBuffer = null;
-      HostMemoryBuffer hostValidityBuffer = null;
-      HostMemoryBuffer hostOffsetsBuffer = null;
-      BaseDeviceMemoryBuffer valid = getValid();
-      BaseDeviceMemoryBuffer offsets = getOffsets();
-      BaseDeviceMemoryBuffer data = null;
-      DType type = this.type;
-      long rows = this.rows;
-      if (!type.isNestedType()) {
-        data = getData();
-      }
-      boolean needsCleanup = true;
+      HostColumnVector[] ret = new HostColumnVector[columns.length];
+      MultiBufferCopy copy = new MultiBufferCopy();
+      boolean success = false;
       try {
-        // We don't have a good way to tell if it is cached on the device or recalculate it on
-        // the host for now, so take the hit here.
-        getNullCount();
-        if (!type.isNestedType()) {
-          if (valid != null) {
-            hostValidityBuffer = HostMemoryBuffer.allocate(valid.getLength());
-            hostValidityBuffer.copyFromDeviceBuffer(valid);
-          }
-          if (offsets != null) {
-            hostOffsetsBuffer = HostMemoryBuffer.allocate(offsets.length);
-            hostOffsetsBuffer.copyFromDeviceBuffer(offsets);
-          }
-          // If a strings column is all null values there is no data buffer allocated
-          if (data != null) {
-            hostDataBuffer = HostMemoryBuffer.allocate(data.length);
-            hostDataBuffer.copyFromDeviceBuffer(data);
-          }
-          HostColumnVector ret = new HostColumnVector(type, rows, Optional.of(nullCount),
-              hostDataBuffer, hostValidityBuffer, hostOffsetsBuffer);
-          needsCleanup = false;
-          return ret;
-        } else {
-          if (data != null) {
-            hostDataBuffer = HostMemoryBuffer.allocate(data.length);
-            hostDataBuffer.copyFromDeviceBuffer(data);
-          }
-
-          if (valid != null) {
-            hostValidityBuffer = HostMemoryBuffer.allocate(valid.getLength());
-            hostValidityBuffer.copyFromDeviceBuffer(valid);
-          }
-          if (offsets != null) {
-            hostOffsetsBuffer = HostMemoryBuffer.allocate(offsets.getLength());
-            hostOffsetsBuffer.copyFromDeviceBuffer(offsets);
-          }
-          List<HostColumnVectorCore> children = new ArrayList<>();
-          for (int i = 0; i < getNumChildren(); i++) {
-            try (ColumnView childDevPtr = getChildColumnView(i)) {
-              children.add(copyToHostNestedHelper(childDevPtr));
+        for (int i = 0; i < columns.length; i++) {
+          ret[i] = columns[i].copyToHost(copy);
+        }
+        copy.copyAsync(Cuda.DEFAULT_STREAM);
+        Cuda.DEFAULT_STREAM.sync();
+        success = true;
+        return ret;
+      } finally {
+        if (!success) {
+          for (HostColumnVector hcv : ret) {
+            if (hcv != null) {
+              hcv.close();
             }
           }
-          HostColumnVector ret = new HostColumnVector(type, rows, Optional.of(nullCount),
-              hostDataBuffer, hostValidityBuffer, hostOffsetsBuffer, children);
-          needsCleanup = false;
-          return ret;
         }
-      } finally {
-        if (data != null) {
-          data.close();
+      }
+    }
+  }
+
+  /**
+   * Create the host column, whose buffers are only filled once the copies added to `copy`
+   * complete.
+   */
+  private HostColumnVector copyToHost(MultiBufferCopy copy) {
+    HostMemoryBuffer hostDataBuffer = null;
+    HostMemoryBuffer hostValidityBuffer = null;
+    HostMemoryBuffer hostOffsetsBuffer = null;
+    BaseDeviceMemoryBuffer valid = getValid();
+    BaseDeviceMemoryBuffer offsets = getOffsets();
+    BaseDeviceMemoryBuffer data = null;
+    DType type = this.type;
+    long rows = this.rows;
+    if (!type.isNestedType()) {
+      data = getData();
+    }
+    boolean needsCleanup = true;
+    try {
+      // We don't have a good way to tell if it is cached on the device or recalculate it on
+      // the host for now, so take the hit here.
+      getNullCount();
+      if (!type.isNestedType()) {
+        if (valid != null) {
+          hostValidityBuffer = HostMemoryBuffer.allocate(valid.getLength());
+          copy.add(hostValidityBuffer, valid);
         }
         if (offsets != null) {
-          offsets.close();
+          hostOffsetsBuffer = HostMemoryBuffer.allocate(offsets.length);
+          copy.add(hostOffsetsBuffer, offsets);
         }
+        // If a strings column is all null values there is no data buffer allocated
+        if (data != null) {
+          hostDataBuffer = HostMemoryBuffer.allocate(data.length);
+          copy.add(hostDataBuffer, data);
+        }
+        HostColumnVector ret = new HostColumnVector(type, rows, Optional.of(nullCount),
+            hostDataBuffer, hostValidityBuffer, hostOffsetsBuffer);
+        needsCleanup = false;
+        return ret;
+      } else {
+        if (data != null) {
+          hostDataBuffer = HostMemoryBuffer.allocate(data.length);
+          copy.add(hostDataBuffer, data);
+        }
+
         if (valid != null) {
-          valid.close();
+          hostValidityBuffer = HostMemoryBuffer.allocate(valid.getLength());
+          copy.add(hostValidityBuffer, valid);
         }
-        if (needsCleanup) {
-          if (hostOffsetsBuffer != null) {
-            hostOffsetsBuffer.close();
-          }
-          if (hostDataBuffer != null) {
-            hostDataBuffer.close();
-          }
-          if (hostValidityBuffer != null) {
-            hostValidityBuffer.close();
+        if (offsets != null) {
+          hostOffsetsBuffer = HostMemoryBuffer.allocate(offsets.getLength());
+          copy.add(hostOffsetsBuffer, offsets);
+        }
+        List<HostColumnVectorCore> children = new ArrayList<>();
+        for (int i = 0; i < getNumChildren(); i++) {
+          try (ColumnView childDevPtr = getChildColumnView(i)) {
+            children.add(copyToHostNestedHelper(childDevPtr, copy));
           }
         }
+        HostColumnVector ret = new HostColumnVector(type, rows, Optional.of(nullCount),
+            hostDataBuffer, hostValidityBuffer, hostOffsetsBuffer, children);
+        needsCleanup = false;
+        return ret;
+      }
+    } finally {
+      if (data != null) {
+        data.close();
+      }
+      if (offsets != null) {
+        offsets.close();
+      }
+      if (valid != null) {
+        valid.close();
+      }
+      if (needsCleanup) {
+        if (hostOffsetsBuffer != null) {
+          hostOffsetsBuffer.close();
+        }
+        if (hostDataBuffer != null) {
+          hostDataBuffer.close();
+        }
+        if (hostValidityBuffer != null) {
+          hostValidityBuffer.close();
+        }
       }
     }
   }
@@ -0,0 +1,146 @@
+/*
+ *
+ *  Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+package ai.rapids.cudf;
+
+import ai.rapids.cudf.nvcomp.BatchedCodec;
+
+import java.nio.ByteBuffer;
+
+/**
+ * A contiguous table whose device buffer is compressed with nvcomp, as produced by
+ * {@link Table#contiguousSplitCompressed(BatchedCodec, long, int...)}.
+ * <p>
+ * The compressed buffer holds the compressed size of each chunk of the uncompressed buffer as a
+ * 64-bit integer, followed by the compressed chunks back to back. Every chunk but the last one
+ * is exactly the chunk size before compression.
+ */
+public final class CompressedContiguousTable implements AutoCloseable {
+  private long metadataHandle;
+  private DeviceMemoryBuffer compressedBuffer;
+  private ByteBuffer metadataBuffer = null;
+  private final long uncompressedSize;
+  private final long rowCount;
+  private final BatchedCodec codec;
+  private final long chunkSize;
+
+  // This method is invoked by JNI
+  static CompressedContiguousTable fromCompressedPackedTable(long metadataHandle,
+                                                             long dataAddress,
+                                                             long dataLength,
+                                                             long rmmBufferAddress,
+                                                             long uncompressedSize,
+                                                             long rowCount,
+                                                             int codecId,
+                                                             long chunkSize) {
+    DeviceMemoryBuffer buffer =
+        DeviceMemoryBuffer.fromRmm(dataAddress, dataLength, rmmBufferAddress);
+    return new CompressedContiguousTable(metadataHandle, buffer, uncompressedSize, rowCount,
+        BatchedCodec.fromNativeId(codecId), chunkSize);
+  }
+
+  private CompressedContiguousTable(long metadataHandle, DeviceMemoryBuffer compressedBuffer,
+                                    long uncompressedSize, long rowCount, BatchedCodec codec,
+                                    long chunkSize) {
+    this.metadataHandle = metadataHandle;
+    this.compressedBuffer = compressedBuffer;
+    this.uncompressedSize = uncompressedSize;
+    this.rowCount = rowCount;
+    this.codec = codec;
+    this.chunkSize = chunkSize;
+  }
+
+  /** Returns the number of rows in the table. */
+  public long getRowCount() {
+    return rowCount;
+  }
+
+  /** Get the device buffer holding the compressed table data. */
+  public DeviceMemoryBuffer getCompressedBuffer() {
+    return compressedBuffer;
+  }
+
+  /** Get the size in bytes of the table data once decompressed. */
+  public long getUncompressedSize() {
+    return uncompressedSize;
+  }
+
+  /** Get the codec the table data is compressed with. */
+  public BatchedCodec getCodec() {
+    return codec;
+  }
+
+  /** Get the maximum uncompressed size of the chunks the table data is compressed as. */
+  public long getChunkSize() {
+    return chunkSize;
+  }
+
+  /**
+   * Get the byte buffer containing the host metadata describing the schema and layout of the
+   * table once decompressed.
+   * <p>
+   * NOTE: This is a direct byte buffer that is backed by the underlying native metadata instance
+   *       and therefore is only valid to be used while this instance is valid.
+   */
+  public ByteBuffer getMetadataDirectBuffer() {
+    if (metadataBuffer == null) {
+      metadataBuffer = ContiguousTable.createMetadataDirectBuffer(metadataHandle);
+    }
+    return metadataBuffer.asReadOnlyBuffer();
+  }
+
+  /**
+   * Decompress the table data with a single nvcomp batched call. The decompression has completed
+   * when this returns.
+   * @return the contiguous table, which must be closed independently from this instance
+   */
+  public ContiguousTable decompress() {
+    DeviceMemoryBuffer buffer = DeviceMemoryBuffer.allocate(uncompressedSize);
+    Table table = null;
+    try {
+      decompress(codec.toNativeId(), chunkSize, compressedBuffer.getAddress(),
+          compressedBuffer.getLength(), buffer.getAddress(), buffer.getLength());
+      table = Table.fromPackedTable(getMetadataDirectBuffer(), buffer);
+      return new ContiguousTable(table, buffer);
+    } catch (Throwable t) {
+      if (table != null) {
+        table.close();
+      }
+      buffer.close();
+      throw t;
+    }
+  }
+
+  /** Close the compressed table instance and its underlying resources. */
+  @Override
+  public void close() {
+    if (metadataHandle != 0) {
+      ContiguousTable.closeMetadata(metadataHandle);
+      metadataHandle = 0;
+    }
+
+    if (compressedBuffer != null) {
+      compressedBuffer.close();
+      compressedBuffer = null;
+    }
+  }
+
+  // decompress the compressed table data into a buffer of exactly its uncompressed size
+  private static native void decompress(int codec, long chunkSize, long compressedAddress,
+                                        long compressedSize, long outputAddress, long outputSize);
+}
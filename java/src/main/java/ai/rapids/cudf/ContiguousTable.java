@@ -1,6 +1,6 @@
 /*
  *
- *  Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ *  Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -123,8 +123,8 @@ public final class ContiguousTable implements AutoCloseable {
   private static native long createPackedMetadata(long tableView, long dataAddress, long dataSize);
 
   // create a DirectByteBuffer for the packed table metadata
-  private static native ByteBuffer createMetadataDirectBuffer(long metadataHandle);
+  static native ByteBuffer createMetadataDirectBuffer(long metadataHandle);
 
   // release the native metadata resources for a packed table
-  private static native void closeMetadata(long metadataHandle);
+  static native void closeMetadata(long metadataHandle);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -526,11 +526,13 @@ public class Cuda {
   public static native boolean isPtdsEnabled();
 
   /**
-   * Copy data from multiple device buffer sources to multiple device buffer destinations.
-   * For each buffer to copy there is a corresponding entry in the destination address, source
-   * address, and copy size vectors.
-   * @param destAddrs vector of device destination addresses
-   * @param srcAddrs vector of device source addresses
+   * Copy data from multiple buffer sources to multiple buffer destinations, each of which may be
+   * in host or device memory. For each buffer to copy there is a corresponding entry in the
+   * destination address, source address, and copy size vectors. The copies between device and
+   * pinned host memory are all done by a single batched copy kernel, the others by one
+   * asynchronous memcpy each. The copy is async and may not have completed when this returns.
+   * @param destAddrs vector of destination addresses
+   * @param srcAddrs vector of source addresses
    * @param copySizes vector of copy sizes
    * @param stream CUDA stream to use for the copy
    */
@@ -538,15 +540,14 @@ public class Cuda {
                                           long [] srcAddrs,
                                           long [] copySizes,
                                           Stream stream) {
-    // Temporary sub-par stand-in for a multi-buffer copy CUDA kernel
-    assert(destAddrs.length == srcAddrs.length);
-    assert(copySizes.length == destAddrs.length);
     try (NvtxRange copyRange = new NvtxRange("multiBufferCopyAsync", NvtxColor.CYAN)){
-      for (int i = 0; i < destAddrs.length; i++) {
-        asyncMemcpy(destAddrs[i], srcAddrs[i], copySizes[i], CudaMemcpyKind.DEVICE_TO_DEVICE, stream);
-      }
+      multiBufferCopyAsync(destAddrs, srcAddrs, copySizes, stream.getStream());
     }
   }
+
+  private static native void multiBufferCopyAsync(long[] destAddrs, long[] srcAddrs,
+                                                  long[] copySizes, long stream);
+
   /**
    * Begins an Nsight profiling session, if a profiler is currently attached.
    * @note if a profiler session has a already started, `profilerStart` has
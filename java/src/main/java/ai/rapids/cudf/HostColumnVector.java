@@ -168,10 +168,48 @@ public final class HostColumnVector extends HostColumnVectorCore {
    * Copy the data to the device.
    */
   public ColumnVector copyToDevice() {
+    return copyToDevice(new HostColumnVector[]{this})[0];
+  }
+
+  /**
+   * Copy a set of columns to the device. All the buffers of all the columns are copied by a
+   * single batched copy on the default stream, which is synchronized once when all of them
+   * are queued.
+   * @param columns the columns to copy
+   * @return the columns on the device, which must each be closed
+   */
+  public static ColumnVector[] copyToDevice(HostColumnVector[] columns) {
+    ColumnVector[] ret = new ColumnVector[columns.length];
+    MultiBufferCopy copy = new MultiBufferCopy();
+    boolean success = false;
+    try {
+      for (int i = 0; i < columns.length; i++) {
+        ret[i] = columns[i].copyToDevice(copy);
+      }
+      copy.copyAsync(Cuda.DEFAULT_STREAM);
+      Cuda.DEFAULT_STREAM.sync();
+      success = true;
+      return ret;
+    } finally {
+      if (!success) {
+        for (ColumnVector cv : ret) {
+          if (cv != null) {
+            cv.close();
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Create the device column, whose buffers are only filled once the copies added to `copy`
+   * complete.
+   */
+  private ColumnVector copyToDevice(MultiBufferCopy copy) {
     if (rows == 0) {
       if (type.isNestedType()) {
         return ColumnView.NestedColumnVector.createColumnVector(type, 0,
-                null, null, null, Optional.of(0L), children);
+                null, null, null, Optional.of(0L), children, copy);
       } else {
         return new ColumnVector(type, 0, Optional.of(0L), null, null, null);
       }
@@ -195,20 +233,20 @@ public final class HostColumnVector extends HostColumnVectorCore {
             }
           }
           data = DeviceMemoryBuffer.allocate(dataLen);
-          data.copyFromHostBuffer(hdata, 0, dataLen);
+          copy.add(data, hdata, dataLen);
         }
         HostMemoryBuffer hvalid = this.offHeap.valid;
         if (hvalid != null) {
           long validLen = ColumnView.getNativeValidPointerSize((int) rows);
           valid = DeviceMemoryBuffer.allocate(validLen);
-          valid.copyFromHostBuffer(hvalid, 0, validLen);
+          copy.add(valid, hvalid, validLen);
         }
 
         HostMemoryBuffer hoff = this.offHeap.offsets;
         if (hoff != null) {
           long offsetsLen = OFFSET_SIZE * (rows + 1);
           offsets = DeviceMemoryBuffer.allocate(offsetsLen);
-          offsets.copyFromHostBuffer(hoff, 0, offsetsLen);
+          copy.add(offsets, hoff, offsetsLen);
         }
 
         ColumnVector ret = new ColumnVector(type, rows, nullCount, data, valid, offsets);
@@ -218,7 +256,8 @@ public final class HostColumnVector extends HostColumnVectorCore {
         return ret;
       } else {
         return ColumnView.NestedColumnVector.createColumnVector(
-            type, (int) rows, offHeap.data, offHeap.valid, offHeap.offsets, nullCount, children);
+            type, (int) rows, offHeap.data, offHeap.valid, offHeap.offsets, nullCount, children,
+            copy);
       }
     } finally {
       if (data != null) {
@@ -1,6 +1,6 @@
 /*
  *
- *  Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ *  Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -596,6 +596,20 @@ public class HostMemoryBuffer extends MemoryBuffer {
     assert !deviceMemoryBuffer.closed;
     Cuda.asyncMemcpy(address, deviceMemoryBuffer.address, deviceMemoryBuffer.length,
         CudaMemcpyKind.DEVICE_TO_HOST, stream);
+    releaseOn(stream);
+  }
+
+  /**
+   * Set the stream the memory of this buffer is released on. Pinned memory from the
+   * {@link PinnedMemoryPool} is only reused once the work queued on that stream before the
+   * buffer is closed has completed, so the buffer may be closed while asynchronous copies from or
+   * to it are still in flight. This has no effect on other host memory.
+   * @param stream the stream of the last asynchronous work using this buffer
+   */
+  public final void releaseOn(Cuda.Stream stream) {
+    if (cleaner != null) {
+      cleaner.setReleaseStream(stream);
+    }
   }
 
   /**
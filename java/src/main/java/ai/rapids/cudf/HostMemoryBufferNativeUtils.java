@@ -1,6 +1,6 @@
 /*
  *
- *  Copyright (c) 2020, NVIDIA CORPORATION.
+ *  Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -54,4 +54,42 @@ class HostMemoryBufferNativeUtils {
    * @param length size of the mapped region in bytes
    */
   static native void munmap(long address, long length);
+
+  /**
+   * Create a native pool of pinned host memory whose sections are released in stream order.
+   * @param size size in bytes of the pool
+   * @return handle of the pool
+   */
+  static native long createPinnedPool(long size);
+
+  /**
+   * Allocate a section of a pinned pool, waiting for the pending releases if no free section is
+   * large enough.
+   * @param pool handle of the pool
+   * @param size size in bytes of the section
+   * @return address of the section or 0 if the pool does not have enough memory
+   */
+  static native long pinnedPoolAllocate(long pool, long size);
+
+  /**
+   * Release a section of a pinned pool once the work queued on a stream so far has completed.
+   * @param pool handle of the pool
+   * @param address address of the section
+   * @param size size in bytes the section was allocated with
+   * @param stream handle of the stream
+   */
+  static native void pinnedPoolFree(long pool, long address, long size, long stream);
+
+  /**
+   * Get the number of bytes of a pinned pool that are not allocated.
+   * @param pool handle of the pool
+   * @return the number of bytes, including the sections whose release is still pending
+   */
+  static native long pinnedPoolAvailable(long pool);
+
+  /**
+   * Destroy a pinned pool, waiting for its pending releases.
+   * @param pool handle of the pool
+   */
+  static native void destroyPinnedPool(long pool);
 }
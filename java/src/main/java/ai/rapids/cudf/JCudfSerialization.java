@@ -1,6 +1,6 @@
 /*
  *
- *  Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ *  Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -901,12 +901,9 @@ public class JCudfSerialization {
   }
 
   private static ColumnBufferProvider[] providersFrom(ColumnVector[] columns) {
-    HostColumnVector[] onHost = new HostColumnVector[columns.length];
+    HostColumnVector[] onHost = ColumnView.copyToHost(columns);
     boolean success = false;
     try {
-      for (int i = 0; i < columns.length; i++) {
-        onHost[i] = columns[i].copyToHost();
-      }
       ColumnBufferProvider[] ret = providersFrom(onHost, true);
       success = true;
       return ret;
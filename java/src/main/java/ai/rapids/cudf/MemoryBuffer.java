@@ -1,6 +1,6 @@
 /*
  *
- *  Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ *  Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -36,7 +36,14 @@ abstract public class MemoryBuffer implements AutoCloseable {
   protected final MemoryBufferCleaner cleaner;
   protected final long id;
 
-  public static abstract class MemoryBufferCleaner extends MemoryCleaner.Cleaner{}
+  public static abstract class MemoryBufferCleaner extends MemoryCleaner.Cleaner{
+    /**
+     * Set the stream the memory is released on, for the memory that is released in stream order.
+     * @param stream the stream of the last asynchronous work using the memory
+     */
+    void setReleaseStream(Cuda.Stream stream) {
+    }
+  }
 
   private static final class SlicedBufferCleaner extends MemoryBufferCleaner {
     private MemoryBuffer parent;
@@ -45,6 +52,13 @@ abstract public class MemoryBuffer implements AutoCloseable {
       this.parent = parent;
     }
 
+    @Override
+    synchronized void setReleaseStream(Cuda.Stream stream) {
+      if (parent != null && parent.cleaner != null) {
+        parent.cleaner.setReleaseStream(stream);
+      }
+    }
+
     @Override
     protected synchronized boolean cleanImpl(boolean logErrorIfNotClean) {
       if (parent != null) {
@@ -0,0 +1,87 @@
+/*
+ *
+ *  Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+package ai.rapids.cudf;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+/**
+ * Gathers the copies of many buffers between the host and the device, to queue them all with a
+ * single call to {@link Cuda#multiBufferCopyAsync(long[], long[], long[], Cuda.Stream)}.
+ */
+final class MultiBufferCopy {
+  private long[] destAddrs = new long[16];
+  private long[] srcAddrs = new long[16];
+  private long[] copySizes = new long[16];
+  private int numCopies = 0;
+  private final List<HostMemoryBuffer> hostBuffers = new ArrayList<>();
+
+  /**
+   * Add the copy of the start of a host buffer to a device buffer.
+   * @param dest buffer to copy to
+   * @param src buffer to copy from
+   * @param length how many bytes to copy
+   */
+  void add(BaseDeviceMemoryBuffer dest, HostMemoryBuffer src, long length) {
+    dest.addressOutOfBoundsCheck(dest.address, length, "copy range dest");
+    src.addressOutOfBoundsCheck(src.address, length, "copy range src");
+    add(dest.address, src.address, length);
+    hostBuffers.add(src);
+  }
+
+  /**
+   * Add the copy of a device buffer to the start of a host buffer.
+   * @param dest buffer to copy to
+   * @param src buffer to copy from
+   */
+  void add(HostMemoryBuffer dest, BaseDeviceMemoryBuffer src) {
+    dest.addressOutOfBoundsCheck(dest.address, src.length, "copy range dest");
+    add(dest.address, src.address, src.length);
+    hostBuffers.add(dest);
+  }
+
+  private void add(long destAddr, long srcAddr, long length) {
+    if (numCopies == copySizes.length) {
+      int newLength = numCopies * 2;
+      destAddrs = Arrays.copyOf(destAddrs, newLength);
+      srcAddrs = Arrays.copyOf(srcAddrs, newLength);
+      copySizes = Arrays.copyOf(copySizes, newLength);
+    }
+    destAddrs[numCopies] = destAddr;
+    srcAddrs[numCopies] = srcAddr;
+    copySizes[numCopies] = length;
+    numCopies++;
+  }
+
+  /**
+   * Queue all the copies on a stream. The host buffers of the copies are released on that
+   * stream, so they may be closed before the copies complete.
+   * @param stream CUDA stream to use for the copies
+   */
+  void copyAsync(Cuda.Stream stream) {
+    if (numCopies > 0) {
+      Cuda.multiBufferCopyAsync(Arrays.copyOf(destAddrs, numCopies),
+          Arrays.copyOf(srcAddrs, numCopies), Arrays.copyOf(copySizes, numCopies), stream);
+    }
+    for (HostMemoryBuffer buffer : hostBuffers) {
+      buffer.releaseOn(stream);
+    }
+  }
+}
@@ -22,108 +22,56 @@ package ai.rapids.cudf;
 import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
 
-import java.util.Comparator;
-import java.util.Iterator;
 import java.util.Objects;
-import java.util.Optional;
-import java.util.SortedSet;
-import java.util.TreeSet;
 import java.util.concurrent.ExecutorService;
 import java.util.concurrent.Executors;
 import java.util.concurrent.Future;
 
 /**
  * This provides a pool of pinned memory similar to what RMM does for device memory.
+ * <p>
+ * The memory of a buffer is released in stream order: it is only reused once the work queued on
+ * its release stream before the buffer is closed has completed, so a buffer may be closed while
+ * asynchronous copies from or to it are still in flight. The release stream is set by
+ * {@link HostMemoryBuffer#releaseOn(Cuda.Stream)} and defaults to the default stream.
  */
 public final class PinnedMemoryPool implements AutoCloseable {
   private static final Logger log = LoggerFactory.getLogger(PinnedMemoryPool.class);
-  private static final long ALIGNMENT = 8;
 
   // These static fields should only ever be accessed when class-synchronized.
   // Do NOT use singleton_ directly!  Use the getSingleton accessor instead.
   private static volatile PinnedMemoryPool singleton_ = null;
   private static Future<PinnedMemoryPool> initFuture = null;
 
-  private final long pinnedPoolBase;
-  private final SortedSet<MemorySection> freeHeap = new TreeSet<>(new SortedByAddress());
-  private int numAllocatedSections = 0;
-  private long availableBytes;
+  private final long poolHandle;
 
-  private static class SortedBySize implements Comparator<MemorySection> {
-    @Override
-    public int compare(MemorySection s0, MemorySection s1) {
-      return Long.compare(s0.size, s1.size);
-    }
-  }
-
-  private static class SortedByAddress implements Comparator<MemorySection> {
-    @Override
-    public int compare(MemorySection s0, MemorySection s1) {
-      return Long.compare(s0.baseAddress, s1.baseAddress);
-    }
-  }
-
-  private static class MemorySection {
-    private long baseAddress;
-    private long size;
-
-    MemorySection(long baseAddress, long size) {
-      this.baseAddress = baseAddress;
-      this.size = size;
-    }
-
-    boolean canCombine(MemorySection other) {
-      boolean ret = (other.baseAddress + other.size) == baseAddress ||
-          (baseAddress + size) == other.baseAddress;
-      log.trace("CAN {} COMBINE WITH {} ? {}", this, other, ret);
-      return ret;
-    }
-
-    void combineWith(MemorySection other) {
-      assert canCombine(other);
-      log.trace("COMBINING {} AND {}", this, other);
-      this.baseAddress = Math.min(baseAddress, other.baseAddress);
-      this.size = other.size + this.size;
-      log.trace("COMBINED TO {}\n", this);
-    }
+  static final class PinnedHostBufferCleaner extends MemoryBuffer.MemoryBufferCleaner {
+    private long address;
+    private final long origLength;
+    private long releaseStream = Cuda.DEFAULT_STREAM.getStream();
 
-    MemorySection splitOff(long newSize) {
-      assert this.size > newSize;
-      MemorySection ret = new MemorySection(baseAddress, newSize);
-      this.baseAddress += newSize;
-      this.size -= newSize;
-      return ret;
+    PinnedHostBufferCleaner(long address, long length) {
+      this.address = address;
+      origLength = length;
     }
 
     @Override
-    public String toString() {
-      return "PINNED: " + size + " bytes (0x" + Long.toHexString(baseAddress)
-          + " to 0x" + Long.toHexString(baseAddress + size) + ")";
-    }
-  }
-
-  private static final class PinnedHostBufferCleaner extends MemoryBuffer.MemoryBufferCleaner {
-    private MemorySection section;
-    private final long origLength;
-
-    PinnedHostBufferCleaner(MemorySection section, long length) {
-      this.section = section;
-      origLength = length;
+    synchronized void setReleaseStream(Cuda.Stream stream) {
+      releaseStream = stream.getStream();
     }
 
     @Override
     protected synchronized boolean cleanImpl(boolean logErrorIfNotClean) {
       boolean neededCleanup = false;
-      long origAddress = 0;
-      if (section != null) {
-        origAddress = section.baseAddress;
+      long origAddress = address;
+      if (address != 0) {
         try {
-          PinnedMemoryPool.freeInternal(section);
+          PinnedMemoryPool.freeInternal(address, origLength, releaseStream);
         } finally {
           // Always mark the resource as freed even if an exception is thrown.
           // We cannot know how far it progressed before the exception, and
           // therefore it is unsafe to retry.
-          section = null;
+          address = 0;
         }
         neededCleanup = true;
       }
@@ -136,7 +84,7 @@ public final class PinnedMemoryPool implements AutoCloseable {
 
     @Override
     public boolean isClean() {
-      return section == null;
+      return address == 0;
     }
   }
 
@@ -160,8 +108,8 @@ public final class PinnedMemoryPool implements AutoCloseable {
     return singleton_;
   }
 
-  private static void freeInternal(MemorySection section) {
-    Objects.requireNonNull(getSingleton()).free(section);
+  private static void freeInternal(long address, long length, long stream) {
+    Objects.requireNonNull(getSingleton()).free(address, length, stream);
   }
 
   /**
@@ -228,7 +176,9 @@ public final class PinnedMemoryPool implements AutoCloseable {
 
   /**
    * Factory method to create a host buffer but preferably pointing to pinned memory.
-   * It is not guaranteed that the returned buffer will be pointer to pinned memory.
+   * It is not guaranteed that the returned buffer will be pointer to pinned memory: pageable
+   * memory is only allocated when the pool does not have enough memory even once all the
+   * buffers already closed are released by their streams.
    *
    * @param bytes size in bytes to allocate
    * @return newly created buffer
@@ -260,71 +210,31 @@ public final class PinnedMemoryPool implements AutoCloseable {
       Cuda.setDevice(gpuId);
       Cuda.freeZero();
     }
-    this.pinnedPoolBase = Cuda.hostAllocPinned(poolSize);
-    freeHeap.add(new MemorySection(pinnedPoolBase, poolSize));
-    this.availableBytes = poolSize;
+    this.poolHandle = HostMemoryBufferNativeUtils.createPinnedPool(poolSize);
   }
 
   @Override
   public void close() {
-    assert numAllocatedSections == 0;
-    Cuda.freePinned(pinnedPoolBase);
+    HostMemoryBufferNativeUtils.destroyPinnedPool(poolHandle);
   }
 
-  private synchronized HostMemoryBuffer tryAllocateInternal(long bytes) {
-    if (freeHeap.isEmpty()) {
-      log.debug("No free pinned memory left");
-      return null;
-    }
-    // Align the allocation
-    long alignedBytes = ((bytes + ALIGNMENT - 1) / ALIGNMENT) * ALIGNMENT;
-    Optional<MemorySection> firstFit = freeHeap.stream()
-        .filter(section -> section.size >= alignedBytes)
-        .findFirst();
-    if (!firstFit.isPresent()) {
-      if (log.isDebugEnabled()) {
-        MemorySection largest = freeHeap.stream()
-            .max(new SortedBySize())
-            .orElse(new MemorySection(0, 0));
-        log.debug("Insufficient pinned memory. {} needed, {} found", alignedBytes, largest.size);
-      }
+  private HostMemoryBuffer tryAllocateInternal(long bytes) {
+    long address = HostMemoryBufferNativeUtils.pinnedPoolAllocate(poolHandle, bytes);
+    if (address == 0) {
+      log.debug("Insufficient pinned memory. {} needed", bytes);
       return null;
     }
-    MemorySection first = firstFit.get();
-    log.debug("Allocating {}/{} bytes pinned from {} FREE COUNT {} OUTSTANDING COUNT {}",
-        bytes, alignedBytes, first, freeHeap.size(), numAllocatedSections);
-    freeHeap.remove(first);
-    MemorySection allocated;
-    if (first.size == alignedBytes) {
-      allocated = first;
-    } else {
-      allocated = first.splitOff(alignedBytes);
-      freeHeap.add(first);
-    }
-    numAllocatedSections++;
-    availableBytes -= allocated.size;
-    log.debug("Allocated {} free {} outstanding {}", allocated, freeHeap, numAllocatedSections);
-    return new HostMemoryBuffer(allocated.baseAddress, bytes,
-        new PinnedHostBufferCleaner(allocated, bytes));
+    log.debug("Allocated {} bytes pinned at 0x{}", bytes, Long.toHexString(address));
+    return new HostMemoryBuffer(address, bytes, new PinnedHostBufferCleaner(address, bytes));
   }
 
-  private synchronized void free(MemorySection section) {
-    log.debug("Freeing {} with {} outstanding {}", section, freeHeap, numAllocatedSections);
-    availableBytes += section.size;
-    Iterator<MemorySection> it = freeHeap.iterator();
-    while(it.hasNext()) {
-      MemorySection current = it.next();
-      if (section.canCombine(current)) {
-        it.remove();
-        section.combineWith(current);
-      }
-    }
-    freeHeap.add(section);
-    numAllocatedSections--;
-    log.debug("After freeing {} outstanding {}", freeHeap, numAllocatedSections);
+  private void free(long address, long length, long stream) {
+    log.debug("Freeing {} bytes pinned at 0x{} on stream 0x{}", length,
+        Long.toHexString(address), Long.toHexString(stream));
+    HostMemoryBufferNativeUtils.pinnedPoolFree(poolHandle, address, length, stream);
   }
 
-  private synchronized long getAvailableBytesInternal() {
-    return this.availableBytes;
+  private long getAvailableBytesInternal() {
+    return HostMemoryBufferNativeUtils.pinnedPoolAvailable(poolHandle);
   }
 }
@@ -24,6 +24,7 @@ import ai.rapids.cudf.HostColumnVector.ListType;
 import ai.rapids.cudf.HostColumnVector.StructData;
 import ai.rapids.cudf.HostColumnVector.StructType;
 import ai.rapids.cudf.ast.CompiledExpression;
+import ai.rapids.cudf.nvcomp.BatchedCodec;
 
 import java.io.File;
 import java.math.BigDecimal;
@@ -187,6 +188,9 @@ public final class Table implements AutoCloseable {
 
   private static native ContiguousTable[] contiguousSplit(long inputTable, int[] indices);
 
+  private static native CompressedContiguousTable[] contiguousSplitCompressed(long inputTable,
+      int[] indices, int codec, long chunkSize);
+
   private static native long[] partition(long inputTable, long partitionView,
       int numberOfPartitions, int[] outputOffsets);
 
@@ -1962,6 +1966,21 @@ public final class Table implements AutoCloseable {
     return contiguousSplit(nativeHandle, indices);
   }
 
+  /**
+   * Split a table at given boundaries like {@link #contiguousSplit(int...)}, and compress the
+   * contiguous buffers of all the splits with a single nvcomp batched call. Each buffer is
+   * compressed as independent chunks of at most chunkSize bytes.
+   * @param codec the codec to compress with
+   * @param chunkSize maximum amount of uncompressed data to compress as a single chunk
+   * @param indices A vector of indices where to make the split
+   * @return The compressed tables split at those points. NOTE: It is the responsibility of the
+   * caller to close the result.
+   */
+  public CompressedContiguousTable[] contiguousSplitCompressed(BatchedCodec codec, long chunkSize,
+                                                               int... indices) {
+    return contiguousSplitCompressed(nativeHandle, indices, codec.toNativeId(), chunkSize);
+  }
+
   /**
    * Explodes a list column's elements.
    *
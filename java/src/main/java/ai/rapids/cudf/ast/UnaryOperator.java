@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -48,7 +48,8 @@ public enum UnaryOperator {
   NOT(22),              // Logical Not (!)
   CAST_TO_INT64(23),    // Cast value to int64_t
   CAST_TO_UINT64(24),   // Cast value to uint64_t
-  CAST_TO_FLOAT64(25);  // Cast value to double
+  CAST_TO_FLOAT64(25),  // Cast value to double
+  IS_NULL(26);          // Check if operand is null
 
   private final byte nativeId;
 
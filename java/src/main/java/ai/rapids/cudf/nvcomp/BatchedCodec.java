@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package ai.rapids.cudf.nvcomp;
+
+/**
+ * Enumeration of the codecs of the nvcomp batched compression of contiguous tables.
+ * ZSTD requires the native library to be built against nvcomp 2.4 or later.
+ */
+public enum BatchedCodec {
+  LZ4(0),
+  ZSTD(1);
+
+  private static final BatchedCodec[] codecs = BatchedCodec.values();
+
+  final int nativeId;
+
+  BatchedCodec(int nativeId) {
+    this.nativeId = nativeId;
+  }
+
+  /** Lookup the BatchedCodec that corresponds to the specified native identifier */
+  public static BatchedCodec fromNativeId(int id) {
+    for (BatchedCodec codec : codecs) {
+      if (codec.nativeId == id) {
+        return codec;
+      }
+    }
+    throw new IllegalArgumentException("Unknown batched codec ID: " + id);
+  }
+
+  /** Get the native code identifier for the codec */
+  public final int toNativeId() {
+    return nativeId;
+  }
+}
@@ -147,6 +147,7 @@ cudf::ast::ast_operator jni_to_unary_operator(jbyte jni_op_value) {
     case 23: return cudf::ast::ast_operator::CAST_TO_INT64;
     case 24: return cudf::ast::ast_operator::CAST_TO_UINT64;
     case 25: return cudf::ast::ast_operator::CAST_TO_FLOAT64;
+    case 26: return cudf::ast::ast_operator::IS_NULL;
     default: throw std::invalid_argument("unexpected JNI AST unary operator value");
   }
 }
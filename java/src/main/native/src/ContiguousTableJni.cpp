@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,10 +20,16 @@ namespace {
 
 #define CONTIGUOUS_TABLE_CLASS "ai/rapids/cudf/ContiguousTable"
 #define CONTIGUOUS_TABLE_FACTORY_SIG(param_sig) "(" param_sig ")L" CONTIGUOUS_TABLE_CLASS ";"
+#define COMPRESSED_CONTIGUOUS_TABLE_CLASS "ai/rapids/cudf/CompressedContiguousTable"
+#define COMPRESSED_CONTIGUOUS_TABLE_FACTORY_SIG(param_sig)                                         \
+  "(" param_sig ")L" COMPRESSED_CONTIGUOUS_TABLE_CLASS ";"
 
 jclass Contiguous_table_jclass;
 jmethodID From_packed_table_method;
 
+jclass Compressed_contiguous_table_jclass;
+jmethodID From_compressed_packed_table_method;
+
 } // anonymous namespace
 
 namespace cudf {
@@ -46,6 +52,23 @@ bool cache_contiguous_table_jni(JNIEnv *env) {
   if (Contiguous_table_jclass == nullptr) {
     return false;
   }
+
+  jclass compressed_cls = env->FindClass(COMPRESSED_CONTIGUOUS_TABLE_CLASS);
+  if (compressed_cls == nullptr) {
+    return false;
+  }
+
+  From_compressed_packed_table_method =
+      env->GetStaticMethodID(compressed_cls, "fromCompressedPackedTable",
+                             COMPRESSED_CONTIGUOUS_TABLE_FACTORY_SIG("JJJJJJIJ"));
+  if (From_compressed_packed_table_method == nullptr) {
+    return false;
+  }
+
+  Compressed_contiguous_table_jclass = static_cast<jclass>(env->NewGlobalRef(compressed_cls));
+  if (Compressed_contiguous_table_jclass == nullptr) {
+    return false;
+  }
   return true;
 }
 
@@ -54,6 +77,10 @@ void release_contiguous_table_jni(JNIEnv *env) {
     env->DeleteGlobalRef(Contiguous_table_jclass);
     Contiguous_table_jclass = nullptr;
   }
+  if (Compressed_contiguous_table_jclass != nullptr) {
+    env->DeleteGlobalRef(Compressed_contiguous_table_jclass);
+    Compressed_contiguous_table_jclass = nullptr;
+  }
 }
 
 jobject contiguous_table_from(JNIEnv *env, cudf::packed_columns &split, long row_count) {
@@ -79,6 +106,32 @@ native_jobjectArray<jobject> contiguous_table_array(JNIEnv *env, jsize length) {
       env, env->NewObjectArray(length, Contiguous_table_jclass, nullptr));
 }
 
+jobject compressed_contiguous_table_from(JNIEnv *env, compressed_packed_table &table, int codec,
+                                         std::size_t chunk_size) {
+  jlong metadata_address = reinterpret_cast<jlong>(table.metadata.get());
+  jlong data_address = reinterpret_cast<jlong>(table.compressed_data->data());
+  jlong data_size = static_cast<jlong>(table.compressed_data->size());
+  jlong rmm_buffer_address = reinterpret_cast<jlong>(table.compressed_data.get());
+
+  jobject compressed_table_obj = env->CallStaticObjectMethod(
+      Compressed_contiguous_table_jclass, From_compressed_packed_table_method, metadata_address,
+      data_address, data_size, rmm_buffer_address, static_cast<jlong>(table.uncompressed_size),
+      static_cast<jlong>(table.num_rows), static_cast<jint>(codec),
+      static_cast<jlong>(chunk_size));
+
+  if (compressed_table_obj != nullptr) {
+    table.metadata.release();
+    table.compressed_data.release();
+  }
+
+  return compressed_table_obj;
+}
+
+native_jobjectArray<jobject> compressed_contiguous_table_array(JNIEnv *env, jsize length) {
+  return native_jobjectArray<jobject>(
+      env, env->NewObjectArray(length, Compressed_contiguous_table_jclass, nullptr));
+}
+
 } // namespace jni
 } // namespace cudf
 
@@ -119,4 +172,19 @@ JNIEXPORT void JNICALL Java_ai_rapids_cudf_ContiguousTable_closeMetadata(JNIEnv
   CATCH_STD(env, );
 }
 
+JNIEXPORT void JNICALL Java_ai_rapids_cudf_CompressedContiguousTable_decompress(
+    JNIEnv *env, jclass, jint j_codec, jlong j_chunk_size, jlong j_compressed_addr,
+    jlong j_compressed_size, jlong j_output_addr, jlong j_output_size) {
+  JNI_ARG_CHECK(env, j_chunk_size > 0, "chunk size must be positive", );
+  try {
+    cudf::jni::auto_set_device(env);
+    cudf::jni::decompress_packed_table(
+        j_codec, static_cast<std::size_t>(j_chunk_size),
+        reinterpret_cast<uint8_t const *>(j_compressed_addr),
+        static_cast<std::size_t>(j_compressed_size), reinterpret_cast<uint8_t *>(j_output_addr),
+        static_cast<std::size_t>(j_output_size), rmm::cuda_stream_default);
+  }
+  CATCH_STD(env, );
+}
+
 } // extern "C"
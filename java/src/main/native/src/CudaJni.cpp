@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,7 +14,12 @@
  * limitations under the License.
  */
 
+#include <cstring>
+#include <vector>
+
 #include <cuda_profiler_api.h>
+#include <cudf/detail/utilities/batched_memcpy.hpp>
+#include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
 
 #include "jni_utils.hpp"
@@ -26,6 +31,20 @@ int Cudf_device{cudaInvalidDeviceId};
 
 thread_local int Thread_device = cudaInvalidDeviceId;
 
+/**
+ * Returns whether a kernel can read and write the memory at an address: device and managed
+ * memory, and pinned or registered host memory, but not pageable host memory.
+ */
+bool is_device_accessible(void const *address) {
+  cudaPointerAttributes attributes;
+  if (cudaPointerGetAttributes(&attributes, address) != cudaSuccess) {
+    // older drivers fail on pageable host memory instead of reporting it as unregistered
+    cudaGetLastError();
+    return false;
+  }
+  return attributes.type != cudaMemoryTypeUnregistered;
+}
+
 } // anonymous namespace
 
 namespace cudf {
@@ -50,6 +69,54 @@ void auto_set_device(JNIEnv *env) {
   }
 }
 
+/**
+ * Copies many buffers, each of which may live in host or device memory, on a stream.
+ *
+ * The copies whose buffers a kernel can access are fused into a single batched copy kernel, with
+ * one upload of the addresses and sizes. The copies from or to pageable host memory are each
+ * queued with their own `cudaMemcpyAsync`.
+ */
+void multi_buffer_copy_async(std::vector<uint8_t *> const &dst_addrs,
+                             std::vector<uint8_t const *> const &src_addrs,
+                             std::vector<std::size_t> const &sizes, rmm::cuda_stream_view stream) {
+  std::vector<uint8_t *> batched_dsts;
+  std::vector<uint8_t const *> batched_srcs;
+  std::vector<std::size_t> batched_sizes;
+  for (std::size_t i = 0; i < sizes.size(); ++i) {
+    if (sizes[i] == 0) {
+      continue;
+    }
+    if (is_device_accessible(dst_addrs[i]) && is_device_accessible(src_addrs[i])) {
+      batched_dsts.push_back(dst_addrs[i]);
+      batched_srcs.push_back(src_addrs[i]);
+      batched_sizes.push_back(sizes[i]);
+    } else {
+      CUDA_TRY(cudaMemcpyAsync(dst_addrs[i], src_addrs[i], sizes[i], cudaMemcpyDefault,
+                               stream.value()));
+    }
+  }
+  auto const num_batched = batched_sizes.size();
+  if (num_batched == 1) {
+    CUDA_TRY(cudaMemcpyAsync(batched_dsts[0], batched_srcs[0], batched_sizes[0],
+                             cudaMemcpyDefault, stream.value()));
+  } else if (num_batched > 1) {
+    // the destination addresses, the source addresses and the sizes are all 8 bytes wide, so they
+    // are uploaded back to back in one buffer
+    static_assert(sizeof(uint8_t *) == sizeof(std::size_t), "unexpected pointer size");
+    auto const array_size = num_batched * sizeof(std::size_t);
+    std::vector<uint8_t> arrays(3 * array_size);
+    std::memcpy(arrays.data(), batched_dsts.data(), array_size);
+    std::memcpy(arrays.data() + array_size, batched_srcs.data(), array_size);
+    std::memcpy(arrays.data() + 2 * array_size, batched_sizes.data(), array_size);
+    rmm::device_buffer d_arrays(arrays.data(), arrays.size(), stream);
+    auto const d_data = static_cast<uint8_t *>(d_arrays.data());
+    cudf::detail::batched_memcpy(
+        {reinterpret_cast<uint8_t *const *>(d_data), num_batched},
+        {reinterpret_cast<uint8_t const *const *>(d_data + array_size), num_batched},
+        {reinterpret_cast<std::size_t const *>(d_data + 2 * array_size), num_batched}, stream);
+  }
+}
+
 /** Fills all the bytes in the buffer 'buf' with 'value'. */
 void device_memset_async(JNIEnv *env, rmm::device_buffer &buf, char value) {
   cudaError_t cuda_status = cudaMemsetAsync((void *)buf.data(), value, buf.size());
@@ -349,6 +416,40 @@ JNIEXPORT void JNICALL Java_ai_rapids_cudf_Cuda_asyncMemcpyOnStream(JNIEnv *env,
   CATCH_STD(env, );
 }
 
+JNIEXPORT void JNICALL Java_ai_rapids_cudf_Cuda_multiBufferCopyAsync(JNIEnv *env, jclass,
+                                                                     jlongArray jdst_addrs,
+                                                                     jlongArray jsrc_addrs,
+                                                                     jlongArray jcopy_sizes,
+                                                                     jlong jstream) {
+  JNI_NULL_CHECK(env, jdst_addrs, "dst addresses are null", );
+  JNI_NULL_CHECK(env, jsrc_addrs, "src addresses are null", );
+  JNI_NULL_CHECK(env, jcopy_sizes, "copy sizes are null", );
+  try {
+    cudf::jni::auto_set_device(env);
+    cudf::jni::native_jlongArray dst_addrs(env, jdst_addrs);
+    cudf::jni::native_jlongArray src_addrs(env, jsrc_addrs);
+    cudf::jni::native_jlongArray copy_sizes(env, jcopy_sizes);
+    JNI_ARG_CHECK(env, dst_addrs.size() == src_addrs.size(), "address counts do not match", );
+    JNI_ARG_CHECK(env, copy_sizes.size() == dst_addrs.size(), "size count does not match", );
+    std::vector<uint8_t *> dsts;
+    std::vector<uint8_t const *> srcs;
+    std::vector<std::size_t> sizes;
+    for (int i = 0; i < copy_sizes.size(); ++i) {
+      JNI_ARG_CHECK(env, copy_sizes[i] >= 0, "negative copy size", );
+      if (copy_sizes[i] > 0) {
+        JNI_ARG_CHECK(env, dst_addrs[i] != 0, "dst memory pointer is null", );
+        JNI_ARG_CHECK(env, src_addrs[i] != 0, "src memory pointer is null", );
+      }
+      dsts.push_back(reinterpret_cast<uint8_t *>(dst_addrs[i]));
+      srcs.push_back(reinterpret_cast<uint8_t const *>(src_addrs[i]));
+      sizes.push_back(static_cast<std::size_t>(copy_sizes[i]));
+    }
+    auto stream = reinterpret_cast<cudaStream_t>(jstream);
+    cudf::jni::multi_buffer_copy_async(dsts, srcs, sizes, stream);
+  }
+  CATCH_STD(env, );
+}
+
 JNIEXPORT void JNICALL Java_ai_rapids_cudf_Cuda_profilerStart(JNIEnv *env, jclass clazz) {
   try {
     cudaProfilerStart();
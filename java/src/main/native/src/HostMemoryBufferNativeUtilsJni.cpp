@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,8 +23,186 @@
 #include <sys/mman.h>
 #include <sys/types.h>
 
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <cuda_runtime.h>
+
+#include "cudf_jni_apis.hpp"
 #include "jni_utils.hpp"
 
+namespace {
+
+/**
+ * A pool of pinned host memory whose sections are released in stream order.
+ *
+ * A section freed on a stream is only reused once the work queued on that stream before the free
+ * has completed, so a buffer can be closed as soon as its asynchronous copies are queued. When no
+ * free section is large enough, an allocation waits for the sections still in use by streams
+ * before giving up.
+ */
+class pinned_host_pool {
+public:
+  explicit pinned_host_pool(std::size_t size) {
+    CUDA_TRY(cudaMallocHost(&base, size));
+    free_sections.emplace(reinterpret_cast<std::uintptr_t>(base), size);
+    available = size;
+  }
+
+  pinned_host_pool(pinned_host_pool const &) = delete;
+  pinned_host_pool &operator=(pinned_host_pool const &) = delete;
+
+  ~pinned_host_pool() {
+    // the memory may not be released while a stream still copies from or to it
+    for (auto const &section : pending) {
+      cudaEventSynchronize(section.event);
+      cudaEventDestroy(section.event);
+    }
+    for (auto event : idle_events) {
+      cudaEventDestroy(event);
+    }
+    cudaFreeHost(base);
+  }
+
+  /**
+   * Returns the address of a section of at least `size` bytes, or 0 if the pool does not have
+   * such a section even once all the pending releases complete.
+   */
+  std::uintptr_t allocate(std::size_t size) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto const aligned_size = align(size);
+    if (aligned_size == 0) {
+      // empty sections take no memory from the pool
+      return reinterpret_cast<std::uintptr_t>(base);
+    }
+    reclaim(false);
+    auto address = first_fit(aligned_size);
+    if (address == 0 && !pending.empty()) {
+      reclaim(true);
+      address = first_fit(aligned_size);
+    }
+    if (address != 0) {
+      available -= aligned_size;
+    }
+    return address;
+  }
+
+  /**
+   * Releases a section of `size` bytes once the work queued on `stream` so far has completed.
+   */
+  void deallocate(std::uintptr_t address, std::size_t size, cudaStream_t stream) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto const aligned_size = align(size);
+    if (aligned_size == 0) {
+      return;
+    }
+    auto const event = acquire_event();
+    auto const status = cudaEventRecord(event, stream);
+    if (status != cudaSuccess) {
+      idle_events.push_back(event);
+      CUDA_TRY(status);
+    }
+    pending.push_back({address, aligned_size, event});
+    available += aligned_size;
+  }
+
+  /**
+   * Returns the number of bytes that are not allocated, including the sections whose release is
+   * still pending.
+   */
+  std::size_t available_bytes() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return available;
+  }
+
+private:
+  static constexpr std::size_t alignment = 8;
+
+  static std::size_t align(std::size_t size) {
+    return (size + alignment - 1) / alignment * alignment;
+  }
+
+  struct pending_section {
+    std::uintptr_t address;
+    std::size_t size;
+    cudaEvent_t event;
+  };
+
+  cudaEvent_t acquire_event() {
+    if (!idle_events.empty()) {
+      auto const event = idle_events.back();
+      idle_events.pop_back();
+      return event;
+    }
+    cudaEvent_t event;
+    CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    return event;
+  }
+
+  /**
+   * Moves the pending sections whose streams are done with them back to the free sections,
+   * waiting for all the streams if `wait` is set.
+   */
+  void reclaim(bool wait) {
+    auto it = pending.begin();
+    while (it != pending.end()) {
+      auto const status = wait ? cudaEventSynchronize(it->event) : cudaEventQuery(it->event);
+      if (status == cudaErrorNotReady) {
+        ++it;
+        continue;
+      }
+      CUDA_TRY(status);
+      insert_free(it->address, it->size);
+      idle_events.push_back(it->event);
+      it = pending.erase(it);
+    }
+  }
+
+  std::uintptr_t first_fit(std::size_t size) {
+    for (auto it = free_sections.begin(); it != free_sections.end(); ++it) {
+      if (it->second >= size) {
+        auto const address = it->first;
+        auto const remaining = it->second - size;
+        free_sections.erase(it);
+        if (remaining > 0) {
+          free_sections.emplace(address + size, remaining);
+        }
+        return address;
+      }
+    }
+    return 0;
+  }
+
+  /** Adds a free section, merging it with the free sections around it. */
+  void insert_free(std::uintptr_t address, std::size_t size) {
+    auto next = free_sections.lower_bound(address);
+    if (next != free_sections.end() && address + size == next->first) {
+      size += next->second;
+      next = free_sections.erase(next);
+    }
+    if (next != free_sections.begin()) {
+      auto const prev = std::prev(next);
+      if (prev->first + prev->second == address) {
+        prev->second += size;
+        return;
+      }
+    }
+    free_sections.emplace_hint(next, address, size);
+  }
+
+  void *base = nullptr;
+  std::mutex mutex;
+  std::size_t available = 0;
+  std::map<std::uintptr_t, std::size_t> free_sections;
+  std::vector<pending_section> pending;
+  std::vector<cudaEvent_t> idle_events;
+};
+
+} // anonymous namespace
+
 extern "C" {
 
 JNIEXPORT jobject JNICALL Java_ai_rapids_cudf_HostMemoryBufferNativeUtils_wrapRangeInBuffer(
@@ -71,4 +249,59 @@ JNIEXPORT void JNICALL Java_ai_rapids_cudf_HostMemoryBufferNativeUtils_munmap(JN
   CATCH_STD(env, );
 }
 
+JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_HostMemoryBufferNativeUtils_createPinnedPool(
+    JNIEnv *env, jclass, jlong size) {
+  JNI_ARG_CHECK(env, size > 0, "pool size must be positive", 0);
+  try {
+    cudf::jni::auto_set_device(env);
+    return reinterpret_cast<jlong>(new pinned_host_pool(size));
+  }
+  CATCH_STD(env, 0);
+}
+
+JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_HostMemoryBufferNativeUtils_pinnedPoolAllocate(
+    JNIEnv *env, jclass, jlong pool_handle, jlong size) {
+  JNI_NULL_CHECK(env, pool_handle, "pool is null", 0);
+  JNI_ARG_CHECK(env, size >= 0, "negative allocation size", 0);
+  try {
+    cudf::jni::auto_set_device(env);
+    auto pool = reinterpret_cast<pinned_host_pool *>(pool_handle);
+    return static_cast<jlong>(pool->allocate(size));
+  }
+  CATCH_STD(env, 0);
+}
+
+JNIEXPORT void JNICALL Java_ai_rapids_cudf_HostMemoryBufferNativeUtils_pinnedPoolFree(
+    JNIEnv *env, jclass, jlong pool_handle, jlong address, jlong size, jlong jstream) {
+  JNI_NULL_CHECK(env, pool_handle, "pool is null", );
+  JNI_NULL_CHECK(env, address, "address is null", );
+  JNI_ARG_CHECK(env, size >= 0, "negative allocation size", );
+  try {
+    cudf::jni::auto_set_device(env);
+    auto pool = reinterpret_cast<pinned_host_pool *>(pool_handle);
+    pool->deallocate(static_cast<std::uintptr_t>(address), size,
+                     reinterpret_cast<cudaStream_t>(jstream));
+  }
+  CATCH_STD(env, );
+}
+
+JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_HostMemoryBufferNativeUtils_pinnedPoolAvailable(
+    JNIEnv *env, jclass, jlong pool_handle) {
+  JNI_NULL_CHECK(env, pool_handle, "pool is null", 0);
+  try {
+    auto pool = reinterpret_cast<pinned_host_pool *>(pool_handle);
+    return static_cast<jlong>(pool->available_bytes());
+  }
+  CATCH_STD(env, 0);
+}
+
+JNIEXPORT void JNICALL Java_ai_rapids_cudf_HostMemoryBufferNativeUtils_destroyPinnedPool(
+    JNIEnv *env, jclass, jlong pool_handle) {
+  try {
+    cudf::jni::auto_set_device(env);
+    delete reinterpret_cast<pinned_host_pool *>(pool_handle);
+  }
+  CATCH_STD(env, );
+}
+
 } // extern "C"
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -13,14 +13,28 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
+
 #include <nvcomp.h>
 
 #include <nvcomp/lz4.h>
+#include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 
 #include "check_nvcomp_output_sizes.hpp"
 #include "cudf_jni_apis.hpp"
 
+#define NVCOMP_VERSION_AT_LEAST(major, minor)                                                      \
+  (NVCOMP_MAJOR_VERSION > (major) ||                                                               \
+   (NVCOMP_MAJOR_VERSION == (major) && NVCOMP_MINOR_VERSION >= (minor)))
+
+#if NVCOMP_VERSION_AT_LEAST(2, 4) && __has_include(<nvcomp/zstd.h>)
+#include <nvcomp/zstd.h>
+#define NVCOMP_HAS_ZSTD 1
+#else
+#define NVCOMP_HAS_ZSTD 0
+#endif
+
 namespace {
 
 constexpr char const *NVCOMP_ERROR_CLASS = "ai/rapids/cudf/nvcomp/NvcompException";
@@ -52,8 +66,264 @@ void check_nvcomp_status(JNIEnv *env, nvcompStatus_t status) {
   }
 }
 
+/** The codecs of the batched compression of packed tables, numbered as in `BatchedCodec`. */
+enum class batched_codec { LZ4 = 0, ZSTD = 1 };
+
+batched_codec to_batched_codec(int codec) {
+  switch (codec) {
+    case 0: return batched_codec::LZ4;
+    case 1:
+      CUDF_EXPECTS(NVCOMP_HAS_ZSTD, "ZSTD batched compression requires nvcomp 2.4 or later");
+      return batched_codec::ZSTD;
+    default: CUDF_FAIL("Unknown batched codec");
+  }
+}
+
+std::size_t compress_max_output_chunk_size(batched_codec codec, std::size_t chunk_size) {
+  std::size_t max_output_size = 0;
+  auto status = nvcompErrorNotSupported;
+  switch (codec) {
+    case batched_codec::LZ4:
+      status = nvcompBatchedLZ4CompressGetMaxOutputChunkSize(
+          chunk_size, nvcompBatchedLZ4DefaultOpts, &max_output_size);
+      break;
+    case batched_codec::ZSTD:
+#if NVCOMP_HAS_ZSTD
+      status = nvcompBatchedZstdCompressGetMaxOutputChunkSize(
+          chunk_size, nvcompBatchedZstdDefaultOpts, &max_output_size);
+#endif
+      break;
+  }
+  CUDF_EXPECTS(status == nvcompSuccess, "Unable to get the maximum compressed chunk size");
+  return max_output_size;
+}
+
+std::size_t compress_temp_size(batched_codec codec, std::size_t num_chunks,
+                               std::size_t chunk_size) {
+  std::size_t temp_size = 0;
+  auto status = nvcompErrorNotSupported;
+  switch (codec) {
+    case batched_codec::LZ4:
+      status = nvcompBatchedLZ4CompressGetTempSize(num_chunks, chunk_size,
+                                                   nvcompBatchedLZ4DefaultOpts, &temp_size);
+      break;
+    case batched_codec::ZSTD:
+#if NVCOMP_HAS_ZSTD
+      status = nvcompBatchedZstdCompressGetTempSize(num_chunks, chunk_size,
+                                                    nvcompBatchedZstdDefaultOpts, &temp_size);
+#endif
+      break;
+  }
+  CUDF_EXPECTS(status == nvcompSuccess, "Unable to get the compression scratch size");
+  return temp_size;
+}
+
+nvcompStatus_t compress_async(batched_codec codec, void const *const *in_ptrs,
+                              std::size_t const *in_sizes, std::size_t chunk_size,
+                              std::size_t num_chunks, void *temp_ptr, std::size_t temp_size,
+                              void *const *out_ptrs, std::size_t *out_sizes,
+                              rmm::cuda_stream_view stream) {
+  switch (codec) {
+    case batched_codec::LZ4:
+      return nvcompBatchedLZ4CompressAsync(in_ptrs, in_sizes, chunk_size, num_chunks, temp_ptr,
+                                           temp_size, out_ptrs, out_sizes,
+                                           nvcompBatchedLZ4DefaultOpts, stream.value());
+    case batched_codec::ZSTD:
+#if NVCOMP_HAS_ZSTD
+      return nvcompBatchedZstdCompressAsync(in_ptrs, in_sizes, chunk_size, num_chunks, temp_ptr,
+                                            temp_size, out_ptrs, out_sizes,
+                                            nvcompBatchedZstdDefaultOpts, stream.value());
+#else
+      return nvcompErrorNotSupported;
+#endif
+  }
+  return nvcompErrorNotSupported;
+}
+
+std::size_t decompress_temp_size(batched_codec codec, std::size_t num_chunks,
+                                 std::size_t chunk_size) {
+  std::size_t temp_size = 0;
+  auto status = nvcompErrorNotSupported;
+  switch (codec) {
+    case batched_codec::LZ4:
+      status = nvcompBatchedLZ4DecompressGetTempSize(num_chunks, chunk_size, &temp_size);
+      break;
+    case batched_codec::ZSTD:
+#if NVCOMP_HAS_ZSTD
+      status = nvcompBatchedZstdDecompressGetTempSize(num_chunks, chunk_size, &temp_size);
+#endif
+      break;
+  }
+  CUDF_EXPECTS(status == nvcompSuccess, "Unable to get the decompression scratch size");
+  return temp_size;
+}
+
+nvcompStatus_t decompress_async(batched_codec codec, void const *const *in_ptrs,
+                                std::size_t const *in_sizes, std::size_t const *out_sizes,
+                                std::size_t *actual_out_sizes, std::size_t num_chunks,
+                                void *temp_ptr, std::size_t temp_size, void *const *out_ptrs,
+                                nvcompStatus_t *statuses, rmm::cuda_stream_view stream) {
+  switch (codec) {
+    case batched_codec::LZ4:
+      return nvcompBatchedLZ4DecompressAsync(in_ptrs, in_sizes, out_sizes, actual_out_sizes,
+                                             num_chunks, temp_ptr, temp_size, out_ptrs, statuses,
+                                             stream.value());
+    case batched_codec::ZSTD:
+#if NVCOMP_HAS_ZSTD
+      return nvcompBatchedZstdDecompressAsync(in_ptrs, in_sizes, out_sizes, actual_out_sizes,
+                                              num_chunks, temp_ptr, temp_size, out_ptrs, statuses,
+                                              stream.value());
+#else
+      return nvcompErrorNotSupported;
+#endif
+  }
+  return nvcompErrorNotSupported;
+}
+
 } // anonymous namespace
 
+namespace cudf {
+namespace jni {
+
+std::vector<compressed_packed_table>
+contiguous_split_compressed(cudf::table_view const &input,
+                            std::vector<cudf::size_type> const &splits, int codec_id,
+                            std::size_t chunk_size) {
+  CUDF_EXPECTS(chunk_size > 0, "The chunk size must be positive");
+  auto const codec = to_batched_codec(codec_id);
+  auto const stream = rmm::cuda_stream_default;
+  auto split = cudf::contiguous_split(input, splits);
+  auto const num_parts = split.size();
+
+  // the chunks of each partition follow the chunks of the partitions before it
+  std::vector<std::size_t> first_chunks(num_parts + 1, 0);
+  std::vector<compressed_packed_table> result(num_parts);
+  for (std::size_t p = 0; p < num_parts; ++p) {
+    auto const size = split[p].data.gpu_data ? split[p].data.gpu_data->size() : 0;
+    first_chunks[p + 1] = first_chunks[p] + (size + chunk_size - 1) / chunk_size;
+    result[p].metadata = std::move(split[p].data.metadata_);
+    result[p].uncompressed_size = size;
+    result[p].num_rows = split[p].table.num_rows();
+  }
+  auto const num_chunks = first_chunks.back();
+  if (num_chunks == 0) {
+    for (auto &part : result) {
+      part.compressed_data = std::make_unique<rmm::device_buffer>(0, stream);
+    }
+    return result;
+  }
+
+  // nvcomp writes each chunk to its own slot of the maximum compressed size
+  auto const max_output_size = compress_max_output_chunk_size(codec, chunk_size);
+  rmm::device_buffer slots(num_chunks * max_output_size, stream);
+  auto const slots_data = static_cast<uint8_t *>(slots.data());
+
+  // the input addresses, the output addresses, the input sizes and the output sizes of the
+  // chunks, uploaded at once
+  static_assert(sizeof(void *) == sizeof(std::size_t), "unexpected pointer size");
+  std::vector<std::size_t> args(4 * num_chunks);
+  for (std::size_t p = 0; p < num_parts; ++p) {
+    auto const data =
+        split[p].data.gpu_data ? static_cast<uint8_t const *>(split[p].data.gpu_data->data()) :
+                                 nullptr;
+    for (auto i = first_chunks[p]; i < first_chunks[p + 1]; ++i) {
+      auto const offset = (i - first_chunks[p]) * chunk_size;
+      args[i] = reinterpret_cast<std::size_t>(data + offset);
+      args[num_chunks + i] = reinterpret_cast<std::size_t>(slots_data + i * max_output_size);
+      args[2 * num_chunks + i] = std::min(chunk_size, result[p].uncompressed_size - offset);
+    }
+  }
+  rmm::device_buffer d_args(args.data(), args.size() * sizeof(std::size_t), stream);
+  auto const d_args_data = static_cast<std::size_t *>(d_args.data());
+  auto const d_compressed_sizes = d_args_data + 3 * num_chunks;
+  rmm::device_buffer temp(compress_temp_size(codec, num_chunks, chunk_size), stream);
+  auto const status = compress_async(
+      codec, reinterpret_cast<void const *const *>(d_args_data), d_args_data + 2 * num_chunks,
+      chunk_size, num_chunks, temp.data(), temp.size(),
+      reinterpret_cast<void *const *>(d_args_data + num_chunks), d_compressed_sizes, stream);
+  CUDF_EXPECTS(status == nvcompSuccess, "nvcomp batched compression failed");
+
+  std::vector<std::size_t> compressed_sizes(num_chunks);
+  CUDA_TRY(cudaMemcpyAsync(compressed_sizes.data(), d_compressed_sizes,
+                           num_chunks * sizeof(std::size_t), cudaMemcpyDeviceToHost,
+                           stream.value()));
+  stream.synchronize();
+
+  // each partition is stitched together from the sizes of its chunks and the chunks, by a single
+  // batched copy for all the partitions
+  std::vector<uint8_t *> dst_addrs;
+  std::vector<uint8_t const *> src_addrs;
+  std::vector<std::size_t> copy_sizes;
+  for (std::size_t p = 0; p < num_parts; ++p) {
+    auto const header_size = (first_chunks[p + 1] - first_chunks[p]) * sizeof(std::size_t);
+    auto total_size = header_size;
+    for (auto i = first_chunks[p]; i < first_chunks[p + 1]; ++i) {
+      total_size += compressed_sizes[i];
+    }
+    result[p].compressed_data = std::make_unique<rmm::device_buffer>(total_size, stream);
+    auto const output = static_cast<uint8_t *>(result[p].compressed_data->data());
+    dst_addrs.push_back(output);
+    src_addrs.push_back(reinterpret_cast<uint8_t const *>(d_compressed_sizes + first_chunks[p]));
+    copy_sizes.push_back(header_size);
+    auto offset = header_size;
+    for (auto i = first_chunks[p]; i < first_chunks[p + 1]; ++i) {
+      dst_addrs.push_back(output + offset);
+      src_addrs.push_back(slots_data + i * max_output_size);
+      copy_sizes.push_back(compressed_sizes[i]);
+      offset += compressed_sizes[i];
+    }
+  }
+  multi_buffer_copy_async(dst_addrs, src_addrs, copy_sizes, stream);
+  // the uncompressed partitions and the slots are freed in stream order, after the copies
+  return result;
+}
+
+void decompress_packed_table(int codec_id, std::size_t chunk_size, uint8_t const *compressed,
+                             std::size_t compressed_size, uint8_t *output, std::size_t output_size,
+                             rmm::cuda_stream_view stream) {
+  CUDF_EXPECTS(chunk_size > 0, "The chunk size must be positive");
+  auto const codec = to_batched_codec(codec_id);
+  auto const num_chunks = (output_size + chunk_size - 1) / chunk_size;
+  if (num_chunks == 0) {
+    return;
+  }
+  auto const header_size = num_chunks * sizeof(std::size_t);
+  CUDF_EXPECTS(compressed_size >= header_size, "The compressed data is truncated");
+
+  // the input addresses, the output addresses, the input sizes and the output sizes of the
+  // chunks, whose input sizes are read from the start of the compressed data
+  std::vector<std::size_t> args(4 * num_chunks);
+  CUDA_TRY(cudaMemcpyAsync(args.data() + 2 * num_chunks, compressed, header_size,
+                           cudaMemcpyDeviceToHost, stream.value()));
+  stream.synchronize();
+  auto offset = header_size;
+  for (std::size_t i = 0; i < num_chunks; ++i) {
+    args[i] = reinterpret_cast<std::size_t>(compressed + offset);
+    args[num_chunks + i] = reinterpret_cast<std::size_t>(output + i * chunk_size);
+    args[3 * num_chunks + i] = std::min(chunk_size, output_size - i * chunk_size);
+    offset += args[2 * num_chunks + i];
+  }
+  CUDF_EXPECTS(offset == compressed_size, "The compressed data does not match its chunk sizes");
+
+  rmm::device_buffer d_args(args.data(), args.size() * sizeof(std::size_t), stream);
+  auto const d_args_data = static_cast<std::size_t *>(d_args.data());
+  auto const d_output_sizes = d_args_data + 3 * num_chunks;
+  rmm::device_uvector<std::size_t> actual_output_sizes(num_chunks, stream);
+  rmm::device_uvector<nvcompStatus_t> statuses(num_chunks, stream);
+  rmm::device_buffer temp(decompress_temp_size(codec, num_chunks, chunk_size), stream);
+  auto const status = decompress_async(
+      codec, reinterpret_cast<void const *const *>(d_args_data), d_args_data + 2 * num_chunks,
+      d_output_sizes, actual_output_sizes.data(), num_chunks, temp.data(), temp.size(),
+      reinterpret_cast<void *const *>(d_args_data + num_chunks), statuses.data(), stream);
+  CUDF_EXPECTS(status == nvcompSuccess, "nvcomp batched decompression failed");
+  CUDF_EXPECTS(cudf::java::check_nvcomp_output_sizes(d_output_sizes, actual_output_sizes.data(),
+                                                     num_chunks, stream),
+               "nvcomp decompress output size mismatch");
+}
+
+} // namespace jni
+} // namespace cudf
+
 extern "C" {
 
 JNIEXPORT jboolean JNICALL Java_ai_rapids_cudf_nvcomp_NvcompJni_isLZ4Data(JNIEnv *env, jclass,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,10 @@
 
 #include <cudf/copying.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <rmm/cuda_stream_view.hpp>
+
+#include <memory>
+#include <vector>
 
 #include "jni_utils.hpp"
 
@@ -37,6 +41,48 @@ jobject contiguous_table_from(JNIEnv *env, cudf::packed_columns &split, long row
 
 native_jobjectArray<jobject> contiguous_table_array(JNIEnv *env, jsize length);
 
+/**
+ * The data of a packed table compressed as independent chunks: the compressed size of each chunk
+ * as a 64-bit integer, followed by the compressed chunks back to back.
+ */
+struct compressed_packed_table {
+  std::unique_ptr<cudf::packed_columns::metadata> metadata;
+  std::unique_ptr<rmm::device_buffer> compressed_data;
+  std::size_t uncompressed_size;
+  cudf::size_type num_rows;
+};
+
+jobject compressed_contiguous_table_from(JNIEnv *env, compressed_packed_table &table, int codec,
+                                         std::size_t chunk_size);
+
+native_jobjectArray<jobject> compressed_contiguous_table_array(JNIEnv *env, jsize length);
+
+//
+// nvcomp APIs
+//
+
+/**
+ * Splits a table with `cudf::contiguous_split` and compresses the data of all the partitions
+ * with a single nvcomp batched call, each partition as chunks of at most `chunk_size` bytes.
+ * The compressed data is complete in the order of the default stream.
+ *
+ * @param codec id of the codec, as in `BatchedCodec`
+ */
+std::vector<compressed_packed_table>
+contiguous_split_compressed(cudf::table_view const &input,
+                            std::vector<cudf::size_type> const &splits, int codec,
+                            std::size_t chunk_size);
+
+/**
+ * Decompresses the data of a `compressed_packed_table` into `output`, which must be exactly its
+ * uncompressed size. The decompression has completed when this returns.
+ *
+ * @param codec id of the codec, as in `BatchedCodec`
+ */
+void decompress_packed_table(int codec, std::size_t chunk_size, uint8_t const *compressed,
+                             std::size_t compressed_size, uint8_t *output, std::size_t output_size,
+                             rmm::cuda_stream_view stream);
+
 //
 // HostMemoryBuffer APIs
 //
@@ -77,5 +123,15 @@ void auto_set_device(JNIEnv *env);
  */
 void device_memset_async(JNIEnv *env, rmm::device_buffer &buf, char value);
 
+/**
+ * Copies many buffers, each of which may live in host or device memory, on a stream.
+ *
+ * The copies whose buffers a kernel can access are fused into a single batched copy kernel, and
+ * the copies from or to pageable host memory are each queued with their own `cudaMemcpyAsync`.
+ */
+void multi_buffer_copy_async(std::vector<uint8_t *> const &dst_addrs,
+                             std::vector<uint8_t const *> const &src_addrs,
+                             std::vector<std::size_t> const &sizes, rmm::cuda_stream_view stream);
+
 } // namespace jni
 } // namespace cudf
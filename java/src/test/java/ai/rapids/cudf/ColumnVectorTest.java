@@ -259,6 +259,36 @@ public class ColumnVectorTest extends CudfTestBase {
     }
   }
 
+  @Test
+  void testCopyColumnSet() {
+    HostColumnVector.DataType listType = new HostColumnVector.ListType(true,
+        new HostColumnVector.BasicType(true, DType.INT32));
+    try (ColumnVector ints = ColumnVector.fromBoxedInts(1, null, 3, 4);
+         ColumnVector strings = ColumnVector.fromStrings("a", "bcd", null, "");
+         ColumnVector lists = ColumnVector.fromLists(listType, Arrays.asList(1, 2),
+             null, Arrays.asList(), Arrays.asList(3))) {
+      ColumnView[] columns = new ColumnView[]{ints, strings, lists};
+      HostColumnVector[] onHost = ColumnView.copyToHost(columns);
+      try {
+        assertEquals(3, onHost.length);
+        ColumnVector[] backAgain = HostColumnVector.copyToDevice(onHost);
+        try {
+          for (int i = 0; i < columns.length; i++) {
+            assertColumnsAreEqual(columns[i], backAgain[i]);
+          }
+        } finally {
+          for (ColumnVector cv : backAgain) {
+            cv.close();
+          }
+        }
+      } finally {
+        for (HostColumnVector hcv : onHost) {
+          hcv.close();
+        }
+      }
+    }
+  }
+
   @Test
   void testUTF8StringCreation() {
     try (ColumnVector cv = ColumnVector.fromUTF8Strings(
@@ -1,6 +1,6 @@
 /*
  *
- *  Copyright (c) 2019, NVIDIA CORPORATION.
+ *  Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -131,4 +131,26 @@ class PinnedMemoryPoolTest extends CudfTestBase {
     }
     assertEquals(poolSize, PinnedMemoryPool.getAvailableBytes());
   }
-}
\ No newline at end of file
+
+  @Test
+  void testReleaseInStreamOrder() {
+    final long poolSize = 4 * 1024L;
+    PinnedMemoryPool.initialize(poolSize);
+    try (Cuda.Stream stream = new Cuda.Stream(true);
+         DeviceMemoryBuffer device = DeviceMemoryBuffer.allocate(poolSize)) {
+      HostMemoryBuffer host = PinnedMemoryPool.tryAllocate(poolSize);
+      assertNotNull(host);
+      host.setMemory(0, poolSize, (byte) 7);
+      device.copyFromHostBufferAsync(host, stream);
+      // the memory is counted as available, and only reused once the copy completes
+      host.close();
+      assertEquals(poolSize, PinnedMemoryPool.getAvailableBytes());
+      try (HostMemoryBuffer reused = PinnedMemoryPool.tryAllocate(poolSize)) {
+        assertNotNull(reused);
+        reused.copyFromDeviceBuffer(device);
+        assertEquals(7, reused.getByte(poolSize - 1));
+      }
+    }
+    assertEquals(poolSize, PinnedMemoryPool.getAvailableBytes());
+  }
+}
@@ -30,6 +30,7 @@ import ai.rapids.cudf.ast.BinaryOperator;
 import ai.rapids.cudf.ast.ColumnReference;
 import ai.rapids.cudf.ast.CompiledExpression;
 import ai.rapids.cudf.ast.TableReference;
+import ai.rapids.cudf.nvcomp.BatchedCodec;
 import com.google.common.collect.Lists;
 import com.google.common.collect.Maps;
 import org.apache.hadoop.conf.Configuration;
@@ -3086,6 +3087,41 @@ public class TableTest extends CudfTestBase {
     }
   }
 
+  @Test
+  void testContiguousSplitCompressed() {
+    ContiguousTable[] expected = null;
+    CompressedContiguousTable[] splits = null;
+    try (Table t1 = new Table.TestBuilder()
+        .column(10, 12, 14, 16, 18, 20, 22, 24, null, 28)
+        .column("A", "B", "C", "D", "E", "F", "G", "H", "I", "J")
+        .decimal64Column(-8, 50L, 52L, 54L, 56L, 58L, 60L, 62L, 64L, 66L, null)
+        .build()) {
+      expected = t1.contiguousSplit(2, 5, 9);
+      // a small chunk size so the partitions are compressed as several chunks
+      splits = t1.contiguousSplitCompressed(BatchedCodec.LZ4, 16, 2, 5, 9);
+      assertEquals(4, splits.length);
+      for (int i = 0; i < splits.length; i++) {
+        assertEquals(BatchedCodec.LZ4, splits[i].getCodec());
+        assertEquals(expected[i].getRowCount(), splits[i].getRowCount());
+        assertEquals(expected[i].getBuffer().getLength(), splits[i].getUncompressedSize());
+        try (ContiguousTable decompressed = splits[i].decompress()) {
+          assertTablesAreEqual(expected[i].getTable(), decompressed.getTable());
+        }
+      }
+    } finally {
+      if (expected != null) {
+        for (ContiguousTable ct : expected) {
+          ct.close();
+        }
+      }
+      if (splits != null) {
+        for (CompressedContiguousTable ct : splits) {
+          ct.close();
+        }
+      }
+    }
+  }
+
   @Test
   void testPartStability() {
     final int PARTS = 5;
@@ -1,4 +1,4 @@
-# Copyright (c) 2020, NVIDIA CORPORATION.
+# Copyright (c) 2020-2022, NVIDIA CORPORATION.
 
 from libc.stdint cimport uint8_t
 from libcpp cimport bool
@@ -9,7 +9,7 @@ from libcpp.vector cimport vector
 
 cimport cudf._lib.cpp.io.types as cudf_io_types
 cimport cudf._lib.cpp.table.table_view as cudf_table_view
-from cudf._lib.cpp.types cimport data_type, size_type
+from cudf._lib.cpp.types cimport data_type
 
 
 cdef extern from "cudf/io/json.hpp" \
@@ -20,8 +20,8 @@ cdef extern from "cudf/io/json.hpp" \
         cudf_io_types.source_info get_source() except+
         vector[string] get_dtypes() except+
         cudf_io_types.compression_type get_compression() except +
-        size_type get_byte_range_offset() except+
-        size_type get_byte_range_size() except+
+        size_t get_byte_range_offset() except+
+        size_t get_byte_range_size() except+
         bool is_enabled_lines() except+
         bool is_enabled_dayfirst() except+
 
@@ -31,8 +31,8 @@ cdef extern from "cudf/io/json.hpp" \
         void set_compression(
             cudf_io_types.compression_type compression
         ) except+
-        void set_byte_range_offset(size_type offset) except+
-        void set_byte_range_size(size_type size) except+
+        void set_byte_range_offset(size_t offset) except+
+        void set_byte_range_size(size_t size) except+
         void enable_lines(bool val) except+
         void enable_dayfirst(bool val) except+
 
@@ -59,10 +59,10 @@ cdef extern from "cudf/io/json.hpp" \
             cudf_io_types.compression_type compression
         ) except+
         json_reader_options_builder& byte_range_offset(
-            size_type offset
+            size_t offset
         ) except+
         json_reader_options_builder& byte_range_size(
-            size_type size
+            size_t size
         ) except+
         json_reader_options_builder& lines(
             bool val
@@ -1,4 +1,4 @@
-# Copyright (c) 2020, NVIDIA CORPORATION.
+# Copyright (c) 2020-2022, NVIDIA CORPORATION.
 
 from libc.stdint cimport uint8_t
 from libcpp cimport bool
@@ -32,6 +32,9 @@ cdef extern from "cudf/io/types.hpp" \
         BROTLI "cudf::io::compression_type::BROTLI"
         ZIP "cudf::io::compression_type::ZIP"
         XZ "cudf::io::compression_type::XZ"
+        ZSTD "cudf::io::compression_type::ZSTD"
+        LZ4 "cudf::io::compression_type::LZ4"
+        ZLIB "cudf::io::compression_type::ZLIB"
 
     ctypedef enum io_type:
         FILEPATH "cudf::io::io_type::FILEPATH"
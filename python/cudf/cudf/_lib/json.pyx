@@ -1,4 +1,4 @@
-# Copyright (c) 2019-2020, NVIDIA CORPORATION.
+# Copyright (c) 2019-2022, NVIDIA CORPORATION.
 
 # cython: boundscheck = False
 
@@ -21,7 +21,7 @@ from cudf._lib.cpp.io.json cimport (
     json_reader_options,
     read_json as libcudf_read_json,
 )
-from cudf._lib.cpp.types cimport data_type, size_type, type_id
+from cudf._lib.cpp.types cimport data_type, type_id
 from cudf._lib.io.utils cimport make_source_info
 from cudf._lib.types cimport dtype_to_data_type
 from cudf._lib.utils cimport data_from_unique_ptr
@@ -57,10 +57,10 @@ cpdef read_json(object filepaths_or_buffers,
     cdef map[string, data_type] c_dtypes_map
     cdef cudf_io_types.compression_type c_compression
     # Determine byte read offsets if applicable
-    cdef size_type c_range_offset = (
+    cdef size_t c_range_offset = (
         byte_range[0] if byte_range is not None else 0
     )
-    cdef size_type c_range_size = (
+    cdef size_t c_range_size = (
         byte_range[1] if byte_range is not None else 0
     )
     cdef bool c_lines = lines